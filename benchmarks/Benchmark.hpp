@@ -0,0 +1,294 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BENCHMARK_HPP
+#define EL_BENCHMARK_HPP
+
+#include <El.hpp>
+#include <fstream>
+
+// A small harness shared by the benchmark drivers. Each driver reads the
+// common options, builds a grid, times its kernels with Time (after the
+// requested number of untimed warmup runs) and emits one JSON record per
+// configuration, e.g.,
+//
+//   {"benchmark":"Gemm","type":"double","version":"0.1","git":"...",
+//    "grid":{"size":4,"height":2,"width":2,"order":"column-major"},
+//    "blocksize":128,"scaling":"strong","params":{"m":4000,...},
+//    "reps":5,"warmups":1,"time":{"min":...,"median":...,...},
+//    "gflops":...,"bandwidth":...}
+//
+// The records are written by the root process as JSON lines, either to
+// standard output or appended to the file given by --json, so that the
+// output of several runs (e.g., of the scaling driver scaling.py) may simply
+// be concatenated. The rates, in GFlop/s and GB/s, are computed from the
+// median time.
+
+namespace El {
+namespace bench {
+
+struct Options
+{
+    Int warmups=1;
+    Int reps=5;
+    // "strong" keeps the problem sizes fixed as the number of processes
+    // varies, whereas "weak" scales each dimension by p^weakExponent, which,
+    // for the default exponent of one half, keeps the memory per process of
+    // dense matrices fixed
+    string scaling="strong";
+    double weakExponent=0.5;
+    string jsonFile="";
+    int gridHeight=0;
+    bool colMajor=true;
+};
+
+// Query the options common to all of the benchmarks; this must precede the
+// call to ProcessInput
+inline Options CommonInput()
+{
+    Options opts;
+    opts.warmups = Input("--warmups","number of untimed runs",opts.warmups);
+    opts.reps = Input("--reps","number of timed runs",opts.reps);
+    opts.scaling = Input("--scaling","strong or weak",opts.scaling);
+    opts.weakExponent =
+      Input("--weakExponent","weak scaling exponent",opts.weakExponent);
+    opts.jsonFile =
+      Input("--json","file to append records to (stdout if empty)",
+            opts.jsonFile);
+    opts.gridHeight =
+      Input("--gridHeight","height of process grid (0 for default)",
+            opts.gridHeight);
+    opts.colMajor = Input("--colMajor","column-major ordering?",opts.colMajor);
+    return opts;
+}
+
+inline unique_ptr<Grid> MakeGrid( const Options& opts, mpi::Comm comm )
+{
+    if( opts.scaling != "strong" && opts.scaling != "weak" )
+        LogicError("Invalid scaling type: ",opts.scaling);
+    if( opts.reps < 1 )
+        LogicError("At least one timed run is required");
+    const int commSize = mpi::Size( comm );
+    const int gridHeight =
+      ( opts.gridHeight == 0 ? Grid::DefaultHeight(commSize)
+                             : opts.gridHeight );
+    const GridOrder order = ( opts.colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+    return unique_ptr<Grid>( new Grid( comm, gridHeight, order ) );
+}
+
+// The problem dimension to use on the given grid
+inline Int ScaledSize( Int n, const Options& opts, const Grid& g )
+{
+    if( opts.scaling != "weak" )
+        return n;
+    return Int( Round( n*Pow( double(g.Size()), opts.weakExponent ) ) );
+}
+
+// Run setup() followed by op() for each of the warmup and timed runs,
+// returning the timings of the latter. Only op() is timed; it is bracketed
+// by barriers and each time is the maximum over the processes.
+template<class SetupType,class OpType>
+vector<double> Time
+( const Grid& g,
+  const Options& opts,
+  const SetupType& setup,
+  const OpType& op )
+{
+    EL_DEBUG_CSE
+    vector<double> times;
+    Timer timer;
+    for( Int run=0; run<opts.warmups+opts.reps; ++run )
+    {
+        setup();
+        mpi::Barrier( g.Comm() );
+        timer.Start();
+        op();
+        mpi::Barrier( g.Comm() );
+        const double time = mpi::AllReduce( timer.Stop(), mpi::MAX, g.Comm() );
+        if( run >= opts.warmups )
+            times.push_back( time );
+    }
+    return times;
+}
+
+// Time an operation which does not require any setup between runs
+template<class OpType>
+vector<double> Time( const Grid& g, const Options& opts, const OpType& op )
+{ return Time( g, opts, [](){}, op ); }
+
+struct Statistics
+{
+    double min=0, max=0, mean=0, median=0, stdDev=0;
+};
+
+inline Statistics ComputeStatistics( vector<double> times )
+{
+    Statistics stats;
+    const Int numTimes = times.size();
+    if( numTimes == 0 )
+        return stats;
+    std::sort( times.begin(), times.end() );
+    stats.min = times.front();
+    stats.max = times.back();
+    stats.median =
+      ( numTimes % 2 == 1 ? times[numTimes/2]
+                          : (times[numTimes/2-1]+times[numTimes/2])/2 );
+    for( const double time : times )
+        stats.mean += time;
+    stats.mean /= numTimes;
+    for( const double time : times )
+        stats.stdDev += (time-stats.mean)*(time-stats.mean);
+    stats.stdDev = Sqrt( stats.stdDev/numTimes );
+    return stats;
+}
+
+inline string Quote( const string& str )
+{
+    string quoted = "\"";
+    for( const char c : str )
+    {
+        if( c == '"' || c == '\\' )
+            quoted += '\\';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+inline string ToJSON( double value )
+{
+    // JSON has no representation of infinities or NaNs
+    if( !std::isfinite(value) )
+        return "null";
+    std::ostringstream os;
+    os.precision( 8 );
+    os << value;
+    return os.str();
+}
+
+// Parse a comma-separated list of integers, e.g., "500,1000,2000"
+inline vector<Int> ParseList( const string& list )
+{
+    vector<Int> values;
+    std::istringstream is( list );
+    string token;
+    while( std::getline( is, token, ',' ) )
+        if( !token.empty() )
+            values.push_back( std::stoll(token) );
+    return values;
+}
+
+// The number of real flops performed by an operation of the given type
+// which requires 'realFlops' flops in real arithmetic
+template<typename T>
+double Flops( double realFlops )
+{ return IsComplex<T>::value ? 4*realFlops : realFlops; }
+
+// A single JSON record
+class Record
+{
+public:
+    Record( const string& name, const Grid& g, const Options& opts )
+    : name_(name), grid_(&g), opts_(opts)
+    { }
+
+    void Set( const string& key, const string& value )
+    { params_.emplace_back( key, Quote(value) ); }
+    void Set( const string& key, const char* value )
+    { Set( key, string(value) ); }
+    void Set( const string& key, Int value )
+    { params_.emplace_back( key, std::to_string(value) ); }
+    void Set( const string& key, double value )
+    { params_.emplace_back( key, ToJSON(value) ); }
+    void Set( const string& key, bool value )
+    { params_.emplace_back( key, value ? "true" : "false" ); }
+
+    template<typename T>
+    void SetType() { typeName_ = TypeName<T>(); }
+
+    // Write the record given the times of the timed runs, the number of
+    // flops per run, and the number of bytes moved per run (either of the
+    // latter two may be zero, in which case the rate is omitted). Records
+    // without any times (e.g., fitted models) only contain the parameters.
+    void Emit
+    ( const vector<double>& times=vector<double>(),
+      double flops=0, double bytes=0 ) const
+    {
+        EL_DEBUG_CSE
+        if( grid_->Rank() != 0 )
+            return;
+        const Statistics stats = ComputeStatistics( times );
+
+        std::ostringstream os;
+        os << "{\"benchmark\":" << Quote(name_)
+           << ",\"type\":" << Quote(typeName_)
+           << ",\"version\":"
+           << Quote(string(EL_VERSION_MAJOR)+"."+EL_VERSION_MINOR)
+           << ",\"git\":" << Quote(EL_GIT_SHA1)
+           << ",\"buildType\":" << Quote(EL_CMAKE_BUILD_TYPE)
+           << ",\"grid\":{\"size\":" << grid_->Size()
+           << ",\"height\":" << grid_->Height()
+           << ",\"width\":" << grid_->Width()
+           << ",\"order\":"
+           << Quote(grid_->Order()==COLUMN_MAJOR ? "column-major"
+                                                 : "row-major")
+           << "},\"blocksize\":" << Blocksize()
+           << ",\"scaling\":" << Quote(opts_.scaling)
+           << ",\"params\":{";
+        for( size_t j=0; j<params_.size(); ++j )
+        {
+            if( j != 0 )
+                os << ",";
+            os << Quote(params_[j].first) << ":" << params_[j].second;
+        }
+        os << "}";
+        if( !times.empty() )
+        {
+            os << ",\"reps\":" << times.size()
+               << ",\"warmups\":" << opts_.warmups
+               << ",\"time\":{\"min\":" << ToJSON(stats.min)
+               << ",\"median\":" << ToJSON(stats.median)
+               << ",\"mean\":" << ToJSON(stats.mean)
+               << ",\"max\":" << ToJSON(stats.max)
+               << ",\"stdDev\":" << ToJSON(stats.stdDev) << "}";
+            if( flops > 0 )
+                os << ",\"gflops\":" << ToJSON(flops/(1.e9*stats.median));
+            if( bytes > 0 )
+                os << ",\"bandwidth\":"
+                   << ToJSON(bytes/(1.e9*stats.median));
+        }
+        os << "}";
+
+        if( opts_.jsonFile.empty() )
+        {
+            cout << os.str() << endl;
+        }
+        else
+        {
+            std::ofstream file( opts_.jsonFile.c_str(), std::ios::app );
+            if( !file.is_open() )
+                RuntimeError("Could not open ",opts_.jsonFile);
+            file << os.str() << endl;
+            if( !times.empty() )
+                Output
+                (name_," (",typeName_,"): median of ",stats.median,
+                 " seconds");
+        }
+    }
+
+private:
+    string name_;
+    string typeName_="";
+    const Grid* grid_;
+    Options opts_;
+    vector<pair<string,string>> params_;
+};
+
+} // namespace bench
+} // namespace El
+
+#endif // ifndef EL_BENCHMARK_HPP
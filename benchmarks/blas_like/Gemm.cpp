@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+const GemmAlgorithm algs[] =
+  { GEMM_DEFAULT, GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_C, GEMM_SUMMA_DOT,
+    GEMM_CANNON, GEMM_SUMMA_A_PIPELINED, GEMM_SUMMA_B_PIPELINED,
+    GEMM_SUMMA_C_PIPELINED, GEMM_25D, GEMM_3D };
+const char* algNames[] =
+  { "default", "SUMMA_A", "SUMMA_B", "SUMMA_C", "SUMMA_DOT", "Cannon",
+    "SUMMA_A_pipelined", "SUMMA_B_pipelined", "SUMMA_C_pipelined", "2.5D",
+    "3D" };
+const Int numAlgs = 11;
+
+template<typename T>
+void Benchmark
+( const Grid& g, const bench::Options& opts, Int m, Int n, Int k, Int alg )
+{
+    DistMatrix<T> A(g), B(g), C(g);
+    Uniform( A, m, k );
+    Uniform( B, k, n );
+    Uniform( C, m, n );
+    const double flops = bench::Flops<T>( 2.*double(m)*double(n)*double(k) );
+
+    for( Int j=0; j<numAlgs; ++j )
+    {
+        if( alg >= 0 && alg != j )
+            continue;
+        // The Cannon and dot-product variants require particular shapes
+        if( algs[j] == GEMM_CANNON && g.Height() != g.Width() )
+            continue;
+        auto times = bench::Time( g, opts, [&]()
+          { Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C, algs[j] ); } );
+
+        bench::Record record( "Gemm", g, opts );
+        record.SetType<T>();
+        record.Set( "algorithm", algNames[j] );
+        record.Set( "m", m );
+        record.Set( "n", n );
+        record.Set( "k", k );
+        record.Emit( times, flops );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        auto opts = bench::CommonInput();
+        const Int m0 = Input("--m","height of result",2000);
+        const Int n0 = Input("--n","width of result",2000);
+        const Int k0 = Input("--k","inner dimension",2000);
+        const Int nb = Input("--nb","algorithmic blocksize",128);
+        const Int alg =
+          Input("--alg","algorithm index (-1 for all; see algNames)",-1);
+        const bool complex = Input("--complex","use complex data?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        auto gridPtr = bench::MakeGrid( opts, comm );
+        const Grid& g = *gridPtr;
+        SetBlocksize( nb );
+        const Int m = bench::ScaledSize( m0, opts, g );
+        const Int n = bench::ScaledSize( n0, opts, g );
+        const Int k = bench::ScaledSize( k0, opts, g );
+        if( complex )
+            Benchmark<Complex<double>>( g, opts, m, n, k, alg );
+        else
+            Benchmark<double>( g, opts, m, n, k, alg );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename T>
+void Benchmark
+( const Grid& g, const bench::Options& opts, Int n, Int k, UpperOrLower uplo,
+  Orientation orientation )
+{
+    DistMatrix<T> A(g), C(g);
+    if( orientation == NORMAL )
+        Uniform( A, n, k );
+    else
+        Uniform( A, k, n );
+    Uniform( C, n, n );
+    // Only one triangle of C is updated
+    const double flops = bench::Flops<T>( double(n)*double(n)*double(k) );
+
+    auto times = bench::Time( g, opts, [&]()
+      { Herk( uplo, orientation, Base<T>(1), A, Base<T>(0), C ); } );
+
+    bench::Record record( "Herk", g, opts );
+    record.SetType<T>();
+    record.Set( "uplo", uplo == LOWER ? "lower" : "upper" );
+    record.Set( "orientation", orientation == NORMAL ? "normal" : "adjoint" );
+    record.Set( "n", n );
+    record.Set( "k", k );
+    record.Emit( times, flops );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        auto opts = bench::CommonInput();
+        const Int n0 = Input("--n","size of C",2000);
+        const Int k0 = Input("--k","inner dimension",2000);
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const char orientChar = Input("--orient","orientation of A: N/C",'N');
+        const Int nb = Input("--nb","algorithmic blocksize",128);
+        const bool complex = Input("--complex","use complex data?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        const Orientation orientation = CharToOrientation( orientChar );
+        auto gridPtr = bench::MakeGrid( opts, comm );
+        const Grid& g = *gridPtr;
+        SetBlocksize( nb );
+        const Int n = bench::ScaledSize( n0, opts, g );
+        const Int k = bench::ScaledSize( k0, opts, g );
+        if( complex )
+            Benchmark<Complex<double>>( g, opts, n, k, uplo, orientation );
+        else
+            Benchmark<double>( g, opts, n, k, uplo, orientation );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+const TrsmAlgorithm algs[] =
+  { TRSM_DEFAULT, TRSM_LARGE, TRSM_MEDIUM, TRSM_SMALL, TRSM_INVERSE };
+const char* algNames[] = { "default", "large", "medium", "small", "inverse" };
+const Int numAlgs = 5;
+
+template<typename F>
+void Benchmark
+( const Grid& g, const bench::Options& opts, Int m, Int n, Int alg )
+{
+    // Solve against a well-conditioned lower triangle from the left
+    DistMatrix<F> A(g), B(g), BOrig(g);
+    Uniform( A, m, m );
+    ShiftDiagonal( A, F(m) );
+    MakeTrapezoidal( LOWER, A );
+    Uniform( BOrig, m, n );
+    const double flops = bench::Flops<F>( double(m)*double(m)*double(n) );
+
+    for( Int j=0; j<numAlgs; ++j )
+    {
+        if( alg >= 0 && alg != j )
+            continue;
+        auto times = bench::Time
+          ( g, opts,
+            [&]() { B = BOrig; },
+            [&]()
+            { Trsm
+              ( LEFT, LOWER, NORMAL, NON_UNIT, F(1), A, B, false, algs[j] ); }
+          );
+
+        bench::Record record( "Trsm", g, opts );
+        record.SetType<F>();
+        record.Set( "algorithm", algNames[j] );
+        record.Set( "m", m );
+        record.Set( "n", n );
+        record.Emit( times, flops );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        auto opts = bench::CommonInput();
+        const Int m0 = Input("--m","height of B",2000);
+        const Int n0 = Input("--n","width of B",2000);
+        const Int nb = Input("--nb","algorithmic blocksize",128);
+        const Int alg =
+          Input("--alg","algorithm index (-1 for all; see algNames)",-1);
+        const bool complex = Input("--complex","use complex data?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        auto gridPtr = bench::MakeGrid( opts, comm );
+        const Grid& g = *gridPtr;
+        SetBlocksize( nb );
+        const Int m = bench::ScaledSize( m0, opts, g );
+        const Int n = bench::ScaledSize( n0, opts, g );
+        if( complex )
+            Benchmark<Complex<double>>( g, opts, m, n, alg );
+        else
+            Benchmark<double>( g, opts, m, n, alg );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// Time the redistribution of an [MC,MR] matrix into a [U,V] matrix. The
+// bandwidth is measured in terms of the size of the (global) matrix.
+template<typename T,Dist U,Dist V>
+void BenchmarkRedist
+( const DistMatrix<T>& A, const bench::Options& opts, Int m, Int n )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<T,U,V> B(g);
+    auto times = bench::Time( g, opts, [&]() { B = A; } );
+
+    bench::Record record( "Copy", g, opts );
+    record.SetType<T>();
+    record.Set( "source", "[MC,MR]" );
+    record.Set
+    ( "target", BuildString("[",DistToString(U),",",DistToString(V),"]") );
+    record.Set( "m", m );
+    record.Set( "n", n );
+    record.Emit( times, 0, double(m)*double(n)*sizeof(T) );
+}
+
+template<typename T>
+void Benchmark( const Grid& g, const bench::Options& opts, Int m, Int n )
+{
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+
+    BenchmarkRedist<T,MC,  MR  >( A, opts, m, n );
+    BenchmarkRedist<T,MC,  STAR>( A, opts, m, n );
+    BenchmarkRedist<T,STAR,MR  >( A, opts, m, n );
+    BenchmarkRedist<T,MR,  MC  >( A, opts, m, n );
+    BenchmarkRedist<T,MR,  STAR>( A, opts, m, n );
+    BenchmarkRedist<T,STAR,MC  >( A, opts, m, n );
+    BenchmarkRedist<T,VC,  STAR>( A, opts, m, n );
+    BenchmarkRedist<T,STAR,VC  >( A, opts, m, n );
+    BenchmarkRedist<T,VR,  STAR>( A, opts, m, n );
+    BenchmarkRedist<T,STAR,VR  >( A, opts, m, n );
+    BenchmarkRedist<T,MD,  STAR>( A, opts, m, n );
+    BenchmarkRedist<T,STAR,STAR>( A, opts, m, n );
+    BenchmarkRedist<T,CIRC,CIRC>( A, opts, m, n );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        auto opts = bench::CommonInput();
+        const Int m0 = Input("--m","height of matrix",4000);
+        const Int n0 = Input("--n","width of matrix",4000);
+        const bool complex = Input("--complex","use complex data?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        auto gridPtr = bench::MakeGrid( opts, comm );
+        const Grid& g = *gridPtr;
+        const Int m = bench::ScaledSize( m0, opts, g );
+        const Int n = bench::ScaledSize( n0, opts, g );
+        if( complex )
+            Benchmark<Complex<double>>( g, opts, m, n );
+        else
+            Benchmark<double>( g, opts, m, n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
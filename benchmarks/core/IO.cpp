@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename T>
+void EmitIO
+( const Grid& g, const bench::Options& opts, const vector<double>& times,
+  const string& operation, const string& format, bool sequential,
+  Int m, Int n )
+{
+    bench::Record record( "IO", g, opts );
+    record.SetType<T>();
+    record.Set( "operation", operation );
+    record.Set( "format", format );
+    record.Set( "sequential", sequential );
+    record.Set( "m", m );
+    record.Set( "n", n );
+    record.Emit( times, 0, double(m)*double(n)*sizeof(T) );
+}
+
+template<typename T>
+void Benchmark
+( const Grid& g, const bench::Options& opts, Int m, Int n,
+  const string& basename )
+{
+    DistMatrix<T> A(g), B(g);
+    Uniform( A, m, n );
+
+    // Binary files (with and without a header), written collectively and
+    // read back both collectively and through the root
+    for( const FileFormat format : { BINARY, BINARY_FLAT } )
+    {
+        const string formatName = FileExtension( format );
+        const string filename = basename + "." + formatName;
+        auto times = bench::Time
+          ( g, opts, [&]() { Write( A, basename, format ); } );
+        EmitIO<T>( g, opts, times, "write", formatName, false, m, n );
+
+        for( const bool sequential : { false, true } )
+        {
+            times = bench::Time
+              ( g, opts,
+                [&]() { B.Resize( m, n ); },
+                [&]() { Read( B, filename, format, sequential ); } );
+            EmitIO<T>( g, opts, times, "read", formatName, sequential, m, n );
+        }
+        mpi::Barrier( g.Comm() );
+        if( g.Rank() == 0 )
+            std::remove( filename.c_str() );
+    }
+
+    // Sharded checkpoints
+    auto times = bench::Time
+      ( g, opts, [&]() { WriteCheckpoint( A, basename ); } );
+    EmitIO<T>( g, opts, times, "write", "checkpoint", false, m, n );
+    times = bench::Time
+      ( g, opts, [&]() { ReadCheckpoint( B, basename ); } );
+    EmitIO<T>( g, opts, times, "read", "checkpoint", false, m, n );
+    mpi::Barrier( g.Comm() );
+    if( g.Rank() == 0 )
+    {
+        std::remove( (basename+".ckpt").c_str() );
+        for( int shard=0; shard<g.Size(); ++shard )
+            std::remove( (basename+".ckpt."+std::to_string(shard)).c_str() );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        auto opts = bench::CommonInput();
+        const Int m0 = Input("--m","height of matrix",4000);
+        const Int n0 = Input("--n","width of matrix",4000);
+        const string basename =
+          Input("--basename","base of the scratch file names",
+                string("IOBenchmark"));
+        const bool complex = Input("--complex","use complex data?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        auto gridPtr = bench::MakeGrid( opts, comm );
+        const Grid& g = *gridPtr;
+        const Int m = bench::ScaledSize( m0, opts, g );
+        const Int n = bench::ScaledSize( n0, opts, g );
+        if( complex )
+            Benchmark<Complex<double>>( g, opts, m, n, basename );
+        else
+            Benchmark<double>( g, opts, m, n, basename );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,366 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// Sweep every [U,V] -> [W,X] redistribution between the fourteen elemental
+// distributions, as well as the underlying collectives over the column, row,
+// and full communicators, across problem sizes and grid shapes. For each
+// pair (and collective) on each grid, the median times t are fit to the
+// alpha-beta model
+//
+//   t(s) = alpha + beta s,
+//
+// where s is the number of bytes per process, and the gamma of the machine
+// (the time per flop of a local Gemm and the time per byte of a local copy,
+// which bound the packing costs) is measured separately. The fits are
+// emitted as "RedistributionModel" and "CollectiveModel" records, and the
+// fit of the all-gather over the full grid can be saved in the format of
+// LoadGemmCostModel for use by the Gemm algorithm selector.
+
+const Dist colDists[] =
+  { CIRC, MC, MC, MD, MR, MR, STAR, STAR, STAR, STAR, STAR, STAR, VC, VR };
+const Dist rowDists[] =
+  { CIRC, MR, STAR, STAR, MC, STAR, MC, MD, MR, STAR, VC, VR, STAR, STAR };
+const Int numDists = 14;
+
+template<typename T>
+unique_ptr<ElementalMatrix<T>>
+MakeDistMatrix( const Grid& g, Dist colDist, Dist rowDist )
+{
+    #define GUARD(CDIST,RDIST,WRAP) \
+      colDist == CDIST && rowDist == RDIST && ELEMENT == WRAP
+    #define PAYLOAD(CDIST,RDIST,WRAP) \
+      return unique_ptr<ElementalMatrix<T>>( new DistMatrix<T,CDIST,RDIST>(g) );
+    #include <El/macros/GuardAndPayload.h>
+    LogicError("Invalid distribution");
+    return unique_ptr<ElementalMatrix<T>>();
+}
+
+string DistPairString( Dist colDist, Dist rowDist )
+{ return BuildString("[",DistToString(colDist),",",DistToString(rowDist),"]"); }
+
+struct AlphaBetaFit
+{
+    double alpha=0, beta=0, r2=0;
+};
+
+// The least-squares fit of t = alpha + beta s, constrained to nonnegative
+// parameters
+AlphaBetaFit FitAlphaBeta( const vector<double>& s, const vector<double>& t )
+{
+    AlphaBetaFit fit;
+    const Int numPoints = s.size();
+    if( numPoints == 0 )
+        return fit;
+    double sMean=0, tMean=0;
+    for( Int j=0; j<numPoints; ++j )
+    {
+        sMean += s[j];
+        tMean += t[j];
+    }
+    sMean /= numPoints;
+    tMean /= numPoints;
+    double sVar=0, stCov=0, tVar=0;
+    for( Int j=0; j<numPoints; ++j )
+    {
+        sVar += (s[j]-sMean)*(s[j]-sMean);
+        stCov += (s[j]-sMean)*(t[j]-tMean);
+        tVar += (t[j]-tMean)*(t[j]-tMean);
+    }
+
+    fit.beta = ( sVar > 0 ? Max(stCov/sVar,0.) : 0. );
+    fit.alpha = tMean - fit.beta*sMean;
+    if( fit.alpha < 0 )
+    {
+        // Refit through the origin
+        double sSq=0, st=0;
+        for( Int j=0; j<numPoints; ++j )
+        {
+            sSq += s[j]*s[j];
+            st += s[j]*t[j];
+        }
+        fit.alpha = 0;
+        fit.beta = ( sSq > 0 ? st/sSq : 0. );
+    }
+
+    double residSq = 0;
+    for( Int j=0; j<numPoints; ++j )
+    {
+        const double resid = t[j] - (fit.alpha+fit.beta*s[j]);
+        residSq += resid*resid;
+    }
+    fit.r2 = ( tVar > 0 ? 1-residSq/tVar : 1. );
+    return fit;
+}
+
+void EmitFit
+( bench::Record& record, const AlphaBetaFit& fit, double gammaFlop,
+  double gammaCopy )
+{
+    record.Set( "alpha", fit.alpha );
+    record.Set( "beta", fit.beta );
+    record.Set( "gammaFlop", gammaFlop );
+    record.Set( "gammaCopy", gammaCopy );
+    record.Set( "r2", fit.r2 );
+    record.Emit();
+}
+
+// The time per flop of a moderately-sized local Gemm and the time per byte
+// of a large local copy (the maximum over the grid)
+void MeasureGamma( const Grid& g, double& gammaFlop, double& gammaCopy )
+{
+    const Int nLoc = 256;
+    vector<double> A(nLoc*nLoc,1.), B(nLoc*nLoc,1.), C(nLoc*nLoc,0.);
+    Timer timer;
+    timer.Start();
+    blas::Gemm
+    ( 'N', 'N', nLoc, nLoc, nLoc,
+      1., A.data(), nLoc, B.data(), nLoc, 0., C.data(), nLoc );
+    gammaFlop = timer.Stop() / (2.*nLoc*nLoc*nLoc);
+
+    const Int numEntries = 1 << 22;
+    vector<double> source(numEntries,1.), target(numEntries);
+    timer.Start();
+    MemCopy( target.data(), source.data(), numEntries );
+    gammaCopy = timer.Stop() / (numEntries*sizeof(double));
+
+    gammaFlop = mpi::AllReduce( gammaFlop, mpi::MAX, g.Comm() );
+    gammaCopy = mpi::AllReduce( gammaCopy, mpi::MAX, g.Comm() );
+}
+
+template<typename T>
+void BenchmarkRedistributions
+( const Grid& g, const bench::Options& opts, const vector<Int>& sizes,
+  double gammaFlop, double gammaCopy )
+{
+    for( Int source=0; source<numDists; ++source )
+    {
+        const Dist U = colDists[source], V = rowDists[source];
+        for( Int target=0; target<numDists; ++target )
+        {
+            const Dist W = colDists[target], X = rowDists[target];
+            vector<double> bytesPerProc, medians;
+            for( const Int n : sizes )
+            {
+                auto A = MakeDistMatrix<T>( g, U, V );
+                auto B = MakeDistMatrix<T>( g, W, X );
+                Uniform( *A, n, n );
+                auto times = bench::Time( g, opts, [&]() { Copy( *A, *B ); } );
+
+                const double bytes = double(n)*double(n)*sizeof(T);
+                bench::Record record( "Redistribution", g, opts );
+                record.SetType<T>();
+                record.Set( "source", DistPairString(U,V) );
+                record.Set( "target", DistPairString(W,X) );
+                record.Set( "n", n );
+                record.Emit( times, 0, bytes );
+
+                bytesPerProc.push_back( bytes/g.Size() );
+                medians.push_back( bench::ComputeStatistics(times).median );
+            }
+
+            bench::Record record( "RedistributionModel", g, opts );
+            record.SetType<T>();
+            record.Set( "source", DistPairString(U,V) );
+            record.Set( "target", DistPairString(W,X) );
+            EmitFit
+            ( record, FitAlphaBeta(bytesPerProc,medians), gammaFlop,
+              gammaCopy );
+        }
+    }
+}
+
+// Time the given collective with each process contributing 'count' entries
+template<typename T>
+vector<double> TimeCollective
+( const Grid& g, const bench::Options& opts, const string& collective,
+  mpi::Comm comm, Int count )
+{
+    const int commSize = mpi::Size( comm );
+    const int perPeer = Max( count/commSize, Int(1) );
+    vector<T> sendBuf, recvBuf;
+    if( collective == "AllGather" )
+    {
+        sendBuf.resize( count, T(1) );
+        recvBuf.resize( count*commSize );
+        return bench::Time( g, opts, [&]()
+          { mpi::AllGather
+            ( sendBuf.data(), count, recvBuf.data(), count, comm ); } );
+    }
+    else if( collective == "AllToAll" )
+    {
+        sendBuf.resize( perPeer*commSize, T(1) );
+        recvBuf.resize( perPeer*commSize );
+        return bench::Time( g, opts, [&]()
+          { mpi::AllToAll
+            ( sendBuf.data(), perPeer, recvBuf.data(), perPeer, comm ); } );
+    }
+    else if( collective == "ReduceScatter" )
+    {
+        sendBuf.resize( perPeer*commSize, T(1) );
+        recvBuf.resize( perPeer );
+        return bench::Time( g, opts, [&]()
+          { mpi::ReduceScatter
+            ( sendBuf.data(), recvBuf.data(), perPeer, comm ); } );
+    }
+    else if( collective == "AllReduce" )
+    {
+        sendBuf.resize( count, T(1) );
+        return bench::Time( g, opts, [&]()
+          { mpi::AllReduce( sendBuf.data(), count, comm ); } );
+    }
+    else if( collective == "Broadcast" )
+    {
+        sendBuf.resize( count, T(1) );
+        return bench::Time( g, opts, [&]()
+          { mpi::Broadcast( sendBuf.data(), count, 0, comm ); } );
+    }
+    LogicError("Unknown collective ",collective);
+    return vector<double>();
+}
+
+// Returns the fit of the all-gather over the full grid
+template<typename T>
+AlphaBetaFit BenchmarkCollectives
+( const Grid& g, const bench::Options& opts, const vector<Int>& counts,
+  double gammaFlop, double gammaCopy )
+{
+    const char* commNames[] = { "MC", "MR", "VC" };
+    const mpi::Comm comms[] = { g.MCComm(), g.MRComm(), g.VCComm() };
+    const char* collectives[] =
+      { "AllGather", "AllToAll", "ReduceScatter", "AllReduce", "Broadcast" };
+
+    AlphaBetaFit gridGatherFit;
+    for( Int c=0; c<3; ++c )
+    {
+        for( const string collective : collectives )
+        {
+            vector<double> bytesPerProc, medians;
+            for( const Int count : counts )
+            {
+                auto times =
+                  TimeCollective<T>( g, opts, collective, comms[c], count );
+                const double bytes = double(count)*sizeof(T);
+
+                bench::Record record( "Collective", g, opts );
+                record.SetType<T>();
+                record.Set( "collective", collective );
+                record.Set( "comm", commNames[c] );
+                record.Set( "count", count );
+                record.Emit( times, 0, bytes );
+
+                bytesPerProc.push_back( bytes );
+                medians.push_back( bench::ComputeStatistics(times).median );
+            }
+
+            const AlphaBetaFit fit = FitAlphaBeta( bytesPerProc, medians );
+            if( c == 2 && collective == "AllGather" )
+                gridGatherFit = fit;
+            bench::Record record( "CollectiveModel", g, opts );
+            record.SetType<T>();
+            record.Set( "collective", collective );
+            record.Set( "comm", commNames[c] );
+            record.Set( "commSize", Int(mpi::Size(comms[c])) );
+            EmitFit( record, fit, gammaFlop, gammaCopy );
+        }
+    }
+    return gridGatherFit;
+}
+
+// Convert the fit of an all-gather over p processes, where each process
+// contributes s bytes and receives (p-1) s bytes over ceil(log2(p)) stages,
+// into the per-message and per-byte costs of the Gemm cost model
+GemmCostModel GemmModelFromFit
+( const AlphaBetaFit& gatherFit, Int p, double gammaFlop )
+{
+    GemmCostModel model;
+    double numStages = 0;
+    for( Int q=1; q<p; q*=2 )
+        ++numStages;
+    if( p > 1 )
+    {
+        model.latency = gatherFit.alpha / numStages;
+        model.inverseBandwidth = gatherFit.beta / (p-1);
+    }
+    model.flopTime = gammaFlop;
+    model.calibrated = true;
+    return model;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        auto opts = bench::CommonInput();
+        const string sizeList =
+          Input("--sizes","matrix sizes",string("250,500,1000,2000"));
+        const string countList =
+          Input("--counts","entries per process for the collectives",
+                string("1,64,1024,16384,262144"));
+        const string gridHeightList =
+          Input("--gridHeights","grid heights (all divisors if empty)",
+                string(""));
+        const bool redistributions =
+          Input("--redistributions","sweep the redistributions?",true);
+        const bool collectives =
+          Input("--collectives","sweep the collectives?",true);
+        const string gemmModelFile =
+          Input("--gemmModel","file to save the Gemm cost model to",
+                string(""));
+        ProcessInput();
+        PrintInputReport();
+
+        const vector<Int> sizes = bench::ParseList( sizeList );
+        const vector<Int> counts = bench::ParseList( countList );
+        const int commSize = mpi::Size( comm );
+        vector<Int> gridHeights = bench::ParseList( gridHeightList );
+        if( gridHeights.empty() )
+            for( int r=1; r<=commSize; ++r )
+                if( commSize % r == 0 )
+                    gridHeights.push_back( r );
+        const GridOrder order = ( opts.colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+
+        // The Gemm cost model is taken from the default grid shape
+        const Int defaultHeight = Grid::DefaultHeight( commSize );
+        for( const Int gridHeight : gridHeights )
+        {
+            if( commSize % gridHeight != 0 )
+                LogicError("Invalid grid height ",gridHeight);
+            const Grid g( comm, gridHeight, order );
+            double gammaFlop, gammaCopy;
+            MeasureGamma( g, gammaFlop, gammaCopy );
+            vector<Int> scaledSizes;
+            for( const Int n : sizes )
+                scaledSizes.push_back( bench::ScaledSize( n, opts, g ) );
+
+            if( redistributions )
+                BenchmarkRedistributions<double>
+                ( g, opts, scaledSizes, gammaFlop, gammaCopy );
+            if( collectives )
+            {
+                const AlphaBetaFit gatherFit = BenchmarkCollectives<double>
+                  ( g, opts, counts, gammaFlop, gammaCopy );
+                if( !gemmModelFile.empty() && gridHeight == defaultHeight )
+                {
+                    SetGemmCostModel
+                    ( GemmModelFromFit( gatherFit, commSize, gammaFlop ) );
+                    SaveGemmCostModel( gemmModelFile );
+                }
+            }
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void Benchmark
+( const Grid& g, const bench::Options& opts, Int n, UpperOrLower uplo )
+{
+    // Form the HPD matrix X^H X + n I
+    DistMatrix<F> X(g), A(g), AOrig(g);
+    Uniform( X, n, n );
+    Herk( uplo, ADJOINT, Base<F>(1), X, AOrig );
+    MakeHermitian( uplo, AOrig );
+    ShiftDiagonal( AOrig, F(n) );
+    const double flops = bench::Flops<F>( double(n)*double(n)*double(n)/3 );
+
+    auto times = bench::Time
+      ( g, opts,
+        [&]() { A = AOrig; },
+        [&]() { Cholesky( uplo, A ); } );
+
+    bench::Record record( "Cholesky", g, opts );
+    record.SetType<F>();
+    record.Set( "uplo", uplo == LOWER ? "lower" : "upper" );
+    record.Set( "n", n );
+    record.Emit( times, flops );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        auto opts = bench::CommonInput();
+        const Int n0 = Input("--n","size of matrix",4000);
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const Int nb = Input("--nb","algorithmic blocksize",128);
+        const bool complex = Input("--complex","use complex data?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        auto gridPtr = bench::MakeGrid( opts, comm );
+        const Grid& g = *gridPtr;
+        SetBlocksize( nb );
+        const Int n = bench::ScaledSize( n0, opts, g );
+        if( complex )
+            Benchmark<Complex<double>>( g, opts, n, uplo );
+        else
+            Benchmark<double>( g, opts, n, uplo );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void Benchmark
+( const Grid& g, const bench::Options& opts, Int n, UpperOrLower uplo,
+  bool vectors )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> A(g), AOrig(g), Q(g);
+    DistMatrix<Real,VR,STAR> w(g);
+    HermitianUniformSpectrum( AOrig, n, Real(-1), Real(1) );
+
+    // The nominal cost of the reduction to tridiagonal form and, if
+    // requested, of the back-transformation of the eigenvectors; the cost of
+    // the tridiagonal eigensolver itself depends upon the spectrum
+    double realFlops = 4.*double(n)*double(n)*double(n)/3;
+    if( vectors )
+        realFlops += 2.*double(n)*double(n)*double(n);
+    const double flops = bench::Flops<F>( realFlops );
+
+    auto setup = [&]() { A = AOrig; };
+    vector<double> times;
+    if( vectors )
+        times = bench::Time
+          ( g, opts, setup, [&]() { HermitianEig( uplo, A, w, Q ); } );
+    else
+        times = bench::Time
+          ( g, opts, setup, [&]() { HermitianEig( uplo, A, w ); } );
+
+    bench::Record record( "HermitianEig", g, opts );
+    record.SetType<F>();
+    record.Set( "uplo", uplo == LOWER ? "lower" : "upper" );
+    record.Set( "vectors", vectors );
+    record.Set( "n", n );
+    record.Emit( times, flops );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        auto opts = bench::CommonInput();
+        const Int n0 = Input("--n","size of matrix",2000);
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const bool vectors = Input("--vectors","compute eigenvectors?",true);
+        const Int nb = Input("--nb","algorithmic blocksize",128);
+        const bool complex = Input("--complex","use complex data?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        auto gridPtr = bench::MakeGrid( opts, comm );
+        const Grid& g = *gridPtr;
+        SetBlocksize( nb );
+        const Int n = bench::ScaledSize( n0, opts, g );
+        if( complex )
+            Benchmark<Complex<double>>( g, opts, n, uplo, vectors );
+        else
+            Benchmark<double>( g, opts, n, uplo, vectors );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void Benchmark
+( const Grid& g, const bench::Options& opts, Int n, const string& pivoting )
+{
+    DistMatrix<F> A(g), AOrig(g);
+    Uniform( AOrig, n, n );
+    DistPermutation P(g);
+    const double flops = bench::Flops<F>( 2.*double(n)*double(n)*double(n)/3 );
+
+    vector<double> times;
+    auto setup = [&]() { A = AOrig; };
+    if( pivoting == "none" )
+        times = bench::Time( g, opts, setup, [&]() { LU( A ); } );
+    else if( pivoting == "partial" )
+        times = bench::Time( g, opts, setup, [&]() { LU( A, P ); } );
+    else if( pivoting == "calu" )
+        times = bench::Time
+          ( g, opts, setup, [&]() { LU( A, P, LU_CALU ); } );
+    else
+        LogicError("Invalid pivoting type: ",pivoting);
+
+    bench::Record record( "LU", g, opts );
+    record.SetType<F>();
+    record.Set( "pivoting", pivoting );
+    record.Set( "n", n );
+    record.Emit( times, flops );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        auto opts = bench::CommonInput();
+        const Int n0 = Input("--n","size of matrix",4000);
+        const string pivoting =
+          Input("--pivoting","none, partial, calu, or all",string("all"));
+        const Int nb = Input("--nb","algorithmic blocksize",128);
+        const bool complex = Input("--complex","use complex data?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        auto gridPtr = bench::MakeGrid( opts, comm );
+        const Grid& g = *gridPtr;
+        SetBlocksize( nb );
+        const Int n = bench::ScaledSize( n0, opts, g );
+        for( const string type : { "none", "partial", "calu" } )
+        {
+            if( pivoting != "all" && pivoting != type )
+                continue;
+            if( complex )
+                Benchmark<Complex<double>>( g, opts, n, type );
+            else
+                Benchmark<double>( g, opts, n, type );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
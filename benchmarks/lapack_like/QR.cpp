@@ -0,0 +1,66 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void Benchmark( const Grid& g, const bench::Options& opts, Int m, Int n )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> A(g), AOrig(g);
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Real,MD,STAR> signature(g);
+    Uniform( AOrig, m, n );
+
+    // Householder QR requires 2 n^2 (m - n/3) flops when m >= n
+    const double mD = Max(m,n), nD = Min(m,n);
+    const double flops = bench::Flops<F>( 2.*nD*nD*(mD-nD/3) );
+
+    auto times = bench::Time
+      ( g, opts,
+        [&]() { A = AOrig; },
+        [&]() { QR( A, householderScalars, signature ); } );
+
+    bench::Record record( "QR", g, opts );
+    record.SetType<F>();
+    record.Set( "m", m );
+    record.Set( "n", n );
+    record.Emit( times, flops );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        auto opts = bench::CommonInput();
+        const Int m0 = Input("--m","height of matrix",4000);
+        const Int n0 = Input("--n","width of matrix",4000);
+        const Int nb = Input("--nb","algorithmic blocksize",128);
+        const bool complex = Input("--complex","use complex data?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        auto gridPtr = bench::MakeGrid( opts, comm );
+        const Grid& g = *gridPtr;
+        SetBlocksize( nb );
+        const Int m = bench::ScaledSize( m0, opts, g );
+        const Int n = bench::ScaledSize( n0, opts, g );
+        if( complex )
+            Benchmark<Complex<double>>( g, opts, m, n );
+        else
+            Benchmark<double>( g, opts, m, n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void Benchmark
+( const Grid& g, const bench::Options& opts, Int m, Int n, bool vectors )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> A(g), AOrig(g), U(g), V(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    Uniform( AOrig, m, n );
+
+    // The nominal cost of the reduction to bidiagonal form and, if
+    // requested, of the back-transformations of the singular vectors; the
+    // cost of the bidiagonal SVD itself depends upon the spectrum
+    const double mD = Max(m,n), nD = Min(m,n);
+    double realFlops = 4.*mD*nD*nD - 4.*nD*nD*nD/3;
+    if( vectors )
+        realFlops += 4.*mD*nD*nD - 2.*nD*nD*nD;
+    const double flops = bench::Flops<F>( realFlops );
+
+    auto setup = [&]() { A = AOrig; };
+    vector<double> times;
+    if( vectors )
+        times = bench::Time
+          ( g, opts, setup, [&]() { SVD( A, U, s, V ); } );
+    else
+        times = bench::Time( g, opts, setup, [&]() { SVD( A, s ); } );
+
+    bench::Record record( "SVD", g, opts );
+    record.SetType<F>();
+    record.Set( "vectors", vectors );
+    record.Set( "m", m );
+    record.Set( "n", n );
+    record.Emit( times, flops );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        auto opts = bench::CommonInput();
+        const Int m0 = Input("--m","height of matrix",2000);
+        const Int n0 = Input("--n","width of matrix",2000);
+        const bool vectors =
+          Input("--vectors","compute singular vectors?",true);
+        const Int nb = Input("--nb","algorithmic blocksize",128);
+        const bool complex = Input("--complex","use complex data?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        auto gridPtr = bench::MakeGrid( opts, comm );
+        const Grid& g = *gridPtr;
+        SetBlocksize( nb );
+        const Int m = bench::ScaledSize( m0, opts, g );
+        const Int n = bench::ScaledSize( n0, opts, g );
+        if( complex )
+            Benchmark<Complex<double>>( g, opts, m, n, vectors );
+        else
+            Benchmark<double>( g, opts, m, n, vectors );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+#!/usr/bin/env python
+#
+#  Copyright (c) 2009-2016, Jack Poulson
+#  All rights reserved.
+#
+#  This file is part of Elemental and is under the BSD 2-Clause License,
+#  which can be found in the LICENSE file in the root directory, or at
+#  http://opensource.org/licenses/BSD-2-Clause
+#
+"""Run a benchmark over a range of process counts for a strong or weak
+scaling study, e.g.,
+
+  scaling.py --procs 1,4,16,64 --scaling weak --output gemm.jsonl -- \\
+    ./GemmBenchmark --m 2000 --n 2000 --k 2000
+
+Each run appends its JSON records (one per line) to the output file, with
+the process count recorded in the "grid" field of each record.
+"""
+import argparse
+import shlex
+import subprocess
+import sys
+
+def main():
+    parser = argparse.ArgumentParser(
+      description=__doc__,
+      formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--procs',required=True,
+      help='comma-separated list of process counts')
+    parser.add_argument('--scaling',choices=['strong','weak'],
+      default='strong')
+    parser.add_argument('--launcher',default='mpirun -np {procs}',
+      help='launch command, where {procs} is the process count')
+    parser.add_argument('--output',required=True,
+      help='JSON lines file to append the records to')
+    parser.add_argument('benchmark',nargs=argparse.REMAINDER,
+      help='the benchmark executable and its arguments')
+    args = parser.parse_args()
+
+    benchmark = args.benchmark
+    if benchmark and benchmark[0] == '--':
+        benchmark = benchmark[1:]
+    if not benchmark:
+        parser.error('no benchmark was given')
+
+    for procs in [int(p) for p in args.procs.split(',')]:
+        command = shlex.split(args.launcher.format(procs=procs)) + \
+          benchmark + ['--scaling',args.scaling,'--json',args.output]
+        print(' '.join(command))
+        sys.stdout.flush()
+        status = subprocess.call(command)
+        if status != 0:
+            sys.exit('Run on {} processes failed with status {}'.format(
+              procs,status))
+
+if __name__ == '__main__':
+    main()
@@ -149,4 +149,8 @@ check_function_exists(mkl_dcsrmv ${UPPER_PROJECT_NAME}_HAVE_MKL)
 if (${UPPER_PROJECT_NAME}_HAVE_MKL)
   check_function_exists(dgemmt  ${UPPER_PROJECT_NAME}_HAVE_MKL_GEMMT)
   check_function_exists(dgemmt_ ${UPPER_PROJECT_NAME}_HAVE_MKL_GEMMT)
+  check_function_exists(dgemm_batch_strided
+    ${UPPER_PROJECT_NAME}_HAVE_MKL_BATCH_STRIDED)
+  check_function_exists(dgemm_batch_strided_
+    ${UPPER_PROJECT_NAME}_HAVE_MKL_BATCH_STRIDED)
 endif ()
@@ -89,6 +89,14 @@ main( int argc, char* argv[] )
           El::Input("--maxIts","maximum pseudospec iter's",200);
         const Real psTol =
           El::Input("--psTol","tolerance for pseudospectra",1e-6);
+        const El::Int numSubgrids =
+          El::Input("--numSubgrids","num subgrids for farming shifts",1);
+        const El::Int chunkSize =
+          El::Input("--chunkSize","shifts per farmed chunk (0=auto)",0);
+        const bool adaptive =
+          El::Input("--adaptive","adaptively refine near contours?",false);
+        const El::Int adaptiveStride =
+          El::Input("--adaptiveStride","initial adaptive pixel stride",16);
         // Uniform options
         const Real uniformRealCenter =
           El::Input("--uniformRealCenter","real center of uniform dist",0.);
@@ -276,6 +284,10 @@ main( int argc, char* argv[] )
         psCtrl.deflate = deflate;
         psCtrl.arnoldi = arnoldi;
         psCtrl.basisSize = basisSize;
+        psCtrl.numSubgrids = numSubgrids;
+        psCtrl.chunkSize = chunkSize;
+        psCtrl.adaptive = adaptive;
+        psCtrl.adaptiveStride = adaptiveStride;
         psCtrl.progress = progress;
         psCtrl.schurCtrl.hessSchurCtrl.scalapack = false;
         psCtrl.schurCtrl.hessSchurCtrl.fullTriangle = true;
@@ -24,6 +24,13 @@ main( int argc, char* argv[] )
         const El::SignScaling scaling =
           static_cast<El::SignScaling>
           (El::Input("--scaling","scaling strategy",0));
+        const El::SignMethod method =
+          static_cast<El::SignMethod>
+          (El::Input("--method","0: Newton, 1: Newton-Schulz hybrid, 2: Pade",
+                     1));
+        const El::Int padeOrder = El::Input("--padeOrder","Pade order",4);
+        const El::Int numSubgrids =
+          El::Input("--numSubgrids","number of subgrids for Pade terms",1);
         const El::Int maxIts = El::Input("--maxIts","max number of iter's",100);
         const double tol = El::Input("--tol","convergence tolerance",1e-6);
         const bool progress =
@@ -46,6 +53,9 @@ main( int argc, char* argv[] )
         signCtrl.tol = tol;
         signCtrl.progress = progress;
         signCtrl.scaling = scaling;
+        signCtrl.method = method;
+        signCtrl.padeOrder = padeOrder;
+        signCtrl.numSubgrids = numSubgrids;
 
         El::Timer timer;
         // Compute sgn(A)
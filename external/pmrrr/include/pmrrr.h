@@ -269,6 +269,19 @@ int PMR_comm_eigvals(MPI_Comm comm, int *nz, int *ifirst, double *W);
  */
 
 
+/*
+ * Routine to allow the boundaries between the contiguous blocks of 
+ * eigenvectors assigned to each process to move by up to 'slack' times 
+ * the nominal block size so that they fall into the largest relative 
+ * gap nearby rather than splitting a cluster across processes. The 
+ * default of zero assigns blocks whose sizes differ by at most one. 
+ * A block can then hold up to (1+2*slack) times the nominal number of 
+ * eigenvectors, and 'Z' must be large enough to hold them. The slack 
+ * is clipped to [0,1/2].
+ */
+void PMR_set_partition_slack(double slack);
+
+
 /* LAPACK and BLAS function prototypes
  * Note: type specifier 'extern' does not matter in declaration
  * so here used to mark routines from LAPACK and BLAS libraries */
@@ -55,6 +55,8 @@ static int assign_to_proc
 (proc_t *procinfo, in_t *Dstruct, val_t *Wstruct, vec_t *Zstruct, 
  int *nzp, int *myfirstp);
 static int cmpa(const void*, const void*);
+static double boundary_relgap
+(sort_struct_t*, int, int, double*, double*, int*);
 static int init_workQ
 (proc_t *procinfo, in_t *Dstruct, val_t *Wstruct, int *nzp, workQ_t *workQ);
 static void *empty_workQ(void*);
@@ -65,6 +67,14 @@ static auxarg3_t *create_auxarg3
 static void retrieve_auxarg3
 (auxarg3_t*, int*, proc_t**, val_t**, vec_t**, tol_t**, workQ_t**, counter_t**);
 
+/* See PMR_set_partition_slack */
+static double partition_slack = 0.0;
+
+void PMR_set_partition_slack(double slack)
+{
+  partition_slack = fmin(fmax(slack, 0.0), 0.5);
+}
+
 /*
  * Computation of eigenvectors of a symmetric tridiagonal
  */
@@ -224,16 +234,32 @@ int assign_to_proc
   int isize = iu - il + 1;
 
   int ibegin=il-1, iend;
+  int nominal_end=il-2;
   int id;
   for (id=0; id<nproc; id++) {
 
     int chunk = imax(1, isize/nproc + (id < isize%nproc));
+    nominal_end += chunk;
     
     if (id==nproc-1) {
       iend = iu - 1;
     } else {
-      iend = ibegin + chunk - 1;
-      iend = imin(iend, iu -1);
+      iend = imin(nominal_end, iu -1);
+
+      /* Move the boundary into the largest nearby relative gap */
+      int max_shift = (int)(partition_slack*chunk);
+      if (max_shift > 0) {
+        int jbegin = imax(ibegin, nominal_end - max_shift);
+        int jend   = imin(iu - 2, nominal_end + max_shift);
+        double best_gap = -1.0;
+        for (j=jbegin; j<=jend; j++) {
+          double gap = boundary_relgap(array, j, n, W, Wstruct->Wgap, iblock);
+          if (gap > best_gap) {
+            best_gap = gap;
+            iend     = j;
+          }
+        }
+      }
     }
 
     int k = 0;
@@ -262,6 +288,21 @@ int assign_to_proc
   return 0;
 }
 
+/*
+ * Relative gap between the j-th smallest eigenvalue, with respect to
+ * the sorted array, and its right neighbour within the same block; a
+ * boundary after the last eigenvalue of a block never splits a cluster
+ */
+static
+double boundary_relgap
+(sort_struct_t *array, int j, int n, double *W, double *Wgap, int *iblock)
+{
+  int i = array[j].ind;
+  if (i == n-1 || iblock[i+1] != iblock[i])
+    return DBL_MAX;
+  return Wgap[i] / fmax(fabs(W[i]), DBL_MIN);
+}
+
 /* 
  * Compare function for using qsort() on an array of 
  * sort_structs
@@ -10,6 +10,7 @@
 #define EL_BLAS_AXPY_HPP
 
 #include <El/blas_like/level1/Axpy/util.hpp>
+#include <El/blas_like/level1/SIMD.hpp>
 
 namespace El {
 
@@ -39,7 +40,7 @@ void Axpy( S alphaS, const Matrix<T>& X, Matrix<T>& Y )
           if( XLength != YLength )
               LogicError("Nonconformal Axpy");
         )
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_GRAIN(XLength)
         for( Int i=0; i<XLength; ++i )
             YBuf[i*YStride] += alpha*XBuf[i*XStride];
     }
@@ -49,21 +50,23 @@ void Axpy( S alphaS, const Matrix<T>& X, Matrix<T>& Y )
         // memory. Otherwise iterate over double loop.
         if( ldX == mX && ldY == mX )
         {
-            EL_PARALLEL_FOR
-            for( Int i=0; i<mX*nX; ++i )
-                YBuf[i] += alpha*XBuf[i];
+            const Int numEntries = mX*nX;
+            const Int chunkSize = simd::ChunkSize();
+            const Int numChunks = (numEntries+chunkSize-1) / chunkSize;
+            EL_PARALLEL_FOR_GRAIN(numEntries)
+            for( Int chunk=0; chunk<numChunks; ++chunk )
+            {
+                const Int off = chunk*chunkSize;
+                simd::Axpy
+                ( Min(chunkSize,numEntries-off), alpha,
+                  &XBuf[off], &YBuf[off] );
+            }
         }
         else
         {
-            EL_PARALLEL_FOR
+            EL_PARALLEL_FOR_GRAIN(mX*nX)
             for( Int j=0; j<nX; ++j )
-            {
-                EL_SIMD
-                for( Int i=0; i<mX; ++i )
-                {
-                    YBuf[i+j*ldY] += alpha*XBuf[i+j*ldX];
-                }
-            }
+                simd::Axpy( mX, alpha, &XBuf[j*ldX], &YBuf[j*ldY] );
         }
     }
 }
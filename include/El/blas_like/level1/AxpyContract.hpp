@@ -13,12 +13,109 @@ namespace El {
 
 namespace axpy_contract {
 
+// B(:,jLoc:jLoc+width) := alpha S + (overwrite ? 0 : B(:,jLoc:jLoc+width)),
+// where S is stored in 'buffer' with a leading dimension of localHeight
+template<typename T>
+void UpdateColumns
+( T alpha, Int localHeight, Int width, const T* buffer,
+  ElementalMatrix<T>& B, Int jLoc, bool overwrite )
+{
+    if( localHeight == 0 || width <= 0 )
+        return;
+    T* BBuf = B.Buffer(0,jLoc);
+    const Int BLDim = B.LDim();
+    if( overwrite )
+    {
+        copy::util::InterleaveMatrix
+        ( localHeight, width,
+          buffer, 1, localHeight,
+          BBuf,   1, BLDim );
+        if( alpha != T(1) )
+            for( Int j=0; j<width; ++j )
+                blas::Scal( localHeight, alpha, &BBuf[j*BLDim], 1 );
+    }
+    else
+        axpy::util::InterleaveMatrixUpdate
+        ( alpha, localHeight, width,
+          buffer, 1, localHeight,
+          BBuf,   1, BLDim );
+}
+
+// Sum the contributions of the members of 'comm' to their local columns of
+// B and update B with alpha times the result (see UpdateColumns).
+// pack(jBeg,jEnd,buffer,portionSize) must write the contributions to local
+// columns [jBeg,jEnd) of member q, with a leading dimension equal to its
+// local height, starting at buffer[q*portionSize]. Once the packed data
+// would exceed the segment size of ContractPipelineCtrl(), the columns are
+// instead split into chunks which are reduce-scattered by nonblocking
+// collectives, so that each chunk is packed while its predecessor is being
+// reduced and is accumulated into B as soon as it arrives, and the
+// workspace is limited to two chunks.
+template<typename T>
+void ReduceScatterUpdate
+( T alpha, Int maxLocalHeight, Int maxLocalWidth,
+  function<void(Int,Int,T*,Int)> pack,
+  mpi::Comm comm, ElementalMatrix<T>& B, bool overwrite )
+{
+    EL_DEBUG_CSE
+    const Int commSize = mpi::Size( comm );
+    const Int localHeight = B.LocalHeight();
+    const Int localWidth = B.LocalWidth();
+    const Int segmentSize = ContractPipelineCtrl().segmentSize;
+    const Int chunkWidth =
+      Max( segmentSize / Max(commSize*maxLocalHeight,Int(1)), Int(1) );
+    if( chunkWidth >= maxLocalWidth || mpi::HierarchicalCollectives(comm) )
+    {
+        const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+
+        // We explicitly zero-initialize rather than calling FastResize to
+        // avoid inadvertently causing a floating-point exception in the
+        // reduction of the padding entries.
+        vector<T> buffer(commSize*portionSize, T(0));
+        pack( 0, maxLocalWidth, buffer.data(), portionSize );
+        mpi::ReduceScatter( buffer.data(), portionSize, comm );
+        UpdateColumns
+        ( alpha, localHeight, localWidth, buffer.data(), B, 0, overwrite );
+        return;
+    }
+
+    const Int numChunks = (maxLocalWidth+chunkWidth-1) / chunkWidth;
+    const Int portionSize = mpi::Pad( maxLocalHeight*chunkWidth );
+    const Int sendSize = commSize*portionSize;
+    vector<T> sendBuf(2*sendSize, T(0)), recvBuf(2*portionSize, T(0));
+    mpi::Request<T> requests[2];
+    auto post =
+      [&]( Int chunk )
+      {
+          const Int jBeg = chunk*chunkWidth;
+          const Int jEnd = Min( jBeg+chunkWidth, maxLocalWidth );
+          T* sendChunk = &sendBuf[(chunk%2)*sendSize];
+          pack( jBeg, jEnd, sendChunk, portionSize );
+          mpi::IReduceScatter
+          ( sendChunk, &recvBuf[(chunk%2)*portionSize], portionSize, comm,
+            requests[chunk%2] );
+      };
+    post( 0 );
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        if( chunk+1 < numChunks )
+            post( chunk+1 );
+        mpi::Wait( requests[chunk%2] );
+        const Int jBeg = chunk*chunkWidth;
+        const Int jEnd = Min( jBeg+chunkWidth, localWidth );
+        UpdateColumns
+        ( alpha, localHeight, jEnd-jBeg, &recvBuf[(chunk%2)*portionSize],
+          B, jBeg, overwrite );
+    }
+}
+
 // (Partial(U),V) -> (U,V)
 template<typename T>
 void PartialColScatter
 ( T alpha,
   const ElementalMatrix<T>& A,
-        ElementalMatrix<T>& B )
+        ElementalMatrix<T>& B,
+  bool overwrite=false )
 {
     EL_DEBUG_CSE
     AssertSameGrids( A, B );
@@ -45,33 +142,21 @@ void PartialColScatter
 
         const Int height = B.Height();
         const Int width = B.Width();
-        const Int localHeight = B.LocalHeight();
         const Int maxLocalHeight = MaxLength( height, colStride );
-        const Int recvSize = mpi::Pad( maxLocalHeight*width );
-        const Int sendSize = colStrideUnion*recvSize;
-
-        // We explicitly zero-initialize rather than calling FastResize to avoid
-        // inadvertently causing a floating-point exception in the reduction of
-        // the padding entries.
-        vector<T> buffer(sendSize, T(0));
-
-        // Pack
-        copy::util::PartialColStridedPack
-        ( height, width,
-          colAlign, colStride,
-          colStrideUnion, colStridePart, colRankPart,
-          A.ColShift(),
-          A.LockedBuffer(), A.LDim(),
-          buffer.data(),    recvSize );
-
-        // Communicate
-        mpi::ReduceScatter( buffer.data(), recvSize, B.PartialUnionColComm() );
-
-        // Unpack our received data
-        axpy::util::InterleaveMatrixUpdate
-        ( alpha, localHeight, width,
-          buffer.data(), 1, localHeight,
-          B.Buffer(),    1, B.LDim() );
+        auto pack =
+          [&]( Int jBeg, Int jEnd, T* buffer, Int portionSize )
+          {
+              copy::util::PartialColStridedPack
+              ( height, jEnd-jBeg,
+                colAlign, colStride,
+                colStrideUnion, colStridePart, colRankPart,
+                A.ColShift(),
+                A.LockedBuffer(0,jBeg), A.LDim(),
+                buffer,                 portionSize );
+          };
+        ReduceScatterUpdate
+        ( alpha, maxLocalHeight, width, function<void(Int,Int,T*,Int)>(pack),
+          B.PartialUnionColComm(), B, overwrite );
     }
     else
         LogicError("Unaligned PartialColScatter not implemented");
@@ -82,7 +167,8 @@ template<typename T>
 void PartialRowScatter
 ( T alpha,
   const ElementalMatrix<T>& A,
-        ElementalMatrix<T>& B )
+        ElementalMatrix<T>& B,
+  bool overwrite=false )
 {
     EL_DEBUG_CSE
     AssertSameGrids( A, B );
@@ -101,28 +187,22 @@ void PartialRowScatter
         const Int height = B.Height();
         const Int width = B.Width();
         const Int maxLocalWidth = MaxLength( width, rowStride );
-        const Int recvSize = mpi::Pad( height*maxLocalWidth );
-        const Int sendSize = rowStrideUnion*recvSize;
-
-        vector<T> buffer(sendSize, T(0));
-
-        // Pack
-        copy::util::PartialRowStridedPack
-        ( height, width,
-          B.RowAlign(), rowStride,
-          rowStrideUnion, rowStridePart, rowRankPart,
-          A.RowShift(),
-          A.LockedBuffer(), A.LDim(),
-          buffer.data(),    recvSize );
-
-        // Communicate
-        mpi::ReduceScatter( buffer.data(), recvSize, B.PartialUnionRowComm() );
-
-        // Unpack our received data
-        axpy::util::InterleaveMatrixUpdate
-        ( alpha, height, B.LocalWidth(),
-          buffer.data(), 1, height,
-          B.Buffer(),    1, B.LDim() );
+        // Each chunk of local columns begins at a multiple of rowStride
+        // globally, so that the alignments are unchanged
+        auto pack =
+          [&]( Int jBeg, Int jEnd, T* buffer, Int portionSize )
+          {
+              copy::util::PartialRowStridedPack
+              ( height, Min(jEnd*rowStride,width)-jBeg*rowStride,
+                B.RowAlign(), rowStride,
+                rowStrideUnion, rowStridePart, rowRankPart,
+                A.RowShift(),
+                A.LockedBuffer(0,jBeg*rowStrideUnion), A.LDim(),
+                buffer,                                portionSize );
+          };
+        ReduceScatterUpdate
+        ( alpha, height, maxLocalWidth, function<void(Int,Int,T*,Int)>(pack),
+          B.PartialUnionRowComm(), B, overwrite );
     }
     else
         LogicError("Unaligned PartialRowScatter not implemented");
@@ -133,7 +213,8 @@ template<typename T>
 void ColScatter
 ( T alpha,
   const ElementalMatrix<T>& A,
-        ElementalMatrix<T>& B )
+        ElementalMatrix<T>& B,
+  bool overwrite=false )
 {
     EL_DEBUG_CSE
     AssertSameGrids( A, B );
@@ -172,26 +253,18 @@ void ColScatter
     if( rowDiff == 0 )
     {
         const Int maxLocalHeight = MaxLength(height,colStride);
-
-        const Int recvSize = mpi::Pad( maxLocalHeight*localWidth );
-        const Int sendSize = colStride*recvSize;
-        vector<T> buffer(sendSize, T(0));
-
-        // Pack
-        copy::util::ColStridedPack
-        ( height, localWidth,
-          colAlign, colStride,
-          A.LockedBuffer(), A.LDim(),
-          buffer.data(),    recvSize );
-
-        // Communicate
-        mpi::ReduceScatter( buffer.data(), recvSize, B.ColComm() );
-
-        // Update with our received data
-        axpy::util::InterleaveMatrixUpdate
-        ( alpha, localHeight, localWidth,
-          buffer.data(), 1, localHeight,
-          B.Buffer(),    1, B.LDim() );
+        auto pack =
+          [&]( Int jBeg, Int jEnd, T* buffer, Int portionSize )
+          {
+              copy::util::ColStridedPack
+              ( height, jEnd-jBeg,
+                colAlign, colStride,
+                A.LockedBuffer(0,jBeg), A.LDim(),
+                buffer,                 portionSize );
+          };
+        ReduceScatterUpdate
+        ( alpha, maxLocalHeight, localWidth,
+          function<void(Int,Int,T*,Int)>(pack), B.ColComm(), B, overwrite );
     }
     else
     {
@@ -228,10 +301,8 @@ void ColScatter
           secondBuf, localHeight*localWidth,  recvCol, B.RowComm() );
 
         // Update with our received data
-        axpy::util::InterleaveMatrixUpdate
-        ( alpha, localHeight, localWidth,
-          secondBuf,  1, localHeight,
-          B.Buffer(), 1, B.LDim() );
+        UpdateColumns
+        ( alpha, localHeight, localWidth, secondBuf, B, 0, overwrite );
     }
 }
 
@@ -240,7 +311,8 @@ template<typename T>
 void RowScatter
 ( T alpha,
   const ElementalMatrix<T>& A,
-        ElementalMatrix<T>& B )
+        ElementalMatrix<T>& B,
+  bool overwrite=false )
 {
     EL_DEBUG_CSE
     AssertSameGrids( A, B );
@@ -266,12 +338,8 @@ void RowScatter
               rowAlign, B.RowComm() );
 
             if( B.RowRank() == rowAlign )
-            {
-                axpy::util::InterleaveMatrixUpdate
-                ( alpha, localHeight, 1,
-                  buffer.data(), 1, localHeight,
-                  B.Buffer(),    1, B.LDim() );
-            }
+                UpdateColumns
+                ( alpha, localHeight, 1, buffer.data(), B, 0, overwrite );
         }
         else
         {
@@ -279,28 +347,22 @@ void RowScatter
             const Int rowAlign = B.RowAlign();
 
             const Int localHeight = B.LocalHeight();
-            const Int localWidth = B.LocalWidth();
             const Int maxLocalWidth = MaxLength(width,rowStride);
-
-            const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
-            const Int sendSize = rowStride*portionSize;
-
-            // Pack
-            vector<T> buffer(sendSize, T(0));
-            copy::util::RowStridedPack
-            ( localHeight, width,
-              rowAlign, rowStride,
-              A.LockedBuffer(), A.LDim(),
-              buffer.data(), portionSize );
-
-            // Communicate
-            mpi::ReduceScatter( buffer.data(), portionSize, B.RowComm() );
-
-            // Update with our received data
-            axpy::util::InterleaveMatrixUpdate
-            ( alpha, localHeight, localWidth,
-              buffer.data(), 1, localHeight,
-              B.Buffer(),    1, B.LDim() );
+            // Each chunk of local columns begins at a multiple of rowStride
+            // globally, so that the alignment is unchanged
+            auto pack =
+              [&]( Int jBeg, Int jEnd, T* buffer, Int portionSize )
+              {
+                  copy::util::RowStridedPack
+                  ( localHeight, Min(jEnd*rowStride,width)-jBeg*rowStride,
+                    rowAlign, rowStride,
+                    A.LockedBuffer(0,jBeg*rowStride), A.LDim(),
+                    buffer,                           portionSize );
+              };
+            ReduceScatterUpdate
+            ( alpha, localHeight, maxLocalWidth,
+              function<void(Int,Int,T*,Int)>(pack), B.RowComm(), B,
+              overwrite );
         }
     }
     else
@@ -336,10 +398,8 @@ void RowScatter
                 ( sendBuf, localHeightA, sendRow,
                   recvBuf, localHeight,  recvRow, B.ColComm() );
 
-                axpy::util::InterleaveMatrixUpdate
-                ( alpha, localHeight, 1,
-                  recvBuf,    1, localHeight,
-                  B.Buffer(), 1, B.LDim() );
+                UpdateColumns
+                ( alpha, localHeight, 1, recvBuf, B, 0, overwrite );
             }
         }
         else
@@ -374,10 +434,8 @@ void RowScatter
               secondBuf, localHeight*localWidth,  recvRow, B.ColComm() );
 
             // Update with our received data
-            axpy::util::InterleaveMatrixUpdate
-            ( alpha, localHeight, localWidth,
-              secondBuf,  1, localHeight,
-              B.Buffer(), 1, B.LDim() );
+            UpdateColumns
+            ( alpha, localHeight, localWidth, secondBuf, B, 0, overwrite );
         }
     }
 }
@@ -387,7 +445,8 @@ template<typename T>
 void Scatter
 ( T alpha,
   const ElementalMatrix<T>& A,
-        ElementalMatrix<T>& B )
+        ElementalMatrix<T>& B,
+  bool overwrite=false )
 {
     EL_DEBUG_CSE
     AssertSameGrids( A, B );
@@ -403,41 +462,33 @@ void Scatter
 
     const Int height = B.Height();
     const Int width = B.Width();
-    const Int localHeight = B.LocalHeight();
-    const Int localWidth = B.LocalWidth();
     const Int maxLocalHeight = MaxLength(height,colStride);
     const Int maxLocalWidth = MaxLength(width,rowStride);
-
-    const Int recvSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
-    const Int sendSize = colStride*rowStride*recvSize;
-
-    vector<T> buffer(sendSize, T(0));
-
-    // Pack
-    copy::util::StridedPack
-    ( height, width,
-      colAlign, colStride,
-      rowAlign, rowStride,
-      A.LockedBuffer(), A.LDim(),
-      buffer.data(),    recvSize );
-
-    // Communicate
-    mpi::ReduceScatter( buffer.data(), recvSize, B.DistComm() );
-
-    // Unpack our received data
-    axpy::util::InterleaveMatrixUpdate
-    ( alpha, localHeight, localWidth,
-      buffer.data(), 1, localHeight,
-      B.Buffer(),    1, B.LDim() );
+    // Each chunk of local columns begins at a multiple of rowStride globally,
+    // so that the alignments are unchanged
+    auto pack =
+      [&]( Int jBeg, Int jEnd, T* buffer, Int portionSize )
+      {
+          copy::util::StridedPack
+          ( height, Min(jEnd*rowStride,width)-jBeg*rowStride,
+            colAlign, colStride,
+            rowAlign, rowStride,
+            A.LockedBuffer(0,jBeg*rowStride), A.LDim(),
+            buffer,                           portionSize );
+      };
+    ReduceScatterUpdate
+    ( alpha, maxLocalHeight, maxLocalWidth,
+      function<void(Int,Int,T*,Int)>(pack), B.DistComm(), B, overwrite );
 }
 
-} // namespace axpy_contract
-
+// The contraction of A into B, overwriting B rather than updating it when
+// requested (and the distributions differ)
 template<typename T>
-void AxpyContract
+void Update
 ( T alpha,
   const ElementalMatrix<T>& A,
-        ElementalMatrix<T>& B )
+        ElementalMatrix<T>& B,
+  bool overwrite )
 {
     EL_DEBUG_CSE
     const Dist U = B.ColDist();
@@ -445,19 +496,31 @@ void AxpyContract
     if( A.ColDist() == U && A.RowDist() == V )
         Axpy( alpha, A, B );
     else if( A.ColDist() == Partial(U) && A.RowDist() == V )
-        axpy_contract::PartialColScatter( alpha, A, B );
+        PartialColScatter( alpha, A, B, overwrite );
     else if( A.ColDist() == U && A.RowDist() == Partial(V) )
-        axpy_contract::PartialRowScatter( alpha, A, B );
+        PartialRowScatter( alpha, A, B, overwrite );
     else if( A.ColDist() == Collect(U) && A.RowDist() == V )
-        axpy_contract::ColScatter( alpha, A, B );
+        ColScatter( alpha, A, B, overwrite );
     else if( A.ColDist() == U && A.RowDist() == Collect(V) )
-        axpy_contract::RowScatter( alpha, A, B );
+        RowScatter( alpha, A, B, overwrite );
     else if( A.ColDist() == Collect(U) && A.RowDist() == Collect(V) )
-        axpy_contract::Scatter( alpha, A, B );
+        Scatter( alpha, A, B, overwrite );
     else
         LogicError("Incompatible distributions");
 }
 
+} // namespace axpy_contract
+
+template<typename T>
+void AxpyContract
+( T alpha,
+  const ElementalMatrix<T>& A,
+        ElementalMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    axpy_contract::Update( alpha, A, B, false );
+}
+
 template<typename T>
 void AxpyContract
 ( T alpha,
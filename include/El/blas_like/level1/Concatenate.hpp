@@ -25,7 +25,6 @@ void HCat
     const Int nB = B.Width();
 
     C.Resize( m, nA+nB );
-    Zero( C );
     auto CL = C( IR(0,m), IR(0,nA)     );
     auto CR = C( IR(0,m), IR(nA,nA+nB) );
     CL = A;
@@ -46,7 +45,6 @@ void VCat
     const Int n = A.Width();
 
     C.Resize( mA+mB, n );
-    Zero( C );
     auto CT = C( IR(0,mA),     IR(0,n) );
     auto CB = C( IR(mA,mA+mB), IR(0,n) );
     CT = A;
@@ -54,51 +52,160 @@ void VCat
 }
 
 template<typename T>
-inline void HCat
-( const AbstractDistMatrix<T>& A,
-  const AbstractDistMatrix<T>& B,
-        AbstractDistMatrix<T>& CPre )
+CompositeMatrix<T>::CompositeMatrix( Int numBlockRows, Int numBlockCols )
+: numBlockRows_(numBlockRows), numBlockCols_(numBlockCols),
+  blocks_(numBlockRows*numBlockCols,nullptr),
+  heights_(numBlockRows,-1), widths_(numBlockCols,-1)
+{ }
+
+template<typename T>
+void CompositeMatrix<T>::SetBlock
+( Int i, Int j, const AbstractDistMatrix<T>& A )
 {
     EL_DEBUG_CSE
-    if( A.Height() != B.Height() )
-        LogicError("Incompatible heights for HCat");
-    const Int m = A.Height();
-    const Int nA = A.Width();
-    const Int nB = B.Width();
+    if( i < 0 || i >= numBlockRows_ || j < 0 || j >= numBlockCols_ )
+        LogicError
+        ("Block (",i,",",j,") is outside of a ",numBlockRows_," x ",
+         numBlockCols_," composite");
+    if( heights_[i] != -1 && heights_[i] != A.Height() )
+        LogicError
+        ("Block (",i,",",j,") has height ",A.Height()," but block row ",i,
+         " has height ",heights_[i]);
+    if( widths_[j] != -1 && widths_[j] != A.Width() )
+        LogicError
+        ("Block (",i,",",j,") has width ",A.Width()," but block column ",j,
+         " has width ",widths_[j]);
+    for( const auto* block : blocks_ )
+        if( block != nullptr && block->Grid() != A.Grid() )
+            LogicError("The blocks of a composite must share a grid");
+    blocks_[i+j*numBlockRows_] = &A;
+    heights_[i] = A.Height();
+    widths_[j] = A.Width();
+}
 
-    DistMatrixWriteProxy<T,T,MC,MR> CProx( CPre );
-    auto& C = CProx.Get();
+template<typename T>
+Int CompositeMatrix<T>::BlockHeight( Int i ) const
+{
+    if( heights_[i] == -1 )
+        LogicError("Block row ",i," of the composite has no blocks");
+    return heights_[i];
+}
 
-    C.Resize( m, nA+nB );
-    Zero( C );
-    auto CL = C( IR(0,m), IR(0,nA)     );
-    auto CR = C( IR(0,m), IR(nA,nA+nB) );
-    CL = A;
-    CR = B;
+template<typename T>
+Int CompositeMatrix<T>::BlockWidth( Int j ) const
+{
+    if( widths_[j] == -1 )
+        LogicError("Block column ",j," of the composite has no blocks");
+    return widths_[j];
 }
 
 template<typename T>
-void VCat
-( const AbstractDistMatrix<T>& A,
-  const AbstractDistMatrix<T>& B,
-        AbstractDistMatrix<T>& CPre )
+Int CompositeMatrix<T>::RowOffset( Int i ) const
+{
+    Int offset = 0;
+    for( Int k=0; k<i; ++k )
+        offset += BlockHeight( k );
+    return offset;
+}
+
+template<typename T>
+Int CompositeMatrix<T>::ColOffset( Int j ) const
+{
+    Int offset = 0;
+    for( Int k=0; k<j; ++k )
+        offset += BlockWidth( k );
+    return offset;
+}
+
+template<typename T>
+const El::Grid& CompositeMatrix<T>::Grid() const
+{
+    const AbstractDistMatrix<T>* first = nullptr;
+    for( const auto* block : blocks_ )
+        if( block != nullptr )
+        {
+            first = block;
+            break;
+        }
+    if( first == nullptr )
+        LogicError("The composite has no blocks");
+    return first->Grid();
+}
+
+template<typename T>
+CompositeMatrix<T>
+HCatView( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != B.Height() )
+        LogicError("Incompatible heights for HCat");
+    CompositeMatrix<T> C( 1, 2 );
+    C.SetBlock( 0, 0, A );
+    C.SetBlock( 0, 1, B );
+    return C;
+}
+
+template<typename T>
+CompositeMatrix<T>
+VCatView( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
 {
     EL_DEBUG_CSE
     if( A.Width() != B.Width() )
         LogicError("Incompatible widths for VCat");
-    const Int mA = A.Height();
-    const Int mB = B.Height();
+    CompositeMatrix<T> C( 2, 1 );
+    C.SetBlock( 0, 0, A );
+    C.SetBlock( 1, 0, B );
+    return C;
+}
+
+// Each block is redistributed straight into its submatrix of the target, and
+// only the zero blocks are filled
+template<typename T>
+void Copy( const CompositeMatrix<T>& A, AbstractDistMatrix<T>& BPre )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
     const Int n = A.Width();
+    if( BPre.Grid() != A.Grid() )
+        BPre.SetGrid( A.Grid() );
+
+    DistMatrixWriteProxy<T,T,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+    B.Resize( m, n );
+    for( Int j=0; j<A.NumBlockCols(); ++j )
+    {
+        const Range<Int> cols( A.ColOffset(j), A.ColOffset(j+1) );
+        for( Int i=0; i<A.NumBlockRows(); ++i )
+        {
+            const Range<Int> rows( A.RowOffset(i), A.RowOffset(i+1) );
+            auto Bij = B( rows, cols );
+            const auto* Aij = A.Block( i, j );
+            if( Aij == nullptr )
+                Zero( Bij );
+            else
+                Bij = *Aij;
+        }
+    }
+}
 
-    DistMatrixWriteProxy<T,T,MC,MR> CProx( CPre );
-    auto& C = CProx.Get();
+template<typename T>
+void HCat
+( const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        AbstractDistMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    Copy( HCatView( A, B ), C );
+}
 
-    C.Resize( mA+mB, n );
-    Zero( C );
-    auto CT = C( IR(0,mA),     IR(0,n) );
-    auto CB = C( IR(mA,mA+mB), IR(0,n) );
-    CT = A;
-    CB = B;
+template<typename T>
+void VCat
+( const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        AbstractDistMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    Copy( VCatView( A, B ), C );
 }
 
 
@@ -124,7 +231,14 @@ void VCat
   EL_EXTERN template void VCat \
   ( const AbstractDistMatrix<T>& A, \
     const AbstractDistMatrix<T>& B, \
-          AbstractDistMatrix<T>& C );
+          AbstractDistMatrix<T>& C ); \
+  EL_EXTERN template class CompositeMatrix<T>; \
+  EL_EXTERN template CompositeMatrix<T> HCatView \
+  ( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B ); \
+  EL_EXTERN template CompositeMatrix<T> VCatView \
+  ( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B ); \
+  EL_EXTERN template void Copy \
+  ( const CompositeMatrix<T>& A, AbstractDistMatrix<T>& B );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
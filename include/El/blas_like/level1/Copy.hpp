@@ -12,6 +12,8 @@
 #include <El/blas_like/level1/Copy/internal_decl.hpp>
 #include <El/blas_like/level1/Copy/GeneralPurpose.hpp>
 #include <El/blas_like/level1/Copy/util.hpp>
+#include <El/blas_like/level1/Copy/RedistBatch.hpp>
+#include <El/blas_like/level1/Copy/RedistPlan.hpp>
 
 namespace El {
 
@@ -21,6 +23,10 @@ void Copy( const Matrix<T>& A, Matrix<T>& B )
     EL_DEBUG_CSE
     const Int height = A.Height();
     const Int width = A.Width();
+    if( CopyOnWrite() &&
+        (!B.FixedSize() || (B.Height() == height && B.Width() == width)) &&
+        B.ShareWith( A ) )
+        return;
     B.Resize( height, width );
     const Int ldA = A.LDim();
     const Int ldB = B.LDim();
@@ -41,6 +47,18 @@ void Copy( const Matrix<T>& A, Matrix<T>& B )
 
 }
 
+template<typename T>
+void Copy( Matrix<T>&& A, Matrix<T>& B )
+{
+    EL_DEBUG_CSE
+    // Views (and the fixed-size local matrices of distributed matrices) must
+    // keep their own buffers
+    if( A.Viewing() || B.Viewing() || B.FixedSize() )
+        Copy( static_cast<const Matrix<T>&>(A), B );
+    else
+        B = std::move(A);
+}
+
 template<typename S,typename T,
          typename/*=EnableIf<CanCast<S,T>>*/>
 void Copy( const Matrix<S>& A, Matrix<T>& B )
@@ -197,6 +215,91 @@ void Copy( const BlockMatrix<S>& A, BlockMatrix<T>& B )
     #include <El/macros/GuardAndPayload.h>
 }
 
+// Sparse and 1D-distributed
+// ==========================
+
+template<typename S,typename T,
+         typename/*=EnableIf<CanCast<S,T>>*/>
+void Copy( const SparseMatrix<S>& A, SparseMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int numEntries = A.NumEntries();
+    B.Resize( A.Height(), A.Width() );
+    B.Reserve( numEntries );
+    for( Int e=0; e<numEntries; ++e )
+        B.QueueUpdate( A.Row(e), A.Col(e), Caster<S,T>::Cast(A.Value(e)) );
+    B.ProcessQueues();
+}
+
+template<typename S,typename T,
+         typename/*=EnableIf<CanCast<S,T>>*/>
+void Copy( const DistSparseMatrix<S>& A, DistSparseMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int firstLocalRow = A.FirstLocalRow();
+    B.SetGrid( A.Grid() );
+    B.Resize( A.Height(), A.Width() );
+    B.Reserve( numLocalEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+        B.QueueLocalUpdate
+        ( A.Row(e)-firstLocalRow, A.Col(e), Caster<S,T>::Cast(A.Value(e)) );
+    B.ProcessLocalQueues();
+}
+
+template<typename S,typename T,
+         typename/*=EnableIf<CanCast<S,T>>*/>
+void Copy( const DistMultiVec<S>& A, DistMultiVec<T>& B )
+{
+    EL_DEBUG_CSE
+    B.SetGrid( A.Grid() );
+    B.Resize( A.Height(), A.Width() );
+    Copy( A.LockedMatrix(), B.Matrix() );
+}
+
+template<typename T>
+void Copy( const DistMultiVec<T>& A, AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = A.LocalHeight();
+    const Int width = A.Width();
+    const Matrix<T>& ALoc = A.LockedMatrix();
+    B.SetGrid( A.Grid() );
+    B.Resize( A.Height(), width );
+    Zero( B );
+    B.Reserve( localHeight*width );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        for( Int j=0; j<width; ++j )
+            B.QueueUpdate( i, j, ALoc(iLoc,j) );
+    }
+    B.ProcessQueues();
+}
+
+template<typename T>
+void Copy( const AbstractDistMatrix<T>& A, DistMultiVec<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int width = A.Width();
+    B.SetGrid( A.Grid() );
+    B.Resize( A.Height(), width );
+    const Int localHeight = B.LocalHeight();
+    A.ReservePulls( localHeight*width );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = B.GlobalRow(iLoc);
+        for( Int j=0; j<width; ++j )
+            A.QueuePull( i, j );
+    }
+    vector<T> pullBuf;
+    A.ProcessPullQueue( pullBuf );
+    Matrix<T>& BLoc = B.Matrix();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        for( Int j=0; j<width; ++j )
+            BLoc(iLoc,j) = pullBuf[iLoc*width+j];
+}
+
 template<typename T>
 void CopyFromRoot
 ( const Matrix<T>& A, DistMatrix<T,CIRC,CIRC>& B, bool includingViewers )
@@ -252,6 +355,10 @@ void CopyFromNonRoot
   ( const Matrix<T>& A, Matrix<T>& B ); \
   EL_EXTERN template void Copy \
   ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B ); \
+  EL_EXTERN template void Copy \
+  ( const DistMultiVec<T>& A, AbstractDistMatrix<T>& B ); \
+  EL_EXTERN template void Copy \
+  ( const AbstractDistMatrix<T>& A, DistMultiVec<T>& B ); \
   EL_EXTERN template void CopyFromRoot \
   ( const Matrix<T>& A, DistMatrix<T,CIRC,CIRC>& B, bool includingViewers ); \
   EL_EXTERN template void CopyFromNonRoot \
@@ -12,6 +12,92 @@
 namespace El {
 namespace copy {
 
+template<typename T,Dist U,Dist V,Dist X,Dist Y>
+bool NodeSharedAllGather
+( const DistMatrix<T,U,V>& /*A*/, DistMatrix<T,X,Y>& /*B*/ )
+{ return false; }
+
+// Gather into a node-shared [STAR,STAR] matrix (see
+// DistMatrix<T,STAR,STAR>::SetNodeShared) by staging the portions of each
+// node in a shared buffer, exchanging the staged portions between the first
+// processes of the nodes, and then unpacking in parallel over the processes
+// of each node. The volume received by each node is then independent of its
+// number of processes. Returns false if B is not node-shared or if A has
+// redundant or cross portions.
+template<typename T,Dist U,Dist V>
+bool NodeSharedAllGather
+( const DistMatrix<T,U,V>& A, DistMatrix<T,STAR,STAR>& B )
+{
+    EL_DEBUG_CSE
+    if( !B.NodeShared() || A.CrossSize() != 1 || A.RedundantSize() != 1 )
+        return false;
+    const Grid& g = A.Grid();
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.ResizeNodeShared( height, width );
+
+    const Int colStride = A.ColStride();
+    const Int rowStride = A.RowStride();
+    const Int distStride = colStride*rowStride;
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+    mpi::SharedWindow& workspace = g.NodeWorkspace();
+    T* staging = static_cast<T*>
+      ( workspace.Require( distStride*portionSize*sizeof(T) ) );
+    auto portion = [&]( int distRank )
+      { return &staging[g.NodeSlot(g.CoordsToVC(U,V,distRank))*portionSize]; };
+
+    // Stage our portion
+    util::InterleaveMatrix
+    ( A.LocalHeight(), A.LocalWidth(),
+      A.LockedBuffer(),        1, A.LDim(),
+      portion(A.DistRank()), 1, A.LocalHeight() );
+    workspace.Synchronize();
+
+    // Exchange the staged portions of each node
+    const int numNodes = g.NumNodes();
+    if( numNodes > 1 && g.NodeRank() == 0 )
+    {
+        vector<int> recvCounts(numNodes), recvDispls(numNodes);
+        for( int node=0; node<numNodes; ++node )
+        {
+            recvDispls[node] = g.NodeOffset(node)*portionSize;
+            recvCounts[node] = g.NodeOffset(node+1)*portionSize -
+                               recvDispls[node];
+        }
+        // The send buffer may not overlap the receive buffer
+        const int node = g.Node();
+        const T* nodeStaging = &staging[recvDispls[node]];
+        vector<T> sendBuf( nodeStaging, nodeStaging+recvCounts[node] );
+        mpi::AllGather
+        ( sendBuf.data(), recvCounts[node],
+          staging, recvCounts.data(), recvDispls.data(),
+          g.NodeLeaderComm() );
+    }
+    workspace.Synchronize();
+
+    // Unpack in parallel over the processes of the node
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    const int nodeSize = g.NodeSize();
+    for( int distRank=g.NodeRank(); distRank<distStride; distRank+=nodeSize )
+    {
+        const int colRank = distRank % colStride;
+        const int rowRank = distRank / colStride;
+        const Int colShift = Shift_( colRank, A.ColAlign(), colStride );
+        const Int rowShift = Shift_( rowRank, A.RowAlign(), rowStride );
+        const Int localHeight = Length_( height, colShift, colStride );
+        const Int localWidth = Length_( width, rowShift, rowStride );
+        util::InterleaveMatrix
+        ( localHeight, localWidth,
+          portion(distRank),             1,         localHeight,
+          &BBuf[colShift+rowShift*BLDim], colStride, rowStride*BLDim );
+    }
+    B.SynchronizeNode();
+    return true;
+}
+
 template<typename T,Dist U,Dist V>
 void AllGather
 ( const DistMatrix<T,        U,           V   >& A,
@@ -19,6 +105,8 @@ void AllGather
 {
     EL_DEBUG_CSE
     AssertSameGrids( A, B );
+    if( NodeSharedAllGather( A, B ) )
+        return;
 
     const Int height = A.Height();
     const Int width = A.Width();
@@ -39,7 +127,7 @@ void AllGather
             const Int maxLocalHeight = MaxLength(height,colStride);
             const Int maxLocalWidth = MaxLength(width,rowStride);
             const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
-            vector<T> buf;
+            SimpleBuffer<T> buf( A.Grid().CommArena() );
             FastResize( buf, (distStride+1)*portionSize );
             T* sendBuf = &buf[0];
             T* recvBuf = &buf[portionSize];
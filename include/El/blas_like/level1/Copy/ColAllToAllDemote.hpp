@@ -51,7 +51,7 @@ void ColAllToAllDemote
         }
         else
         {
-            vector<T> buffer;
+            SimpleBuffer<T> buffer( A.Grid().CommArena() );
             FastResize( buffer, 2*colStrideUnion*portionSize );
             T* firstBuf  = &buffer[0];
             T* secondBuf = &buffer[colStrideUnion*portionSize];
@@ -87,7 +87,7 @@ void ColAllToAllDemote
         const Int sendColRankPart = Mod( colRankPart+colDiff, colStridePart );
         const Int recvColRankPart = Mod( colRankPart-colDiff, colStridePart );
 
-        vector<T> buffer;
+        SimpleBuffer<T> buffer( A.Grid().CommArena() );
         FastResize( buffer, 2*colStrideUnion*portionSize );
         T* firstBuf  = &buffer[0];
         T* secondBuf = &buffer[colStrideUnion*portionSize];
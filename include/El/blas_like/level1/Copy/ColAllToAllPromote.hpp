@@ -45,7 +45,7 @@ void ColAllToAllPromote
         }
         else
         {
-            vector<T> buffer;
+            SimpleBuffer<T> buffer( A.Grid().CommArena() );
             FastResize( buffer, 2*colStrideUnion*portionSize );
             T* firstBuf  = &buffer[0];
             T* secondBuf = &buffer[colStrideUnion*portionSize];
@@ -81,7 +81,7 @@ void ColAllToAllPromote
         const Int sendColRankPart = Mod( colRankPart+colDiff, colStridePart );
         const Int recvColRankPart = Mod( colRankPart-colDiff, colStridePart );
 
-        vector<T> buffer;
+        SimpleBuffer<T> buffer( A.Grid().CommArena() );
         FastResize( buffer, 2*colStrideUnion*portionSize );
         T* firstBuf  = &buffer[0];
         T* secondBuf = &buffer[colStrideUnion*portionSize];
@@ -53,7 +53,7 @@ void Exchange
     else if( contigB )
     {
         // Pack A's data
-        vector<T> buf;
+        SimpleBuffer<T> buf( A.Grid().CommArena() );
         FastResize( buf, sendSize );
         copy::util::InterleaveMatrix
         ( localHeightA, localWidthA,
@@ -68,7 +68,7 @@ void Exchange
     else if( contigA )
     {
         // Exchange with the partner
-        vector<T> buf;
+        SimpleBuffer<T> buf( A.Grid().CommArena() );
         FastResize( buf, recvSize );
         mpi::SendRecv
         ( A.LockedBuffer(), sendSize, sendRank,
@@ -83,7 +83,7 @@ void Exchange
     else
     {
         // Pack A's data
-        vector<T> sendBuf;
+        SimpleBuffer<T> sendBuf( A.Grid().CommArena() );
         FastResize( sendBuf, sendSize );
         copy::util::InterleaveMatrix
         ( localHeightA, localWidthA,
@@ -91,7 +91,7 @@ void Exchange
           sendBuf.data(),   1, localHeightA );
 
         // Exchange with the partner
-        vector<T> recvBuf;
+        SimpleBuffer<T> recvBuf( A.Grid().CommArena() );
         FastResize( recvBuf, recvSize );
         mpi::SendRecv
         ( sendBuf.data(), sendSize, sendRank,
@@ -52,7 +52,8 @@ void Gather
         recvCounts.resize( crossSize );
     mpi::Gather( &totalSend, 1, recvCounts.data(), 1, B.Root(), B.CrossComm() );
     int totalRecv = Scan( recvCounts, recvOffsets );
-    vector<T> sendBuf, recvBuf;
+    SimpleBuffer<T> sendBuf( A.Grid().CommArena() ),
+                    recvBuf( A.Grid().CommArena() );
     FastResize( sendBuf, totalSend );
     FastResize( recvBuf, totalRecv );
     if( !irrelevant )
@@ -127,7 +128,8 @@ void Gather
         recvCounts.resize( crossSize );
     mpi::Gather( &totalSend, 1, recvCounts.data(), 1, B.Root(), B.CrossComm() );
     int totalRecv = Scan( recvCounts, recvOffsets );
-    vector<T> sendBuf, recvBuf;
+    SimpleBuffer<T> sendBuf( A.Grid().CommArena() ),
+                    recvBuf( A.Grid().CommArena() );
     FastResize( sendBuf, totalSend );
     FastResize( recvBuf, totalRecv );
     if( !irrelevant )
@@ -65,7 +65,7 @@ void PartialColAllGather
         }
         else
         {
-            vector<T> buffer;
+            SimpleBuffer<T> buffer( A.Grid().CommArena() );
             FastResize( buffer, (colStrideUnion+1)*portionSize );
             T* firstBuf = &buffer[0];
             T* secondBuf = &buffer[portionSize];
@@ -97,7 +97,7 @@ void PartialColAllGather
         if( A.Grid().Rank() == 0 )
             cerr << "Unaligned PartialColAllGather" << endl;
 #endif
-        vector<T> buffer;
+        SimpleBuffer<T> buffer( A.Grid().CommArena() );
         FastResize( buffer, (colStrideUnion+1)*portionSize );
         T* firstBuf = &buffer[0];
         T* secondBuf = &buffer[portionSize];
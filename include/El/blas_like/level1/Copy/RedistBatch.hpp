@@ -0,0 +1,239 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_REDISTBATCH_HPP
+#define EL_BLAS_COPY_REDISTBATCH_HPP
+
+namespace El {
+
+// A batch of redistributions B := A which are executed together so that
+// those which AllGather over the same communicator -- e.g., a diagonal block
+// and a panel both redistributed from [VC,* ] to [* ,* ] -- are packed into a
+// single collective rather than each paying its own latency. The supported
+// gathers are (U,V) -> (U,* ), (U,V) -> (* ,V), and (U,V) -> (* ,* ) between
+// aligned element-wise distributions without a root; any other queued
+// redistribution is performed with Copy upon execution.
+//
+// The sources must remain valid (and unmodified) until Execute is called,
+// and no target may alias a queued source.
+template<typename T>
+class RedistBatch
+{
+public:
+    void Queue( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+
+    Int NumQueued() const EL_NO_EXCEPT { return ops_.size(); }
+
+    // Perform (and then dequeue) all of the queued redistributions
+    void Execute();
+
+private:
+    enum GatherType { ROW_GATHER, COL_GATHER, FULL_GATHER, NO_GATHER };
+
+    struct Op
+    {
+        const ElementalMatrix<T>* A;
+        ElementalMatrix<T>* B;
+        GatherType type;
+    };
+    vector<Op> ops_;
+
+    static GatherType Classify
+    ( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B );
+    static mpi::Comm GatherComm( const Op& op );
+    static void ExecuteGathers( const vector<Op>& ops );
+};
+
+template<typename T>
+typename RedistBatch<T>::GatherType RedistBatch<T>::Classify
+( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B )
+{
+    const Dist U = A.ColDist();
+    const Dist V = A.RowDist();
+    const Dist W = B.ColDist();
+    const Dist X = B.RowDist();
+    if( A.Grid() != B.Grid() || U == CIRC || V == CIRC ||
+        W == CIRC || X == CIRC || A.CrossSize() != 1 )
+        return NO_GATHER;
+    if( W == U && X == STAR && V != STAR )
+        return ROW_GATHER;
+    if( W == STAR && X == V && U != STAR )
+        return COL_GATHER;
+    if( W == STAR && X == STAR && U != STAR && V != STAR )
+        return FULL_GATHER;
+    return NO_GATHER;
+}
+
+template<typename T>
+mpi::Comm RedistBatch<T>::GatherComm( const Op& op )
+{
+    if( op.type == ROW_GATHER )
+        return op.A->RowComm();
+    else if( op.type == COL_GATHER )
+        return op.A->ColComm();
+    else
+        return op.A->DistComm();
+}
+
+template<typename T>
+void RedistBatch<T>::Queue
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    Op op;
+    op.A = &A;
+    op.B = &B;
+    op.type = Classify( A, B );
+    ops_.push_back( op );
+}
+
+template<typename T>
+void RedistBatch<T>::Execute()
+{
+    EL_DEBUG_CSE
+    vector<Op> ops;
+    ops.swap( ops_ );
+
+    // Resize the targets (as the individual gathers would) and fall back to
+    // Copy for those redistributions which cannot be fused
+    vector<vector<Op>> groups;
+    vector<mpi::Comm> groupComms;
+    for( auto& op : ops )
+    {
+        const ElementalMatrix<T>& A = *op.A;
+        ElementalMatrix<T>& B = *op.B;
+        const Int height = A.Height();
+        const Int width = A.Width();
+        if( op.type == ROW_GATHER )
+        {
+            B.AlignColsAndResize( A.ColAlign(), height, width, false, false );
+            if( B.ColAlign() != A.ColAlign() )
+                op.type = NO_GATHER;
+        }
+        else if( op.type == COL_GATHER )
+        {
+            B.AlignRowsAndResize( A.RowAlign(), height, width, false, false );
+            if( B.RowAlign() != A.RowAlign() )
+                op.type = NO_GATHER;
+        }
+        else if( op.type == FULL_GATHER )
+            B.Resize( height, width );
+
+        if( op.type == NO_GATHER )
+        {
+            Copy( A, B );
+            continue;
+        }
+        if( !A.Participating() )
+            continue;
+        const mpi::Comm comm = GatherComm( op );
+        Int group=0;
+        while( group < Int(groups.size()) && groupComms[group] != comm )
+            ++group;
+        if( group == Int(groups.size()) )
+        {
+            groups.emplace_back();
+            groupComms.push_back( comm );
+        }
+        groups[group].push_back( op );
+    }
+    for( const auto& group : groups )
+        ExecuteGathers( group );
+}
+
+template<typename T>
+void RedistBatch<T>::ExecuteGathers( const vector<Op>& ops )
+{
+    EL_DEBUG_CSE
+    const Int numOps = ops.size();
+    const mpi::Comm comm = GatherComm( ops[0] );
+    const int commSize = mpi::Size( comm );
+
+    // Each process contributes a fixed-size portion holding the (padded)
+    // local matrices of all of the sources
+    vector<Int> offsets( numOps+1, 0 );
+    for( Int op=0; op<numOps; ++op )
+    {
+        const ElementalMatrix<T>& A = *ops[op].A;
+        offsets[op+1] = offsets[op] +
+          MaxLength(A.Height(),A.ColStride())*
+          MaxLength(A.Width(),A.RowStride());
+    }
+    const Int portionSize = mpi::Pad( offsets[numOps] );
+
+    SimpleBuffer<T> buffer( ops[0].A->Grid().CommArena() );
+    FastResize( buffer, (commSize+1)*portionSize );
+    T* sendBuf = &buffer[0];
+    T* recvBuf = &buffer[portionSize];
+
+    // Pack
+    for( Int op=0; op<numOps; ++op )
+    {
+        const ElementalMatrix<T>& A = *ops[op].A;
+        const Int localHeight = A.LocalHeight();
+        copy::util::InterleaveMatrix
+        ( localHeight, A.LocalWidth(),
+          A.LockedBuffer(),     1, A.LDim(),
+          &sendBuf[offsets[op]], 1, localHeight );
+    }
+
+    // Communicate
+    mpi::AllGather( sendBuf, portionSize, recvBuf, portionSize, comm );
+
+    // Unpack the local matrix of each member of the communicator into the
+    // entries of B which it owns
+    for( int q=0; q<commSize; ++q )
+    {
+        for( Int op=0; op<numOps; ++op )
+        {
+            const ElementalMatrix<T>& A = *ops[op].A;
+            ElementalMatrix<T>& B = *ops[op].B;
+            const GatherType type = ops[op].type;
+            const int colStride = A.ColStride();
+            const int rowStride = A.RowStride();
+
+            int colRank, rowRank;
+            if( type == ROW_GATHER )
+            {
+                colRank = A.ColRank();
+                rowRank = q;
+            }
+            else if( type == COL_GATHER )
+            {
+                colRank = q;
+                rowRank = A.RowRank();
+            }
+            else
+            {
+                colRank = q % colStride;
+                rowRank = q / colStride;
+            }
+            const Int colShift = Shift( colRank, A.ColAlign(), colStride );
+            const Int rowShift = Shift( rowRank, A.RowAlign(), rowStride );
+            const Int localHeight = Length( A.Height(), colShift, colStride );
+            const Int localWidth = Length( A.Width(), rowShift, rowStride );
+            if( localHeight == 0 || localWidth == 0 )
+                continue;
+
+            // Gathered dimensions are strided within B while the others
+            // match those of A
+            const Int iFirst = ( type == ROW_GATHER ? 0 : colShift );
+            const Int jFirst = ( type == COL_GATHER ? 0 : rowShift );
+            const Int colStrideB = ( type == ROW_GATHER ? 1 : colStride );
+            const Int rowStrideB = ( type == COL_GATHER ? 1 : rowStride );
+            copy::util::InterleaveMatrix
+            ( localHeight, localWidth,
+              &recvBuf[q*portionSize+offsets[op]], 1, localHeight,
+              B.Buffer(iFirst,jFirst), colStrideB, rowStrideB*B.LDim() );
+        }
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_REDISTBATCH_HPP
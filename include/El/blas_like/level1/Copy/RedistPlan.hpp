@@ -0,0 +1,259 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_REDISTPLAN_HPP
+#define EL_BLAS_COPY_REDISTPLAN_HPP
+
+namespace El {
+
+// A persistent plan for repeatedly executing B[W,X] := A[U,V] for fixed
+// dimensions, alignments, and grid. The owner computations, the send
+// permutation, and the AllToAll counts and displacements of the
+// general-purpose redistribution are computed once, and the index metadata
+// is exchanged only during setup, so that each execution only packs,
+// exchanges, and unpacks the matrix entries.
+//
+// NOTE: MPI-4 persistent collectives (e.g., MPI_Alltoallv_init) could
+//       further reduce the per-execution overhead once they are widely
+//       available.
+template<typename T,Dist U,Dist V,Dist W,Dist X>
+class RedistPlan
+{
+public:
+    RedistPlan() { }
+    RedistPlan( const DistMatrix<T,U,V>& A, const DistMatrix<T,W,X>& B )
+    { Setup( A, B ); }
+
+    // The alignments (and grid) of B are taken as the target configuration
+    void Setup( const DistMatrix<T,U,V>& A, const DistMatrix<T,W,X>& B );
+
+    // Whether or not the plan is applicable to the given pair of matrices
+    bool Matches
+    ( const DistMatrix<T,U,V>& A,
+      const DistMatrix<T,W,X>& B ) const EL_NO_EXCEPT;
+
+    // Resize B and fill it with the contents of A
+    void Execute( const DistMatrix<T,U,V>& A, DistMatrix<T,W,X>& B ) const;
+
+    bool Initialized() const EL_NO_EXCEPT { return grid_ != nullptr; }
+
+private:
+    const El::Grid* grid_=nullptr;
+    Int height_=0, width_=0;
+    int colAlignA_=0, rowAlignA_=0, rootA_=0;
+    int colAlignB_=0, rowAlignB_=0, rootB_=0;
+
+    // Entries which are directly copied from A's local matrix to B's
+    vector<Int> copyRowsA_, copyColsA_, copyRowsB_, copyColsB_;
+
+    // The local indices of A packed (in order) into the send buffer
+    vector<Int> sendRows_, sendCols_;
+    vector<int> sendCounts_, sendOffs_;
+
+    // The local indices of B unpacked (in order) from the receive buffer
+    vector<Int> recvRows_, recvCols_;
+    vector<int> recvCounts_, recvOffs_;
+};
+
+template<typename T,Dist U,Dist V,Dist W,Dist X>
+void RedistPlan<T,U,V,W,X>::Setup
+( const DistMatrix<T,U,V>& A, const DistMatrix<T,W,X>& B )
+{
+    EL_DEBUG_CSE
+    if( A.Grid() != B.Grid() )
+        LogicError("Redistribution plans require a single grid");
+    const El::Grid& g = A.Grid();
+    grid_ = &g;
+    height_ = A.Height();
+    width_ = A.Width();
+    colAlignA_ = A.ColAlign();
+    rowAlignA_ = A.RowAlign();
+    rootA_ = A.Root();
+    colAlignB_ = B.ColAlign();
+    rowAlignB_ = B.RowAlign();
+    rootB_ = B.Root();
+
+    copyRowsA_.clear(); copyColsA_.clear();
+    copyRowsB_.clear(); copyColsB_.clear();
+    sendRows_.clear(); sendCols_.clear();
+    recvRows_.clear(); recvCols_.clear();
+    if( !g.InGrid() )
+        return;
+
+    // A temporary with the target configuration (but without storage) for
+    // determining the owners and local indices of B
+    DistMatrix<T,W,X> BMeta(g);
+    BMeta.Align( colAlignB_, rowAlignB_ );
+    BMeta.SetRoot( rootB_ );
+    BMeta.Resize( height_, width_ );
+    const bool noRedundant = BMeta.RedundantSize() == 1;
+    const bool BPartic = BMeta.Participating();
+    const int colStrideB = BMeta.ColStride();
+    const int colRankB = BMeta.ColRank();
+    const int rowRankB = BMeta.RowRank();
+
+    // We always send to redundant rank 0 of B
+    const int distSizeB = mpi::Size( BMeta.DistComm() );
+    vector<int> distBToVC(distSizeB);
+    for( int distRank=0; distRank<distSizeB; ++distRank )
+        distBToVC[distRank] =
+          g.CoordsToVC( W, X, distRank, rootB_, 0 );
+
+    const int vcSize = g.VCSize();
+    sendCounts_.assign( vcSize, 0 );
+    vector<int> owners;
+    vector<Int> sendRowsB, sendColsB, unsortedRows, unsortedCols;
+    if( A.Participating() && A.RedundantRank() == 0 )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        vector<int> ownerRows(localHeight);
+        vector<Int> localRows(localHeight);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            ownerRows[iLoc] = BMeta.RowOwner(i);
+            localRows[iLoc] = BMeta.LocalRow(i,ownerRows[iLoc]);
+        }
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            const int ownerCol = BMeta.ColOwner(j);
+            const Int localCol = BMeta.LocalCol(j,ownerCol);
+            const bool isLocalCol = ( BPartic && ownerCol == rowRankB );
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const int ownerRow = ownerRows[iLoc];
+                const bool isLocalRow = ( BPartic && ownerRow == colRankB );
+                if( noRedundant && isLocalRow && isLocalCol )
+                {
+                    copyRowsA_.push_back( iLoc );
+                    copyColsA_.push_back( jLoc );
+                    copyRowsB_.push_back( localRows[iLoc] );
+                    copyColsB_.push_back( localCol );
+                }
+                else
+                {
+                    const int owner =
+                      distBToVC[ownerRow+colStrideB*ownerCol];
+                    owners.push_back( owner );
+                    unsortedRows.push_back( iLoc );
+                    unsortedCols.push_back( jLoc );
+                    sendRowsB.push_back( localRows[iLoc] );
+                    sendColsB.push_back( localCol );
+                    ++sendCounts_[owner];
+                }
+            }
+        }
+    }
+
+    // Form the send permutation and the (row,column) pairs for B
+    const Int totalSend = Scan( sendCounts_, sendOffs_ );
+    sendRows_.resize( totalSend );
+    sendCols_.resize( totalSend );
+    vector<Int> sendIndsB(2*totalSend);
+    auto offs = sendOffs_;
+    for( Int k=0; k<totalSend; ++k )
+    {
+        const Int s = offs[owners[k]]++;
+        sendRows_[s] = unsortedRows[k];
+        sendCols_[s] = unsortedCols[k];
+        sendIndsB[2*s  ] = sendRowsB[k];
+        sendIndsB[2*s+1] = sendColsB[k];
+    }
+
+    // Exchange the metadata once and for all
+    mpi::Comm comm = g.VCComm();
+    recvCounts_.resize( vcSize );
+    mpi::AllToAll( sendCounts_.data(), 1, recvCounts_.data(), 1, comm );
+    const Int totalRecv = Scan( recvCounts_, recvOffs_ );
+
+    vector<int> sendIndCounts(vcSize), sendIndOffs(vcSize),
+                recvIndCounts(vcSize), recvIndOffs(vcSize);
+    for( int q=0; q<vcSize; ++q )
+    {
+        sendIndCounts[q] = 2*sendCounts_[q];
+        sendIndOffs[q] = 2*sendOffs_[q];
+        recvIndCounts[q] = 2*recvCounts_[q];
+        recvIndOffs[q] = 2*recvOffs_[q];
+    }
+    vector<Int> recvIndsB(2*totalRecv);
+    mpi::AllToAll
+    ( sendIndsB.data(), sendIndCounts.data(), sendIndOffs.data(),
+      recvIndsB.data(), recvIndCounts.data(), recvIndOffs.data(), comm );
+
+    recvRows_.resize( totalRecv );
+    recvCols_.resize( totalRecv );
+    for( Int k=0; k<totalRecv; ++k )
+    {
+        recvRows_[k] = recvIndsB[2*k];
+        recvCols_[k] = recvIndsB[2*k+1];
+    }
+}
+
+template<typename T,Dist U,Dist V,Dist W,Dist X>
+bool RedistPlan<T,U,V,W,X>::Matches
+( const DistMatrix<T,U,V>& A,
+  const DistMatrix<T,W,X>& B ) const EL_NO_EXCEPT
+{
+    if( grid_ == nullptr || A.Grid() != *grid_ || B.Grid() != *grid_ )
+        return false;
+    if( A.Height() != height_ || A.Width() != width_ ||
+        A.ColAlign() != colAlignA_ || A.RowAlign() != rowAlignA_ ||
+        A.Root() != rootA_ || B.Root() != rootB_ )
+        return false;
+    // B will be resized, so its alignments only matter if they are fixed
+    // or if it is a view
+    if( B.ColAlign() != colAlignB_ || B.RowAlign() != rowAlignB_ )
+        return false;
+    return true;
+}
+
+template<typename T,Dist U,Dist V,Dist W,Dist X>
+void RedistPlan<T,U,V,W,X>::Execute
+( const DistMatrix<T,U,V>& A, DistMatrix<T,W,X>& B ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !Matches( A, B ) )
+          LogicError("Redistribution plan does not match the matrices");
+    )
+    B.Resize( height_, width_ );
+    const El::Grid& g = *grid_;
+    if( !g.InGrid() )
+        return;
+
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+
+    const Int numCopies = copyRowsA_.size();
+    for( Int k=0; k<numCopies; ++k )
+        BBuf[copyRowsB_[k]+copyColsB_[k]*BLDim] =
+          ABuf[copyRowsA_[k]+copyColsA_[k]*ALDim];
+
+    const Int totalSend = sendRows_.size();
+    const Int totalRecv = recvRows_.size();
+    SimpleBuffer<T> sendBuf( totalSend, g.CommArena() ),
+                    recvBuf( totalRecv, g.CommArena() );
+    for( Int k=0; k<totalSend; ++k )
+        sendBuf[k] = ABuf[sendRows_[k]+sendCols_[k]*ALDim];
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts_.data(), sendOffs_.data(),
+      recvBuf.data(), recvCounts_.data(), recvOffs_.data(), g.VCComm() );
+    for( Int k=0; k<totalRecv; ++k )
+        BBuf[recvRows_[k]+recvCols_[k]*BLDim] = recvBuf[k];
+
+    if( B.Participating() && B.RedundantSize() > 1 )
+        El::Broadcast( B, B.RedundantComm(), 0 );
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_REDISTPLAN_HPP
@@ -50,7 +50,7 @@ void Scatter
         return;
     }
 
-    vector<T> buffer;
+    SimpleBuffer<T> buffer( A.Grid().CommArena() );
     T* recvBuf=0; // some compilers (falsely) warn otherwise
     if( A.CrossRank() == root )
     {
@@ -37,11 +37,16 @@ void Translate
         B.AlignCols( colAlign, false );
     if( !B.RowConstrained() )
         B.AlignRows( rowAlign, false );
+    const bool aligned = colAlign == B.ColAlign() && rowAlign == B.RowAlign();
+    // Share the local buffer (rather than allocating and then overwriting
+    // a new one) if copy-on-write is enabled
+    const bool shared =
+      CopyOnWrite() && aligned && root == B.Root() && g.InGrid() &&
+      B.Matrix().ShareWith( A.LockedMatrix() );
     B.Resize( height, width );
-    if( !g.InGrid() )
+    if( !g.InGrid() || shared )
         return;
 
-    const bool aligned = colAlign == B.ColAlign() && rowAlign == B.RowAlign();
     if( aligned && root == B.Root() )
     {
         Copy( A.LockedMatrix(), B.Matrix() );
@@ -60,7 +65,7 @@ void Translate
         const Int maxHeight = MaxLength( height, colStride );
         const Int maxWidth  = MaxLength( width,  rowStride );
         const Int pkgSize = mpi::Pad( maxHeight*maxWidth );
-        vector<T> buffer;
+        SimpleBuffer<T> buffer( A.Grid().CommArena() );
         if( crossRank == root || crossRank == B.Root() )
             FastResize( buffer, pkgSize );
 
@@ -138,11 +143,16 @@ void Translate
         B.AlignCols( blockHeight, colAlign, colCut, false );
     if( !B.RowConstrained() && B.BlockWidth() == blockWidth )
         B.AlignRows( blockWidth, rowAlign, rowCut, false );
-    B.Resize( height, width );
     const bool aligned =
         blockHeight == B.BlockHeight() && blockWidth == B.BlockWidth() &&
         colAlign    == B.ColAlign()    && rowAlign   == B.RowAlign() &&
         colCut      == B.ColCut()      && rowCut     == B.RowCut();
+    const bool shared =
+      CopyOnWrite() && aligned && root == B.Root() && A.Grid().InGrid() &&
+      B.Matrix().ShareWith( A.LockedMatrix() );
+    B.Resize( height, width );
+    if( shared )
+        return;
     if( A.Grid().Size() == 1 || (aligned && root == B.Root()) )
     {
         Copy( A.LockedMatrix(), B.Matrix() );
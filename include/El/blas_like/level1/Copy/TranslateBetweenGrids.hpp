@@ -107,7 +107,7 @@ void TranslateBetweenGrids
         requiredMemory += maxSendSize;
     if( inBGrid )
         requiredMemory += maxSendSize;
-    vector<T> auxBuf;
+    SimpleBuffer<T> auxBuf( A.Grid().CommArena() );
     FastResize( auxBuf, requiredMemory );
     Int offset = 0;
     T* sendBuf = &auxBuf[offset];
@@ -290,7 +290,7 @@ void TranslateBetweenGrids
         requiredMemory += height*width;
     if( B.Participating() )
         requiredMemory += height*width;
-    vector<T> buffer;
+    SimpleBuffer<T> buffer( A.Grid().CommArena() );
     FastResize( buffer, requiredMemory );
     Int offset = 0;
     T* sendBuf = &buffer[offset];
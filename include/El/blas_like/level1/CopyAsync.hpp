@@ -0,0 +1,424 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPYASYNC_HPP
+#define EL_BLAS_COPYASYNC_HPP
+
+namespace El {
+
+template<typename T>
+RedistFuture<T>::RedistFuture( RedistFuture<T>&& future )
+: pending_(future.pending_),
+  request_(std::move(future.request_)),
+  buffer_(std::move(future.buffer_)),
+  finish_(std::move(future.finish_))
+{ future.pending_ = false; }
+
+template<typename T>
+RedistFuture<T>& RedistFuture<T>::operator=( RedistFuture<T>&& future )
+{
+    if( this != &future )
+    {
+        Wait();
+        pending_ = future.pending_;
+        request_ = std::move(future.request_);
+        buffer_ = std::move(future.buffer_);
+        finish_ = std::move(future.finish_);
+        future.pending_ = false;
+    }
+    return *this;
+}
+
+template<typename T>
+RedistFuture<T>::~RedistFuture()
+{
+    // Ensure that MPI is not left writing into a freed buffer
+    if( pending_ )
+        Wait();
+}
+
+template<typename T>
+bool RedistFuture<T>::Test()
+{
+    EL_DEBUG_CSE
+    if( !pending_ )
+        return true;
+    if( !mpi::Test( request_ ) )
+        return false;
+    Finish();
+    return true;
+}
+
+template<typename T>
+void RedistFuture<T>::Wait()
+{
+    EL_DEBUG_CSE
+    if( !pending_ )
+        return;
+    mpi::Wait( request_ );
+    Finish();
+}
+
+template<typename T>
+T* RedistFuture<T>::Reserve( Int size, bool zero )
+{
+    EL_DEBUG_CSE
+    if( pending_ )
+        LogicError("Cannot reserve the buffer of a pending redistribution");
+    if( zero )
+        buffer_.assign( size, T(0) );
+    else
+        FastResize( buffer_, size );
+    return buffer_.data();
+}
+
+template<typename T>
+void RedistFuture<T>::Start( function<void(const T*)> finish )
+{
+    EL_DEBUG_CSE
+    finish_ = std::move(finish);
+    pending_ = true;
+}
+
+template<typename T>
+void RedistFuture<T>::Finish()
+{
+    pending_ = false;
+    if( finish_ )
+        finish_( buffer_.data() );
+    finish_ = nullptr;
+    SwapClear( buffer_ );
+}
+
+namespace copy {
+
+// (U,V) |-> (U,Collect(V))
+template<typename T>
+void RowAllGatherAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B,
+  RedistFuture<T>& future )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize( A.ColAlign(), height, width, false, false );
+    if( B.ColAlign() != A.ColAlign() || A.RowStride() == 1 || width == 1 ||
+        A.CrossComm() != mpi::COMM_SELF )
+    {
+        Copy( A, B );
+        return;
+    }
+    if( !A.Participating() )
+        return;
+
+    const Int rowStride = A.RowStride();
+    const Int rowAlign = A.RowAlign();
+    const Int localHeight = A.LocalHeight();
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
+    T* sendBuf = future.Reserve( (rowStride+1)*portionSize );
+    T* recvBuf = &sendBuf[portionSize];
+
+    // Pack
+    util::InterleaveMatrix
+    ( localHeight, A.LocalWidth(),
+      A.LockedBuffer(), 1, A.LDim(),
+      sendBuf,          1, localHeight );
+
+    // Start the communication
+    mpi::IAllGather
+    ( sendBuf, portionSize, recvBuf, portionSize, A.RowComm(),
+      future.Request() );
+
+    // Unpack upon completion
+    future.Start
+    ( [=,&B]( const T* buffer )
+      {
+          util::RowStridedUnpack
+          ( localHeight, width, rowAlign, rowStride,
+            &buffer[portionSize], portionSize,
+            B.Buffer(), B.LDim() );
+      } );
+}
+
+// (U,V) |-> (Collect(U),V)
+template<typename T>
+void ColAllGatherAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B,
+  RedistFuture<T>& future )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignRowsAndResize( A.RowAlign(), height, width, false, false );
+    if( B.RowAlign() != A.RowAlign() || A.ColStride() == 1 || height == 1 ||
+        A.CrossComm() != mpi::COMM_SELF )
+    {
+        Copy( A, B );
+        return;
+    }
+    if( !A.Participating() )
+        return;
+
+    const Int colStride = A.ColStride();
+    const Int colAlign = A.ColAlign();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    const Int portionSize = mpi::Pad( maxLocalHeight*localWidth );
+    T* sendBuf = future.Reserve( (colStride+1)*portionSize );
+    T* recvBuf = &sendBuf[portionSize];
+
+    // Pack
+    util::InterleaveMatrix
+    ( localHeight, localWidth,
+      A.LockedBuffer(), 1, A.LDim(),
+      sendBuf,          1, localHeight );
+
+    // Start the communication
+    mpi::IAllGather
+    ( sendBuf, portionSize, recvBuf, portionSize, A.ColComm(),
+      future.Request() );
+
+    // Unpack upon completion
+    future.Start
+    ( [=,&B]( const T* buffer )
+      {
+          util::ColStridedUnpack
+          ( height, localWidth, colAlign, colStride,
+            &buffer[portionSize], portionSize,
+            B.Buffer(), B.LDim() );
+      } );
+}
+
+// (Partial(U),PartialUnionRow(U,V)) |-> (U,V), e.g., [MC,MR] -> [VC,* ]
+template<typename T>
+void ColAllToAllDemoteAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B,
+  RedistFuture<T>& future )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize( A.ColAlign(), height, width, false, false );
+    if( !B.Participating() )
+        return;
+
+    const Int colAlign = B.ColAlign();
+    const Int colStride = B.ColStride();
+    const Int colStridePart = B.PartialColStride();
+    const Int colStrideUnion = B.PartialUnionColStride();
+    const Int colRankPart = B.PartialColRank();
+    const Int colDiff = Mod(colAlign,colStridePart) - A.ColAlign();
+    if( colDiff != 0 || colStrideUnion == 1 )
+    {
+        Copy( A, B );
+        return;
+    }
+
+    const Int rowAlignA = A.RowAlign();
+    const Int localHeightB = B.LocalHeight();
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    const Int maxLocalWidth = MaxLength(width,colStrideUnion);
+    const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+    T* firstBuf = future.Reserve( 2*colStrideUnion*portionSize );
+    T* secondBuf = &firstBuf[colStrideUnion*portionSize];
+
+    // Pack
+    util::PartialColStridedPack
+    ( height, A.LocalWidth(),
+      colAlign, colStride,
+      colStrideUnion, colStridePart, colRankPart,
+      A.ColShift(),
+      A.LockedBuffer(), A.LDim(),
+      firstBuf,         portionSize );
+
+    // Start simultaneously scattering in columns and gathering in rows
+    mpi::IAllToAll
+    ( firstBuf,  portionSize,
+      secondBuf, portionSize, B.PartialUnionColComm(), future.Request() );
+
+    // Unpack upon completion
+    future.Start
+    ( [=,&B]( const T* buffer )
+      {
+          util::RowStridedUnpack
+          ( localHeightB, width,
+            rowAlignA, colStrideUnion,
+            &buffer[colStrideUnion*portionSize], portionSize,
+            B.Buffer(), B.LDim() );
+      } );
+}
+
+// (U,Collect(V)) |-> (U,V) with a summation over the rows
+template<typename T>
+void RowSumScatterAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B,
+  RedistFuture<T>& future )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize( A.ColAlign(), height, width, false, false );
+    if( B.ColAlign() != A.ColAlign() || width == 1 )
+    {
+        Contract( A, B );
+        return;
+    }
+    if( !B.Participating() )
+        return;
+
+    const Int rowStride = B.RowStride();
+    const Int localHeight = B.LocalHeight();
+    const Int localWidth = B.LocalWidth();
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
+
+    // We explicitly zero-initialize to avoid reducing uninitialized padding
+    T* sendBuf = future.Reserve( (rowStride+1)*portionSize, true );
+    T* recvBuf = &sendBuf[rowStride*portionSize];
+
+    // Pack
+    util::RowStridedPack
+    ( localHeight, width,
+      B.RowAlign(), rowStride,
+      A.LockedBuffer(), A.LDim(),
+      sendBuf,          portionSize );
+
+    // Start the communication
+    mpi::IReduceScatter
+    ( sendBuf, recvBuf, portionSize, B.RowComm(), future.Request() );
+
+    // Unpack upon completion
+    future.Start
+    ( [=,&B]( const T* buffer )
+      {
+          util::InterleaveMatrix
+          ( localHeight, localWidth,
+            &buffer[rowStride*portionSize], 1, localHeight,
+            B.Buffer(),                     1, B.LDim() );
+      } );
+}
+
+// (Collect(U),V) |-> (U,V) with a summation over the columns
+template<typename T>
+void ColSumScatterAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B,
+  RedistFuture<T>& future )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignRowsAndResize( A.RowAlign(), height, width, false, false );
+    if( B.RowAlign() != A.RowAlign() )
+    {
+        Contract( A, B );
+        return;
+    }
+    if( !B.Participating() )
+        return;
+
+    const Int colStride = B.ColStride();
+    const Int localHeight = B.LocalHeight();
+    const Int localWidth = B.LocalWidth();
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    const Int portionSize = mpi::Pad( maxLocalHeight*localWidth );
+
+    // We explicitly zero-initialize to avoid reducing uninitialized padding
+    T* sendBuf = future.Reserve( (colStride+1)*portionSize, true );
+    T* recvBuf = &sendBuf[colStride*portionSize];
+
+    // Pack
+    util::ColStridedPack
+    ( height, localWidth,
+      B.ColAlign(), colStride,
+      A.LockedBuffer(), A.LDim(),
+      sendBuf,          portionSize );
+
+    // Start the communication
+    mpi::IReduceScatter
+    ( sendBuf, recvBuf, portionSize, B.ColComm(), future.Request() );
+
+    // Unpack upon completion
+    future.Start
+    ( [=,&B]( const T* buffer )
+      {
+          util::InterleaveMatrix
+          ( localHeight, localWidth,
+            &buffer[colStride*portionSize], 1, localHeight,
+            B.Buffer(),                     1, B.LDim() );
+      } );
+}
+
+} // namespace copy
+
+template<typename T>
+RedistFuture<T> CopyAsync( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( A, B );
+    RedistFuture<T> future;
+    const Dist U = A.ColDist();
+    const Dist V = A.RowDist();
+    const Dist W = B.ColDist();
+    const Dist X = B.RowDist();
+    if( W == U && X == Collect(V) && X != V )
+        copy::RowAllGatherAsync( A, B, future );
+    else if( W == Collect(U) && W != U && X == V )
+        copy::ColAllGatherAsync( A, B, future );
+    else if( X == STAR && (W == VC || W == VR) &&
+             U == Partial(W) && V == (W==VC ? MR : MC) )
+        copy::ColAllToAllDemoteAsync( A, B, future );
+    else
+        Copy( A, B );
+    return future;
+}
+
+template<typename T>
+RedistFuture<T>
+ContractAsync( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( A, B );
+    RedistFuture<T> future;
+    const Dist U = B.ColDist();
+    const Dist V = B.RowDist();
+    if( A.ColDist() == U && A.RowDist() == Collect(V) && V != Collect(V) )
+        copy::RowSumScatterAsync( A, B, future );
+    else if( A.ColDist() == Collect(U) && U != Collect(U) && A.RowDist() == V )
+        copy::ColSumScatterAsync( A, B, future );
+    else
+        Contract( A, B );
+    return future;
+}
+
+#ifdef EL_INSTANTIATE_BLAS_LEVEL1
+# define EL_EXTERN
+#else
+# define EL_EXTERN extern
+#endif
+
+#define PROTO(T) \
+  EL_EXTERN template class RedistFuture<T>; \
+  EL_EXTERN template RedistFuture<T> CopyAsync \
+  ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B ); \
+  EL_EXTERN template RedistFuture<T> ContractAsync \
+  ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+#undef EL_EXTERN
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPYASYNC_HPP
@@ -137,6 +137,23 @@ void DiagonalScale
     #include <El/macros/GuardAndPayload.h>
 }
 
+template<typename TDiag,typename T>
+void DiagonalScale
+( LeftOrRight side,
+  Orientation orientation,
+  const DistMultiVec<TDiag>& d,
+        DistMultiVec<T>& X )
+{
+    EL_DEBUG_CSE
+    if( side != LEFT )
+        LogicError("Only the 'LEFT' argument is currently supported");
+    if( d.Height() != X.Height() )
+        LogicError("d and X must be the same size");
+    if( d.Grid() != X.Grid() )
+        LogicError("d and X must share a grid");
+    DiagonalScale( LEFT, orientation, d.LockedMatrix(), X.Matrix() );
+}
+
 
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
@@ -154,7 +171,12 @@ void DiagonalScale
   ( LeftOrRight side, \
     Orientation orientation, \
     const AbstractDistMatrix<T>& d, \
-          AbstractDistMatrix<T>& A );
+          AbstractDistMatrix<T>& A ); \
+  EL_EXTERN template void DiagonalScale \
+  ( LeftOrRight side, \
+    Orientation orientation, \
+    const DistMultiVec<T>& d, \
+          DistMultiVec<T>& X );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -177,6 +177,24 @@ void DiagonalSolve
     #include <El/macros/GuardAndPayload.h>
 }
 
+template<typename FDiag,typename F>
+void DiagonalSolve
+( LeftOrRight side, Orientation orientation,
+  const DistMultiVec<FDiag>& d,
+        DistMultiVec<F>& X,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+    if( side != LEFT )
+        LogicError("Only the 'LEFT' argument is currently supported");
+    if( d.Height() != X.Height() )
+        LogicError("d and X must be the same size");
+    if( d.Grid() != X.Grid() )
+        LogicError("d and X must share a grid");
+    DiagonalSolve
+    ( LEFT, orientation, d.LockedMatrix(), X.Matrix(), checkIfSingular );
+}
+
 
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
@@ -199,6 +217,12 @@ void DiagonalSolve
     Orientation orientation, \
     const AbstractDistMatrix<F>& d, \
           AbstractDistMatrix<F>& A, \
+    bool checkIfSingular ); \
+  EL_EXTERN template void DiagonalSolve \
+  ( LeftOrRight side, \
+    Orientation orientation, \
+    const DistMultiVec<F>& d, \
+          DistMultiVec<F>& X, \
     bool checkIfSingular );
 
 #define EL_NO_INT_PROTO
@@ -11,20 +11,35 @@
 
 namespace El {
 
-template<typename T>
-void EntrywiseFill( Matrix<T>& A, function<T(void)> func )
+// The functor is called sequentially in column-major order (it is typically
+// a stateful random number generator, and so it is taken by value so that
+// mutable lambdas are accepted), but the overloads accepting an arbitrary
+// functor avoid the indirect call per entry of a std::function.
+
+template<typename T,class Func>
+void EntrywiseFill( Matrix<T>& A, Func func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
     for( Int j=0; j<n; ++j )
         for( Int i=0; i<m; ++i )
-            A(i,j) = func();
+            ABuf[i+j*ALDim] = func();
 }
 
+template<typename T,class Func>
+void EntrywiseFill( AbstractDistMatrix<T>& A, Func func )
+{ EntrywiseFill<T,Func>( A.Matrix(), func ); }
+
+template<typename T>
+void EntrywiseFill( Matrix<T>& A, function<T(void)> func )
+{ EntrywiseFill<T,function<T(void)>>( A, func ); }
+
 template<typename T>
 void EntrywiseFill( AbstractDistMatrix<T>& A, function<T(void)> func )
-{ EntrywiseFill( A.Matrix(), func ); }
+{ EntrywiseFill<T,function<T(void)>>( A, func ); }
 
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
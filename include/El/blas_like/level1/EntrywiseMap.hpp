@@ -24,7 +24,7 @@ void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
     // iterate over double loop.
     if( ALDim == m )
     {
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_GRAIN(m*n)
         for( Int i=0; i<m*n; ++i )
         {
             ABuf[i] = func(ABuf[i]);
@@ -32,7 +32,7 @@ void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
     }
     else
     {
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_GRAIN(m*n)
         for( Int j=0; j<n; ++j )
         {
             EL_SIMD
@@ -60,7 +60,7 @@ void EntrywiseMap
     T* BBuf = B.Buffer();
     const Int ALDim = A.LDim();
     const Int BLDim = B.LDim();
-    EL_PARALLEL_FOR
+    EL_PARALLEL_FOR_GRAIN(m*n)
     for( Int j=0; j<n; ++j )
     {
         EL_SIMD
@@ -103,6 +103,60 @@ void EntrywiseMap
     }
 }
 
+// Apply the map to only the 'uplo' triangle of A, which suffices when A is
+// Hermitian (or symmetric), is only accessed through that triangle, and
+// func(Conj(alpha)) = Conj(func(alpha)) (or func is applied to a symmetric
+// matrix). The opposite strictly triangular part of A is left untouched.
+template<typename T>
+void HermitianEntrywiseMap
+( UpperOrLower uplo, Matrix<T>& A, function<T(const T&)> func )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    const Int n = A.Height();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR_GRAIN(n*n/2)
+    for( Int j=0; j<n; ++j )
+    {
+        const Int iBeg = ( uplo==LOWER ? j : 0 );
+        const Int iEnd = ( uplo==LOWER ? n : j+1 );
+        EL_SIMD
+        for( Int i=iBeg; i<iEnd; ++i )
+        {
+            ABuf[i+j*ALDim] = func(ABuf[i+j*ALDim]);
+        }
+    }
+}
+
+template<typename T>
+void HermitianEntrywiseMap
+( UpperOrLower uplo, AbstractDistMatrix<T>& A, function<T(const T&)> func )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    const Int n = A.Height();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg =
+          ( uplo==LOWER ? A.LocalRowOffset(Min(j,n)) : 0 );
+        const Int iLocEnd =
+          ( uplo==LOWER ? localHeight : A.LocalRowOffset(Min(j+1,n)) );
+        EL_SIMD
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+        {
+            ABuf[iLoc+jLoc*ALDim] = func(ABuf[iLoc+jLoc*ALDim]);
+        }
+    }
+}
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -123,7 +177,12 @@ void EntrywiseMap
   EL_EXTERN template void EntrywiseMap \
   ( const AbstractDistMatrix<T>& A, \
           AbstractDistMatrix<T>& B, \
-          function<T(const T&)> func );
+          function<T(const T&)> func ); \
+  EL_EXTERN template void HermitianEntrywiseMap \
+  ( UpperOrLower uplo, Matrix<T>& A, function<T(const T&)> func ); \
+  EL_EXTERN template void HermitianEntrywiseMap \
+  ( UpperOrLower uplo, AbstractDistMatrix<T>& A, \
+    function<T(const T&)> func );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
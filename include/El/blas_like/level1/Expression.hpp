@@ -0,0 +1,361 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_EXPRESSION_HPP
+#define EL_BLAS_EXPRESSION_HPP
+
+// Lazily-evaluated entrywise expressions of matrices, e.g.,
+//
+//   expr::Evaluate( alpha*expr::Lazy(A) + beta*Hadamard(expr::Lazy(B),
+//                   expr::Lazy(D)), C );
+//
+// forms C(i,j) := alpha A(i,j) + beta B(i,j) D(i,j) in a single pass over
+// memory rather than one pass (and possibly one temporary) per operation.
+//
+// The operands of a distributed expression must have the same grid but may
+// have any distributions: those whose distribution (including alignments
+// and block sizes) matches that of the target are read in place, and each
+// of the others is redistributed into a temporary exactly once. If the
+// target's alignments are unconstrained, it is first aligned with an
+// operand of the same distribution when one exists.
+
+namespace El {
+namespace expr {
+
+// The base class of all expressions (via the Curiously Recurring Template
+// Pattern)
+template<typename E>
+struct Expression
+{
+    const E& Derived() const { return static_cast<const E&>(*this); }
+};
+
+// The redistributed copies of the operands of a distributed expression,
+// keyed on the original operands
+template<typename T>
+class Workspace
+{
+public:
+    const AbstractDistMatrix<T>& Redistribute
+    ( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& C )
+    {
+        EL_DEBUG_CSE
+        for( const auto& entry : copies_ )
+            if( entry.first == &A )
+                return *entry.second;
+        unique_ptr<AbstractDistMatrix<T>>
+          ACopy( C.Construct( C.Grid(), C.Root() ) );
+        ACopy->AlignWith( C.DistData() );
+        Copy( A, *ACopy );
+        copies_.emplace_back( &A, std::move(ACopy) );
+        return *copies_.back().second;
+    }
+
+private:
+    vector<std::pair<const AbstractDistMatrix<T>*,
+                     unique_ptr<AbstractDistMatrix<T>>>> copies_;
+};
+
+// A (sequential or distributed) matrix operand
+template<typename T>
+class Leaf : public Expression<Leaf<T>>
+{
+public:
+    typedef T value_type;
+
+    explicit Leaf( const Matrix<T>& A )
+    : A_(&A), ADist_(nullptr), buffer_(A.LockedBuffer()), ldim_(A.LDim())
+    { }
+
+    explicit Leaf( const AbstractDistMatrix<T>& A )
+    : A_(nullptr), ADist_(&A), buffer_(nullptr), ldim_(1)
+    { }
+
+    Int Height() const { return A_ ? A_->Height() : ADist_->Height(); }
+    Int Width() const { return A_ ? A_->Width() : ADist_->Width(); }
+
+    void Operands( vector<const AbstractDistMatrix<T>*>& operands ) const
+    {
+        if( ADist_ )
+            operands.push_back( ADist_ );
+    }
+
+    void Bind()
+    {
+        if( !A_ )
+            LogicError("Expression mixed sequential and distributed operands");
+        buffer_ = A_->LockedBuffer();
+        ldim_ = A_->LDim();
+    }
+
+    void Bind( const AbstractDistMatrix<T>& C, Workspace<T>& workspace )
+    {
+        if( !ADist_ )
+            LogicError("Expression mixed sequential and distributed operands");
+        AssertSameGrids( *ADist_, C );
+        const AbstractDistMatrix<T>& ALocal =
+          ( ADist_->DistData() == C.DistData() ?
+            *ADist_ : workspace.Redistribute( *ADist_, C ) );
+        buffer_ = ALocal.LockedBuffer();
+        ldim_ = ALocal.LDim();
+    }
+
+    T operator()( Int iLoc, Int jLoc ) const
+    { return buffer_[iLoc+jLoc*ldim_]; }
+
+private:
+    const Matrix<T>* A_;
+    const AbstractDistMatrix<T>* ADist_;
+    const T* buffer_;
+    Int ldim_;
+};
+
+// alpha E
+template<typename E>
+class Scaled : public Expression<Scaled<E>>
+{
+public:
+    typedef typename E::value_type value_type;
+
+    Scaled( value_type alpha, const E& e ) : alpha_(alpha), e_(e) { }
+
+    Int Height() const { return e_.Height(); }
+    Int Width() const { return e_.Width(); }
+
+    void Operands
+    ( vector<const AbstractDistMatrix<value_type>*>& operands ) const
+    { e_.Operands( operands ); }
+
+    void Bind() { e_.Bind(); }
+    void Bind
+    ( const AbstractDistMatrix<value_type>& C,
+      Workspace<value_type>& workspace )
+    { e_.Bind( C, workspace ); }
+
+    value_type operator()( Int iLoc, Int jLoc ) const
+    { return alpha_*e_(iLoc,jLoc); }
+
+private:
+    value_type alpha_;
+    E e_;
+};
+
+// Op(E1,E2), where Op is applied entrywise
+template<typename Op,typename E1,typename E2>
+class Binary : public Expression<Binary<Op,E1,E2>>
+{
+public:
+    typedef typename E1::value_type value_type;
+    static_assert
+    ( std::is_same<value_type,typename E2::value_type>::value,
+      "Expression operands must have the same type" );
+
+    Binary( const E1& e1, const E2& e2 ) : e1_(e1), e2_(e2)
+    {
+        if( e1.Height() != e2.Height() || e1.Width() != e2.Width() )
+            LogicError
+            ("Nonconformal expression: ",e1.Height()," x ",e1.Width(),
+             " and ",e2.Height()," x ",e2.Width());
+    }
+
+    Int Height() const { return e1_.Height(); }
+    Int Width() const { return e1_.Width(); }
+
+    void Operands
+    ( vector<const AbstractDistMatrix<value_type>*>& operands ) const
+    {
+        e1_.Operands( operands );
+        e2_.Operands( operands );
+    }
+
+    void Bind()
+    {
+        e1_.Bind();
+        e2_.Bind();
+    }
+    void Bind
+    ( const AbstractDistMatrix<value_type>& C,
+      Workspace<value_type>& workspace )
+    {
+        e1_.Bind( C, workspace );
+        e2_.Bind( C, workspace );
+    }
+
+    value_type operator()( Int iLoc, Int jLoc ) const
+    { return Op::Apply( e1_(iLoc,jLoc), e2_(iLoc,jLoc) ); }
+
+private:
+    E1 e1_;
+    E2 e2_;
+};
+
+// func(E), where func is applied entrywise
+template<typename Function,typename E>
+class Mapped : public Expression<Mapped<Function,E>>
+{
+public:
+    typedef typename E::value_type value_type;
+
+    Mapped( const E& e, Function func ) : e_(e), func_(func) { }
+
+    Int Height() const { return e_.Height(); }
+    Int Width() const { return e_.Width(); }
+
+    void Operands
+    ( vector<const AbstractDistMatrix<value_type>*>& operands ) const
+    { e_.Operands( operands ); }
+
+    void Bind() { e_.Bind(); }
+    void Bind
+    ( const AbstractDistMatrix<value_type>& C,
+      Workspace<value_type>& workspace )
+    { e_.Bind( C, workspace ); }
+
+    value_type operator()( Int iLoc, Int jLoc ) const
+    { return func_(e_(iLoc,jLoc)); }
+
+private:
+    E e_;
+    Function func_;
+};
+
+struct AddOp
+{
+    template<typename T>
+    static T Apply( const T& alpha, const T& beta ) { return alpha + beta; }
+};
+
+struct SubtractOp
+{
+    template<typename T>
+    static T Apply( const T& alpha, const T& beta ) { return alpha - beta; }
+};
+
+struct MultiplyOp
+{
+    template<typename T>
+    static T Apply( const T& alpha, const T& beta ) { return alpha*beta; }
+};
+
+// Construction
+// ============
+
+template<typename T>
+Leaf<T> Lazy( const Matrix<T>& A ) { return Leaf<T>( A ); }
+
+template<typename T>
+Leaf<T> Lazy( const AbstractDistMatrix<T>& A ) { return Leaf<T>( A ); }
+
+template<typename E1,typename E2>
+Binary<AddOp,E1,E2>
+operator+( const Expression<E1>& e1, const Expression<E2>& e2 )
+{ return Binary<AddOp,E1,E2>( e1.Derived(), e2.Derived() ); }
+
+template<typename E1,typename E2>
+Binary<SubtractOp,E1,E2>
+operator-( const Expression<E1>& e1, const Expression<E2>& e2 )
+{ return Binary<SubtractOp,E1,E2>( e1.Derived(), e2.Derived() ); }
+
+// The entrywise (Hadamard) product
+template<typename E1,typename E2>
+Binary<MultiplyOp,E1,E2>
+Hadamard( const Expression<E1>& e1, const Expression<E2>& e2 )
+{ return Binary<MultiplyOp,E1,E2>( e1.Derived(), e2.Derived() ); }
+
+template<typename E>
+Scaled<E>
+operator*( typename E::value_type alpha, const Expression<E>& e )
+{ return Scaled<E>( alpha, e.Derived() ); }
+
+template<typename E>
+Scaled<E>
+operator*( const Expression<E>& e, typename E::value_type alpha )
+{ return Scaled<E>( alpha, e.Derived() ); }
+
+template<typename E>
+Scaled<E> operator-( const Expression<E>& e )
+{ return Scaled<E>( typename E::value_type(-1), e.Derived() ); }
+
+template<typename E,typename Function>
+Mapped<Function,E> Map( const Expression<E>& e, Function func )
+{ return Mapped<Function,E>( e.Derived(), func ); }
+
+// Evaluation
+// ==========
+
+// C(iLoc,jLoc) := e(iLoc,jLoc) for the local entries of C in a single pass
+template<typename T,typename E>
+void EvaluateLocal( const E& e, Matrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Int height = C.Height();
+    const Int width = C.Width();
+    T* CBuf = C.Buffer();
+    const Int CLDim = C.LDim();
+    EL_PARALLEL_FOR_GRAIN(height*width)
+    for( Int j=0; j<width; ++j )
+    {
+        EL_SIMD
+        for( Int i=0; i<height; ++i )
+            CBuf[i+j*CLDim] = e(i,j);
+    }
+}
+
+template<typename T,typename E>
+void Evaluate( const Expression<E>& e, Matrix<T>& C )
+{
+    EL_DEBUG_CSE
+    static_assert
+    ( std::is_same<T,typename E::value_type>::value,
+      "Expression and target must have the same type" );
+    E eBound( e.Derived() );
+    C.Resize( eBound.Height(), eBound.Width() );
+    eBound.Bind();
+    EvaluateLocal( eBound, C );
+}
+
+template<typename T,typename E>
+void Evaluate( const Expression<E>& e, AbstractDistMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    static_assert
+    ( std::is_same<T,typename E::value_type>::value,
+      "Expression and target must have the same type" );
+    E eBound( e.Derived() );
+
+    // Avoid redistributions by aligning an unconstrained target with an
+    // operand of the same distribution (unless the target is itself an
+    // operand, as realigning it would invalidate its entries)
+    vector<const AbstractDistMatrix<T>*> operands;
+    eBound.Operands( operands );
+    const bool targetIsOperand =
+      std::find( operands.begin(), operands.end(), &C ) != operands.end();
+    if( !C.ColConstrained() && !C.RowConstrained() && !C.Viewing() &&
+        !targetIsOperand )
+    {
+        for( const auto* A : operands )
+        {
+            if( A->ColDist() == C.ColDist() && A->RowDist() == C.RowDist() &&
+                A->Wrap() == C.Wrap() && A->Grid() == C.Grid() )
+            {
+                C.AlignWith( A->DistData(), false );
+                break;
+            }
+        }
+    }
+    C.Resize( eBound.Height(), eBound.Width() );
+
+    Workspace<T> workspace;
+    eBound.Bind( C, workspace );
+    EvaluateLocal( eBound, C.Matrix() );
+}
+
+} // namespace expr
+} // namespace El
+
+#endif // ifndef EL_BLAS_EXPRESSION_HPP
@@ -121,60 +121,214 @@ void GetSubmatrix
     }
 }
 
+namespace submatrix {
+
+// Map each (distribution rank, redundant rank) pair of A to its rank within
+// the viewing communicator of A's grid
 template<typename T>
-void GetSubmatrix
-( const AbstractDistMatrix<T>& A,
-        Range<Int> I,
-  const vector<Int>& J,
-        AbstractDistMatrix<T>& ASub )
+vector<int> ViewingRanks( const AbstractDistMatrix<T>& A )
 {
     EL_DEBUG_CSE
-    const Int mSub = I.end-I.beg;
-    const Int nSub = J.size();
     const Grid& g = A.Grid();
-    ASub.SetGrid( g );
-    ASub.Resize( mSub, nSub );
-    Zero( ASub );
-
-    // TODO(poulson): Intelligently pick the redundant rank to pack from?
-
-    const T* ABuf = A.LockedBuffer();
-    const Int ALDim = A.LDim();
-
-    // Count the number of updates
-    // ===========================
-    Int numUpdates = 0;
-    if( A.RedundantRank() == 0 )
-        for( Int i=I.beg; i<I.end; ++i )
-            if( A.IsLocalRow(i) )
-                for( auto& j : J )
-                    if( A.IsLocalCol(j) )
-                        ++numUpdates;
+    const int distSize = A.DistSize();
+    const int redundantSize = A.RedundantSize();
+    vector<int> viewingRanks(distSize*redundantSize);
+    for( int redundantRank=0; redundantRank<redundantSize; ++redundantRank )
+        for( int distRank=0; distRank<distSize; ++distRank )
+            viewingRanks[distRank+redundantRank*distSize] =
+              g.VCToViewing
+              (g.CoordsToVC
+               (A.ColDist(),A.RowDist(),distRank,A.Root(),redundantRank));
+    return viewingRanks;
+}
 
-    // Queue and process the updates
-    // =============================
-    ASub.Reserve( numUpdates );
-    if( A.RedundantRank() == 0 )
+// Set (or, if 'add' is true, update) B(IB[k],JB[l]) with
+// alpha A(IA[k],JA[l]) for each k and l.
+//
+// Since the owner of each entry is the cross product of the owners of its
+// row and column, both the sender and the receiver of each entry can be
+// determined from per-dimension metadata. Each process therefore traverses
+// its local portion of the index sets in the same (column-major) order as
+// its peers, and only the values themselves are exchanged in a single
+// AllToAll. Each redundant copy of B receives its data directly from the
+// redundant copy of A with matching rank modulo the redundant size of A.
+template<typename T>
+void Transfer
+( const AbstractDistMatrix<T>& A,
+  const vector<Int>& IA,
+  const vector<Int>& JA,
+        AbstractDistMatrix<T>& B,
+  const vector<Int>& IB,
+  const vector<Int>& JB,
+  T alpha, bool add )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int m = IA.size();
+    const Int n = JA.size();
+    EL_DEBUG_ONLY(
+      if( B.Grid() != g )
+          LogicError("Grids of A and B must match");
+      if( Int(IB.size()) != m || Int(JB.size()) != n )
+          LogicError("Index sets of A and B must have matching sizes");
+    )
+    mpi::Comm comm = g.ViewingComm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const int ARedundantSize = A.RedundantSize();
+
+    // Determine the destination of each of our (redundant copy's) entries
+    // ===================================================================
+    vector<int> sendCounts(commSize,0);
+    vector<Int> sendRows, sendCols, sendRowOwners, sendColOwners;
+    vector<int> BViewingRanks;
+    const int BDistSize = B.DistSize();
+    const int BRedundantSize = B.RedundantSize();
+    if( A.Participating() )
     {
-        for( Int iSub=0; iSub<mSub; ++iSub )
+        BViewingRanks = ViewingRanks( B );
+        for( Int k=0; k<m; ++k )
+        {
+            if( A.IsLocalRow(IA[k]) )
+            {
+                sendRows.push_back( A.LocalRow(IA[k]) );
+                sendRowOwners.push_back( B.RowOwner(IB[k]) );
+            }
+        }
+        for( Int l=0; l<n; ++l )
         {
-            const Int i = I.beg + iSub;
-            if( A.IsLocalRow(i) )
+            if( A.IsLocalCol(JA[l]) )
             {
-                const Int iLoc = A.LocalRow(i);
-                for( Int jSub=0; jSub<nSub; ++jSub )
+                sendCols.push_back( A.LocalCol(JA[l]) );
+                sendColOwners.push_back( B.ColOwner(JB[l])*B.ColStride() );
+            }
+        }
+    }
+    const Int numSendRows = sendRows.size();
+    const Int numSendCols = sendCols.size();
+    const int ARedundantRank = A.Participating() ? A.RedundantRank() : 0;
+    auto forEachSend = [&]( auto func )
+    {
+        for( Int lLoc=0; lLoc<numSendCols; ++lLoc )
+        {
+            for( Int kLoc=0; kLoc<numSendRows; ++kLoc )
+            {
+                const int distOwner =
+                  sendRowOwners[kLoc] + sendColOwners[lLoc];
+                for( int r=0; r<BRedundantSize; ++r )
                 {
-                    const Int j = J[jSub];
-                    if( A.IsLocalCol(j) )
-                    {
-                        const Int jLoc = A.LocalCol(j);
-                        ASub.QueueUpdate( iSub, jSub, ABuf[iLoc+jLoc*ALDim] );
-                    }
+                    const int q = BViewingRanks[distOwner+r*BDistSize];
+                    if( q % ARedundantSize == ARedundantRank )
+                        func( sendRows[kLoc], sendCols[lLoc], q );
                 }
             }
         }
+    };
+    forEachSend( [&]( Int, Int, int q ) { ++sendCounts[q]; } );
+
+    // Determine the source of each of our entries
+    // ===========================================
+    vector<int> recvCounts(commSize,0);
+    vector<Int> recvRows, recvCols, recvRowOwners, recvColOwners;
+    vector<int> AViewingRanks;
+    if( B.Participating() )
+    {
+        // Every redundant copy of A is a valid source
+        const int ADistSize = A.DistSize();
+        const int sourceRedundantRank = commRank % ARedundantSize;
+        const auto allViewingRanks = ViewingRanks( A );
+        AViewingRanks.assign
+        ( allViewingRanks.begin()+sourceRedundantRank*ADistSize,
+          allViewingRanks.begin()+(sourceRedundantRank+1)*ADistSize );
+        for( Int k=0; k<m; ++k )
+        {
+            if( B.IsLocalRow(IB[k]) )
+            {
+                recvRows.push_back( B.LocalRow(IB[k]) );
+                recvRowOwners.push_back( A.RowOwner(IA[k]) );
+            }
+        }
+        for( Int l=0; l<n; ++l )
+        {
+            if( B.IsLocalCol(JB[l]) )
+            {
+                recvCols.push_back( B.LocalCol(JB[l]) );
+                recvColOwners.push_back( A.ColOwner(JA[l])*A.ColStride() );
+            }
+        }
+    }
+    const Int numRecvRows = recvRows.size();
+    const Int numRecvCols = recvCols.size();
+    for( Int lLoc=0; lLoc<numRecvCols; ++lLoc )
+        for( Int kLoc=0; kLoc<numRecvRows; ++kLoc )
+            ++recvCounts[AViewingRanks[recvRowOwners[kLoc]+
+                                       recvColOwners[lLoc]]];
+
+    // Pack the values
+    // ===============
+    vector<int> sendOffs(commSize), recvOffs(commSize);
+    int totalSend=0, totalRecv=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        sendOffs[q] = totalSend;
+        recvOffs[q] = totalRecv;
+        totalSend += sendCounts[q];
+        totalRecv += recvCounts[q];
+    }
+    vector<T> sendBuf, recvBuf;
+    FastResize( sendBuf, totalSend );
+    FastResize( recvBuf, totalRecv );
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    auto offs = sendOffs;
+    forEachSend
+    ( [&]( Int iLoc, Int jLoc, int q )
+      { sendBuf[offs[q]++] = ABuf[iLoc+jLoc*ALDim]; } );
+
+    // Exchange and unpack the values
+    // ==============================
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+      recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    offs = recvOffs;
+    for( Int lLoc=0; lLoc<numRecvCols; ++lLoc )
+    {
+        const Int jLoc = recvCols[lLoc];
+        for( Int kLoc=0; kLoc<numRecvRows; ++kLoc )
+        {
+            const Int iLoc = recvRows[kLoc];
+            const int p =
+              AViewingRanks[recvRowOwners[kLoc]+recvColOwners[lLoc]];
+            const T& value = recvBuf[offs[p]++];
+            if( add )
+                BBuf[iLoc+jLoc*BLDim] += alpha*value;
+            else
+                BBuf[iLoc+jLoc*BLDim] = alpha*value;
+        }
     }
-    ASub.ProcessQueues();
+}
+
+inline vector<Int> RangeToVector( Range<Int> I )
+{
+    vector<Int> IVec(I.end-I.beg);
+    for( Int i=I.beg; i<I.end; ++i )
+        IVec[i-I.beg] = i;
+    return IVec;
+}
+
+} // namespace submatrix
+
+template<typename T>
+void GetSubmatrix
+( const AbstractDistMatrix<T>& A,
+        Range<Int> I,
+  const vector<Int>& J,
+        AbstractDistMatrix<T>& ASub )
+{
+    EL_DEBUG_CSE
+    GetSubmatrix( A, submatrix::RangeToVector(I), J, ASub );
 }
 
 template<typename T>
@@ -185,52 +339,7 @@ void GetSubmatrix
         AbstractDistMatrix<T>& ASub )
 {
     EL_DEBUG_CSE
-    const Int mSub = I.size();
-    const Int nSub = J.end-J.beg;
-    const Grid& g = A.Grid();
-    ASub.SetGrid( g );
-    ASub.Resize( mSub, nSub );
-    Zero( ASub );
-
-    // TODO(poulson): Intelligently pick the redundant rank to pack from?
-
-    const T* ABuf = A.LockedBuffer();
-    const Int ALDim = A.LDim();
-
-    // Count the number of updates
-    // ===========================
-    Int numUpdates = 0;
-    if( A.RedundantRank() == 0 )
-        for( auto& i : I )
-            if( A.IsLocalRow(i) )
-                for( Int j=J.beg; j<J.end; ++j )
-                    if( A.IsLocalCol(j) )
-                        ++numUpdates;
-
-    // Queue and process the updates
-    // =============================
-    ASub.Reserve( numUpdates );
-    if( A.RedundantRank() == 0 )
-    {
-        for( Int iSub=0; iSub<mSub; ++iSub )
-        {
-            const Int i = I[iSub];
-            if( A.IsLocalRow(i) )
-            {
-                const Int iLoc = A.LocalRow(i);
-                for( Int jSub=0; jSub<nSub; ++jSub )
-                {
-                    const Int j = J.beg + jSub;
-                    if( A.IsLocalCol(j) )
-                    {
-                        const Int jLoc = A.LocalCol(j);
-                        ASub.QueueUpdate( iSub, jSub, ABuf[iLoc+jLoc*ALDim] );
-                    }
-                }
-            }
-        }
-    }
-    ASub.ProcessQueues();
+    GetSubmatrix( A, I, submatrix::RangeToVector(J), ASub );
 }
 
 template<typename T>
@@ -243,50 +352,12 @@ void GetSubmatrix
     EL_DEBUG_CSE
     const Int mSub = I.size();
     const Int nSub = J.size();
-    const Grid& g = A.Grid();
-    ASub.SetGrid( g );
+    ASub.SetGrid( A.Grid() );
     ASub.Resize( mSub, nSub );
-    Zero( ASub );
-
-    // TODO(poulson): Intelligently pick the redundant rank to pack from?
-
-    const T* ABuf = A.LockedBuffer();
-    const Int ALDim = A.LDim();
-
-    // Count the number of updates
-    // ===========================
-    Int numUpdates = 0;
-    if( A.RedundantRank() == 0 )
-        for( auto& i : I )
-            if( A.IsLocalRow(i) )
-                for( auto& j : J )
-                    if( A.IsLocalCol(j) )
-                        ++numUpdates;
-
-    // Queue and process the updates
-    // =============================
-    ASub.Reserve( numUpdates );
-    if( A.RedundantRank() == 0 )
-    {
-        for( Int iSub=0; iSub<mSub; ++iSub )
-        {
-            const Int i = I[iSub];
-            if( A.IsLocalRow(i) )
-            {
-                const Int iLoc = A.LocalRow(i);
-                for( Int jSub=0; jSub<nSub; ++jSub )
-                {
-                    const Int j = J[jSub];
-                    if( A.IsLocalCol(j) )
-                    {
-                        const Int jLoc = A.LocalCol(j);
-                        ASub.QueueUpdate( iSub, jSub, ABuf[iLoc+jLoc*ALDim] );
-                    }
-                }
-            }
-        }
-    }
-    ASub.ProcessQueues();
+    submatrix::Transfer
+    ( A, I, J,
+      ASub, submatrix::RangeToVector(IR(0,mSub)),
+            submatrix::RangeToVector(IR(0,nSub)), T(1), false );
 }
 
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
@@ -9,6 +9,8 @@
 #ifndef EL_BLAS_HADAMARD_HPP
 #define EL_BLAS_HADAMARD_HPP
 
+#include <El/blas_like/level1/SIMD.hpp>
+
 // C(i,j) := A(i,j) B(i,j)
 
 namespace El {
@@ -30,41 +32,28 @@ void Hadamard( const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C )
     const Int BLDim = B.LDim();
     const Int CLDim = C.LDim();
 
-    // Iterate over single loop if memory is contiguous. Otherwise
-    // iterate over double loop.
+    // Iterate over chunks of a single loop if memory is contiguous.
+    // Otherwise iterate over the columns.
     if( ALDim == height && BLDim == height && CLDim == height )
     {
-        // Check if output matrix is equal to either input matrix
-        if( CBuf == BBuf )
-        {
-            EL_PARALLEL_FOR
-            for( Int i=0; i<height*width; ++i )
-                CBuf[i] *= ABuf[i];
-        }
-        else if( CBuf == ABuf )
-        {
-            EL_PARALLEL_FOR
-            for( Int i=0; i<height*width; ++i )
-                CBuf[i] *= BBuf[i];
-        }
-        else
+        const Int numEntries = height*width;
+        const Int chunkSize = simd::ChunkSize();
+        const Int numChunks = (numEntries+chunkSize-1) / chunkSize;
+        EL_PARALLEL_FOR_GRAIN(numEntries)
+        for( Int chunk=0; chunk<numChunks; ++chunk )
         {
-            EL_PARALLEL_FOR
-            for( Int i=0; i<height*width; ++i )
-                CBuf[i] = ABuf[i] * BBuf[i];
+            const Int off = chunk*chunkSize;
+            simd::Hadamard
+            ( Min(chunkSize,numEntries-off),
+              &ABuf[off], &BBuf[off], &CBuf[off] );
         }
     }
     else
     {
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_GRAIN(height*width)
         for( Int j=0; j<width; ++j )
-        {
-            EL_SIMD
-            for( Int i=0; i<height; ++i )
-            {
-                CBuf[i+j*CLDim] = ABuf[i+j*ALDim] * BBuf[i+j*BLDim];
-            }
-        }
+            simd::Hadamard
+            ( height, &ABuf[j*ALDim], &BBuf[j*BLDim], &CBuf[j*CLDim] );
     }
 }
 
@@ -96,6 +85,92 @@ void Hadamard
     Hadamard( A.LockedMatrix(), B.LockedMatrix(), C.Matrix() );
 }
 
+// Form only the 'uplo' triangle of C := A o B, which suffices when A and B
+// are Hermitian (or symmetric) and C is only accessed through that triangle.
+// The opposite strictly triangular part of C is left untouched.
+template<typename T>
+void HermitianHadamard
+( UpperOrLower uplo,
+  const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError("Hadamard product requires equal dimensions");
+    C.Resize( A.Height(), A.Width() );
+
+    const Int n = A.Height();
+    const T* ABuf = A.LockedBuffer();
+    const T* BBuf = B.LockedBuffer();
+    T* CBuf = C.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    const Int CLDim = C.LDim();
+    EL_PARALLEL_FOR_GRAIN(n*n/2)
+    for( Int j=0; j<n; ++j )
+    {
+        const Int iBeg = ( uplo==LOWER ? j : 0 );
+        const Int iEnd = ( uplo==LOWER ? n : j+1 );
+        simd::Hadamard
+        ( iEnd-iBeg,
+          &ABuf[iBeg+j*ALDim], &BBuf[iBeg+j*BLDim], &CBuf[iBeg+j*CLDim] );
+    }
+}
+
+template<typename T>
+void HermitianHadamard
+( UpperOrLower uplo,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        AbstractDistMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const DistData& ADistData = A.DistData();
+    const DistData& BDistData = B.DistData();
+    DistData CDistData = C.DistData();
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError("Hadamard product requires equal dimensions");
+    AssertSameGrids( A, B );
+    if( ADistData.colDist != BDistData.colDist ||
+        ADistData.rowDist != BDistData.rowDist ||
+        BDistData.colDist != CDistData.colDist ||
+        BDistData.rowDist != CDistData.rowDist )
+        LogicError("A, B, and C must share the same distribution");
+    if( A.ColAlign() != B.ColAlign() || A.RowAlign() != B.RowAlign() )
+        LogicError("A and B must be aligned");
+    if ( A.BlockHeight() != B.BlockHeight() ||
+         A.BlockWidth() != B.BlockWidth())
+      LogicError("A and B must have the same block size");
+    C.AlignWith( A.DistData() );
+    C.Resize( A.Height(), A.Width() );
+
+    const Int n = A.Height();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const T* ABuf = A.LockedBuffer();
+    const T* BBuf = B.LockedBuffer();
+    T* CBuf = C.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    const Int CLDim = C.LDim();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg =
+          ( uplo==LOWER ? A.LocalRowOffset(Min(j,n)) : 0 );
+        const Int iLocEnd =
+          ( uplo==LOWER ? localHeight : A.LocalRowOffset(Min(j+1,n)) );
+        simd::Hadamard
+        ( iLocEnd-iLocBeg,
+          &ABuf[iLocBeg+jLoc*ALDim],
+          &BBuf[iLocBeg+jLoc*BLDim],
+          &CBuf[iLocBeg+jLoc*CLDim] );
+    }
+}
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -107,6 +182,14 @@ void Hadamard
   ( const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C ); \
   EL_EXTERN template void Hadamard \
   ( const AbstractDistMatrix<T>& A, \
+    const AbstractDistMatrix<T>& B, \
+          AbstractDistMatrix<T>& C ); \
+  EL_EXTERN template void HermitianHadamard \
+  ( UpperOrLower uplo, \
+    const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C ); \
+  EL_EXTERN template void HermitianHadamard \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<T>& A, \
     const AbstractDistMatrix<T>& B, \
           AbstractDistMatrix<T>& C );
 
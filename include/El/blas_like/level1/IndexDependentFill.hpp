@@ -11,8 +11,13 @@
 
 namespace El {
 
-template<typename T>
-void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
+// The overloads accepting an arbitrary functor inline it into the loops
+// (a std::function costs an indirect call per entry, which also prevents the
+// row loops from vectorizing), and so the std::function overloads forward to
+// them.
+
+template<typename T,class Func>
+void IndexDependentFill( Matrix<T>& A, const Func& func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -42,12 +47,10 @@ void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
             }
         }
     }
-
 }
 
-template<typename T>
-void IndexDependentFill
-( AbstractDistMatrix<T>& A, function<T(Int,Int)> func )
+template<typename T,class Func>
+void IndexDependentFill( AbstractDistMatrix<T>& A, const Func& func )
 {
     EL_DEBUG_CSE
     const Int mLoc = A.LocalHeight();
@@ -55,16 +58,24 @@ void IndexDependentFill
     T* ALocBuf = A.Buffer();
     const Int ALocLDim = A.LDim();
 
+    // Query the (virtual) distribution once per local row and column rather
+    // than once per entry
+    vector<Int> globalRows( mLoc ), globalCols( nLoc );
+    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+        globalCols[jLoc] = A.GlobalCol(jLoc);
+    const Int* rowBuf = globalRows.data();
+
     // Use entry-wise parallelization for column vectors. Otherwise
     // use column-wise parallelization.
     if( nLoc == 1 )
     {
+        const Int j = globalCols[0];
         EL_PARALLEL_FOR
         for( Int iLoc=0; iLoc<mLoc; ++iLoc )
         {
-            const Int i = A.GlobalRow(iLoc);
-            const Int j = A.GlobalCol(0);
-            ALocBuf[iLoc] = func(i,j);
+            ALocBuf[iLoc] = func(rowBuf[iLoc],j);
         }
     }
     else
@@ -72,16 +83,162 @@ void IndexDependentFill
         EL_PARALLEL_FOR
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
+            const Int j = globalCols[jLoc];
+            T* colBuf = &ALocBuf[jLoc*ALocLDim];
             EL_SIMD
             for( Int iLoc=0; iLoc<mLoc; ++iLoc )
             {
-                const Int i = A.GlobalRow(iLoc);
-                const Int j = A.GlobalCol(jLoc);
-                ALocBuf[iLoc+jLoc*ALocLDim] = func(i,j);
+                colBuf[iLoc] = func(rowBuf[iLoc],j);
             }
         }
     }
+}
+
+template<typename T>
+void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
+{ IndexDependentFill<T,function<T(Int,Int)>>( A, func ); }
+
+template<typename T>
+void IndexDependentFill
+( AbstractDistMatrix<T>& A, function<T(Int,Int)> func )
+{ IndexDependentFill<T,function<T(Int,Int)>>( A, func ); }
+
+// Column generators
+// -----------------
+// Column j of A is filled by a single call func(j,iBeg,iStride,count,buf),
+// which must set buf[k] to the (iBeg+k*iStride,j) entry for 0 <= k < count,
+// so that the loop over the rows lives within the functor (where it may be
+// vectorized, e.g., with the routines of SIMD.hpp). Long columns are split
+// into chunks which are generated in parallel.
+
+namespace index_fill {
+
+const Int columnChunkSize = 1024;
+
+// Append the first rows, local offsets, and sizes of the chunks of the count
+// rows iBeg, iBeg+iStride, ..., which begin at the given local offset
+inline void PushRowChunks
+( Int iBeg, Int iStride, Int count, Int localOffset,
+  vector<Int>& firstRows, vector<Int>& localOffsets, vector<Int>& sizes )
+{
+    for( Int k=0; k<count; k+=columnChunkSize )
+    {
+        firstRows.push_back( iBeg+k*iStride );
+        localOffsets.push_back( localOffset+k );
+        sizes.push_back( Min(columnChunkSize,count-k) );
+    }
+}
+
+} // namespace index_fill
 
+template<typename T,class ColumnFunc>
+void IndexDependentColumnFill( Matrix<T>& A, const ColumnFunc& func )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    if( n == 1 )
+    {
+        const Int numChunks =
+          (m+index_fill::columnChunkSize-1) / index_fill::columnChunkSize;
+        EL_PARALLEL_FOR
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+        {
+            const Int iBeg = chunk*index_fill::columnChunkSize;
+            const Int count = Min(index_fill::columnChunkSize,m-iBeg);
+            func( Int(0), iBeg, Int(1), count, &ABuf[iBeg] );
+        }
+    }
+    else
+    {
+        EL_PARALLEL_FOR
+        for( Int j=0; j<n; ++j )
+            func( j, Int(0), Int(1), m, &ABuf[j*ALDim] );
+    }
+}
+
+template<typename T,class ColumnFunc>
+void IndexDependentColumnFill
+( AbstractDistMatrix<T>& A, const ColumnFunc& func )
+{
+    EL_DEBUG_CSE
+    const Int mLoc = A.LocalHeight();
+    const Int nLoc = A.LocalWidth();
+    T* ALocBuf = A.Buffer();
+    const Int ALocLDim = A.LDim();
+
+    // The local rows of an element-wise distribution form a single strided
+    // sequence, whereas those of a block distribution form one contiguous
+    // sequence per block
+    const Int iStride = ( A.Wrap() == ELEMENT ? A.ColStride() : 1 );
+    vector<Int> firstRows, localOffsets, sizes;
+    const bool splitColumns = ( nLoc == 1 );
+    auto pushRun = [&]( Int iBeg, Int count, Int localOffset )
+      {
+          if( splitColumns )
+          {
+              index_fill::PushRowChunks
+              ( iBeg, iStride, count, localOffset,
+                firstRows, localOffsets, sizes );
+          }
+          else
+          {
+              firstRows.push_back( iBeg );
+              localOffsets.push_back( localOffset );
+              sizes.push_back( count );
+          }
+      };
+    if( mLoc > 0 )
+    {
+        if( A.Wrap() == ELEMENT )
+        {
+            pushRun( A.GlobalRow(0), mLoc, 0 );
+        }
+        else
+        {
+            Int runBeg = 0;
+            Int runRow = A.GlobalRow(0);
+            for( Int iLoc=1; iLoc<=mLoc; ++iLoc )
+            {
+                const Int i = ( iLoc < mLoc ? A.GlobalRow(iLoc) : -1 );
+                if( i != runRow+(iLoc-runBeg) )
+                {
+                    pushRun( runRow, iLoc-runBeg, runBeg );
+                    runBeg = iLoc;
+                    runRow = i;
+                }
+            }
+        }
+    }
+    const Int numRuns = sizes.size();
+
+    vector<Int> globalCols( nLoc );
+    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+        globalCols[jLoc] = A.GlobalCol(jLoc);
+
+    if( splitColumns )
+    {
+        const Int j = globalCols[0];
+        EL_PARALLEL_FOR
+        for( Int run=0; run<numRuns; ++run )
+            func
+            ( j, firstRows[run], iStride, sizes[run],
+              &ALocBuf[localOffsets[run]] );
+    }
+    else
+    {
+        EL_PARALLEL_FOR
+        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+        {
+            T* colBuf = &ALocBuf[jLoc*ALocLDim];
+            for( Int run=0; run<numRuns; ++run )
+                func
+                ( globalCols[jLoc], firstRows[run], iStride, sizes[run],
+                  &colBuf[localOffsets[run]] );
+        }
+    }
 }
 
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
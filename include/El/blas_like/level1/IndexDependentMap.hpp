@@ -11,8 +11,11 @@
 
 namespace El {
 
-template<typename T>
-void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
+// As with IndexDependentFill, the overloads accepting an arbitrary functor
+// inline it into the loops, and the std::function overloads forward to them.
+
+template<typename T,class Func>
+void IndexDependentMap( Matrix<T>& A, const Func& func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -42,12 +45,10 @@ void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
             }
         }
     }
-
 }
 
-template<typename T>
-void IndexDependentMap
-( AbstractDistMatrix<T>& A, function<T(Int,Int,const T&)> func )
+template<typename T,class Func>
+void IndexDependentMap( AbstractDistMatrix<T>& A, const Func& func )
 {
     EL_DEBUG_CSE
     const Int mLoc = A.LocalHeight();
@@ -55,16 +56,24 @@ void IndexDependentMap
     T* ALocBuf = A.Buffer();
     const Int ALocLDim = A.LDim();
 
+    // Query the (virtual) distribution once per local row and column rather
+    // than once per entry
+    vector<Int> globalRows( mLoc ), globalCols( nLoc );
+    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+        globalCols[jLoc] = A.GlobalCol(jLoc);
+    const Int* rowBuf = globalRows.data();
+
     // Use entry-wise parallelization for column vectors. Otherwise
     // use column-wise parallelization.
     if( nLoc == 1 )
     {
+        const Int j = globalCols[0];
         EL_PARALLEL_FOR
         for( Int iLoc=0; iLoc<mLoc; ++iLoc )
         {
-            const Int i = A.GlobalRow(iLoc);
-            const Int j = A.GlobalCol(0);
-            ALocBuf[iLoc] = func(i,j,ALocBuf[iLoc]);
+            ALocBuf[iLoc] = func(rowBuf[iLoc],j,ALocBuf[iLoc]);
         }
     }
     else
@@ -72,27 +81,25 @@ void IndexDependentMap
         EL_PARALLEL_FOR
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
+            const Int j = globalCols[jLoc];
+            T* colBuf = &ALocBuf[jLoc*ALocLDim];
             EL_SIMD
             for( Int iLoc=0; iLoc<mLoc; ++iLoc )
             {
-                const Int i = A.GlobalRow(iLoc);
-                const Int j = A.GlobalCol(jLoc);
-                ALocBuf[iLoc+jLoc*ALocLDim] = func(i,j,ALocBuf[iLoc+jLoc*ALocLDim]);
+                colBuf[iLoc] = func(rowBuf[iLoc],j,colBuf[iLoc]);
             }
         }
     }
-
 }
 
-template<typename S,typename T>
-void IndexDependentMap
-( const Matrix<S>& A, Matrix<T>& B, function<T(Int,Int,const S&)> func )
+template<typename S,typename T,class Func>
+void IndexDependentMap( const Matrix<S>& A, Matrix<T>& B, const Func& func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
     B.Resize( m, n );
-    const T* ABuf = A.LockedBuffer();
+    const S* ABuf = A.LockedBuffer();
     T* BBuf = B.Buffer();
     const Int ALDim = A.LDim();
     const Int BLDim = B.LDim();
@@ -119,9 +126,22 @@ void IndexDependentMap
             }
         }
     }
-
 }
 
+template<typename T>
+void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
+{ IndexDependentMap<T,function<T(Int,Int,const T&)>>( A, func ); }
+
+template<typename T>
+void IndexDependentMap
+( AbstractDistMatrix<T>& A, function<T(Int,Int,const T&)> func )
+{ IndexDependentMap<T,function<T(Int,Int,const T&)>>( A, func ); }
+
+template<typename S,typename T>
+void IndexDependentMap
+( const Matrix<S>& A, Matrix<T>& B, function<T(Int,Int,const S&)> func )
+{ IndexDependentMap<S,T,function<T(Int,Int,const S&)>>( A, B, func ); }
+
 template<typename S,typename T,Dist U,Dist V,DistWrap wrap>
 void IndexDependentMap
 ( const DistMatrix<S,U,V,wrap>& A,
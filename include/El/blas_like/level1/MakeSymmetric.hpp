@@ -72,6 +72,71 @@ void MakeSymmetric
         AxpyTrapezoid( LOWER, T(1), *ATrans, A, -1 );
 }
 
+template<typename T>
+void MakeSymmetric( UpperOrLower uplo, SparseMatrix<T>& A, bool conjugate )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Cannot make non-square matrix symmetric");
+
+    // Mirror the strictly triangular entries (with the diagonal made real
+    // when conjugating) and sum them back into the matrix
+    const Int numEntries = A.NumEntries();
+    const Int* sBuf = A.LockedSourceBuffer();
+    const Int* tBuf = A.LockedTargetBuffer();
+    T* vBuf = A.ValueBuffer();
+    vector<Entry<T>> mirrored;
+    mirrored.reserve( numEntries );
+    for( Int k=0; k<numEntries; ++k )
+    {
+        const Int i = sBuf[k];
+        const Int j = tBuf[k];
+        if( i == j )
+        {
+            if( conjugate )
+                vBuf[k] = RealPart(vBuf[k]);
+        }
+        else if( (uplo == LOWER && i > j) || (uplo == UPPER && i < j) )
+            mirrored.push_back( Entry<T>{j,i,conjugate?Conj(vBuf[k]):vBuf[k]} );
+    }
+    A.Reserve( numEntries+mirrored.size() );
+    for( const auto& entry : mirrored )
+        A.QueueUpdate( entry );
+    A.ProcessQueues();
+}
+
+template<typename T>
+void MakeSymmetric
+( UpperOrLower uplo, DistSparseMatrix<T>& A, bool conjugate )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Cannot make non-square matrix symmetric");
+
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* sBuf = A.LockedSourceBuffer();
+    const Int* tBuf = A.LockedTargetBuffer();
+    T* vBuf = A.ValueBuffer();
+    vector<Entry<T>> mirrored;
+    mirrored.reserve( numLocalEntries );
+    for( Int k=0; k<numLocalEntries; ++k )
+    {
+        const Int i = sBuf[k];
+        const Int j = tBuf[k];
+        if( i == j )
+        {
+            if( conjugate )
+                vBuf[k] = RealPart(vBuf[k]);
+        }
+        else if( (uplo == LOWER && i > j) || (uplo == UPPER && i < j) )
+            mirrored.push_back( Entry<T>{j,i,conjugate?Conj(vBuf[k]):vBuf[k]} );
+    }
+    A.Reserve( numLocalEntries+mirrored.size(), mirrored.size() );
+    for( const auto& entry : mirrored )
+        A.QueueUpdate( entry );
+    A.ProcessQueues();
+}
+
 template<typename T>
 void MakeHermitian( UpperOrLower uplo, Matrix<T>& A )
 {
@@ -86,6 +151,20 @@ void MakeHermitian( UpperOrLower uplo, ElementalMatrix<T>& A )
     MakeSymmetric( uplo, A, true );
 }
 
+template<typename T>
+void MakeHermitian( UpperOrLower uplo, SparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    MakeSymmetric( uplo, A, true );
+}
+
+template<typename T>
+void MakeHermitian( UpperOrLower uplo, DistSparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    MakeSymmetric( uplo, A, true );
+}
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -97,10 +176,18 @@ void MakeHermitian( UpperOrLower uplo, ElementalMatrix<T>& A )
   ( UpperOrLower uplo, Matrix<T>& A, bool conjugate ); \
   EL_EXTERN template void MakeSymmetric \
   ( UpperOrLower uplo, ElementalMatrix<T>& A, bool conjugate ); \
+  EL_EXTERN template void MakeSymmetric \
+  ( UpperOrLower uplo, SparseMatrix<T>& A, bool conjugate ); \
+  EL_EXTERN template void MakeSymmetric \
+  ( UpperOrLower uplo, DistSparseMatrix<T>& A, bool conjugate ); \
   EL_EXTERN template void MakeHermitian \
   ( UpperOrLower uplo, Matrix<T>& A ); \
   EL_EXTERN template void MakeHermitian \
-  ( UpperOrLower uplo, ElementalMatrix<T>& A );
+  ( UpperOrLower uplo, ElementalMatrix<T>& A ); \
+  EL_EXTERN template void MakeHermitian \
+  ( UpperOrLower uplo, SparseMatrix<T>& A ); \
+  EL_EXTERN template void MakeHermitian \
+  ( UpperOrLower uplo, DistSparseMatrix<T>& A );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -0,0 +1,370 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_PIPELINED_HPP
+#define EL_BLAS_PIPELINED_HPP
+
+namespace El {
+
+template<typename T>
+TransferFuture<T>::TransferFuture( TransferFuture<T>&& future )
+: next_(future.next_),
+  requests_(std::move(future.requests_)),
+  finishes_(std::move(future.finishes_)),
+  buffers_(std::move(future.buffers_))
+{
+    future.next_ = 0;
+    future.requests_.clear();
+    future.finishes_.clear();
+    future.buffers_.clear();
+}
+
+template<typename T>
+TransferFuture<T>& TransferFuture<T>::operator=( TransferFuture<T>&& future )
+{
+    if( this != &future )
+    {
+        Wait();
+        next_ = future.next_;
+        requests_ = std::move(future.requests_);
+        finishes_ = std::move(future.finishes_);
+        buffers_ = std::move(future.buffers_);
+        future.next_ = 0;
+        future.requests_.clear();
+        future.finishes_.clear();
+        future.buffers_.clear();
+    }
+    return *this;
+}
+
+template<typename T>
+TransferFuture<T>::~TransferFuture()
+{
+    // Ensure that MPI is not left accessing a freed buffer
+    if( Pending() )
+        Wait();
+}
+
+template<typename T>
+bool TransferFuture<T>::Test()
+{
+    EL_DEBUG_CSE
+    while( next_ < requests_.size() )
+    {
+        if( !mpi::Test( requests_[next_] ) )
+            return false;
+        if( finishes_[next_] )
+            finishes_[next_]();
+        ++next_;
+    }
+    Clear();
+    return true;
+}
+
+template<typename T>
+void TransferFuture<T>::Wait()
+{
+    EL_DEBUG_CSE
+    while( next_ < requests_.size() )
+    {
+        mpi::Wait( requests_[next_] );
+        if( finishes_[next_] )
+            finishes_[next_]();
+        ++next_;
+    }
+    Clear();
+}
+
+template<typename T>
+T* TransferFuture<T>::Reserve( Int size )
+{
+    EL_DEBUG_CSE
+    buffers_.emplace_back();
+    FastResize( buffers_.back(), size );
+    return buffers_.back().data();
+}
+
+template<typename T>
+void TransferFuture<T>::Post
+( Int numRequests,
+  function<void(Int,mpi::Request<T>&)> post,
+  function<void(Int)> finish )
+{
+    EL_DEBUG_CSE
+    const Int oldSize = requests_.size();
+    requests_.resize( oldSize+numRequests );
+    finishes_.resize( oldSize+numRequests );
+    for( Int s=0; s<numRequests; ++s )
+    {
+        post( s, requests_[oldSize+s] );
+        if( finish )
+            finishes_[oldSize+s] = [=]() { finish(s); };
+    }
+}
+
+template<typename T>
+void TransferFuture<T>::Clear()
+{
+    next_ = 0;
+    SwapClear( requests_ );
+    SwapClear( finishes_ );
+    SwapClear( buffers_ );
+}
+
+namespace pipeline {
+
+inline Int NumSegments( Int size, const PipelineCtrl& ctrl )
+{
+    if( ctrl.segmentSize <= 0 || ctrl.segmentSize > Int(limits::Max<int>()) )
+        LogicError("Invalid segment size of ",ctrl.segmentSize);
+    return (size+ctrl.segmentSize-1) / ctrl.segmentSize;
+}
+
+// Copy entries [offset,offset+size) of A, in column-major order, into 'buf'
+template<typename T>
+void PackSegment( const Matrix<T>& A, Int offset, Int size, T* buf )
+{
+    const Int height = A.Height();
+    Int i = offset % height;
+    Int j = offset / height;
+    for( Int k=0; k<size; i=0, ++j )
+    {
+        const Int numEntries = Min( height-i, size-k );
+        MemCopy( &buf[k], A.LockedBuffer(i,j), numEntries );
+        k += numEntries;
+    }
+}
+
+// Copy 'buf' into entries [offset,offset+size) of A, in column-major order
+template<typename T>
+void UnpackSegment( const T* buf, Int offset, Int size, Matrix<T>& A )
+{
+    const Int height = A.Height();
+    Int i = offset % height;
+    Int j = offset / height;
+    for( Int k=0; k<size; i=0, ++j )
+    {
+        const Int numEntries = Min( height-i, size-k );
+        MemCopy( A.Buffer(i,j), &buf[k], numEntries );
+        k += numEntries;
+    }
+}
+
+template<typename T>
+void PostSends
+( const Matrix<T>& A, mpi::Comm comm, int destination,
+  const PipelineCtrl& ctrl, TransferFuture<T>& future )
+{
+    EL_DEBUG_CSE
+    const Int size = A.Height()*A.Width();
+    const Int numSegments = NumSegments( size, ctrl );
+    const Int segmentSize = ctrl.segmentSize;
+    if( A.Height() == A.LDim() )
+    {
+        const T* buffer = A.LockedBuffer();
+        future.Post
+        ( numSegments,
+          [=]( Int s, mpi::Request<T>& request )
+          {
+              const Int offset = s*segmentSize;
+              mpi::ISend
+              ( &buffer[offset], int(Min(segmentSize,size-offset)),
+                destination, comm, request );
+          } );
+    }
+    else
+    {
+        // Pack each segment just before it is sent so that the packing
+        // overlaps with the transfer of the previous segments
+        T* buffer = future.Reserve( size );
+        future.Post
+        ( numSegments,
+          [=,&A]( Int s, mpi::Request<T>& request )
+          {
+              const Int offset = s*segmentSize;
+              const Int segSize = Min(segmentSize,size-offset);
+              PackSegment( A, offset, segSize, &buffer[offset] );
+              mpi::ISend
+              ( &buffer[offset], int(segSize), destination, comm, request );
+          } );
+    }
+}
+
+template<typename T>
+void PostRecvs
+( Matrix<T>& A, mpi::Comm comm, int source,
+  const PipelineCtrl& ctrl, TransferFuture<T>& future )
+{
+    EL_DEBUG_CSE
+    const Int size = A.Height()*A.Width();
+    const Int numSegments = NumSegments( size, ctrl );
+    const Int segmentSize = ctrl.segmentSize;
+    const bool contiguous = ( A.Height() == A.LDim() );
+    T* buffer = ( contiguous ? A.Buffer() : future.Reserve(size) );
+    auto post =
+      [=]( Int s, mpi::Request<T>& request )
+      {
+          const Int offset = s*segmentSize;
+          mpi::IRecv
+          ( &buffer[offset], int(Min(segmentSize,size-offset)),
+            source, comm, request );
+      };
+    if( contiguous )
+        future.Post( numSegments, post );
+    else
+        future.Post
+        ( numSegments, post,
+          [=,&A]( Int s )
+          {
+              const Int offset = s*segmentSize;
+              UnpackSegment
+              ( &buffer[offset], offset, Min(segmentSize,size-offset), A );
+          } );
+}
+
+} // namespace pipeline
+
+template<typename T>
+TransferFuture<T> SendAsync
+( const Matrix<T>& A, mpi::Comm comm, int destination,
+  const PipelineCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    TransferFuture<T> future;
+    pipeline::PostSends( A, comm, destination, ctrl, future );
+    return future;
+}
+
+template<typename T>
+TransferFuture<T> RecvAsync
+( Matrix<T>& A, mpi::Comm comm, int source, const PipelineCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    TransferFuture<T> future;
+    pipeline::PostRecvs( A, comm, source, ctrl, future );
+    return future;
+}
+
+template<typename T>
+TransferFuture<T> SendRecvAsync
+( const Matrix<T>& A, Matrix<T>& B, mpi::Comm comm,
+  int sendRank, int recvRank, const PipelineCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    TransferFuture<T> future;
+    pipeline::PostRecvs( B, comm, recvRank, ctrl, future );
+    pipeline::PostSends( A, comm, sendRank, ctrl, future );
+    return future;
+}
+
+template<typename T>
+void PipelinedBroadcast
+( Matrix<T>& A, mpi::Comm comm, int rank, const PipelineCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    if( commSize == 1 )
+        return;
+    const Int size = A.Height()*A.Width();
+    const Int numSegments = pipeline::NumSegments( size, ctrl );
+    const Int segmentSize = ctrl.segmentSize;
+
+    // Each process receives from its predecessor in the chain starting at
+    // the root and forwards every segment to its successor as soon as the
+    // segment arrives
+    const int chainRank = Mod( commRank-rank, commSize );
+    const int prev = Mod( commRank-1, commSize );
+    const int next = Mod( commRank+1, commSize );
+    const bool isRoot = ( chainRank == 0 );
+    const bool isTail = ( chainRank == commSize-1 );
+
+    const bool contiguous = ( A.Height() == A.LDim() );
+    vector<T> packed;
+    if( !contiguous )
+        FastResize( packed, size );
+    T* buffer = ( contiguous ? A.Buffer() : packed.data() );
+
+    vector<mpi::Request<T>> recvRequests( isRoot ? 0 : numSegments );
+    vector<mpi::Request<T>> sendRequests( isTail ? 0 : numSegments );
+    if( !isRoot )
+    {
+        for( Int s=0; s<numSegments; ++s )
+        {
+            const Int offset = s*segmentSize;
+            mpi::IRecv
+            ( &buffer[offset], int(Min(segmentSize,size-offset)), prev, comm,
+              recvRequests[s] );
+        }
+    }
+    for( Int s=0; s<numSegments; ++s )
+    {
+        const Int offset = s*segmentSize;
+        const Int segSize = Min(segmentSize,size-offset);
+        if( isRoot )
+        {
+            if( !contiguous )
+                pipeline::PackSegment( A, offset, segSize, &buffer[offset] );
+        }
+        else
+            mpi::Wait( recvRequests[s] );
+        if( !isTail )
+            mpi::ISend
+            ( &buffer[offset], int(segSize), next, comm, sendRequests[s] );
+        if( !isRoot && !contiguous )
+            pipeline::UnpackSegment( &buffer[offset], offset, segSize, A );
+    }
+    if( !isTail )
+        mpi::WaitAll( int(numSegments), sendRequests.data() );
+}
+
+template<typename T>
+void PipelinedBroadcast
+( AbstractDistMatrix<T>& A, mpi::Comm comm, int rank,
+  const PipelineCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( !A.Participating() )
+        return;
+    PipelinedBroadcast( A.Matrix(), comm, rank, ctrl );
+}
+
+#ifdef EL_INSTANTIATE_BLAS_LEVEL1
+# define EL_EXTERN
+#else
+# define EL_EXTERN extern
+#endif
+
+#define PROTO(T) \
+  EL_EXTERN template class TransferFuture<T>; \
+  EL_EXTERN template TransferFuture<T> SendAsync \
+  ( const Matrix<T>& A, mpi::Comm comm, int destination, \
+    const PipelineCtrl& ctrl ); \
+  EL_EXTERN template TransferFuture<T> RecvAsync \
+  ( Matrix<T>& A, mpi::Comm comm, int source, const PipelineCtrl& ctrl ); \
+  EL_EXTERN template TransferFuture<T> SendRecvAsync \
+  ( const Matrix<T>& A, Matrix<T>& B, mpi::Comm comm, \
+    int sendRank, int recvRank, const PipelineCtrl& ctrl ); \
+  EL_EXTERN template void PipelinedBroadcast \
+  ( Matrix<T>& A, mpi::Comm comm, int rank, const PipelineCtrl& ctrl ); \
+  EL_EXTERN template void PipelinedBroadcast \
+  ( AbstractDistMatrix<T>& A, mpi::Comm comm, int rank, \
+    const PipelineCtrl& ctrl );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+#undef EL_EXTERN
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_PIPELINED_HPP
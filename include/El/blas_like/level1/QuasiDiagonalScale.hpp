@@ -23,7 +23,7 @@ void QuasiDiagonalScale
     EL_DEBUG_CSE
     const Int m = X.Height();
     const Int n = X.Width();
-    Matrix<F> D( 2, 2 );
+    SmallMatrix<F,2,2> D;
     if( side == LEFT && uplo == LOWER )
     {
         Int i=0;
@@ -42,9 +42,9 @@ void QuasiDiagonalScale
             }
             else
             {
-                D.Set(0,0,d.Get(i,0));
-                D.Set(1,1,d.Get(i+1,0));
-                D.Set(1,0,dSub.Get(i,0));
+                D(0,0) = d.Get(i,0);
+                D(1,1) = d.Get(i+1,0);
+                D(1,0) = dSub.Get(i,0);
                 MakeSymmetric( LOWER, D, conjugated );
 
                 Transform2x2Rows( D, X, i, i+1 );
@@ -71,9 +71,9 @@ void QuasiDiagonalScale
             }
             else
             {
-                D.Set(0,0,d.Get(j,0));
-                D.Set(1,1,d.Get(j+1,0));
-                D.Set(1,0,dSub.Get(j,0));
+                D(0,0) = d.Get(j,0);
+                D(1,1) = d.Get(j+1,0);
+                D(1,0) = dSub.Get(j,0);
                 MakeSymmetric( LOWER, D, conjugated );
 
                 Transform2x2Cols( D, X, j, j+1 );
@@ -0,0 +1,289 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_REGRID_HPP
+#define EL_BLAS_REGRID_HPP
+
+namespace El {
+
+namespace regrid {
+
+// The viewing rank of the copy of A's distribution rank 'distRank' which
+// sends to viewing rank 'q': q itself if it holds a copy (so that no data
+// moves), and otherwise the copy with redundant rank q modulo the redundant
+// size (so that the sends are spread over the copies)
+inline int Source
+( const vector<int>& viewingRanks, int distSize, int redundantSize,
+  int distRank, int q )
+{
+    for( int r=0; r<redundantSize; ++r )
+        if( viewingRanks[distRank+r*distSize] == q )
+            return q;
+    return viewingRanks[distRank+(q % redundantSize)*distSize];
+}
+
+} // namespace regrid
+
+template<typename T>
+void Regrid( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Grid& gA = A.Grid();
+    const Grid& gB = B.Grid();
+    if( !mpi::Congruent( gA.ViewingComm(), gB.ViewingComm() ) )
+        LogicError("Viewing communicators of the grids must be congruent");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    B.Resize( m, n );
+
+    mpi::Comm comm = gB.ViewingComm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const bool inA = A.Participating();
+    const bool inB = B.Participating();
+
+    const int ADistSize = A.DistSize();
+    const int ARedundantSize = A.RedundantSize();
+    const int BDistSize = B.DistSize();
+    const int BRedundantSize = B.RedundantSize();
+    const auto AViewingRanks = submatrix::ViewingRanks( A );
+    const auto BViewingRanks = submatrix::ViewingRanks( B );
+
+    // Determine the processes we send to and the per-dimension owners in B
+    // of our local rows and columns of A
+    // =====================================================================
+    vector<bool> sendTo(commSize,false);
+    vector<int> ARowOwnersB, AColOffsetsB;
+    if( inA )
+    {
+        const int distRank = A.DistRank();
+        for( int q=0; q<commSize; ++q )
+            sendTo[q] =
+              regrid::Source
+              ( AViewingRanks, ADistSize, ARedundantSize, distRank, q ) ==
+              commRank;
+        const Int mLocA = A.LocalHeight();
+        const Int nLocA = A.LocalWidth();
+        ARowOwnersB.resize( mLocA );
+        AColOffsetsB.resize( nLocA );
+        for( Int iLoc=0; iLoc<mLocA; ++iLoc )
+            ARowOwnersB[iLoc] = B.RowOwner( A.GlobalRow(iLoc) );
+        for( Int jLoc=0; jLoc<nLocA; ++jLoc )
+            AColOffsetsB[jLoc] = B.ColOwner(A.GlobalCol(jLoc))*B.ColStride();
+    }
+
+    // Determine the source of each of our entries of B
+    // ================================================
+    vector<int> sources;
+    vector<int> BRowOwnersA, BColOffsetsA;
+    if( inB )
+    {
+        sources.resize( ADistSize );
+        for( int distRank=0; distRank<ADistSize; ++distRank )
+            sources[distRank] =
+              regrid::Source
+              ( AViewingRanks, ADistSize, ARedundantSize, distRank,
+                commRank );
+        const Int mLocB = B.LocalHeight();
+        const Int nLocB = B.LocalWidth();
+        BRowOwnersA.resize( mLocB );
+        BColOffsetsA.resize( nLocB );
+        for( Int iLoc=0; iLoc<mLocB; ++iLoc )
+            BRowOwnersA[iLoc] = A.RowOwner( B.GlobalRow(iLoc) );
+        for( Int jLoc=0; jLoc<nLocB; ++jLoc )
+            BColOffsetsA[jLoc] = A.ColOwner(B.GlobalCol(jLoc))*A.ColStride();
+    }
+
+    // Redistribute one block of columns at a time so that the packing of
+    // each block overlaps with the exchange of the previous one. Entries
+    // which remain on the same process are copied directly.
+    // ===================================================================
+    const T* ABuf = A.LockedBuffer();
+    T* BBuf = B.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    const Int mLocA = ( inA ? A.LocalHeight() : 0 );
+    const Int mLocB = ( inB ? B.LocalHeight() : 0 );
+    const Int blocksize = Max( Blocksize(), Int(1) );
+    const Int numBlocks = (n+blocksize-1) / blocksize;
+
+    struct Exchange
+    {
+        vector<int> recvCounts, recvOffs;
+        vector<T> sendBuf, recvBuf;
+        vector<mpi::Request<T>> requests;
+        Int BColBeg=0, BColEnd=0;
+    };
+    Exchange exchanges[2];
+    Int AColBeg=0, BColBeg=0;
+
+    auto start = [&]( Int block, Exchange& exchange )
+    {
+        const Int jEnd = Min( (block+1)*blocksize, n );
+        Int AColEnd = AColBeg;
+        if( inA )
+            while( AColEnd < A.LocalWidth() && A.GlobalCol(AColEnd) < jEnd )
+                ++AColEnd;
+        Int BColEnd = BColBeg;
+        if( inB )
+            while( BColEnd < B.LocalWidth() && B.GlobalCol(BColEnd) < jEnd )
+                ++BColEnd;
+
+        // Count and pack the sends
+        vector<int> sendCounts(commSize,0), sendOffs(commSize);
+        auto forEachSend = [&]( auto func )
+        {
+            for( Int jLoc=AColBeg; jLoc<AColEnd; ++jLoc )
+                for( Int iLoc=0; iLoc<mLocA; ++iLoc )
+                {
+                    const int distOwner =
+                      ARowOwnersB[iLoc] + AColOffsetsB[jLoc];
+                    for( int r=0; r<BRedundantSize; ++r )
+                    {
+                        const int q = BViewingRanks[distOwner+r*BDistSize];
+                        if( sendTo[q] )
+                            func( iLoc, jLoc, q );
+                    }
+                }
+        };
+        forEachSend( [&]( Int, Int, int q ) { ++sendCounts[q]; } );
+        int totalSend = 0;
+        for( int q=0; q<commSize; ++q )
+        {
+            sendOffs[q] = totalSend;
+            if( q != commRank )
+                totalSend += sendCounts[q];
+        }
+        FastResize( exchange.sendBuf, totalSend );
+        auto offs = sendOffs;
+        forEachSend
+        ( [&]( Int iLoc, Int jLoc, int q )
+          {
+              const T& value = ABuf[iLoc+jLoc*ALDim];
+              if( q == commRank )
+              {
+                  const Int i = A.GlobalRow(iLoc);
+                  const Int j = A.GlobalCol(jLoc);
+                  BBuf[B.LocalRow(i)+B.LocalCol(j)*BLDim] = value;
+              }
+              else
+                  exchange.sendBuf[offs[q]++] = value;
+          } );
+
+        // Count the receives
+        exchange.recvCounts.assign( commSize, 0 );
+        exchange.recvOffs.resize( commSize );
+        for( Int jLoc=BColBeg; jLoc<BColEnd; ++jLoc )
+            for( Int iLoc=0; iLoc<mLocB; ++iLoc )
+            {
+                const int p = sources[BRowOwnersA[iLoc]+BColOffsetsA[jLoc]];
+                if( p != commRank )
+                    ++exchange.recvCounts[p];
+            }
+        int totalRecv = 0;
+        for( int p=0; p<commSize; ++p )
+        {
+            exchange.recvOffs[p] = totalRecv;
+            totalRecv += exchange.recvCounts[p];
+        }
+        FastResize( exchange.recvBuf, totalRecv );
+
+        // Post the non-blocking exchange (the requests must not be moved
+        // once posted, so they are allocated up front)
+        Int numRequests = 0;
+        for( int q=0; q<commSize; ++q )
+        {
+            if( exchange.recvCounts[q] != 0 )
+                ++numRequests;
+            if( q != commRank && sendCounts[q] != 0 )
+                ++numRequests;
+        }
+        exchange.requests.clear();
+        exchange.requests.resize( numRequests );
+        Int request = 0;
+        for( int p=0; p<commSize; ++p )
+            if( exchange.recvCounts[p] != 0 )
+                mpi::IRecv
+                ( &exchange.recvBuf[exchange.recvOffs[p]],
+                  exchange.recvCounts[p], p, comm,
+                  exchange.requests[request++] );
+        for( int q=0; q<commSize; ++q )
+            if( q != commRank && sendCounts[q] != 0 )
+                mpi::ISend
+                ( &exchange.sendBuf[sendOffs[q]], sendCounts[q], q, comm,
+                  exchange.requests[request++] );
+        exchange.BColBeg = BColBeg;
+        exchange.BColEnd = BColEnd;
+        AColBeg = AColEnd;
+        BColBeg = BColEnd;
+    };
+
+    auto finish = [&]( Exchange& exchange )
+    {
+        mpi::WaitAll( exchange.requests.size(), exchange.requests.data() );
+        auto offs = exchange.recvOffs;
+        for( Int jLoc=exchange.BColBeg; jLoc<exchange.BColEnd; ++jLoc )
+            for( Int iLoc=0; iLoc<mLocB; ++iLoc )
+            {
+                const int p = sources[BRowOwnersA[iLoc]+BColOffsetsA[jLoc]];
+                if( p != commRank )
+                    BBuf[iLoc+jLoc*BLDim] = exchange.recvBuf[offs[p]++];
+            }
+    };
+
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        start( block, exchanges[block%2] );
+        if( block > 0 )
+            finish( exchanges[(block-1)%2] );
+    }
+    if( numBlocks > 0 )
+        finish( exchanges[(numBlocks-1)%2] );
+}
+
+template<typename T>
+void Regrid( AbstractDistMatrix<T>& A, const Grid& grid )
+{
+    EL_DEBUG_CSE
+    if( A.Viewing() )
+        LogicError("Cannot regrid a view");
+    if( &A.Grid() == &grid )
+        return;
+    unique_ptr<AbstractDistMatrix<T>> B( A.Construct(grid,A.Root()) );
+    Regrid( A, *B );
+    // B was constructed with the default alignments, which are restored by
+    // SetGrid, and so its local matrix can be adopted directly
+    A.SetGrid( grid );
+    A.Resize( B->Height(), B->Width() );
+    A.Matrix() = B->LockedMatrix();
+}
+
+#ifdef EL_INSTANTIATE_BLAS_LEVEL1
+# define EL_EXTERN
+#else
+# define EL_EXTERN extern
+#endif
+
+#define PROTO(T) \
+  EL_EXTERN template void Regrid \
+  ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B ); \
+  EL_EXTERN template void Regrid \
+  ( AbstractDistMatrix<T>& A, const Grid& grid );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+#undef EL_EXTERN
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_REGRID_HPP
@@ -48,8 +48,131 @@ Matrix<T> Reshape( Int mNew, Int nNew, const Matrix<T>& A )
     return B;
 }
 
-// TODO(poulson): Merge with implementation of GetSubmatrix via a function
-// which maps the coordinates in A to the coordinates in B
+namespace reshape {
+
+// When A and B are both elementally distributed over the same grid, the
+// owner in B of each entry of A (and vice versa) follows from the
+// distribution arithmetic. The column-major traversal of the local entries of
+// either matrix visits them in increasing order of their shared linear index,
+// i + j m, so each sender packs its values for a given receiver in that order
+// and the receiver unpacks them in its own traversal order: only the values
+// are exchanged, in a single AllToAll. As in submatrix::Transfer, each
+// redundant copy of B is fed by the copy of A whose redundant rank matches
+// the receiver's viewing rank modulo the redundant size of A.
+template<typename T>
+void Elemental
+(       Int mNew,
+  const AbstractDistMatrix<T>& A,
+        AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Grid& g = A.Grid();
+    mpi::Comm comm = g.ViewingComm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const int ARedundantSize = A.RedundantSize();
+    const int ARedundantRank = A.Participating() ? A.RedundantRank() : 0;
+    const int BDistSize = B.DistSize();
+    const int BRedundantSize = B.RedundantSize();
+
+    vector<int> BViewingRanks, AViewingRanks;
+    if( A.Participating() )
+        BViewingRanks = submatrix::ViewingRanks( B );
+    if( B.Participating() )
+    {
+        const int ADistSize = A.DistSize();
+        const int sourceRedundantRank = commRank % ARedundantSize;
+        const auto allViewingRanks = submatrix::ViewingRanks( A );
+        AViewingRanks.assign
+        ( allViewingRanks.begin()+sourceRedundantRank*ADistSize,
+          allViewingRanks.begin()+(sourceRedundantRank+1)*ADistSize );
+    }
+
+    auto forEachSend = [&]( auto func )
+    {
+        if( !A.Participating() )
+            return;
+        const Int mLoc = A.LocalHeight();
+        const Int nLoc = A.LocalWidth();
+        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+            {
+                const Int k = A.GlobalRow(iLoc) + j*m;
+                const int distOwner =
+                  B.RowOwner(k % mNew) + B.ColOwner(k / mNew)*B.ColStride();
+                for( int r=0; r<BRedundantSize; ++r )
+                {
+                    const int q = BViewingRanks[distOwner+r*BDistSize];
+                    if( q % ARedundantSize == ARedundantRank )
+                        func( iLoc, jLoc, q );
+                }
+            }
+        }
+    };
+    auto forEachRecv = [&]( auto func )
+    {
+        if( !B.Participating() )
+            return;
+        const Int mLoc = B.LocalHeight();
+        const Int nLoc = B.LocalWidth();
+        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+        {
+            const Int jNew = B.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+            {
+                const Int k = B.GlobalRow(iLoc) + jNew*mNew;
+                const int p =
+                  AViewingRanks[A.RowOwner(k % m)+A.ColOwner(k / m)*
+                                A.ColStride()];
+                func( iLoc, jLoc, p );
+            }
+        }
+    };
+
+    vector<int> sendCounts(commSize,0), recvCounts(commSize,0);
+    forEachSend( [&]( Int, Int, int q ) { ++sendCounts[q]; } );
+    forEachRecv( [&]( Int, Int, int p ) { ++recvCounts[p]; } );
+    vector<int> sendOffs(commSize), recvOffs(commSize);
+    int totalSend=0, totalRecv=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        sendOffs[q] = totalSend;
+        recvOffs[q] = totalRecv;
+        totalSend += sendCounts[q];
+        totalRecv += recvCounts[q];
+    }
+
+    vector<T> sendBuf, recvBuf;
+    FastResize( sendBuf, totalSend );
+    FastResize( recvBuf, totalRecv );
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    auto offs = sendOffs;
+    forEachSend
+    ( [&]( Int iLoc, Int jLoc, int q )
+      { sendBuf[offs[q]++] = ABuf[iLoc+jLoc*ALDim]; } );
+
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+      recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    offs = recvOffs;
+    forEachRecv
+    ( [&]( Int iLoc, Int jLoc, int p )
+      { BBuf[iLoc+jLoc*BLDim] = recvBuf[offs[p]++]; } );
+}
+
+} // namespace reshape
+
+// Elemental distributions are reshaped with a direct exchange of the values,
+// and other distributions through the general-purpose queues
+// TODO(poulson): Merge the latter with the implementation of GetSubmatrix via
+// a function which maps the coordinates in A to the coordinates in B
 template<typename T>
 void Reshape
 (       Int mNew,
@@ -70,6 +193,13 @@ void Reshape
 
     B.SetGrid( g );
     B.Resize( mNew, nNew );
+    if( m*n == 0 )
+        return;
+    if( A.Wrap() == ELEMENT && B.Wrap() == ELEMENT )
+    {
+        reshape::Elemental( mNew, A, B );
+        return;
+    }
     Zero( B );
 
     B.Reserve( mLocal*nLocal );
@@ -95,6 +225,83 @@ DistMatrix<T> Reshape( Int mNew, Int nNew, const AbstractDistMatrix<T>& A )
     return B;
 }
 
+// The column-major ordering of the entries of a DistMultiVec is the same as
+// that of a matrix, so, e.g., a vector vec(X) may be reshaped into X
+template<typename T>
+void Reshape
+(       Int mNew,
+        Int nNew,
+  const DistMultiVec<T>& A,
+        AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int mLocal = A.LocalHeight();
+    if( m*n != mNew*nNew )
+        LogicError
+        ("Reshape from ",m," x ",n," to ",mNew," x ",nNew,
+         " did not preserve the total number of entries");
+
+    B.SetGrid( A.Grid() );
+    B.Resize( mNew, nNew );
+    Zero( B );
+
+    const auto& ALoc = A.LockedMatrix();
+    B.Reserve( mLocal*n );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            const Int iNew = (i+j*m) % mNew;
+            const Int jNew = (i+j*m) / mNew;
+            B.QueueUpdate( iNew, jNew, ALoc(iLoc,j) );
+        }
+    }
+    B.ProcessQueues();
+}
+
+template<typename T>
+void Reshape
+(       Int mNew,
+        Int nNew,
+  const AbstractDistMatrix<T>& A,
+        DistMultiVec<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int mLocal = A.LocalHeight();
+    const Int nLocal = A.LocalWidth();
+    if( m*n != mNew*nNew )
+        LogicError
+        ("Reshape from ",m," x ",n," to ",mNew," x ",nNew,
+         " did not preserve the total number of entries");
+
+    B.SetGrid( A.Grid() );
+    B.Resize( mNew, nNew );
+    Zero( B );
+
+    // Redundant copies of A must only contribute once
+    if( A.RedundantRank() == 0 && A.Participating() )
+    {
+        B.Reserve( mLocal*nLocal );
+        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+            {
+                const Int i = A.GlobalRow(iLoc);
+                const Int iNew = (i+j*m) % mNew;
+                const Int jNew = (i+j*m) / mNew;
+                B.QueueUpdate( iNew, jNew, A.GetLocal(iLoc,jLoc) );
+            }
+        }
+    }
+    B.ProcessQueues();
+}
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -115,7 +322,17 @@ DistMatrix<T> Reshape( Int mNew, Int nNew, const AbstractDistMatrix<T>& A )
     const AbstractDistMatrix<T>& A, \
           AbstractDistMatrix<T>& B ); \
   EL_EXTERN template DistMatrix<T> Reshape \
-  ( Int mNew, Int nNew, const AbstractDistMatrix<T>& A );
+  ( Int mNew, Int nNew, const AbstractDistMatrix<T>& A ); \
+  EL_EXTERN template void Reshape \
+  (       Int mNew, \
+          Int nNew, \
+    const DistMultiVec<T>& A, \
+          AbstractDistMatrix<T>& B ); \
+  EL_EXTERN template void Reshape \
+  (       Int mNew, \
+          Int nNew, \
+    const AbstractDistMatrix<T>& A, \
+          DistMultiVec<T>& B );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
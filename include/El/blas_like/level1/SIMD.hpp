@@ -0,0 +1,293 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_SIMD_HPP
+#define EL_BLAS_SIMD_HPP
+
+#ifdef __AVX__
+# include <immintrin.h>
+#endif
+
+// Unit-stride kernels for the innermost loops of the level-1 routines.
+//
+// The generic versions are written so that the compiler can vectorize them.
+// Complex<float> and Complex<double> are handled by operating on the
+// interleaved (real,imag) pairs directly, since compilers rarely vectorize
+// through the elementwise arithmetic of Complex<Real>; when the library is
+// compiled for AVX (or newer), explicit 256-bit kernels are used instead.
+// Complex data stored as separate real and imaginary arrays vectorizes
+// without any shuffling of the parts.
+// All kernels allow the output to alias an input.
+
+namespace El {
+namespace simd {
+
+// Contiguous buffers are processed in chunks of this many entries so that
+// the chunks can be distributed over threads
+inline Int ChunkSize() { return 4096; }
+
+// c := a .* b
+// ===========
+
+template<typename T>
+void Hadamard( Int n, const T* a, const T* b, T* c )
+{
+    EL_SIMD
+    for( Int k=0; k<n; ++k )
+        c[k] = a[k]*b[k];
+}
+
+template<typename Real>
+void ComplexHadamard
+( Int n, const Complex<Real>* aCpx, const Complex<Real>* bCpx,
+  Complex<Real>* cCpx )
+{
+    const Real* a = reinterpret_cast<const Real*>(aCpx);
+    const Real* b = reinterpret_cast<const Real*>(bCpx);
+          Real* c = reinterpret_cast<Real*>(cCpx);
+    EL_SIMD
+    for( Int k=0; k<n; ++k )
+    {
+        const Real aReal=a[2*k], aImag=a[2*k+1];
+        const Real bReal=b[2*k], bImag=b[2*k+1];
+        c[2*k]   = aReal*bReal - aImag*bImag;
+        c[2*k+1] = aReal*bImag + aImag*bReal;
+    }
+}
+
+inline void Hadamard
+( Int n, const Complex<float>* a, const Complex<float>* b, Complex<float>* c )
+{
+    Int k=0;
+#ifdef __AVX__
+    const float* aBuf = reinterpret_cast<const float*>(a);
+    const float* bBuf = reinterpret_cast<const float*>(b);
+          float* cBuf = reinterpret_cast<float*>(c);
+    for( ; k+4<=n; k+=4 )
+    {
+        const __m256 aVec = _mm256_loadu_ps( &aBuf[2*k] );
+        const __m256 bVec = _mm256_loadu_ps( &bBuf[2*k] );
+        const __m256 bReal = _mm256_moveldup_ps( bVec );
+        const __m256 bImag = _mm256_movehdup_ps( bVec );
+        const __m256 aSwap = _mm256_permute_ps( aVec, 0xB1 );
+        _mm256_storeu_ps
+        ( &cBuf[2*k],
+          _mm256_addsub_ps
+          ( _mm256_mul_ps(aVec,bReal), _mm256_mul_ps(aSwap,bImag) ) );
+    }
+#endif
+    ComplexHadamard( n-k, &a[k], &b[k], &c[k] );
+}
+
+inline void Hadamard
+( Int n, const Complex<double>* a, const Complex<double>* b,
+  Complex<double>* c )
+{
+    Int k=0;
+#ifdef __AVX__
+    const double* aBuf = reinterpret_cast<const double*>(a);
+    const double* bBuf = reinterpret_cast<const double*>(b);
+          double* cBuf = reinterpret_cast<double*>(c);
+    for( ; k+2<=n; k+=2 )
+    {
+        const __m256d aVec = _mm256_loadu_pd( &aBuf[2*k] );
+        const __m256d bVec = _mm256_loadu_pd( &bBuf[2*k] );
+        const __m256d bReal = _mm256_movedup_pd( bVec );
+        const __m256d bImag = _mm256_permute_pd( bVec, 0xF );
+        const __m256d aSwap = _mm256_permute_pd( aVec, 0x5 );
+        _mm256_storeu_pd
+        ( &cBuf[2*k],
+          _mm256_addsub_pd
+          ( _mm256_mul_pd(aVec,bReal), _mm256_mul_pd(aSwap,bImag) ) );
+    }
+#endif
+    ComplexHadamard( n-k, &a[k], &b[k], &c[k] );
+}
+
+// y := alpha x + y
+// ================
+
+template<typename T>
+void Axpy( Int n, T alpha, const T* x, T* y )
+{
+    EL_SIMD
+    for( Int k=0; k<n; ++k )
+        y[k] += alpha*x[k];
+}
+
+template<typename Real>
+void ComplexAxpy
+( Int n, Complex<Real> alpha, const Complex<Real>* xCpx, Complex<Real>* yCpx )
+{
+    const Real alphaReal=alpha.real(), alphaImag=alpha.imag();
+    const Real* x = reinterpret_cast<const Real*>(xCpx);
+          Real* y = reinterpret_cast<Real*>(yCpx);
+    EL_SIMD
+    for( Int k=0; k<n; ++k )
+    {
+        const Real xReal=x[2*k], xImag=x[2*k+1];
+        y[2*k]   += alphaReal*xReal - alphaImag*xImag;
+        y[2*k+1] += alphaReal*xImag + alphaImag*xReal;
+    }
+}
+
+inline void Axpy
+( Int n, Complex<float> alpha, const Complex<float>* x, Complex<float>* y )
+{ ComplexAxpy( n, alpha, x, y ); }
+
+inline void Axpy
+( Int n, Complex<double> alpha, const Complex<double>* x, Complex<double>* y )
+{ ComplexAxpy( n, alpha, x, y ); }
+
+// x := alpha x
+// ============
+
+template<typename T>
+void Scale( Int n, T alpha, T* x )
+{
+    EL_SIMD
+    for( Int k=0; k<n; ++k )
+        x[k] *= alpha;
+}
+
+template<typename Real>
+void ComplexScale( Int n, Complex<Real> alpha, Complex<Real>* xCpx )
+{
+    const Real alphaReal=alpha.real(), alphaImag=alpha.imag();
+    Real* x = reinterpret_cast<Real*>(xCpx);
+    EL_SIMD
+    for( Int k=0; k<n; ++k )
+    {
+        const Real xReal=x[2*k], xImag=x[2*k+1];
+        x[2*k]   = alphaReal*xReal - alphaImag*xImag;
+        x[2*k+1] = alphaReal*xImag + alphaImag*xReal;
+    }
+}
+
+inline void Scale( Int n, Complex<float> alpha, Complex<float>* x )
+{ ComplexScale( n, alpha, x ); }
+
+inline void Scale( Int n, Complex<double> alpha, Complex<double>* x )
+{ ComplexScale( n, alpha, x ); }
+
+// Separated complex data
+// ======================
+
+// (aReal,aImag) := a
+template<typename Real>
+void SplitComplex
+( Int n, const Complex<Real>* aCpx, Real* aReal, Real* aImag )
+{
+    const Real* a = reinterpret_cast<const Real*>(aCpx);
+    EL_SIMD
+    for( Int k=0; k<n; ++k )
+    {
+        aReal[k] = a[2*k];
+        aImag[k] = a[2*k+1];
+    }
+}
+
+// a := aReal + i aImag
+template<typename Real>
+void MergeComplex
+( Int n, const Real* aReal, const Real* aImag, Complex<Real>* aCpx )
+{
+    Real* a = reinterpret_cast<Real*>(aCpx);
+    EL_SIMD
+    for( Int k=0; k<n; ++k )
+    {
+        a[2*k]   = aReal[k];
+        a[2*k+1] = aImag[k];
+    }
+}
+
+// (cReal,cImag) := (aReal,aImag) .* (bReal,bImag)
+template<typename Real>
+void SplitHadamard
+( Int n,
+  const Real* aReal, const Real* aImag,
+  const Real* bReal, const Real* bImag,
+        Real* cReal,       Real* cImag )
+{
+    EL_SIMD
+    for( Int k=0; k<n; ++k )
+    {
+        const Real alphaReal=aReal[k], alphaImag=aImag[k];
+        const Real betaReal=bReal[k], betaImag=bImag[k];
+        cReal[k] = alphaReal*betaReal - alphaImag*betaImag;
+        cImag[k] = alphaReal*betaImag + alphaImag*betaReal;
+    }
+}
+
+// (yReal,yImag) += alpha (xReal,xImag)
+template<typename Real>
+void SplitAxpy
+( Int n, Complex<Real> alpha,
+  const Real* xReal, const Real* xImag,
+        Real* yReal,       Real* yImag )
+{
+    const Real alphaReal=alpha.real(), alphaImag=alpha.imag();
+    EL_SIMD
+    for( Int k=0; k<n; ++k )
+    {
+        const Real chiReal=xReal[k], chiImag=xImag[k];
+        yReal[k] += alphaReal*chiReal - alphaImag*chiImag;
+        yImag[k] += alphaReal*chiImag + alphaImag*chiReal;
+    }
+}
+
+// (aReal,aImag)^H (bReal,bImag)
+template<typename Real>
+Complex<Real> SplitDot
+( Int n,
+  const Real* aReal, const Real* aImag,
+  const Real* bReal, const Real* bImag )
+{
+    Real dotReal=0, dotImag=0;
+    for( Int k=0; k<n; ++k )
+    {
+        dotReal += aReal[k]*bReal[k] + aImag[k]*bImag[k];
+        dotImag += aReal[k]*bImag[k] - aImag[k]*bReal[k];
+    }
+    return Complex<Real>(dotReal,dotImag);
+}
+
+// OpenMP reductions are not defined for the extended-precision classes, so
+// the reordered summation is only requested for the native types
+template<typename Real>
+Complex<Real> NativeSplitDot
+( Int n,
+  const Real* aReal, const Real* aImag,
+  const Real* bReal, const Real* bImag )
+{
+    Real dotReal=0, dotImag=0;
+    EL_SIMD_SUM(dotReal,dotImag)
+    for( Int k=0; k<n; ++k )
+    {
+        dotReal += aReal[k]*bReal[k] + aImag[k]*bImag[k];
+        dotImag += aReal[k]*bImag[k] - aImag[k]*bReal[k];
+    }
+    return Complex<Real>(dotReal,dotImag);
+}
+
+inline Complex<float> SplitDot
+( Int n,
+  const float* aReal, const float* aImag,
+  const float* bReal, const float* bImag )
+{ return NativeSplitDot( n, aReal, aImag, bReal, bImag ); }
+
+inline Complex<double> SplitDot
+( Int n,
+  const double* aReal, const double* aImag,
+  const double* bReal, const double* bImag )
+{ return NativeSplitDot( n, aReal, aImag, bReal, bImag ); }
+
+} // namespace simd
+} // namespace El
+
+#endif // ifndef EL_BLAS_SIMD_HPP
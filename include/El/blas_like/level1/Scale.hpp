@@ -9,6 +9,8 @@
 #ifndef EL_BLAS_SCALE_HPP
 #define EL_BLAS_SCALE_HPP
 
+#include <El/blas_like/level1/SIMD.hpp>
+
 namespace El {
 
 template<typename T,typename S>
@@ -32,21 +34,22 @@ void Scale( S alphaS, Matrix<T>& A )
     {
         if( ALDim == height )
         {
-            EL_PARALLEL_FOR
-            for( Int i=0; i<height*width; ++i )
-                ABuf[i] *= alpha;
+            const Int numEntries = height*width;
+            const Int chunkSize = simd::ChunkSize();
+            const Int numChunks = (numEntries+chunkSize-1) / chunkSize;
+            EL_PARALLEL_FOR_GRAIN(numEntries)
+            for( Int chunk=0; chunk<numChunks; ++chunk )
+            {
+                const Int off = chunk*chunkSize;
+                simd::Scale
+                ( Min(chunkSize,numEntries-off), alpha, &ABuf[off] );
+            }
         }
         else
         {
-            EL_PARALLEL_FOR
+            EL_PARALLEL_FOR_GRAIN(height*width)
             for( Int j=0; j<width; ++j )
-            {
-                EL_SIMD
-                for( Int i=0; i<height; ++i )
-                {
-                    ABuf[i+j*ALDim] *= alpha;
-                }
-            }
+                simd::Scale( height, alpha, &ABuf[j*ALDim] );
         }
     }
 }
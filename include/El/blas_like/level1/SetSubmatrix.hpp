@@ -42,13 +42,12 @@ void SetSubmatrix
   const AbstractDistMatrix<T>& ASub )
 {
     EL_DEBUG_CSE
-    // Set the appropriate portion of A to zero before updating
-    for( auto& i : I )
-        if( A.IsLocalRow(i) )
-            for( auto& j : J )
-                if( A.IsLocalCol(j) )
-                    A.Set( i, j, 0 );
-    UpdateSubmatrix( A, I, J, T(1), ASub );
+    if( A.Grid() != ASub.Grid() )
+        LogicError("Grids of A and ASub must match");
+    submatrix::Transfer
+    ( ASub, submatrix::RangeToVector(IR(0,ASub.Height())),
+            submatrix::RangeToVector(IR(0,ASub.Width())),
+      A, I, J, T(1), false );
 }
 
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
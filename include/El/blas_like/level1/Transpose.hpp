@@ -9,6 +9,10 @@
 #ifndef EL_BLAS_TRANSPOSE_HPP
 #define EL_BLAS_TRANSPOSE_HPP
 
+#ifdef __AVX__
+# include <immintrin.h>
+#endif
+
 namespace El {
 
 namespace transpose {
@@ -67,6 +71,153 @@ void PartialColAllGather
 ( const BlockMatrix<T>& A,
         BlockMatrix<T>& B, bool conjugate );
 
+// Local kernels
+// =============
+
+// Transpose (or adjoint) the m x n matrix A into the n x m matrix B, where
+// both fit within a few pages of cache
+template<typename T>
+void Tile
+( Int m, Int n,
+  const T* A, Int ldA,
+        T* B, Int ldB, bool conjugate )
+{
+    if( conjugate )
+    {
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                B[j+i*ldB] = Conj(A[i+j*ldA]);
+    }
+    else
+    {
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                B[j+i*ldB] = A[i+j*ldA];
+    }
+}
+
+#ifdef __AVX__
+// Transpose a 4 x 4 block of 64-bit entries within registers
+inline void Tile4x4( const double* A, Int ldA, double* B, Int ldB )
+{
+    const __m256d a0 = _mm256_loadu_pd( &A[0*ldA] );
+    const __m256d a1 = _mm256_loadu_pd( &A[1*ldA] );
+    const __m256d a2 = _mm256_loadu_pd( &A[2*ldA] );
+    const __m256d a3 = _mm256_loadu_pd( &A[3*ldA] );
+    const __m256d t0 = _mm256_unpacklo_pd( a0, a1 );
+    const __m256d t1 = _mm256_unpackhi_pd( a0, a1 );
+    const __m256d t2 = _mm256_unpacklo_pd( a2, a3 );
+    const __m256d t3 = _mm256_unpackhi_pd( a2, a3 );
+    _mm256_storeu_pd( &B[0*ldB], _mm256_permute2f128_pd( t0, t2, 0x20 ) );
+    _mm256_storeu_pd( &B[1*ldB], _mm256_permute2f128_pd( t1, t3, 0x20 ) );
+    _mm256_storeu_pd( &B[2*ldB], _mm256_permute2f128_pd( t0, t2, 0x31 ) );
+    _mm256_storeu_pd( &B[3*ldB], _mm256_permute2f128_pd( t1, t3, 0x31 ) );
+}
+
+inline void Tile
+( Int m, Int n,
+  const double* A, Int ldA,
+        double* B, Int ldB, bool conjugate )
+{
+    const Int mMain = m - m%4;
+    const Int nMain = n - n%4;
+    for( Int j=0; j<nMain; j+=4 )
+        for( Int i=0; i<mMain; i+=4 )
+            Tile4x4( &A[i+j*ldA], ldA, &B[j+i*ldB], ldB );
+    for( Int j=0; j<n; ++j )
+        for( Int i=mMain; i<m; ++i )
+            B[j+i*ldB] = A[i+j*ldA];
+    for( Int j=nMain; j<n; ++j )
+        for( Int i=0; i<mMain; ++i )
+            B[j+i*ldB] = A[i+j*ldA];
+}
+
+// Complex<float> entries are also 64 bits wide
+inline void Tile
+( Int m, Int n,
+  const Complex<float>* A, Int ldA,
+        Complex<float>* B, Int ldB, bool conjugate )
+{
+    if( conjugate )
+    {
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                B[j+i*ldB] = Conj(A[i+j*ldA]);
+    }
+    else
+    {
+        Tile
+        ( m, n,
+          reinterpret_cast<const double*>(A), ldA,
+          reinterpret_cast<double*>(B), ldB, false );
+    }
+}
+#endif // ifdef __AVX__
+
+// The largest tile dimension handled directly by Tile
+template<typename T>
+constexpr Int TileSize() { return sizeof(T) <= 8 ? 32 : 16; }
+
+// A cache-oblivious transpose which recursively halves the larger dimension
+// (keeping the splits multiples of four) until the pieces fit within a tile
+template<typename T>
+void Recursive
+( Int m, Int n,
+  const T* A, Int ldA,
+        T* B, Int ldB, bool conjugate )
+{
+    const Int tileSize = TileSize<T>();
+    if( m <= tileSize && n <= tileSize )
+    {
+        Tile( m, n, A, ldA, B, ldB, conjugate );
+    }
+    else if( m >= n )
+    {
+        const Int m0 = ((m/2+3)/4)*4;
+        Recursive( m0, n, A, ldA, B, ldB, conjugate );
+        Recursive( m-m0, n, &A[m0], ldA, &B[m0*ldB], ldB, conjugate );
+    }
+    else
+    {
+        const Int n0 = ((n/2+3)/4)*4;
+        Recursive( m, n0, A, ldA, B, ldB, conjugate );
+        Recursive( m, n-n0, &A[n0*ldA], ldA, &B[n0], ldB, conjugate );
+    }
+}
+
+// Swap (and transpose) the m x n block A with the n x m block B
+template<typename T>
+void SwapTiles
+( Int m, Int n, T* A, Int ldA, T* B, Int ldB, bool conjugate )
+{
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            const T alpha = A[i+j*ldA];
+            A[i+j*ldA] = ( conjugate ? Conj(B[j+i*ldB]) : B[j+i*ldB] );
+            B[j+i*ldB] = ( conjugate ? Conj(alpha) : alpha );
+        }
+    }
+}
+
+// Transpose the n x n diagonal block A in place
+template<typename T>
+void DiagonalTile( Int n, T* A, Int ldA, bool conjugate )
+{
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<j; ++i )
+        {
+            const T alpha = A[i+j*ldA];
+            A[i+j*ldA] = ( conjugate ? Conj(A[j+i*ldA]) : A[j+i*ldA] );
+            A[j+i*ldA] = ( conjugate ? Conj(alpha) : alpha );
+        }
+        if( conjugate )
+            A[j+j*ldA] = Conj(A[j+j*ldA]);
+    }
+}
+
 } // namespace transpose
 
 template<typename T>
@@ -84,50 +235,59 @@ void Transpose( const Matrix<T>& A, Matrix<T>& B, bool conjugate )
     // OpenBLAS's {i,o}matcopy routines where disabled for the reasons detailed
     // in src/core/imports/openblas.cpp
 
-    // Blocked matrix transpose
-    // Note: block size should be a multiple of cache line size and
-    // should be small enough to fit in L1 cache. On recent Intel
-    // CPUs, cache line size is 64 B and L1 cache is 32 KB per core.
-    const Int bsize = Max( 64 / sizeof(T), 1 );
+    // Distribute large panels over the threads, and transpose each panel
+    // with a cache-oblivious recursion down to register/L1-sized tiles
+    const Int panelSize = 256;
     const T* ABuf = A.LockedBuffer();
           T* BBuf = B.Buffer();
     const Int ldA = A.LDim();
     const Int ldB = B.LDim();
-    if( conjugate )
+    EL_PARALLEL_FOR_COLLAPSE2_GRAIN(m*n)
+    for( Int j=0; j<n; j+=panelSize )
     {
-        EL_PARALLEL_FOR_COLLAPSE2
-        for( Int j=0; j<n; j+=bsize )
+        for( Int i=0; i<m; i+=panelSize )
         {
-            for( Int i=0; i<m; i+=bsize )
-            {
-                const Int mb = Min( bsize, m - i );
-                const Int nb = Min( bsize, n - j );
-                const T* ABlockBuf = &ABuf[i+j*ldA];
-                      T* BBlockBuf = &BBuf[j+i*ldB];
-                for( Int jb=0; jb<nb; ++jb )
-                    for( Int ib=0; ib<mb; ++ib )
-                        BBlockBuf[jb+ib*ldB] = Conj(ABlockBuf[ib+jb*ldA]);
-            }
+            const Int mb = Min( panelSize, m - i );
+            const Int nb = Min( panelSize, n - j );
+            transpose::Recursive
+            ( mb, nb, &ABuf[i+j*ldA], ldA, &BBuf[j+i*ldB], ldB, conjugate );
         }
     }
-    else
+#endif
+}
+
+template<typename T>
+void Transpose( Matrix<T>& A, bool conjugate )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( A.Width() != n )
     {
-        EL_PARALLEL_FOR_COLLAPSE2
-        for( Int j=0; j<n; j+=bsize )
+        // There is no cheap in-place transpose of a rectangular matrix with
+        // an arbitrary leading dimension
+        Matrix<T> ACopy( A );
+        Transpose( ACopy, A, conjugate );
+        return;
+    }
+
+    // Swap the (i,j) and (j,i) tiles of the upper triangle in parallel
+    const Int tileSize = transpose::TileSize<T>();
+    const Int numTiles = (n+tileSize-1) / tileSize;
+    T* ABuf = A.Buffer();
+    const Int ldA = A.LDim();
+    EL_PARALLEL_FOR_GRAIN(n*n)
+    for( Int jTile=0; jTile<numTiles; ++jTile )
+    {
+        const Int j = jTile*tileSize;
+        const Int nb = Min( tileSize, n-j );
+        for( Int i=0; i<j; i+=tileSize )
         {
-            for( Int i=0; i<m; i+=bsize )
-            {
-                const Int mb = Min( bsize, m - i );
-                const Int nb = Min( bsize, n - j );
-                const T* ABlockBuf = &ABuf[i+j*ldA];
-                      T* BBlockBuf = &BBuf[j+i*ldB];
-                for( Int jb=0; jb<nb; ++jb )
-                    for( Int ib=0; ib<mb; ++ib )
-                        BBlockBuf[jb+ib*ldB] = ABlockBuf[ib+jb*ldA];
-            }
+            const Int mb = Min( tileSize, n-i );
+            transpose::SwapTiles
+            ( mb, nb, &ABuf[i+j*ldA], ldA, &ABuf[j+i*ldA], ldA, conjugate );
         }
+        transpose::DiagonalTile( nb, &ABuf[j+j*ldA], ldA, conjugate );
     }
-#endif
 }
 
 template<typename T>
@@ -304,6 +464,13 @@ void Adjoint( const Matrix<T>& A, Matrix<T>& B )
     Transpose( A, B, true );
 }
 
+template<typename T>
+void Adjoint( Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    Transpose( A, true );
+}
+
 template<typename T>
 void Adjoint( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
@@ -337,6 +504,8 @@ void Adjoint
   EL_EXTERN template void Transpose \
   ( const Matrix<T>& A, Matrix<T>& B, bool conjugate ); \
   EL_EXTERN template void Transpose \
+  ( Matrix<T>& A, bool conjugate ); \
+  EL_EXTERN template void Transpose \
   ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, bool conjugate ); \
   EL_EXTERN template void Transpose \
   ( const BlockMatrix<T>& A, BlockMatrix<T>& B, bool conjugate ); \
@@ -346,6 +515,8 @@ void Adjoint
   EL_EXTERN template void Adjoint \
   ( const Matrix<T>& A, Matrix<T>& B ); \
   EL_EXTERN template void Adjoint \
+  ( Matrix<T>& A ); \
+  EL_EXTERN template void Adjoint \
   ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B ); \
   EL_EXTERN template void Adjoint \
   ( const BlockMatrix<T>& A, BlockMatrix<T>& B ); \
@@ -53,25 +53,26 @@ void TransposeAxpy
           if( mX != nY || nX != mY )
               LogicError("Nonconformal TransposeAxpy");
         )
-        if( nX <= mX )
+        // Traverse the same cache-sized tiles as the local Transpose
+        const Int tileSize = transpose::TileSize<T>();
+        EL_PARALLEL_FOR_COLLAPSE2_GRAIN(mX*nX)
+        for( Int j=0; j<nX; j+=tileSize )
         {
-            if( conjugate )
-                for( Int j=0; j<nX; ++j )
-                    for( Int i=0; i<mX; ++i )
-                        YBuf[j+i*ldY] += alpha*Conj(XBuf[i+j*ldX]);
-            else
-                for( Int j=0; j<nX; ++j )
-                    blas::Axpy( mX, alpha, &XBuf[j*ldX], 1, &YBuf[j], ldY );
-        }
-        else
-        {
-            if( conjugate )
-                for( Int i=0; i<mX; ++i )
-                    for( Int j=0; j<nX; ++j )
-                        YBuf[j+i*ldY] += alpha*Conj(XBuf[i+j*ldX]);
-            else
-                for( Int i=0; i<mX; ++i )
-                    blas::Axpy( nX, alpha, &XBuf[i], ldX, &YBuf[i*ldY], 1 );
+            for( Int i=0; i<mX; i+=tileSize )
+            {
+                const Int mb = Min( tileSize, mX-i );
+                const Int nb = Min( tileSize, nX-j );
+                const T* XTile = &XBuf[i+j*ldX];
+                      T* YTile = &YBuf[j+i*ldY];
+                if( conjugate )
+                    for( Int jb=0; jb<nb; ++jb )
+                        for( Int ib=0; ib<mb; ++ib )
+                            YTile[jb+ib*ldY] += alpha*Conj(XTile[ib+jb*ldX]);
+                else
+                    for( Int jb=0; jb<nb; ++jb )
+                        for( Int ib=0; ib<mb; ++ib )
+                            YTile[jb+ib*ldY] += alpha*XTile[ib+jb*ldX];
+            }
         }
     }
 }
@@ -35,7 +35,6 @@ void UpdateSubmatrix
     }
 }
 
-// TODO(poulson): Adopt the same approach as GetSubmatrix
 template<typename T>
 void UpdateSubmatrix
 (       AbstractDistMatrix<T>& A,
@@ -45,24 +44,12 @@ void UpdateSubmatrix
   const AbstractDistMatrix<T>& ASub )
 {
     EL_DEBUG_CSE
-    // TODO(poulson): Intelligently pick the redundant rank to pack from?
-    if( ASub.RedundantRank() == 0 )
-    {
-        const Int ASubLocalHeight = ASub.LocalHeight();
-        const Int ASubLocalWidth = ASub.LocalWidth();
-        auto& ASubLoc = ASub.LockedMatrix();
-        A.Reserve( ASubLocalHeight*ASubLocalWidth );
-        for( Int jLoc=0; jLoc<ASubLocalWidth; ++jLoc )
-        {
-            const Int jSub = ASub.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<ASubLocalHeight; ++iLoc )
-            {
-                const Int iSub = ASub.GlobalRow(iLoc);
-                A.QueueUpdate( I[iSub], J[jSub], alpha*ASubLoc(iLoc,jLoc) );
-            }
-        }
-    }
-    A.ProcessQueues();
+    if( A.Grid() != ASub.Grid() )
+        LogicError("Grids of A and ASub must match");
+    submatrix::Transfer
+    ( ASub, submatrix::RangeToVector(IR(0,ASub.Height())),
+            submatrix::RangeToVector(IR(0,ASub.Width())),
+      A, I, J, alpha, true );
 }
 
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
@@ -44,6 +44,27 @@ void Zero( AbstractDistMatrix<T>& A )
     Zero( A.Matrix() );
 }
 
+template<typename T>
+void Zero( SparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    A.Resize( A.Height(), A.Width() );
+}
+
+template<typename T>
+void Zero( DistSparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    A.Resize( A.Height(), A.Width() );
+}
+
+template<typename T>
+void Zero( DistMultiVec<T>& A )
+{
+    EL_DEBUG_CSE
+    Zero( A.Matrix() );
+}
+
 
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
@@ -53,7 +74,10 @@ void Zero( AbstractDistMatrix<T>& A )
 
 #define PROTO(T) \
   EL_EXTERN template void Zero( Matrix<T>& A ); \
-  EL_EXTERN template void Zero( AbstractDistMatrix<T>& A );
+  EL_EXTERN template void Zero( AbstractDistMatrix<T>& A ); \
+  EL_EXTERN template void Zero( SparseMatrix<T>& A ); \
+  EL_EXTERN template void Zero( DistSparseMatrix<T>& A ); \
+  EL_EXTERN template void Zero( DistMultiVec<T>& A );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -23,6 +23,9 @@ namespace El {
 // =======
 template<typename Ring>
 void Adjoint( const Matrix<Ring>& A, Matrix<Ring>& B );
+// In-place; square matrices avoid any workspace
+template<typename Ring>
+void Adjoint( Matrix<Ring>& A );
 template<typename Ring>
 void Adjoint( const ElementalMatrix<Ring>& A, ElementalMatrix<Ring>& B );
 template<typename Ring>
@@ -85,6 +88,23 @@ void Axpy
 ( Ring2 alpha, const AbstractDistMatrix<Ring1>& X,
                      AbstractDistMatrix<Ring1>& Y );
 
+// Separated complex data
+// ^^^^^^^^^^^^^^^^^^^^^^
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Axpy
+( Complex<Real> alpha,
+  const Matrix<Real>& XReal, const Matrix<Real>& XImag,
+        Matrix<Real>& YReal,       Matrix<Real>& YImag );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Axpy
+( Complex<Real> alpha,
+  const AbstractDistMatrix<Real>& XReal,
+  const AbstractDistMatrix<Real>& XImag,
+        AbstractDistMatrix<Real>& YReal,
+        AbstractDistMatrix<Real>& YImag );
+
 namespace axpy {
 namespace util {
 
@@ -157,6 +177,88 @@ void SendRecv
 template<typename T>
 void Recv( Matrix<T>& A, mpi::Comm comm, int source );
 
+// Pipelined communication
+// =======================
+// Variants of Send, Recv, SendRecv, and Broadcast which split the (packed)
+// local data into messages of at most 'segmentSize' entries. The
+// point-to-point variants are nonblocking and return a handle which must be
+// completed (via Wait or a successful Test) before the matrices are accessed
+// and before they are destroyed; received segments are unpacked in order as
+// they complete. PipelinedBroadcast passes the segments down a chain of
+// processes starting at the root, so that the cost of replicating a large
+// matrix approaches that of a single point-to-point transfer instead of
+// growing with the logarithm of the communicator size.
+
+struct PipelineCtrl
+{
+    // The maximum number of entries per message
+    Int segmentSize=Int(1)<<20;
+};
+
+template<typename T>
+class TransferFuture
+{
+public:
+    TransferFuture() { }
+    TransferFuture( TransferFuture<T>&& future );
+    TransferFuture<T>& operator=( TransferFuture<T>&& future );
+    ~TransferFuture();
+
+    // Returns true (after unpacking the result) if the communication finished
+    bool Test();
+    void Wait();
+    bool Pending() const EL_NO_EXCEPT { return next_ < requests_.size(); }
+
+    // For use by the pipelined routines
+    // ---------------------------------
+    T* Reserve( Int size );
+    // Start 'numRequests' more requests, the s'th of which is posted by
+    // post(s,request) and, once complete, followed by finish(s) (if given)
+    void Post
+    ( Int numRequests,
+      function<void(Int,mpi::Request<T>&)> post,
+      function<void(Int)> finish=nullptr );
+
+private:
+    size_t next_=0;
+    vector<mpi::Request<T>> requests_;
+    vector<function<void()>> finishes_;
+    vector<vector<T>> buffers_;
+
+    void Clear();
+};
+
+template<typename T>
+TransferFuture<T> SendAsync
+( const Matrix<T>& A, mpi::Comm comm, int destination,
+  const PipelineCtrl& ctrl=PipelineCtrl() );
+// As with Recv, 'A' must be of the correct size on entry
+template<typename T>
+TransferFuture<T> RecvAsync
+( Matrix<T>& A, mpi::Comm comm, int source,
+  const PipelineCtrl& ctrl=PipelineCtrl() );
+template<typename T>
+TransferFuture<T> SendRecvAsync
+( const Matrix<T>& A, Matrix<T>& B, mpi::Comm comm,
+  int sendRank, int recvRank, const PipelineCtrl& ctrl=PipelineCtrl() );
+
+template<typename T>
+void PipelinedBroadcast
+( Matrix<T>& A, mpi::Comm comm, int rank=0,
+  const PipelineCtrl& ctrl=PipelineCtrl() );
+template<typename T>
+void PipelinedBroadcast
+( AbstractDistMatrix<T>& A, mpi::Comm comm, int rank=0,
+  const PipelineCtrl& ctrl=PipelineCtrl() );
+
+// The contractions of AxpyContract and Contract reduce-scatter their packed
+// contributions in chunks of at most (roughly) 'segmentSize' entries,
+// overlapping the packing and accumulation of each chunk with the reduction
+// of its neighbors, once the packed data would exceed a single segment.
+// The setting must be consistent across all processes.
+void SetContractPipelineCtrl( const PipelineCtrl& ctrl );
+const PipelineCtrl& ContractPipelineCtrl() EL_NO_EXCEPT;
+
 // Column norms
 // ============
 
@@ -172,6 +274,9 @@ void ColumnTwoNorms
 template<typename Field,Dist U,Dist V,DistWrap W>
 void ColumnTwoNorms
 ( const DistMatrix<Field,U,V,W>& X, DistMatrix<Base<Field>,V,STAR,W>& norms );
+template<typename Field>
+void ColumnTwoNorms
+( const DistMultiVec<Field>& X, Matrix<Base<Field>>& norms );
 
 // Separated complex data
 // ^^^^^^^^^^^^^^^^^^^^^^
@@ -196,6 +301,33 @@ void ColumnMaxNorms
 template<typename Ring,Dist U,Dist V,DistWrap W>
 void ColumnMaxNorms
 ( const DistMatrix<Ring,U,V,W>& X, DistMatrix<Base<Ring>,V,STAR,W>& norms );
+template<typename Ring>
+void ColumnMaxNorms
+( const DistMultiVec<Ring>& X, Matrix<Base<Ring>>& norms );
+
+// Fused column statistics
+// -----------------------
+// The two-norm, maximum absolute value, and sum of each column in a single
+// pass over the local data, followed (for distributed matrices) by one MAX
+// and one SUM reduction for all three statistics
+template<typename Field>
+void ColumnStats
+( const Matrix<Field>& X,
+        Matrix<Base<Field>>& twoNorms,
+        Matrix<Base<Field>>& maxAbs,
+        Matrix<Field>& sums );
+template<typename Field,Dist U,Dist V,DistWrap W>
+void ColumnStats
+( const DistMatrix<Field,U,V,W>& X,
+        DistMatrix<Base<Field>,V,STAR,W>& twoNorms,
+        DistMatrix<Base<Field>,V,STAR,W>& maxAbs,
+        DistMatrix<Field,V,STAR,W>& sums );
+template<typename Field>
+void ColumnStats
+( const DistMultiVec<Field>& X,
+        Matrix<Base<Field>>& twoNorms,
+        Matrix<Base<Field>>& maxAbs,
+        Matrix<Field>& sums );
 
 // Column minimum absolute values
 // ==============================
@@ -244,6 +376,21 @@ template<typename Ring,Dist U,Dist V>
 void RowMaxNorms
 ( const DistMatrix<Ring,U,V>& X, DistMatrix<Base<Ring>,U,STAR>& norms );
 
+// Fused row statistics
+// --------------------
+template<typename Field>
+void RowStats
+( const Matrix<Field>& X,
+        Matrix<Base<Field>>& twoNorms,
+        Matrix<Base<Field>>& maxAbs,
+        Matrix<Field>& sums );
+template<typename Field,Dist U,Dist V>
+void RowStats
+( const DistMatrix<Field,U,V>& X,
+        DistMatrix<Base<Field>,U,STAR>& twoNorms,
+        DistMatrix<Base<Field>,U,STAR>& maxAbs,
+        DistMatrix<Field,U,STAR>& sums );
+
 // Row minimum absolute values
 // ===========================
 // NOTE: While this is not a norm, it is often colloquially referred to as the
@@ -295,6 +442,55 @@ void VCat
   const AbstractDistMatrix<T>& B,
         AbstractDistMatrix<T>& C );
 
+// Block-composite views
+// ---------------------
+// A CompositeMatrix refers to (but does not own) a grid of distributed
+// matrices over a common process grid, e.g., the blocks of the Hamiltonian
+// | A^H, L; K, -A |, and stands for their concatenation without assembling
+// it. Blocks which are never set are zero, but each block row and block
+// column must have at least one block set. Copy assembles a composite with a
+// single redistribution per block (directly into the corresponding submatrix
+// of the target), and Gemm multiplies by one block by block. The blocks must
+// outlive the composite.
+template<typename T>
+class CompositeMatrix
+{
+public:
+    CompositeMatrix( Int numBlockRows, Int numBlockCols );
+
+    void SetBlock( Int i, Int j, const AbstractDistMatrix<T>& A );
+    // Returns nullptr for a zero block
+    const AbstractDistMatrix<T>* Block( Int i, Int j ) const EL_NO_EXCEPT
+    { return blocks_[i+j*numBlockRows_]; }
+
+    Int NumBlockRows() const EL_NO_EXCEPT { return numBlockRows_; }
+    Int NumBlockCols() const EL_NO_EXCEPT { return numBlockCols_; }
+    Int BlockHeight( Int i ) const;
+    Int BlockWidth( Int j ) const;
+    // The first row (column) of block row i (block column j)
+    Int RowOffset( Int i ) const;
+    Int ColOffset( Int j ) const;
+    Int Height() const { return RowOffset( numBlockRows_ ); }
+    Int Width() const { return ColOffset( numBlockCols_ ); }
+    const El::Grid& Grid() const;
+
+private:
+    Int numBlockRows_, numBlockCols_;
+    vector<const AbstractDistMatrix<T>*> blocks_;
+    vector<Int> heights_, widths_;
+};
+
+// The views [A, B] and [A; B]
+template<typename T>
+CompositeMatrix<T>
+HCatView( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B );
+template<typename T>
+CompositeMatrix<T>
+VCatView( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B );
+
+template<typename T>
+void Copy( const CompositeMatrix<T>& A, AbstractDistMatrix<T>& B );
+
 // Conjugate
 // =========
 template<typename RealRing>
@@ -339,6 +535,9 @@ void Contract( const BlockMatrix<T>& A, BlockMatrix<T>& B );
 
 template<typename T>
 void Copy( const Matrix<T>& A, Matrix<T>& B );
+// Steal the buffer of A when both matrices are (non-fixed-size) owners
+template<typename T>
+void Copy( Matrix<T>&& A, Matrix<T>& B );
 template<typename S,typename T,
          typename=EnableIf<CanCast<S,T>>>
 void Copy( const Matrix<S>& A, Matrix<T>& B );
@@ -357,6 +556,21 @@ template<typename S,typename T,
          typename=EnableIf<CanCast<S,T>>>
 void Copy( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B );
 
+template<typename S,typename T,
+         typename=EnableIf<CanCast<S,T>>>
+void Copy( const SparseMatrix<S>& A, SparseMatrix<T>& B );
+template<typename S,typename T,
+         typename=EnableIf<CanCast<S,T>>>
+void Copy( const DistSparseMatrix<S>& A, DistSparseMatrix<T>& B );
+template<typename S,typename T,
+         typename=EnableIf<CanCast<S,T>>>
+void Copy( const DistMultiVec<S>& A, DistMultiVec<T>& B );
+
+template<typename T>
+void Copy( const DistMultiVec<T>& A, AbstractDistMatrix<T>& B );
+template<typename T>
+void Copy( const AbstractDistMatrix<T>& A, DistMultiVec<T>& B );
+
 template<typename T>
 void CopyFromRoot
 ( const Matrix<T>& A, DistMatrix<T,CIRC,CIRC>& B,
@@ -373,6 +587,51 @@ template<typename T>
 void CopyFromNonRoot( DistMatrix<T,CIRC,CIRC,BLOCK>& B,
   bool includingViewers=false );
 
+// CopyAsync
+// =========
+// Nonblocking variants of Copy and Contract which return a handle that must be
+// completed (via Wait or a successful Test) before the target matrix is
+// accessed and before it is destroyed. Aligned redistributions of the forms
+// (U,V) -> (U,Collect(V)), (U,V) -> (Collect(U),V), [MC,MR] -> [VC,* ], and
+// [MR,MC] -> [VR,* ], as well as the contractions (U,Collect(V)) -> (U,V) and
+// (Collect(U),V) -> (U,V), are overlapped with subsequent computation; all
+// other redistributions complete before returning.
+
+template<typename T>
+class RedistFuture
+{
+public:
+    RedistFuture() { }
+    RedistFuture( RedistFuture<T>&& future );
+    RedistFuture<T>& operator=( RedistFuture<T>&& future );
+    ~RedistFuture();
+
+    // Returns true (after unpacking the result) if the communication finished
+    bool Test();
+    void Wait();
+    bool Pending() const EL_NO_EXCEPT { return pending_; }
+
+    // For use by the nonblocking redistribution routines
+    // --------------------------------------------------
+    T* Reserve( Int size, bool zero=false );
+    mpi::Request<T>& Request() EL_NO_EXCEPT { return request_; }
+    void Start( function<void(const T*)> finish );
+
+private:
+    bool pending_=false;
+    mpi::Request<T> request_;
+    vector<T> buffer_;
+    function<void(const T*)> finish_;
+
+    void Finish();
+};
+
+template<typename T>
+RedistFuture<T> CopyAsync( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+template<typename T>
+RedistFuture<T>
+ContractAsync( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+
 
 namespace copy {
 namespace util {
@@ -498,6 +757,11 @@ void DiagonalScale
 ( LeftOrRight side, Orientation orientation,
   const AbstractDistMatrix<TDiag>& d, AbstractDistMatrix<T>& A );
 
+template<typename TDiag,typename T>
+void DiagonalScale
+( LeftOrRight side, Orientation orientation,
+  const DistMultiVec<TDiag>& d, DistMultiVec<T>& X );
+
 // DiagonalScaleTrapezoid
 // ======================
 template<typename TDiag,typename T>
@@ -551,6 +815,13 @@ void DiagonalSolve
         AbstractDistMatrix<Field>& A,
   bool checkIfSingular=true );
 
+template<typename FieldDiag,typename Field>
+void DiagonalSolve
+( LeftOrRight side, Orientation orientation,
+  const DistMultiVec<FieldDiag>& d,
+        DistMultiVec<Field>& X,
+  bool checkIfSingular=true );
+
 // Dot
 // ===
 template<typename T>
@@ -572,6 +843,12 @@ void EntrywiseFill( Matrix<T>& A, function<T(void)> func );
 template<typename T>
 void EntrywiseFill( AbstractDistMatrix<T>& A, function<T(void)> func );
 
+// Inline the functor rather than calling through a std::function
+template<typename T,class Func>
+void EntrywiseFill( Matrix<T>& A, Func func );
+template<typename T,class Func>
+void EntrywiseFill( AbstractDistMatrix<T>& A, Func func );
+
 // EntrywiseMap
 // ============
 template<typename T>
@@ -587,6 +864,14 @@ void EntrywiseMap
 ( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B,
   function<T(const S&)> func );
 
+// Only map the 'uplo' triangle of a Hermitian (or symmetric) matrix
+template<typename T>
+void HermitianEntrywiseMap
+( UpperOrLower uplo, Matrix<T>& A, function<T(const T&)> func );
+template<typename T>
+void HermitianEntrywiseMap
+( UpperOrLower uplo, AbstractDistMatrix<T>& A, function<T(const T&)> func );
+
 // Fill
 // ====
 template<typename T>
@@ -749,6 +1034,37 @@ void Hadamard
   const AbstractDistMatrix<T>& B,
         AbstractDistMatrix<T>& C );
 
+// Only form the 'uplo' triangle of the product of Hermitian (or symmetric)
+// matrices
+template<typename T>
+void HermitianHadamard
+( UpperOrLower uplo,
+  const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C );
+template<typename T>
+void HermitianHadamard
+( UpperOrLower uplo,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        AbstractDistMatrix<T>& C );
+
+// Separated complex data
+// ^^^^^^^^^^^^^^^^^^^^^^
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Hadamard
+( const Matrix<Real>& AReal, const Matrix<Real>& AImag,
+  const Matrix<Real>& BReal, const Matrix<Real>& BImag,
+        Matrix<Real>& CReal,       Matrix<Real>& CImag );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Hadamard
+( const AbstractDistMatrix<Real>& AReal,
+  const AbstractDistMatrix<Real>& AImag,
+  const AbstractDistMatrix<Real>& BReal,
+  const AbstractDistMatrix<Real>& BImag,
+        AbstractDistMatrix<Real>& CReal,
+        AbstractDistMatrix<Real>& CImag );
+
 // HilbertSchmidt
 // ==============
 template<typename T>
@@ -757,6 +1073,21 @@ template<typename T>
 T HilbertSchmidt
 ( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& C );
 
+// Separated complex data
+// ^^^^^^^^^^^^^^^^^^^^^^
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Complex<Real> HilbertSchmidt
+( const Matrix<Real>& AReal, const Matrix<Real>& AImag,
+  const Matrix<Real>& BReal, const Matrix<Real>& BImag );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Complex<Real> HilbertSchmidt
+( const AbstractDistMatrix<Real>& AReal,
+  const AbstractDistMatrix<Real>& AImag,
+  const AbstractDistMatrix<Real>& BReal,
+  const AbstractDistMatrix<Real>& BImag );
+
 // Imaginary part
 // ==============
 template<typename T>
@@ -775,6 +1106,20 @@ template<typename T>
 void IndexDependentFill
 ( AbstractDistMatrix<T>& A, function<T(Int,Int)> func );
 
+// Inline the functor rather than calling through a std::function
+template<typename T,class Func>
+void IndexDependentFill( Matrix<T>& A, const Func& func );
+template<typename T,class Func>
+void IndexDependentFill( AbstractDistMatrix<T>& A, const Func& func );
+
+// Fill each (chunk of a) local column with a single call
+// func(j,iBeg,iStride,count,buf), which sets buf[k] := A(iBeg+k*iStride,j)
+template<typename T,class ColumnFunc>
+void IndexDependentColumnFill( Matrix<T>& A, const ColumnFunc& func );
+template<typename T,class ColumnFunc>
+void IndexDependentColumnFill
+( AbstractDistMatrix<T>& A, const ColumnFunc& func );
+
 // IndexDependentMap
 // =================
 template<typename T>
@@ -788,6 +1133,14 @@ void IndexDependentMap
 ( const Matrix<S>& A,
         Matrix<T>& B,
         function<T(Int,Int,const S&)> func );
+
+// Inline the functor rather than calling through a std::function
+template<typename T,class Func>
+void IndexDependentMap( Matrix<T>& A, const Func& func );
+template<typename T,class Func>
+void IndexDependentMap( AbstractDistMatrix<T>& A, const Func& func );
+template<typename S,typename T,class Func>
+void IndexDependentMap( const Matrix<S>& A, Matrix<T>& B, const Func& func );
 template<typename S,typename T,Dist U,Dist V,DistWrap wrap>
 void IndexDependentMap
 ( const DistMatrix<S,U,V,wrap>& A,
@@ -818,6 +1171,10 @@ template<typename T>
 void MakeHermitian( UpperOrLower uplo, Matrix<T>& A );
 template<typename T>
 void MakeHermitian( UpperOrLower uplo, ElementalMatrix<T>& A );
+template<typename T>
+void MakeHermitian( UpperOrLower uplo, SparseMatrix<T>& A );
+template<typename T>
+void MakeHermitian( UpperOrLower uplo, DistSparseMatrix<T>& A );
 
 // MakeDiagonalReal
 // ================
@@ -851,6 +1208,12 @@ void MakeSymmetric( UpperOrLower uplo, Matrix<T>& A, bool conjugate=false );
 template<typename T>
 void MakeSymmetric
 ( UpperOrLower uplo, ElementalMatrix<T>& A, bool conjugate=false );
+template<typename T>
+void MakeSymmetric
+( UpperOrLower uplo, SparseMatrix<T>& A, bool conjugate=false );
+template<typename T>
+void MakeSymmetric
+( UpperOrLower uplo, DistSparseMatrix<T>& A, bool conjugate=false );
 
 // MakeTrapezoidal
 // ===============
@@ -1127,6 +1490,20 @@ void RealPart
 ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<Base<T>>& AReal );
 /* TODO(poulson): Sparse versions */
 
+// Regrid
+// ======
+// Redistribute A into B, which may have any distribution over any grid whose
+// viewing communicator is congruent to that of A's grid (e.g., to shrink or
+// grow the set of processes used by a running job). Entries are only moved
+// if their new owner does not already hold a copy, each block of columns is
+// exchanged with non-blocking point-to-point messages while the next block
+// is packed, and no per-entry metadata is communicated.
+template<typename T>
+void Regrid( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+// Migrate A (which may not be a view) onto the given grid in-place
+template<typename T>
+void Regrid( AbstractDistMatrix<T>& A, const Grid& grid );
+
 // Reshape
 // =======
 template<typename T>
@@ -1141,6 +1518,49 @@ template<typename T>
 DistMatrix<T> Reshape
 ( Int m, Int n, const AbstractDistMatrix<T>& A );
 
+template<typename T>
+void Reshape
+( Int m, Int n, const DistMultiVec<T>& A, AbstractDistMatrix<T>& B );
+template<typename T>
+void Reshape
+( Int m, Int n, const AbstractDistMatrix<T>& A, DistMultiVec<T>& B );
+
+// TopKAbs
+// =======
+// Return the k entries of largest (or, if 'largest' is false, smallest)
+// absolute value, sorted from best to worst with ties broken by the smaller
+// column-major index. Fewer than k entries are returned if the matrix is
+// too small.
+template<typename Ring>
+vector<Entry<Base<Ring>>>
+TopKAbs( const Matrix<Ring>& A, Int k, bool largest=true );
+template<typename Ring>
+vector<Entry<Base<Ring>>>
+TopKAbs( const AbstractDistMatrix<Ring>& A, Int k, bool largest=true );
+
+// The k x n results hold the selections for each column, with row indices
+// of -1 (and values of zero) padding columns of height less than k
+template<typename Ring>
+void ColumnTopKAbs
+( const Matrix<Ring>& A, Int k,
+  Matrix<Int>& rowInds, Matrix<Base<Ring>>& values, bool largest=true );
+template<typename Ring,Dist U,Dist V>
+void ColumnTopKAbs
+( const DistMatrix<Ring,U,V>& A, Int k,
+  DistMatrix<Int,STAR,V>& rowInds,
+  DistMatrix<Base<Ring>,STAR,V>& values, bool largest=true );
+
+// The m x k results hold the selections for each row
+template<typename Ring>
+void RowTopKAbs
+( const Matrix<Ring>& A, Int k,
+  Matrix<Int>& colInds, Matrix<Base<Ring>>& values, bool largest=true );
+template<typename Ring,Dist U,Dist V>
+void RowTopKAbs
+( const DistMatrix<Ring,U,V>& A, Int k,
+  DistMatrix<Int,U,STAR>& colInds,
+  DistMatrix<Base<Ring>,U,STAR>& values, bool largest=true );
+
 // Transform2x2
 // ============
 
@@ -1188,6 +1608,10 @@ template<typename T>
 void Transform2x2Rows
 ( const AbstractDistMatrix<T>& G,
         AbstractDistMatrix<T>& A, Int i1, Int i2 );
+template<typename T>
+void Transform2x2Rows
+( const SmallMatrix<T,2,2>& G,
+        Matrix<T>& A, Int i1, Int i2 );
 
 // A(:,[j1,j2]) := A(:,[j1,j2]) G, where G is 2x2
 // ----------------------------------------------
@@ -1203,6 +1627,10 @@ template<typename T>
 void Transform2x2Cols
 ( const AbstractDistMatrix<T>& G,
         AbstractDistMatrix<T>& A, Int j1, Int j2 );
+template<typename T>
+void Transform2x2Cols
+( const SmallMatrix<T,2,2>& G,
+        Matrix<T>& A, Int j1, Int j2 );
 
 // TODO(poulson): SymmetricTransform2x2?
 
@@ -1397,6 +1825,9 @@ void HermitianSwap
 template<typename Field>
 void Symmetric2x2Inv
 ( UpperOrLower uplo, Matrix<Field>& D, bool conjugate=false );
+template<typename Field>
+void Symmetric2x2Inv
+( UpperOrLower uplo, SmallMatrix<Field,2,2>& D, bool conjugate=false );
 
 // Shift
 // =====
@@ -1412,6 +1843,36 @@ void ShiftDiagonal( Matrix<T>& A, S alpha, Int offset=0 );
 template<typename T,typename S>
 void ShiftDiagonal( AbstractDistMatrix<T>& A, S alpha, Int offset=0 );
 
+// SplitComplex
+// ============
+// Convert between the usual (interleaved) storage of complex matrices and
+// separate matrices for the real and imaginary parts. Several kernels have
+// overloads for the separated form (see Axpy, Hadamard, HilbertSchmidt,
+// Scale, and ColumnTwoNorms); conjugation, taking the real or imaginary part,
+// and MakeReal only involve one of the two parts. The distributed versions
+// align the outputs with the input.
+template<typename Real>
+void SplitComplex
+( const Matrix<Complex<Real>>& A,
+        Matrix<Real>& AReal,
+        Matrix<Real>& AImag );
+template<typename Real>
+void SplitComplex
+( const AbstractDistMatrix<Complex<Real>>& A,
+        AbstractDistMatrix<Real>& AReal,
+        AbstractDistMatrix<Real>& AImag );
+
+template<typename Real>
+void MergeComplex
+( const Matrix<Real>& AReal,
+  const Matrix<Real>& AImag,
+        Matrix<Complex<Real>>& A );
+template<typename Real>
+void MergeComplex
+( const AbstractDistMatrix<Real>& AReal,
+  const AbstractDistMatrix<Real>& AImag,
+        AbstractDistMatrix<Complex<Real>>& A );
+
 // Transpose
 // =========
 template<typename T>
@@ -1419,6 +1880,9 @@ void Transpose
 ( const Matrix<T>& A,
         Matrix<T>& B,
   bool conjugate=false );
+// In-place; square matrices avoid any workspace
+template<typename T>
+void Transpose( Matrix<T>& A, bool conjugate=false );
 template<typename T>
 void Transpose
 ( const ElementalMatrix<T>& A,
@@ -1526,6 +1990,12 @@ template<typename T>
 void Zero( Matrix<T>& A );
 template<typename T>
 void Zero( AbstractDistMatrix<T>& A );
+template<typename T>
+void Zero( SparseMatrix<T>& A );
+template<typename T>
+void Zero( DistSparseMatrix<T>& A );
+template<typename T>
+void Zero( DistMultiVec<T>& A );
 
 // Givens rotations
 // ================
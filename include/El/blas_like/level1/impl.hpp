@@ -20,12 +20,14 @@
 #include <El/blas_like/level1/ConjugateSubmatrix.hpp>
 #include <El/blas_like/level1/Contract.hpp>
 #include <El/blas_like/level1/Copy.hpp>
+#include <El/blas_like/level1/CopyAsync.hpp>
 #include <El/blas_like/level1/DiagonalScale.hpp>
 #include <El/blas_like/level1/DiagonalScaleTrapezoid.hpp>
 #include <El/blas_like/level1/DiagonalSolve.hpp>
 #include <El/blas_like/level1/Dot.hpp>
 #include <El/blas_like/level1/EntrywiseFill.hpp>
 #include <El/blas_like/level1/EntrywiseMap.hpp>
+#include <El/blas_like/level1/Expression.hpp>
 #include <El/blas_like/level1/Fill.hpp>
 #include <El/blas_like/level1/FillDiagonal.hpp>
 #include <El/blas_like/level1/GetDiagonal.hpp>
@@ -43,10 +45,12 @@
 #include <El/blas_like/level1/MakeSymmetric.hpp>
 #include <El/blas_like/level1/MakeTrapezoidal.hpp>
 #include <El/blas_like/level1/Nrm2.hpp>
+#include <El/blas_like/level1/Pipelined.hpp>
 #include <El/blas_like/level1/QuasiDiagonalScale.hpp>
 #include <El/blas_like/level1/QuasiDiagonalSolve.hpp>
 #include <El/blas_like/level1/RealPart.hpp>
 #include <El/blas_like/level1/Recv.hpp>
+#include <El/blas_like/level1/Regrid.hpp>
 #include <El/blas_like/level1/Reshape.hpp>
 #include <El/blas_like/level1/Rotate.hpp>
 #include <El/blas_like/level1/Round.hpp>
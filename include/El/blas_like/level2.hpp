@@ -177,6 +177,24 @@ void LocalRowAccumulate
         DistMatrix<T,STAR,MR>& z_STAR_MR,
   bool conjugate=false, const SymvCtrl<T>& ctrl=SymvCtrl<T>() );
 
+// y += z[MC,* ] + z[MR,* ] (or z[* ,MC] + z[* ,MR]), where each contribution
+// is a partial sum over a team of processes (as formed by the local
+// accumulations above). On a square grid, the [MR,* ] ([* ,MC]) contribution
+// is first added onto the other one by a pairwise exchange with the process
+// with transposed grid coordinates so that a single reduce-scatter suffices;
+// the [MC,* ] ([* ,MR]) contribution is overwritten in the process. Any
+// number of columns (rows) is supported so that Symm and Hemm may share it.
+template<typename T>
+void FusedColContract
+(       DistMatrix<T,MC,STAR>& z_MC_STAR,
+  const DistMatrix<T,MR,STAR>& z_MR_STAR,
+        DistMatrix<T>& y );
+template<typename T>
+void FusedRowContract
+( const DistMatrix<T,STAR,MC>& z_STAR_MC,
+        DistMatrix<T,STAR,MR>& z_STAR_MR,
+        DistMatrix<T>& y );
+
 } // namespace symv
 
 // Syr
@@ -278,6 +296,53 @@ void ApplyGivensSequence
   const Matrix<Base<F>>& sList,
   Matrix<F>& A );
 
+// A queue of variable Givens sequences (with real sines) to be applied from
+// the right to a matrix, as would
+//
+//   ApplyGivensSequence
+//   ( RIGHT, VARIABLE_GIVENS_SEQUENCE, direction, cList, sList,
+//     A(ALL,IR(offset,offset+cList.Height()+1)) ),
+//
+// e.g., the sweeps of a tridiagonal or bidiagonal QR algorithm. Rather than
+// streaming all of A through the cache for each sequence, the rows of A are
+// split into panels which fit in cache, and each panel receives every queued
+// sequence before moving on to the next (cf. Van Zee et al., "Restructuring
+// the tridiagonal and bidiagonal QR algorithms for performance"). The rows
+// are independent, so the panels are also divided among threads.
+//
+// The queue is flushed once 'maxQueued' sequences are pending; A must not be
+// otherwise accessed until Flush is called.
+template<typename F>
+class GivensSequenceQueue
+{
+public:
+    explicit GivensSequenceQueue( Matrix<F>& A, Int maxQueued=32 );
+
+    void Push
+    ( ForwardOrBackward direction, Int offset,
+      const Matrix<Base<F>>& cList,
+      const Matrix<Base<F>>& sList );
+    // Queue the rotation of columns j and j+1 which blas::Rot would apply
+    void PushRotation( Int j, const Base<F>& c, const Base<F>& s );
+
+    void Flush();
+    Int NumQueued() const EL_NO_EXCEPT { return sequences_.size(); }
+
+private:
+    struct Sequence
+    {
+        ForwardOrBackward direction;
+        Int offset;
+        Int length;
+        Int start;
+    };
+
+    Matrix<F>& A_;
+    Int maxQueued_;
+    vector<Sequence> sequences_;
+    vector<Base<F>> cList_, sList_;
+};
+
 } // namespace El
 
 #endif // ifndef EL_BLAS2_HPP
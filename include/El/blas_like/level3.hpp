@@ -17,6 +17,12 @@ template<typename T> Int LocalTrrkBlocksize();
 template<typename T> void SetLocalTrr2kBlocksize( Int blocksize );
 template<typename T> Int LocalTrr2kBlocksize();
 
+// For scalar types without BLAS/LAPACK support (e.g., DoubleDouble and
+// BigFloat), the sequential Gemm, Trsm, Cholesky and LU recursively split
+// their operands until each dimension is at most this cutoff
+template<typename T> void SetLocalRecursionCutoff( Int cutoff );
+template<typename T> Int LocalRecursionCutoff();
+
 // Gemm
 // ====
 namespace GemmAlgorithmNS {
@@ -26,11 +32,90 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_SUMMA_A_PIPELINED,
+  GEMM_SUMMA_B_PIPELINED,
+  GEMM_SUMMA_C_PIPELINED,
+  GEMM_25D,
+  GEMM_3D
 };
 }
 using namespace GemmAlgorithmNS;
 
+// The number of iterations whose communication is overlapped with the local
+// updates of the current iteration in the pipelined SUMMA variants
+void SetGemmLookahead( Int lookahead );
+Int GemmLookahead();
+
+// The number of bytes per process which GEMM_25D may use for replicating
+// the operands across layers. A limit of zero (the default) requests that the
+// available memory of each node be queried and divided among its processes.
+void SetGemmMemoryLimit( size_t numBytes );
+size_t GemmMemoryLimit();
+
+// A latency-bandwidth-flop model of the machine used to choose between the
+// SUMMA variants when GEMM_DEFAULT is requested. Until the model has been
+// calibrated (or loaded), a heuristic based upon the matrix shape is used.
+struct GemmCostModel
+{
+    double latency=0;          // seconds per message
+    double inverseBandwidth=0; // seconds per byte
+    double flopTime=0;         // seconds per local flop
+    bool calibrated=false;
+};
+
+// Time a few collectives and a local Gemm over the given grid. This is
+// collective over the grid and is meant to be called once per job.
+void CalibrateGemmCostModel( const Grid& grid=Grid::Default() );
+void SetGemmCostModel( const GemmCostModel& model );
+const GemmCostModel& GetGemmCostModel();
+void SaveGemmCostModel( const string& filename );
+void LoadGemmCostModel( const string& filename );
+
+// The predicted time of a distributed Gemm using the given algorithm
+double GemmCost
+( GemmAlgorithm alg, Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, const Grid& grid, Int entrySize=sizeof(double) );
+
+// The algorithm which GEMM_DEFAULT resolves to. If logging is enabled, each
+// decision (and its predicted cost) is written to the log of each process.
+GemmAlgorithm SelectGemmAlgorithm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, const Grid& grid, Int entrySize=sizeof(double) );
+void SetGemmSelectionLogging( bool log );
+
+// The policy of the sequential Gemm (and hence of LocalGemm).
+// LOCAL_GEMM_STRASSEN applies the Strassen-Winograd recursion (seven
+// half-sized products and fifteen additions per level) while every dimension
+// exceeds StrassenCutoff<T>(), and the standard kernels (vendor BLAS when
+// available) are used at the leaves. This saves roughly 12.5% of the flops
+// per level in exchange for a normwise, rather than componentwise, error
+// bound which grows with the number of levels.
+//
+// LOCAL_GEMM_OZAKI emulates the Gemm of the real extended-precision types
+// (DoubleDouble, QuadDouble, Quad, and BigFloat) with the Ozaki scheme: each
+// operand is split into OzakiNumSlices<T>() slices of double-precision
+// integers (scaled by powers of two) whose pairwise products are computed
+// exactly by the vendor dgemm, and only the accumulation of the products is
+// performed in extended precision. The default of zero slices selects just
+// enough to reproduce the precision of T. Other types, and operands outside
+// of the exponent range of double precision, use the standard kernels.
+namespace LocalGemmAlgorithmNS {
+enum LocalGemmAlgorithm {
+  LOCAL_GEMM_STANDARD,
+  LOCAL_GEMM_STRASSEN,
+  LOCAL_GEMM_OZAKI
+};
+}
+using namespace LocalGemmAlgorithmNS;
+
+void SetLocalGemmAlgorithm( LocalGemmAlgorithm alg );
+LocalGemmAlgorithm GetLocalGemmAlgorithm();
+template<typename T> void SetStrassenCutoff( Int cutoff );
+template<typename T> Int StrassenCutoff();
+template<typename T> void SetOzakiNumSlices( Int numSlices );
+template<typename T> Int OzakiNumSlices();
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -53,6 +138,20 @@ void Gemm
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
 
+// C := alpha op(A) op(B) + beta C, where one of A or B is a block-composite
+// view; the product is accumulated block by block (skipping the zero blocks)
+// so that the composite is never assembled
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const CompositeMatrix<T>& A, const AbstractDistMatrix<T>& B,
+  T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const AbstractDistMatrix<T>& A, const CompositeMatrix<T>& B,
+  T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -66,6 +165,79 @@ void LocalGemm
            const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C );
 
+// Mixed-precision Gemm
+// --------------------
+// A and B are stored, and redistributed, in one of the sixteen-bit formats,
+// which halves their memory and communication relative to single precision,
+// while C = alpha op(A) op(B) + beta C is accumulated in single precision.
+// Only one panel of each input (of width Blocksize()) is widened at a time.
+// These are unavailable in builds without the single-precision instantiations.
+#ifndef HYDROGEN_NO_FLOAT_INSTANTIATION
+void Gemm
+( Orientation orientA, Orientation orientB,
+  float alpha, const Matrix<Half>& A, const Matrix<Half>& B,
+  float beta,        Matrix<float>& C );
+void Gemm
+( Orientation orientA, Orientation orientB,
+  float alpha, const Matrix<BFloat16>& A, const Matrix<BFloat16>& B,
+  float beta,        Matrix<float>& C );
+void Gemm
+( Orientation orientA, Orientation orientB,
+  float alpha, const AbstractDistMatrix<Half>& A,
+               const AbstractDistMatrix<Half>& B,
+  float beta,        AbstractDistMatrix<float>& C );
+void Gemm
+( Orientation orientA, Orientation orientB,
+  float alpha, const AbstractDistMatrix<BFloat16>& A,
+               const AbstractDistMatrix<BFloat16>& B,
+  float beta,        AbstractDistMatrix<float>& C );
+#endif // ifndef HYDROGEN_NO_FLOAT_INSTANTIATION
+
+// Batched small-matrix operations
+// ===============================
+// Each batch consists of 'batchSize' equally-sized column-major matrices,
+// stored either a fixed stride apart or through arrays of pointers. The
+// members of a batch are distributed over the threads and are each handled by
+// a direct kernel (avoiding the per-call overhead of the BLAS wrappers); MKL's
+// strided batch routines are used instead when they are available.
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha,
+  const T* A, Int ALDim, Int AStride,
+  const T* B, Int BLDim, Int BStride,
+  T beta,
+        T* C, Int CLDim, Int CStride,
+  Int batchSize );
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha,
+  const vector<const T*>& A, Int ALDim,
+  const vector<const T*>& B, Int BLDim,
+  T beta,
+  const vector<T*>& C, Int CLDim );
+
+template<typename F>
+void BatchedTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha,
+  const F* A, Int ALDim, Int AStride,
+        F* B, Int BLDim, Int BStride,
+  Int batchSize );
+template<typename F>
+void BatchedTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha,
+  const vector<const F*>& A, Int ALDim,
+  const vector<F*>& B, Int BLDim );
+
 // Hemm
 // ====
 template<typename T>
@@ -100,6 +272,64 @@ void Herk
 ( UpperOrLower uplo, Orientation orientation,
   Base<T> alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& C );
 
+// Update each tile of the triangle of C as an independent task of a TaskGraph
+template<typename F>
+void TiledHerk
+( UpperOrLower uplo, Orientation orientation,
+  Base<F> alpha, const Matrix<F>& A, Base<F> beta, Matrix<F>& C,
+  const TiledCtrl& ctrl=TiledCtrl() );
+
+// GramAccumulator
+// ===============
+// Accumulates the Gramian A^H A and the column sums of a tall matrix A whose
+// rows arrive in blocks (e.g., from disk or the network), without ever
+// forming A. Each process adds the rows it holds into a local n x n partial
+// Gramian with Herk, so that Update performs no communication; the partial
+// sums of all processes are only combined, with a single contraction into
+// the [MC,MR] result, by the (collective) Flush, which the queries call
+// implicitly. Updates may continue after a query, and Reset begins a new
+// pass over the data.
+//
+// Covariance uses the one-pass formula (A^H A - N conj(mu) mu^T) / (N-1),
+// which loses accuracy when the column means dominate the spread of the
+// data; center the rows beforehand (e.g., with the means of a previous pass)
+// when that is a concern.
+template<typename Field>
+class GramAccumulator
+{
+public:
+    GramAccumulator( Int n, const El::Grid& grid=El::Grid::Default() );
+
+    Int Width() const { return n_; }
+    const El::Grid& Grid() const { return gram_.Grid(); }
+
+    // Add a block of rows held entirely by this process
+    void Update( const Matrix<Field>& ABlock );
+    // Add a block of rows distributed over the grid
+    void Update( const DistMatrix<Field,VC,STAR>& ABlock );
+
+    // Combine the partial sums of every process (collective)
+    void Flush();
+    void Reset();
+
+    // The remaining routines are collective and imply a Flush
+    Int NumRows();
+    void Gramian( DistMatrix<Field>& G );
+    void ColumnMeans( Matrix<Field>& means );
+    void Covariance( DistMatrix<Field>& C );
+
+private:
+    Int n_;
+    Int numRows_=0, localNumRows_=0;
+    // The lower triangle of the Gramian of the flushed rows
+    DistMatrix<Field> gram_;
+    // The lower triangle of the Gramian of the unflushed local rows
+    DistMatrix<Field,STAR,STAR> localGram_;
+    Matrix<Field> sums_, localSums_;
+
+    void LocalUpdate( const Matrix<Field>& ABlock );
+};
+
 // Her2k
 // =====
 template<typename T>
@@ -178,6 +408,331 @@ void MultiShiftTrsm
   F alpha, const AbstractDistMatrix<F>& U, const AbstractDistMatrix<F>& shifts,
   AbstractDistMatrix<F>& X );
 
+// Multiply
+// ========
+// Y := alpha op(A) X + beta Y, where A is sparse
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const SparseMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                  Matrix<T>& Y );
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const DistSparseMatrix<T>& A, const DistMultiVec<T>& X,
+  T beta,                                      DistMultiVec<T>& Y );
+
+// Linear operators
+// ----------------
+// A (possibly matrix-free) linear operator, which need only be able to form
+//
+//   Y := alpha op(A) X + beta Y
+//
+// for multi-vectors X and Y. Sequential operators act on Matrix's, whereas
+// distributed operators act on DistMultiVec's over Grid(), which is signaled
+// by Distributed(); the unsupported variant of Apply throws.
+//
+// The function-call operators provide both of the conventions for 'applyA'
+// used by the iterative routines, i.e., y := alpha A x + beta y for FGMRES
+// and LGMRES, and y := A x for RefinedSolve and Lanczos, so that an operator
+// may be passed to any of them directly. ProductLanczos and TwoNormEstimate
+// also accept operators, as they require adjoint applications.
+template<typename T>
+class LinearOperator
+{
+public:
+    virtual ~LinearOperator() { }
+
+    virtual Int Height() const = 0;
+    virtual Int Width() const = 0;
+
+    virtual bool Distributed() const { return false; }
+    virtual const El::Grid& Grid() const { return El::Grid::Default(); }
+
+    // Y := alpha op(A) X + beta Y
+    virtual void Apply
+    ( Orientation,
+      T, const Matrix<T>&, T, Matrix<T>& ) const
+    { LogicError("This operator does not act on Matrix's"); }
+    virtual void Apply
+    ( Orientation,
+      T, const DistMultiVec<T>&, T, DistMultiVec<T>& ) const
+    { LogicError("This operator does not act on DistMultiVec's"); }
+
+    // Y := alpha A X + beta Y
+    void operator()
+    ( T alpha, const Matrix<T>& X, T beta, Matrix<T>& Y ) const
+    { Apply( NORMAL, alpha, X, beta, Y ); }
+    void operator()
+    ( T alpha, const DistMultiVec<T>& X,
+      T beta,        DistMultiVec<T>& Y ) const
+    { Apply( NORMAL, alpha, X, beta, Y ); }
+
+    // Y := A X
+    void operator()( const Matrix<T>& X, Matrix<T>& Y ) const
+    {
+        Zeros( Y, Height(), X.Width() );
+        Apply( NORMAL, T(1), X, T(0), Y );
+    }
+    void operator()( const DistMultiVec<T>& X, DistMultiVec<T>& Y ) const
+    {
+        Y.SetGrid( X.Grid() );
+        Zeros( Y, Height(), X.Width() );
+        Apply( NORMAL, T(1), X, T(0), Y );
+    }
+
+    // Y := A^H X
+    void ApplyAdjoint( const Matrix<T>& X, Matrix<T>& Y ) const
+    {
+        Zeros( Y, Width(), X.Width() );
+        Apply( ADJOINT, T(1), X, T(0), Y );
+    }
+    void ApplyAdjoint( const DistMultiVec<T>& X, DistMultiVec<T>& Y ) const
+    {
+        Y.SetGrid( X.Grid() );
+        Zeros( Y, Width(), X.Width() );
+        Apply( ADJOINT, T(1), X, T(0), Y );
+    }
+};
+
+// Y := alpha op(A) X + beta Y
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const LinearOperator<T>& A, const Matrix<T>& X,
+  T beta,                                    Matrix<T>& Y )
+{ A.Apply( orientation, alpha, X, beta, Y ); }
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const LinearOperator<T>& A, const DistMultiVec<T>& X,
+  T beta,                                    DistMultiVec<T>& Y )
+{ A.Apply( orientation, alpha, X, beta, Y ); }
+
+// Kronecker operators
+// -------------------
+// The operator A \otimes B, which is applied to a vector x = vec(X) as
+// vec(B X A^T) rather than by forming the (mA mB) x (nA nB) Kronecker product
+// (see Kronecker), i.e., with two Gemms and O(mA nA + mB nB) memory.
+// Only (locked) views of A and B are held, so they must outlive the operator.
+//
+// LinearSolve (see lapack_like/solve.hpp) inverts these operators directly.
+template<typename T>
+class KroneckerOperator : public LinearOperator<T>
+{
+public:
+    KroneckerOperator( const Matrix<T>& A, const Matrix<T>& B );
+
+    Int Height() const override;
+    Int Width() const override;
+    const Matrix<T>& A() const EL_NO_EXCEPT { return A_; }
+    const Matrix<T>& B() const EL_NO_EXCEPT { return B_; }
+
+    using LinearOperator<T>::Apply;
+    void Apply
+    ( Orientation orientation,
+      T alpha, const Matrix<T>& X, T beta, Matrix<T>& Y ) const override;
+
+private:
+    Matrix<T> A_, B_;
+};
+
+// The vectors are stored as DistMultiVec's, and their reshapings are
+// multiplied against [MC,MR] copies of A and B via distributed Gemms
+template<typename T>
+class DistKroneckerOperator : public LinearOperator<T>
+{
+public:
+    DistKroneckerOperator
+    ( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B );
+
+    Int Height() const override;
+    Int Width() const override;
+    bool Distributed() const override { return true; }
+    const El::Grid& Grid() const override { return A_.Grid(); }
+    const DistMatrix<T>& A() const EL_NO_EXCEPT { return A_; }
+    const DistMatrix<T>& B() const EL_NO_EXCEPT { return B_; }
+
+    using LinearOperator<T>::Apply;
+    void Apply
+    ( Orientation orientation,
+      T alpha, const DistMultiVec<T>& X,
+      T beta,        DistMultiVec<T>& Y ) const override;
+
+private:
+    DistMatrix<T> A_, B_;
+};
+
+// Y := alpha op(A \otimes B) X + beta Y, where, e.g., the transpose of
+// A \otimes B is A^T \otimes B^T
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const KroneckerOperator<T>& K, const Matrix<T>& X,
+  T beta,                                       Matrix<T>& Y );
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const DistKroneckerOperator<T>& K, const DistMultiVec<T>& X,
+  T beta,                                           DistMultiVec<T>& Y );
+
+// Fast structured operators
+// -------------------------
+// Toeplitz, circulant, and Hankel operators (with the conventions of the
+// Toeplitz, Circulant, and Hankel matrices of matrices.hpp) which store only
+// their defining vectors. Each op(A) X is the leading block of C [X; 0] for a
+// circulant embedding C, whose order is at least m+n-1, and so it is applied
+// with FFTs (see ApplyFourier) in O((m+n) log(m+n)) work per column.
+//
+// An operator constructed over a Grid is distributed and acts upon
+// DistMultiVec's, which are gathered onto every process for the (redundant)
+// transforms. LinearSolve (see lapack_like/solve.hpp) solves square Toeplitz
+// systems with the Levinson recursion.
+template<typename Field>
+class CirculantEmbeddingOperator : public LinearOperator<Field>
+{
+public:
+    Int Height() const override { return height_; }
+    Int Width() const override { return width_; }
+    bool Distributed() const override { return grid_ != nullptr; }
+    const El::Grid& Grid() const override
+    { return grid_ == nullptr ? El::Grid::Default() : *grid_; }
+
+    using LinearOperator<Field>::Apply;
+    void Apply
+    ( Orientation orientation,
+      Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const override;
+    void Apply
+    ( Orientation orientation,
+      Field alpha, const DistMultiVec<Field>& X,
+      Field beta,        DistMultiVec<Field>& Y ) const override;
+
+protected:
+    CirculantEmbeddingOperator
+    ( Int height, Int width, const El::Grid* grid, bool reverseColumns=false );
+
+    // Transform the first columns of the embeddings of A and of A^T, each of
+    // which must have the same (embedding) length
+    void SetEmbeddings
+    ( const vector<Field>& normalCol, const vector<Field>& transCol );
+
+private:
+    Int height_, width_;
+    const El::Grid* grid_;
+    // Whether A is the product of the embedded matrix with the reversal of
+    // the columns of the identity (as for Hankel matrices)
+    bool reverseColumns_;
+    // sqrt(L) F c for the first column, c, of each embedding of order L
+    Matrix<Complex<Base<Field>>> normalSymbol_, transSymbol_, adjointSymbol_;
+};
+
+template<typename Field>
+class ToeplitzOperator : public CirculantEmbeddingOperator<Field>
+{
+public:
+    // A(i,j) = a[i-j+(n-1)], where a is of length m+n-1
+    ToeplitzOperator( Int m, Int n, const vector<Field>& a );
+    ToeplitzOperator
+    ( Int m, Int n, const vector<Field>& a, const El::Grid& grid );
+    const vector<Field>& Entries() const EL_NO_EXCEPT { return a_; }
+
+private:
+    vector<Field> a_;
+    void Initialize();
+};
+
+template<typename Field>
+class CirculantOperator : public CirculantEmbeddingOperator<Field>
+{
+public:
+    // A(i,j) = a[(i-j) mod n]
+    CirculantOperator( const vector<Field>& a );
+    CirculantOperator( const vector<Field>& a, const El::Grid& grid );
+    const vector<Field>& Entries() const EL_NO_EXCEPT { return a_; }
+
+private:
+    vector<Field> a_;
+    void Initialize();
+};
+
+template<typename Field>
+class HankelOperator : public CirculantEmbeddingOperator<Field>
+{
+public:
+    // A(i,j) = a[i+j], where a is of length m+n-1
+    HankelOperator( Int m, Int n, const vector<Field>& a );
+    HankelOperator
+    ( Int m, Int n, const vector<Field>& a, const El::Grid& grid );
+    const vector<Field>& Entries() const EL_NO_EXCEPT { return a_; }
+
+private:
+    vector<Field> a_;
+    void Initialize();
+};
+
+// Matrix-free stencil operators
+// ------------------------------
+// The constant-coefficient (3, 5, or) 7-point operator on an nx x ny x nz
+// grid whose points are numbered naturally (x varying fastest), with
+//
+//   A(i,i) = mainTerm,      A(i,i+-1) = xTerm,
+//   A(i,i+-nx) = yTerm,     A(i,i+-nx*ny) = zTerm
+//
+// for the neighbors within the grid (ny=nz=1 for 1D and nz=1 for 2D grids).
+// Only the coefficients are stored, so that the operator may be handed to the
+// Krylov solvers at any scale. An operator with a Grid (see SetGrid) acts
+// upon DistMultiVec's by exchanging halos of (at most) nx*ny rows with the
+// processes owning the neighboring rows.
+//
+// Form explicitly builds the operator with each process generating (the
+// sorted entries of) its rows in parallel, which is how the Helmholtz and
+// Laplacian routines of matrices.hpp are implemented (see also
+// HelmholtzOperator and LaplacianOperator).
+template<typename Field>
+class StencilOperator : public LinearOperator<Field>
+{
+public:
+    StencilOperator
+    ( Int nx, Int ny, Int nz,
+      Field mainTerm, Field xTerm, Field yTerm, Field zTerm );
+
+    void SetGrid( const El::Grid& grid ) { grid_ = &grid; }
+
+    Int Height() const override { return nx_*ny_*nz_; }
+    Int Width() const override { return nx_*ny_*nz_; }
+    bool Distributed() const override { return grid_ != nullptr; }
+    const El::Grid& Grid() const override
+    { return grid_ == nullptr ? El::Grid::Default() : *grid_; }
+
+    using LinearOperator<Field>::Apply;
+    void Apply
+    ( Orientation orientation,
+      Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const override;
+    void Apply
+    ( Orientation orientation,
+      Field alpha, const DistMultiVec<Field>& X,
+      Field beta,        DistMultiVec<Field>& Y ) const override;
+
+    void Form( Matrix<Field>& A ) const;
+    void Form( AbstractDistMatrix<Field>& A ) const;
+    void Form( SparseMatrix<Field>& A ) const;
+    void Form( DistSparseMatrix<Field>& A ) const;
+
+private:
+    Int nx_, ny_, nz_;
+    Field mainTerm_, xTerm_, yTerm_, zTerm_;
+    const El::Grid* grid_=nullptr;
+
+    // Y := alpha op(A)(firstRow:firstRow+Y.Height()-1,:) X + beta Y, where
+    // row i of X holds global row i+XOffset
+    void LocalApply
+    ( Orientation orientation,
+      Field alpha, const Matrix<Field>& X, Int XOffset,
+      Field beta,        Matrix<Field>& Y, Int firstRow ) const;
+};
+
 // SafeMultiShiftTrsm
 // ==================
 template<typename F>
@@ -368,7 +923,12 @@ enum TrsmAlgorithm {
   TRSM_DEFAULT,
   TRSM_LARGE,
   TRSM_MEDIUM,
-  TRSM_SMALL
+  TRSM_SMALL,
+  // Explicitly invert diagonal blocks (whose size grows as the number of
+  // right-hand sides shrinks) and apply the rest of the triangle with Gemm.
+  // This requires far fewer sweeps for few right-hand sides, but it is only
+  // as accurate as the inverses of the diagonal blocks.
+  TRSM_INVERSE
 };
 }
 using namespace TrsmAlgorithmNS;
@@ -388,6 +948,15 @@ void Trsm
         AbstractDistMatrix<F>& B,
   bool checkIfSingular=false, TrsmAlgorithm alg=TRSM_DEFAULT );
 
+// A tiled triangular solve whose diagonal-tile solves and updates are
+// scheduled by a TaskGraph (in the manner of PLASMA's pztrsm)
+template<typename F>
+void TiledTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const Matrix<F>& A, Matrix<F>& B,
+  const TiledCtrl& ctrl=TiledCtrl() );
+
 template<typename F>
 void LocalTrsm
 ( LeftOrRight side, UpperOrLower uplo,
@@ -509,6 +1078,18 @@ void LocalTrrk
            const DistMatrix<T,MR,  STAR>& B,
   T beta,        DistMatrix<T,MC,  MR  >& C );
 
+// The number of entries of the (uplo) triangle of C which are owned by each
+// process of its distribution (indexed by C.DistRank()), i.e., the relative
+// local work of a triangular update such as Trrk, and the ratio of the
+// maximum to the mean of these counts. Realigning C merely permutes the
+// counts among the processes, so the imbalance is a property of the grid
+// shape and the matrix size; it decays as O(r/n) for an r x c grid.
+template<typename T>
+vector<Int> LocalTriangleSizes
+( UpperOrLower uplo, const ElementalMatrix<T>& C );
+template<typename T>
+double TriangleImbalance( UpperOrLower uplo, const ElementalMatrix<T>& C );
+
 // Trr2k
 // =====
 /*
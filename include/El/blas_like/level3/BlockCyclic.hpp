@@ -0,0 +1,236 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_LEVEL3_BLOCKCYCLIC_HPP
+#define EL_BLAS_LEVEL3_BLOCKCYCLIC_HPP
+
+// Utilities shared by the native [MC,MR,BLOCK] implementations of the level 3
+// BLAS and the dense factorizations. Rather than redistributing into an
+// elemental distribution, these routines work directly on the local storage
+// of the block-cyclic matrix (as ScaLAPACK does), so that each global row or
+// column panel which lies within a single distribution block is owned by a
+// single process row or column and is locally contiguous.
+
+namespace El {
+namespace block_cyclic {
+
+template<typename T>
+bool IsMCMRBlock( const AbstractDistMatrix<T>& A )
+{
+    return A.Wrap() == BLOCK && A.ColDist() == MC && A.RowDist() == MR;
+}
+
+// Whether the row and column block boundaries coincide, so that diagonal
+// blocks are owned by a single process
+template<typename T>
+bool HasSquareBlocks( const AbstractDistMatrix<T>& A )
+{
+    return A.BlockHeight() == A.BlockWidth() && A.ColCut() == A.RowCut();
+}
+
+// Whether the rows of A and B are distributed identically
+template<typename T>
+bool SameColDistribution
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{
+    return A.ColAlign() == B.ColAlign() &&
+           A.BlockHeight() == B.BlockHeight() &&
+           A.ColCut() == B.ColCut();
+}
+
+// Whether the columns of A and B are distributed identically
+template<typename T>
+bool SameRowDistribution
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{
+    return A.RowAlign() == B.RowAlign() &&
+           A.BlockWidth() == B.BlockWidth() &&
+           A.RowCut() == B.RowCut();
+}
+
+// The (exclusive) end of the distribution block containing index k of a
+// dimension of length n
+inline Int BlockEnd( Int k, Int blockSize, Int cut, Int n )
+{ return Min( n, k + blockSize - (k+cut) % blockSize ); }
+
+// Replicate A(i0:i1-1,j0:j1-1), which must lie within a single distribution
+// block, on every process
+template<typename T>
+void BroadcastBlock
+( const DistMatrix<T,MC,MR,BLOCK>& A,
+  Int i0, Int i1, Int j0, Int j1,
+  Matrix<T>& A11 )
+{
+    EL_DEBUG_CSE
+    const Int height = i1 - i0;
+    const Int width = j1 - j0;
+    const int owner = A.Owner(i0,j0);
+    A11.Resize( height, width, Max(height,1) );
+    if( A.DistRank() == owner && height > 0 && width > 0 )
+        lapack::Copy
+        ( 'F', height, width,
+          A.LockedBuffer(A.LocalRowOffset(i0),A.LocalColOffset(j0)), A.LDim(),
+          A11.Buffer(), A11.LDim() );
+    mpi::Broadcast( A11.Buffer(), height*width, owner, A.DistComm() );
+}
+
+// Overwrite the single distribution block A(i0:i1-1,j0:j1-1) with the
+// (redundantly computed) A11 on its owning process
+template<typename T>
+void StoreBlock
+( DistMatrix<T,MC,MR,BLOCK>& A, Int i0, Int j0, const Matrix<T>& A11 )
+{
+    EL_DEBUG_CSE
+    if( A.DistRank() == A.Owner(i0,j0) &&
+        A11.Height() > 0 && A11.Width() > 0 )
+        lapack::Copy
+        ( 'F', A11.Height(), A11.Width(), A11.LockedBuffer(), A11.LDim(),
+          A.Buffer(A.LocalRowOffset(i0),A.LocalColOffset(j0)), A.LDim() );
+}
+
+// Replicate the local rows of A(i0:i1-1,j0:j1-1) within each process row,
+// where the columns j0:j1-1 lie within a single distribution block
+template<typename T>
+void BroadcastColPanel
+( const DistMatrix<T,MC,MR,BLOCK>& A,
+  Int i0, Int i1, Int j0, Int j1,
+  Matrix<T>& P )
+{
+    EL_DEBUG_CSE
+    const Int iLoc0 = A.LocalRowOffset(i0);
+    const Int height = A.LocalRowOffset(i1) - iLoc0;
+    const Int width = j1 - j0;
+    const int owner = A.ColOwner(j0);
+    P.Resize( height, width, Max(height,1) );
+    if( A.RowRank() == owner && height > 0 && width > 0 )
+        lapack::Copy
+        ( 'F', height, width,
+          A.LockedBuffer(iLoc0,A.LocalColOffset(j0)), A.LDim(),
+          P.Buffer(), P.LDim() );
+    mpi::Broadcast( P.Buffer(), height*width, owner, A.RowComm() );
+}
+
+// Replicate the local columns of A(i0:i1-1,j0:j1-1) within each process
+// column, where the rows i0:i1-1 lie within a single distribution block
+template<typename T>
+void BroadcastRowPanel
+( const DistMatrix<T,MC,MR,BLOCK>& A,
+  Int i0, Int i1, Int j0, Int j1,
+  Matrix<T>& P )
+{
+    EL_DEBUG_CSE
+    const Int jLoc0 = A.LocalColOffset(j0);
+    const Int height = i1 - i0;
+    const Int width = A.LocalColOffset(j1) - jLoc0;
+    const int owner = A.RowOwner(i0);
+    P.Resize( height, width, Max(height,1) );
+    if( A.ColRank() == owner && height > 0 && width > 0 )
+        lapack::Copy
+        ( 'F', height, width,
+          A.LockedBuffer(A.LocalRowOffset(i0),jLoc0), A.LDim(),
+          P.Buffer(), P.LDim() );
+    mpi::Broadcast( P.Buffer(), height*width, owner, A.ColComm() );
+}
+
+// Given a column panel P whose rows are the local rows of A with global
+// indices of at least i0 (replicated within each process row, e.g., from
+// BroadcastColPanel), form the panel PTrans whose rows are those of the
+// same global panel indexed by the local columns of A with global indices of
+// at least i0. Each process row broadcasts the requested rows it owns within
+// the process columns.
+template<typename T>
+void TransposeColPanel
+( const DistMatrix<T,MC,MR,BLOCK>& A,
+  Int i0, const Matrix<T>& P, Matrix<T>& PTrans )
+{
+    EL_DEBUG_CSE
+    const Int width = P.Width();
+    const Int iLoc0 = A.LocalRowOffset(i0);
+    const Int jLoc0 = A.LocalColOffset(i0);
+    const Int localWidth = A.LocalWidth();
+    const int colRank = A.ColRank();
+    const int colStride = A.ColStride();
+    PTrans.Resize
+    ( localWidth-jLoc0, width, Max(localWidth-jLoc0,Int(1)) );
+
+    vector<Int> owned;
+    Matrix<T> buffer;
+    for( int root=0; root<colStride; ++root )
+    {
+        owned.clear();
+        for( Int jLoc=jLoc0; jLoc<localWidth; ++jLoc )
+            if( A.RowOwner(A.GlobalCol(jLoc)) == root )
+                owned.push_back( jLoc );
+        const Int numOwned = owned.size();
+        if( numOwned == 0 )
+            continue;
+
+        buffer.Resize( numOwned, width, numOwned );
+        if( colRank == root )
+            for( Int t=0; t<numOwned; ++t )
+            {
+                const Int iLoc = A.LocalRowOffset(A.GlobalCol(owned[t]));
+                for( Int s=0; s<width; ++s )
+                    buffer(t,s) = P(iLoc-iLoc0,s);
+            }
+        mpi::Broadcast( buffer.Buffer(), numOwned*width, root, A.ColComm() );
+        for( Int t=0; t<numOwned; ++t )
+            for( Int s=0; s<width; ++s )
+                PTrans(owned[t]-jLoc0,s) = buffer(t,s);
+    }
+}
+
+// The analogue of TransposeColPanel for a row panel Q whose columns are the
+// local columns of A with global indices of at least j0: QTrans has the
+// columns of the global panel indexed by the local rows of A with global
+// indices of at least j0
+template<typename T>
+void TransposeRowPanel
+( const DistMatrix<T,MC,MR,BLOCK>& A,
+  Int j0, const Matrix<T>& Q, Matrix<T>& QTrans )
+{
+    EL_DEBUG_CSE
+    const Int height = Q.Height();
+    const Int iLoc0 = A.LocalRowOffset(j0);
+    const Int jLoc0 = A.LocalColOffset(j0);
+    const Int localHeight = A.LocalHeight();
+    const int rowRank = A.RowRank();
+    const int rowStride = A.RowStride();
+    QTrans.Resize( height, localHeight-iLoc0, Max(height,Int(1)) );
+
+    vector<Int> owned;
+    Matrix<T> buffer;
+    for( int root=0; root<rowStride; ++root )
+    {
+        owned.clear();
+        for( Int iLoc=iLoc0; iLoc<localHeight; ++iLoc )
+            if( A.ColOwner(A.GlobalRow(iLoc)) == root )
+                owned.push_back( iLoc );
+        const Int numOwned = owned.size();
+        if( numOwned == 0 )
+            continue;
+
+        buffer.Resize( height, numOwned, Max(height,Int(1)) );
+        if( rowRank == root )
+            for( Int t=0; t<numOwned; ++t )
+            {
+                const Int jLoc = A.LocalColOffset(A.GlobalRow(owned[t]));
+                for( Int s=0; s<height; ++s )
+                    buffer(s,t) = Q(s,jLoc-jLoc0);
+            }
+        mpi::Broadcast( buffer.Buffer(), height*numOwned, root, A.RowComm() );
+        for( Int t=0; t<numOwned; ++t )
+            for( Int s=0; s<height; ++s )
+                QTrans(s,owned[t]-iLoc0) = buffer(s,t);
+    }
+}
+
+} // namespace block_cyclic
+} // namespace El
+
+#endif // ifndef EL_BLAS_LEVEL3_BLOCKCYCLIC_HPP
@@ -13,6 +13,30 @@
 
 namespace El {
 
+namespace SylvesterAlgNS {
+enum SylvesterAlg {
+    // Read the solution off of the sign of an enlarged block matrix
+    SYLVESTER_SIGN,
+    // Reduce to (quasi-)triangular form with Schur decompositions and then
+    // solve the resulting triangular equation recursively (Bartels-Stewart)
+    SYLVESTER_SCHUR
+};
+}
+using namespace SylvesterAlgNS;
+
+template<typename Real>
+struct SylvesterCtrl
+{
+    SylvesterAlg alg=SYLVESTER_SCHUR;
+
+    // The triangular Sylvester solve recurses until both dimensions are at
+    // most this size
+    Int cutoff=64;
+
+    SignCtrl<Real> signCtrl;
+    SchurCtrl<Real> schurCtrl;
+};
+
 // Lyapunov
 // ========
 template<typename F>
@@ -28,6 +52,56 @@ void Lyapunov
         ElementalMatrix<F>& X,
   SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 
+template<typename F>
+void Lyapunov
+( const Matrix<F>& A,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl );
+template<typename F>
+void Lyapunov
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl );
+
+// Low-rank Lyapunov
+// =================
+template<typename Real>
+struct LowRankLyapunovCtrl
+{
+    Int maxIts=100;
+
+    // Stop once || A X + X A^H + B B^H ||_2 <= relTol || B B^H ||_2
+    Real relTol;
+
+    bool progress=false;
+
+    LowRankLyapunovCtrl() { relTol = Pow(limits::Epsilon<Real>(),Real(0.5)); }
+};
+
+// Return a factor Z such that X = Z Z^H approximately solves
+//
+//   A X + X A^H + B B^H = 0,
+//
+// where A has all of its eigenvalues in the open left-half plane and B has
+// few columns, via the low-rank ADI iteration. A is reduced to Hessenberg
+// form once so that each shifted solve is performed with
+// MultiShiftHessSolve, and the shifts are generated automatically as the
+// (reflected) Ritz values of A on the most recent ADI subspace.
+template<typename F>
+void LowRankLyapunov
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& Z,
+  const LowRankLyapunovCtrl<Base<F>>& ctrl=LowRankLyapunovCtrl<Base<F>>() );
+template<typename F>
+void LowRankLyapunov
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+        ElementalMatrix<F>& Z,
+  const LowRankLyapunovCtrl<Base<F>>& ctrl=LowRankLyapunovCtrl<Base<F>>() );
+
 // Riccati
 // =======
 template<typename F>
@@ -56,6 +130,59 @@ void Riccati
         ElementalMatrix<F>& X, 
   SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 
+// Newton-Kleinman Riccati
+// -----------------------
+template<typename Real>
+struct NewtonRiccatiCtrl
+{
+    Int maxIts=20;
+
+    // Stop once || X K X - A^H X - X A - L ||_F <= relTol times
+    // || L ||_F + || X ||_F (2 || A ||_F + || K ||_F || X ||_F)
+    Real relTol;
+
+    // Start from the incoming X, which must be Hermitian and stabilizing
+    // (A - K X must have all of its eigenvalues in the open left-half plane),
+    // e.g., the solution of a nearby equation. Otherwise, or if X does not
+    // have the right size, the initial iterate comes from the sign-based
+    // Riccati solver.
+    bool warmStart=true;
+    SignCtrl<Real> signCtrl;
+
+    // Each Newton step solves a Lyapunov equation with this control
+    SylvesterCtrl<Real> lyapunovCtrl;
+
+    bool progress=false;
+
+    NewtonRiccatiCtrl()
+    { relTol = Pow(limits::Epsilon<Real>(),Real(0.75)); }
+};
+
+// Solve X K X - A^H X - X A = L, where K and L are Hermitian (and only the
+// 'uplo' triangles are accessed), with the Newton-Kleinman iteration
+//
+//   (A - K X_k)^H X_{k+1} + X_{k+1} (A - K X_k) = -(L + X_k K X_k),
+//
+// which converges quadratically from any stabilizing initial iterate. From
+// the solution of a slightly perturbed equation, only a few steps are needed.
+// The number of Newton steps is returned.
+template<typename F>
+Int NewtonRiccati
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+  const Matrix<F>& K,
+  const Matrix<F>& L,
+        Matrix<F>& X,
+  const NewtonRiccatiCtrl<Base<F>>& ctrl=NewtonRiccatiCtrl<Base<F>>() );
+template<typename F>
+Int NewtonRiccati
+( UpperOrLower uplo,
+  const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& K,
+  const ElementalMatrix<F>& L,
+        ElementalMatrix<F>& X,
+  const NewtonRiccatiCtrl<Base<F>>& ctrl=NewtonRiccatiCtrl<Base<F>>() );
+
 // Sylvester
 // =========
 template<typename F>
@@ -82,6 +209,37 @@ void Sylvester
         ElementalMatrix<F>& X, 
   SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 
+template<typename F>
+void Sylvester
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl );
+template<typename F>
+void Sylvester
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl );
+
+// Overwrite C with the solution X of A X + X B = C, where A and B are upper
+// triangular (or, in the real case, upper quasi-triangular, as returned by
+// Schur). The spectra of A and -B must be disjoint.
+template<typename F>
+void TriangularSylvester
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& C,
+  Int cutoff=64 );
+template<typename F>
+void TriangularSylvester
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+        ElementalMatrix<F>& C,
+  Int cutoff=64 );
+
 } // namespace El
 
 #endif // ifndef EL_CONTROL_HPP
@@ -14,14 +14,17 @@
 #include <mpi.h>
 
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <complex>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <sstream>
@@ -88,6 +91,8 @@ struct QuadDouble;
 class BigInt;
 class BigFloat;
 #endif
+class Half;
+class BFloat16;
 template<typename Real>
 class Complex;
 
@@ -152,6 +157,10 @@ template<> struct IsScalar<BigInt>
 template<> struct IsScalar<BigFloat>
 { static const bool value=true; };
 #endif
+template<> struct IsScalar<Half>
+{ static const bool value=true; };
+template<> struct IsScalar<BFloat16>
+{ static const bool value=true; };
 template<typename T> struct IsScalar<Complex<T>>
 { static const bool value=IsScalar<T>::value; };
 
@@ -237,6 +246,7 @@ template<typename T> struct IsStdField<Complex<T>>
 #include <El/core/imports/mpfr.hpp>
 #include <El/core/imports/qt5.hpp>
 
+#include <El/core/Element/LowPrecision.hpp>
 #include <El/core/Element/decl.hpp>
 #include <El/core/Serialize.hpp>
 #include <El/core/imports/mpi.hpp>
@@ -245,6 +255,8 @@ template<typename T> struct IsStdField<Complex<T>>
 #include <El/core/environment/decl.hpp>
 
 #include <El/core/Timer.hpp>
+#include <El/core/Trace.hpp>
+#include <El/core/TaskGraph.hpp>
 #include <El/core/indexing/decl.hpp>
 #include <El/core/imports/blas.hpp>
 #include <El/core/imports/lapack.hpp>
@@ -257,6 +269,9 @@ template<typename T> struct IsStdField<Complex<T>>
 #include <El/core/limits.hpp>
 
 #include <El/core/Memory.hpp>
+#include <El/core/imports/cublas.hpp>
+#include <El/core/Arena.hpp>
+#include <El/core/SimpleBuffer.hpp>
 
 namespace El {
 
@@ -270,17 +285,27 @@ template<typename T=double> class BlockMatrix;
 template<typename T=double,Dist U=MC,Dist V=MR,DistWrap wrap=ELEMENT>
 class DistMatrix;
 
+class Graph;
+class DistGraph;
+
+template<typename T=double> class SparseMatrix;
+template<typename T=double> class DistSparseMatrix;
+template<typename T=double> class DistMultiVec;
+
 } // namespace El
 
 #include <El/core/Matrix/decl.hpp>
+#include <El/core/SmallMatrix.hpp>
 #include <El/core/DistMap/decl.hpp>
 #include <El/core/View/decl.hpp>
 #include <El/blas_like/level1/decl.hpp>
 
 #include <El/core/Matrix/impl.hpp>
 #include <El/core/Grid.hpp>
+#include <El/core/Subproblems.hpp>
 #include <El/core/DistMatrix.hpp>
 #include <El/core/Proxy.hpp>
+#include <El/core/DLPack.hpp>
 
 // Implement the intertwined parts of the library
 #include <El/core/Element/impl.hpp>
@@ -299,6 +324,12 @@ class DistMatrix;
 
 #include <El/core/DistMap.hpp>
 
+#include <El/core/Graph.hpp>
+#include <El/core/DistGraph.hpp>
+#include <El/core/SparseMatrix.hpp>
+#include <El/core/DistSparseMatrix.hpp>
+#include <El/core/DistMultiVec.hpp>
+
 #include <El/core/Permutation.hpp>
 #include <El/core/DistPermutation.hpp>
 
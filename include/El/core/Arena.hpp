@@ -0,0 +1,72 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_ARENA_HPP
+#define EL_ARENA_HPP
+
+namespace El {
+
+// A stack-ordered workspace for short-lived buffers, such as the packing
+// buffers of redistributions. Rather than returning memory to the system,
+// released buffers are kept for reuse, and the arena grows geometrically
+// when a request cannot be satisfied. Once all buffers have been released,
+// any additional chunks are coalesced into a single chunk so that the
+// steady-state number of allocations of repeated operations drops to zero.
+//
+// Buffers are expected to be released in (roughly) the reverse order of
+// their acquisition; out-of-order releases are handled lazily.
+// NOTE: An arena is not thread-safe.
+class Arena
+{
+public:
+    Arena() { }
+    ~Arena();
+
+    // Returns a buffer of at least 'numBytes' bytes aligned to 'alignment'
+    byte* Push( size_t numBytes );
+    void Pop( byte* buffer );
+
+    // Return all of the memory to the system (there must not be any
+    // outstanding buffers)
+    void Empty();
+
+    size_t NumOutstanding() const EL_NO_EXCEPT { return stack_.size(); }
+    size_t Capacity() const EL_NO_EXCEPT;
+    size_t HighWaterMark() const EL_NO_EXCEPT { return highWater_; }
+    size_t NumAllocations() const EL_NO_EXCEPT { return numAllocations_; }
+
+    static const size_t alignment = 64;
+
+private:
+    struct Chunk
+    {
+        Memory<byte> memory;
+        size_t offset;
+    };
+    struct Ticket
+    {
+        byte* buffer;
+        size_t chunk;
+        size_t prevOffset;
+        bool released;
+    };
+
+    vector<Chunk> chunks_;
+    vector<Ticket> stack_;
+    size_t used_=0, highWater_=0, numAllocations_=0;
+
+    void Coalesce();
+
+    // Disable copying (outstanding buffers would alias)
+    Arena( const Arena& );
+    const Arena& operator=( const Arena& );
+};
+
+} // namespace El
+
+#endif // ifndef EL_ARENA_HPP
@@ -0,0 +1,121 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_DLPACK_HPP
+#define EL_CORE_DLPACK_HPP
+
+#include <cstdint>
+
+namespace El {
+
+// Zero-copy exchange of local matrices with other frameworks (e.g., NumPy,
+// CuPy, or PyTorch) through the DLPack tensor ABI. If <dlpack/dlpack.h>
+// (version 1.0 or later) was included beforehand, its types are used;
+// otherwise, layout-compatible copies of the structures are defined below.
+
+#ifdef DLPACK_MAJOR_VERSION
+using ::DLPackVersion;
+using ::DLDevice;
+using ::DLDataType;
+using ::DLTensor;
+using ::DLManagedTensorVersioned;
+#else
+struct DLPackVersion
+{
+    std::uint32_t major;
+    std::uint32_t minor;
+};
+
+// The subset of DLDeviceType and DLDataTypeCode which are used
+enum : std::int32_t { kDLCPU=1, kDLCUDA=2, kDLCUDAHost=3 };
+enum : std::uint8_t { kDLInt=0, kDLUInt=1, kDLFloat=2, kDLComplex=5 };
+
+struct DLDevice
+{
+    std::int32_t device_type;
+    std::int32_t device_id;
+};
+
+struct DLDataType
+{
+    std::uint8_t code;
+    std::uint8_t bits;
+    std::uint16_t lanes;
+};
+
+struct DLTensor
+{
+    void* data;
+    DLDevice device;
+    std::int32_t ndim;
+    DLDataType dtype;
+    std::int64_t* shape;
+    std::int64_t* strides; // in elements; null for compact row-major
+    std::uint64_t byte_offset;
+};
+
+struct DLManagedTensorVersioned
+{
+    DLPackVersion version;
+    void* manager_ctx;
+    void (*deleter)( DLManagedTensorVersioned* self );
+    std::uint64_t flags;
+    DLTensor dl_tensor;
+};
+
+# define DLPACK_FLAG_BITMASK_READ_ONLY (1UL << 0UL)
+#endif // ifdef DLPACK_MAJOR_VERSION
+
+template<typename T>
+DLDataType DLPackType();
+
+// Export
+// ------
+// Expose the buffer, dimensions, leading dimension (as the column stride),
+// element type, and memory space of a matrix without copying it. The
+// result must be released through its deleter, which frees only the
+// descriptor: the matrix retains ownership of its entries and must outlive
+// the export (and must not be resized in the meantime). Locked matrices,
+// and those exported through LockedToDLPack, are flagged as read-only.
+template<typename T>
+DLManagedTensorVersioned* ToDLPack( Matrix<T>& A );
+template<typename T>
+DLManagedTensorVersioned* LockedToDLPack( const Matrix<T>& A );
+
+// The local block of a distributed matrix
+template<typename T>
+DLManagedTensorVersioned* ToDLPack( AbstractDistMatrix<T>& A );
+template<typename T>
+DLManagedTensorVersioned* LockedToDLPack( const AbstractDistMatrix<T>& A );
+
+// Import
+// ------
+// View the entries described by a host tensor (e.g., the dl_tensor member of
+// a versioned or unversioned managed tensor) without copying them. The
+// tensor must hold a vector or a column-major matrix, i.e., its row stride
+// must be one; a C-ordered array should instead be attached as its
+// transpose. As with Attach, the caller retains ownership of the tensor,
+// which must outlive the view.
+template<typename T>
+void AttachDLPack( Matrix<T>& A, const DLTensor& tensor );
+template<typename T>
+void LockedAttachDLPack( Matrix<T>& A, const DLTensor& tensor );
+
+// View the tensor as the local block of a distributed matrix
+template<typename T>
+void AttachDLPack
+( ElementalMatrix<T>& A, Int height, Int width, const Grid& grid,
+  int colAlign, int rowAlign, const DLTensor& localTensor, int root=0 );
+template<typename T>
+void LockedAttachDLPack
+( ElementalMatrix<T>& A, Int height, Int width, const Grid& grid,
+  int colAlign, int rowAlign, const DLTensor& localTensor, int root=0 );
+
+} // namespace El
+
+#endif // ifndef EL_CORE_DLPACK_HPP
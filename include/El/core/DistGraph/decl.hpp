@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_DISTGRAPH_DECL_HPP
+#define EL_CORE_DISTGRAPH_DECL_HPP
+
+namespace El {
+
+// Use the same 1D distribution of the sources as DistMap, where each process
+// owns a fixed number of contiguous sources,
+//     if last process,  numSources - (commSize-1)*blocksize
+//     otherwise,        blocksize
+class DistGraph
+{
+public:
+    // Constructors and destructors
+    DistGraph( const El::Grid& grid=El::Grid::Default() );
+    DistGraph( Int numSources, const El::Grid& grid=El::Grid::Default() );
+    DistGraph
+    ( Int numSources, Int numTargets,
+      const El::Grid& grid=El::Grid::Default() );
+    DistGraph( const DistGraph& graph );
+    ~DistGraph();
+
+    // Assignment
+    const DistGraph& operator=( const DistGraph& graph );
+
+    // Changing the graph size
+    void Empty( bool freeMemory=true );
+    void Resize( Int numVertices );
+    void Resize( Int numSources, Int numTargets );
+
+    // Changing the distribution
+    void SetGrid( const El::Grid& grid );
+
+    // Assembly
+    // --------
+    void Reserve( Int numLocalEdges, Int numRemoteEdges=0 );
+
+    // Safe edge insertion/removal procedures (collective)
+    void Connect( Int source, Int target );
+    void ConnectLocal( Int localSource, Int target );
+    void Disconnect( Int source, Int target );
+    void DisconnectLocal( Int localSource, Int target );
+
+    // Batch updating. A passive queue only inserts the edge if its source
+    // is locally owned.
+    void QueueConnection( Int source, Int target, bool passive=false );
+    void QueueLocalConnection( Int localSource, Int target );
+    void QueueDisconnection( Int source, Int target, bool passive=false );
+    void QueueLocalDisconnection( Int localSource, Int target );
+    // Collective: sends the remote edges to their owners
+    void ProcessQueues();
+    void ProcessLocalQueues();
+
+    // High-level information
+    Int NumSources() const EL_NO_EXCEPT;
+    Int NumTargets() const EL_NO_EXCEPT;
+    Int FirstLocalSource() const EL_NO_EXCEPT;
+    Int NumLocalSources() const EL_NO_EXCEPT;
+    Int NumLocalEdges() const EL_NO_EXCEPT;
+    Int Capacity() const EL_NO_EXCEPT;
+    bool LocallyConsistent() const EL_NO_EXCEPT;
+
+    // Distribution information
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+    Int Blocksize() const EL_NO_EXCEPT;
+    int SourceOwner( Int source ) const EL_NO_RELEASE_EXCEPT;
+    Int GlobalSource( Int localSource ) const EL_NO_RELEASE_EXCEPT;
+    Int LocalSource( Int source ) const EL_NO_RELEASE_EXCEPT;
+    bool IsLocalSource( Int source ) const EL_NO_RELEASE_EXCEPT;
+
+    // Detailed local information
+    Int Source( Int localEdge ) const EL_NO_RELEASE_EXCEPT;
+    Int Target( Int localEdge ) const EL_NO_RELEASE_EXCEPT;
+    Int SourceOffset( Int localSource ) const EL_NO_RELEASE_EXCEPT;
+    Int Offset( Int localSource, Int target ) const EL_NO_RELEASE_EXCEPT;
+    Int NumConnections( Int localSource ) const EL_NO_RELEASE_EXCEPT;
+    bool EdgeExistsLocal( Int localSource, Int target )
+    const EL_NO_RELEASE_EXCEPT;
+
+    Int* SourceBuffer() EL_NO_EXCEPT;
+    Int* TargetBuffer() EL_NO_EXCEPT;
+    Int* OffsetBuffer() EL_NO_EXCEPT;
+    const Int* LockedSourceBuffer() const EL_NO_EXCEPT;
+    const Int* LockedTargetBuffer() const EL_NO_EXCEPT;
+    const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
+
+    void ForceNumLocalEdges( Int numLocalEdges );
+    void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
+
+    void AssertLocallyConsistent() const;
+
+private:
+    Int numSources_=0, numTargets_=0;
+
+    // An observing pointer to a pre-existing Grid.
+    const El::Grid* grid_=nullptr;
+
+    Int blocksize_=1;
+    Int numLocalSources_=0;
+
+    // The sources are stored with global indices
+    vector<Int> sources_, targets_;
+    vector<Int> localSourceOffsets_;
+
+    vector<pair<Int,Int>> markedForRemoval_;
+    vector<Int> remoteSources_, remoteTargets_;
+    vector<pair<Int,Int>> remoteRemovals_;
+    bool locallyConsistent_=true;
+
+    void InitializeLocalData();
+    void ComputeSourceOffsets();
+
+    friend class Graph;
+    template<typename T> friend class DistSparseMatrix;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_DISTGRAPH_DECL_HPP
@@ -54,6 +54,8 @@ inline void AssertSameDist( const DistTypeA& distA, const DistTypeB& distB )
 #include <El/core/DistMatrix/Block/VC_STAR.hpp>
 #include <El/core/DistMatrix/Block/VR_STAR.hpp>
 
+#include <El/core/DistMatrix/ReadCache.hpp>
+
 namespace El {
 
 #ifdef EL_HAVE_SCALAPACK
@@ -223,8 +223,24 @@ public:
     void MakeReal( Int i, Int j ) EL_NO_RELEASE_EXCEPT;
     void Conjugate( Int i, Int j ) EL_NO_RELEASE_EXCEPT;
 
+    // Batched global entry manipulation
+    // ---------------------------------
+    // GetMany is collective, like Get, and every process must pass the same
+    // list of indices, but it requires a single AllGather (and, for
+    // [o ,o ]/[MD,* ]/[* ,MD] matrices, a single Broadcast) rather than a
+    // pair of broadcasts per entry. SetMany is not collective: each process
+    // sets the entries of the list which it owns.
+    vector<Ring> GetMany
+    ( const vector<pair<Int,Int>>& indices ) const EL_NO_RELEASE_EXCEPT;
+    void SetMany( const vector<Entry<Ring>>& entries ) EL_NO_RELEASE_EXCEPT;
+
     // Batch updating of remote entries
     // ---------------------------------
+    // ProcessQueues sorts the queued updates by owner, sums those with the
+    // same indices, and exchanges them in rounds of at most QueueRoundSize()
+    // entries per process. In hybrid builds, QueueUpdate may be called
+    // concurrently from within an OpenMP parallel region as long as Reserve
+    // was first called outside of it (each thread then has its own queue).
     void Reserve( Int numRemoteEntries );
     void QueueUpdate( const Entry<Ring>& entry ) EL_NO_RELEASE_EXCEPT;
     void QueueUpdate( Int i, Int j, Ring value ) EL_NO_RELEASE_EXCEPT;
@@ -326,6 +342,10 @@ protected:
 
     El::Matrix<Ring> matrix_=El::Matrix<Ring>();
 
+    // The shared-memory buffer backing matrix_ for node-shared [STAR,STAR]
+    // matrices (see DistMatrix<Ring,STAR,STAR>::SetNodeShared)
+    std::unique_ptr<mpi::SharedWindow> nodeWindow_;
+
     // Remote updates
     // --------------
     // NOTE: Using ValueInt<Int> is somewhat of a hack; it would be nice to
@@ -333,6 +353,9 @@ protected:
     //       require separate MPI wrappers from ValueInt<Int>
     mutable vector<ValueInt<Int>> remotePulls_;
 
+    // The per-thread queues of remote updates (see Reserve)
+    vector<vector<Entry<Ring>>> threadUpdates_;
+
     // Protected constructors
     // ======================
     // Create a 0 x 0 distributed matrix
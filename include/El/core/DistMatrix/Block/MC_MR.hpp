@@ -162,6 +162,22 @@ public:
     int PartialUnionColRank() const EL_NO_EXCEPT override;
     int PartialUnionRowRank() const EL_NO_EXCEPT override;
 
+#ifdef EL_HAVE_SCALAPACK
+    // ScaLAPACK interoperability
+    // ==========================
+    // The array descriptor of this matrix (over the BLACS context of the
+    // grid), so that the local buffer can be passed directly to ScaLAPACK
+    blacs::Desc Descriptor() const;
+
+    // View the local portion of an existing ScaLAPACK array (without copying
+    // it) given its descriptor. The BLACS context of the descriptor must
+    // place this process at the same (row,column) coordinates of a grid of
+    // the same shape as the grid of this matrix. The caller retains
+    // ownership of the buffer, which must outlive the view.
+    void AttachScaLAPACK( const blacs::Desc& desc, Ring* buffer );
+    void LockedAttachScaLAPACK( const blacs::Desc& desc, const Ring* buffer );
+#endif
+
     template<typename S,Dist U,Dist V,DistWrap wrap> friend class DistMatrix;
 };
 
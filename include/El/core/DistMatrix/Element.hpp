@@ -86,6 +86,12 @@ public:
     // (Immutable) view of a local matrix's buffer
     void Attach( const El::Grid& grid, El::Matrix<Ring>& A );
     void LockedAttach( const El::Grid& grid, const El::Matrix<Ring>& A );
+    // (Immutable) view of a contiguous submatrix of a matrix with the same
+    // distribution; the alignments, shifts, and local offsets are derived
+    // from the metadata cached in B rather than recomputed from the grid
+    void AttachSubmatrix( type& B, Int i, Int j, Int height, Int width );
+    void LockedAttachSubmatrix
+    ( const type& B, Int i, Int j, Int height, Int width );
 
     // Operator overloading
     // ====================
@@ -146,6 +152,15 @@ private:
     // =====================================
     void ShallowSwap( type& A );
 
+    // Shared implementations of the (locked) attachment routines
+    // ==========================================================
+    void Attach_
+    ( Int height, Int width, const El::Grid& grid,
+      int colAlign, int rowAlign, Ring* buffer, Int ldim, int root,
+      bool locked );
+    void AttachSubmatrix_
+    ( const type& B, Int i, Int j, Int height, Int width, bool locked );
+
     template<typename S> friend class AbstractDistMatrix;
     template<typename S> friend class ElementalMatrix;
     template<typename S> friend class BlockMatrix;
@@ -109,6 +109,22 @@ public:
     const type& operator-=( const elemType& A );
     const type& operator-=( const absType& A );
 
+    // Node-shared storage
+    // ===================
+    // When enabled, redistributions from [MC,MR] and [MR,MC] gather the
+    // matrix once per node (see Grid::NodeComm), and the local matrices of
+    // the processes of each node are views of a single MPI-3 shared-memory
+    // buffer. The local matrix must then be treated as read-only, and
+    // SetNodeShared, ResizeNodeShared, redistributions into the matrix, and
+    // its destruction are collective over the grid. Only packed datatypes
+    // over grids without viewers are supported.
+    void SetNodeShared( bool nodeShared=true );
+    bool NodeShared() const EL_NO_EXCEPT;
+    // Resize within the shared buffer (the contents are not preserved)
+    void ResizeNodeShared( Int height, Int width );
+    // Make the stores of each process visible to the others of its node
+    void SynchronizeNode();
+
     // Basic queries
     // =============
     Dist ColDist()             const EL_NO_EXCEPT override;
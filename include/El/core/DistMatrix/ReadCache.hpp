@@ -0,0 +1,50 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_DISTMATRIX_READCACHE_HPP
+#define EL_DISTMATRIX_READCACHE_HPP
+
+namespace El {
+
+// A read-through cache of the global entries of a distributed matrix for
+// access patterns which would otherwise call AbstractDistMatrix::Get within
+// a loop. Upon the first access to an entry within a panel of columns, the
+// entire panel is gathered into a redundant ([* ,* ]) copy with a single
+// collective, and subsequent accesses to the panel are purely local.
+//
+// As with Get, each access is collective over the grid of the matrix (every
+// process must access the same sequence of entries), but only misses
+// communicate. The matrix must not be modified while the cache is in use
+// unless Invalidate is subsequently called.
+template<typename Ring>
+class DistMatrixReadCache
+{
+public:
+    // A panelWidth of zero selects the current algorithmic blocksize
+    explicit DistMatrixReadCache
+    ( const AbstractDistMatrix<Ring>& A, Int panelWidth=0 );
+
+    Ring Get( Int i, Int j );
+
+    // Discard the cached panels (e.g., after the matrix was modified)
+    void Invalidate();
+
+    // The number of panels which have been gathered
+    Int NumMisses() const EL_NO_EXCEPT;
+
+private:
+    const AbstractDistMatrix<Ring>& A_;
+    Int panelWidth_;
+    vector<Matrix<Ring>> panels_;
+    vector<bool> cached_;
+    Int numMisses_=0;
+};
+
+} // namespace El
+
+#endif // ifndef EL_DISTMATRIX_READCACHE_HPP
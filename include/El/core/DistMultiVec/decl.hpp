@@ -0,0 +1,96 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_DISTMULTIVEC_DECL_HPP
+#define EL_CORE_DISTMULTIVEC_DECL_HPP
+
+namespace El {
+
+// A set of column vectors whose rows are distributed with the same 1D
+// distribution as DistSparseMatrix, so that each process stores a contiguous,
+// column-major block of rows.
+template<typename T>
+class DistMultiVec
+{
+public:
+    // Constructors and destructors
+    DistMultiVec( const El::Grid& grid=El::Grid::Default() );
+    DistMultiVec
+    ( Int height, Int width, const El::Grid& grid=El::Grid::Default() );
+    DistMultiVec( const DistMultiVec<T>& A );
+    ~DistMultiVec();
+
+    // Assignment and reconfiguration
+    // ==============================
+    const DistMultiVec<T>& operator=( const DistMultiVec<T>& A );
+    const DistMultiVec<T>& operator+=( const DistMultiVec<T>& A );
+    const DistMultiVec<T>& operator-=( const DistMultiVec<T>& A );
+    const DistMultiVec<T>& operator*=( T alpha );
+
+    void Empty( bool freeMemory=true );
+    void Resize( Int height, Int width );
+    void SetGrid( const El::Grid& grid );
+
+    // Assembly
+    // --------
+    void Reserve( Int numRemoteEntries );
+    // A passive queue ignores updates to non-local rows
+    void QueueUpdate( Int row, Int col, T value, bool passive=false );
+    void QueueUpdate( const Entry<T>& entry, bool passive=false );
+    // Collective: sends the remote updates to their owners
+    void ProcessQueues();
+
+    // Queries
+    // =======
+
+    // High-level information
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int FirstLocalRow() const EL_NO_EXCEPT;
+    Int LocalHeight() const EL_NO_EXCEPT;
+    El::Matrix<T>& Matrix() EL_NO_EXCEPT;
+    const El::Matrix<T>& LockedMatrix() const EL_NO_EXCEPT;
+
+    // Distribution information
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+    Int Blocksize() const EL_NO_EXCEPT;
+    int RowOwner( Int i ) const EL_NO_RELEASE_EXCEPT;
+    Int GlobalRow( Int iLoc ) const EL_NO_RELEASE_EXCEPT;
+    Int LocalRow( Int i ) const EL_NO_RELEASE_EXCEPT;
+    bool IsLocalRow( Int i ) const EL_NO_RELEASE_EXCEPT;
+
+    // Entrywise manipulation (the global routines are collective)
+    T Get( Int row, Int col ) const;
+    void Set( Int row, Int col, T value );
+    void Set( const Entry<T>& entry );
+    void Update( Int row, Int col, T value );
+    void Update( const Entry<T>& entry );
+
+    T GetLocal( Int localRow, Int col ) const EL_NO_RELEASE_EXCEPT;
+    void SetLocal( Int localRow, Int col, T value ) EL_NO_RELEASE_EXCEPT;
+    void SetLocal( const Entry<T>& localEntry ) EL_NO_RELEASE_EXCEPT;
+    void UpdateLocal( Int localRow, Int col, T value ) EL_NO_RELEASE_EXCEPT;
+    void UpdateLocal( const Entry<T>& localEntry ) EL_NO_RELEASE_EXCEPT;
+
+private:
+    Int height_=0, width_=0;
+
+    // An observing pointer to a pre-existing Grid.
+    const El::Grid* grid_=nullptr;
+
+    Int blocksize_=1;
+    El::Matrix<T> multiVec_;
+
+    vector<Entry<T>> remoteUpdates_;
+
+    void InitializeLocalData();
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_DISTMULTIVEC_DECL_HPP
@@ -103,6 +103,10 @@ public:
     Int Preimage( Int dest ) const;
     void SetImage( Int origin, Int dest );
 
+    // Explicitly set the permutation from the vector of preimages, p, so
+    // that P A = A(p,:), without a (collective) call per entry
+    void SetPreimages( const AbstractDistMatrix<Int>& p );
+
     // Since local image queries require the permutation to already be explicit,
     // calling this routine when the permutation is a swap sequence will throw
     // an error. These routines are [ADVANCED] since they require knowledge of
@@ -179,6 +183,13 @@ private:
     mutable bool implicitSwapOrigins_=true;
     mutable DistMatrix<Int,VC,STAR> swapDests_, swapOrigins_;
 
+    // The net row/column movements, (destination, source), of the swap
+    // sequence and its inverse, which allow for each to be applied with a
+    // single AllToAll rather than one exchange per swap
+    mutable vector<pair<Int,Int>> composedSwaps_, composedInverseSwaps_;
+    mutable bool staleComposition_=true;
+    const vector<pair<Int,Int>>& ComposedSwaps( bool inverse ) const;
+
     // Only used if swapSequence_=false
     // --------------------------------
     mutable DistMatrix<Int,VC,STAR> perm_;
@@ -0,0 +1,173 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_DISTSPARSEMATRIX_DECL_HPP
+#define EL_CORE_DISTSPARSEMATRIX_DECL_HPP
+
+namespace El {
+
+// A precomputed plan for the halo exchange of the distributed sparse
+// matrix-vector product. It depends only on the sparsity pattern, and so it
+// is reused across products until the pattern changes. The ghosts are the
+// non-local columns referenced by the local entries and the halo is the set
+// of local rows of the (column-distributed) vector requested by the other
+// processes.
+struct DistSparseMultMeta
+{
+    bool ready=false;
+
+    // The number of locally-owned columns and of distinct ghost columns
+    Int numLocalCols=0;
+    Int numGhosts=0;
+
+    // The neighbors which own our ghosts, with the counts and offsets of
+    // their (sorted) ghosts
+    vector<int> ghostProcs, ghostSizes, ghostOffs;
+
+    // The neighbors which request our rows, with the counts and offsets of
+    // their requests within haloInds, which holds local row indices
+    vector<int> haloProcs, haloSizes, haloOffs;
+    vector<Int> haloInds;
+
+    // The local index of the column of each local entry, where ghost g is
+    // indexed as numLocalCols+g
+    vector<Int> colOffs;
+
+    // The local rows which only reference locally-owned columns, and which
+    // may therefore be processed while the halo exchange is in flight
+    vector<Int> interiorRows, boundaryRows;
+};
+
+// The rows are distributed with the same 1D distribution as DistGraph (and
+// DistMultiVec), and each process stores its rows in coordinate format.
+template<typename T>
+class DistSparseMatrix
+{
+public:
+    // Constructors and destructors
+    DistSparseMatrix( const El::Grid& grid=El::Grid::Default() );
+    DistSparseMatrix
+    ( Int height, Int width, const El::Grid& grid=El::Grid::Default() );
+    DistSparseMatrix( const DistSparseMatrix<T>& A );
+    ~DistSparseMatrix();
+
+    // Assignment and reconfiguration
+    // ==============================
+
+    // Make a copy
+    const DistSparseMatrix<T>& operator=( const DistSparseMatrix<T>& A );
+
+    // Rescaling
+    const DistSparseMatrix<T>& operator*=( T alpha );
+
+    // Change the matrix size
+    void Empty( bool freeMemory=true );
+    void Resize( Int height, Int width );
+
+    // Change the distribution
+    void SetGrid( const El::Grid& grid );
+
+    // Assembly
+    // --------
+    void Reserve( Int numLocalEntries, Int numRemoteEntries=0 );
+
+    // Safe entry manipulation (collective)
+    void Update( Int row, Int col, T value );
+    void UpdateLocal( Int localRow, Int col, T value );
+    void Zero( Int row, Int col );
+    void ZeroLocal( Int localRow, Int col );
+
+    // Batch updating and zeroing (the queued values are summed). A passive
+    // queue ignores updates to non-local rows.
+    void QueueUpdate( Int row, Int col, T value, bool passive=false );
+    void QueueUpdate( const Entry<T>& entry, bool passive=false );
+    void QueueLocalUpdate( Int localRow, Int col, T value )
+    EL_NO_RELEASE_EXCEPT;
+    void QueueZero( Int row, Int col, bool passive=false );
+    void QueueLocalZero( Int localRow, Int col ) EL_NO_RELEASE_EXCEPT;
+    // Collective: sends the remote updates to their owners
+    void ProcessQueues();
+    void ProcessLocalQueues();
+
+    // Queries
+    // =======
+
+    // High-level information
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int FirstLocalRow() const EL_NO_EXCEPT;
+    Int LocalHeight() const EL_NO_EXCEPT;
+    Int NumLocalEntries() const EL_NO_EXCEPT;
+    Int Capacity() const EL_NO_EXCEPT;
+    bool LocallyConsistent() const EL_NO_EXCEPT;
+
+    El::DistGraph& DistGraph() EL_NO_EXCEPT;
+    const El::DistGraph& LockedDistGraph() const EL_NO_EXCEPT;
+
+    // Distribution information
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+    Int Blocksize() const EL_NO_EXCEPT;
+    int RowOwner( Int i ) const EL_NO_RELEASE_EXCEPT;
+    Int GlobalRow( Int iLoc ) const EL_NO_RELEASE_EXCEPT;
+    Int LocalRow( Int i ) const EL_NO_RELEASE_EXCEPT;
+    bool IsLocalRow( Int i ) const EL_NO_RELEASE_EXCEPT;
+
+    // Detailed local information
+    Int Row( Int localIndex ) const EL_NO_RELEASE_EXCEPT;
+    Int Col( Int localIndex ) const EL_NO_RELEASE_EXCEPT;
+    T Value( Int localIndex ) const EL_NO_RELEASE_EXCEPT;
+    Int RowOffset( Int localRow ) const EL_NO_RELEASE_EXCEPT;
+    Int Offset( Int localRow, Int col ) const EL_NO_RELEASE_EXCEPT;
+    Int NumConnections( Int localRow ) const EL_NO_RELEASE_EXCEPT;
+
+    Int* SourceBuffer() EL_NO_EXCEPT;
+    Int* TargetBuffer() EL_NO_EXCEPT;
+    Int* OffsetBuffer() EL_NO_EXCEPT;
+    T* ValueBuffer() EL_NO_EXCEPT;
+    const Int* LockedSourceBuffer() const EL_NO_EXCEPT;
+    const Int* LockedTargetBuffer() const EL_NO_EXCEPT;
+    const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
+    const T* LockedValueBuffer() const EL_NO_EXCEPT;
+
+    void ForceNumLocalEntries( Int numLocalEntries );
+    void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
+
+    void AssertLocallyConsistent() const;
+
+    // Reordering metadata for the sparse-direct solvers (collective). The
+    // mapped sources are the reordered indices of the local rows, while
+    // mappedTargets holds the reordered indices of the unique local columns
+    // and colOffs[e] the position of the column of local entry e within it.
+    void MappedSources
+    ( const DistMap& reordering, vector<Int>& mappedSources ) const;
+    void MappedTargets
+    ( const DistMap& reordering,
+      vector<Int>& mappedTargets,
+      vector<Int>& colOffs ) const;
+
+    // Return the halo-exchange plan for Multiply, rebuilding it if the
+    // sparsity pattern changed on any process (collective)
+    const DistSparseMultMeta& InitializeMultMeta() const;
+
+private:
+    El::DistGraph distGraph_;
+    vector<T> vals_;
+
+    vector<T> remoteVals_;
+    vector<pair<Int,Int>> markedForZero_;
+    vector<pair<Int,Int>> remoteZeros_;
+
+    mutable DistSparseMultMeta multMeta_;
+
+    template<typename U> friend class SparseMatrix;
+    template<typename U> friend class DistSparseMatrix;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_DISTSPARSEMATRIX_DECL_HPP
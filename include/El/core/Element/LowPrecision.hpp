@@ -0,0 +1,179 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_ELEMENT_LOWPRECISION_HPP
+#define EL_ELEMENT_LOWPRECISION_HPP
+
+namespace El {
+
+// Sixteen-bit storage formats
+// ===========================
+// Half is the IEEE 754 binary16 format (5 exponent and 10 mantissa bits) and
+// BFloat16 is the upper half of a binary32 (8 exponent and 7 mantissa bits).
+// Both are storage-only: they implicitly widen to float, all arithmetic is
+// performed in single precision, and the result is rounded to the nearest
+// representable value (ties to even) when it is stored. They are meant for
+// halving the memory and communication of matrices whose entries are only
+// needed to a few digits (e.g., random sketches and the low-precision
+// factorizations of mixed-precision refinement), with the products
+// accumulated in single precision (see the mixed-precision Gemm).
+
+namespace low_precision {
+
+inline std::uint32_t FloatBits( float alpha ) EL_NO_EXCEPT
+{
+    std::uint32_t bits;
+    std::memcpy( &bits, &alpha, sizeof(bits) );
+    return bits;
+}
+
+inline float BitsToFloat( std::uint32_t bits ) EL_NO_EXCEPT
+{
+    float alpha;
+    std::memcpy( &alpha, &bits, sizeof(alpha) );
+    return alpha;
+}
+
+inline std::uint16_t ToHalfBits( float alpha ) EL_NO_EXCEPT
+{
+    std::uint32_t x = FloatBits( alpha );
+    const std::uint16_t sign = std::uint16_t((x >> 16) & 0x8000);
+    x &= 0x7FFFFFFF;
+    if( x >= 0x7F800000 )
+        // Infinities stay infinite and NaNs stay (quiet) NaNs
+        return sign | 0x7C00 | ( x > 0x7F800000 ? 0x200 : 0 );
+    if( x >= 0x477FF000 )
+        // At least halfway between the largest half (65504) and 2^16
+        return sign | 0x7C00;
+    if( x < 0x38800000 )
+    {
+        // The result is subnormal (or zero), with a unit of 2^-24
+        if( x < 0x33000000 )
+            return sign;
+        const std::uint32_t exponent = x >> 23;
+        const std::uint32_t mantissa = (x & 0x7FFFFF) | 0x800000;
+        const std::uint32_t shift = 126 - exponent;
+        std::uint32_t h = mantissa >> shift;
+        const std::uint32_t rem = mantissa & ((std::uint32_t(1) << shift)-1);
+        const std::uint32_t halfway = std::uint32_t(1) << (shift-1);
+        if( rem > halfway || (rem == halfway && (h & 1)) )
+            ++h;
+        return sign | std::uint16_t(h);
+    }
+    // Rebias the exponent from 127 to 15 (a carry from rounding the
+    // mantissa correctly increments the exponent)
+    std::uint32_t h = (x >> 13) - (std::uint32_t(112) << 10);
+    const std::uint32_t rem = x & 0x1FFF;
+    if( rem > 0x1000 || (rem == 0x1000 && (h & 1)) )
+        ++h;
+    return sign | std::uint16_t(h);
+}
+
+inline float FromHalfBits( std::uint16_t h ) EL_NO_EXCEPT
+{
+    const std::uint32_t sign = std::uint32_t(h & 0x8000) << 16;
+    std::uint32_t exponent = (h >> 10) & 0x1F;
+    std::uint32_t mantissa = h & 0x3FF;
+    if( exponent == 0x1F )
+        return BitsToFloat( sign | 0x7F800000 | (mantissa << 13) );
+    if( exponent == 0 )
+    {
+        if( mantissa == 0 )
+            return BitsToFloat( sign );
+        // Normalize the subnormal
+        exponent = 113;
+        while( !(mantissa & 0x400) )
+        {
+            mantissa <<= 1;
+            --exponent;
+        }
+        mantissa &= 0x3FF;
+        return BitsToFloat( sign | (exponent << 23) | (mantissa << 13) );
+    }
+    return BitsToFloat( sign | ((exponent+112) << 23) | (mantissa << 13) );
+}
+
+inline std::uint16_t ToBFloat16Bits( float alpha ) EL_NO_EXCEPT
+{
+    std::uint32_t bits = FloatBits( alpha );
+    if( (bits & 0x7FFFFFFF) > 0x7F800000 )
+        return std::uint16_t((bits >> 16) | 0x40);
+    bits += 0x7FFF + ((bits >> 16) & 1);
+    return std::uint16_t(bits >> 16);
+}
+
+inline float FromBFloat16Bits( std::uint16_t alpha ) EL_NO_EXCEPT
+{ return BitsToFloat( std::uint32_t(alpha) << 16 ); }
+
+} // namespace low_precision
+
+class Half
+{
+public:
+    Half() = default;
+    Half( float alpha ) EL_NO_EXCEPT
+    : bits_(low_precision::ToHalfBits(alpha)) { }
+
+    operator float() const EL_NO_EXCEPT
+    { return low_precision::FromHalfBits( bits_ ); }
+
+    Half& operator+=( float alpha ) EL_NO_EXCEPT
+    { return *this = float(*this) + alpha; }
+    Half& operator-=( float alpha ) EL_NO_EXCEPT
+    { return *this = float(*this) - alpha; }
+    Half& operator*=( float alpha ) EL_NO_EXCEPT
+    { return *this = float(*this) * alpha; }
+    Half& operator/=( float alpha ) EL_NO_EXCEPT
+    { return *this = float(*this) / alpha; }
+
+    std::uint16_t Bits() const EL_NO_EXCEPT { return bits_; }
+    static Half FromBits( std::uint16_t bits ) EL_NO_EXCEPT
+    {
+        Half alpha;
+        alpha.bits_ = bits;
+        return alpha;
+    }
+
+private:
+    std::uint16_t bits_;
+};
+
+class BFloat16
+{
+public:
+    BFloat16() = default;
+    BFloat16( float alpha ) EL_NO_EXCEPT
+    : bits_(low_precision::ToBFloat16Bits(alpha)) { }
+
+    operator float() const EL_NO_EXCEPT
+    { return low_precision::FromBFloat16Bits( bits_ ); }
+
+    BFloat16& operator+=( float alpha ) EL_NO_EXCEPT
+    { return *this = float(*this) + alpha; }
+    BFloat16& operator-=( float alpha ) EL_NO_EXCEPT
+    { return *this = float(*this) - alpha; }
+    BFloat16& operator*=( float alpha ) EL_NO_EXCEPT
+    { return *this = float(*this) * alpha; }
+    BFloat16& operator/=( float alpha ) EL_NO_EXCEPT
+    { return *this = float(*this) / alpha; }
+
+    std::uint16_t Bits() const EL_NO_EXCEPT { return bits_; }
+    static BFloat16 FromBits( std::uint16_t bits ) EL_NO_EXCEPT
+    {
+        BFloat16 alpha;
+        alpha.bits_ = bits;
+        return alpha;
+    }
+
+private:
+    std::uint16_t bits_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_ELEMENT_LOWPRECISION_HPP
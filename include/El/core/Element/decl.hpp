@@ -36,6 +36,8 @@ template<> std::string TypeName<long int>();
 template<> std::string TypeName<long long int>();
 template<> std::string TypeName<float>();
 template<> std::string TypeName<double>();
+template<> std::string TypeName<Half>();
+template<> std::string TypeName<BFloat16>();
 #ifdef HYDROGEN_HAVE_QD
 template<> std::string TypeName<DoubleDouble>();
 template<> std::string TypeName<QuadDouble>();
@@ -86,6 +88,10 @@ template<> struct IsPacked<float>
 { static const bool value=true; };
 template<> struct IsPacked<double>
 { static const bool value=true; };
+template<> struct IsPacked<Half>
+{ static const bool value=true; };
+template<> struct IsPacked<BFloat16>
+{ static const bool value=true; };
 #ifdef HYDROGEN_HAVE_QD
 template<> struct IsPacked<DoubleDouble>
 { static const bool value=true; };
@@ -152,6 +158,33 @@ template<typename Real> struct PromoteHelper<Complex<Real>>
 
 template<typename Field> using Promote = typename PromoteHelper<Field>::type;
 
+// Decrease the precision (if possible)
+// ------------------------------------
+// Builds without the single-precision instantiations never demote into them,
+// so that the mixed-precision drivers fall back to the working precision
+template<typename Field> struct DemoteHelper { typedef Field type; };
+#ifndef HYDROGEN_NO_FLOAT_INSTANTIATION
+template<> struct DemoteHelper<double> { typedef float type; };
+#endif
+
+#ifdef HYDROGEN_HAVE_QD
+template<> struct DemoteHelper<DoubleDouble> { typedef double type; };
+template<> struct DemoteHelper<QuadDouble> { typedef DoubleDouble type; };
+#endif
+
+#ifdef HYDROGEN_HAVE_QUADMATH
+template<> struct DemoteHelper<Quad> { typedef double type; };
+#endif
+
+template<typename Real> struct DemoteHelper<Complex<Real>>
+{ typedef Complex<typename DemoteHelper<Real>::type> type; };
+#ifdef HYDROGEN_NO_COMPLEX_FLOAT_INSTANTIATION
+template<> struct DemoteHelper<Complex<double>>
+{ typedef Complex<double> type; };
+#endif
+
+template<typename Field> using Demote = typename DemoteHelper<Field>::type;
+
 template<typename S,typename T>
 struct CanCast
 {
@@ -182,6 +215,8 @@ template<> struct IsData<Unsigned> { static const bool value=true; };
 template<> struct IsData<Int> { static const bool value=true; };
 template<> struct IsData<float> { static const bool value=true; };
 template<> struct IsData<double> { static const bool value=true; };
+template<> struct IsData<Half> { static const bool value=true; };
+template<> struct IsData<BFloat16> { static const bool value=true; };
 #ifdef HYDROGEN_HAVE_QD
 template<> struct IsData<DoubleDouble> { static const bool value=true; };
 template<> struct IsData<QuadDouble> { static const bool value=true; };
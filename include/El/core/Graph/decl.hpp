@@ -0,0 +1,93 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_GRAPH_DECL_HPP
+#define EL_CORE_GRAPH_DECL_HPP
+
+namespace El {
+
+// A directed graph stored as a sorted list of (source,target) edges with
+// offsets into the edge list for each source. Edges are queued and become
+// usable after a call to ProcessQueues, which sorts them and removes
+// duplicates.
+class Graph
+{
+public:
+    // Constructors and destructors
+    Graph();
+    Graph( Int numSources );
+    Graph( Int numSources, Int numTargets );
+    Graph( const Graph& graph );
+    // NOTE: This requires that each process own a redundant copy
+    Graph( const DistGraph& graph );
+    ~Graph();
+
+    // Assignment
+    const Graph& operator=( const Graph& graph );
+    const Graph& operator=( const DistGraph& graph );
+
+    // Changing the graph size
+    void Empty( bool freeMemory=true );
+    void Resize( Int numVertices );
+    void Resize( Int numSources, Int numTargets );
+
+    // Assembly
+    void Reserve( Int numEdges );
+    void Connect( Int source, Int target );
+    void Disconnect( Int source, Int target );
+    void QueueConnection( Int source, Int target );
+    void QueueDisconnection( Int source, Int target );
+    void ProcessQueues();
+
+    // High-level information
+    Int NumSources() const EL_NO_EXCEPT;
+    Int NumTargets() const EL_NO_EXCEPT;
+    Int NumEdges() const EL_NO_EXCEPT;
+    Int Capacity() const EL_NO_EXCEPT;
+    bool Consistent() const EL_NO_EXCEPT;
+
+    // Edge information
+    Int Source( Int edge ) const EL_NO_RELEASE_EXCEPT;
+    Int Target( Int edge ) const EL_NO_RELEASE_EXCEPT;
+    Int SourceOffset( Int source ) const EL_NO_RELEASE_EXCEPT;
+    Int Offset( Int source, Int target ) const EL_NO_RELEASE_EXCEPT;
+    Int NumConnections( Int source ) const EL_NO_RELEASE_EXCEPT;
+    bool EdgeExists( Int source, Int target ) const EL_NO_RELEASE_EXCEPT;
+
+    Int* SourceBuffer() EL_NO_EXCEPT;
+    Int* TargetBuffer() EL_NO_EXCEPT;
+    Int* OffsetBuffer() EL_NO_EXCEPT;
+    const Int* LockedSourceBuffer() const EL_NO_EXCEPT;
+    const Int* LockedTargetBuffer() const EL_NO_EXCEPT;
+    const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
+
+    // For filling the edge lists directly (e.g., from a symbolic
+    // factorization) without sorting. The offsets must be filled as well.
+    void ForceNumEdges( Int numEdges );
+    void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
+
+    void AssertConsistent() const;
+
+private:
+    Int numSources_=0, numTargets_=0;
+    vector<Int> sources_, targets_;
+    vector<Int> sourceOffsets_;
+
+    // Edges queued for removal are processed along with the insertions
+    vector<pair<Int,Int>> markedForRemoval_;
+    bool consistent_=true;
+
+    void ComputeSourceOffsets();
+
+    friend class DistGraph;
+    template<typename T> friend class SparseMatrix;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_GRAPH_DECL_HPP
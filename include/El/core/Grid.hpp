@@ -12,12 +12,34 @@
 
 namespace El {
 
+// Parameters of the topology-aware Grid constructor
+struct GridTopologyCtrl
+{
+    // A height of zero requests that it be chosen by
+    // Grid::TopologyAwareHeight
+    int height=0;
+
+    // The cost of communicating a byte between two processes of the same
+    // node relative to that of communicating it between nodes
+    double intraNodeRatio=0.25;
+};
+
 class Grid
 {
 public:
     explicit Grid
     ( mpi::Comm comm=mpi::COMM_WORLD, GridOrder order=COLUMN_MAJOR );
     explicit Grid( mpi::Comm comm, int height, GridOrder order=COLUMN_MAJOR );
+
+    // The processes of 'comm' are renumbered so that those of each node
+    // (as determined by mpi::SplitShared) are contiguous. Each MC (MR)
+    // communicator of a COLUMN_MAJOR (ROW_MAJOR) grid then lies within a
+    // single node whenever the grid height (width) divides the number of
+    // processes of every node. Note that Rank() need not match the rank
+    // within 'comm'.
+    explicit Grid
+    ( mpi::Comm comm, const GridTopologyCtrl& ctrl,
+      GridOrder order=COLUMN_MAJOR );
     ~Grid();
 
     // Simple interface (simpler version of distributed-based interface)
@@ -84,6 +106,28 @@ public:
     EL_NO_RELEASE_EXCEPT;
     int VCToViewing( int VCRank ) const EL_NO_EXCEPT;
 
+    // A reusable workspace for the packing buffers of redistributions
+    Arena& CommArena() const EL_NO_EXCEPT;
+
+    // The processes of the grid which share memory with this one (see
+    // mpi::SplitShared), ordered by their VC ranks. The nodes themselves are
+    // ordered by the smallest VC rank of each, and the first process of each
+    // node belongs to the NodeLeaderComm (which is mpi::COMM_NULL elsewhere).
+    mpi::Comm NodeComm() const EL_NO_EXCEPT;
+    mpi::Comm NodeLeaderComm() const EL_NO_EXCEPT;
+    int NodeRank() const EL_NO_RELEASE_EXCEPT;
+    int NodeSize() const EL_NO_RELEASE_EXCEPT;
+    int NumNodes() const EL_NO_EXCEPT;
+    int Node() const EL_NO_RELEASE_EXCEPT;
+    int Node( int vcRank ) const EL_NO_EXCEPT;
+    // The position of a process when the grid is ordered node by node, and
+    // the position of the first process of each node (with
+    // NodeOffset(NumNodes()) equal to Size())
+    int NodeSlot( int vcRank ) const EL_NO_EXCEPT;
+    int NodeOffset( int node ) const EL_NO_EXCEPT;
+    // A reusable buffer shared by the processes of this node
+    mpi::SharedWindow& NodeWorkspace() const;
+
 #ifdef EL_HAVE_SCALAPACK
     // TODO(poulson): More distribution contexts and handles
     int BlacsVCHandle() const;
@@ -93,11 +137,36 @@ public:
 
     static int DefaultHeight( int gridSize ) EL_NO_EXCEPT;
 
-    // To be used internally by Elemental
+    // The divisor of gridSize which minimizes the modeled per-process
+    // communication volume of a SUMMA-like update,
+    //
+    //   w_MR / height + w_MC / width,
+    //
+    // where the weight of each communicator is intraNodeRatio if it lies
+    // within a node of a grid whose consecutive ranks are packed onto nodes
+    // of (a multiple of) procsPerNode processes, and one otherwise. Ties
+    // are broken in favor of the smaller height, so that, without any
+    // topology information, this matches DefaultHeight.
+    static int TopologyAwareHeight
+    ( int gridSize, int procsPerNode, GridOrder order=COLUMN_MAJOR,
+      double intraNodeRatio=0.25 ) EL_NO_EXCEPT;
+
+    // Grids spanning at least this many nodes perform the collectives over
+    // their communicators in two levels (see
+    // mpi::EnableHierarchicalCollectives); zero disables this. The setting
+    // only affects grids constructed afterwards.
+    static void SetHierarchicalThreshold( int numNodes ) EL_NO_EXCEPT;
+    static int HierarchicalThreshold() EL_NO_EXCEPT;
+
+    // To be used internally by Elemental. The default and trivial grids are
+    // constructed upon their first request (which, for the default grid, is
+    // collective over mpi::COMM_WORLD) rather than within El::Initialize.
     static void InitializeDefault();
     static void InitializeTrivial();
     static void FinalizeDefault();
     static void FinalizeTrivial();
+    static bool HaveDefault() EL_NO_EXCEPT;
+    static bool HaveTrivial() EL_NO_EXCEPT;
     static const Grid& Default() EL_NO_RELEASE_EXCEPT;
     static const Grid& Trivial() EL_NO_RELEASE_EXCEPT;
 
@@ -107,8 +176,9 @@ private:
     bool inGrid_;
     GridOrder order_;
 
-    static Grid* defaultGrid;
-    static Grid* trivialGrid;
+    static std::atomic<Grid*> defaultGrid;
+    static std::atomic<Grid*> trivialGrid;
+    static int hierarchicalThreshold;
 
     vector<int> diagsAndRanks_;
     vector<int> vcToViewing_;
@@ -121,19 +191,26 @@ private:
               cartComm_,
               mcComm_, mrComm_,
               mdComm_, mdPerpComm_,
-              vcComm_, vrComm_;
+              vcComm_, vrComm_,
+              nodeComm_, nodeLeaderComm_;
 
     int viewingRank_,
         owningRank_,
         mcRank_, mrRank_,
         mdRank_, mdPerpRank_,
-        vcRank_, vrRank_;
+        vcRank_, vrRank_,
+        nodeRank_;
+
+    vector<int> vcToNode_, nodeSlots_, nodeOffsets_;
 
 #ifdef EL_HAVE_SCALAPACK
     int blacsVCHandle_, blacsVRHandle_;
     int blacsMCMRContext_;
 #endif
 
+    mutable Arena commArena_;
+    mutable std::unique_ptr<mpi::SharedWindow> nodeWorkspace_;
+
     void SetUpGrid();
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
@@ -184,6 +261,16 @@ inline bool GridCompare
     return true;
 }
 
+// The tuned blocksize of a distributed routine over a problem of the given
+// (global) size, whose local size is taken relative to the grid height
+template<typename T>
+Int TunedBlocksize( const string& routine, Int size, const Grid& grid )
+{
+    const int height = grid.Height();
+    return TunedBlocksize<T>
+    ( routine, (size+height-1)/height, height, grid.Width() );
+}
+
 } // namespace El
 
 #endif // ifndef EL_GRID_HPP
@@ -126,6 +126,34 @@ public:
     void SetViewType( El::ViewType viewType ) EL_NO_EXCEPT;
     El::ViewType ViewType() const EL_NO_EXCEPT;
 
+    // The huge page and NUMA policy for subsequent (re)allocations
+    void SetAllocationPolicy( const El::AllocationPolicy& policy );
+    const El::AllocationPolicy& AllocationPolicy() const EL_NO_EXCEPT;
+    // The space of the owned buffer (views are assumed to be of host memory)
+    El::MemorySpace MemorySpace() const EL_NO_EXCEPT;
+
+    // Copy-on-write
+    // -------------
+    // When CopyOnWrite() is enabled, copying an owning matrix into another
+    // owning matrix shares the underlying buffer rather than duplicating it.
+    // Each sharer transparently calls Detach (which makes a private copy of
+    // the entries if the buffer is still shared) before returning mutable
+    // access through Buffer, Ref, Set, Update, etc. Pointers and views
+    // obtained before a buffer was shared are not tracked: a mutable pointer
+    // taken beforehand writes through to every sharer, and a locked view
+    // continues to see the shared entries after a detach.
+    //
+    // Detach should not be called concurrently on the same matrix, so a
+    // shared matrix should be detached before being written to in parallel.
+    bool Shared() const EL_NO_EXCEPT;
+    void Detach();
+
+    // Take on the dimensions of A and share its buffer if both matrices are
+    // owners, returning whether or not the buffer was shared. Since this is
+    // how distributed copies share their local buffers, the dimensions of a
+    // fixed-size matrix are not protected.
+    bool ShareWith( const Matrix<Ring>& A );
+
     // Single-entry manipulation
     // =========================
     Ring Get( Int i, Int j=0 ) const EL_NO_RELEASE_EXCEPT;
@@ -175,7 +203,11 @@ private:
     El::ViewType viewType_=OWNER;
     Int height_=0, width_=0, leadingDimension_=1;
 
-    Memory<Ring> memory_;
+    // The (possibly shared) buffer of an owning matrix, which is lazily
+    // allocated
+    shared_ptr<Memory<Ring>> memory_;
+    // Whether 'memory_' might still be referenced by another matrix
+    mutable bool shared_=false;
     // Const-correctness is internally managed to avoid the need for storing
     // two separate pointers with different 'const' attributes
     Ring* data_=nullptr;
@@ -187,6 +219,9 @@ private:
     // Reconfigure without error-checking
     // ==================================
     void Empty_( bool freeMemory=true );
+    // Ensure that an unshared buffer of at least the given size is owned
+    // (without preserving its entries)
+    void Require_( Int size );
     void Resize_( Int height, Int width );
     void Resize_( Int height, Int width, Int leadingDimension );
 
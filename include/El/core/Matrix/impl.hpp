@@ -26,8 +26,7 @@ Matrix<Ring>::Matrix( Int height, Int width )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(AssertValidDimensions( height, width ))
-    memory_.Require( leadingDimension_ * width );
-    data_ = memory_.Buffer();
+    Require_( leadingDimension_ * width );
     // TODO(poulson): Consider explicitly zeroing
 }
 
@@ -37,8 +36,7 @@ Matrix<Ring>::Matrix( Int height, Int width, Int leadingDimension )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(AssertValidDimensions( height, width, leadingDimension ))
-    memory_.Require( leadingDimension*width );
-    data_ = memory_.Buffer();
+    Require_( leadingDimension*width );
 }
 
 template<typename Ring>
@@ -77,8 +75,11 @@ template<typename Ring>
 Matrix<Ring>::Matrix( Matrix<Ring>&& A ) EL_NO_EXCEPT
 : viewType_(A.viewType_),
   height_(A.height_), width_(A.width_), leadingDimension_(A.leadingDimension_),
-  memory_(std::move(A.memory_)), data_(nullptr)
-{ std::swap( data_, A.data_ ); }
+  memory_(std::move(A.memory_)), shared_(A.shared_), data_(nullptr)
+{
+    std::swap( data_, A.data_ );
+    A.shared_ = false;
+}
 
 template<typename Ring>
 Matrix<Ring>::~Matrix() { }
@@ -249,7 +250,8 @@ Matrix<Ring>& Matrix<Ring>::operator=( Matrix<Ring>&& A )
     }
     else
     {
-        memory_.ShallowSwap( A.memory_ );
+        memory_.swap( A.memory_ );
+        std::swap( shared_, A.shared_ );
         std::swap( data_, A.data_ );
         viewType_ = A.viewType_;
         height_ = A.height_;
@@ -300,7 +302,8 @@ template<typename Ring>
 Int Matrix<Ring>::LDim() const EL_NO_EXCEPT { return leadingDimension_; }
 
 template<typename Ring>
-Int Matrix<Ring>::MemorySize() const EL_NO_EXCEPT { return memory_.Size(); }
+Int Matrix<Ring>::MemorySize() const EL_NO_EXCEPT
+{ return memory_ ? memory_->Size() : 0; }
 
 template<typename Ring>
 Int Matrix<Ring>::DiagonalLength( Int offset ) const EL_NO_EXCEPT
@@ -314,6 +317,8 @@ Ring* Matrix<Ring>::Buffer() EL_NO_RELEASE_EXCEPT
       if( Locked() )
           LogicError("Cannot return non-const buffer of locked Matrix");
     )
+    if( shared_ )
+        Detach();
     return data_;
 }
 
@@ -327,6 +332,8 @@ Ring* Matrix<Ring>::Buffer( Int i, Int j ) EL_NO_RELEASE_EXCEPT
     )
     if( data_ == nullptr )
         return nullptr;
+    if( shared_ )
+        Detach();
     if( i == END ) i = height_ - 1;
     if( j == END ) j = width_ - 1;
     return &data_[i+j*leadingDimension_];
@@ -374,6 +381,87 @@ template<typename Ring>
 El::ViewType Matrix<Ring>::ViewType() const EL_NO_EXCEPT
 { return viewType_; }
 
+template<typename Ring>
+void Matrix<Ring>::SetAllocationPolicy( const El::AllocationPolicy& policy )
+{
+    EL_DEBUG_CSE
+    // Avoid changing the policy of a buffer held by another matrix
+    if( shared_ )
+        Detach();
+    if( !memory_ )
+        memory_ = std::make_shared<Memory<Ring>>();
+    memory_->SetPolicy( policy );
+}
+
+template<typename Ring>
+const El::AllocationPolicy& Matrix<Ring>::AllocationPolicy() const EL_NO_EXCEPT
+{ return memory_ ? memory_->Policy() : DefaultAllocationPolicy(); }
+
+template<typename Ring>
+El::MemorySpace Matrix<Ring>::MemorySpace() const EL_NO_EXCEPT
+{ return !Viewing() && memory_ ? memory_->Space() : HOST_MEMORY; }
+
+// Copy-on-write
+// =============
+
+template<typename Ring>
+bool Matrix<Ring>::Shared() const EL_NO_EXCEPT
+{ return shared_ && memory_.use_count() > 1; }
+
+template<typename Ring>
+void Matrix<Ring>::Detach()
+{
+    EL_DEBUG_CSE
+    if( !shared_ )
+        return;
+    shared_ = false;
+    // The last remaining sharer can simply take over the buffer
+    if( memory_.use_count() == 1 )
+        return;
+
+    auto memory = std::make_shared<Memory<Ring>>();
+    memory->SetPolicy( memory_->Policy() );
+    const Int leadingDimension = Max( height_, 1 );
+    Ring* buffer = memory->Require( leadingDimension*width_ );
+    if( leadingDimension == leadingDimension_ )
+    {
+        MemCopy( buffer, data_, leadingDimension*width_ );
+    }
+    else
+    {
+        for( Int j=0; j<width_; ++j )
+            MemCopy
+            ( &buffer[j*leadingDimension], &data_[j*leadingDimension_],
+              height_ );
+    }
+    memory_ = std::move(memory);
+    data_ = buffer;
+    leadingDimension_ = leadingDimension;
+}
+
+template<typename Ring>
+bool Matrix<Ring>::ShareWith( const Matrix<Ring>& A )
+{
+    EL_DEBUG_CSE
+    if( &A == this )
+        return true;
+    // Only buffers which are owned by A (rather than attached to it) may be
+    // shared, and only with a matrix which will own them
+    if( A.Viewing() || !A.memory_ || A.data_ != A.memory_->Buffer() ||
+        Viewing() || !HostAccessible( A.memory_->Space() ) )
+        return false;
+
+    A.shared_ = true;
+    memory_ = A.memory_;
+    shared_ = true;
+    data_ = A.data_;
+    height_ = A.height_;
+    width_ = A.width_;
+    leadingDimension_ = A.leadingDimension_;
+    viewType_ = static_cast<El::ViewType>( viewType_ & ~LOCKED_VIEW );
+    return true;
+}
+
 // Single-entry manipulation
 // =========================
 
@@ -564,7 +652,8 @@ EL_NO_RELEASE_EXCEPT
 template<typename Ring>
 void Matrix<Ring>::ShallowSwap( Matrix<Ring>& A )
 {
-    memory_.ShallowSwap( A.memory_ );
+    memory_.swap( A.memory_ );
+    std::swap( shared_, A.shared_ );
     std::swap( data_, A.data_ );
     std::swap( viewType_, A.viewType_ );
     std::swap( height_, A.height_ );
@@ -578,8 +667,11 @@ void Matrix<Ring>::ShallowSwap( Matrix<Ring>& A )
 template<typename Ring>
 void Matrix<Ring>::Empty_( bool freeMemory )
 {
-    if( freeMemory )
-        memory_.Empty();
+    if( freeMemory || shared_ )
+    {
+        memory_.reset();
+        shared_ = false;
+    }
     height_ = 0;
     width_ = 0;
     leadingDimension_ = 1;
@@ -591,6 +683,11 @@ template<typename Ring>
 void Matrix<Ring>::Attach_
 ( Int height, Int width, Ring* buffer, Int leadingDimension )
 {
+    if( shared_ )
+    {
+        memory_.reset();
+        shared_ = false;
+    }
     height_ = height;
     width_ = width;
     leadingDimension_ = leadingDimension;
@@ -602,6 +699,11 @@ template<typename Ring>
 void Matrix<Ring>::LockedAttach_
 ( Int height, Int width, const Ring* buffer, Int leadingDimension )
 {
+    if( shared_ )
+    {
+        memory_.reset();
+        shared_ = false;
+    }
     height_ = height;
     width_ = width;
     leadingDimension_ = leadingDimension;
@@ -613,6 +715,11 @@ template<typename Ring>
 void Matrix<Ring>::Control_
 ( Int height, Int width, Ring* buffer, Int leadingDimension )
 {
+    if( shared_ )
+    {
+        memory_.reset();
+        shared_ = false;
+    }
     height_ = height;
     width_ = width;
     leadingDimension_ = leadingDimension;
@@ -642,6 +749,8 @@ template<typename Ring>
 Ring& Matrix<Ring>::Ref( Int i, Int j ) 
 EL_NO_RELEASE_EXCEPT
 {
+    if( shared_ )
+        Detach();
     return data_[i+j*leadingDimension_];
 }
 
@@ -655,6 +764,8 @@ EL_NO_RELEASE_EXCEPT
       if( Locked() )
           LogicError("Cannot modify data of locked matrices");
     )
+    if( shared_ )
+        Detach();
     return data_[i+j*leadingDimension_];
 }
 
@@ -694,6 +805,26 @@ void Matrix<Ring>::AssertValidEntry( Int i, Int j ) const
         ("Out of bounds: (",i,",",j,") of ",Height()," x ",Width()," Matrix");
 }
 
+template<typename Ring>
+void Matrix<Ring>::Require_( Int size )
+{
+    if( !memory_ )
+    {
+        memory_ = std::make_shared<Memory<Ring>>();
+    }
+    else if( shared_ )
+    {
+        shared_ = false;
+        if( memory_.use_count() > 1 )
+        {
+            auto memory = std::make_shared<Memory<Ring>>();
+            memory->SetPolicy( memory_->Policy() );
+            memory_ = std::move(memory);
+        }
+    }
+    data_ = memory_->Require( size );
+}
+
 template<typename Ring>
 void Matrix<Ring>::Resize_( Int height, Int width )
 {
@@ -711,8 +842,7 @@ void Matrix<Ring>::Resize_( Int height, Int width )
     if( reallocate )
     {
         leadingDimension_ = Max( height, 1 );
-        memory_.Require( leadingDimension_ * width );
-        data_ = memory_.Buffer();
+        Require_( leadingDimension_ * width );
     }
 }
 
@@ -727,8 +857,7 @@ void Matrix<Ring>::Resize_( Int height, Int width, Int leadingDimension )
     if( reallocate )
     {
         leadingDimension_ = leadingDimension;
-        memory_.Require(leadingDimension*width);
-        data_ = memory_.Buffer();
+        Require_( leadingDimension*width );
     }
 }
 
@@ -788,6 +917,8 @@ int Matrix<Ring>::RowAlign() const EL_NO_EXCEPT { return 0; }
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#define EL_ENABLE_BFLOAT16
 #include <El/macros/Instantiate.h>
 
 #undef EL_EXTERN
@@ -11,12 +11,198 @@
 
 namespace El {
 
+// An opt-in, pooled workspace allocator for the buffers of packed datatypes.
+// Each thread keeps its own free lists which are bucketed into size classes
+// of at most 25% overhead, and the total number of cached (i.e., free but
+// not returned to the system) bytes is limited by a user-specified cap.
+// The pool can also be enabled at initialization time by setting the
+// environment variable EL_MEMORY_POOL (and optionally EL_MEMORY_POOL_CAP,
+// in bytes).
+struct MemoryPoolStats
+{
+    size_t bytesLive=0;   // bytes currently handed out by the pool
+    size_t bytesPeak=0;   // the high-water mark of 'bytesLive'
+    size_t bytesCached=0; // bytes in the free lists of all threads
+    size_t numRequests=0;
+    size_t numHits=0;
+
+    double HitRate() const
+    { return numRequests==0 ? 0. : double(numHits)/double(numRequests); }
+};
+
+void EnableMemoryPool( bool enable=true );
+void DisableMemoryPool();
+bool MemoryPoolEnabled() EL_NO_EXCEPT;
+
+// The maximum number of bytes that may be cached in the free lists
+void SetMemoryPoolCap( size_t capBytes );
+size_t MemoryPoolCap() EL_NO_EXCEPT;
+
+// Return the free lists of the calling thread to the system
+void EmptyMemoryPool();
+
+MemoryPoolStats GetMemoryPoolStats();
+void ResetMemoryPoolStats();
+
+// Raw allocation/deallocation through the pool. The number of bytes passed
+// to PoolFree must match that of the corresponding PoolAllocate.
+void* PoolAllocate( size_t numBytes );
+void PoolFree( void* ptr, size_t numBytes );
+
+// Tracking of the bytes held by the Memory buffers of this process
+// ================================================================
+// Every Memory allocation is tallied (at the cost of an atomic update) so
+// that the live and peak usage of each process can always be queried. The
+// usage of each region is also recorded while memory tracking is enabled
+// (see EnableMemoryTracking in Trace.hpp).
+struct MemoryStats
+{
+    size_t bytesLive=0; // bytes currently held by Memory buffers
+    size_t bytesPeak=0; // the high-water mark of 'bytesLive'
+};
+
+MemoryStats GetMemoryStats();
+// Reset the high-water mark to the current usage
+void ResetMemoryPeak();
+
+void TrackAllocation( size_t numBytes );
+void TrackDeallocation( size_t numBytes );
+
+// A per-process memory budget which high-level routines consult in order to
+// trade speed for space, e.g., by shrinking their workspaces or choosing
+// iterations with fewer temporaries. If the budget is enforced, Memory
+// allocations which would exceed it throw a RuntimeError rather than risking
+// the process being killed by the system. A budget of zero (the default) is
+// unlimited. The budget can also be set at initialization time through the
+// environment variable EL_MEMORY_BUDGET (in bytes), and enforced by setting
+// EL_MEMORY_BUDGET_ENFORCE.
+void SetMemoryBudget( size_t budgetBytes, bool enforce=false );
+size_t MemoryBudget() EL_NO_EXCEPT;
+bool MemoryBudgetEnforced() EL_NO_EXCEPT;
+
+// The number of bytes which may still be allocated within the budget
+size_t MemoryHeadroom();
+bool FitsMemoryBudget( double numBytes );
+// Throw a RuntimeError if the budget is enforced and would be exceeded
+void CheckMemoryBudget( size_t numBytes );
+
+// The largest count in [minCount,count] such that 'count' units of the given
+// size fit within the headroom (minCount if none does)
+Int BudgetedCount( Int count, double bytesPerUnit, Int minCount=1 );
+
+// Page-level allocation policies for large buffers
+// ================================================
+namespace HugePagePolicyNS {
+enum HugePagePolicy
+{
+    NO_HUGE_PAGES,          // Use whatever pages the system hands out
+    TRANSPARENT_HUGE_PAGES, // Request transparent huge pages via madvise
+    EXPLICIT_HUGE_PAGES     // Map from the hugetlbfs pool (MAP_HUGETLB)
+};
+}
+using namespace HugePagePolicyNS;
+
+namespace NumaPolicyNS {
+enum NumaPolicy
+{
+    NUMA_FIRST_TOUCH, // Defer to the first-touch policy of the system
+    NUMA_INTERLEAVE,  // Interleave the pages across all allowed nodes
+    NUMA_LOCAL        // Bind the pages to the node of the allocating thread
+};
+}
+using namespace NumaPolicyNS;
+
+// Where a buffer resides. Only HOST_MEMORY buffers are allocated by Elemental
+// itself; each of the other spaces requires a registered Allocator (though
+// PINNED_HOST_MEMORY and USER_MEMORY requests silently fall back to the host
+// in its absence).
+namespace MemorySpaceNS {
+enum MemorySpace
+{
+    HOST_MEMORY,        // Standard host memory
+    PINNED_HOST_MEMORY, // Page-locked host memory (e.g., for fast transfers)
+    DEVICE_MEMORY,      // Memory which is not accessible from the host
+    USER_MEMORY         // Host memory from a user-managed arena
+};
+}
+using namespace MemorySpaceNS;
+
+// Whether or not the entries of a buffer in the given space may be directly
+// accessed (and constructed, zeroed, copied, etc.) by the host
+bool HostAccessible( MemorySpace space ) EL_NO_EXCEPT;
+
+struct AllocationPolicy
+{
+    HugePagePolicy hugePages=NO_HUGE_PAGES;
+    NumaPolicy numa=NUMA_FIRST_TOUCH;
+
+    // Buffers smaller than this size are always allocated in the standard
+    // manner (whether or not the memory pool is enabled)
+    size_t minBytes=size_t(1)<<21;
+
+    // The above page-level policies only apply to HOST_MEMORY buffers
+    MemorySpace space=HOST_MEMORY;
+
+    bool IsDefault() const EL_NO_EXCEPT
+    { return hugePages == NO_HUGE_PAGES && numa == NUMA_FIRST_TOUCH; }
+};
+
+// The policy used by all buffers which have not been given their own
+void SetDefaultAllocationPolicy( const AllocationPolicy& policy );
+const AllocationPolicy& DefaultAllocationPolicy() EL_NO_EXCEPT;
+
+// Whether or not a buffer of the given size would be mapped according to
+// the policy (rather than through the standard allocator or the pool)
+bool UsePolicyAllocation
+( size_t numBytes, const AllocationPolicy& policy ) EL_NO_EXCEPT;
+
+// Map/unmap a buffer according to an allocation policy; failure to satisfy
+// the huge page or NUMA requests results in a silent fallback.
+void* PolicyAllocate( size_t numBytes, const AllocationPolicy& policy );
+void PolicyFree( void* ptr, size_t numBytes );
+
+// A user-provided allocator for a (non-host) memory space, e.g., one wrapping
+// cudaMallocHost/cudaFreeHost or a user arena. The allocator must remain
+// registered while any buffer obtained from it is alive.
+struct Allocator
+{
+    function<void*(size_t numBytes)> allocate;
+    function<void(void* ptr,size_t numBytes)> free;
+};
+
+void SetAllocator( MemorySpace space, const Allocator& allocator );
+void ClearAllocator( MemorySpace space );
+bool HaveAllocator( MemorySpace space );
+
+// Allocate/free through the allocator registered for the given space
+void* SpaceAllocate( size_t numBytes, MemorySpace space );
+void SpaceFree( void* ptr, size_t numBytes, MemorySpace space );
+
+// How a particular buffer of a Memory instance was obtained
+namespace MemoryModeNS {
+enum MemoryMode
+{
+    MEMORY_NEW,
+    MEMORY_POOLED,
+    MEMORY_MAPPED,
+    MEMORY_ALLOCATOR,
+    // BigFloat entries sharing a single allocation with their limbs
+    // (see mpfr::SetContiguousLimbs)
+    MEMORY_CONTIGUOUS_LIMBS
+};
+}
+using namespace MemoryModeNS;
+
 template<typename G>
 class Memory
 {
     size_t size_;
     G* rawBuffer_;
     G* buffer_;
+    MemoryMode mode_;
+    MemorySpace space_;
+    AllocationPolicy policy_;
+    bool customPolicy_;
 public:
     Memory();
     Memory( size_t size );
@@ -30,10 +216,18 @@ public:
 
     G* Buffer() const EL_NO_EXCEPT;
     size_t Size() const EL_NO_EXCEPT;
+    // The space of the current buffer
+    MemorySpace Space() const EL_NO_EXCEPT;
 
     G* Require( size_t size );
     void Release();
     void Empty();
+
+    // The policy is applied to all subsequent allocations; it defaults to
+    // DefaultAllocationPolicy() until explicitly set.
+    void SetPolicy( const AllocationPolicy& policy );
+    void SetDefaultPolicy();
+    const AllocationPolicy& Policy() const EL_NO_EXCEPT;
 };
 
 } // namespace El
@@ -11,16 +11,103 @@ namespace El {
 
 namespace {
 
+template<typename G,
+         typename=EnableIf<IsPacked<G>>>
+static G* New
+( size_t size, const AllocationPolicy& policy, MemoryMode& mode )
+{
+    const size_t numBytes = size*sizeof(G);
+    G* ptr;
+    if( policy.space != HOST_MEMORY && HaveAllocator( policy.space ) )
+    {
+        ptr = static_cast<G*>( SpaceAllocate( numBytes, policy.space ) );
+        mode = MEMORY_ALLOCATOR;
+        // Device buffers are opaque to the host
+        if( !HostAccessible( policy.space ) )
+            return ptr;
+    }
+    else if( policy.space == DEVICE_MEMORY )
+    {
+        LogicError("No allocator was registered for device memory");
+    }
+    else if( UsePolicyAllocation( numBytes, policy ) )
+    {
+        ptr = static_cast<G*>( PolicyAllocate( numBytes, policy ) );
+        mode = MEMORY_MAPPED;
+    }
+    else if( MemoryPoolEnabled() )
+    {
+        ptr = static_cast<G*>( PoolAllocate( numBytes ) );
+        mode = MEMORY_POOLED;
+    }
+    else
+    {
+        mode = MEMORY_NEW;
+        return new G[size];
+    }
+    // Preserve the semantics of new[] for types with nontrivial
+    // (e.g., zero-initializing) default constructors
+    if( !std::is_trivially_default_constructible<G>::value )
+        for( size_t i=0; i<size; ++i )
+            new(ptr+i) G();
+    return ptr;
+}
+
 template<typename G>
-static G* New( size_t size )
+static G* NewUnpacked( size_t size, MemoryMode& mode, G* )
 {
+    mode = MEMORY_NEW;
     return new G[size];
 }
+template<typename G>
+static void DeleteUnpacked( G* ptr, size_t size, G* )
+{ delete[] ptr; }
+
+#ifdef HYDROGEN_HAVE_MPC
+inline BigFloat* NewUnpacked( size_t size, MemoryMode& mode, BigFloat* )
+{
+    if( mpfr::ContiguousLimbs() )
+    {
+        mode = MEMORY_CONTIGUOUS_LIMBS;
+        return mpfr::NewContiguous( size );
+    }
+    mode = MEMORY_NEW;
+    return new BigFloat[size];
+}
+inline void DeleteUnpacked( BigFloat* ptr, size_t size, BigFloat* )
+{ mpfr::DeleteContiguous( ptr, size ); }
+#endif
+
+template<typename G,
+         typename=DisableIf<IsPacked<G>>,
+         typename=void>
+static G* New
+( size_t size, const AllocationPolicy& policy, MemoryMode& mode )
+{
+    if( policy.space == DEVICE_MEMORY )
+        LogicError("Only packed datatypes may reside in device memory");
+    return NewUnpacked( size, mode, static_cast<G*>(nullptr) );
+}
 
 template<typename G>
-static void Delete( G*& ptr )
+static void Delete( G*& ptr, size_t size, MemoryMode mode, MemorySpace space )
 {
-    delete[] ptr;
+    // Packed datatypes have trivial destructors, so pooled, mapped, and
+    // user-allocated buffers can be directly released
+    if( ptr != nullptr )
+    {
+        TrackDeallocation( size*sizeof(G) );
+        if( mode == MEMORY_CONTIGUOUS_LIMBS )
+            DeleteUnpacked( ptr, size, static_cast<G*>(nullptr) );
+        else if( mode == MEMORY_ALLOCATOR )
+            SpaceFree( ptr, size*sizeof(G), space );
+        else if( mode == MEMORY_POOLED )
+            PoolFree( ptr, size*sizeof(G) );
+        else if( mode == MEMORY_MAPPED )
+            PolicyFree( ptr, size*sizeof(G) );
+        else
+            delete[] ptr;
+    }
     ptr = nullptr;
 }
 
@@ -28,17 +115,20 @@ static void Delete( G*& ptr )
 
 template<typename G>
 Memory<G>::Memory()
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr), mode_(MEMORY_NEW),
+  space_(HOST_MEMORY), customPolicy_(false)
 { }
 
 template<typename G>
 Memory<G>::Memory( size_t size )
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr), mode_(MEMORY_NEW),
+  space_(HOST_MEMORY), customPolicy_(false)
 { Require( size ); }
 
 template<typename G>
 Memory<G>::Memory( Memory<G>&& mem )
-: size_(mem.size_), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr), mode_(MEMORY_NEW),
+  space_(HOST_MEMORY), customPolicy_(false)
 { ShallowSwap(mem); }
 
 template<typename G>
@@ -51,12 +141,16 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
     std::swap(size_,mem.size_);
     std::swap(rawBuffer_,mem.rawBuffer_);
     std::swap(buffer_,mem.buffer_);
+    std::swap(mode_,mem.mode_);
+    std::swap(space_,mem.space_);
+    std::swap(policy_,mem.policy_);
+    std::swap(customPolicy_,mem.customPolicy_);
 }
 
 template<typename G>
 Memory<G>::~Memory() 
 { 
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_, mode_, space_ );
 }
 
 template<typename G>
@@ -65,20 +159,27 @@ G* Memory<G>::Buffer() const EL_NO_EXCEPT { return buffer_; }
 template<typename G>
 size_t  Memory<G>::Size() const EL_NO_EXCEPT { return size_; }
 
+template<typename G>
+MemorySpace Memory<G>::Space() const EL_NO_EXCEPT { return space_; }
+
 template<typename G>
 G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        Delete( rawBuffer_, size_, mode_, space_ );
+        size_ = 0;
+        CheckMemoryBudget( size*sizeof(G) );
 
 #ifndef EL_RELEASE
         try {
 #endif
 
             // TODO: Optionally overallocate to force alignment of buffer_
-            rawBuffer_ = New<G>( size );
+            rawBuffer_ = New<G>( size, Policy(), mode_ );
+            TrackAllocation( size*sizeof(G) );
             buffer_ = rawBuffer_;
+            space_ = mode_ == MEMORY_ALLOCATOR ? Policy().space : HOST_MEMORY;
 
             size_ = size;
 #ifndef EL_RELEASE
@@ -94,9 +195,10 @@ G* Memory<G>::Require( size_t size )
         }
 #endif
 #ifdef EL_ZERO_INIT
-        MemZero( buffer_, size_ );
+        if( HostAccessible( space_ ) )
+            MemZero( buffer_, size_ );
 #elif defined(EL_HAVE_VALGRIND)
-        if( EL_RUNNING_ON_VALGRIND )
+        if( EL_RUNNING_ON_VALGRIND && HostAccessible( space_ ) )
             MemZero( buffer_, size_ );
 #endif
     }
@@ -110,11 +212,26 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_, mode_, space_ );
     buffer_ = nullptr;
     size_ = 0;
 }
 
+template<typename G>
+void Memory<G>::SetPolicy( const AllocationPolicy& policy )
+{
+    policy_ = policy;
+    customPolicy_ = true;
+}
+
+template<typename G>
+void Memory<G>::SetDefaultPolicy()
+{ customPolicy_ = false; }
+
+template<typename G>
+const AllocationPolicy& Memory<G>::Policy() const EL_NO_EXCEPT
+{ return customPolicy_ ? policy_ : DefaultAllocationPolicy(); }
+
 #ifdef EL_INSTANTIATE_CORE
 # define EL_EXTERN
 #else
@@ -127,6 +244,8 @@ void Memory<G>::Empty()
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#define EL_ENABLE_BFLOAT16
 #include <El/macros/Instantiate.h>
 
 #undef EL_EXTERN
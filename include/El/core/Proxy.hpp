@@ -168,6 +168,70 @@ struct ElementalProxyCtrl
     { }
 };
 
+namespace proxy {
+
+// The representative of the class of distributions which assign each process
+// the same indices as U does over the given grid, e.g., every distribution
+// other than CIRC is equivalent to STAR over a 1 x 1 grid and [MC,* ] is
+// equivalent to [VC,* ] over a p x 1 grid
+inline Dist EquivalentDist( Dist U, const Grid& g ) EL_NO_EXCEPT
+{
+    const int height = g.Height();
+    const int width = g.Width();
+    if( U == CIRC )
+        return CIRC;
+    if( g.Size() == 1 )
+        return STAR;
+    switch( U )
+    {
+    case MC: return ( height == 1 ? STAR : width == 1 ? VC : MC );
+    case MR: return ( width == 1 ? STAR : height == 1 ? VC : MR );
+    case VR: return ( height == 1 || width == 1 ? VC : VR );
+    default: return U;
+    }
+}
+
+// Whether the local data of A can be directly viewed as a [U,V] matrix which
+// satisfies the alignment constraints of ctrl
+template<Dist U,Dist V,typename T>
+bool CanView( const AbstractDistMatrix<T>& A, const ElementalProxyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Wrap() != ELEMENT )
+        return false;
+    const Grid& g = A.Grid();
+    const Dist colDist = EquivalentDist( U, g );
+    const Dist rowDist = EquivalentDist( V, g );
+    if( colDist == CIRC || rowDist == CIRC ||
+        colDist != EquivalentDist( A.ColDist(), g ) ||
+        rowDist != EquivalentDist( A.RowDist(), g ) )
+        return false;
+    const bool colMisalign = ( colDist != STAR && ctrl.colConstrain &&
+                               A.ColAlign() != ctrl.colAlign );
+    const bool rowMisalign = ( rowDist != STAR && ctrl.rowConstrain &&
+                               A.RowAlign() != ctrl.rowAlign );
+    return !colMisalign && !rowMisalign;
+}
+
+// The alignments of a [U,V] view of the local data of A
+template<Dist U,Dist V,typename T>
+std::pair<int,int> ViewAlignments
+( const AbstractDistMatrix<T>& A, const ElementalProxyCtrl& ctrl )
+{
+    const Grid& g = A.Grid();
+    const bool colTrivial = ( EquivalentDist( U, g ) == STAR );
+    const bool rowTrivial = ( EquivalentDist( V, g ) == STAR );
+    const int colAlign =
+      ( colTrivial ? ( ctrl.colConstrain ? ctrl.colAlign : 0 )
+                   : A.ColAlign() );
+    const int rowAlign =
+      ( rowTrivial ? ( ctrl.rowConstrain ? ctrl.rowAlign : 0 )
+                   : A.RowAlign() );
+    return std::make_pair( colAlign, rowAlign );
+}
+
+} // namespace proxy
+
 template<typename S,typename T,Dist U=MC,Dist V=MR,DistWrap wrap=ELEMENT,
          typename=EnableIf<CanCast<S,T>>>
 class DistMatrixReadProxy; 
@@ -252,6 +316,18 @@ public:
                 return;
             }
         }
+        if( proxy::CanView<U,V>( A, ctrl ) )
+        {
+            // The local data of A is already laid out as required
+            locked_ = true;
+            madeCopy_ = true;
+            const auto aligns = proxy::ViewAlignments<U,V>( A, ctrl );
+            prox_ = new proxType(A.Grid());
+            prox_->LockedAttach
+            ( A.Height(), A.Width(), A.Grid(), aligns.first, aligns.second,
+              A.LockedMatrix(), ctrl.rootConstrain ? ctrl.root : A.Root() );
+            return;
+        }
         locked_ = false;
         madeCopy_ = true;
         prox_ = new proxType(A.Grid());
@@ -290,6 +366,26 @@ public:
                 return;
             }
         }
+        if( proxy::CanView<U,V>( A, ctrl ) )
+        {
+            // The local data of A is already laid out as required
+            madeCopy_ = true;
+            const auto aligns = proxy::ViewAlignments<U,V>( A, ctrl );
+            const int root = ( ctrl.rootConstrain ? ctrl.root : A.Root() );
+            prox_ = new proxType(A.Grid());
+            if( A.Locked() )
+            {
+                locked_ = true;
+                prox_->LockedAttach
+                ( A.Height(), A.Width(), A.Grid(),
+                  aligns.first, aligns.second, A.LockedMatrix(), root );
+            }
+            else
+                prox_->Attach
+                ( A.Height(), A.Width(), A.Grid(),
+                  aligns.first, aligns.second, A.Matrix(), root );
+            return;
+        }
         madeCopy_ = true;
         prox_ = new proxType(A.Grid());
         if( ctrl.rootConstrain )
@@ -734,6 +830,7 @@ private:
     typedef DistMatrix<T,U,V,ELEMENT> proxType;
 
     bool madeCopy_;
+    bool viewing_;
     AbstractDistMatrix<T>& orig_;
     proxType* prox_;
 
@@ -742,7 +839,7 @@ public:
     DistMatrixReadWriteProxy
     ( AbstractDistMatrix<T>& A,
       const ElementalProxyCtrl& ctrl=ElementalProxyCtrl() )
-    : orig_(A)
+    : viewing_(false), orig_(A)
     { 
         if( A.ColDist() == U && A.RowDist() == V && A.Wrap() == ELEMENT )
         {
@@ -765,6 +862,19 @@ public:
                 return;
             }
         }
+        if( proxy::CanView<U,V>( A, ctrl ) )
+        {
+            // The local data of A is already laid out as required, so it can
+            // be modified in place
+            madeCopy_ = true;
+            viewing_ = true;
+            const auto aligns = proxy::ViewAlignments<U,V>( A, ctrl );
+            prox_ = new proxType(A.Grid());
+            prox_->Attach
+            ( A.Height(), A.Width(), A.Grid(), aligns.first, aligns.second,
+              A.Matrix(), ctrl.rootConstrain ? ctrl.root : A.Root() );
+            return;
+        }
         madeCopy_ = true;
         prox_ = new proxType(A.Grid());
         if( ctrl.rootConstrain )
@@ -780,7 +890,7 @@ public:
     { 
         if( madeCopy_ )
         {
-            if( !uncaught_exception() )
+            if( !viewing_ && !uncaught_exception() )
                 Copy( *prox_, orig_ );
             delete prox_;
         }
@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SIMPLEBUFFER_HPP
+#define EL_SIMPLEBUFFER_HPP
+
+namespace El {
+
+// A minimal, vector-like workspace buffer (e.g., for the packing buffers of
+// redistributions) which, unlike std::vector, is allocated through
+// Memory<T> and therefore respects the memory pool and allocation policies.
+// If an arena is provided, the storage for packed datatypes is instead
+// drawn from said arena. As with FastResize, the entries are not
+// initialized for packed datatypes.
+template<typename T>
+class SimpleBuffer
+{
+public:
+    SimpleBuffer() { }
+    explicit SimpleBuffer( size_t size ) { resize( size ); }
+    explicit SimpleBuffer( Arena& arena ) : arena_(&arena) { }
+    SimpleBuffer( size_t size, Arena& arena ) : arena_(&arena)
+    { resize( size ); }
+
+    ~SimpleBuffer() { clear(); }
+
+    void resize( size_t size )
+    {
+        if( arena_ != nullptr && IsPacked<T>::value )
+        {
+            if( size > capacity_ )
+            {
+                arena_->Pop( reinterpret_cast<byte*>(data_) );
+                data_ = reinterpret_cast<T*>( arena_->Push( size*sizeof(T) ) );
+                capacity_ = size;
+            }
+        }
+        else
+            data_ = memory_.Require( size );
+        size_ = size;
+    }
+
+    void clear()
+    {
+        if( arena_ != nullptr && IsPacked<T>::value )
+            arena_->Pop( reinterpret_cast<byte*>(data_) );
+        else
+            memory_.Empty();
+        data_ = nullptr;
+        size_ = capacity_ = 0;
+    }
+
+    T* data() EL_NO_EXCEPT { return data_; }
+    const T* data() const EL_NO_EXCEPT { return data_; }
+    size_t size() const EL_NO_EXCEPT { return size_; }
+    bool empty() const EL_NO_EXCEPT { return size_ == 0; }
+
+    // NOTE: The one-past-the-end entry may be referenced in order to form
+    //       the address of an empty portion of the buffer
+    T& operator[]( size_t i ) EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_ONLY(
+          if( i > size_ )
+              LogicError("Index ",i," out of bounds of buffer of size ",size_);
+        )
+        return data_[i];
+    }
+    const T& operator[]( size_t i ) const EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_ONLY(
+          if( i > size_ )
+              LogicError("Index ",i," out of bounds of buffer of size ",size_);
+        )
+        return data_[i];
+    }
+
+    void SetPolicy( const AllocationPolicy& policy )
+    { memory_.SetPolicy( policy ); }
+
+private:
+    Memory<T> memory_;
+    Arena* arena_=nullptr;
+    T* data_=nullptr;
+    size_t size_=0, capacity_=0;
+
+    // Disable copying (an arena-backed buffer must be released exactly once)
+    SimpleBuffer( const SimpleBuffer<T>& );
+    const SimpleBuffer<T>& operator=( const SimpleBuffer<T>& );
+};
+
+template<typename T>
+void FastResize( SimpleBuffer<T>& buffer, Int numEntries )
+{ buffer.resize( numEntries ); }
+
+} // namespace El
+
+#endif // ifndef EL_SIMPLEBUFFER_HPP
@@ -0,0 +1,130 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SMALLMATRIX_HPP
+#define EL_SMALLMATRIX_HPP
+
+namespace El {
+
+// A column-major M x N matrix whose dimensions are known at compile time and
+// whose entries live on the stack (e.g., the 2x2 pivot blocks of
+// Bunch-Kaufman or the Schur vectors of a 2x2 bulge). Since every loop bound
+// is a constant, the kernels below are fully unrolled by the compiler, and
+// no allocation or dimension bookkeeping is performed. The entries are not
+// initialized for packed datatypes.
+template<typename T,Int M,Int N>
+class SmallMatrix
+{
+public:
+    static_assert( M > 0 && N > 0, "SmallMatrix dimensions must be positive" );
+
+    SmallMatrix() { }
+
+    // Copy the entries of an M x N Matrix
+    explicit SmallMatrix( const Matrix<T>& A ) { *this = A; }
+
+    SmallMatrix<T,M,N>& operator=( const Matrix<T>& A )
+    {
+        EL_DEBUG_ONLY(
+          if( A.Height() != M || A.Width() != N )
+              LogicError
+              ("Cannot copy a ",A.Height()," x ",A.Width(),
+               " matrix into a ",M," x ",N," SmallMatrix");
+        )
+        const T* ABuf = A.LockedBuffer();
+        const Int ALDim = A.LDim();
+        for( Int j=0; j<N; ++j )
+            for( Int i=0; i<M; ++i )
+                data_[i+j*M] = ABuf[i+j*ALDim];
+        return *this;
+    }
+
+    // Overwrite A with a copy of the entries
+    void CopyTo( Matrix<T>& A ) const
+    {
+        A.Resize( M, N );
+        T* ABuf = A.Buffer();
+        const Int ALDim = A.LDim();
+        for( Int j=0; j<N; ++j )
+            for( Int i=0; i<M; ++i )
+                ABuf[i+j*ALDim] = data_[i+j*M];
+    }
+
+    static constexpr Int Height() EL_NO_EXCEPT { return M; }
+    static constexpr Int Width() EL_NO_EXCEPT { return N; }
+    static constexpr Int LDim() EL_NO_EXCEPT { return M; }
+
+    T* Buffer() EL_NO_EXCEPT { return data_; }
+    const T* LockedBuffer() const EL_NO_EXCEPT { return data_; }
+
+    T& operator()( Int i, Int j ) EL_NO_EXCEPT { return data_[i+j*M]; }
+    const T& operator()( Int i, Int j ) const EL_NO_EXCEPT
+    { return data_[i+j*M]; }
+
+    void Zero() EL_NO_EXCEPT
+    {
+        for( Int k=0; k<M*N; ++k )
+            data_[k] = T(0);
+    }
+
+private:
+    T data_[M*N];
+};
+
+template<typename T,Int M,Int K,Int N>
+SmallMatrix<T,M,N>
+operator*( const SmallMatrix<T,M,K>& A, const SmallMatrix<T,K,N>& B )
+EL_NO_EXCEPT
+{
+    SmallMatrix<T,M,N> C;
+    C.Zero();
+    for( Int j=0; j<N; ++j )
+        for( Int l=0; l<K; ++l )
+            for( Int i=0; i<M; ++i )
+                C(i,j) += A(i,l)*B(l,j);
+    return C;
+}
+
+template<typename T,Int M,Int N>
+void Transpose
+( const SmallMatrix<T,M,N>& A, SmallMatrix<T,N,M>& B, bool conjugate=false )
+EL_NO_EXCEPT
+{
+    for( Int j=0; j<N; ++j )
+        for( Int i=0; i<M; ++i )
+            B(j,i) = ( conjugate ? Conj(A(i,j)) : A(i,j) );
+}
+
+template<typename T,Int M,Int N>
+void Adjoint( const SmallMatrix<T,M,N>& A, SmallMatrix<T,N,M>& B )
+EL_NO_EXCEPT
+{ Transpose( A, B, true ); }
+
+template<typename T,Int N>
+void MakeSymmetric
+( UpperOrLower uplo, SmallMatrix<T,N,N>& A, bool conjugate=false )
+EL_NO_EXCEPT
+{
+    if( conjugate )
+        for( Int j=0; j<N; ++j )
+            A(j,j) = RealPart(A(j,j));
+    for( Int j=0; j<N; ++j )
+    {
+        for( Int i=j+1; i<N; ++i )
+        {
+            if( uplo == LOWER )
+                A(j,i) = ( conjugate ? Conj(A(i,j)) : A(i,j) );
+            else
+                A(i,j) = ( conjugate ? Conj(A(j,i)) : A(j,i) );
+        }
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_SMALLMATRIX_HPP
@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_SPARSEMATRIX_DECL_HPP
+#define EL_CORE_SPARSEMATRIX_DECL_HPP
+
+namespace El {
+
+// A coordinate-format sparse matrix whose nonzero pattern is stored as a Graph
+// (with rows as sources and columns as targets). Queued updates with the same
+// coordinates are summed by ProcessQueues.
+template<typename T>
+class SparseMatrix
+{
+public:
+    // Constructors and destructors
+    SparseMatrix();
+    SparseMatrix( Int height, Int width );
+    SparseMatrix( const SparseMatrix<T>& A );
+    // NOTE: This requires that each process own a redundant copy
+    SparseMatrix( const DistSparseMatrix<T>& A );
+    ~SparseMatrix();
+
+    // Assignment and reconfiguration
+    // ==============================
+
+    // Making a copy
+    const SparseMatrix<T>& operator=( const SparseMatrix<T>& A );
+    const SparseMatrix<T>& operator=( const DistSparseMatrix<T>& A );
+
+    // Rescaling
+    const SparseMatrix<T>& operator*=( T alpha );
+
+    // Change the matrix size
+    void Empty( bool freeMemory=true );
+    void Resize( Int height, Int width );
+
+    // Assembly
+    // --------
+    void Reserve( Int numEntries );
+
+    // Safe entry manipulation
+    void Update( Int row, Int col, T value );
+    void Update( const Entry<T>& entry );
+    void Zero( Int row, Int col );
+
+    // Batch updating and zeroing (these are sums of the queued values)
+    void QueueUpdate( Int row, Int col, T value ) EL_NO_RELEASE_EXCEPT;
+    void QueueUpdate( const Entry<T>& entry ) EL_NO_RELEASE_EXCEPT;
+    void QueueZero( Int row, Int col ) EL_NO_RELEASE_EXCEPT;
+    void ProcessQueues();
+
+    // Queries
+    // =======
+
+    // High-level information
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int NumEntries() const EL_NO_EXCEPT;
+    Int Capacity() const EL_NO_EXCEPT;
+    bool Consistent() const EL_NO_EXCEPT;
+
+    El::Graph& Graph() EL_NO_EXCEPT;
+    const El::Graph& LockedGraph() const EL_NO_EXCEPT;
+
+    // Entrywise information
+    T Get( Int row, Int col ) const EL_NO_RELEASE_EXCEPT;
+    Int Row( Int index ) const EL_NO_RELEASE_EXCEPT;
+    Int Col( Int index ) const EL_NO_RELEASE_EXCEPT;
+    T Value( Int index ) const EL_NO_RELEASE_EXCEPT;
+    Int RowOffset( Int row ) const EL_NO_RELEASE_EXCEPT;
+    Int Offset( Int row, Int col ) const EL_NO_RELEASE_EXCEPT;
+    Int NumConnections( Int row ) const EL_NO_RELEASE_EXCEPT;
+
+    Int* SourceBuffer() EL_NO_EXCEPT;
+    Int* TargetBuffer() EL_NO_EXCEPT;
+    Int* OffsetBuffer() EL_NO_EXCEPT;
+    T* ValueBuffer() EL_NO_EXCEPT;
+    const Int* LockedSourceBuffer() const EL_NO_EXCEPT;
+    const Int* LockedTargetBuffer() const EL_NO_EXCEPT;
+    const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
+    const T* LockedValueBuffer() const EL_NO_EXCEPT;
+
+    // For filling the entries directly (e.g., from a sparse factorization)
+    void ForceNumEntries( Int numEntries );
+    void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
+
+    void AssertConsistent() const;
+
+private:
+    El::Graph graph_;
+    vector<T> vals_;
+
+    // Queued zeroings are processed along with the queued updates
+    vector<pair<Int,Int>> markedForZero_;
+
+    template<typename U> friend class SparseMatrix;
+    template<typename U> friend class DistSparseMatrix;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_SPARSEMATRIX_DECL_HPP
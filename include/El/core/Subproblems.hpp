@@ -0,0 +1,68 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SUBPROBLEMS_HPP
+#define EL_SUBPROBLEMS_HPP
+
+namespace El {
+
+// Concurrent subproblems on disjoint subgrids
+// ===========================================
+// Independent subproblems (e.g., the two halves of a spectral divide and
+// conquer, or separate blocks of right-hand sides) need not be solved one
+// after another over the full grid: each may instead be assigned a subgrid
+// whose number of processes is proportional to its estimated work so that
+// they all proceed at once.
+//
+// A subproblem moves its data onto its subgrid in 'push' (typically by
+// assigning to a DistMatrix which was moved to the subgrid via SetGrid, which
+// translates between the grids) and back again in 'pull'. Both phases are
+// collective over the parent grid and are run for every subproblem in order,
+// whereas 'solve' is only run by the members of the subproblem's subgrid.
+// Since the subgrids are freed before RunSubproblems returns, 'pull' should
+// also release any data which remains on its subgrid.
+struct Subproblem
+{
+    // An estimate of the work (e.g., in flops) of the subproblem
+    double work=1;
+
+    function<void(const Grid& subgrid)> push;
+    function<void(const Grid& subgrid)> solve;
+    function<void()> pull;
+};
+
+struct SubproblemCtrl
+{
+    // If there are more subproblems than processes, several subproblems will
+    // share a single-process subgrid, and their solves may then run
+    // concurrently as futures over this many threads. Such solves should
+    // restrict themselves to sequential (Matrix-based) routines.
+    Int numThreads=1;
+
+    bool progress=false;
+};
+
+// Partition the processes of 'grid' into consecutive groups whose sizes are
+// roughly proportional to the (positive) weights, each with at least one
+// process, and form a grid over each group (with 'grid' as the viewers).
+// There may be no more weights than processes, and the call is collective
+// over 'grid'.
+vector<unique_ptr<Grid>>
+SplitGrid( const Grid& grid, const vector<double>& weights );
+
+// Assign the subproblems to min(numSubproblems,grid.Size()) subgrids -- in
+// order of decreasing work, each to the subgrid with the least work so far --
+// then push, solve, and pull each of them.
+void RunSubproblems
+( const Grid& grid,
+  vector<Subproblem>& subproblems,
+  const SubproblemCtrl& ctrl=SubproblemCtrl() );
+
+} // namespace El
+
+#endif // ifndef EL_SUBPROBLEMS_HPP
@@ -0,0 +1,73 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TASKGRAPH_HPP
+#define EL_TASKGRAPH_HPP
+
+namespace El {
+
+// A dynamically-scheduled directed acyclic graph of tasks
+// =======================================================
+// Each inserted task declares the data (e.g., the tiles of a matrix) which it
+// reads and writes, and the dependencies upon previously-inserted tasks are
+// inferred from the read-after-write, write-after-read, and write-after-write
+// hazards (in the manner of PLASMA/QUARK). The graph is executed by a pool of
+// threads, each of which runs the highest-priority task it has made ready
+// and steals the oldest ready tasks of the others when it runs dry.
+//
+// Since each worker calls sequential (BLAS-backed) kernels, the vendor BLAS
+// should usually be restricted to a single thread while a graph executes.
+class TaskGraph
+{
+public:
+    typedef Int TaskId;
+
+    TaskGraph();
+    ~TaskGraph();
+
+    TaskId Insert
+    ( function<void()> task,
+      const vector<const void*>& reads,
+      const vector<const void*>& writes,
+      Int priority=0 );
+
+    Int NumTasks() const EL_NO_EXCEPT;
+    Int NumEdges() const EL_NO_EXCEPT;
+
+    // Run every task using the given number of threads (including the calling
+    // one, and defaulting to the hardware concurrency) and empty the graph.
+    // The workers inherit the blocksize of the calling thread. If any task
+    // throws, the remaining tasks are skipped and the first exception is
+    // rethrown once the workers have joined.
+    void Execute( Int numThreads=0 );
+
+    void Clear();
+
+private:
+    struct State;
+    std::unique_ptr<State> state_;
+};
+
+// Control structure for the tiled (DAG-scheduled) algorithms
+struct TiledCtrl
+{
+    // The order of each (square) tile; if nonpositive, Blocksize() is used
+    Int tileSize=0;
+
+    // The number of threads; if nonpositive, the hardware concurrency is used
+    Int numThreads=0;
+};
+
+// The boundaries [0,...,n] of a partition of n indices into tiles of the given
+// size, with an additional boundary at 'split' if it lies in (0,n) (e.g., so
+// that the min(m,n) panels of a rectangular factorization are whole tiles)
+vector<Int> TileOffsets( Int n, Int tileSize, Int split=0 );
+
+} // namespace El
+
+#endif // ifndef EL_TASKGRAPH_HPP
@@ -0,0 +1,192 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TRACE_HPP
+#define EL_TRACE_HPP
+
+namespace El {
+
+// A release-mode tracing layer which records a tree of nested regions (e.g.,
+// "LU > Panel") along with the flops and time spent in local BLAS calls and
+// the bytes and time spent in mpi:: calls within each region. When tracing
+// is disabled (the default), each hook reduces to a single branch.
+//
+// Tracing is enabled by EnableTracing or by setting the environment variable
+// EL_TRACE to a filename, in which case the trace is written upon Finalize.
+// The mpi:: hooks also feed the communication profiler (see
+// mpi::EnableProfiling).
+void EnableTracing( bool enable=true );
+void DisableTracing();
+bool TracingEnabled() EL_NO_EXCEPT;
+
+// Regions are also maintained while communication profiling is enabled, as
+// they identify the call sites of mpi:: calls
+void PushTraceRegion( const char* name );
+void PopTraceRegion();
+// The path of the innermost open region (empty if there is none)
+string CurrentTraceRegion();
+void TraceBlas( double numFlops, double seconds );
+// Communication is only recorded for the outermost of nested mpi:: calls.
+// The returned time is spent waiting on the other members of 'comm' (see
+// mpi::EnableProfiling).
+double BeginTraceCommunication( mpi::Comm comm, bool collective );
+void EndTraceCommunication
+( mpi::Comm comm, const char* name, double numBytes, double seconds,
+  double waitSeconds );
+// Discard the recorded events (open regions are kept)
+void ResetTrace();
+
+// Gather the regions of every process in 'comm' and write them from the
+// root in the Chrome trace-event (JSON) format, with one process per rank.
+// The format can be loaded by chrome://tracing and Perfetto, and converted
+// to OTF2.
+void WriteTrace( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+
+// Lightweight per-process counters of the flops performed, and the bytes of
+// memory touched, by the local BLAS and LAPACK wrappers (and their templated
+// fallbacks), aggregated under the outermost open region, i.e., the
+// top-level routine (e.g., "HermitianEig"). Work performed outside of any
+// region is attributed to "Other". Unlike tracing, no calls are timed, and,
+// when the counters are disabled (the default), each hook reduces to a
+// single branch. The byte counts are the minimal traffic of each call, i.e.,
+// each operand is read (and possibly written) once.
+struct PerfCounter
+{
+    string routine;
+    // The number of times the routine was entered as the outermost region
+    Int numCalls=0;
+    double numFlops=0, numBytes=0;
+};
+
+void EnablePerfCounters( bool enable=true );
+void DisablePerfCounters();
+bool PerfCountersEnabled() EL_NO_EXCEPT;
+void CountPerf( double numFlops, double numBytes );
+// The counters of this process, sorted by routine name
+vector<PerfCounter> PerfCounters();
+void ResetPerfCounters();
+
+// The spread of the flop counters of each routine over the processes of
+// 'comm' (a routine which a process never entered counts as zero flops
+// there), e.g., to measure the load imbalance of triangular updates. The
+// call is collective over 'comm' and the results are sorted by routine.
+struct PerfImbalance
+{
+    string routine;
+    double minFlops=0, maxFlops=0, meanFlops=0;
+
+    // The ratio of the maximum to the mean (one if perfectly balanced)
+    double Imbalance() const
+    { return meanFlops == 0 ? 1. : maxFlops/meanFlops; }
+};
+vector<PerfImbalance> PerfCounterImbalance( mpi::Comm comm=mpi::COMM_WORLD );
+
+// Per-region memory usage of this process, recorded from the Memory
+// allocations of the main thread while memory tracking is enabled: the
+// number of bytes allocated within each region (including its subregions)
+// and the peak number of live bytes while it was open (see GetMemoryStats
+// for the totals of the process).
+struct RegionMemory
+{
+    // The path of the region, e.g., "LU > Panel"
+    string region;
+    Int numCalls=0;
+    double bytesAllocated=0;
+    size_t bytesPeak=0;
+};
+
+void EnableMemoryTracking( bool enable=true );
+void DisableMemoryTracking();
+bool MemoryTrackingEnabled() EL_NO_EXCEPT;
+void TraceMemory( size_t numBytes, size_t bytesLive );
+// The usage of each region which has been closed, sorted by path
+vector<RegionMemory> RegionMemoryStats();
+void ResetRegionMemoryStats();
+
+class TraceRegion
+{
+public:
+    explicit TraceRegion( const char* name )
+    : active_(TracingEnabled() || PerfCountersEnabled() ||
+              MemoryTrackingEnabled() || mpi::ProfilingEnabled())
+    { if( active_ ) PushTraceRegion( name ); }
+    ~TraceRegion() { if( active_ ) PopTraceRegion(); }
+private:
+    bool active_;
+};
+
+// Times a local BLAS (or LAPACK) call which performs the given number of
+// flops and touches the given number of bytes of memory
+class TraceBlasCall
+{
+public:
+    explicit TraceBlasCall( double numFlops, double numBytes=0 )
+    : active_(TracingEnabled()), numFlops_(numFlops)
+    {
+        if( PerfCountersEnabled() )
+            CountPerf( numFlops, numBytes );
+        if( active_ ) start_ = Clock::now();
+    }
+    ~TraceBlasCall()
+    {
+        if( active_ )
+            TraceBlas
+            ( numFlops_, duration<double>(Clock::now()-start_).count() );
+    }
+private:
+    bool active_;
+    double numFlops_;
+    Clock::time_point start_;
+};
+
+// Times an MPI call which sends and receives the given number of bytes
+class TraceMpiCall
+{
+public:
+    TraceMpiCall
+    ( const char* name, double numBytes, mpi::Comm comm, bool collective )
+    : active_(TracingEnabled() || mpi::ProfilingEnabled()),
+      name_(name), numBytes_(numBytes), comm_(comm)
+    {
+        if( active_ )
+        {
+            waitSeconds_ = BeginTraceCommunication( comm, collective );
+            start_ = Clock::now();
+        }
+    }
+    ~TraceMpiCall()
+    {
+        if( active_ )
+            EndTraceCommunication
+            ( comm_, name_, numBytes_,
+              duration<double>(Clock::now()-start_).count(), waitSeconds_ );
+    }
+private:
+    bool active_;
+    const char* name_;
+    double numBytes_;
+    mpi::Comm comm_;
+    double waitSeconds_=0;
+    Clock::time_point start_;
+};
+
+} // namespace El
+
+#define EL_TRACE_REGION(name) El::TraceRegion elTraceRegion( name )
+// The byte count is only evaluated when tracing or profiling is enabled
+#define EL_TRACE_MPI_CALL(name,numBytes,comm,collective) \
+  El::TraceMpiCall elTraceMpiCall \
+  ( name, \
+    El::TracingEnabled() || El::mpi::ProfilingEnabled() ? double(numBytes) : 0., \
+    comm, collective )
+#define EL_TRACE_MPI(name,numBytes,comm) \
+  EL_TRACE_MPI_CALL(name,numBytes,comm,true)
+#define EL_TRACE_MPI_P2P(name,numBytes,comm) \
+  EL_TRACE_MPI_CALL(name,numBytes,comm,false)
+
+#endif // ifndef EL_TRACE_HPP
@@ -396,36 +396,10 @@ void View
   Int i, Int j, Int height, Int width )
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      AssertSameDist( A.DistData(), B.DistData() );
-      B.AssertValidSubmatrix( i, j, height, width );
-    )
-    const Int colAlign = B.RowOwner(i);
-    const Int rowAlign = B.ColOwner(j);
-    if( B.Participating() )
-    {
-        const Int iLoc = B.LocalRowOffset(i);
-        const Int jLoc = B.LocalColOffset(j);
-        if( B.Locked() )
-            A.LockedAttach
-            ( height, width, B.Grid(), colAlign, rowAlign, 
-              B.LockedBuffer(iLoc,jLoc), B.LDim(), B.Root() );
-        else
-            A.Attach
-            ( height, width, B.Grid(), colAlign, rowAlign, 
-              B.Buffer(iLoc,jLoc), B.LDim(), B.Root() );
-    }
+    if( B.Locked() )
+        A.LockedAttachSubmatrix( B, i, j, height, width );
     else
-    {
-        if( B.Locked() )
-            A.LockedAttach
-            ( height, width, B.Grid(),
-              colAlign, rowAlign, 0, B.LDim(), B.Root() );
-        else
-            A.Attach
-            ( height, width, B.Grid(),
-              colAlign, rowAlign, 0, B.LDim(), B.Root() );
-    }
+        A.AttachSubmatrix( B, i, j, height, width );
 }
 
 template<typename T>
@@ -435,25 +409,7 @@ void LockedView
   Int i, Int j, Int height, Int width )
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      AssertSameDist( A.DistData(), B.DistData() );
-      B.AssertValidSubmatrix( i, j, height, width );
-    )
-    const Int colAlign = B.RowOwner(i);
-    const Int rowAlign = B.ColOwner(j);
-    if( B.Participating() )
-    {
-        const Int iLoc = B.LocalRowOffset(i);
-        const Int jLoc = B.LocalColOffset(j);
-        A.LockedAttach
-        ( height, width, B.Grid(), colAlign, rowAlign, 
-          B.LockedBuffer(iLoc,jLoc), B.LDim(), B.Root() );
-    }
-    else
-    {
-        A.LockedAttach
-        ( height, width, B.Grid(), colAlign, rowAlign, 0, B.LDim(), B.Root() );
-    }
+    A.LockedAttachSubmatrix( B, i, j, height, width );
 }
 
 template<typename T>
@@ -840,6 +796,8 @@ void LockedView
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#define EL_ENABLE_BFLOAT16
 #include <El/macros/Instantiate.h>
 
 #undef EL_EXTERN
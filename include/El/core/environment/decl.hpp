@@ -84,6 +84,45 @@ T Input( string name, string desc, T defaultVal );
 void ProcessInput();
 void PrintInputReport();
 
+// Per-thread library state
+// ========================
+// The mutable state consulted by the sequential routines -- the blocksize
+// stack, the Mersenne twister returned by Generator(), and the indentation
+// level of Output -- lives in a Context rather than in process-wide globals.
+// Each thread is given its own upon first use (with the default blocksize and
+// a uniquely-seeded generator), so that independent solves over Matrix<F>
+// instances may run concurrently from a thread pool. A Context may also be
+// explicitly installed on the calling thread for the lifetime of a
+// ContextScope, e.g., to reproduce the random numbers of a particular solve.
+struct Context
+{
+    vector<Int> blocksizeStack;
+    std::mt19937 generator;
+    Int indentLevel=0;
+
+    // The default blocksize and a generator seeded from the process seed and
+    // a unique index
+    Context();
+    // The default blocksize and a generator with the given seed
+    explicit Context( unsigned long seed );
+};
+
+// The context of the calling thread
+Context& CurrentContext();
+
+// The seed from which the generators of subsequently-created contexts are
+// derived (set by InitializeRandom)
+void SetContextSeed( unsigned long seed );
+
+class ContextScope
+{
+public:
+    ContextScope( Context& context );
+    ~ContextScope();
+private:
+    Context* previous_;
+};
+
 // For getting and setting the algorithmic blocksize
 Int Blocksize();
 void SetBlocksize( Int blocksize );
@@ -93,6 +132,63 @@ void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 void EmptyBlocksizeStack();
 
+// The minimum number of local entries a level-1 loop must touch before it is
+// split across OpenMP threads (only relevant for hybrid builds). The default
+// can be overridden with the environment variable EL_OMP_GRAIN_SIZE.
+Int ParallelGrainSize();
+void SetParallelGrainSize( Int grainSize );
+
+// Whether the distributed right-looking Cholesky and LU factorizations update
+// and begin redistributing the next panel before the rest of the trailing
+// matrix (a look-ahead of depth one). The default (off) can be overridden with
+// the environment variable EL_FACTOR_LOOKAHEAD.
+bool FactorLookahead();
+void SetFactorLookahead( bool lookahead );
+
+// The maximum number of queued entries each process sends per round of
+// AbstractDistMatrix::ProcessQueues, which bounds the size of the exchange
+// buffers when assembling very large numbers of updates. The default can be
+// overridden with the environment variable EL_QUEUE_ROUND_SIZE.
+Int QueueRoundSize();
+void SetQueueRoundSize( Int roundSize );
+
+// Whether copies of owning matrices share the source's buffer until either
+// is modified (see Matrix::Detach) rather than immediately copying it. The
+// default (off) can be overridden with the environment variable
+// EL_COPY_ON_WRITE.
+bool CopyOnWrite();
+void SetCopyOnWrite( bool copyOnWrite );
+
+// For autotuning the blocksizes of individual routines. Tuned blocksizes are
+// keyed on the routine, the datatype, the local problem size (rounded to the
+// nearest power of two), and the grid shape; queries without an exact match
+// use the nearest tuned local size, and fall back to Blocksize() otherwise.
+// The tuning file named by the environment variable EL_TUNING_FILE is loaded
+// by Initialize (if it exists) and rewritten by each call to TuneBlocksize.
+Int TunedBlocksize
+( const string& routine, const string& datatype,
+  Int localSize, int gridHeight=1, int gridWidth=1 );
+template<typename T>
+Int TunedBlocksize
+( const string& routine, Int localSize, int gridHeight=1, int gridWidth=1 );
+void SetTunedBlocksize
+( const string& routine, const string& datatype,
+  Int localSize, int gridHeight, int gridWidth, Int blocksize );
+void ClearTunedBlocksizes();
+
+// Record the candidate blocksize which minimizes the time returned by
+// 'timeRoutine', which runs the routine while TunedBlocksize returns the
+// candidate. For distributed routines, the returned time should be
+// identical on every process (e.g., the maximum over the grid).
+Int TuneBlocksize
+( const string& routine, const string& datatype,
+  Int localSize, int gridHeight, int gridWidth,
+  const std::function<double(Int)>& timeRoutine,
+  const vector<Int>& candidates=vector<Int>({32,64,96,128,192,256}) );
+
+void LoadTuningFile( const string& filename );
+void SaveTuningFile( const string& filename );
+
 template<typename T,
          typename=EnableIf<IsScalar<T>>>
 const T& Max( const T& m, const T& n ) EL_NO_EXCEPT;
@@ -263,9 +359,12 @@ EL_DEBUG_ONLY(
     typedef CallStackEntry CSE;
 )
 
+// The log is shared by all of the threads of a process, and each call to Log
+// writes its line atomically
 void OpenLog( const char* filename );
 
 std::ostream & LogOS();
+void LogLine( const string& line );
 
 template<typename... ArgPack>
 void Log( const ArgPack& ... args );
@@ -27,6 +27,14 @@ inline void
 PrintInputReport()
 { GetArgs().PrintReport(); }
 
+template<typename T>
+Int TunedBlocksize
+( const string& routine, Int localSize, int gridHeight, int gridWidth )
+{
+    return TunedBlocksize
+    ( routine, TypeName<T>(), localSize, gridHeight, gridWidth );
+}
+
 template<typename T,
          typename/*=EnableIf<IsScalar<T>>*/>
 const T& Max( const T& m, const T& n ) EL_NO_EXCEPT
@@ -216,7 +224,7 @@ void Log( const ArgPack& ... args )
 {
     std::ostringstream str;
     BuildStream( str, args... );
-    LogOS() << str.str() << std::endl;
+    LogLine( str.str() );
 }
 
 template<typename... ArgPack>
@@ -585,6 +585,33 @@ void Gemm
   const dcomplex* B, BlasInt BLDim,
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim );
+// The following are cache-blocked (and, in the case of DoubleDouble,
+// vectorized) rather than reference implementations
+#ifdef HYDROGEN_HAVE_QD
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* B, BlasInt BLDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+  const QuadDouble* B, BlasInt BLDim,
+  const QuadDouble& beta,
+        QuadDouble* C, BlasInt CLDim );
+#endif
+#ifdef HYDROGEN_HAVE_QUADMATH
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim,
+  const Quad* B, BlasInt BLDim,
+  const Quad& beta,
+        Quad* C, BlasInt CLDim );
+#endif
 
 template<typename T>
 void Hemm
@@ -704,6 +731,31 @@ void Herk
   const dcomplex* A, BlasInt ALDim,
   const double& beta,
         dcomplex* C, BlasInt CLDim );
+#ifdef HYDROGEN_HAVE_QD
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim );
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+  const QuadDouble& beta,
+        QuadDouble* C, BlasInt CLDim );
+#endif
+#ifdef HYDROGEN_HAVE_QUADMATH
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim,
+  const Quad& beta,
+        Quad* C, BlasInt CLDim );
+#endif
 
 template<typename T>
 void Symm
@@ -828,6 +880,31 @@ void Syrk
   const dcomplex* A, BlasInt ALDim,
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim );
+#ifdef HYDROGEN_HAVE_QD
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim );
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+  const QuadDouble& beta,
+        QuadDouble* C, BlasInt CLDim );
+#endif
+#ifdef HYDROGEN_HAVE_QUADMATH
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim,
+  const Quad& beta,
+        Quad* C, BlasInt CLDim );
+#endif
 
 template<typename T>
 void Trmm
@@ -894,6 +971,28 @@ void Trsm
   const dcomplex& alpha,
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim );
+#ifdef HYDROGEN_HAVE_QD
+void Trsm
+( char side,  char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+        DoubleDouble* B, BlasInt BLDim );
+void Trsm
+( char side,  char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+        QuadDouble* B, BlasInt BLDim );
+#endif
+#ifdef HYDROGEN_HAVE_QUADMATH
+void Trsm
+( char side,  char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim,
+        Quad* B, BlasInt BLDim );
+#endif
 
 } // namespace blas
 } // namespace El
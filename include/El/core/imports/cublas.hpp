@@ -0,0 +1,151 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IMPORTS_CUBLAS_HPP
+#define EL_IMPORTS_CUBLAS_HPP
+
+namespace El {
+
+// The backend of the local BLAS-3 kernels (blas::Gemm, blas::Trsm, and
+// blas::Herk/Syrk, and hence of every sequential and local Gemm, Trsm, and
+// Trrk). With LOCAL_BLAS_DEVICE, each call to one of these kernels with
+// single or double-precision (complex) data which performs at least
+// DeviceBlasMinFlops() flops is offloaded to a CUDA device via cuBLAS.
+//
+// Operands which already reside in device (or managed) memory, e.g., those
+// of matrices allocated with an AllocationPolicy using DEVICE_MEMORY and the
+// allocator returned by cublas::DeviceAllocator(), are used in place. Host
+// operands are staged through device workspaces which are cached (per
+// thread) across calls, and the columns of the right-hand sides are
+// pipelined over two streams so that transfers overlap with computation.
+//
+// The default (LOCAL_BLAS_HOST) can be overridden with the environment
+// variable EL_LOCAL_BLAS_BACKEND=device. Selecting the device backend is
+// collective over mpi::COMM_WORLD, as each process is assigned a device
+// based upon its rank within its node.
+namespace LocalBlasBackendNS {
+enum LocalBlasBackend
+{
+    LOCAL_BLAS_HOST,
+    LOCAL_BLAS_DEVICE
+};
+}
+using namespace LocalBlasBackendNS;
+
+void SetLocalBlasBackend( LocalBlasBackend backend );
+LocalBlasBackend GetLocalBlasBackend() EL_NO_EXCEPT;
+
+void SetDeviceBlasMinFlops( double minFlops );
+double DeviceBlasMinFlops() EL_NO_EXCEPT;
+
+// Return the cached device workspaces of the calling thread to the device
+void EmptyDeviceBlasCache();
+
+namespace cublas {
+
+// Whether a kernel performing the given number of flops should be offloaded
+bool Offload( double numFlops ) EL_NO_EXCEPT;
+
+// Allocators for device and pinned host memory (see SetAllocator)
+Allocator DeviceAllocator();
+Allocator PinnedHostAllocator();
+
+// The following mirror the interfaces of the corresponding blas:: routines,
+// with each buffer residing in either host or device memory
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const float& alpha,
+  const float* A, BlasInt ALDim,
+  const float* B, BlasInt BLDim,
+  const float& beta,
+        float* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const double& alpha,
+  const double* A, BlasInt ALDim,
+  const double* B, BlasInt BLDim,
+  const double& beta,
+        double* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const scomplex& alpha,
+  const scomplex* A, BlasInt ALDim,
+  const scomplex* B, BlasInt BLDim,
+  const scomplex& beta,
+        scomplex* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const dcomplex& alpha,
+  const dcomplex* A, BlasInt ALDim,
+  const dcomplex* B, BlasInt BLDim,
+  const dcomplex& beta,
+        dcomplex* C, BlasInt CLDim );
+
+void Herk
+( char uplo, char trans, BlasInt n, BlasInt k,
+  const float& alpha,
+  const scomplex* A, BlasInt ALDim,
+  const float& beta,
+        scomplex* C, BlasInt CLDim );
+void Herk
+( char uplo, char trans, BlasInt n, BlasInt k,
+  const double& alpha,
+  const dcomplex* A, BlasInt ALDim,
+  const double& beta,
+        dcomplex* C, BlasInt CLDim );
+
+void Syrk
+( char uplo, char trans, BlasInt n, BlasInt k,
+  const float& alpha,
+  const float* A, BlasInt ALDim,
+  const float& beta,
+        float* C, BlasInt CLDim );
+void Syrk
+( char uplo, char trans, BlasInt n, BlasInt k,
+  const double& alpha,
+  const double* A, BlasInt ALDim,
+  const double& beta,
+        double* C, BlasInt CLDim );
+void Syrk
+( char uplo, char trans, BlasInt n, BlasInt k,
+  const scomplex& alpha,
+  const scomplex* A, BlasInt ALDim,
+  const scomplex& beta,
+        scomplex* C, BlasInt CLDim );
+void Syrk
+( char uplo, char trans, BlasInt n, BlasInt k,
+  const dcomplex& alpha,
+  const dcomplex* A, BlasInt ALDim,
+  const dcomplex& beta,
+        dcomplex* C, BlasInt CLDim );
+
+void Trsm
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  const float& alpha,
+  const float* A, BlasInt ALDim,
+        float* B, BlasInt BLDim );
+void Trsm
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  const double& alpha,
+  const double* A, BlasInt ALDim,
+        double* B, BlasInt BLDim );
+void Trsm
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  const scomplex& alpha,
+  const scomplex* A, BlasInt ALDim,
+        scomplex* B, BlasInt BLDim );
+void Trsm
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  const dcomplex& alpha,
+  const dcomplex* A, BlasInt ALDim,
+        dcomplex* B, BlasInt BLDim );
+
+} // namespace cublas
+} // namespace El
+
+#endif // ifndef EL_IMPORTS_CUBLAS_HPP
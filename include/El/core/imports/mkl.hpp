@@ -180,6 +180,73 @@ void Trrk
         dcomplex beta,
         dcomplex* C, BlasInt CLDim );
 
+#ifdef HYDROGEN_HAVE_MKL_BATCH_STRIDED
+void GemmBatchStrided
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+        float alpha,
+  const float* A, BlasInt ALDim, BlasInt AStride,
+  const float* B, BlasInt BLDim, BlasInt BStride,
+        float beta,
+        float* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchSize );
+void GemmBatchStrided
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+        double alpha,
+  const double* A, BlasInt ALDim, BlasInt AStride,
+  const double* B, BlasInt BLDim, BlasInt BStride,
+        double beta,
+        double* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchSize );
+void GemmBatchStrided
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+        scomplex alpha,
+  const scomplex* A, BlasInt ALDim, BlasInt AStride,
+  const scomplex* B, BlasInt BLDim, BlasInt BStride,
+        scomplex beta,
+        scomplex* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchSize );
+void GemmBatchStrided
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+        dcomplex alpha,
+  const dcomplex* A, BlasInt ALDim, BlasInt AStride,
+  const dcomplex* B, BlasInt BLDim, BlasInt BStride,
+        dcomplex beta,
+        dcomplex* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchSize );
+void TrsmBatchStrided
+( char side, char uplo, char trans, char diag,
+  BlasInt m, BlasInt n,
+        float alpha,
+  const float* A, BlasInt ALDim, BlasInt AStride,
+        float* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchSize );
+void TrsmBatchStrided
+( char side, char uplo, char trans, char diag,
+  BlasInt m, BlasInt n,
+        double alpha,
+  const double* A, BlasInt ALDim, BlasInt AStride,
+        double* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchSize );
+void TrsmBatchStrided
+( char side, char uplo, char trans, char diag,
+  BlasInt m, BlasInt n,
+        scomplex alpha,
+  const scomplex* A, BlasInt ALDim, BlasInt AStride,
+        scomplex* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchSize );
+void TrsmBatchStrided
+( char side, char uplo, char trans, char diag,
+  BlasInt m, BlasInt n,
+        dcomplex alpha,
+  const dcomplex* A, BlasInt ALDim, BlasInt AStride,
+        dcomplex* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchSize );
+#endif
+
 } // namespace mkl
 } // namespace El
 #endif // ifdef HYDROGEN_HAVE_MKL
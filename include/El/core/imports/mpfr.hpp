@@ -19,6 +19,8 @@
 
 namespace El {
 
+class BigFloat;
+
 namespace mpfr {
 
 void RandomState( gmp_randstate_t randState );
@@ -27,6 +29,19 @@ mpfr_prec_t Precision();
 size_t NumLimbs();
 void SetPrecision( mpfr_prec_t precision );
 
+// Whether subsequently allocated buffers of BigFloat (e.g., those underlying
+// Matrix<BigFloat>) place the limbs of all of their entries in a single
+// allocation alongside the entries, at the precision in effect at the time
+// of the allocation, rather than performing a heap allocation per entry.
+// An entry whose precision is later changed migrates to its own storage.
+// The default is false.
+void SetContiguousLimbs( bool contiguous );
+bool ContiguousLimbs();
+
+// NOTE: These should only be called internally (by Memory<BigFloat>)
+BigFloat* NewContiguous( size_t size );
+void DeleteContiguous( BigFloat* buffer, size_t size );
+
 int NumIntBits();
 int NumIntLimbs();
 void SetMinIntBits( int minIntBits );
@@ -321,13 +336,21 @@ class BigFloat {
 private:
     mpfr_t mpfrFloat_;
     size_t numLimbs_;
+    // False if the limbs are borrowed from a contiguous buffer
+    bool ownsLimbs_=true;
 
     void SetNumLimbs( mpfr_prec_t prec );
     void Init( mpfr_prec_t prec=mpfr::Precision() );
 
+    // Construct a NaN whose limbs are borrowed from 'limbs', which must
+    // have room for (prec-1)/GMP_NUMB_BITS+1 limbs
+    BigFloat( mp_limb_t* limbs, mpfr_prec_t prec, bool );
+    friend BigFloat* mpfr::NewContiguous( size_t size );
+
 public:
     mpfr_ptr    Pointer();
     mpfr_srcptr LockedPointer() const;
+    bool        OwnsLimbs() const;
     mpfr_sign_t Sign() const;
     mpfr_exp_t  Exponent() const;
     mpfr_prec_t Precision() const;
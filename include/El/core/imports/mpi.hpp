@@ -15,6 +15,8 @@
 namespace El {
 
 using std::function;
+using std::ostream;
+using std::string;
 using std::vector;
 
 namespace mpi {
@@ -26,7 +28,7 @@ namespace mpi {
 #define EL_HAVE_NONBLOCKING 0
 #endif
 
-#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#if EL_HAVE_NONBLOCKING
 #ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
 #define EL_NONBLOCKING_COLL(name) MPI_ ## name
 #else
@@ -89,7 +91,7 @@ struct Request
 {
     Request() { }
 
-    MPI_Request backend;
+    MPI_Request backend=MPI_REQUEST_NULL;
 
     vector<byte> buffer;
     bool receivingPacked=false;
@@ -180,32 +182,113 @@ struct MPIBaseHelper<Entry<T>> { typedef T value; };
 template<typename T>
 using MPIBase = typename MPIBaseHelper<T>::value;
 
+// The custom datatypes (e.g., those of DoubleDouble, ValueInt<double>, and
+// Entry<Complex<double>>) and reduction ops of each scalar family are created
+// upon the first access of any of them through the routines below rather
+// than within El::Initialize. Each family is created at most once (in a
+// thread-safe manner) between El::Initialize and El::Finalize.
+enum CustomFamily
+{
+    INT_FAMILY,
+    FLOAT_FAMILY,
+    DOUBLE_FAMILY,
+    DOUBLEDOUBLE_FAMILY,
+    QUADDOUBLE_FAMILY,
+    QUAD_FAMILY,
+    BIGFLOAT_FAMILY,
+    BIGINT_FAMILY,
+    HALF_FAMILY,
+    BFLOAT16_FAMILY,
+    NUM_CUSTOM_FAMILIES,
+    NO_CUSTOM_FAMILY
+};
+
+template<typename Real>
+struct CustomFamilyHelper
+{ static constexpr CustomFamily value = NO_CUSTOM_FAMILY; };
+template<>
+struct CustomFamilyHelper<Int>
+{ static constexpr CustomFamily value = INT_FAMILY; };
+template<>
+struct CustomFamilyHelper<float>
+{ static constexpr CustomFamily value = FLOAT_FAMILY; };
+template<>
+struct CustomFamilyHelper<double>
+{ static constexpr CustomFamily value = DOUBLE_FAMILY; };
+#ifdef HYDROGEN_HAVE_QD
+template<>
+struct CustomFamilyHelper<DoubleDouble>
+{ static constexpr CustomFamily value = DOUBLEDOUBLE_FAMILY; };
+template<>
+struct CustomFamilyHelper<QuadDouble>
+{ static constexpr CustomFamily value = QUADDOUBLE_FAMILY; };
+#endif
+#ifdef HYDROGEN_HAVE_QUADMATH
+template<>
+struct CustomFamilyHelper<Quad>
+{ static constexpr CustomFamily value = QUAD_FAMILY; };
+#endif
+#ifdef HYDROGEN_HAVE_MPC
+template<>
+struct CustomFamilyHelper<BigFloat>
+{ static constexpr CustomFamily value = BIGFLOAT_FAMILY; };
+template<>
+struct CustomFamilyHelper<BigInt>
+{ static constexpr CustomFamily value = BIGINT_FAMILY; };
+#endif
+
+template<>
+struct CustomFamilyHelper<Half>
+{ static constexpr CustomFamily value = HALF_FAMILY; };
+template<>
+struct CustomFamilyHelper<BFloat16>
+{ static constexpr CustomFamily value = BFLOAT16_FAMILY; };
+
+// The family of the custom types and ops associated with T
+template<typename T>
+using CustomFamilyOf = CustomFamilyHelper<Base<MPIBase<T>>>;
+
+// For internal usage only; please use EnsureCustom
+extern std::atomic<bool> customCreated[NUM_CUSTOM_FAMILIES];
+
+void CreateCustom( CustomFamily family ) EL_NO_RELEASE_EXCEPT;
+bool CreatedCustom( CustomFamily family ) EL_NO_EXCEPT;
+
+template<typename T>
+inline void EnsureCustom() EL_NO_RELEASE_EXCEPT
+{
+    const CustomFamily family = CustomFamilyOf<T>::value;
+    if( family != NO_CUSTOM_FAMILY &&
+        !customCreated[family].load(std::memory_order_acquire) )
+        CreateCustom( family );
+}
+
 template<typename T>
 Datatype& TypeMap() EL_NO_EXCEPT
-{ return Types<T>::type; }
+{ EnsureCustom<T>(); return Types<T>::type; }
 
 template<typename T>
-Op& UserOp() { return Types<T>::userOp; }
+Op& UserOp() { EnsureCustom<T>(); return Types<T>::userOp; }
 template<typename T>
-Op& UserCommOp() { return Types<T>::userCommOp; }
+Op& UserCommOp() { EnsureCustom<T>(); return Types<T>::userCommOp; }
 template<typename T>
-Op& SumOp() { return Types<T>::sumOp; }
+Op& SumOp() { EnsureCustom<T>(); return Types<T>::sumOp; }
 template<typename T>
-Op& ProdOp() { return Types<T>::prodOp; }
+Op& ProdOp() { EnsureCustom<T>(); return Types<T>::prodOp; }
 // The following are currently only defined for real datatypes but could
 // potentially use lexicographic ordering for complex numbers
 template<typename T>
-Op& MaxOp() { return Types<T>::maxOp; }
+Op& MaxOp() { EnsureCustom<T>(); return Types<T>::maxOp; }
 template<typename T>
-Op& MinOp() { return Types<T>::minOp; }
+Op& MinOp() { EnsureCustom<T>(); return Types<T>::minOp; }
 template<typename T>
-Op& MaxLocOp() { return Types<ValueInt<T>>::maxOp; }
+Op& MaxLocOp() { EnsureCustom<T>(); return Types<ValueInt<T>>::maxOp; }
 template<typename T>
-Op& MinLocOp() { return Types<ValueInt<T>>::minOp; }
+Op& MinLocOp() { EnsureCustom<T>(); return Types<ValueInt<T>>::minOp; }
 template<typename T>
-Op& MaxLocPairOp() { return Types<Entry<T>>::maxOp; }
+Op& MaxLocPairOp() { EnsureCustom<T>(); return Types<Entry<T>>::maxOp; }
 template<typename T>
-Op& MinLocPairOp() { return Types<Entry<T>>::minOp; }
+Op& MinLocPairOp() { EnsureCustom<T>(); return Types<Entry<T>>::minOp; }
 
 // Added constant(s)
 const int MIN_COLL_MSG = 1; // minimum message size for collectives
@@ -235,11 +318,165 @@ void Create
 ( Comm parentComm, Group subsetGroup, Comm& subsetComm ) EL_NO_RELEASE_EXCEPT;
 void Dup( Comm original, Comm& duplicate ) EL_NO_RELEASE_EXCEPT;
 void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
+// Split into the subsets of processes which can share memory (i.e., nodes)
+void SplitShared( Comm comm, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
+// Communicator names are reported by the communication profiler
+void SetName( Comm comm, const string& name ) EL_NO_RELEASE_EXCEPT;
+string Name( Comm comm ) EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
 ( Comm comm, ErrorHandler errorHandler ) EL_NO_RELEASE_EXCEPT;
 
+// Two-level collectives
+// ---------------------
+// AllGather, ReduceScatter, and AllReduce over a registered communicator
+// (for packed datatypes) are performed within each node (see SplitShared),
+// then between the first processes of each node, and then within each node
+// again, so that the number of messages crossing the network no longer grows
+// with the number of processes per node. The operations must be
+// commutative. Enabling returns false, and registers nothing, unless the
+// communicator spans several nodes with several processes on at least one.
+// Both routines are collective, and Free deregisters the communicator.
+bool EnableHierarchicalCollectives( Comm comm ) EL_NO_RELEASE_EXCEPT;
+void DisableHierarchicalCollectives( Comm comm ) EL_NO_RELEASE_EXCEPT;
+bool HierarchicalCollectives( Comm comm ) EL_NO_EXCEPT;
+
+// ReduceScatter algorithms
+// ------------------------
+// REDUCE_SCATTER_NATIVE calls MPI_Reduce_scatter_block (or the configured
+// AllReduce fallback). REDUCE_SCATTER_RECURSIVE_HALVING instead folds the
+// first 2 (p-p') of the p processes onto their neighbors, where p' is the
+// largest power of two no larger than p, and then has each of the p'
+// remaining processes repeatedly trade half of its remaining blocks with a
+// partner, so that no process sends more than its whole buffer or more
+// than log2(p')+1 messages whether or not p is a power of two. This is
+// preferable when the MPI implementation handles the non-power-of-two
+// process rows and columns of non-square grids poorly, and is also used
+// when MPI_Reduce_scatter_block is unavailable. The choice applies to the
+// (I)ReduceScatter routines for packed datatypes on communicators without
+// two-level collectives and must be made consistently by all processes.
+enum ReduceScatterAlgorithm
+{
+    REDUCE_SCATTER_NATIVE,
+    REDUCE_SCATTER_RECURSIVE_HALVING
+};
+void SetReduceScatterAlgorithm( ReduceScatterAlgorithm alg ) EL_NO_EXCEPT;
+ReduceScatterAlgorithm GetReduceScatterAlgorithm() EL_NO_EXCEPT;
+
+// Reduced-precision wire formats
+// ------------------------------
+// While a reduced format is active, the entries of double-precision (and,
+// for WIRE_BFLOAT16, single-precision) real and complex buffers passed to
+// AllGather, AllToAll, and SendRecv -- and thus the redistributions of Copy
+// -- are rounded to the narrower format before being sent and widened once
+// received. The relative error of each entry is then at most 2^-24 for
+// WIRE_SINGLE and 2^-8 for WIRE_BFLOAT16 (values outside of the single-
+// precision range overflow), in exchange for halving or quartering the
+// traffic. All processes of a communicator must use the same format, and
+// the format applies to every such call made while it is active, so it is
+// best confined to regions (e.g., the early iterations of a refinement
+// loop) with a WireFormatGuard.
+enum WireFormat
+{
+    WIRE_FULL,
+    WIRE_SINGLE,
+    WIRE_BFLOAT16
+};
+void SetWireFormat( WireFormat format ) EL_NO_EXCEPT;
+WireFormat GetWireFormat() EL_NO_EXCEPT;
+
+class WireFormatGuard
+{
+public:
+    explicit WireFormatGuard( WireFormat format )
+    : previous_(GetWireFormat())
+    { SetWireFormat( format ); }
+    ~WireFormatGuard() { SetWireFormat( previous_ ); }
+private:
+    WireFormat previous_;
+
+    WireFormatGuard( const WireFormatGuard& );
+    const WireFormatGuard& operator=( const WireFormatGuard& );
+};
+
+// A buffer which is shared by all of the processes of a node communicator
+// (see SplitShared) through an MPI-3 shared-memory window. Without MPI-3,
+// SplitShared returns singleton communicators and each process simply owns
+// a private buffer. Require, Synchronize, and destruction are collective
+// over the node communicator, which must outlive the window.
+class SharedWindow
+{
+public:
+    explicit SharedWindow( Comm nodeComm );
+    ~SharedWindow();
+
+    // Ensure that the buffer holds at least numBytes bytes; the contents are
+    // not preserved if the buffer must be reallocated
+    void* Require( size_t numBytes );
+    void* Buffer() const EL_NO_EXCEPT;
+    size_t Size() const EL_NO_EXCEPT;
+
+    // Make the stores of each process visible to the others of its node
+    void Synchronize();
+
+private:
+    Comm nodeComm_;
+    void* buffer_=nullptr;
+    size_t size_=0;
+#if MPI_VERSION >= 3
+    MPI_Win window_=MPI_WIN_NULL;
+#endif
+
+    void Free();
+
+    SharedWindow( const SharedWindow& );
+    const SharedWindow& operator=( const SharedWindow& );
+};
+
+// Parallel file I/O
+// -----------------
+// Collective MPI-IO on files holding column-major matrices with entries of
+// a fixed size. Each process transfers the entries lying in its (increasing)
+// lists of global rows and columns directly between the file and its local
+// column-major buffer, so that no process funnels the data of the others.
+typedef MPI_File File;
+
+// Hints for striped parallel filesystems (e.g., Lustre) which are passed to
+// each opened file; zero values leave the choice to the MPI implementation.
+// The defaults can be overridden with the environment variables
+// EL_IO_STRIPE_COUNT, EL_IO_STRIPE_SIZE, and EL_IO_AGGREGATORS.
+struct FileHints
+{
+    int stripeCount=0;    // the number of storage targets (striping_factor)
+    Int stripeSize=0;     // the number of bytes per stripe (striping_unit)
+    int numAggregators=0; // the number of collective-buffering processes
+};
+void SetFileHints( const FileHints& hints );
+const FileHints& GetFileHints() EL_NO_EXCEPT;
+
+// Opening for writing creates (or truncates) the file
+void FileOpen( Comm comm, const string& filename, bool write, File& file );
+void FileClose( File& file ) EL_NO_RELEASE_EXCEPT;
+Int FileSize( File file ) EL_NO_RELEASE_EXCEPT;
+// Independently transfer a contiguous range of bytes (e.g., a header)
+void FileReadAt
+( File file, Int offset, void* buffer, Int numBytes ) EL_NO_RELEASE_EXCEPT;
+void FileWriteAt
+( File file, Int offset, const void* buffer, Int numBytes )
+EL_NO_RELEASE_EXCEPT;
+// Collectively transfer the entries (rows[iLoc],cols[jLoc]) of the
+// column-major height-row matrix of entrySize-byte entries starting at byte
+// 'offset' to/from the buffer with leading dimension ldim
+void FileReadAll
+( File file, Int offset, Int height, Int entrySize,
+  const vector<Int>& rows, const vector<Int>& cols,
+  void* buffer, Int ldim ) EL_NO_RELEASE_EXCEPT;
+void FileWriteAll
+( File file, Int offset, Int height, Int entrySize,
+  const vector<Int>& rows, const vector<Int>& cols,
+  const void* buffer, Int ldim ) EL_NO_RELEASE_EXCEPT;
+
 // Cartesian communicator routines
 void CartCreate
 ( Comm comm, int numDims, const int* dimensions, const int* periods,
@@ -751,6 +988,28 @@ void AllGather
         T* rbuf, const int* rcs, const int* rds, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllGather
+// ----------------------
+// If non-blocking collectives are not available (or the datatype is not
+// packed), the operation is performed immediately and the request is null
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm, Request<T>& request );
+
 // Scatter
 // -------
 template<typename Real,
@@ -811,6 +1070,27 @@ void AllToAll
 ( const T* sbuf, int sc,
         T* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllToAll
+// ---------------------
+// NOTE: See the corresponding note for IAllGather
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm, Request<T>& request );
+
 // AllToAll with non-uniform send/recv sizes
 // -----------------------------------------
 template<typename Real,
@@ -1022,6 +1302,32 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void AllReduce( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllReduce
+// ----------------------
+// NOTE: If non-blocking collectives are not available, or the communicator
+//       was registered for hierarchical reductions, a blocking AllReduce is
+//       performed and the request is set to MPI_REQUEST_NULL
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm, Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request );
+
 // ReduceScatter
 // -------------
 template<typename Real,
@@ -1057,6 +1363,29 @@ template<typename T>
 void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking ReduceScatter
+// --------------------------
+// NOTE: See the corresponding note for IAllGather
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm, Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IReduceScatter
+( T* sbuf, T* rbuf, int rc, Op op, Comm comm, Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IReduceScatter
+( T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request );
+
 // Single-buffer ReduceScatter
 // ---------------------------
 template<typename Real,
@@ -1231,9 +1560,49 @@ void VerifySendsAndRecvs
 ( const vector<int>& sendCounts,
   const vector<int>& recvCounts, Comm comm );
 
+// Eagerly create the custom types and ops of every family (e.g., for
+// debugging or benchmarking), which otherwise happens upon first use
 void CreateCustom() EL_NO_RELEASE_EXCEPT;
 void DestroyCustom() EL_NO_RELEASE_EXCEPT;
 
+// Communication profiling
+// =======================
+// When enabled, each blocking call records the number of bytes it moved and
+// the time it took, keyed by communicator name, call, and call site (the
+// innermost trace region). If skew measurement is requested, each
+// collective is preceded by a timed barrier whose duration measures how long
+// the process waited on the slowest member of the communicator.
+//
+// Setting the environment variable EL_MPI_PROFILE to a filename enables
+// profiling (with skew measurement if EL_MPI_PROFILE_SKEW is nonzero) and
+// writes the profile during Finalize.
+const Int PROFILE_NUM_BUCKETS = 32;
+
+struct CallProfile
+{
+    string comm, call, site;
+    Int numCalls=0;
+    double numBytes=0, seconds=0, waitSeconds=0, maxWaitSeconds=0;
+    // The number of calls moving [2^(b-1),2^b) bytes, with zero in bucket 0
+    Int histogram[PROFILE_NUM_BUCKETS]={};
+};
+
+void EnableProfiling( bool measureSkew=false );
+void DisableProfiling();
+bool ProfilingEnabled() EL_NO_EXCEPT;
+bool ProfilingSkew() EL_NO_EXCEPT;
+void ResetProfile();
+// Time a barrier over 'comm', which should precede the profiled collective
+double ProfileWait( Comm comm );
+void RecordProfile
+( Comm comm, const char* call, double numBytes, double seconds,
+  double waitSeconds );
+// The local profile, sorted by decreasing time
+vector<CallProfile> Profile();
+void PrintProfile( ostream& os );
+// Gather the profiles of every process in 'comm' and write them from the root
+void WriteProfile( const string& filename, Comm comm=COMM_WORLD );
+
 #ifdef HYDROGEN_HAVE_MPC
 void CreateBigIntFamily();
 void DestroyBigIntFamily();
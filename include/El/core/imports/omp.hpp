@@ -11,23 +11,40 @@
 
 #ifdef EL_HYBRID
 # include <omp.h>
+# define EL_PRAGMA(x) _Pragma(#x)
 # define EL_PARALLEL_FOR _Pragma("omp parallel for")
+# define EL_PARALLEL_FOR_IF(cond) EL_PRAGMA(omp parallel for if(cond))
 # ifdef EL_HAVE_OMP_COLLAPSE
 #  define EL_PARALLEL_FOR_COLLAPSE2 _Pragma("omp parallel for collapse(2)")
+#  define EL_PARALLEL_FOR_COLLAPSE2_IF(cond) \
+     EL_PRAGMA(omp parallel for collapse(2) if(cond))
 # else
 #  define EL_PARALLEL_FOR_COLLAPSE2 EL_PARALLEL_FOR
+#  define EL_PARALLEL_FOR_COLLAPSE2_IF(cond) EL_PARALLEL_FOR_IF(cond)
 # endif
 # ifdef EL_HAVE_OMP_SIMD
 #  define EL_SIMD _Pragma("omp simd")
+#  define EL_SIMD_SUM(...) EL_PRAGMA(omp simd reduction(+:__VA_ARGS__))
 # else
 #  define EL_SIMD
+#  define EL_SIMD_SUM(...)
 # endif
 #else
 # define EL_PARALLEL_FOR 
+# define EL_PARALLEL_FOR_IF(cond)
 # define EL_PARALLEL_FOR_COLLAPSE2
+# define EL_PARALLEL_FOR_COLLAPSE2_IF(cond)
 # define EL_SIMD
+# define EL_SIMD_SUM(...)
 #endif
 
+// Only fork a team for loops touching at least El::ParallelGrainSize()
+// entries; smaller loops are cheaper to run on the calling thread
+#define EL_PARALLEL_FOR_GRAIN(numEntries) \
+  EL_PARALLEL_FOR_IF((numEntries) >= El::ParallelGrainSize())
+#define EL_PARALLEL_FOR_COLLAPSE2_GRAIN(numEntries) \
+  EL_PARALLEL_FOR_COLLAPSE2_IF((numEntries) >= El::ParallelGrainSize())
+
 #ifdef EL_AVOID_OMP_FMA
 # define EL_FMA_PARALLEL_FOR 
 #else
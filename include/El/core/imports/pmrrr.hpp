@@ -32,9 +32,18 @@ struct Info {
 // Compute all of the eigenvalues
 Info Eig( int n, double* d, double* e, double* w, mpi::Comm comm );
 
+// The routines which compute eigenpairs accept a 'partitionSlack' which
+// allows PMRRR to move the boundaries between the contiguous blocks of
+// eigenvectors computed by each process into gaps between clusters (see
+// herm_tridiag_eig::MRRRCtrl). Z must then have room for
+// MaxLocalEigenvectors(numEigenvalues,commSize,partitionSlack) columns.
+int MaxLocalEigenvectors
+( int numEigenvalues, int commSize, double partitionSlack );
+
 // Compute all of the eigenpairs
 Info Eig
-( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm );
+( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm,
+  double partitionSlack=0 );
 
 // Compute all of the eigenvalues in [lowerBound,upperBound)
 Info Eig
@@ -44,7 +53,7 @@ Info Eig
 // Compute all of the eigenpairs with eigenvalues in [lowerBound,upperBound)
 Info Eig
 ( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm, 
-  double lowerBound, double upperBound );
+  double lowerBound, double upperBound, double partitionSlack=0 );
 
 // Compute all of the eigenvalues with indices in [lowerBound,upperBound)
 Info Eig
@@ -55,7 +64,7 @@ Info Eig
 // [lowerBound,upperBound)
 Info Eig
 ( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm, 
-  int lowerBound, int upperBound );
+  int lowerBound, int upperBound, double partitionSlack=0 );
 
 } // namespace herm_tridiag_eig
 } // namespace El
@@ -99,6 +99,58 @@ F SampleBall( const F& center=F(0), const Base<F>& radius=Base<F>(1) );
 template<typename Real,typename=EnableIf<IsReal<Real>>> 
 Real SampleBall( const Real& center=Real(0), const Real& radius=Real(1) );
 
+// Counter-based random number generation
+// ======================================
+// The Philox4x32-10 generator of
+//   John K. Salmon, Mark A. Moraes, Ron O. Dror, and David E. Shaw,
+//   "Parallel random numbers: as easy as 1, 2, 3",
+//   Proc. of SC '11, Article 16, 2011,
+// is a stateless bijection from a 128-bit counter, under a 64-bit key, to 128
+// pseudo-random bits. When it is enabled, the independent random fills
+// (Bernoulli, Gaussian, Rademacher, ThreeValued, and Uniform) key it by a
+// seed and draw entry (i,j) from the counter formed from a stream index and
+// the global indices (i,j), so that their results are identical on every
+// process grid, distribution, and number of threads, and distributed fills
+// require no communication.
+typedef std::array<std::uint32_t,4> PhiloxCounter;
+typedef std::array<std::uint32_t,2> PhiloxKey;
+PhiloxCounter Philox( PhiloxCounter counter, PhiloxKey key ) EL_NO_EXCEPT;
+
+// Whether the independent random fills use the counter-based generator
+// rather than Generator(). The default (off) can be overridden with the
+// environment variable EL_COUNTER_BASED_RANDOM.
+bool CounterBasedRandom();
+void SetCounterBasedRandom( bool counterBased );
+
+// Each counter-based fill consumes the next stream index; since the index is
+// tracked separately on each process, all processes must perform the same
+// sequence of fills. Setting the seed resets the stream index.
+void SetCounterBasedSeed( unsigned long long seed );
+unsigned long long CounterBasedSeed();
+unsigned long long NextCounterBasedStream();
+
+// Two independent samples from the uniform distribution over [0,1), each with
+// 53 random bits, for entry (i,j) of the given stream. Only the lower 48 bits
+// of each index are significant.
+std::array<double,2>
+CounterBasedUniforms( unsigned long long stream, Int i, Int j ) EL_NO_EXCEPT;
+// The same, but with an explicit seed rather than CounterBasedSeed()
+std::array<double,2>
+CounterBasedUniforms
+( unsigned long long seed, unsigned long long stream, Int i, Int j )
+EL_NO_EXCEPT;
+
+// The counter-based analogues of SampleBall and SampleNormal. Only 53 bits of
+// each sample are random, even for types with more precision.
+template<typename T>
+T CounterBasedBall
+( unsigned long long stream, Int i, Int j,
+  const T& center=T(0), const Base<T>& radius=Base<T>(1) );
+template<typename T>
+T CounterBasedNormal
+( unsigned long long stream, Int i, Int j,
+  const T& mean=T(0), const Base<T>& stddev=Base<T>(1) );
+
 // To be used internally by Elemental
 void InitializeRandom( bool deterministic=true );
 void FinalizeRandom();
@@ -223,6 +223,134 @@ template<typename Real,typename>
 Real SampleBall( const Real& center, const Real& radius )
 { return SampleUniform(center-radius,center+radius); }
 
+inline PhiloxCounter Philox( PhiloxCounter counter, PhiloxKey key ) EL_NO_EXCEPT
+{
+    const std::uint64_t multiplier0 = 0xD2511F53;
+    const std::uint64_t multiplier1 = 0xCD9E8D57;
+    const std::uint32_t weyl0 = 0x9E3779B9;
+    const std::uint32_t weyl1 = 0xBB67AE85;
+    for( Int round=0; round<10; ++round )
+    {
+        if( round > 0 )
+        {
+            key[0] += weyl0;
+            key[1] += weyl1;
+        }
+        const std::uint64_t product0 = multiplier0*counter[0];
+        const std::uint64_t product1 = multiplier1*counter[2];
+        counter =
+          PhiloxCounter
+          {{ std::uint32_t(product1>>32) ^ counter[1] ^ key[0],
+             std::uint32_t(product1),
+             std::uint32_t(product0>>32) ^ counter[3] ^ key[1],
+             std::uint32_t(product0) }};
+    }
+    return counter;
+}
+
+inline std::array<double,2>
+CounterBasedUniforms
+( unsigned long long seed, unsigned long long stream, Int i, Int j )
+EL_NO_EXCEPT
+{
+    // Pack the lower 48 bits of each index and the lower 32 bits of the
+    // stream index into the counter
+    const std::uint64_t iBits = std::uint64_t(i);
+    const std::uint64_t jBits = std::uint64_t(j);
+    const PhiloxCounter counter =
+      {{ std::uint32_t(iBits),
+         std::uint32_t(((iBits>>32) & 0xFFFF) | ((jBits & 0xFFFF)<<16)),
+         std::uint32_t(jBits>>16),
+         std::uint32_t(stream) }};
+    const PhiloxKey key = {{ std::uint32_t(seed), std::uint32_t(seed>>32) }};
+    const PhiloxCounter bits = Philox( counter, key );
+
+    // Keep the upper 53 bits of each pair of words
+    const double ulp = std::ldexp( 1., -53 );
+    const std::uint64_t bits0 = (std::uint64_t(bits[1])<<32) | bits[0];
+    const std::uint64_t bits1 = (std::uint64_t(bits[3])<<32) | bits[2];
+    return {{ double(bits0>>11)*ulp, double(bits1>>11)*ulp }};
+}
+
+inline std::array<double,2>
+CounterBasedUniforms( unsigned long long stream, Int i, Int j ) EL_NO_EXCEPT
+{ return CounterBasedUniforms( CounterBasedSeed(), stream, i, j ); }
+
+namespace counter_based {
+
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>,
+         typename=DisableIf<IsIntegral<Real>>>
+Real Ball
+( const std::array<double,2>& uniforms, const Real& center, const Real& radius )
+{ return center + radius*Real(2*uniforms[0]-1); }
+
+template<typename T,
+         typename=EnableIf<IsIntegral<T>>,
+         typename=void,
+         typename=void>
+T Ball
+( const std::array<double,2>& uniforms, const T& center, const T& radius )
+{
+    // Mirror SampleUniform over the integers in [center-radius,center+radius)
+    const T width = 2*radius;
+    return center - radius +
+      T( (long long)(uniforms[0]*double(width)) );
+}
+
+template<typename F,typename=EnableIf<IsComplex<F>>>
+F Ball
+( const std::array<double,2>& uniforms,
+  const F& center, const Base<F>& radius )
+{
+    typedef Base<F> Real;
+    const Real r = radius*Real(uniforms[0]);
+    const Real angle = 2*Pi<Real>()*Real(uniforms[1]);
+    return center + F(r*Cos(angle),r*Sin(angle));
+}
+
+// Use the Box-Muller transform, where 1-u lies in (0,1]
+template<typename T>
+T Normal
+( const std::array<double,2>& uniforms,
+  const T& mean, const Base<T>& stddev )
+{
+    typedef Base<T> Real;
+    Real stddevAdj = stddev;
+    if( IsComplex<T>::value )
+        stddevAdj /= Sqrt(Real(2));
+
+    const double rho = std::sqrt( -2*std::log(1-uniforms[0]) );
+    const double theta = 2*Pi<double>()*uniforms[1];
+
+    T sample;
+    SetRealPart( sample, RealPart(mean) + stddevAdj*Real(rho*std::cos(theta)) );
+    if( IsComplex<T>::value )
+        SetImagPart
+        ( sample, ImagPart(mean) + stddevAdj*Real(rho*std::sin(theta)) );
+    return sample;
+}
+
+} // namespace counter_based
+
+template<typename T>
+T CounterBasedBall
+( unsigned long long stream, Int i, Int j,
+  const T& center, const Base<T>& radius )
+{
+    return counter_based::Ball
+      ( CounterBasedUniforms(stream,i,j), center, radius );
+}
+
+template<typename T>
+T CounterBasedNormal
+( unsigned long long stream, Int i, Int j,
+  const T& mean, const Base<T>& stddev )
+{
+    return counter_based::Normal
+      ( CounterBasedUniforms(stream,i,j), mean, stddev );
+}
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_IMPL_HPP
@@ -37,6 +37,34 @@ ColorMap GetColorMap();
 void SetNumDiscreteColors( Int numColors );
 Int NumDiscreteColors();
 
+// Image tiles
+// ===========
+namespace TileReductionNS {
+enum TileReduction
+{
+    TILE_MEAN,         // mean of the real (or imaginary) parts
+    TILE_MAX_ABS,      // maximum absolute value
+    TILE_NONZERO_COUNT // number of entries with absolute value above 'tol'
+};
+}
+using namespace TileReductionNS;
+
+// Distributed matrices with a dimension larger than MaxImageSize() are
+// downsampled with ImageTile before being displayed, spied, or written as
+// an image, rather than being gathered onto a single process
+void SetMaxImageSize( Int maxSize );
+Int MaxImageSize();
+
+// Downsample A into an (at most) mPix x nPix tile in which each pixel
+// summarizes the block of entries which maps to it. Each process reduces its
+// local entries into a tile and only the tiles are combined. Returns whether
+// the calling process holds the result (distribution rank zero of the root
+// team); the tile is empty elsewhere.
+template<typename T>
+bool ImageTile
+( const AbstractDistMatrix<T>& A, Matrix<double>& tile, Int mPix, Int nPix,
+  TileReduction reduction=TILE_MEAN, bool imagPart=false, Base<T> tol=0 );
+
 // Display
 // =======
 void ProcessEvents( int numMsecs );
@@ -50,6 +78,17 @@ void Display( const Matrix<Complex<Real>>& A, string title="Matrix" );
 template<typename T>
 void Display( const AbstractDistMatrix<T>& A, string title="DistMatrix" );
 
+// Graphs and sparse matrices
+// --------------------------
+void Display( const Graph& graph, string title="Graph" );
+void Display( const DistGraph& graph, string title="DistGraph" );
+template<typename T>
+void Display( const SparseMatrix<T>& A, string title="SparseMatrix" );
+template<typename T>
+void Display( const DistSparseMatrix<T>& A, string title="DistSparseMatrix" );
+template<typename T>
+void Display( const DistMultiVec<T>& X, string title="DistMultiVec" );
+
 // Print
 // =====
 
@@ -61,6 +100,23 @@ template<typename T>
 void Print
 ( const AbstractDistMatrix<T>& A, string title="DistMatrix", ostream& os=cout );
 
+// Graphs and sparse matrices
+// --------------------------
+void Print
+( const Graph& graph, string title="Graph", ostream& os=cout );
+void Print
+( const DistGraph& graph, string title="DistGraph", ostream& os=cout );
+template<typename T>
+void Print
+( const SparseMatrix<T>& A, string title="SparseMatrix", ostream& os=cout );
+template<typename T>
+void Print
+( const DistSparseMatrix<T>& A, string title="DistSparseMatrix",
+  ostream& os=cout );
+template<typename T>
+void Print
+( const DistMultiVec<T>& X, string title="DistMultiVec", ostream& os=cout );
+
 // Utilities
 // ---------
 template<typename T>
@@ -68,6 +124,9 @@ void Print( const vector<T>& x, string title="vector", ostream& os=cout );
 
 // Read
 // ====
+// Unless 'sequential' is set, BINARY and BINARY_FLAT files are read (and,
+// below, written) collectively via MPI-IO, with each process transferring its
+// own entries (see mpi::FileHints for tuning on striped filesystems)
 template<typename T>
 void Read( Matrix<T>& A, const string filename, FileFormat format=AUTO );
 template<typename T>
@@ -75,6 +134,62 @@ void Read
 ( AbstractDistMatrix<T>& A,
   const string filename, FileFormat format=AUTO, bool sequential=false );
 
+// Checkpoints
+// ===========
+// A sharded checkpoint of a distributed matrix: 'basename.ckpt' holds the
+// dimensions and distribution of the matrix, and 'basename.ckpt.<r>' holds
+// the local matrix of the process with distribution rank r along with the
+// global indices of its rows and columns. Redundant copies are only stored
+// once, and each shard is written independently by its owner. Shards may be
+// compressed with Zstandard when built with Hydrogen_ENABLE_ZSTD.
+//
+// A checkpoint may be restored into a matrix with any distribution over any
+// grid. If the layout (including the grid) matches, each process reads its
+// own shard directly; otherwise, the shards are divided among the processes,
+// which queue their entries to the new owners for a single ProcessQueues.
+// Both routines are collective over the viewing communicator of the grid.
+template<typename T>
+void WriteCheckpoint
+( const AbstractDistMatrix<T>& A, const string& basename,
+  bool compress=false );
+template<typename T>
+void ReadCheckpoint( AbstractDistMatrix<T>& A, const string& basename );
+
+// Memory-mapped files
+// ===================
+// A read-only mapping of a file into the address space. Pages are only
+// loaded once they are touched, and the processes of a node which map the
+// same file share the page-cache pages backing it. Without mmap support,
+// the file is instead read into a private buffer.
+class MappedFile
+{
+public:
+    explicit MappedFile( const string& filename );
+    ~MappedFile();
+
+    const byte* Data() const EL_NO_EXCEPT { return data_; }
+    size_t Size() const EL_NO_EXCEPT { return size_; }
+
+private:
+    byte* data_=nullptr;
+    size_t size_=0;
+    bool mapped_=false;
+
+    MappedFile( const MappedFile& );
+    const MappedFile& operator=( const MappedFile& );
+};
+
+// Lock A onto the column-major height x width matrix stored after 'offset'
+// bytes of the mapped file (e.g., a BINARY_FLAT file) without copying it.
+// MapBinary reads the dimensions from the header of a BINARY file. The
+// matrix must not be used after the file is destroyed.
+template<typename T>
+void MapBinaryFlat
+( Matrix<T>& A, const MappedFile& file, Int height, Int width,
+  Int offset=0 );
+template<typename T>
+void MapBinary( Matrix<T>& A, const MappedFile& file );
+
 // Spy
 // ===
 template<typename T>
@@ -94,6 +209,20 @@ void Write
 ( const AbstractDistMatrix<T>& A, string basename="DistMatrix",
   FileFormat format=BINARY, string title="" );
 
+// Write a snapshot of A from a background thread. The local data is first
+// staged (sharing the buffer of A when copy-on-write is enabled) so that A
+// may be modified immediately. For a DistMatrix, the gather onto the root
+// is performed before returning and only the root writes in the background.
+// The future rethrows any failure, and its destructor waits for the write.
+template<typename T>
+std::future<void> WriteAsync
+( const Matrix<T>& A, string basename="Matrix", FileFormat format=BINARY,
+  string title="" );
+template<typename T>
+std::future<void> WriteAsync
+( const AbstractDistMatrix<T>& A, string basename="DistMatrix",
+  FileFormat format=BINARY, string title="" );
+
 } // namespace El
 
 #ifdef EL_HAVE_QT5
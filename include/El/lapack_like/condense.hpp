@@ -13,9 +13,45 @@
 
 namespace El {
 
+// Process-grid selection
+// ======================
+// The blocked reductions to condensed form perform half of their work in
+// matrix-vector products, whose communication is latency-bound once the
+// trailing matrix is small relative to the grid, so that running on a subset
+// of the processes can be faster even after redistributing A there and back.
+// The predictions use the machine model of CalibrateGemmCostModel.
+enum CondenseReduction
+{
+  CONDENSE_BIDIAG,
+  CONDENSE_HERMITIAN_TRIDIAG,
+  CONDENSE_HESSENBERG
+};
+
+// The predicted time of reducing an m x n matrix on a gridHeight x gridWidth
+// grid, excluding any redistribution. HermitianTridiag is assumed to use its
+// square-grid algorithm whenever the grid is square.
+double CondenseCost
+( CondenseReduction reduction, Int m, Int n, int gridHeight, int gridWidth,
+  Int entrySize=sizeof(double) );
+
+// Choose the grid over the first processes of 'grid' (possibly all of them,
+// in a different shape) which minimizes the predicted time of the reduction
+// plus that of redistributing A to it and back. Without a calibrated model,
+// the current grid is kept, except that HermitianTridiag drops to the
+// largest square subgrid.
+void SelectCondenseGrid
+( CondenseReduction reduction, Int m, Int n, const Grid& grid,
+  int& gridHeight, int& gridWidth, Int entrySize=sizeof(double) );
+
 // Bidiag
 // ======
 
+struct BidiagCtrl
+{
+    // Run on the grid chosen by SelectCondenseGrid
+    bool adaptiveGrid=false;
+};
+
 // Return the packed reduction to bidiagonal form
 // ----------------------------------------------
 template<typename Field>
@@ -28,12 +64,8 @@ template<typename Field>
 void Bidiag
 ( AbstractDistMatrix<Field>& A,
   AbstractDistMatrix<Field>& householderScalarsP,
-  AbstractDistMatrix<Field>& householderScalarsQ );
-template<typename Field>
-void Bidiag
-( AbstractDistMatrix<Field>& A,
-  AbstractDistMatrix<Field>& householderScalarsP,
-  AbstractDistMatrix<Field>& householderScalarsQ );
+  AbstractDistMatrix<Field>& householderScalarsQ,
+  const BidiagCtrl& ctrl=BidiagCtrl() );
 
 namespace bidiag {
 
@@ -60,6 +92,12 @@ void ExplicitCondensed( Matrix<Field>& A );
 template<typename Field>
 void ExplicitCondensed( AbstractDistMatrix<Field>& A );
 
+// Only return a condensed real bidiagonal matrix with the same singular
+// values, computed by reducing to a band of the given width (Blocksize() if
+// nonpositive) with level-3 updates and then chasing the band down
+template<typename Field>
+void TwoStageCondensed( AbstractDistMatrix<Field>& A, Int bandwidth=0 );
+
 template<typename Field>
 void ApplyQ
 ( LeftOrRight side, Orientation orientation,
@@ -96,7 +134,8 @@ enum HermitianTridiagApproach
 {
     HERMITIAN_TRIDIAG_NORMAL, // Keep the current grid
     HERMITIAN_TRIDIAG_SQUARE, // Drop to a square process grid
-    HERMITIAN_TRIDIAG_DEFAULT // Square grid algorithm only if already square
+    HERMITIAN_TRIDIAG_DEFAULT, // Square grid algorithm only if already square
+    HERMITIAN_TRIDIAG_ADAPTIVE // Use the grid chosen by SelectCondenseGrid
 };
 }
 using namespace HermitianTridiagApproachNS;
@@ -107,6 +146,13 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<Field> symvCtrl;
+
+    // Reduce to a band of the given width (Blocksize() if nonpositive) using
+    // level-3 updates and then chase the band down to tridiagonal form.
+    // Since the unitary transformations are not kept, this is only used by
+    // herm_tridiag::ExplicitCondensed.
+    bool twoStage=false;
+    Int bandwidth=0;
 };
 
 template<typename Field>
@@ -145,20 +191,54 @@ void ApplyQ
 
 // Hessenberg
 // ==========
+struct HessenbergCtrl
+{
+    // Reduce to block upper-Hessenberg form with the given number of
+    // subdiagonals (Blocksize() if nonpositive) using level-3 updates and then
+    // chase the extra subdiagonals away (see hessenberg::TwoStage). Since the
+    // unitary transformations are not kept in the packed format, this is only
+    // used by hessenberg::ExplicitCondensed and Schur.
+    bool twoStage=false;
+    Int bandwidth=0;
+
+    // Run the one-stage reduction on the grid chosen by SelectCondenseGrid
+    bool adaptiveGrid=false;
+};
+
 template<typename Field>
 void Hessenberg
 ( UpperOrLower uplo, Matrix<Field>& A, Matrix<Field>& householderScalars );
 template<typename Field>
 void Hessenberg
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A,
-  AbstractDistMatrix<Field>& householderScalars );
+  AbstractDistMatrix<Field>& householderScalars,
+  const HessenbergCtrl& ctrl=HessenbergCtrl() );
 
 namespace hessenberg {
 
 template<typename Field>
-void ExplicitCondensed( UpperOrLower uplo, Matrix<Field>& A );
+void ExplicitCondensed
+( UpperOrLower uplo, Matrix<Field>& A,
+  const HessenbergCtrl& ctrl=HessenbergCtrl() );
+template<typename Field>
+void ExplicitCondensed
+( UpperOrLower uplo, AbstractDistMatrix<Field>& A,
+  const HessenbergCtrl& ctrl=HessenbergCtrl() );
+
+// Overwrite A with the upper Hessenberg matrix Q^H A Q, computed by first
+// reducing to block upper-Hessenberg form with the given number of
+// subdiagonals (Blocksize() if nonpositive), and optionally return the
+// explicit unitary matrix Q
+template<typename Field>
+void TwoStage( Matrix<Field>& A, Int bandwidth=0 );
+template<typename Field>
+void TwoStage( Matrix<Field>& A, Matrix<Field>& Q, Int bandwidth=0 );
 template<typename Field>
-void ExplicitCondensed( UpperOrLower uplo, AbstractDistMatrix<Field>& A );
+void TwoStage( AbstractDistMatrix<Field>& A, Int bandwidth=0 );
+template<typename Field>
+void TwoStage
+( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& Q,
+  Int bandwidth=0 );
 
 template<typename Field>
 void ApplyQ
@@ -188,6 +268,29 @@ void FormQ
 
 } // namespace hessenberg
 
+// Hessenberg-triangular
+// =====================
+// Reduce the square pencil (A,B) to (Q^H A Z, Q^H B Z), with the former
+// upper Hessenberg and the latter upper triangular
+template<typename Field>
+void HessenbergTriangular( Matrix<Field>& A, Matrix<Field>& B );
+template<typename Field>
+void HessenbergTriangular
+( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B );
+
+template<typename Field>
+void HessenbergTriangular
+( Matrix<Field>& A,
+  Matrix<Field>& B,
+  Matrix<Field>& Q,
+  Matrix<Field>& Z );
+template<typename Field>
+void HessenbergTriangular
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& B,
+  AbstractDistMatrix<Field>& Q,
+  AbstractDistMatrix<Field>& Z );
+
 } // namespace El
 
 #endif // ifndef EL_CONDENSE_HPP
@@ -13,6 +13,32 @@ namespace El {
 
 // Ruiz scaling
 // ============
+template<typename Real>
+struct RuizEquilCtrl
+{
+    // The maximum number of sweeps, each of which rescales the columns by
+    // their maximum norms and then the rows by theirs
+    Int maxIter=4;
+    // Stop once the column rescaling of a sweep deviates from the identity
+    // by at most this amount (a negative value disables the check)
+    Real tol=-1;
+    bool progress=false;
+};
+
+template<typename Field>
+void RuizEquil
+( Matrix<Field>& A,
+  Matrix<Base<Field>>& dRow,
+  Matrix<Base<Field>>& dCol,
+  const RuizEquilCtrl<Base<Field>>& ctrl );
+
+template<typename Field>
+void RuizEquil
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Base<Field>>& dRow,
+  AbstractDistMatrix<Base<Field>>& dCol,
+  const RuizEquilCtrl<Base<Field>>& ctrl );
+
 template<typename Field>
 void RuizEquil
 ( Matrix<Field>& A,
@@ -23,18 +23,87 @@ namespace El {
 //
 //    min_X || X ||_F s.t. op(A) X = B.
 //
+
+namespace LeastSquaresAlgNS {
+enum LeastSquaresAlg {
+    // LS_TSQR when a distributed, non-transposed A is tall and skinny, and
+    // LS_HOUSEHOLDER otherwise
+    LS_AUTO,
+    // A 2D Householder QR (or LQ) factorization
+    LS_HOUSEHOLDER,
+    // A tall-skinny QR factorization of A in a [VC,STAR] distribution,
+    // requiring a single reduction tree, followed by an implicit application
+    // of Q^H to B
+    LS_TSQR,
+    // The corrected seminormal equations R^H R X = A^H B, where only the
+    // triangular factor R of A is computed, followed by iterative refinement
+    LS_SEMINORMAL
+};
+}
+using namespace LeastSquaresAlgNS;
+
+// TSQR and the seminormal equations are only used for the non-transposed,
+// overdetermined case; other problems fall back to LS_HOUSEHOLDER.
+struct DenseLeastSquaresCtrl
+{
+    LeastSquaresAlg alg=LS_AUTO;
+
+    // A is treated as tall and skinny when its height is at least
+    // 'tallSkinnyRatio' times its width (and TSQR's requirement that the
+    // height is at least the width times the number of processes is met)
+    Int tallSkinnyRatio=50;
+
+    // The number of refinement steps for LS_SEMINORMAL
+    Int refineIts=1;
+
+    qr::TSQRCtrl tsqrCtrl;
+};
+
 template<typename Field>
 void LeastSquares
 ( Orientation orientation,
   const Matrix<Field>& A,
   const Matrix<Field>& B,
-        Matrix<Field>& X );
+        Matrix<Field>& X,
+  const DenseLeastSquaresCtrl& ctrl=DenseLeastSquaresCtrl() );
 template<typename Field>
 void LeastSquares
 ( Orientation orientation,
   const AbstractDistMatrix<Field>& A,
   const AbstractDistMatrix<Field>& B,
-        AbstractDistMatrix<Field>& X );
+        AbstractDistMatrix<Field>& X,
+  const DenseLeastSquaresCtrl& ctrl=DenseLeastSquaresCtrl() );
+
+// Least squares over streamed row blocks
+// --------------------------------------
+// Solve min_X || A X - B ||_F when the rows of [A, B] arrive in blocks which
+// need not fit in memory simultaneously. Only the (n+k) x (n+k) triangular
+// factor of [A, B] = Q [R, C; 0, S] is kept, so that X = inv(R) C and the
+// residual norm is || S ||_F. Each block is absorbed with a QR factorization
+// of the triangle stacked on top of the block.
+template<typename Field>
+class StreamingLeastSquares
+{
+public:
+    StreamingLeastSquares
+    ( Int width, Int numRHS, const Grid& grid=Grid::Default() );
+
+    // [A; B] := [A, B; ABlock, BBlock]
+    void AddRows
+    ( const AbstractDistMatrix<Field>& ABlock,
+      const AbstractDistMatrix<Field>& BBlock );
+
+    void Solve( AbstractDistMatrix<Field>& X ) const;
+
+    // The minimal value of || A X - B ||_F over the rows absorbed so far
+    Base<Field> ResidualNorm() const;
+
+    Int Height() const;
+
+private:
+    Int height_=0, width_, numRHS_;
+    DistMatrix<Field> T_;
+};
 
 template<typename Real>
 struct SQSDCtrl
@@ -179,6 +248,73 @@ void Tikhonov
         AbstractDistMatrix<Field>& X,
   TikhonovAlg alg=TIKHONOV_CHOLESKY );
 
+// Regularization paths
+// ====================
+// Solve the Ridge (or Tikhonov) problem for every regularization parameter
+// gamma_j in the column vector 'gammas' (known to every process) from a
+// single SVD of op(A) (or of op(A) inv(G)), so that each additional
+// parameter only costs O(n^2) work per right-hand side. The solution for
+// gamma_j is returned in columns [j k, (j+1) k) of X, where k is the width
+// of B. Each solution may be a minimum-length one when op(A) is wide.
+//
+// The returned info contains, for each gamma_j, the criteria used to choose
+// a parameter:
+//
+//   residualNorms(j) = || op(A) X_j - B ||_F,
+//   solutionNorms(j) = || X_j ||_F (|| G X_j ||_F for Tikhonov),
+//   gcv(j) = || op(A) X_j - B ||_F^2 / (m - trace(H_j))^2,
+//
+// where H_j = op(A) (op(A)^H op(A) + gamma_j^2 G^H G)^{-1} op(A)^H is the
+// influence matrix, and lCurveCurvatures(j) is the curvature of the
+// L-curve (log residualNorms, log solutionNorms) at gamma_j. The indices of
+// the minimum GCV value and of the maximum L-curve curvature are also
+// returned.
+template<typename Real>
+struct RegularizationPathInfo
+{
+    Matrix<Real> residualNorms;
+    Matrix<Real> solutionNorms;
+    Matrix<Real> gcv;
+    Matrix<Real> lCurveCurvatures;
+    Int gcvIndex=-1;
+    Int lCurveIndex=-1;
+};
+
+template<typename Field>
+RegularizationPathInfo<Base<Field>> RidgePath
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Field>& X );
+template<typename Field>
+RegularizationPathInfo<Base<Field>> RidgePath
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        AbstractDistMatrix<Field>& X );
+
+// Solve min_X || op(A) X - B ||_F^2 + gamma_j^2 || G X ||_F^2 for each
+// gamma_j, where G is square and nonsingular, via the standard-form
+// transformation Y = G X
+template<typename Field>
+RegularizationPathInfo<Base<Field>> TikhonovPath
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Field>& G,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Field>& X );
+template<typename Field>
+RegularizationPathInfo<Base<Field>> TikhonovPath
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+  const AbstractDistMatrix<Field>& G,
+  const Matrix<Base<Field>>& gammas,
+        AbstractDistMatrix<Field>& X );
+
 // Equality-constrained Least Squarees
 // ===================================
 // Solve
@@ -198,6 +334,20 @@ void LSE
   const AbstractDistMatrix<Field>& D,
         AbstractDistMatrix<Field>& X );
 
+// Solve the independent problems
+//   min_{X_k} || A_k X_k - C_k ||_F subject to B X_k = D_k,
+// which share the constraint matrix B, using the given number of threads
+// (defaulting to the hardware concurrency). The RQ factorization of B is
+// only computed once.
+template<typename Field>
+void LSE
+( const vector<Matrix<Field>>& A,
+  const Matrix<Field>& B,
+  const vector<Matrix<Field>>& C,
+  const vector<Matrix<Field>>& D,
+        vector<Matrix<Field>>& X,
+  Int numThreads=0 );
+
 // Dense versions which overwrite inputs where possible
 // ----------------------------------------------------
 namespace lse {
@@ -221,6 +371,48 @@ void Overwrite
   AbstractDistMatrix<Field>& X,
   bool computeResidual=false );
 
+// The implicit Generalized RQ factorization of (B,A), which can be reused to
+// solve for any number of right-hand sides (C,D)
+template<typename Field>
+struct Factorization
+{
+    Matrix<Field> A, B;
+    Matrix<Field> householderScalarsA, householderScalarsB;
+    Matrix<Base<Field>> signatureA, signatureB;
+};
+
+template<typename Field>
+struct DistFactorization
+{
+    DistMatrix<Field> A, B;
+    DistMatrix<Field,MD,STAR> householderScalarsA, householderScalarsB;
+    DistMatrix<Base<Field>,MD,STAR> signatureA, signatureB;
+};
+
+template<typename Field>
+void Factor
+( const Matrix<Field>& A,
+  const Matrix<Field>& B,
+        Factorization<Field>& factorization );
+template<typename Field>
+void Factor
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+        DistFactorization<Field>& factorization );
+
+template<typename Field>
+void SolveAfter
+( const Factorization<Field>& factorization,
+  const Matrix<Field>& C,
+  const Matrix<Field>& D,
+        Matrix<Field>& X );
+template<typename Field>
+void SolveAfter
+( const DistFactorization<Field>& factorization,
+  const AbstractDistMatrix<Field>& C,
+  const AbstractDistMatrix<Field>& D,
+        AbstractDistMatrix<Field>& X );
+
 } // namespace lse
 
 // General (Gauss-Markov) Linear Model
@@ -10,9 +10,10 @@
 #define EL_FACTOR_HPP
 
 #include <El/lapack_like/perm.hpp>
+#include <El/lapack_like/reflect.hpp>
 #include <El/lapack_like/util.hpp>
-//#include <El/lapack_like/factor/ldl/sparse/symbolic.hpp>
-//#include <El/lapack_like/factor/ldl/sparse/numeric.hpp>
+#include <El/lapack_like/factor/ldl/sparse/symbolic.hpp>
+#include <El/lapack_like/factor/ldl/sparse/numeric.hpp>
 
 namespace El {
 
@@ -28,17 +29,70 @@ void Cholesky( UpperOrLower uplo, DistMatrix<Field,STAR,STAR>& A );
 
 template<typename Field>
 void ReverseCholesky( UpperOrLower uplo, Matrix<Field>& A );
+
 template<typename Field>
 void ReverseCholesky( UpperOrLower uplo, AbstractDistMatrix<Field>& A );
 template<typename Field>
 void ReverseCholesky( UpperOrLower uplo, DistMatrix<Field,STAR,STAR>& A );
 
+// Factor each n x n member of a batch of HPD matrices in place (see
+// BatchedGemm for the storage formats). A NonHPDMatrixException is thrown
+// if any member is not numerically HPD.
+template<typename Field>
+void BatchedCholesky
+( UpperOrLower uplo, Int n,
+  Field* A, Int ALDim, Int AStride,
+  Int batchSize );
+template<typename Field>
+void BatchedCholesky
+( UpperOrLower uplo, Int n,
+  const vector<Field*>& A, Int ALDim );
+
 template<typename Field>
 void Cholesky( UpperOrLower uplo, Matrix<Field>& A, Permutation& P );
 template<typename Field>
 void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A, DistPermutation& P );
 
+// Out-of-core factorization
+// -------------------------
+// Matrices too large to be held in (aggregate) memory can be factored in
+// place within a file in the BINARY format of write::Binary, which must be
+// visible to every process. Column panels are streamed through memory in a
+// left-looking fashion, and the panel reads can be overlapped with the
+// in-core updates.
+struct OutOfCoreCtrl
+{
+    // The number of columns in each panel. If nonpositive, each process is
+    // assigned one algorithmic block of columns per panel.
+    Int panelWidth=0;
+
+    // Read the next panel on a helper thread during each update
+    bool asyncRead=true;
+
+    bool progress=false;
+};
+
+// Overwrite the lower triangle of the file with L, where A = L L^H
+template<typename Field>
+void OutOfCoreCholesky
+( const Grid& grid,
+  const string& filename,
+  const OutOfCoreCtrl& ctrl=OutOfCoreCtrl() );
+
+// Tiled Cholesky
+// --------------
+// The matrix is decomposed into square tiles (views into A) whose
+// factorizations, triangular solves, and updates are scheduled by a TaskGraph
+// so that the updates of each step overlap with the factorization of the
+// next diagonal tile, rather than relying upon a multithreaded LAPACK which
+// stalls at panel boundaries. A NonHPDMatrixException is rethrown from the
+// task which encountered it.
+template<typename Field>
+void TiledCholesky
+( UpperOrLower uplo, Matrix<Field>& A,
+  const TiledCtrl& ctrl=TiledCtrl() );
+
 template<typename Field>
 void CholeskyMod
 ( UpperOrLower uplo,
@@ -89,6 +143,91 @@ void SolveAfter
 
 } // namespace cholesky
 
+// Rectangular full packed storage
+// -------------------------------
+// A Hermitian (or triangular) n x n matrix is stored in an
+// (n+1) x n/2 (for even n) or n x (n+1)/2 (for odd n) matrix following
+// LAPACK's TRANSR='N', UPLO='L' rectangular full packed (RFP) format:
+// partitioning A = [A11, A21^H; A21, A22] with A11 of order ceil(n/2), the
+// lower triangle of A11, the upper triangle of A22^H, and A21 fill a single
+// rectangle so that roughly half of the memory of full storage is required
+// while every operation is still composed of full-storage level 3 kernels.
+namespace rfp {
+
+// The order of the matrix stored in a height x width RFP array
+Int Order( Int height, Int width );
+// The dimensions of the RFP array for an n x n matrix
+Int Height( Int n );
+Int Width( Int n );
+
+template<typename Field>
+void Pack
+( UpperOrLower uplo, const Matrix<Field>& A, Matrix<Field>& ARFP );
+template<typename Field>
+void Pack
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& ARFP );
+
+// Form the lower triangle of the full matrix (the strictly upper triangle is
+// zeroed)
+template<typename Field>
+void Unpack( const Matrix<Field>& ARFP, Matrix<Field>& A );
+template<typename Field>
+void Unpack
+( const AbstractDistMatrix<Field>& ARFP, AbstractDistMatrix<Field>& A );
+
+// Overwrite the packed matrix with its packed lower Cholesky factor
+template<typename Field>
+void Cholesky( Matrix<Field>& ARFP );
+template<typename Field>
+void Cholesky( AbstractDistMatrix<Field>& ARFP );
+
+// B := alpha op(L)^{-1} B, where L is a packed lower triangular matrix
+template<typename Field>
+void Trsm
+( Orientation orientation,
+  Field alpha,
+  const Matrix<Field>& LRFP,
+        Matrix<Field>& B );
+template<typename Field>
+void Trsm
+( Orientation orientation,
+  Field alpha,
+  const AbstractDistMatrix<Field>& LRFP,
+        AbstractDistMatrix<Field>& B );
+
+// C := alpha op(A) op(A)^H + beta C, where C is packed
+template<typename Field>
+void Herk
+( Orientation orientation,
+  Base<Field> alpha,
+  const Matrix<Field>& A,
+  Base<Field> beta,
+        Matrix<Field>& CRFP );
+template<typename Field>
+void Herk
+( Orientation orientation,
+  Base<Field> alpha,
+  const AbstractDistMatrix<Field>& A,
+  Base<Field> beta,
+        AbstractDistMatrix<Field>& CRFP );
+
+// Solve A X = B given the packed Cholesky factor of A
+template<typename Field>
+void SolveAfter( const Matrix<Field>& LRFP, Matrix<Field>& B );
+template<typename Field>
+void SolveAfter
+( const AbstractDistMatrix<Field>& LRFP, AbstractDistMatrix<Field>& B );
+
+// Overwrite the packed matrix with its Cholesky factor and B with A^{-1} B
+template<typename Field>
+void HPDSolve( Matrix<Field>& ARFP, Matrix<Field>& B );
+template<typename Field>
+void HPDSolve( AbstractDistMatrix<Field>& ARFP, AbstractDistMatrix<Field>& B );
+
+} // namespace rfp
+
 // LDL
 // ===
 namespace LDLPivotTypeNS {
@@ -174,6 +313,20 @@ InertiaType Inertia
 ( const AbstractDistMatrix<Base<Field>>& d,
   const AbstractDistMatrix<Field>& dSub );
 
+// Compute both the inertia and the (safely-represented) determinant of a
+// Hermitian matrix from its Bunch-Kaufman LDL^H factorization in one pass
+// -----------------------------------------------------------------------
+template<typename Field>
+SafeProduct<Base<Field>> DeterminantAndInertia
+( const Matrix<Base<Field>>& d,
+  const Matrix<Field>& dSub,
+  InertiaType& inertia );
+template<typename Field>
+SafeProduct<Base<Field>> DeterminantAndInertia
+( const AbstractDistMatrix<Base<Field>>& d,
+  const AbstractDistMatrix<Field>& dSub,
+  InertiaType& inertia );
+
 // Multiply vectors using an implicit representation of an LDL factorization
 // -------------------------------------------------------------------------
 template<typename Field>
@@ -234,6 +387,18 @@ void SolveAfter
         AbstractDistMatrix<Field>& B,
   bool conjugated );
 
+// Aasen's factorization P A P^T = L T L^{T/H}, with T tridiagonal
+// -----------------------------------------------------------------
+template<typename Field>
+void Aasen( Matrix<Field>& A, Permutation& P, bool conjugate=false );
+
+template<typename Field>
+void SolveAfterAasen
+( const Matrix<Field>& A,
+  const Permutation& P,
+        Matrix<Field>& B,
+  bool conjugated=false );
+
 } // namespace ldl
 
 // Solve a linear system with a regularized factorization
@@ -241,7 +406,12 @@ void SolveAfter
 enum RegSolveAlg
 {
   REG_SOLVE_FGMRES,
-  REG_SOLVE_LGMRES
+  REG_SOLVE_LGMRES,
+  // Pipelined CG and MINRES require A to be Hermitian and the regularized
+  // factorization to be HPD (CG additionally requires A to be HPD); the
+  // 'restart' parameter is ignored
+  REG_SOLVE_CG,
+  REG_SOLVE_MINRES
 };
 
 template<typename Real>
@@ -264,20 +434,148 @@ struct RegSolveCtrl
     }
 };
 
+namespace reg_ldl {
+
+// Overwrite the lower triangle of the Hermitian quasi-semidefinite matrix A
+// with the unpivoted LDL^H factorization of A + diag(reg), where the first n0
+// pivots should be positive and the remainder negative. Each pivot of the
+// wrong sign, or of magnitude less than the (positive) candidate regCand(j),
+// is replaced by +-regCand(j), and the perturbation is returned in 'reg'.
+// As no pivot search is performed, the factorization is purely level-3 and
+// requires no pivot communication.
+template<typename Field>
+void RegularizedQSDLDL
+( Int n0,
+  Matrix<Field>& A,
+  const Matrix<Base<Field>>& regCand,
+        Matrix<Base<Field>>& reg );
+template<typename Field>
+void RegularizedQSDLDL
+( Int n0,
+  AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Base<Field>>& regCand,
+        AbstractDistMatrix<Base<Field>>& reg );
+
+} // namespace reg_ldl
+
+// Solve A X = B using a factorization of A + diag(reg) (optionally with a
+// symmetric diagonal equilibration d) as a preconditioner
+namespace reg_ldl {
+
+template<typename Field>
+Int RegularizedSolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const SparseLDLFactorization<Field>& sparseLDLFact,
+        Matrix<Field>& B,
+  Base<Field> relTol,
+  Int maxRefineIts,
+  bool progress=false,
+  bool time=false );
+template<typename Field>
+Int RegularizedSolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const Matrix<Base<Field>>& d,
+  const SparseLDLFactorization<Field>& sparseLDLFact,
+        Matrix<Field>& B,
+  Base<Field> relTol,
+  Int maxRefineIts,
+  bool progress=false,
+  bool time=false );
+template<typename Field>
+Int RegularizedSolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistSparseLDLFactorization<Field>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  Base<Field> relTol,
+  Int maxRefineIts,
+  bool progress=false,
+  bool time=false );
+template<typename Field>
+Int RegularizedSolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistMultiVec<Base<Field>>& d,
+  const DistSparseLDLFactorization<Field>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  Base<Field> relTol,
+  Int maxRefineIts,
+  bool progress=false,
+  bool time=false );
+
+template<typename Field>
+Int SolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const SparseLDLFactorization<Field>& sparseLDLFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl=RegSolveCtrl<Base<Field>>() );
+template<typename Field>
+Int SolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const Matrix<Base<Field>>& d,
+  const SparseLDLFactorization<Field>& sparseLDLFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl=RegSolveCtrl<Base<Field>>() );
+template<typename Field>
+Int SolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistSparseLDLFactorization<Field>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl=RegSolveCtrl<Base<Field>>() );
+template<typename Field>
+Int SolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistMultiVec<Base<Field>>& d,
+  const DistSparseLDLFactorization<Field>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl=RegSolveCtrl<Base<Field>>() );
+
+// Solve A X = B, where only the 'uplo' triangle of the Hermitian matrix A is
+// accessed, using the RegularizedQSDLDL factorization AFact of
+// A + diag(reg) (plus any dynamic regularization) as a preconditioner
+template<typename Field>
+Int SolveAfter
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const Matrix<Field>& AFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl=RegSolveCtrl<Base<Field>>() );
+template<typename Field>
+Int SolveAfter
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Base<Field>>& reg,
+  const AbstractDistMatrix<Field>& AFact,
+        AbstractDistMatrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl=RegSolveCtrl<Base<Field>>() );
+
+} // namespace reg_ldl
+
 
 // LU
 // ==
 
-// NOTE: This is not yet made use of, but the fully-pivoted version of LU
-//       should (soon?) accept it as an argument and potentially return one or
-//       more of the permutation matrices as the identity
+// NOTE: This is currently only used to select between partial and
+//       tournament pivoting, but the fully-pivoted version of LU should
+//       (soon?) accept it as an argument and potentially return one or more
+//       of the permutation matrices as the identity
 namespace LUPivotTypeNS {
 enum LUPivotType
 {
     LU_PARTIAL,
     LU_FULL,
     LU_ROOK, /* not yet supported */
-    LU_WITHOUT_PIVOTING
+    LU_WITHOUT_PIVOTING,
+    // Partial pivoting where the pivot rows of each panel are chosen by a
+    // tournament over the process column (communication-avoiding LU)
+    LU_CALU
 };
 }
 using namespace LUPivotTypeNS;
@@ -297,6 +595,46 @@ template<typename Field>
 void LU( Matrix<Field>& A, Permutation& P );
 template<typename Field>
 void LU( AbstractDistMatrix<Field>& A, DistPermutation& P );
+// Only LU_PARTIAL and LU_CALU are supported as the pivot type
+template<typename Field>
+void LU
+( AbstractDistMatrix<Field>& A, DistPermutation& P, LUPivotType pivotType );
+
+// Overwrite the file with the factors of P A = L U (see OutOfCoreCholesky)
+template<typename Field>
+void OutOfCoreLU
+( const Grid& grid,
+  const string& filename,
+  DistPermutation& P,
+  const OutOfCoreCtrl& ctrl=OutOfCoreCtrl() );
+
+// Tiled LU with partial pivoting
+// ------------------------------
+// Each (tile-wide) column panel is factored as a single task, while the row
+// interchanges, triangular solves, and updates of the remaining tiles are
+// scheduled by a TaskGraph (so that the factorization of the next panel can
+// begin as soon as its own column has been updated). The factorization is
+// identical in format to LU( A, P ).
+template<typename Field>
+void TiledLU
+( Matrix<Field>& A, Permutation& P,
+  const TiledCtrl& ctrl=TiledCtrl() );
+
+// Batched LU with partial pivoting
+// ---------------------------------
+// Factor each m x n member of the batch in place. Row i of a member was
+// interchanged with row pivots[i] (zero-based) for i < min(m,n).
+template<typename Field>
+void BatchedLU
+( Int m, Int n,
+  Field* A, Int ALDim, Int AStride,
+  Int* pivots, Int pivotStride,
+  Int batchSize );
+template<typename Field>
+void BatchedLU
+( Int m, Int n,
+  const vector<Field*>& A, Int ALDim,
+  const vector<Int*>& pivots );
 
 // LU with full pivoting
 // ---------------------
@@ -483,6 +821,14 @@ struct QRCtrl
     // instead, as it is often the case that one may desire a custom pivoting
     // rule.
     bool smallestFirst=false;
+
+    // Rather than updating the column norms after each Householder
+    // reflection, choose each block of pivots from a Gaussian sketch of the
+    // remaining columns (with the given number of oversampled rows) and
+    // factor the block with blocked Householder (HQRRP). This is not
+    // supported for smallestFirst.
+    bool randomized=false;
+    Int oversampling=10;
 };
 
 // Return an implicit representation of Q and R such that A = Q R
@@ -498,6 +844,17 @@ void QR
   AbstractDistMatrix<Field>& householderScalars,
   AbstractDistMatrix<Base<Field>>& signature );
 
+// A tiled version of the above in which the Householder panels (of the tile
+// width) are factored by individual tasks and applied to each remaining tile
+// column by others, as scheduled by a TaskGraph. The representation is
+// identical in format to that of the above, e.g., for usage with qr::ApplyQ.
+template<typename Field>
+void TiledQR
+( Matrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  Matrix<Base<Field>>& signature,
+  const TiledCtrl& ctrl=TiledCtrl() );
+
 // Return an implicit representation of (Q,R,Omega) such that A Omega^T ~= Q R
 // ---------------------------------------------------------------------------
 template<typename Field>
@@ -536,6 +893,27 @@ void ApplyQ
   const AbstractDistMatrix<Base<Field>>& signature,
         AbstractDistMatrix<Field>& B );
 
+// Apply Q while retaining the panels of its reflectors (and their triangular
+// factors) for reuse in subsequent applications of the same Q
+template<typename Field>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const Matrix<Base<Field>>& signature,
+        Matrix<Field>& B,
+        PackedReflectorPanels<Field>& panels );
+template<typename Field>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalars,
+  const AbstractDistMatrix<Base<Field>>& signature,
+        AbstractDistMatrix<Field>& B,
+        DistPackedReflectorPanels<Field>& panels );
+
 // Solve a linear system with the implicit QR factorization
 // --------------------------------------------------------
 template<typename Field>
@@ -558,10 +936,32 @@ void SolveAfter
 
 // Cholesky-based QR
 // -----------------
+enum CholeskyQRVariant
+{
+  CHOLESKY_QR,
+  CHOLESKY_QR2,
+  SHIFTED_CHOLESKY_QR3
+};
+
+struct CholeskyQRCtrl
+{
+    CholeskyQRVariant variant=CHOLESKY_QR;
+
+    // Form (and factor) the Gram matrix in the promoted precision, e.g.,
+    // DoubleDouble for double, and round the triangular factor afterwards
+    bool promoteGram=false;
+};
+
 template<typename Field>
-void Cholesky( Matrix<Field>& A, Matrix<Field>& R );
+void Cholesky
+( Matrix<Field>& A,
+  Matrix<Field>& R,
+  const CholeskyQRCtrl& ctrl=CholeskyQRCtrl() );
 template<typename Field>
-void Cholesky( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
+void Cholesky
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& R,
+  const CholeskyQRCtrl& ctrl=CholeskyQRCtrl() );
 
 // Return R (with non-negative diagonal) such that A = Q R or A Omega^T = Q R
 // --------------------------------------------------------------------------
@@ -636,6 +1036,29 @@ void DisjointNeighborColSwaps
         Matrix<Field>& R,
   const Matrix<Int>& colSwaps );
 
+// The shape of the reduction tree used by tall-skinny QR
+enum TSQRTree
+{
+  // A binomial tree over the processes, which reduces to the classical
+  // butterfly when the number of processes is a power of two
+  TSQR_BINARY,
+  // The root directly absorbs the triangle of every other process
+  TSQR_FLAT,
+  // A flat tree within each group of groupSize consecutive processes
+  // followed by a binomial tree over the group leaders
+  TSQR_HYBRID
+};
+
+struct TSQRCtrl
+{
+    TSQRTree tree=TSQR_BINARY;
+
+    // The number of consecutive processes within each group of a hybrid tree.
+    // If nonpositive, the number of processes sharing a node is used, which
+    // assumes that ranks are placed on nodes in contiguous blocks.
+    Int groupSize=0;
+};
+
 template<typename Field>
 struct TreeData
 {
@@ -644,6 +1067,7 @@ struct TreeData
     vector<Matrix<Field>> QRList;
     vector<Matrix<Field>> householderScalarsList;
     vector<Matrix<Base<Field>>> signatureList;
+    TSQRCtrl ctrl;
 
     TreeData( Int numStages=0 )
     : QRList(numStages),
@@ -657,7 +1081,8 @@ struct TreeData
       signature0(move(treeData.signature0)),
       QRList(move(treeData.QRList)),
       householderScalarsList(move(treeData.householderScalarsList)),
-      signatureList(move(treeData.signatureList))
+      signatureList(move(treeData.signatureList)),
+      ctrl(treeData.ctrl)
     { }
 
     TreeData<Field>& operator=( TreeData<Field>&& treeData )
@@ -668,20 +1093,46 @@ struct TreeData
         QRList = move(treeData.QRList);
         householderScalarsList = move(treeData.householderScalarsList);
         signatureList = move(treeData.signatureList);
+        ctrl = treeData.ctrl;
         return *this;
     }
 };
 
 // Return an implicit tall-skinny QR factorization
 template<typename Field>
-TreeData<Field> TS( const AbstractDistMatrix<Field>& A );
+TreeData<Field> TS
+( const AbstractDistMatrix<Field>& A, const TSQRCtrl& ctrl=TSQRCtrl() );
 
 // Return an explicit tall-skinny QR factorization
 template<typename Field>
-void ExplicitTS( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
+void ExplicitTS
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& R,
+  const TSQRCtrl& ctrl=TSQRCtrl() );
+
+// Communication-avoiding QR: the 2D Householder QR in which each panel is
+// factored with TSQR and its Householder vectors are then reconstructed from
+// the explicit tall-skinny Q. The result is in the same implicit format as
+// QR(A,householderScalars,signature).
+template<typename Field>
+void CA
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  AbstractDistMatrix<Base<Field>>& signature,
+  const TSQRCtrl& ctrl=TSQRCtrl() );
 
 namespace ts {
 
+// Overwrite B with Q B or Q^H B, where Q is the (square) unitary matrix
+// implicitly defined by the result of qr::TS(A). B must have the same height
+// and column distribution as A.
+template<typename Field>
+void ApplyQ
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const TreeData<Field>& treeData,
+        AbstractDistMatrix<Field>& B );
+
 template<typename Field>
 Matrix<Field>& RootQR
 ( const AbstractDistMatrix<Field>& A, TreeData<Field>& treeData );
@@ -700,6 +1151,55 @@ void Scatter( AbstractDistMatrix<Field>& A, const TreeData<Field>& treeData );
 
 } // namespace qr
 
+// A persistent, updatable QR factorization
+// ----------------------------------------
+// Only the upper-triangular factor R (with non-negative diagonal) of the
+// m x n matrix A = Q R, with m >= n, is stored, and it is kept in a DistMatrix
+// between calls so that A can be modified without refactoring. Since
+// A^H A = R^H R, appending or removing the rows W requires the (hyperbolic)
+// Householder modification R^H R +/- W^H W, which costs O(n^2) work per row.
+// Modifying the columns requires the current A, as Q is never formed.
+template<typename Field>
+class UpdatableQR
+{
+public:
+    UpdatableQR( const Grid& grid=Grid::Default() );
+
+    // Factor A from scratch
+    void Initialize( const AbstractDistMatrix<Field>& A );
+
+    // A := [A; W]
+    void AddRows( const AbstractDistMatrix<Field>& W );
+
+    // Remove the rows W from A. This fails if the result would not have
+    // full column rank.
+    void RemoveRows( const AbstractDistMatrix<Field>& W );
+
+    // A := [A, C], where A is the matrix currently represented by R. The new
+    // columns are orthogonalized against Q = A inv(R) twice.
+    void AddColumns
+    ( const AbstractDistMatrix<Field>& A,
+      const AbstractDistMatrix<Field>& C );
+
+    // Delete columns j through j+numCols-1 of A
+    void DeleteColumns( Int j, Int numCols=1 );
+
+    // Solve min_X || A X - B ||_F using the corrected seminormal equations,
+    // where A is the matrix currently represented by R
+    void LeastSquares
+    ( const AbstractDistMatrix<Field>& A,
+      const AbstractDistMatrix<Field>& B,
+            AbstractDistMatrix<Field>& X ) const;
+
+    Int Height() const;
+    Int Width() const;
+    const DistMatrix<Field>& R() const;
+
+private:
+    Int height_=0;
+    DistMatrix<Field> R_;
+};
+
 // RQ
 // ==
 template<typename Field>
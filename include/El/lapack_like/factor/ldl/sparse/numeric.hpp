@@ -250,6 +250,46 @@ struct DistMatrixNode
 template<typename Field>
 struct DistFront;
 
+enum PullDestination
+{
+  PULL_DENSE,
+  PULL_SPARSE,
+  PULL_SPARSE_DIAGONAL,
+  PULL_SPARSE_MIRROR
+};
+
+// The destinations within a sequential frontal tree of the nonzeros of the
+// sparse matrix it was pulled from. This allows the fronts to be refilled from
+// a matrix with the same sparsity pattern without any symbolic work.
+struct PullPlan
+{
+    Int numEntries=0;
+
+    // The nonzero index of the source of each destination, the index of the
+    // front (in preorder), and the row and column within its dense part
+    // (or, for sparse leaves, the nonzero index within 'workSparse' as the
+    // row).
+    vector<Int> sources, fronts, rows, cols;
+    vector<PullDestination> kinds;
+};
+
+// The communication pattern of DistFront<Field>::Pull, so that subsequent
+// pulls from a matrix with the same (distributed) sparsity pattern only need
+// to pack the nonzeros and perform a single AllToAll.
+struct DistPullPlan
+{
+    Int numLocalEntries=0;
+
+    // The local nonzero indices of the entries sent to each process
+    vector<Int> sendInds;
+    vector<int> sendSizes, sendOffs;
+
+    vector<int> recvSizes, recvOffs;
+    vector<Int> recvRowLengths;
+    vector<int> recvRowOffs;
+    vector<Int> recvTargets;
+};
+
 template<typename Field>
 struct Front
 {
@@ -299,6 +339,16 @@ struct Front
       const vector<Int>& reordering,
       const NodeInfo& rootInfo );
 
+    // Record where each nonzero of A was placed by Pull
+    void FormPullPlan
+    ( const SparseMatrix<Field>& A,
+      const vector<Int>& reordering,
+      const NodeInfo& rootInfo,
+            PullPlan& plan ) const;
+    // Overwrite the (possibly factored) fronts in place with the entries of a
+    // matrix with the same sparsity pattern as the one the plan was formed for
+    void Refill( const SparseMatrix<Field>& A, const PullPlan& plan );
+
     void Push
     (       SparseMatrix<Field>& A,
       const vector<Int>& reordering,
@@ -394,6 +444,24 @@ struct DistFront
             vector<Int>& colOffs,
       bool hermitian=false );
 
+    // Form the communication pattern of Pull without moving any values
+    void FormPullPlan
+    ( const DistSparseMatrix<Field>& A,
+      const DistMap& reordering,
+      const DistSeparator& rootSep,
+      const DistNodeInfo& info,
+            vector<Int>& mappedSources,
+            vector<Int>& mappedTargets,
+            vector<Int>& colOffs,
+            DistPullPlan& plan ) const;
+    // Pull from a matrix with the sparsity pattern the plan was formed for
+    void Pull
+    ( const DistSparseMatrix<Field>& A,
+      const DistSeparator& rootSep,
+      const DistNodeInfo& info,
+      const DistPullPlan& plan,
+      bool hermitian=false );
+
     void PullUpdate
     ( const DistSparseMatrix<Field>& A,
       const DistMap& reordering,
@@ -472,6 +540,13 @@ public:
     // Factor the initialized multifrontal tree.
     void Factor( LDLFrontType frontType=LDL_2D );
 
+    // Refactor with a new matrix with the same sparsity pattern as the one
+    // used for initialization. The ordering, elimination tree and front
+    // buffers are all reused (as is the placement of each nonzero after the
+    // first call), so that only the numeric factorization is performed.
+    void Refactor
+    ( const SparseMatrix<Field>& ANew, LDLFrontType frontType=LDL_2D );
+
     // Change the storage format of the multifrontal tree. This can be called
     // either before or after factorization.
     void ChangeFrontType( LDLFrontType frontType );
@@ -544,6 +619,10 @@ private:
     unique_ptr<ldl::Separator> separator_;
 
     vector<Int> map_, inverseMap_;
+
+    // The placement of the nonzeros for refactorizations
+    bool formedPullPlan_=false;
+    ldl::PullPlan pullPlan_;
 };
 
 template<typename Field>
@@ -585,6 +664,13 @@ public:
     // Factor the initialized multifrontal tree.
     void Factor( LDLFrontType frontType=LDL_2D );
 
+    // Refactor with a new matrix with the same (distributed) sparsity pattern
+    // as the one used for initialization. The ordering, elimination tree and
+    // communication pattern for the nonzeros are all reused, so that only a
+    // single AllToAll precedes the numeric factorization.
+    void Refactor
+    ( const DistSparseMatrix<Field>& ANew, LDLFrontType frontType=LDL_2D );
+
     // Change the storage format of the multifrontal tree. This can be called
     // either before or after factorization.
     void ChangeFrontType( LDLFrontType frontType );
@@ -672,6 +758,7 @@ private:
     // Metadata for repeated calls to DistFront<Field>::Pull
     mutable bool formedPullMetadata_=false;
     mutable vector<Int> mappedSources_, mappedTargets_, columnOffsets_;
+    mutable ldl::DistPullPlan pullPlan_;
 
     // Metadata for future use.
     mutable ldl::DistMultiVecNodeMeta dmvMeta_;
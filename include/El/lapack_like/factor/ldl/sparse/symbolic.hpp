@@ -25,6 +25,73 @@
 #include <El/lapack_like/factor/ldl/sparse/symbolic/NodeInfo.hpp>
 
 namespace El {
+
+// Graph bisection
+// ===============
+struct BisectCtrl
+{
+    // If true, each distributed graph is gathered onto every process and
+    // bisected redundantly; otherwise, it is bisected in place with
+    // ParMETIS (if available) or with distributed breadth-first searches
+    bool sequential=false;
+    int numDistSeps=1;
+    int numSeqSeps=1;
+    Int cutoff=128;
+    bool storeFactRecvInds=true;
+
+    // Relaxed supernode amalgamation of the sequential elimination tree:
+    // a child separator is merged into its parent when the merged node has
+    // at most 'relaxSize' indices or when the explicit zeros the merge
+    // introduces are at most 'relaxFraction' of the merged front
+    bool amalgamate=true;
+    Int relaxSize=16;
+    double relaxFraction=0.1;
+};
+
+// Partition the sources of a symmetric graph into two halves and a separator.
+// The map sends each source to its new index, where the left half comes first,
+// followed by the right half and then the separator, and the return value is
+// the size of the separator. The separators are chosen from the level sets
+// of breadth-first searches, trying up to ctrl.numSeqSeps starting vertices.
+Int Bisect
+( const Graph& graph,
+        Graph& leftChild,
+        Graph& rightChild,
+        vector<Int>& map,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
+// The lower half of the processes receives the left child and the upper half
+// the right child. Unless ctrl.sequential is true, the graph is never
+// gathered: the parts are computed by ParMETIS or by the distributed analogue
+// of the sequential level-set bisection, and each child is sent directly to
+// its new owners.
+Int Bisect
+( const DistGraph& graph,
+        unique_ptr<El::Grid>& childGrid,
+        DistGraph& child,
+        DistMap& map,
+        bool& childIsOnLeft,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
+// Bisect the natural (x fastest) ordering of an nx x ny x nz grid graph with
+// a plane normal to its longest dimension
+Int NaturalBisect
+( Int nx, Int ny, Int nz,
+  const Graph& graph,
+  Int& nxLeft, Int& nyLeft, Int& nzLeft,
+  Graph& leftChild,
+  Int& nxRight, Int& nyRight, Int& nzRight,
+  Graph& rightChild,
+  vector<Int>& map );
+Int NaturalBisect
+( Int nx, Int ny, Int nz,
+  const DistGraph& graph,
+  Int& nxChild, Int& nyChild, Int& nzChild,
+  unique_ptr<El::Grid>& childGrid,
+  DistGraph& child,
+  DistMap& map,
+  bool& childIsOnLeft );
+
 namespace ldl {
 
 Int Analysis( NodeInfo& rootInfo, Int myOff=0 );
@@ -37,6 +104,16 @@ void AMDOrder
         double* control=nullptr,
         double* info=nullptr );
 
+// Merge the separators of the sequential elimination tree into supernodes
+// according to the relaxation parameters of ctrl. Only a child whose indices
+// immediately precede those of its parent (the last child in the nested
+// dissection ordering) and which is not a sparse leaf may be merged, so that
+// the ordering, and hence the reordering map, is unchanged.
+void Amalgamate
+( Separator& rootSep,
+  NodeInfo& rootInfo,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
 void NestedDissection
 ( const Graph& graph,
         vector<Int>& map,
@@ -23,6 +23,19 @@ enum SignScaling {
 }
 using namespace SignScalingNS;
 
+namespace SignMethodNS {
+enum SignMethod {
+    SIGN_NEWTON,
+    // Newton's iteration until || I - X^2 ||_1 <= switchTol, then the
+    // inverse-free Newton-Schulz iteration
+    SIGN_NEWTON_SCHULZ_HYBRID,
+    // The principal Pade iteration in partial-fraction form, whose
+    // 'padeOrder' shifted solves are independent
+    SIGN_PADE
+};
+}
+using namespace SignMethodNS;
+
 template<typename Real>
 struct SignCtrl
 {
@@ -30,6 +43,11 @@ struct SignCtrl
     Real tol=Real(0);
     Real power=Real(1);
     SignScaling scaling=SIGN_SCALE_FROB;
+    SignMethod method=SIGN_NEWTON_SCHULZ_HYBRID;
+    Real switchTol=Real(1)/Real(4);
+    Int padeOrder=4;
+    // The distributed Pade iteration splits its terms over this many subgrids
+    Int numSubgrids=1;
     bool progress=false;
 };
 
@@ -42,6 +60,21 @@ struct SquareRootCtrl
     bool progress=false;
 };
 
+template<typename Real>
+struct KrylovFunctionCtrl
+{
+    // The maximum number of block Krylov steps
+    Int maxIts=50;
+
+    // Stop once a step changes the approximation of f(A) B by at most
+    // relTol times its Frobenius norm
+    Real relTol;
+
+    bool progress=false;
+
+    KrylovFunctionCtrl() { relTol = Pow(limits::Epsilon<Real>(),Real(0.75)); }
+};
+
 // Hermitian function
 // ==================
 template<typename Field>
@@ -62,6 +95,56 @@ void HermitianFunction
 ( UpperOrLower uplo, AbstractDistMatrix<Complex<Real>>& A,
   function<Complex<Real>(const Real&)> func );
 
+// Matrix functions applied to thin blocks
+// =======================================
+// Approximate X := f(A) B, where B has few columns, from the block Krylov
+// subspace span{B, A B, A^2 B, ...} without forming f(A): an orthonormal
+// basis V_m of the first m blocks is built with a (fully reorthogonalized)
+// block Arnoldi process and X ~= V_m f(H_m) V_m^H B, where H_m = V_m^H A V_m
+// is small. For m steps this costs O(n^2 k m) rather than the O(n^3) of a
+// dense evaluation.
+
+// A is Hermitian and f is real-valued on its (real) spectrum
+template<typename Field>
+void HermitianFunctionTimes
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  function<Base<Field>(const Base<Field>&)> func,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl=
+        KrylovFunctionCtrl<Base<Field>>() );
+template<typename Field>
+void HermitianFunctionTimes
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+        AbstractDistMatrix<Field>& X,
+  function<Base<Field>(const Base<Field>&)> func,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl=
+        KrylovFunctionCtrl<Base<Field>>() );
+
+// A is a general square matrix. f(H_m) is evaluated through an
+// eigendecomposition of H_m, and, for real A, f must satisfy
+// f(conj(z)) = conj(f(z)) (e.g., the principal exp, sqrt, and log) so that
+// f(A) B is real.
+template<typename Field>
+void MatrixFunctionTimes
+( const Matrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  function<Complex<Base<Field>>(const Complex<Base<Field>>&)> func,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl=
+        KrylovFunctionCtrl<Base<Field>>() );
+template<typename Field>
+void MatrixFunctionTimes
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+        AbstractDistMatrix<Field>& X,
+  function<Complex<Base<Field>>(const Complex<Base<Field>>&)> func,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl=
+        KrylovFunctionCtrl<Base<Field>>() );
+
 // Inverse
 // =======
 template<typename Field>
@@ -79,6 +162,14 @@ template<typename Field>
 void AfterLUPartialPiv
 (       AbstractDistMatrix<Field>& A,
   const DistPermutation& P );
+
+// Overwrite A with its inverse via blocked Gauss-Jordan elimination with
+// partial pivoting, which requires a single (Gemm-dominated) sweep rather
+// than the three sweeps of LU, TriangularInverse, and the final solve
+template<typename Field>
+void GaussJordan( Matrix<Field>& A );
+template<typename Field>
+void GaussJordan( AbstractDistMatrix<Field>& A );
 } // namespace inverse
 
 template<typename Field>
@@ -131,6 +222,14 @@ void Pseudoinverse( Matrix<Field>& A, Base<Field> tolerance=0 );
 template<typename Field>
 void Pseudoinverse( AbstractDistMatrix<Field>& A, Base<Field> tolerance=0 );
 
+// Form W inv(T) U^H from the rank-revealing factorization A ~= U T W^H
+template<typename Field>
+void Pseudoinverse
+( Matrix<Field>& A, const RankRevealCtrl<Base<Field>>& ctrl );
+template<typename Field>
+void Pseudoinverse
+( AbstractDistMatrix<Field>& A, const RankRevealCtrl<Base<Field>>& ctrl );
+
 template<typename Field>
 void HermitianPseudoinverse
 ( UpperOrLower uplo, Matrix<Field>& A, Base<Field> tolerance=0 );
@@ -157,6 +256,20 @@ void Sign
 ( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& N,
   const SignCtrl<Base<Field>> ctrl=SignCtrl<Base<Field>>() );
 
+// Overwrite the Hamiltonian matrix W (i.e., J W is Hermitian, where
+// J = [0, I; -I, 0]) with sgn(W) using a structure-preserving scaled Newton
+// iteration in which each inversion is of the Hermitian matrix J X via a
+// pivoted LDL^H factorization. Only the lower triangle of J W is accessed and
+// ctrl.method is ignored.
+template<typename Field>
+void HamiltonianSign
+( Matrix<Field>& W,
+  const SignCtrl<Base<Field>> ctrl=SignCtrl<Base<Field>>() );
+template<typename Field>
+void HamiltonianSign
+( AbstractDistMatrix<Field>& W,
+  const SignCtrl<Base<Field>> ctrl=SignCtrl<Base<Field>>() );
+
 template<typename Field>
 void HermitianSign
 ( UpperOrLower uplo, Matrix<Field>& A,
@@ -9,8 +9,36 @@
 #ifndef EL_PROPS_HPP
 #define EL_PROPS_HPP
 
+#include <El/blas_like/level3.hpp>
+
 namespace El {
 
+// Controls for the estimators of norms and condition numbers, which only
+// apply the matrix (or its inverse, via existing factors) to a few vectors
+// rather than computing singular values. Increasing the numbers of steps,
+// probes, and iterations trades speed for accuracy.
+template<typename Real>
+struct NormEstimateCtrl
+{
+    // The number of Lanczos steps used for each extremal singular value
+    // estimate and for each stochastic quadrature
+    Int numLanczosSteps=20;
+
+    // The number of random probe vectors of the stochastic trace estimators
+    // (Schatten and nuclear norms, Frobenius condition numbers)
+    Int numProbes=10;
+
+    // The number of columns and the maximum number of iterations of the
+    // block Hager-Higham estimator (one and infinity norms)
+    Int blockSize=2;
+    Int maxBlockIts=5;
+
+    // The oversampling and number of power iterations of the randomized
+    // subspace iteration (Ky-Fan norms)
+    Int oversampling=10;
+    Int numPowerIts=2;
+};
+
 // Condition number
 // ================
 template<typename F>
@@ -43,6 +71,47 @@ Base<F> TwoCondition( const Matrix<F>& A );
 template<typename F>
 Base<F> TwoCondition( const AbstractDistMatrix<F>& A );
 
+// Estimate the condition number of a square matrix in the one, infinity,
+// two, or Frobenius norm from its LU factorization (the two-norm estimate
+// also supports rectangular matrices, via the R factor of a QR
+// factorization). Singular factors yield infinity.
+template<typename F>
+Base<F> ConditionEstimate
+( const Matrix<F>& A, NormType type=ONE_NORM,
+  const NormEstimateCtrl<Base<F>>& ctrl=NormEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> ConditionEstimate
+( const AbstractDistMatrix<F>& A, NormType type=ONE_NORM,
+  const NormEstimateCtrl<Base<F>>& ctrl=NormEstimateCtrl<Base<F>>() );
+
+namespace condest {
+
+// Return normA times an estimate of the norm of inv(A), given the (in-place)
+// factors of A and the norm of A in the same norm
+template<typename F>
+Base<F> AfterLUPartialPiv
+( const Matrix<F>& A, const Permutation& P, Base<F> normA,
+  NormType type=ONE_NORM,
+  const NormEstimateCtrl<Base<F>>& ctrl=NormEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> AfterLUPartialPiv
+( const AbstractDistMatrix<F>& A, const DistPermutation& P, Base<F> normA,
+  NormType type=ONE_NORM,
+  const NormEstimateCtrl<Base<F>>& ctrl=NormEstimateCtrl<Base<F>>() );
+
+template<typename F>
+Base<F> AfterCholesky
+( UpperOrLower uplo, const Matrix<F>& A, Base<F> normA,
+  NormType type=ONE_NORM,
+  const NormEstimateCtrl<Base<F>>& ctrl=NormEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> AfterCholesky
+( UpperOrLower uplo, const AbstractDistMatrix<F>& A, Base<F> normA,
+  NormType type=ONE_NORM,
+  const NormEstimateCtrl<Base<F>>& ctrl=NormEstimateCtrl<Base<F>>() );
+
+} // namespace condest
+
 // Determinant
 // ===========
 template<typename F>
@@ -122,6 +191,29 @@ InertiaType Inertia
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A,
   const LDLPivotCtrl<Base<F>>& ctrl=LDLPivotCtrl<Base<F>>() );
 
+// Return the determinant of a Hermitian (possibly indefinite) matrix, as a
+// SafeProduct, and set its inertia, using a single Bunch-Kaufman LDL^H
+// factorization (rather than an LU factorization, which requires twice the
+// work, and a separate LDL^H factorization for the inertia)
+template<typename F>
+SafeProduct<Base<F>> LDLDeterminantAndInertia
+( UpperOrLower uplo, const Matrix<F>& A, InertiaType& inertia,
+  const LDLPivotCtrl<Base<F>>& ctrl=LDLPivotCtrl<Base<F>>() );
+template<typename F>
+SafeProduct<Base<F>> LDLDeterminantAndInertia
+( UpperOrLower uplo, const AbstractDistMatrix<F>& A, InertiaType& inertia,
+  const LDLPivotCtrl<Base<F>>& ctrl=LDLPivotCtrl<Base<F>>() );
+template<typename F>
+SafeProduct<Base<F>> LDLDeterminantAndInertia
+( UpperOrLower uplo, Matrix<F>& A, InertiaType& inertia,
+  bool canOverwrite,
+  const LDLPivotCtrl<Base<F>>& ctrl=LDLPivotCtrl<Base<F>>() );
+template<typename F>
+SafeProduct<Base<F>> LDLDeterminantAndInertia
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, InertiaType& inertia,
+  bool canOverwrite,
+  const LDLPivotCtrl<Base<F>>& ctrl=LDLPivotCtrl<Base<F>>() );
+
 // Norm
 // ====
 template<typename F>
@@ -172,6 +264,12 @@ template<typename F>
 Base<F> FrobeniusNorm( const Matrix<F>& A );
 template<typename F>
 Base<F> FrobeniusNorm( const AbstractDistMatrix<F>& A );
+template<typename F>
+Base<F> FrobeniusNorm( const SparseMatrix<F>& A );
+template<typename F>
+Base<F> FrobeniusNorm( const DistSparseMatrix<F>& A );
+template<typename F>
+Base<F> FrobeniusNorm( const DistMultiVec<F>& A );
 
 template<typename F>
 Base<F> HermitianFrobeniusNorm
@@ -260,6 +358,12 @@ template<typename T>
 Base<T> MaxNorm( const Matrix<T>& A );
 template<typename T>
 Base<T> MaxNorm( const AbstractDistMatrix<T>& A );
+template<typename T>
+Base<T> MaxNorm( const SparseMatrix<T>& A );
+template<typename T>
+Base<T> MaxNorm( const DistSparseMatrix<T>& A );
+template<typename T>
+Base<T> MaxNorm( const DistMultiVec<T>& A );
 
 template<typename T>
 Base<T> HermitianMaxNorm( UpperOrLower uplo, const Matrix<T>& A );
@@ -364,6 +468,11 @@ Base<F> TwoNormEstimate
 template<typename F>
 Base<F> TwoNormEstimate
 ( const AbstractDistMatrix<F>& A, Base<F> tol=1e-6, Int maxIts=1000 );
+// Only Height(), Width(), and the (distributed, if Distributed()) applications
+// of the operator and its adjoint are used
+template<typename F>
+Base<F> TwoNormEstimate
+( const LinearOperator<F>& A, Base<F> tol=1e-6, Int maxIts=1000 );
 
 template<typename F>
 Base<F> HermitianTwoNormEstimate
@@ -383,6 +492,48 @@ Base<F> SymmetricTwoNormEstimate
 ( UpperOrLower uplo, const AbstractDistMatrix<F>& A,
   Base<F> tol=1e-6, Int maxIts=1000 );
 
+// Schatten and Ky-Fan norm estimates
+// -----------------------------------
+// The Schatten p-norms are estimated by combining Hutchinson's trace
+// estimator with Lanczos quadrature for tr((A^H A)^{p/2}), while the Ky-Fan
+// norms use the singular values of the projection of A onto the dominant
+// subspace found by a randomized subspace iteration.
+template<typename F>
+Base<F> SchattenNormEstimate
+( const Matrix<F>& A, Base<F> p,
+  const NormEstimateCtrl<Base<F>>& ctrl=NormEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> SchattenNormEstimate
+( const AbstractDistMatrix<F>& A, Base<F> p,
+  const NormEstimateCtrl<Base<F>>& ctrl=NormEstimateCtrl<Base<F>>() );
+
+template<typename F>
+Base<F> NuclearNormEstimate
+( const Matrix<F>& A,
+  const NormEstimateCtrl<Base<F>>& ctrl=NormEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> NuclearNormEstimate
+( const AbstractDistMatrix<F>& A,
+  const NormEstimateCtrl<Base<F>>& ctrl=NormEstimateCtrl<Base<F>>() );
+
+template<typename F>
+Base<F> KyFanSchattenNormEstimate
+( const Matrix<F>& A, Int k, Base<F> p,
+  const NormEstimateCtrl<Base<F>>& ctrl=NormEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> KyFanSchattenNormEstimate
+( const AbstractDistMatrix<F>& A, Int k, Base<F> p,
+  const NormEstimateCtrl<Base<F>>& ctrl=NormEstimateCtrl<Base<F>>() );
+
+template<typename F>
+Base<F> KyFanNormEstimate
+( const Matrix<F>& A, Int k,
+  const NormEstimateCtrl<Base<F>>& ctrl=NormEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> KyFanNormEstimate
+( const AbstractDistMatrix<F>& A, Int k,
+  const NormEstimateCtrl<Base<F>>& ctrl=NormEstimateCtrl<Base<F>>() );
+
 // Trace
 // =====
 template<typename T>
@@ -390,6 +541,58 @@ T Trace( const Matrix<T>& A );
 template<typename T>
 T Trace( const AbstractDistMatrix<T>& A );
 
+// Stochastic trace estimation
+// ---------------------------
+// Estimate traces (and traces of functions) of square operators which are
+// only available through their application to multi-vectors, e.g., to form
+// log det(K) and tr(inv(K) dK) for large kernel matrices, where inv(K) may
+// be applied by an iterative solver. All of the probe vectors are applied
+// as a single multi-vector, so that each operator application is a
+// level-3 operation.
+namespace TraceEstimatorNS {
+enum TraceEstimator {
+    // The average of z^H A z over Rademacher vectors z
+    TRACE_HUTCHINSON,
+    // Hutchinson's estimator applied only to the part of A outside of a
+    // randomized sketch of its dominant range (Meyer, Musco, Musco, and
+    // Woodruff), which converges much faster for low-rank-dominated A
+    TRACE_HUTCH_PLUS_PLUS
+};
+}
+using namespace TraceEstimatorNS;
+
+struct TraceEstimateCtrl
+{
+    TraceEstimator estimator=TRACE_HUTCH_PLUS_PLUS;
+
+    // The total number of probe vectors (i.e., the number of columns of the
+    // multi-vectors), which is also the block size of the block Lanczos
+    // quadrature
+    Int numProbes=30;
+
+    // The maximum number of block Lanczos steps of the quadrature
+    Int numLanczosSteps=20;
+};
+
+template<typename F>
+F TraceEstimate
+( const LinearOperator<F>& A,
+  const TraceEstimateCtrl& ctrl=TraceEstimateCtrl() );
+
+// Estimate tr(f(A)) for a Hermitian operator A via block stochastic Lanczos
+// quadrature
+template<typename F>
+Base<F> HermitianTraceFunctionEstimate
+( const LinearOperator<F>& A,
+  function<Base<F>(const Base<F>&)> func,
+  const TraceEstimateCtrl& ctrl=TraceEstimateCtrl() );
+
+// Estimate log det(A) = tr(log(A)) for an HPD operator A
+template<typename F>
+Base<F> HPDLogDetEstimate
+( const LinearOperator<F>& A,
+  const TraceEstimateCtrl& ctrl=TraceEstimateCtrl() );
+
 } // namespace El
 
 #endif // ifndef EL_PROPS_HPP
@@ -0,0 +1,165 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_REDUCE_HPP
+#define EL_REDUCE_HPP
+
+#include <El/lapack_like/factor.hpp>
+
+namespace El {
+
+// Lattice reduction
+// =================
+// The columns of B are treated as a (possibly linearly dependent) basis for
+// an integer lattice, and a unimodular U is sought such that B U has short,
+// nearly orthogonal columns. Linearly dependent columns are reduced to zero
+// and moved to the end of the basis.
+//
+// The Gram-Schmidt coefficients are maintained through a Householder QR
+// factorization of B (in the manner of Morel, Stehle, and Villard's H-LLL):
+// the factorization is initially formed with blocked Householder transforms,
+// each column is then size-reduced (independently, and in parallel) against
+// it, and every subsequently modified column is re-orthogonalized by applying
+// the (blocked) reflectors of its predecessors. If the integer multipliers
+// grow large enough that the working precision cannot be trusted, the
+// reduction is resumed from the current basis in Promote<Field>, e.g.,
+// DoubleDouble or BigFloat for double.
+
+namespace LLLVariantNS {
+enum LLLVariant {
+    // Only size-reduce each column against its immediate predecessor
+    LLL_WEAK,
+    // Full size reduction with the Lovasz condition on adjacent columns
+    LLL_NORMAL,
+    // Full size reduction with Schnorr and Euchner's deep insertions, where
+    // each column is inserted at the first position at which it is shorter
+    // (relative to delta) than the projection of the existing column
+    LLL_DEEP
+};
+}
+using namespace LLLVariantNS;
+
+template<typename Real>
+struct LLLCtrl
+{
+    // The Lovasz parameter, which should lie in (1/4,1]
+    Real delta=Real(3)/Real(4);
+
+    LLLVariant variant=LLL_NORMAL;
+
+    // Reorder the columns with a column-pivoted QR factorization before
+    // reducing, optionally selecting the smallest column first (as suggested
+    // by Wubben et al.)
+    bool presort=false;
+    bool smallestFirst=true;
+
+    // The number of threads for the initial size reduction of every column
+    // against the Householder factorization (if nonpositive, the hardware
+    // concurrency is used)
+    Int numThreads=1;
+
+    // The number of times that a column may be re-orthogonalized after a
+    // size reduction with large multipliers before precision is declared lost
+    Int maxSizeReductionIts=10;
+
+    bool progress=false;
+};
+
+template<typename Real>
+struct LLLInfo
+{
+    // The smallest delta and the largest size-reduction ratio, |R(i,j)/R(i,i)|,
+    // satisfied by the reduced basis
+    Real delta;
+    Real eta;
+
+    Int rank;
+    Int nullity;
+    Int numSwaps;
+
+    // The number of times the reduction was moved to a higher precision
+    Int numPromotions;
+};
+
+// Overwrite B with its reduction
+template<typename Field>
+LLLInfo<Base<Field>> LLL
+( Matrix<Field>& B,
+  const LLLCtrl<Base<Field>>& ctrl=LLLCtrl<Base<Field>>() );
+
+// Also return the (min(m,n) x n) upper-trapezoidal R of the reduced basis
+template<typename Field>
+LLLInfo<Base<Field>> LLL
+( Matrix<Field>& B,
+  Matrix<Field>& R,
+  const LLLCtrl<Base<Field>>& ctrl=LLLCtrl<Base<Field>>() );
+
+// Also return the unimodular U such that the reduced basis is B_orig U
+template<typename Field>
+LLLInfo<Base<Field>> LLL
+( Matrix<Field>& B,
+  Matrix<Field>& U,
+  Matrix<Field>& R,
+  const LLLCtrl<Base<Field>>& ctrl=LLLCtrl<Base<Field>>() );
+
+// Block Korkine-Zolotarev reduction
+// ---------------------------------
+// Each window of 'blocksize' columns of an LLL-reduced basis is searched
+// (via Schnorr-Euchner enumeration over its projected triangular factor) for
+// a vector shorter than delta times the projection of its first column, which
+// is then inserted into the basis, with the resulting linear dependence
+// removed by LLL. Tours over the windows are repeated until none of them
+// yield an insertion.
+template<typename Real>
+struct BKZCtrl
+{
+    Int blocksize=10;
+
+    // If positive, an upper bound on the number of tours
+    Int maxTours=0;
+
+    // The control for each LLL call (whose delta also determines when an
+    // enumerated vector is inserted)
+    LLLCtrl<Real> lllCtrl;
+
+    bool progress=false;
+};
+
+template<typename Real>
+struct BKZInfo
+{
+    // The information from the final LLL call
+    LLLInfo<Real> lllInfo;
+
+    Int numTours;
+    Int numInsertions;
+};
+
+template<typename Real>
+BKZInfo<Real> BKZ
+( Matrix<Real>& B,
+  const BKZCtrl<Real>& ctrl=BKZCtrl<Real>() );
+template<typename Real>
+BKZInfo<Real> BKZ
+( Matrix<Real>& B,
+  Matrix<Real>& R,
+  const BKZCtrl<Real>& ctrl=BKZCtrl<Real>() );
+
+namespace bkz {
+
+// Search for a nonzero integer vector x such that || R x ||_2^2 < radiusSq,
+// where R is upper triangular with a positive diagonal, returning the
+// shortest such x (if it exists)
+template<typename Real>
+bool Enumerate( const Matrix<Real>& R, Real radiusSq, Matrix<Real>& x );
+
+} // namespace bkz
+
+} // namespace El
+
+#endif // ifndef EL_REDUCE_HPP
@@ -31,6 +31,83 @@ void ApplyPackedReflectors
   const AbstractDistMatrix<F>& householderScalars, 
         AbstractDistMatrix<F>& A );
 
+// The explicit (unit-diagonal) Householder vectors of each panel of a set of
+// vertically-packed reflectors, along with their Gram matrices, V^H V, from
+// which the triangular factor of each compact WY transform is formed.
+// Retaining them allows repeated applications of the same reflectors to skip
+// straight to the Gemm's. They must only be reused with the same H and
+// householderScalars, and are formed upon the first application.
+template<typename F>
+struct PackedReflectorPanels
+{
+    UpperOrLower uplo=LOWER;
+    Int offset=0;
+    Int blocksize=0;
+    vector<Matrix<F>> vectors;
+    vector<Matrix<F>> grams;
+
+    bool Formed() const { return blocksize > 0; }
+    void Empty() { blocksize = 0; vectors.clear(); grams.clear(); }
+};
+
+template<typename F>
+struct DistPackedReflectorPanels
+{
+    UpperOrLower uplo=LOWER;
+    Int offset=0;
+    Int blocksize=0;
+    vector<DistMatrix<F,VC,STAR>> vectors;
+    vector<DistMatrix<F,STAR,STAR>> grams;
+
+    // The redistributions of the vectors needed for applications from the
+    // left and right, which are reused while the alignments of A match
+    vector<DistMatrix<F,MC,STAR>> vectors_MC_STAR;
+    vector<DistMatrix<F,MR,STAR>> vectors_MR_STAR;
+
+    bool Formed() const { return blocksize > 0; }
+    void Empty()
+    {
+        blocksize = 0;
+        vectors.clear();
+        grams.clear();
+        vectors_MC_STAR.clear();
+        vectors_MR_STAR.clear();
+    }
+};
+
+template<typename F>
+void FormPackedReflectorPanels
+( UpperOrLower uplo, Int offset,
+  const Matrix<F>& H,
+  PackedReflectorPanels<F>& panels );
+template<typename F>
+void FormPackedReflectorPanels
+( UpperOrLower uplo, Int offset,
+  const AbstractDistMatrix<F>& H,
+  DistPackedReflectorPanels<F>& panels );
+
+// Only vertically-packed reflectors make use of the panels; horizontally
+// packed reflectors fall back to the above routines
+template<typename F>
+void ApplyPackedReflectors
+( LeftOrRight side, UpperOrLower uplo,
+  VerticalOrHorizontal dir, ForwardOrBackward order,
+  Conjugation conjugation,
+  Int offset,
+  const Matrix<F>& H,
+  const Matrix<F>& householderScalars,
+        Matrix<F>& A,
+        PackedReflectorPanels<F>& panels );
+template<typename F>
+void ApplyPackedReflectors
+( LeftOrRight side, UpperOrLower uplo,
+  VerticalOrHorizontal dir, ForwardOrBackward order,
+  Conjugation conjugation, Int offset,
+  const AbstractDistMatrix<F>& H,
+  const AbstractDistMatrix<F>& householderScalars,
+        AbstractDistMatrix<F>& A,
+        DistPackedReflectorPanels<F>& panels );
+
 // ExpandPackedReflectors
 // ======================
 template<typename F>
@@ -129,6 +206,62 @@ F Row( AbstractDistMatrix<F>& chi, AbstractDistMatrix<F>& x );
 
 } // namespace reflector
 
+// ReflectorBatch
+// ==============
+// Applies Householder reflectors, H = I - tau [1; v] [1; v]', to many small
+// blocks which are stored locally on the members of a communicator. A
+// reflector may be owned by a different process than the blocks it is to be
+// applied to, in which case its owner lists the processes which need it.
+// Upon execution, all of the reflectors which must cross processes are
+// exchanged in a single round of AllToAll's (one for the headers and one
+// for the entries), and the queued applications are then all performed
+// without any further communication.
+//
+// Execute must be called by every member of the communicator, and the
+// reflector ids must be unique across the communicator.
+template<typename F>
+class ReflectorBatch
+{
+public:
+    explicit ReflectorBatch( mpi::Comm comm=mpi::COMM_WORLD );
+
+    // Register the reflector defined by tau and v, which is owned by this
+    // process, under the given id, and send it to each of the 'targets'
+    // (other than this process) upon execution
+    void AddReflector
+    ( Int id, F tau, const Matrix<F>& v,
+      const vector<int>& targets=vector<int>() );
+
+    // Queue the application of the given reflector to the local block A.
+    // The reflector must be registered by this process or sent to it by its
+    // owner, and A must remain valid until Execute is called.
+    void QueueApply( LeftOrRight side, Int id, Matrix<F>& A );
+
+    Int NumQueued() const EL_NO_EXCEPT { return applies_.size(); }
+
+    // Exchange the reflectors and perform (and then dequeue) all of the
+    // queued applications; the registered reflectors are also cleared
+    void Execute();
+
+private:
+    struct Reflector
+    {
+        F tau;
+        Matrix<F> v;
+    };
+    struct Apply
+    {
+        LeftOrRight side;
+        Int id;
+        Matrix<F>* A;
+    };
+
+    mpi::Comm comm_;
+    std::map<Int,Reflector> reflectors_;
+    vector<std::pair<int,Int>> sends_;
+    vector<Apply> applies_;
+};
+
 } // namespace El
 
 #endif // ifndef EL_REFLECT_HPP
@@ -9,11 +9,43 @@
 #ifndef EL_SOLVE_HPP
 #define EL_SOLVE_HPP
 
+#include <El/blas_like/level3.hpp>
 #include <El/lapack_like/factor.hpp>
 #include <El/lapack_like/euclidean_min.hpp>
 
 namespace El {
 
+// Mixed-precision iterative refinement
+// ====================================
+// The overloads of LinearSolve, HPDSolve, and SymmetricSolve which accept a
+// MixedPrecisionCtrl factor a copy of A in the precision Demote<Field> (e.g.,
+// single precision for double-precision data, or double precision for
+// DoubleDouble) and then refine the solution in the working precision, so
+// that the cubic cost of the factorization is paid at the lower precision.
+// The low-precision copy of A must not overflow, and the refinement will only
+// converge if A is reasonably conditioned relative to the lower precision
+// (or, when 'gmres' is true, relative to its square). Builds configured
+// without the single-precision instantiations factor double-precision data
+// in double precision.
+template<typename Real>
+struct MixedPrecisionCtrl
+{
+    // Use FGMRES preconditioned with the low-precision factorization
+    // (GMRES-IR) rather than classical iterative refinement
+    bool gmres=false;
+
+    // Form the classical refinement residuals in Promote<Real>
+    bool promoteResiduals=false;
+
+    Real relTol;
+    Int maxIts=10; // refinement iterations (or FGMRES iterations)
+    Int restart=30; // only used if 'gmres' is true
+    bool progress=false;
+
+    MixedPrecisionCtrl()
+    { relTol = Pow(limits::Epsilon<Real>(),Real(0.9)); }
+};
+
 // Linear
 // ======
 template<typename Field>
@@ -26,6 +58,40 @@ void LinearSolve
         AbstractDistMatrix<Field>& B,
   bool scalapack=false );
 
+template<typename Field>
+void LinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+template<typename Field>
+void LinearSolve
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+
+// X := inv(K) X for the Kronecker operator K of a pair of square matrices,
+// A \otimes B, i.e., X_k := inv(B) X_k inv(A)^T for the reshaping X_k of each
+// column of X, so that only A and B are factored
+template<typename Field>
+void LinearSolve
+( const KroneckerOperator<Field>& K,
+        Matrix<Field>& X );
+template<typename Field>
+void LinearSolve
+( const DistKroneckerOperator<Field>& K,
+        DistMultiVec<Field>& X );
+
+// X := inv(A) X for a square Toeplitz operator via the O(n^2) Levinson
+// recursion, which requires every leading principal submatrix of A to be
+// nonsingular
+template<typename Field>
+void LinearSolve
+( const ToeplitzOperator<Field>& A,
+        Matrix<Field>& X );
+template<typename Field>
+void LinearSolve
+( const ToeplitzOperator<Field>& A,
+        DistMultiVec<Field>& X );
 
 namespace lin_solve {
 
@@ -51,6 +117,18 @@ void HermitianSolve
         AbstractDistMatrix<Field>& B,
   const LDLPivotCtrl<Base<Field>>& ctrl=LDLPivotCtrl<Base<Field>>() );
 
+template<typename Field>
+void HermitianSolve
+( const SparseMatrix<Field>& A,
+        Matrix<Field>& B,
+  bool tryLDL=true,
+  const BisectCtrl& ctrl=BisectCtrl() );
+template<typename Field>
+void HermitianSolve
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& B,
+  bool tryLDL=true,
+  const BisectCtrl& ctrl=BisectCtrl() );
 
 namespace herm_solve {
 
@@ -88,6 +166,39 @@ void SymmetricSolve
   bool conjugate=false,
   const LDLPivotCtrl<Base<Field>>& ctrl=LDLPivotCtrl<Base<Field>>() );
 
+template<typename Field>
+void SymmetricSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  bool conjugate,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+template<typename Field>
+void SymmetricSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  bool conjugate,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+
+// Sparse solves currently require a successful sparse-direct LDL
+template<typename Field>
+void SymmetricSolve
+( const SparseMatrix<Field>& A,
+        Matrix<Field>& B,
+  bool conjugate=false,
+  bool tryLDL=true,
+  const BisectCtrl& ctrl=BisectCtrl() );
+template<typename Field>
+void SymmetricSolve
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& B,
+  bool conjugate=false,
+  bool tryLDL=true,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
 
 namespace symm_solve {
 
@@ -122,18 +233,24 @@ void Overwrite
 // Dense matrices need only be explicitly filled in either their upper or
 // lower triangle, but sparse matrices must be explicitly symmetric.
 //
+// Dense matrices are factored without pivoting using dynamic regularization
+// (see reg_ldl::RegularizedQSDLDL), which is then removed iteratively; the
+// 'equilibrate' and 'canOverwrite' members of the control are ignored.
+//
 template<typename Field>
 void SQSDSolve
 ( Int n0,
   UpperOrLower uplo,
   const Matrix<Field>& J,
-        Matrix<Field>& B );
+        Matrix<Field>& B,
+  const SQSDCtrl<Base<Field>>& ctrl=SQSDCtrl<Base<Field>>() );
 template<typename Field>
 void SQSDSolve
 ( Int n0,
   UpperOrLower uplo,
   const AbstractDistMatrix<Field>& J,
-        AbstractDistMatrix<Field>& B );
+        AbstractDistMatrix<Field>& B,
+  const SQSDCtrl<Base<Field>>& ctrl=SQSDCtrl<Base<Field>>() );
 
 
 // Hermitian Positive-Definite
@@ -151,6 +268,21 @@ void HPDSolve
   const AbstractDistMatrix<Field>& A,
         AbstractDistMatrix<Field>& B );
 
+template<typename Field>
+void HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+template<typename Field>
+void HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+
 
 namespace hpd_solve {
 
@@ -171,6 +303,27 @@ void Overwrite
 
 // Multi-shift Hessenberg
 // ======================
+struct MultiShiftHessCtrl
+{
+    // The number of shifts which are swept through H together; if
+    // nonpositive, all of the (local) shifts form a single block
+    Int shiftBlocksize=64;
+
+    // The number of threads the blocks of shifts are spread over; if
+    // nonpositive, the hardware concurrency is used
+    Int numThreads=1;
+
+    // Whether the distributed solve should replicate H on every process once
+    // (rather than gathering a column of H for every step of the sweep)
+    bool replicateH=true;
+
+    // Whether the sweeps should be run in Demote<Field> and the solutions then
+    // refined (using at most maxRefineIts sweeps against residuals formed in
+    // the working precision)
+    bool mixedPrecision=false;
+    Int maxRefineIts=3;
+};
+
 template<typename Field>
 void MultiShiftHessSolve
 ( UpperOrLower uplo,
@@ -178,7 +331,8 @@ void MultiShiftHessSolve
   Field alpha,
   const Matrix<Field>& H,
   const Matrix<Field>& shifts,
-        Matrix<Field>& X );
+        Matrix<Field>& X,
+  const MultiShiftHessCtrl& ctrl=MultiShiftHessCtrl() );
 template<typename Field>
 void MultiShiftHessSolve
 ( UpperOrLower uplo,
@@ -186,12 +340,422 @@ void MultiShiftHessSolve
   Field alpha,
   const AbstractDistMatrix<Field>& H,
   const AbstractDistMatrix<Field>& shifts,
-        AbstractDistMatrix<Field>& X );
+        AbstractDistMatrix<Field>& X,
+  const MultiShiftHessCtrl& ctrl=MultiShiftHessCtrl() );
+
+// Hierarchically off-diagonal low-rank (HODLR) matrices
+// =====================================================
+// A square matrix is recursively bisected (until the diagonal blocks are of
+// order at most leafSize), and each off-diagonal block of each level is
+// replaced by an interpolative decomposition
+//
+//   A(I1,I2) ~= A(I1,J) W,
+//
+// where J is a set of skeleton columns of the block and W is the (rank x |I2|)
+// interpolation matrix. The skeletons are selected from Gaussian sketches of
+// the blocks whose number of rows is doubled until it exceeds the numerical
+// rank by at least 'oversample'. For the discretizations of smooth kernels
+// away from the diagonal (e.g., Cauchy or UniformHelmholtzGreens at modest
+// frequencies), the ranks remain small, so that application costs
+// O(r n log n) work and, after an O(r^2 n log^2 n) Factor, Solve costs
+// O(r n log n) work via the Sherman-Morrison-Woodbury formula at each level.
+//
+// Solve is exact for the compressed matrix, and so the compression tolerance
+// determines whether it is used as a direct solver or as a preconditioner for
+// the original (dense or matrix-free) operator.
+//
+// NOTE: The distributed constructor computes the sketches and gathers the
+//       skeletons with distributed kernels, but the compressed factors are
+//       then stored (and applied) redundantly over the Grid.
+template<typename Real>
+struct HODLRCtrl
+{
+    Int leafSize=64;
+
+    // The tolerance (relative to the largest column norm of each sketch) for
+    // the pivoted QR factorizations defining the skeletons
+    Real relTol;
+
+    // Bound the rank of every off-diagonal block if positive
+    Int maxRank=0;
+
+    Int oversample=10;
+
+    HODLRCtrl() { relTol = Pow(limits::Epsilon<Real>(),Real(0.5)); }
+};
+
+template<typename Field>
+class HODLRMatrix : public LinearOperator<Field>
+{
+public:
+    HODLRMatrix
+    ( const Matrix<Field>& A,
+      const HODLRCtrl<Base<Field>>& ctrl=HODLRCtrl<Base<Field>>() );
+    HODLRMatrix
+    ( const AbstractDistMatrix<Field>& A,
+      const HODLRCtrl<Base<Field>>& ctrl=HODLRCtrl<Base<Field>>() );
+
+    Int Height() const override { return n_; }
+    Int Width() const override { return n_; }
+    bool Distributed() const override { return grid_ != nullptr; }
+    const El::Grid& Grid() const override
+    { return grid_ == nullptr ? El::Grid::Default() : *grid_; }
+
+    using LinearOperator<Field>::Apply;
+    void Apply
+    ( Orientation orientation,
+      Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const override;
+    void Apply
+    ( Orientation orientation,
+      Field alpha, const DistMultiVec<Field>& X,
+      Field beta,        DistMultiVec<Field>& Y ) const override;
+
+    // Factor each diagonal block and each level's capacitance matrix so that
+    // Solve may overwrite B with inv(A) B
+    void Factor();
+    bool Factored() const EL_NO_EXCEPT { return factored_; }
+    void Solve( Matrix<Field>& B ) const;
+    void Solve( DistMultiVec<Field>& B ) const;
+
+    // Decompress the hierarchical approximation
+    void Form( Matrix<Field>& A ) const;
+
+    // The largest rank of the off-diagonal blocks and the number of entries
+    // stored for the (unfactored) approximation
+    Int MaxRank() const;
+    Int NumEntries() const;
+
+private:
+    struct Node
+    {
+        Int offset, size;
+        Int left=-1, right=-1;
+
+        // Leaves: the diagonal block and, after Factor, its LU factors
+        Matrix<Field> D, DFact;
+        Permutation DPerm;
+
+        // Internal nodes: A12 ~= U12 W12 and A21 ~= U21 W21, where U12 and
+        // U21 are the skeleton columns, and, after Factor, Y1 = inv(A11) U12,
+        // Y2 = inv(A22) U21, and the LU factors of the capacitance matrix
+        // K = [I, W12 Y2; W21 Y1, I]
+        Matrix<Field> U12, W12, U21, W21;
+        Matrix<Field> Y1, Y2, K;
+        Permutation KPerm;
+    };
+
+    Int n_;
+    const El::Grid* grid_=nullptr;
+    vector<Node> nodes_;
+    bool factored_=false;
+
+    void BuildTree( Int leafSize );
+    Int BuildSubtree( Int offset, Int size, Int leafSize, Int& numNodes );
+    void ApplyNode
+    ( Int index, Orientation orientation,
+      Field alpha, const Matrix<Field>& X, Matrix<Field>& Y ) const;
+    void FactorNode( Int index );
+    void SolveNode( Int index, Matrix<Field>& B ) const;
+};
+
+// Banded matrices
+// ===============
+// An n x n matrix whose nonzeros satisfy -upperBW <= i-j <= lowerBW is
+// stored in the LAPACK band format, i.e., A(i,j) is entry (upperBW+i-j,j) of
+// a (lowerBW+upperBW+1) x n matrix, so that storage is O(n b) and the
+// products, triangular solves, and factorizations require O(n b^2) work
+// rather than the O(n^3) of the dense kernels. Block-tridiagonal matrices
+// with blocks of order m are banded with lowerBW = upperBW = 2m-1.
+//
+// NOTE: Factor computes an LU factorization without pivoting (and thus
+//       introduces no fill outside of the band), which is stable for the
+//       diagonally dominant and Hermitian positive-definite matrices (where it
+//       is equivalent to a Cholesky factorization) that typically arise.
+template<typename Field>
+class BandMatrix : public LinearOperator<Field>
+{
+public:
+    BandMatrix() { }
+    BandMatrix( Int n, Int lowerBW, Int upperBW );
+    // Copy the band of the dense matrix A
+    BandMatrix( const Matrix<Field>& A, Int lowerBW, Int upperBW );
+
+    // Zero the matrix (and forget any factorization)
+    void Resize( Int n, Int lowerBW, Int upperBW );
+
+    Int Height() const override { return n_; }
+    Int Width() const override { return n_; }
+    Int LowerBandwidth() const EL_NO_EXCEPT { return lowerBW_; }
+    Int UpperBandwidth() const EL_NO_EXCEPT { return upperBW_; }
+
+    // Only entries within the band may be modified
+    Field Get( Int i, Int j ) const;
+    void Set( Int i, Int j, Field value );
+    void Update( Int i, Int j, Field value );
+
+    Matrix<Field>& Band() EL_NO_EXCEPT { return band_; }
+    const Matrix<Field>& LockedBand() const EL_NO_EXCEPT { return band_; }
+
+    // Y := alpha op(A) X + beta Y
+    using LinearOperator<Field>::Apply;
+    void Apply
+    ( Orientation orientation,
+      Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const override;
+
+    // B := op(T)^{-1} B, where T is the lower or upper triangle of the band
+    void Trsm
+    ( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag,
+      Matrix<Field>& B ) const;
+
+    // Overwrite the band with the (unit lower and upper) triangular factors
+    // of A = L U so that Solve may overwrite B with inv(A) B
+    void Factor();
+    bool Factored() const EL_NO_EXCEPT { return factored_; }
+    void Solve( Matrix<Field>& B ) const;
+
+    // Form the dense matrix
+    void Form( Matrix<Field>& A ) const;
+
+private:
+    Int n_=0, lowerBW_=0, upperBW_=0;
+    Matrix<Field> band_;
+    bool factored_=false;
+};
+
+// A banded matrix whose rows are distributed with the same 1D distribution as
+// DistMultiVec, so that Apply only communicates the lowerBW and upperBW rows
+// of X nearest to the boundaries of each process's block of rows.
+//
+// Factor and Solve follow the SPIKE algorithm of
+//
+//   Eric Polizzi and Ahmed H. Sameh,
+//   "A parallel hybrid banded system solver: the SPIKE algorithm",
+//   Parallel Computing, 32(2), pp. 177--194, 2006 [CITATION].
+//
+// Each process factors its diagonal block A_p and computes the 'spikes'
+// V_p = inv(A_p) [0; B_p] and W_p = inv(A_p) [C_p; 0] from the blocks B_p and
+// C_p coupling it to its neighbors. The unknowns of the remaining reduced
+// system are the top upperBW and the bottom lowerBW entries of the solution
+// on each process, and so it has order p (lowerBW+upperBW). It is solved
+// redundantly after a single AllGather, after which each process recovers its
+// solution with the spikes. The total work is O(n b^2/p + (p b)^3) per
+// factorization and O(n b/p + (p b)^2) per right-hand side.
+//
+// NOTE: Every process must own at least max(lowerBW,upperBW) (and at least
+//       one) rows so that only neighboring processes are coupled.
+template<typename Field>
+class DistBandMatrix : public LinearOperator<Field>
+{
+public:
+    DistBandMatrix( const El::Grid& grid=El::Grid::Default() );
+    DistBandMatrix
+    ( Int n, Int lowerBW, Int upperBW,
+      const El::Grid& grid=El::Grid::Default() );
+
+    // Zero the matrix (and forget any factorization)
+    void Resize( Int n, Int lowerBW, Int upperBW );
+
+    Int Height() const override { return n_; }
+    Int Width() const override { return n_; }
+    Int LowerBandwidth() const EL_NO_EXCEPT { return lowerBW_; }
+    Int UpperBandwidth() const EL_NO_EXCEPT { return upperBW_; }
+    bool Distributed() const override { return true; }
+    const El::Grid& Grid() const override { return *grid_; }
+
+    Int Blocksize() const EL_NO_EXCEPT { return blocksize_; }
+    Int FirstLocalRow() const EL_NO_EXCEPT;
+    Int LocalHeight() const EL_NO_EXCEPT;
+    bool IsLocalRow( Int i ) const EL_NO_EXCEPT;
+
+    // Assembly (only entries within the band may be modified)
+    // -------------------------------------------------------
+    // A passive queue ignores updates to non-local rows
+    void QueueUpdate( Int i, Int j, Field value, bool passive=false );
+    // Collective: sends the remote updates to their owners
+    void ProcessQueues();
+
+    Field GetLocal( Int iLoc, Int j ) const;
+    void SetLocal( Int iLoc, Int j, Field value );
+    void UpdateLocal( Int iLoc, Int j, Field value );
+
+    // Y := alpha op(A) X + beta Y
+    using LinearOperator<Field>::Apply;
+    void Apply
+    ( Orientation orientation,
+      Field alpha, const DistMultiVec<Field>& X,
+      Field beta,        DistMultiVec<Field>& Y ) const override;
+
+    void Factor();
+    bool Factored() const EL_NO_EXCEPT { return factored_; }
+    void Solve( DistMultiVec<Field>& B ) const;
+
+private:
+    Int n_=0, lowerBW_=0, upperBW_=0;
+    const El::Grid* grid_=nullptr;
+    Int blocksize_=1;
+
+    // Entry (i,j) of local row iLoc is stored in entry (lowerBW+j-i,iLoc)
+    Matrix<Field> localBand_;
+    vector<Entry<Field>> remoteUpdates_;
+
+    // The factored diagonal block, the spikes, and the LU factorization of the
+    // (redundant) reduced system
+    bool factored_=false;
+    BandMatrix<Field> diag_;
+    Matrix<Field> V_, W_;
+    Matrix<Field> reduced_;
+    Permutation reducedPerm_;
+
+    void CheckDistribution() const;
+};
+
+// Reusable factorizations
+// =======================
+// A handle which owns a factorization of a square matrix so that it may be
+// repeatedly applied to batches of right-hand sides. In the distributed case,
+// the diagonal blocks of each triangular factor are stored as [* ,* ] and the
+// panels coupling them to the remaining rows are stored as [MC,* ] (or as
+// [* ,MC] for adjoint solves) the first time they are needed, so that each
+// subsequent solve only redistributes the right-hand sides (in addition to
+// the local Trsm's and Gemm's). The cached panels of each triangle require
+// about n^2/(2 r) entries per process, where r is the height of the grid.
+//
+// Low-rank updates A := A + U V^H are handled with the
+// Sherman-Morrison-Woodbury formula
+//
+//   inv(A + U V^H) = inv(A) - inv(A) U inv(I + V^H inv(A) U) V^H inv(A),
+//
+// where inv(A) U and inv(A)^H V are computed once per update.
+//
+// NOTE: The Cholesky and LDL factorizations assume that A is Hermitian (and
+//       positive-definite for Cholesky) and only access its lower triangle.
+namespace FactorizationTypeNS {
+enum FactorizationType
+{
+    LU_FACTORIZATION,
+    CHOLESKY_FACTORIZATION,
+    LDL_FACTORIZATION,
+    QR_FACTORIZATION
+};
+}
+using namespace FactorizationTypeNS;
+
+template<typename Field>
+class Factorization
+{
+public:
+    Factorization( FactorizationType type, const Matrix<Field>& A );
+    Factorization( FactorizationType type, const AbstractDistMatrix<Field>& A );
+
+    FactorizationType Type() const EL_NO_EXCEPT { return type_; }
+    Int Height() const EL_NO_EXCEPT { return n_; }
+    bool Distributed() const EL_NO_EXCEPT { return grid_ != nullptr; }
+
+    // B := inv(op(A)) B, where A includes any low-rank updates
+    void Solve( Orientation orientation, Matrix<Field>& B ) const;
+    void Solve( Orientation orientation, AbstractDistMatrix<Field>& B ) const;
+
+    // A := A + U V^H (accumulating any previous updates)
+    void LowRankUpdate( const Matrix<Field>& U, const Matrix<Field>& V );
+    void LowRankUpdate
+    ( const AbstractDistMatrix<Field>& U, const AbstractDistMatrix<Field>& V );
+    Int UpdateRank() const EL_NO_EXCEPT
+    { return Distributed() ? UDist_.Width() : U_.Width(); }
+    void ClearUpdates();
+
+private:
+    // The redistributed blocks of a triangular factor for a blocked left
+    // solve with a particular orientation
+    struct TrsmCache
+    {
+        Int blocksize=0;
+        vector<DistMatrix<Field,STAR,STAR>> diagBlocks;
+        vector<DistMatrix<Field,MC,STAR>> normalPanels;
+        vector<DistMatrix<Field,STAR,MC>> adjointPanels;
+    };
+
+    FactorizationType type_;
+    Int n_;
+    const El::Grid* grid_=nullptr;
+
+    // The sequential factorization and low-rank update
+    Matrix<Field> A_, householderScalars_, dSub_;
+    Matrix<Base<Field>> signature_;
+    Permutation P_;
+    Matrix<Field> U_, V_, Y_, Z_;
+
+    // The distributed factorization and low-rank update
+    DistMatrix<Field> ADist_, householderScalarsDist_;
+    DistMatrix<Base<Field>> signatureDist_;
+    DistMatrix<Field,MC,STAR> dDist_, dSubDist_;
+    DistPermutation PDist_;
+    DistMatrix<Field> UDist_, VDist_, YDist_, ZDist_;
+    // Indexed by 2*(uplo==UPPER) + (orientation!=NORMAL)
+    mutable TrsmCache caches_[4];
+
+    // The (redundant) LU factorization of I + V^H inv(A) U
+    Matrix<Field> K_;
+    Permutation KPerm_;
+
+    void Factor();
+    void BaseSolve( Orientation orientation, Matrix<Field>& B ) const;
+    void BaseSolve( Orientation orientation, DistMatrix<Field>& B ) const;
+    void CachedTrsm
+    ( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag,
+      DistMatrix<Field>& X ) const;
+    void FormCapacitance();
+};
+
+// Batched solves of streamed right-hand sides
+// --------------------------------------------
+// Rather than solving each submitted right-hand side with level 2 triangular
+// solves, a background thread aggregates the queued right-hand sides into
+// blocks of up to maxBatchSize columns, which are solved with the level 3
+// Trsm's of a (sequential) Factorization. A partial batch is solved once its
+// oldest right-hand side has waited for maxLatency seconds (or upon Flush).
+struct SolveQueueCtrl
+{
+    Int maxBatchSize=64;
+    double maxLatency=1.e-3;
+};
+
+template<typename Field>
+class SolveQueue
+{
+public:
+    // The factorization must outlive the queue and must not be modified
+    // (e.g., by LowRankUpdate) while the queue exists
+    SolveQueue
+    ( const Factorization<Field>& factorization,
+      Orientation orientation=NORMAL,
+      const SolveQueueCtrl& ctrl=SolveQueueCtrl() );
+    // Solve the remaining right-hand sides before joining the worker
+    ~SolveQueue();
+
+    // Queue the solution of op(A) X = B; the future rethrows any exception
+    // raised while solving the batch containing B
+    std::future<Matrix<Field>> Submit( const Matrix<Field>& B );
+
+    // Solve the queued right-hand sides without waiting for the deadline
+    void Flush();
+
+    Int NumBatches() const;
+    Int NumSolved() const;
+
+private:
+    struct State;
+    std::unique_ptr<State> state_;
+};
 
 } // namespace El
 
+#include <El/lapack_like/solve/CG.hpp>
 #include <El/lapack_like/solve/FGMRES.hpp>
 #include <El/lapack_like/solve/LGMRES.hpp>
+#include <El/lapack_like/solve/MINRES.hpp>
 #include <El/lapack_like/solve/Refined.hpp>
+#include <El/lapack_like/solve/SStepGMRES.hpp>
 
 #endif // ifndef EL_SOLVE_HPP
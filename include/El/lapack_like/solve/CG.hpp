@@ -0,0 +1,271 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_CG_HPP
+#define EL_SOLVE_CG_HPP
+
+// The pipelined formulation of preconditioned Conjugate Gradients follows
+// "Algorithm 4" of
+//   Pieter Ghysels and Wim Vanroose,
+//   "Hiding global synchronization latency in the preconditioned Conjugate
+//    Gradient algorithm",
+//   Parallel Computing, Vol. 40, No. 7, pp. 224--238, 2014,
+// where the three inner products of each iteration are combined into a
+// single non-blocking reduction which is overlapped with the application of
+// the preconditioner and of A.
+
+namespace El {
+
+namespace pipelined {
+
+// In what follows, 'applyA' and 'precond' should be of the same form as in
+// FGMRES (any LinearOperator may be passed as 'applyA'), but both A and the
+// preconditioner must be Hermitian (and positive-definite for CG), and the
+// preconditioner must be a fixed linear operator.
+
+template<typename Field>
+Matrix<Field>& Local( Matrix<Field>& x ) EL_NO_EXCEPT { return x; }
+template<typename Field>
+Matrix<Field>& Local( DistMultiVec<Field>& x ) EL_NO_EXCEPT
+{ return x.Matrix(); }
+
+template<typename Field>
+Matrix<Field> Like( const Matrix<Field>& ) { return Matrix<Field>(); }
+template<typename Field>
+DistMultiVec<Field> Like( const DistMultiVec<Field>& x )
+{ return DistMultiVec<Field>( x.Grid() ); }
+
+// Begin summing the local inner products over the processes sharing the
+// vector x; the sums are only valid after a subsequent call to FinishSum
+template<typename Field>
+void StartSum
+( const Matrix<Field>&, const Matrix<Field>& dots,
+  Matrix<Field>& sums, mpi::Request<Field>& )
+{ sums = dots; }
+template<typename Field>
+void StartSum
+( const DistMultiVec<Field>& x, const Matrix<Field>& dots,
+  Matrix<Field>& sums, mpi::Request<Field>& request )
+{
+    sums.Resize( dots.Height(), 1 );
+    mpi::IAllReduce
+    ( dots.LockedBuffer(), sums.Buffer(), dots.Height(), x.Grid().Comm(),
+      request );
+}
+
+template<typename Field>
+void FinishSum( const Matrix<Field>&, mpi::Request<Field>& ) { }
+template<typename Field>
+void FinishSum( const DistMultiVec<Field>&, mpi::Request<Field>& request )
+{ mpi::Wait( request ); }
+
+} // namespace pipelined
+
+namespace cg {
+
+template<typename Field,class ApplyAType,class PrecondType,class VecType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VecType& b,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<Field> Real;
+    const Int n = b.Height();
+    const Int localHeight = pipelined::Local(b).Height();
+
+    const Real origResidNorm = FrobeniusNorm( b );
+    if( progress )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    auto x = pipelined::Like( b );
+    auto r = pipelined::Like( b );
+    auto mVec = pipelined::Like( b );
+    auto nVec = pipelined::Like( b );
+    Zeros( x, n, 1 );
+    auto& xLoc = pipelined::Local( x );
+    auto& mLoc = pipelined::Local( mVec );
+    auto& nLoc = pipelined::Local( nVec );
+
+    Matrix<Field> u, w, p, s, q, z;
+    Matrix<Field> dots, sums;
+    mpi::Request<Field> request;
+    Int iter = 0;
+    while( true )
+    {
+        // Explicitly form r := b - A x, which doubles as a residual
+        // replacement to counter the drift of the pipelined recurrences
+        r = b;
+        applyA( Field(-1), x, Field(1), r );
+        const Real residNorm = FrobeniusNorm( r );
+        if( !limits::IsFinite(residNorm) )
+            RuntimeError("Residual norm was not finite");
+        const Real relResidNorm = residNorm / origResidNorm;
+        if( relResidNorm <= relTol )
+        {
+            if( progress )
+                Output("converged with relative tolerance: ",relResidNorm);
+            break;
+        }
+        if( iter >= maxIts )
+            RuntimeError("CG did not converge");
+        if( progress )
+            Output("Restarting CG at iteration ",iter);
+
+        // u := inv(M) r and w := A u
+        mVec = r;
+        precond( mVec );
+        Zeros( nVec, n, 1 );
+        applyA( Field(1), mVec, Field(0), nVec );
+        u = mLoc;
+        w = nLoc;
+        auto& rLoc = pipelined::Local( r );
+
+        Zeros( p, localHeight, 1 );
+        Zeros( s, localHeight, 1 );
+        Zeros( q, localHeight, 1 );
+        Zeros( z, localHeight, 1 );
+        Real gammaOld=0, alphaOld=0;
+        for( Int j=0; iter<maxIts; ++j )
+        {
+            // Start the reduction of gamma := r' u, delta := w' u, and r' r
+            Zeros( dots, 3, 1 );
+            dots(0) = Dot( rLoc, u );
+            dots(1) = Dot( w, u );
+            dots(2) = Dot( rLoc, rLoc );
+            pipelined::StartSum( b, dots, sums, request );
+
+            // Overlap the reduction with m := inv(M) w and n := A m
+            mLoc = w;
+            precond( mVec );
+            Zeros( nVec, n, 1 );
+            applyA( Field(1), mVec, Field(0), nVec );
+            pipelined::FinishSum( b, request );
+
+            const Real gamma = RealPart(sums(0));
+            const Real delta = RealPart(sums(1));
+            const Real estResidNorm = Sqrt( Max(RealPart(sums(2)),Real(0)) );
+            if( !limits::IsFinite(gamma) || !limits::IsFinite(delta) )
+                RuntimeError("Pipelined CG produced a non-finite number");
+            if( progress )
+                Output
+                ("iteration ",iter," estimated relative residual: ",
+                 estResidNorm/origResidNorm);
+            if( j > 0 && estResidNorm <= relTol*origResidNorm )
+                break;
+            if( gamma == Real(0) )
+                break;
+
+            Real alpha, beta;
+            if( j == 0 )
+            {
+                beta = 0;
+                alpha = gamma / delta;
+            }
+            else
+            {
+                beta = gamma / gammaOld;
+                alpha = gamma / (delta - beta*gamma/alphaOld);
+            }
+            if( !(alpha > Real(0)) )
+                RuntimeError("A or the preconditioner was not HPD");
+
+            // z := n + beta z, q := m + beta q, s := w + beta s,
+            // p := u + beta p
+            Scale( beta, z ); z += nLoc;
+            Scale( beta, q ); q += mLoc;
+            Scale( beta, s ); s += w;
+            Scale( beta, p ); p += u;
+
+            // x := x + alpha p, r := r - alpha s, u := u - alpha q,
+            // w := w - alpha z
+            Axpy( alpha, p, xLoc );
+            Axpy( -alpha, s, rLoc );
+            Axpy( -alpha, q, u );
+            Axpy( -alpha, z, w );
+
+            gammaOld = gamma;
+            alphaOld = alpha;
+            ++iter;
+        }
+    }
+    b = x;
+    return iter;
+}
+
+} // namespace cg
+
+// Solve A X = B, where A and the preconditioner are both HPD, using
+// pipelined preconditioned Conjugate Gradients with a single non-blocking
+// reduction per iteration. The number of iterations is returned.
+// TODO(poulson): Add support for an initial guess
+template<typename Field,class ApplyAType,class PrecondType>
+Int CG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int width = B.Width();
+    Matrix<Field> b;
+    for( Int j=0; j<width; ++j )
+    {
+        b = B( ALL, IR(j) );
+        const Int its =
+          cg::Single<Field>( applyA, precond, b, relTol, maxIts, progress );
+        auto BCol = B( ALL, IR(j) );
+        BCol = b;
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+// TODO(poulson): Add support for an initial guess
+template<typename Field,class ApplyAType,class PrecondType>
+Int CG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int height = B.Height();
+    const Int width = B.Width();
+    DistMultiVec<Field> b(B.Grid());
+    for( Int j=0; j<width; ++j )
+    {
+        auto BLoc_j = B.Matrix()( ALL, IR(j) );
+        b.Resize( height, 1 );
+        b.Matrix() = BLoc_j;
+        const Int its =
+          cg::Single<Field>( applyA, precond, b, relTol, maxIts, progress );
+        BLoc_j = b.LockedMatrix();
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_CG_HPP
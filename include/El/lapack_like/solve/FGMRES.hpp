@@ -32,6 +32,8 @@ namespace fgmres {
 //
 // and overwrite b with an approximation of inv(A) b.
 //
+// Any LinearOperator (e.g., a KroneckerOperator) may be passed as 'applyA'.
+//
 
 // TODO(poulson): Add support for an initial guess
 template<typename Field,class ApplyAType,class PrecondType>
@@ -287,6 +289,267 @@ Int Single
     return iter;
 }
 
+// The basis vectors are stored in the local portions of DistMultiVecs, and
+// only the small Hessenberg system is kept redundantly on every process
+// TODO(poulson): Add support for an initial guess
+template<typename Field,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& b,
+        Base<Field> relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+
+    // A z_j and A x_0
+    const bool saveProducts = true;
+    const bool time = false;
+
+    typedef Base<Field> Real;
+    const Int n = b.Height();
+    const Grid& grid = b.Grid();
+    mpi::Comm comm = grid.Comm();
+    Timer iterTimer;
+
+    // x := 0
+    // ======
+    DistMultiVec<Field> x(grid);
+    Zeros( x, n, 1 );
+
+    DistMultiVec<Field> Ax0(grid);
+    if( saveProducts )
+    {
+        // A x_0 := 0
+        // ==========
+        Zeros( Ax0, n, 1 );
+    }
+
+    // w := b (= b - A x_0)
+    // ====================
+    auto w = b;
+    const Real origResidNorm = FrobeniusNorm( w );
+    if( progress )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    // TODO: Constrain the maximum number of iterations
+
+    Int iter=0;
+    bool converged = false;
+    Matrix<Real> cs;
+    Matrix<Field> sn, H, t;
+    DistMultiVec<Field> x0(grid), V(grid), Z(grid), AZ(grid), q(grid),
+                        zj(grid);
+    while( !converged )
+    {
+        if( progress )
+            Output("Starting FGMRES iteration ",iter);
+        const Int indent = PushIndent();
+
+        Zeros( cs, restart, 1 );
+        Zeros( sn, restart, 1 );
+        Zeros( H,  restart, restart );
+        Zeros( V, n, restart );
+        Zeros( Z, n, restart );
+        if( saveProducts )
+            Zeros( AZ, n, restart );
+
+        // x0 := x
+        // =======
+        x0 = x;
+        if( saveProducts && iter != 0 )
+            Ax0 = q;
+
+        // NOTE: w = b - A x already
+
+        // beta := || w ||_2
+        // =================
+        const Real beta = FrobeniusNorm( w );
+
+        // v0 := w / beta
+        // ==============
+        auto v0 = V.Matrix()( ALL, IR(0) );
+        v0 = w.LockedMatrix();
+        v0 *= 1/beta;
+
+        // t := beta e_0
+        // =============
+        Zeros( t, restart+1, 1 );
+        t(0) = beta;
+
+        // Run one round of GMRES(restart)
+        // ===============================
+        for( Int j=0; j<restart; ++j )
+        {
+            if( progress )
+                Output("Starting inner FGMRES iteration ",j);
+            if( time )
+                iterTimer.Start();
+            const Int innerIndent = PushIndent();
+
+            // z_j := inv(M) v_j
+            // =================
+            auto vj = V.Matrix()( ALL, IR(j) );
+            zj.Resize( n, 1 );
+            zj.Matrix() = vj;
+            precond( zj );
+            auto ZLoc_j = Z.Matrix()( ALL, IR(j) );
+            ZLoc_j = zj.LockedMatrix();
+
+            // w := A z_j
+            // ----------
+            applyA( Field(1), zj, Field(0), w );
+            if( saveProducts )
+            {
+                auto AzjLoc = AZ.Matrix()( ALL, IR(j) );
+                AzjLoc = w.LockedMatrix();
+            }
+
+            // Run the j'th step of Arnoldi
+            // ----------------------------
+            for( Int i=0; i<=j; ++i )
+            {
+                // H(i,j) := v_i' w
+                // ^^^^^^^^^^^^^^^^
+                auto vi = V.Matrix()( ALL, IR(i) );
+                H(i,j) = mpi::AllReduce( Dot(vi,w.LockedMatrix()), comm );
+
+                // w := w - H(i,j) v_i
+                // ^^^^^^^^^^^^^^^^^^^
+                Axpy( -H(i,j), vi, w.Matrix() );
+            }
+            const Real delta = FrobeniusNorm( w );
+            if( !limits::IsFinite(delta) )
+                RuntimeError("Arnoldi step produced a non-finite number");
+            if( delta == Real(0) )
+                restart = j+1;
+            if( j+1 != restart )
+            {
+                // v_{j+1} := w / delta
+                // ^^^^^^^^^^^^^^^^^^^^^^^^^^
+                auto vjp1 = V.Matrix()( ALL, IR(j+1) );
+                vjp1 = w.LockedMatrix();
+                vjp1 *= 1/delta;
+            }
+
+            // Apply existing rotations to the new column of H
+            // -----------------------------------------------
+            for( Int i=0; i<j; ++i )
+            {
+                const Real& c = cs(i);
+                const Field& s = sn(i);
+                const Field sConj = Conj(s);
+                const Field eta_i_j = H(i,j);
+                const Field eta_ip1_j = H(i+1,j);
+                H(i,  j) =  c    *eta_i_j + s*eta_ip1_j;
+                H(i+1,j) = -sConj*eta_i_j + c*eta_ip1_j;
+            }
+
+            // Generate and apply a new rotation to both H and the rotated
+            // beta*e_0 vector, t, then solve the minimum residual problem
+            // -----------------------------------------------------------
+            const Field eta_j_j = H(j,j);
+            const Field eta_jp1_j = delta;
+            if( !limits::IsFinite(RealPart(eta_j_j))   ||
+                !limits::IsFinite(ImagPart(eta_j_j))   ||
+                !limits::IsFinite(RealPart(eta_jp1_j)) ||
+                !limits::IsFinite(ImagPart(eta_jp1_j)) )
+                RuntimeError("Either H(j,j) or H(j+1,j) was not finite");
+            Real c;
+            Field s;
+            Field rho = Givens( eta_j_j, eta_jp1_j, c, s );
+            if( !limits::IsFinite(c) ||
+                !limits::IsFinite(RealPart(s)) ||
+                !limits::IsFinite(ImagPart(s)) ||
+                !limits::IsFinite(RealPart(rho)) ||
+                !limits::IsFinite(ImagPart(rho)) )
+                RuntimeError("Givens rotation produced a non-finite number");
+            H(j,j) = rho;
+            cs(j) = c;
+            sn(j) = s;
+            // Apply the rotation to the rotated beta*e_0 vector
+            // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+            const Field sConj = Conj(s);
+            const Field tau_j = t(j);
+            const Field tau_jp1 = t(j+1);
+            t(j)   =  c    *tau_j + s*tau_jp1;
+            t(j+1) = -sConj*tau_j + c*tau_jp1;
+            // Minimize the residual
+            // ^^^^^^^^^^^^^^^^^^^^^
+            auto tT = t( IR(0,j+1), ALL );
+            auto HTL = H( IR(0,j+1), IR(0,j+1) );
+            auto y = tT;
+            Trsv( UPPER, NORMAL, NON_UNIT, HTL, y );
+            // x := x0 + Zj y
+            // ^^^^^^^^^^^^^^
+            x = x0;
+            auto ZjLoc = Z.Matrix()( ALL, IR(0,j+1) );
+            auto yj = y( IR(0,j+1), ALL );
+            Gemv( NORMAL, Field(1), ZjLoc, yj, Field(1), x.Matrix() );
+
+            // w := b - A x
+            // ------------
+            w = b;
+            if( saveProducts )
+            {
+                // q := Ax = Ax0 + A Z_j y_j
+                // ^^^^^^^^^^^^^^^^^^^^^^^^^
+                q = Ax0;
+                auto AZjLoc = AZ.Matrix()( ALL, IR(0,j+1) );
+                Gemv( NORMAL, Field(1), AZjLoc, yj, Field(1), q.Matrix() );
+
+                // w := b - A x
+                // ^^^^^^^^^^^^
+                w -= q;
+            }
+            else
+            {
+                applyA( Field(-1), x, Field(1), w );
+            }
+
+            if( time )
+                Output("iter took ",iterTimer.Stop()," secs");
+
+            // Residual checks
+            // ---------------
+            const Real residNorm = FrobeniusNorm( w );
+            if( !limits::IsFinite(residNorm) )
+                RuntimeError("Residual norm was not finite");
+            const Real relResidNorm = residNorm/origResidNorm;
+            if( relResidNorm < relTol )
+            {
+                if( progress )
+                    Output("converged with relative tolerance: ",relResidNorm);
+                converged = true;
+                ++iter;
+                break;
+            }
+            else
+            {
+                if( progress )
+                    Output
+                    ("finished iteration ",iter," with relResidNorm=",
+                     relResidNorm);
+            }
+            ++iter;
+            if( iter == maxIts )
+                RuntimeError("FGMRES did not converge");
+            SetIndent( innerIndent );
+        }
+        SetIndent( indent );
+    }
+    b = x;
+    return iter;
+}
+
 } // namespace fgmres
 
 // TODO(poulson): Add support for an initial guess
@@ -314,6 +577,36 @@ Int FGMRES
     return mostIts;
 }
 
+// TODO(poulson): Add support for an initial guess
+template<typename Field,class ApplyAType,class PrecondType>
+Int FGMRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int height = B.Height();
+    const Int width = B.Width();
+    DistMultiVec<Field> b(B.Grid());
+    for( Int j=0; j<width; ++j )
+    {
+        auto BLoc_j = B.Matrix()( ALL, IR(j) );
+        b.Resize( height, 1 );
+        b.Matrix() = BLoc_j;
+        const Int its =
+          fgmres::Single
+          ( applyA, precond, b, relTol, restart, maxIts, progress );
+        BLoc_j = b.LockedMatrix();
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
 
 } // namespace El
 
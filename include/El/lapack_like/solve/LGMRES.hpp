@@ -27,6 +27,8 @@ namespace lgmres {
 //
 // and overwrite b with an approximation of inv(A) b.
 //
+// Any LinearOperator (e.g., a KroneckerOperator) may be passed as 'applyA'.
+//
 
 // TODO(poulson): Add support for an initial guess
 template<typename Field,class ApplyAType,class PrecondType>
@@ -235,6 +237,219 @@ Int Single
     return iter;
 }
 
+// The basis vectors are stored in the local portion of a DistMultiVec, and
+// only the small Hessenberg system is kept redundantly on every process
+// TODO(poulson): Add support for an initial guess
+template<typename Field,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& b,
+        Base<Field> relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<Field> Real;
+    const Int n = b.Height();
+    const Grid& grid = b.Grid();
+    mpi::Comm comm = grid.Comm();
+
+    // x := 0
+    // ======
+    DistMultiVec<Field> x(grid);
+    Zeros( x, n, 1 );
+
+    // w := b (= b - A x_0)
+    // ====================
+    DistMultiVec<Field> w(grid);
+    w = b;
+    const Real origResidNorm = FrobeniusNorm( w );
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    Int iter=0;
+    bool converged = false;
+    Matrix<Real> cs;
+    Matrix<Field> sn, H, t;
+    DistMultiVec<Field> x0(grid), V(grid), vj(grid);
+    while( !converged )
+    {
+        if( progress )
+            Output("Starting GMRES iteration ",iter);
+        const Int indent = PushIndent();
+
+        Zeros( cs, restart, 1 );
+        Zeros( sn, restart, 1 );
+        Zeros( H,  restart, restart );
+        Zeros( V, n, restart );
+
+        // x0 := x
+        // =======
+        x0 = x;
+
+        // w := inv(M) w
+        // =============
+        precond( w );
+
+        // beta := || w ||_2
+        // =================
+        const Real beta = FrobeniusNorm( w );
+
+        // v0 := w / beta
+        // ==============
+        auto v0 = V.Matrix()( ALL, IR(0) );
+        v0 = w.LockedMatrix();
+        v0 *= 1/beta;
+
+        // t := beta e_0
+        // =============
+        Zeros( t, restart+1, 1 );
+        t.Set( 0, 0, beta );
+
+        // Run one round of GMRES
+        // ======================
+        for( Int j=0; j<restart; ++j )
+        {
+            if( progress )
+                Output("Starting inner GMRES iteration ",j);
+            const Int innerIndent = PushIndent();
+
+            // w := A v_j
+            // ----------
+            vj.Resize( n, 1 );
+            vj.Matrix() = V.Matrix()( ALL, IR(j) );
+            applyA( Field(1), vj, Field(0), w );
+
+            // w := inv(M) w
+            // -------------
+            precond( w );
+
+            // Run the j'th step of Arnoldi
+            // ----------------------------
+            for( Int i=0; i<=j; ++i )
+            {
+                // H(i,j) := v_i' w
+                // ^^^^^^^^^^^^^^^^
+                auto vi = V.Matrix()( ALL, IR(i) );
+                H.Set( i, j, mpi::AllReduce( Dot(vi,w.LockedMatrix()), comm ) );
+
+                // w := w - H(i,j) v_i
+                // ^^^^^^^^^^^^^^^^^^^
+                Axpy( -H(i,j), vi, w.Matrix() );
+            }
+            const Real delta = FrobeniusNorm( w );
+            if( !limits::IsFinite(delta) )
+                RuntimeError("Arnoldi step produced a non-finite number");
+            if( delta == Real(0) )
+                restart = j+1;
+            if( j+1 != restart )
+            {
+                // v_{j+1} := w / delta
+                // ^^^^^^^^^^^^^^^^^^^^
+                auto vjp1 = V.Matrix()( ALL, IR(j+1) );
+                vjp1 = w.LockedMatrix();
+                vjp1 *= 1/delta;
+            }
+
+            // Apply existing rotations to the new column of H
+            // -----------------------------------------------
+            for( Int i=0; i<j; ++i )
+            {
+                const Real& c = cs(i);
+                const Field& s = sn(i);
+                const Field sConj = Conj(s);
+                const Field eta_i_j = H(i,j);
+                const Field eta_ip1_j = H(i+1,j);
+                H(i,  j) =  c    *eta_i_j + s*eta_ip1_j;
+                H(i+1,j) = -sConj*eta_i_j + c*eta_ip1_j;
+            }
+
+            // Generate and apply a new rotation to both H and the rotated
+            // beta*e_0 vector, t, then solve the minimum residual problem
+            // -----------------------------------------------------------
+            const Field eta_j_j = H(j,j);
+            const Field eta_jp1_j = delta;
+            if( !limits::IsFinite(RealPart(eta_j_j))   ||
+                !limits::IsFinite(ImagPart(eta_j_j))   ||
+                !limits::IsFinite(RealPart(eta_jp1_j)) ||
+                !limits::IsFinite(ImagPart(eta_jp1_j)) )
+                RuntimeError("Either H(j,j) or H(j+1,j) was not finite");
+            Real c;
+            Field s;
+            Field rho = Givens( eta_j_j, eta_jp1_j, c, s );
+            if( !limits::IsFinite(c) ||
+                !limits::IsFinite(RealPart(s)) ||
+                !limits::IsFinite(ImagPart(s)) ||
+                !limits::IsFinite(RealPart(rho)) ||
+                !limits::IsFinite(ImagPart(rho)) )
+                RuntimeError("Givens rotation produced a non-finite number");
+            H(j,j) = rho;
+            cs(j) = c;
+            sn(j) = s;
+            // Apply the rotation to the rotated beta*e_0 vector
+            // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+            const Field sConj = Conj(s);
+            const Field tau_j = t(j);
+            const Field tau_jp1 = t(j+1);
+            t(j)   =  c    *tau_j + s*tau_jp1;
+            t(j+1) = -sConj*tau_j + c*tau_jp1;
+            // Minimize the residual
+            // ^^^^^^^^^^^^^^^^^^^^^
+            auto tT = t( IR(0,j+1), ALL );
+            auto HTL = H( IR(0,j+1), IR(0,j+1) );
+            auto y = tT;
+            Trsv( UPPER, NORMAL, NON_UNIT, HTL, y );
+            // x := x0 + Vj y
+            // ^^^^^^^^^^^^^^
+            x = x0;
+            for( Int i=0; i<=j; ++i )
+            {
+                Axpy( y(i), V.Matrix()( ALL, IR(i) ), x.Matrix() );
+            }
+
+            // w := b - A x
+            // ------------
+            w = b;
+            applyA( Field(-1), x, Field(1), w );
+
+            // Residual checks
+            // ---------------
+            const Real residNorm = FrobeniusNorm( w );
+            if( !limits::IsFinite(residNorm) )
+                RuntimeError("Residual norm was not finite");
+            const Real relResidNorm = residNorm/origResidNorm;
+            if( relResidNorm < relTol )
+            {
+                if( progress )
+                    Output("converged with relative tolerance: ",relResidNorm);
+                converged = true;
+                ++iter;
+                break;
+            }
+            else
+            {
+                if( progress )
+                    Output
+                    ("finished iteration ",iter," with relResidNorm=",
+                     relResidNorm);
+            }
+            ++iter;
+            if( iter == maxIts )
+                RuntimeError("LGMRES did not converge");
+            SetIndent( innerIndent );
+        }
+        SetIndent( indent );
+    }
+    b = x;
+    return iter;
+}
+
 } // namespace lgmres
 
 // TODO(poulson): Add support for an initial guess
@@ -262,6 +477,36 @@ Int LGMRES
     return mostIts;
 }
 
+// TODO(poulson): Add support for an initial guess
+template<typename Field,class ApplyAType,class PrecondType>
+Int LGMRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int height = B.Height();
+    const Int width = B.Width();
+    DistMultiVec<Field> b(B.Grid());
+    for( Int j=0; j<width; ++j )
+    {
+        auto BLoc_j = B.Matrix()( ALL, IR(j) );
+        b.Resize( height, 1 );
+        b.Matrix() = BLoc_j;
+        const Int its =
+          lgmres::Single
+          ( applyA, precond, b, relTol, restart, maxIts, progress );
+        BLoc_j = b.LockedMatrix();
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
 } // namespace El
 
 #endif // ifndef EL_SOLVE_LGMRES_HPP
@@ -0,0 +1,279 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_MINRES_HPP
+#define EL_SOLVE_MINRES_HPP
+
+// The Givens-based update of the solution follows "Algorithm 2.4"
+// (preconditioned MINRES) of
+//   Howard Elman, David Silvester, and Andy Wathen,
+//   "Finite Elements and Fast Iterative Solvers", 2nd edition,
+//   Oxford University Press, 2014,
+// while the preconditioned Lanczos process is pipelined in the spirit of
+//   Pieter Ghysels, Thomas Ashby, Karl Meerbergen, and Wim Vanroose,
+//   "Hiding global communication latency in the GMRES algorithm on massively
+//    parallel machines",
+//   SIAM J. Sci. Comput., Vol. 35, No. 1, pp. C48--C71, 2013:
+// the unnormalized Lanczos vector q_k, along with z_k = inv(M) q_k and
+// w_k = A z_k, is formed before its norm is known, so that both Lanczos
+// coefficients follow from the single reduction of q_k' z_k and z_k' w_k,
+// which is overlapped with the applications of inv(M) and A to w_k. The
+// Givens update of the solution consequently lags one Lanczos step behind.
+
+namespace El {
+
+namespace minres {
+
+// See the note in CG.hpp on the forms of 'applyA' and 'precond'; A may be
+// indefinite, but the preconditioner must be HPD.
+
+template<typename Field,class ApplyAType,class PrecondType,class VecType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VecType& b,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<Field> Real;
+    const Int n = b.Height();
+    const Int localHeight = pipelined::Local(b).Height();
+
+    const Real origResidNorm = FrobeniusNorm( b );
+    if( progress )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    auto x = pipelined::Like( b );
+    auto r = pipelined::Like( b );
+    auto mVec = pipelined::Like( b );
+    auto nVec = pipelined::Like( b );
+    Zeros( x, n, 1 );
+    auto& xLoc = pipelined::Local( x );
+    auto& mLoc = pipelined::Local( mVec );
+    auto& nLoc = pipelined::Local( nVec );
+
+    // The unnormalized preconditioned Lanczos vectors q_k, z_k = inv(M) q_k,
+    // and w_k = A z_k, their normalized predecessors, and the MINRES search
+    // directions
+    Matrix<Field> q, z, w, qPrev, zPrev, wPrev, d, dPrev;
+    Matrix<Field> dots, sums;
+    mpi::Request<Field> request;
+    Int iter = 0;
+    while( true )
+    {
+        // Explicitly form r := b - A x, which doubles as a residual
+        // replacement to counter the drift of the pipelined recurrences
+        r = b;
+        applyA( Field(-1), x, Field(1), r );
+        const Real residNorm = FrobeniusNorm( r );
+        if( !limits::IsFinite(residNorm) )
+            RuntimeError("Residual norm was not finite");
+        const Real relResidNorm = residNorm / origResidNorm;
+        if( relResidNorm <= relTol )
+        {
+            if( progress )
+                Output("converged with relative tolerance: ",relResidNorm);
+            break;
+        }
+        if( iter >= maxIts )
+            RuntimeError("MINRES did not converge");
+        if( progress )
+            Output("Restarting MINRES at iteration ",iter);
+
+        // q := r, z := inv(M) r, and w := A z
+        mVec = r;
+        precond( mVec );
+        Zeros( nVec, n, 1 );
+        applyA( Field(1), mVec, Field(0), nVec );
+        q = pipelined::Local( r );
+        z = mLoc;
+        w = nLoc;
+        Zeros( qPrev, localHeight, 1 );
+        Zeros( zPrev, localHeight, 1 );
+        Zeros( wPrev, localHeight, 1 );
+        Zeros( d, localHeight, 1 );
+        Zeros( dPrev, localHeight, 1 );
+
+        // The residual estimate is measured in the inv(M) norm, and so its
+        // target is scaled by the ratio of the two norms of the residual
+        Real estTarget=0, betaInit=0, beta=0, alphaPrev=0, eta=0;
+        Real c=1, cPrev=1, sn=0, snPrev=0;
+        for( Int j=0; iter<maxIts; ++j )
+        {
+            // Start the reduction of beta_k^2 := q' z and
+            // beta_k^2 alpha_k := z' w
+            Zeros( dots, 2, 1 );
+            dots(0) = Dot( q, z );
+            dots(1) = Dot( z, w );
+            pipelined::StartSum( b, dots, sums, request );
+
+            // Overlap the reduction with m := inv(M) w and n := A m
+            mLoc = w;
+            precond( mVec );
+            Zeros( nVec, n, 1 );
+            applyA( Field(1), mVec, Field(0), nVec );
+            pipelined::FinishSum( b, request );
+
+            const Real betaSquared = RealPart(sums(0));
+            if( !limits::IsFinite(betaSquared) ||
+                !limits::IsFinite(RealPart(sums(1))) )
+                RuntimeError("Pipelined MINRES produced a non-finite number");
+            if( betaSquared < Real(0) )
+                RuntimeError("The preconditioner was not HPD");
+            const Real betaNext = Sqrt( betaSquared );
+            const Real alpha =
+              betaNext > Real(0) ? RealPart(sums(1))/betaSquared : Real(0);
+
+            if( j == 0 )
+            {
+                if( betaNext == Real(0) )
+                    RuntimeError("The preconditioner was not HPD");
+                betaInit = eta = betaNext;
+                estTarget = relTol*betaInit/relResidNorm;
+            }
+            else
+            {
+                // Apply the previous two rotations to the now-complete
+                // previous column of the tridiagonal matrix and form the
+                // next rotation
+                const Real a0 = c*alphaPrev - cPrev*sn*beta;
+                const Real a1 = SafeNorm( a0, betaNext );
+                const Real a2 = sn*alphaPrev + cPrev*c*beta;
+                const Real a3 = snPrev*beta;
+                if( a1 == Real(0) )
+                    RuntimeError("MINRES broke down");
+                const Real cNext = a0 / a1;
+                const Real snNext = betaNext / a1;
+
+                // d_k := (z_{k-1} - a3 d_{k-2} - a2 d_{k-1}) / a1, stored
+                // in dPrev
+                Scale( -a3, dPrev );
+                Axpy( -a2, d, dPrev );
+                dPrev += zPrev;
+                Scale( Real(1)/a1, dPrev );
+                std::swap( d, dPrev );
+
+                // x := x + cNext eta d_k
+                Axpy( cNext*eta, d, xLoc );
+                eta = -snNext*eta;
+                ++iter;
+
+                cPrev = c;
+                c = cNext;
+                snPrev = sn;
+                sn = snNext;
+                beta = betaNext;
+
+                if( progress )
+                    Output
+                    ("iteration ",iter," estimated relative residual: ",
+                     Abs(eta)/betaInit*relResidNorm);
+                if( Abs(eta) <= estTarget || betaNext == Real(0) )
+                    break;
+            }
+
+            // Normalize q, z, w, m, and n by beta_k and continue the Lanczos
+            // recurrences, e.g., q_{k+1} := w_k - alpha_k q_k - beta_k q_{k-1},
+            // overwriting the previous vectors with the normalized current ones
+            const Real betaInv = Real(1)/betaNext;
+            Scale( betaInv, q );
+            Scale( betaInv, z );
+            Scale( betaInv, w );
+            Scale( betaInv, mLoc );
+            Scale( betaInv, nLoc );
+            Scale( -betaNext, qPrev );
+            Axpy( -alpha, q, qPrev );
+            qPrev += w;
+            Scale( -betaNext, zPrev );
+            Axpy( -alpha, z, zPrev );
+            zPrev += mLoc;
+            Scale( -betaNext, wPrev );
+            Axpy( -alpha, w, wPrev );
+            wPrev += nLoc;
+            std::swap( q, qPrev );
+            std::swap( z, zPrev );
+            std::swap( w, wPrev );
+            alphaPrev = alpha;
+        }
+    }
+    b = x;
+    return iter;
+}
+
+} // namespace minres
+
+// Solve A X = B, where A is Hermitian (but possibly indefinite) and the
+// preconditioner is HPD, using pipelined preconditioned MINRES with a single
+// non-blocking reduction per iteration. The number of iterations is returned.
+// TODO(poulson): Add support for an initial guess
+template<typename Field,class ApplyAType,class PrecondType>
+Int MINRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int width = B.Width();
+    Matrix<Field> b;
+    for( Int j=0; j<width; ++j )
+    {
+        b = B( ALL, IR(j) );
+        const Int its =
+          minres::Single<Field>
+          ( applyA, precond, b, relTol, maxIts, progress );
+        auto BCol = B( ALL, IR(j) );
+        BCol = b;
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+// TODO(poulson): Add support for an initial guess
+template<typename Field,class ApplyAType,class PrecondType>
+Int MINRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int height = B.Height();
+    const Int width = B.Width();
+    DistMultiVec<Field> b(B.Grid());
+    for( Int j=0; j<width; ++j )
+    {
+        auto BLoc_j = B.Matrix()( ALL, IR(j) );
+        b.Resize( height, 1 );
+        b.Matrix() = BLoc_j;
+        const Int its =
+          minres::Single<Field>
+          ( applyA, precond, b, relTol, maxIts, progress );
+        BLoc_j = b.LockedMatrix();
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_MINRES_HPP
@@ -39,6 +39,8 @@ namespace refined_solve {
 //
 // and overwrite b with inv(A) b.
 //
+// Any LinearOperator may be passed as 'applyA'.
+//
 
 template<typename Field,class ApplyAType,class ApplyAInvType>
 Int Single
@@ -345,6 +347,136 @@ Int Batch
     return refineIt;
 }
 
+template<typename Field,class ApplyAType,class ApplyAInvType>
+Int Single
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+        DistMultiVec<Field>& b,
+        Base<Field> relTol,
+        Int maxRefineIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    if( maxRefineIts <= 0 )
+    {
+        applyAInv( b );
+        return 0;
+    }
+
+    auto bOrig = b;
+    const Base<Field> bNorm = MaxNorm( b );
+
+    // Compute the initial guess
+    // =========================
+    auto x = b;
+    applyAInv( x );
+
+    DistMultiVec<Field> dx(b.Grid()), xCand(b.Grid()), y(b.Grid());
+    Zeros( y, x.Height(), 1 );
+
+    applyA( x, y );
+    b -= y;
+    Base<Field> errorNorm = MaxNorm( b );
+    if( progress )
+        Output("original rel error: ",errorNorm/bNorm);
+
+    Int refineIt = 0;
+    while( true )
+    {
+        if( errorNorm/bNorm <= relTol )
+        {
+            if( progress )
+                Output(errorNorm/bNorm," <= ",relTol);
+            break;
+        }
+
+        // Compute the proposed update to the solution
+        // -------------------------------------------
+        dx = b;
+        applyAInv( dx );
+        xCand = x;
+        xCand += dx;
+
+        // Check the new residual
+        // ----------------------
+        applyA( xCand, y );
+        b = bOrig;
+        b -= y;
+        auto newErrorNorm = MaxNorm( b );
+        if( progress )
+            Output("refined rel error: ",newErrorNorm/bNorm);
+
+        if( newErrorNorm < errorNorm )
+            x = xCand;
+        else
+            break;
+
+        errorNorm = newErrorNorm;
+        ++refineIt;
+        if( refineIt >= maxRefineIts )
+            break;
+    }
+    b = x;
+    return refineIt;
+}
+
+template<typename Field,class ApplyAType,class ApplyAInvType>
+Int Batch
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+        DistMultiVec<Field>& B,
+        Int maxRefineIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    if( maxRefineIts <= 0 )
+    {
+        applyAInv( B );
+        return 0;
+    }
+
+    // TODO: Allow for early exits
+
+    // Compute the initial guesses
+    // ===========================
+    auto BOrig = B;
+    auto X = B;
+    applyAInv( X );
+
+    DistMultiVec<Field> dX(B.Grid()), Y(B.Grid());
+    Zeros( Y, X.Height(), X.Width() );
+    applyA( X, Y );
+    B -= Y;
+
+    Int refineIt = 0;
+    while( true )
+    {
+        // Compute the updates to the solutions
+        // ------------------------------------
+        dX = B;
+        applyAInv( dX );
+        X += dX;
+
+        ++refineIt;
+        if( refineIt < maxRefineIts )
+        {
+            // Compute the new residual
+            // ------------------------
+            applyA( X, Y );
+            B = BOrig;
+            B -= Y;
+        }
+        else
+            break;
+    }
+    B = X;
+    return refineIt;
+}
+
 } // namespace refined_solve
 
 template<typename Field,class ApplyAType,class ApplyAInvType>
@@ -368,6 +500,25 @@ Int RefinedSolve
                ( applyA, applyAInv, B, maxRefineIts, progress );
 }
 
+// Pairs of right-hand sides are refined as a batch
+template<typename Field,class ApplyAType,class ApplyAInvType>
+Int RefinedSolve
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int maxRefineIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    if( B.Width() == 1 )
+        return refined_solve::Single
+               ( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+    else
+        return refined_solve::Batch
+               ( applyA, applyAInv, B, maxRefineIts, progress );
+}
+
 namespace refined_solve {
 
 template<typename Field,class ApplyAType,class ApplyAInvType>
@@ -700,6 +851,147 @@ Int PromotedBatch
     return refineIt;
 }
 
+template<typename Field,class ApplyAType,class ApplyAInvType>
+Int PromotedSingle
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+        DistMultiVec<Field>& b,
+        Base<Field> relTol,
+        Int maxRefineIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    if( maxRefineIts <= 0 )
+    {
+        applyAInv( b );
+        return 0;
+    }
+    typedef Base<Field> Real;
+    typedef Promote<Real> PReal;
+    typedef Promote<Field> PField;
+
+    DistMultiVec<PField> bProm(b.Grid()), bOrigProm(b.Grid());
+    Copy( b, bProm );
+    Copy( b, bOrigProm );
+    const PReal bNorm = MaxNorm( bOrigProm );
+
+    // Compute the initial guess
+    // =========================
+    applyAInv( b );
+    DistMultiVec<PField> xProm(b.Grid());
+    Copy( b, xProm );
+
+    DistMultiVec<PField> dxProm(b.Grid()), xCandProm(b.Grid()), yProm(b.Grid());
+    Zeros( yProm, xProm.Height(), 1 );
+
+    applyA( xProm, yProm );
+    bProm -= yProm;
+    auto errorNorm = MaxNorm( bProm );
+    if( progress )
+        Output("original rel error: ",errorNorm/bNorm);
+
+    Int refineIt = 0;
+    while( true )
+    {
+        if( errorNorm/bNorm <= relTol )
+        {
+            if( progress )
+                Output(errorNorm/bNorm," <= ",relTol);
+            break;
+        }
+
+        // Compute the proposed update to the solution
+        // -------------------------------------------
+        Copy( bProm, b );
+        applyAInv( b );
+        Copy( b, dxProm );
+        xCandProm = xProm;
+        xCandProm += dxProm;
+
+        // Check the new residual
+        // ----------------------
+        applyA( xCandProm, yProm );
+        bProm = bOrigProm;
+        bProm -= yProm;
+        auto newErrorNorm = MaxNorm( bProm );
+        if( progress )
+            Output("refined rel error: ",newErrorNorm/bNorm);
+
+        if( newErrorNorm < errorNorm )
+            xProm = xCandProm;
+        else
+            break;
+
+        errorNorm = newErrorNorm;
+        ++refineIt;
+        if( refineIt >= maxRefineIts )
+            break;
+    }
+    Copy( xProm, b );
+    return refineIt;
+}
+
+template<typename Field,class ApplyAType,class ApplyAInvType>
+Int PromotedBatch
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+        DistMultiVec<Field>& B,
+        Int maxRefineIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    if( maxRefineIts <= 0 )
+    {
+        applyAInv( B );
+        return 0;
+    }
+    typedef Promote<Field> PField;
+
+    DistMultiVec<PField> BProm(B.Grid()), BOrigProm(B.Grid());
+    Copy( B, BProm );
+    Copy( B, BOrigProm );
+
+    // Compute the initial guesses
+    // ===========================
+    applyAInv( B );
+    DistMultiVec<PField> XProm(B.Grid());
+    Copy( B, XProm );
+
+    DistMultiVec<PField> dXProm(B.Grid()), YProm(B.Grid());
+    Zeros( YProm, XProm.Height(), XProm.Width() );
+    applyA( XProm, YProm );
+    BProm -= YProm;
+
+    Int refineIt = 0;
+    while( true )
+    {
+        // Update the solutions
+        // --------------------
+        Copy( BProm, B );
+        applyAInv( B );
+        Copy( B, dXProm );
+        XProm += dXProm;
+
+        ++refineIt;
+        if( refineIt < maxRefineIts )
+        {
+            // Form the new residuals
+            // ----------------------
+            applyA( XProm, YProm );
+            BProm = BOrigProm;
+            BProm -= YProm;
+        }
+        else
+            break;
+    }
+    Copy( XProm, B );
+    return refineIt;
+}
+
 } // namespace refined_solve
 
 template<typename Field,class ApplyAType,class ApplyAInvType>
@@ -738,6 +1030,39 @@ PromotedRefinedSolve
     return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
 }
 
+template<typename Field,class ApplyAType,class ApplyAInvType>
+DisableIf<IsSame<Field,Promote<Field>>,Int>
+PromotedRefinedSolve
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int maxRefineIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    if( B.Width() == 1 )
+        return refined_solve::PromotedSingle
+               ( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+    else
+        return refined_solve::PromotedBatch
+               ( applyA, applyAInv, B, maxRefineIts, progress );
+}
+
+template<typename Field,class ApplyAType,class ApplyAInvType>
+EnableIf<IsSame<Field,Promote<Field>>,Int>
+PromotedRefinedSolve
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int maxRefineIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+}
+
 } // namespace El
 
 #endif // ifndef EL_SOLVE_REFINED_HPP
@@ -0,0 +1,531 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_SSTEP_GMRES_HPP
+#define EL_SOLVE_SSTEP_GMRES_HPP
+
+// The s-step ("communication-avoiding") formulation of GMRES follows
+//   Mark Hoemmen,
+//   "Communication-avoiding Krylov subspace methods",
+//   PhD thesis, University of California, Berkeley, 2010,
+// where each block of s basis vectors is generated with s consecutive
+// applications of (a Newton polynomial in) the preconditioned operator and
+// then orthogonalized against the existing basis with block classical
+// Gram-Schmidt and CholeskyQR, each repeated twice. A block of s Krylov
+// iterations therefore requires only two global reductions, rather than the
+// O(s^2) reductions of the Arnoldi steps in FGMRES.
+
+namespace El {
+
+namespace sstep_gmres {
+
+// In what follows, 'applyA' and 'precond' should be of the same form as in
+// FGMRES (any LinearOperator may be passed as 'applyA'). Unlike FGMRES, the
+// preconditioner must be a fixed linear operator, as it is applied to the
+// (right-preconditioned) Krylov basis only once per restart.
+
+template<typename Field>
+Matrix<Field>& Local( Matrix<Field>& x ) EL_NO_EXCEPT { return x; }
+template<typename Field>
+Matrix<Field>& Local( DistMultiVec<Field>& x ) EL_NO_EXCEPT
+{ return x.Matrix(); }
+
+template<typename Field>
+Matrix<Field> Like( const Matrix<Field>& ) { return Matrix<Field>(); }
+template<typename Field>
+DistMultiVec<Field> Like( const DistMultiVec<Field>& x )
+{ return DistMultiVec<Field>( x.Grid() ); }
+
+// Sum the contiguous matrix G over the processes sharing the vector x
+template<typename Field>
+void SumOver( const Matrix<Field>&, Matrix<Field>& ) { }
+template<typename Field>
+void SumOver( const DistMultiVec<Field>& x, Matrix<Field>& G )
+{ mpi::AllReduce( G.Buffer(), G.Height()*G.Width(), x.Grid().Comm() ); }
+
+// Order the Ritz values so as to (approximately) maximize the distance of
+// each shift from the previous ones (the "modified Leja ordering" of Bai, Hu,
+// and Reichel). For real fields, conjugate pairs are kept adjacent, with the
+// member of positive imaginary part first.
+template<typename Field>
+vector<Complex<Base<Field>>>
+LejaOrdering( const Matrix<Complex<Base<Field>>>& ritz )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const bool real = !IsComplex<Field>::value;
+    const Int numRitz = ritz.Height();
+
+    vector<Complex<Real>> candidates;
+    for( Int i=0; i<numRitz; ++i )
+    {
+        const Complex<Real> theta = ritz(i);
+        if( !limits::IsFinite(RealPart(theta)) ||
+            !limits::IsFinite(ImagPart(theta)) )
+            return vector<Complex<Real>>( numRitz, Complex<Real>(0) );
+        if( !real || ImagPart(theta) >= Real(0) )
+            candidates.push_back( theta );
+    }
+
+    const Int numCandidates = candidates.size();
+    vector<bool> used( numCandidates, false );
+    vector<Real> logDist( numCandidates, Real(0) );
+    vector<Complex<Real>> shifts;
+    while( Int(shifts.size()) < numRitz )
+    {
+        Int best = -1;
+        Real bestScore = 0;
+        for( Int i=0; i<numCandidates; ++i )
+        {
+            if( used[i] )
+                continue;
+            const Real score =
+              ( shifts.empty() ? Abs(candidates[i]) : logDist[i] );
+            if( best < 0 || score > bestScore )
+            {
+                best = i;
+                bestScore = score;
+            }
+        }
+        if( best < 0 )
+            break;
+        used[best] = true;
+        const Complex<Real> theta = candidates[best];
+        const bool pair = ( real && ImagPart(theta) != Real(0) );
+        shifts.push_back( theta );
+        if( pair )
+            shifts.push_back( Conj(theta) );
+        for( Int i=0; i<numCandidates; ++i )
+        {
+            if( used[i] )
+                continue;
+            logDist[i] += Log( Abs(candidates[i]-theta) );
+            if( pair )
+                logDist[i] += Log( Abs(candidates[i]-Conj(theta)) );
+        }
+    }
+    return shifts;
+}
+
+// Form the (s+1) x s change of basis matrix B such that
+//
+//   (A inv(M)) [v_0, ..., v_{s-1}] = [v_0, ..., v_s] B
+//
+// for the Newton basis v_{i+1} := (A inv(M) - theta_i) v_i. For real fields,
+// a conjugate pair (theta, conj(theta)) = (a + i b, a - i b) instead yields
+// the real recurrence
+//
+//   v_{i+1} := (A inv(M) - a) v_i,
+//   v_{i+2} := (A inv(M) - a) v_{i+1} + b^2 v_i,
+//
+// and a pair which would be split by the end of the block is replaced by
+// its real part.
+template<typename Field>
+void NewtonBasisChange
+( const vector<Complex<Base<Field>>>& shifts, Int s, Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const bool real = !IsComplex<Field>::value;
+    Zeros( B, s+1, s );
+    for( Int i=0; i<s; ++i )
+    {
+        B(i+1,i) = Field(1);
+        const Complex<Real> theta = shifts[i];
+        if( !real || ImagPart(theta) == Real(0) )
+        {
+            B(i,i) = RealPart(theta);
+            if( !real )
+                SetImagPart( B(i,i), ImagPart(theta) );
+            continue;
+        }
+        // The first member of the conjugate pair
+        B(i,i) = RealPart(theta);
+        if( i+1 < s )
+        {
+            ++i;
+            B(i,i) = RealPart(theta);
+            B(i+1,i) = Field(1);
+            B(i-1,i) = -ImagPart(theta)*ImagPart(theta);
+        }
+    }
+}
+
+// Orthogonalize W against the orthonormal columns of Q (locally) and then
+// among themselves, so that W = Q C + WNew R, via two passes of block
+// classical Gram-Schmidt and CholeskyQR, each of which performs a single
+// reduction. Returns false if the block was numerically rank-deficient.
+template<typename Field,class VecType>
+bool BlockOrthogonalize
+( const VecType& b,
+  const Matrix<Field>& Q,
+        Matrix<Field>& W,
+        Matrix<Field>& C,
+        Matrix<Field>& R )
+{
+    EL_DEBUG_CSE
+    const Int k = Q.Width();
+    const Int s = W.Width();
+    Matrix<Field> G, CPass, GPass, RPass;
+    for( Int pass=0; pass<2; ++pass )
+    {
+        // [C; G] := [Q, W]^H W with a single reduction
+        Zeros( G, k+s, s );
+        View( CPass, G, IR(0,k), ALL );
+        View( GPass, G, IR(k,k+s), ALL );
+        Gemm( ADJOINT, NORMAL, Field(1), Q, W, Field(0), CPass );
+        Gemm( ADJOINT, NORMAL, Field(1), W, W, Field(0), GPass );
+        SumOver( b, G );
+
+        // W := W - Q C, and the Gram matrix of the result is G - C^H C
+        Gemm( NORMAL, NORMAL, Field(-1), Q, CPass, Field(1), W );
+        Gemm( ADJOINT, NORMAL, Field(-1), CPass, CPass, Field(1), GPass );
+        RPass = GPass;
+        try { Cholesky( UPPER, RPass ); }
+        catch( NonHPDMatrixException& ) { return false; }
+        MakeTrapezoidal( UPPER, RPass );
+        for( Int j=0; j<s; ++j )
+            if( !limits::IsFinite(RealPart(RPass(j,j))) ||
+                RealPart(RPass(j,j)) <= Base<Field>(0) )
+                return false;
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), RPass, W );
+
+        // Accumulate C := C + C_pass R and R := R_pass R
+        if( pass == 0 )
+        {
+            C = CPass;
+            R = RPass;
+        }
+        else
+        {
+            Gemm( NORMAL, NORMAL, Field(1), CPass, R, Field(1), C );
+            Trmm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), RPass, R );
+        }
+    }
+    return true;
+}
+
+// TODO(poulson): Add support for an initial guess
+template<typename Field,class ApplyAType,class PrecondType,class VecType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VecType& b,
+        Base<Field> relTol,
+        Int restart,
+        Int maxIts,
+        Int s,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<Field> Real;
+    const Int n = b.Height();
+    restart = Max( restart, Int(1) );
+    s = Min( Max( s, Int(1) ), restart );
+
+    // x := 0 and w := b (= b - A x)
+    auto x = Like( b );
+    Zeros( x, n, 1 );
+    auto w = b;
+    const Real origResidNorm = FrobeniusNorm( w );
+    if( progress )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm == Real(0) )
+        return 0;
+    Real residNorm = origResidNorm;
+
+    // Until the Ritz values are available, the basis is generated one
+    // vector at a time, which is just Arnoldi with reorthogonalization
+    bool haveShifts = false;
+    vector<Complex<Real>> shifts;
+
+    Int iter=0;
+    Matrix<Real> cs;
+    Matrix<Field> sn, H, HRaw, t, BChange, C, R, RFull, HNew, WLoc, HRitz;
+    Matrix<Complex<Real>> ritz;
+    auto V = Like( b );
+    auto u = Like( b );
+    auto Au = Like( b );
+    auto z = Like( b );
+    while( true )
+    {
+        if( progress )
+            Output("Starting s-step GMRES cycle with ",iter," iterations");
+        const Int indent = PushIndent();
+
+        Zeros( cs, restart, 1 );
+        Zeros( sn, restart, 1 );
+        Zeros( H, restart+1, restart );
+        Zeros( HRaw, restart+1, restart );
+        Zeros( V, n, restart+1 );
+        Zeros( t, restart+1, 1 );
+        t(0) = residNorm;
+        auto& VLoc = Local( V );
+        const Int localHeight = VLoc.Height();
+        {
+            auto v0 = VLoc( ALL, IR(0) );
+            v0 = Local( w );
+            v0 *= Real(1)/residNorm;
+        }
+
+        Int numCols = 0;
+        Int sCycle = s;
+        bool converged = false;
+        while( numCols < restart && !converged )
+        {
+            const Int sBlock = ( haveShifts ? Min(sCycle,restart-numCols) : 1 );
+            const Int k = numCols + 1;
+            if( haveShifts )
+                NewtonBasisChange( shifts, sBlock, BChange );
+            else
+                NewtonBasisChange
+                ( vector<Complex<Real>>(1,Complex<Real>(0)), 1, BChange );
+
+            // Generate the block W with the Newton recurrence starting from
+            // the last basis vector
+            Zeros( WLoc, localHeight, sBlock+1 );
+            {
+                auto w0 = WLoc( ALL, IR(0) );
+                w0 = VLoc( ALL, IR(k-1) );
+            }
+            for( Int i=0; i<sBlock; ++i )
+            {
+                Zeros( u, n, 1 );
+                Local( u ) = WLoc( ALL, IR(i) );
+                precond( u );
+                Zeros( Au, n, 1 );
+                applyA( Field(1), u, Field(0), Au );
+                auto wNext = WLoc( ALL, IR(i+1) );
+                wNext = Local( Au );
+                Axpy( -BChange(i,i), WLoc(ALL,IR(i)), wNext );
+                if( i > 0 && BChange(i-1,i) != Field(0) )
+                    Axpy( -BChange(i-1,i), WLoc(ALL,IR(i-1)), wNext );
+                ++iter;
+            }
+
+            // Orthogonalize the new vectors against [v_0, ..., v_{k-1}]
+            Matrix<Field> WNew = WLoc( ALL, IR(1,sBlock+1) );
+            if( !BlockOrthogonalize
+                ( b, VLoc(ALL,IR(0,k)), WNew, C, R ) )
+            {
+                iter -= sBlock;
+                if( sBlock > 1 )
+                {
+                    // Retry with a smaller (better-conditioned) block
+                    sCycle = Max( sBlock/2, Int(1) );
+                    if( progress )
+                        Output("Reducing the block size to ",sCycle);
+                    continue;
+                }
+                // The Krylov subspace is (numerically) invariant
+                break;
+            }
+            auto VNew = VLoc( ALL, IR(k,k+sBlock) );
+            VNew = WNew;
+
+            // [v_{k-1}, W] = [V, WNew] RFull, where the first column of RFull
+            // is e_{k-1}
+            Zeros( RFull, k+sBlock, sBlock+1 );
+            RFull(k-1,0) = Field(1);
+            {
+                auto RFullC = RFull( IR(0,k), IR(1,sBlock+1) );
+                auto RFullR = RFull( IR(k,k+sBlock), IR(1,sBlock+1) );
+                RFullC = C;
+                RFullR = R;
+            }
+
+            // The new columns of the Hessenberg matrix satisfy
+            //
+            //   H_new RBot = RFull B - [H_prev RTop; 0],
+            //
+            // where RTop and RBot are the first k-1 and the next sBlock rows
+            // of the first sBlock columns of RFull
+            Zeros( HNew, k+sBlock, sBlock );
+            Gemm( NORMAL, NORMAL, Field(1), RFull, BChange, Field(0), HNew );
+            if( k > 1 )
+            {
+                auto HPrev = HRaw( IR(0,k), IR(0,k-1) );
+                auto RTop = RFull( IR(0,k-1), IR(0,sBlock) );
+                auto HNewT = HNew( IR(0,k), ALL );
+                Gemm( NORMAL, NORMAL, Field(-1), HPrev, RTop, Field(1), HNewT );
+            }
+            auto RBot = RFull( IR(k-1,k-1+sBlock), IR(0,sBlock) );
+            Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), RBot, HNew );
+            auto HRawNew = HRaw( IR(0,k+sBlock), IR(k-1,k-1+sBlock) );
+            auto HCols = H( IR(0,k+sBlock), IR(k-1,k-1+sBlock) );
+            HRawNew = HNew;
+            HCols = HNew;
+
+            // Apply the rotations to each of the new columns and update the
+            // estimate of the residual norm, |t(j+1)|
+            for( Int j=k-1; j<k-1+sBlock; ++j )
+            {
+                for( Int i=0; i<j; ++i )
+                {
+                    const Real& c = cs(i);
+                    const Field& sRot = sn(i);
+                    const Field eta_i_j = H(i,j);
+                    const Field eta_ip1_j = H(i+1,j);
+                    H(i,  j) =  c*eta_i_j + sRot*eta_ip1_j;
+                    H(i+1,j) = -Conj(sRot)*eta_i_j + c*eta_ip1_j;
+                }
+                Real c;
+                Field sRot;
+                const Field rho = Givens( H(j,j), H(j+1,j), c, sRot );
+                if( !limits::IsFinite(c) ||
+                    !limits::IsFinite(RealPart(rho)) ||
+                    !limits::IsFinite(ImagPart(rho)) )
+                    RuntimeError
+                    ("Givens rotation produced a non-finite number");
+                H(j,j) = rho;
+                H(j+1,j) = Field(0);
+                cs(j) = c;
+                sn(j) = sRot;
+                const Field tau_j = t(j);
+                const Field tau_jp1 = t(j+1);
+                t(j)   =  c*tau_j + sRot*tau_jp1;
+                t(j+1) = -Conj(sRot)*tau_j + c*tau_jp1;
+
+                numCols = j+1;
+                const Real relResidEst = Abs(t(j+1))/origResidNorm;
+                if( progress )
+                    Output("iteration ",j," relResidEst=",relResidEst);
+                if( relResidEst < relTol )
+                {
+                    converged = true;
+                    break;
+                }
+            }
+
+            // Use the Ritz values of the leading s x s block as the shifts
+            if( !haveShifts && numCols >= s )
+            {
+                if( s > 1 )
+                {
+                    HRitz = HRaw( IR(0,s), IR(0,s) );
+                    Schur( HRitz, ritz );
+                    shifts = LejaOrdering<Field>( ritz );
+                }
+                else
+                    shifts.assign( 1, Complex<Real>(0) );
+                haveShifts = true;
+            }
+        }
+
+        // x := x + inv(M) V y, where y minimizes the residual
+        if( numCols > 0 )
+        {
+            auto y = t( IR(0,numCols), ALL );
+            auto HTL = H( IR(0,numCols), IR(0,numCols) );
+            Trsv( UPPER, NORMAL, NON_UNIT, HTL, y );
+            Zeros( z, n, 1 );
+            Gemv
+            ( NORMAL, Field(1), VLoc(ALL,IR(0,numCols)), y,
+              Field(0), Local(z) );
+            precond( z );
+            Local( x ) += Local( z );
+        }
+
+        // w := b - A x
+        w = b;
+        applyA( Field(-1), x, Field(1), w );
+        residNorm = FrobeniusNorm( w );
+        if( !limits::IsFinite(residNorm) )
+            RuntimeError("Residual norm was not finite");
+        const Real relResidNorm = residNorm/origResidNorm;
+        SetIndent( indent );
+        if( relResidNorm < relTol )
+        {
+            if( progress )
+                Output("converged with relative tolerance: ",relResidNorm);
+            break;
+        }
+        if( progress )
+            Output("finished cycle with relResidNorm=",relResidNorm);
+        if( numCols == 0 )
+            RuntimeError("s-step GMRES stagnated");
+        if( iter >= maxIts )
+            RuntimeError("s-step GMRES did not converge");
+    }
+    b = x;
+    return iter;
+}
+
+} // namespace sstep_gmres
+
+// Solve A X = B with right-preconditioned s-step GMRES(restart), where 's' is
+// the number of Krylov vectors generated between global reductions. Values of
+// s between 4 and 8 are typical; the block size is automatically reduced if
+// a block turns out to be numerically rank-deficient.
+// TODO(poulson): Add support for an initial guess
+template<typename Field,class ApplyAType,class PrecondType>
+Int SStepGMRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int restart,
+        Int maxIts,
+        Int s,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int width = B.Width();
+    Matrix<Field> b;
+    for( Int j=0; j<width; ++j )
+    {
+        b = B( ALL, IR(j) );
+        const Int its =
+          sstep_gmres::Single<Field>
+          ( applyA, precond, b, relTol, restart, maxIts, s, progress );
+        auto BCol = B( ALL, IR(j) );
+        BCol = b;
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+// TODO(poulson): Add support for an initial guess
+template<typename Field,class ApplyAType,class PrecondType>
+Int SStepGMRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int restart,
+        Int maxIts,
+        Int s,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int height = B.Height();
+    const Int width = B.Width();
+    DistMultiVec<Field> b(B.Grid());
+    for( Int j=0; j<width; ++j )
+    {
+        auto BLoc_j = B.Matrix()( ALL, IR(j) );
+        b.Resize( height, 1 );
+        b.Matrix() = BLoc_j;
+        const Int its =
+          sstep_gmres::Single<Field>
+          ( applyA, precond, b, relTol, restart, maxIts, s, progress );
+        BLoc_j = b.LockedMatrix();
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_SSTEP_GMRES_HPP
@@ -9,6 +9,7 @@
 #ifndef EL_SPECTRAL_HPP
 #define EL_SPECTRAL_HPP
 
+#include <El/blas_like/level3.hpp>
 #include <El/lapack_like/condense.hpp>
 
 namespace El {
@@ -122,6 +123,26 @@ SecularEigenvalue
         Matrix<Real>& dMinusShift,
   const SecularEVDCtrl<Real>& ctrl=SecularEVDCtrl<Real>() );
 
+// Solve for the numValues eigenvalues with indices
+//
+//     firstValue + t*valueStride, for t = 0, 1, ..., numValues-1,
+//
+// storing the t'th in w(t) and d - w(t) in the t'th column of the
+// n x numValues matrix dMinusShift. The roots are split across threads.
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+SecularEVDInfo
+SecularEigenvalues
+( Int firstValue,
+  Int valueStride,
+  Int numValues,
+  const Matrix<Real>& d,
+  const Real& rho,
+  const Matrix<Real>& z,
+        Matrix<Real>& w,
+        Matrix<Real>& dMinusShift,
+  const SecularEVDCtrl<Real>& ctrl=SecularEVDCtrl<Real>() );
+
 // Note that this routine requires that d(0) <= d(1) <= ... <= d(n-1) and
 // that || z ||_2 = 1.
 template<typename Real,
@@ -215,6 +236,28 @@ SecularSingularValue
         Matrix<Real>& dPlusShift,
   const SecularSVDCtrl<Real>& ctrl=SecularSVDCtrl<Real>() );
 
+// Solve for the numValues singular values with indices
+//
+//     firstValue + t*valueStride, for t = 0, 1, ..., numValues-1,
+//
+// storing the t'th in s(t), d - s(t) in the t'th column of dMinusShift, and
+// d + s(t) in the t'th column of dPlusShift. The roots are split across
+// threads.
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+SecularSVDInfo
+SecularSingularValues
+( Int firstValue,
+  Int valueStride,
+  Int numValues,
+  const Matrix<Real>& d,
+  const Real& rho,
+  const Matrix<Real>& z,
+        Matrix<Real>& s,
+        Matrix<Real>& dMinusShift,
+        Matrix<Real>& dPlusShift,
+  const SecularSVDCtrl<Real>& ctrl=SecularSVDCtrl<Real>() );
+
 // Note that this routine requires that 0 = d(0) <= d(1) <= ... <= d(n-1) and
 // that || z ||_2 = 1.
 template<typename Real,
@@ -303,6 +346,35 @@ struct DCCtrl
     bool exploitStructure = true;
 };
 
+struct MRRRCtrl
+{
+    // PMRRR assigns each process a contiguous block of the sorted
+    // eigenvectors. If positive, each boundary between blocks may move by up
+    // to this fraction of the nominal block size so that clusters of
+    // eigenvalues are not split across processes (at the cost of
+    // redistributing the resulting nonuniform blocks). The fraction is
+    // clipped to [0,1/2].
+    double partitionSlack=0;
+};
+
+// Bisection on Sturm counts only computes eigenvalues, but each of them is
+// isolated independently (and to high absolute accuracy), so that the
+// requested indices can be split across processes and threads.
+template<typename Real>
+struct BisectionCtrl
+{
+    // The number of threads for each process (if nonpositive, the hardware
+    // concurrency is used)
+    Int numThreads=1;
+
+    // The number of eigenvalues bisected simultaneously by each thread
+    Int batchSize=64;
+
+    // The absolute tolerance for each eigenvalue (if nonpositive, epsilon
+    // times the norm of the matrix is used)
+    Real absTol=Real(0);
+};
+
 // Cf. Section 4 of Gu and Eisenstat's "A Divide-and-Conquer Algorithm for the
 // Bidiagonal SVD" [CITATION] and LAPACK's {s,d}lasd2 [CITATION].
 //
@@ -337,7 +409,9 @@ struct HermitianTridiagEigInfo
 enum HermitianTridiagEigAlg {
   HERM_TRIDIAG_EIG_QR = 0,
   HERM_TRIDIAG_EIG_DC = 1,
-  HERM_TRIDIAG_EIG_MRRR = 2
+  HERM_TRIDIAG_EIG_MRRR = 2,
+  // Only supported when eigenvectors are not requested
+  HERM_TRIDIAG_EIG_BISECTION = 3
 };
 
 template<typename Real,
@@ -353,7 +427,8 @@ struct HermitianTridiagEigCtrl
     HermitianTridiagEigAlg alg=HERM_TRIDIAG_EIG_MRRR;
     herm_tridiag_eig::QRCtrl qrCtrl;
     herm_tridiag_eig::DCCtrl<Real> dcCtrl;
-    // TODO(poulson): MRRR ctrl
+    herm_tridiag_eig::MRRRCtrl mrrrCtrl;
+    herm_tridiag_eig::BisectionCtrl<Real> bisectCtrl;
 };
 
 // Compute eigenvalues
@@ -404,6 +479,24 @@ struct HermitianSDCCtrl
     Int maxInnerIts=2, maxOuterIts=10;
     Real tol=Real(0);
     Real spreadFactor=Real(1e-6);
+    // Use mixed-precision QDWH iterations for the sign functions
+    bool mixedPrecision=false;
+    bool progress=false;
+};
+
+// Spectrum slicing splits the range subset into 'numSlices' equal-width
+// slices (by default, one per process), counts the eigenvalues in each slice
+// using the inertia of LDL^H factorizations, and computes the eigenpairs of
+// each slice on its own subgrid using shift-and-invert subspace iteration on
+// a basis of twice the slice's eigenvalue count plus 'numGuardVectors'.
+// A tolerance of zero corresponds to n*eps (relative to || A ||_1).
+template<typename Real>
+struct HermitianSliceCtrl
+{
+    Int numSlices=0;
+    Int numGuardVectors=8;
+    Int maxIts=100;
+    Real tol=Real(0);
     bool progress=false;
 };
 
@@ -413,8 +506,10 @@ struct HermitianEigCtrl
     HermitianTridiagCtrl<Field> tridiagCtrl;
     HermitianTridiagEigCtrl<Base<Field>> tridiagEigCtrl;
     HermitianSDCCtrl<Base<Field>> sdcCtrl;
+    HermitianSliceCtrl<Base<Field>> sliceCtrl;
     bool useScaLAPACK=false;
     bool useSDC=false;
+    bool useSlicing=false;
     bool timeStages=false;
 };
 
@@ -482,8 +577,162 @@ void TwoByTwo
 
 } // namespace herm_eig
 
+// Chebyshev-filtered subspace iteration
+// -------------------------------------
+// Compute the 'numEig' smallest eigenpairs of a Hermitian matrix by
+// repeatedly applying a Chebyshev polynomial filter, which damps the part of
+// the spectrum above the basis's largest Ritz value, to a basis with
+// 'numGuardVectors' additional columns, orthonormalizing it with Cholesky QR
+// (or Householder QR if the Gram matrix is numerically singular), and
+// performing a Rayleigh-Ritz projection. All but the projected eigenproblem
+// is performed with Hemm and Gemm.
+//
+// If 'warmStart' is true, the columns of X on entry (e.g., the eigenvectors
+// computed for a nearby matrix) form the leading columns of the initial
+// basis. A value of zero for 'numGuardVectors' selects Max(numEig/4,8), and a
+// tolerance of zero corresponds to n*eps (relative to the spectral radius).
+template<typename Real>
+struct HermitianChebyshevCtrl
+{
+    Int numGuardVectors=0;
+    Int degree=10;
+    Int maxIts=100;
+    Int numLanczosSteps=20;
+    Real tol=Real(0);
+    bool warmStart=false;
+    qr::CholeskyQRVariant orthoVariant=qr::SHIFTED_CHOLESKY_QR3;
+    bool progress=false;
+};
+
+struct HermitianChebyshevInfo
+{
+    Int numIterations=0;
+    Int numConverged=0;
+};
+
+template<typename Field>
+HermitianChebyshevInfo
+HermitianChebyshevEig
+(       UpperOrLower uplo,
+  const Matrix<Field>& A,
+        Int numEig,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const HermitianChebyshevCtrl<Base<Field>>& ctrl=
+        HermitianChebyshevCtrl<Base<Field>>() );
+template<typename Field>
+HermitianChebyshevInfo
+HermitianChebyshevEig
+(       UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+        Int numEig,
+        AbstractDistMatrix<Base<Field>>& w,
+        AbstractDistMatrix<Field>& X,
+  const HermitianChebyshevCtrl<Base<Field>>& ctrl=
+        HermitianChebyshevCtrl<Base<Field>>() );
+
+// Thick-restart block Lanczos
+// ---------------------------
+// Compute the 'numEig' smallest (or, if 'largest' is true, largest)
+// eigenpairs of a Hermitian matrix with a block Lanczos process which is
+// thickly restarted (which, for Hermitian matrices, is equivalent to a
+// Krylov-Schur restart) by retaining the leading Ritz vectors whenever the
+// basis reaches 'maxBasisSize' columns. Each block of 'blocksize' vectors is
+// fully reorthogonalized against the basis with two passes of classical
+// Gram-Schmidt, so that the bulk of the work is in Gemm rather than in a
+// sequence of Gemv calls.
+//
+// A value of zero for 'blocksize' selects Min(numEig,8), a value of zero for
+// 'maxBasisSize' selects Max(2*numEig,numEig+4*blocksize), and a tolerance
+// of zero corresponds to n*eps (relative to the spectral radius). Versions
+// which only require a routine for applying the operator to a block of
+// vectors are provided in El/lapack_like/spectral/BlockLanczos.hpp.
+template<typename Real>
+struct HermitianBlockLanczosCtrl
+{
+    Int blocksize=0;
+    Int maxBasisSize=0;
+    Int maxRestarts=100;
+    Real tol=Real(0);
+    bool largest=false;
+    bool progress=false;
+};
+
+struct HermitianBlockLanczosInfo
+{
+    Int numRestarts=0;
+    Int numBlockApplications=0;
+    Int numConverged=0;
+};
+
+template<typename Field>
+HermitianBlockLanczosInfo
+HermitianBlockLanczosEig
+(       UpperOrLower uplo,
+  const Matrix<Field>& A,
+        Int numEig,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const HermitianBlockLanczosCtrl<Base<Field>>& ctrl=
+        HermitianBlockLanczosCtrl<Base<Field>>() );
+template<typename Field>
+HermitianBlockLanczosInfo
+HermitianBlockLanczosEig
+(       UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+        Int numEig,
+        AbstractDistMatrix<Base<Field>>& w,
+        AbstractDistMatrix<Field>& X,
+  const HermitianBlockLanczosCtrl<Base<Field>>& ctrl=
+        HermitianBlockLanczosCtrl<Base<Field>>() );
+
+// Low-rank updates of Hermitian eigendecompositions
+// -------------------------------------------------
+// Given the eigendecomposition A = Z diag(w) Z^H, overwrite w and Z with the
+// (ascending) eigendecomposition of A + U V U^H, where U is n x k and V is a
+// k x k Hermitian matrix (only its lower triangle is accessed). The update is
+// split into k rank-one updates using the eigenvectors of V, and each is
+// handled with the same deflation strategy as the divide-and-conquer merges
+// (cf. LAPACK's {s,d}laed{1,2,3} [CITATION]) followed by a secular
+// eigenvalue solve over the undeflated columns. Forming each projected update
+// vector costs O(n^2) and updating the eigenvectors costs a single Gemm over
+// the undeflated columns.
+template<typename Real>
+struct HermitianEigUpdateCtrl
+{
+    Real deflationFudge = Real(8);
+    SecularEVDCtrl<Real> secularCtrl;
+    bool progress=false;
+};
+
+template<typename Field>
+SecularEVDInfo
+HermitianEigUpdate
+(       Matrix<Base<Field>>& w,
+        Matrix<Field>& Z,
+  const Matrix<Field>& U,
+  const Matrix<Field>& V,
+  const HermitianEigUpdateCtrl<Base<Field>>& ctrl=
+        HermitianEigUpdateCtrl<Base<Field>>() );
+// The eigenvectors are updated in a [VC,STAR] distribution so that the only
+// communication for each rank-one update is a single reduction of the
+// projected update vector.
+template<typename Field>
+SecularEVDInfo
+HermitianEigUpdate
+(       AbstractDistMatrix<Base<Field>>& w,
+        AbstractDistMatrix<Field>& Z,
+  const AbstractDistMatrix<Field>& U,
+  const AbstractDistMatrix<Field>& V,
+  const HermitianEigUpdateCtrl<Base<Field>>& ctrl=
+        HermitianEigUpdateCtrl<Base<Field>>() );
+
 // Skew-Hermitian eigenvalue solvers
 // =================================
+// Real skew-symmetric matrices are reduced to skew-symmetric tridiagonal form
+// in real arithmetic, and only the final eigenvectors are complex; complex
+// skew-Hermitian matrices are handled via the Hermitian matrix -i G.
+//
 // Compute the full set of eigenvalues
 // -----------------------------------
 template<typename Field>
@@ -581,12 +830,88 @@ HermitianGenDefEig
         AbstractDistMatrix<Field>& X,
   const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
 
+// Reuse the Cholesky factor of B across many pencils
+// ---------------------------------------------------
+// Factor B once (e.g., the fixed overlap matrix of a self-consistent field
+// loop) so that each subsequent pencil with the same B only requires the
+// two-sided reduction of A and a standard Hermitian eigensolve.
+//
+// When A only changes slightly between calls, Refine instead improves the
+// previous generalized eigenvectors: with C the reduction of A to standard
+// form and Y the previous standard-form eigenvectors, each iteration performs
+// a Rayleigh-Ritz projection onto the span of [Y, C Y]. Since C is only
+// applied through triangular multiplications/solves and Hemm's against
+// n x 2k blocks, the reduction of A is never formed.
+template<typename Real>
+struct HermitianGenDefRefineCtrl
+{
+    Int maxIts=10;
+
+    // Stop once || C Y - Y diag(w) ||_F <= tol max_j |w(j)|
+    Real tol=Pow(limits::Epsilon<Real>(),Real(0.5));
+
+    bool progress=false;
+};
+
+template<typename Field>
+class HermitianGenDefEigSolver
+{
+public:
+    HermitianGenDefEigSolver
+    ( Pencil pencil, UpperOrLower uplo, const AbstractDistMatrix<Field>& B );
+
+    // A is overwritten with its reduction to standard form
+    HermitianEigInfo Eig
+    ( AbstractDistMatrix<Field>& A,
+      AbstractDistMatrix<Base<Field>>& w,
+      const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() ) const;
+    HermitianEigInfo Eig
+    ( AbstractDistMatrix<Field>& A,
+      AbstractDistMatrix<Base<Field>>& w,
+      AbstractDistMatrix<Field>& X,
+      const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() ) const;
+
+    // Given B-orthonormal approximations X to the generalized eigenvectors of
+    // the X.Width() smallest eigenvalues of a nearby pencil, overwrite X and w
+    // with refined eigenpairs of (A,B) and return the number of iterations
+    Int Refine
+    ( const AbstractDistMatrix<Field>& A,
+      AbstractDistMatrix<Base<Field>>& w,
+      AbstractDistMatrix<Field>& X,
+      const HermitianGenDefRefineCtrl<Base<Field>>& ctrl=
+            HermitianGenDefRefineCtrl<Base<Field>>() ) const;
+
+    // The Cholesky factor of B (stored in the 'uplo' triangle)
+    const DistMatrix<Field>& Factor() const;
+
+private:
+    Pencil pencil_;
+    UpperOrLower uplo_;
+    DistMatrix<Field> factor_;
+
+    // Map generalized eigenvectors to those of the standard form and back
+    void ToStandard( DistMatrix<Field>& X ) const;
+    void FromStandard( DistMatrix<Field>& Y ) const;
+
+    // CY := C Y
+    void ApplyReduced
+    ( const DistMatrix<Field>& A,
+      const DistMatrix<Field>& Y,
+            DistMatrix<Field>& CY ) const;
+};
+
 // Polar decomposition
 // ===================
 struct QDWHCtrl
 {
     bool colPiv=false;
     Int maxIts=20;
+
+    // Factor the Gram matrices of the Cholesky-based iterations in
+    // Demote<Field> and recover the working-precision update with iterative
+    // refinement. The Gram matrices of these iterations have condition
+    // numbers of at most 101, so only a few refinement steps are required.
+    bool mixedPrecision=false;
 };
 
 struct PolarCtrl
@@ -746,6 +1071,12 @@ struct HessenbergSchurCtrl
     Int minMultiBulgeSize = 75;
     Int minDistMultiBulgeSize = 400;
 
+    // Distributed AED windows at least this large have their Schur
+    // decompositions computed in parallel on a subgrid (with roughly a
+    // minDistMultiBulgeSize x minDistMultiBulgeSize block per process) rather
+    // than on a single process
+    Int minDistAEDSize = 1000;
+
     function<Int(Int,Int)> numShifts =
       function<Int(Int,Int)>(hess_schur::aed::NumShifts);
 
@@ -811,6 +1142,51 @@ void Sweep
 
 } // namespace hess_schur
 
+// Batched Hessenberg Schur decompositions
+// ---------------------------------------
+// Overwrite each n x n upper Hessenberg member of a batch with its Schur
+// form, where member b of H begins at H[b*HStride], its eigenvalues at
+// w[b*wStride], and its Schur vectors at Z[b*ZStride]. The members are
+// processed in parallel with OpenMP. The returned number of unconverged
+// eigenvalues is summed over the batch, while the number of iterations is
+// the maximum over the batch.
+template<typename Field>
+HessenbergSchurInfo
+BatchedHessenbergSchur
+( Int n,
+  Field* H, Int HLDim, Int HStride,
+  Complex<Base<Field>>* w, Int wStride,
+  Int batchSize,
+  const HessenbergSchurCtrl& ctrl=HessenbergSchurCtrl() );
+template<typename Field>
+HessenbergSchurInfo
+BatchedHessenbergSchur
+( Int n,
+  Field* H, Int HLDim, Int HStride,
+  Complex<Base<Field>>* w, Int wStride,
+  Field* Z, Int ZLDim, Int ZStride,
+  Int batchSize,
+  const HessenbergSchurCtrl& ctrl=HessenbergSchurCtrl() );
+
+// The batch is distributed over the processes by storing the members side by
+// side in an n x (n batchSize) matrix H with a distribution block width of n
+// (and, likewise, Z), and their eigenvalues in the columns of an
+// n x batchSize matrix w with a distribution block width of one, so that
+// each process handles its local members with the above routines.
+template<typename Field>
+HessenbergSchurInfo
+BatchedHessenbergSchur
+( DistMatrix<Field,STAR,VR,BLOCK>& H,
+  DistMatrix<Complex<Base<Field>>,STAR,VR,BLOCK>& w,
+  const HessenbergSchurCtrl& ctrl=HessenbergSchurCtrl() );
+template<typename Field>
+HessenbergSchurInfo
+BatchedHessenbergSchur
+( DistMatrix<Field,STAR,VR,BLOCK>& H,
+  DistMatrix<Complex<Base<Field>>,STAR,VR,BLOCK>& w,
+  DistMatrix<Field,STAR,VR,BLOCK>& Z,
+  const HessenbergSchurCtrl& ctrl=HessenbergSchurCtrl() );
+
 // Schur decomposition
 // ===================
 // Forward declaration
@@ -833,6 +1209,7 @@ template<typename Real>
 struct SchurCtrl
 {
     bool useSDC=false;
+    HessenbergCtrl hessCtrl;
     HessenbergSchurCtrl hessSchurCtrl;
     SDCCtrl<Real> sdcCtrl;
     bool time=false;
@@ -945,6 +1322,137 @@ void TwoByTwo
 
 } // namespace schur
 
+// Hessenberg QZ decomposition
+// ===========================
+// Compute the generalized Schur form (S,T) = (Q^H H Z, Q^H T Z) of a complex
+// upper Hessenberg-triangular pencil (H,T), overwriting H with the upper
+// triangular matrix S and T with an upper-triangular matrix with a real,
+// non-negative diagonal. The generalized eigenvalues are alpha(j) / beta(j),
+// where beta(j) = 0 corresponds to an infinite eigenvalue.
+struct HessenbergQZInfo
+{
+    Int numUnconverged=0;
+    Int numIterations=0;
+};
+
+enum HessenbergQZAlg {
+  HESSENBERG_QZ_AED=0,
+  HESSENBERG_QZ_SIMPLE=1
+};
+
+struct HessenbergQZCtrl
+{
+    Int winBeg=0;
+    Int winEnd=END;
+    bool fullTriangle=true;
+    bool wantSchurVecs=false;
+    bool accumulateSchurVecs=false;
+    bool demandConverged=true;
+
+    HessenbergQZAlg alg=HESSENBERG_QZ_AED;
+
+    bool progress=false;
+
+    // Cf. LAPACK's IPARMQ for this choice
+    Int minMultiBulgeSize = 75;
+
+    // The shift and deflation window heuristics are shared with the
+    // Hessenberg QR algorithm
+    function<Int(Int,Int)> numShifts =
+      function<Int(Int,Int)>(hess_schur::aed::NumShifts);
+
+    function<Int(Int,Int,Int)> deflationSize =
+      function<Int(Int,Int,Int)>(hess_schur::aed::DeflationSize);
+
+    function<Int(Int)> sufficientDeflation =
+      function<Int(Int)>(hess_schur::aed::SufficientDeflation);
+};
+
+// Only complex pencils are currently supported
+template<typename Field>
+HessenbergQZInfo
+HessenbergQZ
+( Matrix<Field>& H,
+  Matrix<Field>& T,
+  Matrix<Field>& alpha,
+  Matrix<Field>& beta,
+  const HessenbergQZCtrl& ctrl=HessenbergQZCtrl() );
+template<typename Field>
+HessenbergQZInfo
+HessenbergQZ
+( Matrix<Field>& H,
+  Matrix<Field>& T,
+  Matrix<Field>& alpha,
+  Matrix<Field>& beta,
+  Matrix<Field>& Q,
+  Matrix<Field>& Z,
+  const HessenbergQZCtrl& ctrl=HessenbergQZCtrl() );
+
+// The QZ iteration is performed redundantly on [STAR,STAR] copies of the
+// pencil while each process only updates its own rows of the [VC,STAR]
+// Schur vectors
+template<typename Field>
+HessenbergQZInfo
+HessenbergQZ
+( AbstractDistMatrix<Field>& H,
+  AbstractDistMatrix<Field>& T,
+  AbstractDistMatrix<Field>& alpha,
+  AbstractDistMatrix<Field>& beta,
+  const HessenbergQZCtrl& ctrl=HessenbergQZCtrl() );
+template<typename Field>
+HessenbergQZInfo
+HessenbergQZ
+( AbstractDistMatrix<Field>& H,
+  AbstractDistMatrix<Field>& T,
+  AbstractDistMatrix<Field>& alpha,
+  AbstractDistMatrix<Field>& beta,
+  AbstractDistMatrix<Field>& Q,
+  AbstractDistMatrix<Field>& Z,
+  const HessenbergQZCtrl& ctrl=HessenbergQZCtrl() );
+
+// Generalized Schur decomposition
+// ===============================
+// Compute the generalized Schur form (S,T) = (Q^H A Z, Q^H B Z) of a complex
+// pencil (A,B) by reducing it to Hessenberg-triangular form and then running
+// the QZ algorithm
+template<typename Field>
+HessenbergQZInfo
+GeneralizedSchur
+( Matrix<Field>& A,
+  Matrix<Field>& B,
+  Matrix<Field>& alpha,
+  Matrix<Field>& beta,
+  const HessenbergQZCtrl& ctrl=HessenbergQZCtrl() );
+template<typename Field>
+HessenbergQZInfo
+GeneralizedSchur
+( Matrix<Field>& A,
+  Matrix<Field>& B,
+  Matrix<Field>& alpha,
+  Matrix<Field>& beta,
+  Matrix<Field>& Q,
+  Matrix<Field>& Z,
+  const HessenbergQZCtrl& ctrl=HessenbergQZCtrl() );
+
+template<typename Field>
+HessenbergQZInfo
+GeneralizedSchur
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& B,
+  AbstractDistMatrix<Field>& alpha,
+  AbstractDistMatrix<Field>& beta,
+  const HessenbergQZCtrl& ctrl=HessenbergQZCtrl() );
+template<typename Field>
+HessenbergQZInfo
+GeneralizedSchur
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& B,
+  AbstractDistMatrix<Field>& alpha,
+  AbstractDistMatrix<Field>& beta,
+  AbstractDistMatrix<Field>& Q,
+  AbstractDistMatrix<Field>& Z,
+  const HessenbergQZCtrl& ctrl=HessenbergQZCtrl() );
+
 // Compute eigenvectors of a triangular matrix
 // ===========================================
 template<typename Field>
@@ -990,7 +1498,18 @@ enum SVDApproach
   // When thresholded, a cross-product algorithm is used. This is often
   // advantageous since tridiagonal eigensolvers tend to have faster
   // parallel implementations than bidiagonal SVD's.
-  PRODUCT_SVD
+  PRODUCT_SVD,
+
+  // Compute the thin SVD with a one-sided block Jacobi method applied to the
+  // adjoint of the R factor from a (tall-skinny) QR factorization. Only
+  // supported by SVD, not BidiagSVD.
+  JACOBI_SVD,
+
+  // Compute the thin SVD from the QDWH polar decomposition A = W H followed
+  // by the Hermitian eigendecomposition H = V Sigma V^H, so that U = W V.
+  // Nearly all of the work is in QR, Cholesky, and Gemm. Only supported by
+  // SVD, not BidiagSVD.
+  QDWH_SVD
 };
 
 enum SingularValueToleranceType
@@ -1057,6 +1576,14 @@ struct DCInfo
     SecularSVDInfo secularInfo;
 };
 
+struct DQDSInfo
+{
+    // The number of accepted dqds transforms and the number of shifts which
+    // were rejected (and retried) due to rounding errors
+    Int numSweeps=0;
+    Int numRejectedShifts=0;
+};
+
 template<typename Real>
 struct DCCtrl
 {
@@ -1073,6 +1600,12 @@ struct DCCtrl
     // singular vectors with the outer singular vectors? This should only be
     // disabled for academic reasons.
     bool exploitStructure = true;
+
+    // If greater than one, the two subproblems of each split are solved
+    // concurrently, with the threads divided between them. (The distributed
+    // algorithm instead splits the grid, and applies this to the subtrees
+    // which are owned by a single process.)
+    Int numThreads = 1;
 };
 
 // Cf. Section 4 of Gu and Eisenstat's "A Divide-and-Conquer Algorithm for the
@@ -1118,6 +1651,7 @@ struct BidiagSVDInfo
 {
     bidiag_svd::QRInfo qrInfo;
     bidiag_svd::DCInfo dcInfo;
+    bidiag_svd::DQDSInfo dqdsInfo;
 };
 
 template<typename Real>
@@ -1135,6 +1669,11 @@ struct BidiagSVDCtrl
     bool useQR=false;
     bidiag_svd::QRCtrl qrCtrl;
     bidiag_svd::DCCtrl<Real> dcCtrl;
+
+    // When only the singular values are requested, compute them with dqds
+    // (falling back to the implicit QR iteration if a diagonal entry is
+    // exactly zero or dqds fails to converge) rather than with QR
+    bool useDQDS=true;
 };
 
 namespace bidiag_svd {
@@ -1212,6 +1751,8 @@ BidiagSVD
 struct SVDInfo
 {
     BidiagSVDInfo bidiagSVDInfo;
+    Int numJacobiSweeps=0;
+    QDWHInfo qdwhInfo;
 };
 
 template<typename Real>
@@ -1237,6 +1778,27 @@ struct SVDCtrl
     // decomposition when computing a full SVD
     double fullChanRatio=1.5;
 
+    // Bidiagonalize in two stages (via a band matrix of the given width, or
+    // Blocksize() if nonpositive) when only computing singular values
+    bool twoStageBidiag=false;
+    Int bidiagBandwidth=0;
+
+    // One-sided block Jacobi (JACOBI_SVD)
+    // -----------------------------------
+
+    // The width of the column blocks (Blocksize() if nonpositive)
+    Int jacobiBlocksize=0;
+    Int jacobiMaxSweeps=30;
+
+    // Columns i and j are considered orthogonal once
+    // |a_i^H a_j| <= jacobiTol || a_i ||_2 || a_j ||_2. A tolerance of zero
+    // corresponds to sqrt(n) eps.
+    Real jacobiTol=Real(0);
+
+    // QDWH-based polar decomposition (QDWH_SVD)
+    // -----------------------------------------
+    QDWHCtrl qdwhCtrl;
+
     BidiagSVDCtrl<Real> bidiagSVDCtrl;
 };
 
@@ -1355,8 +1917,199 @@ SVDInfo TSQR
         AbstractDistMatrix<Base<Field>>& s,
         AbstractDistMatrix<Field>& V );
 
+// Only compute the singular values and right singular vectors, so that U is
+// left implicit as A V inv(Sigma) (see StreamingTSQR::LeftSingularVectors)
+template<typename Field>
+SVDInfo TSQR
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V );
+
+// Streaming tall-skinny SVD
+// -------------------------
+// The m x n matrix A, with m >= n, is fed in as consecutive blocks of rows
+// which are never stored. Each process factors the rows it receives and
+// merges the resulting triangles as in a binary counter (so that each row
+// passes through O(log(numBlocks)) merges) without any communication, and
+// Finalize then combines the local triangles with TSQR. The singular values
+// and right singular vectors of A are those of the final R, and the rows of
+// U = A V inv(Sigma) corresponding to a row block can be recomputed on
+// demand during a second pass over A.
+template<typename Field>
+class StreamingTSQR
+{
+public:
+    StreamingTSQR( Int width, const Grid& grid=Grid::Default() );
+
+    // A := [A; W]
+    void AddRows( const AbstractDistMatrix<Field>& W );
+    // Append rows that are only held by this process; their position
+    // relative to the rows of other processes is irrelevant
+    void AddLocalRows( const Matrix<Field>& WLoc );
+
+    // Collectively form R and its SVD. No rows may be added afterwards.
+    SVDInfo Finalize();
+
+    Int Height() const;
+    Int Width() const;
+    bool Finalized() const;
+
+    const DistMatrix<Field,STAR,STAR>& R() const;
+    const DistMatrix<Base<Field>,STAR,STAR>& SingularValues() const;
+    const DistMatrix<Field,STAR,STAR>& RightSingularVectors() const;
+
+    // UW := W V pinv(Sigma), the rows of U corresponding to the rows W of A.
+    // Columns associated with zero singular values are set to zero.
+    void LeftSingularVectors
+    ( const AbstractDistMatrix<Field>& W,
+            AbstractDistMatrix<Field>& UW ) const;
+    void LeftSingularVectors
+    ( const Matrix<Field>& WLoc, Matrix<Field>& UWLoc ) const;
+
+private:
+    Int width_;
+    Int localHeight_=0, height_=0;
+    bool finalized_=false;
+
+    // levels_[k] is either empty or the triangular factor of 2^k blocks
+    vector<Matrix<Field>> levels_;
+
+    DistMatrix<Field,STAR,STAR> R_, V_;
+    DistMatrix<Base<Field>,STAR,STAR> s_, sInv_;
+
+    void Push( Matrix<Field>& T );
+};
+
 } // namespace svd
 
+// Randomized truncated SVD
+// ========================
+// Cf. Halko, Martinsson, and Tropp's "Finding structure with randomness:
+// Probabilistic algorithms for constructing approximate matrix
+// decompositions". An orthonormal basis Q for the range of A A^H A ... A
+// (with 'numPowerIts' applications of A A^H) is computed from a sketch
+// A Omega with rank+oversampling columns, and the SVD of the small matrix
+// Q^H A then yields the leading 'rank' singular triplets of A.
+
+enum RandomizedSketchType
+{
+  // Omega is Gaussian
+  GAUSSIAN_SKETCH,
+  // Omega is a subsampled randomized Hadamard transform, D H S, where D is a
+  // random diagonal sign matrix, H is a (zero-padded) Walsh-Hadamard matrix,
+  // and S selects random columns. The sketch is formed with a fast
+  // Walsh-Hadamard transform of the rows of A at O(m n log(n)) cost. The
+  // distributed implementation redistributes A into a [VC,STAR] matrix.
+  SRHT_SKETCH,
+  // Omega has independent random signs
+  RADEMACHER_SKETCH,
+  // Each row of Omega has 'sparsity' nonzeros, +-1/sqrt(sparsity), in random
+  // columns (a sparse sign embedding), and so A Omega costs O(m n sparsity)
+  SPARSE_SIGN_SKETCH
+};
+
+// An implicit n x k sketching operator, Omega, of the given type, whose
+// entries are generated on the fly from the counter-based generator (see
+// CounterBasedUniforms) whenever it is applied, so that it is never stored.
+// Each operator is keyed by the seed and the next stream index at the time of
+// its construction; it is therefore identical on every process grid, and on
+// every process that constructs the same sequence of operators and
+// counter-based random fills.
+template<typename Field>
+class SketchOperator
+{
+public:
+    SketchOperator
+    ( RandomizedSketchType type, Int height, Int width, Int sparsity=8 );
+
+    // Y := alpha A Omega + beta Y in a single pass over the columns of A, of
+    // which only a block of the corresponding rows of Omega is generated at
+    // a time. The distributed (non-SRHT) application sums the local
+    // contributions of an [MC,MR] copy of A into an [MC,STAR] matrix.
+    void Apply
+    ( Field alpha, const Matrix<Field>& A,
+      Field beta,        Matrix<Field>& Y ) const;
+    void Apply
+    ( Field alpha, const AbstractDistMatrix<Field>& A,
+      Field beta,        AbstractDistMatrix<Field>& Y ) const;
+
+    // Y := A Omega
+    void Apply( const Matrix<Field>& A, Matrix<Field>& Y ) const;
+    void Apply
+    ( const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& Y ) const;
+
+    // Explicitly form Omega (entry by entry rather than through Apply)
+    void Form( Matrix<Field>& Omega ) const;
+
+    RandomizedSketchType Type() const;
+    Int Height() const;
+    Int Width() const;
+
+private:
+    RandomizedSketchType type_;
+    Int height_, width_, sparsity_;
+    unsigned long long seed_, stream_;
+
+    // The order of the Hadamard matrix and the sampled columns of an SRHT
+    Int hadamardOrder_=0;
+    vector<Int> samples_;
+
+    // Z := A Omega(colShift:colStride:end,:), where Z is zero on entry
+    void LocalApply
+    ( const Matrix<Field>& A, Int colShift, Int colStride,
+      Matrix<Field>& Z ) const;
+};
+
+template<typename Real>
+struct RandomizedSVDCtrl
+{
+    Int oversampling=10;
+    Int numPowerIts=1;
+    RandomizedSketchType sketch=GAUSSIAN_SKETCH;
+    // The number of nonzeros per row of a SPARSE_SIGN_SKETCH
+    Int sketchSparsity=8;
+
+    // Used for the SVD of the small projected matrix
+    SVDCtrl<Real> svdCtrl;
+};
+
+// Return a matrix with orthonormal columns whose span approximately contains
+// the 'rank' leading left singular vectors of A
+template<typename Field>
+void RandomizedRangeFinder
+( const Matrix<Field>& A,
+        Int rank,
+        Matrix<Field>& Q,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl=
+        RandomizedSVDCtrl<Base<Field>>() );
+template<typename Field>
+void RandomizedRangeFinder
+( const AbstractDistMatrix<Field>& A,
+        Int rank,
+        AbstractDistMatrix<Field>& Q,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl=
+        RandomizedSVDCtrl<Base<Field>>() );
+
+// Approximate the 'rank' leading singular triplets of A
+template<typename Field>
+SVDInfo RandomizedSVD
+( const Matrix<Field>& A,
+        Int rank,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl=
+        RandomizedSVDCtrl<Base<Field>>() );
+template<typename Field>
+SVDInfo RandomizedSVD
+( const AbstractDistMatrix<Field>& A,
+        Int rank,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl=
+        RandomizedSVDCtrl<Base<Field>>() );
+
 // Hermitian SVD
 // =============
 
@@ -1420,10 +2173,65 @@ void HermitianSVD
         AbstractDistMatrix<Base<Field>>& s,
         AbstractDistMatrix<Field>& V );
 
+// Rank-revealing factorization
+// ============================
+// Compute A ~= U T W^H, where U and W have r orthonormal columns, T is r x r
+// and upper-triangular, and r is the numerical rank of A.
+
+enum RankRevealApproach
+{
+  // T is the diagonal matrix of singular values from a compact SVD of A
+  RANK_REVEAL_SVD,
+  // RandomizedSVD with a guess of the rank which is doubled until a
+  // singular value falls below the tolerance, so that the cost is
+  // proportional to the numerical rank rather than to min(m,n)
+  RANK_REVEAL_RANDOMIZED_SVD,
+  // Randomized column-pivoted QR (HQRRP) which stops as soon as a diagonal
+  // entry of R falls below the tolerance, A P = Q [R11 R12; 0 ~0], followed
+  // by a URV refinement, [R11 R12] = [0 T] Z, so that U is the leading r
+  // columns of Q and W is the trailing r columns of P Z^H
+  RANK_REVEAL_RANDOMIZED_URV
+};
+
+template<typename Real>
+struct RankRevealCtrl
+{
+    RankRevealApproach approach=RANK_REVEAL_SVD;
+
+    // Singular values (or, for the URV approach, diagonal entries of R) which
+    // are at most 'tol' times the largest singular value (or column norm)
+    // are treated as zero. If zero, max(m,n) eps is used.
+    Real tol=Real(0);
+
+    // The initial guess of the rank for RANK_REVEAL_RANDOMIZED_SVD; if
+    // nonpositive, Blocksize() is used
+    Int rankGuess=0;
+
+    // The oversampling, power iterations, and sketch of the randomized
+    // approaches (the URV approach only makes use of the oversampling)
+    RandomizedSVDCtrl<Real> randomizedCtrl;
+};
+
+// Returns the numerical rank, r
+template<typename Field>
+Int RankReveal
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Field>& T,
+        Matrix<Field>& W,
+  const RankRevealCtrl<Base<Field>>& ctrl=RankRevealCtrl<Base<Field>>() );
+template<typename Field>
+Int RankReveal
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Field>& T,
+        AbstractDistMatrix<Field>& W,
+  const RankRevealCtrl<Base<Field>>& ctrl=RankRevealCtrl<Base<Field>>() );
+
 // Image and kernel
 // ================
-// Return orthonormal bases for the image and/or kernel of a matrix
-// TODO(poulson): Provide support for various algorithms (e.g., RRQR vs. SVD)
+// Return orthonormal bases for the image and/or kernel of a matrix. The
+// variants without a control structure use an SVD.
 
 template<typename Field>
 void ImageAndKernel
@@ -1454,6 +2262,41 @@ void Kernel
 ( const AbstractDistMatrix<Field>& A,
         AbstractDistMatrix<Field>& K );
 
+template<typename Field>
+void ImageAndKernel
+( const Matrix<Field>& A,
+        Matrix<Field>& M,
+        Matrix<Field>& K,
+  const RankRevealCtrl<Base<Field>>& ctrl );
+template<typename Field>
+void ImageAndKernel
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& M,
+        AbstractDistMatrix<Field>& K,
+  const RankRevealCtrl<Base<Field>>& ctrl );
+
+template<typename Field>
+void Image
+( const Matrix<Field>& A,
+        Matrix<Field>& M,
+  const RankRevealCtrl<Base<Field>>& ctrl );
+template<typename Field>
+void Image
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& M,
+  const RankRevealCtrl<Base<Field>>& ctrl );
+
+template<typename Field>
+void Kernel
+( const Matrix<Field>& A,
+        Matrix<Field>& K,
+  const RankRevealCtrl<Base<Field>>& ctrl );
+template<typename Field>
+void Kernel
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& K,
+  const RankRevealCtrl<Base<Field>>& ctrl );
+
 
 // Pseudospectra
 // =============
@@ -1475,6 +2318,12 @@ struct SnapshotCtrl
     FileFormat imgFormat=PNG, numFormat=ASCII_MATLAB;
     bool itCounts=true;
 
+    // Numerical snapshots may be written in the background (see WriteAsync)
+    // while the iteration continues; each snapshot first waits for the
+    // writes of the previous one so that at most one set is outstanding
+    bool asyncNumSave=false;
+    vector<std::shared_future<void>> pendingNumSaves;
+
     void ResetCounts()
     {
         imgSaveCount = 0;
@@ -1487,6 +2336,12 @@ struct SnapshotCtrl
         ++numSaveCount;
         ++imgDispCount;
     }
+    void WaitForNumSaves()
+    {
+        for( auto& save : pendingNumSaves )
+            save.get();
+        pendingNumSaves.clear();
+    }
 };
 
 template<typename Real>
@@ -1512,6 +2367,26 @@ struct PseudospecCtrl
     Int basisSize=10;
     bool reorthog=true; // only matters for IRL, which isn't currently used
 
+    // If numSubgrids > 1, the processes of a distributed problem are split
+    // into that many subgrids, each of which receives a copy of the
+    // (quasi-)triangular or Hessenberg matrix and is dynamically handed
+    // chunks of 'chunkSize' shifts as it becomes idle. A chunk size of zero
+    // selects roughly a quarter of each subgrid's share of the shifts.
+    Int numSubgrids=1;
+    Int chunkSize=0;
+
+    // If adaptive is true, spectral windows and portraits are first sampled
+    // on a lattice of pixels spaced 'adaptiveStride' apart, and only the
+    // cells whose corner values of log10(epsilon) straddle one of the
+    // 'contours' (every integer if none are given) are recursively bisected;
+    // the remaining pixels are interpolated and assigned zero iterations.
+    // NOTE: The general (non-triangular) SpectralWindow recomputes its Schur
+    //       decomposition for each level of refinement, whereas the portraits
+    //       only reduce once.
+    bool adaptive=false;
+    Int adaptiveStride=16;
+    vector<Real> contours;
+
     // Whether or not to print progress information at each iteration
     bool progress=false;
 
@@ -1920,5 +2795,6 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
 #include <El/lapack_like/spectral/SVD.hpp>
 #include <El/lapack_like/spectral/Lanczos.hpp>
 #include <El/lapack_like/spectral/ProductLanczos.hpp>
+#include <El/lapack_like/spectral/BlockLanczos.hpp>
 
 #endif // ifndef EL_SPECTRAL_HPP
@@ -0,0 +1,330 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SPECTRAL_BLOCK_LANCZOS_HPP
+#define EL_SPECTRAL_BLOCK_LANCZOS_HPP
+
+namespace El {
+
+// Thick-restart block Lanczos for the extremal eigenpairs of a Hermitian
+// operator which is only available through a routine of the form
+//
+//   applyA( X, Y ),
+//
+// which should overwrite Y with A X (Y is passed in with the same
+// distribution and alignment as X, which should be preserved).
+//
+// The basis V is stored in a single matrix which is a DistMatrix<Field,VC,STAR>
+// in the distributed case, so that each pass of classical Gram-Schmidt is a
+// local Gemm followed by a single summation of the (small) matrix of
+// coefficients. Every process redundantly forms and diagonalizes the
+// projected matrix T = V^H A V, whose lower triangle is built from the
+// Gram-Schmidt coefficients of each expansion and hence, after a restart,
+// automatically picks up the coupling between the retained Ritz vectors and
+// the residual block.
+
+namespace block_lanczos {
+
+template<typename Real>
+void BasisSizes
+( Int n,
+  Int numEig,
+  const HermitianBlockLanczosCtrl<Real>& ctrl,
+  Int& blocksize,
+  Int& maxBasisSize )
+{
+    blocksize =
+      ( ctrl.blocksize > 0 ? ctrl.blocksize : Min(numEig,Int(8)) );
+    maxBasisSize =
+      ( ctrl.maxBasisSize > 0 ?
+        ctrl.maxBasisSize : Max(2*numEig,numEig+4*blocksize) );
+    maxBasisSize = Min( maxBasisSize, n-blocksize );
+    if( maxBasisSize < numEig+2*blocksize )
+        LogicError
+        ("A basis of at most ",maxBasisSize," vectors is too small for ",
+         numEig," eigenpairs with a blocksize of ",blocksize);
+}
+
+// H := V^H W
+template<typename F>
+void Project( const Matrix<F>& V, const Matrix<F>& W, Matrix<F>& H )
+{ Gemm( ADJOINT, NORMAL, F(1), V, W, H ); }
+
+template<typename F>
+void Project
+( const DistMatrix<F,VC,STAR>& V,
+  const DistMatrix<F,VC,STAR>& W,
+        Matrix<F>& H )
+{
+    Gemm( ADJOINT, NORMAL, F(1), V.LockedMatrix(), W.LockedMatrix(), H );
+    mpi::AllReduce( H.Buffer(), H.Height()*H.Width(), V.ColComm() );
+}
+
+// W := W - V H
+template<typename F>
+void Subtract( const Matrix<F>& V, const Matrix<F>& H, Matrix<F>& W )
+{ Gemm( NORMAL, NORMAL, F(-1), V, H, F(1), W ); }
+
+template<typename F>
+void Subtract
+( const DistMatrix<F,VC,STAR>& V,
+  const Matrix<F>& H,
+        DistMatrix<F,VC,STAR>& W )
+{ Gemm( NORMAL, NORMAL, F(-1), V.LockedMatrix(), H, F(1), W.Matrix() ); }
+
+// X := V Y
+template<typename F>
+void Combine( const Matrix<F>& V, const Matrix<F>& Y, Matrix<F>& X )
+{ Gemm( NORMAL, NORMAL, F(1), V, Y, X ); }
+
+template<typename F>
+void Combine
+( const DistMatrix<F,VC,STAR>& V,
+  const Matrix<F>& Y,
+        DistMatrix<F,VC,STAR>& X )
+{
+    X.AlignWith( V );
+    X.Resize( V.Height(), Y.Width() );
+    Gemm( NORMAL, NORMAL, F(1), V.LockedMatrix(), Y, X.Matrix() );
+}
+
+// W := Q, where W = Q R
+template<typename F>
+void Orthonormalize( Matrix<F>& W, Matrix<F>& R )
+{ qr::Explicit( W, R ); }
+
+template<typename F>
+void Orthonormalize( DistMatrix<F,VC,STAR>& W, Matrix<F>& R )
+{
+    const Grid& g = W.Grid();
+    DistMatrix<F,STAR,STAR> RDist(g);
+    if( W.Height() >= g.Size()*W.Width() )
+        qr::ExplicitTS( W, RDist );
+    else
+        qr::Explicit( W, RDist );
+    R = RDist.Matrix();
+}
+
+// Orthogonalize W against the orthonormal columns of V with two passes of
+// classical Gram-Schmidt and return the accumulated coefficients in H
+template<typename F,class BasisType>
+void CGS2( const BasisType& V, BasisType& W, Matrix<F>& H )
+{
+    EL_DEBUG_CSE
+    Matrix<F> HCorr;
+    Project( V, W, H );
+    Subtract( V, H, W );
+    Project( V, W, HCorr );
+    Subtract( V, HCorr, W );
+    H += HCorr;
+}
+
+// Given A V(:,0:p) = V(:,0:p+b) T(0:p+b,0:p), apply A to the block
+// V(:,p:p+b) and extend the decomposition by one block. Only the lower
+// triangle of T is maintained.
+template<typename F,class BasisType,class ApplyAType>
+void Expand
+( const ApplyAType& applyA,
+        BasisType& V,
+        BasisType& W,
+        Matrix<F>& T,
+        Int p,
+        Int b )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    auto VActive = V( ALL, IR(0,p+b) );
+    auto Vp = V( ALL, IR(p,p+b) );
+    applyA( Vp, W );
+
+    Matrix<F> H, R;
+    CGS2( VActive, W, H );
+    Orthonormalize( W, R );
+
+    // If the block was (nearly) rank-deficient, then the trailing columns of
+    // Q are dominated by rounding errors and need not be orthogonal to V. We
+    // then write Q = Q2 R2 + V C and fold C R into H and R2 R into R.
+    Real minDiag = limits::Max<Real>();
+    for( Int j=0; j<b; ++j )
+        minDiag = Min( minDiag, Abs(R(j,j)) );
+    if( minDiag <= Sqrt(eps)*(FrobeniusNorm(H)+FrobeniusNorm(R)) )
+    {
+        Matrix<F> C, R2, RNew;
+        CGS2( VActive, W, C );
+        Orthonormalize( W, R2 );
+        Gemm( NORMAL, NORMAL, F(1), C, R, F(1), H );
+        Gemm( NORMAL, NORMAL, F(1), R2, R, RNew );
+        R = RNew;
+    }
+
+    Matrix<F> HAdj;
+    Adjoint( H(IR(0,p),ALL), HAdj );
+    auto TRow = T( IR(p,p+b), IR(0,p) );
+    auto TDiag = T( IR(p,p+b), IR(p,p+b) );
+    auto TBelow = T( IR(p+b,p+2*b), IR(p,p+b) );
+    TRow = HAdj;
+    TDiag = H( IR(p,p+b), ALL );
+    TBelow = R;
+
+    auto VNext = V( ALL, IR(p+b,p+2*b) );
+    VNext = W;
+}
+
+template<typename F,class BasisType,class ApplyAType>
+HermitianBlockLanczosInfo
+Solve
+( const ApplyAType& applyA,
+        BasisType& V,
+        BasisType& W,
+        BasisType& X,
+        Int numEig,
+        Matrix<Base<F>>& w,
+  const HermitianBlockLanczosCtrl<Base<F>>& ctrl,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = V.Height();
+    HermitianBlockLanczosInfo info;
+    Int b, m;
+    BasisSizes( n, numEig, ctrl, b, m );
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( ctrl.tol > Real(0) ? ctrl.tol : n*eps );
+
+    HermitianEigCtrl<F> eigCtrl;
+    eigCtrl.tridiagEigCtrl.sort = ( ctrl.largest ? DESCENDING : ASCENDING );
+
+    // Start from a random orthonormal block
+    Matrix<F> T, TActive, Y, S, R;
+    Matrix<Real> theta, residNorms;
+    Zeros( T, m+b, m+b );
+    V.Resize( n, m+b );
+    Gaussian( W, n, b );
+    Orthonormalize( W, R );
+    auto V0 = V( ALL, IR(0,b) );
+    V0 = W;
+
+    Int p = 0;
+    while( true )
+    {
+        while( p+b <= m )
+        {
+            Expand( applyA, V, W, T, p, b );
+            ++info.numBlockApplications;
+            p += b;
+        }
+
+        // Rayleigh-Ritz with T(0:p,0:p) = Y diag(theta) Y^H. The residual of
+        // the i'th Ritz pair is V(:,p:p+b) T(p:p+b,p-b:p) Y(p-b:p,i).
+        TActive = T( IR(0,p), IR(0,p) );
+        HermitianEig( LOWER, TActive, theta, Y, eigCtrl );
+        Gemm
+        ( NORMAL, NORMAL, F(1),
+          T(IR(p,p+b),IR(p-b,p)), Y(IR(p-b,p),ALL), S );
+        ColumnTwoNorms( S, residNorms );
+        const Real spectralRadius = Max( Abs(theta(0)), Abs(theta(p-1)) );
+        info.numConverged = 0;
+        for( Int i=0; i<numEig; ++i )
+            if( residNorms(i) <= tol*spectralRadius )
+                ++info.numConverged;
+        if( progress )
+            Output
+            ("restart ",info.numRestarts,": ",info.numConverged," of ",
+             numEig," converged");
+        if( info.numConverged == numEig ||
+            info.numRestarts == ctrl.maxRestarts )
+            break;
+
+        // Retain the leading Ritz vectors and the residual block
+        const Int numKeep = Min( numEig+(p-numEig)/2, p-b );
+        auto VActive = V( ALL, IR(0,p) );
+        Combine( VActive, Y(ALL,IR(0,numKeep)), X );
+        auto VKeep = V( ALL, IR(0,numKeep) );
+        auto VResid = V( ALL, IR(p,p+b) );
+        auto VNext = V( ALL, IR(numKeep,numKeep+b) );
+        VKeep = X;
+        VNext = VResid;
+        Zero( T );
+        for( Int i=0; i<numKeep; ++i )
+            T(i,i) = theta(i);
+        p = numKeep;
+        ++info.numRestarts;
+    }
+
+    auto VActive = V( ALL, IR(0,p) );
+    Combine( VActive, Y(ALL,IR(0,numEig)), X );
+    w = theta( IR(0,numEig), ALL );
+    return info;
+}
+
+} // namespace block_lanczos
+
+template<typename Field,class ApplyAType>
+HermitianBlockLanczosInfo
+HermitianBlockLanczosEig
+(       Int n,
+  const ApplyAType& applyA,
+        Int numEig,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const HermitianBlockLanczosCtrl<Base<Field>>& ctrl=
+        HermitianBlockLanczosCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    if( numEig < 0 || numEig > n )
+        LogicError("Cannot compute ",numEig," eigenpairs of an ",n," x ",n,
+                   " operator");
+    if( numEig == 0 )
+    {
+        w.Resize( 0, 1 );
+        X.Resize( n, 0 );
+        return HermitianBlockLanczosInfo();
+    }
+    Matrix<Field> V, W;
+    V.Resize( n, 0 );
+    return block_lanczos::Solve<Field>
+      ( applyA, V, W, X, numEig, w, ctrl, ctrl.progress );
+}
+
+template<typename Field,class ApplyAType>
+HermitianBlockLanczosInfo
+HermitianBlockLanczosEig
+( const Grid& grid,
+        Int n,
+  const ApplyAType& applyA,
+        Int numEig,
+        DistMatrix<Base<Field>,STAR,STAR>& w,
+        DistMatrix<Field,VC,STAR>& X,
+  const HermitianBlockLanczosCtrl<Base<Field>>& ctrl=
+        HermitianBlockLanczosCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    if( numEig < 0 || numEig > n )
+        LogicError("Cannot compute ",numEig," eigenpairs of an ",n," x ",n,
+                   " operator");
+    if( numEig == 0 )
+    {
+        w.Resize( 0, 1 );
+        X.Resize( n, 0 );
+        return HermitianBlockLanczosInfo();
+    }
+    DistMatrix<Field,VC,STAR> V(grid), W(grid), XTmp(grid);
+    V.Resize( n, 0 );
+    W.AlignWith( V );
+    w.Resize( numEig, 1 );
+    const bool progress = ctrl.progress && grid.Rank() == 0;
+    auto info = block_lanczos::Solve<Field>
+      ( applyA, V, W, XTmp, numEig, w.Matrix(), ctrl, progress );
+    X = XTmp;
+    return info;
+}
+
+} // namespace El
+
+#endif // ifndef EL_SPECTRAL_BLOCK_LANCZOS_HPP
@@ -29,6 +29,9 @@ namespace El {
 // minimum nonzero singular value of A), as well as to provide a means of
 // scaling A down to roughly unit two-norm.
 //
+// 'applyA' should overwrite y := A x via applyA( x, y ), which any (Hermitian)
+// LinearOperator does.
+//
 
 template<typename Field,class ApplyAType>
 void Lanczos
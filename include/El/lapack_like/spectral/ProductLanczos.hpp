@@ -79,6 +79,38 @@ Base<Field> ProductLanczosDecomp
     }
 }
 
+// Run Lanczos on the smaller of A^H A and A A^H, where the adjoint of the
+// operator A is applied via ApplyAdjoint
+template<typename Field>
+void ProductLanczos
+( const LinearOperator<Field>& A,
+        Matrix<Base<Field>>& T,
+        Int basisSize )
+{
+    EL_DEBUG_CSE
+    auto applyAAdj =
+      [&]( const Matrix<Field>& x, Matrix<Field>& y )
+      { A.ApplyAdjoint( x, y ); };
+    ProductLanczos<Field>
+    ( A.Height(), A.Width(), A, applyAAdj, T, basisSize );
+}
+
+template<typename Field>
+Base<Field> ProductLanczosDecomp
+( const LinearOperator<Field>& A,
+        Matrix<Field>& V,
+        Matrix<Base<Field>>& T,
+        Matrix<Field>& v,
+        Int basisSize )
+{
+    EL_DEBUG_CSE
+    auto applyAAdj =
+      [&]( const Matrix<Field>& x, Matrix<Field>& y )
+      { A.ApplyAdjoint( x, y ); };
+    return ProductLanczosDecomp<Field>
+    ( A.Height(), A.Width(), A, applyAAdj, V, T, v, basisSize );
+}
+
 } // namespace El
 
 #endif // ifndef EL_SPECTRAL_PRODUCT_LANCZOS
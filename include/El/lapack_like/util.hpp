@@ -20,6 +20,15 @@ template<typename Real,
          typename=DisableIf<IsComplex<Real>>>
 ValueInt<Real> Median( const AbstractDistMatrix<Real>& x );
 
+// Return the entry of rank k (counting from zero) in ascending order, with
+// ties broken by index. The distributed variant is a parallel quickselect.
+template<typename Real,
+         typename=DisableIf<IsComplex<Real>>>
+ValueInt<Real> OrderStatistic( const Matrix<Real>& x, Int k );
+template<typename Real,
+         typename=DisableIf<IsComplex<Real>>>
+ValueInt<Real> OrderStatistic( const AbstractDistMatrix<Real>& x, Int k );
+
 // Sort
 // ====
 template<typename Real,
@@ -66,6 +75,12 @@ template<typename Real,
 void SortingPermutation
 ( const Matrix<Real>& x, Permutation& sortPerm, SortType sort=ASCENDING,
   bool stable=false );
+// A parallel sample sort (which is always stable) of a distributed vector
+template<typename Real,
+         typename=DisableIf<IsComplex<Real>>>
+void SortingPermutation
+( const AbstractDistMatrix<Real>& x, DistPermutation& sortPerm,
+  SortType sort=ASCENDING, bool stable=false );
 
 template<typename Real,
          typename=DisableIf<IsComplex<Real>>>
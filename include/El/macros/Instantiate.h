@@ -6,6 +6,17 @@
    which can be found in the LICENSE file in the root directory, or at 
    http://opensource.org/licenses/BSD-2-Clause
 */
+// Scalar types omitted from the library at configuration time are skipped
+// by every instantiation list (including the extern declarations of the
+// header-only routines, which are then implicitly instantiated on use)
+#if defined(HYDROGEN_NO_FLOAT_INSTANTIATION) && !defined(EL_NO_FLOAT_PROTO)
+# define EL_NO_FLOAT_PROTO
+#endif
+#if defined(HYDROGEN_NO_COMPLEX_FLOAT_INSTANTIATION) && \
+    !defined(EL_NO_COMPLEX_FLOAT_PROTO)
+# define EL_NO_COMPLEX_FLOAT_PROTO
+#endif
+
 #ifndef PROTO_INT
 # define PROTO_INT(T) PROTO(T)
 #endif
@@ -50,6 +61,21 @@
 #endif
 #endif
 
+// The sixteen-bit storage types are only instantiated where requested
+#ifndef PROTO_LOWPRECISION
+# define PROTO_LOWPRECISION(T) PROTO(T)
+#endif
+#if defined(EL_ENABLE_HALF)
+#ifndef PROTO_HALF
+# define PROTO_HALF PROTO_LOWPRECISION(Half)
+#endif
+#endif
+#if defined(EL_ENABLE_BFLOAT16)
+#ifndef PROTO_BFLOAT16
+# define PROTO_BFLOAT16 PROTO_LOWPRECISION(BFloat16)
+#endif
+#endif
+
 #ifndef PROTO_COMPLEX
 # define PROTO_COMPLEX(T) PROTO(T)
 #endif
@@ -112,6 +138,13 @@ PROTO_BIGFLOAT
 #endif
 #endif
 
+#if defined(EL_ENABLE_HALF)
+PROTO_HALF
+#endif
+#if defined(EL_ENABLE_BFLOAT16)
+PROTO_BFLOAT16
+#endif
+
 #if !defined(EL_NO_COMPLEX_PROTO)
 # if !defined(EL_NO_COMPLEX_FLOAT_PROTO)
 PROTO_COMPLEX_FLOAT
@@ -145,6 +178,10 @@ PROTO_COMPLEX_BIGFLOAT
 #undef PROTO_QUAD
 #undef PROTO_BIGFLOAT
 
+#undef PROTO_LOWPRECISION
+#undef PROTO_HALF
+#undef PROTO_BFLOAT16
+
 #undef PROTO_COMPLEX
 #undef PROTO_COMPLEX_FLOAT
 #undef PROTO_COMPLEX_DOUBLE
@@ -158,6 +195,8 @@ PROTO_COMPLEX_BIGFLOAT
 #undef EL_ENABLE_QUAD
 #undef EL_ENABLE_BIGINT
 #undef EL_ENABLE_BIGFLOAT
+#undef EL_ENABLE_HALF
+#undef EL_ENABLE_BFLOAT16
 
 #undef EL_NO_INT_PROTO
 #undef EL_NO_REAL_PROTO
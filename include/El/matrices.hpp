@@ -89,6 +89,16 @@ void Fourier( Matrix<Complex<Real>>& A, Int n );
 template<typename Real>
 void Fourier( AbstractDistMatrix<Complex<Real>>& A, Int n );
 
+// Overwrite A with F A (or F^H A, if 'adjoint'), where F is the Fourier
+// matrix of order A.Height(), with O(n log n) work per column: a radix-2 FFT
+// is used if n is a power of two, and Bluestein's algorithm otherwise. The
+// distributed version redistributes A to [STAR,VR] (an all-to-all exchange)
+// so that every process transforms entire columns.
+template<typename Real>
+void ApplyFourier( Matrix<Complex<Real>>& A, bool adjoint=false );
+template<typename Real>
+void ApplyFourier( AbstractDistMatrix<Complex<Real>>& A, bool adjoint=false );
+
 // Greatest Common Denominator matrix
 // ----------------------------------
 template<typename T>
@@ -152,12 +162,27 @@ void Walsh( Matrix<T>& A, Int k, bool binary=false );
 template<typename T>
 void Walsh( AbstractDistMatrix<T>& A, Int k, bool binary=false );
 
+// Overwrite A with W A, where W is the (non-binary) Walsh matrix of order
+// A.Height(), which must be a power of two, using a fast Walsh-Hadamard
+// transform of each column. As with ApplyFourier, the distributed version
+// redistributes A to [STAR,VR].
+template<typename T>
+void ApplyWalsh( Matrix<T>& A );
+template<typename T>
+void ApplyWalsh( AbstractDistMatrix<T>& A );
+
 // Zeros
 // -----
 template<typename T>
 void Zeros( Matrix<T>& A, Int m, Int n );
 template<typename T>
 void Zeros( AbstractDistMatrix<T>& A, Int m, Int n );
+template<typename T>
+void Zeros( SparseMatrix<T>& A, Int m, Int n );
+template<typename T>
+void Zeros( DistSparseMatrix<T>& A, Int m, Int n );
+template<typename T>
+void Zeros( DistMultiVec<T>& A, Int m, Int n );
 
 // Integral equations
 // ==================
@@ -178,11 +203,19 @@ template<typename Field>
 void Helmholtz( Matrix<Field>& H, Int nx, Field shift );
 template<typename Field>
 void Helmholtz( AbstractDistMatrix<Field>& H, Int nx, Field shift );
+template<typename Field>
+void Helmholtz( SparseMatrix<Field>& H, Int nx, Field shift );
+template<typename Field>
+void Helmholtz( DistSparseMatrix<Field>& H, Int nx, Field shift );
 
 template<typename Field>
 void Helmholtz( Matrix<Field>& H, Int nx, Int ny, Field shift );
 template<typename Field>
 void Helmholtz( AbstractDistMatrix<Field>& H, Int nx, Int ny, Field shift );
+template<typename Field>
+void Helmholtz( SparseMatrix<Field>& H, Int nx, Int ny, Field shift );
+template<typename Field>
+void Helmholtz( DistSparseMatrix<Field>& H, Int nx, Int ny, Field shift );
 
 template<typename Field>
 void Helmholtz
@@ -190,6 +223,12 @@ void Helmholtz
 template<typename Field>
 void Helmholtz
 ( AbstractDistMatrix<Field>& H, Int nx, Int ny, Int nz, Field shift );
+template<typename Field>
+void Helmholtz
+( SparseMatrix<Field>& H, Int nx, Int ny, Int nz, Field shift );
+template<typename Field>
+void Helmholtz
+( DistSparseMatrix<Field>& H, Int nx, Int ny, Int nz, Field shift );
 
 // Helmholtz PML
 // -------------
@@ -201,6 +240,14 @@ template<typename Real>
 void HelmholtzPML
 ( AbstractDistMatrix<Complex<Real>>& H, Int nx,
   Complex<Real> omega, Int numPmlPoints=5, Real sigma=1.5, Real pmlExp=3 );
+template<typename Real>
+void HelmholtzPML
+( SparseMatrix<Complex<Real>>& H, Int nx,
+  Complex<Real> omega, Int numPmlPoints=5, Real sigma=1.5, Real pmlExp=3 );
+template<typename Real>
+void HelmholtzPML
+( DistSparseMatrix<Complex<Real>>& H, Int nx,
+  Complex<Real> omega, Int numPmlPoints=5, Real sigma=1.5, Real pmlExp=3 );
 
 template<typename Real>
 void HelmholtzPML
@@ -210,6 +257,14 @@ template<typename Real>
 void HelmholtzPML
 ( AbstractDistMatrix<Complex<Real>>& H, Int nx, Int ny,
   Complex<Real> omega, Int numPmlPoints=5, Real sigma=1.5, Real pmlExp=3 );
+template<typename Real>
+void HelmholtzPML
+( SparseMatrix<Complex<Real>>& H, Int nx, Int ny,
+  Complex<Real> omega, Int numPmlPoints=5, Real sigma=1.5, Real pmlExp=3 );
+template<typename Real>
+void HelmholtzPML
+( DistSparseMatrix<Complex<Real>>& H, Int nx, Int ny,
+  Complex<Real> omega, Int numPmlPoints=5, Real sigma=1.5, Real pmlExp=3 );
 
 template<typename Real>
 void HelmholtzPML
@@ -219,6 +274,14 @@ template<typename Real>
 void HelmholtzPML
 ( AbstractDistMatrix<Complex<Real>>& H, Int nx, Int ny, Int nz,
   Complex<Real> omega, Int numPmlPoints=5, Real sigma=1.5, Real pmlExp=3 );
+template<typename Real>
+void HelmholtzPML
+( SparseMatrix<Complex<Real>>& H, Int nx, Int ny, Int nz,
+  Complex<Real> omega, Int numPmlPoints=5, Real sigma=1.5, Real pmlExp=3 );
+template<typename Real>
+void HelmholtzPML
+( DistSparseMatrix<Complex<Real>>& H, Int nx, Int ny, Int nz,
+  Complex<Real> omega, Int numPmlPoints=5, Real sigma=1.5, Real pmlExp=3 );
 
 // Laplacian
 // ---------
@@ -226,16 +289,48 @@ template<typename Field>
 void Laplacian( Matrix<Field>& L, Int nx );
 template<typename Field>
 void Laplacian( AbstractDistMatrix<Field>& L, Int nx );
+template<typename Field>
+void Laplacian( SparseMatrix<Field>& L, Int nx );
+template<typename Field>
+void Laplacian( DistSparseMatrix<Field>& L, Int nx );
 
 template<typename Field>
 void Laplacian( Matrix<Field>& L, Int nx, Int ny );
 template<typename Field>
 void Laplacian( AbstractDistMatrix<Field>& L, Int nx, Int ny );
+template<typename Field>
+void Laplacian( SparseMatrix<Field>& L, Int nx, Int ny );
+template<typename Field>
+void Laplacian( DistSparseMatrix<Field>& L, Int nx, Int ny );
 
 template<typename Field>
 void Laplacian( Matrix<Field>& L, Int nx, Int ny, Int nz );
 template<typename Field>
 void Laplacian( AbstractDistMatrix<Field>& L, Int nx, Int ny, Int nz );
+template<typename Field>
+void Laplacian( SparseMatrix<Field>& L, Int nx, Int ny, Int nz );
+template<typename Field>
+void Laplacian( DistSparseMatrix<Field>& L, Int nx, Int ny, Int nz );
+
+// Matrix-free stencils
+// --------------------
+// See StencilOperator in blas_like/level3.hpp
+template<typename Field> class StencilOperator;
+
+template<typename Field>
+StencilOperator<Field> HelmholtzOperator( Int nx, Field shift );
+template<typename Field>
+StencilOperator<Field> HelmholtzOperator( Int nx, Int ny, Field shift );
+template<typename Field>
+StencilOperator<Field>
+HelmholtzOperator( Int nx, Int ny, Int nz, Field shift );
+
+template<typename Field>
+StencilOperator<Field> LaplacianOperator( Int nx );
+template<typename Field>
+StencilOperator<Field> LaplacianOperator( Int nx, Int ny );
+template<typename Field>
+StencilOperator<Field> LaplacianOperator( Int nx, Int ny, Int nz );
 
 // Miscellaneous (to be categorized)
 // =================================
@@ -535,6 +630,9 @@ void NTRUAttack( Matrix<Real>& A, const Matrix<Real>& h, Real alpha, Real q );
 
 // Independent
 // ===========
+// If CounterBasedRandom() is enabled, each entry is instead drawn from the
+// counter-based generator by its global indices, so that the result does not
+// depend upon the process grid or the distribution.
 
 // Bernoulli
 // ---------
@@ -582,12 +680,17 @@ template<typename T>
 void MakeUniform( Matrix<T>& A, T center=0, Base<T> radius=1 );
 template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center=0, Base<T> radius=1 );
+template<typename T>
+void MakeUniform( DistMultiVec<T>& A, T center=0, Base<T> radius=1 );
 
 template<typename T>
 void Uniform( Matrix<T>& A, Int m, Int n, T center=0, Base<T> radius=1 );
 template<typename T>
 void Uniform
 ( AbstractDistMatrix<T>& A, Int m, Int n, T center=0, Base<T> radius=1 );
+template<typename T>
+void Uniform
+( DistMultiVec<T>& A, Int m, Int n, T center=0, Base<T> radius=1 );
 
 // Lattice bases
 // =============
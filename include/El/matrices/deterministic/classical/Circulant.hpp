@@ -20,7 +20,7 @@ void Circulant( Matrix<T>& A, const Matrix<T>& a )
     // NOTE: gcc (Ubuntu 5.2.1-22ubuntu2) 5.2.1 20151010 segfaults here
     //       if the return type of the lambda is not manually specified.
     auto circFill = [&]( Int i, Int j ) -> T { return a.Get(Mod(i-j,n),0); };
-    IndexDependentFill( A, function<T(Int,Int)>(circFill) );
+    IndexDependentFill( A, circFill );
 }
 
 template<typename T>
@@ -32,7 +32,7 @@ void Circulant( Matrix<T>& A, const vector<T>& a )
     // NOTE: gcc (Ubuntu 5.2.1-22ubuntu2) 5.2.1 20151010 segfaults here
     //       if the return type of the lambda is not manually specified.
     auto circFill = [&]( Int i, Int j ) -> T { return a[Mod(i-j,n)]; };
-    IndexDependentFill( A, function<T(Int,Int)>(circFill) );
+    IndexDependentFill( A, circFill );
 }
 
 template<typename T>
@@ -42,7 +42,7 @@ void Circulant( AbstractDistMatrix<T>& A, const Matrix<T>& a )
     const Int n = a.Height();
     A.Resize( n, n );
     auto circFill = [&]( Int i, Int j ) -> T { return a.Get(Mod(i-j,n),0); };
-    IndexDependentFill( A, function<T(Int,Int)>(circFill) );
+    IndexDependentFill( A, circFill );
 }
 
 template<typename T>
@@ -52,7 +52,7 @@ void Circulant( AbstractDistMatrix<T>& A, const vector<T>& a )
     const Int n = a.size();
     A.Resize( n, n );
     auto circFill = [&]( Int i, Int j ) -> T { return a[Mod(i-j,n)]; };
-    IndexDependentFill( A, function<T(Int,Int)>(circFill) );
+    IndexDependentFill( A, circFill );
 }
 
 } // namespace El
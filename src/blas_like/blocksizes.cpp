@@ -8,12 +8,45 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like.hpp>
-#include <stack>
+#include <map>
+#include <tuple>
 
 namespace {
 using namespace El;
 
-std::stack<Int> blocksizeStack;
+Int parallelGrainSize = 16384;
+
+bool factorLookahead = false;
+
+Int queueRoundSize = Int(1) << 22;
+
+bool copyOnWrite = false;
+
+Int gemmLookahead = 1;
+size_t gemmMemoryLimit = 0;
+LocalGemmAlgorithm localGemmAlg = LOCAL_GEMM_STANDARD;
+
+PipelineCtrl contractPipelineCtrl;
+
+struct TuningKey
+{
+    string routine, datatype;
+    int gridHeight, gridWidth;
+
+    bool operator<( const TuningKey& other ) const
+    {
+        return std::tie(routine,datatype,gridHeight,gridWidth) <
+          std::tie(other.routine,other.datatype,other.gridHeight,
+                   other.gridWidth);
+    }
+};
+
+// For each key, a map from the rounded base-two logarithm of the local size
+// to the tuned blocksize
+std::map<TuningKey,std::map<Int,Int>> tunedBlocksizes;
+
+Int SizeBucket( Int localSize )
+{ return std::lround( std::log2( double(Max(localSize,Int(1))) ) ); }
 
 template<typename T>
 struct LocalSymvBlocksizeHelper { static Int value; };
@@ -30,44 +63,215 @@ struct LocalTrr2kBlocksizeHelper { static Int value; };
 template<typename T>
 Int LocalTrr2kBlocksizeHelper<T>::value = 64;
 
+template<typename T>
+struct LocalRecursionCutoffHelper { static Int value; };
+template<typename T>
+Int LocalRecursionCutoffHelper<T>::value = 32;
+
+template<typename T>
+struct StrassenCutoffHelper { static Int value; };
+template<typename T>
+Int StrassenCutoffHelper<T>::value = 512;
+
+template<typename T>
+struct OzakiNumSlicesHelper { static Int value; };
+template<typename T>
+Int OzakiNumSlicesHelper<T>::value = 0;
+
 }
 
 namespace El {
 
+// NOTE: The blocksize stack is a member of the Context of the calling thread
+
 Int Blocksize()
 {
+    const auto& blocksizeStack = CurrentContext().blocksizeStack;
     EL_DEBUG_ONLY(
-      if( ::blocksizeStack.empty() )
+      if( blocksizeStack.empty() )
           LogicError("Attempted to extract blocksize from empty stack");
     )
-    return ::blocksizeStack.top();
+    return blocksizeStack.back();
 }
 
 void SetBlocksize( Int blocksize )
 {
+    auto& blocksizeStack = CurrentContext().blocksizeStack;
     EL_DEBUG_ONLY(
-      if( ::blocksizeStack.empty() )
+      if( blocksizeStack.empty() )
           LogicError("Attempted to set blocksize at top of empty stack");
     )
-    ::blocksizeStack.top() = blocksize;
+    blocksizeStack.back() = blocksize;
 }
 
 void PushBlocksizeStack( Int blocksize )
-{ ::blocksizeStack.push( blocksize ); }
+{ CurrentContext().blocksizeStack.push_back( blocksize ); }
 
 void PopBlocksizeStack()
 {
+    auto& blocksizeStack = CurrentContext().blocksizeStack;
     EL_DEBUG_ONLY(
-      if( ::blocksizeStack.empty() )
+      if( blocksizeStack.empty() )
           LogicError("Attempted to pop an empty blocksize stack");
     )
-    ::blocksizeStack.pop();
+    blocksizeStack.pop_back();
+}
+
+void EmptyBlocksizeStack() { CurrentContext().blocksizeStack.clear(); }
+
+Int ParallelGrainSize() { return ::parallelGrainSize; }
+
+void SetParallelGrainSize( Int grainSize )
+{
+    if( grainSize < 1 )
+        LogicError("Parallel grain size must be positive");
+    ::parallelGrainSize = grainSize;
 }
 
-void EmptyBlocksizeStack()
+bool FactorLookahead() { return ::factorLookahead; }
+
+void SetFactorLookahead( bool lookahead ) { ::factorLookahead = lookahead; }
+
+Int QueueRoundSize() { return ::queueRoundSize; }
+
+void SetQueueRoundSize( Int roundSize )
 {
-    while( ! ::blocksizeStack.empty() )
-        ::blocksizeStack.pop();
+    if( roundSize < 1 )
+        LogicError("Queue round size must be positive");
+    ::queueRoundSize = roundSize;
+}
+
+bool CopyOnWrite() { return ::copyOnWrite; }
+
+void SetCopyOnWrite( bool copyOnWrite ) { ::copyOnWrite = copyOnWrite; }
+
+void SetGemmLookahead( Int lookahead )
+{
+    if( lookahead < 1 )
+        LogicError("Gemm lookahead must be positive");
+    ::gemmLookahead = lookahead;
+}
+
+Int GemmLookahead() { return ::gemmLookahead; }
+
+void SetGemmMemoryLimit( size_t numBytes ) { ::gemmMemoryLimit = numBytes; }
+
+size_t GemmMemoryLimit() { return ::gemmMemoryLimit; }
+
+void SetContractPipelineCtrl( const PipelineCtrl& ctrl )
+{
+    if( ctrl.segmentSize < 1 )
+        LogicError("Contraction segment sizes must be positive");
+    ::contractPipelineCtrl = ctrl;
+}
+
+const PipelineCtrl& ContractPipelineCtrl() EL_NO_EXCEPT
+{ return ::contractPipelineCtrl; }
+
+void SetLocalGemmAlgorithm( LocalGemmAlgorithm alg )
+{ ::localGemmAlg = alg; }
+
+LocalGemmAlgorithm GetLocalGemmAlgorithm() { return ::localGemmAlg; }
+
+Int TunedBlocksize
+( const string& routine, const string& datatype,
+  Int localSize, int gridHeight, int gridWidth )
+{
+    auto it =
+      ::tunedBlocksizes.find( TuningKey{routine,datatype,gridHeight,gridWidth} );
+    if( it == ::tunedBlocksizes.end() || it->second.empty() )
+        return Blocksize();
+
+    // Use the nearest tuned (logarithmic) local size
+    const auto& sizes = it->second;
+    const Int bucket = SizeBucket( localSize );
+    auto upper = sizes.lower_bound( bucket );
+    if( upper == sizes.end() )
+        return std::prev(upper)->second;
+    if( upper == sizes.begin() || upper->first == bucket )
+        return upper->second;
+    auto lower = std::prev(upper);
+    return ( bucket-lower->first <= upper->first-bucket ?
+             lower->second : upper->second );
+}
+
+void SetTunedBlocksize
+( const string& routine, const string& datatype,
+  Int localSize, int gridHeight, int gridWidth, Int blocksize )
+{
+    if( blocksize < 1 )
+        LogicError("Tuned blocksizes must be positive");
+    const TuningKey key{routine,datatype,gridHeight,gridWidth};
+    ::tunedBlocksizes[key][SizeBucket(localSize)] = blocksize;
+}
+
+void ClearTunedBlocksizes() { ::tunedBlocksizes.clear(); }
+
+Int TuneBlocksize
+( const string& routine, const string& datatype,
+  Int localSize, int gridHeight, int gridWidth,
+  const std::function<double(Int)>& timeRoutine,
+  const vector<Int>& candidates )
+{
+    EL_DEBUG_CSE
+    if( candidates.empty() )
+        LogicError("No candidate blocksizes were given");
+    Int bestBlocksize = candidates[0];
+    double bestTime = std::numeric_limits<double>::max();
+    for( const Int candidate : candidates )
+    {
+        SetTunedBlocksize
+        ( routine, datatype, localSize, gridHeight, gridWidth, candidate );
+        const double time = timeRoutine( candidate );
+        if( time < bestTime )
+        {
+            bestTime = time;
+            bestBlocksize = candidate;
+        }
+    }
+    SetTunedBlocksize
+    ( routine, datatype, localSize, gridHeight, gridWidth, bestBlocksize );
+    if( const char* tuningFile = std::getenv("EL_TUNING_FILE") )
+        SaveTuningFile( tuningFile );
+    return bestBlocksize;
+}
+
+void LoadTuningFile( const string& filename )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    string line;
+    while( std::getline( file, line ) )
+    {
+        if( line.empty() || line[0] == '#' )
+            continue;
+        std::istringstream lineStream( line );
+        TuningKey key;
+        Int bucket, blocksize;
+        if( !(lineStream >> key.routine >> key.datatype >> bucket
+                         >> key.gridHeight >> key.gridWidth >> blocksize) )
+            RuntimeError("Could not parse tuning entry \"",line,"\"");
+        ::tunedBlocksizes[key][bucket] = blocksize;
+    }
+}
+
+void SaveTuningFile( const string& filename )
+{
+    EL_DEBUG_CSE
+    if( mpi::Rank(mpi::COMM_WORLD) != 0 )
+        return;
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "# routine datatype log2(localSize) gridHeight gridWidth "
+            "blocksize" << std::endl;
+    for( const auto& entry : ::tunedBlocksizes )
+        for( const auto& size : entry.second )
+            file << entry.first.routine << " " << entry.first.datatype << " "
+                 << size.first << " " << entry.first.gridHeight << " "
+                 << entry.first.gridWidth << " " << size.second << std::endl;
 }
 
 template<typename T>
@@ -94,13 +298,51 @@ template<typename T>
 Int LocalTrr2kBlocksize()
 { return LocalTrr2kBlocksizeHelper<T>::value; }
 
+template<typename T>
+void SetLocalRecursionCutoff( Int cutoff )
+{ LocalRecursionCutoffHelper<T>::value = cutoff; }
+
+template<typename T>
+Int LocalRecursionCutoff()
+{ return LocalRecursionCutoffHelper<T>::value; }
+
+template<typename T>
+void SetStrassenCutoff( Int cutoff )
+{
+    if( cutoff < 1 )
+        LogicError("Strassen cutoff must be positive");
+    StrassenCutoffHelper<T>::value = cutoff;
+}
+
+template<typename T>
+Int StrassenCutoff()
+{ return StrassenCutoffHelper<T>::value; }
+
+template<typename T>
+void SetOzakiNumSlices( Int numSlices )
+{
+    if( numSlices < 0 )
+        LogicError("Number of Ozaki slices must be non-negative");
+    OzakiNumSlicesHelper<T>::value = numSlices;
+}
+
+template<typename T>
+Int OzakiNumSlices()
+{ return OzakiNumSlicesHelper<T>::value; }
+
 #define PROTO(T) \
   template void SetLocalSymvBlocksize<T>( Int blocksize ); \
   template Int LocalSymvBlocksize<T>(); \
   template void SetLocalTrrkBlocksize<T>( Int blocksize ); \
   template Int LocalTrrkBlocksize<T>(); \
   template void SetLocalTrr2kBlocksize<T>( Int blocksize ); \
-  template Int LocalTrr2kBlocksize<T>();
+  template Int LocalTrr2kBlocksize<T>(); \
+  template void SetLocalRecursionCutoff<T>( Int cutoff ); \
+  template Int LocalRecursionCutoff<T>(); \
+  template void SetStrassenCutoff<T>( Int cutoff ); \
+  template Int StrassenCutoff<T>(); \
+  template void SetOzakiNumSlices<T>( Int numSlices ); \
+  template Int OzakiNumSlices<T>();
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -21,19 +21,25 @@ void ColumnTwoNormsHelper
     const Int mLocal = ALoc.Height();
     const Int nLocal = ALoc.Width();
 
+    const Field* ABuf = ALoc.LockedBuffer();
+    const Int ALDim = ALoc.LDim();
+
     // TODO(poulson): Ensure that NaN's propagate
     Matrix<Real> localScales( nLocal, 1 ),
                  localScaledSquares( nLocal, 1 );
+    Real* scaleBuf = localScales.Buffer();
+    Real* scaledSquareBuf = localScaledSquares.Buffer();
+    EL_PARALLEL_FOR_GRAIN(mLocal*nLocal)
     for( Int jLoc=0; jLoc<nLocal; ++jLoc )
     {
         Real localScale = 0;
         Real localScaledSquare = 1;
         for( Int iLoc=0; iLoc<mLocal; ++iLoc )
             UpdateScaledSquare
-            ( ALoc(iLoc,jLoc), localScale, localScaledSquare );
+            ( ABuf[iLoc+jLoc*ALDim], localScale, localScaledSquare );
 
-        localScales(jLoc) = localScale;
-        localScaledSquares(jLoc) = localScaledSquare;
+        scaleBuf[jLoc] = localScale;
+        scaledSquareBuf[jLoc] = localScaledSquare;
     }
 
     NormsFromScaledSquares( localScales, localScaledSquares, normsLoc, comm );
@@ -49,21 +55,29 @@ void ColumnTwoNormsHelper
     const Int mLocal = ARealLoc.Height();
     const Int nLocal = ARealLoc.Width();
 
+    const Real* ARealBuf = ARealLoc.LockedBuffer();
+    const Real* AImagBuf = AImagLoc.LockedBuffer();
+    const Int ARealLDim = ARealLoc.LDim();
+    const Int AImagLDim = AImagLoc.LDim();
+
     // TODO(poulson): Ensure that NaN's propagate
     Matrix<Real> localScales( nLocal, 1 ), localScaledSquares( nLocal, 1 );
+    Real* scaleBuf = localScales.Buffer();
+    Real* scaledSquareBuf = localScaledSquares.Buffer();
+    EL_PARALLEL_FOR_GRAIN(mLocal*nLocal)
     for( Int jLoc=0; jLoc<nLocal; ++jLoc )
     {
         Real localScale = 0;
         Real localScaledSquare = 1;
         for( Int iLoc=0; iLoc<mLocal; ++iLoc )
             UpdateScaledSquare
-            ( ARealLoc(iLoc,jLoc), localScale, localScaledSquare );
+            ( ARealBuf[iLoc+jLoc*ARealLDim], localScale, localScaledSquare );
         for( Int iLoc=0; iLoc<mLocal; ++iLoc )
             UpdateScaledSquare
-            ( AImagLoc(iLoc,jLoc), localScale, localScaledSquare );
+            ( AImagBuf[iLoc+jLoc*AImagLDim], localScale, localScaledSquare );
 
-        localScales(jLoc) = localScale;
-        localScaledSquares(jLoc) = localScaledSquare;
+        scaleBuf[jLoc] = localScale;
+        scaledSquareBuf[jLoc] = localScaledSquare;
     }
 
     NormsFromScaledSquares( localScales, localScaledSquares, normsLoc, comm );
@@ -81,8 +95,12 @@ void ColumnTwoNorms( const Matrix<Field>& X, Matrix<Base<Field>>& norms )
         Zero( norms );
         return;
     }
+    const Field* XBuf = X.LockedBuffer();
+    const Int XLDim = X.LDim();
+    Base<Field>* normBuf = norms.Buffer();
+    EL_PARALLEL_FOR_GRAIN(m*n)
     for( Int j=0; j<n; ++j )
-        norms(j) = blas::Nrm2( m, &X(0,j), 1 );
+        normBuf[j] = blas::Nrm2( m, &XBuf[j*XLDim], 1 );
 }
 
 template<typename Field>
@@ -93,13 +111,17 @@ void ColumnMaxNorms( const Matrix<Field>& X, Matrix<Base<Field>>& norms )
     const Int m = X.Height();
     const Int n = X.Width();
     norms.Resize( n, 1 );
+    const Field* XBuf = X.LockedBuffer();
+    const Int XLDim = X.LDim();
+    Real* normBuf = norms.Buffer();
+    EL_PARALLEL_FOR_GRAIN(m*n)
     for( Int j=0; j<n; ++j )
     {
         // TODO(poulson): Ensure that NaN's propagate
         Real colMax = 0;
         for( Int i=0; i<m; ++i )
-            colMax = Max(colMax,Abs(X(i,j)));
-        norms(j) = colMax;
+            colMax = Max(colMax,Abs(XBuf[i+j*XLDim]));
+        normBuf[j] = colMax;
     }
 }
 
@@ -129,6 +151,29 @@ void ColumnMaxNorms
     AllReduce( norms.Matrix(), A.ColComm(), mpi::MAX );
 }
 
+template<typename Field>
+void ColumnTwoNorms
+( const DistMultiVec<Field>& X, Matrix<Base<Field>>& norms )
+{
+    EL_DEBUG_CSE
+    norms.Resize( X.Width(), 1 );
+    if( X.Height() == 0 )
+    {
+        Zero( norms );
+        return;
+    }
+    ColumnTwoNormsHelper( X.LockedMatrix(), norms, X.Grid().Comm() );
+}
+
+template<typename Field>
+void ColumnMaxNorms
+( const DistMultiVec<Field>& X, Matrix<Base<Field>>& norms )
+{
+    EL_DEBUG_CSE
+    ColumnMaxNorms( X.LockedMatrix(), norms );
+    AllReduce( norms, X.Grid().Comm(), mpi::MAX );
+}
+
 // Versions which operate on explicitly-separated complex matrices
 // ===============================================================
 template<typename Real,typename>
@@ -146,11 +191,17 @@ void ColumnTwoNorms
         Zero( norms );
         return;
     }
+    const Real* XRealBuf = XReal.LockedBuffer();
+    const Real* XImagBuf = XImag.LockedBuffer();
+    const Int XRealLDim = XReal.LDim();
+    const Int XImagLDim = XImag.LDim();
+    Real* normBuf = norms.Buffer();
+    EL_PARALLEL_FOR_GRAIN(m*n)
     for( Int j=0; j<n; ++j )
     {
-        Real alpha = blas::Nrm2( m, &XReal(0,j), 1 );
-        Real beta  = blas::Nrm2( m, &XImag(0,j), 1 );
-        norms(j) = SafeNorm(alpha,beta);
+        Real alpha = blas::Nrm2( m, &XRealBuf[j*XRealLDim], 1 );
+        Real beta  = blas::Nrm2( m, &XImagBuf[j*XImagLDim], 1 );
+        normBuf[j] = SafeNorm(alpha,beta);
     }
 }
 
@@ -197,6 +248,12 @@ void ColumnTwoNorms
   template void ColumnMaxNorms \
   ( const Matrix<Field>& X, \
           Matrix<Base<Field>>& norms ); \
+  template void ColumnTwoNorms \
+  ( const DistMultiVec<Field>& X, \
+          Matrix<Base<Field>>& norms ); \
+  template void ColumnMaxNorms \
+  ( const DistMultiVec<Field>& X, \
+          Matrix<Base<Field>>& norms ); \
   PROTO_DIST(Field,MC,  MR  ) \
   PROTO_DIST(Field,MC,  STAR) \
   PROTO_DIST(Field,MD,  STAR) \
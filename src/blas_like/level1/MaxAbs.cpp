@@ -12,21 +12,37 @@
 namespace El {
 
 template<typename Ring>
-Base<Ring> MaxAbs( const Matrix<Ring>& A )
+Base<Ring> MaxAbsHelper( Int m, Int n, const Ring* ABuf, Int ALDim )
 {
-    EL_DEBUG_CSE
-    const Int m = A.Height();
-    const Int n = A.Width();
-    const Ring* ABuf = A.LockedBuffer();
-    const Int ALDim = A.LDim();
-
     Base<Ring> value = 0;
+#ifdef EL_HYBRID
+    // A manual reduction, since OpenMP's max reduction is restricted to
+    // builtin arithmetic types
+    #pragma omp parallel if( m*n >= ParallelGrainSize() )
+    {
+        Base<Ring> threadValue = 0;
+        #pragma omp for nowait
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                threadValue = Max(threadValue,Abs(ABuf[i+j*ALDim]));
+        #pragma omp critical
+        value = Max(value,threadValue);
+    }
+#else
     for( Int j=0; j<n; ++j )
         for( Int i=0; i<m; ++i )
             value = Max(value,Abs(ABuf[i+j*ALDim]));
+#endif
     return value;
 }
 
+template<typename Ring>
+Base<Ring> MaxAbs( const Matrix<Ring>& A )
+{
+    EL_DEBUG_CSE
+    return MaxAbsHelper( A.Height(), A.Width(), A.LockedBuffer(), A.LDim() );
+}
+
 template<typename Ring>
 Base<Ring> MaxAbs( const AbstractDistMatrix<Ring>& A )
 {
@@ -38,15 +54,8 @@ Base<Ring> MaxAbs( const AbstractDistMatrix<Ring>& A )
     Base<Ring> value = 0;
     if( A.Participating() )
     {
-        // Store the index/value of the local pivot candidate
-        const Int mLocal = A.LocalHeight();
-        const Int nLocal = A.LocalWidth();
-        const Ring* ABuf = A.LockedBuffer();
-        const Int ALDim = A.LDim();
-        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-            for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-                value = Max(value,Abs(ABuf[iLoc+jLoc*ALDim]));
-
+        value = MaxAbsHelper
+        ( A.LocalHeight(), A.LocalWidth(), A.LockedBuffer(), A.LDim() );
         value = mpi::AllReduce( value, mpi::MAX, A.DistComm() );
     }
     mpi::Broadcast( value, A.Root(), A.CrossComm() );
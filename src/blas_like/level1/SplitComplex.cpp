@@ -0,0 +1,337 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+
+namespace El {
+
+namespace split_complex {
+
+template<typename S,typename T>
+void AssertSameDist
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+{
+    AssertSameGrids( A, B );
+    if( A.DistData().colDist != B.DistData().colDist ||
+        A.DistData().rowDist != B.DistData().rowDist ||
+        A.Wrap() != B.Wrap() )
+        LogicError("Matrices must have the same distribution");
+}
+
+template<typename S,typename T>
+void AssertConforming
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError("Matrices must be the same size");
+    AssertSameDist( A, B );
+    if( A.ColAlign() != B.ColAlign() || A.RowAlign() != B.RowAlign() )
+        LogicError("Matrices must be aligned");
+    if( A.BlockHeight() != B.BlockHeight() ||
+        A.BlockWidth() != B.BlockWidth() )
+        LogicError("Matrices must have the same block size");
+}
+
+template<typename S,typename T>
+void AlignAndResize
+( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B )
+{
+    AssertSameDist( A, B );
+    B.AlignWith( A.DistData() );
+    B.Resize( A.Height(), A.Width() );
+}
+
+} // namespace split_complex
+
+template<typename Real>
+void SplitComplex
+( const Matrix<Complex<Real>>& A,
+        Matrix<Real>& AReal,
+        Matrix<Real>& AImag )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    AReal.Resize( m, n );
+    AImag.Resize( m, n );
+    const Complex<Real>* ABuf = A.LockedBuffer();
+    Real* ARealBuf = AReal.Buffer();
+    Real* AImagBuf = AImag.Buffer();
+    const Int ALDim = A.LDim();
+    const Int ARealLDim = AReal.LDim();
+    const Int AImagLDim = AImag.LDim();
+    EL_PARALLEL_FOR_GRAIN(m*n)
+    for( Int j=0; j<n; ++j )
+        simd::SplitComplex
+        ( m, &ABuf[j*ALDim],
+          &ARealBuf[j*ARealLDim], &AImagBuf[j*AImagLDim] );
+}
+
+template<typename Real>
+void SplitComplex
+( const AbstractDistMatrix<Complex<Real>>& A,
+        AbstractDistMatrix<Real>& AReal,
+        AbstractDistMatrix<Real>& AImag )
+{
+    EL_DEBUG_CSE
+    split_complex::AlignAndResize( A, AReal );
+    split_complex::AlignAndResize( A, AImag );
+    SplitComplex( A.LockedMatrix(), AReal.Matrix(), AImag.Matrix() );
+}
+
+template<typename Real>
+void MergeComplex
+( const Matrix<Real>& AReal,
+  const Matrix<Real>& AImag,
+        Matrix<Complex<Real>>& A )
+{
+    EL_DEBUG_CSE
+    const Int m = AReal.Height();
+    const Int n = AReal.Width();
+    if( AImag.Height() != m || AImag.Width() != n )
+        LogicError("The real and imaginary parts must be the same size");
+    A.Resize( m, n );
+    const Real* ARealBuf = AReal.LockedBuffer();
+    const Real* AImagBuf = AImag.LockedBuffer();
+    Complex<Real>* ABuf = A.Buffer();
+    const Int ARealLDim = AReal.LDim();
+    const Int AImagLDim = AImag.LDim();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR_GRAIN(m*n)
+    for( Int j=0; j<n; ++j )
+        simd::MergeComplex
+        ( m, &ARealBuf[j*ARealLDim], &AImagBuf[j*AImagLDim],
+          &ABuf[j*ALDim] );
+}
+
+template<typename Real>
+void MergeComplex
+( const AbstractDistMatrix<Real>& AReal,
+  const AbstractDistMatrix<Real>& AImag,
+        AbstractDistMatrix<Complex<Real>>& A )
+{
+    EL_DEBUG_CSE
+    split_complex::AssertConforming( AReal, AImag );
+    split_complex::AlignAndResize( AReal, A );
+    MergeComplex( AReal.LockedMatrix(), AImag.LockedMatrix(), A.Matrix() );
+}
+
+template<typename Real,typename>
+void Axpy
+( Complex<Real> alpha,
+  const Matrix<Real>& XReal, const Matrix<Real>& XImag,
+        Matrix<Real>& YReal,       Matrix<Real>& YImag )
+{
+    EL_DEBUG_CSE
+    const Int m = XReal.Height();
+    const Int n = XReal.Width();
+    if( XImag.Height() != m || XImag.Width() != n ||
+        YReal.Height() != m || YReal.Width() != n ||
+        YImag.Height() != m || YImag.Width() != n )
+        LogicError("Matrices must be the same size");
+    const Real* XRealBuf = XReal.LockedBuffer();
+    const Real* XImagBuf = XImag.LockedBuffer();
+    Real* YRealBuf = YReal.Buffer();
+    Real* YImagBuf = YImag.Buffer();
+    const Int XRealLDim = XReal.LDim();
+    const Int XImagLDim = XImag.LDim();
+    const Int YRealLDim = YReal.LDim();
+    const Int YImagLDim = YImag.LDim();
+    EL_PARALLEL_FOR_GRAIN(m*n)
+    for( Int j=0; j<n; ++j )
+        simd::SplitAxpy
+        ( m, alpha,
+          &XRealBuf[j*XRealLDim], &XImagBuf[j*XImagLDim],
+          &YRealBuf[j*YRealLDim], &YImagBuf[j*YImagLDim] );
+}
+
+template<typename Real,typename>
+void Axpy
+( Complex<Real> alpha,
+  const AbstractDistMatrix<Real>& XReal,
+  const AbstractDistMatrix<Real>& XImag,
+        AbstractDistMatrix<Real>& YReal,
+        AbstractDistMatrix<Real>& YImag )
+{
+    EL_DEBUG_CSE
+    split_complex::AssertConforming( XReal, XImag );
+    split_complex::AssertConforming( XReal, YReal );
+    split_complex::AssertConforming( XReal, YImag );
+    Axpy
+    ( alpha, XReal.LockedMatrix(), XImag.LockedMatrix(),
+      YReal.Matrix(), YImag.Matrix() );
+}
+
+template<typename Real,typename>
+void Hadamard
+( const Matrix<Real>& AReal, const Matrix<Real>& AImag,
+  const Matrix<Real>& BReal, const Matrix<Real>& BImag,
+        Matrix<Real>& CReal,       Matrix<Real>& CImag )
+{
+    EL_DEBUG_CSE
+    const Int m = AReal.Height();
+    const Int n = AReal.Width();
+    if( AImag.Height() != m || AImag.Width() != n ||
+        BReal.Height() != m || BReal.Width() != n ||
+        BImag.Height() != m || BImag.Width() != n )
+        LogicError("Hadamard product requires equal dimensions");
+    CReal.Resize( m, n );
+    CImag.Resize( m, n );
+    const Real* ARealBuf = AReal.LockedBuffer();
+    const Real* AImagBuf = AImag.LockedBuffer();
+    const Real* BRealBuf = BReal.LockedBuffer();
+    const Real* BImagBuf = BImag.LockedBuffer();
+    Real* CRealBuf = CReal.Buffer();
+    Real* CImagBuf = CImag.Buffer();
+    const Int ARealLDim = AReal.LDim();
+    const Int AImagLDim = AImag.LDim();
+    const Int BRealLDim = BReal.LDim();
+    const Int BImagLDim = BImag.LDim();
+    const Int CRealLDim = CReal.LDim();
+    const Int CImagLDim = CImag.LDim();
+    EL_PARALLEL_FOR_GRAIN(m*n)
+    for( Int j=0; j<n; ++j )
+        simd::SplitHadamard
+        ( m,
+          &ARealBuf[j*ARealLDim], &AImagBuf[j*AImagLDim],
+          &BRealBuf[j*BRealLDim], &BImagBuf[j*BImagLDim],
+          &CRealBuf[j*CRealLDim], &CImagBuf[j*CImagLDim] );
+}
+
+template<typename Real,typename>
+void Hadamard
+( const AbstractDistMatrix<Real>& AReal,
+  const AbstractDistMatrix<Real>& AImag,
+  const AbstractDistMatrix<Real>& BReal,
+  const AbstractDistMatrix<Real>& BImag,
+        AbstractDistMatrix<Real>& CReal,
+        AbstractDistMatrix<Real>& CImag )
+{
+    EL_DEBUG_CSE
+    split_complex::AssertConforming( AReal, AImag );
+    split_complex::AssertConforming( AReal, BReal );
+    split_complex::AssertConforming( AReal, BImag );
+    split_complex::AlignAndResize( AReal, CReal );
+    split_complex::AlignAndResize( AReal, CImag );
+    Hadamard
+    ( AReal.LockedMatrix(), AImag.LockedMatrix(),
+      BReal.LockedMatrix(), BImag.LockedMatrix(),
+      CReal.Matrix(), CImag.Matrix() );
+}
+
+template<typename Real,typename>
+Complex<Real> HilbertSchmidt
+( const Matrix<Real>& AReal, const Matrix<Real>& AImag,
+  const Matrix<Real>& BReal, const Matrix<Real>& BImag )
+{
+    EL_DEBUG_CSE
+    const Int m = AReal.Height();
+    const Int n = AReal.Width();
+    if( AImag.Height() != m || AImag.Width() != n ||
+        BReal.Height() != m || BReal.Width() != n ||
+        BImag.Height() != m || BImag.Width() != n )
+        LogicError("Matrices must be the same size");
+    const Real* ARealBuf = AReal.LockedBuffer();
+    const Real* AImagBuf = AImag.LockedBuffer();
+    const Real* BRealBuf = BReal.LockedBuffer();
+    const Real* BImagBuf = BImag.LockedBuffer();
+    const Int ARealLDim = AReal.LDim();
+    const Int AImagLDim = AImag.LDim();
+    const Int BRealLDim = BReal.LDim();
+    const Int BImagLDim = BImag.LDim();
+    Complex<Real> innerProd(0);
+    for( Int j=0; j<n; ++j )
+        innerProd +=
+          simd::SplitDot
+          ( m,
+            &ARealBuf[j*ARealLDim], &AImagBuf[j*AImagLDim],
+            &BRealBuf[j*BRealLDim], &BImagBuf[j*BImagLDim] );
+    return innerProd;
+}
+
+template<typename Real,typename>
+Complex<Real> HilbertSchmidt
+( const AbstractDistMatrix<Real>& AReal,
+  const AbstractDistMatrix<Real>& AImag,
+  const AbstractDistMatrix<Real>& BReal,
+  const AbstractDistMatrix<Real>& BImag )
+{
+    EL_DEBUG_CSE
+    split_complex::AssertConforming( AReal, AImag );
+    split_complex::AssertConforming( AReal, BReal );
+    split_complex::AssertConforming( AReal, BImag );
+    Complex<Real> innerProd;
+    if( AReal.Participating() )
+    {
+        const Complex<Real> localInnerProd =
+          HilbertSchmidt
+          ( AReal.LockedMatrix(), AImag.LockedMatrix(),
+            BReal.LockedMatrix(), BImag.LockedMatrix() );
+        innerProd = mpi::AllReduce( localInnerProd, AReal.DistComm() );
+    }
+    mpi::Broadcast( innerProd, AReal.Root(), AReal.CrossComm() );
+    return innerProd;
+}
+
+#define PROTO(Real) \
+  template void SplitComplex \
+  ( const Matrix<Complex<Real>>& A, \
+          Matrix<Real>& AReal, \
+          Matrix<Real>& AImag ); \
+  template void SplitComplex \
+  ( const AbstractDistMatrix<Complex<Real>>& A, \
+          AbstractDistMatrix<Real>& AReal, \
+          AbstractDistMatrix<Real>& AImag ); \
+  template void MergeComplex \
+  ( const Matrix<Real>& AReal, \
+    const Matrix<Real>& AImag, \
+          Matrix<Complex<Real>>& A ); \
+  template void MergeComplex \
+  ( const AbstractDistMatrix<Real>& AReal, \
+    const AbstractDistMatrix<Real>& AImag, \
+          AbstractDistMatrix<Complex<Real>>& A ); \
+  template void Axpy \
+  ( Complex<Real> alpha, \
+    const Matrix<Real>& XReal, const Matrix<Real>& XImag, \
+          Matrix<Real>& YReal,       Matrix<Real>& YImag ); \
+  template void Axpy \
+  ( Complex<Real> alpha, \
+    const AbstractDistMatrix<Real>& XReal, \
+    const AbstractDistMatrix<Real>& XImag, \
+          AbstractDistMatrix<Real>& YReal, \
+          AbstractDistMatrix<Real>& YImag ); \
+  template void Hadamard \
+  ( const Matrix<Real>& AReal, const Matrix<Real>& AImag, \
+    const Matrix<Real>& BReal, const Matrix<Real>& BImag, \
+          Matrix<Real>& CReal,       Matrix<Real>& CImag ); \
+  template void Hadamard \
+  ( const AbstractDistMatrix<Real>& AReal, \
+    const AbstractDistMatrix<Real>& AImag, \
+    const AbstractDistMatrix<Real>& BReal, \
+    const AbstractDistMatrix<Real>& BImag, \
+          AbstractDistMatrix<Real>& CReal, \
+          AbstractDistMatrix<Real>& CImag ); \
+  template Complex<Real> HilbertSchmidt \
+  ( const Matrix<Real>& AReal, const Matrix<Real>& AImag, \
+    const Matrix<Real>& BReal, const Matrix<Real>& BImag ); \
+  template Complex<Real> HilbertSchmidt \
+  ( const AbstractDistMatrix<Real>& AReal, \
+    const AbstractDistMatrix<Real>& AImag, \
+    const AbstractDistMatrix<Real>& BReal, \
+    const AbstractDistMatrix<Real>& BImag );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
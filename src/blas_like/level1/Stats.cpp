@@ -0,0 +1,288 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+
+namespace El {
+
+// The scale used for each scaled sum of squares is the running maximum
+// absolute value, so a single pass yields the two-norms, the max-abs values,
+// and the sums.
+
+template<typename Field>
+void LocalColumnStats
+( const Matrix<Field>& A,
+        Matrix<Base<Field>>& scaledSquares,
+        Matrix<Base<Field>>& maxAbs,
+        Matrix<Field>& sums )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Field* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    scaledSquares.Resize( n, 1 );
+    maxAbs.Resize( n, 1 );
+    sums.Resize( n, 1 );
+    Real* scaledSquareBuf = scaledSquares.Buffer();
+    Real* maxAbsBuf = maxAbs.Buffer();
+    Field* sumBuf = sums.Buffer();
+    EL_PARALLEL_FOR_GRAIN(m*n)
+    for( Int j=0; j<n; ++j )
+    {
+        Real scale = 0;
+        Real scaledSquare = 1;
+        Field sum = 0;
+        for( Int i=0; i<m; ++i )
+        {
+            const Field& alpha = ABuf[i+j*ALDim];
+            UpdateScaledSquare( alpha, scale, scaledSquare );
+            sum += alpha;
+        }
+        scaledSquareBuf[j] = scaledSquare;
+        maxAbsBuf[j] = scale;
+        sumBuf[j] = sum;
+    }
+}
+
+template<typename Field>
+void LocalRowStats
+( const Matrix<Field>& A,
+        Matrix<Base<Field>>& scaledSquares,
+        Matrix<Base<Field>>& maxAbs,
+        Matrix<Field>& sums )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Field* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    scaledSquares.Resize( m, 1 );
+    maxAbs.Resize( m, 1 );
+    sums.Resize( m, 1 );
+    Real* scaledSquareBuf = scaledSquares.Buffer();
+    Real* maxAbsBuf = maxAbs.Buffer();
+    Field* sumBuf = sums.Buffer();
+    for( Int i=0; i<m; ++i )
+    {
+        scaledSquareBuf[i] = 1;
+        maxAbsBuf[i] = 0;
+        sumBuf[i] = 0;
+    }
+    // Stream down the columns, updating the accumulators of each row
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            const Field& alpha = ABuf[i+j*ALDim];
+            UpdateScaledSquare( alpha, maxAbsBuf[i], scaledSquareBuf[i] );
+            sumBuf[i] += alpha;
+        }
+    }
+}
+
+// Combine the local statistics over the given communicator using one MAX
+// reduction (which also provides the scales for the two-norms) and one
+// SUM reduction of the rescaled squares packed together with the sums
+template<typename Field>
+void StatsAllReduce
+( Matrix<Base<Field>>& scaledSquares,
+  Matrix<Base<Field>>& maxAbs,
+  Matrix<Field>& sums,
+  Matrix<Base<Field>>& twoNorms,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int k = maxAbs.Height();
+    twoNorms.Resize( k, 1 );
+    if( mpi::Size(comm) == 1 )
+    {
+        for( Int j=0; j<k; ++j )
+            twoNorms(j) = maxAbs(j)*Sqrt(scaledSquares(j));
+        return;
+    }
+
+    const Real* maxAbsBuf = maxAbs.LockedBuffer();
+    vector<Real> localMaxAbs( maxAbsBuf, maxAbsBuf+k );
+    mpi::AllReduce( maxAbs.Buffer(), k, mpi::MAX, comm );
+
+    const Int sumSize = ( IsComplex<Field>::value ? 2 : 1 );
+    vector<Real> packed( k*(1+sumSize) );
+    for( Int j=0; j<k; ++j )
+    {
+        const Real scale = maxAbs(j);
+        if( scale != Real(0) )
+        {
+            const Real relScale = localMaxAbs[j] / scale;
+            packed[j] = scaledSquares(j)*relScale*relScale;
+        }
+        else
+            packed[j] = 0;
+        packed[k+j*sumSize] = RealPart(sums(j));
+        if( sumSize == 2 )
+            packed[k+j*sumSize+1] = ImagPart(sums(j));
+    }
+    mpi::AllReduce( packed.data(), packed.size(), mpi::SUM, comm );
+    for( Int j=0; j<k; ++j )
+    {
+        twoNorms(j) = maxAbs(j)*Sqrt(packed[j]);
+        Field sum( packed[k+j*sumSize] );
+        if( sumSize == 2 )
+            SetImagPart( sum, packed[k+j*sumSize+1] );
+        sums(j) = sum;
+    }
+}
+
+template<typename Field>
+void ColumnStats
+( const Matrix<Field>& A,
+        Matrix<Base<Field>>& twoNorms,
+        Matrix<Base<Field>>& maxAbs,
+        Matrix<Field>& sums )
+{
+    EL_DEBUG_CSE
+    Matrix<Base<Field>> scaledSquares;
+    LocalColumnStats( A, scaledSquares, maxAbs, sums );
+    const Int n = A.Width();
+    twoNorms.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+        twoNorms(j) = maxAbs(j)*Sqrt(scaledSquares(j));
+}
+
+template<typename Field,Dist U,Dist V,DistWrap W>
+void ColumnStats
+( const DistMatrix<Field,U,V,W>& A,
+        DistMatrix<Base<Field>,V,STAR,W>& twoNorms,
+        DistMatrix<Base<Field>,V,STAR,W>& maxAbs,
+        DistMatrix<Field,V,STAR,W>& sums )
+{
+    EL_DEBUG_CSE
+    twoNorms.AlignWith( A );
+    maxAbs.AlignWith( A );
+    sums.AlignWith( A );
+    twoNorms.Resize( A.Width(), 1 );
+    maxAbs.Resize( A.Width(), 1 );
+    sums.Resize( A.Width(), 1 );
+    Matrix<Base<Field>> scaledSquares;
+    LocalColumnStats
+    ( A.LockedMatrix(), scaledSquares, maxAbs.Matrix(), sums.Matrix() );
+    StatsAllReduce
+    ( scaledSquares, maxAbs.Matrix(), sums.Matrix(), twoNorms.Matrix(),
+      A.ColComm() );
+}
+
+template<typename Field>
+void ColumnStats
+( const DistMultiVec<Field>& X,
+        Matrix<Base<Field>>& twoNorms,
+        Matrix<Base<Field>>& maxAbs,
+        Matrix<Field>& sums )
+{
+    EL_DEBUG_CSE
+    Matrix<Base<Field>> scaledSquares;
+    LocalColumnStats( X.LockedMatrix(), scaledSquares, maxAbs, sums );
+    StatsAllReduce( scaledSquares, maxAbs, sums, twoNorms, X.Grid().Comm() );
+}
+
+template<typename Field>
+void RowStats
+( const Matrix<Field>& A,
+        Matrix<Base<Field>>& twoNorms,
+        Matrix<Base<Field>>& maxAbs,
+        Matrix<Field>& sums )
+{
+    EL_DEBUG_CSE
+    Matrix<Base<Field>> scaledSquares;
+    LocalRowStats( A, scaledSquares, maxAbs, sums );
+    const Int m = A.Height();
+    twoNorms.Resize( m, 1 );
+    for( Int i=0; i<m; ++i )
+        twoNorms(i) = maxAbs(i)*Sqrt(scaledSquares(i));
+}
+
+template<typename Field,Dist U,Dist V>
+void RowStats
+( const DistMatrix<Field,U,V>& A,
+        DistMatrix<Base<Field>,U,STAR>& twoNorms,
+        DistMatrix<Base<Field>,U,STAR>& maxAbs,
+        DistMatrix<Field,U,STAR>& sums )
+{
+    EL_DEBUG_CSE
+    twoNorms.AlignWith( A );
+    maxAbs.AlignWith( A );
+    sums.AlignWith( A );
+    twoNorms.Resize( A.Height(), 1 );
+    maxAbs.Resize( A.Height(), 1 );
+    sums.Resize( A.Height(), 1 );
+    Matrix<Base<Field>> scaledSquares;
+    LocalRowStats
+    ( A.LockedMatrix(), scaledSquares, maxAbs.Matrix(), sums.Matrix() );
+    StatsAllReduce
+    ( scaledSquares, maxAbs.Matrix(), sums.Matrix(), twoNorms.Matrix(),
+      A.RowComm() );
+}
+
+#define PROTO_DIST(Field,U,V) \
+  template void ColumnStats \
+  ( const DistMatrix<Field,U,V,ELEMENT>& A, \
+          DistMatrix<Base<Field>,V,STAR,ELEMENT>& twoNorms, \
+          DistMatrix<Base<Field>,V,STAR,ELEMENT>& maxAbs, \
+          DistMatrix<Field,V,STAR,ELEMENT>& sums ); \
+  template void ColumnStats \
+  ( const DistMatrix<Field,U,V,BLOCK>& A, \
+          DistMatrix<Base<Field>,V,STAR,BLOCK>& twoNorms, \
+          DistMatrix<Base<Field>,V,STAR,BLOCK>& maxAbs, \
+          DistMatrix<Field,V,STAR,BLOCK>& sums ); \
+  template void RowStats \
+  ( const DistMatrix<Field,U,V>& A, \
+          DistMatrix<Base<Field>,U,STAR>& twoNorms, \
+          DistMatrix<Base<Field>,U,STAR>& maxAbs, \
+          DistMatrix<Field,U,STAR>& sums );
+
+#define PROTO(Field) \
+  template void ColumnStats \
+  ( const Matrix<Field>& A, \
+          Matrix<Base<Field>>& twoNorms, \
+          Matrix<Base<Field>>& maxAbs, \
+          Matrix<Field>& sums ); \
+  template void ColumnStats \
+  ( const DistMultiVec<Field>& X, \
+          Matrix<Base<Field>>& twoNorms, \
+          Matrix<Base<Field>>& maxAbs, \
+          Matrix<Field>& sums ); \
+  template void RowStats \
+  ( const Matrix<Field>& A, \
+          Matrix<Base<Field>>& twoNorms, \
+          Matrix<Base<Field>>& maxAbs, \
+          Matrix<Field>& sums ); \
+  PROTO_DIST(Field,MC,  MR  ) \
+  PROTO_DIST(Field,MC,  STAR) \
+  PROTO_DIST(Field,MD,  STAR) \
+  PROTO_DIST(Field,MR,  MC  ) \
+  PROTO_DIST(Field,MR,  STAR) \
+  PROTO_DIST(Field,STAR,MC  ) \
+  PROTO_DIST(Field,STAR,MD  ) \
+  PROTO_DIST(Field,STAR,MR  ) \
+  PROTO_DIST(Field,STAR,STAR) \
+  PROTO_DIST(Field,STAR,VC  ) \
+  PROTO_DIST(Field,STAR,VR  ) \
+  PROTO_DIST(Field,VC,  STAR) \
+  PROTO_DIST(Field,VR,  STAR)
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
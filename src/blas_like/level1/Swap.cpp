@@ -386,9 +386,9 @@ void SymmetricSwap
             A.Conjugate( from, to );
         // Diagonal swap
         {
-            const T value = A.Get(from,from);
-            A.Set( from, from, A.Get(to,to) );
-            A.Set( to,   to,   value        );
+            const auto values = A.GetMany( {{from,from},{to,to}} );
+            A.Set( from, from, values[1] );
+            A.Set( to,   to,   values[0] );
             if( conjugate )
             {
                 A.MakeReal( to, to );
@@ -426,9 +426,9 @@ void SymmetricSwap
             A.Conjugate( to, from );
         // Diagonal swap
         {
-            const T value = A.Get(from,from);
-            A.Set( from, from, A.Get(to,to) );
-            A.Set( to,   to,   value        );
+            const auto values = A.GetMany( {{from,from},{to,to}} );
+            A.Set( from, from, values[1] );
+            A.Set( to,   to,   values[0] );
             if( conjugate )
             {
                 A.MakeReal( to, to );
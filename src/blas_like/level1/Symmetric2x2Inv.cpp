@@ -11,10 +11,12 @@
 
 namespace El {
 
-template<typename Field>
-void Symmetric2x2Inv( UpperOrLower uplo, Matrix<Field>& D, bool conjugate )
+namespace symm2x2inv {
+
+// Shared by the dynamically and statically sized 2x2 matrices
+template<typename Field,class MatrixType>
+void Inverse( UpperOrLower uplo, MatrixType& D, bool conjugate )
 {
-    EL_DEBUG_CSE
     typedef Base<Field> Real;
     if( uplo == LOWER )
     {
@@ -29,9 +31,9 @@ void Symmetric2x2Inv( UpperOrLower uplo, Matrix<Field>& D, bool conjugate )
             const Field phi21 = delta21 / delta21Abs;
             const Real xi = (Real(1)/(phi21To11*phi21To22-Real(1)))/delta21Abs;
 
-            D.SetRealPart( 0, 0,  xi*phi21To11 );
+            SetRealPart( D(0,0), xi*phi21To11 );
             D(1,0) = -xi*phi21;
-            D.SetRealPart( 1, 1,  xi*phi21To22 );
+            SetRealPart( D(1,1), xi*phi21To22 );
         }
         else
         {
@@ -52,9 +54,28 @@ void Symmetric2x2Inv( UpperOrLower uplo, Matrix<Field>& D, bool conjugate )
         LogicError("This option not yet supported");
 }
 
+} // namespace symm2x2inv
+
+template<typename Field>
+void Symmetric2x2Inv( UpperOrLower uplo, Matrix<Field>& D, bool conjugate )
+{
+    EL_DEBUG_CSE
+    symm2x2inv::Inverse<Field>( uplo, D, conjugate );
+}
+
+template<typename Field>
+void Symmetric2x2Inv
+( UpperOrLower uplo, SmallMatrix<Field,2,2>& D, bool conjugate )
+{
+    EL_DEBUG_CSE
+    symm2x2inv::Inverse<Field>( uplo, D, conjugate );
+}
+
 #define PROTO(Field) \
   template void Symmetric2x2Inv \
-  ( UpperOrLower uplo, Matrix<Field>& A, bool conjugate );
+  ( UpperOrLower uplo, Matrix<Field>& A, bool conjugate ); \
+  template void Symmetric2x2Inv \
+  ( UpperOrLower uplo, SmallMatrix<Field,2,2>& A, bool conjugate );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,422 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+
+namespace El {
+
+namespace top_k {
+
+// Each selection is stored as a list of exactly k (value,index) pairs sorted
+// from best to worst. Lists with fewer than k candidates are padded with
+// entries whose index is -1, which always sort last. Ties in the value are
+// broken in favor of the smaller index so that the result does not depend
+// upon the distribution of the matrix.
+template<typename Real>
+bool Precedes
+( const ValueInt<Real>& a, const ValueInt<Real>& b, bool largest )
+{
+    if( a.index < 0 )
+        return false;
+    if( b.index < 0 )
+        return true;
+    if( a.value != b.value )
+        return largest ? a.value > b.value : a.value < b.value;
+    return a.index < b.index;
+}
+
+template<typename Real>
+void Select
+( vector<ValueInt<Real>>& candidates, Int k, bool largest,
+  ValueInt<Real>* list )
+{
+    EL_DEBUG_CSE
+    const Int numKept = Min( k, Int(candidates.size()) );
+    std::partial_sort
+    ( candidates.begin(), candidates.begin()+numKept, candidates.end(),
+      [&]( const ValueInt<Real>& a, const ValueInt<Real>& b )
+      { return Precedes( a, b, largest ); } );
+    for( Int t=0; t<numKept; ++t )
+        list[t] = candidates[t];
+    for( Int t=numKept; t<k; ++t )
+    {
+        list[t].value = 0;
+        list[t].index = -1;
+    }
+}
+
+// Overwrite each of the 'numLists' lists with the best k entries of itself
+// and the corresponding list in 'otherLists'
+template<typename Real>
+void Merge
+( Int numLists, Int k, bool largest,
+        ValueInt<Real>* lists,
+  const ValueInt<Real>* otherLists,
+        vector<ValueInt<Real>>& work )
+{
+    EL_DEBUG_CSE
+    work.resize( k );
+    for( Int l=0; l<numLists; ++l )
+    {
+        ValueInt<Real>* list = &lists[l*k];
+        const ValueInt<Real>* otherList = &otherLists[l*k];
+        Int s=0, t=0;
+        for( Int r=0; r<k; ++r )
+        {
+            if( Precedes( otherList[t], list[s], largest ) )
+                work[r] = otherList[t++];
+            else
+                work[r] = list[s++];
+        }
+        std::copy( work.begin(), work.end(), list );
+    }
+}
+
+// Replace the lists on each process with the merge of the lists from every
+// process in the communicator. A binomial tree of pairwise merges is used
+// (rather than a user-defined MPI operation) so that each message carries
+// all of the lists at once and every level only moves k entries per list.
+template<typename Real>
+void AllMerge
+( vector<ValueInt<Real>>& lists, Int numLists, Int k, bool largest,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    if( commSize == 1 || numLists*k == 0 )
+        return;
+    const int commRank = mpi::Rank( comm );
+    const Int size = numLists*k;
+
+    vector<ValueInt<Real>> otherLists( size ), work;
+    for( int mask=1; mask<commSize; mask<<=1 )
+    {
+        if( commRank & mask )
+        {
+            mpi::Send( lists.data(), size, commRank-mask, comm );
+            break;
+        }
+        else if( commRank+mask < commSize )
+        {
+            mpi::Recv( otherLists.data(), size, commRank+mask, comm );
+            Merge
+            ( numLists, k, largest, lists.data(), otherLists.data(), work );
+        }
+    }
+    mpi::Broadcast( lists.data(), size, 0, comm );
+}
+
+// Form the sorted lists for each column of a local matrix, where the i'th
+// local row has the global row index rowInds[i]
+template<typename Ring>
+void LocalColumnLists
+( const Matrix<Ring>& A, const vector<Int>& rowInds, Int k, bool largest,
+  vector<ValueInt<Base<Ring>>>& lists )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Ring* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    lists.resize( n*k );
+    vector<ValueInt<Base<Ring>>> candidates( m );
+    for( Int j=0; j<n; ++j )
+    {
+        const Ring* aCol = &ABuf[j*ALDim];
+        for( Int i=0; i<m; ++i )
+        {
+            candidates[i].value = Abs(aCol[i]);
+            candidates[i].index = rowInds[i];
+        }
+        Select( candidates, k, largest, &lists[j*k] );
+    }
+}
+
+// Form the sorted lists for each row of a local matrix, where the j'th
+// local column has the global column index colInds[j]
+template<typename Ring>
+void LocalRowLists
+( const Matrix<Ring>& A, const vector<Int>& colInds, Int k, bool largest,
+  vector<ValueInt<Base<Ring>>>& lists )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Ring* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    lists.resize( m*k );
+    vector<ValueInt<Base<Ring>>> candidates( n );
+    for( Int i=0; i<m; ++i )
+    {
+        for( Int j=0; j<n; ++j )
+        {
+            candidates[j].value = Abs(ABuf[i+j*ALDim]);
+            candidates[j].index = colInds[j];
+        }
+        Select( candidates, k, largest, &lists[i*k] );
+    }
+}
+
+template<typename Real>
+vector<Entry<Real>>
+ListToEntries( const vector<ValueInt<Real>>& list, Int height )
+{
+    vector<Entry<Real>> entries;
+    for( const auto& candidate : list )
+    {
+        if( candidate.index < 0 )
+            break;
+        entries.push_back
+        ( Entry<Real>
+          { candidate.index % height, candidate.index / height,
+            candidate.value } );
+    }
+    return entries;
+}
+
+} // namespace top_k
+
+template<typename Ring>
+vector<Entry<Base<Ring>>>
+TopKAbs( const Matrix<Ring>& A, Int k, bool largest )
+{
+    EL_DEBUG_CSE
+    if( k < 0 )
+        LogicError("k must be non-negative");
+    typedef Base<Ring> RealRing;
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    vector<ValueInt<RealRing>> candidates( m*n );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            candidates[i+j*m].value = Abs(A(i,j));
+            candidates[i+j*m].index = i + j*m;
+        }
+    }
+    vector<ValueInt<RealRing>> list( k );
+    top_k::Select( candidates, k, largest, list.data() );
+    return top_k::ListToEntries( list, m );
+}
+
+template<typename Ring>
+vector<Entry<Base<Ring>>>
+TopKAbs( const AbstractDistMatrix<Ring>& A, Int k, bool largest )
+{
+    EL_DEBUG_CSE
+    if( k < 0 )
+        LogicError("k must be non-negative");
+    typedef Base<Ring> RealRing;
+    const Int m = A.Height();
+
+    vector<ValueInt<RealRing>> list( k );
+    if( A.Participating() )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const Matrix<Ring>& ALoc = A.LockedMatrix();
+        vector<ValueInt<RealRing>> candidates( localHeight*localWidth );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Int i = A.GlobalRow(iLoc);
+                auto& candidate = candidates[iLoc+jLoc*localHeight];
+                candidate.value = Abs(ALoc(iLoc,jLoc));
+                candidate.index = i + j*m;
+            }
+        }
+        top_k::Select( candidates, k, largest, list.data() );
+        top_k::AllMerge( list, 1, k, largest, A.DistComm() );
+    }
+    if( k > 0 )
+        mpi::Broadcast( list.data(), k, A.Root(), A.CrossComm() );
+    return top_k::ListToEntries( list, m );
+}
+
+template<typename Ring>
+void ColumnTopKAbs
+( const Matrix<Ring>& A, Int k,
+  Matrix<Int>& rowInds, Matrix<Base<Ring>>& values, bool largest )
+{
+    EL_DEBUG_CSE
+    if( k < 0 )
+        LogicError("k must be non-negative");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    vector<Int> globalRowInds( m );
+    for( Int i=0; i<m; ++i )
+        globalRowInds[i] = i;
+    vector<ValueInt<Base<Ring>>> lists;
+    top_k::LocalColumnLists( A, globalRowInds, k, largest, lists );
+
+    rowInds.Resize( k, n );
+    values.Resize( k, n );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int t=0; t<k; ++t )
+        {
+            rowInds(t,j) = lists[t+j*k].index;
+            values(t,j) = lists[t+j*k].value;
+        }
+    }
+}
+
+template<typename Ring,Dist U,Dist V>
+void ColumnTopKAbs
+( const DistMatrix<Ring,U,V>& A, Int k,
+  DistMatrix<Int,STAR,V>& rowInds,
+  DistMatrix<Base<Ring>,STAR,V>& values, bool largest )
+{
+    EL_DEBUG_CSE
+    if( k < 0 )
+        LogicError("k must be non-negative");
+    const Int n = A.Width();
+    rowInds.AlignWith( A );
+    values.AlignWith( A );
+    rowInds.Resize( k, n );
+    values.Resize( k, n );
+    if( !A.Participating() )
+        return;
+
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    vector<Int> globalRowInds( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        globalRowInds[iLoc] = A.GlobalRow(iLoc);
+    vector<ValueInt<Base<Ring>>> lists;
+    top_k::LocalColumnLists
+    ( A.LockedMatrix(), globalRowInds, k, largest, lists );
+    top_k::AllMerge( lists, localWidth, k, largest, A.ColComm() );
+
+    auto& rowIndsLoc = rowInds.Matrix();
+    auto& valuesLoc = values.Matrix();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        for( Int t=0; t<k; ++t )
+        {
+            rowIndsLoc(t,jLoc) = lists[t+jLoc*k].index;
+            valuesLoc(t,jLoc) = lists[t+jLoc*k].value;
+        }
+    }
+}
+
+template<typename Ring>
+void RowTopKAbs
+( const Matrix<Ring>& A, Int k,
+  Matrix<Int>& colInds, Matrix<Base<Ring>>& values, bool largest )
+{
+    EL_DEBUG_CSE
+    if( k < 0 )
+        LogicError("k must be non-negative");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    vector<Int> globalColInds( n );
+    for( Int j=0; j<n; ++j )
+        globalColInds[j] = j;
+    vector<ValueInt<Base<Ring>>> lists;
+    top_k::LocalRowLists( A, globalColInds, k, largest, lists );
+
+    colInds.Resize( m, k );
+    values.Resize( m, k );
+    for( Int t=0; t<k; ++t )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            colInds(i,t) = lists[t+i*k].index;
+            values(i,t) = lists[t+i*k].value;
+        }
+    }
+}
+
+template<typename Ring,Dist U,Dist V>
+void RowTopKAbs
+( const DistMatrix<Ring,U,V>& A, Int k,
+  DistMatrix<Int,U,STAR>& colInds,
+  DistMatrix<Base<Ring>,U,STAR>& values, bool largest )
+{
+    EL_DEBUG_CSE
+    if( k < 0 )
+        LogicError("k must be non-negative");
+    const Int m = A.Height();
+    colInds.AlignWith( A );
+    values.AlignWith( A );
+    colInds.Resize( m, k );
+    values.Resize( m, k );
+    if( !A.Participating() )
+        return;
+
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    vector<Int> globalColInds( localWidth );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        globalColInds[jLoc] = A.GlobalCol(jLoc);
+    vector<ValueInt<Base<Ring>>> lists;
+    top_k::LocalRowLists
+    ( A.LockedMatrix(), globalColInds, k, largest, lists );
+    top_k::AllMerge( lists, localHeight, k, largest, A.RowComm() );
+
+    auto& colIndsLoc = colInds.Matrix();
+    auto& valuesLoc = values.Matrix();
+    for( Int t=0; t<k; ++t )
+    {
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            colIndsLoc(iLoc,t) = lists[t+iLoc*k].index;
+            valuesLoc(iLoc,t) = lists[t+iLoc*k].value;
+        }
+    }
+}
+
+#define PROTO_DIST(Ring,U,V) \
+  template void ColumnTopKAbs \
+  ( const DistMatrix<Ring,U,V>& A, Int k, \
+    DistMatrix<Int,STAR,V>& rowInds, \
+    DistMatrix<Base<Ring>,STAR,V>& values, bool largest ); \
+  template void RowTopKAbs \
+  ( const DistMatrix<Ring,U,V>& A, Int k, \
+    DistMatrix<Int,U,STAR>& colInds, \
+    DistMatrix<Base<Ring>,U,STAR>& values, bool largest );
+
+#define PROTO(Ring) \
+  template vector<Entry<Base<Ring>>> TopKAbs \
+  ( const Matrix<Ring>& A, Int k, bool largest ); \
+  template vector<Entry<Base<Ring>>> TopKAbs \
+  ( const AbstractDistMatrix<Ring>& A, Int k, bool largest ); \
+  template void ColumnTopKAbs \
+  ( const Matrix<Ring>& A, Int k, \
+    Matrix<Int>& rowInds, Matrix<Base<Ring>>& values, bool largest ); \
+  template void RowTopKAbs \
+  ( const Matrix<Ring>& A, Int k, \
+    Matrix<Int>& colInds, Matrix<Base<Ring>>& values, bool largest ); \
+  PROTO_DIST(Ring,MC,  MR  ) \
+  PROTO_DIST(Ring,MC,  STAR) \
+  PROTO_DIST(Ring,MD,  STAR) \
+  PROTO_DIST(Ring,MR,  MC  ) \
+  PROTO_DIST(Ring,MR,  STAR) \
+  PROTO_DIST(Ring,STAR,MC  ) \
+  PROTO_DIST(Ring,STAR,MD  ) \
+  PROTO_DIST(Ring,STAR,MR  ) \
+  PROTO_DIST(Ring,STAR,STAR) \
+  PROTO_DIST(Ring,STAR,VC  ) \
+  PROTO_DIST(Ring,STAR,VR  ) \
+  PROTO_DIST(Ring,VC,  STAR) \
+  PROTO_DIST(Ring,VR,  STAR)
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
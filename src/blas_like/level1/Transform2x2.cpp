@@ -109,6 +109,18 @@ void Transform2x2Rows
     Transform2x2( G, a1, a2 );
 }
 
+template<typename Ring>
+void Transform2x2Rows
+( const SmallMatrix<Ring,2,2>& G,
+        Matrix<Ring>& A, Int i1, Int i2 )
+{
+    EL_DEBUG_CSE
+    const Int ALDim = A.LDim();
+    Transform2x2
+    ( A.Width(), G(0,0), G(0,1), G(1,0), G(1,1),
+      A.Buffer(i1,0), ALDim, A.Buffer(i2,0), ALDim );
+}
+
 template<typename Ring>
 void Transform2x2Rows
 ( const Matrix<Ring>& G, AbstractDistMatrix<Ring>& A, Int i1, Int i2 )
@@ -192,6 +204,17 @@ void Transform2x2Cols
       A.Buffer(0,i1), 1, A.Buffer(0,i2), 1 );
 }
 
+template<typename Ring>
+void Transform2x2Cols
+( const SmallMatrix<Ring,2,2>& G,
+        Matrix<Ring>& A, Int j1, Int j2 )
+{
+    EL_DEBUG_CSE
+    Transform2x2
+    ( A.Height(), G(0,0), G(1,0), G(0,1), G(1,1),
+      A.Buffer(0,j1), 1, A.Buffer(0,j2), 1 );
+}
+
 template<typename Ring>
 void Transform2x2Cols
 ( const Matrix<Ring>& G, AbstractDistMatrix<Ring>& A, Int j1, Int j2 )
@@ -288,6 +311,9 @@ void Transform2x2Cols
   template void Transform2x2Rows \
   ( const AbstractDistMatrix<Ring>& G, \
           AbstractDistMatrix<Ring>& A, Int i1, Int i2 ); \
+  template void Transform2x2Rows \
+  ( const SmallMatrix<Ring,2,2>& G, \
+          Matrix<Ring>& A, Int i1, Int i2 ); \
   template void Transform2x2Cols \
   ( const Matrix<Ring>& G, \
           Matrix<Ring>& A, Int j1, Int j2 ); \
@@ -296,7 +322,10 @@ void Transform2x2Cols
           AbstractDistMatrix<Ring>& A, Int j1, Int j2 ); \
   template void Transform2x2Cols \
   ( const AbstractDistMatrix<Ring>& G, \
-          AbstractDistMatrix<Ring>& A, Int j1, Int j2 );
+          AbstractDistMatrix<Ring>& A, Int j1, Int j2 ); \
+  template void Transform2x2Cols \
+  ( const SmallMatrix<Ring,2,2>& G, \
+          Matrix<Ring>& A, Int j1, Int j2 );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -16,46 +16,46 @@ namespace El {
 // TODO: Optimized versions which avoid temporaries and/or directly work on the
 // underlying raw data buffers
 
-template<typename F,typename=DisableIf<IsReal<F>>>
-void ApplyVariableLeft
-( Int i,
-  const Base<F>& c,
-  const F& s,
-        Matrix<F>& A,
-        F& tmp,
-  const Base<F>& one=Base<F>(1),
-  const F& zeroF=F(0) )
+// Apply the rotation which ApplyGivensSequence applies to rows (or columns)
+// i and i+1 to the pair (alpha0,alpha1) of their entries
+template<typename F,typename SineType>
+inline void RotatePair
+( const Base<F>& c, const SineType& s, F& alpha0, F& alpha1 )
 {
-    if( c == one && s == zeroF )
-        return;
-    const Int n = A.Width();
-    const F sConj = Conj(s);
-    for( Int j=0; j<n; ++j )
-    {
-        tmp = A(i+1,j);
-        A(i+1,j) = c*tmp - sConj*A(i,j);
-        A(i,  j) = s*tmp +     c*A(i,j);
-    }
+    const F tmp = alpha1;
+    alpha1 = c*tmp - Conj(s)*alpha0;
+    alpha0 = s*tmp +       c*alpha0;
 }
 
-template<typename F>
+// Apply a variable sequence from the left one column at a time. Each
+// (contiguous) column then receives every rotation while it is in cache,
+// rather than each rotation streaming a pair of rows (with stride A.LDim())
+// through the cache. Rotations of distinct columns commute, so the result
+// is unchanged.
+template<typename F,typename SineType>
 void ApplyVariableLeft
-( Int i,
-  const Base<F>& c,
-  const Base<F>& s,
-        Matrix<F>& A,
-        F& tmp,
-  const Base<F>& one=Base<F>(1),
-  const Base<F>& zero=Base<F>(0) )
+( ForwardOrBackward direction,
+  const Matrix<Base<F>>& cList,
+  const Matrix<SineType>& sList,
+        Matrix<F>& A )
 {
-    if( c == one && s == zero )
-        return;
+    typedef Base<F> Real;
+    const Real one(1);
+    const SineType zero(0);
+    const Int m = A.Height();
     const Int n = A.Width();
     for( Int j=0; j<n; ++j )
     {
-        tmp = A(i+1,j);
-        A(i+1,j) = c*tmp - s*A(i,j);
-        A(i,  j) = s*tmp + c*A(i,j);
+        F* a = A.Buffer(0,j);
+        for( Int k=0; k<m-1; ++k )
+        {
+            const Int i = ( direction == FORWARD ? k : m-2-k );
+            const Real& c = cList(i);
+            const SineType& s = sList(i);
+            if( c == one && s == zero )
+                continue;
+            RotatePair( c, s, a[i], a[i+1] );
+        }
     }
 }
 
@@ -300,22 +300,7 @@ void ApplyGivensSequence
     {
         if( seqType == VARIABLE_GIVENS_SEQUENCE )
         {
-            if( direction == FORWARD )
-            {
-                for( Int i=0; i<m-1; ++i )
-                {
-                    ApplyVariableLeft
-                    ( i, cList(i), sList(i), A, tmp, one, zeroF );
-                }
-            }
-            else
-            {
-                for( Int i=m-2; i>=0; --i )
-                {
-                    ApplyVariableLeft
-                    ( i, cList(i), sList(i), A, tmp, one, zeroF );
-                }
-            }
+            ApplyVariableLeft( direction, cList, sList, A );
         }
         else if( seqType == TOP_GIVENS_SEQUENCE )
         {
@@ -439,22 +424,7 @@ void ApplyGivensSequence
     {
         if( seqType == VARIABLE_GIVENS_SEQUENCE )
         {
-            if( direction == FORWARD )
-            {
-                for( Int i=0; i<m-1; ++i )
-                {
-                    ApplyVariableLeft
-                    ( i, cList(i), sList(i), A, tmp, one, zero );
-                }
-            }
-            else
-            {
-                for( Int i=m-2; i>=0; --i )
-                {
-                    ApplyVariableLeft
-                    ( i, cList(i), sList(i), A, tmp, one, zero );
-                }
-            }
+            ApplyVariableLeft( direction, cList, sList, A );
         }
         else if( seqType == TOP_GIVENS_SEQUENCE )
         {
@@ -557,12 +527,111 @@ void ApplyGivensSequence
     }
 }
 
+template<typename F>
+GivensSequenceQueue<F>::GivensSequenceQueue( Matrix<F>& A, Int maxQueued )
+: A_(A), maxQueued_(Max(maxQueued,Int(1)))
+{ }
+
+template<typename F>
+void GivensSequenceQueue<F>::Push
+( ForwardOrBackward direction, Int offset,
+  const Matrix<Base<F>>& cList,
+  const Matrix<Base<F>>& sList )
+{
+    EL_DEBUG_CSE
+    const Int length = cList.Height();
+    EL_DEBUG_ONLY(
+      if( sList.Height() != length )
+          LogicError("cList and sList must be the same length");
+      if( offset < 0 || offset+length+1 > A_.Width() )
+          LogicError
+          ("Sequence of length ",length," at offset ",offset,
+           " does not fit within ",A_.Width()," columns");
+    )
+    if( length == 0 )
+        return;
+    Sequence sequence;
+    sequence.direction = direction;
+    sequence.offset = offset;
+    sequence.length = length;
+    sequence.start = cList_.size();
+    for( Int k=0; k<length; ++k )
+    {
+        cList_.push_back( cList(k) );
+        sList_.push_back( sList(k) );
+    }
+    sequences_.push_back( sequence );
+    if( NumQueued() >= maxQueued_ )
+        Flush();
+}
+
+template<typename F>
+void GivensSequenceQueue<F>::PushRotation
+( Int j, const Base<F>& c, const Base<F>& s )
+{
+    EL_DEBUG_CSE
+    Matrix<Base<F>> cList(1,1), sList(1,1);
+    cList(0) = c;
+    sList(0) = s;
+    Push( FORWARD, j, cList, sList );
+}
+
+template<typename F>
+void GivensSequenceQueue<F>::Flush()
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real one(1), zero(0);
+    const Int m = A_.Height();
+    const Int n = A_.Width();
+    const Int numRotations = cList_.size();
+    if( m > 0 && numRotations > 0 )
+    {
+        // Aim for panels of roughly 256 KB
+        const Int panelEntries = Int(1 << 18) / Int(sizeof(F));
+        const Int panelHeight =
+          Min( m, Max( Int(8), panelEntries/Max(n,Int(1)) ) );
+        const Int numPanels = (m+panelHeight-1) / panelHeight;
+        F* ABuf = A_.Buffer();
+        const Int ALDim = A_.LDim();
+        const Real* cBuf = cList_.data();
+        const Real* sBuf = sList_.data();
+
+        EL_PARALLEL_FOR_GRAIN(m*numRotations)
+        for( Int t=0; t<numPanels; ++t )
+        {
+            const Int iBeg = t*panelHeight;
+            const Int mPanel = Min( panelHeight, m-iBeg );
+            for( const auto& sequence : sequences_ )
+            {
+                for( Int k=0; k<sequence.length; ++k )
+                {
+                    const Int l = ( sequence.direction == FORWARD ?
+                                    k : sequence.length-1-k );
+                    const Real& c = cBuf[sequence.start+l];
+                    const Real& s = sBuf[sequence.start+l];
+                    if( c == one && s == zero )
+                        continue;
+                    F* a0 = &ABuf[iBeg+(sequence.offset+l)*ALDim];
+                    F* a1 = a0 + ALDim;
+                    for( Int i=0; i<mPanel; ++i )
+                        RotatePair( c, s, a0[i], a1[i] );
+                }
+            }
+        }
+    }
+    sequences_.clear();
+    cList_.clear();
+    sList_.clear();
+}
+
 #define PROTO_REAL(F) \
   template void ApplyGivensSequence \
   ( LeftOrRight side, GivensSequenceType seqType, ForwardOrBackward direction, \
     const Matrix<Base<F>>& cList, \
     const Matrix<Base<F>>& sList, \
-    Matrix<F>& A );
+    Matrix<F>& A ); \
+  template class GivensSequenceQueue<F>;
 
 #define PROTO(F) \
   PROTO_REAL(F) \
@@ -13,6 +13,7 @@
 #include "./QuasiTrsv/LT.hpp"
 #include "./QuasiTrsv/UN.hpp"
 #include "./QuasiTrsv/UT.hpp"
+#include "./Trsv/Replicated.hpp"
 
 namespace El {
 
@@ -41,24 +42,44 @@ void QuasiTrsv
 template<typename F>
 void QuasiTrsv
 ( UpperOrLower uplo, Orientation orientation, 
-  const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& x, 
+  const AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& x, 
   bool checkIfSingular )
 {
     EL_DEBUG_CSE
-    if( uplo == LOWER )
-    {
-        if( orientation == NORMAL )
-            quasitrsv::LN( A, x, checkIfSingular );
-        else
-            quasitrsv::LT( orientation, A, x, checkIfSingular );
-    }
-    else
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, x );
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( x.Width() != 1 && x.Height() != 1 )
+          LogicError("x must be a vector");
+      const Int xLength = ( x.Width() == 1 ? x.Height() : x.Width() );
+      if( APre.Width() != xLength )
+          LogicError("Nonconformal");
+    )
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Int m = A.Height();
+
+    // Extend any block which would otherwise split a 2x2 diagonal block,
+    // i.e., when the entry coupling rows/columns k-1 and k is nonzero
+    DistMatrix<F,STAR,STAR> coupling( A.Grid() );
+    GetDiagonal( A, coupling, ( uplo==LOWER ? 1 : -1 ) );
+    const Int bsize = Blocksize();
+    vector<Int> bounds( 1, 0 );
+    Int k=0;
+    while( k < m )
     {
-        if( orientation == NORMAL )
-            quasitrsv::UN( A, x, checkIfSingular );
-        else
-            quasitrsv::UT( orientation, A, x, checkIfSingular );
+        k = Min( k+bsize, m );
+        if( k < m && coupling.Participating() &&
+            coupling.GetLocal(k-1,0) != F(0) )
+            ++k;
+        bounds.push_back( k );
     }
+
+    auto localSolve =
+      [&]( const Matrix<F>& A11, Matrix<F>& x1 )
+      { QuasiTrsv( uplo, orientation, A11, x1, checkIfSingular ); };
+    trsv::Replicated( uplo, orientation, A, x, bounds, localSolve );
 }
 
 #define PROTO(F) \
@@ -143,135 +143,5 @@ void LN( const Matrix<F>& L, Matrix<F>& x, bool checkIfSingular=false )
     }
 }
 
-template<typename F>
-void LN
-( const AbstractDistMatrix<F>& LPre,
-        AbstractDistMatrix<F>& xPre, 
-  bool checkIfSingular=false )
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      AssertSameGrids( LPre, xPre );
-      if( LPre.Height() != LPre.Width() )
-          LogicError("L must be square");
-      if( xPre.Width() != 1 && xPre.Height() != 1 )
-          LogicError("x must be a vector");
-      const Int xLength = 
-          ( xPre.Width() == 1 ? xPre.Height() : xPre.Width() );
-      if( LPre.Width() != xLength )
-          LogicError("Nonconformal");
-    )
-    const Int m = LPre.Height();
-    const Int bsize = Blocksize();
-    const Grid& g = LPre.Grid();
-
-    DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
-    DistMatrixReadWriteProxy<F,F,MC,MR> xProx( xPre );
-    auto& L = LProx.GetLocked();
-    auto& x = xProx.Get();
-
-    // Matrix views 
-    DistMatrix<F> L11(g), L21(g), x1(g);
-
-    // Temporary distributions
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), x1_STAR_STAR(g);
-
-    if( x.Width() == 1 )
-    {
-        DistMatrix<F,MR,STAR> x1_MR_STAR(g);
-        DistMatrix<F,MC,STAR> z_MC_STAR(g);
-
-        // Views of z[MC,* ], which will store updates to x
-        DistMatrix<F,MC,STAR> z1_MC_STAR(g), z2_MC_STAR(g);
-
-        z_MC_STAR.AlignWith( L );
-        z_MC_STAR.Resize( m, 1 );
-        Zero( z_MC_STAR );
-
-        Int k=0;
-        while( k < m )
-        {
-            const Int nbProp = Min(bsize,m-k);
-            const bool in2x2 = 
-                ( k+nbProp<m && L.Get(k+nbProp-1,k+nbProp) != F(0) );
-            const Int nb = ( in2x2 ? nbProp+1 : nbProp );
-
-            LockedView( L11, L, k,    k, k+nb, k+nb );
-            LockedView( L21, L, k+nb, k, m,    k+nb );
-
-            View( x1, x, k,    0, k+nb, 1 );
-
-            View( z1_MC_STAR, z_MC_STAR, k,    0, k+nb, 1 );
-            View( z2_MC_STAR, z_MC_STAR, k+nb, 0, m,    1 ); 
-
-            if( k != 0 )
-                AxpyContract( F(1), z1_MC_STAR, x1 );
-
-            x1_STAR_STAR = x1;
-            L11_STAR_STAR = L11;
-            quasitrsv::LN
-            ( L11_STAR_STAR.LockedMatrix(), x1_STAR_STAR.Matrix(), 
-              checkIfSingular );
-            x1 = x1_STAR_STAR;
-
-            x1_MR_STAR.AlignWith( L21 );
-            x1_MR_STAR = x1_STAR_STAR;
-            LocalGemv( NORMAL, F(-1), L21, x1_MR_STAR, F(1), z2_MC_STAR );
-
-            k += nb;
-        }
-    }
-    else
-    {
-        DistMatrix<F,STAR,MR> x1_STAR_MR(g);
-        DistMatrix<F,MR,  MC> z1_MR_MC(g);
-        DistMatrix<F,STAR,MC> z_STAR_MC(g);
-
-        // Views of z[* ,MC]
-        DistMatrix<F,STAR,MC> z1_STAR_MC(g), z2_STAR_MC(g);
-
-        z_STAR_MC.AlignWith( L );
-        z_STAR_MC.Resize( 1, m );
-        Zero( z_STAR_MC );
-
-        Int k=0;
-        while( k < m )
-        {
-            const Int nbProp = Min(bsize,m-k);
-            const bool in2x2 = 
-                ( k+nbProp<m && L.Get(k+nbProp-1,k+nbProp) != F(0) );
-            const Int nb = ( in2x2 ? nbProp+1 : nbProp );
-            const IR ind1( k, k+nb ), ind2( k+nb, END );
-
-            LockedView( L11, L, ind1, ind1 );
-            LockedView( L21, L, ind2, ind1 );
-
-            View( x1, x, ALL, ind1 );
-
-            View( z1_STAR_MC, z_STAR_MC, ALL, ind1 );
-            View( z2_STAR_MC, z_STAR_MC, ALL, ind2 );
-
-            if( k != 0 )
-            {
-                Contract( z1_STAR_MC, z1_MR_MC );
-                x1 += z1_MR_MC;
-            }
-
-            x1_STAR_STAR = x1;
-            L11_STAR_STAR = L11;
-            quasitrsv::LN
-            ( L11_STAR_STAR.LockedMatrix(), x1_STAR_STAR.Matrix(), 
-              checkIfSingular );
-            x1 = x1_STAR_STAR;
-
-            x1_STAR_MR.AlignWith( L21 );
-            x1_STAR_MR = x1_STAR_STAR;
-            LocalGemv( NORMAL, F(-1), L21, x1_STAR_MR, F(1), z2_STAR_MC );
-
-            k += nb;
-        }
-    }
-}
-
 } // namespace quasitrsv
 } // namespace El
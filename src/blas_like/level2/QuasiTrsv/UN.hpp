@@ -141,142 +141,5 @@ void UN( const Matrix<F>& U, Matrix<F>& x, bool checkIfSingular=false )
     }
 }
 
-template<typename F>
-void UN
-( const AbstractDistMatrix<F>& UPre,
-        AbstractDistMatrix<F>& xPre,
-  bool checkIfSingular=false )
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      AssertSameGrids( UPre, xPre );
-      if( UPre.Height() != UPre.Width() )
-          LogicError("U must be square");
-      if( xPre.Width() != 1 && xPre.Height() != 1 )
-          LogicError("x must be a vector");
-      const Int xLength = 
-          ( xPre.Width() == 1 ? xPre.Height() : xPre.Width() );
-      if( UPre.Width() != xLength )
-          LogicError("Nonconformal");
-    )
-    const Int m = UPre.Height();
-    const Int bsize = Blocksize();
-    const Int kLast = LastOffset( m, bsize );
-    const Grid& g = UPre.Grid();
-
-    DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
-    DistMatrixReadWriteProxy<F,F,MC,MR> xProx( xPre );
-    auto& U = UProx.GetLocked();
-    auto& x = xProx.Get();
-
-    // Matrix views 
-    DistMatrix<F> U01(g), U11(g), x1(g);
-
-    // Temporary distributions
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), x1_STAR_STAR(g);
-
-    if( x.Width() == 1 )
-    {
-        DistMatrix<F,MR,STAR> x1_MR_STAR(g);
-        DistMatrix<F,MC,STAR> z_MC_STAR(g);
-
-        // Views of z[MC,* ], which will store updates to x
-        DistMatrix<F,MC,STAR> z0_MC_STAR(g), z1_MC_STAR(g);
-
-        z_MC_STAR.AlignWith( U );
-        z_MC_STAR.Resize( m, 1 );
-        Zero( z_MC_STAR );
-
-        Int k=kLast, kOld=m;
-        while( true )
-        {
-            const bool in2x2 = ( k>0 && U.Get(k,k-1) != F(0) );
-            if( in2x2 )
-                --k;
-            const IR ind0( 0, k ), ind1( k, kOld );
-
-            LockedView( U01, U, ind0, ind1 );
-            LockedView( U11, U, ind1, ind1 );
-
-            View( x1, x, ind1, ALL );
-
-            View( z0_MC_STAR, z_MC_STAR, ind0, ALL );
-            View( z1_MC_STAR, z_MC_STAR, ind1, ALL );
-
-            if( kOld != m )
-                AxpyContract( F(1), z1_MC_STAR, x1 );
-
-            x1_STAR_STAR = x1;
-            U11_STAR_STAR = U11;
-            quasitrsv::UN
-            ( U11_STAR_STAR.LockedMatrix(), x1_STAR_STAR.Matrix(), 
-              checkIfSingular );
-            x1 = x1_STAR_STAR;
-
-            x1_MR_STAR.AlignWith( U01 );
-            x1_MR_STAR = x1_STAR_STAR;
-            LocalGemv( NORMAL, F(-1), U01, x1_MR_STAR, F(1), z0_MC_STAR );
-
-            if( k == 0 )
-                break;
-            kOld = k;
-            k -= Min(bsize,k);
-        }
-    }
-    else
-    {
-        DistMatrix<F,STAR,MR  > x1_STAR_MR(g);
-        DistMatrix<F,MC,  MR  > z1(g);
-        DistMatrix<F,MR,  MC  > z1_MR_MC(g);
-        DistMatrix<F,STAR,MC  > z_STAR_MC(g);
-
-        // Views of z[* ,MC]
-        DistMatrix<F,STAR,MC> z0_STAR_MC(g), z1_STAR_MC(g);
-
-        z_STAR_MC.AlignWith( U );
-        z_STAR_MC.Resize( 1, m );
-        Zero( z_STAR_MC );
-
-        Int k=kLast, kOld=m;
-        while( true )
-        {
-            const bool in2x2 = ( k>0 && U.Get(k,k-1) != F(0) );
-            if( in2x2 )
-                --k;
-            const IR ind0( 0, k ), ind1( k, kOld );
-
-            LockedView( U01, U, ind0, ind1 );
-            LockedView( U11, U, ind1, ind1 );
-
-            View( x1, x, ALL, ind1 );
-
-            View( z0_STAR_MC, z_STAR_MC, ALL, ind0 );
-            View( z1_STAR_MC, z_STAR_MC, ALL, ind1 );
-
-            if( kOld != m )
-            {
-                Contract( z1_STAR_MC, z1_MR_MC );
-                x1 += z1_MR_MC;
-            }
-
-            x1_STAR_STAR = x1;
-            U11_STAR_STAR = U11;
-            quasitrsv::UN
-            ( U11_STAR_STAR.LockedMatrix(), x1_STAR_STAR.Matrix(),
-              checkIfSingular );
-            x1 = x1_STAR_STAR;
-
-            x1_STAR_MR.AlignWith( U01 );
-            x1_STAR_MR = x1_STAR_STAR;
-            LocalGemv( NORMAL, F(-1), U01, x1_STAR_MR, F(1), z0_STAR_MC );
-
-            if( k == 0 )
-                break;
-            kOld = k;
-            k -= Min(bsize,k);
-        }
-    }
-}
-
 } // namespace quasitrsv
 } // namespace El
@@ -163,144 +163,5 @@ void UT
         Conjugate( x );
 }
 
-template<typename F>
-void UT
-( Orientation orientation, 
-  const AbstractDistMatrix<F>& UPre,
-        AbstractDistMatrix<F>& xPre,
-  bool checkIfSingular=false )
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      AssertSameGrids( UPre, xPre );
-      if( UPre.Height() != UPre.Width() )
-          LogicError("U must be square");
-      if( xPre.Width() != 1 && xPre.Height() != 1 )
-          LogicError("x must be a vector");
-      const Int xLength = 
-          ( xPre.Width() == 1 ? xPre.Height() : xPre.Width() );
-      if( UPre.Width() != xLength )
-          LogicError("Nonconformal");
-      if( orientation == NORMAL )
-          LogicError("Invalid orientation");
-    )
-    const Int m = UPre.Height();
-    const Int bsize = Blocksize();
-    const Grid& g = UPre.Grid();
-    const bool conjugate = ( orientation==ADJOINT );
-    if( conjugate )
-        Conjugate( xPre );
-
-    DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
-    DistMatrixReadWriteProxy<F,F,MC,MR> xProx( xPre );
-    auto& U = UProx.GetLocked();
-    auto& x = xProx.Get();
-
-    // Matrix views 
-    DistMatrix<F> U11(g), U12(g), x1(g);
-
-    // Temporary distributions
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), x1_STAR_STAR(g);
-
-    if( x.Width() == 1 )
-    {
-        DistMatrix<F,MR,STAR> x1_MR_STAR(g);
-        DistMatrix<F,MC,STAR> z_MC_STAR(g);
-
-        // Views of z[MC,* ], which will store updates to x
-        DistMatrix<F,MC,STAR> z1_MC_STAR(g), z2_MC_STAR(g);
-
-        z_MC_STAR.AlignWith( U );
-        z_MC_STAR.Resize( m, 1 );
-        Zero( z_MC_STAR );
-
-        Int k=0;
-        while( k < m )
-        {
-            const Int nbProp = Min(bsize,m-k);
-            const bool in2x2 =
-                ( k+nbProp<m && U.Get(k+nbProp,k+nbProp-1) != F(0) );
-            const Int nb = ( in2x2 ? nbProp+1 : nbProp );
-            const IR ind1( k, k+nb ), ind2( k+nb, END );
-
-            LockedView( U11, U, ind1, ind1 );
-            LockedView( U12, U, ind1, ind2 );
-
-            View( x1, x, ind1, ALL );
-
-            View( z1_MC_STAR, z_MC_STAR, ind1, ALL );
-            View( z2_MC_STAR, z_MC_STAR, ind2, ALL );
-
-            if( k != 0 )
-                AxpyContract( F(1), z1_MC_STAR, x1 );
-
-            x1_STAR_STAR = x1;
-            U11_STAR_STAR = U11;
-            quasitrsv::UT
-            ( TRANSPOSE, U11_STAR_STAR.LockedMatrix(), x1_STAR_STAR.Matrix(),
-              checkIfSingular );
-            x1 = x1_STAR_STAR;
-
-            x1_MR_STAR.AlignWith( U12 );
-            x1_MR_STAR = x1_STAR_STAR;
-            LocalGemv( TRANSPOSE, F(-1), U12, x1_MR_STAR, F(1), z2_MC_STAR );
-
-            k += nb;
-        }
-    }
-    else
-    {
-        DistMatrix<F,STAR,MR> x1_STAR_MR(g);
-        DistMatrix<F,MR,  MC> z1_MR_MC(g);
-        DistMatrix<F,STAR,MC> z_STAR_MC(g);
-
-        // Views of z[* ,MC]
-        DistMatrix<F,STAR,MC> z1_STAR_MC(g), z2_STAR_MC(g);
-
-        z_STAR_MC.AlignWith( U );
-        z_STAR_MC.Resize( 1, m );
-        Zero( z_STAR_MC );
-
-        Int k=0;
-        while( k < m )
-        {
-            const Int nbProp = Min(bsize,m-k);
-            const bool in2x2 =
-                ( k+nbProp<m && U.Get(k+nbProp,k+nbProp-1) != F(0) );
-            const Int nb = ( in2x2 ? nbProp+1 : nbProp );
-            const IR ind1( k, k+nb ), ind2( k+nb, END );
-
-            LockedView( U11, U, ind1, ind1 );
-            LockedView( U12, U, ind1, ind2 );
-
-            View( x1, x, ALL, ind1 );
-
-            View( z1_STAR_MC, z_STAR_MC, ALL, ind1 );
-            View( z2_STAR_MC, z_STAR_MC, ALL, ind2 );
-
-            if( k != 0 )
-            {
-                Contract( z1_STAR_MC, z1_MR_MC );
-                x1 += z1_MR_MC;
-            }
-
-            x1_STAR_STAR = x1;
-            U11_STAR_STAR = U11;
-            quasitrsv::UT
-            ( TRANSPOSE, U11_STAR_STAR.LockedMatrix(), x1_STAR_STAR.Matrix(),
-              checkIfSingular );
-            x1 = x1_STAR_STAR;
-
-            x1_STAR_MR.AlignWith( U12 );
-            x1_STAR_MR = x1_STAR_STAR;
-            LocalGemv( TRANSPOSE, F(-1), U12, x1_STAR_MR, F(1), z2_STAR_MC );
-
-            k += nb;
-        }
-    }
-    if( conjugate )
-        Conjugate( x );
-}
-
 } // namespace quasitrsv
 } // namespace El
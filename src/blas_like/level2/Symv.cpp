@@ -9,6 +9,7 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level2.hpp>
 
+#include "./Symv/Diagonal.hpp"
 #include "./Symv/L.hpp"
 #include "./Symv/U.hpp"
 
@@ -121,14 +122,7 @@ void Symv
               ctrl );
         }
 
-        DistMatrix<T,MR,MC> z_MR_MC(g);
-        Contract( z_MR_STAR, z_MR_MC );
-
-        DistMatrix<T> z(g);
-        z.AlignWith( y );
-        z = z_MR_MC;
-        AxpyContract( T(1), z_MC_STAR, z );
-        Axpy( T(1), z, y );
+        symv::FusedColContract( z_MC_STAR, z_MR_STAR, y );
     }
     else if( x.Width() == 1 )
     {
@@ -249,15 +243,7 @@ void Symv
               ctrl );
         }
 
-        DistMatrix<T,MR,MC> z_MR_MC(g);
-        z_MR_MC.AlignWith( y );
-        Contract( z_STAR_MC, z_MR_MC );
-
-        DistMatrix<T> z(g);
-        z.AlignWith( y );
-        z = z_MR_MC;
-        AxpyContract( T(1), z_STAR_MR, z );
-        Axpy( T(1), z, y );
+        symv::FusedRowContract( z_STAR_MC, z_STAR_MR, y );
     }
 }
 
@@ -303,6 +289,155 @@ void LocalRowAccumulate
           ctrl );
 }
 
+namespace {
+
+// Add the local contributions of the process with transposed grid coordinates
+// onto our own. On a square grid, the [MR,* ] ([* ,MC]) contributions of that
+// process have the same indices as our [MC,* ] ([* ,MR]) contributions, and
+// a partial sum over process columns (rows) is thereby converted into one
+// over process rows (columns).
+template<typename T>
+void TransposeExchangeUpdate
+( const Grid& g,
+  Int colAlign, Int colShift, Int rowAlign, Int rowShift,
+  const Matrix<T>& send, Matrix<T>& recv )
+{
+    EL_DEBUG_CSE
+    const Int r = g.Height();
+    const Int transposeRow = Mod( colAlign+rowShift, r );
+    const Int transposeCol = Mod( rowAlign+colShift, r );
+    const Int transposeRank = transposeRow + r*transposeCol;
+    if( transposeRank == g.VCRank() )
+    {
+        Axpy( T(1), send, recv );
+        return;
+    }
+
+    const Int sendHeight = send.Height();
+    const Int recvHeight = recv.Height();
+    const Int sendSize = sendHeight*send.Width();
+    const Int recvSize = recvHeight*recv.Width();
+    vector<T> sendBuf, recvBuf;
+    FastResize( sendBuf, sendSize );
+    FastResize( recvBuf, recvSize );
+    copy::util::InterleaveMatrix
+    ( sendHeight, send.Width(),
+      send.LockedBuffer(), 1, send.LDim(),
+      sendBuf.data(),      1, sendHeight );
+    mpi::SendRecv
+    ( sendBuf.data(), sendSize, transposeRank,
+      recvBuf.data(), recvSize, transposeRank, g.VCComm() );
+    axpy::util::InterleaveMatrixUpdate
+    ( T(1), recvHeight, recv.Width(),
+      recvBuf.data(), 1, recvHeight,
+      recv.Buffer(),  1, recv.LDim() );
+}
+
+} // anonymous namespace
+
+template<typename T>
+void FusedColContract
+(       DistMatrix<T,MC,STAR>& z_MC_STAR,
+  const DistMatrix<T,MR,STAR>& z_MR_STAR,
+        DistMatrix<T>& y )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( z_MC_STAR, z_MR_STAR, y );
+      if( z_MC_STAR.Height() != y.Height() ||
+          z_MC_STAR.Width() != y.Width() ||
+          z_MR_STAR.Height() != y.Height() ||
+          z_MR_STAR.Width() != y.Width() )
+          LogicError
+          ("Nonconformal: \n",
+           DimsString(z_MC_STAR,"z[MC,* ]"),"\n",
+           DimsString(z_MR_STAR,"z[MR,* ]"),"\n",
+           DimsString(y,"y"));
+    )
+    const Grid& g = y.Grid();
+    if( g.Height() != g.Width() )
+    {
+        DistMatrix<T,MR,MC> z_MR_MC(g);
+        Contract( z_MR_STAR, z_MR_MC );
+
+        DistMatrix<T> z(g);
+        z.AlignWith( y );
+        z = z_MR_MC;
+        AxpyContract( T(1), z_MC_STAR, z );
+        Axpy( T(1), z, y );
+        return;
+    }
+
+    if( g.InGrid() )
+        TransposeExchangeUpdate
+        ( g,
+          z_MC_STAR.ColAlign(), z_MC_STAR.ColShift(),
+          z_MR_STAR.ColAlign(), z_MR_STAR.ColShift(),
+          z_MR_STAR.LockedMatrix(), z_MC_STAR.Matrix() );
+    if( z_MC_STAR.ColAlign() == y.ColAlign() )
+    {
+        AxpyContract( T(1), z_MC_STAR, y );
+    }
+    else
+    {
+        DistMatrix<T> z(g);
+        Contract( z_MC_STAR, z );
+        Axpy( T(1), z, y );
+    }
+}
+
+template<typename T>
+void FusedRowContract
+( const DistMatrix<T,STAR,MC>& z_STAR_MC,
+        DistMatrix<T,STAR,MR>& z_STAR_MR,
+        DistMatrix<T>& y )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( z_STAR_MC, z_STAR_MR, y );
+      if( z_STAR_MC.Height() != y.Height() ||
+          z_STAR_MC.Width() != y.Width() ||
+          z_STAR_MR.Height() != y.Height() ||
+          z_STAR_MR.Width() != y.Width() )
+          LogicError
+          ("Nonconformal: \n",
+           DimsString(z_STAR_MC,"z[* ,MC]"),"\n",
+           DimsString(z_STAR_MR,"z[* ,MR]"),"\n",
+           DimsString(y,"y"));
+    )
+    const Grid& g = y.Grid();
+    if( g.Height() != g.Width() )
+    {
+        DistMatrix<T,MR,MC> z_MR_MC(g);
+        z_MR_MC.AlignWith( y );
+        Contract( z_STAR_MC, z_MR_MC );
+
+        DistMatrix<T> z(g);
+        z.AlignWith( y );
+        z = z_MR_MC;
+        AxpyContract( T(1), z_STAR_MR, z );
+        Axpy( T(1), z, y );
+        return;
+    }
+
+    if( g.InGrid() )
+        TransposeExchangeUpdate
+        ( g,
+          z_STAR_MC.RowAlign(), z_STAR_MC.RowShift(),
+          z_STAR_MR.RowAlign(), z_STAR_MR.RowShift(),
+          z_STAR_MC.LockedMatrix(), z_STAR_MR.Matrix() );
+    if( z_STAR_MR.RowAlign() == y.RowAlign() )
+    {
+        AxpyContract( T(1), z_STAR_MR, y );
+    }
+    else
+    {
+        DistMatrix<T> z(g);
+        Contract( z_STAR_MR, z );
+        Axpy( T(1), z, y );
+    }
+}
+
 } // namespace symv
 
 #define PROTO(T) \
@@ -340,7 +475,15 @@ void LocalRowAccumulate
     const DistMatrix<T,STAR,MR>& x_STAR_MR, \
           DistMatrix<T,STAR,MC>& z_STAR_MC, \
           DistMatrix<T,STAR,MR>& z_STAR_MR, bool conjugate, \
-    const SymvCtrl<T>& ctrl );
+    const SymvCtrl<T>& ctrl ); \
+  template void symv::FusedColContract \
+  (       DistMatrix<T,MC,STAR>& z_MC_STAR, \
+    const DistMatrix<T,MR,STAR>& z_MR_STAR, \
+          DistMatrix<T>& y ); \
+  template void symv::FusedRowContract \
+  ( const DistMatrix<T,STAR,MC>& z_STAR_MC, \
+          DistMatrix<T,STAR,MR>& z_STAR_MR, \
+          DistMatrix<T>& y );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
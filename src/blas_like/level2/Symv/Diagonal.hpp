@@ -0,0 +1,98 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace symv {
+
+// The stride between the entries of a local column or row vector
+template<typename T>
+inline Int VectorInc( const Matrix<T>& v ) EL_NO_EXCEPT
+{ return ( v.Width()==1 ? 1 : v.LDim() ); }
+
+template<bool conjugate,typename T>
+inline void DiagonalBlockColumn
+( Int iBeg, Int iEnd, T alphaQ, const T* a,
+  const T* rBuf, Int incr, T* sBuf, Int incs, T& tau )
+{
+    for( Int iLoc=iBeg; iLoc<iEnd; ++iLoc )
+    {
+        const T alpha_ij = a[iLoc];
+        sBuf[iLoc*incs] += alpha_ij*alphaQ;
+        tau += ( conjugate ? Conj(alpha_ij) : alpha_ij )*rBuf[iLoc*incr];
+    }
+}
+
+// s += alpha tril(A)  q,  t += alpha tril(A,-1)' r  (LOWER)
+// s += alpha triu(A)  q,  t += alpha triu(A,1)'  r  (UPPER)
+//
+// where s and r are indexed by the local rows of the diagonal block A, and
+// q and t by its local columns. Each local column of A is only traversed
+// once, and, unlike forming the trapezoid explicitly, nothing is copied.
+template<typename T>
+void LocalDiagonalBlock
+( UpperOrLower uplo, bool conjugate, T alpha,
+  const DistMatrix<T>& A,
+  const Matrix<T>& q, const Matrix<T>& r,
+        Matrix<T>& s,       Matrix<T>& t )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const T* ABuf = A.LockedBuffer();
+    const T* qBuf = q.LockedBuffer();
+    const T* rBuf = r.LockedBuffer();
+          T* sBuf = s.Buffer();
+          T* tBuf = t.Buffer();
+    const Int ALDim = A.LDim();
+    const Int incq = VectorInc( q );
+    const Int incr = VectorInc( r );
+    const Int incs = VectorInc( s );
+    const Int inct = VectorInc( t );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const T* a = &ABuf[jLoc*ALDim];
+        const T alphaQ = alpha*qBuf[jLoc*incq];
+
+        // The diagonal entry (if we own it) only contributes to s
+        Int iBeg, iEnd;
+        if( uplo == LOWER )
+        {
+            iBeg = A.LocalRowOffset(j);
+            iEnd = localHeight;
+            if( iBeg < iEnd && A.GlobalRow(iBeg) == j )
+            {
+                sBuf[iBeg*incs] += a[iBeg]*alphaQ;
+                ++iBeg;
+            }
+        }
+        else
+        {
+            iBeg = 0;
+            iEnd = A.LocalRowOffset(j+1);
+            if( iBeg < iEnd && A.GlobalRow(iEnd-1) == j )
+            {
+                --iEnd;
+                sBuf[iEnd*incs] += a[iEnd]*alphaQ;
+            }
+        }
+
+        T tau = 0;
+        if( conjugate )
+            DiagonalBlockColumn<true>
+            ( iBeg, iEnd, alphaQ, a, rBuf, incr, sBuf, incs, tau );
+        else
+            DiagonalBlockColumn<false>
+            ( iBeg, iEnd, alphaQ, a, rBuf, incr, sBuf, incs, tau );
+        tBuf[jLoc*inct] += alpha*tau;
+    }
+}
+
+} // namespace symv
+} // namespace El
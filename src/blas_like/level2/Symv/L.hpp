@@ -28,15 +28,21 @@ void FusedColPanelGemvs
           T* sBuf = s.Buffer();
           T* tBuf = t.Buffer();
     const Int ALDim = A.LDim();
+    const Int incq = VectorInc( q );
+    const Int incr = VectorInc( r );
+    const Int incs = VectorInc( s );
+    const Int inct = VectorInc( t );
     for( Int k=0; k<m; k+=bsize )
     {
         const Int mb = Min(m-k,bsize);
         blas::Gemv
         ( 'N', mb, n, alpha, 
-          &ABuf[k], ALDim, qBuf,     1, T(1), &sBuf[k], 1 );
+          &ABuf[k], ALDim, qBuf,          incq,
+          T(1),     &sBuf[k*incs], incs );
         blas::Gemv
         ( transChar, mb, n, alpha,
-          &ABuf[k], ALDim, &rBuf[k], 1, T(1), tBuf,     1 );
+          &ABuf[k], ALDim, &rBuf[k*incr], incr,
+          T(1),     tBuf,          inct );
     }
 }
 
@@ -75,9 +81,6 @@ void LocalColAccumulateLGeneral
           LogicError("Partial matrix distributions are misaligned");
     )
     const Grid& g = A.Grid();
-    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
-
-    DistMatrix<T> D11(g);
 
     // We want our local gemvs to be of width blocksize, so we will 
     // temporarily change to max(r,c) times the current blocksize
@@ -97,13 +100,10 @@ void LocalColAccumulateLGeneral
         auto z2_MC_STAR = z_MC_STAR( ind2, ALL );
         auto z1_MR_STAR = z_MR_STAR( ind1, ALL );
  
-        D11.AlignWith( A11 );
-        // TODO: These diagonal block updates can be greatly improved
-        D11 = A11;
-        MakeTrapezoidal( LOWER, D11 );
-        LocalGemv( NORMAL,      alpha, D11, x1_MR_STAR, T(1), z1_MC_STAR );
-        FillDiagonal( D11, T(0) );
-        LocalGemv( orientation, alpha, D11, x1_MC_STAR, T(1), z1_MR_STAR );
+        LocalDiagonalBlock
+        ( LOWER, conjugate, alpha, A11,
+          x1_MR_STAR.LockedMatrix(), x1_MC_STAR.LockedMatrix(),
+          z1_MC_STAR.Matrix(),       z1_MR_STAR.Matrix() );
 
         // TODO: Expose the fusion blocksize as another parameter 
         FusedColPanelGemvs
@@ -296,9 +296,6 @@ void LocalRowAccumulateL
           LogicError("Partial matrix distributions are misaligned");
     )
     const Grid& g = A.Grid();
-    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
-
-    DistMatrix<T> D11(g);
 
     // We want our local gemvs to be of width blocksize, so we will 
     // temporarily change to max(r,c) times the current blocksize
@@ -318,16 +315,15 @@ void LocalRowAccumulateL
         auto z2_STAR_MC = z_STAR_MC( ALL, ind2 );
         auto z1_STAR_MR = z_STAR_MR( ALL, ind1 );
 
-        D11.AlignWith( A11 );
-        // TODO: These diagonal block updates can be greatly improved
-        D11 = A11;
-        MakeTrapezoidal( LOWER, D11 );
-        LocalGemv( NORMAL,      alpha, D11, x1_STAR_MR, T(1), z1_STAR_MC );
-        FillDiagonal( D11, T(0) );
-        LocalGemv( orientation, alpha, D11, x1_STAR_MC, T(1), z1_STAR_MR );
+        LocalDiagonalBlock
+        ( LOWER, conjugate, alpha, A11,
+          x1_STAR_MR.LockedMatrix(), x1_STAR_MC.LockedMatrix(),
+          z1_STAR_MC.Matrix(),       z1_STAR_MR.Matrix() );
 
-        LocalGemv( NORMAL,      alpha, A21, x1_STAR_MR, T(1), z2_STAR_MC );
-        LocalGemv( orientation, alpha, A21, x2_STAR_MC, T(1), z1_STAR_MR );
+        FusedColPanelGemvs
+        ( conjugate, alpha, A21.LockedMatrix(),
+          x1_STAR_MR.LockedMatrix(), x2_STAR_MC.LockedMatrix(),
+          z2_STAR_MC.Matrix(),       z1_STAR_MR.Matrix(), ctrl.bsize );
     }
 }
 
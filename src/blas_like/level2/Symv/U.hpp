@@ -28,15 +28,21 @@ void FusedRowPanelGemvs
           T* sBuf = s.Buffer();
           T* tBuf = t.Buffer();
     const Int ALDim = A.LDim();
+    const Int incq = VectorInc( q );
+    const Int incr = VectorInc( r );
+    const Int incs = VectorInc( s );
+    const Int inct = VectorInc( t );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(n-k,bsize);
         blas::Gemv
         ( 'N', m, nb, alpha, 
-          &ABuf[k*ALDim], ALDim, &qBuf[k], 1, T(1), sBuf, 1 );
+          &ABuf[k*ALDim], ALDim, &qBuf[k*incq], incq,
+          T(1),           sBuf,          incs );
         blas::Gemv
         ( transChar, m, nb, alpha,
-          &ABuf[k*ALDim], ALDim, rBuf,     1, T(1), &tBuf[k], 1 );
+          &ABuf[k*ALDim], ALDim, rBuf,          incr,
+          T(1),           &tBuf[k*inct], inct );
     }
 }
 
@@ -75,9 +81,6 @@ void LocalColAccumulateUGeneral
           LogicError("Partial matrix distributions are misaligned");
     )
     const Grid& g = A.Grid();
-    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
-
-    DistMatrix<T> D11(g);
 
     // We want our local gemvs to be of width blocksize, so we will 
     // temporarily change to max(r,c) times the current blocksize
@@ -97,13 +100,10 @@ void LocalColAccumulateUGeneral
         auto z1_MR_STAR = z_MR_STAR( ind1, ALL );
         auto z2_MR_STAR = z_MR_STAR( ind2, ALL );
 
-        D11.AlignWith( A11 );
-        // TODO: These diagonal block updates can be greatly improved
-        D11 = A11;
-        MakeTrapezoidal( UPPER, D11 );
-        LocalGemv( NORMAL,      alpha, D11, x1_MR_STAR, T(1), z1_MC_STAR );
-        FillDiagonal( D11, T(0) );
-        LocalGemv( orientation, alpha, D11, x1_MC_STAR, T(1), z1_MR_STAR );
+        LocalDiagonalBlock
+        ( UPPER, conjugate, alpha, A11,
+          x1_MR_STAR.LockedMatrix(), x1_MC_STAR.LockedMatrix(),
+          z1_MC_STAR.Matrix(),       z1_MR_STAR.Matrix() );
         
         // TODO: Expose the fusion blocksize as another parameter
         FusedRowPanelGemvs
@@ -300,9 +300,6 @@ void LocalRowAccumulateU
           LogicError("Partial matrix distributions are misaligned");
     )
     const Grid& g = A.Grid();
-    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
-
-    DistMatrix<T> D11(g);
 
     // We want our local gemvs to be of width blocksize, so we will 
     // temporarily change to max(r,c) times the current blocksize
@@ -322,16 +319,15 @@ void LocalRowAccumulateU
         auto z1_STAR_MR = z_STAR_MR( ALL, ind1 );
         auto z2_STAR_MR = z_STAR_MR( ALL, ind2 );
 
-        D11.AlignWith( A11 );
-        // TODO: These diagonal block updates can be greatly improved
-        D11 = A11;
-        MakeTrapezoidal( UPPER, D11 );
-        LocalGemv( NORMAL,      alpha, D11, x1_STAR_MR, T(1), z1_STAR_MC );
-        FillDiagonal( D11, T(0) );
-        LocalGemv( orientation, alpha, D11, x1_STAR_MC, T(1), z1_STAR_MR );
+        LocalDiagonalBlock
+        ( UPPER, conjugate, alpha, A11,
+          x1_STAR_MR.LockedMatrix(), x1_STAR_MC.LockedMatrix(),
+          z1_STAR_MC.Matrix(),       z1_STAR_MR.Matrix() );
 
-        LocalGemv( NORMAL,      alpha, A12, x2_STAR_MR, T(1), z1_STAR_MC );
-        LocalGemv( orientation, alpha, A12, x1_STAR_MC, T(1), z2_STAR_MR );
+        FusedRowPanelGemvs
+        ( conjugate, alpha, A12.LockedMatrix(),
+          x2_STAR_MR.LockedMatrix(), x1_STAR_MC.LockedMatrix(),
+          z1_STAR_MC.Matrix(),       z2_STAR_MR.Matrix(), ctrl.bsize );
     }
 }
 
@@ -9,10 +9,7 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level2.hpp>
 
-#include "./Trsv/LN.hpp"
-#include "./Trsv/LT.hpp"
-#include "./Trsv/UN.hpp"
-#include "./Trsv/UT.hpp"
+#include "./Trsv/Replicated.hpp"
 
 namespace El {
 
@@ -44,23 +41,27 @@ void Trsv
 template<typename F>
 void Trsv
 ( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag,
-  const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& x )
+  const AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& x )
 {
     EL_DEBUG_CSE
-    if( uplo == LOWER )
-    {
-        if( orientation == NORMAL )
-            trsv::LN( diag, A, x );
-        else
-            trsv::LT( orientation, diag, A, x );
-    }
-    else
-    {
-        if( orientation == NORMAL )
-            trsv::UN( diag, A, x );
-        else
-            trsv::UT( orientation, diag, A, x );
-    }
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, x );
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( x.Width() != 1 && x.Height() != 1 )
+          LogicError("x must be a vector");
+      const Int xLength = ( x.Width() == 1 ? x.Height() : x.Width() );
+      if( APre.Width() != xLength )
+          LogicError("Nonconformal");
+    )
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    auto localSolve =
+      [&]( const Matrix<F>& A11, Matrix<F>& x1 )
+      { Trsv( uplo, orientation, diag, A11, x1 ); };
+    const auto bounds = trsv::BlockBounds( A.Height(), Blocksize() );
+    trsv::Replicated( uplo, orientation, A, x, bounds, localSolve );
 }
 
 #define PROTO(F) \
@@ -0,0 +1,145 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TRSV_REPLICATED_HPP
+#define EL_TRSV_REPLICATED_HPP
+
+namespace El {
+namespace trsv {
+
+// Solve op(A) x = b for a single (row or column) vector x, where A is
+// (quasi-)triangular and the diagonal blocks of the sweep are
+// [bounds[t],bounds[t+1]).
+//
+// A solve with one right-hand side is almost entirely latency-bound, and the
+// standard approach requires a reduce-scatter, a pair of gathers, and
+// redistributions of x for every diagonal block. Instead, the right-hand side
+// is replicated on every process at the beginning, and each process
+// accumulates the contributions of its local portion of A into a local
+// vector z as the blocks of x are solved. Each diagonal block then costs a
+// single AllReduce, which both sums the contributions to the block and
+// gathers the diagonal block of A, after which every process redundantly
+// solves against the diagonal block with 'localSolve'.
+template<typename F,class LocalSolve>
+void Replicated
+( UpperOrLower uplo,
+  Orientation orientation,
+  const DistMatrix<F>& A,
+        AbstractDistMatrix<F>& x,
+  const vector<Int>& bounds,
+  LocalSolve localSolve )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const bool colVec = ( x.Width() == 1 );
+    DistMatrix<F,STAR,STAR> x_STAR_STAR( x );
+    if( !g.InGrid() )
+    {
+        Copy( x_STAR_STAR, x );
+        return;
+    }
+
+    const bool normal = ( orientation == NORMAL );
+    const bool forward = ( (uplo == LOWER) == normal );
+    const char transChar = OrientationToChar( orientation );
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const auto& ALoc = A.LockedMatrix();
+    auto& xLoc = x_STAR_STAR.Matrix();
+
+    // For op(A) = A, the contributions are indexed by our local rows of A,
+    // and the entries of x which we apply are indexed by our local columns.
+    // Otherwise, the roles are reversed.
+    vector<F> z( normal ? localHeight : localWidth, F(0) ), xApply;
+    auto localOffset = [&]( Int i, bool contribIndex )
+      { return ( normal == contribIndex ?
+                 A.LocalRowOffset(i) : A.LocalColOffset(i) ); };
+    auto globalIndex = [&]( Int iLoc, bool contribIndex )
+      { return ( normal == contribIndex ?
+                 A.GlobalRow(iLoc) : A.GlobalCol(iLoc) ); };
+    auto xEntry = [&]( Int i ) -> F&
+      { return ( colVec ? xLoc(i,0) : xLoc(0,i) ); };
+
+    const Int numBlocks = bounds.size()-1;
+    vector<F> buffer;
+    Matrix<F> A11;
+    for( Int t=0; t<numBlocks; ++t )
+    {
+        const Int s = ( forward ? t : numBlocks-1-t );
+        const Int k = bounds[s];
+        const Int kEnd = bounds[s+1];
+        const Int nb = kEnd - k;
+
+        // Pack our contributions to x1 and our portion of A11
+        buffer.assign( nb+nb*nb, F(0) );
+        const Int zBeg = localOffset( k, true );
+        const Int zEnd = localOffset( kEnd, true );
+        for( Int iLoc=zBeg; iLoc<zEnd; ++iLoc )
+            buffer[globalIndex(iLoc,true)-k] = z[iLoc];
+        const Int rowBeg = A.LocalRowOffset(k);
+        const Int rowEnd = A.LocalRowOffset(kEnd);
+        const Int colBeg = A.LocalColOffset(k);
+        const Int colEnd = A.LocalColOffset(kEnd);
+        for( Int jLoc=colBeg; jLoc<colEnd; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc) - k;
+            for( Int iLoc=rowBeg; iLoc<rowEnd; ++iLoc )
+                buffer[nb+(A.GlobalRow(iLoc)-k)+j*nb] = ALoc(iLoc,jLoc);
+        }
+        mpi::AllReduce( buffer.data(), nb+nb*nb, g.VCComm() );
+
+        // x1 := op(A11)^{-1} (b1 - z1) on every process
+        for( Int i=0; i<nb; ++i )
+            xEntry(k+i) -= buffer[i];
+        A11.LockedAttach( nb, nb, &buffer[nb], nb );
+        const Range<Int> ind1( k, kEnd );
+        auto x1 = ( colVec ? xLoc( ind1, ALL ) : xLoc( ALL, ind1 ) );
+        localSolve( A11, x1 );
+
+        // Accumulate the contributions of x1 to the remainder of the sweep
+        const Int applyBeg = localOffset( k, false );
+        const Int applyEnd = localOffset( kEnd, false );
+        const Int restBeg = ( forward ? localOffset( kEnd, true ) : 0 );
+        const Int restEnd = ( forward ? z.size() : localOffset( k, true ) );
+        const Int numApply = applyEnd - applyBeg;
+        const Int numRest = restEnd - restBeg;
+        if( numApply == 0 || numRest == 0 )
+            continue;
+        xApply.resize( numApply );
+        for( Int jLoc=applyBeg; jLoc<applyEnd; ++jLoc )
+            xApply[jLoc-applyBeg] = xEntry( globalIndex(jLoc,false) );
+        if( normal )
+            blas::Gemv
+            ( 'N', numRest, numApply,
+              F(1), ALoc.LockedBuffer(restBeg,applyBeg), ALoc.LDim(),
+                    xApply.data(), 1,
+              F(1), &z[restBeg], 1 );
+        else
+            blas::Gemv
+            ( transChar, numApply, numRest,
+              F(1), ALoc.LockedBuffer(applyBeg,restBeg), ALoc.LDim(),
+                    xApply.data(), 1,
+              F(1), &z[restBeg], 1 );
+    }
+    Copy( x_STAR_STAR, x );
+}
+
+// Partition [0,m) into blocks of (roughly) the given size
+inline vector<Int> BlockBounds( Int m, Int bsize )
+{
+    vector<Int> bounds;
+    for( Int k=0; k<m; k+=bsize )
+        bounds.push_back( k );
+    bounds.push_back( m );
+    return bounds;
+}
+
+} // namespace trsv
+} // namespace El
+
+#endif // ifndef EL_TRSV_REPLICATED_HPP
@@ -0,0 +1,349 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+namespace batched {
+
+// C := alpha op(A) op(B) + beta C for a single small member of a batch.
+// The products are accumulated in the (j,l,i) order for op(A)=A, so that
+// the innermost loop is unit-stride over a column of both A and C, and as
+// dot products otherwise.
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha,
+  const T* A, Int ALDim,
+  const T* B, Int BLDim,
+  T beta,
+        T* C, Int CLDim )
+{
+    const bool conjA = ( orientA == ADJOINT );
+    const bool conjB = ( orientB == ADJOINT );
+    for( Int j=0; j<n; ++j )
+    {
+        T* cCol = &C[j*CLDim];
+        if( beta == T(0) )
+        {
+            for( Int i=0; i<m; ++i )
+                cCol[i] = 0;
+        }
+        else if( beta != T(1) )
+        {
+            for( Int i=0; i<m; ++i )
+                cCol[i] *= beta;
+        }
+
+        if( orientA == NORMAL )
+        {
+            for( Int l=0; l<k; ++l )
+            {
+                T beta_lj =
+                  ( orientB == NORMAL ? B[l+j*BLDim] : B[j+l*BLDim] );
+                if( conjB )
+                    beta_lj = Conj(beta_lj);
+                const T gamma = alpha*beta_lj;
+                const T* aCol = &A[l*ALDim];
+                EL_SIMD
+                for( Int i=0; i<m; ++i )
+                    cCol[i] += gamma*aCol[i];
+            }
+        }
+        else
+        {
+            for( Int i=0; i<m; ++i )
+            {
+                const T* aCol = &A[i*ALDim];
+                T dot = 0;
+                for( Int l=0; l<k; ++l )
+                {
+                    T beta_lj =
+                      ( orientB == NORMAL ? B[l+j*BLDim] : B[j+l*BLDim] );
+                    if( conjB )
+                        beta_lj = Conj(beta_lj);
+                    dot += ( conjA ? Conj(aCol[l]) : aCol[l] )*beta_lj;
+                }
+                cCol[i] += alpha*dot;
+            }
+        }
+    }
+}
+
+#ifdef HYDROGEN_HAVE_MKL_BATCH_STRIDED
+template<typename T,typename=EnableIf<IsBlasScalar<T>>>
+bool GemmStrided
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha,
+  const T* A, Int ALDim, Int AStride,
+  const T* B, Int BLDim, Int BStride,
+  T beta,
+        T* C, Int CLDim, Int CStride,
+  Int batchSize )
+{
+    mkl::GemmBatchStrided
+    ( OrientationToChar(orientA), OrientationToChar(orientB),
+      m, n, k,
+      alpha,
+      A, ALDim, AStride,
+      B, BLDim, BStride,
+      beta,
+      C, CLDim, CStride,
+      batchSize );
+    return true;
+}
+
+template<typename F,typename=EnableIf<IsBlasScalar<F>>>
+bool TrsmStrided
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha,
+  const F* A, Int ALDim, Int AStride,
+        F* B, Int BLDim, Int BStride,
+  Int batchSize )
+{
+    mkl::TrsmBatchStrided
+    ( LeftOrRightToChar(side), UpperOrLowerToChar(uplo),
+      OrientationToChar(orientation), UnitOrNonUnitToChar(diag),
+      m, n,
+      alpha,
+      A, ALDim, AStride,
+      B, BLDim, BStride,
+      batchSize );
+    return true;
+}
+
+template<typename T,typename=DisableIf<IsBlasScalar<T>>,typename=void>
+bool GemmStrided
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha,
+  const T* A, Int ALDim, Int AStride,
+  const T* B, Int BLDim, Int BStride,
+  T beta,
+        T* C, Int CLDim, Int CStride,
+  Int batchSize )
+{ return false; }
+
+template<typename F,typename=DisableIf<IsBlasScalar<F>>,typename=void>
+bool TrsmStrided
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha,
+  const F* A, Int ALDim, Int AStride,
+        F* B, Int BLDim, Int BStride,
+  Int batchSize )
+{ return false; }
+#else
+// Without MKL's strided batch routines, every scalar type takes the fallback
+template<typename T>
+bool GemmStrided
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha,
+  const T* A, Int ALDim, Int AStride,
+  const T* B, Int BLDim, Int BStride,
+  T beta,
+        T* C, Int CLDim, Int CStride,
+  Int batchSize )
+{ return false; }
+
+template<typename F>
+bool TrsmStrided
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha,
+  const F* A, Int ALDim, Int AStride,
+        F* B, Int BLDim, Int BStride,
+  Int batchSize )
+{ return false; }
+#endif // ifdef HYDROGEN_HAVE_MKL_BATCH_STRIDED
+
+} // namespace batched
+
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha,
+  const T* A, Int ALDim, Int AStride,
+  const T* B, Int BLDim, Int BStride,
+  T beta,
+        T* C, Int CLDim, Int CStride,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( m < 0 || n < 0 || k < 0 || batchSize < 0 )
+          LogicError("Batch dimensions must be non-negative");
+      const Int AHeight = ( orientA == NORMAL ? m : k );
+      const Int BHeight = ( orientB == NORMAL ? k : n );
+      if( ALDim < Max(AHeight,1) || BLDim < Max(BHeight,1) ||
+          CLDim < Max(m,1) )
+          LogicError("Invalid leading dimension in BatchedGemm");
+    )
+    if( batchSize == 0 || m == 0 || n == 0 )
+        return;
+    if( batched::GemmStrided
+        ( orientA, orientB, m, n, k,
+          alpha, A, ALDim, AStride, B, BLDim, BStride,
+          beta, C, CLDim, CStride, batchSize ) )
+        return;
+
+    EL_PARALLEL_FOR_GRAIN(batchSize*m*n*k)
+    for( Int b=0; b<batchSize; ++b )
+        batched::Gemm
+        ( orientA, orientB, m, n, k,
+          alpha, &A[b*AStride], ALDim, &B[b*BStride], BLDim,
+          beta, &C[b*CStride], CLDim );
+}
+
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha,
+  const vector<const T*>& A, Int ALDim,
+  const vector<const T*>& B, Int BLDim,
+  T beta,
+  const vector<T*>& C, Int CLDim )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = C.size();
+    EL_DEBUG_ONLY(
+      if( Int(A.size()) != batchSize || Int(B.size()) != batchSize )
+          LogicError("Batch sizes of A, B, and C do not match");
+    )
+    if( batchSize == 0 || m == 0 || n == 0 )
+        return;
+    EL_PARALLEL_FOR_GRAIN(batchSize*m*n*k)
+    for( Int b=0; b<batchSize; ++b )
+        batched::Gemm
+        ( orientA, orientB, m, n, k,
+          alpha, A[b], ALDim, B[b], BLDim, beta, C[b], CLDim );
+}
+
+template<typename F>
+void BatchedTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha,
+  const F* A, Int ALDim, Int AStride,
+        F* B, Int BLDim, Int BStride,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( m < 0 || n < 0 || batchSize < 0 )
+          LogicError("Batch dimensions must be non-negative");
+      const Int ADim = ( side == LEFT ? m : n );
+      if( ALDim < Max(ADim,1) || BLDim < Max(m,1) )
+          LogicError("Invalid leading dimension in BatchedTrsm");
+    )
+    if( batchSize == 0 || m == 0 || n == 0 )
+        return;
+    if( batched::TrsmStrided
+        ( side, uplo, orientation, diag, m, n,
+          alpha, A, ALDim, AStride, B, BLDim, BStride, batchSize ) )
+        return;
+
+    const char sideChar = LeftOrRightToChar( side );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char transChar = OrientationToChar( orientation );
+    const char diagChar = UnitOrNonUnitToChar( diag );
+    EL_PARALLEL_FOR_GRAIN(batchSize*(side==LEFT ? m : n)*m*n)
+    for( Int b=0; b<batchSize; ++b )
+        blas::Trsm
+        ( sideChar, uploChar, transChar, diagChar, m, n,
+          alpha, &A[b*AStride], ALDim, &B[b*BStride], BLDim );
+}
+
+template<typename F>
+void BatchedTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha,
+  const vector<const F*>& A, Int ALDim,
+  const vector<F*>& B, Int BLDim )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = B.size();
+    EL_DEBUG_ONLY(
+      if( Int(A.size()) != batchSize )
+          LogicError("Batch sizes of A and B do not match");
+    )
+    if( batchSize == 0 || m == 0 || n == 0 )
+        return;
+    const char sideChar = LeftOrRightToChar( side );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char transChar = OrientationToChar( orientation );
+    const char diagChar = UnitOrNonUnitToChar( diag );
+    EL_PARALLEL_FOR_GRAIN(batchSize*(side==LEFT ? m : n)*m*n)
+    for( Int b=0; b<batchSize; ++b )
+        blas::Trsm
+        ( sideChar, uploChar, transChar, diagChar, m, n,
+          alpha, A[b], ALDim, B[b], BLDim );
+}
+
+#define PROTO_FIELD(F) \
+  template void BatchedTrsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    Int m, Int n, \
+    F alpha, \
+    const F* A, Int ALDim, Int AStride, \
+          F* B, Int BLDim, Int BStride, \
+    Int batchSize ); \
+  template void BatchedTrsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    Int m, Int n, \
+    F alpha, \
+    const vector<const F*>& A, Int ALDim, \
+    const vector<F*>& B, Int BLDim );
+
+#define PROTO(T) \
+  template void BatchedGemm \
+  ( Orientation orientA, Orientation orientB, \
+    Int m, Int n, Int k, \
+    T alpha, \
+    const T* A, Int ALDim, Int AStride, \
+    const T* B, Int BLDim, Int BStride, \
+    T beta, \
+          T* C, Int CLDim, Int CStride, \
+    Int batchSize ); \
+  template void BatchedGemm \
+  ( Orientation orientA, Orientation orientB, \
+    Int m, Int n, Int k, \
+    T alpha, \
+    const vector<const T*>& A, Int ALDim, \
+    const vector<const T*>& B, Int BLDim, \
+    T beta, \
+    const vector<T*>& C, Int CLDim );
+
+#define PROTO_INT(T) PROTO(T)
+#define PROTO_REAL(Real) PROTO(Real) PROTO_FIELD(Real)
+#define PROTO_COMPLEX(Field) PROTO(Field) PROTO_FIELD(Field)
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
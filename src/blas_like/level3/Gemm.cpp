@@ -8,11 +8,17 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
+#include <El/blas_like/level3/BlockCyclic.hpp>
 
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/25D.hpp"
+#include "./Gemm/Recursive.hpp"
+#include "./Gemm/Strassen.hpp"
+#include "./Gemm/Ozaki.hpp"
+#include "./Gemm/Block.hpp"
 
 namespace El {
 
@@ -52,22 +58,20 @@ void Gemm
             A.Height() != B.Width() )
             LogicError("Nonconformal Gemm(T/C)(T/C)");
     }
-    const char transA = OrientationToChar( orientA );
-    const char transB = OrientationToChar( orientB );
     const Int m = C.Height();
     const Int n = C.Width();
     const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
-    if( k != 0 )
+    const LocalGemmAlgorithm localAlg = GetLocalGemmAlgorithm();
+    const Int strassenCutoff = StrassenCutoff<T>();
+    if( localAlg == LOCAL_GEMM_STRASSEN && Min(Min(m,n),k) > strassenCutoff )
     {
-        blas::Gemm
-        ( transA, transB, m, n, k,
-          alpha, A.LockedBuffer(), A.LDim(),
-                 B.LockedBuffer(), B.LDim(),
-          beta,  C.Buffer(),       C.LDim() );
+        gemm::StrassenWinograd
+        ( orientA, orientB, alpha, A, B, beta, C, strassenCutoff );
     }
-    else
+    else if( localAlg != LOCAL_GEMM_OZAKI ||
+             !gemm::Ozaki( orientA, orientB, alpha, A, B, beta, C ) )
     {
-        C *= beta;
+        gemm::Standard( orientA, orientB, alpha, A, B, beta, C );
     }
 }
 
@@ -95,8 +99,49 @@ void Gemm
   GemmAlgorithm alg )
 {
     EL_DEBUG_CSE
+    EL_TRACE_REGION("Gemm");
     C *= beta;
-    if( orientA == NORMAL && orientB == NORMAL )
+    if( alg == GEMM_DEFAULT && orientA == NORMAL && orientB == NORMAL &&
+        gemm::BlockCompatibleNN( A, B, C ) )
+    {
+        // Avoid redistributing block-cyclic operands into [MC,MR]
+        typedef DistMatrix<T,MC,MR,BLOCK> BlockMat;
+        gemm::BlockNN
+        ( alpha, static_cast<const BlockMat&>(A),
+                 static_cast<const BlockMat&>(B),
+                 static_cast<BlockMat&>(C) );
+        return;
+    }
+    if( alg == GEMM_DEFAULT )
+    {
+        const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+        alg = SelectGemmAlgorithm
+          ( orientA, orientB, C.Height(), C.Width(), k, A.Grid(), sizeof(T) );
+    }
+    const bool pipelined =
+      alg == GEMM_SUMMA_A_PIPELINED ||
+      alg == GEMM_SUMMA_B_PIPELINED ||
+      alg == GEMM_SUMMA_C_PIPELINED;
+    if( alg == GEMM_25D || alg == GEMM_3D )
+    {
+        gemm::Layered( orientA, orientB, alpha, A, B, C, alg );
+    }
+    else if( pipelined && (orientA != NORMAL || orientB != NORMAL) )
+    {
+        // The pipelined variants are only implemented for the NN case, so we
+        // explicitly form any (conjugate-)transposed operands
+        const Grid& g = A.Grid();
+        DistMatrix<T> AOp(g), BOp(g);
+        if( orientA != NORMAL )
+            Transpose( A, AOp, orientA == ADJOINT );
+        if( orientB != NORMAL )
+            Transpose( B, BOp, orientB == ADJOINT );
+        gemm::SUMMA_NN
+        ( alpha,
+          ( orientA == NORMAL ? A : AOp ),
+          ( orientB == NORMAL ? B : BOp ), C, alg );
+    }
+    else if( orientA == NORMAL && orientB == NORMAL )
     {
         if( alg == GEMM_CANNON )
             gemm::Cannon_NN( alpha, A, B, C );
@@ -132,6 +177,106 @@ void Gemm
     Gemm( orientA, orientB, alpha, A, B, T(0), C, alg );
 }
 
+// Block (i,j) of op(A) is op(A_{ij}) if orient is NORMAL and op(A_{ji})
+// otherwise
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const CompositeMatrix<T>& A, const AbstractDistMatrix<T>& BPre,
+  T beta,        AbstractDistMatrix<T>& CPre, GemmAlgorithm alg )
+{
+    EL_DEBUG_CSE
+    const bool normalA = ( orientA == NORMAL );
+    const Int numBlockRows = ( normalA ? A.NumBlockRows() : A.NumBlockCols() );
+    const Int numBlockCols = ( normalA ? A.NumBlockCols() : A.NumBlockRows() );
+    const Int k = ( normalA ? A.Width() : A.Height() );
+    const Int BHeight = ( orientB==NORMAL ? BPre.Height() : BPre.Width() );
+    const Int BWidth = ( orientB==NORMAL ? BPre.Width() : BPre.Height() );
+    if( BHeight != k ||
+        CPre.Height() != ( normalA ? A.Height() : A.Width() ) ||
+        CPre.Width() != BWidth )
+        LogicError
+        ("Nonconformal composite Gemm:\n",DimsString(BPre,"B"),"\n",
+         DimsString(CPre,"C"));
+
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+    Scale( beta, C );
+    for( Int i=0; i<numBlockRows; ++i )
+    {
+        const Range<Int> rows =
+          ( normalA ? IR(A.RowOffset(i),A.RowOffset(i+1))
+                    : IR(A.ColOffset(i),A.ColOffset(i+1)) );
+        auto Ci = C( rows, ALL );
+        for( Int j=0; j<numBlockCols; ++j )
+        {
+            const auto* Aij = ( normalA ? A.Block(i,j) : A.Block(j,i) );
+            if( Aij == nullptr )
+                continue;
+            const Range<Int> inner =
+              ( normalA ? IR(A.ColOffset(j),A.ColOffset(j+1))
+                        : IR(A.RowOffset(j),A.RowOffset(j+1)) );
+            DistMatrix<T> Bj( B.Grid() );
+            if( orientB == NORMAL )
+                LockedView( Bj, B, inner, ALL );
+            else
+                LockedView( Bj, B, ALL, inner );
+            Gemm( orientA, orientB, alpha, *Aij, Bj, T(1), Ci, alg );
+        }
+    }
+}
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const AbstractDistMatrix<T>& APre, const CompositeMatrix<T>& B,
+  T beta,        AbstractDistMatrix<T>& CPre, GemmAlgorithm alg )
+{
+    EL_DEBUG_CSE
+    const bool normalB = ( orientB == NORMAL );
+    const Int numBlockRows = ( normalB ? B.NumBlockRows() : B.NumBlockCols() );
+    const Int numBlockCols = ( normalB ? B.NumBlockCols() : B.NumBlockRows() );
+    const Int k = ( normalB ? B.Height() : B.Width() );
+    const Int AHeight = ( orientA==NORMAL ? APre.Height() : APre.Width() );
+    const Int AWidth = ( orientA==NORMAL ? APre.Width() : APre.Height() );
+    if( AWidth != k ||
+        CPre.Height() != AHeight ||
+        CPre.Width() != ( normalB ? B.Width() : B.Height() ) )
+        LogicError
+        ("Nonconformal composite Gemm:\n",DimsString(APre,"A"),"\n",
+         DimsString(CPre,"C"));
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& C = CProx.Get();
+    Scale( beta, C );
+    for( Int j=0; j<numBlockCols; ++j )
+    {
+        const Range<Int> cols =
+          ( normalB ? IR(B.ColOffset(j),B.ColOffset(j+1))
+                    : IR(B.RowOffset(j),B.RowOffset(j+1)) );
+        auto Cj = C( ALL, cols );
+        for( Int i=0; i<numBlockRows; ++i )
+        {
+            const auto* Bij = ( normalB ? B.Block(i,j) : B.Block(j,i) );
+            if( Bij == nullptr )
+                continue;
+            const Range<Int> inner =
+              ( normalB ? IR(B.RowOffset(i),B.RowOffset(i+1))
+                        : IR(B.ColOffset(i),B.ColOffset(i+1)) );
+            DistMatrix<T> Ai( A.Grid() );
+            if( orientA == NORMAL )
+                LockedView( Ai, A, ALL, inner );
+            else
+                LockedView( Ai, A, inner, ALL );
+            Gemm( orientA, orientB, alpha, Ai, *Bij, T(1), Cj, alg );
+        }
+    }
+}
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -279,6 +424,16 @@ void LocalGemm
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& B, \
                    AbstractDistMatrix<T>& C, GemmAlgorithm alg ); \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const CompositeMatrix<T>& A, \
+             const AbstractDistMatrix<T>& B, \
+    T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg ); \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const AbstractDistMatrix<T>& A, \
+             const CompositeMatrix<T>& B, \
+    T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg ); \
   template void LocalGemm \
   ( Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
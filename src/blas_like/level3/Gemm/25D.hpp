@@ -0,0 +1,170 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifdef __linux__
+# include <unistd.h>
+#endif
+
+namespace El {
+namespace gemm {
+
+// The minimum (over the grid) number of bytes available to each process for
+// replicating the operands
+inline double AvailableMemory( const Grid& g )
+{
+    EL_DEBUG_CSE
+    double numBytes = GemmMemoryLimit();
+    if( numBytes == 0 )
+    {
+#ifdef __linux__
+        const double pageSize = sysconf( _SC_PAGESIZE );
+        const double numPages = sysconf( _SC_AVPHYS_PAGES );
+        mpi::Comm nodeComm;
+        mpi::SplitShared( g.VCComm(), g.VCRank(), nodeComm );
+        numBytes = pageSize*numPages / mpi::Size( nodeComm );
+        mpi::Free( nodeComm );
+#endif
+    }
+    return mpi::AllReduce( numBytes, mpi::MIN, g.VCComm() );
+}
+
+// The largest number of layers, c, which divides the number of processes,
+// satisfies c^3 <= p, and (unless 'maximal' is true) fits within the
+// available memory
+template<typename T>
+Int NumLayers( Int m, Int n, Int k, const Grid& g, bool maximal )
+{
+    EL_DEBUG_CSE
+    const Int p = g.Size();
+    const double numBytes = ( maximal ? 0 : AvailableMemory( g ) );
+    Int numLayers = 1;
+    for( Int c=2; c*c*c<=p; ++c )
+    {
+        if( p % c != 0 )
+            continue;
+        // Each process stores its layer's slices of A and B, its layer's
+        // contribution to C, and the sum of the contributions on the
+        // original grid
+        const double required =
+          sizeof(T)*(double(m)*k + double(k)*n + (c+1)*double(m)*n) / p;
+        if( maximal || required <= numBytes )
+            numLayers = c;
+    }
+    return numLayers;
+}
+
+// The 2.5D algorithm splits the p processes into c layers, each a grid of
+// p/c processes which computes the contribution to C from a 1/c slice of the
+// inner dimension, and then sums the contributions over the layers. Relative
+// to SUMMA, this reduces the communication volume by a factor of sqrt(c) at
+// the cost of c copies of C. The 3D algorithm corresponds to c = p^{1/3}.
+template<typename T>
+void Layered
+( Orientation orientA, Orientation orientB,
+  T alpha, const AbstractDistMatrix<T>& APre,
+           const AbstractDistMatrix<T>& BPre,
+                 AbstractDistMatrix<T>& C, GemmAlgorithm alg )
+{
+    EL_DEBUG_CSE
+    const Grid& g = APre.Grid();
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( orientA == NORMAL ? APre.Width() : APre.Height() );
+    const Int numLayers =
+      ( g.HaveViewers() ? 1 : NumLayers<T>( m, n, k, g, alg == GEMM_3D ) );
+    if( numLayers == 1 )
+    {
+        Gemm( orientA, orientB, alpha, APre, BPre, T(1), C );
+        return;
+    }
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre ), BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    // Form the layer grids from contiguous ranges of the VC ranks
+    const int layerSize = g.Size() / numLayers;
+    const int vcRank = g.VCRank();
+    const int layer = vcRank / layerSize;
+    mpi::Group viewingGroup;
+    mpi::CommGroup( g.ViewingComm(), viewingGroup );
+    vector<unique_ptr<Grid>> grids(numLayers);
+    vector<int> ranks(layerSize);
+    for( Int l=0; l<numLayers; ++l )
+    {
+        for( int q=0; q<layerSize; ++q )
+            ranks[q] = g.VCToViewing( l*layerSize+q );
+        mpi::Group layerGroup;
+        mpi::Incl( viewingGroup, layerSize, ranks.data(), layerGroup );
+        grids[l].reset
+        ( new Grid
+          ( g.ViewingComm(), layerGroup, Grid::DefaultHeight(layerSize),
+            g.Order() ) );
+        mpi::Free( layerGroup );
+    }
+    mpi::Free( viewingGroup );
+
+    // Redistribute each slice of the inner dimension onto its layer
+    vector<DistMatrix<T>> ALayers, BLayers, CLayers;
+    ALayers.reserve( numLayers );
+    BLayers.reserve( numLayers );
+    CLayers.reserve( numLayers );
+    for( Int l=0; l<numLayers; ++l )
+    {
+        ALayers.emplace_back( *grids[l] );
+        BLayers.emplace_back( *grids[l] );
+        CLayers.emplace_back( *grids[l] );
+
+        const Range<Int> ind( (l*k)/numLayers, ((l+1)*k)/numLayers );
+        auto A1 = ( orientA == NORMAL ? A(ALL,ind) : A(ind,ALL) );
+        auto B1 = ( orientB == NORMAL ? B(ind,ALL) : B(ALL,ind) );
+        Copy( A1, ALayers[l] );
+        Copy( B1, BLayers[l] );
+        CLayers[l].Resize( m, n );
+    }
+
+    // Form each layer's contribution and sum them onto the first layer
+    auto& CLayer = CLayers[layer];
+    Gemm
+    ( orientA, orientB, alpha, ALayers[layer], BLayers[layer], CLayer );
+    ALayers.clear();
+    BLayers.clear();
+    mpi::Comm depthComm;
+    mpi::Split( g.VCComm(), vcRank % layerSize, layer, depthComm );
+    const Int localHeight = CLayer.LocalHeight();
+    const Int localWidth = CLayer.LocalWidth();
+    const Int localSize = localHeight*localWidth;
+    if( localHeight == CLayer.LDim() )
+    {
+        mpi::Reduce( CLayer.Buffer(), localSize, 0, depthComm );
+    }
+    else
+    {
+        vector<T> buf;
+        FastResize( buf, localSize );
+        copy::util::InterleaveMatrix
+        ( localHeight, localWidth,
+          CLayer.LockedBuffer(), 1, CLayer.LDim(),
+          buf.data(),            1, localHeight );
+        mpi::Reduce( buf.data(), localSize, 0, depthComm );
+        copy::util::InterleaveMatrix
+        ( localHeight, localWidth,
+          buf.data(),      1, localHeight,
+          CLayer.Buffer(), 1, CLayer.LDim() );
+    }
+    mpi::Free( depthComm );
+
+    // Return the sum to the original grid
+    DistMatrix<T> CSum(g);
+    Copy( CLayers[0], CSum );
+    CLayers.clear();
+    Axpy( T(1), CSum, C );
+}
+
+} // namespace gemm
+} // namespace El
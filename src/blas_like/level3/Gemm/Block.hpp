@@ -0,0 +1,73 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GEMM_BLOCK_HPP
+#define EL_GEMM_BLOCK_HPP
+
+namespace El {
+namespace gemm {
+
+// Whether C := alpha A B + C can be computed directly on [MC,MR,BLOCK]
+// matrices: the rows of C must be distributed like those of A, the columns
+// of C like those of B, and the column blocks of A must match the row blocks
+// of B (as required by PDGEMM)
+template<typename T>
+bool BlockCompatibleNN
+( const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+  const AbstractDistMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    using namespace block_cyclic;
+    return IsMCMRBlock(A) && IsMCMRBlock(B) && IsMCMRBlock(C) &&
+           A.Grid() == C.Grid() && B.Grid() == C.Grid() &&
+           SameColDistribution( A, C ) && SameRowDistribution( B, C ) &&
+           A.BlockWidth() == B.BlockHeight() && A.RowCut() == B.ColCut();
+}
+
+// C := alpha A B + C as a sequence of rank-b updates, one per distribution
+// block of the inner dimension: each column panel of A is broadcast within
+// process rows from its owning process column, each row panel of B within
+// process columns from its owning process row, and the update is then
+// purely local
+template<typename T>
+void BlockNN
+( T alpha,
+  const DistMatrix<T,MC,MR,BLOCK>& A,
+  const DistMatrix<T,MC,MR,BLOCK>& B,
+        DistMatrix<T,MC,MR,BLOCK>& C )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != C.Height() || B.Width() != C.Width() ||
+          A.Width() != B.Height() )
+          LogicError
+          ("Nonconformal BlockNN: ",
+           DimsString(A,"A"),", ",DimsString(B,"B"),", ",DimsString(C,"C"));
+    )
+    const Int m = A.Height();
+    const Int n = B.Width();
+    const Int sumDim = A.Width();
+    const Int bsize = A.BlockWidth();
+    const Int cut = A.RowCut();
+
+    Matrix<T> A1, B1;
+    for( Int k=0; k<sumDim; )
+    {
+        const Int kEnd = block_cyclic::BlockEnd( k, bsize, cut, sumDim );
+        block_cyclic::BroadcastColPanel( A, 0, m, k, kEnd, A1 );
+        block_cyclic::BroadcastRowPanel( B, k, kEnd, 0, n, B1 );
+        Gemm( NORMAL, NORMAL, alpha, A1, B1, T(1), C.Matrix() );
+        k = kEnd;
+    }
+}
+
+} // namespace gemm
+} // namespace El
+
+#endif // ifndef EL_GEMM_BLOCK_HPP
@@ -0,0 +1,242 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+
+#include <fstream>
+
+namespace El {
+
+namespace {
+
+GemmCostModel costModel;
+bool logSelection = false;
+
+// The number of stages of a tree-based collective over p processes
+double NumStages( Int p )
+{
+    double numStages = 0;
+    for( Int q=1; q<p; q*=2 )
+        ++numStages;
+    return numStages;
+}
+
+const char* AlgorithmName( GemmAlgorithm alg )
+{
+    switch( alg )
+    {
+    case GEMM_SUMMA_A:   return "SUMMA_A";
+    case GEMM_SUMMA_B:   return "SUMMA_B";
+    case GEMM_SUMMA_C:   return "SUMMA_C";
+    case GEMM_SUMMA_DOT: return "SUMMA_DOT";
+    default:             return "other";
+    }
+}
+
+} // anonymous namespace
+
+void CalibrateGemmCostModel( const Grid& grid )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = grid.VCComm();
+    const Int p = grid.Size();
+    const Int numTrials = 10;
+    Timer timer;
+
+    // The latency of a small all-reduction
+    double latencyTime = 0;
+    if( p > 1 )
+    {
+        double dummy = 0;
+        mpi::Barrier( comm );
+        timer.Start();
+        for( Int trial=0; trial<numTrials; ++trial )
+            dummy = mpi::AllReduce( dummy, comm );
+        latencyTime = timer.Stop() / numTrials;
+    }
+
+    // The bandwidth of a large all-gather
+    double gatherTime = 0;
+    const Int numEntries = 1 << 15;
+    if( p > 1 )
+    {
+        vector<double> sendBuf(numEntries,1.), recvBuf(numEntries*p);
+        mpi::Barrier( comm );
+        timer.Start();
+        for( Int trial=0; trial<numTrials; ++trial )
+            mpi::AllGather
+            ( sendBuf.data(), numEntries, recvBuf.data(), numEntries, comm );
+        gatherTime = timer.Stop() / numTrials;
+    }
+
+    // The flop rate of a moderately-sized local Gemm
+    const Int nLoc = 256;
+    vector<double> A(nLoc*nLoc,1.), B(nLoc*nLoc,1.), C(nLoc*nLoc,0.);
+    timer.Start();
+    blas::Gemm
+    ( 'N', 'N', nLoc, nLoc, nLoc,
+      1., A.data(), nLoc, B.data(), nLoc, 0., C.data(), nLoc );
+    const double gemmTime = timer.Stop();
+
+    // Every process must make identical decisions
+    latencyTime = mpi::AllReduce( latencyTime, mpi::MAX, comm );
+    gatherTime = mpi::AllReduce( gatherTime, mpi::MAX, comm );
+    const double flopTime =
+      mpi::AllReduce( gemmTime, mpi::MAX, comm ) / (2.*nLoc*nLoc*nLoc);
+
+    GemmCostModel model;
+    if( p > 1 )
+    {
+        const double numStages = NumStages( p );
+        const double numBytes = double(p-1)*numEntries*sizeof(double);
+        model.latency = latencyTime / numStages;
+        model.inverseBandwidth =
+          Max( gatherTime-numStages*model.latency, 0. ) / numBytes;
+    }
+    model.flopTime = flopTime;
+    model.calibrated = true;
+    SetGemmCostModel( model );
+}
+
+void SetGemmCostModel( const GemmCostModel& model ) { costModel = model; }
+
+const GemmCostModel& GetGemmCostModel() { return costModel; }
+
+void SaveGemmCostModel( const string& filename )
+{
+    EL_DEBUG_CSE
+    if( !costModel.calibrated )
+        LogicError("The Gemm cost model has not been calibrated");
+    if( mpi::Rank(mpi::COMM_WORLD) != 0 )
+        return;
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.precision( 17 );
+    file << costModel.latency << " "
+         << costModel.inverseBandwidth << " "
+         << costModel.flopTime << std::endl;
+}
+
+void LoadGemmCostModel( const string& filename )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    GemmCostModel model;
+    if( !(file >> model.latency >> model.inverseBandwidth >> model.flopTime) )
+        RuntimeError("Could not parse a Gemm cost model from ",filename);
+    model.calibrated = true;
+    SetGemmCostModel( model );
+}
+
+double GemmCost
+( GemmAlgorithm alg, Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, const Grid& grid, Int entrySize )
+{
+    EL_DEBUG_CSE
+    const double r = grid.Height();
+    const double c = grid.Width();
+    const double p = grid.Size();
+    const double nb = Blocksize();
+    const double blockSizeDot = 2000;
+    const double colStages = NumStages( grid.Height() );
+    const double rowStages = NumStages( grid.Width() );
+    const double stages = NumStages( grid.Size() );
+    // Redistributing a transposed panel requires an extra permutation
+    const double transA = ( orientA == NORMAL ? 0 : stages );
+    const double transB = ( orientB == NORMAL ? 0 : stages );
+
+    // The number of messages and the number of bytes received per process
+    double numMessages, numBytes;
+    switch( alg )
+    {
+    case GEMM_SUMMA_A:
+        // Gather each panel of B into [MR,* ] and sum-scatter the update of C
+        numMessages = Ceil(n/nb)*(stages+rowStages+transB);
+        numBytes = entrySize*n*(k/c + m*(c-1)/p);
+        break;
+    case GEMM_SUMMA_B:
+        // Gather each panel of A into [* ,MC] and sum-scatter the update of C
+        numMessages = Ceil(m/nb)*(stages+colStages+transA);
+        numBytes = entrySize*m*(k/r + n*(r-1)/p);
+        break;
+    case GEMM_SUMMA_C:
+        // Gather each panel of A into [MC,* ] and each panel of B into [* ,MR]
+        numMessages = Ceil(k/nb)*(rowStages+colStages+transA+transB);
+        numBytes = entrySize*k*(m*(c-1)/p + n*(r-1)/p);
+        break;
+    case GEMM_SUMMA_DOT:
+        // Redistribute A and B over the inner dimension and sum each block of C
+        numMessages =
+          2*stages + Ceil(m/blockSizeDot)*Ceil(n/blockSizeDot)*stages;
+        numBytes = entrySize*(double(m)*k/p + double(k)*n/p + double(m)*n);
+        break;
+    default:
+        LogicError("No cost model for Gemm algorithm ",Int(alg));
+        return 0;
+    }
+    const double numFlops = 2.*m*n*k/p;
+    return costModel.latency*numMessages +
+           costModel.inverseBandwidth*numBytes +
+           costModel.flopTime*numFlops;
+}
+
+GemmAlgorithm SelectGemmAlgorithm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, const Grid& grid, Int entrySize )
+{
+    EL_DEBUG_CSE
+    GemmAlgorithm alg;
+    double cost = 0;
+    if( costModel.calibrated )
+    {
+        alg = GEMM_SUMMA_C;
+        cost = GemmCost( alg, orientA, orientB, m, n, k, grid, entrySize );
+        const GemmAlgorithm candidates[] =
+          { GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_DOT };
+        for( const GemmAlgorithm candidate : candidates )
+        {
+            const double candidateCost =
+              GemmCost( candidate, orientA, orientB, m, n, k, grid, entrySize );
+            if( candidateCost < cost )
+            {
+                alg = candidate;
+                cost = candidateCost;
+            }
+        }
+    }
+    else
+    {
+        // Fall back to the shape-based heuristic
+        const double weightTowardsC = 2.;
+        const double weightAwayFromDot = 10.;
+        if( weightAwayFromDot*m <= k && weightAwayFromDot*n <= k )
+            alg = GEMM_SUMMA_DOT;
+        else if( m <= n && weightTowardsC*m <= k )
+            alg = GEMM_SUMMA_B;
+        else if( n <= m && weightTowardsC*n <= k )
+            alg = GEMM_SUMMA_A;
+        else
+            alg = GEMM_SUMMA_C;
+    }
+    if( logSelection )
+        Log
+        ("Gemm",OrientationToChar(orientA),OrientationToChar(orientB)," ",
+         m," x ",n," x ",k," on a ",grid.Height()," x ",grid.Width(),
+         " grid: ",AlgorithmName(alg),
+         ( costModel.calibrated ?
+           BuildString(" (predicted ",cost," seconds)") : string() ));
+    return alg;
+}
+
+void SetGemmSelectionLogging( bool log ) { logSelection = log; }
+
+} // namespace El
@@ -0,0 +1,166 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+
+// The accumulation into single precision relies on the float instantiations
+#ifndef HYDROGEN_NO_FLOAT_INSTANTIATION
+
+namespace El {
+namespace gemm {
+
+// The sixteen-bit formats are real, so an adjoint is just a transpose
+inline Orientation WidenedOrientation( Orientation orient )
+{ return orient == NORMAL ? NORMAL : TRANSPOSE; }
+
+template<typename T>
+void LowPrecision
+( Orientation orientA, Orientation orientB,
+  float alpha, const Matrix<T>& A, const Matrix<T>& B,
+  float beta,        Matrix<float>& C )
+{
+    EL_DEBUG_CSE
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+    const Int k = ( normalA ? A.Width() : A.Height() );
+    if( (normalA ? A.Height() : A.Width()) != C.Height() ||
+        (normalB ? B.Width() : B.Height()) != C.Width() ||
+        (normalB ? B.Height() : B.Width()) != k )
+        LogicError
+        ("Nonconformal Gemm: A is ",A.Height()," x ",A.Width(),", B is ",
+         B.Height()," x ",B.Width(),", and C is ",C.Height()," x ",C.Width());
+    if( k == 0 )
+    {
+        Scale( beta, C );
+        return;
+    }
+    const Orientation localOrientA = WidenedOrientation( orientA );
+    const Orientation localOrientB = WidenedOrientation( orientB );
+
+    // Only one panel of each input is ever held in single precision
+    Matrix<float> A1, B1;
+    const Int bsize = Blocksize();
+    for( Int k0=0; k0<k; k0+=bsize )
+    {
+        const Int nb = Min(bsize,k-k0);
+        const Range<Int> ind1( k0, k0+nb );
+
+        if( normalA )
+            Copy( A( ALL, ind1 ), A1 );
+        else
+            Copy( A( ind1, ALL ), A1 );
+        if( normalB )
+            Copy( B( ind1, ALL ), B1 );
+        else
+            Copy( B( ALL, ind1 ), B1 );
+        Gemm
+        ( localOrientA, localOrientB,
+          alpha, A1, B1, ( k0 == 0 ? beta : float(1) ), C );
+    }
+}
+
+template<typename T>
+void LowPrecision
+( Orientation orientA, Orientation orientB,
+  float alpha, const AbstractDistMatrix<T>& APre,
+               const AbstractDistMatrix<T>& BPre,
+  float beta,        AbstractDistMatrix<float>& CPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( APre, BPre, CPre ))
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+    const Int k = ( normalA ? APre.Width() : APre.Height() );
+    if( (normalA ? APre.Height() : APre.Width()) != CPre.Height() ||
+        (normalB ? BPre.Width() : BPre.Height()) != CPre.Width() ||
+        (normalB ? BPre.Height() : BPre.Width()) != k )
+        LogicError("Nonconformal Gemm");
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre ), BProx( BPre );
+    DistMatrixReadWriteProxy<float,float,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+    if( k == 0 )
+    {
+        Scale( beta, C );
+        return;
+    }
+    const Grid& g = C.Grid();
+    const Orientation localOrientA = WidenedOrientation( orientA );
+    const Orientation localOrientB = WidenedOrientation( orientB );
+
+    // The panels are redistributed in sixteen bits and only widened once
+    // they are local
+    DistMatrix<T,MC,STAR> A1_MC_STAR(g);
+    DistMatrix<T,STAR,MC> A1_STAR_MC(g);
+    DistMatrix<T,STAR,MR> B1_STAR_MR(g);
+    DistMatrix<T,MR,STAR> B1_MR_STAR(g);
+    A1_MC_STAR.AlignWith( C );
+    A1_STAR_MC.AlignWith( C );
+    B1_STAR_MR.AlignWith( C );
+    B1_MR_STAR.AlignWith( C );
+    Matrix<float> A1Loc, B1Loc;
+
+    const Int bsize = Blocksize();
+    for( Int k0=0; k0<k; k0+=bsize )
+    {
+        const Int nb = Min(bsize,k-k0);
+        const Range<Int> ind1( k0, k0+nb );
+
+        if( normalA )
+        {
+            A1_MC_STAR = A( ALL, ind1 );
+            Copy( A1_MC_STAR.LockedMatrix(), A1Loc );
+        }
+        else
+        {
+            A1_STAR_MC = A( ind1, ALL );
+            Copy( A1_STAR_MC.LockedMatrix(), A1Loc );
+        }
+        if( normalB )
+        {
+            B1_STAR_MR = B( ind1, ALL );
+            Copy( B1_STAR_MR.LockedMatrix(), B1Loc );
+        }
+        else
+        {
+            B1_MR_STAR = B( ALL, ind1 );
+            Copy( B1_MR_STAR.LockedMatrix(), B1Loc );
+        }
+        Gemm
+        ( localOrientA, localOrientB,
+          alpha, A1Loc, B1Loc, ( k0 == 0 ? beta : float(1) ), C.Matrix() );
+    }
+}
+
+} // namespace gemm
+
+#define PROTO(T) \
+  void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    float alpha, const Matrix<T>& A, const Matrix<T>& B, \
+    float beta,        Matrix<float>& C ) \
+  { gemm::LowPrecision( orientA, orientB, alpha, A, B, beta, C ); } \
+  void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    float alpha, const AbstractDistMatrix<T>& A, \
+                 const AbstractDistMatrix<T>& B, \
+    float beta,        AbstractDistMatrix<float>& C ) \
+  { gemm::LowPrecision( orientA, orientB, alpha, A, B, beta, C ); }
+
+PROTO(Half)
+PROTO(BFloat16)
+
+#undef PROTO
+
+} // namespace El
+
+#endif // ifndef HYDROGEN_NO_FLOAT_INSTANTIATION
@@ -217,6 +217,213 @@ void SUMMA_NNC
     }
 }
 
+// Normal Normal Gemm that avoids communicating the matrix A, with the
+// contractions of the previous 'lookahead' panels of C overlapped with the
+// current local update
+template<typename T>
+void SUMMA_NNA_Pipelined
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    const Int n = CPre.Width();
+    const Int bsize = Blocksize();
+    const Int numSlots = GemmLookahead()+1;
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    ElementalProxyCtrl ctrlA;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    // Temporary distributions
+    DistMatrix<T,VR,STAR> B1_VR_STAR(g);
+    DistMatrix<T,STAR,MR> B1Trans_STAR_MR(g);
+    DistMatrix<T,MC,STAR> D1_MC_STAR(g);
+
+    B1_VR_STAR.AlignWith( A );
+    B1Trans_STAR_MR.AlignWith( A );
+    D1_MC_STAR.AlignWith( A );
+
+    // The contracted panels which are still in flight
+    vector<DistMatrix<T,MC,MR>> E1(numSlots,DistMatrix<T,MC,MR>(g));
+    vector<RedistFuture<T>> futures(numSlots);
+    vector<Int> offsets(numSlots,-1);
+    auto finish = [&]( Int slot )
+    {
+        if( offsets[slot] < 0 )
+            return;
+        futures[slot].Wait();
+        const Int k = offsets[slot];
+        auto C1 = C( ALL, IR(k,k+E1[slot].Width()) );
+        Axpy( T(1), E1[slot].LockedMatrix(), C1.Matrix() );
+        offsets[slot] = -1;
+    };
+
+    Int slot = 0;
+    for( Int k=0; k<n; k+=bsize, slot=(slot+1)%numSlots )
+    {
+        const Int nb = Min(bsize,n-k);
+        auto B1 = B( ALL, IR(k,k+nb) );
+        auto C1 = C( ALL, IR(k,k+nb) );
+
+        // D1[MC,*] := alpha A[MC,MR] B1[MR,*]
+        B1_VR_STAR = B1;
+        Transpose( B1_VR_STAR, B1Trans_STAR_MR );
+        LocalGemm( NORMAL, TRANSPOSE, alpha, A, B1Trans_STAR_MR, D1_MC_STAR );
+
+        // Start summing D1[MC,*] over grid rows and scattering the result
+        finish( slot );
+        E1[slot].AlignWith( C1 );
+        futures[slot] = ContractAsync( D1_MC_STAR, E1[slot] );
+        offsets[slot] = k;
+    }
+    for( Int s=0; s<numSlots; ++s, slot=(slot+1)%numSlots )
+        finish( slot );
+}
+
+// Normal Normal Gemm that avoids communicating the matrix B, with the
+// contractions of the previous 'lookahead' panels of C overlapped with the
+// current local update
+template<typename T>
+void SUMMA_NNB_Pipelined
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    const Int m = CPre.Height();
+    const Int bsize = Blocksize();
+    const Int numSlots = GemmLookahead()+1;
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    ElementalProxyCtrl ctrlB;
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    // Temporary distributions
+    DistMatrix<T,STAR,MC> A1_STAR_MC(g);
+    DistMatrix<T,MR,STAR> D1Trans_MR_STAR(g);
+    DistMatrix<T,STAR,MR> D1_STAR_MR(g);
+
+    A1_STAR_MC.AlignWith( B );
+    D1Trans_MR_STAR.AlignWith( B );
+
+    // The contracted panels which are still in flight
+    vector<DistMatrix<T,MC,MR>> E1(numSlots,DistMatrix<T,MC,MR>(g));
+    vector<RedistFuture<T>> futures(numSlots);
+    vector<Int> offsets(numSlots,-1);
+    auto finish = [&]( Int slot )
+    {
+        if( offsets[slot] < 0 )
+            return;
+        futures[slot].Wait();
+        const Int k = offsets[slot];
+        auto C1 = C( IR(k,k+E1[slot].Height()), ALL );
+        Axpy( T(1), E1[slot].LockedMatrix(), C1.Matrix() );
+        offsets[slot] = -1;
+    };
+
+    Int slot = 0;
+    for( Int k=0; k<m; k+=bsize, slot=(slot+1)%numSlots )
+    {
+        const Int nb = Min(bsize,m-k);
+        auto A1 = A( IR(k,k+nb), ALL );
+        auto C1 = C( IR(k,k+nb), ALL );
+
+        // D1^T[MR,* ] := alpha B^T[MR,MC] A1^T[MC,* ]
+        A1_STAR_MC = A1;
+        LocalGemm
+        ( TRANSPOSE, TRANSPOSE, alpha, B, A1_STAR_MC, D1Trans_MR_STAR );
+        Transpose( D1Trans_MR_STAR, D1_STAR_MR );
+
+        // Start summing D1[* ,MR] over grid columns and scattering the result
+        finish( slot );
+        E1[slot].AlignWith( C1 );
+        futures[slot] = ContractAsync( D1_STAR_MR, E1[slot] );
+        offsets[slot] = k;
+    }
+    for( Int s=0; s<numSlots; ++s, slot=(slot+1)%numSlots )
+        finish( slot );
+}
+
+// Normal Normal Gemm that avoids communicating the matrix C, with the panel
+// AllGathers of the next 'lookahead' iterations overlapped with the current
+// local update
+template<typename T>
+void SUMMA_NNC_Pipelined
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    const Int sumDim = APre.Width();
+    const Int bsize = Blocksize();
+    const Int lookahead = GemmLookahead();
+    const Int numSlots = lookahead+1;
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    // Each slot holds a pair of panels and their pending AllGathers
+    vector<DistMatrix<T,MC,STAR>> A1_MC_STAR(numSlots,DistMatrix<T,MC,STAR>(g));
+    vector<DistMatrix<T,STAR,MR>> B1_STAR_MR(numSlots,DistMatrix<T,STAR,MR>(g));
+    vector<RedistFuture<T>> futuresA(numSlots), futuresB(numSlots);
+    for( Int s=0; s<numSlots; ++s )
+    {
+        A1_MC_STAR[s].AlignWith( C );
+        B1_STAR_MR[s].AlignWith( C );
+    }
+    auto start = [&]( Int k )
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        const Int slot = (k/bsize) % numSlots;
+        auto A1 = A( ALL,        IR(k,k+nb) );
+        auto B1 = B( IR(k,k+nb), ALL        );
+        futuresA[slot] = CopyAsync( A1, A1_MC_STAR[slot] );
+        futuresB[slot] = CopyAsync( B1, B1_STAR_MR[slot] );
+    };
+
+    for( Int k=0; k<Min(lookahead*bsize,sumDim); k+=bsize )
+        start( k );
+    for( Int k=0; k<sumDim; k+=bsize )
+    {
+        if( k+lookahead*bsize < sumDim )
+            start( k+lookahead*bsize );
+
+        // C[MC,MR] += alpha A1[MC,*] B1[*,MR]
+        const Int slot = (k/bsize) % numSlots;
+        futuresA[slot].Wait();
+        futuresB[slot].Wait();
+        LocalGemm
+        ( NORMAL, NORMAL, alpha, A1_MC_STAR[slot], B1_STAR_MR[slot], T(1), C );
+    }
+}
+
 // Normal Normal Gemm for panel-panel dot products
 //
 // Use summations of local multiplications from a 1D distribution of A and B
@@ -315,6 +522,9 @@ void SUMMA_NN
     case GEMM_SUMMA_B:   SUMMA_NNB( alpha, A, B, C ); break;
     case GEMM_SUMMA_C:   SUMMA_NNC( alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_NNDot( alpha, A, B, C, blockSizeDot ); break;
+    case GEMM_SUMMA_A_PIPELINED: SUMMA_NNA_Pipelined( alpha, A, B, C ); break;
+    case GEMM_SUMMA_B_PIPELINED: SUMMA_NNB_Pipelined( alpha, A, B, C ); break;
+    case GEMM_SUMMA_C_PIPELINED: SUMMA_NNC_Pipelined( alpha, A, B, C ); break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -0,0 +1,210 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GEMM_OZAKI_HPP
+#define EL_GEMM_OZAKI_HPP
+
+namespace El {
+namespace gemm {
+
+// The real types without vendor BLAS support whose Gemm can be emulated
+template<typename T>
+struct IsOzakiScalar
+{
+    static const bool value =
+      !IsBlasScalar<T>::value && !IsComplex<T>::value &&
+      !IsIntegral<T>::value;
+};
+
+// The number of bits of precision of a real type
+template<typename Real>
+Int OzakiNumBits()
+{
+    const double eps = double(limits::Epsilon<Real>());
+    return Int(std::ceil(-std::log2(eps)));
+}
+#ifdef HYDROGEN_HAVE_MPC
+template<>
+inline Int OzakiNumBits<BigFloat>() { return Int(mpfr::Precision()); }
+#endif
+
+// Split op(X) into 'numSlices' integer-valued double-precision matrices X_p,
+// with entries of magnitude at most 2^sliceBits, such that
+//
+//   op(X) ~= sum_p diag(scales(:,p)) X_p, if 'byRows', and
+//   op(X) ~= sum_p X_p diag(scales(:,p)), otherwise,
+//
+// where each scale is a power of two. False is returned if an entry lies
+// outside of the range of double precision.
+template<typename Real>
+bool OzakiSplit
+( Orientation orient, const Matrix<Real>& X,
+  bool byRows, Int numSlices, Int sliceBits,
+  vector<Matrix<double>>& slices, Matrix<double>& scales )
+{
+    EL_DEBUG_CSE
+    // The residual, R := op(X), is exactly updated after each slice
+    Matrix<Real> R;
+    if( orient == NORMAL )
+        R = X;
+    else
+        Transpose( X, R );
+    const Int m = R.Height();
+    const Int n = R.Width();
+    Real* RBuf = R.Buffer();
+    const Int RLDim = R.LDim();
+
+    const Int numScales = ( byRows ? m : n );
+    slices.resize( numSlices );
+    scales.Resize( numScales, numSlices );
+    vector<double> maxAbs( numScales );
+    for( Int p=0; p<numSlices; ++p )
+    {
+        double* scale = scales.Buffer(0,p);
+        std::fill( maxAbs.begin(), maxAbs.end(), 0. );
+        for( Int j=0; j<n; ++j )
+        {
+            for( Int i=0; i<m; ++i )
+            {
+                const double rhoAbs = std::abs( double(RBuf[i+j*RLDim]) );
+                if( !std::isfinite(rhoAbs) )
+                    return false;
+                const Int index = ( byRows ? i : j );
+                maxAbs[index] = Max( maxAbs[index], rhoAbs );
+            }
+        }
+        for( Int index=0; index<numScales; ++index )
+        {
+            if( maxAbs[index] == 0. )
+            {
+                scale[index] = 1;
+                continue;
+            }
+            // |rho| < 2^(ilogb(maxAbs)+1), and so |rho/scale| < 2^sliceBits
+            scale[index] =
+              std::ldexp( 1., std::ilogb(maxAbs[index])+1-int(sliceBits) );
+            if( scale[index] == 0. )
+                return false;
+        }
+
+        // X_p := round(R/scale) and R := R - scale X_p, which is exact
+        Matrix<double>& S = slices[p];
+        S.Resize( m, n );
+        double* SBuf = S.Buffer();
+        const Int SLDim = S.LDim();
+        for( Int j=0; j<n; ++j )
+        {
+            for( Int i=0; i<m; ++i )
+            {
+                const double sigma = scale[byRows ? i : j];
+                const double chi =
+                  std::nearbyint( double(RBuf[i+j*RLDim]) / sigma );
+                SBuf[i+j*SLDim] = chi;
+                RBuf[i+j*RLDim] -= chi*sigma;
+            }
+        }
+    }
+    return true;
+}
+
+// C := alpha op(A) op(B) + beta C via the error-free splitting of
+//   Katsuhisa Ozaki, Takeshi Ogita, Shin'ichi Oishi, and Siegfried M. Rump,
+//   "Error-free transformations of matrix multiplication by using fast
+//    routines of matrix multiplication and its applications",
+//   Numerical Algorithms, Vol. 59, No. 1, pp. 95--118, 2012.
+//
+// Each row of op(A) and each column of op(B) is split into a sum of slices of
+// integers of magnitude at most 2^sliceBits, scaled by powers of two, where
+// k 2^(2 sliceBits) <= 2^53, so that the product of any slice of op(A) with
+// any slice of op(B) is computed exactly by the double-precision (vendor)
+// Gemm. The products of the pairs of slices whose combined significance is
+// within the precision of the type are then accumulated in its arithmetic,
+// from the least to the most significant.
+//
+// False is returned, and C is left unmodified, if an entry of A or B lies
+// outside of the range of double precision or k is too large.
+template<typename Real,typename=EnableIf<IsOzakiScalar<Real>>>
+bool Ozaki
+( Orientation orientA, Orientation orientB,
+  Real alpha, const Matrix<Real>& A,
+              const Matrix<Real>& B,
+  Real beta,        Matrix<Real>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    if( m == 0 || n == 0 || k == 0 )
+        return false;
+    const Int sliceBits = (53-Int(std::ceil(std::log2(double(k)))))/2;
+    if( sliceBits < 2 )
+        return false;
+    Int numSlices = OzakiNumSlices<Real>();
+    if( numSlices == 0 )
+    {
+        // Each slice captures at least sliceBits-1 bits
+        numSlices = (OzakiNumBits<Real>()+sliceBits-2)/(sliceBits-1) + 1;
+    }
+
+    vector<Matrix<double>> ASlices, BSlices;
+    Matrix<double> AScales, BScales;
+    if( !OzakiSplit
+        ( orientA, A, true, numSlices, sliceBits, ASlices, AScales ) ||
+        !OzakiSplit
+        ( orientB, B, false, numSlices, sliceBits, BSlices, BScales ) )
+        return false;
+
+    Matrix<Real> accum( m, n );
+    Zero( accum );
+    Real* accumBuf = accum.Buffer();
+    const Int accumLDim = accum.LDim();
+    Matrix<double> product;
+    Real delta;
+    for( Int level=numSlices-1; level>=0; --level )
+    {
+        for( Int p=0; p<=level; ++p )
+        {
+            const Int q = level - p;
+            Gemm( NORMAL, NORMAL, 1., ASlices[p], BSlices[q], product );
+            const double* productBuf = product.LockedBuffer();
+            const Int productLDim = product.LDim();
+            const double* AScale = AScales.LockedBuffer(0,p);
+            const double* BScale = BScales.LockedBuffer(0,q);
+            for( Int j=0; j<n; ++j )
+            {
+                for( Int i=0; i<m; ++i )
+                {
+                    const double pi = productBuf[i+j*productLDim];
+                    if( pi == 0. )
+                        continue;
+                    delta = pi;
+                    delta *= AScale[i];
+                    delta *= BScale[j];
+                    accumBuf[i+j*accumLDim] += delta;
+                }
+            }
+        }
+    }
+
+    ScaleForGemm( beta, C );
+    Axpy( alpha, accum, C );
+    return true;
+}
+
+template<typename T,typename=DisableIf<IsOzakiScalar<T>>,typename=void>
+bool Ozaki
+( Orientation orientA, Orientation orientB,
+  T alpha, const Matrix<T>& A,
+           const Matrix<T>& B,
+  T beta,        Matrix<T>& C )
+{ return false; }
+
+} // namespace gemm
+} // namespace El
+
+#endif // ifndef EL_GEMM_OZAKI_HPP
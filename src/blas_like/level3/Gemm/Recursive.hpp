@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GEMM_RECURSIVE_HPP
+#define EL_GEMM_RECURSIVE_HPP
+
+namespace El {
+namespace gemm {
+
+// Cache-oblivious C := alpha op(A) op(B) + beta C for scalar types without
+// BLAS support: the largest of the three dimensions is halved until each is
+// at most the cutoff, so that the (naive) reference kernel only ever runs on
+// operands which fit in cache.
+template<typename T>
+void Recursive
+( Orientation orientA, Orientation orientB,
+  T alpha, const Matrix<T>& A,
+           const Matrix<T>& B,
+  T beta,        Matrix<T>& C,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    if( m == 0 || n == 0 )
+        return;
+    if( Max(Max(m,n),k) <= cutoff || k == 0 )
+    {
+        if( k == 0 )
+        {
+            C *= beta;
+            return;
+        }
+        const char transA = OrientationToChar( orientA );
+        const char transB = OrientationToChar( orientB );
+        blas::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A.LockedBuffer(), A.LDim(),
+                 B.LockedBuffer(), B.LDim(),
+          beta,  C.Buffer(),       C.LDim() );
+        return;
+    }
+
+    if( m >= n && m >= k )
+    {
+        const Range<Int> indT( 0, m/2 ), indB( m/2, m );
+        auto CT = C( indT, ALL );
+        auto CB = C( indB, ALL );
+        auto AT = ( orientA == NORMAL ? A( indT, ALL ) : A( ALL, indT ) );
+        auto AB = ( orientA == NORMAL ? A( indB, ALL ) : A( ALL, indB ) );
+        Recursive( orientA, orientB, alpha, AT, B, beta, CT, cutoff );
+        Recursive( orientA, orientB, alpha, AB, B, beta, CB, cutoff );
+    }
+    else if( n >= k )
+    {
+        const Range<Int> indL( 0, n/2 ), indR( n/2, n );
+        auto CL = C( ALL, indL );
+        auto CR = C( ALL, indR );
+        auto BL = ( orientB == NORMAL ? B( ALL, indL ) : B( indL, ALL ) );
+        auto BR = ( orientB == NORMAL ? B( ALL, indR ) : B( indR, ALL ) );
+        Recursive( orientA, orientB, alpha, A, BL, beta, CL, cutoff );
+        Recursive( orientA, orientB, alpha, A, BR, beta, CR, cutoff );
+    }
+    else
+    {
+        const Range<Int> ind1( 0, k/2 ), ind2( k/2, k );
+        auto A1 = ( orientA == NORMAL ? A( ALL, ind1 ) : A( ind1, ALL ) );
+        auto A2 = ( orientA == NORMAL ? A( ALL, ind2 ) : A( ind2, ALL ) );
+        auto B1 = ( orientB == NORMAL ? B( ind1, ALL ) : B( ALL, ind1 ) );
+        auto B2 = ( orientB == NORMAL ? B( ind2, ALL ) : B( ALL, ind2 ) );
+        Recursive( orientA, orientB, alpha, A1, B1, beta, C, cutoff );
+        Recursive( orientA, orientB, alpha, A2, B2, T(1), C, cutoff );
+    }
+}
+
+// The standard local kernel: vendor BLAS when it supports the scalar type,
+// and the above cache-oblivious recursion otherwise
+template<typename T>
+void Standard
+( Orientation orientA, Orientation orientB,
+  T alpha, const Matrix<T>& A,
+           const Matrix<T>& B,
+  T beta,        Matrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    const Int cutoff = LocalRecursionCutoff<T>();
+    if( !IsBlasScalar<T>::value && Max(Max(m,n),k) > cutoff )
+    {
+        Recursive( orientA, orientB, alpha, A, B, beta, C, cutoff );
+    }
+    else if( k != 0 )
+    {
+        const char transA = OrientationToChar( orientA );
+        const char transB = OrientationToChar( orientB );
+        blas::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A.LockedBuffer(), A.LDim(),
+                 B.LockedBuffer(), B.LDim(),
+          beta,  C.Buffer(),       C.LDim() );
+    }
+    else
+    {
+        C *= beta;
+    }
+}
+
+} // namespace gemm
+} // namespace El
+
+#endif // ifndef EL_GEMM_RECURSIVE_HPP
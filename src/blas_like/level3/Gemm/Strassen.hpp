@@ -0,0 +1,190 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GEMM_STRASSEN_HPP
+#define EL_GEMM_STRASSEN_HPP
+
+namespace El {
+namespace gemm {
+
+// Overwrite C with beta C, where beta=0 discards any NaN's in C as in BLAS
+template<typename T>
+void ScaleForGemm( T beta, Matrix<T>& C )
+{
+    if( beta == T(0) )
+        Zero( C );
+    else
+        C *= beta;
+}
+
+// The number of entries of workspace needed by StrassenWinogradNN for an
+// m x k times k x n product: each level needs the two operand sums and one
+// product of half size, and the (sequential) recursive calls share the
+// workspace of the next level
+inline Int StrassenWorkspaceSize( Int m, Int n, Int k, Int cutoff )
+{
+    if( Min(Min(m,n),k) <= cutoff )
+        return 0;
+    const Int mh = m/2, nh = n/2, kh = k/2;
+    return mh*kh + kh*nh + mh*nh +
+      StrassenWorkspaceSize( mh, nh, kh, cutoff );
+}
+
+// C := alpha A B + beta C via Winograd's variant of Strassen's algorithm,
+// using the schedule
+//
+//   S1 = A21 + A22,  T1 = B12 - B11,  P5 = S1 T1,
+//   S2 = S1 - A11,   T2 = B22 - T1,   P6 = S2 T2,
+//   S3 = A11 - A21,  T3 = B22 - B12,  P7 = S3 T3,
+//   S4 = A12 - S2,   T4 = T2 - B21,
+//   P1 = A11 B11,    P2 = A12 B21,    P3 = S4 B22,   P4 = A22 T4,
+//
+//   C11 = P1 + P2,   C12 = P1 + P6 + P5 + P3,
+//   C21 = P1 + P6 + P7 - P4,   C22 = P1 + P6 + P7 + P5,
+//
+// which only requires one half-sized temporary for each of A, B, and C.
+// Odd trailing rows/columns are peeled off and handled by the standard
+// kernel.
+template<typename T>
+void StrassenWinogradNN
+( T alpha, const Matrix<T>& A,
+           const Matrix<T>& B,
+  T beta,        Matrix<T>& C,
+  Int cutoff, T* workspace )
+{
+    EL_DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = A.Width();
+    if( Min(Min(m,n),k) <= cutoff )
+    {
+        Standard( NORMAL, NORMAL, alpha, A, B, beta, C );
+        return;
+    }
+    const Int mh = m/2, nh = n/2, kh = k/2;
+    const Range<Int> indM1( 0, mh ), indM2( mh, 2*mh ),
+                     indN1( 0, nh ), indN2( nh, 2*nh ),
+                     indK1( 0, kh ), indK2( kh, 2*kh );
+
+    auto A11 = A( indM1, indK1 );
+    auto A12 = A( indM1, indK2 );
+    auto A21 = A( indM2, indK1 );
+    auto A22 = A( indM2, indK2 );
+    auto B11 = B( indK1, indN1 );
+    auto B12 = B( indK1, indN2 );
+    auto B21 = B( indK2, indN1 );
+    auto B22 = B( indK2, indN2 );
+    auto C11 = C( indM1, indN1 );
+    auto C12 = C( indM1, indN2 );
+    auto C21 = C( indM2, indN1 );
+    auto C22 = C( indM2, indN2 );
+
+    Matrix<T> S, U, W;
+    S.Attach( mh, kh, workspace, mh );
+    U.Attach( kh, nh, &workspace[mh*kh], kh );
+    W.Attach( mh, nh, &workspace[mh*kh+kh*nh], mh );
+    T* subWorkspace = &workspace[mh*kh+kh*nh+mh*nh];
+
+    // W := alpha P5
+    S = A21;
+    S += A22;
+    U = B12;
+    U -= B11;
+    StrassenWinogradNN( alpha, S, U, T(0), W, cutoff, subWorkspace );
+    ScaleForGemm( beta, C12 );
+    C12 += W;
+    ScaleForGemm( beta, C22 );
+    C22 += W;
+
+    // Form S2 and T2
+    S -= A11;
+    U *= T(-1);
+    U += B22;
+
+    // C11 := alpha (P1 + P2) + beta C11, and W := alpha (P1 + P6)
+    StrassenWinogradNN( alpha, A11, B11, T(0), W, cutoff, subWorkspace );
+    ScaleForGemm( beta, C11 );
+    C11 += W;
+    StrassenWinogradNN( alpha, A12, B21, T(1), C11, cutoff, subWorkspace );
+    StrassenWinogradNN( alpha, S, U, T(1), W, cutoff, subWorkspace );
+
+    // C12 += W + alpha P3
+    C12 += W;
+    S *= T(-1);
+    S += A12;
+    StrassenWinogradNN( alpha, S, B22, T(1), C12, cutoff, subWorkspace );
+
+    // C21 := beta C21 - alpha P4
+    U -= B21;
+    ScaleForGemm( beta, C21 );
+    StrassenWinogradNN( -alpha, A22, U, T(1), C21, cutoff, subWorkspace );
+
+    // W += alpha P7, which is then added into C21 and C22
+    S = A11;
+    S -= A21;
+    U = B22;
+    U -= B12;
+    StrassenWinogradNN( alpha, S, U, T(1), W, cutoff, subWorkspace );
+    C21 += W;
+    C22 += W;
+
+    // Handle the peeled rows and columns
+    if( k > 2*kh )
+    {
+        auto CCore = C( IR(0,2*mh), IR(0,2*nh) );
+        Standard
+        ( NORMAL, NORMAL,
+          alpha, A( IR(0,2*mh), IR(2*kh,k) ), B( IR(2*kh,k), IR(0,2*nh) ),
+          T(1), CCore );
+    }
+    if( n > 2*nh )
+    {
+        auto CRight = C( ALL, IR(2*nh,n) );
+        Standard
+        ( NORMAL, NORMAL, alpha, A, B( ALL, IR(2*nh,n) ), beta, CRight );
+    }
+    if( m > 2*mh )
+    {
+        auto CBottom = C( IR(2*mh,m), IR(0,2*nh) );
+        Standard
+        ( NORMAL, NORMAL,
+          alpha, A( IR(2*mh,m), ALL ), B( ALL, IR(0,2*nh) ), beta, CBottom );
+    }
+}
+
+template<typename T>
+void StrassenWinograd
+( Orientation orientA, Orientation orientB,
+  T alpha, const Matrix<T>& A,
+           const Matrix<T>& B,
+  T beta,        Matrix<T>& C,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    // Explicitly (conjugate-)transposing the operands only requires
+    // quadratic work
+    Matrix<T> AOp, BOp;
+    if( orientA != NORMAL )
+        Transpose( A, AOp, orientA == ADJOINT );
+    if( orientB != NORMAL )
+        Transpose( B, BOp, orientB == ADJOINT );
+    const Matrix<T>& ANormal = ( orientA == NORMAL ? A : AOp );
+    const Matrix<T>& BNormal = ( orientB == NORMAL ? B : BOp );
+
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ANormal.Width();
+    Matrix<T> workspace( StrassenWorkspaceSize(m,n,k,cutoff), 1 );
+    StrassenWinogradNN
+    ( alpha, ANormal, BNormal, beta, C, cutoff, workspace.Buffer() );
+}
+
+} // namespace gemm
+} // namespace El
+
+#endif // ifndef EL_GEMM_STRASSEN_HPP
@@ -0,0 +1,164 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+template<typename Field>
+GramAccumulator<Field>::GramAccumulator( Int n, const El::Grid& grid )
+: n_(n), gram_(grid), localGram_(grid)
+{
+    EL_DEBUG_CSE
+    if( n < 0 )
+        LogicError("The width must be non-negative");
+    Reset();
+}
+
+template<typename Field>
+void GramAccumulator<Field>::Reset()
+{
+    EL_DEBUG_CSE
+    numRows_ = 0;
+    localNumRows_ = 0;
+    gram_.Resize( n_, n_ );
+    localGram_.Resize( n_, n_ );
+    sums_.Resize( n_, 1 );
+    localSums_.Resize( n_, 1 );
+    Zero( gram_ );
+    Zero( localGram_ );
+    Zero( sums_ );
+    Zero( localSums_ );
+}
+
+template<typename Field>
+void GramAccumulator<Field>::LocalUpdate( const Matrix<Field>& ABlock )
+{
+    EL_DEBUG_CSE
+    if( ABlock.Width() != n_ )
+        LogicError
+        ("Row block was of width ",ABlock.Width()," rather than ",n_);
+    const Int numRows = ABlock.Height();
+    if( numRows == 0 )
+        return;
+    Herk( LOWER, ADJOINT, Base<Field>(1), ABlock, Base<Field>(1),
+          localGram_.Matrix() );
+    for( Int j=0; j<n_; ++j )
+    {
+        Field sum = 0;
+        for( Int i=0; i<numRows; ++i )
+            sum += ABlock(i,j);
+        localSums_(j) += sum;
+    }
+    localNumRows_ += numRows;
+}
+
+template<typename Field>
+void GramAccumulator<Field>::Update( const Matrix<Field>& ABlock )
+{
+    EL_DEBUG_CSE
+    LocalUpdate( ABlock );
+}
+
+template<typename Field>
+void GramAccumulator<Field>::Update( const DistMatrix<Field,VC,STAR>& ABlock )
+{
+    EL_DEBUG_CSE
+    if( ABlock.Grid() != Grid() )
+        LogicError("Row block was not distributed over the same grid");
+    if( ABlock.Width() != n_ )
+        LogicError
+        ("Row block was of width ",ABlock.Width()," rather than ",n_);
+    LocalUpdate( ABlock.LockedMatrix() );
+}
+
+template<typename Field>
+void GramAccumulator<Field>::Flush()
+{
+    EL_DEBUG_CSE
+    // A single reduce-scatter combines every process's partial Gramian
+    AxpyContract( Field(1), localGram_, gram_ );
+    Zero( localGram_ );
+
+    const auto& comm = Grid().Comm();
+    AllReduce( localSums_, comm );
+    sums_ += localSums_;
+    Zero( localSums_ );
+    numRows_ += mpi::AllReduce( localNumRows_, comm );
+    localNumRows_ = 0;
+}
+
+template<typename Field>
+Int GramAccumulator<Field>::NumRows()
+{
+    EL_DEBUG_CSE
+    Flush();
+    return numRows_;
+}
+
+template<typename Field>
+void GramAccumulator<Field>::Gramian( DistMatrix<Field>& G )
+{
+    EL_DEBUG_CSE
+    Flush();
+    G = gram_;
+    MakeHermitian( LOWER, G );
+}
+
+template<typename Field>
+void GramAccumulator<Field>::ColumnMeans( Matrix<Field>& means )
+{
+    EL_DEBUG_CSE
+    Flush();
+    if( numRows_ == 0 )
+        LogicError("No rows have been accumulated");
+    means = sums_;
+    means *= Field(1)/Field(numRows_);
+}
+
+template<typename Field>
+void GramAccumulator<Field>::Covariance( DistMatrix<Field>& C )
+{
+    EL_DEBUG_CSE
+    Flush();
+    if( numRows_ < 2 )
+        LogicError("At least two rows are required for a covariance");
+
+    // C := (A^H A - conj(s) s^T / N) / (N-1), where s holds the column sums
+    C = gram_;
+    const Field numRowsInv = Field(1)/Field(numRows_);
+    const Field scale = Field(1)/Field(numRows_-1);
+    auto& CLoc = C.Matrix();
+    for( Int jLoc=0; jLoc<C.LocalWidth(); ++jLoc )
+    {
+        const Int j = C.GlobalCol(jLoc);
+        const Field sum = sums_(j);
+        for( Int iLoc=0; iLoc<C.LocalHeight(); ++iLoc )
+        {
+            const Int i = C.GlobalRow(iLoc);
+            if( i >= j )
+                CLoc(iLoc,jLoc) =
+                  scale*(CLoc(iLoc,jLoc) - Conj(sums_(i))*sum*numRowsInv);
+        }
+    }
+    MakeHermitian( LOWER, C );
+}
+
+#define PROTO(Field) \
+  template class GramAccumulator<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,264 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+namespace kronecker {
+
+// op(A \otimes B) vec(X) = vec(op(B) X op(A)^T) can either be evaluated as
+// (op(B) X) op(A)^T or as op(B) (X op(A)^T); return whether the former
+// requires fewer flops
+inline bool LeftFirst( Int mA, Int nA, Int mB, Int nB )
+{
+    const double leftCost = double(mB)*nA*(nB+mA);
+    const double rightCost = double(nB)*mA*(nA+mB);
+    return leftCost <= rightCost;
+}
+
+} // namespace kronecker
+
+template<typename T>
+KroneckerOperator<T>::KroneckerOperator
+( const Matrix<T>& A, const Matrix<T>& B )
+{
+    EL_DEBUG_CSE
+    LockedView( A_, A );
+    LockedView( B_, B );
+}
+
+template<typename T>
+Int KroneckerOperator<T>::Height() const
+{ return A_.Height()*B_.Height(); }
+
+template<typename T>
+Int KroneckerOperator<T>::Width() const
+{ return A_.Width()*B_.Width(); }
+
+template<typename T>
+void KroneckerOperator<T>::Apply
+( Orientation orientation,
+  T alpha, const Matrix<T>& X, T beta, Matrix<T>& Y ) const
+{
+    EL_DEBUG_CSE
+    Multiply( orientation, alpha, *this, X, beta, Y );
+}
+
+template<typename T>
+DistKroneckerOperator<T>::DistKroneckerOperator
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+: A_(A.Grid()), B_(A.Grid())
+{
+    EL_DEBUG_CSE
+    if( A.Grid() != B.Grid() )
+        LogicError("A and B must share a grid");
+    Copy( A, A_ );
+    Copy( B, B_ );
+}
+
+template<typename T>
+Int DistKroneckerOperator<T>::Height() const
+{ return A_.Height()*B_.Height(); }
+
+template<typename T>
+Int DistKroneckerOperator<T>::Width() const
+{ return A_.Width()*B_.Width(); }
+
+template<typename T>
+void DistKroneckerOperator<T>::Apply
+( Orientation orientation,
+  T alpha, const DistMultiVec<T>& X,
+  T beta,        DistMultiVec<T>& Y ) const
+{
+    EL_DEBUG_CSE
+    Multiply( orientation, alpha, *this, X, beta, Y );
+}
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const KroneckerOperator<T>& K, const Matrix<T>& X,
+  T beta,                                       Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    const Matrix<T>& A = K.A();
+    const Matrix<T>& B = K.B();
+    const bool normal = ( orientation == NORMAL );
+    const Int mA = ( normal ? A.Height() : A.Width() );
+    const Int nA = ( normal ? A.Width() : A.Height() );
+    const Int mB = ( normal ? B.Height() : B.Width() );
+    const Int nB = ( normal ? B.Width() : B.Height() );
+    const Int numRHS = X.Width();
+    if( X.Height() != nA*nB || Y.Height() != mA*mB || Y.Width() != numRHS )
+        LogicError("K, X, and Y did not conform");
+    if( Y.Height() == 0 || numRHS == 0 )
+        return;
+    if( X.Height() == 0 )
+    {
+        Scale( beta, Y );
+        return;
+    }
+    if( orientation == ADJOINT )
+    {
+        // (A \otimes B)^H X = conj((A^T \otimes B^T) conj(X))
+        Matrix<T> XConj;
+        Conjugate( X, XConj );
+        Conjugate( Y );
+        Multiply( TRANSPOSE, Conj(alpha), K, XConj, Conj(beta), Y );
+        Conjugate( Y );
+        return;
+    }
+
+    // The columns of X (Y) are collectively the vectorization of the
+    // nB x (nA numRHS) (mB x (mA numRHS)) matrix [X_0, X_1, ...], where the
+    // k'th column of X is vec(X_k)
+    Matrix<T> XCont, YCont, Z, YMat;
+    if( X.LDim() == X.Height() )
+        Z.LockedAttach( nB, nA*numRHS, X.LockedBuffer(), nB );
+    else
+    {
+        XCont = X;
+        Z.LockedAttach( nB, nA*numRHS, XCont.LockedBuffer(), nB );
+    }
+    const bool contiguousY = ( Y.LDim() == Y.Height() );
+    if( contiguousY )
+        YMat.Attach( mB, mA*numRHS, Y.Buffer(), mB );
+    else
+    {
+        YCont = Y;
+        YMat.Attach( mB, mA*numRHS, YCont.Buffer(), mB );
+    }
+
+    // op(A)^T is A^T if op(A) = A and A otherwise
+    const Orientation orientA = ( normal ? TRANSPOSE : NORMAL );
+    Matrix<T> W, Zk, Wk, Yk;
+    if( kronecker::LeftFirst( mA, nA, mB, nB ) )
+    {
+        // Form W := op(B) [X_0, X_1, ...] with a single Gemm
+        Gemm( orientation, NORMAL, T(1), B, Z, W );
+        for( Int k=0; k<numRHS; ++k )
+        {
+            LockedView( Wk, W, ALL, IR(k*nA,(k+1)*nA) );
+            View( Yk, YMat, ALL, IR(k*mA,(k+1)*mA) );
+            Gemm( NORMAL, orientA, alpha, Wk, A, beta, Yk );
+        }
+    }
+    else
+    {
+        // Form W := [X_0 op(A)^T, X_1 op(A)^T, ...]
+        W.Resize( nB, mA*numRHS );
+        for( Int k=0; k<numRHS; ++k )
+        {
+            LockedView( Zk, Z, ALL, IR(k*nA,(k+1)*nA) );
+            View( Wk, W, ALL, IR(k*mA,(k+1)*mA) );
+            Gemm( NORMAL, orientA, T(1), Zk, A, T(0), Wk );
+        }
+        Gemm( orientation, NORMAL, alpha, B, W, beta, YMat );
+    }
+    if( !contiguousY )
+        Y = YCont;
+}
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const DistKroneckerOperator<T>& K, const DistMultiVec<T>& X,
+  T beta,                                           DistMultiVec<T>& Y )
+{
+    EL_DEBUG_CSE
+    const DistMatrix<T>& A = K.A();
+    const DistMatrix<T>& B = K.B();
+    const Grid& g = K.Grid();
+    const bool normal = ( orientation == NORMAL );
+    const Int mA = ( normal ? A.Height() : A.Width() );
+    const Int nA = ( normal ? A.Width() : A.Height() );
+    const Int mB = ( normal ? B.Height() : B.Width() );
+    const Int nB = ( normal ? B.Width() : B.Height() );
+    const Int numRHS = X.Width();
+    if( X.Height() != nA*nB || Y.Height() != mA*mB || Y.Width() != numRHS )
+        LogicError("K, X, and Y did not conform");
+    if( X.Grid() != g || Y.Grid() != g )
+        LogicError("K, X, and Y must share a grid");
+    if( Y.Height() == 0 || numRHS == 0 )
+        return;
+    if( X.Height() == 0 )
+    {
+        Scale( beta, Y.Matrix() );
+        return;
+    }
+    if( orientation == ADJOINT )
+    {
+        // (A \otimes B)^H X = conj((A^T \otimes B^T) conj(X))
+        DistMultiVec<T> XConj( g );
+        XConj = X;
+        Conjugate( XConj.Matrix() );
+        Conjugate( Y.Matrix() );
+        Multiply( TRANSPOSE, Conj(alpha), K, XConj, Conj(beta), Y );
+        Conjugate( Y.Matrix() );
+        return;
+    }
+
+    // See the sequential implementation; the reshapings of X and Y are
+    // formed in [MC,MR] distributions so that only distributed Gemms are
+    // performed against A and B
+    DistMatrix<T> Z(g), W(g), R(g);
+    Reshape( nB, nA*numRHS, X, Z );
+    const Orientation orientA = ( normal ? TRANSPOSE : NORMAL );
+    if( kronecker::LeftFirst( mA, nA, mB, nB ) )
+    {
+        Gemm( orientation, NORMAL, T(1), B, Z, W );
+        R.Resize( mB, mA*numRHS );
+        for( Int k=0; k<numRHS; ++k )
+        {
+            auto Wk = W( ALL, IR(k*nA,(k+1)*nA) );
+            auto Rk = R( ALL, IR(k*mA,(k+1)*mA) );
+            Gemm( NORMAL, orientA, T(1), Wk, A, T(0), Rk );
+        }
+    }
+    else
+    {
+        W.Resize( nB, mA*numRHS );
+        for( Int k=0; k<numRHS; ++k )
+        {
+            auto Zk = Z( ALL, IR(k*nA,(k+1)*nA) );
+            auto Wk = W( ALL, IR(k*mA,(k+1)*mA) );
+            Gemm( NORMAL, orientA, T(1), Zk, A, T(0), Wk );
+        }
+        Gemm( orientation, NORMAL, T(1), B, W, R );
+    }
+
+    // Y and its update share the same (one-dimensional) distribution
+    DistMultiVec<T> YUpdate( g );
+    Reshape( mA*mB, numRHS, R, YUpdate );
+    Scale( beta, Y.Matrix() );
+    Axpy( alpha, YUpdate.LockedMatrix(), Y.Matrix() );
+}
+
+#define PROTO(T) \
+  template class KroneckerOperator<T>; \
+  template class DistKroneckerOperator<T>; \
+  template void Multiply \
+  ( Orientation orientation, \
+    T alpha, const KroneckerOperator<T>& K, const Matrix<T>& X, \
+    T beta,                                       Matrix<T>& Y ); \
+  template void Multiply \
+  ( Orientation orientation, \
+    T alpha, const DistKroneckerOperator<T>& K, const DistMultiVec<T>& X, \
+    T beta,                                           DistMultiVec<T>& Y );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 
+#include "./MultiShiftTrsm/ShiftMajor.hpp"
 #include "./MultiShiftTrsm/LUN.hpp"
 #include "./MultiShiftTrsm/LUT.hpp"
 
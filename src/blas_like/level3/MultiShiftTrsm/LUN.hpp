@@ -19,30 +19,7 @@ void LeftUnb
         Matrix<F>& X ) 
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      if( shifts.Height() != X.Width() )
-          LogicError("Incompatible number of shifts");
-    )
-    const char uploChar = ( uplo==LOWER ? 'L' : 'U' );
-    char orientChar; 
-    switch( orientation )
-    {
-    case NORMAL:    orientChar = 'N'; break;
-    case TRANSPOSE: orientChar = 'T'; break;
-    default:        orientChar = 'C';
-    }
-    auto diag = GetDiagonal(T);
-    const Int n = T.Height();
-    const Int ldim = T.LDim();
-    const Int numShifts = shifts.Height();
-    for( Int j=0; j<numShifts; ++j )
-    {
-        ShiftDiagonal( T, -shifts.Get(j,0) );
-        blas::Trsv
-        ( uploChar, orientChar, 'N', n, 
-          T.LockedBuffer(), ldim, X.Buffer(0,j), 1 );
-        SetDiagonal( T, diag );
-    }
+    ShiftMajorSolve( uplo, orientation, T, shifts, X );
 }
 
 template<typename F>
@@ -0,0 +1,89 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_MULTISHIFTTRSM_SHIFTMAJOR_HPP
+#define EL_MULTISHIFTTRSM_SHIFTMAJOR_HPP
+
+namespace El {
+namespace mstrsm {
+
+// The number of right-hand sides transposed at once; a tile of a diagonal
+// block's worth of rows should comfortably fit in the L2 cache
+inline Int ShiftTileSize() { return 128; }
+
+// Solve op(T - shift_j I) x_j = x_j for every column of X.
+//
+// Rather than performing one triangular solve per shift, which streams
+// through T once per right-hand side, each tile of right-hand sides is
+// transposed so that the entries of a given row for all of the shifts in
+// the tile are contiguous. Every step of the substitution is then a
+// unit-stride (vectorized) Hadamard product or Axpy over the shifts, and T
+// is only traversed once per tile.
+template<typename F>
+void ShiftMajorSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<F>& T,
+  const Matrix<F>& shifts,
+        Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( shifts.Height() != X.Width() )
+          LogicError("Incompatible number of shifts");
+      if( T.Height() != T.Width() || T.Height() != X.Height() )
+          LogicError("Nonconformal");
+    )
+    const Int n = T.Height();
+    const Int numShifts = shifts.Height();
+    const Int tileSize = ShiftTileSize();
+    const bool conjugate = ( orientation == ADJOINT );
+    const bool backward = ( (uplo==UPPER) == (orientation==NORMAL) );
+
+    Matrix<F> XTile, recips;
+    for( Int jTile=0; jTile<numShifts; jTile+=tileSize )
+    {
+        const Int nt = Min( tileSize, numShifts-jTile );
+        auto XCols = X( ALL, IR(jTile,jTile+nt) );
+        Transpose( XCols, XTile );
+        F* XTileBuf = XTile.Buffer();
+        const Int ldTile = XTile.LDim();
+
+        recips.Resize( nt, 1 );
+        F* recipBuf = recips.Buffer();
+        for( Int step=0; step<n; ++step )
+        {
+            const Int i = ( backward ? n-1-step : step );
+            const F tau = T(i,i);
+            for( Int t=0; t<nt; ++t )
+            {
+                const F delta = tau - shifts(jTile+t);
+                recipBuf[t] = F(1) / ( conjugate ? Conj(delta) : delta );
+            }
+            F* xi = &XTileBuf[i*ldTile];
+            simd::Hadamard( nt, xi, recipBuf, xi );
+
+            const Int kBeg = ( backward ? 0 : i+1 );
+            const Int kEnd = ( backward ? i : n   );
+            for( Int k=kBeg; k<kEnd; ++k )
+            {
+                F gamma = ( orientation==NORMAL ? T(k,i) : T(i,k) );
+                if( conjugate )
+                    gamma = Conj(gamma);
+                if( gamma != F(0) )
+                    simd::Axpy( nt, -gamma, xi, &XTileBuf[k*ldTile] );
+            }
+        }
+        Transpose( XTile, XCols );
+    }
+}
+
+} // namespace mstrsm
+} // namespace El
+
+#endif // ifndef EL_MULTISHIFTTRSM_SHIFTMAJOR_HPP
@@ -0,0 +1,239 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const SparseMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                  Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    const Int numRHS = X.Width();
+    if( orientation == NORMAL )
+    {
+        if( A.Height() != Y.Height() || A.Width() != X.Height() ||
+            numRHS != Y.Width() )
+            LogicError("A, X, and Y did not conform");
+    }
+    else
+    {
+        if( A.Width() != Y.Height() || A.Height() != X.Height() ||
+            numRHS != Y.Width() )
+            LogicError("A, X, and Y did not conform");
+    }
+    const bool conjugate = ( orientation == ADJOINT );
+
+    Scale( beta, Y );
+    const Int numEntries = A.NumEntries();
+    const Int* sBuf = A.LockedSourceBuffer();
+    const Int* tBuf = A.LockedTargetBuffer();
+    const T* vBuf = A.LockedValueBuffer();
+    const T* XBuf = X.LockedBuffer();
+          T* YBuf = Y.Buffer();
+    const Int XLDim = X.LDim();
+    const Int YLDim = Y.LDim();
+    for( Int e=0; e<numEntries; ++e )
+    {
+        if( orientation == NORMAL )
+        {
+            const T value = alpha*vBuf[e];
+            for( Int k=0; k<numRHS; ++k )
+                YBuf[sBuf[e]+k*YLDim] += value*XBuf[tBuf[e]+k*XLDim];
+        }
+        else
+        {
+            const T value = alpha*(conjugate ? Conj(vBuf[e]) : vBuf[e]);
+            for( Int k=0; k<numRHS; ++k )
+                YBuf[tBuf[e]+k*YLDim] += value*XBuf[sBuf[e]+k*XLDim];
+        }
+    }
+}
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const DistSparseMatrix<T>& A, const DistMultiVec<T>& X,
+  T beta,                                      DistMultiVec<T>& Y )
+{
+    EL_DEBUG_CSE
+    const Int numRHS = X.Width();
+    if( orientation == NORMAL )
+    {
+        if( A.Height() != Y.Height() || A.Width() != X.Height() ||
+            numRHS != Y.Width() )
+            LogicError("A, X, and Y did not conform");
+    }
+    else
+    {
+        if( A.Width() != Y.Height() || A.Height() != X.Height() ||
+            numRHS != Y.Width() )
+            LogicError("A, X, and Y did not conform");
+    }
+    if( A.Grid() != X.Grid() || X.Grid() != Y.Grid() )
+        LogicError("A, X, and Y must share a grid");
+    const bool conjugate = ( orientation == ADJOINT );
+    mpi::Comm comm = A.Grid().Comm();
+
+    // The communication plan only depends upon the sparsity pattern, and so
+    // it is reused by repeated products (e.g., within Krylov solvers)
+    const DistSparseMultMeta& meta = A.InitializeMultMeta();
+    const Int numLocalCols = meta.numLocalCols;
+    const Int numGhostProcs = meta.ghostProcs.size();
+    const Int numHaloProcs = meta.haloProcs.size();
+    const Int numHalo = meta.haloInds.size();
+    const Int* offBuf = A.LockedOffsetBuffer();
+    const Int* colOffs = meta.colOffs.data();
+    const T* vBuf = A.LockedValueBuffer();
+
+    Scale( beta, Y.Matrix() );
+    const T* XBuf = X.LockedMatrix().LockedBuffer();
+          T* YBuf = Y.Matrix().Buffer();
+    const Int XLDim = X.LockedMatrix().LDim();
+    const Int YLDim = Y.Matrix().LDim();
+
+    // The ghost and halo values are stored row-major so that each entry of
+    // the sparse matrix is only loaded once for all of the right-hand sides
+    vector<T> ghostVals( meta.numGhosts*numRHS ), haloVals( numHalo*numRHS );
+    vector<mpi::Request<T>> ghostRequests( numGhostProcs ),
+                            haloRequests( numHaloProcs );
+    vector<T> acc( numRHS );
+    if( orientation == NORMAL )
+    {
+        // Each row of Y is accumulated from the local columns of X and the
+        // ghost rows received from their owners
+        auto rowKernel =
+          [&]( Int iLoc )
+          {
+              for( Int k=0; k<numRHS; ++k )
+                  acc[k] = 0;
+              for( Int e=offBuf[iLoc]; e<offBuf[iLoc+1]; ++e )
+              {
+                  const T value = vBuf[e];
+                  const Int c = colOffs[e];
+                  if( c < numLocalCols )
+                  {
+                      const T* xRow = &XBuf[c];
+                      for( Int k=0; k<numRHS; ++k )
+                          acc[k] += value*xRow[k*XLDim];
+                  }
+                  else
+                  {
+                      const T* gRow = &ghostVals[(c-numLocalCols)*numRHS];
+                      for( Int k=0; k<numRHS; ++k )
+                          acc[k] += value*gRow[k];
+                  }
+              }
+              for( Int k=0; k<numRHS; ++k )
+                  YBuf[iLoc+k*YLDim] += alpha*acc[k];
+          };
+
+        // Start the halo exchange
+        for( Int j=0; j<numGhostProcs; ++j )
+            mpi::IRecv
+            ( &ghostVals[meta.ghostOffs[j]*numRHS],
+              meta.ghostSizes[j]*numRHS, meta.ghostProcs[j], comm,
+              ghostRequests[j] );
+        for( Int s=0; s<numHalo; ++s )
+            for( Int k=0; k<numRHS; ++k )
+                haloVals[s*numRHS+k] = XBuf[meta.haloInds[s]+k*XLDim];
+        for( Int j=0; j<numHaloProcs; ++j )
+            mpi::ISend
+            ( &haloVals[meta.haloOffs[j]*numRHS],
+              meta.haloSizes[j]*numRHS, meta.haloProcs[j], comm,
+              haloRequests[j] );
+
+        // Overlap the exchange with the rows which do not need any ghosts
+        for( const Int iLoc : meta.interiorRows )
+            rowKernel( iLoc );
+        for( auto& request : ghostRequests )
+            mpi::Wait( request );
+        for( const Int iLoc : meta.boundaryRows )
+            rowKernel( iLoc );
+        for( auto& request : haloRequests )
+            mpi::Wait( request );
+    }
+    else
+    {
+        // The contributions to the ghost rows of Y are summed locally and
+        // then sent to their owners, which receive them in the halo buffer
+        auto rowKernel =
+          [&]( Int iLoc, bool ghost )
+          {
+              for( Int k=0; k<numRHS; ++k )
+                  acc[k] = alpha*XBuf[iLoc+k*XLDim];
+              for( Int e=offBuf[iLoc]; e<offBuf[iLoc+1]; ++e )
+              {
+                  const T value = ( conjugate ? Conj(vBuf[e]) : vBuf[e] );
+                  const Int c = colOffs[e];
+                  if( c < numLocalCols && !ghost )
+                  {
+                      T* yRow = &YBuf[c];
+                      for( Int k=0; k<numRHS; ++k )
+                          yRow[k*YLDim] += value*acc[k];
+                  }
+                  else if( c >= numLocalCols && ghost )
+                  {
+                      T* gRow = &ghostVals[(c-numLocalCols)*numRHS];
+                      for( Int k=0; k<numRHS; ++k )
+                          gRow[k] += value*acc[k];
+                  }
+              }
+          };
+
+        for( Int j=0; j<numHaloProcs; ++j )
+            mpi::IRecv
+            ( &haloVals[meta.haloOffs[j]*numRHS],
+              meta.haloSizes[j]*numRHS, meta.haloProcs[j], comm,
+              haloRequests[j] );
+        for( const Int iLoc : meta.boundaryRows )
+            rowKernel( iLoc, true );
+        for( Int j=0; j<numGhostProcs; ++j )
+            mpi::ISend
+            ( &ghostVals[meta.ghostOffs[j]*numRHS],
+              meta.ghostSizes[j]*numRHS, meta.ghostProcs[j], comm,
+              ghostRequests[j] );
+
+        // Overlap the exchange with the local contributions
+        for( const Int iLoc : meta.interiorRows )
+            rowKernel( iLoc, false );
+        for( const Int iLoc : meta.boundaryRows )
+            rowKernel( iLoc, false );
+        for( auto& request : haloRequests )
+            mpi::Wait( request );
+        for( Int s=0; s<numHalo; ++s )
+            for( Int k=0; k<numRHS; ++k )
+                YBuf[meta.haloInds[s]+k*YLDim] += haloVals[s*numRHS+k];
+        for( auto& request : ghostRequests )
+            mpi::Wait( request );
+    }
+}
+
+#define PROTO(T) \
+  template void Multiply \
+  ( Orientation orientation, \
+    T alpha, const SparseMatrix<T>& A, const Matrix<T>& X, \
+    T beta,                                  Matrix<T>& Y ); \
+  template void Multiply \
+  ( Orientation orientation, \
+    T alpha, const DistSparseMatrix<T>& A, const DistMultiVec<T>& X, \
+    T beta,                                      DistMultiVec<T>& Y );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
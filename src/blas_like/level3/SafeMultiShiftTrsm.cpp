@@ -13,6 +13,7 @@
 #include <El/blas_like/level1.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./MultiShiftTrsm/ShiftMajor.hpp"
 #include "./SafeMultiShiftTrsm/Overflow.hpp"
 #include "./SafeMultiShiftTrsm/LUN.hpp"
 
@@ -66,12 +66,12 @@ void LUNBlock
             cNorm(j) = Max( cNorm(j), Abs(U(i,j)) );
     }
 
-    // Iterate through RHS's
+    // Iterate through RHS's, deferring every system whose estimated growth
+    // is modest to a single tiled solve over all such shifts
+    vector<Int> tiledShifts;
     for( Int j=0; j<numShifts; ++j )
     {
-        // Initialize triangular system
-        SetDiagonal( U, diag );
-        ShiftDiagonal( U, -shifts.Get(j,0) );
+        const F shift = shifts(j);
         auto xj = X( ALL, IR(j) );
         Real scales_j = Real(1);
 
@@ -96,7 +96,7 @@ void LUNBlock
         Real invMi = invGi;
         for( Int i=n-1; i>=0; --i )
         {
-            const Real absUii = SafeAbs( U(i,i) );
+            const Real absUii = SafeAbs( diag(i)-shift );
             if( invGi<=smallNum || invMi<=smallNum || absUii<=smallNum )
             {
                 invGi = 0;
@@ -112,12 +112,14 @@ void LUNBlock
 
         if( invGi > smallNum )
         {
-            // Call TRSV since estimated growth is not too large
-            blas::Trsv( 'U', 'N', 'N', n, &U(0,0), U.LDim(), &xj(0), 1 );
+            // The estimated growth is not too large, so no entrywise
+            // scaling is required
+            tiledShifts.push_back( j );
         }
         else
         {
             // Perform backward substitution since estimated growth is large
+            ShiftDiagonal( U, -shift );
             for( Int i=n-1; i>=0; --i )
             {
                 // Perform division and check for overflow
@@ -198,12 +200,28 @@ void LUNBlock
                     blas::Axpy( i, -Xij, &U(0,i), 1, &xj(0), 1 );
                 }
             }
+            SetDiagonal( U, diag );
         }
         scales(j) = scales_j;
     }
 
-    // Reset matrix diagonal
-    SetDiagonal( U, diag );
+    // Solve the well-conditioned systems with the shift-vectorized kernel
+    const Int numTiled = tiledShifts.size();
+    if( numTiled == numShifts )
+    {
+        mstrsm::ShiftMajorSolve( UPPER, NORMAL, U, shifts, X );
+    }
+    else if( numTiled > 0 )
+    {
+        Matrix<F> tiledShiftVals = shifts( tiledShifts, ALL );
+        Matrix<F> XTiled = X( ALL, tiledShifts );
+        mstrsm::ShiftMajorSolve( UPPER, NORMAL, U, tiledShiftVals, XTiled );
+        for( Int k=0; k<numTiled; ++k )
+        {
+            auto xj = X( ALL, IR(tiledShifts[k]) );
+            xj = XTiled( ALL, IR(k) );
+        }
+    }
 }
 
 /*   Note: See "Robust Triangular Solves for Use in Condition
@@ -0,0 +1,271 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+#include <El/matrices.hpp>
+
+namespace El {
+
+namespace structured {
+
+// The circulant embeddings are applied in complex arithmetic, and so the
+// imaginary parts of the products of real operators are discarded
+template<typename Real>
+void FromEmbedding( const Complex<Real>& alpha, Real& beta )
+{ beta = RealPart(alpha); }
+template<typename Real>
+void FromEmbedding( const Complex<Real>& alpha, Complex<Real>& beta )
+{ beta = alpha; }
+
+// Return the smallest power of two which is at least n
+inline Int EmbeddingLength( Int n )
+{
+    Int length = 1;
+    while( length < n )
+        length *= 2;
+    return length;
+}
+
+// The first columns of the circulant embeddings of the m x n Toeplitz matrix
+// A(i,j) = a[i-j+(n-1)] and of its transpose
+template<typename Field>
+void ToeplitzEmbeddings
+( Int m, Int n, const vector<Field>& a,
+  vector<Field>& normalCol, vector<Field>& transCol )
+{
+    EL_DEBUG_CSE
+    if( m == 0 || n == 0 )
+    {
+        normalCol.clear();
+        transCol.clear();
+        return;
+    }
+    if( Int(a.size()) != m+n-1 )
+        LogicError("a was of length ",a.size()," rather than ",m+n-1);
+    const Int length = EmbeddingLength( m+n-1 );
+    normalCol.assign( length, Field(0) );
+    transCol.assign( length, Field(0) );
+    for( Int k=0; k<m; ++k )
+        normalCol[k] = a[k+(n-1)];
+    for( Int k=1; k<n; ++k )
+        normalCol[length-k] = a[(n-1)-k];
+    for( Int k=0; k<n; ++k )
+        transCol[k] = a[(n-1)-k];
+    for( Int k=1; k<m; ++k )
+        transCol[length-k] = a[(n-1)+k];
+}
+
+} // namespace structured
+
+template<typename Field>
+CirculantEmbeddingOperator<Field>::CirculantEmbeddingOperator
+( Int height, Int width, const El::Grid* grid, bool reverseColumns )
+: height_(height), width_(width), grid_(grid),
+  reverseColumns_(reverseColumns)
+{ }
+
+template<typename Field>
+void CirculantEmbeddingOperator<Field>::SetEmbeddings
+( const vector<Field>& normalCol, const vector<Field>& transCol )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int length = normalCol.size();
+    if( Int(transCol.size()) != length )
+        LogicError("The embeddings were of different lengths");
+    auto transform =
+      [&]( const vector<Field>& c, bool conjugate,
+           Matrix<Complex<Real>>& symbol )
+      {
+          symbol.Resize( length, 1 );
+          for( Int k=0; k<length; ++k )
+              symbol(k) = ( conjugate ? Conj(c[k]) : c[k] );
+          ApplyFourier( symbol );
+          symbol *= Sqrt(Real(length));
+      };
+    transform( normalCol, false, normalSymbol_ );
+    transform( transCol, false, transSymbol_ );
+    transform( transCol, true, adjointSymbol_ );
+}
+
+template<typename Field>
+void CirculantEmbeddingOperator<Field>::Apply
+( Orientation orientation,
+  Field alpha, const Matrix<Field>& X,
+  Field beta,        Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const bool normal = ( orientation == NORMAL );
+    const Int inHeight = ( normal ? width_ : height_ );
+    const Int outHeight = ( normal ? height_ : width_ );
+    const Int numRHS = X.Width();
+    if( X.Height() != inHeight || Y.Height() != outHeight ||
+        Y.Width() != numRHS )
+        LogicError
+        ("Nonconformal application of a ",height_," x ",width_,
+         " operator to a ",X.Height()," x ",numRHS," matrix with a ",
+         Y.Height()," x ",Y.Width()," result");
+    const Matrix<Complex<Real>>& symbol =
+      ( normal ? normalSymbol_ :
+        ( orientation == TRANSPOSE ? transSymbol_ : adjointSymbol_ ) );
+    const Int length = symbol.Height();
+
+    // W := C [X; 0], with the rows of X reversed for the NORMAL application
+    // of a column-reversed operator, so that op(A) X is its leading block
+    const bool reverseInput = reverseColumns_ && normal;
+    const bool reverseOutput = reverseColumns_ && !normal;
+    Matrix<Complex<Real>> W;
+    Zeros( W, length, numRHS );
+    for( Int j=0; j<numRHS; ++j )
+        for( Int i=0; i<inHeight; ++i )
+            W( reverseInput ? inHeight-1-i : i, j ) = X(i,j);
+    ApplyFourier( W );
+    DiagonalScale( LEFT, NORMAL, symbol, W );
+    ApplyFourier( W, true );
+
+    Scale( beta, Y );
+    Field update;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        for( Int i=0; i<outHeight; ++i )
+        {
+            structured::FromEmbedding
+            ( W( reverseOutput ? outHeight-1-i : i, j ), update );
+            Y(i,j) += alpha*update;
+        }
+    }
+}
+
+template<typename Field>
+void CirculantEmbeddingOperator<Field>::Apply
+( Orientation orientation,
+  Field alpha, const DistMultiVec<Field>& X,
+  Field beta,        DistMultiVec<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    // Every process redundantly transforms all of X and keeps its own rows
+    const Int outHeight = ( orientation == NORMAL ? height_ : width_ );
+    DistMatrix<Field,STAR,STAR> X_STAR_STAR( X.Grid() );
+    Copy( X, X_STAR_STAR );
+    Matrix<Field> Z;
+    Zeros( Z, outHeight, X.Width() );
+    Apply
+    ( orientation, Field(1), X_STAR_STAR.LockedMatrix(), Field(0), Z );
+
+    const Int firstLocalRow = Y.FirstLocalRow();
+    auto ZLoc =
+      Z( IR(firstLocalRow,firstLocalRow+Y.LocalHeight()), ALL );
+    Scale( beta, Y.Matrix() );
+    Axpy( alpha, ZLoc, Y.Matrix() );
+}
+
+template<typename Field>
+ToeplitzOperator<Field>::ToeplitzOperator
+( Int m, Int n, const vector<Field>& a )
+: CirculantEmbeddingOperator<Field>( m, n, nullptr ), a_(a)
+{
+    EL_DEBUG_CSE
+    Initialize();
+}
+
+template<typename Field>
+ToeplitzOperator<Field>::ToeplitzOperator
+( Int m, Int n, const vector<Field>& a, const El::Grid& grid )
+: CirculantEmbeddingOperator<Field>( m, n, &grid ), a_(a)
+{
+    EL_DEBUG_CSE
+    Initialize();
+}
+
+template<typename Field>
+void ToeplitzOperator<Field>::Initialize()
+{
+    EL_DEBUG_CSE
+    vector<Field> normalCol, transCol;
+    structured::ToeplitzEmbeddings
+    ( this->Height(), this->Width(), a_, normalCol, transCol );
+    this->SetEmbeddings( normalCol, transCol );
+}
+
+template<typename Field>
+CirculantOperator<Field>::CirculantOperator( const vector<Field>& a )
+: CirculantEmbeddingOperator<Field>( a.size(), a.size(), nullptr ), a_(a)
+{
+    EL_DEBUG_CSE
+    Initialize();
+}
+
+template<typename Field>
+CirculantOperator<Field>::CirculantOperator
+( const vector<Field>& a, const El::Grid& grid )
+: CirculantEmbeddingOperator<Field>( a.size(), a.size(), &grid ), a_(a)
+{
+    EL_DEBUG_CSE
+    Initialize();
+}
+
+template<typename Field>
+void CirculantOperator<Field>::Initialize()
+{
+    EL_DEBUG_CSE
+    // A circulant matrix is its own embedding, though its order need not be
+    // a power of two
+    const Int n = a_.size();
+    vector<Field> transCol( n );
+    for( Int k=0; k<n; ++k )
+        transCol[k] = a_[(n-k) % n];
+    this->SetEmbeddings( a_, transCol );
+}
+
+template<typename Field>
+HankelOperator<Field>::HankelOperator
+( Int m, Int n, const vector<Field>& a )
+: CirculantEmbeddingOperator<Field>( m, n, nullptr, true ), a_(a)
+{
+    EL_DEBUG_CSE
+    Initialize();
+}
+
+template<typename Field>
+HankelOperator<Field>::HankelOperator
+( Int m, Int n, const vector<Field>& a, const El::Grid& grid )
+: CirculantEmbeddingOperator<Field>( m, n, &grid, true ), a_(a)
+{
+    EL_DEBUG_CSE
+    Initialize();
+}
+
+template<typename Field>
+void HankelOperator<Field>::Initialize()
+{
+    EL_DEBUG_CSE
+    // A(i,j) = a[i+j] = T(i,n-1-j) for the Toeplitz matrix T with the same
+    // defining vector, i.e., A is T with its columns reversed
+    vector<Field> normalCol, transCol;
+    structured::ToeplitzEmbeddings
+    ( this->Height(), this->Width(), a_, normalCol, transCol );
+    this->SetEmbeddings( normalCol, transCol );
+}
+
+#define PROTO(Field) \
+  template class CirculantEmbeddingOperator<Field>; \
+  template class ToeplitzOperator<Field>; \
+  template class CirculantOperator<Field>; \
+  template class HankelOperator<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
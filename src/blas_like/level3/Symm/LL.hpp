@@ -114,10 +114,8 @@ void LLA
     DistMatrix<T,MC,STAR> B1_MC_STAR(g);
     DistMatrix<T,VR,STAR> B1_VR_STAR(g);
     DistMatrix<T,STAR,MR> B1Trans_STAR_MR(g);
-    DistMatrix<T> Z1(g);
     DistMatrix<T,MC,STAR> Z1_MC_STAR(g);
     DistMatrix<T,MR,STAR> Z1_MR_STAR(g);
-    DistMatrix<T,MR,MC  > Z1_MR_MC(g);
 
     B1_MC_STAR.AlignWith( A );
     B1_VR_STAR.AlignWith( A );
@@ -142,11 +140,7 @@ void LLA
         ( orientation, 
           alpha, A, B1_MC_STAR, B1Trans_STAR_MR, Z1_MC_STAR, Z1_MR_STAR );
 
-        Contract( Z1_MR_STAR, Z1_MR_MC );
-        Z1.AlignWith( C1 );
-        Z1 = Z1_MR_MC;
-        AxpyContract( T(1), Z1_MC_STAR, Z1 );
-        C1 += Z1;
+        symv::FusedColContract( Z1_MC_STAR, Z1_MR_STAR, C1 );
     }
 }
 
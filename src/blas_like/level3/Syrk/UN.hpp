@@ -19,8 +19,9 @@ void UN_C
 {
     EL_DEBUG_CSE
     const Int r = APre.Width();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize =
+      TunedBlocksize<T>( (conjugate ? "Herk" : "Syrk"), r, g );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
     DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
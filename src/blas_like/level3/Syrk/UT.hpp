@@ -19,8 +19,9 @@ void UT_C
 {
     EL_DEBUG_CSE
     const Int r = APre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize =
+      TunedBlocksize<T>( (conjugate ? "Herk" : "Syrk"), r, g );
     const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -0,0 +1,200 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <deque>
+
+namespace El {
+
+template<typename F>
+void TiledHerk
+( UpperOrLower uplo, Orientation orientation,
+  Base<F> alpha, const Matrix<F>& A, Base<F> beta, Matrix<F>& C,
+  const TiledCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = C.Height();
+    EL_DEBUG_ONLY(
+      if( C.Width() != n )
+          LogicError("C must be square");
+      if( (orientation == NORMAL ? A.Height() : A.Width()) != n )
+          LogicError("Nonconformal TiledHerk");
+    )
+    const Int tileSize = ( ctrl.tileSize > 0 ? ctrl.tileSize : Blocksize() );
+    const auto offsets = TileOffsets( n, tileSize );
+    const Int nt = offsets.size()-1;
+
+    // The block of rows (or columns) of A which forms tile row i of C
+    vector<Matrix<F>> ATiles;
+    for( Int i=0; i<nt; ++i )
+    {
+        const IR ind( offsets[i], offsets[i+1] );
+        ATiles.push_back( orientation == NORMAL ? A(ind,ALL) : A(ALL,ind) );
+    }
+    vector<Matrix<F>> CTiles( nt*nt );
+    for( Int j=0; j<nt; ++j )
+        for( Int i=(uplo==LOWER ? j : 0); i<(uplo==LOWER ? nt : j+1); ++i )
+            CTiles[i+j*nt] =
+              C( IR(offsets[i],offsets[i+1]), IR(offsets[j],offsets[j+1]) );
+
+    const Orientation leftOrient = ( orientation==NORMAL ? NORMAL : ADJOINT );
+    const Orientation rightOrient = ( orientation==NORMAL ? ADJOINT : NORMAL );
+    TaskGraph graph;
+    for( Int j=0; j<nt; ++j )
+    {
+        for( Int i=(uplo==LOWER ? j : 0); i<(uplo==LOWER ? nt : j+1); ++i )
+        {
+            auto& CTile = CTiles[i+j*nt];
+            auto task = [&,i,j]()
+              {
+                if( i == j )
+                    Herk( uplo, orientation, alpha, ATiles[i], beta, CTile );
+                else
+                    Gemm
+                    ( leftOrient, rightOrient,
+                      F(alpha), ATiles[i], ATiles[j], F(beta), CTile );
+              };
+            graph.Insert( task, {}, {&CTile} );
+        }
+    }
+    graph.Execute( ctrl.numThreads );
+}
+
+template<typename F>
+void TiledTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const Matrix<F>& A, Matrix<F>& B,
+  const TiledCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = B.Height();
+    const Int n = B.Width();
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Triangular matrix must be square");
+      if( A.Height() != (side==LEFT ? m : n) )
+          LogicError("Nonconformal TiledTrsm");
+    )
+    const Int tileSize = ( ctrl.tileSize > 0 ? ctrl.tileSize : Blocksize() );
+    const auto rowOffsets = TileOffsets( m, tileSize );
+    const auto colOffsets = TileOffsets( n, tileSize );
+    const auto& AOffsets = ( side==LEFT ? rowOffsets : colOffsets );
+    const Int mt = rowOffsets.size()-1;
+    const Int nt = colOffsets.size()-1;
+    const Int At = AOffsets.size()-1;
+
+    vector<Matrix<F>> BTiles( mt*nt );
+    for( Int j=0; j<nt; ++j )
+        for( Int i=0; i<mt; ++i )
+            BTiles[i+j*mt] =
+              B( IR(rowOffsets[i],rowOffsets[i+1]),
+                 IR(colOffsets[j],colOffsets[j+1]) );
+    auto BTile = [&]( Int i, Int j ) -> Matrix<F>& { return BTiles[i+j*mt]; };
+    auto ATile = [&]( Int i, Int j )
+      {
+        return A( IR(AOffsets[i],AOffsets[i+1]),
+                  IR(AOffsets[j],AOffsets[j+1]) );
+      };
+
+    // Whether the solve proceeds from the first tile of A to the last
+    const bool forward =
+      ( side==LEFT ? (uplo==LOWER) == (orientation==NORMAL)
+                   : (uplo==UPPER) == (orientation==NORMAL) );
+
+    // The views of A referenced by the tasks (a deque keeps them in place)
+    std::deque<Matrix<F>> ATiles;
+    TaskGraph graph;
+    for( Int step=0; step<At; ++step )
+    {
+        const Int k = ( forward ? step : At-1-step );
+        // Following PLASMA, alpha is applied by the first solve and update
+        // of each tile of B
+        const F stepAlpha = ( step==0 ? alpha : F(1) );
+        const Int critical = 2*(At-step);
+        const Int next = ( forward ? k+1 : k-1 );
+
+        ATiles.push_back( ATile(k,k) );
+        const Matrix<F>& AKK = ATiles.back();
+        const Int numOther = ( side==LEFT ? nt : mt );
+        for( Int l=0; l<numOther; ++l )
+        {
+            auto& BKL = ( side==LEFT ? BTile(k,l) : BTile(l,k) );
+            graph.Insert
+            ( [&,stepAlpha]()
+              { Trsm( side, uplo, orientation, diag, stepAlpha, AKK, BKL ); },
+              {}, {&BKL}, critical );
+        }
+
+        const Int begin = ( forward ? k+1 : 0 );
+        const Int end = ( forward ? At : k );
+        for( Int i=begin; i<end; ++i )
+        {
+            const Int priority = ( i==next ? critical-1 : 0 );
+            if( side == LEFT )
+            {
+                // B_{i,l} := stepAlpha B_{i,l} - op(A)_{i,k} X_{k,l}
+                ATiles.push_back
+                ( orientation==NORMAL ? ATile(i,k) : ATile(k,i) );
+            }
+            else
+            {
+                // B_{l,i} := stepAlpha B_{l,i} - X_{l,k} op(A)_{k,i}
+                ATiles.push_back
+                ( orientation==NORMAL ? ATile(k,i) : ATile(i,k) );
+            }
+            const Matrix<F>& AOff = ATiles.back();
+            for( Int l=0; l<numOther; ++l )
+            {
+                if( side == LEFT )
+                {
+                    auto& BKL = BTile(k,l);
+                    auto& BIL = BTile(i,l);
+                    graph.Insert
+                    ( [&,stepAlpha]()
+                      { Gemm
+                        ( orientation, NORMAL,
+                          F(-1), AOff, BKL, stepAlpha, BIL ); },
+                      {&BKL}, {&BIL}, priority );
+                }
+                else
+                {
+                    auto& BLK = BTile(l,k);
+                    auto& BLI = BTile(l,i);
+                    graph.Insert
+                    ( [&,stepAlpha]()
+                      { Gemm
+                        ( NORMAL, orientation,
+                          F(-1), BLK, AOff, stepAlpha, BLI ); },
+                      {&BLK}, {&BLI}, priority );
+                }
+            }
+        }
+    }
+    graph.Execute( ctrl.numThreads );
+}
+
+#define PROTO(F) \
+  template void TiledHerk \
+  ( UpperOrLower uplo, Orientation orientation, \
+    Base<F> alpha, const Matrix<F>& A, Base<F> beta, Matrix<F>& C, \
+    const TiledCtrl& ctrl ); \
+  template void TiledTrsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    F alpha, const Matrix<F>& A, Matrix<F>& B, \
+    const TiledCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
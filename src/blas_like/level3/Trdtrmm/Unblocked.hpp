@@ -77,7 +77,8 @@ void LUnblocked( Matrix<F>& L, const Matrix<F>& dSub, bool conjugate=false )
     const Int ldim = L.LDim();
     const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
 
-    Matrix<F> s10, S10, D11(2,2), D11Inv(2,2);
+    Matrix<F> s10, S10;
+    SmallMatrix<F,2,2> D11, D11Inv;
 
     Int k=0;
     while( k < n )
@@ -133,9 +134,9 @@ void LUnblocked( Matrix<F>& L, const Matrix<F>& dSub, bool conjugate=false )
             S10 = L10;
 
             // L10 := inv(D11) L10 
-            D11.Set( 0, 0, L11.Get(0,0) );
-            D11.Set( 1, 1, L11.Get(1,1) );
-            D11.Set( 1, 0, dSub.Get(k,0) );
+            D11(0,0) = L11.Get(0,0);
+            D11(1,1) = L11.Get(1,1);
+            D11(1,0) = dSub.Get(k,0);
 
             D11Inv = D11;
             Symmetric2x2Inv( LOWER, D11Inv, conjugate );
@@ -147,9 +148,9 @@ void LUnblocked( Matrix<F>& L, const Matrix<F>& dSub, bool conjugate=false )
             Trrk( LOWER, orientation, NORMAL, F(1), L10, S10, F(1), L00 );
 
             // L11 := inv(D11)
-            L11.Set( 0, 0, D11Inv.Get(0,0) );
-            L11.Set( 1, 0, D11Inv.Get(1,0) );
-            L11.Set( 1, 1, D11Inv.Get(1,1) );
+            L11.Set( 0, 0, D11Inv(0,0) );
+            L11.Set( 1, 0, D11Inv(1,0) );
+            L11.Set( 1, 1, D11Inv(1,1) );
         }
 
         k += nb;
@@ -10,6 +10,7 @@
 #include <El/blas_like/level1.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./Trrk/Local.hpp"
 #include "./Trr2k/Local.hpp"
 #include "./Trr2k/NNNN.hpp"
 #include "./Trr2k/NNNT.hpp"
@@ -27,14 +27,7 @@ void TrrkInternal
 {
     EL_DEBUG_CSE
     ScaleTrapezoid( beta, uplo, C );
-    if( orientA==NORMAL && orientB==NORMAL )
-        trrk::TrrkNN( uplo, alpha, A, B, C );
-    else if( orientA==NORMAL )
-        trrk::TrrkNT( uplo, orientB, alpha, A, B, C );
-    else if( orientB==NORMAL )
-        trrk::TrrkTN( uplo, orientA, alpha, A, B, C );
-    else
-        trrk::TrrkTT( uplo, orientA, orientB, alpha, A, B, C );
+    trrk::LocalTiled( uplo, orientA, orientB, alpha, A, B, C );
 }
 
 #ifdef HYDROGEN_HAVE_MKL_GEMMT
@@ -115,7 +108,65 @@ void Trrk
         trrk::TrrkTT( uplo, orientA, orientB, alpha, A, B, C );
 }
 
+template<typename T>
+vector<Int> LocalTriangleSizes
+( UpperOrLower uplo, const ElementalMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const int colStride = C.ColStride();
+    const int rowStride = C.RowStride();
+    vector<Int> sizes( colStride*rowStride, 0 );
+    for( int rowRank=0; rowRank<rowStride; ++rowRank )
+    {
+        const Int rowShift = Shift( rowRank, C.RowAlign(), rowStride );
+        for( int colRank=0; colRank<colStride; ++colRank )
+        {
+            const Int colShift = Shift( colRank, C.ColAlign(), colStride );
+            const Int localHeight = Length( m, colShift, colStride );
+            Int size = 0;
+            for( Int j=rowShift; j<n; j+=rowStride )
+            {
+                // The number of local rows i with i >= j (lower) or i <= j
+                // (upper)
+                if( uplo == LOWER )
+                {
+                    const Int iLocBeg =
+                      ( j <= colShift ? 0 :
+                        (j-colShift+colStride-1)/colStride );
+                    size += Max( localHeight-iLocBeg, Int(0) );
+                }
+                else if( j >= colShift )
+                    size += Min( localHeight, (j-colShift)/colStride+1 );
+            }
+            sizes[colRank+colStride*rowRank] = size;
+        }
+    }
+    return sizes;
+}
+
+template<typename T>
+double TriangleImbalance( UpperOrLower uplo, const ElementalMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const auto sizes = LocalTriangleSizes( uplo, C );
+    Int maxSize = 0, totalSize = 0;
+    for( const Int size : sizes )
+    {
+        maxSize = Max( maxSize, size );
+        totalSize += size;
+    }
+    if( totalSize == 0 )
+        return 1;
+    return double(maxSize) / (double(totalSize)/sizes.size());
+}
+
 #define PROTO(T) \
+  template vector<Int> LocalTriangleSizes \
+  ( UpperOrLower uplo, const ElementalMatrix<T>& C ); \
+  template double TriangleImbalance \
+  ( UpperOrLower uplo, const ElementalMatrix<T>& C ); \
   template void Trrk \
   ( UpperOrLower uplo, \
     Orientation orientA, Orientation orientB, \
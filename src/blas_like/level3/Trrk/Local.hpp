@@ -120,559 +120,130 @@ void CheckInputTT
 
 #endif // ifndef EL_RELEASE
 
-// Local C := alpha A B + C
-template<typename T>
-void TrrkNNKernel
-( UpperOrLower uplo, 
-  T alpha, const Matrix<T>& A, const Matrix<T>& B,
-                 Matrix<T>& C )
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInputNN( A, B, C ))
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AT = A(indTL,ALL);
-    auto AB = A(indBR,ALL);
-    auto BL = B(ALL,indTL);
-    auto BR = B(ALL,indBR);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        Gemm( NORMAL, NORMAL, alpha, AB, BL, T(1), CBL );
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        Gemm( NORMAL, NORMAL, alpha, AT, BR, T(1), CTR );
-    }
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DTL;
-    Gemm( NORMAL, NORMAL, alpha, AT, BL, DTL );
-    AxpyTrapezoid( uplo, T(1), DTL, CTL );
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DBR;
-    Gemm( NORMAL, NORMAL, alpha, AB, BR, DBR );
-    AxpyTrapezoid( uplo, T(1), DBR, CBR );
-}
-
-// Distributed C := alpha A B + C
-template<typename T>
-void LocalTrrkKernel
-( UpperOrLower uplo, 
-  T alpha, const DistMatrix<T,MC,  STAR>& A,
-           const DistMatrix<T,STAR,MR  >& B,
-                 DistMatrix<T>& C )
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInput( A, B, C ))
-    const Grid& g = C.Grid();
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AT = A(indTL,ALL);
-    auto AB = A(indBR,ALL);
-    auto BL = B(ALL,indTL);
-    auto BR = B(ALL,indBR);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        LocalGemm( NORMAL, NORMAL, alpha, AB, BL, T(1), CBL );
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        LocalGemm( NORMAL, NORMAL, alpha, AT, BR, T(1), CTR );
-    }
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DTL(g);
-    DTL.AlignWith( CTL );
-    LocalGemm( NORMAL, NORMAL, alpha, AT, BL, DTL );
-    LocalAxpyTrapezoid( uplo, T(1), DTL, CTL );
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DBR(g);
-    DBR.AlignWith( CBR );
-    LocalGemm( NORMAL, NORMAL, alpha, AB, BR, DBR );
-    LocalAxpyTrapezoid( uplo, T(1), DBR, CBR );
-}
-
-// Local C := alpha A B^{T/H} + C
-template<typename T>
-void TrrkNTKernel
-( UpperOrLower uplo,
-  Orientation orientationOfB,
-  T alpha, const Matrix<T>& A, const Matrix<T>& B,
-                 Matrix<T>& C )
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInputNT( orientationOfB, A, B, C ))
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AT = A(indTL,ALL);
-    auto AB = A(indBR,ALL);
-    auto BT = B(indTL,ALL);
-    auto BB = B(indBR,ALL);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        Gemm( NORMAL, orientationOfB, alpha, AB, BT, T(1), CBL );
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        Gemm( NORMAL, orientationOfB, alpha, AT, BB, T(1), CTR );
-    }
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DTL;
-    Gemm( NORMAL, orientationOfB, alpha, AT, BT, DTL );
-    AxpyTrapezoid( uplo, T(1), DTL, CTL );
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DBR;
-    Gemm( NORMAL, orientationOfB, alpha, AB, BB, DBR );
-    AxpyTrapezoid( uplo, T(1), DBR, CBR );
-}
-
-// Distributed C := alpha A B^{T/H} + C
-template<typename T>
-void LocalTrrkKernel
-( UpperOrLower uplo,
-  Orientation orientationOfB,
-  T alpha, const DistMatrix<T,MC,STAR>& A,
-           const DistMatrix<T,MR,STAR>& B,
-                 DistMatrix<T>& C )
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInput( A, B, C ))
-    const Grid& g = C.Grid();
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AT = A(indTL,ALL);
-    auto AB = A(indBR,ALL);
-    auto BT = B(indTL,ALL);
-    auto BB = B(indBR,ALL);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        LocalGemm( NORMAL, orientationOfB, alpha, AB, BT, T(1), CBL );
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        LocalGemm( NORMAL, orientationOfB, alpha, AT, BB, T(1), CTR );
-    }
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DTL(g);
-    DTL.AlignWith( CTL );
-    LocalGemm( NORMAL, orientationOfB, alpha, AT, BT, DTL );
-    LocalAxpyTrapezoid( uplo, T(1), DTL, CTL );
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DBR(g);
-    DBR.AlignWith( CBR );
-    LocalGemm( NORMAL, orientationOfB, alpha, AB, BB, DBR );
-    LocalAxpyTrapezoid( uplo, T(1), DBR, CBR );
-}
-
-// Local C := alpha A^{T/H} B + C
-template<typename T>
-void TrrkTNKernel
-( UpperOrLower uplo,
-  Orientation orientationOfA,
-  T alpha, const Matrix<T>& A, const Matrix<T>& B,
-                 Matrix<T>& C )
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInputTN( orientationOfA, A, B, C ))
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AL = A(ALL,indTL);
-    auto AR = A(ALL,indBR);
-    auto BL = B(ALL,indTL);
-    auto BR = B(ALL,indBR);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        Gemm( orientationOfA, NORMAL, alpha, AR, BL, T(1), CBL );
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        Gemm( orientationOfA, NORMAL, alpha, AL, BR, T(1), CTR );
-    }
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DTL;
-    Gemm( orientationOfA, NORMAL, alpha, AL, BL, DTL );
-    AxpyTrapezoid( uplo, T(1), DTL, CTL );
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DBR;
-    Gemm( orientationOfA, NORMAL, alpha, AR, BR, DBR );
-    AxpyTrapezoid( uplo, T(1), DBR, CBR );
-}
-
-// Distributed C := alpha A^{T/H} B + C
-template<typename T>
-void LocalTrrkKernel
-( UpperOrLower uplo,
-  Orientation orientationOfA,
-  T alpha, const DistMatrix<T,STAR,MC>& A,
-           const DistMatrix<T,STAR,MR>& B,
-                 DistMatrix<T>& C )
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInput( A, B, C ))
-    const Grid& g = C.Grid();
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AL = A(ALL,indTL);
-    auto AR = A(ALL,indBR);
-    auto BL = B(ALL,indTL);
-    auto BR = B(ALL,indBR);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        LocalGemm( orientationOfA, NORMAL, alpha, AR, BL, T(1), CBL );
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        LocalGemm( orientationOfA, NORMAL, alpha, AL, BR, T(1), CTR );
-    }
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DTL(g);
-    DTL.AlignWith( CTL );
-    LocalGemm( orientationOfA, NORMAL, alpha, AL, BL, DTL );
-    LocalAxpyTrapezoid( uplo, T(1), DTL, CTL );
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DBR(g);
-    DBR.AlignWith( CBR );
-    LocalGemm( orientationOfA, NORMAL, alpha, AR, BR, DBR );
-    LocalAxpyTrapezoid( uplo, T(1), DBR, CBR );
-}
-
-// Local C := alpha A^{T/H} B^{T/H} + C
-template<typename T>
-void TrrkTTKernel
-( UpperOrLower uplo,
-  Orientation orientationOfA,
-  Orientation orientationOfB,
-  T alpha, const Matrix<T>& A, const Matrix<T>& B,
-                 Matrix<T>& C )
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInputTT( orientationOfA, orientationOfB, A, B, C ))
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AL = A(ALL,indTL);
-    auto AR = A(ALL,indBR);
-    auto BT = B(indTL,ALL);
-    auto BB = B(indBR,ALL);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        Gemm( orientationOfA, orientationOfB, alpha, AR, BT, T(1), CBL );
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        Gemm( orientationOfA, orientationOfB, alpha, AL, BB, T(1), CTR );
-    }
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DTL;
-    Gemm( orientationOfA, orientationOfB, alpha, AL, BT, DTL );
-    AxpyTrapezoid( uplo, T(1), DTL, CTL );
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DBR;
-    Gemm( orientationOfA, orientationOfB, alpha, AR, BB, DBR );
-    AxpyTrapezoid( uplo, T(1), DBR, CBR );
-}
-
-// Distributed C := alpha A^{T/H} B^{T/H} + C
-template<typename T>
-void LocalTrrkKernel
-( UpperOrLower uplo,
-  Orientation orientationOfA,
-  Orientation orientationOfB,
-  T alpha, const DistMatrix<T,STAR,MC  >& A,
-           const DistMatrix<T,MR,  STAR>& B,
-                 DistMatrix<T>& C )
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInput( A, B, C ))
-    const Grid& g = C.Grid();
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AL = A(ALL,indTL);
-    auto AR = A(ALL,indBR);
-    auto BT = B(indTL,ALL);
-    auto BB = B(indBR,ALL);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        LocalGemm( orientationOfA, orientationOfB, alpha, AR, BT, T(1), CBL );
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        LocalGemm( orientationOfA, orientationOfB, alpha, AL, BB, T(1), CTR );
-    }
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DTL(g);
-    DTL.AlignWith( CTL );
-    LocalGemm( orientationOfA, orientationOfB, alpha, AL, BT, DTL );
-    LocalAxpyTrapezoid( uplo, T(1), DTL, CTL );
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DBR(g);
-    DBR.AlignWith( CBR );
-    LocalGemm( orientationOfA, orientationOfB, alpha, AR, BB, DBR );
-    LocalAxpyTrapezoid( uplo, T(1), DBR, CBR );
-}
-
-// Local C := alpha A B + C
-template<typename T>
-void TrrkNN
-( UpperOrLower uplo,
-  T alpha, const Matrix<T>& A, const Matrix<T>& B,
-                 Matrix<T>& C )
+// Add update(rowInd,colInd,C(rowInd,colInd)) to the trapezoid of the local
+// matrix C, where rowBound(jLoc) is the first row of column jLoc within the
+// lower trapezoid (or one past its last row within the upper trapezoid) and
+// must be nondecreasing in jLoc.
+//
+// C is split into tiles of 'tileWidth' columns, and each tile is updated
+// with a single (tall) Gemm over the rows which intersect the trapezoid.
+// The handful of entries of each tile on the wrong side of the diagonal are
+// saved beforehand and restored afterwards, so that neither temporary
+// diagonal blocks nor small Gemms are required and only O(tileWidth/n) of
+// the flops are wasted. The tiles are independent and are divided among the
+// threads, with long and short tiles paired so that the work is balanced.
+template<typename T,class RowBound,class Update>
+void TiledTrapezoid
+( UpperOrLower uplo, Matrix<T>& C, Int tileWidth, Int innerDim,
+  RowBound rowBound, Update update )
 {
     EL_DEBUG_CSE
-    using namespace trrk;
-    EL_DEBUG_ONLY(CheckInputNN( A, B, C ))
-    if( C.Height() < LocalTrrkBlocksize<T>() )
-    {
-        TrrkNNKernel( uplo, alpha, A, B, C );
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AT = A(indTL,ALL);
-        auto AB = A(indBR,ALL);
-        auto BL = B(ALL,indTL);
-        auto BR = B(ALL,indBR);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if( uplo == LOWER )
+    const Int m = C.Height();
+    const Int n = C.Width();
+    if( m == 0 || n == 0 )
+        return;
+    // Detach a copy-on-write buffer here rather than racing to do so from
+    // every thread's first write below
+    C.Buffer();
+    tileWidth = Max( tileWidth, Int(1) );
+    const Int numTiles = (n+tileWidth-1) / tileWidth;
+
+    EL_PARALLEL_FOR_GRAIN(m*n*Max(innerDim,Int(1)))
+    for( Int t=0; t<numTiles; ++t )
+    {
+        const Int s = ( t % 2 == 0 ? t/2 : numTiles-1-t/2 );
+        const Int jBeg = s*tileWidth;
+        const Int jEnd = Min( jBeg+tileWidth, n );
+        const Int rowBeg = ( uplo == LOWER ? rowBound(jBeg) : 0 );
+        const Int rowEnd = ( uplo == LOWER ? m : rowBound(jEnd-1) );
+        if( rowBeg >= rowEnd )
+            continue;
+
+        // The rows of column jLoc outside of the trapezoid are
+        // [rowBeg,rowBound(jLoc)) (lower) or [rowBound(jLoc),rowEnd) (upper)
+        const Int maxSaved =
+          ( uplo == LOWER ? rowBound(jEnd-1)-rowBeg : rowEnd-rowBound(jBeg) );
+        Matrix<T> saved( maxSaved, jEnd-jBeg );
+        for( Int jLoc=jBeg; jLoc<jEnd; ++jLoc )
         {
-            auto CBL = C(indBR,indTL);
-            Gemm( NORMAL, NORMAL, alpha, AB, BL, T(1), CBL );
+            const Int bound = Min( Max( rowBound(jLoc), rowBeg ), rowEnd );
+            const Int iBeg = ( uplo == LOWER ? rowBeg : bound );
+            const Int iEnd = ( uplo == LOWER ? bound : rowEnd );
+            for( Int iLoc=iBeg; iLoc<iEnd; ++iLoc )
+                saved(iLoc-iBeg,jLoc-jBeg) = C(iLoc,jLoc);
         }
-        else
+
+        const Range<Int> rowInd( rowBeg, rowEnd ), colInd( jBeg, jEnd );
+        auto CBlock = C( rowInd, colInd );
+        update( rowInd, colInd, CBlock );
+
+        for( Int jLoc=jBeg; jLoc<jEnd; ++jLoc )
         {
-            auto CTR = C(indTL,indBR);
-            Gemm( NORMAL, NORMAL, alpha, AT, BR, T(1), CTR );
+            const Int bound = Min( Max( rowBound(jLoc), rowBeg ), rowEnd );
+            const Int iBeg = ( uplo == LOWER ? rowBeg : bound );
+            const Int iEnd = ( uplo == LOWER ? bound : rowEnd );
+            for( Int iLoc=iBeg; iLoc<iEnd; ++iLoc )
+                C(iLoc,jLoc) = saved(iLoc-iBeg,jLoc-jBeg);
         }
-
-        // Recurse
-        TrrkNN( uplo, alpha, AT, BL, CTL );
-        TrrkNN( uplo, alpha, AB, BR, CBR );
     }
 }
 
-// Local C := alpha A B^{T/H} + C
+// The rowBound of TiledTrapezoid for the local matrix of an element-wise
+// distributed matrix
 template<typename T>
-void TrrkNT
-( UpperOrLower uplo,
-  Orientation orientationOfB,
-  T alpha, const Matrix<T>& A, const Matrix<T>& B,
-                 Matrix<T>& C )
+inline auto LocalRowBound( UpperOrLower uplo, const AbstractDistMatrix<T>& C )
+-> std::function<Int(Int)>
 {
-    EL_DEBUG_CSE
-    using namespace trrk;
-    EL_DEBUG_ONLY(CheckInputNT( orientationOfB, A, B, C ))
-    if( C.Height() < LocalTrrkBlocksize<T>() )
-    {
-        TrrkNTKernel( uplo, orientationOfB, alpha, A, B, C );
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AT = A(indTL,ALL);
-        auto AB = A(indBR,ALL);
-        auto BT = B(indTL,ALL);
-        auto BB = B(indBR,ALL);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if( uplo == LOWER )
-        {
-            auto CBL = C(indBR,indTL);
-            Gemm( NORMAL, orientationOfB, alpha, AB, BT, T(1), CBL );
-        }
-        else
-        {
-            auto CTR = C(indTL,indBR);
-            Gemm( NORMAL, orientationOfB, alpha, AT, BB, T(1), CTR );
-        }
-
-        // Recurse
-        TrrkNT( uplo, orientationOfB, alpha, AT, BT, CTL );
-        TrrkNT( uplo, orientationOfB, alpha, AB, BB, CBR );
-    }
+    const Int shift = ( uplo == LOWER ? 0 : 1 );
+    return [&C,shift]( Int jLoc )
+      { return C.LocalRowOffset( C.GlobalCol(jLoc)+shift ); };
 }
 
-// Local C := alpha A^{T/H} B + C
-template<typename T>
-void TrrkTN
+// C := alpha op(A) op(B) + C over the trapezoid of C described by rowBound
+template<typename T,class RowBound>
+void TiledTrrk
 ( UpperOrLower uplo,
-  Orientation orientationOfA,
+  Orientation orientA, Orientation orientB,
   T alpha, const Matrix<T>& A, const Matrix<T>& B,
-                 Matrix<T>& C )
+                 Matrix<T>& C,
+  RowBound rowBound )
 {
     EL_DEBUG_CSE
-    using namespace trrk;
-    EL_DEBUG_ONLY(CheckInputTN( orientationOfA, A, B, C ))
-    if( C.Height() < LocalTrrkBlocksize<T>() )
-    {
-        TrrkTNKernel( uplo, orientationOfA, alpha, A, B, C );
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AL = A(ALL,indTL);
-        auto AR = A(ALL,indBR);
-        auto BL = B(ALL,indTL);
-        auto BR = B(ALL,indBR);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if( uplo == LOWER )
-        {
-            auto CBL = C(indBR,indTL);
-            Gemm( orientationOfA, NORMAL, alpha, AR, BL, T(1), CBL );
-        }
-        else
-        {
-            auto CTR = C(indTL,indBR);
-            Gemm( orientationOfA, NORMAL, alpha, AL, BR, T(1), CTR );
-        }
-
-        // Recurse
-        TrrkTN( uplo, orientationOfA, alpha, AL, BL, CTL );
-        TrrkTN( uplo, orientationOfA, alpha, AR, BR, CBR );
-    }
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    auto update =
+      [&]( const Range<Int>& rowInd, const Range<Int>& colInd,
+           Matrix<T>& CBlock )
+      {
+          auto A1 = ( orientA == NORMAL ? A(rowInd,ALL) : A(ALL,rowInd) );
+          auto B1 = ( orientB == NORMAL ? B(ALL,colInd) : B(colInd,ALL) );
+          Gemm( orientA, orientB, alpha, A1, B1, T(1), CBlock );
+      };
+    TiledTrapezoid
+    ( uplo, C, LocalTrrkBlocksize<T>(), k, rowBound, update );
 }
 
-// Local C := alpha A^{T/H} B^{T/H} + C
+// Local C := alpha op(A) op(B) + C
 template<typename T>
-void TrrkTT
+void LocalTiled
 ( UpperOrLower uplo,
-  Orientation orientationOfA, Orientation orientationOfB,
+  Orientation orientA, Orientation orientB,
   T alpha, const Matrix<T>& A, const Matrix<T>& B,
                  Matrix<T>& C )
 {
     EL_DEBUG_CSE
-    using namespace trrk;
-    EL_DEBUG_ONLY(CheckInputTT( orientationOfA, orientationOfB, A, B, C ))
-    if( C.Height() < LocalTrrkBlocksize<T>() )
-    {
-        TrrkTTKernel( uplo, orientationOfA, orientationOfB, alpha, A, B, C );
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AL = A(ALL,indTL);
-        auto AR = A(ALL,indBR);
-        auto BT = B(indTL,ALL);
-        auto BB = B(indBR,ALL);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if( uplo == LOWER )
-        {
-            auto CBL = C(indBR,indTL);
-            Gemm( orientationOfA, orientationOfB, alpha, AR, BT, T(1), CBL );
-        }
-        else
-        {
-            auto CTR = C(indTL,indBR);
-            Gemm( orientationOfA, orientationOfB, alpha, AL, BB, T(1), CTR );
-        }
-
-        // Recurse
-        TrrkTT( uplo, orientationOfA, orientationOfB, alpha, AL, BT, CTL );
-        TrrkTT( uplo, orientationOfA, orientationOfB, alpha, AR, BB, CBR );
-    }
+    EL_DEBUG_ONLY(
+      if( orientA == NORMAL && orientB == NORMAL )
+          CheckInputNN( A, B, C );
+      else if( orientA == NORMAL )
+          CheckInputNT( orientB, A, B, C );
+      else if( orientB == NORMAL )
+          CheckInputTN( orientA, A, B, C );
+      else
+          CheckInputTT( orientA, orientB, A, B, C );
+    )
+    const Int shift = ( uplo == LOWER ? 0 : 1 );
+    auto rowBound = [shift]( Int j ) { return j+shift; };
+    TiledTrrk( uplo, orientA, orientB, alpha, A, B, C, rowBound );
 }
 
 } // namespace trrk
@@ -688,43 +259,11 @@ void LocalTrrk
     EL_DEBUG_CSE
     using namespace trrk;
     EL_DEBUG_ONLY(CheckInput( A, B, C ))
-    const Grid& g = C.Grid();
     ScaleTrapezoid( beta, uplo, C );
-
-    if( C.Height() < g.Width()*LocalTrrkBlocksize<T>() )
-    {
-        LocalTrrkKernel( uplo, alpha, A, B, C );
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AT = A(indTL,ALL);
-        auto AB = A(indBR,ALL);
-        auto BL = B(ALL,indTL);
-        auto BR = B(ALL,indBR);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if( uplo == LOWER )
-        {
-            auto CBL = C(indBR,indTL);
-            LocalGemm( NORMAL, NORMAL, alpha, AB, BL, T(1), CBL );
-        }
-        else
-        {
-            auto CTR = C(indTL,indBR);
-            LocalGemm( NORMAL, NORMAL, alpha, AT, BR, T(1), CTR );
-        }
-
-        // Recurse
-        LocalTrrk( uplo, alpha, AT, BL, T(1), CTL );
-        LocalTrrk( uplo, alpha, AB, BR, T(1), CBR );
-    }
+    TiledTrrk
+    ( uplo, NORMAL, NORMAL,
+      alpha, A.LockedMatrix(), B.LockedMatrix(), C.Matrix(),
+      LocalRowBound( uplo, C ) );
 }
 
 // Distributed C := alpha A B^{T/H} + beta C
@@ -739,43 +278,11 @@ void LocalTrrk
     EL_DEBUG_CSE
     using namespace trrk;
     EL_DEBUG_ONLY(CheckInput( A, B, C ))
-    const Grid& g = C.Grid();
     ScaleTrapezoid( beta, uplo, C );
-
-    if( C.Height() < g.Width()*LocalTrrkBlocksize<T>() )
-    {
-        LocalTrrkKernel( uplo, orientationOfB, alpha, A, B, C );
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AT = A(indTL,ALL);
-        auto AB = A(indBR,ALL);
-        auto BT = B(indTL,ALL);
-        auto BB = B(indBR,ALL);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if( uplo == LOWER )
-        {
-            auto CBL = C(indBR,indTL);
-            LocalGemm( NORMAL, orientationOfB, alpha, AB, BT, T(1), CBL );
-        }
-        else
-        {
-            auto CTR = C(indTL,indBR);
-            LocalGemm( NORMAL, orientationOfB, alpha, AT, BB, T(1), CTR );
-        }
-
-        // Recurse
-        LocalTrrk( uplo, orientationOfB, alpha, AT, BT, T(1), CTL );
-        LocalTrrk( uplo, orientationOfB, alpha, AB, BB, T(1), CBR );
-    }
+    TiledTrrk
+    ( uplo, NORMAL, orientationOfB,
+      alpha, A.LockedMatrix(), B.LockedMatrix(), C.Matrix(),
+      LocalRowBound( uplo, C ) );
 }
 
 // Distributed C := alpha A^{T/H} B + beta C
@@ -790,43 +297,11 @@ void LocalTrrk
     EL_DEBUG_CSE
     using namespace trrk;
     EL_DEBUG_ONLY(CheckInput( A, B, C ))
-    const Grid& g = C.Grid();
     ScaleTrapezoid( beta, uplo, C );
-
-    if( C.Height() < g.Width()*LocalTrrkBlocksize<T>() )
-    {
-        LocalTrrkKernel( uplo, orientationOfA, alpha, A, B, C );
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AL = A(ALL,indTL);
-        auto AR = A(ALL,indBR);
-        auto BL = B(ALL,indTL);
-        auto BR = B(ALL,indBR);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if( uplo == LOWER )
-        {
-            auto CBL = C(indBR,indTL);
-            LocalGemm( orientationOfA, NORMAL, alpha, AR, BL, T(1), CBL );
-        }
-        else
-        {
-            auto CTR = C(indTL,indBR);
-            LocalGemm( orientationOfA, NORMAL, alpha, AL, BR, T(1), CTR );
-        }
-
-        // Recurse
-        LocalTrrk( uplo, orientationOfA, alpha, AL, BL, T(1), CTL );
-        LocalTrrk( uplo, orientationOfA, alpha, AR, BR, T(1), CBR );
-    }
+    TiledTrrk
+    ( uplo, orientationOfA, NORMAL,
+      alpha, A.LockedMatrix(), B.LockedMatrix(), C.Matrix(),
+      LocalRowBound( uplo, C ) );
 }
 
 // Distributed C := alpha A^{T/H} B^{T/H} + beta C
@@ -841,47 +316,11 @@ void LocalTrrk
     EL_DEBUG_CSE
     using namespace trrk;
     EL_DEBUG_ONLY(CheckInput( A, B, C ))
-    const Grid& g = C.Grid();
     ScaleTrapezoid( beta, uplo, C );
-
-    if( C.Height() < g.Width()*LocalTrrkBlocksize<T>() )
-    {
-        LocalTrrkKernel( uplo, orientationOfA, orientationOfB, alpha, A, B, C );
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AL = A(ALL,indTL);
-        auto AR = A(ALL,indBR);
-        auto BT = B(indTL,ALL);
-        auto BB = B(indBR,ALL);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if( uplo == LOWER )
-        {
-            auto CBL = C(indBR,indTL);
-            LocalGemm
-            ( orientationOfA, orientationOfB, alpha, AR, BT, T(1), CBL );
-        }
-        else
-        {
-            auto CTR = C(indTL,indBR);
-            LocalGemm
-            ( orientationOfA, orientationOfB, alpha, AL, BB, T(1), CTR );
-        }
-
-        // Recurse
-        LocalTrrk
-        ( uplo, orientationOfA, orientationOfB, alpha, AL, BT, T(1), CTL );
-        LocalTrrk
-        ( uplo, orientationOfA, orientationOfB, alpha, AR, BB, T(1), CBR );
-    }
+    TiledTrrk
+    ( uplo, orientationOfA, orientationOfB,
+      alpha, A.LockedMatrix(), B.LockedMatrix(), C.Matrix(),
+      LocalRowBound( uplo, C ) );
 }
 
 } // namespace El
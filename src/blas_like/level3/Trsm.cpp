@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/blas_like/level2.hpp>
 #include <El/blas_like/level3.hpp>
+#include <El/blas_like/level3/BlockCyclic.hpp>
+#include <El/lapack_like/funcs.hpp>
 
 #include "./Trsm/LLN.hpp"
 #include "./Trsm/LLT.hpp"
@@ -19,6 +21,9 @@
 #include "./Trsm/RLT.hpp"
 #include "./Trsm/RUN.hpp"
 #include "./Trsm/RUT.hpp"
+#include "./Trsm/Recursive.hpp"
+#include "./Trsm/Block.hpp"
+#include "./Trsm/Inverse.hpp"
 
 namespace El {
 
@@ -59,6 +64,14 @@ void Trsm
             if( A.Get(j,j) == F(0) )
                 throw SingularMatrixException();
     }
+    const Int cutoff = LocalRecursionCutoff<F>();
+    if( !IsBlasScalar<F>::value &&
+        Max(A.Height(),side==LEFT ? B.Width() : B.Height()) > cutoff )
+    {
+        B *= alpha;
+        trsm::Recursive( side, uplo, orientation, diag, A, B, cutoff );
+        return;
+    }
     blas::Trsm
     ( sideChar, uploChar, transChar, diagChar, B.Height(), B.Width(),
       alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
@@ -77,6 +90,7 @@ void Trsm
   bool checkIfSingular, TrsmAlgorithm alg )
 {
     EL_DEBUG_CSE
+    EL_TRACE_REGION("Trsm");
     EL_DEBUG_ONLY(
       AssertSameGrids( A, B );
       if( A.Height() != A.Width() )
@@ -94,6 +108,24 @@ void Trsm
     )
     B *= alpha;
 
+    // Avoid redistributing block-cyclic operands into [MC,MR]
+    if( side == LEFT && orientation == NORMAL && alg == TRSM_DEFAULT &&
+        trsm::BlockCompatible( A, B ) )
+    {
+        typedef DistMatrix<F,MC,MR,BLOCK> BlockMat;
+        trsm::BlockLeft
+        ( uplo, diag, static_cast<const BlockMat&>(A),
+          static_cast<BlockMat&>(B), checkIfSingular );
+        return;
+    }
+
+    if( alg == TRSM_INVERSE )
+    {
+        trsm::Inverse
+        ( side, uplo, orientation, diag, A, B, checkIfSingular );
+        return;
+    }
+
     // Call the single right-hand side algorithm if appropriate
     if( side == LEFT && B.Width() == 1 )
     {
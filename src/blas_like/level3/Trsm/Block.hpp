@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TRSM_BLOCK_HPP
+#define EL_TRSM_BLOCK_HPP
+
+namespace El {
+namespace trsm {
+
+// Whether a left solve can be performed directly on [MC,MR,BLOCK] matrices:
+// the diagonal blocks of A must each be owned by a single process and the
+// rows of B must be distributed like those of A
+template<typename F>
+bool BlockCompatible
+( const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    using namespace block_cyclic;
+    return IsMCMRBlock(A) && IsMCMRBlock(B) && A.Grid() == B.Grid() &&
+           HasSquareBlocks(A) && SameColDistribution( A, B );
+}
+
+// Left Lower/Upper Normal Trsm on [MC,MR,BLOCK] matrices, where each
+// diagonal block of A is a distribution block: the owning process row of
+// each block row of B solves against the diagonal block of A, broadcasts the
+// solution within process columns, and the remainder of B is updated using
+// the column panel of A broadcast within process rows
+template<typename F>
+void BlockLeft
+( UpperOrLower uplo,
+  UnitOrNonUnit diag,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+        DistMatrix<F,MC,MR,BLOCK>& B,
+  bool checkIfSingular=false )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() || A.Height() != B.Height() )
+          LogicError("Nonconformal Trsm");
+    )
+    const Int m = B.Height();
+    const Int n = B.Width();
+    const Int bsize = A.BlockHeight();
+    const Int cut = A.ColCut();
+    auto& BLoc = B.Matrix();
+
+    // Only the owning process row of each diagonal block takes part in its
+    // solve, so singularity is checked collectively in advance
+    if( checkIfSingular && diag == NON_UNIT )
+    {
+        const auto& ALoc = A.LockedMatrix();
+        int numZeros = 0;
+        for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            if( A.RowOwner(j) == A.ColRank() &&
+                ALoc(A.LocalRowOffset(j),jLoc) == F(0) )
+                ++numZeros;
+        }
+        if( mpi::AllReduce( numZeros, A.DistComm() ) > 0 )
+            throw SingularMatrixException();
+    }
+
+    vector<Int> blockStarts;
+    for( Int k=0; k<m; k=block_cyclic::BlockEnd(k,bsize,cut,m) )
+        blockStarts.push_back( k );
+    const Int numBlocks = blockStarts.size();
+
+    Matrix<F> A1, X1;
+    for( Int t=0; t<numBlocks; ++t )
+    {
+        const Int k =
+          ( uplo == LOWER ? blockStarts[t] : blockStarts[numBlocks-1-t] );
+        const Int kEnd = block_cyclic::BlockEnd( k, bsize, cut, m );
+        const Int nb = kEnd - k;
+        const Int iLoc = A.LocalRowOffset(k);
+        const bool inOwnerRow = ( A.ColRank() == A.RowOwner(k) );
+        if( uplo == LOWER )
+        {
+            // A1[MC,* ] <- A(k:m-1,k:kEnd-1)
+            block_cyclic::BroadcastColPanel( A, k, m, k, kEnd, A1 );
+            if( inOwnerRow )
+            {
+                auto X1Loc = BLoc( IR(iLoc,iLoc+nb), ALL );
+                Trsm
+                ( LEFT, LOWER, NORMAL, diag,
+                  F(1), A1(IR(0,nb),ALL), X1Loc );
+            }
+            block_cyclic::BroadcastRowPanel( B, k, kEnd, 0, n, X1 );
+
+            // B2 -= A21 X1
+            const Int iLocEnd = A.LocalRowOffset(kEnd);
+            auto B2Loc = BLoc( IR(iLocEnd,END), ALL );
+            Gemm
+            ( NORMAL, NORMAL,
+              F(-1), A1(IR(iLocEnd-iLoc,END),ALL), X1, F(1), B2Loc );
+        }
+        else
+        {
+            // A1[MC,* ] <- A(0:kEnd-1,k:kEnd-1)
+            block_cyclic::BroadcastColPanel( A, 0, kEnd, k, kEnd, A1 );
+            if( inOwnerRow )
+            {
+                auto X1Loc = BLoc( IR(iLoc,iLoc+nb), ALL );
+                Trsm
+                ( LEFT, UPPER, NORMAL, diag,
+                  F(1), A1(IR(iLoc,iLoc+nb),ALL), X1Loc );
+            }
+            block_cyclic::BroadcastRowPanel( B, k, kEnd, 0, n, X1 );
+
+            // B0 -= A01 X1
+            auto B0Loc = BLoc( IR(0,iLoc), ALL );
+            Gemm( NORMAL, NORMAL, F(-1), A1(IR(0,iLoc),ALL), X1, F(1), B0Loc );
+        }
+    }
+}
+
+} // namespace trsm
+} // namespace El
+
+#endif // ifndef EL_TRSM_BLOCK_HPP
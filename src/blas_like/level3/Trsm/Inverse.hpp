@@ -0,0 +1,157 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TRSM_INVERSE_HPP
+#define EL_TRSM_INVERSE_HPP
+
+namespace El {
+namespace trsm {
+
+// The size of the diagonal blocks which are inverted by TRSM_INVERSE.
+//
+// The standard algorithms perform several collectives for every Blocksize()
+// rows of A, which dominates their cost when there are few right-hand sides.
+// Larger diagonal blocks lead to proportionally fewer sweeps, at the price of
+// each process redundantly inverting the m/nb blocks, i.e., m nb^2/3 flops.
+// We allow this to be as large as the m^2 n flops of the solve itself (and
+// limit each block to the memory of the local portion of A).
+inline Int InverseBlocksize( Int m, Int n, Int p )
+{
+    const Int bsize = Blocksize();
+    const double flopLimit = Sqrt(3*double(m)*double(n));
+    const double memLimit = m/Sqrt(double(p));
+    const Int nb = Int(Min(flopLimit,memLimit));
+    return Min( m, Max( bsize, nb ) );
+}
+
+// X := inv(op(A)) B or X := B inv(op(A)) by recursively splitting A in half
+// until its diagonal blocks are at most 'cutoff' in size; the off-diagonal
+// blocks only enter through distributed Gemms. Each diagonal block is
+// gathered onto every process and inverted there, so that it is applied with
+// a local Trmm and only a pair of redistributions of the corresponding rows
+// (columns) of B.
+//
+// B is assumed to have already been scaled by alpha.
+template<typename F>
+void InverseRecursive
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  const DistMatrix<F>& A,
+        DistMatrix<F>& B,
+  Int cutoff,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n == 0 )
+        return;
+
+    if( n <= cutoff )
+    {
+        const Grid& g = A.Grid();
+        DistMatrix<F,STAR,STAR> AInv( A );
+        if( checkIfSingular && diag == NON_UNIT )
+        {
+            // Every process holds the diagonal, so all of them throw
+            for( Int j=0; j<n; ++j )
+                if( AInv.GetLocal(j,j) == F(0) )
+                    throw SingularMatrixException();
+        }
+        LocalTriangularInverse( uplo, diag, AInv );
+        if( side == LEFT )
+        {
+            DistMatrix<F,STAR,VR> B_STAR_VR( B );
+            LocalTrmm
+            ( LEFT, uplo, orientation, diag, F(1), AInv, B_STAR_VR );
+            B = B_STAR_VR;
+        }
+        else
+        {
+            DistMatrix<F,VC,STAR> B_VC_STAR(g);
+            B_VC_STAR.AlignWith( B );
+            B_VC_STAR = B;
+            LocalTrmm
+            ( RIGHT, uplo, orientation, diag, F(1), AInv, B_VC_STAR );
+            B = B_VC_STAR;
+        }
+        return;
+    }
+
+    const Range<Int> ind1( 0, n/2 ), ind2( n/2, n );
+    auto A11 = A( ind1, ind1 );
+    auto A22 = A( ind2, ind2 );
+    // See Recursive.hpp for the correspondence between the blocks of A and
+    // those of op(A)
+    const bool lowerOp = ( (uplo == LOWER) == (orientation == NORMAL) );
+    auto AOff = ( uplo == LOWER ? A( ind2, ind1 ) : A( ind1, ind2 ) );
+    auto B1 = ( side == LEFT ? B( ind1, ALL ) : B( ALL, ind1 ) );
+    auto B2 = ( side == LEFT ? B( ind2, ALL ) : B( ALL, ind2 ) );
+
+    if( side == LEFT && lowerOp )
+    {
+        InverseRecursive
+        ( side, uplo, orientation, diag, A11, B1, cutoff, checkIfSingular );
+        Gemm( orientation, NORMAL, F(-1), AOff, B1, F(1), B2 );
+        InverseRecursive
+        ( side, uplo, orientation, diag, A22, B2, cutoff, checkIfSingular );
+    }
+    else if( side == LEFT )
+    {
+        InverseRecursive
+        ( side, uplo, orientation, diag, A22, B2, cutoff, checkIfSingular );
+        Gemm( orientation, NORMAL, F(-1), AOff, B2, F(1), B1 );
+        InverseRecursive
+        ( side, uplo, orientation, diag, A11, B1, cutoff, checkIfSingular );
+    }
+    else if( lowerOp )
+    {
+        InverseRecursive
+        ( side, uplo, orientation, diag, A22, B2, cutoff, checkIfSingular );
+        Gemm( NORMAL, orientation, F(-1), B2, AOff, F(1), B1 );
+        InverseRecursive
+        ( side, uplo, orientation, diag, A11, B1, cutoff, checkIfSingular );
+    }
+    else
+    {
+        InverseRecursive
+        ( side, uplo, orientation, diag, A11, B1, cutoff, checkIfSingular );
+        Gemm( NORMAL, orientation, F(-1), B1, AOff, F(1), B2 );
+        InverseRecursive
+        ( side, uplo, orientation, diag, A22, B2, cutoff, checkIfSingular );
+    }
+}
+
+template<typename F>
+void Inverse
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<F>& BPre,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+
+    const Int m = A.Height();
+    const Int numRHS = ( side == LEFT ? B.Width() : B.Height() );
+    const Int cutoff = InverseBlocksize( m, numRHS, A.Grid().Size() );
+    InverseRecursive
+    ( side, uplo, orientation, diag, A, B, cutoff, checkIfSingular );
+}
+
+} // namespace trsm
+} // namespace El
+
+#endif // ifndef EL_TRSM_INVERSE_HPP
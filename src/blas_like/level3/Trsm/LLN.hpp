@@ -141,6 +141,7 @@ void LLNSmall
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
+    RedistBatch<F> batch;
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -155,8 +156,11 @@ void LLNSmall
         auto X1 = X( ind1, ALL );
         auto X2 = X( ind2, ALL );
 
-        L11_STAR_STAR = L11; // L11[* ,* ] <- L11[VC,* ]
-        X1_STAR_STAR = X1;   // X1[* ,* ] <- X1[VC,* ]
+        // L11[* ,* ] <- L11[VC,* ] and X1[* ,* ] <- X1[VC,* ] within a
+        // single AllGather
+        batch.Queue( L11, L11_STAR_STAR );
+        batch.Queue( X1, X1_STAR_STAR );
+        batch.Execute();
 
         // X1[* ,* ] := (L11[* ,* ])^-1 X1[* ,* ]
         LocalTrsm
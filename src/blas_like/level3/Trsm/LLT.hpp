@@ -221,6 +221,7 @@ void LLTSmall
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
+    RedistBatch<F> batch;
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -236,8 +237,11 @@ void LLTSmall
         auto X0 = X( ind0, ALL );
         auto X1 = X( ind1, ALL );
 
-        L11_STAR_STAR = L11; // L11[* ,* ] <- L11[* ,VR]
-        X1_STAR_STAR = X1;   // X1[* ,* ] <- X1[VR,* ]
+        // L11[* ,* ] <- L11[* ,VR] and X1[* ,* ] <- X1[VR,* ] within a
+        // single AllGather
+        batch.Queue( L11, L11_STAR_STAR );
+        batch.Queue( X1, X1_STAR_STAR );
+        batch.Execute();
 
         // X1[* ,* ] := L11^-[T/H][* ,* ] X1[* ,* ]
         LocalTrsm
@@ -145,6 +145,7 @@ void LUNSmall
     const Grid& g = U.Grid();
 
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g);
+    RedistBatch<F> batch;
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -160,8 +161,11 @@ void LUNSmall
         auto X0 = X( ind0, ALL );
         auto X1 = X( ind1, ALL );
 
-        U11_STAR_STAR = U11; // U11[* ,* ] <- U11[VC,* ]
-        X1_STAR_STAR = X1;   // X1[* ,* ] <- X1[VC,* ]
+        // U11[* ,* ] <- U11[VC,* ] and X1[* ,* ] <- X1[VC,* ] within a
+        // single AllGather
+        batch.Queue( U11, U11_STAR_STAR );
+        batch.Queue( X1, X1_STAR_STAR );
+        batch.Execute();
         
         // X1[* ,* ] := U11^-1[* ,* ] X1[* ,* ]
         LocalTrsm
@@ -166,6 +166,7 @@ void LUTSmall
     const Grid& g = U.Grid();
 
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g); 
+    RedistBatch<F> batch;
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -180,8 +181,11 @@ void LUTSmall
         auto X1 = X( ind1, ALL );
         auto X2 = X( ind2, ALL );
 
-        U11_STAR_STAR = U11; // U11[* ,* ] <- U11[* ,VR]
-        X1_STAR_STAR = X1;   // X1[* ,* ] <- X1[VR,* ]
+        // U11[* ,* ] <- U11[* ,VR] and X1[* ,* ] <- X1[VR,* ] within a
+        // single AllGather
+        batch.Queue( U11, U11_STAR_STAR );
+        batch.Queue( X1, X1_STAR_STAR );
+        batch.Execute();
         
         // X1[* ,* ] := U11^-[T/H][* ,* ] X1[* ,* ]
         LocalTrsm
@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TRSM_RECURSIVE_HPP
+#define EL_TRSM_RECURSIVE_HPP
+
+namespace El {
+namespace trsm {
+
+// Cache-oblivious solve against op(A) for scalar types without BLAS support.
+// The right-hand sides are split until there are at most 'cutoff' of them,
+// and then the triangular matrix is split in half so that all but O(cutoff^2)
+// of the work is performed by (recursive) Gemm updates, e.g., for the
+// forward substitution
+//
+//   | op(A)_11    0     | | X1 | = | B1 |,
+//   | op(A)_21 op(A)_22 | | X2 |   | B2 |
+//
+// X1 := inv(op(A)_11) B1, B2 -= op(A)_21 X1, and X2 := inv(op(A)_22) B2.
+//
+// B is assumed to have already been scaled by alpha.
+template<typename F>
+void Recursive
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  const Matrix<F>& A,
+        Matrix<F>& B,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int numRHS = ( side == LEFT ? B.Width() : B.Height() );
+    if( n == 0 || numRHS == 0 )
+        return;
+
+    if( numRHS > cutoff )
+    {
+        const Range<Int> ind1( 0, numRHS/2 ), ind2( numRHS/2, numRHS );
+        auto B1 = ( side == LEFT ? B( ALL, ind1 ) : B( ind1, ALL ) );
+        auto B2 = ( side == LEFT ? B( ALL, ind2 ) : B( ind2, ALL ) );
+        Recursive( side, uplo, orientation, diag, A, B1, cutoff );
+        Recursive( side, uplo, orientation, diag, A, B2, cutoff );
+        return;
+    }
+    if( n <= cutoff )
+    {
+        const char sideChar = LeftOrRightToChar( side );
+        const char uploChar = UpperOrLowerToChar( uplo );
+        const char transChar = OrientationToChar( orientation );
+        const char diagChar = UnitOrNonUnitToChar( diag );
+        blas::Trsm
+        ( sideChar, uploChar, transChar, diagChar, B.Height(), B.Width(),
+          F(1), A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
+        return;
+    }
+
+    const Range<Int> ind1( 0, n/2 ), ind2( n/2, n );
+    auto A11 = A( ind1, ind1 );
+    auto A22 = A( ind2, ind2 );
+    // The bottom-left block of op(A) (if it is lower triangular) or the
+    // top-right block of op(A) (if it is upper triangular) is
+    // op(A)_offDiag = op(AOff)
+    const bool lowerOp = ( (uplo == LOWER) == (orientation == NORMAL) );
+    auto AOff = ( uplo == LOWER ? A( ind2, ind1 ) : A( ind1, ind2 ) );
+    auto B1 = ( side == LEFT ? B( ind1, ALL ) : B( ALL, ind1 ) );
+    auto B2 = ( side == LEFT ? B( ind2, ALL ) : B( ALL, ind2 ) );
+
+    if( side == LEFT && lowerOp )
+    {
+        Recursive( side, uplo, orientation, diag, A11, B1, cutoff );
+        Gemm( orientation, NORMAL, F(-1), AOff, B1, F(1), B2 );
+        Recursive( side, uplo, orientation, diag, A22, B2, cutoff );
+    }
+    else if( side == LEFT )
+    {
+        Recursive( side, uplo, orientation, diag, A22, B2, cutoff );
+        Gemm( orientation, NORMAL, F(-1), AOff, B2, F(1), B1 );
+        Recursive( side, uplo, orientation, diag, A11, B1, cutoff );
+    }
+    else if( lowerOp )
+    {
+        // X op(A) = B is a backward substitution over the columns of X
+        Recursive( side, uplo, orientation, diag, A22, B2, cutoff );
+        Gemm( NORMAL, orientation, F(-1), B2, AOff, F(1), B1 );
+        Recursive( side, uplo, orientation, diag, A11, B1, cutoff );
+    }
+    else
+    {
+        Recursive( side, uplo, orientation, diag, A11, B1, cutoff );
+        Gemm( NORMAL, orientation, F(-1), B1, AOff, F(1), B2 );
+        Recursive( side, uplo, orientation, diag, A22, B2, cutoff );
+    }
+}
+
+} // namespace trsm
+} // namespace El
+
+#endif // ifndef EL_TRSM_RECURSIVE_HPP
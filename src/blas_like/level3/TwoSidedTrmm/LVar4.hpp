@@ -106,9 +106,11 @@ void LVar4
 
     // Temporary distributions
     DistMatrix<F,STAR,STAR> A11_STAR_STAR(g), L11_STAR_STAR(g);
-    DistMatrix<F,STAR,MC  > A10_STAR_MC(g), L10_STAR_MC(g);
+    DistMatrix<F,STAR,MC  > W10_STAR_MC(g);
     DistMatrix<F,STAR,MR  > A10_STAR_MR(g);
-    DistMatrix<F,STAR,VR  > A10_STAR_VR(g), L10_STAR_VR(g), Y10_STAR_VR(g);
+    DistMatrix<F,STAR,VR  > A10_STAR_VR(g), L10_STAR_VR(g), Y10_STAR_VR(g),
+                            W10_STAR_VR(g);
+    DistMatrix<F,STAR,VC  > W10_STAR_VC(g);
     DistMatrix<F,MC,  STAR> A21_MC_STAR(g);
     DistMatrix<F,MR,  STAR> L10Adj_MR_STAR(g);
     DistMatrix<F,VC,  STAR> A21_VC_STAR(g);
@@ -152,10 +154,20 @@ void LVar4
         // A00 := A00 + (A10' L10 + L10' A10)
         A10_STAR_MR.AlignWith( A00 );
         A10_STAR_MR = A10_STAR_VR;
-        A10_STAR_MC.AlignWith( A00 );
-        A10_STAR_MC = A10_STAR_VR;
-        L10_STAR_MC.AlignWith( A00 );
-        L10_STAR_MC = L10_STAR_VR;
+        // Redistribute A10 and L10 stacked as W10 = [A10; L10] so that each
+        // of the two redistributions to [* ,MC] is only performed once
+        W10_STAR_VR.AlignWith( A00 );
+        W10_STAR_VR.Resize( 2*nb, k );
+        auto WA10_STAR_VR = W10_STAR_VR( IR(0,nb), ALL );
+        auto WL10_STAR_VR = W10_STAR_VR( IR(nb,2*nb), ALL );
+        Copy( A10_STAR_VR.LockedMatrix(), WA10_STAR_VR.Matrix() );
+        Copy( L10_STAR_VR.LockedMatrix(), WL10_STAR_VR.Matrix() );
+        W10_STAR_VC.AlignWith( A00 );
+        W10_STAR_VC = W10_STAR_VR;
+        W10_STAR_MC.AlignWith( A00 );
+        W10_STAR_MC = W10_STAR_VC;
+        auto A10_STAR_MC = W10_STAR_MC( IR(0,nb), ALL );
+        auto L10_STAR_MC = W10_STAR_MC( IR(nb,2*nb), ALL );
         LocalTrr2k
         ( LOWER, ADJOINT, ADJOINT, ADJOINT, NORMAL,
           F(1), A10_STAR_MC, L10Adj_MR_STAR, 
@@ -103,12 +103,13 @@ void UVar4
 
     // Temporary distributions
     DistMatrix<F,STAR,STAR> A11_STAR_STAR(g), U11_STAR_STAR(g);
-    DistMatrix<F,STAR,MC  > A01Adj_STAR_MC(g), U01Adj_STAR_MC(g);
-    DistMatrix<F,STAR,MR  > A01Adj_STAR_MR(g), U01Adj_STAR_MR(g);
+    DistMatrix<F,STAR,MC  > W01Adj_STAR_MC(g);
+    DistMatrix<F,STAR,MR  > W01Adj_STAR_MR(g);
     DistMatrix<F,STAR,VR  > A12_STAR_VR(g);
     DistMatrix<F,MR,  STAR> A12Adj_MR_STAR(g);
-    DistMatrix<F,VC,  STAR> A01_VC_STAR(g), U01_VC_STAR(g), Y01_VC_STAR(g);
-    DistMatrix<F,VR,  STAR> A01_VR_STAR(g), U01_VR_STAR(g);
+    DistMatrix<F,VC,  STAR> A01_VC_STAR(g), U01_VC_STAR(g), Y01_VC_STAR(g),
+                            W01_VC_STAR(g);
+    DistMatrix<F,VR,  STAR> W01_VR_STAR(g);
 
     for( Int k=0; k<n; k+=bsize )
     {
@@ -145,18 +146,25 @@ void UVar4
         Axpy( F(1)/F(2), Y01_VC_STAR, A01_VC_STAR );
 
         // A00 := A00 + (U01 A01' + A01 U01')
-        A01Adj_STAR_MC.AlignWith( A00 );
-        U01Adj_STAR_MC.AlignWith( A00 );
-        Adjoint( A01_VC_STAR, A01Adj_STAR_MC );
-        Adjoint( U01_VC_STAR, U01Adj_STAR_MC );
-        A01_VR_STAR.AlignWith( A00 );
-        A01_VR_STAR = A01_VC_STAR;
-        U01_VR_STAR.AlignWith( A00 );
-        U01_VR_STAR = U01_VC_STAR;
-        A01Adj_STAR_MR.AlignWith( A00 );
-        U01Adj_STAR_MR.AlignWith( A00 );
-        Adjoint( A01_VR_STAR, A01Adj_STAR_MR );
-        Adjoint( U01_VR_STAR, U01Adj_STAR_MR );
+        //
+        // A01 and U01 are redistributed side by side as W01 = [A01, U01] so
+        // that each of the three redistributions is only performed once
+        W01_VC_STAR.AlignWith( A00 );
+        W01_VC_STAR.Resize( k, 2*nb );
+        auto WA01_VC_STAR = W01_VC_STAR( ALL, IR(0,nb) );
+        auto WU01_VC_STAR = W01_VC_STAR( ALL, IR(nb,2*nb) );
+        Copy( A01_VC_STAR.LockedMatrix(), WA01_VC_STAR.Matrix() );
+        Copy( U01_VC_STAR.LockedMatrix(), WU01_VC_STAR.Matrix() );
+        W01Adj_STAR_MC.AlignWith( A00 );
+        Adjoint( W01_VC_STAR, W01Adj_STAR_MC );
+        W01_VR_STAR.AlignWith( A00 );
+        W01_VR_STAR = W01_VC_STAR;
+        W01Adj_STAR_MR.AlignWith( A00 );
+        Adjoint( W01_VR_STAR, W01Adj_STAR_MR );
+        auto A01Adj_STAR_MC = W01Adj_STAR_MC( IR(0,nb), ALL );
+        auto U01Adj_STAR_MC = W01Adj_STAR_MC( IR(nb,2*nb), ALL );
+        auto A01Adj_STAR_MR = W01Adj_STAR_MR( IR(0,nb), ALL );
+        auto U01Adj_STAR_MR = W01Adj_STAR_MR( IR(nb,2*nb), ALL );
         LocalTrr2k
         ( UPPER, ADJOINT, NORMAL, ADJOINT, NORMAL,
           F(1), U01Adj_STAR_MC, A01Adj_STAR_MR, 
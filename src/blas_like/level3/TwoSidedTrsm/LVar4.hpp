@@ -100,13 +100,13 @@ void LVar4
     auto& L = LProx.GetLocked();
 
     // Temporary distributions
-    DistMatrix<F,STAR,MR  > A10_STAR_MR(g), 
-                            A21Adj_STAR_MR(g), L21Adj_STAR_MR(g);
+    DistMatrix<F,STAR,MR  > A10_STAR_MR(g), W21Adj_STAR_MR(g);
     DistMatrix<F,STAR,MC  > A21Trans_STAR_MC(g);
     DistMatrix<F,STAR,VR  > A10_STAR_VR(g);
     DistMatrix<F,STAR,STAR> A11_STAR_STAR(g), L11_STAR_STAR(g);
-    DistMatrix<F,VC,  STAR> A21_VC_STAR(g), L21_VC_STAR(g), Y21_VC_STAR(g);
-    DistMatrix<F,VR,  STAR> A21_VR_STAR(g), L21_VR_STAR(g);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(g), L21_VC_STAR(g), Y21_VC_STAR(g),
+                            W21_VC_STAR(g);
+    DistMatrix<F,VR,  STAR> W21_VR_STAR(g);
     DistMatrix<F,MC,  STAR> L21_MC_STAR(g);
 
     for( Int k=0; k<n; k+=bsize )
@@ -169,14 +169,20 @@ void LVar4
         // A22 := A22 - (L21 A21' + A21 L21')
         A21Trans_STAR_MC.AlignWith( A22 );
         Transpose( A21_VC_STAR, A21Trans_STAR_MC );
-        A21_VR_STAR.AlignWith( A22 );
-        A21_VR_STAR = A21_VC_STAR;
-        L21_VR_STAR.AlignWith( A22 );
-        L21_VR_STAR = L21_VC_STAR;
-        A21Adj_STAR_MR.AlignWith( A22 );
-        L21Adj_STAR_MR.AlignWith( A22 );
-        Adjoint( A21_VR_STAR, A21Adj_STAR_MR );
-        Adjoint( L21_VR_STAR, L21Adj_STAR_MR );
+        // Redistribute A21 and L21 side by side as W21 = [A21, L21] so that
+        // each of the two redistributions is only performed once
+        W21_VC_STAR.AlignWith( A22 );
+        W21_VC_STAR.Resize( A21.Height(), 2*nb );
+        auto WA21_VC_STAR = W21_VC_STAR( ALL, IR(0,nb) );
+        auto WL21_VC_STAR = W21_VC_STAR( ALL, IR(nb,2*nb) );
+        Copy( A21_VC_STAR.LockedMatrix(), WA21_VC_STAR.Matrix() );
+        Copy( L21_VC_STAR.LockedMatrix(), WL21_VC_STAR.Matrix() );
+        W21_VR_STAR.AlignWith( A22 );
+        W21_VR_STAR = W21_VC_STAR;
+        W21Adj_STAR_MR.AlignWith( A22 );
+        Adjoint( W21_VR_STAR, W21Adj_STAR_MR );
+        auto A21Adj_STAR_MR = W21Adj_STAR_MR( IR(0,nb), ALL );
+        auto L21Adj_STAR_MR = W21Adj_STAR_MR( IR(nb,2*nb), ALL );
         LocalTrr2k
         ( LOWER, NORMAL, NORMAL, TRANSPOSE, NORMAL,
           F(-1), L21_MC_STAR,      A21Adj_STAR_MR, 
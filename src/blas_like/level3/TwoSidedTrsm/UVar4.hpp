@@ -101,10 +101,11 @@ void UVar4
 
     // Temporary distributions
     DistMatrix<F,STAR,STAR> A11_STAR_STAR(g), U11_STAR_STAR(g);
-    DistMatrix<F,STAR,MC  > A01Trans_STAR_MC(g), A12_STAR_MC(g), U12_STAR_MC(g);
+    DistMatrix<F,STAR,MC  > A01Trans_STAR_MC(g), W12_STAR_MC(g);
     DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
-    DistMatrix<F,STAR,VC  > A12_STAR_VC(g), U12_STAR_VC(g);
-    DistMatrix<F,STAR,VR  > A12_STAR_VR(g), U12_STAR_VR(g), Y12_STAR_VR(g);
+    DistMatrix<F,STAR,VC  > W12_STAR_VC(g);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(g), U12_STAR_VR(g), Y12_STAR_VR(g),
+                            W12_STAR_VR(g);
     DistMatrix<F,MR,  STAR> U12Trans_MR_STAR(g);
     DistMatrix<F,VC,  STAR> A01_VC_STAR(g);
     DistMatrix<F,VR,  STAR> U12Trans_VR_STAR(g);
@@ -175,14 +176,20 @@ void UVar4
         // A22 := A22 - (A12' U12 + U12' A12)
         A12_STAR_MR.AlignWith( A22 );
         A12_STAR_MR = A12_STAR_VR;
-        A12_STAR_VC.AlignWith( A22 );
-        A12_STAR_VC = A12_STAR_VR;
-        U12_STAR_VC.AlignWith( A22 );
-        U12_STAR_VC = U12_STAR_VR;
-        A12_STAR_MC.AlignWith( A22 );
-        A12_STAR_MC = A12_STAR_VC;
-        U12_STAR_MC.AlignWith( A22 );
-        U12_STAR_MC = U12_STAR_VC;
+        // Redistribute A12 and U12 stacked as W12 = [A12; U12] so that each
+        // of the two redistributions is only performed once
+        W12_STAR_VR.AlignWith( A22 );
+        W12_STAR_VR.Resize( 2*nb, A12.Width() );
+        auto WA12_STAR_VR = W12_STAR_VR( IR(0,nb), ALL );
+        auto WU12_STAR_VR = W12_STAR_VR( IR(nb,2*nb), ALL );
+        Copy( A12_STAR_VR.LockedMatrix(), WA12_STAR_VR.Matrix() );
+        Copy( U12_STAR_VR.LockedMatrix(), WU12_STAR_VR.Matrix() );
+        W12_STAR_VC.AlignWith( A22 );
+        W12_STAR_VC = W12_STAR_VR;
+        W12_STAR_MC.AlignWith( A22 );
+        W12_STAR_MC = W12_STAR_VC;
+        auto A12_STAR_MC = W12_STAR_MC( IR(0,nb), ALL );
+        auto U12_STAR_MC = W12_STAR_MC( IR(nb,2*nb), ALL );
         LocalTrr2k
         ( UPPER, ADJOINT, TRANSPOSE, ADJOINT, NORMAL,
           F(-1), A12_STAR_MC, U12Trans_MR_STAR,
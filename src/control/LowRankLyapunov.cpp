@@ -0,0 +1,425 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The low-rank ADI iteration for A X + X A^H + B B^H = 0 with shifts p_k in
+// the open left-half plane sets W_0 = B and
+//
+//   V_k     = inv(A + p_k I) W_{k-1},
+//   W_k     = W_{k-1} - 2 Re(p_k) V_k,
+//   Z       = [Z, sqrt(-2 Re(p_k)) V_k],
+//
+// so that the residual of X_k = Z Z^H is exactly W_k W_k^H. For real
+// matrices, a complex conjugate pair of shifts is handled with a single
+// complex solve as in Benner, Kuerschner, and Saak's "Efficient handling of
+// complex shift parameters in the low-rank ADI method". The iteration is
+// carried out in the basis in which A = Q H Q^H is upper Hessenberg.
+
+namespace El {
+namespace adi {
+
+template<typename Real>
+void SetShift( Real& alpha, const Complex<Real>& p ) { alpha = -p.real(); }
+template<typename Real>
+void SetShift( Complex<Real>& alpha, const Complex<Real>& p ) { alpha = -p; }
+
+template<typename F>
+void AppendColumns( Matrix<F>& Z, const Matrix<F>& V )
+{
+    EL_DEBUG_CSE
+    const Int width = Z.Width();
+    Matrix<F> ZOld( Z );
+    Z.Resize( V.Height(), width+V.Width() );
+    if( width > 0 )
+    {
+        auto ZL = Z( ALL, IR(0,width) );
+        ZL = ZOld;
+    }
+    auto ZR = Z( ALL, IR(width,END) );
+    ZR = V;
+}
+
+template<typename F>
+void AppendColumns( DistMatrix<F>& Z, const DistMatrix<F>& V )
+{
+    EL_DEBUG_CSE
+    const Int width = Z.Width();
+    DistMatrix<F> ZOld( Z );
+    Z.Resize( V.Height(), width+V.Width() );
+    if( width > 0 )
+    {
+        auto ZL = Z( ALL, IR(0,width) );
+        ZL = ZOld;
+    }
+    auto ZR = Z( ALL, IR(width,END) );
+    ZR = V;
+}
+
+// Reflect the Ritz values into the open left-half plane. Since the iterates
+// of real problems are kept real, only one member of each conjugate pair is
+// kept in that case.
+template<typename F>
+void RitzShifts
+( const Matrix<Complex<Base<F>>>& w, vector<Complex<Base<F>>>& shifts )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    shifts.clear();
+    for( Int i=0; i<w.Height(); ++i )
+    {
+        const Complex<Real> p( -Abs(RealPart(w(i))), ImagPart(w(i)) );
+        if( RealPart(p) == Real(0) )
+            continue;
+        if( !IsComplex<F>::value && ImagPart(p) < Real(0) )
+            continue;
+        shifts.push_back( p );
+    }
+    if( shifts.empty() )
+        RuntimeError("Could not generate ADI shifts from the Ritz values");
+}
+
+// Compute shifts from the Ritz values of H on the span of V
+template<typename F>
+void ProjectionShifts
+( const Matrix<F>& H, const Matrix<F>& V, vector<Complex<Base<F>>>& shifts )
+{
+    EL_DEBUG_CSE
+    Matrix<F> U( V ), HU, HProj;
+    qr::ExplicitUnitary( U );
+    Gemm( NORMAL, NORMAL, F(1), H, U, HU );
+    Gemm( ADJOINT, NORMAL, F(1), U, HU, HProj );
+    Matrix<Complex<Base<F>>> w;
+    Schur( HProj, w );
+    RitzShifts<F>( w, shifts );
+}
+
+// The small projected eigenproblem is solved redundantly
+template<typename F>
+void ProjectionShifts
+( const DistMatrix<F>& H, const DistMatrix<F>& V,
+  vector<Complex<Base<F>>>& shifts )
+{
+    EL_DEBUG_CSE
+    const Grid& g = H.Grid();
+    DistMatrix<F> U( V ), HU(g), HProj(g);
+    qr::ExplicitUnitary( U );
+    Gemm( NORMAL, NORMAL, F(1), H, U, HU );
+    Gemm( ADJOINT, NORMAL, F(1), U, HU, HProj );
+    DistMatrix<F,STAR,STAR> HProj_STAR_STAR( HProj );
+    Matrix<Complex<Base<F>>> w;
+    Schur( HProj_STAR_STAR.Matrix(), w );
+    RitzShifts<F>( w, shifts );
+}
+
+// Perform the ADI step(s) for the shift p, overwriting V with the new
+// columns of Z
+template<typename F>
+void SingleStep
+( const Matrix<F>& H, const Complex<Base<F>>& p,
+  Matrix<F>& W, Matrix<F>& V )
+{
+    EL_DEBUG_CSE
+    F shift;
+    SetShift( shift, p );
+    Matrix<F> shifts;
+    Zeros( shifts, W.Width(), 1 );
+    Fill( shifts, shift );
+    V = W;
+    MultiShiftHessSolve( UPPER, NORMAL, F(1), H, shifts, V );
+    Axpy( -2*RealPart(p), V, W );
+    V *= Sqrt( -2*RealPart(p) );
+}
+
+template<typename F>
+void SingleStep
+( const DistMatrix<F>& H, const Complex<Base<F>>& p,
+  DistMatrix<F>& W, DistMatrix<F>& V )
+{
+    EL_DEBUG_CSE
+    F shift;
+    SetShift( shift, p );
+    DistMatrix<F,VR,STAR> shifts( H.Grid() );
+    Zeros( shifts, W.Width(), 1 );
+    Fill( shifts, shift );
+    V = W;
+    MultiShiftHessSolve( UPPER, NORMAL, F(1), H, shifts, V );
+    Axpy( -2*RealPart(p), V, W );
+    V *= Sqrt( -2*RealPart(p) );
+}
+
+// For real data and a shift p with nonzero imaginary part, the steps for p
+// and its conjugate are combined: with V = inv(H + p I) W, gamma =
+// 2 sqrt(-Re(p)), and delta = Re(p)/Im(p),
+//
+//   W := W + gamma^2 (Re(V) + delta Im(V)),
+//   Z := [Z, gamma (Re(V) + delta Im(V)), gamma sqrt(delta^2+1) Im(V)].
+//
+// The complex copy of H is formed upon first use.
+template<typename Real>
+void PairStep
+( const Matrix<Real>& H, Matrix<Complex<Real>>& HComplex,
+  const Complex<Real>& p, Matrix<Real>& W, Matrix<Real>& V )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Int n = H.Height();
+    const Int k = W.Width();
+    if( HComplex.Height() != n )
+        Copy( H, HComplex );
+    Matrix<C> shifts, VComplex;
+    Zeros( shifts, k, 1 );
+    Fill( shifts, -p );
+    Copy( W, VComplex );
+    MultiShiftHessSolve( UPPER, NORMAL, C(1), HComplex, shifts, VComplex );
+
+    const Real gamma = 2*Sqrt( -RealPart(p) );
+    const Real delta = RealPart(p) / ImagPart(p);
+    Matrix<Real> VReal, VImag;
+    RealPart( VComplex, VReal );
+    ImagPart( VComplex, VImag );
+    Axpy( delta, VImag, VReal );
+    Axpy( gamma*gamma, VReal, W );
+
+    Zeros( V, n, 2*k );
+    auto VFirst = V( ALL, IR(0,k) );
+    auto VSecond = V( ALL, IR(k,2*k) );
+    VFirst = VReal;
+    VFirst *= gamma;
+    VSecond = VImag;
+    VSecond *= gamma*Sqrt( delta*delta+1 );
+}
+
+template<typename Real>
+void PairStep
+( const DistMatrix<Real>& H, DistMatrix<Complex<Real>>& HComplex,
+  const Complex<Real>& p, DistMatrix<Real>& W, DistMatrix<Real>& V )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Grid& g = H.Grid();
+    const Int n = H.Height();
+    const Int k = W.Width();
+    if( HComplex.Height() != n )
+        Copy( H, HComplex );
+    DistMatrix<C,VR,STAR> shifts(g);
+    DistMatrix<C> VComplex(g);
+    Zeros( shifts, k, 1 );
+    Fill( shifts, -p );
+    Copy( W, VComplex );
+    MultiShiftHessSolve( UPPER, NORMAL, C(1), HComplex, shifts, VComplex );
+
+    const Real gamma = 2*Sqrt( -RealPart(p) );
+    const Real delta = RealPart(p) / ImagPart(p);
+    DistMatrix<Real> VReal(g), VImag(g);
+    RealPart( VComplex, VReal );
+    ImagPart( VComplex, VImag );
+    Axpy( delta, VImag, VReal );
+    Axpy( gamma*gamma, VReal, W );
+
+    Zeros( V, n, 2*k );
+    auto VFirst = V( ALL, IR(0,k) );
+    auto VSecond = V( ALL, IR(k,2*k) );
+    VFirst = VReal;
+    VFirst *= gamma;
+    VSecond = VImag;
+    VSecond *= gamma*Sqrt( delta*delta+1 );
+}
+
+template<typename Real>
+void Step
+( const Matrix<Real>& H, Matrix<Complex<Real>>& HComplex,
+  const Complex<Real>& p, Matrix<Real>& W, Matrix<Real>& V )
+{
+    if( ImagPart(p) == Real(0) )
+        SingleStep( H, p, W, V );
+    else
+        PairStep( H, HComplex, p, W, V );
+}
+
+template<typename Real>
+void Step
+( const Matrix<Complex<Real>>& H, Matrix<Complex<Real>>& HComplex,
+  const Complex<Real>& p, Matrix<Complex<Real>>& W,
+  Matrix<Complex<Real>>& V )
+{ SingleStep( H, p, W, V ); }
+
+template<typename Real>
+void Step
+( const DistMatrix<Real>& H, DistMatrix<Complex<Real>>& HComplex,
+  const Complex<Real>& p, DistMatrix<Real>& W, DistMatrix<Real>& V )
+{
+    if( ImagPart(p) == Real(0) )
+        SingleStep( H, p, W, V );
+    else
+        PairStep( H, HComplex, p, W, V );
+}
+
+template<typename Real>
+void Step
+( const DistMatrix<Complex<Real>>& H, DistMatrix<Complex<Real>>& HComplex,
+  const Complex<Real>& p, DistMatrix<Complex<Real>>& W,
+  DistMatrix<Complex<Real>>& V )
+{ SingleStep( H, p, W, V ); }
+
+} // namespace adi
+
+template<typename F>
+void LowRankLyapunov
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& Z,
+  const LowRankLyapunovCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( B.Height() != A.Height() )
+          LogicError("B must conform with A");
+    )
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+
+    // Reduce to A = Q H Q^H and set W := Q^H B
+    Matrix<F> H( A ), householderScalars;
+    Hessenberg( UPPER, H, householderScalars );
+    Matrix<F> W( B );
+    hessenberg::ApplyQ( LEFT, UPPER, ADJOINT, H, householderScalars, W );
+    Matrix<F> HReflectors( H );
+    MakeTrapezoidal( UPPER, H, -1 );
+
+    const Real normB = TwoNorm( B );
+    const Real tol = ctrl.relTol*normB*normB;
+    vector<C> shifts;
+    adi::ProjectionShifts( H, W, shifts );
+
+    Matrix<C> HComplex;
+    Matrix<F> V, ZCycle;
+    Z.Resize( A.Height(), 0 );
+    Int numIts=0;
+    while( true )
+    {
+        for( const C& p : shifts )
+        {
+            adi::Step( H, HComplex, p, W, V );
+            adi::AppendColumns( ZCycle, V );
+        }
+        adi::AppendColumns( Z, ZCycle );
+        ++numIts;
+
+        const Real normW = TwoNorm( W );
+        if( ctrl.progress )
+            Output
+            ("LR-ADI cycle ",numIts,": ",Z.Width()," columns, residual ",
+             normW*normW," (tolerance ",tol,")");
+        if( normW*normW <= tol )
+            break;
+        if( numIts == ctrl.maxIts )
+        {
+            RuntimeError
+            ("Low-rank ADI did not converge within ",ctrl.maxIts," cycles");
+        }
+
+        // Generate the next shifts from the subspace of the last cycle
+        adi::ProjectionShifts( H, ZCycle, shifts );
+        ZCycle.Empty();
+    }
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, NORMAL, HReflectors, householderScalars, Z );
+}
+
+template<typename F>
+void LowRankLyapunov
+( const ElementalMatrix<F>& APre,
+  const ElementalMatrix<F>& B,
+        ElementalMatrix<F>& ZPre,
+  const LowRankLyapunovCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( B.Height() != APre.Height() )
+          LogicError("B must conform with A");
+      AssertSameGrids( APre, B, ZPre );
+    )
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    const Grid& g = APre.Grid();
+
+    DistMatrixWriteProxy<F,F,MC,MR> ZProx( ZPre );
+    auto& Z = ZProx.Get();
+
+    DistMatrix<F> H( APre );
+    DistMatrix<F,STAR,STAR> householderScalars(g);
+    Hessenberg( UPPER, H, householderScalars );
+    DistMatrix<F> W( B );
+    hessenberg::ApplyQ( LEFT, UPPER, ADJOINT, H, householderScalars, W );
+    DistMatrix<F> HReflectors( H );
+    MakeTrapezoidal( UPPER, H, -1 );
+
+    const Real normB = TwoNorm( B );
+    const Real tol = ctrl.relTol*normB*normB;
+    vector<C> shifts;
+    adi::ProjectionShifts( H, W, shifts );
+
+    DistMatrix<C> HComplex(g);
+    DistMatrix<F> V(g), ZCycle(g);
+    Z.Resize( H.Height(), 0 );
+    Int numIts=0;
+    while( true )
+    {
+        for( const C& p : shifts )
+        {
+            adi::Step( H, HComplex, p, W, V );
+            adi::AppendColumns( ZCycle, V );
+        }
+        adi::AppendColumns( Z, ZCycle );
+        ++numIts;
+
+        const Real normW = TwoNorm( W );
+        if( ctrl.progress && g.Rank() == 0 )
+            Output
+            ("LR-ADI cycle ",numIts,": ",Z.Width()," columns, residual ",
+             normW*normW," (tolerance ",tol,")");
+        if( normW*normW <= tol )
+            break;
+        if( numIts == ctrl.maxIts )
+        {
+            RuntimeError
+            ("Low-rank ADI did not converge within ",ctrl.maxIts," cycles");
+        }
+
+        adi::ProjectionShifts( H, ZCycle, shifts );
+        ZCycle.Empty();
+    }
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, NORMAL, HReflectors, householderScalars, Z );
+}
+
+#define PROTO(F) \
+  template void LowRankLyapunov \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& B, \
+          Matrix<F>& Z, \
+    const LowRankLyapunovCtrl<Base<F>>& ctrl ); \
+  template void LowRankLyapunov \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& B, \
+          ElementalMatrix<F>& Z, \
+    const LowRankLyapunovCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
 #include <El/control.hpp>
 
 namespace El {
@@ -33,10 +34,10 @@ void Lyapunov
     Matrix<F> W, WTL, WTR,
                  WBL, WBR;
     W.Resize( 2*m, 2*m );
-    Zero( W );
     PartitionDownDiagonal
     ( W, WTL, WTR,
          WBL, WBR, m );
+    Zero( WBL );
     WTL = A;
     Adjoint( A, WBR ); WBR *= -1;
     WTR = C;           WTR *= -1;
@@ -62,16 +63,109 @@ void Lyapunov
     DistMatrix<F> W(g), WTL(g), WTR(g),
                         WBL(g), WBR(g);
     W.Resize( 2*m, 2*m );
-    Zero( W );
     PartitionDownDiagonal
     ( W, WTL, WTR,
          WBL, WBR, m );
+    Zero( WBL );
     WTL = A;
     Adjoint( A, WBR ); WBR *= -1;
     WTR = C;           WTR *= -1;
     Sylvester( m, W, X, ctrl );
 }
 
+// With the Schur decomposition A = Q T Q^H, the equation A X + X A^H = C
+// becomes T Y + Y T^H = Q^H C Q for Y = Q^H X Q. Since, for the reversal
+// permutation J, J T^H J is upper (quasi-)triangular, a single Schur
+// decomposition suffices to pose the triangular Sylvester equation
+//
+//   T (Y J) + (Y J) (J T^H J) = (Q^H C Q) J.
+
+template<typename F>
+void Lyapunov
+( const Matrix<F>& A, const Matrix<F>& C, Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.alg == SYLVESTER_SIGN )
+    {
+        Lyapunov( A, C, X, ctrl.signCtrl );
+        return;
+    }
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( C.Height() != A.Height() || C.Width() != A.Height() )
+          LogicError("C must conform with A");
+    )
+    auto schurCtrl = ctrl.schurCtrl;
+    schurCtrl.hessSchurCtrl.fullTriangle = true;
+    const Int m = A.Height();
+
+    Matrix<F> T( A ), Q;
+    Matrix<Complex<Base<F>>> w;
+    Schur( T, w, Q, schurCtrl );
+
+    vector<Int> reversal( m );
+    for( Int i=0; i<m; ++i )
+        reversal[i] = m-1-i;
+    Matrix<F> TRev, TRevAdj;
+    GetSubmatrix( T, reversal, reversal, TRev );
+    Adjoint( TRev, TRevAdj );
+
+    Matrix<F> Y, Z;
+    Gemm( ADJOINT, NORMAL, F(1), Q, C, Z );
+    Gemm( NORMAL, NORMAL, F(1), Z, Q, Y );
+    GetSubmatrix( Y, IR(0,m), reversal, Z );
+    TriangularSylvester( T, TRevAdj, Z, ctrl.cutoff );
+    GetSubmatrix( Z, IR(0,m), reversal, Y );
+    Gemm( NORMAL, NORMAL, F(1), Q, Y, Z );
+    Gemm( NORMAL, ADJOINT, F(1), Z, Q, X );
+}
+
+template<typename F>
+void Lyapunov
+( const ElementalMatrix<F>& A, const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X, const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.alg == SYLVESTER_SIGN )
+    {
+        Lyapunov( A, C, X, ctrl.signCtrl );
+        return;
+    }
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( C.Height() != A.Height() || C.Width() != A.Height() )
+          LogicError("C must conform with A");
+      AssertSameGrids( A, C );
+    )
+    auto schurCtrl = ctrl.schurCtrl;
+    schurCtrl.hessSchurCtrl.fullTriangle = true;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+
+    DistMatrix<F> T( A ), Q(g);
+    DistMatrix<Complex<Base<F>>,VR,STAR> w(g);
+    Schur( T, w, Q, schurCtrl );
+
+    vector<Int> reversal( m );
+    for( Int i=0; i<m; ++i )
+        reversal[i] = m-1-i;
+    DistMatrix<F> TRev(g), TRevAdj(g);
+    GetSubmatrix( T, reversal, reversal, TRev );
+    Adjoint( TRev, TRevAdj );
+
+    DistMatrix<F> Y(g), Z(g);
+    Gemm( ADJOINT, NORMAL, F(1), Q, C, Z );
+    Gemm( NORMAL, NORMAL, F(1), Z, Q, Y );
+    GetSubmatrix( Y, IR(0,m), reversal, Z );
+    TriangularSylvester( T, TRevAdj, Z, ctrl.cutoff );
+    GetSubmatrix( Z, IR(0,m), reversal, Y );
+    Gemm( NORMAL, NORMAL, F(1), Q, Y, Z );
+    Gemm( NORMAL, ADJOINT, F(1), Z, Q, X );
+}
+
 #define PROTO(F) \
   template void Lyapunov \
   ( const Matrix<F>& A, \
@@ -82,7 +176,17 @@ void Lyapunov
   ( const ElementalMatrix<F>& A, \
     const ElementalMatrix<F>& C, \
           ElementalMatrix<F>& X, \
-    SignCtrl<Base<F>> ctrl );
+    SignCtrl<Base<F>> ctrl ); \
+  template void Lyapunov \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& C, \
+          Matrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl ); \
+  template void Lyapunov \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& C, \
+          ElementalMatrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
@@ -0,0 +1,212 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+#include <El/lapack_like/factor.hpp>
+#include <El/lapack_like/props.hpp>
+#include <El/control.hpp>
+
+namespace El {
+
+// Each step forms the closed-loop matrix A - K X_k and solves
+//
+//   (X_k K - A^H) X_{k+1} + X_{k+1} (K X_k - A) = L + X_k K X_k,
+//
+// i.e., the Newton-Kleinman equation multiplied by -1, so that the Lyapunov
+// coefficient has its spectrum in the open right-half plane (as required by
+// the sign-based Lyapunov solver). K X_k is reused for the residual, the
+// coefficient, and the right-hand side.
+//
+// See D. L. Kleinman, "On an iterative technique for Riccati equation
+// computations", IEEE Trans. Automatic Control, 1968.
+
+template<typename F>
+Int NewtonRiccati
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+  const Matrix<F>& KPre,
+  const Matrix<F>& LPre,
+        Matrix<F>& X,
+  const NewtonRiccatiCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( KPre.Height() != KPre.Width() )
+          LogicError("K must be square");
+      if( LPre.Height() != LPre.Width() )
+          LogicError("L must be square");
+      if( A.Height() != KPre.Height() || A.Height() != LPre.Height() )
+          LogicError("A, K, and L must be the same size");
+    )
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    if( !ctrl.warmStart || X.Height() != n || X.Width() != n )
+        Riccati( uplo, A, KPre, LPre, X, ctrl.signCtrl );
+
+    Matrix<F> K( KPre ), L( LPre ), AAdj;
+    MakeHermitian( uplo, K );
+    MakeHermitian( uplo, L );
+    Adjoint( A, AAdj );
+    const Real normA = FrobeniusNorm( A );
+    const Real normK = FrobeniusNorm( K );
+    const Real normL = FrobeniusNorm( L );
+
+    Matrix<F> KX, XKX, R, M, XAdj;
+    Int numIts=0;
+    while( true )
+    {
+        // R := X K X - A^H X - X A - L
+        Gemm( NORMAL, NORMAL, F(1), K, X, KX );
+        Gemm( NORMAL, NORMAL, F(1), X, KX, XKX );
+        R = XKX;
+        R -= L;
+        Gemm( NORMAL, NORMAL, F(-1), AAdj, X, F(1), R );
+        Gemm( NORMAL, NORMAL, F(-1), X, A, F(1), R );
+
+        const Real normX = FrobeniusNorm( X );
+        const Real tol =
+          ctrl.relTol*(normL+normX*(2*normA+normK*normX));
+        const Real normR = FrobeniusNorm( R );
+        if( ctrl.progress )
+            Output
+            ("Newton-Kleinman step ",numIts,": || R ||_F = ",normR,
+             " (tolerance ",tol,")");
+        if( normR <= tol )
+            break;
+        if( numIts == ctrl.maxIts )
+        {
+            RuntimeError
+            ("Newton-Kleinman did not converge within ",ctrl.maxIts,
+             " steps");
+        }
+
+        // M := X K - A^H = -(A - K X)^H
+        Adjoint( KX, M );
+        M -= AAdj;
+        XKX += L;
+        Lyapunov( M, XKX, X, ctrl.lyapunovCtrl );
+
+        // Remove the non-Hermitian part introduced by rounding
+        Adjoint( X, XAdj );
+        X += XAdj;
+        X *= Real(1)/Real(2);
+        ++numIts;
+    }
+    return numIts;
+}
+
+template<typename F>
+Int NewtonRiccati
+( UpperOrLower uplo,
+  const ElementalMatrix<F>& APre,
+  const ElementalMatrix<F>& KPre,
+  const ElementalMatrix<F>& LPre,
+        ElementalMatrix<F>& XPre,
+  const NewtonRiccatiCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( KPre.Height() != KPre.Width() )
+          LogicError("K must be square");
+      if( LPre.Height() != LPre.Width() )
+          LogicError("L must be square");
+      if( APre.Height() != KPre.Height() || APre.Height() != LPre.Height() )
+          LogicError("A, K, and L must be the same size");
+      AssertSameGrids( APre, KPre, LPre, XPre );
+    )
+    typedef Base<F> Real;
+    const Grid& g = APre.Grid();
+    const Int n = APre.Height();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& X = XProx.Get();
+    if( !ctrl.warmStart || X.Height() != n || X.Width() != n )
+        Riccati( uplo, APre, KPre, LPre, X, ctrl.signCtrl );
+
+    DistMatrix<F> A( APre ), K( KPre ), L( LPre ), AAdj(g);
+    MakeHermitian( uplo, K );
+    MakeHermitian( uplo, L );
+    Adjoint( A, AAdj );
+    const Real normA = FrobeniusNorm( A );
+    const Real normK = FrobeniusNorm( K );
+    const Real normL = FrobeniusNorm( L );
+
+    DistMatrix<F> KX(g), XKX(g), R(g), M(g), XAdj(g);
+    Int numIts=0;
+    while( true )
+    {
+        // R := X K X - A^H X - X A - L
+        Gemm( NORMAL, NORMAL, F(1), K, X, KX );
+        Gemm( NORMAL, NORMAL, F(1), X, KX, XKX );
+        R = XKX;
+        R -= L;
+        Gemm( NORMAL, NORMAL, F(-1), AAdj, X, F(1), R );
+        Gemm( NORMAL, NORMAL, F(-1), X, A, F(1), R );
+
+        const Real normX = FrobeniusNorm( X );
+        const Real tol =
+          ctrl.relTol*(normL+normX*(2*normA+normK*normX));
+        const Real normR = FrobeniusNorm( R );
+        if( ctrl.progress && g.Rank() == 0 )
+            Output
+            ("Newton-Kleinman step ",numIts,": || R ||_F = ",normR,
+             " (tolerance ",tol,")");
+        if( normR <= tol )
+            break;
+        if( numIts == ctrl.maxIts )
+        {
+            RuntimeError
+            ("Newton-Kleinman did not converge within ",ctrl.maxIts,
+             " steps");
+        }
+
+        // M := X K - A^H = -(A - K X)^H
+        Adjoint( KX, M );
+        M -= AAdj;
+        XKX += L;
+        Lyapunov( M, XKX, X, ctrl.lyapunovCtrl );
+
+        // Remove the non-Hermitian part introduced by rounding
+        Adjoint( X, XAdj );
+        X += XAdj;
+        X *= Real(1)/Real(2);
+        ++numIts;
+    }
+    return numIts;
+}
+
+#define PROTO(F) \
+  template Int NewtonRiccati \
+  ( UpperOrLower uplo, \
+    const Matrix<F>& A, \
+    const Matrix<F>& K, \
+    const Matrix<F>& L, \
+          Matrix<F>& X, \
+    const NewtonRiccatiCtrl<Base<F>>& ctrl ); \
+  template Int NewtonRiccati \
+  ( UpperOrLower uplo, \
+    const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& K, \
+    const ElementalMatrix<F>& L, \
+          ElementalMatrix<F>& X, \
+    const NewtonRiccatiCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -22,13 +22,17 @@ namespace El {
 // is returned, as well as the number of Newton iterations for computing sgn(W).
 //
 // See Chapter 2 of Nicholas J. Higham's "Functions of Matrices"
+//
+// Since W is Hamiltonian, sgn(W) is computed with the structure-preserving
+// Newton iteration of HamiltonianSign, which only requires Hermitian
+// indefinite inversions.
 
 template<typename F>
 void Riccati
 ( Matrix<F>& W, Matrix<F>& X, SignCtrl<Base<F>> ctrl )
 {
     EL_DEBUG_CSE
-    Sign( W, ctrl );
+    HamiltonianSign( W, ctrl );
     const Int n = W.Height()/2;
     Matrix<F> WTL, WTR,
               WBL, WBR;
@@ -58,7 +62,7 @@ void Riccati
     auto& W = WProx.Get();
 
     const Grid& g = W.Grid();
-    Sign( W, ctrl );
+    HamiltonianSign( W, ctrl );
     const Int n = W.Height()/2;
     DistMatrix<F> WTL(g), WTR(g),
                   WBL(g), WBR(g);
@@ -100,7 +104,6 @@ void Riccati
     Matrix<F> W, WTL, WTR,
                  WBL, WBR;
     W.Resize( 2*n, 2*n );
-    Zero( W );
     PartitionDownDiagonal
     ( W, WTL, WTR,
          WBL, WBR, n );
@@ -139,7 +142,6 @@ void Riccati
     DistMatrix<F> W(g), WTL(g), WTR(g),
                         WBL(g), WBR(g);
     W.Resize( 2*n, 2*n );
-    Zero( W );
     PartitionDownDiagonal
     ( W, WTL, WTR,
          WBL, WBR, n );
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
 #include <El/lapack_like/funcs.hpp>
 #include <El/control.hpp>
 
@@ -111,10 +112,10 @@ void Sylvester
     Matrix<F> W, WTL, WTR,
                  WBL, WBR;
     W.Resize( m+n, m+n );
-    Zero( W );
     PartitionDownDiagonal
     ( W, WTL, WTR,
          WBL, WBR, m );
+    Zero( WBL );
     WTL = A;
     WBR = B; WBR *= -1;
     WTR = C; WTR *= -1;
@@ -145,16 +146,101 @@ void Sylvester
     DistMatrix<F> W(g), WTL(g), WTR(g),
                         WBL(g), WBR(g);
     W.Resize( m+n, m+n );
-    Zero( W );
     PartitionDownDiagonal
     ( W, WTL, WTR,
          WBL, WBR, m );
+    Zero( WBL );
     WTL = A;
     WBR = B; WBR *= -1;
     WTR = C; WTR *= -1;
     Sylvester( m, W, X, ctrl );
 }
 
+// Bartels-Stewart: with the Schur decompositions A = QA TA QA^H and
+// B = QB TB QB^H, the equation A X + X B = C becomes
+//
+//   TA (QA^H X QB) + (QA^H X QB) TB = QA^H C QB,
+//
+// which is solved by TriangularSylvester. Unlike the sign-based approach, the
+// spectra of A and B need only satisfy that A and -B have no common
+// eigenvalue, and no 2n x 2n matrices are formed.
+
+template<typename F>
+void Sylvester
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.alg == SYLVESTER_SIGN )
+    {
+        Sylvester( A, B, C, X, ctrl.signCtrl );
+        return;
+    }
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( B.Height() != B.Width() )
+          LogicError("B must be square");
+      if( C.Height() != A.Height() || C.Width() != B.Height() )
+          LogicError("C must conform with A and B");
+    )
+    auto schurCtrl = ctrl.schurCtrl;
+    schurCtrl.hessSchurCtrl.fullTriangle = true;
+
+    Matrix<F> TA( A ), TB( B ), QA, QB, Z;
+    Matrix<Complex<Base<F>>> w;
+    Schur( TA, w, QA, schurCtrl );
+    Schur( TB, w, QB, schurCtrl );
+
+    Gemm( ADJOINT, NORMAL, F(1), QA, C, Z );
+    Gemm( NORMAL, NORMAL, F(1), Z, QB, X );
+    TriangularSylvester( TA, TB, X, ctrl.cutoff );
+    Gemm( NORMAL, NORMAL, F(1), QA, X, Z );
+    Gemm( NORMAL, ADJOINT, F(1), Z, QB, X );
+}
+
+template<typename F>
+void Sylvester
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.alg == SYLVESTER_SIGN )
+    {
+        Sylvester( A, B, C, X, ctrl.signCtrl );
+        return;
+    }
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( B.Height() != B.Width() )
+          LogicError("B must be square");
+      if( C.Height() != A.Height() || C.Width() != B.Height() )
+          LogicError("C must conform with A and B");
+      AssertSameGrids( A, B, C );
+    )
+    auto schurCtrl = ctrl.schurCtrl;
+    schurCtrl.hessSchurCtrl.fullTriangle = true;
+
+    const Grid& g = A.Grid();
+    DistMatrix<F> TA( A ), TB( B ), QA(g), QB(g), Y(g), Z(g);
+    DistMatrix<Complex<Base<F>>,VR,STAR> w(g);
+    Schur( TA, w, QA, schurCtrl );
+    Schur( TB, w, QB, schurCtrl );
+
+    Gemm( ADJOINT, NORMAL, F(1), QA, C, Z );
+    Gemm( NORMAL, NORMAL, F(1), Z, QB, Y );
+    TriangularSylvester( TA, TB, Y, ctrl.cutoff );
+    Gemm( NORMAL, NORMAL, F(1), QA, Y, Z );
+    Gemm( NORMAL, ADJOINT, F(1), Z, QB, X );
+}
+
 #define PROTO(F) \
   template void Sylvester \
   ( Int m, \
@@ -177,7 +263,19 @@ void Sylvester
     const ElementalMatrix<F>& B, \
     const ElementalMatrix<F>& C, \
           ElementalMatrix<F>& X, \
-    SignCtrl<Base<F>> ctrl );
+    SignCtrl<Base<F>> ctrl ); \
+  template void Sylvester \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& B, \
+    const Matrix<F>& C, \
+          Matrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl ); \
+  template void Sylvester \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& B, \
+    const ElementalMatrix<F>& C, \
+          ElementalMatrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
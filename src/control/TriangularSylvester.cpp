@@ -0,0 +1,292 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The triangular Sylvester equation A X + X B = C is solved by recursively
+// splitting the larger of A and B in half (without splitting any 2x2 diagonal
+// blocks) so that nearly all of the work is performed in Gemm updates, as in
+// Jonsson and Kagstrom's "Recursive blocked algorithms for solving triangular
+// systems--Part I: one-sided and coupled Sylvester-type matrix equations".
+// Once both dimensions are at most the cutoff, the small equation is solved
+// with the classical Bartels-Stewart substitution.
+
+namespace El {
+namespace sylvester {
+
+// Choose a split point near the middle of the upper quasi-triangular matrix T
+// which does not cut through a 2x2 diagonal block
+template<typename F>
+Int Split( const Matrix<F>& T )
+{
+    EL_DEBUG_CSE
+    Int n1 = T.Height() / 2;
+    if( !IsComplex<F>::value && n1 > 0 && T(n1,n1-1) != F(0) )
+        ++n1;
+    return n1;
+}
+
+template<typename F>
+Int Split( const DistMatrix<F>& T )
+{
+    EL_DEBUG_CSE
+    Int n1 = T.Height() / 2;
+    if( !IsComplex<F>::value && n1 > 0 && T.Get(n1,n1-1) != F(0) )
+        ++n1;
+    return n1;
+}
+
+// Return the offsets of the 1x1 and 2x2 diagonal blocks of T followed by
+// its height
+template<typename F>
+vector<Int> DiagonalBlocks( const Matrix<F>& T )
+{
+    EL_DEBUG_CSE
+    const Int n = T.Height();
+    vector<Int> offsets;
+    Int i = 0;
+    while( i < n )
+    {
+        offsets.push_back( i );
+        if( !IsComplex<F>::value && i+1 < n && T(i+1,i) != F(0) )
+            i += 2;
+        else
+            i += 1;
+    }
+    offsets.push_back( n );
+    return offsets;
+}
+
+// Overwrite the nA x nB block C with the solution of A X + X B = C, where A
+// and B are at most 2x2, via the Kronecker form
+//   (I kron A + B^T kron I) vec(X) = vec(C)
+template<typename F>
+void SmallSolve( const Matrix<F>& A, const Matrix<F>& B, Matrix<F>& C )
+{
+    EL_DEBUG_CSE
+    const Int nA = A.Height();
+    const Int nB = B.Height();
+    if( nA == 1 && nB == 1 )
+    {
+        const F denom = A(0,0) + B(0,0);
+        if( denom == F(0) )
+            RuntimeError("A and -B have a common eigenvalue");
+        C(0,0) /= denom;
+        return;
+    }
+
+    const Int nK = nA*nB;
+    Matrix<F> K, c;
+    Zeros( K, nK, nK );
+    Zeros( c, nK, 1 );
+    for( Int j=0; j<nB; ++j )
+    {
+        for( Int i=0; i<nA; ++i )
+        {
+            const Int row = i + j*nA;
+            c(row) = C(i,j);
+            for( Int k=0; k<nA; ++k )
+                K(row,k+j*nA) += A(i,k);
+            for( Int k=0; k<nB; ++k )
+                K(row,i+k*nA) += B(k,j);
+        }
+    }
+    LinearSolve( K, c );
+    for( Int j=0; j<nB; ++j )
+        for( Int i=0; i<nA; ++i )
+            C(i,j) = c(i+j*nA);
+}
+
+// Bartels-Stewart: sweep forward over the diagonal blocks of B and, within
+// each block column, backward over the diagonal blocks of A
+template<typename F>
+void BartelsStewart( const Matrix<F>& A, const Matrix<F>& B, Matrix<F>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const vector<Int> rowOffsets = DiagonalBlocks( A );
+    const vector<Int> colOffsets = DiagonalBlocks( B );
+    const Int numRowBlocks = rowOffsets.size()-1;
+    const Int numColBlocks = colOffsets.size()-1;
+    for( Int l=0; l<numColBlocks; ++l )
+    {
+        const Range<Int> indl( colOffsets[l], colOffsets[l+1] );
+        const Range<Int> ind0( 0, colOffsets[l] );
+        auto Cl = C( ALL, indl );
+        if( colOffsets[l] > 0 )
+            Gemm
+            ( NORMAL, NORMAL, F(-1), C(ALL,ind0), B(ind0,indl), F(1), Cl );
+
+        for( Int k=numRowBlocks-1; k>=0; --k )
+        {
+            const Int iBeg = rowOffsets[k];
+            const Int iEnd = rowOffsets[k+1];
+            auto Ckl = Cl( IR(iBeg,iEnd), ALL );
+            for( Int j=0; j<Ckl.Width(); ++j )
+                for( Int i=iBeg; i<iEnd; ++i )
+                {
+                    F update = 0;
+                    for( Int t=iEnd; t<m; ++t )
+                        update += A(i,t)*Cl(t,j);
+                    Ckl(i-iBeg,j) -= update;
+                }
+            SmallSolve
+            ( A(IR(iBeg,iEnd),IR(iBeg,iEnd)), B(indl,indl), Ckl );
+        }
+    }
+}
+
+template<typename F>
+void Recursive
+( const Matrix<F>& A, const Matrix<F>& B, Matrix<F>& C, Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = B.Height();
+    if( m <= cutoff && n <= cutoff )
+    {
+        BartelsStewart( A, B, C );
+        return;
+    }
+
+    if( m >= n )
+    {
+        // | A11 A12 | | X1 | + | X1 | B = | C1 |
+        // |   0 A22 | | X2 |   | X2 |     | C2 |
+        const Int m1 = Split( A );
+        const Range<Int> ind1( 0, m1 ), ind2( m1, m );
+        auto C1 = C( ind1, ALL );
+        auto C2 = C( ind2, ALL );
+        Recursive( A(ind2,ind2), B, C2, cutoff );
+        Gemm( NORMAL, NORMAL, F(-1), A(ind1,ind2), C2, F(1), C1 );
+        Recursive( A(ind1,ind1), B, C1, cutoff );
+    }
+    else
+    {
+        // A | X1 X2 | + | X1 X2 | | B11 B12 | = | C1 C2 |
+        //                         |   0 B22 |
+        const Int n1 = Split( B );
+        const Range<Int> ind1( 0, n1 ), ind2( n1, n );
+        auto C1 = C( ALL, ind1 );
+        auto C2 = C( ALL, ind2 );
+        Recursive( A, B(ind1,ind1), C1, cutoff );
+        Gemm( NORMAL, NORMAL, F(-1), C1, B(ind1,ind2), F(1), C2 );
+        Recursive( A, B(ind2,ind2), C2, cutoff );
+    }
+}
+
+// Once both dimensions are small, the subproblem is gathered and solved
+// redundantly
+template<typename F>
+void Recursive
+( const DistMatrix<F>& A, const DistMatrix<F>& B, DistMatrix<F>& C,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = B.Height();
+    if( m <= cutoff && n <= cutoff )
+    {
+        DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B ),
+                                C_STAR_STAR( C );
+        BartelsStewart
+        ( A_STAR_STAR.LockedMatrix(), B_STAR_STAR.LockedMatrix(),
+          C_STAR_STAR.Matrix() );
+        C = C_STAR_STAR;
+        return;
+    }
+
+    if( m >= n )
+    {
+        const Int m1 = Split( A );
+        const Range<Int> ind1( 0, m1 ), ind2( m1, m );
+        auto C1 = C( ind1, ALL );
+        auto C2 = C( ind2, ALL );
+        Recursive( A(ind2,ind2), B, C2, cutoff );
+        Gemm( NORMAL, NORMAL, F(-1), A(ind1,ind2), C2, F(1), C1 );
+        Recursive( A(ind1,ind1), B, C1, cutoff );
+    }
+    else
+    {
+        const Int n1 = Split( B );
+        const Range<Int> ind1( 0, n1 ), ind2( n1, n );
+        auto C1 = C( ALL, ind1 );
+        auto C2 = C( ALL, ind2 );
+        Recursive( A, B(ind1,ind1), C1, cutoff );
+        Gemm( NORMAL, NORMAL, F(-1), C1, B(ind1,ind2), F(1), C2 );
+        Recursive( A, B(ind2,ind2), C2, cutoff );
+    }
+}
+
+} // namespace sylvester
+
+template<typename F>
+void TriangularSylvester
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& C,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( B.Height() != B.Width() )
+          LogicError("B must be square");
+      if( C.Height() != A.Height() || C.Width() != B.Height() )
+          LogicError("C must conform with A and B");
+    )
+    // A split point must leave both halves nonempty
+    sylvester::Recursive( A, B, C, Max(cutoff,Int(2)) );
+}
+
+template<typename F>
+void TriangularSylvester
+( const ElementalMatrix<F>& APre,
+  const ElementalMatrix<F>& BPre,
+        ElementalMatrix<F>& CPre,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( BPre.Height() != BPre.Width() )
+          LogicError("B must be square");
+      if( CPre.Height() != APre.Height() || CPre.Width() != BPre.Height() )
+          LogicError("C must conform with A and B");
+      AssertSameGrids( APre, BPre, CPre );
+    )
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre ), BProx( BPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+    sylvester::Recursive( A, B, C, Max(cutoff,Int(2)) );
+}
+
+#define PROTO(F) \
+  template void TriangularSylvester \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& B, \
+          Matrix<F>& C, \
+    Int cutoff ); \
+  template void TriangularSylvester \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& B, \
+          ElementalMatrix<F>& C, \
+    Int cutoff );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
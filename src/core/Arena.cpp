@@ -0,0 +1,134 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+namespace {
+
+size_t AlignUp( size_t numBytes )
+{ return ((numBytes+Arena::alignment-1)/Arena::alignment)*Arena::alignment; }
+
+} // anonymous namespace
+
+Arena::~Arena()
+{
+    EL_DEBUG_ONLY(
+      if( !stack_.empty() && !uncaught_exception() )
+          cerr << "Destroying an arena with " << stack_.size()
+               << " outstanding buffers" << endl;
+    )
+}
+
+size_t Arena::Capacity() const EL_NO_EXCEPT
+{
+    size_t capacity = 0;
+    for( const auto& chunk : chunks_ )
+        capacity += chunk.memory.Size();
+    return capacity;
+}
+
+byte* Arena::Push( size_t numBytes )
+{
+    EL_DEBUG_CSE
+    const size_t alignedBytes = AlignUp( Max(numBytes,size_t(1)) );
+
+    // Find room in the active (i.e., last) chunk, or append a new one
+    if( chunks_.empty() ||
+        chunks_.back().offset+alignedBytes >
+        chunks_.back().memory.Size()-alignment )
+    {
+        const size_t capacity = Capacity();
+        const size_t chunkBytes = Max( 2*capacity, alignedBytes ) + alignment;
+        Chunk chunk;
+        chunk.memory.Require( chunkBytes );
+        chunk.offset = 0;
+        chunks_.push_back( std::move(chunk) );
+        ++numAllocations_;
+    }
+    Chunk& chunk = chunks_.back();
+
+    // Align relative to the address of the chunk's buffer
+    const size_t base = reinterpret_cast<size_t>(chunk.memory.Buffer());
+    const size_t misalignment = base % alignment;
+    const size_t shift = ( misalignment==0 ? 0 : alignment-misalignment );
+
+    Ticket ticket;
+    ticket.buffer = chunk.memory.Buffer() + shift + chunk.offset;
+    ticket.chunk = chunks_.size()-1;
+    ticket.prevOffset = chunk.offset;
+    ticket.released = false;
+    stack_.push_back( ticket );
+
+    chunk.offset += alignedBytes;
+    used_ += alignedBytes;
+    highWater_ = Max( highWater_, used_ );
+#ifdef EL_ZERO_INIT
+    MemZero( ticket.buffer, alignedBytes );
+#endif
+    return ticket.buffer;
+}
+
+void Arena::Pop( byte* buffer )
+{
+    EL_DEBUG_CSE
+    if( buffer == nullptr )
+        return;
+
+    // Mark the buffer as released (searching from the top of the stack)
+    bool found = false;
+    for( auto it=stack_.rbegin(); it!=stack_.rend(); ++it )
+    {
+        if( it->buffer == buffer && !it->released )
+        {
+            it->released = true;
+            found = true;
+            break;
+        }
+    }
+    if( !found )
+        LogicError("Attempted to release a buffer not owned by the arena");
+
+    // Unwind all released buffers from the top of the stack
+    while( !stack_.empty() && stack_.back().released )
+    {
+        const Ticket& ticket = stack_.back();
+        Chunk& chunk = chunks_[ticket.chunk];
+        used_ -= chunk.offset - ticket.prevOffset;
+        chunk.offset = ticket.prevOffset;
+        stack_.pop_back();
+    }
+
+    if( stack_.empty() && chunks_.size() > 1 )
+        Coalesce();
+}
+
+void Arena::Coalesce()
+{
+    EL_DEBUG_CSE
+    const size_t capacity = Capacity();
+    chunks_.clear();
+    Chunk chunk;
+    chunk.memory.Require( capacity );
+    chunk.offset = 0;
+    chunks_.push_back( std::move(chunk) );
+    ++numAllocations_;
+    used_ = 0;
+}
+
+void Arena::Empty()
+{
+    EL_DEBUG_CSE
+    if( !stack_.empty() )
+        LogicError("Cannot empty an arena with outstanding buffers");
+    chunks_.clear();
+    used_ = 0;
+}
+
+} // namespace El
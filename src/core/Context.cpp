@@ -0,0 +1,56 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace {
+
+const El::Int defaultBlocksize = 128;
+
+// The generator of each new context is seeded from the process seed (set by
+// InitializeRandom) and the index of the context
+std::atomic<unsigned long> contextSeed(0);
+std::atomic<unsigned long> numContexts(0);
+
+// The context installed on this thread (if any)
+thread_local El::Context* currentContext = nullptr;
+
+}
+
+namespace El {
+
+Context::Context()
+: blocksizeStack(1,::defaultBlocksize)
+{
+    std::seed_seq seedSeq{ ::contextSeed.load(), ::numContexts++ };
+    generator.seed( seedSeq );
+}
+
+Context::Context( unsigned long seed )
+: blocksizeStack(1,::defaultBlocksize), generator(seed)
+{ }
+
+void SetContextSeed( unsigned long seed ) { ::contextSeed = seed; }
+
+Context& CurrentContext()
+{
+    if( ::currentContext == nullptr )
+    {
+        thread_local Context threadContext;
+        ::currentContext = &threadContext;
+    }
+    return *::currentContext;
+}
+
+ContextScope::ContextScope( Context& context )
+: previous_(::currentContext)
+{ ::currentContext = &context; }
+
+ContextScope::~ContextScope() { ::currentContext = previous_; }
+
+} // namespace El
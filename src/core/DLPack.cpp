@@ -0,0 +1,231 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+DLDataType MakeType( std::uint8_t code, std::uint8_t bits )
+{
+    DLDataType type;
+    type.code = code;
+    type.bits = bits;
+    type.lanes = 1;
+    return type;
+}
+
+// The descriptor of an exported matrix along with its shape and strides
+struct ExportedTensor
+{
+    DLManagedTensorVersioned managed;
+    std::int64_t shape[2];
+    std::int64_t strides[2];
+};
+
+void DeleteExportedTensor( DLManagedTensorVersioned* self )
+{ delete static_cast<ExportedTensor*>(self->manager_ctx); }
+
+template<typename T>
+DLManagedTensorVersioned* Export( const Matrix<T>& A, bool readOnly )
+{
+    auto exported = new ExportedTensor;
+    exported->shape[0] = A.Height();
+    exported->shape[1] = A.Width();
+    exported->strides[0] = 1;
+    exported->strides[1] = A.LDim();
+
+    DLManagedTensorVersioned& managed = exported->managed;
+    managed.version.major = 1;
+    managed.version.minor = 0;
+    managed.manager_ctx = exported;
+    managed.deleter = &DeleteExportedTensor;
+    managed.flags = ( readOnly ? DLPACK_FLAG_BITMASK_READ_ONLY : 0 );
+
+    DLTensor& tensor = managed.dl_tensor;
+    tensor.data = const_cast<T*>(A.LockedBuffer());
+    switch( A.MemorySpace() )
+    {
+    case DEVICE_MEMORY:      tensor.device.device_type = kDLCUDA;     break;
+    case PINNED_HOST_MEMORY: tensor.device.device_type = kDLCUDAHost; break;
+    default:                 tensor.device.device_type = kDLCPU;      break;
+    }
+    tensor.device.device_id = 0;
+    tensor.ndim = 2;
+    tensor.dtype = DLPackType<T>();
+    tensor.shape = exported->shape;
+    tensor.strides = exported->strides;
+    tensor.byte_offset = 0;
+    return &managed;
+}
+
+// Extract the dimensions, leading dimension, and buffer of a vector or
+// column-major matrix held in host memory
+template<typename T>
+T* Import
+( const DLTensor& tensor, Int& height, Int& width, Int& ldim )
+{
+    const DLDataType type = DLPackType<T>();
+    if( tensor.dtype.code != type.code || tensor.dtype.bits != type.bits ||
+        tensor.dtype.lanes != 1 )
+        LogicError
+        ("Tensor of type (code=",int(tensor.dtype.code),", bits=",
+         int(tensor.dtype.bits),", lanes=",int(tensor.dtype.lanes),
+         ") does not hold entries of type ",TypeName<T>());
+    if( tensor.device.device_type != kDLCPU &&
+        tensor.device.device_type != kDLCUDAHost )
+        LogicError("Only tensors in host memory can be attached");
+    if( tensor.ndim == 1 )
+    {
+        height = tensor.shape[0];
+        width = 1;
+        if( tensor.strides != nullptr && tensor.strides[0] != 1 &&
+            height > 1 )
+            LogicError("Vector had a stride of ",tensor.strides[0]);
+        ldim = Max( height, 1 );
+    }
+    else if( tensor.ndim == 2 )
+    {
+        height = tensor.shape[0];
+        width = tensor.shape[1];
+        const Int rowStride =
+          ( tensor.strides == nullptr ? width : tensor.strides[0] );
+        const Int colStride =
+          ( tensor.strides == nullptr ? 1 : tensor.strides[1] );
+        if( rowStride != 1 && height > 1 )
+            LogicError
+            ("Tensor had a row stride of ",rowStride,
+             " (attach the transpose of a row-major array instead)");
+        ldim = ( width > 1 ? colStride : Max(height,1) );
+        if( ldim < Max(height,1) )
+            LogicError
+            ("Column stride of ",ldim," was less than the height, ",height);
+    }
+    else
+        LogicError("Cannot attach a tensor with ",tensor.ndim," dimensions");
+
+    byte* data = static_cast<byte*>(tensor.data) + tensor.byte_offset;
+    return reinterpret_cast<T*>(data);
+}
+
+} // anonymous namespace
+
+template<>
+DLDataType DLPackType<Int>()
+{ return MakeType( kDLInt, 8*sizeof(Int) ); }
+template<>
+DLDataType DLPackType<float>()
+{ return MakeType( kDLFloat, 32 ); }
+template<>
+DLDataType DLPackType<double>()
+{ return MakeType( kDLFloat, 64 ); }
+template<>
+DLDataType DLPackType<Complex<float>>()
+{ return MakeType( kDLComplex, 64 ); }
+template<>
+DLDataType DLPackType<Complex<double>>()
+{ return MakeType( kDLComplex, 128 ); }
+
+template<typename T>
+DLManagedTensorVersioned* ToDLPack( Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    return Export( A, A.Locked() );
+}
+
+template<typename T>
+DLManagedTensorVersioned* LockedToDLPack( const Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    return Export( A, true );
+}
+
+template<typename T>
+DLManagedTensorVersioned* ToDLPack( AbstractDistMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    return ToDLPack( A.Matrix() );
+}
+
+template<typename T>
+DLManagedTensorVersioned* LockedToDLPack( const AbstractDistMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    return LockedToDLPack( A.LockedMatrix() );
+}
+
+template<typename T>
+void AttachDLPack( Matrix<T>& A, const DLTensor& tensor )
+{
+    EL_DEBUG_CSE
+    Int height, width, ldim;
+    T* buffer = Import<T>( tensor, height, width, ldim );
+    A.Attach( height, width, buffer, ldim );
+}
+
+template<typename T>
+void LockedAttachDLPack( Matrix<T>& A, const DLTensor& tensor )
+{
+    EL_DEBUG_CSE
+    Int height, width, ldim;
+    const T* buffer = Import<T>( tensor, height, width, ldim );
+    A.LockedAttach( height, width, buffer, ldim );
+}
+
+template<typename T>
+void AttachDLPack
+( ElementalMatrix<T>& A, Int height, Int width, const Grid& grid,
+  int colAlign, int rowAlign, const DLTensor& localTensor, int root )
+{
+    EL_DEBUG_CSE
+    Int localHeight, localWidth, ldim;
+    T* buffer = Import<T>( localTensor, localHeight, localWidth, ldim );
+    A.Attach( height, width, grid, colAlign, rowAlign, buffer, ldim, root );
+    if( A.LocalHeight() != localHeight || A.LocalWidth() != localWidth )
+        LogicError
+        ("Local tensor was ",localHeight," x ",localWidth," but the local ",
+         "matrix should be ",A.LocalHeight()," x ",A.LocalWidth());
+}
+
+template<typename T>
+void LockedAttachDLPack
+( ElementalMatrix<T>& A, Int height, Int width, const Grid& grid,
+  int colAlign, int rowAlign, const DLTensor& localTensor, int root )
+{
+    EL_DEBUG_CSE
+    Int localHeight, localWidth, ldim;
+    const T* buffer =
+      Import<T>( localTensor, localHeight, localWidth, ldim );
+    A.LockedAttach
+    ( height, width, grid, colAlign, rowAlign, buffer, ldim, root );
+    if( A.LocalHeight() != localHeight || A.LocalWidth() != localWidth )
+        LogicError
+        ("Local tensor was ",localHeight," x ",localWidth," but the local ",
+         "matrix should be ",A.LocalHeight()," x ",A.LocalWidth());
+}
+
+#define PROTO(T) \
+  template DLManagedTensorVersioned* ToDLPack( Matrix<T>& A ); \
+  template DLManagedTensorVersioned* LockedToDLPack( const Matrix<T>& A ); \
+  template DLManagedTensorVersioned* ToDLPack( AbstractDistMatrix<T>& A ); \
+  template DLManagedTensorVersioned* LockedToDLPack \
+  ( const AbstractDistMatrix<T>& A ); \
+  template void AttachDLPack( Matrix<T>& A, const DLTensor& tensor ); \
+  template void LockedAttachDLPack \
+  ( Matrix<T>& A, const DLTensor& tensor ); \
+  template void AttachDLPack \
+  ( ElementalMatrix<T>& A, Int height, Int width, const Grid& grid, \
+    int colAlign, int rowAlign, const DLTensor& localTensor, int root ); \
+  template void LockedAttachDLPack \
+  ( ElementalMatrix<T>& A, Int height, Int width, const Grid& grid, \
+    int colAlign, int rowAlign, const DLTensor& localTensor, int root );
+
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,509 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+
+namespace El {
+
+namespace {
+
+// Send each queued (source,target) pair to the owner of its source
+void ExchangePairs
+( const vector<Int>& sources,
+  const vector<Int>& targets,
+  const DistGraph& graph,
+        vector<Int>& recvSources,
+        vector<Int>& recvTargets )
+{
+    EL_DEBUG_CSE
+    const El::Grid& grid = graph.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+    const Int numSends = sources.size();
+
+    vector<int> sendSizes( commSize, 0 );
+    for( Int s=0; s<numSends; ++s )
+        ++sendSizes[graph.SourceOwner(sources[s])];
+    vector<int> recvSizes( commSize );
+    mpi::AllToAll( sendSizes.data(), 1, recvSizes.data(), 1, comm );
+    vector<int> sendOffs, recvOffs;
+    Scan( sendSizes, sendOffs );
+    const int numRecvs = Scan( recvSizes, recvOffs );
+
+    vector<Int> sendSources( numSends ), sendTargets( numSends );
+    auto offs = sendOffs;
+    for( Int s=0; s<numSends; ++s )
+    {
+        const int q = graph.SourceOwner(sources[s]);
+        sendSources[offs[q]] = sources[s];
+        sendTargets[offs[q]] = targets[s];
+        ++offs[q];
+    }
+
+    recvSources.resize( numRecvs );
+    recvTargets.resize( numRecvs );
+    mpi::AllToAll
+    ( sendSources.data(), sendSizes.data(), sendOffs.data(),
+      recvSources.data(), recvSizes.data(), recvOffs.data(), comm );
+    mpi::AllToAll
+    ( sendTargets.data(), sendSizes.data(), sendOffs.data(),
+      recvTargets.data(), recvSizes.data(), recvOffs.data(), comm );
+}
+
+} // anonymous namespace
+
+// Constructors and destructors
+// ============================
+
+DistGraph::DistGraph( const El::Grid& grid )
+: grid_(&grid)
+{
+    EL_DEBUG_CSE
+    InitializeLocalData();
+}
+
+DistGraph::DistGraph( Int numSources, const El::Grid& grid )
+: DistGraph( numSources, numSources, grid )
+{ }
+
+DistGraph::DistGraph( Int numSources, Int numTargets, const El::Grid& grid )
+: numSources_(numSources), numTargets_(numTargets), grid_(&grid)
+{
+    EL_DEBUG_CSE
+    InitializeLocalData();
+}
+
+DistGraph::DistGraph( const DistGraph& graph )
+: grid_(graph.grid_)
+{
+    EL_DEBUG_CSE
+    *this = graph;
+}
+
+DistGraph::~DistGraph() { }
+
+// Assignment
+// ==========
+
+const DistGraph& DistGraph::operator=( const DistGraph& graph )
+{
+    EL_DEBUG_CSE
+    numSources_ = graph.numSources_;
+    numTargets_ = graph.numTargets_;
+    grid_ = graph.grid_;
+    blocksize_ = graph.blocksize_;
+    numLocalSources_ = graph.numLocalSources_;
+    sources_ = graph.sources_;
+    targets_ = graph.targets_;
+    localSourceOffsets_ = graph.localSourceOffsets_;
+    markedForRemoval_ = graph.markedForRemoval_;
+    remoteSources_ = graph.remoteSources_;
+    remoteTargets_ = graph.remoteTargets_;
+    remoteRemovals_ = graph.remoteRemovals_;
+    locallyConsistent_ = graph.locallyConsistent_;
+    return *this;
+}
+
+// Changing the graph size
+// =======================
+
+void DistGraph::Empty( bool freeMemory )
+{
+    EL_DEBUG_CSE
+    numSources_ = 0;
+    numTargets_ = 0;
+    if( freeMemory )
+    {
+        SwapClear( sources_ );
+        SwapClear( targets_ );
+        SwapClear( remoteSources_ );
+        SwapClear( remoteTargets_ );
+    }
+    else
+    {
+        sources_.resize( 0 );
+        targets_.resize( 0 );
+        remoteSources_.resize( 0 );
+        remoteTargets_.resize( 0 );
+    }
+    SwapClear( markedForRemoval_ );
+    SwapClear( remoteRemovals_ );
+    InitializeLocalData();
+}
+
+void DistGraph::Resize( Int numVertices ) { Resize( numVertices, numVertices ); }
+
+void DistGraph::Resize( Int numSources, Int numTargets )
+{
+    EL_DEBUG_CSE
+    numSources_ = numSources;
+    numTargets_ = numTargets;
+    sources_.resize( 0 );
+    targets_.resize( 0 );
+    markedForRemoval_.resize( 0 );
+    remoteSources_.resize( 0 );
+    remoteTargets_.resize( 0 );
+    remoteRemovals_.resize( 0 );
+    InitializeLocalData();
+}
+
+void DistGraph::InitializeLocalData()
+{
+    EL_DEBUG_CSE
+    const int commSize = grid_->Size();
+    const int commRank = grid_->Rank();
+
+    blocksize_ = numSources_ / commSize;
+    if( blocksize_*commSize < numSources_ || numSources_ == 0 )
+        ++blocksize_;
+
+    numLocalSources_ = Min(blocksize_,Max(numSources_-blocksize_*commRank,0));
+    localSourceOffsets_.assign( numLocalSources_+1, 0 );
+    locallyConsistent_ = true;
+}
+
+// Changing the distribution
+// =========================
+
+void DistGraph::SetGrid( const El::Grid& grid )
+{
+    EL_DEBUG_CSE
+    if( grid_ == &grid )
+        return;
+    grid_ = &grid;
+    Resize( numSources_, numTargets_ );
+}
+
+// Assembly
+// ========
+
+void DistGraph::Reserve( Int numLocalEdges, Int numRemoteEdges )
+{
+    sources_.reserve( numLocalEdges );
+    targets_.reserve( numLocalEdges );
+    remoteSources_.reserve( numRemoteEdges );
+    remoteTargets_.reserve( numRemoteEdges );
+}
+
+void DistGraph::Connect( Int source, Int target )
+{
+    EL_DEBUG_CSE
+    QueueConnection( source, target );
+    ProcessQueues();
+}
+
+void DistGraph::ConnectLocal( Int localSource, Int target )
+{
+    EL_DEBUG_CSE
+    QueueLocalConnection( localSource, target );
+    ProcessLocalQueues();
+}
+
+void DistGraph::Disconnect( Int source, Int target )
+{
+    EL_DEBUG_CSE
+    QueueDisconnection( source, target );
+    ProcessQueues();
+}
+
+void DistGraph::DisconnectLocal( Int localSource, Int target )
+{
+    EL_DEBUG_CSE
+    QueueLocalDisconnection( localSource, target );
+    ProcessLocalQueues();
+}
+
+void DistGraph::QueueConnection( Int source, Int target, bool passive )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( source < 0 || source >= numSources_ )
+          LogicError
+          ("Source was out of bounds: ",source," is not in [0,",
+           numSources_,")");
+    )
+    if( IsLocalSource(source) )
+        QueueLocalConnection( source-FirstLocalSource(), target );
+    else if( !passive )
+    {
+        remoteSources_.push_back( source );
+        remoteTargets_.push_back( target );
+    }
+}
+
+void DistGraph::QueueLocalConnection( Int localSource, Int target )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( localSource < 0 || localSource >= numLocalSources_ )
+          LogicError
+          ("Local source was out of bounds: ",localSource," is not in [0,",
+           numLocalSources_,")");
+      if( target < 0 || target >= numTargets_ )
+          LogicError
+          ("Target was out of bounds: ",target," is not in [0,",
+           numTargets_,")");
+    )
+    sources_.push_back( GlobalSource(localSource) );
+    targets_.push_back( target );
+    locallyConsistent_ = false;
+}
+
+void DistGraph::QueueDisconnection( Int source, Int target, bool passive )
+{
+    EL_DEBUG_CSE
+    if( IsLocalSource(source) )
+        QueueLocalDisconnection( source-FirstLocalSource(), target );
+    else if( !passive )
+        remoteRemovals_.emplace_back( source, target );
+}
+
+void DistGraph::QueueLocalDisconnection( Int localSource, Int target )
+{
+    EL_DEBUG_CSE
+    markedForRemoval_.emplace_back( GlobalSource(localSource), target );
+    locallyConsistent_ = false;
+}
+
+void DistGraph::ProcessQueues()
+{
+    EL_DEBUG_CSE
+    // Send the remote insertions to their owners
+    vector<Int> recvSources, recvTargets;
+    ExchangePairs
+    ( remoteSources_, remoteTargets_, *this, recvSources, recvTargets );
+    SwapClear( remoteSources_ );
+    SwapClear( remoteTargets_ );
+    const Int numRecvs = recvSources.size();
+    for( Int s=0; s<numRecvs; ++s )
+    {
+        sources_.push_back( recvSources[s] );
+        targets_.push_back( recvTargets[s] );
+        locallyConsistent_ = false;
+    }
+
+    // Send the remote removals to their owners
+    const Int numRemoteRemovals = remoteRemovals_.size();
+    vector<Int> removalSources( numRemoteRemovals ),
+                removalTargets( numRemoteRemovals );
+    for( Int s=0; s<numRemoteRemovals; ++s )
+    {
+        removalSources[s] = remoteRemovals_[s].first;
+        removalTargets[s] = remoteRemovals_[s].second;
+    }
+    SwapClear( remoteRemovals_ );
+    ExchangePairs
+    ( removalSources, removalTargets, *this, recvSources, recvTargets );
+    const Int numRecvRemovals = recvSources.size();
+    for( Int s=0; s<numRecvRemovals; ++s )
+    {
+        markedForRemoval_.emplace_back( recvSources[s], recvTargets[s] );
+        locallyConsistent_ = false;
+    }
+
+    ProcessLocalQueues();
+}
+
+void DistGraph::ProcessLocalQueues()
+{
+    EL_DEBUG_CSE
+    if( locallyConsistent_ )
+        return;
+
+    const Int numQueued = sources_.size();
+    vector<pair<Int,Int>> edges( numQueued );
+    for( Int e=0; e<numQueued; ++e )
+        edges[e] = pair<Int,Int>( sources_[e], targets_[e] );
+    std::sort( edges.begin(), edges.end() );
+    edges.erase( std::unique( edges.begin(), edges.end() ), edges.end() );
+
+    if( !markedForRemoval_.empty() )
+    {
+        std::sort( markedForRemoval_.begin(), markedForRemoval_.end() );
+        edges.erase
+        ( std::remove_if
+          ( edges.begin(), edges.end(),
+            [&]( const pair<Int,Int>& edge )
+            { return std::binary_search
+                     ( markedForRemoval_.begin(), markedForRemoval_.end(),
+                       edge ); } ),
+          edges.end() );
+        SwapClear( markedForRemoval_ );
+    }
+
+    const Int numEdges = edges.size();
+    sources_.resize( numEdges );
+    targets_.resize( numEdges );
+    for( Int e=0; e<numEdges; ++e )
+    {
+        sources_[e] = edges[e].first;
+        targets_[e] = edges[e].second;
+    }
+    ComputeSourceOffsets();
+    locallyConsistent_ = true;
+}
+
+// High-level information
+// ======================
+
+Int DistGraph::NumSources() const EL_NO_EXCEPT { return numSources_; }
+Int DistGraph::NumTargets() const EL_NO_EXCEPT { return numTargets_; }
+
+Int DistGraph::FirstLocalSource() const EL_NO_EXCEPT
+{ return blocksize_*grid_->Rank(); }
+
+Int DistGraph::NumLocalSources() const EL_NO_EXCEPT
+{ return numLocalSources_; }
+
+Int DistGraph::NumLocalEdges() const EL_NO_EXCEPT { return targets_.size(); }
+
+Int DistGraph::Capacity() const EL_NO_EXCEPT
+{ return Min( sources_.capacity(), targets_.capacity() ); }
+
+bool DistGraph::LocallyConsistent() const EL_NO_EXCEPT
+{ return locallyConsistent_; }
+
+// Distribution information
+// ========================
+
+const El::Grid& DistGraph::Grid() const EL_NO_EXCEPT { return *grid_; }
+
+Int DistGraph::Blocksize() const EL_NO_EXCEPT { return blocksize_; }
+
+int DistGraph::SourceOwner( Int source ) const EL_NO_RELEASE_EXCEPT
+{ return source / blocksize_; }
+
+Int DistGraph::GlobalSource( Int localSource ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( localSource < 0 || localSource > numLocalSources_ )
+          LogicError("Local source was out of bounds");
+    )
+    return localSource + FirstLocalSource();
+}
+
+Int DistGraph::LocalSource( Int source ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !IsLocalSource(source) )
+          LogicError("Requested local index of non-local source");
+    )
+    return source - FirstLocalSource();
+}
+
+bool DistGraph::IsLocalSource( Int source ) const EL_NO_RELEASE_EXCEPT
+{
+    const Int firstLocalSource = FirstLocalSource();
+    return source >= firstLocalSource &&
+           source < firstLocalSource+numLocalSources_;
+}
+
+// Detailed local information
+// ==========================
+
+Int DistGraph::Source( Int localEdge ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( localEdge < 0 || localEdge >= Int(sources_.size()) )
+          LogicError("Edge number out of bounds");
+    )
+    return sources_[localEdge];
+}
+
+Int DistGraph::Target( Int localEdge ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( localEdge < 0 || localEdge >= Int(targets_.size()) )
+          LogicError("Edge number out of bounds");
+    )
+    return targets_[localEdge];
+}
+
+Int DistGraph::SourceOffset( Int localSource ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( localSource < 0 || localSource > numLocalSources_ )
+          LogicError("Local source was out of bounds");
+      AssertLocallyConsistent();
+    )
+    return localSourceOffsets_[localSource];
+}
+
+Int DistGraph::Offset( Int localSource, Int target ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int* targetBuf = targets_.data();
+    const Int thisOff = SourceOffset(localSource);
+    const Int nextOff = SourceOffset(localSource+1);
+    return std::lower_bound
+           ( targetBuf+thisOff, targetBuf+nextOff, target ) - targetBuf;
+}
+
+Int DistGraph::NumConnections( Int localSource ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    return SourceOffset(localSource+1) - SourceOffset(localSource);
+}
+
+bool DistGraph::EdgeExistsLocal( Int localSource, Int target )
+const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int off = Offset( localSource, target );
+    return off < SourceOffset(localSource+1) && targets_[off] == target;
+}
+
+Int* DistGraph::SourceBuffer() EL_NO_EXCEPT { return sources_.data(); }
+Int* DistGraph::TargetBuffer() EL_NO_EXCEPT { return targets_.data(); }
+Int* DistGraph::OffsetBuffer() EL_NO_EXCEPT
+{ return localSourceOffsets_.data(); }
+
+const Int* DistGraph::LockedSourceBuffer() const EL_NO_EXCEPT
+{ return sources_.data(); }
+const Int* DistGraph::LockedTargetBuffer() const EL_NO_EXCEPT
+{ return targets_.data(); }
+const Int* DistGraph::LockedOffsetBuffer() const EL_NO_EXCEPT
+{ return localSourceOffsets_.data(); }
+
+void DistGraph::ForceNumLocalEdges( Int numLocalEdges )
+{
+    EL_DEBUG_CSE
+    sources_.resize( numLocalEdges );
+    targets_.resize( numLocalEdges );
+    locallyConsistent_ = false;
+}
+
+void DistGraph::ForceConsistency( bool consistent ) EL_NO_EXCEPT
+{ locallyConsistent_ = consistent; }
+
+void DistGraph::AssertLocallyConsistent() const
+{
+    if( !locallyConsistent_ )
+        LogicError("DistGraph was not locally consistent");
+}
+
+void DistGraph::ComputeSourceOffsets()
+{
+    EL_DEBUG_CSE
+    const Int numLocalEdges = sources_.size();
+    const Int firstLocalSource = FirstLocalSource();
+    localSourceOffsets_.assign( numLocalSources_+1, 0 );
+    for( Int e=0; e<numLocalEdges; ++e )
+        ++localSourceOffsets_[sources_[e]-firstLocalSource+1];
+    for( Int s=0; s<numLocalSources_; ++s )
+        localSourceOffsets_[s+1] += localSourceOffsets_[s];
+}
+
+} // namespace El
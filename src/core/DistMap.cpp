@@ -306,4 +306,42 @@ void InvertMap( const DistMap& map, DistMap& inverseMap )
     }
 }
 
+void EnsurePermutation( const vector<Int>& map )
+{
+    EL_DEBUG_CSE
+    const Int numSources = map.size();
+    vector<bool> hit( numSources, false );
+    for( Int s=0; s<numSources; ++s )
+    {
+        const Int target = map[s];
+        if( target < 0 || target >= numSources )
+            LogicError("Target ",target," of source ",s," was out of bounds");
+        if( hit[target] )
+            LogicError("Target ",target," was hit more than once");
+        hit[target] = true;
+    }
+}
+
+void EnsurePermutation( const DistMap& map )
+{
+    EL_DEBUG_CSE
+    const Int numSources = map.NumSources();
+    const Int numLocalSources = map.NumLocalSources();
+
+    // Gather the map onto every process and check redundantly
+    const El::Grid& grid = map.Grid();
+    const int commSize = grid.Size();
+    const int numLocalInts = numLocalSources;
+    vector<int> sizes( commSize ), offs;
+    mpi::AllGather( &numLocalInts, 1, sizes.data(), 1, grid.Comm() );
+    const int totalSize = Scan( sizes, offs );
+    if( totalSize != numSources )
+        LogicError("Map did not have the correct number of sources");
+    vector<Int> fullMap( numSources );
+    mpi::AllGather
+    ( map.Buffer(), numLocalSources,
+      fullMap.data(), sizes.data(), offs.data(), grid.Comm() );
+    EnsurePermutation( fullMap );
+}
+
 } // namespace El
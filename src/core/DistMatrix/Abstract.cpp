@@ -38,7 +38,10 @@ EL_NO_EXCEPT
   rowShift_(A.rowShift_),
   root_(A.root_),
   grid_(A.grid_)
-{ matrix_.ShallowSwap( A.matrix_ ); }
+{
+    matrix_.ShallowSwap( A.matrix_ );
+    nodeWindow_.swap( A.nodeWindow_ );
+}
 
 template<typename T>
 AbstractDistMatrix<T>::~AbstractDistMatrix() { }
@@ -61,6 +64,7 @@ AbstractDistMatrix<T>::Empty( bool freeMemory )
     SetShifts();
 
     SwapClear( remoteUpdates );
+    SwapClear( threadUpdates_ );
 }
 
 template<typename T>
@@ -72,6 +76,7 @@ AbstractDistMatrix<T>::EmptyData( bool freeMemory )
     height_ = 0;
     width_ = 0;
     SwapClear( remoteUpdates );
+    SwapClear( threadUpdates_ );
 }
 
 template<typename T>
@@ -165,6 +170,7 @@ AbstractDistMatrix<T>::operator=( AbstractDistMatrix<T>&& A )
     else
     {
         matrix_.ShallowSwap( A.matrix_ );
+        nodeWindow_.swap( A.nodeWindow_ );
         viewType_ = A.viewType_;
         height_ = A.height_;
         width_ = A.width_;
@@ -389,6 +395,55 @@ EL_NO_RELEASE_EXCEPT
     return value;
 }
 
+template<typename T>
+vector<T>
+AbstractDistMatrix<T>::GetMany( const vector<pair<Int,Int>>& indices ) const
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !grid_->InGrid() )
+          LogicError("GetMany should only be called in-grid");
+    )
+    const Int numEntries = indices.size();
+    vector<T> values;
+    FastResize( values, numEntries );
+    if( CrossRank() == Root() )
+    {
+        // Every process can determine the owner of each entry, so the
+        // counts of the gather need not be exchanged
+        const int distSize = DistSize();
+        const int distRank = DistRank();
+        vector<int> owners(numEntries), recvCounts(distSize,0);
+        for( Int k=0; k<numEntries; ++k )
+        {
+            owners[k] = Owner( indices[k].first, indices[k].second );
+            ++recvCounts[owners[k]];
+        }
+        vector<int> recvOffs;
+        Scan( recvCounts, recvOffs );
+
+        vector<T> sendBuf;
+        sendBuf.reserve( recvCounts[distRank] );
+        for( Int k=0; k<numEntries; ++k )
+            if( owners[k] == distRank )
+                sendBuf.push_back
+                ( GetLocal
+                  ( LocalRow(indices[k].first),
+                    LocalCol(indices[k].second) ) );
+
+        vector<T> recvBuf;
+        FastResize( recvBuf, numEntries );
+        mpi::AllGather
+        ( sendBuf.data(), recvCounts[distRank],
+          recvBuf.data(), recvCounts.data(), recvOffs.data(), DistComm() );
+        for( Int k=0; k<numEntries; ++k )
+            values[k] = recvBuf[recvOffs[owners[k]]++];
+    }
+    mpi::Broadcast( values.data(), numEntries, Root(), CrossComm() );
+    return values;
+}
+
 template<typename T>
 Base<T>
 AbstractDistMatrix<T>::GetRealPart( Int i, Int j ) const
@@ -454,6 +509,16 @@ AbstractDistMatrix<T>::Set( const Entry<T>& entry )
 EL_NO_RELEASE_EXCEPT
 { Set( entry.i, entry.j, entry.value ); }
 
+template<typename T>
+void
+AbstractDistMatrix<T>::SetMany( const vector<Entry<T>>& entries )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    for( const auto& entry : entries )
+        Set( entry );
+}
+
 template<typename T>
 void
 AbstractDistMatrix<T>::SetRealPart( Int i, Int j, Base<T> value )
@@ -552,12 +617,49 @@ EL_NO_RELEASE_EXCEPT
 
 // Batch remote updates
 // --------------------
+namespace {
+
+// Sort the entries into column-major order and sum those with the same
+// indices, returning the number of distinct entries
+template<typename T>
+Int CombineDuplicates( Entry<T>* entries, Int numEntries )
+{
+    std::sort
+    ( entries, entries+numEntries,
+      []( const Entry<T>& a, const Entry<T>& b )
+      { return a.j < b.j || (a.j == b.j && a.i < b.i); } );
+    Int numCombined = 0;
+    for( Int k=0; k<numEntries; ++k )
+    {
+        if( numCombined > 0 &&
+            entries[numCombined-1].i == entries[k].i &&
+            entries[numCombined-1].j == entries[k].j )
+            entries[numCombined-1].value += entries[k].value;
+        else
+            entries[numCombined++] = entries[k];
+    }
+    return numCombined;
+}
+
+} // anonymous namespace
+
 template<typename T>
 void AbstractDistMatrix<T>::Reserve( Int numRemoteUpdates )
 {
     EL_DEBUG_CSE
     const Int currSize = remoteUpdates.size();
     remoteUpdates.reserve( currSize+numRemoteUpdates );
+#ifdef EL_HYBRID
+    if( !omp_in_parallel() )
+    {
+        const int numThreads = omp_get_max_threads();
+        if( Int(threadUpdates_.size()) < numThreads )
+            threadUpdates_.resize( numThreads );
+        for( auto& threadQueue : threadUpdates_ )
+            threadQueue.reserve
+            ( threadQueue.size()+numRemoteUpdates/numThreads );
+    }
+#endif
 }
 
 template<typename T>
@@ -565,6 +667,21 @@ void AbstractDistMatrix<T>::QueueUpdate( const Entry<T>& entry )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    // Each thread of a team appends to its own queue (allocated by Reserve)
+    if( omp_in_parallel() )
+    {
+        const int thread = omp_get_thread_num();
+        EL_DEBUG_ONLY(
+          if( thread >= Int(threadUpdates_.size()) )
+              LogicError
+              ("Reserve must be called outside of a parallel region before "
+               "queueing updates from within one");
+        )
+        threadUpdates_[thread].push_back( entry );
+        return;
+    }
+#endif
     // NOTE: We cannot always simply locally update since it can (and has)
     //       lead to the processors in the same redundant communicator having
     //       different results after ProcessQueues()
@@ -586,6 +703,12 @@ void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
     const auto& grid = Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
+    for( auto& threadQueue : threadUpdates_ )
+    {
+        remoteUpdates.insert
+        ( remoteUpdates.end(), threadQueue.begin(), threadQueue.end() );
+        SwapClear( threadQueue );
+    }
     const Int totalSend = remoteUpdates.size();
 
     // We will first push to redundant rank 0
@@ -594,7 +717,8 @@ void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
     // Compute the metadata
     // ====================
     mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
+    vector<Int> sendCounts;
+    vector<int> owners(totalSend);
     if( includeViewers )
     {
         comm = grid.ViewingComm();
@@ -626,28 +750,55 @@ void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
             ++sendCounts[owners[k]];
         }
     }
+    const int commSize = sendCounts.size();
 
     // Pack the data
     // =============
-    vector<int> sendOffs;
+    vector<Int> sendOffs;
     Scan( sendCounts, sendOffs );
     vector<Entry<T>> sendBuf(totalSend);
     auto offs = sendOffs;
     for( Int k=0; k<totalSend; ++k )
         sendBuf[offs[owners[k]]++] = remoteUpdates[k];
     SwapClear( remoteUpdates );
+    SwapClear( owners );
+
+    // Sum the updates of each destination which share the same indices
+    EL_PARALLEL_FOR_GRAIN(totalSend)
+    for( int q=0; q<commSize; ++q )
+        sendCounts[q] =
+          CombineDuplicates( &sendBuf[sendOffs[q]], sendCounts[q] );
 
     // Exchange and unpack the data
     // ============================
-    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
-    Int recvBufSize = recvBuf.size();
-    mpi::Broadcast( recvBufSize, redundantRoot, RedundantComm() );
-    recvBuf.resize( recvBufSize );
-    mpi::Broadcast
-    ( recvBuf.data(), recvBufSize, redundantRoot, RedundantComm() );
-    // TODO: Make this loop faster
-    for( const auto& entry : recvBuf )
-        UpdateLocal( LocalRow(entry.i), LocalCol(entry.j), entry.value );
+    // Each round sends (roughly) at most QueueRoundSize() entries from each
+    // process so that the exchange buffers remain bounded
+    Int numCombined = 0;
+    for( int q=0; q<commSize; ++q )
+        numCombined += sendCounts[q];
+    const Int roundSize = QueueRoundSize();
+    const Int numLocalRounds = (numCombined+roundSize-1) / roundSize;
+    const Int numRounds = mpi::AllReduce( numLocalRounds, mpi::MAX, comm );
+    vector<int> roundCounts(commSize), roundOffs(commSize);
+    for( Int round=0; round<numRounds; ++round )
+    {
+        for( int q=0; q<commSize; ++q )
+        {
+            const Int chunk = (sendCounts[q]+numRounds-1) / numRounds;
+            const Int beg = Min( round*chunk, sendCounts[q] );
+            const Int end = Min( beg+chunk, sendCounts[q] );
+            roundCounts[q] = end - beg;
+            roundOffs[q] = sendOffs[q] + beg;
+        }
+        auto recvBuf = mpi::AllToAll( sendBuf, roundCounts, roundOffs, comm );
+        Int recvBufSize = recvBuf.size();
+        mpi::Broadcast( recvBufSize, redundantRoot, RedundantComm() );
+        recvBuf.resize( recvBufSize );
+        mpi::Broadcast
+        ( recvBuf.data(), recvBufSize, redundantRoot, RedundantComm() );
+        for( const auto& entry : recvBuf )
+            UpdateLocal( LocalRow(entry.i), LocalCol(entry.j), entry.value );
+    }
 }
 
 template<typename T>
@@ -966,6 +1117,7 @@ void
 AbstractDistMatrix<T>::ShallowSwap( AbstractDistMatrix<T>& A )
 {
     matrix_.ShallowSwap( A.matrix_ );
+    nodeWindow_.swap( A.nodeWindow_ );
     std::swap( viewType_, A.viewType_ );
     std::swap( height_ , A.height_ );
     std::swap( width_, A.width_ );
@@ -990,6 +1142,8 @@ AbstractDistMatrix<T>::ShallowSwap( AbstractDistMatrix<T>& A )
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#define EL_ENABLE_BFLOAT16
 #include <El/macros/Instantiate.h>
 
 } // namespace El
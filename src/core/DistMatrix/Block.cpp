@@ -860,6 +860,8 @@ void AssertConforming2x2
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#define EL_ENABLE_BFLOAT16
 #include <El/macros/Instantiate.h>
 
 } // namespace El
@@ -240,6 +240,67 @@ template<typename T>
 int BDM::PartialUnionRowRank() const EL_NO_EXCEPT
 { return ( this->Grid().InGrid() ? 0 : mpi::UNDEFINED ); }
 
+#ifdef EL_HAVE_SCALAPACK
+// ScaLAPACK interoperability
+// ==========================
+
+namespace {
+
+void AssertMatchingContext( const Grid& grid, const blacs::Desc& desc )
+{
+    if( desc[0] != 1 )
+        LogicError("Only dense (type 1) descriptors are supported");
+    if( !grid.InGrid() )
+        return;
+    const int context = desc[1];
+    if( context == grid.BlacsMCMRContext() )
+        return;
+    if( blacs::GridHeight(context) != grid.Height() ||
+        blacs::GridWidth(context) != grid.Width() )
+        LogicError
+        ("BLACS grid was ",blacs::GridHeight(context)," x ",
+         blacs::GridWidth(context)," but the Elemental grid was ",
+         grid.Height()," x ",grid.Width());
+    if( blacs::GridRow(context) != grid.Row() ||
+        blacs::GridCol(context) != grid.Col() )
+        LogicError
+        ("Process was at (",blacs::GridRow(context),",",
+         blacs::GridCol(context),") of the BLACS grid but at (",
+         grid.Row(),",",grid.Col(),") of the Elemental grid");
+}
+
+} // anonymous namespace
+
+template<typename T>
+blacs::Desc BDM::Descriptor() const
+{
+    EL_DEBUG_CSE
+    return FillDesc( *this );
+}
+
+template<typename T>
+void BDM::AttachScaLAPACK( const blacs::Desc& desc, T* buffer )
+{
+    EL_DEBUG_CSE
+    const El::Grid& grid = this->Grid();
+    AssertMatchingContext( grid, desc );
+    this->Attach
+    ( desc[2], desc[3], grid, desc[4], desc[5], desc[6], desc[7], 0, 0,
+      buffer, desc[8], this->Root() );
+}
+
+template<typename T>
+void BDM::LockedAttachScaLAPACK( const blacs::Desc& desc, const T* buffer )
+{
+    EL_DEBUG_CSE
+    const El::Grid& grid = this->Grid();
+    AssertMatchingContext( grid, desc );
+    this->LockedAttach
+    ( desc[2], desc[3], grid, desc[4], desc[5], desc[6], desc[7], 0, 0,
+      buffer, desc[8], this->Root() );
+}
+#endif // ifdef EL_HAVE_SCALAPACK
+
 // Instantiate {Int,Real,Complex<Real>} for each Real in {float,double}
 // ####################################################################
 
@@ -277,6 +338,8 @@ int BDM::PartialUnionRowRank() const EL_NO_EXCEPT
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#define EL_ENABLE_BFLOAT16
 #include <El/macros/Instantiate.h>
 
 } // namespace El
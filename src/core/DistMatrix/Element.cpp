@@ -333,25 +333,7 @@ ElementalMatrix<T>::Attach
   int colAlign, int rowAlign, T* buffer, Int ldim, int root )
 {
     EL_DEBUG_CSE
-    this->Empty();
-
-    this->grid_ = &g;
-    this->root_ = root;
-    this->height_ = height;
-    this->width_ = width;
-    this->colAlign_ = colAlign;
-    this->rowAlign_ = rowAlign;
-    this->colConstrained_ = true;
-    this->rowConstrained_ = true;
-    this->rootConstrained_ = true;
-    this->viewType_ = VIEW;
-    this->SetShifts();
-    if( this->Participating() )
-    {
-        Int localHeight = Length(height,this->colShift_,this->ColStride());
-        Int localWidth = Length(width,this->rowShift_,this->RowStride());
-        this->matrix_.Attach_( localHeight, localWidth, buffer, ldim );
-    }
+    Attach_( height, width, g, colAlign, rowAlign, buffer, ldim, root, false );
 }
 
 template<typename T>
@@ -381,25 +363,9 @@ ElementalMatrix<T>::LockedAttach
   int colAlign, int rowAlign, const T* buffer, Int ldim, int root )
 {
     EL_DEBUG_CSE
-    this->Empty();
-
-    this->grid_ = &g;
-    this->root_ = root;
-    this->height_ = height;
-    this->width_ = width;
-    this->colAlign_ = colAlign;
-    this->rowAlign_ = rowAlign;
-    this->colConstrained_ = true;
-    this->rowConstrained_ = true;
-    this->rootConstrained_ = true;
-    this->viewType_ = LOCKED_VIEW;
-    this->SetShifts();
-    if( this->Participating() )
-    {
-        Int localHeight = Length(height,this->colShift_,this->ColStride());
-        Int localWidth = Length(width,this->rowShift_,this->RowStride());
-        this->matrix_.LockedAttach_( localHeight, localWidth, buffer, ldim );
-    }
+    Attach_
+    ( height, width, g, colAlign, rowAlign, const_cast<T*>(buffer), ldim, root,
+      true );
 }
 
 template<typename T>
@@ -423,6 +389,130 @@ ElementalMatrix<T>::LockedAttach( const El::Grid& g, const El::Matrix<T>& A )
     LockedAttach( A.Height(), A.Width(), g, 0, 0, A.LockedBuffer(), A.LDim() );
 }
 
+template<typename T>
+void
+ElementalMatrix<T>::AttachSubmatrix
+( ElementalMatrix<T>& B, Int i, Int j, Int height, Int width )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( B.Locked() )
+          LogicError("Cannot attach a mutable view to a locked matrix");
+    )
+    // Writes through the view must not reach a copy-on-write sharer of B
+    B.matrix_.Detach();
+    AttachSubmatrix_( B, i, j, height, width, false );
+}
+
+template<typename T>
+void
+ElementalMatrix<T>::LockedAttachSubmatrix
+( const ElementalMatrix<T>& B, Int i, Int j, Int height, Int width )
+{
+    EL_DEBUG_CSE
+    AttachSubmatrix_( B, i, j, height, width, true );
+}
+
+template<typename T>
+void
+ElementalMatrix<T>::Attach_
+( Int height, Int width, const El::Grid& g,
+  int colAlign, int rowAlign, T* buffer, Int ldim, int root, bool locked )
+{
+    EL_DEBUG_CSE
+    // Unlike Empty, EmptyData does not recompute the (soon to be
+    // overwritten) shifts
+    this->EmptyData();
+
+    this->grid_ = &g;
+    this->root_ = root;
+    this->height_ = height;
+    this->width_ = width;
+    this->colAlign_ = colAlign;
+    this->rowAlign_ = rowAlign;
+    this->colConstrained_ = true;
+    this->rowConstrained_ = true;
+    this->rootConstrained_ = true;
+    this->viewType_ = ( locked ? LOCKED_VIEW : VIEW );
+    if( this->Participating() )
+    {
+        const int colStride = this->ColStride();
+        const int rowStride = this->RowStride();
+        this->colShift_ = Shift(this->ColRank(),colAlign,colStride);
+        this->rowShift_ = Shift(this->RowRank(),rowAlign,rowStride);
+        const Int localHeight = Length(height,this->colShift_,colStride);
+        const Int localWidth = Length(width,this->rowShift_,rowStride);
+        if( locked )
+            this->matrix_.LockedAttach_
+            ( localHeight, localWidth, buffer, ldim );
+        else
+            this->matrix_.Attach_( localHeight, localWidth, buffer, ldim );
+    }
+    else
+    {
+        this->colShift_ = 0;
+        this->rowShift_ = 0;
+    }
+}
+
+template<typename T>
+void
+ElementalMatrix<T>::AttachSubmatrix_
+( const ElementalMatrix<T>& B, Int i, Int j, Int height, Int width,
+  bool locked )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameDist( this->DistData(), B.DistData() );
+      B.AssertValidSubmatrix( i, j, height, width );
+    )
+    // Since the submatrix shares the distribution of B, the new alignments
+    // and shifts follow from those of B by modular arithmetic. Everything is
+    // read from B before this matrix is modified so that B may alias it.
+    const El::Grid* grid = B.grid_;
+    const int root = B.root_;
+    const int colStride = B.ColStride();
+    const int rowStride = B.RowStride();
+    const int colAlign = int((i+B.colAlign_) % colStride);
+    const int rowAlign = int((j+B.rowAlign_) % rowStride);
+    const bool participating = B.Participating();
+    Int colShift=0, rowShift=0, localHeight=0, localWidth=0, ldim=1;
+    T* buffer = nullptr;
+    if( participating )
+    {
+        colShift = Mod( B.colShift_-i, colStride );
+        rowShift = Mod( B.rowShift_-j, rowStride );
+        localHeight = Length_( height, colShift, colStride );
+        localWidth = Length_( width, rowShift, rowStride );
+        const Int iLoc = Length_( i, B.colShift_, colStride );
+        const Int jLoc = Length_( j, B.rowShift_, rowStride );
+        ldim = B.matrix_.LDim();
+        buffer = const_cast<T*>(B.matrix_.LockedBuffer()) + iLoc + jLoc*ldim;
+    }
+
+    this->EmptyData();
+    this->grid_ = grid;
+    this->root_ = root;
+    this->height_ = height;
+    this->width_ = width;
+    this->colAlign_ = colAlign;
+    this->rowAlign_ = rowAlign;
+    this->colShift_ = colShift;
+    this->rowShift_ = rowShift;
+    this->colConstrained_ = true;
+    this->rowConstrained_ = true;
+    this->rootConstrained_ = true;
+    this->viewType_ = ( locked ? LOCKED_VIEW : VIEW );
+    if( participating )
+    {
+        if( locked )
+            this->matrix_.LockedAttach_
+            ( localHeight, localWidth, buffer, ldim );
+        else
+            this->matrix_.Attach_( localHeight, localWidth, buffer, ldim );
+    }
+}
+
 // Operator overloading
 // ====================
 
@@ -818,6 +908,8 @@ ElementalMatrix<T>::ShallowSwap( ElementalMatrix<T>& A )
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#define EL_ENABLE_BFLOAT16
 #include <El/macros/Instantiate.h>
 
 } // namespace El
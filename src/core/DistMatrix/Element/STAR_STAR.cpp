@@ -142,6 +142,68 @@ DM& DM::operator=( const ElementalMatrix<T>& A )
     return *this;
 }
 
+// Node-shared storage
+// ===================
+template<typename T>
+void DM::SetNodeShared( bool nodeShared )
+{
+    EL_DEBUG_CSE
+    if( nodeShared == NodeShared() )
+        return;
+    const El::Grid& g = this->Grid();
+    if( nodeShared )
+    {
+        if( !IsPacked<T>::value )
+            LogicError("Node-shared matrices require a packed datatype");
+        if( g.HaveViewers() )
+            LogicError("Node-shared matrices require a grid without viewers");
+        if( this->Viewing() )
+            LogicError("Views cannot be node-shared");
+        El::Matrix<T> contents( this->matrix_ );
+        this->nodeWindow_.reset( new mpi::SharedWindow(g.NodeComm()) );
+        ResizeNodeShared( contents.Height(), contents.Width() );
+        if( g.NodeRank() == 0 )
+            this->matrix_ = contents;
+        SynchronizeNode();
+    }
+    else
+    {
+        El::Matrix<T> contents( this->matrix_ );
+        // Every process must finish reading before the buffer is freed
+        SynchronizeNode();
+        this->matrix_.Empty();
+        this->nodeWindow_.reset();
+        this->matrix_ = contents;
+    }
+}
+
+template<typename T>
+bool DM::NodeShared() const EL_NO_EXCEPT
+{ return this->nodeWindow_ != nullptr; }
+
+template<typename T>
+void DM::ResizeNodeShared( Int height, Int width )
+{
+    EL_DEBUG_CSE
+    if( !NodeShared() )
+        LogicError("Matrix is not node-shared");
+    const Int ldim = Max(height,Int(1));
+    T* buffer = static_cast<T*>
+      ( this->nodeWindow_->Require( ldim*width*sizeof(T) ) );
+    this->matrix_.Empty();
+    this->matrix_.Attach( height, width, buffer, ldim );
+    this->height_ = height;
+    this->width_ = width;
+}
+
+template<typename T>
+void DM::SynchronizeNode()
+{
+    EL_DEBUG_CSE
+    if( NodeShared() )
+        this->nodeWindow_->Synchronize();
+}
+
 // Basic queries
 // =============
 template<typename T>
@@ -260,6 +322,8 @@ int DM::PartialUnionRowRank() const EL_NO_EXCEPT
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#define EL_ENABLE_BFLOAT16
 #include <El/macros/Instantiate.h>
 
 } // namespace El
@@ -0,0 +1,76 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Ring>
+DistMatrixReadCache<Ring>::DistMatrixReadCache
+( const AbstractDistMatrix<Ring>& A, Int panelWidth )
+: A_(A), panelWidth_(panelWidth==0 ? Blocksize() : panelWidth)
+{
+    EL_DEBUG_CSE
+    if( panelWidth_ <= 0 )
+        LogicError("Invalid panel width of ",panelWidth_);
+    Invalidate();
+}
+
+template<typename Ring>
+Ring DistMatrixReadCache<Ring>::Get( Int i, Int j )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( i < 0 || i >= A_.Height() || j < 0 || j >= A_.Width() )
+          LogicError
+          ("Entry (",i,",",j,") is out of bounds of a ",A_.Height()," x ",
+           A_.Width()," matrix");
+    )
+    const Int panel = j / panelWidth_;
+    const Int jBeg = panel*panelWidth_;
+    if( !cached_[panel] )
+    {
+        const Int jEnd = Min( jBeg+panelWidth_, A_.Width() );
+        vector<Int> J(jEnd-jBeg);
+        for( Int jSub=0; jSub<jEnd-jBeg; ++jSub )
+            J[jSub] = jBeg + jSub;
+        DistMatrix<Ring,STAR,STAR> panel_STAR_STAR( A_.Grid() );
+        GetSubmatrix( A_, IR(0,A_.Height()), J, panel_STAR_STAR );
+        panels_[panel] = panel_STAR_STAR.LockedMatrix();
+        cached_[panel] = true;
+        ++numMisses_;
+    }
+    return panels_[panel].Get( i, j-jBeg );
+}
+
+template<typename Ring>
+void DistMatrixReadCache<Ring>::Invalidate()
+{
+    EL_DEBUG_CSE
+    const Int numPanels = (A_.Width()+panelWidth_-1) / panelWidth_;
+    panels_.clear();
+    panels_.resize( numPanels );
+    cached_.assign( numPanels, false );
+}
+
+template<typename Ring>
+Int DistMatrixReadCache<Ring>::NumMisses() const EL_NO_EXCEPT
+{ return numMisses_; }
+
+#define PROTO(Ring) template class DistMatrixReadCache<Ring>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#define EL_ENABLE_BFLOAT16
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,330 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+template<typename T>
+DistMultiVec<T>::DistMultiVec( const El::Grid& grid )
+: grid_(&grid)
+{
+    EL_DEBUG_CSE
+    InitializeLocalData();
+}
+
+template<typename T>
+DistMultiVec<T>::DistMultiVec( Int height, Int width, const El::Grid& grid )
+: height_(height), width_(width), grid_(&grid)
+{
+    EL_DEBUG_CSE
+    InitializeLocalData();
+}
+
+template<typename T>
+DistMultiVec<T>::DistMultiVec( const DistMultiVec<T>& A )
+: grid_(A.grid_)
+{
+    EL_DEBUG_CSE
+    *this = A;
+}
+
+template<typename T>
+DistMultiVec<T>::~DistMultiVec() { }
+
+// Assignment and reconfiguration
+// ==============================
+
+template<typename T>
+const DistMultiVec<T>& DistMultiVec<T>::operator=( const DistMultiVec<T>& A )
+{
+    EL_DEBUG_CSE
+    height_ = A.height_;
+    width_ = A.width_;
+    grid_ = A.grid_;
+    blocksize_ = A.blocksize_;
+    multiVec_ = A.multiVec_;
+    remoteUpdates_ = A.remoteUpdates_;
+    return *this;
+}
+
+template<typename T>
+const DistMultiVec<T>& DistMultiVec<T>::operator+=( const DistMultiVec<T>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != height_ || A.Width() != width_ )
+          LogicError("DistMultiVecs were not conformal");
+      if( A.Grid() != *grid_ )
+          LogicError("DistMultiVecs had different grids");
+    )
+    Axpy( T(1), A.LockedMatrix(), multiVec_ );
+    return *this;
+}
+
+template<typename T>
+const DistMultiVec<T>& DistMultiVec<T>::operator-=( const DistMultiVec<T>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != height_ || A.Width() != width_ )
+          LogicError("DistMultiVecs were not conformal");
+      if( A.Grid() != *grid_ )
+          LogicError("DistMultiVecs had different grids");
+    )
+    Axpy( T(-1), A.LockedMatrix(), multiVec_ );
+    return *this;
+}
+
+template<typename T>
+const DistMultiVec<T>& DistMultiVec<T>::operator*=( T alpha )
+{
+    EL_DEBUG_CSE
+    Scale( alpha, multiVec_ );
+    return *this;
+}
+
+template<typename T>
+void DistMultiVec<T>::Empty( bool freeMemory )
+{
+    height_ = 0;
+    width_ = 0;
+    multiVec_.Empty( freeMemory );
+    SwapClear( remoteUpdates_ );
+    InitializeLocalData();
+}
+
+template<typename T>
+void DistMultiVec<T>::Resize( Int height, Int width )
+{
+    EL_DEBUG_CSE
+    height_ = height;
+    width_ = width;
+    InitializeLocalData();
+}
+
+template<typename T>
+void DistMultiVec<T>::SetGrid( const El::Grid& grid )
+{
+    EL_DEBUG_CSE
+    if( grid_ == &grid )
+        return;
+    grid_ = &grid;
+    InitializeLocalData();
+}
+
+template<typename T>
+void DistMultiVec<T>::InitializeLocalData()
+{
+    EL_DEBUG_CSE
+    const int commSize = grid_->Size();
+    const int commRank = grid_->Rank();
+
+    blocksize_ = height_ / commSize;
+    if( blocksize_*commSize < height_ || height_ == 0 )
+        ++blocksize_;
+
+    const Int localHeight = Min(blocksize_,Max(height_-blocksize_*commRank,0));
+    multiVec_.Resize( localHeight, width_ );
+}
+
+// Assembly
+// ========
+
+template<typename T>
+void DistMultiVec<T>::Reserve( Int numRemoteEntries )
+{ remoteUpdates_.reserve( numRemoteEntries ); }
+
+template<typename T>
+void DistMultiVec<T>::QueueUpdate( Int row, Int col, T value, bool passive )
+{
+    EL_DEBUG_CSE
+    if( IsLocalRow(row) )
+        UpdateLocal( row-FirstLocalRow(), col, value );
+    else if( !passive )
+        remoteUpdates_.push_back( Entry<T>{row,col,value} );
+}
+
+template<typename T>
+void DistMultiVec<T>::QueueUpdate( const Entry<T>& entry, bool passive )
+{ QueueUpdate( entry.i, entry.j, entry.value, passive ); }
+
+template<typename T>
+void DistMultiVec<T>::ProcessQueues()
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = grid_->Comm();
+    const int commSize = grid_->Size();
+
+    // Send the remote updates to the owners of their rows
+    const Int numRemoteUpdates = remoteUpdates_.size();
+    vector<int> sendSizes( commSize, 0 );
+    for( Int s=0; s<numRemoteUpdates; ++s )
+        ++sendSizes[RowOwner(remoteUpdates_[s].i)];
+    vector<int> recvSizes( commSize );
+    mpi::AllToAll( sendSizes.data(), 1, recvSizes.data(), 1, comm );
+    vector<int> sendOffs, recvOffs;
+    const int numSends = Scan( sendSizes, sendOffs );
+    const int numRecvs = Scan( recvSizes, recvOffs );
+
+    vector<Entry<T>> sendBuf( numSends );
+    auto offs = sendOffs;
+    for( Int s=0; s<numRemoteUpdates; ++s )
+    {
+        const Entry<T>& entry = remoteUpdates_[s];
+        sendBuf[offs[RowOwner(entry.i)]++] = entry;
+    }
+    SwapClear( remoteUpdates_ );
+
+    vector<Entry<T>> recvBuf( numRecvs );
+    mpi::AllToAll
+    ( sendBuf.data(), sendSizes.data(), sendOffs.data(),
+      recvBuf.data(), recvSizes.data(), recvOffs.data(), comm );
+
+    const Int firstLocalRow = FirstLocalRow();
+    for( const auto& entry : recvBuf )
+        UpdateLocal( entry.i-firstLocalRow, entry.j, entry.value );
+}
+
+// Queries
+// =======
+
+template<typename T>
+Int DistMultiVec<T>::Height() const EL_NO_EXCEPT { return height_; }
+
+template<typename T>
+Int DistMultiVec<T>::Width() const EL_NO_EXCEPT { return width_; }
+
+template<typename T>
+Int DistMultiVec<T>::FirstLocalRow() const EL_NO_EXCEPT
+{ return blocksize_*grid_->Rank(); }
+
+template<typename T>
+Int DistMultiVec<T>::LocalHeight() const EL_NO_EXCEPT
+{ return multiVec_.Height(); }
+
+template<typename T>
+El::Matrix<T>& DistMultiVec<T>::Matrix() EL_NO_EXCEPT { return multiVec_; }
+
+template<typename T>
+const El::Matrix<T>& DistMultiVec<T>::LockedMatrix() const EL_NO_EXCEPT
+{ return multiVec_; }
+
+template<typename T>
+const El::Grid& DistMultiVec<T>::Grid() const EL_NO_EXCEPT { return *grid_; }
+
+template<typename T>
+Int DistMultiVec<T>::Blocksize() const EL_NO_EXCEPT { return blocksize_; }
+
+template<typename T>
+int DistMultiVec<T>::RowOwner( Int i ) const EL_NO_RELEASE_EXCEPT
+{ return i / blocksize_; }
+
+template<typename T>
+Int DistMultiVec<T>::GlobalRow( Int iLoc ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( iLoc < 0 || iLoc >= LocalHeight() )
+          LogicError("Invalid local row index");
+    )
+    return iLoc + FirstLocalRow();
+}
+
+template<typename T>
+Int DistMultiVec<T>::LocalRow( Int i ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !IsLocalRow(i) )
+          LogicError("Requested local index of non-local row");
+    )
+    return i - FirstLocalRow();
+}
+
+template<typename T>
+bool DistMultiVec<T>::IsLocalRow( Int i ) const EL_NO_RELEASE_EXCEPT
+{
+    const Int firstLocalRow = FirstLocalRow();
+    return i >= firstLocalRow && i < firstLocalRow+LocalHeight();
+}
+
+template<typename T>
+T DistMultiVec<T>::Get( Int row, Int col ) const
+{
+    EL_DEBUG_CSE
+    const int owner = RowOwner( row );
+    T value;
+    if( owner == grid_->Rank() )
+        value = GetLocal( row-FirstLocalRow(), col );
+    mpi::Broadcast( value, owner, grid_->Comm() );
+    return value;
+}
+
+template<typename T>
+void DistMultiVec<T>::Set( Int row, Int col, T value )
+{
+    EL_DEBUG_CSE
+    if( IsLocalRow(row) )
+        SetLocal( row-FirstLocalRow(), col, value );
+}
+
+template<typename T>
+void DistMultiVec<T>::Set( const Entry<T>& entry )
+{ Set( entry.i, entry.j, entry.value ); }
+
+template<typename T>
+void DistMultiVec<T>::Update( Int row, Int col, T value )
+{
+    EL_DEBUG_CSE
+    if( IsLocalRow(row) )
+        UpdateLocal( row-FirstLocalRow(), col, value );
+}
+
+template<typename T>
+void DistMultiVec<T>::Update( const Entry<T>& entry )
+{ Update( entry.i, entry.j, entry.value ); }
+
+template<typename T>
+T DistMultiVec<T>::GetLocal( Int localRow, Int col ) const
+EL_NO_RELEASE_EXCEPT
+{ return multiVec_.Get( localRow, col ); }
+
+template<typename T>
+void DistMultiVec<T>::SetLocal( Int localRow, Int col, T value )
+EL_NO_RELEASE_EXCEPT
+{ multiVec_.Set( localRow, col, value ); }
+
+template<typename T>
+void DistMultiVec<T>::SetLocal( const Entry<T>& localEntry )
+EL_NO_RELEASE_EXCEPT
+{ SetLocal( localEntry.i, localEntry.j, localEntry.value ); }
+
+template<typename T>
+void DistMultiVec<T>::UpdateLocal( Int localRow, Int col, T value )
+EL_NO_RELEASE_EXCEPT
+{ multiVec_.Update( localRow, col, value ); }
+
+template<typename T>
+void DistMultiVec<T>::UpdateLocal( const Entry<T>& localEntry )
+EL_NO_RELEASE_EXCEPT
+{ UpdateLocal( localEntry.i, localEntry.j, localEntry.value ); }
+
+#define PROTO(T) template class DistMultiVec<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,665 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+template<typename T>
+DistSparseMatrix<T>::DistSparseMatrix( const El::Grid& grid )
+: distGraph_(grid)
+{ }
+
+template<typename T>
+DistSparseMatrix<T>::DistSparseMatrix
+( Int height, Int width, const El::Grid& grid )
+: distGraph_(height,width,grid)
+{ }
+
+template<typename T>
+DistSparseMatrix<T>::DistSparseMatrix( const DistSparseMatrix<T>& A )
+: distGraph_(A.Grid())
+{
+    EL_DEBUG_CSE
+    *this = A;
+}
+
+template<typename T>
+DistSparseMatrix<T>::~DistSparseMatrix() { }
+
+// Assignment and reconfiguration
+// ==============================
+
+template<typename T>
+const DistSparseMatrix<T>&
+DistSparseMatrix<T>::operator=( const DistSparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    distGraph_ = A.distGraph_;
+    vals_ = A.vals_;
+    remoteVals_ = A.remoteVals_;
+    markedForZero_ = A.markedForZero_;
+    remoteZeros_ = A.remoteZeros_;
+    multMeta_ = A.multMeta_;
+    return *this;
+}
+
+template<typename T>
+const DistSparseMatrix<T>& DistSparseMatrix<T>::operator*=( T alpha )
+{
+    EL_DEBUG_CSE
+    for( auto& value : vals_ )
+        value *= alpha;
+    return *this;
+}
+
+template<typename T>
+void DistSparseMatrix<T>::Empty( bool freeMemory )
+{
+    distGraph_.Empty( freeMemory );
+    if( freeMemory )
+    {
+        SwapClear( vals_ );
+        SwapClear( remoteVals_ );
+    }
+    else
+    {
+        vals_.resize( 0 );
+        remoteVals_.resize( 0 );
+    }
+    SwapClear( markedForZero_ );
+    SwapClear( remoteZeros_ );
+    multMeta_ = DistSparseMultMeta();
+}
+
+template<typename T>
+void DistSparseMatrix<T>::Resize( Int height, Int width )
+{
+    distGraph_.Resize( height, width );
+    vals_.resize( 0 );
+    remoteVals_.resize( 0 );
+    markedForZero_.resize( 0 );
+    remoteZeros_.resize( 0 );
+    multMeta_.ready = false;
+}
+
+template<typename T>
+void DistSparseMatrix<T>::SetGrid( const El::Grid& grid )
+{
+    EL_DEBUG_CSE
+    if( &distGraph_.Grid() == &grid )
+        return;
+    distGraph_.SetGrid( grid );
+    vals_.resize( 0 );
+    remoteVals_.resize( 0 );
+    markedForZero_.resize( 0 );
+    remoteZeros_.resize( 0 );
+    multMeta_.ready = false;
+}
+
+// Assembly
+// ========
+
+template<typename T>
+void DistSparseMatrix<T>::Reserve( Int numLocalEntries, Int numRemoteEntries )
+{
+    distGraph_.Reserve( numLocalEntries, numRemoteEntries );
+    vals_.reserve( numLocalEntries );
+    remoteVals_.reserve( numRemoteEntries );
+}
+
+template<typename T>
+void DistSparseMatrix<T>::Update( Int row, Int col, T value )
+{
+    EL_DEBUG_CSE
+    QueueUpdate( row, col, value );
+    ProcessQueues();
+}
+
+template<typename T>
+void DistSparseMatrix<T>::UpdateLocal( Int localRow, Int col, T value )
+{
+    EL_DEBUG_CSE
+    QueueLocalUpdate( localRow, col, value );
+    ProcessLocalQueues();
+}
+
+template<typename T>
+void DistSparseMatrix<T>::Zero( Int row, Int col )
+{
+    EL_DEBUG_CSE
+    QueueZero( row, col );
+    ProcessQueues();
+}
+
+template<typename T>
+void DistSparseMatrix<T>::ZeroLocal( Int localRow, Int col )
+{
+    EL_DEBUG_CSE
+    QueueLocalZero( localRow, col );
+    ProcessLocalQueues();
+}
+
+template<typename T>
+void DistSparseMatrix<T>::QueueUpdate( Int row, Int col, T value, bool passive )
+{
+    EL_DEBUG_CSE
+    if( IsLocalRow(row) )
+        QueueLocalUpdate( row-FirstLocalRow(), col, value );
+    else if( !passive )
+    {
+        distGraph_.remoteSources_.push_back( row );
+        distGraph_.remoteTargets_.push_back( col );
+        remoteVals_.push_back( value );
+    }
+}
+
+template<typename T>
+void DistSparseMatrix<T>::QueueUpdate( const Entry<T>& entry, bool passive )
+{ QueueUpdate( entry.i, entry.j, entry.value, passive ); }
+
+template<typename T>
+void DistSparseMatrix<T>::QueueLocalUpdate( Int localRow, Int col, T value )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    distGraph_.QueueLocalConnection( localRow, col );
+    vals_.push_back( value );
+}
+
+template<typename T>
+void DistSparseMatrix<T>::QueueZero( Int row, Int col, bool passive )
+{
+    EL_DEBUG_CSE
+    if( IsLocalRow(row) )
+        QueueLocalZero( row-FirstLocalRow(), col );
+    else if( !passive )
+        remoteZeros_.emplace_back( row, col );
+}
+
+template<typename T>
+void DistSparseMatrix<T>::QueueLocalZero( Int localRow, Int col )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    markedForZero_.emplace_back( GlobalRow(localRow), col );
+    distGraph_.locallyConsistent_ = false;
+}
+
+template<typename T>
+void DistSparseMatrix<T>::ProcessQueues()
+{
+    EL_DEBUG_CSE
+    const El::Grid& grid = Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+
+    // Send the remote updates and zeros to the owners of their rows, with
+    // the updates for each process preceding its zeros
+    const Int numRemoteUpdates = remoteVals_.size();
+    const Int numRemoteZeros = remoteZeros_.size();
+    vector<int> sendCounts( 2*commSize, 0 );
+    for( Int s=0; s<numRemoteUpdates; ++s )
+        ++sendCounts[2*RowOwner(distGraph_.remoteSources_[s])];
+    for( Int s=0; s<numRemoteZeros; ++s )
+        ++sendCounts[2*RowOwner(remoteZeros_[s].first)+1];
+    vector<int> recvCounts( 2*commSize );
+    mpi::AllToAll( sendCounts.data(), 2, recvCounts.data(), 2, comm );
+
+    vector<int> sendSizes( commSize ), recvSizes( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        sendSizes[q] = sendCounts[2*q] + sendCounts[2*q+1];
+        recvSizes[q] = recvCounts[2*q] + recvCounts[2*q+1];
+    }
+    vector<int> sendOffs, recvOffs;
+    const int numSends = Scan( sendSizes, sendOffs );
+    const int numRecvs = Scan( recvSizes, recvOffs );
+
+    vector<Int> sendRows( numSends ), sendCols( numSends );
+    vector<T> sendVals( numSends );
+    auto offs = sendOffs;
+    for( Int s=0; s<numRemoteUpdates; ++s )
+    {
+        const int q = RowOwner(distGraph_.remoteSources_[s]);
+        sendRows[offs[q]] = distGraph_.remoteSources_[s];
+        sendCols[offs[q]] = distGraph_.remoteTargets_[s];
+        sendVals[offs[q]] = remoteVals_[s];
+        ++offs[q];
+    }
+    for( Int s=0; s<numRemoteZeros; ++s )
+    {
+        const int q = RowOwner(remoteZeros_[s].first);
+        sendRows[offs[q]] = remoteZeros_[s].first;
+        sendCols[offs[q]] = remoteZeros_[s].second;
+        sendVals[offs[q]] = T(0);
+        ++offs[q];
+    }
+    SwapClear( distGraph_.remoteSources_ );
+    SwapClear( distGraph_.remoteTargets_ );
+    SwapClear( remoteVals_ );
+    SwapClear( remoteZeros_ );
+
+    vector<Int> recvRows( numRecvs ), recvCols( numRecvs );
+    vector<T> recvVals( numRecvs );
+    mpi::AllToAll
+    ( sendRows.data(), sendSizes.data(), sendOffs.data(),
+      recvRows.data(), recvSizes.data(), recvOffs.data(), comm );
+    mpi::AllToAll
+    ( sendCols.data(), sendSizes.data(), sendOffs.data(),
+      recvCols.data(), recvSizes.data(), recvOffs.data(), comm );
+    mpi::AllToAll
+    ( sendVals.data(), sendSizes.data(), sendOffs.data(),
+      recvVals.data(), recvSizes.data(), recvOffs.data(), comm );
+
+    const Int firstLocalRow = FirstLocalRow();
+    for( int q=0; q<commSize; ++q )
+    {
+        const int numUpdates = recvCounts[2*q];
+        const int numZeros = recvCounts[2*q+1];
+        const int off = recvOffs[q];
+        for( int s=0; s<numUpdates; ++s )
+            QueueLocalUpdate
+            ( recvRows[off+s]-firstLocalRow, recvCols[off+s], recvVals[off+s] );
+        for( int s=numUpdates; s<numUpdates+numZeros; ++s )
+            QueueLocalZero( recvRows[off+s]-firstLocalRow, recvCols[off+s] );
+    }
+
+    ProcessLocalQueues();
+}
+
+template<typename T>
+void DistSparseMatrix<T>::ProcessLocalQueues()
+{
+    EL_DEBUG_CSE
+    if( distGraph_.locallyConsistent_ )
+        return;
+    multMeta_.ready = false;
+
+    const Int numQueued = vals_.size();
+    const Int* sourceBuf = distGraph_.sources_.data();
+    const Int* targetBuf = distGraph_.targets_.data();
+
+    // Entries which were queued in strictly increasing order (e.g., by the
+    // generators which fill whole rows in place) need not be sorted or summed
+    if( markedForZero_.empty() )
+    {
+        Int e=1;
+        for( ; e<numQueued; ++e )
+            if( sourceBuf[e-1] > sourceBuf[e] ||
+                (sourceBuf[e-1] == sourceBuf[e] &&
+                 targetBuf[e-1] >= targetBuf[e]) )
+                break;
+        if( e >= numQueued )
+        {
+            distGraph_.ComputeSourceOffsets();
+            distGraph_.locallyConsistent_ = true;
+            return;
+        }
+    }
+
+    // Sort the queued entries by their coordinates
+    vector<Int> perm( numQueued );
+    for( Int e=0; e<numQueued; ++e )
+        perm[e] = e;
+    std::stable_sort
+    ( perm.begin(), perm.end(),
+      [&]( Int e, Int f )
+      { return sourceBuf[e] < sourceBuf[f] ||
+               (sourceBuf[e] == sourceBuf[f] && targetBuf[e] < targetBuf[f]); } );
+
+    // Sum the duplicates and drop the entries marked for zeroing
+    std::sort( markedForZero_.begin(), markedForZero_.end() );
+    vector<Int> sources, targets;
+    vector<T> vals;
+    sources.reserve( numQueued );
+    targets.reserve( numQueued );
+    vals.reserve( numQueued );
+    for( Int k=0; k<numQueued; ++k )
+    {
+        const Int e = perm[k];
+        const Int i = sourceBuf[e];
+        const Int j = targetBuf[e];
+        if( !sources.empty() && sources.back() == i && targets.back() == j )
+        {
+            vals.back() += vals_[e];
+            continue;
+        }
+        if( std::binary_search
+            ( markedForZero_.begin(), markedForZero_.end(),
+              pair<Int,Int>(i,j) ) )
+            continue;
+        sources.push_back( i );
+        targets.push_back( j );
+        vals.push_back( vals_[e] );
+    }
+    SwapClear( markedForZero_ );
+
+    distGraph_.sources_.swap( sources );
+    distGraph_.targets_.swap( targets );
+    vals_.swap( vals );
+    distGraph_.ComputeSourceOffsets();
+    distGraph_.locallyConsistent_ = true;
+}
+
+// Queries
+// =======
+
+template<typename T>
+Int DistSparseMatrix<T>::Height() const EL_NO_EXCEPT
+{ return distGraph_.NumSources(); }
+
+template<typename T>
+Int DistSparseMatrix<T>::Width() const EL_NO_EXCEPT
+{ return distGraph_.NumTargets(); }
+
+template<typename T>
+Int DistSparseMatrix<T>::FirstLocalRow() const EL_NO_EXCEPT
+{ return distGraph_.FirstLocalSource(); }
+
+template<typename T>
+Int DistSparseMatrix<T>::LocalHeight() const EL_NO_EXCEPT
+{ return distGraph_.NumLocalSources(); }
+
+template<typename T>
+Int DistSparseMatrix<T>::NumLocalEntries() const EL_NO_EXCEPT
+{ return vals_.size(); }
+
+template<typename T>
+Int DistSparseMatrix<T>::Capacity() const EL_NO_EXCEPT
+{ return Min( distGraph_.Capacity(), Int(vals_.capacity()) ); }
+
+template<typename T>
+bool DistSparseMatrix<T>::LocallyConsistent() const EL_NO_EXCEPT
+{ return distGraph_.LocallyConsistent(); }
+
+template<typename T>
+El::DistGraph& DistSparseMatrix<T>::DistGraph() EL_NO_EXCEPT
+{
+    multMeta_.ready = false;
+    return distGraph_;
+}
+
+template<typename T>
+const El::DistGraph& DistSparseMatrix<T>::LockedDistGraph() const EL_NO_EXCEPT
+{ return distGraph_; }
+
+template<typename T>
+const El::Grid& DistSparseMatrix<T>::Grid() const EL_NO_EXCEPT
+{ return distGraph_.Grid(); }
+
+template<typename T>
+Int DistSparseMatrix<T>::Blocksize() const EL_NO_EXCEPT
+{ return distGraph_.Blocksize(); }
+
+template<typename T>
+int DistSparseMatrix<T>::RowOwner( Int i ) const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.SourceOwner( i ); }
+
+template<typename T>
+Int DistSparseMatrix<T>::GlobalRow( Int iLoc ) const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.GlobalSource( iLoc ); }
+
+template<typename T>
+Int DistSparseMatrix<T>::LocalRow( Int i ) const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.LocalSource( i ); }
+
+template<typename T>
+bool DistSparseMatrix<T>::IsLocalRow( Int i ) const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.IsLocalSource( i ); }
+
+template<typename T>
+Int DistSparseMatrix<T>::Row( Int localIndex ) const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.Source( localIndex ); }
+
+template<typename T>
+Int DistSparseMatrix<T>::Col( Int localIndex ) const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.Target( localIndex ); }
+
+template<typename T>
+T DistSparseMatrix<T>::Value( Int localIndex ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( localIndex < 0 || localIndex >= Int(vals_.size()) )
+          LogicError("Entry number out of bounds");
+    )
+    return vals_[localIndex];
+}
+
+template<typename T>
+Int DistSparseMatrix<T>::RowOffset( Int localRow ) const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.SourceOffset( localRow ); }
+
+template<typename T>
+Int DistSparseMatrix<T>::Offset( Int localRow, Int col )
+const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.Offset( localRow, col ); }
+
+template<typename T>
+Int DistSparseMatrix<T>::NumConnections( Int localRow )
+const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.NumConnections( localRow ); }
+
+template<typename T>
+Int* DistSparseMatrix<T>::SourceBuffer() EL_NO_EXCEPT
+{
+    multMeta_.ready = false;
+    return distGraph_.SourceBuffer();
+}
+template<typename T>
+Int* DistSparseMatrix<T>::TargetBuffer() EL_NO_EXCEPT
+{
+    multMeta_.ready = false;
+    return distGraph_.TargetBuffer();
+}
+template<typename T>
+Int* DistSparseMatrix<T>::OffsetBuffer() EL_NO_EXCEPT
+{
+    multMeta_.ready = false;
+    return distGraph_.OffsetBuffer();
+}
+template<typename T>
+T* DistSparseMatrix<T>::ValueBuffer() EL_NO_EXCEPT { return vals_.data(); }
+
+template<typename T>
+const Int* DistSparseMatrix<T>::LockedSourceBuffer() const EL_NO_EXCEPT
+{ return distGraph_.LockedSourceBuffer(); }
+template<typename T>
+const Int* DistSparseMatrix<T>::LockedTargetBuffer() const EL_NO_EXCEPT
+{ return distGraph_.LockedTargetBuffer(); }
+template<typename T>
+const Int* DistSparseMatrix<T>::LockedOffsetBuffer() const EL_NO_EXCEPT
+{ return distGraph_.LockedOffsetBuffer(); }
+template<typename T>
+const T* DistSparseMatrix<T>::LockedValueBuffer() const EL_NO_EXCEPT
+{ return vals_.data(); }
+
+template<typename T>
+void DistSparseMatrix<T>::ForceNumLocalEntries( Int numLocalEntries )
+{
+    EL_DEBUG_CSE
+    distGraph_.ForceNumLocalEdges( numLocalEntries );
+    vals_.resize( numLocalEntries );
+    multMeta_.ready = false;
+}
+
+template<typename T>
+void DistSparseMatrix<T>::ForceConsistency( bool consistent ) EL_NO_EXCEPT
+{
+    distGraph_.ForceConsistency( consistent );
+    multMeta_.ready = false;
+}
+
+template<typename T>
+void DistSparseMatrix<T>::AssertLocallyConsistent() const
+{ distGraph_.AssertLocallyConsistent(); }
+
+template<typename T>
+void DistSparseMatrix<T>::MappedSources
+( const DistMap& reordering, vector<Int>& mappedSources ) const
+{
+    EL_DEBUG_CSE
+    const Int localHeight = LocalHeight();
+    if( Int(mappedSources.size()) == localHeight )
+        return;
+
+    mappedSources.resize( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        mappedSources[iLoc] = GlobalRow(iLoc);
+    reordering.Translate( mappedSources );
+}
+
+template<typename T>
+void DistSparseMatrix<T>::MappedTargets
+( const DistMap& reordering,
+  vector<Int>& mappedTargets,
+  vector<Int>& colOffs ) const
+{
+    EL_DEBUG_CSE
+    const Int numLocalEntries = NumLocalEntries();
+    if( Int(colOffs.size()) == numLocalEntries )
+        return;
+
+    // Map each unique column only once
+    const Int* colBuf = LockedTargetBuffer();
+    mappedTargets.assign( colBuf, colBuf+numLocalEntries );
+    std::sort( mappedTargets.begin(), mappedTargets.end() );
+    mappedTargets.erase
+    ( std::unique( mappedTargets.begin(), mappedTargets.end() ),
+      mappedTargets.end() );
+
+    colOffs.resize( numLocalEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+        colOffs[e] = Find( mappedTargets, colBuf[e] );
+    reordering.Translate( mappedTargets );
+}
+
+template<typename T>
+const DistSparseMultMeta& DistSparseMatrix<T>::InitializeMultMeta() const
+{
+    EL_DEBUG_CSE
+    const El::Grid& grid = Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+    const int commRank = grid.Rank();
+
+    // Every process takes part in building the plan, so it is rebuilt
+    // everywhere if any process invalidated its copy
+    if( mpi::AllReduce( int(multMeta_.ready), mpi::MIN, comm ) )
+        return multMeta_;
+    AssertLocallyConsistent();
+
+    // The columns follow the distribution of the rows of a DistMultiVec
+    // whose height is the width of this matrix
+    const Int width = Width();
+    Int blocksize = width / commSize;
+    if( blocksize*commSize < width || width == 0 )
+        ++blocksize;
+    const Int firstLocalCol = blocksize*commRank;
+    const Int numLocalCols =
+      Min( blocksize, Max(width-firstLocalCol,Int(0)) );
+
+    const Int numLocalEntries = NumLocalEntries();
+    const Int* colBuf = LockedTargetBuffer();
+    auto isLocalCol =
+      [&]( Int j )
+      { return j >= firstLocalCol && j < firstLocalCol+numLocalCols; };
+
+    DistSparseMultMeta meta;
+    meta.numLocalCols = numLocalCols;
+
+    // Since the ghosts are sorted, they are packed by owner
+    vector<Int> ghosts;
+    for( Int e=0; e<numLocalEntries; ++e )
+        if( !isLocalCol(colBuf[e]) )
+            ghosts.push_back( colBuf[e] );
+    std::sort( ghosts.begin(), ghosts.end() );
+    ghosts.erase( std::unique( ghosts.begin(), ghosts.end() ), ghosts.end() );
+    meta.numGhosts = ghosts.size();
+
+    meta.colOffs.resize( numLocalEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int j = colBuf[e];
+        meta.colOffs[e] =
+          ( isLocalCol(j) ? j-firstLocalCol : numLocalCols+Find(ghosts,j) );
+    }
+
+    const Int localHeight = LocalHeight();
+    const Int* offBuf = LockedOffsetBuffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        bool interior = true;
+        for( Int e=offBuf[iLoc]; e<offBuf[iLoc+1]; ++e )
+        {
+            if( meta.colOffs[e] >= numLocalCols )
+            {
+                interior = false;
+                break;
+            }
+        }
+        if( interior )
+            meta.interiorRows.push_back( iLoc );
+        else
+            meta.boundaryRows.push_back( iLoc );
+    }
+
+    // Tell the owners which of their rows we need
+    vector<int> ghostSizes( commSize, 0 );
+    for( Int g=0; g<meta.numGhosts; ++g )
+        ++ghostSizes[ghosts[g]/blocksize];
+    vector<int> haloSizes( commSize );
+    mpi::AllToAll( ghostSizes.data(), 1, haloSizes.data(), 1, comm );
+    vector<int> ghostOffs, haloOffs;
+    Scan( ghostSizes, ghostOffs );
+    const Int numHalo = Scan( haloSizes, haloOffs );
+    meta.haloInds.resize( numHalo );
+    mpi::AllToAll
+    ( ghosts.data(), ghostSizes.data(), ghostOffs.data(),
+      meta.haloInds.data(), haloSizes.data(), haloOffs.data(), comm );
+    for( auto& ind : meta.haloInds )
+        ind -= firstLocalCol;
+
+    // Only keep the processes which we actually exchange with
+    for( int q=0; q<commSize; ++q )
+    {
+        if( ghostSizes[q] > 0 )
+        {
+            meta.ghostProcs.push_back( q );
+            meta.ghostSizes.push_back( ghostSizes[q] );
+            meta.ghostOffs.push_back( ghostOffs[q] );
+        }
+        if( haloSizes[q] > 0 )
+        {
+            meta.haloProcs.push_back( q );
+            meta.haloSizes.push_back( haloSizes[q] );
+            meta.haloOffs.push_back( haloOffs[q] );
+        }
+    }
+
+    meta.ready = true;
+    multMeta_ = std::move( meta );
+    return multMeta_;
+}
+
+#define PROTO(T) template class DistSparseMatrix<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
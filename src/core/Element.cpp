@@ -49,6 +49,12 @@ string TypeName<float>()
 template<>
 string TypeName<double>()
 { return string("double"); }
+template<>
+string TypeName<Half>()
+{ return string("Half"); }
+template<>
+string TypeName<BFloat16>()
+{ return string("BFloat16"); }
 #ifdef HYDROGEN_HAVE_QD
 template<>
 string TypeName<DoubleDouble>()
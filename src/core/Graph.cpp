@@ -0,0 +1,319 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+Graph::Graph() : sourceOffsets_(1,0) { }
+
+Graph::Graph( Int numSources )
+: Graph( numSources, numSources )
+{ }
+
+Graph::Graph( Int numSources, Int numTargets )
+: numSources_(numSources), numTargets_(numTargets),
+  sourceOffsets_(numSources+1,0)
+{ }
+
+Graph::Graph( const Graph& graph )
+{
+    EL_DEBUG_CSE
+    *this = graph;
+}
+
+Graph::Graph( const DistGraph& graph )
+{
+    EL_DEBUG_CSE
+    *this = graph;
+}
+
+Graph::~Graph() { }
+
+// Assignment
+// ==========
+
+const Graph& Graph::operator=( const Graph& graph )
+{
+    EL_DEBUG_CSE
+    numSources_ = graph.numSources_;
+    numTargets_ = graph.numTargets_;
+    sources_ = graph.sources_;
+    targets_ = graph.targets_;
+    sourceOffsets_ = graph.sourceOffsets_;
+    markedForRemoval_ = graph.markedForRemoval_;
+    consistent_ = graph.consistent_;
+    return *this;
+}
+
+const Graph& Graph::operator=( const DistGraph& graph )
+{
+    EL_DEBUG_CSE
+    graph.AssertLocallyConsistent();
+    const El::Grid& grid = graph.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+
+    // Every process receives a copy of each edge
+    const int numLocalEdges = graph.NumLocalEdges();
+    vector<int> edgeSizes(commSize), edgeOffs;
+    mpi::AllGather( &numLocalEdges, 1, edgeSizes.data(), 1, comm );
+    const int numEdges = Scan( edgeSizes, edgeOffs );
+
+    Resize( graph.NumSources(), graph.NumTargets() );
+    sources_.resize( numEdges );
+    targets_.resize( numEdges );
+    mpi::AllGather
+    ( graph.LockedSourceBuffer(), numLocalEdges,
+      sources_.data(), edgeSizes.data(), edgeOffs.data(), comm );
+    mpi::AllGather
+    ( graph.LockedTargetBuffer(), numLocalEdges,
+      targets_.data(), edgeSizes.data(), edgeOffs.data(), comm );
+
+    // The processes own contiguous, increasing sets of sources
+    ComputeSourceOffsets();
+    return *this;
+}
+
+// Changing the graph size
+// =======================
+
+void Graph::Empty( bool freeMemory )
+{
+    numSources_ = 0;
+    numTargets_ = 0;
+    if( freeMemory )
+    {
+        SwapClear( sources_ );
+        SwapClear( targets_ );
+        SwapClear( markedForRemoval_ );
+    }
+    else
+    {
+        sources_.resize( 0 );
+        targets_.resize( 0 );
+        markedForRemoval_.resize( 0 );
+    }
+    sourceOffsets_.assign( 1, 0 );
+    consistent_ = true;
+}
+
+void Graph::Resize( Int numVertices ) { Resize( numVertices, numVertices ); }
+
+void Graph::Resize( Int numSources, Int numTargets )
+{
+    numSources_ = numSources;
+    numTargets_ = numTargets;
+    sources_.resize( 0 );
+    targets_.resize( 0 );
+    markedForRemoval_.resize( 0 );
+    sourceOffsets_.assign( numSources+1, 0 );
+    consistent_ = true;
+}
+
+// Assembly
+// ========
+
+void Graph::Reserve( Int numEdges )
+{
+    sources_.reserve( numEdges );
+    targets_.reserve( numEdges );
+}
+
+void Graph::Connect( Int source, Int target )
+{
+    EL_DEBUG_CSE
+    QueueConnection( source, target );
+    ProcessQueues();
+}
+
+void Graph::Disconnect( Int source, Int target )
+{
+    EL_DEBUG_CSE
+    QueueDisconnection( source, target );
+    ProcessQueues();
+}
+
+void Graph::QueueConnection( Int source, Int target )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( source < 0 || source >= numSources_ )
+          LogicError
+          ("Source was out of bounds: ",source," is not in [0,",
+           numSources_,")");
+      if( target < 0 || target >= numTargets_ )
+          LogicError
+          ("Target was out of bounds: ",target," is not in [0,",
+           numTargets_,")");
+    )
+    sources_.push_back( source );
+    targets_.push_back( target );
+    consistent_ = false;
+}
+
+void Graph::QueueDisconnection( Int source, Int target )
+{
+    EL_DEBUG_CSE
+    markedForRemoval_.emplace_back( source, target );
+    consistent_ = false;
+}
+
+void Graph::ProcessQueues()
+{
+    EL_DEBUG_CSE
+    if( consistent_ )
+        return;
+
+    const Int numQueued = sources_.size();
+    vector<pair<Int,Int>> edges( numQueued );
+    for( Int e=0; e<numQueued; ++e )
+        edges[e] = pair<Int,Int>( sources_[e], targets_[e] );
+    std::sort( edges.begin(), edges.end() );
+    edges.erase( std::unique( edges.begin(), edges.end() ), edges.end() );
+
+    if( !markedForRemoval_.empty() )
+    {
+        std::sort( markedForRemoval_.begin(), markedForRemoval_.end() );
+        edges.erase
+        ( std::remove_if
+          ( edges.begin(), edges.end(),
+            [&]( const pair<Int,Int>& edge )
+            { return std::binary_search
+                     ( markedForRemoval_.begin(), markedForRemoval_.end(),
+                       edge ); } ),
+          edges.end() );
+        SwapClear( markedForRemoval_ );
+    }
+
+    const Int numEdges = edges.size();
+    sources_.resize( numEdges );
+    targets_.resize( numEdges );
+    for( Int e=0; e<numEdges; ++e )
+    {
+        sources_[e] = edges[e].first;
+        targets_[e] = edges[e].second;
+    }
+    ComputeSourceOffsets();
+    consistent_ = true;
+}
+
+// High-level information
+// ======================
+
+Int Graph::NumSources() const EL_NO_EXCEPT { return numSources_; }
+Int Graph::NumTargets() const EL_NO_EXCEPT { return numTargets_; }
+Int Graph::NumEdges() const EL_NO_EXCEPT { return targets_.size(); }
+
+Int Graph::Capacity() const EL_NO_EXCEPT
+{ return Min( sources_.capacity(), targets_.capacity() ); }
+
+bool Graph::Consistent() const EL_NO_EXCEPT { return consistent_; }
+
+// Edge information
+// ================
+
+Int Graph::Source( Int edge ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( edge < 0 || edge >= Int(sources_.size()) )
+          LogicError("Edge number out of bounds");
+    )
+    return sources_[edge];
+}
+
+Int Graph::Target( Int edge ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( edge < 0 || edge >= Int(targets_.size()) )
+          LogicError("Edge number out of bounds");
+    )
+    return targets_[edge];
+}
+
+Int Graph::SourceOffset( Int source ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( source < 0 || source > numSources_ )
+          LogicError("Source was out of bounds");
+      AssertConsistent();
+    )
+    return sourceOffsets_[source];
+}
+
+Int Graph::Offset( Int source, Int target ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int* targetBuf = targets_.data();
+    const Int thisOff = SourceOffset(source);
+    const Int nextOff = SourceOffset(source+1);
+    return std::lower_bound
+           ( targetBuf+thisOff, targetBuf+nextOff, target ) - targetBuf;
+}
+
+Int Graph::NumConnections( Int source ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    return SourceOffset(source+1) - SourceOffset(source);
+}
+
+bool Graph::EdgeExists( Int source, Int target ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int off = Offset( source, target );
+    return off < SourceOffset(source+1) && targets_[off] == target;
+}
+
+Int* Graph::SourceBuffer() EL_NO_EXCEPT { return sources_.data(); }
+Int* Graph::TargetBuffer() EL_NO_EXCEPT { return targets_.data(); }
+Int* Graph::OffsetBuffer() EL_NO_EXCEPT { return sourceOffsets_.data(); }
+
+const Int* Graph::LockedSourceBuffer() const EL_NO_EXCEPT
+{ return sources_.data(); }
+const Int* Graph::LockedTargetBuffer() const EL_NO_EXCEPT
+{ return targets_.data(); }
+const Int* Graph::LockedOffsetBuffer() const EL_NO_EXCEPT
+{ return sourceOffsets_.data(); }
+
+void Graph::ForceNumEdges( Int numEdges )
+{
+    EL_DEBUG_CSE
+    sources_.resize( numEdges );
+    targets_.resize( numEdges );
+    consistent_ = false;
+}
+
+void Graph::ForceConsistency( bool consistent ) EL_NO_EXCEPT
+{ consistent_ = consistent; }
+
+void Graph::AssertConsistent() const
+{
+    if( !consistent_ )
+        LogicError("Graph was not consistent; run ProcessQueues()");
+}
+
+void Graph::ComputeSourceOffsets()
+{
+    EL_DEBUG_CSE
+    const Int numEdges = sources_.size();
+    sourceOffsets_.assign( numSources_+1, 0 );
+    for( Int e=0; e<numEdges; ++e )
+        ++sourceOffsets_[sources_[e]+1];
+    for( Int s=0; s<numSources_; ++s )
+        sourceOffsets_[s+1] += sourceOffsets_[s];
+}
+
+} // namespace El
@@ -8,62 +8,99 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <map>
+#include <mutex>
 
 namespace El {
 
-Grid* Grid::defaultGrid = 0;
-Grid* Grid::trivialGrid = 0;
+std::atomic<Grid*> Grid::defaultGrid(nullptr);
+std::atomic<Grid*> Grid::trivialGrid(nullptr);
+int Grid::hierarchicalThreshold = 4;
+
+namespace {
+std::mutex gridMutex;
+}
 
 void Grid::InitializeDefault()
 {
     EL_DEBUG_CSE
-    defaultGrid = new Grid( mpi::COMM_WORLD );
+    std::lock_guard<std::mutex> lock( gridMutex );
+    if( defaultGrid.load() == nullptr )
+        defaultGrid.store( new Grid( mpi::COMM_WORLD ) );
 }
 
 void Grid::InitializeTrivial()
 {
     EL_DEBUG_CSE
-    trivialGrid = new Grid( mpi::COMM_SELF );
+    std::lock_guard<std::mutex> lock( gridMutex );
+    if( trivialGrid.load() == nullptr )
+        trivialGrid.store( new Grid( mpi::COMM_SELF ) );
 }
 
 void Grid::FinalizeDefault()
 {
     EL_DEBUG_CSE
-    delete defaultGrid;
-    defaultGrid = 0;
+    std::lock_guard<std::mutex> lock( gridMutex );
+    delete defaultGrid.exchange( nullptr );
 }
 
 void Grid::FinalizeTrivial()
 {
     EL_DEBUG_CSE
-    delete trivialGrid;
-    trivialGrid = 0;
+    std::lock_guard<std::mutex> lock( gridMutex );
+    delete trivialGrid.exchange( nullptr );
 }
 
+bool Grid::HaveDefault() EL_NO_EXCEPT
+{ return defaultGrid.load() != nullptr; }
+
+bool Grid::HaveTrivial() EL_NO_EXCEPT
+{ return trivialGrid.load() != nullptr; }
+
 const Grid& Grid::Default() EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      if( defaultGrid == 0 )
-          LogicError
-          ("Attempted to return a non-existant default grid. Please ensure "
-           "that Elemental is initialized before creating a DistMatrix.");
-    )
-    return *defaultGrid;
+    Grid* grid = defaultGrid.load( std::memory_order_acquire );
+    if( grid == nullptr )
+    {
+        EL_DEBUG_ONLY(
+          if( !Initialized() )
+              LogicError
+              ("Attempted to return a non-existant default grid. Please "
+               "ensure that Elemental is initialized before creating a "
+               "DistMatrix.");
+        )
+        InitializeDefault();
+        grid = defaultGrid.load();
+    }
+    return *grid;
 }
 
 const Grid& Grid::Trivial() EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      if( trivialGrid == 0 )
-          LogicError
-          ("Attempted to return a non-existant trivial grid. Please ensure "
-           "that Elemental is initialized before creating a DistMatrix.");
-    )
-    return *trivialGrid;
+    Grid* grid = trivialGrid.load( std::memory_order_acquire );
+    if( grid == nullptr )
+    {
+        EL_DEBUG_ONLY(
+          if( !Initialized() )
+              LogicError
+              ("Attempted to return a non-existant trivial grid. Please "
+               "ensure that Elemental is initialized before creating a "
+               "DistMatrix.");
+        )
+        InitializeTrivial();
+        grid = trivialGrid.load();
+    }
+    return *grid;
 }
 
+void Grid::SetHierarchicalThreshold( int numNodes ) EL_NO_EXCEPT
+{ hierarchicalThreshold = numNodes; }
+
+int Grid::HierarchicalThreshold() EL_NO_EXCEPT
+{ return hierarchicalThreshold; }
+
 int Grid::DefaultHeight( int gridSize ) EL_NO_EXCEPT
 {
     int gridHeight = int(sqrt(double(gridSize)));
@@ -72,6 +109,38 @@ int Grid::DefaultHeight( int gridSize ) EL_NO_EXCEPT
     return gridHeight;
 }
 
+int Grid::TopologyAwareHeight
+( int gridSize, int procsPerNode, GridOrder order, double intraNodeRatio )
+EL_NO_EXCEPT
+{
+    int bestHeight = 1;
+    double bestCost = std::numeric_limits<double>::max();
+    for( int height=1; height<=gridSize; ++height )
+    {
+        if( gridSize % height != 0 )
+            continue;
+        const int width = gridSize / height;
+
+        // The number of consecutive ranks spanned by each communicator
+        const int mcSpan = ( order==COLUMN_MAJOR ? height : gridSize );
+        const int mrSpan = ( order==COLUMN_MAJOR ? gridSize : width );
+
+        double mcCost = 1./width;
+        double mrCost = 1./height;
+        if( procsPerNode % mcSpan == 0 )
+            mcCost *= intraNodeRatio;
+        if( procsPerNode % mrSpan == 0 )
+            mrCost *= intraNodeRatio;
+        const double cost = mcCost + mrCost;
+        if( cost < bestCost )
+        {
+            bestHeight = height;
+            bestCost = cost;
+        }
+    }
+    return bestHeight;
+}
+
 Grid::Grid( mpi::Comm comm, GridOrder order )
 : haveViewers_(false), order_(order)
 {
@@ -110,6 +179,55 @@ Grid::Grid( mpi::Comm comm, int height, GridOrder order )
     SetUpGrid();
 }
 
+Grid::Grid
+( mpi::Comm comm, const GridTopologyCtrl& ctrl, GridOrder order )
+: haveViewers_(false), order_(order)
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Identify each node by the smallest rank of 'comm' which it contains
+    mpi::Comm nodeComm;
+    mpi::SplitShared( comm, commRank, nodeComm );
+    const int nodeRank = mpi::Rank( nodeComm );
+    const int nodeLeader = mpi::AllReduce( commRank, mpi::MIN, nodeComm );
+    mpi::Free( nodeComm );
+    vector<int> leaders( commSize );
+    mpi::AllGather( &nodeLeader, 1, leaders.data(), 1, comm );
+
+    // Order the processes by node, and then by their rank within 'comm',
+    // and find the largest number of processes dividing that of every node
+    int key = nodeRank;
+    std::map<int,int> nodeSizes;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( leaders[q] < nodeLeader )
+            ++key;
+        ++nodeSizes[leaders[q]];
+    }
+    int procsPerNode = 0;
+    for( const auto& entry : nodeSizes )
+        procsPerNode = El::GCD( procsPerNode, entry.second );
+
+    // Extract our rank, the underlying group, and the number of processes
+    mpi::Split( comm, 0, key, viewingComm_ );
+    mpi::CommGroup( viewingComm_, viewingGroup_ );
+    size_ = mpi::Size( viewingComm_ );
+
+    // All processes own the grid, so we have to trivially split viewingGroup_
+    owningGroup_ = viewingGroup_;
+
+    if( ctrl.height < 0 )
+        LogicError("Process grid dimensions must be non-negative");
+    height_ =
+      ( ctrl.height == 0 ?
+        TopologyAwareHeight( size_, procsPerNode, order, ctrl.intraNodeRatio ) :
+        ctrl.height );
+
+    SetUpGrid();
+}
+
 void Grid::SetUpGrid()
 {
     EL_DEBUG_CSE
@@ -126,6 +244,7 @@ void Grid::SetUpGrid()
 
     // Create the communicator for the owning group (mpi::COMM_NULL otherwise)
     mpi::Create( viewingComm_, owningGroup_, owningComm_ );
+    mpi::SetName( viewingComm_, "Viewing" );
 
     vcToViewing_.resize(size_);
     diagsAndRanks_.resize(2*size_);
@@ -202,6 +321,37 @@ void Grid::SetUpGrid()
         mpi::Split( cartComm_, mdPerpRank_, mdRank_,     mdComm_     );
         mpi::Split( cartComm_, mdRank_,     mdPerpRank_, mdPerpComm_ );
 
+        // Group the processes by node, identifying each node by its smallest
+        // VC rank
+        mpi::SplitShared( vcComm_, vcRank_, nodeComm_ );
+        nodeRank_ = mpi::Rank( nodeComm_ );
+        mpi::Split
+        ( vcComm_, ( nodeRank_ == 0 ? 0 : mpi::UNDEFINED ), vcRank_,
+          nodeLeaderComm_ );
+        const int nodeLeader = mpi::AllReduce( vcRank_, mpi::MIN, nodeComm_ );
+        vector<int> nodeLeaders(size_);
+        mpi::AllGather( &nodeLeader, 1, nodeLeaders.data(), 1, vcComm_ );
+        vector<int> leaderToNode(size_,-1);
+        nodeOffsets_.assign( 1, 0 );
+        vcToNode_.resize( size_ );
+        nodeSlots_.resize( size_ );
+        vector<int> nodeSizes;
+        for( int q=0; q<size_; ++q )
+        {
+            int& node = leaderToNode[nodeLeaders[q]];
+            if( node < 0 )
+            {
+                node = nodeSizes.size();
+                nodeSizes.push_back( 0 );
+            }
+            vcToNode_[q] = node;
+            nodeSlots_[q] = nodeSizes[node]++;
+        }
+        for( const int nodeSize : nodeSizes )
+            nodeOffsets_.push_back( nodeOffsets_.back()+nodeSize );
+        for( int q=0; q<size_; ++q )
+            nodeSlots_[q] += nodeOffsets_[vcToNode_[q]];
+
         EL_DEBUG_ONLY(
           mpi::ErrorHandlerSet( mcComm_,     mpi::ERRORS_RETURN );
           mpi::ErrorHandlerSet( mrComm_,     mpi::ERRORS_RETURN );
@@ -210,6 +360,28 @@ void Grid::SetUpGrid()
           mpi::ErrorHandlerSet( mdComm_,     mpi::ERRORS_RETURN );
           mpi::ErrorHandlerSet( mdPerpComm_, mpi::ERRORS_RETURN );
         )
+
+        // Name the communicators for the communication profiler
+        mpi::SetName( owningComm_, "Owning" );
+        mpi::SetName( cartComm_,   "Cart" );
+        mpi::SetName( mcComm_,     "MC" );
+        mpi::SetName( mrComm_,     "MR" );
+        mpi::SetName( vcComm_,     "VC" );
+        mpi::SetName( vrComm_,     "VR" );
+        mpi::SetName( mdComm_,     "MD" );
+        mpi::SetName( mdPerpComm_, "MDPerp" );
+        mpi::SetName( nodeComm_,   "Node" );
+        if( nodeLeaderComm_ != mpi::COMM_NULL )
+            mpi::SetName( nodeLeaderComm_, "NodeLeader" );
+
+        // Collectives over the grid's communicators which span several
+        // nodes are performed in two levels when the grid spans many nodes
+        if( hierarchicalThreshold > 0 && NumNodes() >= hierarchicalThreshold )
+        {
+            for( mpi::Comm comm :
+                 { mcComm_, mrComm_, vcComm_, vrComm_, mdComm_, mdPerpComm_ } )
+                mpi::EnableHierarchicalCollectives( comm );
+        }
     }
     else
     {
@@ -219,6 +391,8 @@ void Grid::SetUpGrid()
         mdPerpComm_ = mpi::COMM_NULL;
         vcComm_     = mpi::COMM_NULL;
         vrComm_     = mpi::COMM_NULL;
+        nodeComm_   = mpi::COMM_NULL;
+        nodeLeaderComm_ = mpi::COMM_NULL;
 
         mcRank_     = mpi::UNDEFINED;
         mrRank_     = mpi::UNDEFINED;
@@ -226,6 +400,7 @@ void Grid::SetUpGrid()
         mdPerpRank_ = mpi::UNDEFINED;
         vcRank_     = mpi::UNDEFINED;
         vrRank_     = mpi::UNDEFINED;
+        nodeRank_   = mpi::UNDEFINED;
 
         // diags and ranks are implicitly set to undefined
     }
@@ -255,6 +430,10 @@ Grid::~Grid()
 #endif
         if( InGrid() )
         {
+            nodeWorkspace_.reset();
+            if( nodeLeaderComm_ != mpi::COMM_NULL )
+                mpi::Free( nodeLeaderComm_ );
+            mpi::Free( nodeComm_ );
             mpi::Free( mdComm_ );
             mpi::Free( mdPerpComm_ );
             mpi::Free( mcComm_ );
@@ -278,6 +457,30 @@ int Grid::MDPerpRank() const EL_NO_RELEASE_EXCEPT { return mdPerpRank_; }
 int Grid::VCRank()     const EL_NO_RELEASE_EXCEPT { return vcRank_; }
 int Grid::VRRank()     const EL_NO_RELEASE_EXCEPT { return vrRank_; }
 
+mpi::Comm Grid::NodeComm() const EL_NO_EXCEPT { return nodeComm_; }
+mpi::Comm Grid::NodeLeaderComm() const EL_NO_EXCEPT
+{ return nodeLeaderComm_; }
+int Grid::NodeRank() const EL_NO_RELEASE_EXCEPT { return nodeRank_; }
+int Grid::NodeSize() const EL_NO_RELEASE_EXCEPT
+{ return NodeOffset(Node()+1) - NodeOffset(Node()); }
+int Grid::NumNodes() const EL_NO_EXCEPT { return nodeOffsets_.size()-1; }
+int Grid::Node() const EL_NO_RELEASE_EXCEPT { return vcToNode_[vcRank_]; }
+int Grid::Node( int vcRank ) const EL_NO_EXCEPT { return vcToNode_[vcRank]; }
+int Grid::NodeSlot( int vcRank ) const EL_NO_EXCEPT
+{ return nodeSlots_[vcRank]; }
+int Grid::NodeOffset( int node ) const EL_NO_EXCEPT
+{ return nodeOffsets_[node]; }
+
+mpi::SharedWindow& Grid::NodeWorkspace() const
+{
+    EL_DEBUG_CSE
+    if( !InGrid() )
+        LogicError("Only processes in the grid have a node workspace");
+    if( !nodeWorkspace_ )
+        nodeWorkspace_.reset( new mpi::SharedWindow(nodeComm_) );
+    return *nodeWorkspace_;
+}
+
 int Grid::MCSize()     const EL_NO_EXCEPT { return height_;       }
 int Grid::MRSize()     const EL_NO_EXCEPT { return size_/height_; }
 int Grid::MDSize()     const EL_NO_EXCEPT { return size_/gcd_;    }
@@ -413,6 +616,8 @@ int Grid::CoordsToVC
 int Grid::VCToViewing( int vcRank ) const EL_NO_EXCEPT
 { return vcToViewing_[vcRank]; }
 
+Arena& Grid::CommArena() const EL_NO_EXCEPT { return commArena_; }
+
 mpi::Group Grid::OwningGroup() const EL_NO_EXCEPT { return owningGroup_; }
 mpi::Comm Grid::OwningComm()  const EL_NO_EXCEPT { return owningComm_; }
 mpi::Comm Grid::ViewingComm() const EL_NO_EXCEPT { return viewingComm_; }
@@ -0,0 +1,447 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+#ifdef __linux__
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+namespace El {
+
+namespace {
+
+// Size classes are spaced so that each power of two is split into four
+// buckets, which bounds the internal fragmentation by 25%. The smallest
+// class is 64 bytes.
+const size_t minClassLog2 = 6;
+const size_t numSubClasses = 4;
+const size_t numClasses =
+  1 + numSubClasses*(std::numeric_limits<size_t>::digits-minClassLog2-2);
+
+std::atomic<bool> poolEnabled(false);
+std::atomic<size_t> poolCap(std::numeric_limits<size_t>::max());
+
+std::atomic<size_t> bytesLive(0);
+std::atomic<size_t> bytesPeak(0);
+std::atomic<size_t> bytesCached(0);
+std::atomic<size_t> numRequests(0);
+std::atomic<size_t> numHits(0);
+
+size_t FloorLog2( size_t n )
+{
+    size_t k = 0;
+    while( n >>= 1 )
+        ++k;
+    return k;
+}
+
+size_t SizeClass( size_t numBytes )
+{
+    if( numBytes <= (size_t(1)<<minClassLog2) )
+        return 0;
+    const size_t k = FloorLog2( numBytes-1 );
+    const size_t step = size_t(1) << (k-2);
+    const size_t j = (numBytes-(size_t(1)<<k)+step-1) / step;
+    return 1 + numSubClasses*(k-minClassLog2) + (j-1);
+}
+
+size_t ClassBytes( size_t sizeClass )
+{
+    if( sizeClass == 0 )
+        return size_t(1)<<minClassLog2;
+    const size_t k = minClassLog2 + (sizeClass-1)/numSubClasses;
+    const size_t j = (sizeClass-1)%numSubClasses + 1;
+    return (size_t(1)<<k) + j*(size_t(1)<<(k-2));
+}
+
+void UpdatePeak( std::atomic<size_t>& peakBytes, size_t live )
+{
+    size_t peak = peakBytes.load();
+    while( live > peak && !peakBytes.compare_exchange_weak( peak, live ) ) { }
+}
+
+const size_t maxClassBytes = ClassBytes( numClasses-1 );
+
+// Buffers may be freed after the thread-local cache has been destroyed
+// (e.g., by objects with static storage duration), so we track its lifetime
+// with a trivially-destructible flag
+thread_local bool cacheDestroyed = false;
+
+struct PoolCache
+{
+    vector<vector<void*>> freeLists;
+
+    PoolCache() : freeLists(numClasses) { }
+    ~PoolCache() { Empty(); cacheDestroyed = true; }
+
+    void Empty()
+    {
+        for( size_t c=0; c<numClasses; ++c )
+        {
+            const size_t classBytes = ClassBytes( c );
+            for( void* ptr : freeLists[c] )
+            {
+                ::operator delete( ptr );
+                bytesCached -= classBytes;
+            }
+            SwapClear( freeLists[c] );
+        }
+    }
+};
+
+PoolCache& ThreadCache()
+{
+    static thread_local PoolCache cache;
+    return cache;
+}
+
+std::atomic<size_t> memoryLive(0);
+std::atomic<size_t> memoryPeak(0);
+std::atomic<size_t> memoryBudget(0);
+std::atomic<bool> enforceBudget(false);
+
+AllocationPolicy defaultPolicy;
+
+// The registered allocators of each memory space
+std::mutex allocatorMutex;
+std::unordered_map<int,Allocator> allocators;
+
+// The lengths of the active mappings (which can differ from the requested
+// sizes due to rounding and huge page fallbacks)
+std::mutex mappingMutex;
+std::unordered_map<void*,size_t> mappingLengths;
+
+#ifdef __linux__
+// We avoid a dependency on libnuma by directly issuing the system call
+const int mpolPreferred = 1;
+const int mpolInterleave = 3;
+
+void ApplyNumaPolicy( void* ptr, size_t length, NumaPolicy numa )
+{
+    if( numa == NUMA_FIRST_TOUCH )
+        return;
+# ifdef SYS_mbind
+    if( numa == NUMA_INTERLEAVE )
+    {
+        // The kernel intersects the mask with the allowed memory nodes
+        const unsigned long maxNode = 8*sizeof(unsigned long);
+        unsigned long nodeMask = ~0UL;
+        syscall( SYS_mbind, ptr, length, mpolInterleave, &nodeMask, maxNode,
+                 0 );
+    }
+    else
+    {
+        // A preference for an empty set of nodes implies local allocation
+        syscall( SYS_mbind, ptr, length, mpolPreferred, nullptr, 0, 0 );
+    }
+# endif
+}
+#endif
+
+} // anonymous namespace
+
+void SetDefaultAllocationPolicy( const AllocationPolicy& policy )
+{ defaultPolicy = policy; }
+
+const AllocationPolicy& DefaultAllocationPolicy() EL_NO_EXCEPT
+{ return defaultPolicy; }
+
+bool UsePolicyAllocation
+( size_t numBytes, const AllocationPolicy& policy ) EL_NO_EXCEPT
+{ return !policy.IsDefault() && numBytes >= policy.minBytes; }
+
+void* PolicyAllocate( size_t numBytes, const AllocationPolicy& policy )
+{
+    if( numBytes == 0 )
+        numBytes = 1;
+#ifdef __linux__
+    const size_t pageSize = sysconf( _SC_PAGESIZE );
+    const size_t hugePageSize = size_t(1)<<21;
+
+    void* ptr = MAP_FAILED;
+    size_t length = 0;
+# ifdef MAP_HUGETLB
+    if( policy.hugePages == EXPLICIT_HUGE_PAGES )
+    {
+        length = ((numBytes+hugePageSize-1)/hugePageSize)*hugePageSize;
+        ptr = mmap
+          ( nullptr, length, PROT_READ|PROT_WRITE,
+            MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0 );
+    }
+# endif
+    if( ptr == MAP_FAILED )
+    {
+        // Fall back to standard pages (with transparent huge pages requested
+        // if any form of huge pages was desired)
+        length = ((numBytes+pageSize-1)/pageSize)*pageSize;
+        ptr = mmap
+          ( nullptr, length, PROT_READ|PROT_WRITE,
+            MAP_PRIVATE|MAP_ANONYMOUS, -1, 0 );
+        if( ptr == MAP_FAILED )
+            throw std::bad_alloc();
+# ifdef MADV_HUGEPAGE
+        if( policy.hugePages != NO_HUGE_PAGES )
+            madvise( ptr, length, MADV_HUGEPAGE );
+# endif
+    }
+    ApplyNumaPolicy( ptr, length, policy.numa );
+
+    std::lock_guard<std::mutex> guard( mappingMutex );
+    mappingLengths[ptr] = length;
+    return ptr;
+#else
+    return ::operator new( numBytes );
+#endif
+}
+
+void PolicyFree( void* ptr, size_t numBytes )
+{
+    if( ptr == nullptr )
+        return;
+#ifdef __linux__
+    size_t length;
+    {
+        std::lock_guard<std::mutex> guard( mappingMutex );
+        auto it = mappingLengths.find( ptr );
+        if( it == mappingLengths.end() )
+            LogicError("Attempted to unmap an unknown buffer");
+        length = it->second;
+        mappingLengths.erase( it );
+    }
+    munmap( ptr, length );
+#else
+    ::operator delete( ptr );
+#endif
+}
+
+bool HostAccessible( MemorySpace space ) EL_NO_EXCEPT
+{ return space != DEVICE_MEMORY; }
+
+void SetAllocator( MemorySpace space, const Allocator& allocator )
+{
+    EL_DEBUG_CSE
+    if( space == HOST_MEMORY )
+        LogicError("Host memory is always allocated by Elemental");
+    if( !allocator.allocate || !allocator.free )
+        LogicError("Allocators must provide both allocate and free");
+    std::lock_guard<std::mutex> guard( allocatorMutex );
+    allocators[space] = allocator;
+}
+
+void ClearAllocator( MemorySpace space )
+{
+    EL_DEBUG_CSE
+    std::lock_guard<std::mutex> guard( allocatorMutex );
+    allocators.erase( space );
+}
+
+bool HaveAllocator( MemorySpace space )
+{
+    std::lock_guard<std::mutex> guard( allocatorMutex );
+    return allocators.find( space ) != allocators.end();
+}
+
+void* SpaceAllocate( size_t numBytes, MemorySpace space )
+{
+    EL_DEBUG_CSE
+    function<void*(size_t)> allocate;
+    {
+        std::lock_guard<std::mutex> guard( allocatorMutex );
+        auto it = allocators.find( space );
+        if( it == allocators.end() )
+            LogicError("No allocator was registered for memory space ",space);
+        allocate = it->second.allocate;
+    }
+    void* ptr = allocate( numBytes );
+    if( ptr == nullptr && numBytes != 0 )
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void SpaceFree( void* ptr, size_t numBytes, MemorySpace space )
+{
+    EL_DEBUG_CSE
+    if( ptr == nullptr )
+        return;
+    function<void(void*,size_t)> free;
+    {
+        std::lock_guard<std::mutex> guard( allocatorMutex );
+        auto it = allocators.find( space );
+        if( it == allocators.end() )
+            LogicError("No allocator was registered for memory space ",space);
+        free = it->second.free;
+    }
+    free( ptr, numBytes );
+}
+
+void EnableMemoryPool( bool enable )
+{
+    poolEnabled = enable;
+    if( !enable )
+        EmptyMemoryPool();
+}
+
+void DisableMemoryPool() { EnableMemoryPool( false ); }
+
+bool MemoryPoolEnabled() EL_NO_EXCEPT { return poolEnabled.load(); }
+
+void SetMemoryPoolCap( size_t capBytes ) { poolCap = capBytes; }
+
+size_t MemoryPoolCap() EL_NO_EXCEPT { return poolCap.load(); }
+
+void EmptyMemoryPool()
+{
+    if( !cacheDestroyed )
+        ThreadCache().Empty();
+}
+
+MemoryPoolStats GetMemoryPoolStats()
+{
+    MemoryPoolStats stats;
+    stats.bytesLive = bytesLive.load();
+    stats.bytesPeak = bytesPeak.load();
+    stats.bytesCached = bytesCached.load();
+    stats.numRequests = numRequests.load();
+    stats.numHits = numHits.load();
+    return stats;
+}
+
+void ResetMemoryPoolStats()
+{
+    bytesPeak = bytesLive.load();
+    numRequests = 0;
+    numHits = 0;
+}
+
+void* PoolAllocate( size_t numBytes )
+{
+    if( numBytes > maxClassBytes )
+        return ::operator new( numBytes );
+    const size_t sizeClass = SizeClass( numBytes );
+    const size_t classBytes = ClassBytes( sizeClass );
+    ++numRequests;
+
+    void* ptr = nullptr;
+    if( !cacheDestroyed )
+    {
+        auto& freeList = ThreadCache().freeLists[sizeClass];
+        if( !freeList.empty() )
+        {
+            ptr = freeList.back();
+            freeList.pop_back();
+            bytesCached -= classBytes;
+            ++numHits;
+        }
+    }
+    if( ptr == nullptr )
+    {
+        try { ptr = ::operator new( classBytes ); }
+        catch( std::bad_alloc& )
+        {
+            // Return our cached buffers to the system and try once more
+            EmptyMemoryPool();
+            ptr = ::operator new( classBytes );
+        }
+    }
+    UpdatePeak( bytesPeak, bytesLive += classBytes );
+    return ptr;
+}
+
+void PoolFree( void* ptr, size_t numBytes )
+{
+    if( ptr == nullptr )
+        return;
+    if( numBytes > maxClassBytes )
+    {
+        ::operator delete( ptr );
+        return;
+    }
+    const size_t sizeClass = SizeClass( numBytes );
+    const size_t classBytes = ClassBytes( sizeClass );
+    bytesLive -= classBytes;
+
+    if( MemoryPoolEnabled() && !cacheDestroyed &&
+        bytesCached.load()+classBytes <= poolCap.load() )
+    {
+        ThreadCache().freeLists[sizeClass].push_back( ptr );
+        bytesCached += classBytes;
+    }
+    else
+        ::operator delete( ptr );
+}
+
+MemoryStats GetMemoryStats()
+{
+    MemoryStats stats;
+    stats.bytesLive = memoryLive.load();
+    stats.bytesPeak = memoryPeak.load();
+    return stats;
+}
+
+void ResetMemoryPeak() { memoryPeak = memoryLive.load(); }
+
+void TrackAllocation( size_t numBytes )
+{
+    const size_t live = ( memoryLive += numBytes );
+    UpdatePeak( memoryPeak, live );
+    if( MemoryTrackingEnabled() )
+        TraceMemory( numBytes, live );
+}
+
+void TrackDeallocation( size_t numBytes ) { memoryLive -= numBytes; }
+
+void SetMemoryBudget( size_t budgetBytes, bool enforce )
+{
+    memoryBudget = budgetBytes;
+    enforceBudget = enforce;
+}
+
+size_t MemoryBudget() EL_NO_EXCEPT { return memoryBudget.load(); }
+
+bool MemoryBudgetEnforced() EL_NO_EXCEPT
+{ return enforceBudget.load() && memoryBudget.load() != 0; }
+
+size_t MemoryHeadroom()
+{
+    const size_t budget = memoryBudget.load();
+    if( budget == 0 )
+        return std::numeric_limits<size_t>::max();
+    const size_t live = memoryLive.load();
+    return ( live >= budget ? 0 : budget-live );
+}
+
+bool FitsMemoryBudget( double numBytes )
+{ return numBytes <= double(MemoryHeadroom()); }
+
+void CheckMemoryBudget( size_t numBytes )
+{
+    if( MemoryBudgetEnforced() && !FitsMemoryBudget( numBytes ) )
+        RuntimeError
+        ("Allocating ",numBytes," bytes on process ",mpi::Rank(),
+         " would exceed its memory budget of ",MemoryBudget()," bytes (",
+         memoryLive.load()," are in use)");
+}
+
+Int BudgetedCount( Int count, double bytesPerUnit, Int minCount )
+{
+    if( bytesPerUnit <= 0 || FitsMemoryBudget( count*bytesPerUnit ) )
+        return count;
+    const double maxCount = Floor( MemoryHeadroom()/bytesPerUnit );
+    return Max( minCount, Min( count, Int(maxCount) ) );
+}
+
+} // namespace El
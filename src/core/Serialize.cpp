@@ -12,6 +12,68 @@
 
 namespace El {
 
+namespace {
+
+// Each BigFloat is packed as its precision, sign, exponent, and limbs, just
+// as in BigFloat::Serialize. Unless SetPrecision was called on individual
+// entries, every entry of an array has the same number of limbs, and the
+// common limb counts are dispatched to copies of compile-time length so
+// that each entry is moved with a handful of register-width loads and
+// stores rather than four calls to memcpy.
+
+inline byte* PackFloat
+( mpfr_srcptr alpha, size_t numLimbs, byte* buf ) EL_NO_EXCEPT
+{
+    std::memcpy( buf, &alpha->_mpfr_prec, sizeof(mpfr_prec_t) );
+    buf += sizeof(mpfr_prec_t);
+    std::memcpy( buf, &alpha->_mpfr_sign, sizeof(mpfr_sign_t) );
+    buf += sizeof(mpfr_sign_t);
+    std::memcpy( buf, &alpha->_mpfr_exp, sizeof(mpfr_exp_t) );
+    buf += sizeof(mpfr_exp_t);
+    std::memcpy( buf, alpha->_mpfr_d, numLimbs*sizeof(mp_limb_t) );
+    return buf + numLimbs*sizeof(mp_limb_t);
+}
+
+inline const byte* UnpackFloat
+( const byte* buf, size_t numLimbs, mpfr_ptr alpha ) EL_NO_EXCEPT
+{
+    std::memcpy( &alpha->_mpfr_prec, buf, sizeof(mpfr_prec_t) );
+    buf += sizeof(mpfr_prec_t);
+    std::memcpy( &alpha->_mpfr_sign, buf, sizeof(mpfr_sign_t) );
+    buf += sizeof(mpfr_sign_t);
+    std::memcpy( &alpha->_mpfr_exp, buf, sizeof(mpfr_exp_t) );
+    buf += sizeof(mpfr_exp_t);
+    std::memcpy( alpha->_mpfr_d, buf, numLimbs*sizeof(mp_limb_t) );
+    return buf + numLimbs*sizeof(mp_limb_t);
+}
+
+// The number of limbs shared by all of the entries (or zero if they differ)
+template<typename F>
+size_t CommonNumLimbs( Int n, const F* x ) EL_NO_EXCEPT
+{
+    const size_t numLimbs = x[0].NumLimbs();
+    for( Int j=1; j<n; ++j )
+        if( x[j].NumLimbs() != numLimbs )
+            return 0;
+    return numLimbs;
+}
+
+// Call pack(numLimbs) with a compile-time constant for common precisions
+template<typename Function>
+void DispatchNumLimbs( size_t numLimbs, Function pack )
+{
+    switch( numLimbs )
+    {
+    case 1: pack( std::integral_constant<size_t,1>() ); break;
+    case 2: pack( std::integral_constant<size_t,2>() ); break;
+    case 3: pack( std::integral_constant<size_t,3>() ); break;
+    case 4: pack( std::integral_constant<size_t,4>() ); break;
+    default: pack( numLimbs ); break;
+    }
+}
+
+} // anonymous namespace
+
 byte* Serialize( Int n, const BigInt* x, byte* buf )
 {
     EL_DEBUG_CSE
@@ -23,16 +85,43 @@ byte* Serialize( Int n, const BigInt* x, byte* buf )
 byte* Serialize( Int n, const BigFloat* x, byte* buf )
 {
     EL_DEBUG_CSE
-    for( Int j=0; j<n; ++j )
-        buf = x[j].Serialize( buf );
+    const size_t numLimbs = ( n > 0 ? CommonNumLimbs( n, x ) : 0 );
+    if( numLimbs == 0 )
+    {
+        for( Int j=0; j<n; ++j )
+            buf = x[j].Serialize( buf );
+        return buf;
+    }
+    DispatchNumLimbs
+    ( numLimbs,
+      [&]( auto limbs )
+      {
+          for( Int j=0; j<n; ++j )
+              buf = PackFloat( x[j].LockedPointer(), limbs, buf );
+      } );
     return buf;
 }
 
 byte* Serialize( Int n, const Complex<BigFloat>* x, byte* buf )
 {
     EL_DEBUG_CSE
-    for( Int j=0; j<n; ++j )
-        buf = x[j].Serialize( buf );
+    const size_t numLimbs = ( n > 0 ? CommonNumLimbs( n, x ) : 0 );
+    if( numLimbs == 0 )
+    {
+        for( Int j=0; j<n; ++j )
+            buf = x[j].Serialize( buf );
+        return buf;
+    }
+    DispatchNumLimbs
+    ( numLimbs,
+      [&]( auto limbs )
+      {
+          for( Int j=0; j<n; ++j )
+          {
+              buf = PackFloat( x[j].LockedRealPointer(), limbs, buf );
+              buf = PackFloat( x[j].LockedImagPointer(), limbs, buf );
+          }
+      } );
     return buf;
 }
 
@@ -305,17 +394,15 @@ byte* Deserialize( Int n, byte* buf, BigInt* x )
 byte* Deserialize( Int n, byte* buf, BigFloat* x )
 {
     EL_DEBUG_CSE
-    for( Int j=0; j<n; ++j )
-        buf = x[j].Deserialize( buf );
-    return buf;
+    const byte* constBuf = buf;
+    return const_cast<byte*>(Deserialize( n, constBuf, x ));
 }
 
 byte* Deserialize( Int n, byte* buf, Complex<BigFloat>* x )
 {
     EL_DEBUG_CSE
-    for( Int j=0; j<n; ++j )
-        buf = x[j].Deserialize( buf );
-    return buf;
+    const byte* constBuf = buf;
+    return const_cast<byte*>(Deserialize( n, constBuf, x ));
 }
 
 byte* Deserialize( Int n, byte* buf, ValueInt<BigInt>* x )
@@ -407,16 +494,43 @@ const byte* Deserialize( Int n, const byte* buf, BigInt* x )
 const byte* Deserialize( Int n, const byte* buf, BigFloat* x )
 {
     EL_DEBUG_CSE
-    for( Int j=0; j<n; ++j )
-        buf = x[j].Deserialize( buf );
+    const size_t numLimbs = ( n > 0 ? CommonNumLimbs( n, x ) : 0 );
+    if( numLimbs == 0 )
+    {
+        for( Int j=0; j<n; ++j )
+            buf = x[j].Deserialize( buf );
+        return buf;
+    }
+    DispatchNumLimbs
+    ( numLimbs,
+      [&]( auto limbs )
+      {
+          for( Int j=0; j<n; ++j )
+              buf = UnpackFloat( buf, limbs, x[j].Pointer() );
+      } );
     return buf;
 }
 
 const byte* Deserialize( Int n, const byte* buf, Complex<BigFloat>* x )
 {
     EL_DEBUG_CSE
-    for( Int j=0; j<n; ++j )
-        buf = x[j].Deserialize( buf );
+    const size_t numLimbs = ( n > 0 ? CommonNumLimbs( n, x ) : 0 );
+    if( numLimbs == 0 )
+    {
+        for( Int j=0; j<n; ++j )
+            buf = x[j].Deserialize( buf );
+        return buf;
+    }
+    DispatchNumLimbs
+    ( numLimbs,
+      [&]( auto limbs )
+      {
+          for( Int j=0; j<n; ++j )
+          {
+              buf = UnpackFloat( buf, limbs, x[j].RealPointer() );
+              buf = UnpackFloat( buf, limbs, x[j].ImagPointer() );
+          }
+      } );
     return buf;
 }
 
@@ -0,0 +1,352 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+template<typename T>
+SparseMatrix<T>::SparseMatrix() { }
+
+template<typename T>
+SparseMatrix<T>::SparseMatrix( Int height, Int width )
+: graph_(height,width)
+{ }
+
+template<typename T>
+SparseMatrix<T>::SparseMatrix( const SparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    *this = A;
+}
+
+template<typename T>
+SparseMatrix<T>::SparseMatrix( const DistSparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    *this = A;
+}
+
+template<typename T>
+SparseMatrix<T>::~SparseMatrix() { }
+
+// Assignment and reconfiguration
+// ==============================
+
+template<typename T>
+const SparseMatrix<T>& SparseMatrix<T>::operator=( const SparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    graph_ = A.graph_;
+    vals_ = A.vals_;
+    markedForZero_ = A.markedForZero_;
+    return *this;
+}
+
+template<typename T>
+const SparseMatrix<T>&
+SparseMatrix<T>::operator=( const DistSparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    graph_ = A.LockedDistGraph();
+
+    const El::Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+    const int numLocalEntries = A.NumLocalEntries();
+    vector<int> entrySizes(commSize), entryOffs;
+    mpi::AllGather( &numLocalEntries, 1, entrySizes.data(), 1, comm );
+    const int numEntries = Scan( entrySizes, entryOffs );
+    vals_.resize( numEntries );
+    mpi::AllGather
+    ( A.LockedValueBuffer(), numLocalEntries,
+      vals_.data(), entrySizes.data(), entryOffs.data(), comm );
+    SwapClear( markedForZero_ );
+    return *this;
+}
+
+template<typename T>
+const SparseMatrix<T>& SparseMatrix<T>::operator*=( T alpha )
+{
+    EL_DEBUG_CSE
+    for( auto& value : vals_ )
+        value *= alpha;
+    return *this;
+}
+
+template<typename T>
+void SparseMatrix<T>::Empty( bool freeMemory )
+{
+    graph_.Empty( freeMemory );
+    if( freeMemory )
+        SwapClear( vals_ );
+    else
+        vals_.resize( 0 );
+    SwapClear( markedForZero_ );
+}
+
+template<typename T>
+void SparseMatrix<T>::Resize( Int height, Int width )
+{
+    graph_.Resize( height, width );
+    vals_.resize( 0 );
+    markedForZero_.resize( 0 );
+}
+
+// Assembly
+// ========
+
+template<typename T>
+void SparseMatrix<T>::Reserve( Int numEntries )
+{
+    graph_.Reserve( numEntries );
+    vals_.reserve( numEntries );
+}
+
+template<typename T>
+void SparseMatrix<T>::Update( Int row, Int col, T value )
+{
+    EL_DEBUG_CSE
+    QueueUpdate( row, col, value );
+    ProcessQueues();
+}
+
+template<typename T>
+void SparseMatrix<T>::Update( const Entry<T>& entry )
+{ Update( entry.i, entry.j, entry.value ); }
+
+template<typename T>
+void SparseMatrix<T>::Zero( Int row, Int col )
+{
+    EL_DEBUG_CSE
+    QueueZero( row, col );
+    ProcessQueues();
+}
+
+template<typename T>
+void SparseMatrix<T>::QueueUpdate( Int row, Int col, T value )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    graph_.QueueConnection( row, col );
+    vals_.push_back( value );
+}
+
+template<typename T>
+void SparseMatrix<T>::QueueUpdate( const Entry<T>& entry )
+EL_NO_RELEASE_EXCEPT
+{ QueueUpdate( entry.i, entry.j, entry.value ); }
+
+template<typename T>
+void SparseMatrix<T>::QueueZero( Int row, Int col ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    markedForZero_.emplace_back( row, col );
+    graph_.consistent_ = false;
+}
+
+template<typename T>
+void SparseMatrix<T>::ProcessQueues()
+{
+    EL_DEBUG_CSE
+    if( graph_.consistent_ )
+        return;
+
+    const Int numQueued = vals_.size();
+    const Int* sourceBuf = graph_.sources_.data();
+    const Int* targetBuf = graph_.targets_.data();
+
+    // Entries which were queued in strictly increasing order (e.g., by the
+    // generators which fill whole rows in place) need not be sorted or summed
+    if( markedForZero_.empty() )
+    {
+        Int e=1;
+        for( ; e<numQueued; ++e )
+            if( sourceBuf[e-1] > sourceBuf[e] ||
+                (sourceBuf[e-1] == sourceBuf[e] &&
+                 targetBuf[e-1] >= targetBuf[e]) )
+                break;
+        if( e >= numQueued )
+        {
+            graph_.ComputeSourceOffsets();
+            graph_.consistent_ = true;
+            return;
+        }
+    }
+
+    // Sort the queued entries by their coordinates
+    vector<Int> perm( numQueued );
+    for( Int e=0; e<numQueued; ++e )
+        perm[e] = e;
+    std::stable_sort
+    ( perm.begin(), perm.end(),
+      [&]( Int e, Int f )
+      { return sourceBuf[e] < sourceBuf[f] ||
+               (sourceBuf[e] == sourceBuf[f] && targetBuf[e] < targetBuf[f]); } );
+
+    // Sum the duplicates and drop the entries marked for zeroing
+    std::sort( markedForZero_.begin(), markedForZero_.end() );
+    vector<Int> sources, targets;
+    vector<T> vals;
+    sources.reserve( numQueued );
+    targets.reserve( numQueued );
+    vals.reserve( numQueued );
+    for( Int k=0; k<numQueued; ++k )
+    {
+        const Int e = perm[k];
+        const Int i = sourceBuf[e];
+        const Int j = targetBuf[e];
+        if( !sources.empty() && sources.back() == i && targets.back() == j )
+        {
+            vals.back() += vals_[e];
+            continue;
+        }
+        if( std::binary_search
+            ( markedForZero_.begin(), markedForZero_.end(),
+              pair<Int,Int>(i,j) ) )
+            continue;
+        sources.push_back( i );
+        targets.push_back( j );
+        vals.push_back( vals_[e] );
+    }
+    SwapClear( markedForZero_ );
+
+    graph_.sources_.swap( sources );
+    graph_.targets_.swap( targets );
+    vals_.swap( vals );
+    graph_.ComputeSourceOffsets();
+    graph_.consistent_ = true;
+}
+
+// Queries
+// =======
+
+template<typename T>
+Int SparseMatrix<T>::Height() const EL_NO_EXCEPT
+{ return graph_.NumSources(); }
+
+template<typename T>
+Int SparseMatrix<T>::Width() const EL_NO_EXCEPT
+{ return graph_.NumTargets(); }
+
+template<typename T>
+Int SparseMatrix<T>::NumEntries() const EL_NO_EXCEPT
+{ return vals_.size(); }
+
+template<typename T>
+Int SparseMatrix<T>::Capacity() const EL_NO_EXCEPT
+{ return Min( graph_.Capacity(), Int(vals_.capacity()) ); }
+
+template<typename T>
+bool SparseMatrix<T>::Consistent() const EL_NO_EXCEPT
+{ return graph_.Consistent(); }
+
+template<typename T>
+El::Graph& SparseMatrix<T>::Graph() EL_NO_EXCEPT { return graph_; }
+
+template<typename T>
+const El::Graph& SparseMatrix<T>::LockedGraph() const EL_NO_EXCEPT
+{ return graph_; }
+
+template<typename T>
+T SparseMatrix<T>::Get( Int row, Int col ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int index = Offset( row, col );
+    if( index == RowOffset(row+1) || Col(index) != col )
+        return T(0);
+    return Value( index );
+}
+
+template<typename T>
+Int SparseMatrix<T>::Row( Int index ) const EL_NO_RELEASE_EXCEPT
+{ return graph_.Source( index ); }
+
+template<typename T>
+Int SparseMatrix<T>::Col( Int index ) const EL_NO_RELEASE_EXCEPT
+{ return graph_.Target( index ); }
+
+template<typename T>
+T SparseMatrix<T>::Value( Int index ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( index < 0 || index >= Int(vals_.size()) )
+          LogicError("Entry number out of bounds");
+    )
+    return vals_[index];
+}
+
+template<typename T>
+Int SparseMatrix<T>::RowOffset( Int row ) const EL_NO_RELEASE_EXCEPT
+{ return graph_.SourceOffset( row ); }
+
+template<typename T>
+Int SparseMatrix<T>::Offset( Int row, Int col ) const EL_NO_RELEASE_EXCEPT
+{ return graph_.Offset( row, col ); }
+
+template<typename T>
+Int SparseMatrix<T>::NumConnections( Int row ) const EL_NO_RELEASE_EXCEPT
+{ return graph_.NumConnections( row ); }
+
+template<typename T>
+Int* SparseMatrix<T>::SourceBuffer() EL_NO_EXCEPT
+{ return graph_.SourceBuffer(); }
+template<typename T>
+Int* SparseMatrix<T>::TargetBuffer() EL_NO_EXCEPT
+{ return graph_.TargetBuffer(); }
+template<typename T>
+Int* SparseMatrix<T>::OffsetBuffer() EL_NO_EXCEPT
+{ return graph_.OffsetBuffer(); }
+template<typename T>
+T* SparseMatrix<T>::ValueBuffer() EL_NO_EXCEPT { return vals_.data(); }
+
+template<typename T>
+const Int* SparseMatrix<T>::LockedSourceBuffer() const EL_NO_EXCEPT
+{ return graph_.LockedSourceBuffer(); }
+template<typename T>
+const Int* SparseMatrix<T>::LockedTargetBuffer() const EL_NO_EXCEPT
+{ return graph_.LockedTargetBuffer(); }
+template<typename T>
+const Int* SparseMatrix<T>::LockedOffsetBuffer() const EL_NO_EXCEPT
+{ return graph_.LockedOffsetBuffer(); }
+template<typename T>
+const T* SparseMatrix<T>::LockedValueBuffer() const EL_NO_EXCEPT
+{ return vals_.data(); }
+
+template<typename T>
+void SparseMatrix<T>::ForceNumEntries( Int numEntries )
+{
+    EL_DEBUG_CSE
+    graph_.ForceNumEdges( numEntries );
+    vals_.resize( numEntries );
+}
+
+template<typename T>
+void SparseMatrix<T>::ForceConsistency( bool consistent ) EL_NO_EXCEPT
+{ graph_.ForceConsistency( consistent ); }
+
+template<typename T>
+void SparseMatrix<T>::AssertConsistent() const
+{ graph_.AssertConsistent(); }
+
+#define PROTO(T) template class SparseMatrix<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,181 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <algorithm>
+#include <future>
+#include <numeric>
+
+namespace El {
+
+vector<unique_ptr<Grid>>
+SplitGrid( const Grid& grid, const vector<double>& weights )
+{
+    EL_DEBUG_CSE
+    const Int numGroups = weights.size();
+    const int p = grid.Size();
+    if( numGroups == 0 )
+        LogicError("There were no weights to split the grid by");
+    if( numGroups > p )
+        LogicError
+        ("Cannot split ",p," processes into ",numGroups," nonempty groups");
+    double totalWeight = 0;
+    for( const double weight : weights )
+    {
+        if( weight <= 0 )
+            LogicError("The weights must be positive");
+        totalWeight += weight;
+    }
+
+    // Give each group one process and then distribute the remainder in
+    // proportion to the weights, with any leftovers going to the groups with
+    // the largest fractional shares
+    vector<int> sizes( numGroups, 1 );
+    vector<double> fractions( numGroups );
+    const int numExtra = p - numGroups;
+    int numLeftover = numExtra;
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const double share = numExtra*(weights[group]/totalWeight);
+        const int wholeShare = Min( int(share), numLeftover );
+        sizes[group] += wholeShare;
+        numLeftover -= wholeShare;
+        fractions[group] = share - wholeShare;
+    }
+    vector<Int> order( numGroups );
+    std::iota( order.begin(), order.end(), 0 );
+    std::stable_sort
+    ( order.begin(), order.end(),
+      [&]( Int i, Int j ) { return fractions[i] > fractions[j]; } );
+    for( int k=0; k<numLeftover; ++k )
+        ++sizes[order[k]];
+
+    vector<unique_ptr<Grid>> subgrids( numGroups );
+    mpi::Group owningGroup = grid.OwningGroup();
+    int offset = 0;
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const int size = sizes[group];
+        vector<int> ranks( size );
+        std::iota( ranks.begin(), ranks.end(), offset );
+        mpi::Group subgroup;
+        mpi::Incl( owningGroup, size, ranks.data(), subgroup );
+        subgrids[group].reset
+        ( new Grid( grid.VCComm(), subgroup, Grid::DefaultHeight(size) ) );
+        mpi::Free( subgroup );
+        offset += size;
+    }
+    return subgrids;
+}
+
+void RunSubproblems
+( const Grid& grid,
+  vector<Subproblem>& subproblems,
+  const SubproblemCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numSubproblems = subproblems.size();
+    if( numSubproblems == 0 )
+        return;
+    const Int numGroups = Min( numSubproblems, Int(grid.Size()) );
+
+    // Assign the subproblems to the groups in order of decreasing work, each
+    // to the group with the least work so far (work below one is rounded up
+    // so that every group has a positive weight)
+    vector<Int> order( numSubproblems );
+    std::iota( order.begin(), order.end(), 0 );
+    std::stable_sort
+    ( order.begin(), order.end(),
+      [&]( Int i, Int j )
+      { return subproblems[i].work > subproblems[j].work; } );
+    vector<double> groupWork( numGroups, 0 );
+    vector<Int> groupOf( numSubproblems );
+    for( const Int i : order )
+    {
+        const Int group =
+          std::min_element( groupWork.begin(), groupWork.end() ) -
+          groupWork.begin();
+        groupOf[i] = group;
+        groupWork[group] += Max( subproblems[i].work, 1. );
+    }
+
+    vector<unique_ptr<Grid>> ownedGrids;
+    vector<const Grid*> subgrids( numGroups, &grid );
+    if( numGroups > 1 )
+    {
+        ownedGrids = SplitGrid( grid, groupWork );
+        for( Int group=0; group<numGroups; ++group )
+            subgrids[group] = ownedGrids[group].get();
+        if( ctrl.progress && grid.Rank() == 0 )
+            Output
+            ("Split ",grid.Size()," processes into ",numGroups,
+             " subgrids for ",numSubproblems," subproblems");
+    }
+
+    for( Int i=0; i<numSubproblems; ++i )
+        if( subproblems[i].push )
+            subproblems[i].push( *subgrids[groupOf[i]] );
+
+    // Solve the subproblems assigned to the subgrid of this process, largest
+    // first
+    vector<Int> mine;
+    for( const Int i : order )
+        if( subgrids[groupOf[i]]->InGrid() && subproblems[i].solve )
+            mine.push_back( i );
+    const Int numMine = mine.size();
+    const Int numThreads = Min( ctrl.numThreads, numMine );
+    const bool concurrent =
+      numThreads > 1 && subgrids[groupOf[mine[0]]]->Size() == 1;
+    if( concurrent )
+    {
+        // The calling thread participates alongside numThreads-1 futures,
+        // which inherit its blocksize. The futures are joined (and the first
+        // exception rethrown) before the results are pulled.
+        std::atomic<Int> next(0);
+        auto solveMine = [&]()
+        {
+            for( Int k=next++; k<numMine; k=next++ )
+            {
+                const Int i = mine[k];
+                subproblems[i].solve( *subgrids[groupOf[i]] );
+            }
+        };
+        const auto blocksizeStack = CurrentContext().blocksizeStack;
+        vector<std::future<void>> futures;
+        for( Int t=1; t<numThreads; ++t )
+            futures.push_back
+            ( std::async
+              ( std::launch::async,
+                [&]()
+                {
+                    CurrentContext().blocksizeStack = blocksizeStack;
+                    solveMine();
+                } ) );
+        std::exception_ptr error;
+        try { solveMine(); }
+        catch( ... ) { error = std::current_exception(); }
+        for( auto& future : futures )
+        {
+            try { future.get(); }
+            catch( ... ) { if( !error ) error = std::current_exception(); }
+        }
+        if( error )
+            std::rethrow_exception( error );
+    }
+    else
+    {
+        for( const Int i : mine )
+            subproblems[i].solve( *subgrids[groupOf[i]] );
+    }
+
+    for( Int i=0; i<numSubproblems; ++i )
+        if( subproblems[i].pull )
+            subproblems[i].pull();
+}
+
+} // namespace El
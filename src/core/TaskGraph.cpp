@@ -0,0 +1,259 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace El {
+
+namespace {
+
+struct Task
+{
+    function<void()> body;
+    vector<TaskGraph::TaskId> successors;
+    Int numDependencies=0;
+    Int priority=0;
+};
+
+// The tasks which last wrote, and have since read, a particular datum
+struct Access
+{
+    TaskGraph::TaskId lastWriter=-1;
+    vector<TaskGraph::TaskId> readers;
+};
+
+// The ready tasks of a worker: the owner pops from the back and thieves
+// steal from the front
+struct ReadyQueue
+{
+    std::mutex mutex;
+    std::deque<TaskGraph::TaskId> tasks;
+};
+
+} // anonymous namespace
+
+struct TaskGraph::State
+{
+    vector<Task> tasks;
+    std::map<const void*,Access> accesses;
+    Int numEdges=0;
+
+    void AddEdge( TaskId source, TaskId target )
+    {
+        auto& successors = tasks[source].successors;
+        // Consecutive duplicates are common (e.g., a task reading and
+        // writing data last written by the same task)
+        if( !successors.empty() && successors.back() == target )
+            return;
+        successors.push_back( target );
+        ++tasks[target].numDependencies;
+        ++numEdges;
+    }
+};
+
+TaskGraph::TaskGraph() : state_(new State) { }
+
+TaskGraph::~TaskGraph() { }
+
+TaskGraph::TaskId TaskGraph::Insert
+( function<void()> task,
+  const vector<const void*>& reads,
+  const vector<const void*>& writes,
+  Int priority )
+{
+    EL_DEBUG_CSE
+    auto& state = *state_;
+    const TaskId id = state.tasks.size();
+    state.tasks.emplace_back();
+    state.tasks.back().body = std::move(task);
+    state.tasks.back().priority = priority;
+
+    for( const void* datum : reads )
+    {
+        auto& access = state.accesses[datum];
+        if( access.lastWriter >= 0 )
+            state.AddEdge( access.lastWriter, id );
+        access.readers.push_back( id );
+    }
+    for( const void* datum : writes )
+    {
+        auto& access = state.accesses[datum];
+        if( access.readers.empty() )
+        {
+            if( access.lastWriter >= 0 )
+                state.AddEdge( access.lastWriter, id );
+        }
+        else
+        {
+            for( const TaskId reader : access.readers )
+                if( reader != id )
+                    state.AddEdge( reader, id );
+            access.readers.clear();
+        }
+        access.lastWriter = id;
+    }
+    return id;
+}
+
+Int TaskGraph::NumTasks() const EL_NO_EXCEPT
+{ return state_->tasks.size(); }
+
+Int TaskGraph::NumEdges() const EL_NO_EXCEPT
+{ return state_->numEdges; }
+
+void TaskGraph::Clear() { state_.reset( new State ); }
+
+void TaskGraph::Execute( Int numThreads )
+{
+    EL_DEBUG_CSE
+    auto& tasks = state_->tasks;
+    const Int numTasks = tasks.size();
+    if( numThreads <= 0 )
+        numThreads = Max( Int(std::thread::hardware_concurrency()), Int(1) );
+    numThreads = Max( Min( numThreads, numTasks ), Int(1) );
+
+    vector<std::atomic<Int>> numPending( numTasks );
+    for( Int id=0; id<numTasks; ++id )
+        numPending[id] = tasks[id].numDependencies;
+    std::atomic<Int> numRemaining( numTasks );
+    vector<ReadyQueue> queues( numThreads );
+
+    auto byPriority = [&]( TaskId a, TaskId b )
+      { return tasks[a].priority < tasks[b].priority; };
+
+    // Deal out the initially-ready tasks so that each worker begins with its
+    // highest-priority task
+    vector<TaskId> ready;
+    for( Int id=0; id<numTasks; ++id )
+        if( tasks[id].numDependencies == 0 )
+            ready.push_back( id );
+    std::stable_sort( ready.begin(), ready.end(), byPriority );
+    for( size_t j=0; j<ready.size(); ++j )
+        queues[j % numThreads].tasks.push_back( ready[j] );
+
+    std::mutex errorMutex;
+    std::exception_ptr error;
+    std::atomic<bool> failed( false );
+
+    auto pop = [&]( Int worker, TaskId& id )
+      {
+        {
+            auto& queue = queues[worker];
+            std::lock_guard<std::mutex> lock( queue.mutex );
+            if( !queue.tasks.empty() )
+            {
+                id = queue.tasks.back();
+                queue.tasks.pop_back();
+                return true;
+            }
+        }
+        for( Int offset=1; offset<numThreads; ++offset )
+        {
+            auto& queue = queues[(worker+offset) % numThreads];
+            std::lock_guard<std::mutex> lock( queue.mutex );
+            if( !queue.tasks.empty() )
+            {
+                id = queue.tasks.front();
+                queue.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+      };
+
+    auto work = [&]( Int worker )
+      {
+        vector<TaskId> newlyReady;
+        TaskId id;
+        while( numRemaining.load() > 0 )
+        {
+            if( !pop( worker, id ) )
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            if( !failed.load() )
+            {
+                try { tasks[id].body(); }
+                catch( ... )
+                {
+                    std::lock_guard<std::mutex> lock( errorMutex );
+                    if( !failed.load() )
+                    {
+                        error = std::current_exception();
+                        failed = true;
+                    }
+                }
+            }
+
+            // Release the successors, leaving the highest priority on top
+            newlyReady.clear();
+            for( const TaskId successor : tasks[id].successors )
+                if( --numPending[successor] == 0 )
+                    newlyReady.push_back( successor );
+            if( !newlyReady.empty() )
+            {
+                std::stable_sort
+                ( newlyReady.begin(), newlyReady.end(), byPriority );
+                auto& queue = queues[worker];
+                std::lock_guard<std::mutex> lock( queue.mutex );
+                for( const TaskId successor : newlyReady )
+                    queue.tasks.push_back( successor );
+            }
+            --numRemaining;
+        }
+      };
+
+    const auto blocksizeStack = CurrentContext().blocksizeStack;
+    vector<std::thread> threads;
+    for( Int worker=1; worker<numThreads; ++worker )
+        threads.emplace_back
+        ( [&,worker]()
+          {
+              CurrentContext().blocksizeStack = blocksizeStack;
+              work( worker );
+          } );
+    work( 0 );
+    for( auto& thread : threads )
+        thread.join();
+
+    Clear();
+    if( error )
+        std::rethrow_exception( error );
+}
+
+vector<Int> TileOffsets( Int n, Int tileSize, Int split )
+{
+    EL_DEBUG_CSE
+    if( tileSize <= 0 )
+        LogicError("The tile size must be positive");
+    vector<Int> offsets( 1, 0 );
+    if( split > 0 && split < n )
+    {
+        for( Int offset=tileSize; offset<split; offset+=tileSize )
+            offsets.push_back( offset );
+        offsets.push_back( split );
+        for( Int offset=split+tileSize; offset<n; offset+=tileSize )
+            offsets.push_back( offset );
+    }
+    else
+    {
+        for( Int offset=tileSize; offset<n; offset+=tileSize )
+            offsets.push_back( offset );
+    }
+    if( n > 0 )
+        offsets.push_back( n );
+    return offsets;
+}
+
+} // namespace El
@@ -0,0 +1,458 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <thread>
+
+namespace El {
+
+namespace {
+
+struct CallSummary
+{
+    double numCalls=0, numBytes=0, seconds=0;
+};
+
+struct TraceFrame
+{
+    string path;
+    Int depth=0;
+    double start=0;
+    double numFlops=0, blasSeconds=0;
+    double commBytes=0, commSeconds=0;
+    std::map<string,CallSummary> calls;
+    double bytesAllocated=0;
+    size_t bytesPeak=0;
+};
+
+struct TraceEvent
+{
+    TraceFrame frame;
+    double duration=0;
+};
+
+bool tracing = false;
+Int commDepth = 0;
+Clock::time_point traceStart;
+TraceFrame totals;
+vector<TraceFrame> regionStack;
+vector<TraceEvent> traceEvents;
+
+bool counting = false;
+std::map<string,PerfCounter> perfCounters;
+// The counter of the outermost open region (lazily looked up)
+PerfCounter* routineCounter = nullptr;
+
+bool trackingMemory = false;
+std::map<string,RegionMemory> regionMemory;
+
+// The trace belongs to the thread which loaded the library; the events of
+// other threads (e.g., the workers of a TaskGraph) are ignored
+const std::thread::id mainThread = std::this_thread::get_id();
+
+bool OnMainThread()
+{
+#ifdef EL_HYBRID
+    if( omp_get_thread_num() != 0 )
+        return false;
+#endif
+    return std::this_thread::get_id() == mainThread;
+}
+
+double TraceTime()
+{ return duration<double>(Clock::now()-traceStart).count(); }
+
+void Accumulate( const TraceFrame& child, TraceFrame& parent )
+{
+    parent.numFlops += child.numFlops;
+    parent.blasSeconds += child.blasSeconds;
+    parent.commBytes += child.commBytes;
+    parent.commSeconds += child.commSeconds;
+    for( const auto& entry : child.calls )
+    {
+        auto& summary = parent.calls[entry.first];
+        summary.numCalls += entry.second.numCalls;
+        summary.numBytes += entry.second.numBytes;
+        summary.seconds += entry.second.seconds;
+    }
+}
+
+TraceFrame& CurrentFrame()
+{ return regionStack.empty() ? totals : regionStack.back(); }
+
+PerfCounter& RoutineCounter()
+{
+    if( routineCounter == nullptr )
+    {
+        const string routine =
+          ( regionStack.empty() ? string("Other") : regionStack.front().path );
+        routineCounter = &perfCounters[routine];
+        routineCounter->routine = routine;
+    }
+    return *routineCounter;
+}
+
+string Escape( const string& str )
+{
+    string escaped;
+    for( const char c : str )
+    {
+        if( c == '"' || c == '\\' )
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+// Region and function names follow the Chrome trace-event format, with
+// timestamps and durations in microseconds
+void WriteEvent
+( std::ostream& os, const string& name, const TraceFrame& frame,
+  double start, double dur, int rank )
+{
+    os << ",\n{\"name\":\"" << Escape(name) << "\",\"ph\":\"X\",\"pid\":"
+       << rank << ",\"tid\":0,\"ts\":" << 1e6*start
+       << ",\"dur\":" << 1e6*dur << ",\"args\":{"
+       << "\"path\":\"" << Escape(frame.path) << "\","
+       << "\"depth\":" << frame.depth << ","
+       << "\"flops\":" << frame.numFlops << ","
+       << "\"blasSeconds\":" << frame.blasSeconds << ","
+       << "\"GFlops\":"
+       << ( frame.blasSeconds > 0 ? frame.numFlops/frame.blasSeconds/1e9 : 0 )
+       << ",\"commBytes\":" << frame.commBytes << ","
+       << "\"commSeconds\":" << frame.commSeconds;
+    for( const auto& entry : frame.calls )
+        os << ",\"" << Escape(entry.first) << "\":{"
+           << "\"calls\":" << entry.second.numCalls << ","
+           << "\"bytes\":" << entry.second.numBytes << ","
+           << "\"seconds\":" << entry.second.seconds << "}";
+    os << "}}";
+}
+
+} // anonymous namespace
+
+void EnableTracing( bool enable )
+{
+    if( enable && !tracing )
+    {
+        ResetTrace();
+        tracing = true;
+    }
+    else if( !enable )
+        tracing = false;
+}
+
+void DisableTracing() { EnableTracing( false ); }
+
+bool TracingEnabled() EL_NO_EXCEPT { return tracing; }
+
+void PushTraceRegion( const char* name )
+{
+    if( !tracing && !counting && !trackingMemory && !mpi::ProfilingEnabled() )
+        return;
+    if( !OnMainThread() )
+        return;
+    TraceFrame frame;
+    frame.path =
+      ( regionStack.empty() ? string(name)
+                            : regionStack.back().path+" > "+name );
+    frame.depth = regionStack.size();
+    frame.start = TraceTime();
+    frame.bytesPeak = GetMemoryStats().bytesLive;
+    regionStack.push_back( frame );
+    if( regionStack.size() == 1 )
+    {
+        routineCounter = nullptr;
+        if( counting )
+            RoutineCounter().numCalls += 1;
+    }
+}
+
+void PopTraceRegion()
+{
+    if( regionStack.empty() || !OnMainThread() )
+        return;
+    TraceEvent event;
+    event.frame = std::move(regionStack.back());
+    regionStack.pop_back();
+    if( regionStack.empty() )
+        routineCounter = nullptr;
+    if( trackingMemory )
+    {
+        const TraceFrame& frame = event.frame;
+        auto& usage = regionMemory[frame.path];
+        usage.region = frame.path;
+        usage.numCalls += 1;
+        usage.bytesAllocated += frame.bytesAllocated;
+        usage.bytesPeak = Max( usage.bytesPeak, frame.bytesPeak );
+        if( !regionStack.empty() )
+        {
+            auto& parent = regionStack.back();
+            parent.bytesAllocated += frame.bytesAllocated;
+            parent.bytesPeak = Max( parent.bytesPeak, frame.bytesPeak );
+        }
+    }
+    if( tracing )
+    {
+        event.duration = TraceTime() - event.frame.start;
+        Accumulate( event.frame, CurrentFrame() );
+        traceEvents.push_back( std::move(event) );
+    }
+}
+
+string CurrentTraceRegion()
+{ return regionStack.empty() ? string() : regionStack.back().path; }
+
+void TraceBlas( double numFlops, double seconds )
+{
+    if( !tracing || !OnMainThread() )
+        return;
+    auto& frame = CurrentFrame();
+    frame.numFlops += numFlops;
+    frame.blasSeconds += seconds;
+}
+
+double BeginTraceCommunication( mpi::Comm comm, bool collective )
+{
+    ++commDepth;
+    if( commDepth == 1 && collective &&
+        mpi::ProfilingEnabled() && mpi::ProfilingSkew() )
+        return mpi::ProfileWait( comm );
+    return 0;
+}
+
+void EndTraceCommunication
+( mpi::Comm comm, const char* name, double numBytes, double seconds,
+  double waitSeconds )
+{
+    --commDepth;
+    if( commDepth > 0 )
+        return;
+    if( tracing )
+    {
+        auto& frame = CurrentFrame();
+        frame.commBytes += numBytes;
+        frame.commSeconds += seconds;
+        auto& summary = frame.calls[name];
+        summary.numCalls += 1;
+        summary.numBytes += numBytes;
+        summary.seconds += seconds;
+    }
+    if( mpi::ProfilingEnabled() )
+        mpi::RecordProfile( comm, name, numBytes, seconds, waitSeconds );
+}
+
+void EnablePerfCounters( bool enable )
+{
+    if( enable && !counting )
+    {
+        ResetPerfCounters();
+        counting = true;
+    }
+    else if( !enable )
+        counting = false;
+}
+
+void DisablePerfCounters() { EnablePerfCounters( false ); }
+
+bool PerfCountersEnabled() EL_NO_EXCEPT { return counting; }
+
+void CountPerf( double numFlops, double numBytes )
+{
+    if( !counting || !OnMainThread() )
+        return;
+    auto& counter = RoutineCounter();
+    counter.numFlops += numFlops;
+    counter.numBytes += numBytes;
+}
+
+vector<PerfCounter> PerfCounters()
+{
+    vector<PerfCounter> counters;
+    for( const auto& entry : perfCounters )
+        counters.push_back( entry.second );
+    return counters;
+}
+
+void ResetPerfCounters()
+{
+    perfCounters.clear();
+    routineCounter = nullptr;
+}
+
+vector<PerfImbalance> PerfCounterImbalance( mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+
+    // Form the union of the routines counted by any of the processes
+    string localNames;
+    for( const auto& entry : perfCounters )
+        localNames += entry.first + '\n';
+    const int localSize = localNames.size();
+    vector<int> sizes(commSize), offsets(commSize);
+    mpi::AllGather( &localSize, 1, sizes.data(), 1, comm );
+    const int totalSize = Scan( sizes, offsets );
+    vector<byte> names( totalSize );
+    mpi::AllGather
+    ( reinterpret_cast<const byte*>(localNames.data()), localSize,
+      names.data(), sizes.data(), offsets.data(), comm );
+    std::set<string> routines;
+    std::istringstream is
+    ( string( reinterpret_cast<const char*>(names.data()), totalSize ) );
+    string routine;
+    while( std::getline( is, routine ) )
+        routines.insert( routine );
+
+    const int numRoutines = routines.size();
+    vector<PerfImbalance> imbalances;
+    if( numRoutines == 0 )
+        return imbalances;
+    vector<double> minFlops, maxFlops, sumFlops;
+    for( const auto& name : routines )
+    {
+        auto it = perfCounters.find( name );
+        const double numFlops =
+          ( it == perfCounters.end() ? 0. : it->second.numFlops );
+        minFlops.push_back( numFlops );
+        maxFlops.push_back( numFlops );
+        sumFlops.push_back( numFlops );
+    }
+    mpi::AllReduce( minFlops.data(), numRoutines, mpi::MIN, comm );
+    mpi::AllReduce( maxFlops.data(), numRoutines, mpi::MAX, comm );
+    mpi::AllReduce( sumFlops.data(), numRoutines, mpi::SUM, comm );
+
+    Int k = 0;
+    for( const auto& name : routines )
+    {
+        PerfImbalance imbalance;
+        imbalance.routine = name;
+        imbalance.minFlops = minFlops[k];
+        imbalance.maxFlops = maxFlops[k];
+        imbalance.meanFlops = sumFlops[k] / commSize;
+        imbalances.push_back( imbalance );
+        ++k;
+    }
+    return imbalances;
+}
+
+void EnableMemoryTracking( bool enable )
+{
+    if( enable && !trackingMemory )
+    {
+        ResetRegionMemoryStats();
+        trackingMemory = true;
+    }
+    else if( !enable )
+        trackingMemory = false;
+}
+
+void DisableMemoryTracking() { EnableMemoryTracking( false ); }
+
+bool MemoryTrackingEnabled() EL_NO_EXCEPT { return trackingMemory; }
+
+void TraceMemory( size_t numBytes, size_t bytesLive )
+{
+    if( !trackingMemory || regionStack.empty() || !OnMainThread() )
+        return;
+    auto& frame = regionStack.back();
+    frame.bytesAllocated += numBytes;
+    frame.bytesPeak = Max( frame.bytesPeak, bytesLive );
+}
+
+vector<RegionMemory> RegionMemoryStats()
+{
+    vector<RegionMemory> stats;
+    for( const auto& entry : regionMemory )
+        stats.push_back( entry.second );
+    return stats;
+}
+
+void ResetRegionMemoryStats()
+{
+    regionMemory.clear();
+    const size_t bytesLive = GetMemoryStats().bytesLive;
+    for( auto& frame : regionStack )
+    {
+        frame.bytesAllocated = 0;
+        frame.bytesPeak = bytesLive;
+    }
+}
+
+void ResetTrace()
+{
+    traceStart = Clock::now();
+    totals = TraceFrame();
+    totals.path = "Total";
+    for( auto& frame : regionStack )
+    {
+        TraceFrame openFrame;
+        openFrame.path = frame.path;
+        openFrame.depth = frame.depth;
+        frame = openFrame;
+    }
+    traceEvents.clear();
+}
+
+void WriteTrace( const string& filename, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    if( !regionStack.empty() )
+        LogicError
+        ("Cannot write a trace while region ",regionStack.back().path,
+         " is open");
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    // Serialize the local events, with the totals spanning the whole trace
+    std::ostringstream os;
+    os.precision( 12 );
+    WriteEvent( os, "Total", totals, 0, TraceTime(), commRank );
+    for( const auto& event : traceEvents )
+    {
+        const string& path = event.frame.path;
+        const auto pos = path.rfind( " > " );
+        const string name =
+          ( pos == string::npos ? path : path.substr( pos+3 ) );
+        WriteEvent
+        ( os, name, event.frame, event.frame.start, event.duration, commRank );
+    }
+    const string localTrace = os.str();
+
+    // Gather each process's events onto the root
+    const int localSize = localTrace.size();
+    vector<int> sizes(commSize), offsets(commSize);
+    mpi::Gather( &localSize, 1, sizes.data(), 1, 0, comm );
+    const int totalSize = Scan( sizes, offsets );
+    vector<byte> trace;
+    if( commRank == 0 )
+        trace.resize( totalSize );
+    mpi::Gather
+    ( reinterpret_cast<const byte*>(localTrace.data()), localSize,
+      trace.data(), sizes.data(), offsets.data(), 0, comm );
+
+    if( commRank == 0 )
+    {
+        std::ofstream file( filename.c_str() );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        // Drop the leading comma of the first event
+        const char* events = reinterpret_cast<const char*>(trace.data());
+        file << "{\"traceEvents\":[";
+        if( totalSize > 0 )
+            file.write( events+1, totalSize-1 );
+        file << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+    }
+}
+
+} // namespace El
@@ -11,9 +11,9 @@
 
 namespace {
 
-// Debugging
+// Debugging (each thread, e.g., those of WriteAsync, has its own stack)
 EL_DEBUG_ONLY(
-  std::stack<std::string> callStack;
+  thread_local std::stack<std::string> callStack;
   bool tracingEnabled = false;
 )
 
@@ -181,10 +181,71 @@ void Initialize( int& argc, char**& argv )
     // Queue a default algorithmic blocksize
     EmptyBlocksizeStack();
     PushBlocksizeStack( 128 );
+    if( const char* grainEnv = std::getenv("EL_OMP_GRAIN_SIZE") )
+        SetParallelGrainSize( std::strtoll( grainEnv, nullptr, 10 ) );
+    if( const char* lookaheadEnv = std::getenv("EL_FACTOR_LOOKAHEAD") )
+        SetFactorLookahead( string(lookaheadEnv) != "0" );
+    if( const char* roundEnv = std::getenv("EL_QUEUE_ROUND_SIZE") )
+        SetQueueRoundSize( std::strtoll( roundEnv, nullptr, 10 ) );
+    if( const char* cowEnv = std::getenv("EL_COPY_ON_WRITE") )
+        SetCopyOnWrite( string(cowEnv) != "0" );
+    if( const char* counterEnv = std::getenv("EL_COUNTER_BASED_RANDOM") )
+        SetCounterBasedRandom( string(counterEnv) != "0" );
+
+    // Optionally enable the pooled workspace allocator
+    if( const char* poolCapEnv = std::getenv("EL_MEMORY_POOL_CAP") )
+        SetMemoryPoolCap( std::strtoull( poolCapEnv, nullptr, 10 ) );
+    if( const char* poolEnv = std::getenv("EL_MEMORY_POOL") )
+    {
+        if( string(poolEnv) != "0" )
+            EnableMemoryPool();
+    }
+
+    // Optionally cap the memory of each process
+    if( const char* budgetEnv = std::getenv("EL_MEMORY_BUDGET") )
+    {
+        const char* enforceEnv = std::getenv("EL_MEMORY_BUDGET_ENFORCE");
+        SetMemoryBudget
+        ( std::strtoull( budgetEnv, nullptr, 10 ),
+          enforceEnv != nullptr && string(enforceEnv) != "0" );
+    }
+
+    // Optionally offload the local BLAS-3 kernels to a CUDA device
+    if( const char* blasEnv = std::getenv("EL_LOCAL_BLAS_BACKEND") )
+    {
+        if( string(blasEnv) == "device" )
+            SetLocalBlasBackend( LOCAL_BLAS_DEVICE );
+    }
 
-    // Build the default grid
-    Grid::InitializeDefault();
-    Grid::InitializeTrivial();
+    // Tune the parallel file I/O for striped filesystems
+    {
+        mpi::FileHints hints;
+        if( const char* countEnv = std::getenv("EL_IO_STRIPE_COUNT") )
+            hints.stripeCount = std::atoi( countEnv );
+        if( const char* sizeEnv = std::getenv("EL_IO_STRIPE_SIZE") )
+            hints.stripeSize = std::strtoll( sizeEnv, nullptr, 10 );
+        if( const char* aggEnv = std::getenv("EL_IO_AGGREGATORS") )
+            hints.numAggregators = std::atoi( aggEnv );
+        mpi::SetFileHints( hints );
+    }
+
+    // Load any previously tuned blocksizes
+    if( const char* tuningFile = std::getenv("EL_TUNING_FILE") )
+    {
+        if( std::ifstream(tuningFile).good() )
+            LoadTuningFile( tuningFile );
+    }
+
+    // Optionally trace and profile communication until Finalize
+    if( std::getenv("EL_TRACE") )
+        EnableTracing();
+    if( std::getenv("EL_MPI_PROFILE") )
+    {
+        const char* skewEnv = std::getenv("EL_MPI_PROFILE_SKEW");
+        mpi::EnableProfiling( skewEnv && string(skewEnv) != "0" );
+    }
+
+    // NOTE: The default and trivial grids are built upon first request
 
 #ifdef HYDROGEN_HAVE_QD
     InitializeQD();
@@ -192,9 +253,11 @@ void Initialize( int& argc, char**& argv )
 
     InitializeRandom();
 
-    // Create the types and ops.
-    // mpfr::SetPrecision within InitializeRandom created the BigFloat types
-    mpi::CreateCustom();
+    // NOTE: The remaining custom types and ops are created upon first use;
+    //       mpfr::SetPrecision within InitializeRandom created the BigFloat
+    //       types. Setting EL_MPI_EAGER_TYPES restores eager creation.
+    if( std::getenv("EL_MPI_EAGER_TYPES") )
+        mpi::CreateCustom();
 }
 
 void Finalize()
@@ -214,6 +277,19 @@ void Finalize()
         delete ::args;
         ::args = 0;
 
+        if( const char* traceFile = std::getenv("EL_TRACE") )
+        {
+            if( TracingEnabled() && !mpi::Finalized() )
+                WriteTrace( traceFile );
+        }
+        DisableTracing();
+        if( const char* profileFile = std::getenv("EL_MPI_PROFILE") )
+        {
+            if( mpi::ProfilingEnabled() && !mpi::Finalized() )
+                mpi::WriteProfile( profileFile );
+        }
+        mpi::DisableProfiling();
+
         Grid::FinalizeDefault();
         Grid::FinalizeTrivial();
 
@@ -228,12 +304,15 @@ void Finalize()
 
 
         EmptyBlocksizeStack();
+        ClearTunedBlocksizes();
 
 #ifdef HYDROGEN_HAVE_QD
         FinalizeQD();
 #endif
 
         FinalizeRandom();
+
+        DisableMemoryPool();
     }
 
     EL_DEBUG_ONLY( CloseLog() )
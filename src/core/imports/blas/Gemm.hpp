@@ -54,6 +54,9 @@ void Gemm
   const T& beta,
         T* C, BlasInt CLDim )
 {
+    TraceBlasCall trace
+    ( (IsComplex<T>::value ? 8. : 2.)*m*n*k,
+      (double(m)*k+double(k)*n+2.*m*n)*sizeof(T) );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     if( m > 0 && n > 0 && k == 0 && beta == T(0) )
@@ -385,6 +388,15 @@ void Gemm
     )
     const char fixedTransA = ( std::toupper(transA) == 'C' ? 'T' : transA );
     const char fixedTransB = ( std::toupper(transB) == 'C' ? 'T' : transB );
+    TraceBlasCall trace
+    ( 2.*m*n*k, (double(m)*k+double(k)*n+2.*m*n)*sizeof(*C) );
+    if( cublas::Offload( 2.*m*n*k ) )
+    {
+        cublas::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
     EL_BLAS(sgemm)
     ( &fixedTransA, &fixedTransB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -428,6 +440,15 @@ void Gemm
     )
     const char fixedTransA = ( std::toupper(transA) == 'C' ? 'T' : transA );
     const char fixedTransB = ( std::toupper(transB) == 'C' ? 'T' : transB );
+    TraceBlasCall trace
+    ( 2.*m*n*k, (double(m)*k+double(k)*n+2.*m*n)*sizeof(*C) );
+    if( cublas::Offload( 2.*m*n*k ) )
+    {
+        cublas::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
     EL_BLAS(dgemm)
     ( &fixedTransA, &fixedTransB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -468,6 +489,15 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+    TraceBlasCall trace
+    ( 8.*m*n*k, (double(m)*k+double(k)*n+2.*m*n)*sizeof(*C) );
+    if( cublas::Offload( 8.*m*n*k ) )
+    {
+        cublas::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
     EL_BLAS(cgemm)
     ( &transA, &transB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -508,10 +538,70 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+    TraceBlasCall trace
+    ( 8.*m*n*k, (double(m)*k+double(k)*n+2.*m*n)*sizeof(*C) );
+    if( cublas::Offload( 8.*m*n*k ) )
+    {
+        cublas::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
     EL_BLAS(zgemm)
     ( &transA, &transB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
 
+#ifdef HYDROGEN_HAVE_QD
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* B, BlasInt BLDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    TraceBlasCall trace
+    ( 2.*m*n*k, (double(m)*k+double(k)*n+2.*m*n)*sizeof(*C) );
+    packed::ScaleC( m, n, beta, C, CLDim );
+    packed::Gemm
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
+}
+
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+  const QuadDouble* B, BlasInt BLDim,
+  const QuadDouble& beta,
+        QuadDouble* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    TraceBlasCall trace
+    ( 2.*m*n*k, (double(m)*k+double(k)*n+2.*m*n)*sizeof(*C) );
+    packed::ScaleC( m, n, beta, C, CLDim );
+    packed::Gemm
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
+}
+#endif
+#ifdef HYDROGEN_HAVE_QUADMATH
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim,
+  const Quad* B, BlasInt BLDim,
+  const Quad& beta,
+        Quad* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    TraceBlasCall trace
+    ( 2.*m*n*k, (double(m)*k+double(k)*n+2.*m*n)*sizeof(*C) );
+    packed::ScaleC( m, n, beta, C, CLDim );
+    packed::Gemm
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
+}
+#endif
+
 } // namespace blas
 } // namespace El
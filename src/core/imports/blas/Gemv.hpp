@@ -48,6 +48,9 @@ void Gemv
   const T& beta,
         T* y, BlasInt incy )
 {
+    TraceBlasCall trace
+    ( (IsComplex<T>::value ? 8. : 2.)*m*n,
+      (double(m)*n+m+n+(std::toupper(trans) == 'N' ? m : n))*sizeof(T) );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     // TODO: Special-case alpha=0, alpha=1, and alpha=-1?
@@ -219,6 +222,9 @@ void Gemv
   const float& beta,
         float* y, BlasInt incy )
 {
+    TraceBlasCall trace
+    ( 2.*m*n,
+      (double(m)*n+m+n+(std::toupper(trans) == 'N' ? m : n))*sizeof(*y) );
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
     EL_BLAS(sgemv)
     ( &fixedTrans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
@@ -232,6 +238,9 @@ void Gemv
   const double& beta,
         double* y, BlasInt incy )
 {
+    TraceBlasCall trace
+    ( 2.*m*n,
+      (double(m)*n+m+n+(std::toupper(trans) == 'N' ? m : n))*sizeof(*y) );
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
     EL_BLAS(dgemv)
     ( &fixedTrans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
@@ -244,8 +253,13 @@ void Gemv
   const scomplex* x, BlasInt incx,
   const scomplex& beta,
         scomplex* y, BlasInt incy )
-{ EL_BLAS(cgemv)
-  ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
+{
+    TraceBlasCall trace
+    ( 8.*m*n,
+      (double(m)*n+m+n+(std::toupper(trans) == 'N' ? m : n))*sizeof(*y) );
+    EL_BLAS(cgemv)
+    ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
+}
 
 void Gemv
 ( char trans, BlasInt m, BlasInt n,
@@ -254,8 +268,13 @@ void Gemv
   const dcomplex* x, BlasInt incx,
   const dcomplex& beta,
         dcomplex* y, BlasInt incy )
-{ EL_BLAS(zgemv)
-  ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
+{
+    TraceBlasCall trace
+    ( 8.*m*n,
+      (double(m)*n+m+n+(std::toupper(trans) == 'N' ? m : n))*sizeof(*y) );
+    EL_BLAS(zgemv)
+    ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
+}
 
 } // namespace blas
 } // namespace El
@@ -0,0 +1,472 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Cache-blocked level 3 kernels for the real scalar types which lack a vendor
+// BLAS (DoubleDouble, QuadDouble, and Quad). Trsm and Syrk apply the
+// unblocked (templated) algorithms only to diagonal blocks and express the
+// remainder of their work as calls to Gemm. Within Gemm, each KC x NC block of
+// alpha op(B) and each MC x KC block of op(A) are copied into contiguous
+// micro-panels of NR columns and MR rows (respectively), so that the
+// MR x NR micro-kernel only ever streams through unit-stride memory,
+// regardless of the orientations of A and B.
+//
+// In the case of DoubleDouble, the micro-panels are further split into
+// separate arrays of the high and low words, so that the micro-kernel can
+// apply the error-free transformations
+//
+//   TwoProd(a,b) = (p,e), with p = fl(a b) and p + e = a b, and
+//   TwoSum(a,b) = (s,e), with s = fl(a+b) and s + e = a + b,
+//
+// to MR contiguous doubles at a time, which compilers readily vectorize.
+// TwoProd is computed with a single fused multiply-add when the target
+// provides one (FP_FAST_FMA) and with Dekker's splitting otherwise.
+
+namespace El {
+namespace blas {
+namespace packed {
+
+const BlasInt MC = 64;
+const BlasInt KC = 256;
+const BlasInt NC = 512;
+
+template<typename T>
+void ScaleC( BlasInt m, BlasInt n, const T& beta, T* C, BlasInt CLDim )
+{
+    if( beta == T(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != T(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] *= beta;
+    }
+}
+
+// Returns op(A)(i,j), where A is real and op(A) is either A or A^T
+template<typename T>
+const T& OpEntry
+( bool trans, const T* A, BlasInt ALDim, BlasInt i, BlasInt j ) EL_NO_EXCEPT
+{ return trans ? A[j+i*ALDim] : A[i+j*ALDim]; }
+
+inline BlasInt RoundUp( BlasInt n, BlasInt blocksize ) EL_NO_EXCEPT
+{ return ((n+blocksize-1)/blocksize)*blocksize; }
+
+// C := C + alpha op(A) op(B) for a real scalar type, using the (overloaded)
+// arithmetic of T within the micro-kernel
+template<typename T>
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt MR = 4;
+    const BlasInt NR = 4;
+    if( m == 0 || n == 0 || k == 0 )
+        return;
+    const bool transAFlag = ( std::toupper(transA) != 'N' );
+    const bool transBFlag = ( std::toupper(transB) != 'N' );
+
+    // NOTE: MC and NC are multiples of MR and NR
+    vector<T> APack( RoundUp(Min(MC,m),MR)*Min(KC,k) ),
+              BPack( RoundUp(Min(NC,n),NR)*Min(KC,k) );
+    T acc[MR*NR], delta;
+    for( BlasInt jc=0; jc<n; jc+=NC )
+    {
+        const BlasInt nc = Min(NC,n-jc);
+        for( BlasInt pc=0; pc<k; pc+=KC )
+        {
+            const BlasInt kc = Min(KC,k-pc);
+
+            // Pack alpha op(B)(pc:pc+kc,jc:jc+nc)
+            for( BlasInt jr=0; jr<nc; jr+=NR )
+            {
+                T* BPanel = &BPack[jr*kc];
+                for( BlasInt l=0; l<kc; ++l )
+                    for( BlasInt j=0; j<NR; ++j )
+                    {
+                        T& beta = BPanel[j+l*NR];
+                        if( jr+j < nc )
+                        {
+                            beta =
+                              OpEntry( transBFlag, B, BLDim, pc+l, jc+jr+j );
+                            beta *= alpha;
+                        }
+                        else
+                            beta = 0;
+                    }
+            }
+
+            for( BlasInt ic=0; ic<m; ic+=MC )
+            {
+                const BlasInt mc = Min(MC,m-ic);
+
+                // Pack op(A)(ic:ic+mc,pc:pc+kc)
+                for( BlasInt ir=0; ir<mc; ir+=MR )
+                {
+                    T* APanel = &APack[ir*kc];
+                    for( BlasInt l=0; l<kc; ++l )
+                        for( BlasInt i=0; i<MR; ++i )
+                        {
+                            if( ir+i < mc )
+                                APanel[i+l*MR] =
+                                  OpEntry
+                                  ( transAFlag, A, ALDim, ic+ir+i, pc+l );
+                            else
+                                APanel[i+l*MR] = 0;
+                        }
+                }
+
+                for( BlasInt jr=0; jr<nc; jr+=NR )
+                {
+                    const T* BPanel = &BPack[jr*kc];
+                    const BlasInt nr = Min(NR,nc-jr);
+                    for( BlasInt ir=0; ir<mc; ir+=MR )
+                    {
+                        const T* APanel = &APack[ir*kc];
+                        const BlasInt mr = Min(MR,mc-ir);
+                        for( BlasInt t=0; t<MR*NR; ++t )
+                            acc[t] = 0;
+                        for( BlasInt l=0; l<kc; ++l )
+                            for( BlasInt j=0; j<NR; ++j )
+                                for( BlasInt i=0; i<MR; ++i )
+                                {
+                                    delta = APanel[i+l*MR];
+                                    delta *= BPanel[j+l*NR];
+                                    acc[i+j*MR] += delta;
+                                }
+                        T* CBlock = &C[(ic+ir)+(jc+jr)*CLDim];
+                        for( BlasInt j=0; j<nr; ++j )
+                            for( BlasInt i=0; i<mr; ++i )
+                                CBlock[i+j*CLDim] += acc[i+j*MR];
+                    }
+                }
+            }
+        }
+    }
+}
+
+#ifdef HYDROGEN_HAVE_QD
+inline void TwoSum( double a, double b, double& s, double& e ) EL_NO_EXCEPT
+{
+    s = a + b;
+    const double bVirtual = s - a;
+    e = (a - (s-bVirtual)) + (b - bVirtual);
+}
+
+inline void TwoProd( double a, double b, double& p, double& e ) EL_NO_EXCEPT
+{
+    p = a*b;
+#ifdef FP_FAST_FMA
+    e = std::fma( a, b, -p );
+#else
+    // 2^27 + 1
+    const double splitter = 134217729.;
+    double t = splitter*a;
+    const double aHi = t - (t-a);
+    const double aLo = a - aHi;
+    t = splitter*b;
+    const double bHi = t - (t-b);
+    const double bLo = b - bHi;
+    e = ((aHi*bHi - p) + aHi*bLo + aLo*bHi) + aLo*bLo;
+#endif
+}
+
+const BlasInt DD_MR = 8;
+const BlasInt DD_NR = 4;
+
+// (SHi,SLo) := A B, where A is the DD_MR x kc micro-panel (AHi,ALo) and B
+// is the kc x DD_NR micro-panel (BHi,BLo). Each entry is accumulated as a
+// double-double using QD's "sloppy" addition, which is accurate so long as
+// no catastrophic cancellation occurs in the accumulation.
+inline void DoubleDoubleKernel
+( BlasInt kc,
+  const double* AHi, const double* ALo,
+  const double* BHi, const double* BLo,
+  double* SHi, double* SLo )
+{
+    double sHi[DD_MR*DD_NR], sLo[DD_MR*DD_NR];
+    for( BlasInt t=0; t<DD_MR*DD_NR; ++t )
+    {
+        sHi[t] = 0;
+        sLo[t] = 0;
+    }
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        const double* aHi = &AHi[l*DD_MR];
+        const double* aLo = &ALo[l*DD_MR];
+        const double* bHi = &BHi[l*DD_NR];
+        const double* bLo = &BLo[l*DD_NR];
+        for( BlasInt j=0; j<DD_NR; ++j )
+        {
+            for( BlasInt i=0; i<DD_MR; ++i )
+            {
+                // (p,e) := a b, neglecting the product of the low words
+                double p, e, s, sErr;
+                TwoProd( aHi[i], bHi[j], p, e );
+                e += aHi[i]*bLo[j] + aLo[i]*bHi[j];
+
+                // (sHi,sLo) := (sHi,sLo) + (p,e)
+                TwoSum( sHi[i+j*DD_MR], p, s, sErr );
+                sErr += sLo[i+j*DD_MR] + e;
+                sHi[i+j*DD_MR] = s + sErr;
+                sLo[i+j*DD_MR] = sErr - (sHi[i+j*DD_MR]-s);
+            }
+        }
+    }
+    for( BlasInt t=0; t<DD_MR*DD_NR; ++t )
+    {
+        SHi[t] = sHi[t];
+        SLo[t] = sLo[t];
+    }
+}
+
+// C := C + alpha op(A) op(B)
+inline void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* B, BlasInt BLDim,
+        DoubleDouble* C, BlasInt CLDim )
+{
+    const BlasInt MR = DD_MR;
+    const BlasInt NR = DD_NR;
+    if( m == 0 || n == 0 || k == 0 )
+        return;
+    const bool transAFlag = ( std::toupper(transA) != 'N' );
+    const bool transBFlag = ( std::toupper(transB) != 'N' );
+
+    // NOTE: MC and NC are multiples of MR and NR
+    const BlasInt APackSize = RoundUp(Min(MC,m),MR)*Min(KC,k);
+    const BlasInt BPackSize = RoundUp(Min(NC,n),NR)*Min(KC,k);
+    vector<double> packBuf( 2*(APackSize+BPackSize) );
+    double* AHi = packBuf.data();
+    double* ALo = AHi + APackSize;
+    double* BHi = ALo + APackSize;
+    double* BLo = BHi + BPackSize;
+    double SHi[MR*NR], SLo[MR*NR];
+    DoubleDouble beta;
+    for( BlasInt jc=0; jc<n; jc+=NC )
+    {
+        const BlasInt nc = Min(NC,n-jc);
+        for( BlasInt pc=0; pc<k; pc+=KC )
+        {
+            const BlasInt kc = Min(KC,k-pc);
+
+            // Pack alpha op(B)(pc:pc+kc,jc:jc+nc)
+            for( BlasInt jr=0; jr<nc; jr+=NR )
+            {
+                for( BlasInt l=0; l<kc; ++l )
+                    for( BlasInt j=0; j<NR; ++j )
+                    {
+                        const BlasInt offset = jr*kc + j+l*NR;
+                        if( jr+j < nc )
+                        {
+                            beta =
+                              OpEntry( transBFlag, B, BLDim, pc+l, jc+jr+j );
+                            beta *= alpha;
+                            BHi[offset] = beta.x[0];
+                            BLo[offset] = beta.x[1];
+                        }
+                        else
+                        {
+                            BHi[offset] = 0;
+                            BLo[offset] = 0;
+                        }
+                    }
+            }
+
+            for( BlasInt ic=0; ic<m; ic+=MC )
+            {
+                const BlasInt mc = Min(MC,m-ic);
+
+                // Pack op(A)(ic:ic+mc,pc:pc+kc)
+                for( BlasInt ir=0; ir<mc; ir+=MR )
+                {
+                    for( BlasInt l=0; l<kc; ++l )
+                        for( BlasInt i=0; i<MR; ++i )
+                        {
+                            const BlasInt offset = ir*kc + i+l*MR;
+                            if( ir+i < mc )
+                            {
+                                const DoubleDouble& entry =
+                                  OpEntry
+                                  ( transAFlag, A, ALDim, ic+ir+i, pc+l );
+                                AHi[offset] = entry.x[0];
+                                ALo[offset] = entry.x[1];
+                            }
+                            else
+                            {
+                                AHi[offset] = 0;
+                                ALo[offset] = 0;
+                            }
+                        }
+                }
+
+                for( BlasInt jr=0; jr<nc; jr+=NR )
+                {
+                    const BlasInt nr = Min(NR,nc-jr);
+                    for( BlasInt ir=0; ir<mc; ir+=MR )
+                    {
+                        const BlasInt mr = Min(MR,mc-ir);
+                        DoubleDoubleKernel
+                        ( kc, &AHi[ir*kc], &ALo[ir*kc],
+                              &BHi[jr*kc], &BLo[jr*kc], SHi, SLo );
+                        DoubleDouble* CBlock = &C[(ic+ir)+(jc+jr)*CLDim];
+                        for( BlasInt j=0; j<nr; ++j )
+                        {
+                            for( BlasInt i=0; i<mr; ++i )
+                            {
+                                // Renormalize before the accurate addition
+                                double s, e;
+                                TwoSum( SHi[i+j*MR], SLo[i+j*MR], s, e );
+                                CBlock[i+j*CLDim] += dd_real( s, e );
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+#endif // ifdef HYDROGEN_HAVE_QD
+
+const BlasInt LEVEL3_BLOCKSIZE = 64;
+
+// Solve op(A) X = alpha B or X op(A) = alpha B, where A is real and
+// triangular, overwriting B with X
+template<typename F>
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim )
+{
+    const BlasInt bsize = LEVEL3_BLOCKSIZE;
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const bool transFlag = ( std::toupper(trans) != 'N' );
+    const bool opLower = ( (std::toupper(uplo) == 'L') != transFlag );
+    // The address of op(A)(i,j)
+    auto opA = [&]( BlasInt i, BlasInt j )
+      { return transFlag ? &A[j+i*ALDim] : &A[i+j*ALDim]; };
+
+    ScaleC( m, n, alpha, B, BLDim );
+    if( onLeft && opLower )
+    {
+        for( BlasInt k=0; k<m; k+=bsize )
+        {
+            const BlasInt nb = Min(bsize,m-k);
+            blas::Trsm<F>
+            ( side, uplo, trans, unit, nb, n,
+              F(1), &A[k+k*ALDim], ALDim, &B[k], BLDim );
+            blas::Gemm
+            ( trans, 'N', m-(k+nb), n, nb,
+              F(-1), opA(k+nb,k), ALDim,
+                     &B[k],       BLDim,
+              F(1),  &B[k+nb],    BLDim );
+        }
+    }
+    else if( onLeft )
+    {
+        for( BlasInt kEnd=m; kEnd>0; kEnd-=bsize )
+        {
+            const BlasInt nb = Min(bsize,kEnd);
+            const BlasInt k = kEnd - nb;
+            blas::Trsm<F>
+            ( side, uplo, trans, unit, nb, n,
+              F(1), &A[k+k*ALDim], ALDim, &B[k], BLDim );
+            blas::Gemm
+            ( trans, 'N', k, n, nb,
+              F(-1), opA(0,k), ALDim,
+                     &B[k],    BLDim,
+              F(1),  B,        BLDim );
+        }
+    }
+    else if( !opLower )
+    {
+        for( BlasInt k=0; k<n; k+=bsize )
+        {
+            const BlasInt nb = Min(bsize,n-k);
+            blas::Trsm<F>
+            ( side, uplo, trans, unit, m, nb,
+              F(1), &A[k+k*ALDim], ALDim, &B[k*BLDim], BLDim );
+            blas::Gemm
+            ( 'N', trans, m, n-(k+nb), nb,
+              F(-1), &B[k*BLDim],      BLDim,
+                     opA(k,k+nb),      ALDim,
+              F(1),  &B[(k+nb)*BLDim], BLDim );
+        }
+    }
+    else
+    {
+        for( BlasInt kEnd=n; kEnd>0; kEnd-=bsize )
+        {
+            const BlasInt nb = Min(bsize,kEnd);
+            const BlasInt k = kEnd - nb;
+            blas::Trsm<F>
+            ( side, uplo, trans, unit, m, nb,
+              F(1), &A[k+k*ALDim], ALDim, &B[k*BLDim], BLDim );
+            blas::Gemm
+            ( 'N', trans, m, k, nb,
+              F(-1), &B[k*BLDim], BLDim,
+                     opA(k,0),    ALDim,
+              F(1),  B,           BLDim );
+        }
+    }
+}
+
+// C := alpha op(A) op(A)^T + beta C within the 'uplo' triangle of C, where
+// A is real (and so Herk and Syrk coincide)
+template<typename T>
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt bsize = LEVEL3_BLOCKSIZE;
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const bool transFlag = ( std::toupper(trans) != 'N' );
+    const char transLeft = ( transFlag ? 'T' : 'N' );
+    const char transRight = ( transFlag ? 'N' : 'T' );
+    // The address of the first entry of row i of op(A)
+    auto opARow = [&]( BlasInt i ) { return transFlag ? &A[i*ALDim] : &A[i]; };
+
+    for( BlasInt j=0; j<n; j+=bsize )
+    {
+        const BlasInt nb = Min(bsize,n-j);
+        blas::Syrk<T>
+        ( uplo, trans, nb, k, alpha, opARow(j), ALDim,
+          beta, &C[j+j*CLDim], CLDim );
+        if( lower )
+            blas::Gemm
+            ( transLeft, transRight, n-(j+nb), nb, k,
+              alpha, opARow(j+nb),          ALDim,
+                     opARow(j),             ALDim,
+              beta,  &C[(j+nb)+j*CLDim],    CLDim );
+        else
+            blas::Gemm
+            ( transLeft, transRight, j, nb, k,
+              alpha, opARow(0),   ALDim,
+                     opARow(j),   ALDim,
+              beta,  &C[j*CLDim], CLDim );
+    }
+}
+
+} // namespace packed
+} // namespace blas
+} // namespace El
@@ -63,6 +63,9 @@ void Herk
   const Base<T>& beta,
         T* C, BlasInt CLDim )
 {
+    TraceBlasCall trace
+    ( (IsComplex<T>::value ? 4. : 1.)*n*n*k,
+      (double(n)*k+double(n)*(n+1))*sizeof(T) );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     if( beta == Base<T>(0) )
@@ -249,6 +252,14 @@ void Herk
         float* C, BlasInt CLDim )
 {
     const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    TraceBlasCall trace
+    ( double(n)*n*k, (double(n)*k+double(n)*(n+1))*sizeof(*C) );
+    if( cublas::Offload( double(n)*n*k ) )
+    {
+        cublas::Syrk
+        ( uplo, transFixed, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
     EL_BLAS(ssyrk)
     ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -262,6 +273,14 @@ void Herk
         double* C, BlasInt CLDim )
 {
     const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    TraceBlasCall trace
+    ( double(n)*n*k, (double(n)*k+double(n)*(n+1))*sizeof(*C) );
+    if( cublas::Offload( double(n)*n*k ) )
+    {
+        cublas::Syrk
+        ( uplo, transFixed, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
     EL_BLAS(dsyrk)
     ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -274,6 +293,14 @@ void Herk
   const float& beta,
         scomplex* C, BlasInt CLDim )
 {
+    TraceBlasCall trace
+    ( 4*double(n)*n*k, (double(n)*k+double(n)*(n+1))*sizeof(*C) );
+    if( cublas::Offload( 4*double(n)*n*k ) )
+    {
+        cublas::Herk
+        ( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
     EL_BLAS(cherk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -286,10 +313,63 @@ void Herk
   const double& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    TraceBlasCall trace
+    ( 4*double(n)*n*k, (double(n)*k+double(n)*(n+1))*sizeof(*C) );
+    if( cublas::Offload( 4*double(n)*n*k ) )
+    {
+        cublas::Herk
+        ( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
     EL_BLAS(zherk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
 
+#ifdef HYDROGEN_HAVE_QD
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    TraceBlasCall trace
+    ( double(n)*n*k, (double(n)*k+double(n)*(n+1))*sizeof(*C) );
+    packed::Syrk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+}
+
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+  const QuadDouble& beta,
+        QuadDouble* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    TraceBlasCall trace
+    ( double(n)*n*k, (double(n)*k+double(n)*(n+1))*sizeof(*C) );
+    packed::Syrk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+}
+#endif
+#ifdef HYDROGEN_HAVE_QUADMATH
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim,
+  const Quad& beta,
+        Quad* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    TraceBlasCall trace
+    ( double(n)*n*k, (double(n)*k+double(n)*(n+1))*sizeof(*C) );
+    packed::Syrk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+}
+#endif
+
 template<typename T>
 void Syrk
 ( char uplo, char trans,
@@ -299,6 +379,9 @@ void Syrk
   const T& beta,
         T* C, BlasInt CLDim )
 {
+    TraceBlasCall trace
+    ( (IsComplex<T>::value ? 4. : 1.)*n*n*k,
+      (double(n)*k+double(n)*(n+1))*sizeof(T) );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     if( beta == T(0) )
@@ -483,6 +566,14 @@ void Syrk
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    TraceBlasCall trace
+    ( double(n)*n*k, (double(n)*k+double(n)*(n+1))*sizeof(*C) );
+    if( cublas::Offload( double(n)*n*k ) )
+    {
+        cublas::Syrk
+        ( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
     EL_BLAS(ssyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -494,6 +585,14 @@ void Syrk
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    TraceBlasCall trace
+    ( double(n)*n*k, (double(n)*k+double(n)*(n+1))*sizeof(*C) );
+    if( cublas::Offload( double(n)*n*k ) )
+    {
+        cublas::Syrk
+        ( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
     EL_BLAS(dsyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -505,6 +604,14 @@ void Syrk
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    TraceBlasCall trace
+    ( 4*double(n)*n*k, (double(n)*k+double(n)*(n+1))*sizeof(*C) );
+    if( cublas::Offload( 4*double(n)*n*k ) )
+    {
+        cublas::Syrk
+        ( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
     EL_BLAS(csyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -516,9 +623,62 @@ void Syrk
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    TraceBlasCall trace
+    ( 4*double(n)*n*k, (double(n)*k+double(n)*(n+1))*sizeof(*C) );
+    if( cublas::Offload( 4*double(n)*n*k ) )
+    {
+        cublas::Syrk
+        ( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
     EL_BLAS(zsyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
 
+#ifdef HYDROGEN_HAVE_QD
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    TraceBlasCall trace
+    ( double(n)*n*k, (double(n)*k+double(n)*(n+1))*sizeof(*C) );
+    packed::Syrk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+}
+
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+  const QuadDouble& beta,
+        QuadDouble* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    TraceBlasCall trace
+    ( double(n)*n*k, (double(n)*k+double(n)*(n+1))*sizeof(*C) );
+    packed::Syrk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+}
+#endif
+#ifdef HYDROGEN_HAVE_QUADMATH
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim,
+  const Quad& beta,
+        Quad* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    TraceBlasCall trace
+    ( double(n)*n*k, (double(n)*k+double(n)*(n+1))*sizeof(*C) );
+    packed::Syrk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+}
+#endif
+
 } // namespace blas
 } // namespace El
@@ -45,6 +45,10 @@ void Trsm
   const F* A, BlasInt ALDim,
         F* B, BlasInt BLDim )
 {
+    const double order = ( std::toupper(side) == 'L' ? m : n );
+    TraceBlasCall trace
+    ( (IsComplex<F>::value ? 4. : 1.)*order*m*n,
+      (order*order/2+2.*m*n)*sizeof(F) );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     const bool onLeft = ( std::toupper(side) == 'L' );
@@ -356,6 +360,15 @@ void Trsm
         float* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    const double order = ( std::toupper(side) == 'L' ? m : n );
+    const double numFlops = order*m*n;
+    TraceBlasCall trace( numFlops, (order*order/2+2.*m*n)*sizeof(*B) );
+    if( cublas::Offload( numFlops ) )
+    {
+        cublas::Trsm
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
     EL_BLAS(strsm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -368,6 +381,15 @@ void Trsm
         double* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    const double order = ( std::toupper(side) == 'L' ? m : n );
+    const double numFlops = order*m*n;
+    TraceBlasCall trace( numFlops, (order*order/2+2.*m*n)*sizeof(*B) );
+    if( cublas::Offload( numFlops ) )
+    {
+        cublas::Trsm
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
     EL_BLAS(dtrsm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -379,6 +401,15 @@ void Trsm
   const scomplex* A, BlasInt ALDim,
         scomplex* B, BlasInt BLDim )
 {
+    const double order = ( std::toupper(side) == 'L' ? m : n );
+    const double numFlops = order*m*n;
+    TraceBlasCall trace( 4*numFlops, (order*order/2+2.*m*n)*sizeof(*B) );
+    if( cublas::Offload( 4*numFlops ) )
+    {
+        cublas::Trsm
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
     EL_BLAS(ctrsm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -390,9 +421,66 @@ void Trsm
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim )
 {
+    const double order = ( std::toupper(side) == 'L' ? m : n );
+    const double numFlops = order*m*n;
+    TraceBlasCall trace( 4*numFlops, (order*order/2+2.*m*n)*sizeof(*B) );
+    if( cublas::Offload( 4*numFlops ) )
+    {
+        cublas::Trsm
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
     EL_BLAS(ztrsm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
 
+#ifdef HYDROGEN_HAVE_QD
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+        DoubleDouble* B, BlasInt BLDim )
+{
+    EL_DEBUG_CSE
+    const double order = ( std::toupper(side) == 'L' ? m : n );
+    const double numFlops = order*m*n;
+    TraceBlasCall trace( numFlops, (order*order/2+2.*m*n)*sizeof(*B) );
+    packed::Trsm
+    ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+}
+
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+        QuadDouble* B, BlasInt BLDim )
+{
+    EL_DEBUG_CSE
+    const double order = ( std::toupper(side) == 'L' ? m : n );
+    const double numFlops = order*m*n;
+    TraceBlasCall trace( numFlops, (order*order/2+2.*m*n)*sizeof(*B) );
+    packed::Trsm
+    ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+}
+#endif
+#ifdef HYDROGEN_HAVE_QUADMATH
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim,
+        Quad* B, BlasInt BLDim )
+{
+    EL_DEBUG_CSE
+    const double order = ( std::toupper(side) == 'L' ? m : n );
+    const double numFlops = order*m*n;
+    TraceBlasCall trace( numFlops, (order*order/2+2.*m*n)*sizeof(*B) );
+    packed::Trsm
+    ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+}
+#endif
+
 } // namespace blas
 } // namespace El
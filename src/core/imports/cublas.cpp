@@ -0,0 +1,615 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#ifdef HYDROGEN_HAVE_CUBLAS
+# include <cuda_runtime.h>
+# include <cublas_v2.h>
+#endif
+
+namespace El {
+
+namespace {
+
+LocalBlasBackend localBlasBackend = LOCAL_BLAS_HOST;
+double deviceBlasMinFlops = 1e8;
+
+#ifdef HYDROGEN_HAVE_CUBLAS
+
+// The device assigned to this process by SetLocalBlasBackend
+int deviceIndex = 0;
+
+void CheckCuda( cudaError_t error )
+{
+    if( error != cudaSuccess )
+        RuntimeError("CUDA error: ",cudaGetErrorString(error));
+}
+
+void CheckCublas( cublasStatus_t status )
+{
+    if( status != CUBLAS_STATUS_SUCCESS )
+        RuntimeError("cuBLAS error: ",int(status));
+}
+
+// The right-hand sides of Gemm and Trsm are pipelined over this many streams
+const int numStreams = 2;
+
+enum WorkspaceSlot { SLOT_A, SLOT_B, SLOT_C, NUM_SLOTS };
+
+// The cuBLAS handle, streams, and (grow-only) device workspaces of a thread
+struct DeviceState
+{
+    cublasHandle_t handle;
+    cudaStream_t streams[numStreams];
+    cudaEvent_t operandReady;
+    void* workspaces[NUM_SLOTS];
+    size_t workspaceBytes[NUM_SLOTS];
+
+    DeviceState()
+    {
+        CheckCuda( cudaSetDevice( deviceIndex ) );
+        CheckCublas( cublasCreate( &handle ) );
+        for( int s=0; s<numStreams; ++s )
+            CheckCuda
+            ( cudaStreamCreateWithFlags( &streams[s], cudaStreamNonBlocking ) );
+        CheckCuda
+        ( cudaEventCreateWithFlags( &operandReady, cudaEventDisableTiming ) );
+        for( int slot=0; slot<NUM_SLOTS; ++slot )
+        {
+            workspaces[slot] = nullptr;
+            workspaceBytes[slot] = 0;
+        }
+    }
+
+    ~DeviceState()
+    {
+        Empty();
+        cudaEventDestroy( operandReady );
+        for( int s=0; s<numStreams; ++s )
+            cudaStreamDestroy( streams[s] );
+        cublasDestroy( handle );
+    }
+
+    void* Workspace( WorkspaceSlot slot, size_t numBytes )
+    {
+        if( numBytes > workspaceBytes[slot] )
+        {
+            if( workspaces[slot] != nullptr )
+                CheckCuda( cudaFree( workspaces[slot] ) );
+            workspaces[slot] = nullptr;
+            workspaceBytes[slot] = 0;
+            CheckCuda( cudaMalloc( &workspaces[slot], numBytes ) );
+            workspaceBytes[slot] = numBytes;
+        }
+        return workspaces[slot];
+    }
+
+    void Empty()
+    {
+        for( int slot=0; slot<NUM_SLOTS; ++slot )
+        {
+            if( workspaces[slot] != nullptr )
+                cudaFree( workspaces[slot] );
+            workspaces[slot] = nullptr;
+            workspaceBytes[slot] = 0;
+        }
+    }
+};
+
+DeviceState& State()
+{
+    static thread_local DeviceState state;
+    return state;
+}
+
+bool OnDevice( const void* ptr )
+{
+    cudaPointerAttributes attributes;
+    if( cudaPointerGetAttributes( &attributes, ptr ) != cudaSuccess )
+    {
+        // Unregistered host memory is reported as an error by older runtimes
+        cudaGetLastError();
+        return false;
+    }
+    return attributes.type == cudaMemoryTypeDevice ||
+           attributes.type == cudaMemoryTypeManaged;
+}
+
+cublasOperation_t ToOperation( char trans )
+{
+    const char t = std::toupper(trans);
+    return t == 'N' ? CUBLAS_OP_N : ( t == 'T' ? CUBLAS_OP_T : CUBLAS_OP_C );
+}
+
+cublasFillMode_t ToFillMode( char uplo )
+{ return std::toupper(uplo) == 'L' ? CUBLAS_FILL_MODE_LOWER
+                                   : CUBLAS_FILL_MODE_UPPER; }
+
+cublasSideMode_t ToSideMode( char side )
+{ return std::toupper(side) == 'L' ? CUBLAS_SIDE_LEFT : CUBLAS_SIDE_RIGHT; }
+
+cublasDiagType_t ToDiagType( char unit )
+{ return std::toupper(unit) == 'U' ? CUBLAS_DIAG_UNIT
+                                   : CUBLAS_DIAG_NON_UNIT; }
+
+// An m x n operand in device memory: either the original buffer or a
+// (packed) staged copy of a host buffer
+template<typename T>
+struct DeviceOperand
+{
+    const T* host;
+    T* device;
+    BlasInt height, width, hostLDim, deviceLDim;
+    bool staged;
+
+    DeviceOperand
+    ( DeviceState& state, WorkspaceSlot slot,
+      const T* buffer, BlasInt m, BlasInt n, BlasInt ldim )
+    : host(buffer), height(m), width(n), hostLDim(ldim)
+    {
+        staged = !OnDevice( buffer );
+        if( staged )
+        {
+            deviceLDim = Max(m,1);
+            device = static_cast<T*>
+              ( state.Workspace( slot, size_t(deviceLDim)*n*sizeof(T) ) );
+        }
+        else
+        {
+            deviceLDim = ldim;
+            device = const_cast<T*>( buffer );
+        }
+    }
+
+    T* Device( BlasInt i, BlasInt j ) const
+    { return &device[i+j*deviceLDim]; }
+
+    // Asynchronously upload (or download) the given columns
+    void Upload( BlasInt jBeg, BlasInt jEnd, cudaStream_t stream ) const
+    {
+        if( !staged || height == 0 || jEnd <= jBeg )
+            return;
+        CheckCuda
+        ( cudaMemcpy2DAsync
+          ( Device(0,jBeg), deviceLDim*sizeof(T),
+            &host[jBeg*hostLDim], hostLDim*sizeof(T),
+            height*sizeof(T), jEnd-jBeg, cudaMemcpyHostToDevice, stream ) );
+    }
+    void Download( BlasInt jBeg, BlasInt jEnd, cudaStream_t stream ) const
+    {
+        if( !staged || height == 0 || jEnd <= jBeg )
+            return;
+        CheckCuda
+        ( cudaMemcpy2DAsync
+          ( const_cast<T*>(&host[jBeg*hostLDim]), hostLDim*sizeof(T),
+            Device(0,jBeg), deviceLDim*sizeof(T),
+            height*sizeof(T), jEnd-jBeg, cudaMemcpyDeviceToHost, stream ) );
+    }
+};
+
+// The number of columns of the right-hand sides handled per pipeline stage
+BlasInt ChunkWidth( BlasInt n )
+{ return Max( (n+2*numStreams-1)/(2*numStreams), BlasInt(256) ); }
+
+// The cuBLAS kernels for each datatype
+// ===================================
+
+cublasStatus_t CublasGemm
+( cublasHandle_t handle, cublasOperation_t transA, cublasOperation_t transB,
+  int m, int n, int k, const float* alpha, const float* A, int ALDim,
+  const float* B, int BLDim, const float* beta, float* C, int CLDim )
+{ return cublasSgemm
+  ( handle, transA, transB, m, n, k, alpha, A, ALDim, B, BLDim,
+    beta, C, CLDim ); }
+cublasStatus_t CublasGemm
+( cublasHandle_t handle, cublasOperation_t transA, cublasOperation_t transB,
+  int m, int n, int k, const double* alpha, const double* A, int ALDim,
+  const double* B, int BLDim, const double* beta, double* C, int CLDim )
+{ return cublasDgemm
+  ( handle, transA, transB, m, n, k, alpha, A, ALDim, B, BLDim,
+    beta, C, CLDim ); }
+cublasStatus_t CublasGemm
+( cublasHandle_t handle, cublasOperation_t transA, cublasOperation_t transB,
+  int m, int n, int k, const scomplex* alpha, const scomplex* A, int ALDim,
+  const scomplex* B, int BLDim, const scomplex* beta, scomplex* C, int CLDim )
+{ return cublasCgemm
+  ( handle, transA, transB, m, n, k,
+    reinterpret_cast<const cuComplex*>(alpha),
+    reinterpret_cast<const cuComplex*>(A), ALDim,
+    reinterpret_cast<const cuComplex*>(B), BLDim,
+    reinterpret_cast<const cuComplex*>(beta),
+    reinterpret_cast<cuComplex*>(C), CLDim ); }
+cublasStatus_t CublasGemm
+( cublasHandle_t handle, cublasOperation_t transA, cublasOperation_t transB,
+  int m, int n, int k, const dcomplex* alpha, const dcomplex* A, int ALDim,
+  const dcomplex* B, int BLDim, const dcomplex* beta, dcomplex* C, int CLDim )
+{ return cublasZgemm
+  ( handle, transA, transB, m, n, k,
+    reinterpret_cast<const cuDoubleComplex*>(alpha),
+    reinterpret_cast<const cuDoubleComplex*>(A), ALDim,
+    reinterpret_cast<const cuDoubleComplex*>(B), BLDim,
+    reinterpret_cast<const cuDoubleComplex*>(beta),
+    reinterpret_cast<cuDoubleComplex*>(C), CLDim ); }
+
+cublasStatus_t CublasTrsm
+( cublasHandle_t handle, cublasSideMode_t side, cublasFillMode_t uplo,
+  cublasOperation_t trans, cublasDiagType_t diag, int m, int n,
+  const float* alpha, const float* A, int ALDim, float* B, int BLDim )
+{ return cublasStrsm
+  ( handle, side, uplo, trans, diag, m, n, alpha, A, ALDim, B, BLDim ); }
+cublasStatus_t CublasTrsm
+( cublasHandle_t handle, cublasSideMode_t side, cublasFillMode_t uplo,
+  cublasOperation_t trans, cublasDiagType_t diag, int m, int n,
+  const double* alpha, const double* A, int ALDim, double* B, int BLDim )
+{ return cublasDtrsm
+  ( handle, side, uplo, trans, diag, m, n, alpha, A, ALDim, B, BLDim ); }
+cublasStatus_t CublasTrsm
+( cublasHandle_t handle, cublasSideMode_t side, cublasFillMode_t uplo,
+  cublasOperation_t trans, cublasDiagType_t diag, int m, int n,
+  const scomplex* alpha, const scomplex* A, int ALDim, scomplex* B, int BLDim )
+{ return cublasCtrsm
+  ( handle, side, uplo, trans, diag, m, n,
+    reinterpret_cast<const cuComplex*>(alpha),
+    reinterpret_cast<const cuComplex*>(A), ALDim,
+    reinterpret_cast<cuComplex*>(B), BLDim ); }
+cublasStatus_t CublasTrsm
+( cublasHandle_t handle, cublasSideMode_t side, cublasFillMode_t uplo,
+  cublasOperation_t trans, cublasDiagType_t diag, int m, int n,
+  const dcomplex* alpha, const dcomplex* A, int ALDim, dcomplex* B, int BLDim )
+{ return cublasZtrsm
+  ( handle, side, uplo, trans, diag, m, n,
+    reinterpret_cast<const cuDoubleComplex*>(alpha),
+    reinterpret_cast<const cuDoubleComplex*>(A), ALDim,
+    reinterpret_cast<cuDoubleComplex*>(B), BLDim ); }
+
+cublasStatus_t CublasSyrk
+( cublasHandle_t handle, cublasFillMode_t uplo, cublasOperation_t trans,
+  int n, int k, const float* alpha, const float* A, int ALDim,
+  const float* beta, float* C, int CLDim )
+{ return cublasSsyrk
+  ( handle, uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim ); }
+cublasStatus_t CublasSyrk
+( cublasHandle_t handle, cublasFillMode_t uplo, cublasOperation_t trans,
+  int n, int k, const double* alpha, const double* A, int ALDim,
+  const double* beta, double* C, int CLDim )
+{ return cublasDsyrk
+  ( handle, uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim ); }
+cublasStatus_t CublasSyrk
+( cublasHandle_t handle, cublasFillMode_t uplo, cublasOperation_t trans,
+  int n, int k, const scomplex* alpha, const scomplex* A, int ALDim,
+  const scomplex* beta, scomplex* C, int CLDim )
+{ return cublasCsyrk
+  ( handle, uplo, trans, n, k,
+    reinterpret_cast<const cuComplex*>(alpha),
+    reinterpret_cast<const cuComplex*>(A), ALDim,
+    reinterpret_cast<const cuComplex*>(beta),
+    reinterpret_cast<cuComplex*>(C), CLDim ); }
+cublasStatus_t CublasSyrk
+( cublasHandle_t handle, cublasFillMode_t uplo, cublasOperation_t trans,
+  int n, int k, const dcomplex* alpha, const dcomplex* A, int ALDim,
+  const dcomplex* beta, dcomplex* C, int CLDim )
+{ return cublasZsyrk
+  ( handle, uplo, trans, n, k,
+    reinterpret_cast<const cuDoubleComplex*>(alpha),
+    reinterpret_cast<const cuDoubleComplex*>(A), ALDim,
+    reinterpret_cast<const cuDoubleComplex*>(beta),
+    reinterpret_cast<cuDoubleComplex*>(C), CLDim ); }
+
+cublasStatus_t CublasHerk
+( cublasHandle_t handle, cublasFillMode_t uplo, cublasOperation_t trans,
+  int n, int k, const float* alpha, const scomplex* A, int ALDim,
+  const float* beta, scomplex* C, int CLDim )
+{ return cublasCherk
+  ( handle, uplo, trans, n, k,
+    alpha, reinterpret_cast<const cuComplex*>(A), ALDim,
+    beta,  reinterpret_cast<cuComplex*>(C), CLDim ); }
+cublasStatus_t CublasHerk
+( cublasHandle_t handle, cublasFillMode_t uplo, cublasOperation_t trans,
+  int n, int k, const double* alpha, const dcomplex* A, int ALDim,
+  const double* beta, dcomplex* C, int CLDim )
+{ return cublasZherk
+  ( handle, uplo, trans, n, k,
+    alpha, reinterpret_cast<const cuDoubleComplex*>(A), ALDim,
+    beta,  reinterpret_cast<cuDoubleComplex*>(C), CLDim ); }
+
+// Dispatch the rank-k updates by name (rather than via an overload set)
+struct SyrkKernel
+{
+    template<typename... Args>
+    cublasStatus_t operator()( Args... args ) const
+    { return CublasSyrk( args... ); }
+};
+
+struct HerkKernel
+{
+    template<typename... Args>
+    cublasStatus_t operator()( Args... args ) const
+    { return CublasHerk( args... ); }
+};
+
+// Generic drivers
+// ===============
+
+template<typename T>
+void GemmDriver
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha, const T* A, BlasInt ALDim, const T* B, BlasInt BLDim,
+  const T& beta, T* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    DeviceState& state = State();
+    const bool normalA = std::toupper(transA) == 'N';
+    const bool normalB = std::toupper(transB) == 'N';
+    DeviceOperand<T> ADev
+    ( state, SLOT_A, A, normalA ? m : k, normalA ? k : m, ALDim );
+    DeviceOperand<T> BDev
+    ( state, SLOT_B, B, normalB ? k : n, normalB ? n : k, BLDim );
+    DeviceOperand<T> CDev( state, SLOT_C, C, m, n, CLDim );
+
+    // A is shared by every stage of the pipeline
+    ADev.Upload( 0, ADev.width, state.streams[0] );
+    CheckCuda( cudaEventRecord( state.operandReady, state.streams[0] ) );
+    for( int s=1; s<numStreams; ++s )
+        CheckCuda
+        ( cudaStreamWaitEvent( state.streams[s], state.operandReady, 0 ) );
+
+    // Each stage handles a block of columns of B (or rows of B^T) and C
+    const BlasInt chunkWidth = ChunkWidth( n );
+    for( BlasInt jBeg=0, stage=0; jBeg<n; jBeg+=chunkWidth, ++stage )
+    {
+        const BlasInt jEnd = Min( jBeg+chunkWidth, n );
+        cudaStream_t stream = state.streams[stage % numStreams];
+        CheckCublas( cublasSetStream( state.handle, stream ) );
+        if( normalB )
+            BDev.Upload( jBeg, jEnd, stream );
+        else if( stage == 0 )
+            BDev.Upload( 0, BDev.width, stream );
+        if( beta != T(0) )
+            CDev.Upload( jBeg, jEnd, stream );
+        const T* BChunk = normalB ? BDev.Device(0,jBeg) : BDev.Device(jBeg,0);
+        CheckCublas
+        ( CublasGemm
+          ( state.handle, ToOperation(transA), ToOperation(transB),
+            m, jEnd-jBeg, k,
+            &alpha, ADev.device, ADev.deviceLDim,
+                    BChunk,      BDev.deviceLDim,
+            &beta,  CDev.Device(0,jBeg), CDev.deviceLDim ) );
+        CDev.Download( jBeg, jEnd, stream );
+        if( !normalB && stage == 0 )
+        {
+            // The transposed B must be fully uploaded before other streams
+            // use it
+            CheckCuda( cudaEventRecord( state.operandReady, stream ) );
+            for( int s=1; s<numStreams; ++s )
+                CheckCuda
+                ( cudaStreamWaitEvent
+                  ( state.streams[s], state.operandReady, 0 ) );
+        }
+    }
+    for( int s=0; s<numStreams; ++s )
+        CheckCuda( cudaStreamSynchronize( state.streams[s] ) );
+}
+
+template<typename T>
+void TrsmDriver
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  const T& alpha, const T* A, BlasInt ALDim, T* B, BlasInt BLDim )
+{
+    EL_DEBUG_CSE
+    DeviceState& state = State();
+    const bool left = std::toupper(side) == 'L';
+    const BlasInt order = left ? m : n;
+    DeviceOperand<T> ADev( state, SLOT_A, A, order, order, ALDim );
+    DeviceOperand<T> BDev( state, SLOT_B, B, m, n, BLDim );
+
+    ADev.Upload( 0, order, state.streams[0] );
+    CheckCuda( cudaEventRecord( state.operandReady, state.streams[0] ) );
+    for( int s=1; s<numStreams; ++s )
+        CheckCuda
+        ( cudaStreamWaitEvent( state.streams[s], state.operandReady, 0 ) );
+
+    // The columns of B are independent for a solve from the left
+    const BlasInt chunkWidth = left ? ChunkWidth( n ) : Max(n,BlasInt(1));
+    for( BlasInt jBeg=0, stage=0; jBeg<n; jBeg+=chunkWidth, ++stage )
+    {
+        const BlasInt jEnd = Min( jBeg+chunkWidth, n );
+        cudaStream_t stream = state.streams[stage % numStreams];
+        CheckCublas( cublasSetStream( state.handle, stream ) );
+        BDev.Upload( jBeg, jEnd, stream );
+        CheckCublas
+        ( CublasTrsm
+          ( state.handle, ToSideMode(side), ToFillMode(uplo),
+            ToOperation(trans), ToDiagType(unit), m, jEnd-jBeg,
+            &alpha, ADev.device, ADev.deviceLDim,
+                    BDev.Device(0,jBeg), BDev.deviceLDim ) );
+        BDev.Download( jBeg, jEnd, stream );
+    }
+    for( int s=0; s<numStreams; ++s )
+        CheckCuda( cudaStreamSynchronize( state.streams[s] ) );
+}
+
+template<typename T,typename TScal,typename Kernel>
+void RankKDriver
+( Kernel kernel, char uplo, char trans, BlasInt n, BlasInt k,
+  const TScal& alpha, const T* A, BlasInt ALDim,
+  const TScal& beta, T* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    DeviceState& state = State();
+    const bool normal = std::toupper(trans) == 'N';
+    DeviceOperand<T> ADev
+    ( state, SLOT_A, A, normal ? n : k, normal ? k : n, ALDim );
+    DeviceOperand<T> CDev( state, SLOT_C, C, n, n, CLDim );
+
+    cudaStream_t stream = state.streams[0];
+    CheckCublas( cublasSetStream( state.handle, stream ) );
+    ADev.Upload( 0, ADev.width, stream );
+    if( beta != TScal(0) )
+        CDev.Upload( 0, n, stream );
+    CheckCublas
+    ( kernel
+      ( state.handle, ToFillMode(uplo), ToOperation(trans), n, k,
+        &alpha, ADev.device, ADev.deviceLDim,
+        &beta,  CDev.device, CDev.deviceLDim ) );
+    CDev.Download( 0, n, stream );
+    CheckCuda( cudaStreamSynchronize( stream ) );
+}
+
+#else
+
+void NotBuilt()
+{ LogicError("Elemental was not built with cuBLAS support"); }
+
+#endif // ifdef HYDROGEN_HAVE_CUBLAS
+
+} // anonymous namespace
+
+void SetLocalBlasBackend( LocalBlasBackend backend )
+{
+    EL_DEBUG_CSE
+    if( backend == LOCAL_BLAS_DEVICE )
+    {
+#ifdef HYDROGEN_HAVE_CUBLAS
+        int numDevices = 0;
+        CheckCuda( cudaGetDeviceCount( &numDevices ) );
+        if( numDevices == 0 )
+            RuntimeError("No CUDA devices were found");
+        mpi::Comm nodeComm;
+        mpi::SplitShared
+        ( mpi::COMM_WORLD, mpi::Rank(mpi::COMM_WORLD), nodeComm );
+        deviceIndex = mpi::Rank(nodeComm) % numDevices;
+        mpi::Free( nodeComm );
+        CheckCuda( cudaSetDevice( deviceIndex ) );
+#else
+        NotBuilt();
+#endif
+    }
+    localBlasBackend = backend;
+}
+
+LocalBlasBackend GetLocalBlasBackend() EL_NO_EXCEPT
+{ return localBlasBackend; }
+
+void SetDeviceBlasMinFlops( double minFlops )
+{
+    if( minFlops < 0 )
+        LogicError("The minimum number of offloaded flops must be nonnegative");
+    deviceBlasMinFlops = minFlops;
+}
+
+double DeviceBlasMinFlops() EL_NO_EXCEPT { return deviceBlasMinFlops; }
+
+void EmptyDeviceBlasCache()
+{
+#ifdef HYDROGEN_HAVE_CUBLAS
+    if( localBlasBackend == LOCAL_BLAS_DEVICE )
+        State().Empty();
+#endif
+}
+
+namespace cublas {
+
+bool Offload( double numFlops ) EL_NO_EXCEPT
+{
+    return localBlasBackend == LOCAL_BLAS_DEVICE &&
+           numFlops >= deviceBlasMinFlops;
+}
+
+Allocator DeviceAllocator()
+{
+    Allocator allocator;
+#ifdef HYDROGEN_HAVE_CUBLAS
+    allocator.allocate = []( size_t numBytes )
+      {
+          void* ptr = nullptr;
+          CheckCuda( cudaMalloc( &ptr, numBytes ) );
+          return ptr;
+      };
+    allocator.free = []( void* ptr, size_t ) { cudaFree( ptr ); };
+#else
+    NotBuilt();
+#endif
+    return allocator;
+}
+
+Allocator PinnedHostAllocator()
+{
+    Allocator allocator;
+#ifdef HYDROGEN_HAVE_CUBLAS
+    allocator.allocate = []( size_t numBytes )
+      {
+          void* ptr = nullptr;
+          CheckCuda( cudaMallocHost( &ptr, numBytes ) );
+          return ptr;
+      };
+    allocator.free = []( void* ptr, size_t ) { cudaFreeHost( ptr ); };
+#else
+    NotBuilt();
+#endif
+    return allocator;
+}
+
+#ifdef HYDROGEN_HAVE_CUBLAS
+# define EL_CUBLAS_CALL(call) call
+#else
+# define EL_CUBLAS_CALL(call) NotBuilt()
+#endif
+
+#define GEMM_PROTO(T) \
+  void Gemm \
+  ( char transA, char transB, BlasInt m, BlasInt n, BlasInt k, \
+    const T& alpha, const T* A, BlasInt ALDim, const T* B, BlasInt BLDim, \
+    const T& beta, T* C, BlasInt CLDim ) \
+  { EL_CUBLAS_CALL(GemmDriver \
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, \
+      beta, C, CLDim )); }
+
+#define TRSM_PROTO(T) \
+  void Trsm \
+  ( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n, \
+    const T& alpha, const T* A, BlasInt ALDim, T* B, BlasInt BLDim ) \
+  { EL_CUBLAS_CALL(TrsmDriver \
+    ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim )); }
+
+#define SYRK_PROTO(T) \
+  void Syrk \
+  ( char uplo, char trans, BlasInt n, BlasInt k, \
+    const T& alpha, const T* A, BlasInt ALDim, \
+    const T& beta, T* C, BlasInt CLDim ) \
+  { EL_CUBLAS_CALL(RankKDriver \
+    ( SyrkKernel(), uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim )); }
+
+#define HERK_PROTO(T) \
+  void Herk \
+  ( char uplo, char trans, BlasInt n, BlasInt k, \
+    const Base<T>& alpha, const T* A, BlasInt ALDim, \
+    const Base<T>& beta, T* C, BlasInt CLDim ) \
+  { EL_CUBLAS_CALL(RankKDriver \
+    ( HerkKernel(), uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim )); }
+
+GEMM_PROTO(float)
+GEMM_PROTO(double)
+GEMM_PROTO(scomplex)
+GEMM_PROTO(dcomplex)
+
+TRSM_PROTO(float)
+TRSM_PROTO(double)
+TRSM_PROTO(scomplex)
+TRSM_PROTO(dcomplex)
+
+SYRK_PROTO(float)
+SYRK_PROTO(double)
+SYRK_PROTO(scomplex)
+SYRK_PROTO(dcomplex)
+
+HERK_PROTO(scomplex)
+HERK_PROTO(dcomplex)
+
+} // namespace cublas
+} // namespace El
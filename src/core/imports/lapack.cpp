@@ -902,6 +902,11 @@ BlasInt HermitianEigWrapper
     EL_DEBUG_CSE
     if( n == 0 )
         return 0;
+    const double numFlops =
+      ( std::toupper(job) == 'V' ? 10./3 : 4./3 )*double(n)*n*n;
+    const double numBytes =
+      ( std::toupper(job) == 'V' ? 3. : 2. )*double(n)*n*sizeof(*A);
+    TraceBlasCall trace( numFlops, numBytes );
 
     vector<BlasInt> isuppZ( 2*n );
 
@@ -936,6 +941,11 @@ BlasInt HermitianEigWrapper
     EL_DEBUG_CSE
     if( n == 0 )
         return 0;
+    const double numFlops =
+      ( std::toupper(job) == 'V' ? 10./3 : 4./3 )*double(n)*n*n;
+    const double numBytes =
+      ( std::toupper(job) == 'V' ? 3. : 2. )*double(n)*n*sizeof(*A);
+    TraceBlasCall trace( numFlops, numBytes );
 
     vector<BlasInt> isuppZ( 2*n );
 
@@ -970,6 +980,11 @@ BlasInt HermitianEigWrapper
     EL_DEBUG_CSE
     if( n == 0 )
         return 0;
+    const double numFlops =
+      4*( std::toupper(job) == 'V' ? 10./3 : 4./3 )*double(n)*n*n;
+    const double numBytes =
+      ( std::toupper(job) == 'V' ? 3. : 2. )*double(n)*n*sizeof(*A);
+    TraceBlasCall trace( numFlops, numBytes );
 
     vector<BlasInt> isuppZ( 2*n );
 
@@ -1007,6 +1022,11 @@ BlasInt HermitianEigWrapper
     EL_DEBUG_CSE
     if( n == 0 )
         return 0;
+    const double numFlops =
+      4*( std::toupper(job) == 'V' ? 10./3 : 4./3 )*double(n)*n*n;
+    const double numBytes =
+      ( std::toupper(job) == 'V' ? 3. : 2. )*double(n)*n*sizeof(*A);
+    TraceBlasCall trace( numFlops, numBytes );
 
     vector<BlasInt> isuppZ( 2*n );
 
@@ -1433,6 +1453,14 @@ void DivideAndConquerSVD
     EL_DEBUG_CSE
     if( m==0 || n==0 )
         return;
+    const double minDim = Min(m,n), maxDim = Max(m,n);
+    const double numValueFlops =
+      4*maxDim*minDim*minDim - 4*minDim*minDim*minDim/3;
+    const double numVectorFlops =
+      4*maxDim*minDim*minDim - 2*minDim*minDim*minDim;
+    const double numBytes =
+      (2.*m*n + (double(m)+n)*minDim)*sizeof(*A);
+    TraceBlasCall trace( numValueFlops+numVectorFlops, numBytes );
 
     const char jobz = ( thin ? 'S' : 'A' );
     BlasInt workSize=-1, info;
@@ -1478,6 +1506,14 @@ void DivideAndConquerSVD
     EL_DEBUG_CSE
     if( m==0 || n==0 )
         return;
+    const double minDim = Min(m,n), maxDim = Max(m,n);
+    const double numValueFlops =
+      4*maxDim*minDim*minDim - 4*minDim*minDim*minDim/3;
+    const double numVectorFlops =
+      4*maxDim*minDim*minDim - 2*minDim*minDim*minDim;
+    const double numBytes =
+      (2.*m*n + (double(m)+n)*minDim)*sizeof(*A);
+    TraceBlasCall trace( numValueFlops+numVectorFlops, numBytes );
 
     const char jobz = ( thin ? 'S' : 'A' );
     BlasInt workSize=-1, info;
@@ -1523,6 +1559,14 @@ void DivideAndConquerSVD
     EL_DEBUG_CSE
     if( m==0 || n==0 )
         return;
+    const double minDim = Min(m,n), maxDim = Max(m,n);
+    const double numValueFlops =
+      4*maxDim*minDim*minDim - 4*minDim*minDim*minDim/3;
+    const double numVectorFlops =
+      4*maxDim*minDim*minDim - 2*minDim*minDim*minDim;
+    const double numBytes =
+      (2.*m*n + (double(m)+n)*minDim)*sizeof(*A);
+    TraceBlasCall trace( 4*(numValueFlops+numVectorFlops), numBytes );
 
     const char jobz = ( thin ? 'S' : 'A' );
     BlasInt workSize=-1, info;
@@ -1573,6 +1617,14 @@ void DivideAndConquerSVD
     EL_DEBUG_CSE
     if( m==0 || n==0 )
         return;
+    const double minDim = Min(m,n), maxDim = Max(m,n);
+    const double numValueFlops =
+      4*maxDim*minDim*minDim - 4*minDim*minDim*minDim/3;
+    const double numVectorFlops =
+      4*maxDim*minDim*minDim - 2*minDim*minDim*minDim;
+    const double numBytes =
+      (2.*m*n + (double(m)+n)*minDim)*sizeof(*A);
+    TraceBlasCall trace( 4*(numValueFlops+numVectorFlops), numBytes );
 
     const char jobz = ( thin ? 'S' : 'A' );
     BlasInt workSize=-1, info;
@@ -1626,6 +1678,15 @@ void QRSVD
     EL_DEBUG_CSE
     if( m==0 || n==0 )
         return;
+    const bool vectors = !avoidU || !avoidV;
+    const double minDim = Min(m,n), maxDim = Max(m,n);
+    const double numValueFlops =
+      4*maxDim*minDim*minDim - 4*minDim*minDim*minDim/3;
+    const double numVectorFlops =
+      vectors ? 4*maxDim*minDim*minDim - 2*minDim*minDim*minDim : 0;
+    const double numBytes =
+      (2.*m*n + (vectors ? (double(m)+n)*minDim : 0))*sizeof(*A);
+    TraceBlasCall trace( numValueFlops+numVectorFlops, numBytes );
 
     const char jobU= ( avoidU ? 'N' : ( thin ? 'S' : 'A' ) ),
                jobVT= ( avoidV ? 'N' : ( thin ? 'S' : 'A' ) );
@@ -1668,6 +1729,15 @@ void QRSVD
     EL_DEBUG_CSE
     if( m==0 || n==0 )
         return;
+    const bool vectors = !avoidU || !avoidV;
+    const double minDim = Min(m,n), maxDim = Max(m,n);
+    const double numValueFlops =
+      4*maxDim*minDim*minDim - 4*minDim*minDim*minDim/3;
+    const double numVectorFlops =
+      vectors ? 4*maxDim*minDim*minDim - 2*minDim*minDim*minDim : 0;
+    const double numBytes =
+      (2.*m*n + (vectors ? (double(m)+n)*minDim : 0))*sizeof(*A);
+    TraceBlasCall trace( numValueFlops+numVectorFlops, numBytes );
 
     const char jobU= ( avoidU ? 'N' : ( thin ? 'S' : 'A' ) ),
                jobVT= ( avoidV ? 'N' : ( thin ? 'S' : 'A' ) );
@@ -1710,6 +1780,15 @@ void QRSVD
     EL_DEBUG_CSE
     if( m==0 || n==0 )
         return;
+    const bool vectors = !avoidU || !avoidV;
+    const double minDim = Min(m,n), maxDim = Max(m,n);
+    const double numValueFlops =
+      4*maxDim*minDim*minDim - 4*minDim*minDim*minDim/3;
+    const double numVectorFlops =
+      vectors ? 4*maxDim*minDim*minDim - 2*minDim*minDim*minDim : 0;
+    const double numBytes =
+      (2.*m*n + (vectors ? (double(m)+n)*minDim : 0))*sizeof(*A);
+    TraceBlasCall trace( 4*(numValueFlops+numVectorFlops), numBytes );
 
     const char jobU= ( avoidU ? 'N' : ( thin ? 'S' : 'A' ) ),
                jobVH= ( avoidV ? 'N' : ( thin ? 'S' : 'A' ) );
@@ -1756,6 +1835,15 @@ void QRSVD
     EL_DEBUG_CSE
     if( m==0 || n==0 )
         return;
+    const bool vectors = !avoidU || !avoidV;
+    const double minDim = Min(m,n), maxDim = Max(m,n);
+    const double numValueFlops =
+      4*maxDim*minDim*minDim - 4*minDim*minDim*minDim/3;
+    const double numVectorFlops =
+      vectors ? 4*maxDim*minDim*minDim - 2*minDim*minDim*minDim : 0;
+    const double numBytes =
+      (2.*m*n + (vectors ? (double(m)+n)*minDim : 0))*sizeof(*A);
+    TraceBlasCall trace( 4*(numValueFlops+numVectorFlops), numBytes );
 
     const char jobU= ( avoidU ? 'N' : ( thin ? 'S' : 'A' ) ),
                jobVH= ( avoidV ? 'N' : ( thin ? 'S' : 'A' ) );
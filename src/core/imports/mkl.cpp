@@ -154,6 +154,74 @@ void EL_BLAS(zgemmt)
         dcomplex* C, const BlasInt* CLDim );
 #endif
 
+#ifdef HYDROGEN_HAVE_MKL_BATCH_STRIDED
+// Batches of equally-sized matrices separated by a fixed stride
+void EL_BLAS(sgemm_batch_strided)
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const float* alpha,
+  const float* A, const BlasInt* ALDim, const BlasInt* AStride,
+  const float* B, const BlasInt* BLDim, const BlasInt* BStride,
+  const float* beta,
+        float* C, const BlasInt* CLDim, const BlasInt* CStride,
+  const BlasInt* batchSize );
+void EL_BLAS(dgemm_batch_strided)
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const double* alpha,
+  const double* A, const BlasInt* ALDim, const BlasInt* AStride,
+  const double* B, const BlasInt* BLDim, const BlasInt* BStride,
+  const double* beta,
+        double* C, const BlasInt* CLDim, const BlasInt* CStride,
+  const BlasInt* batchSize );
+void EL_BLAS(cgemm_batch_strided)
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const scomplex* alpha,
+  const scomplex* A, const BlasInt* ALDim, const BlasInt* AStride,
+  const scomplex* B, const BlasInt* BLDim, const BlasInt* BStride,
+  const scomplex* beta,
+        scomplex* C, const BlasInt* CLDim, const BlasInt* CStride,
+  const BlasInt* batchSize );
+void EL_BLAS(zgemm_batch_strided)
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const dcomplex* alpha,
+  const dcomplex* A, const BlasInt* ALDim, const BlasInt* AStride,
+  const dcomplex* B, const BlasInt* BLDim, const BlasInt* BStride,
+  const dcomplex* beta,
+        dcomplex* C, const BlasInt* CLDim, const BlasInt* CStride,
+  const BlasInt* batchSize );
+void EL_BLAS(strsm_batch_strided)
+( const char* side, const char* uplo, const char* trans, const char* diag,
+  const BlasInt* m, const BlasInt* n,
+  const float* alpha,
+  const float* A, const BlasInt* ALDim, const BlasInt* AStride,
+        float* B, const BlasInt* BLDim, const BlasInt* BStride,
+  const BlasInt* batchSize );
+void EL_BLAS(dtrsm_batch_strided)
+( const char* side, const char* uplo, const char* trans, const char* diag,
+  const BlasInt* m, const BlasInt* n,
+  const double* alpha,
+  const double* A, const BlasInt* ALDim, const BlasInt* AStride,
+        double* B, const BlasInt* BLDim, const BlasInt* BStride,
+  const BlasInt* batchSize );
+void EL_BLAS(ctrsm_batch_strided)
+( const char* side, const char* uplo, const char* trans, const char* diag,
+  const BlasInt* m, const BlasInt* n,
+  const scomplex* alpha,
+  const scomplex* A, const BlasInt* ALDim, const BlasInt* AStride,
+        scomplex* B, const BlasInt* BLDim, const BlasInt* BStride,
+  const BlasInt* batchSize );
+void EL_BLAS(ztrsm_batch_strided)
+( const char* side, const char* uplo, const char* trans, const char* diag,
+  const BlasInt* m, const BlasInt* n,
+  const dcomplex* alpha,
+  const dcomplex* A, const BlasInt* ALDim, const BlasInt* AStride,
+        dcomplex* B, const BlasInt* BLDim, const BlasInt* BStride,
+  const BlasInt* batchSize );
+#endif
+
 } // extern "C"
 
 namespace El {
@@ -458,6 +526,117 @@ void Trrk
 }
 #endif
 
+#ifdef HYDROGEN_HAVE_MKL_BATCH_STRIDED
+void GemmBatchStrided
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+        float alpha,
+  const float* A, BlasInt ALDim, BlasInt AStride,
+  const float* B, BlasInt BLDim, BlasInt BStride,
+        float beta,
+        float* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchSize )
+{
+    EL_BLAS(sgemm_batch_strided)
+    ( &transA, &transB, &m, &n, &k,
+      &alpha, A, &ALDim, &AStride, B, &BLDim, &BStride,
+      &beta,  C, &CLDim, &CStride, &batchSize );
+}
+void GemmBatchStrided
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+        double alpha,
+  const double* A, BlasInt ALDim, BlasInt AStride,
+  const double* B, BlasInt BLDim, BlasInt BStride,
+        double beta,
+        double* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchSize )
+{
+    EL_BLAS(dgemm_batch_strided)
+    ( &transA, &transB, &m, &n, &k,
+      &alpha, A, &ALDim, &AStride, B, &BLDim, &BStride,
+      &beta,  C, &CLDim, &CStride, &batchSize );
+}
+void GemmBatchStrided
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+        scomplex alpha,
+  const scomplex* A, BlasInt ALDim, BlasInt AStride,
+  const scomplex* B, BlasInt BLDim, BlasInt BStride,
+        scomplex beta,
+        scomplex* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchSize )
+{
+    EL_BLAS(cgemm_batch_strided)
+    ( &transA, &transB, &m, &n, &k,
+      &alpha, A, &ALDim, &AStride, B, &BLDim, &BStride,
+      &beta,  C, &CLDim, &CStride, &batchSize );
+}
+void GemmBatchStrided
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+        dcomplex alpha,
+  const dcomplex* A, BlasInt ALDim, BlasInt AStride,
+  const dcomplex* B, BlasInt BLDim, BlasInt BStride,
+        dcomplex beta,
+        dcomplex* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchSize )
+{
+    EL_BLAS(zgemm_batch_strided)
+    ( &transA, &transB, &m, &n, &k,
+      &alpha, A, &ALDim, &AStride, B, &BLDim, &BStride,
+      &beta,  C, &CLDim, &CStride, &batchSize );
+}
+void TrsmBatchStrided
+( char side, char uplo, char trans, char diag,
+  BlasInt m, BlasInt n,
+        float alpha,
+  const float* A, BlasInt ALDim, BlasInt AStride,
+        float* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchSize )
+{
+    EL_BLAS(strsm_batch_strided)
+    ( &side, &uplo, &trans, &diag, &m, &n,
+      &alpha, A, &ALDim, &AStride, B, &BLDim, &BStride, &batchSize );
+}
+void TrsmBatchStrided
+( char side, char uplo, char trans, char diag,
+  BlasInt m, BlasInt n,
+        double alpha,
+  const double* A, BlasInt ALDim, BlasInt AStride,
+        double* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchSize )
+{
+    EL_BLAS(dtrsm_batch_strided)
+    ( &side, &uplo, &trans, &diag, &m, &n,
+      &alpha, A, &ALDim, &AStride, B, &BLDim, &BStride, &batchSize );
+}
+void TrsmBatchStrided
+( char side, char uplo, char trans, char diag,
+  BlasInt m, BlasInt n,
+        scomplex alpha,
+  const scomplex* A, BlasInt ALDim, BlasInt AStride,
+        scomplex* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchSize )
+{
+    EL_BLAS(ctrsm_batch_strided)
+    ( &side, &uplo, &trans, &diag, &m, &n,
+      &alpha, A, &ALDim, &AStride, B, &BLDim, &BStride, &batchSize );
+}
+void TrsmBatchStrided
+( char side, char uplo, char trans, char diag,
+  BlasInt m, BlasInt n,
+        dcomplex alpha,
+  const dcomplex* A, BlasInt ALDim, BlasInt AStride,
+        dcomplex* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchSize )
+{
+    EL_BLAS(ztrsm_batch_strided)
+    ( &side, &uplo, &trans, &diag, &m, &n,
+      &alpha, A, &ALDim, &AStride, B, &BLDim, &BStride, &batchSize );
+}
+#endif
+
 } // namespace mkl
 } // namespace El
 
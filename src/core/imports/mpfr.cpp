@@ -13,6 +13,7 @@ namespace {
 
 size_t numLimbs;
 int numIntLimbs;
+bool contiguousLimbs = false;
 
 El::BigInt bigIntZero, bigIntOne, bigIntTwo;
 
@@ -47,6 +48,12 @@ void SetPrecision( mpfr_prec_t prec )
     previouslySet = true;
 }
 
+void SetContiguousLimbs( bool contiguous )
+{ ::contiguousLimbs = contiguous; }
+
+bool ContiguousLimbs()
+{ return ::contiguousLimbs; }
+
 void SetMinIntBits( int numBits )
 { 
     static bool previouslySet = false;
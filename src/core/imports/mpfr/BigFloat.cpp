@@ -28,6 +28,9 @@ mpfr_ptr BigFloat::Pointer()
 mpfr_srcptr BigFloat::LockedPointer() const
 { return mpfrFloat_; }
 
+bool BigFloat::OwnsLimbs() const
+{ return ownsLimbs_; }
+
 mpfr_sign_t BigFloat::Sign() const
 { return mpfrFloat_->_mpfr_sign; }
 
@@ -39,8 +42,18 @@ mpfr_prec_t BigFloat::Precision() const
 
 void BigFloat::SetPrecision( mpfr_prec_t prec )
 {
-    mpfr_set_prec( mpfrFloat_, prec ); 
-    SetNumLimbs( prec );
+    if( ownsLimbs_ )
+    {
+        mpfr_set_prec( mpfrFloat_, prec ); 
+        SetNumLimbs( prec );
+    }
+    else
+    {
+        // Borrowed limbs cannot be reallocated, so migrate to our own
+        // storage (mpfr_set_prec would also have set the value to NaN)
+        Init( prec );
+        ownsLimbs_ = true;
+    }
 }
 
 size_t BigFloat::NumLimbs() const
@@ -52,6 +65,15 @@ BigFloat::BigFloat()
     Init();
 }
 
+BigFloat::BigFloat( mp_limb_t* limbs, mpfr_prec_t prec, bool )
+: ownsLimbs_(false)
+{
+    EL_DEBUG_CSE
+    mpfr_custom_init( limbs, prec );
+    mpfr_custom_init_set( mpfrFloat_, MPFR_NAN_KIND, 0, prec, limbs );
+    SetNumLimbs( prec );
+}
+
 // Copy constructors
 // -----------------
 BigFloat::BigFloat( const BigFloat& a, mpfr_prec_t prec )
@@ -223,15 +245,24 @@ BigFloat::BigFloat( const std::string& str, int base, mpfr_prec_t prec )
 BigFloat::BigFloat( BigFloat&& a )
 {
     EL_DEBUG_CSE
-    Pointer()->_mpfr_d = 0;
-    mpfr_swap( Pointer(), a.Pointer() );
-    std::swap( numLimbs_, a.numLimbs_ );
+    if( a.ownsLimbs_ )
+    {
+        Pointer()->_mpfr_d = 0;
+        mpfr_swap( Pointer(), a.Pointer() );
+        std::swap( numLimbs_, a.numLimbs_ );
+    }
+    else
+    {
+        // Borrowed limbs must not outlive their buffer, so copy
+        Init( a.Precision() );
+        mpfr_set( mpfrFloat_, a.mpfrFloat_, mpfr::RoundingMode() );
+    }
 }
 
 BigFloat::~BigFloat()
 {
     EL_DEBUG_CSE
-    if( Pointer()->_mpfr_d != 0 )
+    if( ownsLimbs_ && Pointer()->_mpfr_d != 0 )
         mpfr_clear( Pointer() );
 }
 
@@ -395,8 +426,18 @@ BigFloat& BigFloat::operator=( const Quad& a )
 BigFloat& BigFloat::operator=( BigFloat&& a )
 {
     EL_DEBUG_CSE
-    mpfr_swap( Pointer(), a.Pointer() );
-    std::swap( numLimbs_, a.numLimbs_ );
+    if( ownsLimbs_ && a.ownsLimbs_ )
+    {
+        mpfr_swap( Pointer(), a.Pointer() );
+        std::swap( numLimbs_, a.numLimbs_ );
+    }
+    else
+    {
+        // Borrowed limbs can neither be handed off nor resized
+        if( ownsLimbs_ && Precision() != a.Precision() )
+            SetPrecision( a.Precision() );
+        mpfr_set( Pointer(), a.LockedPointer(), mpfr::RoundingMode() );
+    }
     return *this;
 }
 
@@ -1405,6 +1446,38 @@ std::istream& operator>>( std::istream& is, BigFloat& alpha )
     return is;
 }
 
+namespace mpfr {
+
+BigFloat* NewContiguous( size_t size )
+{
+    EL_DEBUG_CSE
+    const mpfr_prec_t prec = Precision();
+    const size_t numLimbs = (prec-1) / GMP_NUMB_BITS + 1;
+    // The entries are followed by their limbs
+    const size_t limbAlign = alignof(mp_limb_t);
+    const size_t entryBytes =
+      ((size*sizeof(BigFloat)+limbAlign-1)/limbAlign)*limbAlign;
+    byte* raw = new byte[entryBytes+size*numLimbs*sizeof(mp_limb_t)];
+    BigFloat* buffer = reinterpret_cast<BigFloat*>(raw);
+    mp_limb_t* limbs = reinterpret_cast<mp_limb_t*>(raw+entryBytes);
+    for( size_t i=0; i<size; ++i )
+        new(buffer+i) BigFloat( limbs+i*numLimbs, prec, true );
+    return buffer;
+}
+
+void DeleteContiguous( BigFloat* buffer, size_t size )
+{
+    EL_DEBUG_CSE
+    if( buffer == nullptr )
+        return;
+    // Entries which migrated to their own storage release it here
+    for( size_t i=0; i<size; ++i )
+        buffer[i].~BigFloat();
+    delete[] reinterpret_cast<byte*>(buffer);
+}
+
+} // namespace mpfr
+
 } // namespace El
 
 #endif // ifdef HYDROGEN_HAVE_MPC
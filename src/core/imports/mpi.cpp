@@ -14,6 +14,8 @@
 */
 #include <El-lite.hpp>
 
+#include <map>
+
 typedef unsigned char* UCP;
 
 namespace {
@@ -49,6 +51,16 @@ MPI_Op NativeOp( const El::mpi::Op& op )
     return opC;
 }
 
+// The total of the per-process counts of a variable-length collective
+inline double SumCounts( const int* counts, El::mpi::Comm comm )
+{
+    double total = 0;
+    const int commSize = El::mpi::Size( comm );
+    for( int q=0; q<commSize; ++q )
+        total += counts[q];
+    return total;
+}
+
 } // anonymous namespace
 
 namespace El {
@@ -176,12 +188,632 @@ void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
     SafeMpi( MPI_Comm_split( comm.comm, color, key, &newComm.comm ) );
 }
 
+void SplitShared( Comm comm, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#if MPI_VERSION >= 3
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( comm.comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL, &newComm.comm ) );
+#else
+    // Conservatively assume that no two processes share a node
+    SafeMpi
+    ( MPI_Comm_split( comm.comm, Rank(comm), key, &newComm.comm ) );
+#endif
+}
+
+namespace {
+
+// The node and node-leader communicators of a communicator registered for
+// two-level collectives, along with its ranks ordered node by node (where
+// the nodes are ordered by their smallest rank)
+struct HierarchicalInfo
+{
+    Comm nodeComm, leaderComm;
+    bool contiguous;
+    vector<int> nodeSizes, nodeOffsets, nodeMajorRanks;
+};
+
+std::map<MPI_Comm,HierarchicalInfo> hierarchicalInfos;
+
+const HierarchicalInfo* FindHierarchical( Comm comm ) EL_NO_EXCEPT
+{
+    if( hierarchicalInfos.empty() )
+        return nullptr;
+    auto it = hierarchicalInfos.find( comm.comm );
+    return ( it == hierarchicalInfos.end() ? nullptr : &it->second );
+}
+
+} // anonymous namespace
+
+bool EnableHierarchicalCollectives( Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( HierarchicalCollectives(comm) )
+        return true;
+    const int commRank = Rank( comm );
+    const int commSize = Size( comm );
+
+    HierarchicalInfo info;
+    SplitShared( comm, commRank, info.nodeComm );
+    const int nodeRank = Rank( info.nodeComm );
+    const int nodeLeader = AllReduce( commRank, MIN, info.nodeComm );
+    vector<int> nodeLeaders(commSize);
+    AllGather( &nodeLeader, 1, nodeLeaders.data(), 1, comm );
+
+    vector<int> leaderToNode(commSize,-1), rankToNode(commSize);
+    int maxNodeSize = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        int& node = leaderToNode[nodeLeaders[q]];
+        if( node < 0 )
+        {
+            node = info.nodeSizes.size();
+            info.nodeSizes.push_back( 0 );
+        }
+        rankToNode[q] = node;
+        maxNodeSize = Max( maxNodeSize, ++info.nodeSizes[node] );
+    }
+    const int numNodes = info.nodeSizes.size();
+    if( numNodes == 1 || maxNodeSize == 1 )
+    {
+        Free( info.nodeComm );
+        return false;
+    }
+    Split
+    ( comm, ( nodeRank == 0 ? 0 : UNDEFINED ), commRank, info.leaderComm );
+
+    info.nodeOffsets.resize( numNodes );
+    for( int node=1; node<numNodes; ++node )
+        info.nodeOffsets[node] =
+          info.nodeOffsets[node-1] + info.nodeSizes[node-1];
+    vector<int> nodeCounts(numNodes,0);
+    info.nodeMajorRanks.resize( commSize );
+    info.contiguous = true;
+    for( int q=0; q<commSize; ++q )
+    {
+        const int node = rankToNode[q];
+        const int p = info.nodeOffsets[node] + nodeCounts[node]++;
+        info.nodeMajorRanks[p] = q;
+        info.contiguous = info.contiguous && ( p == q );
+    }
+
+    // Name the subcommunicators after their parent for the profiler
+    const string name = Name( comm );
+    SetName( info.nodeComm, name+"/Node" );
+    if( info.leaderComm != COMM_NULL )
+        SetName( info.leaderComm, name+"/NodeLeader" );
+
+    hierarchicalInfos[comm.comm] = info;
+    return true;
+}
+
+void DisableHierarchicalCollectives( Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    auto it = hierarchicalInfos.find( comm.comm );
+    if( it == hierarchicalInfos.end() )
+        return;
+    HierarchicalInfo info = it->second;
+    hierarchicalInfos.erase( it );
+    if( info.leaderComm != COMM_NULL )
+        Free( info.leaderComm );
+    Free( info.nodeComm );
+}
+
+bool HierarchicalCollectives( Comm comm ) EL_NO_EXCEPT
+{ return FindHierarchical( comm ) != nullptr; }
+
+namespace {
+
+template<typename T>
+void HierarchicalAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, const HierarchicalInfo& info )
+EL_NO_RELEASE_EXCEPT
+{
+    if( sbuf != rbuf )
+        MemCopy( rbuf, sbuf, count );
+    Reduce( rbuf, count, op, 0, info.nodeComm );
+    if( info.leaderComm != COMM_NULL )
+        AllReduce( rbuf, count, op, info.leaderComm );
+    Broadcast( rbuf, count, 0, info.nodeComm );
+}
+
+template<typename T>
+void HierarchicalAllGather
+( const T* sbuf, int sc, T* rbuf, int rc, const HierarchicalInfo& info )
+EL_NO_RELEASE_EXCEPT
+{
+    const int commSize = info.nodeMajorRanks.size();
+    const int nodeSize = Size( info.nodeComm );
+    const bool leader = ( info.leaderComm != COMM_NULL );
+
+    vector<T> nodeBuf( leader ? nodeSize*rc : 0 );
+    Gather( sbuf, sc, nodeBuf.data(), rc, 0, info.nodeComm );
+    if( leader )
+    {
+        const int numNodes = info.nodeSizes.size();
+        vector<int> rcs(numNodes), rds(numNodes);
+        for( int node=0; node<numNodes; ++node )
+        {
+            rcs[node] = info.nodeSizes[node]*rc;
+            rds[node] = info.nodeOffsets[node]*rc;
+        }
+        vector<T> nodeMajorBuf( info.contiguous ? 0 : commSize*rc );
+        T* recvBuf = ( info.contiguous ? rbuf : nodeMajorBuf.data() );
+        AllGather
+        ( nodeBuf.data(), nodeSize*rc, recvBuf, rcs.data(), rds.data(),
+          info.leaderComm );
+        if( !info.contiguous )
+            for( int p=0; p<commSize; ++p )
+                MemCopy
+                ( &rbuf[info.nodeMajorRanks[p]*rc], &nodeMajorBuf[p*rc], rc );
+    }
+    Broadcast( rbuf, commSize*rc, 0, info.nodeComm );
+}
+
+// As in the Reduce/Scatter fallback of ReduceScatter, the send buffer is
+// overwritten
+template<typename T>
+void HierarchicalReduceScatter
+( T* sbuf, T* rbuf, int rc, Op op, const HierarchicalInfo& info )
+EL_NO_RELEASE_EXCEPT
+{
+    const int commSize = info.nodeMajorRanks.size();
+    const int nodeSize = Size( info.nodeComm );
+    const bool leader = ( info.leaderComm != COMM_NULL );
+
+    Reduce( sbuf, commSize*rc, op, 0, info.nodeComm );
+    vector<T> nodeBuf( leader ? nodeSize*rc : 0 );
+    if( leader )
+    {
+        vector<T> nodeMajorBuf( info.contiguous ? 0 : commSize*rc );
+        if( !info.contiguous )
+            for( int p=0; p<commSize; ++p )
+                MemCopy
+                ( &nodeMajorBuf[p*rc], &sbuf[info.nodeMajorRanks[p]*rc], rc );
+        const T* sendBuf = ( info.contiguous ? sbuf : nodeMajorBuf.data() );
+        const int numNodes = info.nodeSizes.size();
+        vector<int> rcs(numNodes);
+        for( int node=0; node<numNodes; ++node )
+            rcs[node] = info.nodeSizes[node]*rc;
+        ReduceScatter
+        ( sendBuf, nodeBuf.data(), rcs.data(), op, info.leaderComm );
+    }
+    Scatter( nodeBuf.data(), rc, rbuf, rc, 0, info.nodeComm );
+}
+
+
+ReduceScatterAlgorithm reduceScatterAlgorithm = REDUCE_SCATTER_NATIVE;
+
+// With p' the largest power of two no larger than the communicator size p,
+// the first 2 (p-p') processes are folded pairwise onto their odd members
+// so that p' participants remain, the first p-p' of which own the blocks of
+// two processes. Each participant then repeatedly exchanges the half of
+// its remaining (contiguous) range of blocks which its partner owns and
+// reduces the half which it keeps, before the folded processes receive
+// their blocks from the partners which absorbed them.
+template<typename T>
+void RecursiveHalvingReduceScatter
+( const T* sbuf, T* rbuf, int rc, MPI_Datatype type, MPI_Op opC, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    if( commSize == 1 )
+    {
+        if( rbuf != sbuf )
+            MemCopy( rbuf, sbuf, rc );
+        return;
+    }
+    int pof2 = 1;
+    while( 2*pof2 <= commSize )
+        pof2 *= 2;
+    const int numFolded = commSize - pof2;
+    const int totalSize = commSize*rc;
+    Status status;
+
+    if( commRank < 2*numFolded && commRank % 2 == 0 )
+    {
+        SafeMpi
+        ( MPI_Send
+          ( const_cast<T*>(sbuf), totalSize, type, commRank+1, 0,
+            comm.comm ) );
+        SafeMpi
+        ( MPI_Recv( rbuf, rc, type, commRank+1, 0, comm.comm, &status ) );
+        return;
+    }
+
+    vector<T> work( sbuf, sbuf+totalSize ), recvBuf;
+    FastResize( recvBuf, totalSize );
+    if( commRank < 2*numFolded )
+    {
+        SafeMpi
+        ( MPI_Recv
+          ( recvBuf.data(), totalSize, type, commRank-1, 0, comm.comm,
+            &status ) );
+        SafeMpi
+        ( MPI_Reduce_local
+          ( recvBuf.data(), work.data(), totalSize, type, opC ) );
+    }
+
+    // The real rank of the (sole or odd) process of each participant and
+    // the first of the blocks which it owns
+    auto realRank =
+      [&]( int v ) { return v < numFolded ? 2*v+1 : v+numFolded; };
+    auto firstBlock =
+      [&]( int v ) { return v < numFolded ? 2*v : v+numFolded; };
+
+    const int virtRank =
+      ( commRank < 2*numFolded ? commRank/2 : commRank-numFolded );
+    int lo=0, hi=pof2;
+    for( int mask=pof2/2; mask>0; mask/=2 )
+    {
+        const int mid = lo + mask;
+        const bool keepLower = ( virtRank < mid );
+        const int keepLo = ( keepLower ? lo : mid );
+        const int keepHi = ( keepLower ? mid : hi );
+        const int sendLo = ( keepLower ? mid : lo );
+        const int sendHi = ( keepLower ? hi : mid );
+        const int sendOff = firstBlock(sendLo)*rc;
+        const int keepOff = firstBlock(keepLo)*rc;
+        const int sendSize =
+          ( sendHi == pof2 ? totalSize : firstBlock(sendHi)*rc ) - sendOff;
+        const int keepSize =
+          ( keepHi == pof2 ? totalSize : firstBlock(keepHi)*rc ) - keepOff;
+        const int partner = realRank( virtRank ^ mask );
+        SafeMpi
+        ( MPI_Sendrecv
+          ( &work[sendOff],  sendSize, type, partner, 0,
+            recvBuf.data(), keepSize, type, partner, 0,
+            comm.comm, &status ) );
+        SafeMpi
+        ( MPI_Reduce_local
+          ( recvBuf.data(), &work[keepOff], keepSize, type, opC ) );
+        lo = keepLo;
+        hi = keepHi;
+    }
+
+    if( virtRank < numFolded )
+        SafeMpi
+        ( MPI_Send
+          ( &work[(commRank-1)*rc], rc, type, commRank-1, 0, comm.comm ) );
+    MemCopy( rbuf, &work[commRank*rc], rc );
+}
+
+template<typename Real>
+void RecursiveHalvingComplexReduceScatter
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+#ifdef EL_AVOID_COMPLEX_MPI
+    RecursiveHalvingReduceScatter
+    ( reinterpret_cast<const Real*>(sbuf), reinterpret_cast<Real*>(rbuf),
+      2*rc, TypeMap<Real>(), NativeOp<Real>(op), comm );
+#else
+    RecursiveHalvingReduceScatter
+    ( sbuf, rbuf, rc, TypeMap<Complex<Real>>(), NativeOp<Complex<Real>>(op),
+      comm );
+#endif
+}
+
+} // anonymous namespace
+
+void SetReduceScatterAlgorithm( ReduceScatterAlgorithm alg ) EL_NO_EXCEPT
+{ reduceScatterAlgorithm = alg; }
+
+ReduceScatterAlgorithm GetReduceScatterAlgorithm() EL_NO_EXCEPT
+{ return reduceScatterAlgorithm; }
+
+SharedWindow::SharedWindow( Comm nodeComm ) : nodeComm_(nodeComm) { }
+
+SharedWindow::~SharedWindow()
+{
+    if( !Finalized() )
+        Free();
+}
+
+void* SharedWindow::Require( size_t numBytes )
+{
+    EL_DEBUG_CSE
+    if( numBytes <= size_ && buffer_ != nullptr )
+        return buffer_;
+    Free();
+#if MPI_VERSION >= 3
+    // The first process of the node allocates the entire buffer so that it
+    // is contiguous, and the others query its address
+    const MPI_Aint localBytes = ( Rank(nodeComm_) == 0 ? numBytes : 0 );
+    void* localBuffer;
+    SafeMpi
+    ( MPI_Win_allocate_shared
+      ( localBytes, 1, MPI_INFO_NULL, nodeComm_.comm, &localBuffer,
+        &window_ ) );
+    MPI_Aint rootBytes;
+    int dispUnit;
+    SafeMpi
+    ( MPI_Win_shared_query( window_, 0, &rootBytes, &dispUnit, &buffer_ ) );
+    // Keep a passive-target epoch open so that MPI_Win_sync may be used
+    SafeMpi( MPI_Win_lock_all( MPI_MODE_NOCHECK, window_ ) );
+#else
+    buffer_ = new char[numBytes];
+#endif
+    size_ = numBytes;
+    return buffer_;
+}
+
+void* SharedWindow::Buffer() const EL_NO_EXCEPT { return buffer_; }
+size_t SharedWindow::Size() const EL_NO_EXCEPT { return size_; }
+
+void SharedWindow::Synchronize()
+{
+    EL_DEBUG_CSE
+#if MPI_VERSION >= 3
+    if( window_ != MPI_WIN_NULL )
+        SafeMpi( MPI_Win_sync( window_ ) );
+    Barrier( nodeComm_ );
+    if( window_ != MPI_WIN_NULL )
+        SafeMpi( MPI_Win_sync( window_ ) );
+#endif
+}
+
+void SharedWindow::Free()
+{
+    EL_DEBUG_CSE
+#if MPI_VERSION >= 3
+    if( window_ != MPI_WIN_NULL )
+    {
+        SafeMpi( MPI_Win_unlock_all( window_ ) );
+        SafeMpi( MPI_Win_free( &window_ ) );
+    }
+#else
+    delete[] static_cast<char*>(buffer_);
+#endif
+    buffer_ = nullptr;
+    size_ = 0;
+}
+
+// Parallel file I/O
+// =================
+
+namespace {
+
+FileHints fileHints;
+
+// Merge consecutive indices into (start,length) runs
+void IndexRuns
+( const vector<Int>& indices, vector<int>& starts, vector<int>& lengths )
+{
+    starts.resize( 0 );
+    lengths.resize( 0 );
+    for( const Int index : indices )
+    {
+        if( !starts.empty() && starts.back()+lengths.back() == index )
+        {
+            ++lengths.back();
+        }
+        else
+        {
+            starts.push_back( int(index) );
+            lengths.push_back( 1 );
+        }
+    }
+}
+
+// Select the entries of the file and of the local buffer to transfer. Both
+// datatypes are MPI_BYTE, with a count of zero, if this process owns none.
+void FileTransferTypes
+( Int height, Int entrySize,
+  const vector<Int>& rows, const vector<Int>& cols, Int ldim,
+  MPI_Datatype& fileType, MPI_Datatype& memType )
+{
+    EL_DEBUG_CSE
+    fileType = memType = MPI_BYTE;
+    if( rows.empty() || cols.empty() )
+        return;
+
+    MPI_Datatype entryType, colType, paddedColType;
+    SafeMpi( MPI_Type_contiguous( int(entrySize), MPI_BYTE, &entryType ) );
+
+    // The owned entries of a single column, padded out to the full column
+    // so that the column runs can be expressed in units of columns
+    vector<int> starts, lengths;
+    IndexRuns( rows, starts, lengths );
+    SafeMpi
+    ( MPI_Type_indexed
+      ( int(starts.size()), lengths.data(), starts.data(), entryType,
+        &colType ) );
+    SafeMpi
+    ( MPI_Type_create_resized
+      ( colType, 0, MPI_Aint(height)*entrySize, &paddedColType ) );
+    IndexRuns( cols, starts, lengths );
+    SafeMpi
+    ( MPI_Type_indexed
+      ( int(starts.size()), lengths.data(), starts.data(), paddedColType,
+        &fileType ) );
+    SafeMpi( MPI_Type_commit( &fileType ) );
+
+    SafeMpi
+    ( MPI_Type_vector
+      ( int(cols.size()), int(rows.size()), int(ldim), entryType,
+        &memType ) );
+    SafeMpi( MPI_Type_commit( &memType ) );
+
+    SafeMpi( MPI_Type_free( &paddedColType ) );
+    SafeMpi( MPI_Type_free( &colType ) );
+    SafeMpi( MPI_Type_free( &entryType ) );
+}
+
+void FreeTransferTypes( MPI_Datatype& fileType, MPI_Datatype& memType )
+{
+    if( fileType != MPI_BYTE )
+        SafeMpi( MPI_Type_free( &fileType ) );
+    if( memType != MPI_BYTE )
+        SafeMpi( MPI_Type_free( &memType ) );
+}
+
+} // anonymous namespace
+
+void SetFileHints( const FileHints& hints )
+{
+    EL_DEBUG_CSE
+    if( hints.stripeCount < 0 || hints.stripeSize < 0 ||
+        hints.numAggregators < 0 )
+        LogicError("File hints must be non-negative");
+    fileHints = hints;
+}
+
+const FileHints& GetFileHints() EL_NO_EXCEPT { return fileHints; }
+
+void FileOpen( Comm comm, const string& filename, bool write, File& file )
+{
+    EL_DEBUG_CSE
+    MPI_Info info;
+    SafeMpi( MPI_Info_create( &info ) );
+    // The striping hints only take effect when the file is created
+    if( fileHints.stripeCount > 0 )
+        SafeMpi
+        ( MPI_Info_set
+          ( info, const_cast<char*>("striping_factor"),
+            const_cast<char*>(std::to_string(fileHints.stripeCount).c_str())
+          ) );
+    if( fileHints.stripeSize > 0 )
+        SafeMpi
+        ( MPI_Info_set
+          ( info, const_cast<char*>("striping_unit"),
+            const_cast<char*>(std::to_string(fileHints.stripeSize).c_str())
+          ) );
+    if( fileHints.numAggregators > 0 )
+        SafeMpi
+        ( MPI_Info_set
+          ( info, const_cast<char*>("cb_nodes"),
+            const_cast<char*>
+            (std::to_string(fileHints.numAggregators).c_str()) ) );
+    // Aggregate the strided accesses into large, stripe-aligned requests
+    // rather than relying upon data sieving, which requires file locking
+    SafeMpi
+    ( MPI_Info_set
+      ( info, const_cast<char*>("romio_cb_read"),
+        const_cast<char*>("enable") ) );
+    SafeMpi
+    ( MPI_Info_set
+      ( info, const_cast<char*>("romio_cb_write"),
+        const_cast<char*>("enable") ) );
+    SafeMpi
+    ( MPI_Info_set
+      ( info, const_cast<char*>("romio_ds_write"),
+        const_cast<char*>("disable") ) );
+
+    const int mode =
+      write ? MPI_MODE_CREATE | MPI_MODE_WRONLY : MPI_MODE_RDONLY;
+    const int err =
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()), mode, info, &file );
+    SafeMpi( MPI_Info_free( &info ) );
+    if( err != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+    if( write )
+        SafeMpi( MPI_File_set_size( file, 0 ) );
+}
+
+void FileClose( File& file ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_File_close( &file ) );
+}
+
+Int FileSize( File file ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    MPI_Offset size;
+    SafeMpi( MPI_File_get_size( file, &size ) );
+    return Int(size);
+}
+
+void FileReadAt
+( File file, Int offset, void* buffer, Int numBytes ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    MPI_Status status;
+    SafeMpi
+    ( MPI_File_read_at
+      ( file, MPI_Offset(offset), buffer, int(numBytes), MPI_BYTE,
+        &status ) );
+}
+
+void FileWriteAt
+( File file, Int offset, const void* buffer, Int numBytes )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    MPI_Status status;
+    SafeMpi
+    ( MPI_File_write_at
+      ( file, MPI_Offset(offset), const_cast<void*>(buffer), int(numBytes),
+        MPI_BYTE, &status ) );
+}
+
+void FileReadAll
+( File file, Int offset, Int height, Int entrySize,
+  const vector<Int>& rows, const vector<Int>& cols,
+  void* buffer, Int ldim ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    MPI_Datatype fileType, memType;
+    FileTransferTypes( height, entrySize, rows, cols, ldim, fileType, memType );
+    const int count = ( fileType == MPI_BYTE ? 0 : 1 );
+    SafeMpi
+    ( MPI_File_set_view
+      ( file, MPI_Offset(offset), MPI_BYTE, fileType,
+        const_cast<char*>("native"), MPI_INFO_NULL ) );
+    MPI_Status status;
+    SafeMpi( MPI_File_read_all( file, buffer, count, memType, &status ) );
+    FreeTransferTypes( fileType, memType );
+}
+
+void FileWriteAll
+( File file, Int offset, Int height, Int entrySize,
+  const vector<Int>& rows, const vector<Int>& cols,
+  const void* buffer, Int ldim ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    MPI_Datatype fileType, memType;
+    FileTransferTypes( height, entrySize, rows, cols, ldim, fileType, memType );
+    const int count = ( fileType == MPI_BYTE ? 0 : 1 );
+    SafeMpi
+    ( MPI_File_set_view
+      ( file, MPI_Offset(offset), MPI_BYTE, fileType,
+        const_cast<char*>("native"), MPI_INFO_NULL ) );
+    MPI_Status status;
+    SafeMpi
+    ( MPI_File_write_all
+      ( file, const_cast<void*>(buffer), count, memType, &status ) );
+    FreeTransferTypes( fileType, memType );
+}
+
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    DisableHierarchicalCollectives( comm );
     SafeMpi( MPI_Comm_free( &comm.comm ) );
 }
 
+void SetName( Comm comm, const string& name ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Comm_set_name( comm.comm, const_cast<char*>(name.c_str()) ) );
+}
+
+string Name( Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( comm == COMM_NULL )
+        return "null";
+    char name[MPI_MAX_OBJECT_NAME];
+    int length;
+    SafeMpi( MPI_Comm_get_name( comm.comm, name, &length ) );
+    return string( name, length );
+}
+
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -552,6 +1184,7 @@ void TaggedSend( const Real* buf, int count, int to, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI_P2P( "Send", count*sizeof(Real), comm );
     SafeMpi
     ( MPI_Send
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, tag, comm.comm ) );
@@ -564,6 +1197,7 @@ void TaggedSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI_P2P( "Send", count*sizeof(Complex<Real>), comm );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Send
@@ -583,6 +1217,7 @@ template<typename T,
 void TaggedSend( const T* buf, int count, int to, int tag, Comm comm )
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI_P2P( "Send", count*sizeof(T), comm );
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     SafeMpi
@@ -796,6 +1431,7 @@ void TaggedRecv( Real* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI_P2P( "Recv", count*sizeof(Real), comm );
     Status status;
     SafeMpi
     ( MPI_Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
@@ -807,6 +1443,7 @@ void TaggedRecv( Complex<Real>* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI_P2P( "Recv", count*sizeof(Complex<Real>), comm );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -824,6 +1461,7 @@ template<typename T,
 void TaggedRecv( T* buf, int count, int from, int tag, Comm comm )
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI_P2P( "Recv", count*sizeof(T), comm );
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Status status;
@@ -889,31 +1527,192 @@ void TaggedIRecv
 ( T* buf, int count, int from, int tag, Comm comm, Request<T>& request )
 EL_NO_RELEASE_EXCEPT
 {
-    EL_DEBUG_CSE
-    request.receivingPacked = true;
-    request.recvCount = count;
-    request.unpackedRecvBuf = buf;
-    ReserveSerialized( count, buf, request.buffer );
-    SafeMpi
-    ( MPI_Irecv
-      ( request.buffer.data(), count, TypeMap<T>(), from, tag, comm.comm,
-        &request.backend ) );
+    EL_DEBUG_CSE
+    request.receivingPacked = true;
+    request.recvCount = count;
+    request.unpackedRecvBuf = buf;
+    ReserveSerialized( count, buf, request.buffer );
+    SafeMpi
+    ( MPI_Irecv
+      ( request.buffer.data(), count, TypeMap<T>(), from, tag, comm.comm,
+        &request.backend ) );
+}
+
+template<typename T>
+void IRecv( T* buf, int count, int from, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{ TaggedIRecv( buf, count, from, ANY_TAG, comm, request ); }
+
+template<typename T>
+T TaggedIRecv( int from, int tag, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{ T b; TaggedIRecv( &b, 1, from, tag, comm, request ); return b; }
+
+template<typename T>
+T IRecv( int from, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{ return TaggedIRecv<T>( from, ANY_TAG, comm, request ); }
+
+// Reduced-precision wire formats
+// ==============================
+namespace {
+
+WireFormat wireFormat = WIRE_FULL;
+
+// The number of bytes per entry on the wire (zero if sent as is)
+template<typename Real>
+int WireSize() EL_NO_EXCEPT;
+template<>
+int WireSize<double>() EL_NO_EXCEPT
+{
+    return wireFormat == WIRE_SINGLE ? 4 :
+           wireFormat == WIRE_BFLOAT16 ? 2 : 0;
+}
+template<>
+int WireSize<float>() EL_NO_EXCEPT
+{ return wireFormat == WIRE_BFLOAT16 ? 2 : 0; }
+
+template<typename Real>
+void ToWire( const Real* x, Int n, int wireSize, byte* wire ) EL_NO_EXCEPT
+{
+    if( wireSize == 4 )
+    {
+        for( Int i=0; i<n; ++i )
+        {
+            const float alpha = float(x[i]);
+            std::memcpy( &wire[4*i], &alpha, 4 );
+        }
+    }
+    else
+    {
+        for( Int i=0; i<n; ++i )
+        {
+            const std::uint16_t alpha = BFloat16( float(x[i]) ).Bits();
+            std::memcpy( &wire[2*i], &alpha, 2 );
+        }
+    }
+}
+
+template<typename Real>
+void FromWire( const byte* wire, Int n, int wireSize, Real* x ) EL_NO_EXCEPT
+{
+    if( wireSize == 4 )
+    {
+        for( Int i=0; i<n; ++i )
+        {
+            float alpha;
+            std::memcpy( &alpha, &wire[4*i], 4 );
+            x[i] = alpha;
+        }
+    }
+    else
+    {
+        for( Int i=0; i<n; ++i )
+        {
+            std::uint16_t alpha;
+            std::memcpy( &alpha, &wire[2*i], 2 );
+            x[i] = float(BFloat16::FromBits( alpha ));
+        }
+    }
+}
+
+// Each of the following returns false, without communicating, unless the
+// entries are narrowed on the wire. Complex buffers are passed as arrays of
+// twice as many real entries.
+
+template<typename Real>
+bool NarrowedSendRecvImpl
+( const Real* sbuf, int sc, int to,   int stag,
+        Real* rbuf, int rc, int from, int rtag, Comm comm )
+{
+    const int wireSize = WireSize<Real>();
+    if( wireSize == 0 )
+        return false;
+    vector<byte> sendWire( wireSize*sc ), recvWire( wireSize*rc );
+    ToWire( sbuf, sc, wireSize, sendWire.data() );
+    TaggedSendRecv
+    ( sendWire.data(), wireSize*sc, to,   stag,
+      recvWire.data(), wireSize*rc, from, rtag, comm );
+    FromWire( recvWire.data(), rc, wireSize, rbuf );
+    return true;
+}
+
+template<typename Real>
+bool NarrowedAllGatherImpl
+( const Real* sbuf, int sc, Real* rbuf, int rc, Comm comm )
+{
+    const int wireSize = WireSize<Real>();
+    if( wireSize == 0 )
+        return false;
+    const int commSize = Size( comm );
+    vector<byte> sendWire( wireSize*sc ), recvWire( wireSize*rc*commSize );
+    ToWire( sbuf, sc, wireSize, sendWire.data() );
+    AllGather
+    ( sendWire.data(), wireSize*sc, recvWire.data(), wireSize*rc, comm );
+    FromWire( recvWire.data(), rc*commSize, wireSize, rbuf );
+    return true;
+}
+
+template<typename Real>
+bool NarrowedAllToAllImpl
+( const Real* sbuf, int sc, Real* rbuf, int rc, Comm comm )
+{
+    const int wireSize = WireSize<Real>();
+    if( wireSize == 0 )
+        return false;
+    const int commSize = Size( comm );
+    vector<byte> sendWire( wireSize*sc*commSize ),
+                 recvWire( wireSize*rc*commSize );
+    ToWire( sbuf, sc*commSize, wireSize, sendWire.data() );
+    AllToAll
+    ( sendWire.data(), wireSize*sc, recvWire.data(), wireSize*rc, comm );
+    FromWire( recvWire.data(), rc*commSize, wireSize, rbuf );
+    return true;
 }
 
+// Only single and double-precision entries are narrowed
 template<typename T>
-void IRecv( T* buf, int count, int from, Comm comm, Request<T>& request )
-EL_NO_RELEASE_EXCEPT
-{ TaggedIRecv( buf, count, from, ANY_TAG, comm, request ); }
+bool NarrowedSendRecv
+( const T*, int, int, int, T*, int, int, int, Comm )
+{ return false; }
+bool NarrowedSendRecv
+( const float* sbuf, int sc, int to,   int stag,
+        float* rbuf, int rc, int from, int rtag, Comm comm )
+{ return NarrowedSendRecvImpl( sbuf, sc, to, stag, rbuf, rc, from, rtag,
+                               comm ); }
+bool NarrowedSendRecv
+( const double* sbuf, int sc, int to,   int stag,
+        double* rbuf, int rc, int from, int rtag, Comm comm )
+{ return NarrowedSendRecvImpl( sbuf, sc, to, stag, rbuf, rc, from, rtag,
+                               comm ); }
 
 template<typename T>
-T TaggedIRecv( int from, int tag, Comm comm, Request<T>& request )
-EL_NO_RELEASE_EXCEPT
-{ T b; TaggedIRecv( &b, 1, from, tag, comm, request ); return b; }
+bool NarrowedAllGather( const T*, int, T*, int, Comm )
+{ return false; }
+bool NarrowedAllGather
+( const float* sbuf, int sc, float* rbuf, int rc, Comm comm )
+{ return NarrowedAllGatherImpl( sbuf, sc, rbuf, rc, comm ); }
+bool NarrowedAllGather
+( const double* sbuf, int sc, double* rbuf, int rc, Comm comm )
+{ return NarrowedAllGatherImpl( sbuf, sc, rbuf, rc, comm ); }
 
 template<typename T>
-T IRecv( int from, Comm comm, Request<T>& request )
-EL_NO_RELEASE_EXCEPT
-{ return TaggedIRecv<T>( from, ANY_TAG, comm, request ); }
+bool NarrowedAllToAll( const T*, int, T*, int, Comm )
+{ return false; }
+bool NarrowedAllToAll
+( const float* sbuf, int sc, float* rbuf, int rc, Comm comm )
+{ return NarrowedAllToAllImpl( sbuf, sc, rbuf, rc, comm ); }
+bool NarrowedAllToAll
+( const double* sbuf, int sc, double* rbuf, int rc, Comm comm )
+{ return NarrowedAllToAllImpl( sbuf, sc, rbuf, rc, comm ); }
+
+} // anonymous namespace
+
+void SetWireFormat( WireFormat format ) EL_NO_EXCEPT
+{ wireFormat = format; }
+
+WireFormat GetWireFormat() EL_NO_EXCEPT
+{ return wireFormat; }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
@@ -923,6 +1722,9 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    if( NarrowedSendRecv( sbuf, sc, to, stag, rbuf, rc, from, rtag, comm ) )
+        return;
+    EL_TRACE_MPI_P2P( "SendRecv", (sc+rc)*sizeof(Real), comm );
     Status status;
     SafeMpi
     ( MPI_Sendrecv
@@ -939,6 +1741,11 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    if( NarrowedSendRecv
+        ( reinterpret_cast<const Real*>(sbuf), 2*sc, to,   stag,
+          reinterpret_cast<Real*>(rbuf),       2*rc, from, rtag, comm ) )
+        return;
+    EL_TRACE_MPI_P2P( "SendRecv", (sc+rc)*sizeof(Complex<Real>), comm );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -964,6 +1771,7 @@ void TaggedSendRecv
         T* rbuf, int rc, int from, int rtag, Comm comm )
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI_P2P( "SendRecv", (sc+rc)*sizeof(T), comm );
     Status status;
     std::vector<byte> packedSend, packedRecv;
     Serialize( sc, sbuf, packedSend );
@@ -1004,6 +1812,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI_P2P( "SendRecv", (2*count)*sizeof(Real), comm );
     Status status;
     SafeMpi
     ( MPI_Sendrecv_replace
@@ -1019,6 +1828,8 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI_P2P
+    ( "SendRecv", (2*count)*sizeof(Complex<Real>), comm );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1041,6 +1852,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI_P2P( "SendRecv", (2*count)*sizeof(T), comm );
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Serialize( count, buf, packedBuf );
@@ -1063,6 +1875,7 @@ void Broadcast( Real* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "Broadcast", count*sizeof(Real), comm );
     if( Size(comm) == 1 || count == 0 )
         return;
     SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
@@ -1074,6 +1887,7 @@ void Broadcast( Complex<Real>* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "Broadcast", count*sizeof(Complex<Real>), comm );
     if( Size(comm) == 1 )
         return;
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -1090,6 +1904,7 @@ void Broadcast( T* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "Broadcast", count*sizeof(T), comm );
     if( Size(comm) == 1 || count == 0 )
         return;
     std::vector<byte> packedBuf;
@@ -1175,6 +1990,9 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "Gather",
+      (sc+(Rank(comm)==root ? rc*Size(comm) : 0))*sizeof(Real), comm );
     SafeMpi
     ( MPI_Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1189,6 +2007,9 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "Gather",
+      (sc+(Rank(comm)==root ? rc*Size(comm) : 0))*sizeof(Complex<Real>), comm );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Gather
@@ -1213,6 +2034,8 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "Gather", (sc+(Rank(comm)==root ? rc*Size(comm) : 0))*sizeof(T), comm );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalRecv = rc*commSize;
@@ -1316,6 +2139,9 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "Gather",
+      (sc+(Rank(comm)==root ? SumCounts(rcs,comm) : 0))*sizeof(Real), comm );
     SafeMpi
     ( MPI_Gatherv
       ( const_cast<Real*>(sbuf),
@@ -1338,6 +2164,9 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "Gather",
+      (sc+(Rank(comm)==root ? SumCounts(rcs,comm) : 0))*sizeof(Complex<Real>), comm );
 #ifdef EL_AVOID_COMPLEX_MPI
     const int commRank = Rank( comm );
     const int commSize = Size( comm );
@@ -1382,6 +2211,9 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "Gather",
+      (sc+(Rank(comm)==root ? SumCounts(rcs,comm) : 0))*sizeof(T), comm );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     int totalRecv=0;
@@ -1416,6 +2248,14 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    if( NarrowedAllGather( sbuf, sc, rbuf, rc, comm ) )
+        return;
+    EL_TRACE_MPI( "AllGather", (sc+rc*Size(comm))*sizeof(Real), comm );
+    if( const HierarchicalInfo* info = FindHierarchical(comm) )
+    {
+        HierarchicalAllGather( sbuf, sc, rbuf, rc, *info );
+        return;
+    }
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1440,6 +2280,17 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    if( NarrowedAllGather
+        ( reinterpret_cast<const Real*>(sbuf), 2*sc,
+          reinterpret_cast<Real*>(rbuf),       2*rc, comm ) )
+        return;
+    EL_TRACE_MPI
+    ( "AllGather", (sc+rc*Size(comm))*sizeof(Complex<Real>), comm );
+    if( const HierarchicalInfo* info = FindHierarchical(comm) )
+    {
+        HierarchicalAllGather( sbuf, sc, rbuf, rc, *info );
+        return;
+    }
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1474,6 +2325,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "AllGather", (sc+rc*Size(comm))*sizeof(T), comm );
     const int commSize = mpi::Size(comm);
     const int totalRecv = rc*commSize;
 
@@ -1496,6 +2348,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "AllGather", (sc+SumCounts(rcs,comm))*sizeof(Real), comm );
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1533,6 +2386,8 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "AllGather", (sc+SumCounts(rcs,comm))*sizeof(Complex<Real>), comm );
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1585,6 +2440,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "AllGather", (sc+SumCounts(rcs,comm))*sizeof(T), comm );
     const int commSize = mpi::Size(comm);
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
 
@@ -1605,6 +2461,65 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request<Real>& request )
+{
+    EL_DEBUG_CSE
+#if EL_HAVE_NONBLOCKING
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+#if EL_HAVE_NONBLOCKING
+# ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+# else
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+# endif
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm, Request<T>& request )
+{
+    EL_DEBUG_CSE
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void Scatter
@@ -1613,6 +2528,9 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "Scatter",
+      (rc+(Rank(comm)==root ? sc*Size(comm) : 0))*sizeof(Real), comm );
     SafeMpi
     ( MPI_Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1627,6 +2545,9 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "Scatter",
+      (rc+(Rank(comm)==root ? sc*Size(comm) : 0))*sizeof(Complex<Real>), comm );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Scatter
@@ -1651,6 +2572,8 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "Scatter", (rc+(Rank(comm)==root ? sc*Size(comm) : 0))*sizeof(T), comm );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1673,6 +2596,9 @@ void Scatter( Real* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "Scatter",
+      (rc+(Rank(comm)==root ? sc*Size(comm) : 0))*sizeof(Real), comm );
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1696,6 +2622,9 @@ void Scatter( Complex<Real>* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "Scatter",
+      (rc+(Rank(comm)==root ? sc*Size(comm) : 0))*sizeof(Complex<Real>), comm );
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1734,6 +2663,8 @@ void Scatter( T* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "Scatter", (rc+(Rank(comm)==root ? sc*Size(comm) : 0))*sizeof(T), comm );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1760,6 +2691,9 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    if( NarrowedAllToAll( sbuf, sc, rbuf, rc, comm ) )
+        return;
+    EL_TRACE_MPI( "AllToAll", ((sc+rc)*Size(comm))*sizeof(Real), comm );
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1774,6 +2708,12 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    if( NarrowedAllToAll
+        ( reinterpret_cast<const Real*>(sbuf), 2*sc,
+          reinterpret_cast<Real*>(rbuf),       2*rc, comm ) )
+        return;
+    EL_TRACE_MPI
+    ( "AllToAll", ((sc+rc)*Size(comm))*sizeof(Complex<Real>), comm );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Alltoall
@@ -1800,6 +2740,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "AllToAll", ((sc+rc)*Size(comm))*sizeof(T), comm );
     const int commSize = mpi::Size( comm );
     const int totalSend = sc*commSize;
     const int totalRecv = rc*commSize;
@@ -1814,6 +2755,65 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request<Real>& request )
+{
+    EL_DEBUG_CSE
+#if EL_HAVE_NONBLOCKING
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoall)
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    AllToAll( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+#if EL_HAVE_NONBLOCKING
+# ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoall)
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+# else
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoall)
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+# endif
+#else
+    AllToAll( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm, Request<T>& request )
+{
+    EL_DEBUG_CSE
+    AllToAll( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void AllToAll
@@ -1822,6 +2822,9 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "AllToAll",
+      (SumCounts(scs,comm)+SumCounts(rcs,comm))*sizeof(Real), comm );
     SafeMpi
     ( MPI_Alltoallv
       ( const_cast<Real*>(sbuf),
@@ -1843,6 +2846,9 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "AllToAll",
+      (SumCounts(scs,comm)+SumCounts(rcs,comm))*sizeof(Complex<Real>), comm );
 #ifdef EL_AVOID_COMPLEX_MPI
     int p;
     MPI_Comm_size( comm.comm, &p );
@@ -1884,6 +2890,8 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "AllToAll", (SumCounts(scs,comm)+SumCounts(rcs,comm))*sizeof(T), comm );
     const int commSize = mpi::Size( comm );
     const int totalSend = scs[commSize-1]+sds[commSize-1];
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
@@ -1928,6 +2936,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "Reduce", count*sizeof(Real), comm );
     if( count == 0 )
         return;
 
@@ -1946,6 +2955,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "Reduce", count*sizeof(Complex<Real>), comm );
     if( count == 0 )
         return;
 
@@ -1984,6 +2994,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "Reduce", count*sizeof(T), comm );
     if( count == 0 )
         return;
 
@@ -2032,6 +3043,7 @@ void Reduce( Real* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "Reduce", count*sizeof(Real), comm );
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2057,6 +3069,7 @@ void Reduce( Complex<Real>* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "Reduce", count*sizeof(Complex<Real>), comm );
     if( Size(comm) == 1 )
         return;
     if( count != 0 )
@@ -2119,6 +3132,7 @@ void Reduce( T* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "Reduce", count*sizeof(T), comm );
     if( count == 0 )
         return;
 
@@ -2151,6 +3165,12 @@ void AllReduce( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "AllReduce", count*sizeof(Real), comm );
+    if( const HierarchicalInfo* info = FindHierarchical(comm) )
+    {
+        HierarchicalAllReduce( sbuf, rbuf, count, op, *info );
+        return;
+    }
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2168,6 +3188,12 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "AllReduce", count*sizeof(Complex<Real>), comm );
+    if( const HierarchicalInfo* info = FindHierarchical(comm) )
+    {
+        HierarchicalAllReduce( sbuf, rbuf, count, op, *info );
+        return;
+    }
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2205,6 +3231,7 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "AllReduce", count*sizeof(T), comm );
     if( count == 0 )
         return;
 
@@ -2241,6 +3268,12 @@ void AllReduce( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "AllReduce", count*sizeof(Real), comm );
+    if( const HierarchicalInfo* info = FindHierarchical(comm) )
+    {
+        HierarchicalAllReduce( buf, buf, count, op, *info );
+        return;
+    }
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2256,6 +3289,12 @@ void AllReduce( Complex<Real>* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "AllReduce", count*sizeof(Complex<Real>), comm );
+    if( const HierarchicalInfo* info = FindHierarchical(comm) )
+    {
+        HierarchicalAllReduce( buf, buf, count, op, *info );
+        return;
+    }
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2291,6 +3330,7 @@ void AllReduce( T* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "AllReduce", count*sizeof(T), comm );
     if( count == 0 )
         return;
 
@@ -2311,14 +3351,105 @@ void AllReduce( T* buf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { AllReduce( buf, count, SUM, comm ); }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+#if EL_HAVE_NONBLOCKING
+    if( count == 0 || FindHierarchical(comm) != nullptr )
+    {
+        AllReduce( sbuf, rbuf, count, op, comm );
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    EL_TRACE_MPI( "IAllReduce", count*sizeof(Real), comm );
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(), opC,
+        comm.comm, &request.backend ) );
+#else
+    AllReduce( sbuf, rbuf, count, op, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+#if EL_HAVE_NONBLOCKING
+    if( count == 0 || FindHierarchical(comm) != nullptr )
+    {
+        AllReduce( sbuf, rbuf, count, op, comm );
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    EL_TRACE_MPI( "IAllReduce", count*sizeof(Complex<Real>), comm );
+# ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Iallreduce)
+          ( const_cast<Complex<Real>*>(sbuf), rbuf, 2*count,
+            TypeMap<Real>(), opC, comm.comm, &request.backend ) );
+        return;
+    }
+# endif
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, count,
+        TypeMap<Complex<Real>>(), opC, comm.comm, &request.backend ) );
+#else
+    AllReduce( sbuf, rbuf, count, op, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm, Request<T>& request )
+{
+    EL_DEBUG_CSE
+    AllReduce( sbuf, rbuf, count, op, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request )
+{ IAllReduce( sbuf, rbuf, count, SUM, comm, request ); }
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "ReduceScatter", (rc*Size(comm))*sizeof(Real), comm );
+    if( const HierarchicalInfo* info = FindHierarchical(comm) )
+    {
+        HierarchicalReduceScatter( sbuf, rbuf, rc, op, *info );
+        return;
+    }
     if( rc == 0 )
         return;
+    if( reduceScatterAlgorithm == REDUCE_SCATTER_RECURSIVE_HALVING )
+    {
+        RecursiveHalvingReduceScatter
+        ( sbuf, rbuf, rc, TypeMap<Real>(), NativeOp<Real>(op), comm );
+        return;
+    }
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2330,9 +3461,8 @@ EL_NO_RELEASE_EXCEPT
     ( MPI_Reduce_scatter_block
       ( sbuf, rbuf, rc, TypeMap<Real>(), opC, comm.comm ) );
 #else
-    const int commSize = Size( comm );
-    Reduce( sbuf, rc*commSize, op, 0, comm );
-    Scatter( sbuf, rc, rbuf, rc, 0, comm );
+    RecursiveHalvingReduceScatter
+    ( sbuf, rbuf, rc, TypeMap<Real>(), NativeOp<Real>(op), comm );
 #endif
 }
 
@@ -2343,8 +3473,20 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "ReduceScatter", (rc*Size(comm))*sizeof(Complex<Real>), comm );
+    if( const HierarchicalInfo* info = FindHierarchical(comm) )
+    {
+        HierarchicalReduceScatter( sbuf, rbuf, rc, op, *info );
+        return;
+    }
     if( rc == 0 )
         return;
+    if( reduceScatterAlgorithm == REDUCE_SCATTER_RECURSIVE_HALVING )
+    {
+        RecursiveHalvingComplexReduceScatter( sbuf, rbuf, rc, op, comm );
+        return;
+    }
 
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
@@ -2364,9 +3506,7 @@ EL_NO_RELEASE_EXCEPT
       ( sbuf, rbuf, rc, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 # endif
 #else
-    const int commSize = Size( comm );
-    Reduce( sbuf, rc*commSize, op, 0, comm );
-    Scatter( sbuf, rc, rbuf, rc, 0, comm );
+    RecursiveHalvingComplexReduceScatter( sbuf, rbuf, rc, op, comm );
 #endif
 }
 
@@ -2377,6 +3517,7 @@ void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "ReduceScatter", (rc*Size(comm))*sizeof(T), comm );
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2418,14 +3559,109 @@ T ReduceScatter( T sb, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { return ReduceScatter( sb, SUM, comm ); }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IReduceScatter
+( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm, Request<Real>& request )
+{
+    EL_DEBUG_CSE
+#if EL_HAVE_NONBLOCKING && defined(EL_HAVE_MPI_REDUCE_SCATTER_BLOCK)
+    if( reduceScatterAlgorithm == REDUCE_SCATTER_RECURSIVE_HALVING )
+    {
+        ReduceScatter( sbuf, rbuf, rc, op, comm );
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    if( rc == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+      ( sbuf, rbuf, rc, TypeMap<Real>(), opC, comm.comm,
+        &request.backend ) );
+#else
+    ReduceScatter( sbuf, rbuf, rc, op, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IReduceScatter
+( Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+#if EL_HAVE_NONBLOCKING && defined(EL_HAVE_MPI_REDUCE_SCATTER_BLOCK)
+    if( reduceScatterAlgorithm == REDUCE_SCATTER_RECURSIVE_HALVING )
+    {
+        ReduceScatter( sbuf, rbuf, rc, op, comm );
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    if( rc == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+# ifdef EL_AVOID_COMPLEX_MPI
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+      ( sbuf, rbuf, 2*rc, TypeMap<Real>(), opC, comm.comm,
+        &request.backend ) );
+# else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+      ( sbuf, rbuf, rc, TypeMap<Complex<Real>>(), opC, comm.comm,
+        &request.backend ) );
+# endif
+#else
+    ReduceScatter( sbuf, rbuf, rc, op, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IReduceScatter
+( T* sbuf, T* rbuf, int rc, Op op, Comm comm, Request<T>& request )
+{
+    EL_DEBUG_CSE
+    ReduceScatter( sbuf, rbuf, rc, op, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
+template<typename T>
+void IReduceScatter
+( T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request )
+{ IReduceScatter( sbuf, rbuf, rc, SUM, comm, request ); }
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void ReduceScatter( Real* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "ReduceScatter", (rc*Size(comm))*sizeof(Real), comm );
+    if( const HierarchicalInfo* info = FindHierarchical(comm) )
+    {
+        HierarchicalReduceScatter( buf, buf, rc, op, *info );
+        return;
+    }
     if( rc == 0 || Size(comm) == 1 )
         return;
+    if( reduceScatterAlgorithm == REDUCE_SCATTER_RECURSIVE_HALVING )
+    {
+        RecursiveHalvingReduceScatter
+        ( buf, buf, rc, TypeMap<Real>(), NativeOp<Real>(op), comm );
+        return;
+    }
 
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
@@ -2439,9 +3675,8 @@ EL_NO_RELEASE_EXCEPT
     ( MPI_Reduce_scatter_block
       ( MPI_IN_PLACE, buf, rc, TypeMap<Real>(), opC, comm.comm ) );
 #else
-    const int commSize = Size( comm );
-    Reduce( buf, rc*commSize, op, 0, comm );
-    Scatter( buf, rc, rc, 0, comm );
+    RecursiveHalvingReduceScatter
+    ( buf, buf, rc, TypeMap<Real>(), NativeOp<Real>(op), comm );
 #endif
 }
 
@@ -2451,8 +3686,20 @@ void ReduceScatter( Complex<Real>* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "ReduceScatter", (rc*Size(comm))*sizeof(Complex<Real>), comm );
+    if( const HierarchicalInfo* info = FindHierarchical(comm) )
+    {
+        HierarchicalReduceScatter( buf, buf, rc, op, *info );
+        return;
+    }
     if( rc == 0 || Size(comm) == 1 )
         return;
+    if( reduceScatterAlgorithm == REDUCE_SCATTER_RECURSIVE_HALVING )
+    {
+        RecursiveHalvingComplexReduceScatter( buf, buf, rc, op, comm );
+        return;
+    }
 
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
@@ -2473,9 +3720,7 @@ EL_NO_RELEASE_EXCEPT
       ( MPI_IN_PLACE, buf, rc, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 # endif
 #else
-    const int commSize = Size( comm );
-    Reduce( buf, rc*commSize, op, 0, comm );
-    Scatter( buf, rc, rc, 0, comm );
+    RecursiveHalvingComplexReduceScatter( buf, buf, rc, op, comm );
 #endif
 }
 
@@ -2486,6 +3731,7 @@ void ReduceScatter( T* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "ReduceScatter", (rc*Size(comm))*sizeof(T), comm );
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2524,6 +3770,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "ReduceScatter", (SumCounts(rcs,comm))*sizeof(Real), comm );
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
     ( MPI_Reduce_scatter
@@ -2539,6 +3786,8 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "ReduceScatter", (SumCounts(rcs,comm))*sizeof(Complex<Real>), comm );
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
     {
@@ -2580,6 +3829,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "ReduceScatter", (SumCounts(rcs,comm))*sizeof(T), comm );
     const int commRank = mpi::Rank(comm);
     const int commSize = mpi::Size(comm);
     int totalSend=0;
@@ -2944,6 +4194,9 @@ EL_NO_RELEASE_EXCEPT
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllGather \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, \
+    Request<T>& request ); \
   template void Scatter \
   ( const T* sbuf, int sc, \
           T* rbuf, int rc, int root, Comm comm ) \
@@ -2954,6 +4207,9 @@ EL_NO_RELEASE_EXCEPT
   ( const T* sbuf, int sc, \
           T* rbuf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllToAll \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, \
+    Request<T>& request ); \
   template void AllToAll \
   ( const T* sbuf, const int* scs, const int* sds, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
@@ -2991,10 +4247,19 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce( T* buf, int count, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllReduce \
+  ( const T* sbuf, T* rbuf, int count, Op op, Comm comm, \
+    Request<T>& request ); \
+  template void IAllReduce \
+  ( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request ); \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IReduceScatter \
+  ( T* sbuf, T* rbuf, int rc, Op op, Comm comm, Request<T>& request ); \
+  template void IReduceScatter \
+  ( T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request ); \
   template T ReduceScatter( T sb, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template T ReduceScatter( T sb, Comm comm ) \
@@ -3045,6 +4310,12 @@ MPI_PROTO(ValueInt<double>)
 MPI_PROTO(ValueInt<Complex<double>>)
 MPI_PROTO(Entry<double>)
 MPI_PROTO(Entry<Complex<double>>)
+MPI_PROTO(Half)
+MPI_PROTO(ValueInt<Half>)
+MPI_PROTO(Entry<Half>)
+MPI_PROTO(BFloat16)
+MPI_PROTO(ValueInt<BFloat16>)
+MPI_PROTO(Entry<BFloat16>)
 #ifdef HYDROGEN_HAVE_QD
 MPI_PROTO(DoubleDouble)
 MPI_PROTO(QuadDouble)
@@ -3094,6 +4365,8 @@ MPI_PROTO(Entry<Complex<BigFloat>>)
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#define EL_ENABLE_BFLOAT16
 #include <El/macros/Instantiate.h>
 
 } // namespace mpi
@@ -30,6 +30,8 @@ int pmrrr
   int* ZSupp      // support of eigenvectors [length 2n]
 );
 
+void PMR_set_partition_slack( double slack );
+
 } // extern "C"
 
 namespace El {
@@ -86,9 +88,20 @@ Info Eig( int n, double* d, double* e, double* w, mpi::Comm comm )
     return info;
 }
 
+int MaxLocalEigenvectors
+( int numEigenvalues, int commSize, double partitionSlack )
+{
+    // Each boundary of a nominal block of at most ceil(k/p) eigenvectors
+    // can move by at most floor(slack*ceil(k/p)) eigenvectors
+    partitionSlack = Min(Max(partitionSlack,0.),0.5);
+    const int maxChunk = Max((numEigenvalues+commSize-1)/commSize,1);
+    return maxChunk + 2*int(partitionSlack*maxChunk);
+}
+
 // Compute all of the eigenpairs
 Info Eig
-( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm )
+( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm,
+  double partitionSlack )
 {
     EL_DEBUG_CSE
     Info info;
@@ -99,9 +112,11 @@ Info Eig
     int highAccuracy=0; 
     int nz, offset;
     vector<int> ZSupport(2*n);
+    PMR_set_partition_slack( partitionSlack );
     int retval = pmrrr
     ( &jobz, &range, &n, d, e, &vl, &vu, &il, &iu, &highAccuracy, comm.comm,
       &nz, &offset, w, Z, &ldz, ZSupport.data() );
+    PMR_set_partition_slack( 0 );
     if( retval != 0 )
         RuntimeError("pmrrr returned ",retval);
 
@@ -140,7 +155,7 @@ Info Eig
 // Compute all of the eigenpairs with eigenvalues in (lowerBound,upperBound]
 Info Eig
 ( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm, 
-  double lowerBound, double upperBound )
+  double lowerBound, double upperBound, double partitionSlack )
 {
     EL_DEBUG_CSE
     Info info;
@@ -150,9 +165,11 @@ Info Eig
     int highAccuracy=0; 
     int nz, offset;
     vector<int> ZSupport(2*n);
+    PMR_set_partition_slack( partitionSlack );
     int retval = pmrrr
     ( &jobz, &range, &n, d, e, &lowerBound, &upperBound, &il, &iu, 
       &highAccuracy, comm.comm, &nz, &offset, w, Z, &ldz, ZSupport.data() );
+    PMR_set_partition_slack( 0 );
     if( retval != 0 )
         RuntimeError("pmrrr returned ",retval);
 
@@ -194,7 +211,7 @@ Info Eig
 // [lowerBound,upperBound]
 Info Eig
 ( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm, 
-  int lowerBound, int upperBound )
+  int lowerBound, int upperBound, double partitionSlack )
 {
     EL_DEBUG_CSE
     Info info;
@@ -206,9 +223,11 @@ Info Eig
     int highAccuracy=0; 
     int nz, offset;
     vector<int> ZSupport(2*n);
+    PMR_set_partition_slack( partitionSlack );
     int retval = pmrrr
     ( &jobz, &range, &n, d, e, &vl, &vu, &lowerBound, &upperBound, 
       &highAccuracy, comm.comm, &nz, &offset, w, Z, &ldz, ZSupport.data() );
+    PMR_set_partition_slack( 0 );
     if( retval != 0 )
         RuntimeError("pmrrr returned ",retval);
 
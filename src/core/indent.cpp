@@ -10,25 +10,23 @@
 
 namespace {
 
-El::Int indentLevel=0;
 El::Int spacesPerIndent=2;
 
 }
 
 namespace El {
 
-Int PushIndent() { return ::indentLevel++; }
-Int PopIndent() { return ::indentLevel--; }
-void SetIndent( Int indent ) { ::indentLevel = indent; }
-void ClearIndent() { ::indentLevel = 0; }
-Int IndentLevel() { return ::indentLevel; }
+// NOTE: The indentation level is a member of the Context of the calling thread
+
+Int PushIndent() { return CurrentContext().indentLevel++; }
+Int PopIndent() { return CurrentContext().indentLevel--; }
+void SetIndent( Int indent ) { CurrentContext().indentLevel = indent; }
+void ClearIndent() { CurrentContext().indentLevel = 0; }
+Int IndentLevel() { return CurrentContext().indentLevel; }
 
 string Indent()
 {
-    string ind;
-    for( Int i=0; i < ::spacesPerIndent * ::indentLevel; ++i )
-        ind = ind + " ";
-    return ind;
+    return string( ::spacesPerIndent*CurrentContext().indentLevel, ' ' );
 }
 
 } // namespace El
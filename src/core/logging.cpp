@@ -8,11 +8,13 @@
 */
 #include <El-lite.hpp>
 #include <iomanip>
+#include <mutex>
 
 namespace {
 
 // A (per-process) output file for logging
 std::ofstream logFile;
+std::recursive_mutex logMutex;
 
 }
 
@@ -20,6 +22,7 @@ namespace El {
 
 void OpenLog( const char* filename )
 {
+    std::lock_guard<std::recursive_mutex> lock( ::logMutex );
     if( ::logFile.is_open() )
         CloseLog();
     ::logFile.open( filename );
@@ -27,6 +30,7 @@ void OpenLog( const char* filename )
 
 std::ostream& LogOS()
 {
+    std::lock_guard<std::recursive_mutex> lock( ::logMutex );
     if( !::logFile.is_open() )
     {
         std::ostringstream fileOS;
@@ -37,6 +41,16 @@ std::ostream& LogOS()
     return ::logFile; 
 }
 
-void CloseLog() { ::logFile.close(); }
+void LogLine( const string& line )
+{
+    std::lock_guard<std::recursive_mutex> lock( ::logMutex );
+    LogOS() << line << std::endl;
+}
+
+void CloseLog()
+{
+    std::lock_guard<std::recursive_mutex> lock( ::logMutex );
+    ::logFile.close();
+}
 
 } // namespace El
@@ -0,0 +1,169 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <tuple>
+
+namespace El {
+namespace mpi {
+
+namespace {
+
+bool profiling = false;
+bool profilingSkew = false;
+std::map<std::tuple<string,string,string>,CallProfile> profiles;
+
+Int Bucket( double numBytes )
+{
+    Int bucket = 0;
+    while( numBytes >= 1 && bucket < PROFILE_NUM_BUCKETS-1 )
+    {
+        numBytes /= 2;
+        ++bucket;
+    }
+    return bucket;
+}
+
+} // anonymous namespace
+
+void EnableProfiling( bool measureSkew )
+{
+    if( !profiling )
+        ResetProfile();
+    profiling = true;
+    profilingSkew = measureSkew;
+}
+
+void DisableProfiling() { profiling = false; }
+
+bool ProfilingEnabled() EL_NO_EXCEPT { return profiling; }
+
+bool ProfilingSkew() EL_NO_EXCEPT { return profilingSkew; }
+
+void ResetProfile() { profiles.clear(); }
+
+double ProfileWait( Comm comm )
+{
+    const auto start = Clock::now();
+    Barrier( comm );
+    return duration<double>(Clock::now()-start).count();
+}
+
+void RecordProfile
+( Comm comm, const char* call, double numBytes, double seconds,
+  double waitSeconds )
+{
+    if( !profiling )
+        return;
+    const auto key =
+      std::make_tuple( Name(comm), string(call), CurrentTraceRegion() );
+    auto& profile = profiles[key];
+    if( profile.numCalls == 0 )
+    {
+        profile.comm = std::get<0>(key);
+        profile.call = std::get<1>(key);
+        profile.site = std::get<2>(key);
+    }
+    ++profile.numCalls;
+    profile.numBytes += numBytes;
+    profile.seconds += seconds;
+    profile.waitSeconds += waitSeconds;
+    profile.maxWaitSeconds = Max( profile.maxWaitSeconds, waitSeconds );
+    ++profile.histogram[Bucket(numBytes)];
+}
+
+vector<CallProfile> Profile()
+{
+    vector<CallProfile> profileList;
+    profileList.reserve( profiles.size() );
+    for( const auto& entry : profiles )
+        profileList.push_back( entry.second );
+    std::stable_sort
+    ( profileList.begin(), profileList.end(),
+      []( const CallProfile& a, const CallProfile& b )
+      { return a.seconds+a.waitSeconds > b.seconds+b.waitSeconds; } );
+    return profileList;
+}
+
+// Each line is tab-separated since call sites (e.g., "LU > Panel") contain
+// spaces. The histogram lists "<upper bound in bytes>:<number of calls>" for
+// each nonempty bucket.
+void PrintProfile( ostream& os )
+{
+    for( const auto& profile : Profile() )
+    {
+        os << profile.comm << "\t" << profile.call << "\t"
+           << ( profile.site.empty() ? string("-") : profile.site ) << "\t"
+           << profile.numCalls << "\t" << profile.numBytes << "\t"
+           << profile.seconds << "\t" << profile.waitSeconds << "\t"
+           << profile.maxWaitSeconds << "\t";
+        bool first = true;
+        for( Int bucket=0; bucket<PROFILE_NUM_BUCKETS; ++bucket )
+        {
+            if( profile.histogram[bucket] == 0 )
+                continue;
+            if( !first )
+                os << ",";
+            os << ( bucket == 0 ? 0. : std::ldexp(1.,bucket) ) << ":"
+               << profile.histogram[bucket];
+            first = false;
+        }
+        os << "\n";
+    }
+}
+
+void WriteProfile( const string& filename, Comm comm )
+{
+    EL_DEBUG_CSE
+    const bool wasProfiling = profiling;
+    profiling = false;
+    const int commRank = Rank( comm );
+    const int commSize = Size( comm );
+
+    std::ostringstream os;
+    os.precision( 6 );
+    {
+        std::ostringstream localOS;
+        PrintProfile( localOS );
+        std::istringstream lines( localOS.str() );
+        string line;
+        while( std::getline( lines, line ) )
+            os << commRank << "\t" << line << "\n";
+    }
+    const string localProfile = os.str();
+
+    const int localSize = localProfile.size();
+    vector<int> sizes(commSize), offsets(commSize);
+    Gather( &localSize, 1, sizes.data(), 1, 0, comm );
+    const int totalSize = El::Scan( sizes, offsets );
+    vector<byte> profile;
+    if( commRank == 0 )
+        profile.resize( totalSize );
+    Gather
+    ( reinterpret_cast<const byte*>(localProfile.data()), localSize,
+      profile.data(), sizes.data(), offsets.data(), 0, comm );
+
+    if( commRank == 0 )
+    {
+        std::ofstream file( filename.c_str() );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        file << "# rank\tcomm\tcall\tsite\tcalls\tbytes\tseconds\t"
+             << "waitSeconds\tmaxWaitSeconds\thistogram\n";
+        file.write( reinterpret_cast<const char*>(profile.data()), totalSize );
+    }
+    profiling = wasProfiling;
+}
+
+} // namespace mpi
+} // namespace El
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <mutex>
 using std::function;
 
 namespace El {
@@ -126,6 +127,8 @@ template struct Types<long long int>; // Avoid conflict with Int
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#define EL_ENABLE_BFLOAT16
 #include <El/macros/Instantiate.h>
 
 // TODO(poulson): ValueInt<Real> user functions and ops
@@ -897,10 +900,10 @@ void CreateMinLocPairOp()
     Types<Entry<T>>::createdMinOp = true;
 }
 
-void CreateCustom() EL_NO_RELEASE_EXCEPT
+namespace {
+
+void CreateIntFamily()
 {
-    // Int
-    // ===
     CreateValueIntType<Int>();
     CreateEntryType<Int>();
     CreateUserOps<Int>();
@@ -908,9 +911,10 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     CreateMinLocOp<Int>();
     CreateMaxLocPairOp<Int>();
     CreateMinLocPairOp<Int>();
+}
 
-    // float
-    // =====
+void CreateFloatFamily()
+{
 #ifdef EL_USE_64BIT_INTS
     CreateValueIntType<float>();
 #else
@@ -930,9 +934,10 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
 #endif
     CreateMaxLocPairOp<float>();
     CreateMinLocPairOp<float>();
+}
 
-    // double
-    // ======
+void CreateDoubleFamily()
+{
 #ifdef EL_USE_64BIT_INTS
     CreateValueIntType<double>();
 #else
@@ -952,10 +957,11 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
 #endif
     CreateMaxLocPairOp<double>();
     CreateMinLocPairOp<double>();
+}
 
 #ifdef HYDROGEN_HAVE_QD
-    // DoubleDouble
-    // ============
+void CreateDoubleDoubleFamily()
+{
     CreateContiguous<DoubleDouble>( 2, MPI_DOUBLE );
     CreateContiguous<Complex<DoubleDouble>>( 2, TypeMap<DoubleDouble>() );
     CreateValueIntType<DoubleDouble>();
@@ -974,9 +980,10 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     CreateMinLocOp<DoubleDouble>();
     CreateMaxLocPairOp<DoubleDouble>();
     CreateMinLocPairOp<DoubleDouble>();
+}
 
-    // QuadDouble
-    // ==========
+void CreateQuadDoubleFamily()
+{
     CreateContiguous<QuadDouble>( 4, MPI_DOUBLE );
     CreateContiguous<Complex<QuadDouble>>( 2, TypeMap<QuadDouble>() );
     CreateValueIntType<QuadDouble>();
@@ -995,11 +1002,12 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     CreateMinLocOp<QuadDouble>();
     CreateMaxLocPairOp<QuadDouble>();
     CreateMinLocPairOp<QuadDouble>();
+}
 #endif
 
 #ifdef HYDROGEN_HAVE_QUADMATH
-    // Quad
-    // ====
+void CreateQuadFamily()
+{
     CreateContiguous<Quad>( 2, MPI_DOUBLE );
     CreateContiguous<Complex<Quad>>( 2, TypeMap<Quad>() );
     CreateValueIntType<Quad>();
@@ -1018,11 +1026,12 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     CreateMinLocOp<Quad>();
     CreateMaxLocPairOp<Quad>();
     CreateMinLocPairOp<Quad>();
+}
 #endif
 
 #ifdef HYDROGEN_HAVE_MPC
-    // BigFloat
-    // ========
+void CreateBigFloatOps()
+{
     // NOTE: The BigFloat types are created by mpfr::SetPrecision previously
     //       within El::Initialize
     CreateUserOps<BigFloat>();
@@ -1037,9 +1046,10 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     CreateMinLocOp<BigFloat>();
     CreateMaxLocPairOp<BigFloat>();
     CreateMinLocPairOp<BigFloat>();
+}
 
-    // BigInt
-    // ======
+void CreateBigIntOps()
+{
     CreateUserOps<BigInt>();
     CreateMaxOp<BigInt>();
     CreateMinOp<BigInt>();
@@ -1049,7 +1059,84 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     CreateMinLocOp<BigInt>();
     CreateMaxLocPairOp<BigInt>();
     CreateMinLocPairOp<BigInt>();
+}
 #endif
+
+// The sixteen-bit types are sent as their bit patterns, while their
+// reductions are performed in single precision
+template<typename T>
+void CreateLowPrecisionFamily()
+{
+    CreateContiguous<T>( 1, MPI_UINT16_T );
+    CreateValueIntType<T>();
+    CreateEntryType<T>();
+    CreateUserOps<T>();
+    CreateMaxOp<T>();
+    CreateMinOp<T>();
+    CreateSumOp<T>();
+    CreateProdOp<T>();
+    CreateMaxLocOp<T>();
+    CreateMinLocOp<T>();
+    CreateMaxLocPairOp<T>();
+    CreateMinLocPairOp<T>();
+}
+
+// Guards the creation of the custom families. The mutex is recursive since
+// the creation of a family accesses its own (already created) members, e.g.,
+// TypeMap<DoubleDouble>() within that of Complex<DoubleDouble>, as well as
+// those of the Int family.
+std::recursive_mutex customMutex;
+bool creatingCustom[NUM_CUSTOM_FAMILIES] = {};
+
+} // anonymous namespace
+
+std::atomic<bool> customCreated[NUM_CUSTOM_FAMILIES];
+
+void CreateCustom( CustomFamily family ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( family >= NUM_CUSTOM_FAMILIES )
+          LogicError("Invalid custom family: ",int(family));
+    )
+    std::lock_guard<std::recursive_mutex> lock( customMutex );
+    if( customCreated[family].load() || creatingCustom[family] )
+        return;
+    creatingCustom[family] = true;
+    switch( family )
+    {
+    case INT_FAMILY: CreateIntFamily(); break;
+    case FLOAT_FAMILY: CreateFloatFamily(); break;
+    case DOUBLE_FAMILY: CreateDoubleFamily(); break;
+#ifdef HYDROGEN_HAVE_QD
+    case DOUBLEDOUBLE_FAMILY: CreateDoubleDoubleFamily(); break;
+    case QUADDOUBLE_FAMILY: CreateQuadDoubleFamily(); break;
+#endif
+#ifdef HYDROGEN_HAVE_QUADMATH
+    case QUAD_FAMILY: CreateQuadFamily(); break;
+#endif
+#ifdef HYDROGEN_HAVE_MPC
+    // NOTE: The BigFloat and BigInt types are created by mpfr::SetPrecision
+    //       and mpfr::SetMinIntBits within El::Initialize
+    case BIGFLOAT_FAMILY: CreateBigFloatOps(); break;
+    case BIGINT_FAMILY: CreateBigIntOps(); break;
+#endif
+    case HALF_FAMILY: CreateLowPrecisionFamily<Half>(); break;
+    case BFLOAT16_FAMILY: CreateLowPrecisionFamily<BFloat16>(); break;
+    default: break;
+    }
+    creatingCustom[family] = false;
+    customCreated[family].store( true, std::memory_order_release );
+}
+
+bool CreatedCustom( CustomFamily family ) EL_NO_EXCEPT
+{ return family < NUM_CUSTOM_FAMILIES && customCreated[family].load(); }
+
+void CreateCustom() EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    for( int family=0; family<NUM_CUSTOM_FAMILIES; ++family )
+        CreateCustom( CustomFamily(family) );
 }
 
 template<typename T>
@@ -1069,9 +1156,13 @@ void DestroyScalarFamily()
 
 void DestroyCustom() EL_NO_RELEASE_EXCEPT
 {
+    // Only the types and ops which were created are freed
+    std::lock_guard<std::recursive_mutex> lock( customMutex );
     DestroyFamily<Int>();
     DestroyScalarFamily<float>();
     DestroyScalarFamily<double>();
+    DestroyFamily<Half>();
+    DestroyFamily<BFloat16>();
 #ifdef HYDROGEN_HAVE_QD
     DestroyScalarFamily<DoubleDouble>();
     DestroyScalarFamily<QuadDouble>();
@@ -1083,6 +1174,8 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
     DestroyScalarFamily<BigFloat>();
     DestroyFamily<BigInt>();
 #endif
+    for( int family=0; family<NUM_CUSTOM_FAMILIES; ++family )
+        customCreated[family].store( false );
 }
 
 } // namespace mpi
@@ -10,13 +10,15 @@
 
 namespace {
 
-// A common Mersenne twister configuration
-std::mt19937 generator;
-
 #ifdef HYDROGEN_HAVE_MPC
 gmp_randstate_t gmpRandState;
 #endif
 
+// The state of the counter-based generator
+bool counterBasedRandom = false;
+unsigned long long counterBasedSeed = 0;
+std::atomic<unsigned long long> counterBasedStream(0);
+
 }
 
 namespace El {
@@ -27,7 +29,14 @@ void InitializeRandom( bool deterministic )
     const long secs = ( deterministic ? 21 : time(NULL) );
     const long seed = (secs<<16) | (rank & 0xFFFF);
 
-    ::generator.seed( seed );
+    CurrentContext().generator.seed( seed );
+    SetContextSeed( seed );
+
+    // The counter-based generator must be keyed identically on every process
+    Int commonSecs = secs;
+    if( !deterministic )
+        mpi::Broadcast( commonSecs, 0, mpi::COMM_WORLD );
+    SetCounterBasedSeed( commonSecs );
 
     srand( seed );
 
@@ -46,8 +55,21 @@ void FinalizeRandom()
 #endif
 }
 
+// The Mersenne twister of the Context of the calling thread
 std::mt19937& Generator()
-{ return ::generator; }
+{ return CurrentContext().generator; }
+
+bool CounterBasedRandom() { return ::counterBasedRandom; }
+void SetCounterBasedRandom( bool counterBased )
+{ ::counterBasedRandom = counterBased; }
+
+void SetCounterBasedSeed( unsigned long long seed )
+{
+    ::counterBasedSeed = seed;
+    ::counterBasedStream = 0;
+}
+unsigned long long CounterBasedSeed() { return ::counterBasedSeed; }
+unsigned long long NextCounterBasedStream() { return ::counterBasedStream++; }
 
 #ifdef HYDROGEN_HAVE_MPC
 namespace mpfr {
@@ -13,6 +13,7 @@ using namespace El;
 
 ColorMap colorMap=RED_BLACK_GREEN;
 Int numDiscreteColors = 15;
+Int maxImageSize = 1024;
 
 }
 
@@ -30,4 +31,14 @@ void SetNumDiscreteColors( Int numChunks )
 Int NumDiscreteColors()
 { return ::numDiscreteColors; }
 
+void SetMaxImageSize( Int maxSize )
+{
+    if( maxSize <= 0 )
+        LogicError("Maximum image size must be positive");
+    ::maxImageSize = maxSize;
+}
+
+Int MaxImageSize()
+{ return ::maxImageSize; }
+
 } // namespace El
@@ -0,0 +1,379 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#ifdef HYDROGEN_HAVE_ZSTD
+# include <zstd.h>
+#endif
+
+namespace El {
+
+namespace {
+
+const char checkpointStamp[8] = { 'E','L','C','K','P','T','0','1' };
+
+// The contents of the metadata file (following the stamp and type name)
+struct CheckpointLayout
+{
+    Int height, width;
+    Int entrySize;
+    int colDist, rowDist, wrap;
+    int colAlign, rowAlign, root;
+    Int blockHeight, blockWidth, colCut, rowCut;
+    int gridHeight, gridWidth, gridOrder;
+    int numShards;
+    int compressed;
+};
+
+// The header of each shard, which is followed by the global row and column
+// indices and then the (possibly compressed) column-major local matrix
+struct ShardHeader
+{
+    Int localHeight, localWidth;
+    Int dataBytes;
+};
+
+string ShardName( const string& basename, int shard )
+{ return basename + ".ckpt." + std::to_string(shard); }
+
+template<typename T>
+CheckpointLayout Layout( const AbstractDistMatrix<T>& A, bool compress )
+{
+    const Grid& g = A.Grid();
+    CheckpointLayout layout;
+    layout.height = A.Height();
+    layout.width = A.Width();
+    layout.entrySize = sizeof(T);
+    layout.colDist = A.ColDist();
+    layout.rowDist = A.RowDist();
+    layout.wrap = A.Wrap();
+    layout.colAlign = A.ColAlign();
+    layout.rowAlign = A.RowAlign();
+    layout.root = A.Root();
+    layout.blockHeight = A.BlockHeight();
+    layout.blockWidth = A.BlockWidth();
+    layout.colCut = A.ColCut();
+    layout.rowCut = A.RowCut();
+    layout.gridHeight = g.Height();
+    layout.gridWidth = g.Width();
+    layout.gridOrder = g.Order();
+    layout.numShards = A.DistSize();
+    layout.compressed = compress;
+    return layout;
+}
+
+// Whether the local matrices of A would be exactly those of the shards
+template<typename T>
+bool SameLayout
+( const AbstractDistMatrix<T>& A, const CheckpointLayout& layout )
+{
+    const CheckpointLayout other = Layout( A, layout.compressed );
+    return other.colDist == layout.colDist &&
+           other.rowDist == layout.rowDist &&
+           other.wrap == layout.wrap &&
+           other.colAlign == layout.colAlign &&
+           other.rowAlign == layout.rowAlign &&
+           other.root == layout.root &&
+           other.blockHeight == layout.blockHeight &&
+           other.blockWidth == layout.blockWidth &&
+           other.colCut == layout.colCut &&
+           other.rowCut == layout.rowCut &&
+           other.gridHeight == layout.gridHeight &&
+           other.gridWidth == layout.gridWidth &&
+           other.gridOrder == layout.gridOrder &&
+           other.numShards == layout.numShards;
+}
+
+// Throw on every process if any process failed, so that none are left
+// waiting within a subsequent collective
+void AgreeOnFailure( const string& error, mpi::Comm comm )
+{
+    const int failed = !error.empty();
+    if( mpi::AllReduce( failed, mpi::MAX, comm ) )
+    {
+        if( failed )
+            RuntimeError( error );
+        else
+            RuntimeError("Another process failed to access its shard");
+    }
+}
+
+void WriteBytes( std::ofstream& file, const void* buffer, Int numBytes )
+{ file.write( static_cast<const char*>(buffer), numBytes ); }
+
+void ReadBytes
+( std::ifstream& file, void* buffer, Int numBytes, const string& filename )
+{
+    file.read( static_cast<char*>(buffer), numBytes );
+    if( file.gcount() != std::streamsize(numBytes) )
+        RuntimeError("Unexpected end of ",filename);
+}
+
+vector<byte> Compress( const byte* buffer, Int numBytes )
+{
+    EL_DEBUG_CSE
+#ifdef HYDROGEN_HAVE_ZSTD
+    // Favor throughput, as floating-point data rarely compresses well
+    const int level = 1;
+    vector<byte> packed( ZSTD_compressBound(numBytes) );
+    const size_t packedBytes =
+      ZSTD_compress( packed.data(), packed.size(), buffer, numBytes, level );
+    if( ZSTD_isError(packedBytes) )
+        RuntimeError
+        ("Compression failed: ",ZSTD_getErrorName(packedBytes));
+    packed.resize( packedBytes );
+    return packed;
+#else
+    LogicError("Compressed checkpoints require Hydrogen_ENABLE_ZSTD");
+    return vector<byte>();
+#endif
+}
+
+void Decompress
+( const vector<byte>& packed, byte* buffer, Int numBytes )
+{
+    EL_DEBUG_CSE
+#ifdef HYDROGEN_HAVE_ZSTD
+    const size_t unpackedBytes =
+      ZSTD_decompress( buffer, numBytes, packed.data(), packed.size() );
+    if( ZSTD_isError(unpackedBytes) || Int(unpackedBytes) != numBytes )
+        RuntimeError("Could not decompress checkpoint shard");
+#else
+    RuntimeError("Compressed checkpoints require Hydrogen_ENABLE_ZSTD");
+#endif
+}
+
+// Read the indices and the (packed, column-major) local matrix of a shard
+template<typename T>
+void ReadShard
+( const string& filename, bool compressed,
+  vector<Int>& rows, vector<Int>& cols, vector<T>& values )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    ShardHeader header;
+    ReadBytes( file, &header, sizeof(header), filename );
+    rows.resize( header.localHeight );
+    cols.resize( header.localWidth );
+    values.resize( header.localHeight*header.localWidth );
+    ReadBytes( file, rows.data(), rows.size()*sizeof(Int), filename );
+    ReadBytes( file, cols.data(), cols.size()*sizeof(Int), filename );
+    const Int numBytes = values.size()*sizeof(T);
+    if( compressed )
+    {
+        vector<byte> packed( header.dataBytes );
+        ReadBytes( file, packed.data(), header.dataBytes, filename );
+        Decompress( packed, (byte*)values.data(), numBytes );
+    }
+    else
+    {
+        if( header.dataBytes != numBytes )
+            RuntimeError("Shard ",filename," has an inconsistent size");
+        ReadBytes( file, values.data(), numBytes, filename );
+    }
+}
+
+} // anonymous namespace
+
+template<typename T>
+void WriteCheckpoint
+( const AbstractDistMatrix<T>& A, const string& basename, bool compress )
+{
+    EL_DEBUG_CSE
+#ifndef HYDROGEN_HAVE_ZSTD
+    if( compress )
+        LogicError("Compressed checkpoints require Hydrogen_ENABLE_ZSTD");
+#endif
+    mpi::Comm comm = A.Grid().ViewingComm();
+    const CheckpointLayout layout = Layout( A, compress );
+    const string typeName = TypeName<T>();
+
+    string error;
+    try
+    {
+        if( mpi::Rank(comm) == 0 )
+        {
+            const string filename = basename + ".ckpt";
+            std::ofstream file( filename.c_str(), std::ios::binary );
+            if( !file.is_open() )
+                RuntimeError("Could not open ",filename);
+            const Int typeNameSize = typeName.size();
+            WriteBytes( file, checkpointStamp, sizeof(checkpointStamp) );
+            WriteBytes( file, &typeNameSize, sizeof(Int) );
+            WriteBytes( file, typeName.data(), typeNameSize );
+            WriteBytes( file, &layout, sizeof(layout) );
+            if( !file )
+                RuntimeError("Could not write ",filename);
+        }
+
+        // Only the first of each set of redundant processes writes a shard
+        if( A.Participating() && A.RedundantRank() == 0 &&
+            A.CrossRank() == A.Root() )
+        {
+            const string filename = ShardName( basename, A.DistRank() );
+            std::ofstream file( filename.c_str(), std::ios::binary );
+            if( !file.is_open() )
+                RuntimeError("Could not open ",filename);
+
+            const Int localHeight = A.LocalHeight();
+            const Int localWidth = A.LocalWidth();
+            vector<Int> rows( localHeight ), cols( localWidth );
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                rows[iLoc] = A.GlobalRow(iLoc);
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                cols[jLoc] = A.GlobalCol(jLoc);
+
+            ShardHeader header;
+            header.localHeight = localHeight;
+            header.localWidth = localWidth;
+            const Int numBytes = localHeight*localWidth*sizeof(T);
+            const T* ABuf = A.LockedBuffer();
+            const Int ALDim = A.LDim();
+            if( compress )
+            {
+                vector<T> contiguous( localHeight*localWidth );
+                lapack::Copy
+                ( 'F', localHeight, localWidth, ABuf, ALDim,
+                  contiguous.data(), Max(localHeight,1) );
+                const vector<byte> packed =
+                  Compress( (const byte*)contiguous.data(), numBytes );
+                header.dataBytes = packed.size();
+                WriteBytes( file, &header, sizeof(header) );
+                WriteBytes( file, rows.data(), localHeight*sizeof(Int) );
+                WriteBytes( file, cols.data(), localWidth*sizeof(Int) );
+                WriteBytes( file, packed.data(), packed.size() );
+            }
+            else
+            {
+                header.dataBytes = numBytes;
+                WriteBytes( file, &header, sizeof(header) );
+                WriteBytes( file, rows.data(), localHeight*sizeof(Int) );
+                WriteBytes( file, cols.data(), localWidth*sizeof(Int) );
+                if( ALDim == localHeight )
+                    WriteBytes( file, ABuf, numBytes );
+                else
+                    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                        WriteBytes
+                        ( file, &ABuf[jLoc*ALDim], localHeight*sizeof(T) );
+            }
+            if( !file )
+                RuntimeError("Could not write ",filename);
+        }
+    }
+    catch( std::exception& e ) { error = e.what(); }
+    AgreeOnFailure( error, comm );
+}
+
+template<typename T>
+void ReadCheckpoint( AbstractDistMatrix<T>& A, const string& basename )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = A.Grid().ViewingComm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    // Every process reads the (small) metadata file
+    CheckpointLayout layout;
+    string error;
+    try
+    {
+        const string filename = basename + ".ckpt";
+        std::ifstream file( filename.c_str(), std::ios::binary );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        char stamp[sizeof(checkpointStamp)];
+        ReadBytes( file, stamp, sizeof(stamp), filename );
+        if( !std::equal( stamp, stamp+sizeof(stamp), checkpointStamp ) )
+            RuntimeError(filename," is not a checkpoint");
+        Int typeNameSize;
+        ReadBytes( file, &typeNameSize, sizeof(Int), filename );
+        if( typeNameSize < 0 || typeNameSize > 1024 )
+            RuntimeError(filename," is corrupt");
+        string typeName( typeNameSize, ' ' );
+        ReadBytes( file, &typeName[0], typeNameSize, filename );
+        ReadBytes( file, &layout, sizeof(layout), filename );
+        if( typeName != TypeName<T>() || layout.entrySize != Int(sizeof(T)) )
+            RuntimeError
+            ("Checkpoint holds ",typeName," rather than ",TypeName<T>());
+    }
+    catch( std::exception& e ) { error = e.what(); }
+    AgreeOnFailure( error, comm );
+
+    vector<Int> rows, cols;
+    vector<T> values;
+    if( SameLayout( A, layout ) && !A.Viewing() )
+    {
+        // Each process (including redundant ones) reads its own shard
+        A.Resize( layout.height, layout.width );
+        try
+        {
+            if( A.Participating() && A.CrossRank() == A.Root() )
+            {
+                ReadShard
+                ( ShardName(basename,A.DistRank()), layout.compressed,
+                  rows, cols, values );
+                const Int localHeight = A.LocalHeight();
+                const Int localWidth = A.LocalWidth();
+                if( Int(rows.size()) != localHeight ||
+                    Int(cols.size()) != localWidth )
+                    RuntimeError("Shard ",A.DistRank()," has the wrong size");
+                lapack::Copy
+                ( 'F', localHeight, localWidth,
+                  values.data(), Max(localHeight,1), A.Buffer(), A.LDim() );
+            }
+        }
+        catch( std::exception& e ) { error = e.what(); }
+        AgreeOnFailure( error, comm );
+        return;
+    }
+
+    // Divide the shards among all of the processes and send each entry to
+    // its new owner(s)
+    Zeros( A, layout.height, layout.width );
+    for( int shard=commRank; shard<layout.numShards; shard+=commSize )
+    {
+        try
+        {
+            ReadShard
+            ( ShardName(basename,shard), layout.compressed,
+              rows, cols, values );
+        }
+        catch( std::exception& e )
+        {
+            error = e.what();
+            break;
+        }
+        const Int localHeight = rows.size();
+        const Int localWidth = cols.size();
+        A.Reserve( localHeight*localWidth );
+        EL_PARALLEL_FOR
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                A.QueueUpdate
+                ( rows[iLoc], cols[jLoc], values[iLoc+jLoc*localHeight] );
+    }
+    AgreeOnFailure( error, comm );
+    A.ProcessQueues();
+}
+
+#define PROTO(T) \
+  template void WriteCheckpoint \
+  ( const AbstractDistMatrix<T>& A, const string& basename, \
+    bool compress ); \
+  template void ReadCheckpoint \
+  ( AbstractDistMatrix<T>& A, const string& basename );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
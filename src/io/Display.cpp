@@ -97,7 +97,31 @@ template<typename T>
 void Display( const AbstractDistMatrix<T>& A, string title )
 {
     EL_DEBUG_CSE
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    const Int maxSize = MaxImageSize();
+    if( A.Height() > maxSize || A.Width() > maxSize )
+    {
+        Matrix<double> realTile, imagTile;
+        const bool root = ImageTile( A, realTile, maxSize, maxSize );
+        if( IsComplex<T>::value )
+        {
+            ImageTile( A, imagTile, maxSize, maxSize, TILE_MEAN, true );
+            if( root )
+            {
+                const Int mPix = realTile.Height();
+                const Int nPix = realTile.Width();
+                Matrix<Complex<double>> tile( mPix, nPix );
+                for( Int jPix=0; jPix<nPix; ++jPix )
+                    for( Int iPix=0; iPix<mPix; ++iPix )
+                        tile(iPix,jPix) =
+                          Complex<double>
+                          (realTile(iPix,jPix),imagTile(iPix,jPix));
+                Display( tile, title );
+            }
+        }
+        else if( root )
+            Display( realTile, title );
+    }
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Display( A.LockedMatrix(), title );
@@ -110,10 +134,74 @@ void Display( const AbstractDistMatrix<T>& A, string title )
     }
 }
 
+void Display( const Graph& graph, string title )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_QT5
+    graph.AssertConsistent();
+    Matrix<double> A;
+    Zeros( A, graph.NumSources(), graph.NumTargets() );
+    const Int numEdges = graph.NumEdges();
+    for( Int e=0; e<numEdges; ++e )
+        A( graph.Source(e), graph.Target(e) ) = 1;
+    Display( A, title );
+#else
+    Print( graph, title );
+#endif
+}
+
+void Display( const DistGraph& graph, string title )
+{
+    EL_DEBUG_CSE
+    Graph seqGraph;
+    seqGraph = graph;
+    if( graph.Grid().Rank() == 0 )
+        Display( seqGraph, title );
+}
+
+template<typename T>
+void Display( const SparseMatrix<T>& A, string title )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_QT5
+    A.AssertConsistent();
+    Matrix<T> ADense;
+    Zeros( ADense, A.Height(), A.Width() );
+    const Int numEntries = A.NumEntries();
+    for( Int e=0; e<numEntries; ++e )
+        ADense( A.Row(e), A.Col(e) ) += A.Value(e);
+    Display( ADense, title );
+#else
+    Print( A, title );
+#endif
+}
+
+template<typename T>
+void Display( const DistSparseMatrix<T>& A, string title )
+{
+    EL_DEBUG_CSE
+    SparseMatrix<T> ASeq;
+    ASeq = A;
+    if( A.Grid().Rank() == 0 )
+        Display( ASeq, title );
+}
+
+template<typename T>
+void Display( const DistMultiVec<T>& X, string title )
+{
+    EL_DEBUG_CSE
+    DistMatrix<T,CIRC,CIRC> X_CIRC_CIRC( X.Grid() );
+    Copy( X, X_CIRC_CIRC );
+    Display( X_CIRC_CIRC, title );
+}
+
 
 #define PROTO(T) \
   template void Display( const Matrix<T>& A, string title ); \
-  template void Display( const AbstractDistMatrix<T>& A, string title );
+  template void Display( const AbstractDistMatrix<T>& A, string title ); \
+  template void Display( const SparseMatrix<T>& A, string title ); \
+  template void Display( const DistSparseMatrix<T>& A, string title ); \
+  template void Display( const DistMultiVec<T>& X, string title );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -0,0 +1,120 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+// The pixel containing entry i of a dimension of size n split into nPix
+inline Int PixelIndex( Int i, Int n, Int nPix ) EL_NO_EXCEPT
+{ return (i*nPix) / n; }
+
+// The number of entries of a dimension of size n which map to each pixel
+vector<Int> PixelCounts( Int n, Int nPix )
+{
+    vector<Int> counts( nPix, 0 );
+    for( Int i=0; i<n; ++i )
+        ++counts[PixelIndex(i,n,nPix)];
+    return counts;
+}
+
+} // anonymous namespace
+
+template<typename T>
+bool ImageTile
+( const AbstractDistMatrix<T>& A, Matrix<double>& tile,
+  Int mPix, Int nPix, TileReduction reduction, bool imagPart, Base<T> tol )
+{
+    EL_DEBUG_CSE
+    if( mPix <= 0 || nPix <= 0 )
+        LogicError("Tile dimensions must be positive");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    mPix = Min( mPix, m );
+    nPix = Min( nPix, n );
+    tile.Empty();
+    // Only one copy of each entry contributes
+    if( !A.Participating() || A.RedundantRank() != 0 )
+        return false;
+
+    // Summarize the local entries in a full-size tile
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    vector<Int> rowPixels( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        rowPixels[iLoc] = PixelIndex( A.GlobalRow(iLoc), m, mPix );
+    vector<double> values( mPix*nPix, 0 );
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int jPix = PixelIndex( A.GlobalCol(jLoc), n, nPix );
+        double* valueCol = &values[jPix*mPix];
+        const T* ACol = &ABuf[jLoc*ALDim];
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            double& value = valueCol[rowPixels[iLoc]];
+            switch( reduction )
+            {
+            case TILE_MEAN:
+                value +=
+                  double( imagPart ? ImagPart(ACol[iLoc])
+                                   : RealPart(ACol[iLoc]) );
+                break;
+            case TILE_MAX_ABS:
+                value = Max( value, double(Abs(ACol[iLoc])) );
+                break;
+            case TILE_NONZERO_COUNT:
+                if( Abs(ACol[iLoc]) > tol )
+                    value += 1;
+                break;
+            }
+        }
+    }
+
+    // Combine the tiles of the distribution team onto its root
+    const mpi::Op op = ( reduction == TILE_MAX_ABS ? mpi::MAX : mpi::SUM );
+    mpi::Reduce( values.data(), mPix*nPix, op, 0, A.DistComm() );
+    if( A.DistRank() != 0 )
+        return false;
+
+    tile.Resize( mPix, nPix );
+    if( reduction == TILE_MEAN )
+    {
+        const vector<Int> rowCounts = PixelCounts( m, mPix );
+        const vector<Int> colCounts = PixelCounts( n, nPix );
+        for( Int jPix=0; jPix<nPix; ++jPix )
+            for( Int iPix=0; iPix<mPix; ++iPix )
+                tile(iPix,jPix) = values[iPix+jPix*mPix] /
+                  double(rowCounts[iPix]*colCounts[jPix]);
+    }
+    else
+    {
+        for( Int jPix=0; jPix<nPix; ++jPix )
+            for( Int iPix=0; iPix<mPix; ++iPix )
+                tile(iPix,jPix) = values[iPix+jPix*mPix];
+    }
+    return true;
+}
+
+#define PROTO(T) \
+  template bool ImageTile \
+  ( const AbstractDistMatrix<T>& A, Matrix<double>& tile, \
+    Int mPix, Int nPix, TileReduction reduction, bool imagPart, \
+    Base<T> tol );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
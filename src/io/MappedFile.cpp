@@ -0,0 +1,112 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+# define EL_HAVE_MMAP
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace El {
+
+MappedFile::MappedFile( const string& filename )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MMAP
+    const int fd = open( filename.c_str(), O_RDONLY );
+    if( fd < 0 )
+        RuntimeError("Could not open ",filename);
+    struct stat info;
+    if( fstat( fd, &info ) != 0 )
+    {
+        close( fd );
+        RuntimeError("Could not determine the size of ",filename);
+    }
+    size_ = info.st_size;
+    if( size_ > 0 )
+    {
+        void* ptr = mmap( nullptr, size_, PROT_READ, MAP_SHARED, fd, 0 );
+        if( ptr == MAP_FAILED )
+        {
+            close( fd );
+            RuntimeError("Could not map ",filename);
+        }
+        data_ = static_cast<byte*>(ptr);
+        mapped_ = true;
+    }
+    // The mapping remains valid after the descriptor is closed
+    close( fd );
+#else
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    size_ = FileSize( file );
+    data_ = new byte[size_];
+    file.read( (char*)data_, size_ );
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef EL_HAVE_MMAP
+    if( mapped_ )
+        munmap( data_, size_ );
+#else
+    delete[] data_;
+#endif
+}
+
+template<typename T>
+void MapBinaryFlat
+( Matrix<T>& A, const MappedFile& file, Int height, Int width, Int offset )
+{
+    EL_DEBUG_CSE
+    if( height < 0 || width < 0 || offset < 0 )
+        LogicError("Dimensions and offset must be non-negative");
+    const Int numBytes = file.Size();
+    const Int numBytesExp = offset + height*width*sizeof(T);
+    if( numBytes != numBytesExp )
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    // The mapping itself is page-aligned
+    if( offset % alignof(T) != 0 )
+        LogicError
+        ("Offset of ",offset," is not a multiple of the alignment of ",
+         TypeName<T>());
+    const T* buffer = reinterpret_cast<const T*>(file.Data()+offset);
+    A.LockedAttach( height, width, buffer, Max(height,1) );
+}
+
+template<typename T>
+void MapBinary( Matrix<T>& A, const MappedFile& file )
+{
+    EL_DEBUG_CSE
+    const Int metaBytes = 2*sizeof(Int);
+    if( Int(file.Size()) < metaBytes )
+        RuntimeError("File is too small to hold a BINARY header");
+    Int dims[2];
+    MemCopy( (byte*)dims, file.Data(), metaBytes );
+    MapBinaryFlat( A, file, dims[0], dims[1], metaBytes );
+}
+
+#define PROTO(T) \
+  template void MapBinaryFlat \
+  ( Matrix<T>& A, const MappedFile& file, Int height, Int width, \
+    Int offset ); \
+  template void MapBinary( Matrix<T>& A, const MappedFile& file );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
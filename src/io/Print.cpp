@@ -60,6 +60,70 @@ void Print
     }
 }
 
+// Graphs and sparse matrices
+// ===========================
+
+void Print( const Graph& graph, string title, ostream& os )
+{
+    EL_DEBUG_CSE
+    graph.AssertConsistent();
+    if( title != "" )
+        os << title << endl;
+    const Int numEdges = graph.NumEdges();
+    const Int* srcBuf = graph.LockedSourceBuffer();
+    const Int* tgtBuf = graph.LockedTargetBuffer();
+    for( Int e=0; e<numEdges; ++e )
+        os << srcBuf[e] << " " << tgtBuf[e] << "\n";
+    os << endl;
+}
+
+void Print( const DistGraph& graph, string title, ostream& os )
+{
+    EL_DEBUG_CSE
+    Graph seqGraph;
+    seqGraph = graph;
+    if( graph.Grid().Rank() == 0 )
+        Print( seqGraph, title, os );
+}
+
+template<typename T>
+void Print( const SparseMatrix<T>& A, string title, ostream& os )
+{
+    EL_DEBUG_CSE
+    A.AssertConsistent();
+    if( title != "" )
+        os << title << endl;
+
+    ConfigurePrecision<T>( os );
+
+    const Int numEntries = A.NumEntries();
+    const Int* srcBuf = A.LockedSourceBuffer();
+    const Int* tgtBuf = A.LockedTargetBuffer();
+    const T* valBuf = A.LockedValueBuffer();
+    for( Int s=0; s<numEntries; ++s )
+        os << srcBuf[s] << " " << tgtBuf[s] << " " << valBuf[s] << "\n";
+    os << endl;
+}
+
+template<typename T>
+void Print( const DistSparseMatrix<T>& A, string title, ostream& os )
+{
+    EL_DEBUG_CSE
+    SparseMatrix<T> ASeq;
+    ASeq = A;
+    if( A.Grid().Rank() == 0 )
+        Print( ASeq, title, os );
+}
+
+template<typename T>
+void Print( const DistMultiVec<T>& X, string title, ostream& os )
+{
+    EL_DEBUG_CSE
+    DistMatrix<T,CIRC,CIRC> X_CIRC_CIRC( X.Grid() );
+    Copy( X, X_CIRC_CIRC );
+    Print( X_CIRC_CIRC, title, os );
+}
+
 // Utilities
 // =========
 
@@ -84,7 +148,13 @@ void Print( const vector<T>& x, string title, ostream& os )
   template void Print \
   ( const Matrix<T>& A, string title, ostream& os ); \
   template void Print \
-  ( const AbstractDistMatrix<T>& A, string title, ostream& os );
+  ( const AbstractDistMatrix<T>& A, string title, ostream& os ); \
+  template void Print \
+  ( const SparseMatrix<T>& A, string title, ostream& os ); \
+  template void Print \
+  ( const DistSparseMatrix<T>& A, string title, ostream& os ); \
+  template void Print \
+  ( const DistMultiVec<T>& X, string title, ostream& os );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
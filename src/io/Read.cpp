@@ -54,7 +54,15 @@ void Read
     if( format == AUTO )
         format = DetectFormat( filename );
 
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( !sequential && (format == BINARY || format == BINARY_FLAT) )
+    {
+        // Each process reads its own entries via collective MPI-IO
+        if( format == BINARY )
+            read::Binary( A, filename );
+        else
+            read::BinaryFlat( A, A.Height(), A.Width(), filename );
+    }
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
         {
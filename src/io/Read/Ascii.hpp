@@ -9,103 +9,158 @@
 #ifndef EL_READ_ASCII_HPP
 #define EL_READ_ASCII_HPP
 
+#include "./Parse.hpp"
+
 namespace El {
 namespace read {
 
+// Append the (row-major) entries of the rows in [p,end), ignoring blank
+// lines, and return their number. The width is that of each row, or zero if
+// there were none.
+template<typename T>
+inline Int AsciiRows
+( const char* p, const char* end, vector<T>& values, Int& width )
+{
+    Int numRows = 0;
+    width = 0;
+    T value;
+    while( p != end )
+    {
+        Int numCols = 0;
+        while( !AtLineEnd( p, end ) )
+        {
+            if( !ParseValue( p, end, value ) )
+                RuntimeError("Could not parse entry ",numCols," of a row");
+            values.push_back( value );
+            ++numCols;
+        }
+        if( numCols != 0 )
+        {
+            if( numRows != 0 && numCols != width )
+                LogicError("Inconsistent number of columns");
+            width = numCols;
+            ++numRows;
+        }
+        NextLine( p, end );
+    }
+    return numRows;
+}
+
+// The rows are parsed directly from a mapping of the file, with the threads
+// of the process each handling a contiguous range of lines
 template<typename T>
 inline void
 Ascii( Matrix<T>& A, const string filename )
 {
     EL_DEBUG_CSE
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    MappedFile file( filename );
+    const char* beg = reinterpret_cast<const char*>(file.Data());
+    const char* end = beg + file.Size();
+
+    const Int numChunks = NumParseChunks();
+    vector<const char*> bounds;
+    LineChunks( beg, end, numChunks, bounds );
+    vector<vector<T>> values( numChunks );
+    vector<Int> numRows( numChunks ), widths( numChunks );
+    ParseChunks
+    ( numChunks,
+      [&]( Int c )
+      {
+          numRows[c] =
+            AsciiRows( bounds[c], bounds[c+1], values[c], widths[c] );
+      } );
 
-    // Walk through the file once to both count the number of rows and
-    // columns and to ensure that the number of columns is consistent
+    // Ensure that the number of columns is consistent
     Int height=0, width=0;
-    string line;
-    while( std::getline( file, line ) )
+    vector<Int> rowOffsets( numChunks );
+    for( Int c=0; c<numChunks; ++c )
     {
-        std::stringstream lineStream( line );
-        Int numCols=0;
-        T value;
-        while( lineStream >> value ) ++numCols;
-        if( numCols != 0 )
+        if( numRows[c] != 0 )
         {
-            if( numCols != width && width != 0 )
+            if( width != 0 && widths[c] != width )
                 LogicError("Inconsistent number of columns");
-            else
-                width = numCols;
-            ++height;
+            width = widths[c];
         }
+        rowOffsets[c] = height;
+        height += numRows[c];
     }
-    file.clear();
-    file.seekg(0,file.beg);
 
-    // Resize the matrix and then read it
     A.Resize( height, width );
-    Int i=0;
-    while( std::getline( file, line ) )
-    {
-        std::stringstream lineStream( line );
-        Int j=0;
-        T value;
-        while( lineStream >> value )
-        {
-            A.Set( i, j, value );
-            ++j;
-        }
-        ++i;
-    }
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int c=0; c<numChunks; ++c )
+        for( Int i=0; i<numRows[c]; ++i )
+            for( Int j=0; j<width; ++j )
+                ABuf[(rowOffsets[c]+i)+j*ALDim] = values[c][i*width+j];
 }
 
+// Each process parses a contiguous range of the lines of the file, and
+// queues the entries to their owners
 template<typename T>
 inline void
 Ascii( AbstractDistMatrix<T>& A, const string filename )
 {
     EL_DEBUG_CSE
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
 
-    // Walk through the file once to both count the number of rows and
-    // columns and to ensure that the number of columns is consistent
-    Int height=0, width=0;
-    string line;
-    while( std::getline( file, line ) )
+    MappedFile file( filename );
+    const char* beg = reinterpret_cast<const char*>(file.Data());
+    const char* end = beg + file.Size();
+
+    const Int numLocalChunks = NumParseChunks();
+    vector<const char*> bounds;
+    LineChunks( beg, end, commSize*numLocalChunks, bounds );
+    const Int firstChunk = commRank*numLocalChunks;
+    vector<vector<T>> values( numLocalChunks );
+    vector<Int> numRows( numLocalChunks ), widths( numLocalChunks );
+    ParseChunks
+    ( numLocalChunks,
+      [&]( Int c )
+      {
+          numRows[c] =
+            AsciiRows
+            ( bounds[firstChunk+c], bounds[firstChunk+c+1], values[c],
+              widths[c] );
+      }, comm );
+
+    // Ensure that the number of columns is consistent
+    Int numLocalRows = 0;
+    Int minWidth = std::numeric_limits<Int>::max(), maxWidth = 0;
+    vector<Int> rowOffsets( numLocalChunks );
+    for( Int c=0; c<numLocalChunks; ++c )
     {
-        std::stringstream lineStream( line );
-        Int numCols=0;
-        T value;
-        while( lineStream >> value ) ++numCols;
-        if( numCols != 0 )
+        if( numRows[c] != 0 )
         {
-            if( numCols != width && width != 0 )
-                LogicError("Inconsistent number of columns");
-            else
-                width = numCols;
-            ++height;
+            minWidth = Min( minWidth, widths[c] );
+            maxWidth = Max( maxWidth, widths[c] );
         }
+        rowOffsets[c] = numLocalRows;
+        numLocalRows += numRows[c];
     }
-    file.clear();
-    file.seekg(0,file.beg);
+    minWidth = mpi::AllReduce( minWidth, mpi::MIN, comm );
+    maxWidth = mpi::AllReduce( maxWidth, mpi::MAX, comm );
+    if( maxWidth != 0 && minWidth != maxWidth )
+        LogicError("Inconsistent number of columns");
+    const Int width = maxWidth;
+    const Int height = mpi::AllReduce( numLocalRows, comm );
+    const Int firstRow =
+      mpi::Scan( numLocalRows, mpi::SUM, comm ) - numLocalRows;
 
-    // Resize the matrix and then read in our local portion
-    A.Resize( height, width );
-    Int i=0;
-    while( std::getline( file, line ) )
+    Zeros( A, height, width );
+    A.Reserve( numLocalRows*width );
+    EL_PARALLEL_FOR
+    for( Int c=0; c<numLocalChunks; ++c )
     {
-        std::stringstream lineStream( line );
-        Int j=0;
-        T value;
-        while( lineStream >> value )
-        {
-            A.Set( i, j, value );
-            ++j;
-        }
-        ++i;
+        for( Int i=0; i<numRows[c]; ++i )
+            for( Int j=0; j<width; ++j )
+                A.QueueUpdate
+                ( firstRow+rowOffsets[c]+i, j, values[c][i*width+j] );
+        SwapClear( values[c] );
     }
+    A.ProcessQueues();
 }
 
 } // namespace read
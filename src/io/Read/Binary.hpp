@@ -40,66 +40,56 @@ Binary( Matrix<T>& A, const string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
+// Collectively read the column-major height x width matrix stored after
+// 'offset' bytes of the file, with each process reading its own entries
+template<typename T>
+inline void
+ParallelBinary
+( AbstractDistMatrix<T>& A, Int height, Int width, mpi::File& file,
+  Int offset )
+{
+    EL_DEBUG_CSE
+    A.Resize( height, width );
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    vector<Int> rows(localHeight), cols(localWidth);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        rows[iLoc] = A.GlobalRow(iLoc);
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        cols[jLoc] = A.GlobalCol(jLoc);
+    mpi::FileReadAll
+    ( file, offset, height, sizeof(T), rows, cols, A.Buffer(), A.LDim() );
+}
+
 template<typename T>
 inline void
 Binary( AbstractDistMatrix<T>& A, const string filename )
 {
     EL_DEBUG_CSE
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    mpi::FileOpen( comm, filename, false, file );
 
-    Int height, width;
-    file.read( (char*)&height, sizeof(Int) );
-    file.read( (char*)&width,  sizeof(Int) );
-    const Int numBytes = FileSize( file );
+    // The root reads the metadata on behalf of the others
+    Int dims[2];
+    if( mpi::Rank(comm) == 0 )
+        mpi::FileReadAt( file, 0, dims, 2*sizeof(Int) );
+    mpi::Broadcast( dims, 2, 0, comm );
+    const Int height = dims[0];
+    const Int width = dims[1];
+    const Int numBytes = mpi::FileSize( file );
     const Int metaBytes = 2*sizeof(Int);
     const Int dataBytes = height*width*sizeof(T);
     const Int numBytesExp = metaBytes + dataBytes;
     if( numBytes != numBytesExp )
+    {
+        mpi::FileClose( file );
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
-
-    A.Resize( height, width );
-    if( A.CrossRank() != A.Root() )
-        return;
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.Height() == A.LDim() )
-            file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-        else
-            for( Int j=0; j<width; ++j )
-                file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-    }
-    else if( A.ColStride() == 1 )
-    {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
-    }
-    else
-    {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
     }
+
+    ParallelBinary( A, height, width, file, metaBytes );
+    mpi::FileClose( file );
 }
 
 } // namespace read
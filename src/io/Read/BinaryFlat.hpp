@@ -9,6 +9,8 @@
 #ifndef EL_READ_BINARYFLAT_HPP
 #define EL_READ_BINARYFLAT_HPP
 
+#include "./Binary.hpp"
+
 namespace El {
 namespace read {
 
@@ -41,57 +43,20 @@ BinaryFlat
 ( AbstractDistMatrix<T>& A, Int height, Int width, const string filename )
 {
     EL_DEBUG_CSE
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    mpi::File file;
+    mpi::FileOpen( A.Grid().ViewingComm(), filename, false, file );
 
-    const Int numBytes = FileSize( file );
+    const Int numBytes = mpi::FileSize( file );
     const Int numBytesExp = height*width*sizeof(T);
     if( numBytes != numBytesExp )
+    {
+        mpi::FileClose( file );
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
-
-    A.Resize( height, width );
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.CrossRank() == A.Root() )
-        {
-            if( A.Height() == A.LDim() )
-                file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-            else
-                for( Int j=0; j<width; ++j )
-                    file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-        }
-    }
-    else if( A.ColStride() == 1 )
-    {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
-    }
-    else
-    {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
     }
+
+    ParallelBinary( A, height, width, file, 0 );
+    mpi::FileClose( file );
 }
 
 } // namespace read
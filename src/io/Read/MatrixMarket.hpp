@@ -9,24 +9,43 @@
 #ifndef EL_READ_MATRIXMARKET_HPP
 #define EL_READ_MATRIXMARKET_HPP
 
+#include "./Parse.hpp"
+
 namespace El {
 namespace read {
 
-template<typename T>
-void MatrixMarket( Matrix<T>& A, const string filename )
+struct MatrixMarketInfo
+{
+    bool isMatrix, isArray, isComplex, isPattern;
+    bool isSymmetric, isSkewSymmetric, isHermitian;
+    Int height, width, numNonzero;
+    // The beginning of the lines holding the entries
+    const char* data;
+};
+
+// Validate the banner and extract the dimensions from the size line
+inline MatrixMarketInfo
+MatrixMarketHeader( const char* beg, const char* end )
 {
     EL_DEBUG_CSE
-    typedef Base<T> Real;
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    MatrixMarketInfo info;
+    const char* p = beg;
+    auto getLine = [&]( string& line )
+    {
+        if( p == end )
+            return false;
+        const char* lineBeg = p;
+        NextLine( p, end );
+        line.assign( lineBeg, p );
+        return true;
+    };
 
     // Read the header
     // ===============
     // Attempt to pull in the various header components
     // ------------------------------------------------
     string line, stamp, object, format, field, symmetry;
-    if( !std::getline( file, line ) )
+    if( !getLine( line ) )
         RuntimeError("Could not extract header line");
     {
         std::stringstream lineStream( line );
@@ -44,192 +63,328 @@ void MatrixMarket( Matrix<T>& A, const string filename )
     }
     // Ensure that the header components are individually valid
     // --------------------------------------------------------
-    const bool isMatrix = ( object == string("matrix") );
-    const bool isArray = ( format == string("array") );
-    const bool isComplex = ( field == string("complex") );
-    const bool isPattern = ( field == string("pattern") );
+    info.isMatrix = ( object == string("matrix") );
+    info.isArray = ( format == string("array") );
+    info.isComplex = ( field == string("complex") );
+    info.isPattern = ( field == string("pattern") );
     const bool isGeneral = ( symmetry == string("general") );
-    const bool isSymmetric = ( symmetry == string("symmetric") );
-    const bool isSkewSymmetric = ( symmetry == string("skew-symmetric") );
-    const bool isHermitian = ( symmetry == string("hermitian") );
-    if( !isMatrix && object != string("vector") )
+    info.isSymmetric = ( symmetry == string("symmetric") );
+    info.isSkewSymmetric = ( symmetry == string("skew-symmetric") );
+    info.isHermitian = ( symmetry == string("hermitian") );
+    if( !info.isMatrix && object != string("vector") )
         RuntimeError("Invalid Matrix Market object: ",object);
-    if( !isArray && format != string("coordinate") )
+    if( !info.isArray && format != string("coordinate") )
         RuntimeError("Invalid Matrix Market format: ",format);
-    if( !isComplex && !isPattern &&
+    if( !info.isComplex && !info.isPattern &&
         field != string("real") &&
         field != string("double") &&
         field != string("integer") )
         RuntimeError("Invalid Matrix Market field: ",field);
-    if( !isGeneral && !isSymmetric && !isSkewSymmetric && !isHermitian )
+    if( !isGeneral && !info.isSymmetric && !info.isSkewSymmetric &&
+        !info.isHermitian )
         RuntimeError("Invalid Matrix Market symmetry: ",symmetry);
     // Ensure that the components are consistent
     // -----------------------------------------
-    if( isArray && isPattern )
+    if( info.isArray && info.isPattern )
         RuntimeError("Pattern field requires coordinate format");
     // NOTE: This constraint is only enforced because of the note located at
     //       http://people.sc.fsu.edu/~jburkardt/data/mm/mm.html
-    if( isSkewSymmetric && isPattern )
+    if( info.isSkewSymmetric && info.isPattern )
         RuntimeError("Pattern field incompatible with skew-symmetry");
-    if( isHermitian && !isComplex )
+    if( info.isHermitian && !info.isComplex )
         RuntimeError("Hermitian symmetry requires complex data");
 
     // Skip the comment lines
     // ======================
-    while( file.peek() == '%' )
-        std::getline( file, line );
+    while( p != end && *p == '%' )
+        NextLine( p, end );
 
-    int m, n;
-    if( !std::getline( file, line ) )
+    // Read in the dimensions (and number of nonzeros)
+    // ===============================================
+    if( !getLine( line ) )
         RuntimeError("Could not extract the size line");
-    if( isArray )
+    std::stringstream lineStream( line );
+    if( !(lineStream >> info.height) )
+        RuntimeError("Missing matrix height: ",line);
+    if( info.isMatrix )
     {
-        // Read in the matrix dimensions
-        // =============================
-        if( isMatrix )
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing matrix height: ",line);
-            if( !(lineStream >> n) )
-                RuntimeError("Missing matrix width: ",line);
-        }
-        else
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing vector height: ",line);
-            n = 1;
-        }
+        if( !(lineStream >> info.width) )
+            RuntimeError("Missing matrix width: ",line);
+    }
+    else
+        info.width = 1;
+    if( info.isArray )
+        info.numNonzero = info.height*info.width;
+    else if( !(lineStream >> info.numNonzero) )
+        RuntimeError("Missing nonzeros entry: ",line);
 
-        // Resize the matrix
-        // =================
-        Zeros( A, m, n );
+    info.data = p;
+    return info;
+}
 
-        // Now read in the data
-        // ====================
-        Real realPart, imagPart;
-        for( Int j=0; j<n; ++j )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                if( !std::getline( file, line ) )
-                    RuntimeError("Could not get entry (",i,",",j,")");
-                std::stringstream lineStream( line );
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real part of entry (",i,",",j,")");
-                A.SetRealPart( i, j, realPart );
-                if( isComplex )
-                {
-                    if( !(lineStream >> imagPart) )
-                        RuntimeError
-                        ("Could not extract imag part of entry (",i,",",j,")");
-                    A.SetImagPart( i, j, imagPart );
-                }
-            }
-        }
+template<typename T>
+inline bool MatrixMarketValue
+( const char*& p, const char* end, bool isComplex, T& value )
+{
+    Base<T> realPart, imagPart;
+    if( !ParseValue( p, end, realPart ) )
+        return false;
+    value = realPart;
+    if( isComplex )
+    {
+        if( !ParseValue( p, end, imagPart ) )
+            return false;
+        SetImagPart( value, imagPart );
     }
-    else
+    return true;
+}
+
+// Append the values of the (array format) entries in [p,end)
+template<typename T>
+inline void MatrixMarketArray
+( const MatrixMarketInfo& info, const char* p, const char* end,
+  vector<T>& values )
+{
+    T value;
+    while( p != end )
     {
-        // Read in the matrix dimensions and number of nonzeros
-        // ====================================================
-        int numNonzero;
-        if( isMatrix )
+        if( !AtLineEnd( p, end ) )
         {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing matrix height: ",line);
-            if( !(lineStream >> n) )
-                RuntimeError("Missing matrix width: ",line);
-            if( !(lineStream >> numNonzero) )
-                RuntimeError("Missing nonzeros entry: ",line);
+            if( !MatrixMarketValue( p, end, info.isComplex, value ) )
+                RuntimeError("Could not parse entry ",values.size());
+            values.push_back( value );
         }
-        else
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing vector height: ",line);
-            n = 1;
-            if( !(lineStream >> numNonzero) )
-                RuntimeError("Missing nonzeros entry: ",line);
-        }
-
-        // Create a matrix of zeros
-        // ========================
-        Zeros( A, m, n );
+        NextLine( p, end );
+    }
+}
 
-        // Fill in the nonzero entries
-        // ===========================
-        int i, j;
-        Real realPart, imagPart;
-        for( Int k=0; k<numNonzero; ++k )
+// Pass each of the (coordinate format) entries in [p,end), with zero-based
+// indices, to 'insert' and return the number of entries
+template<typename T,typename Function>
+inline Int MatrixMarketCoordinates
+( const MatrixMarketInfo& info, const char* p, const char* end,
+  Function insert )
+{
+    Int numEntries = 0;
+    Entry<T> entry;
+    while( p != end )
+    {
+        if( !AtLineEnd( p, end ) )
         {
-            if( !std::getline( file, line ) )
-                RuntimeError("Could not get nonzero ",k);
-            std::stringstream lineStream( line );
-            if( !(lineStream >> i) )
-                RuntimeError("Could not extract row coordinate of nonzero ",k);
-            --i; // convert from Fortran to C indexing
-            if( isMatrix )
-            {
-                if( !(lineStream >> j) )
-                    RuntimeError
-                    ("Could not extract col coordinate of nonzero ",k);
-                --j;
-            }
-            else
-                j = 0;
-
-            if( isPattern )
-            {
-                A.Set( i, j, T(1) );
-            }
-            else
-            {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real part of entry (",i,",",j,")");
-                A.UpdateRealPart( i, j, realPart );
-                if( isComplex )
-                {
-                    if( !(lineStream >> imagPart) )
-                        RuntimeError
-                        ("Could not extract imag part of entry (",i,",",j,")");
-                    A.UpdateImagPart( i, j, imagPart );
-                }
-            }
+            if( !ParseInt( p, end, entry.i ) )
+                RuntimeError("Could not extract row coordinate of nonzero");
+            entry.j = 1;
+            if( info.isMatrix && !ParseInt( p, end, entry.j ) )
+                RuntimeError("Could not extract col coordinate of nonzero");
+            // Convert from Fortran to C indexing
+            --entry.i;
+            --entry.j;
+            if( entry.i < 0 || entry.i >= info.height ||
+                entry.j < 0 || entry.j >= info.width )
+                RuntimeError
+                ("Nonzero (",entry.i,",",entry.j,") is out of bounds");
+            if( info.isPattern )
+                entry.value = T(1);
+            else if( !MatrixMarketValue( p, end, info.isComplex, entry.value ) )
+                RuntimeError
+                ("Could not extract value of entry (",entry.i,",",entry.j,")");
+            insert( entry );
+            ++numEntries;
         }
+        NextLine( p, end );
     }
+    return numEntries;
+}
 
-    if( isSymmetric )
+// Fill in the strictly upper triangle implied by the symmetry
+template<typename T,typename MatrixType>
+inline void
+MatrixMarketSymmetry( const MatrixMarketInfo& info, MatrixType& A )
+{
+    EL_DEBUG_CSE
+    if( info.isSymmetric )
         MakeSymmetric( LOWER, A );
-    if( isHermitian )
+    if( info.isHermitian )
         MakeHermitian( LOWER, A );
     // I'm not certain of what the MM standard is for complex skew-symmetry,
     // so I'll default to assuming no conjugation
     const bool conjugateSkew = false;
-    if( isSkewSymmetric )
+    if( info.isSkewSymmetric )
     {
         MakeSymmetric( LOWER, A, conjugateSkew );
         ScaleTrapezoid( T(-1), UPPER, A, 1 );
     }
 }
 
+// The entries are parsed directly from a mapping of the file, with the
+// threads of the process each handling a contiguous range of lines
+template<typename T>
+void MatrixMarket( Matrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    MappedFile file( filename );
+    const char* beg = reinterpret_cast<const char*>(file.Data());
+    const char* end = beg + file.Size();
+    const MatrixMarketInfo info = MatrixMarketHeader( beg, end );
+    Zeros( A, info.height, info.width );
+
+    const Int numChunks = NumParseChunks();
+    vector<const char*> bounds;
+    LineChunks( info.data, end, numChunks, bounds );
+    if( info.isArray )
+    {
+        vector<vector<T>> values( numChunks );
+        ParseChunks
+        ( numChunks,
+          [&]( Int c )
+          { MatrixMarketArray( info, bounds[c], bounds[c+1], values[c] ); } );
+
+        // The entries are stored in column-major order
+        vector<Int> offsets( numChunks+1, 0 );
+        for( Int c=0; c<numChunks; ++c )
+            offsets[c+1] = offsets[c] + values[c].size();
+        if( offsets[numChunks] != info.numNonzero )
+            RuntimeError
+            ("Expected ",info.numNonzero," entries but found ",
+             offsets[numChunks]);
+        const Int m = info.height;
+        T* ABuf = A.Buffer();
+        const Int ALDim = A.LDim();
+        EL_PARALLEL_FOR
+        for( Int c=0; c<numChunks; ++c )
+        {
+            const Int numValues = values[c].size();
+            for( Int k=0; k<numValues; ++k )
+            {
+                const Int index = offsets[c] + k;
+                ABuf[(index%m)+(index/m)*ALDim] = values[c][k];
+            }
+        }
+    }
+    else
+    {
+        vector<vector<Entry<T>>> entries( numChunks );
+        ParseChunks
+        ( numChunks,
+          [&]( Int c )
+          {
+              MatrixMarketCoordinates<T>
+              ( info, bounds[c], bounds[c+1],
+                [&]( const Entry<T>& entry )
+                { entries[c].push_back( entry ); } );
+          } );
+
+        // Duplicate entries are summed (other than for patterns)
+        Int numEntries = 0;
+        for( Int c=0; c<numChunks; ++c )
+        {
+            for( const auto& entry : entries[c] )
+            {
+                if( info.isPattern )
+                    A.Set( entry.i, entry.j, entry.value );
+                else
+                    A.Update( entry.i, entry.j, entry.value );
+            }
+            numEntries += entries[c].size();
+            SwapClear( entries[c] );
+        }
+        if( numEntries != info.numNonzero )
+            RuntimeError
+            ("Expected ",info.numNonzero," nonzeros but found ",numEntries);
+    }
+    MatrixMarketSymmetry<T>( info, A );
+}
+
+// Each process parses a contiguous range of the lines of the file, and
+// queues the entries to their owners
 template<typename T>
 void MatrixMarket( AbstractDistMatrix<T>& A, const string filename )
 {
     EL_DEBUG_CSE
-    // TODO: Use a WriteProxy instead
-    DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A.Grid() );
-    if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
+    mpi::Comm comm = A.Grid().ViewingComm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    MappedFile file( filename );
+    const char* beg = reinterpret_cast<const char*>(file.Data());
+    const char* end = beg + file.Size();
+    const MatrixMarketInfo info = MatrixMarketHeader( beg, end );
+    Zeros( A, info.height, info.width );
+
+    // Each process only touches the pages of its own chunks
+    const Int numLocalChunks = NumParseChunks();
+    vector<const char*> bounds;
+    LineChunks( info.data, end, commSize*numLocalChunks, bounds );
+    const Int firstChunk = commRank*numLocalChunks;
+
+    Int numLocalEntries = 0;
+    if( info.isArray )
+    {
+        vector<vector<T>> values( numLocalChunks );
+        ParseChunks
+        ( numLocalChunks,
+          [&]( Int c )
+          {
+              MatrixMarketArray
+              ( info, bounds[firstChunk+c], bounds[firstChunk+c+1],
+                values[c] );
+          }, comm );
+
+        // Entry k of the file is entry (k % m, k / m) of the matrix
+        vector<Int> offsets( numLocalChunks+1, 0 );
+        for( Int c=0; c<numLocalChunks; ++c )
+            offsets[c+1] = offsets[c] + values[c].size();
+        numLocalEntries = offsets[numLocalChunks];
+        const Int numEntries = mpi::AllReduce( numLocalEntries, comm );
+        if( numEntries != info.numNonzero )
+            RuntimeError
+            ("Expected ",info.numNonzero," entries but found ",numEntries);
+        const Int firstEntry =
+          mpi::Scan( numLocalEntries, mpi::SUM, comm ) - numLocalEntries;
+        const Int m = info.height;
+        A.Reserve( numLocalEntries );
+        EL_PARALLEL_FOR
+        for( Int c=0; c<numLocalChunks; ++c )
+        {
+            const Int numValues = values[c].size();
+            for( Int k=0; k<numValues; ++k )
+            {
+                const Int index = firstEntry + offsets[c] + k;
+                A.QueueUpdate( index%m, index/m, values[c][k] );
+            }
+            SwapClear( values[c] );
+        }
+    }
+    else
+    {
+        // The threads queue their entries directly (see Reserve)
+        A.Reserve( 0 );
+        vector<Int> numChunkEntries( numLocalChunks );
+        ParseChunks
+        ( numLocalChunks,
+          [&]( Int c )
+          {
+              numChunkEntries[c] = MatrixMarketCoordinates<T>
+              ( info, bounds[firstChunk+c], bounds[firstChunk+c+1],
+                [&]( const Entry<T>& entry ) { A.QueueUpdate( entry ); } );
+          }, comm );
+        for( Int c=0; c<numLocalChunks; ++c )
+            numLocalEntries += numChunkEntries[c];
+    }
+    A.ProcessQueues();
+    if( !info.isArray )
+    {
+        const Int numEntries = mpi::AllReduce( numLocalEntries, comm );
+        if( numEntries != info.numNonzero )
+            RuntimeError
+            ("Expected ",info.numNonzero," nonzeros but found ",numEntries);
+    }
+
+    if( info.isSymmetric || info.isHermitian || info.isSkewSymmetric )
     {
-        MatrixMarket( A_CIRC_CIRC.Matrix(), filename );
-        A_CIRC_CIRC.Resize
-        ( A_CIRC_CIRC.Matrix().Height(), A_CIRC_CIRC.Matrix().Width() );
+        DistMatrixReadWriteProxy<T,T,MC,MR> AProx( A );
+        MatrixMarketSymmetry<T>( info, AProx.Get() );
     }
-    A_CIRC_CIRC.MakeSizeConsistent();
-    Copy( A_CIRC_CIRC, A );
 }
 
 } // namespace read
@@ -0,0 +1,247 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_PARSE_HPP
+#define EL_READ_PARSE_HPP
+
+namespace El {
+namespace read {
+
+// Parsing of the whitespace-separated tokens of (memory-mapped) text files.
+// Each routine advances 'p', which must not pass 'end', and no memory is
+// allocated for integers or single and double-precision numbers.
+
+inline bool IsBlank( char c ) EL_NO_EXCEPT
+{ return c == ' ' || c == '\t' || c == '\r'; }
+
+inline void SkipBlanks( const char*& p, const char* end ) EL_NO_EXCEPT
+{
+    while( p != end && IsBlank(*p) )
+        ++p;
+}
+
+// Advance to the beginning of the next line
+inline void NextLine( const char*& p, const char* end ) EL_NO_EXCEPT
+{
+    p = static_cast<const char*>(std::memchr( p, '\n', end-p ));
+    p = ( p == nullptr ? end : p+1 );
+}
+
+// Whether the remainder of the current line is blank
+inline bool AtLineEnd( const char*& p, const char* end ) EL_NO_EXCEPT
+{
+    SkipBlanks( p, end );
+    return p == end || *p == '\n';
+}
+
+inline const char* TokenEnd( const char* p, const char* end ) EL_NO_EXCEPT
+{
+    while( p != end && !IsBlank(*p) && *p != '\n' )
+        ++p;
+    return p;
+}
+
+inline bool ParseInt( const char*& p, const char* end, Int& value )
+EL_NO_EXCEPT
+{
+    SkipBlanks( p, end );
+    bool negative = false;
+    if( p != end && (*p == '-' || *p == '+') )
+    {
+        negative = ( *p == '-' );
+        ++p;
+    }
+    if( p == end || *p < '0' || *p > '9' )
+        return false;
+    Int magnitude = 0;
+    while( p != end && *p >= '0' && *p <= '9' )
+        magnitude = 10*magnitude + (*p++ - '0');
+    value = ( negative ? -magnitude : magnitude );
+    return p == end || IsBlank(*p) || *p == '\n';
+}
+
+// Decimal numbers whose significand and power of ten are both exactly
+// representable are converted with a single (correctly rounded) product or
+// quotient; all others fall back to the C library
+template<typename Real>
+inline bool ParseFloat
+( const char*& p, const char* end, Real& value,
+  Real (*convert)( const char*, char** ), int maxExactPow10 )
+{
+    SkipBlanks( p, end );
+    const char* tokenBeg = p;
+    const char* tokenEnd = TokenEnd( p, end );
+    if( tokenBeg == tokenEnd )
+        return false;
+
+    bool negative = false;
+    if( *p == '-' || *p == '+' )
+    {
+        negative = ( *p == '-' );
+        ++p;
+    }
+    unsigned long long significand = 0;
+    int numDigits = 0, pow10 = 0;
+    bool sawDigit = false;
+    for( ; p != tokenEnd && *p >= '0' && *p <= '9'; ++p, sawDigit=true )
+    {
+        if( significand != 0 || *p != '0' )
+            ++numDigits;
+        significand = 10*significand + (*p - '0');
+    }
+    if( p != tokenEnd && *p == '.' )
+    {
+        for( ++p; p != tokenEnd && *p >= '0' && *p <= '9'; ++p )
+        {
+            sawDigit = true;
+            if( significand != 0 || *p != '0' )
+                ++numDigits;
+            significand = 10*significand + (*p - '0');
+            --pow10;
+        }
+    }
+    if( sawDigit && p != tokenEnd && (*p == 'e' || *p == 'E') )
+    {
+        ++p;
+        bool negativeExp = false;
+        if( p != tokenEnd && (*p == '-' || *p == '+') )
+        {
+            negativeExp = ( *p == '-' );
+            ++p;
+        }
+        int exponent = 0;
+        for( ; p != tokenEnd && *p >= '0' && *p <= '9'; ++p )
+            exponent = Min( 10*exponent + (*p - '0'), 100000 );
+        pow10 += ( negativeExp ? -exponent : exponent );
+    }
+
+    const unsigned long long maxExactSignificand =
+      1ULL << std::numeric_limits<Real>::digits;
+    if( sawDigit && p == tokenEnd && numDigits <= 19 &&
+        significand <= maxExactSignificand &&
+        pow10 >= -maxExactPow10 && pow10 <= maxExactPow10 )
+    {
+        static const Real powers[] =
+          { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21,
+            1e22 };
+        value = Real(significand);
+        if( pow10 < 0 )
+            value /= powers[-pow10];
+        else
+            value *= powers[pow10];
+        if( negative )
+            value = -value;
+        return true;
+    }
+
+    // Hexadecimal, infinite, NaN, long, or otherwise unusual tokens
+    char buffer[128];
+    const size_t tokenSize = tokenEnd - tokenBeg;
+    if( tokenSize >= sizeof(buffer) )
+        return false;
+    std::memcpy( buffer, tokenBeg, tokenSize );
+    buffer[tokenSize] = '\0';
+    char* parseEnd;
+    value = convert( buffer, &parseEnd );
+    p = tokenEnd;
+    return parseEnd == buffer+tokenSize;
+}
+
+inline bool ParseValue( const char*& p, const char* end, double& value )
+{ return ParseFloat( p, end, value, std::strtod, 22 ); }
+
+inline bool ParseValue( const char*& p, const char* end, float& value )
+{ return ParseFloat( p, end, value, std::strtof, 10 ); }
+
+inline bool ParseValue( const char*& p, const char* end, Int& value )
+{ return ParseInt( p, end, value ); }
+
+// Other types are extracted from a copy of the token as before
+template<typename T>
+inline bool ParseValue( const char*& p, const char* end, T& value )
+{
+    SkipBlanks( p, end );
+    const char* tokenEnd = TokenEnd( p, end );
+    if( p == tokenEnd )
+        return false;
+    std::istringstream tokenStream( string(p,tokenEnd) );
+    p = tokenEnd;
+    return bool(tokenStream >> value);
+}
+
+// Split [beg,end) into (at most) numChunks pieces of roughly equal size
+// which each begin at the start of a line; chunk c is [bounds[c],bounds[c+1])
+inline void LineChunks
+( const char* beg, const char* end, Int numChunks,
+  vector<const char*>& bounds )
+{
+    bounds.resize( numChunks+1 );
+    bounds[0] = beg;
+    const Int numBytes = end - beg;
+    for( Int c=1; c<numChunks; ++c )
+    {
+        const char* p = beg + (numBytes*c)/numChunks;
+        if( p < bounds[c-1] )
+            p = bounds[c-1];
+        else if( p != beg && p[-1] != '\n' )
+            NextLine( p, end );
+        bounds[c] = p;
+    }
+    bounds[numChunks] = end;
+}
+
+// The number of chunks to split the input of a process into
+inline Int NumParseChunks()
+{
+#ifdef EL_HYBRID
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+// Run parse(c) over each chunk c in parallel. An exception thrown by any
+// chunk is rethrown after all have finished. In the distributed case, the
+// failure is shared over the communicator so that no process is left
+// waiting within a subsequent collective.
+template<typename Function>
+inline void ParseChunks
+( Int numChunks, Function parse, mpi::Comm comm=mpi::COMM_SELF )
+{
+    vector<string> errors( numChunks );
+    EL_PARALLEL_FOR
+    for( Int c=0; c<numChunks; ++c )
+    {
+        try { parse( c ); }
+        catch( std::exception& e ) { errors[c] = e.what(); }
+    }
+    int failed = 0;
+    string error;
+    for( const auto& chunkError : errors )
+    {
+        if( !chunkError.empty() )
+        {
+            failed = 1;
+            error = chunkError;
+            break;
+        }
+    }
+    if( mpi::AllReduce( failed, mpi::MAX, comm ) )
+    {
+        if( failed )
+            RuntimeError( error );
+        else
+            RuntimeError("Another process failed to parse its input");
+    }
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_PARSE_HPP
@@ -49,7 +49,15 @@ void Spy( const AbstractDistMatrix<T>& A, string title, Base<T> tol )
 #ifdef EL_HAVE_QT5
     if( GuiDisabled() )
         LogicError("GUI was disabled");
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    const Int maxSize = MaxImageSize();
+    if( A.Height() > maxSize || A.Width() > maxSize )
+    {
+        Matrix<double> tile;
+        if( ImageTile
+            ( A, tile, maxSize, maxSize, TILE_NONZERO_COUNT, false, tol ) )
+            Spy( tile, title );
+    }
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Spy( A.LockedMatrix(), title, tol );
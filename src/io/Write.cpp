@@ -49,7 +49,20 @@ void Write
   string basename, FileFormat format, string title )
 {
     EL_DEBUG_CSE
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( format == BINARY || format == BINARY_FLAT )
+    {
+        // Each process writes its own entries via collective MPI-IO
+        if( format == BINARY )
+            write::Binary( A, basename );
+        else
+            write::BinaryFlat( A, basename );
+    }
+    else if( format >= BMP && format != MATRIX_MARKET &&
+             (A.Height() > MaxImageSize() || A.Width() > MaxImageSize()) )
+    {
+        write::TiledImage( A, basename, format );
+    }
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
@@ -62,11 +75,65 @@ void Write
     }
 }
 
+namespace {
+
+std::future<void> ReadyFuture()
+{
+    std::promise<void> promise;
+    promise.set_value();
+    return promise.get_future();
+}
+
+} // anonymous namespace
+
+template<typename T>
+std::future<void> WriteAsync
+( const Matrix<T>& A, string basename, FileFormat format, string title )
+{
+    EL_DEBUG_CSE
+    // Images depend upon the global color map and Qt should only be used
+    // from the main thread
+    if( format >= BMP && format != MATRIX_MARKET )
+    {
+        Write( A, basename, format, title );
+        return ReadyFuture();
+    }
+    auto staged = std::make_shared<Matrix<T>>( A );
+    return std::async
+    ( std::launch::async,
+      [=]() { Write( *staged, basename, format, title ); } );
+}
+
+template<typename T>
+std::future<void> WriteAsync
+( const AbstractDistMatrix<T>& A,
+  string basename, FileFormat format, string title )
+{
+    EL_DEBUG_CSE
+    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    {
+        if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
+            return WriteAsync( A.LockedMatrix(), basename, format, title );
+        return ReadyFuture();
+    }
+    DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
+    if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
+        return WriteAsync
+        ( A_CIRC_CIRC.LockedMatrix(), basename, format, title );
+    return ReadyFuture();
+}
+
 #define PROTO(T) \
   template void Write \
   ( const Matrix<T>& A, \
     string basename, FileFormat format, string title ); \
   template void Write \
+  ( const AbstractDistMatrix<T>& A, \
+    string basename, FileFormat format, string title ); \
+  template std::future<void> WriteAsync \
+  ( const Matrix<T>& A, \
+    string basename, FileFormat format, string title ); \
+  template std::future<void> WriteAsync \
   ( const AbstractDistMatrix<T>& A, \
     string basename, FileFormat format, string title );
 
@@ -35,6 +35,49 @@ Binary( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Collectively write the column-major matrix after 'offset' bytes of the
+// file, with each entry written by the first of the processes owning it
+template<typename T>
+inline void
+ParallelBinary( const AbstractDistMatrix<T>& A, mpi::File& file, Int offset )
+{
+    EL_DEBUG_CSE
+    vector<Int> rows, cols;
+    if( A.RedundantRank() == 0 )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        rows.resize( localHeight );
+        cols.resize( localWidth );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            rows[iLoc] = A.GlobalRow(iLoc);
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            cols[jLoc] = A.GlobalCol(jLoc);
+    }
+    mpi::FileWriteAll
+    ( file, offset, A.Height(), sizeof(T), rows, cols,
+      A.LockedBuffer(), A.LDim() );
+}
+
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    mpi::FileOpen( comm, filename, true, file );
+
+    if( mpi::Rank(comm) == 0 )
+    {
+        const Int dims[2] = { A.Height(), A.Width() };
+        mpi::FileWriteAt( file, 0, dims, 2*sizeof(Int) );
+    }
+    ParallelBinary( A, file, 2*sizeof(Int) );
+    mpi::FileClose( file );
+}
+
 } // namespace write
 } // namespace El
 
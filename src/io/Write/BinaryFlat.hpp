@@ -9,6 +9,8 @@
 #ifndef EL_WRITE_BINARYFLAT_HPP
 #define EL_WRITE_BINARYFLAT_HPP
 
+#include "./Binary.hpp"
+
 namespace El {
 namespace write {
 
@@ -30,6 +32,18 @@ BinaryFlat( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+template<typename T>
+inline void
+BinaryFlat( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY_FLAT);
+    mpi::File file;
+    mpi::FileOpen( A.Grid().ViewingComm(), filename, true, file );
+    ParallelBinary( A, file, 0 );
+    mpi::FileClose( file );
+}
+
 } // namespace write
 } // namespace El
 
@@ -149,6 +149,29 @@ void Image
     ImagPartImage( A, basename+"_imag", format );
 }
 
+// Only the downsampled tiles of a large distributed matrix are combined
+template<typename T>
+void TiledImage
+( const AbstractDistMatrix<T>& A, string basename="matrix",
+  FileFormat format=PNG )
+{
+    EL_DEBUG_CSE
+    const Int maxSize = MaxImageSize();
+    Matrix<double> realTile, imagTile;
+    const bool root = ImageTile( A, realTile, maxSize, maxSize );
+    if( IsComplex<T>::value )
+    {
+        ImageTile( A, imagTile, maxSize, maxSize, TILE_MEAN, true );
+        if( root )
+        {
+            RealPartImage( realTile, basename+"_real", format );
+            RealPartImage( imagTile, basename+"_imag", format );
+        }
+    }
+    else if( root )
+        RealPartImage( realTile, basename, format );
+}
+
 } // namespace write
 } // namespace El
 
@@ -11,6 +11,9 @@
 #include "./Bidiag/Apply.hpp"
 #include "./Bidiag/LowerBlocked.hpp"
 #include "./Bidiag/UpperBlocked.hpp"
+#include "./Bidiag/TwoStage.hpp"
+
+#include "./Subgrid.hpp"
 
 namespace El {
 
@@ -29,15 +32,57 @@ void Bidiag
 
 template<typename F> 
 void Bidiag
-( AbstractDistMatrix<F>& A, 
+( AbstractDistMatrix<F>& APre, 
   AbstractDistMatrix<F>& householderScalarsP,
-  AbstractDistMatrix<F>& householderScalarsQ )
+  AbstractDistMatrix<F>& householderScalarsQ,
+  const BidiagCtrl& ctrl )
 {
     EL_DEBUG_CSE
-    if( A.Height() >= A.Width() )
-        bidiag::UpperBlocked( A, householderScalarsP, householderScalarsQ );
-    else
-        bidiag::LowerBlocked( A, householderScalarsP, householderScalarsQ );
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    auto reduce =
+      [&]( AbstractDistMatrix<F>& B,
+           AbstractDistMatrix<F>& scalarsP,
+           AbstractDistMatrix<F>& scalarsQ )
+      {
+          if( m >= n )
+              bidiag::UpperBlocked( B, scalarsP, scalarsQ );
+          else
+              bidiag::LowerBlocked( B, scalarsP, scalarsQ );
+      };
+
+    const Grid& grid = APre.Grid();
+    int gridHeight=grid.Height(), gridWidth=grid.Width();
+    if( ctrl.adaptiveGrid )
+        SelectCondenseGrid
+        ( CONDENSE_BIDIAG, m, n, grid, gridHeight, gridWidth, sizeof(F) );
+    if( gridHeight == grid.Height() && gridWidth == grid.Width() )
+    {
+        reduce( APre, householderScalarsP, householderScalarsQ );
+        return;
+    }
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR>
+      householderScalarsPProx( householderScalarsP ),
+      householderScalarsQProx( householderScalarsQ );
+    auto& A = AProx.Get();
+    auto& scalarsP = householderScalarsPProx.Get();
+    auto& scalarsQ = householderScalarsQProx.Get();
+    condense::ReduceOnSubgrid
+    ( A, gridHeight, gridWidth, grid.Order(),
+      [&]( DistMatrix<F>& ASub )
+      {
+          const Grid& subgrid = ASub.Grid();
+          DistMatrix<F,STAR,STAR> scalarsPSub(subgrid), scalarsQSub(subgrid);
+          if( ASub.Participating() )
+              reduce( ASub, scalarsPSub, scalarsQSub );
+          const bool includeViewers = true;
+          scalarsPSub.MakeConsistent( includeViewers );
+          scalarsQSub.MakeConsistent( includeViewers );
+          scalarsP = scalarsPSub;
+          scalarsQ = scalarsQSub;
+      } );
 }
 
 namespace bidiag {
@@ -175,7 +220,8 @@ void ExplicitCondensed( AbstractDistMatrix<F>& A )
   template void Bidiag \
   ( AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& householderScalarsP, \
-    AbstractDistMatrix<F>& householderScalarsQ ); \
+    AbstractDistMatrix<F>& householderScalarsQ, \
+    const BidiagCtrl& ctrl ); \
   template void bidiag::Explicit \
   ( Matrix<F>& A, \
     Matrix<F>& P, \
@@ -186,6 +232,8 @@ void ExplicitCondensed( AbstractDistMatrix<F>& A )
     AbstractDistMatrix<F>& Q ); \
   template void bidiag::ExplicitCondensed( Matrix<F>& A ); \
   template void bidiag::ExplicitCondensed( AbstractDistMatrix<F>& A ); \
+  template void bidiag::TwoStageCondensed \
+  ( AbstractDistMatrix<F>& A, Int bandwidth ); \
   template void bidiag::ApplyQ \
   ( LeftOrRight side, Orientation orientation, \
     const Matrix<F>& A, \
@@ -0,0 +1,184 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BIDIAG_TWOSTAGE_HPP
+#define EL_BIDIAG_TWOSTAGE_HPP
+
+namespace El {
+namespace bidiag {
+
+// Two-stage reduction of a matrix with at least as many rows as columns to
+// real upper bidiagonal form which discards the unitary transformations:
+//
+//  1) A dense-to-band reduction which alternates between a QR factorization
+//     of each panel of 'bandwidth' columns and an LQ factorization of the
+//     corresponding row panel to its right. The trailing matrix is updated
+//     with blocked applications of the packed reflectors (qr::ApplyQ and
+//     lq::ApplyQ), so that the O(m n^2) work is level-3.
+//
+//  2) A band-to-bidiagonal reduction which annihilates the outermost
+//     superdiagonal one entry at a time using a column rotation and chases
+//     the resulting bulges off of the bottom of the matrix with alternating
+//     row and column rotations. This only requires O(n^2 bandwidth) work on
+//     a compact copy of the band.
+
+template<typename F>
+void UpperReduceToBand( DistMatrix<F>& A, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Real,MD,STAR> signature(g);
+    for( Int k=0; k<n; k+=bandwidth )
+    {
+        const Int nb = Min(bandwidth,n-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, n );
+
+        auto ACol = A( IR(k,m), ind1 );
+        auto ARight = A( IR(k,m), ind2 );
+        QR( ACol, householderScalars, signature );
+        qr::ApplyQ
+        ( LEFT, ADJOINT, ACol, householderScalars, signature, ARight );
+        MakeTrapezoidal( UPPER, ACol );
+        if( k+nb == n )
+            break;
+
+        auto ARow = A( ind1, ind2 );
+        auto ABottom = A( IR(k+nb,m), ind2 );
+        LQ( ARow, householderScalars, signature );
+        lq::ApplyQ
+        ( RIGHT, ADJOINT, ARow, householderScalars, signature, ABottom );
+        MakeTrapezoidal( LOWER, ARow );
+    }
+}
+
+// Reduce an n x n upper band matrix with the given bandwidth, stored in the
+// format B(j-i+1,j) = A(i,j), with room for the subdiagonal and
+// bandwidth+1 superdiagonals, to upper bidiagonal form.
+template<typename F>
+void BandToBidiag( Matrix<F>& B, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = B.Width();
+    auto entry = [&]( Int i, Int j ) -> F& { return B(j-i+1,j); };
+    for( Int d=bandwidth; d>=2; --d )
+    {
+        for( Int k=0; k+d<n; ++k )
+        {
+            // Annihilate A(row,col+1) against A(row,col) from the right and
+            // then the resulting subdiagonal bulge from the left, which
+            // introduces a new bulge d columns further to the right
+            Int row = k;
+            for( Int col=k+d-1; col+1<n; row=col, col+=d )
+            {
+                if( entry(row,col+1) == F(0) )
+                    break;
+                Real c;
+                F s;
+                F rho =
+                  Givens( Conj(entry(row,col)), Conj(entry(row,col+1)), c, s );
+                for( Int i=Max(col-d,Int(0)); i<=col+1; ++i )
+                {
+                    F& x = entry(i,col);
+                    F& y = entry(i,col+1);
+                    const F xOld = x;
+                    x = xOld*c + y*Conj(s);
+                    y = -xOld*s + y*c;
+                }
+                entry(row,col) = Conj(rho);
+                entry(row,col+1) = 0;
+
+                rho = Givens( entry(col,col), entry(col+1,col), c, s );
+                for( Int j=col; j<=Min(col+1+d,n-1); ++j )
+                {
+                    F& x = entry(col,j);
+                    F& y = entry(col+1,j);
+                    const F xOld = x;
+                    x = c*xOld + s*y;
+                    y = -Conj(s)*xOld + c*y;
+                }
+                entry(col,col) = rho;
+                entry(col+1,col) = 0;
+            }
+        }
+    }
+}
+
+template<typename F>
+void TwoStageCondensed( AbstractDistMatrix<F>& APre, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    EL_TRACE_REGION("Bidiag::TwoStage");
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( bandwidth <= 0 )
+        bandwidth = Blocksize();
+    bandwidth = Max(Min(bandwidth,minDim-1),Int(1));
+
+    // Wide matrices are handled through their adjoints, whose real upper
+    // bidiagonal forms are the transposes of lower bidiagonal forms of A
+    DistMatrix<F> AAdj(A.Grid());
+    if( m < n )
+        Adjoint( A, AAdj );
+    DistMatrix<F>& ATall = ( m >= n ? A : AAdj );
+    UpperReduceToBand( ATall, bandwidth );
+
+    // Replicate the leading minDim x minDim band on every process so that
+    // the chase requires no further communication
+    Matrix<F> B;
+    Zeros( B, bandwidth+3, minDim );
+    {
+        const Int localHeight = ATall.LocalHeight();
+        const Int localWidth = ATall.LocalWidth();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = ATall.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Int i = ATall.GlobalRow(iLoc);
+                if( j >= i && j-i <= bandwidth )
+                    B(j-i+1,j) = ATall.GetLocal(iLoc,jLoc);
+            }
+        }
+    }
+    mpi::AllReduce( B.Buffer(), B.Height()*B.Width(), A.DistComm() );
+
+    BandToBidiag( B, bandwidth );
+
+    // Diagonal unitary transformations from both sides make the bidiagonal
+    // matrix real and nonnegative
+    const Int offset = ( m >= n ? 1 : -1 );
+    Zero( A );
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i == j && i < minDim )
+                A.SetLocal( iLoc, jLoc, Abs(B(1,j)) );
+            else if( j-i == offset && Max(i,j) < minDim )
+                A.SetLocal( iLoc, jLoc, Abs(B(2,Max(i,j))) );
+        }
+    }
+}
+
+} // namespace bidiag
+} // namespace El
+
+#endif // ifndef EL_BIDIAG_TWOSTAGE_HPP
@@ -0,0 +1,128 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+// The number of stages of a tree-based collective over p processes
+double NumStages( Int p )
+{
+    double numStages = 0;
+    for( Int q=1; q<p; q*=2 )
+        ++numStages;
+    return numStages;
+}
+
+} // anonymous namespace
+
+double CondenseCost
+( CondenseReduction reduction, Int m, Int n, int gridHeight, int gridWidth,
+  Int entrySize )
+{
+    EL_DEBUG_CSE
+    const GemmCostModel& model = GetGemmCostModel();
+    const double r = gridHeight;
+    const double c = gridWidth;
+    const double p = r*c;
+    const double nb = Blocksize();
+    const double colStages = NumStages( gridHeight );
+    const double rowStages = NumStages( gridWidth );
+    const double stages = NumStages( gridHeight*gridWidth );
+    const double mMax = Max(m,n);
+    const double nMin = Min(m,n);
+
+    // The number of matrix-vector steps, the flop count, and the number of
+    // stages needed to transpose a vector between [MC,* ] and [MR,* ]
+    double numSteps, numFlops, transStages;
+    switch( reduction )
+    {
+    case CONDENSE_BIDIAG:
+        numSteps = 2*nMin;
+        numFlops = 4*mMax*nMin*nMin - 4*nMin*nMin*nMin/3;
+        transStages = stages;
+        break;
+    case CONDENSE_HERMITIAN_TRIDIAG:
+        numSteps = nMin;
+        numFlops = 4*nMin*nMin*nMin/3;
+        // The square-grid algorithm swaps vectors between pairs of processes
+        transStages = ( gridHeight == gridWidth ? 1 : stages );
+        break;
+    case CONDENSE_HESSENBERG:
+        numSteps = 2*nMin;
+        numFlops = 10*nMin*nMin*nMin/3;
+        transStages = stages;
+        break;
+    default:
+        LogicError("No cost model for reduction ",Int(reduction));
+        return 0;
+    }
+
+    // Each step broadcasts and sums vectors within the process rows and
+    // columns before transposing them, and each panel update gathers the
+    // panels over the trailing matrix, whose dimensions average out to
+    // (mMax-nMin/2) x (nMin/2)
+    const double numPanels = Ceil(nMin/nb);
+    const double numMessages =
+      numSteps*(2*(colStages+rowStages)+transStages) +
+      numPanels*2*(colStages+rowStages);
+    const double numBytes =
+      2*entrySize*(numSteps+nMin)*((mMax-nMin/2)/r + (nMin/2)/c);
+    return model.latency*numMessages +
+           model.inverseBandwidth*numBytes +
+           model.flopTime*numFlops/p;
+}
+
+void SelectCondenseGrid
+( CondenseReduction reduction, Int m, Int n, const Grid& grid,
+  int& gridHeight, int& gridWidth, Int entrySize )
+{
+    EL_DEBUG_CSE
+    const GemmCostModel& model = GetGemmCostModel();
+    const int p = grid.Size();
+    gridHeight = grid.Height();
+    gridWidth = grid.Width();
+    if( !model.calibrated )
+    {
+        if( reduction == CONDENSE_HERMITIAN_TRIDIAG )
+        {
+            gridHeight = int(sqrt(double(p)));
+            gridWidth = gridHeight;
+        }
+        return;
+    }
+
+    // Moving A to the new grid and back is modeled as two all-to-alls in
+    // which each process of the new grid receives its portion of A
+    const double redistLatency = 2*model.latency*NumStages(p);
+    const double numEntries = double(m)*n;
+
+    double bestCost =
+      CondenseCost( reduction, m, n, gridHeight, gridWidth, entrySize );
+    for( int q=1; q<=p; ++q )
+    {
+        const int height = Grid::DefaultHeight( q );
+        const int width = q / height;
+        if( height == grid.Height() && width == grid.Width() )
+            continue;
+        const double redistCost = redistLatency +
+          2*model.inverseBandwidth*entrySize*numEntries/q;
+        const double cost = redistCost +
+          CondenseCost( reduction, m, n, height, width, entrySize );
+        if( cost < bestCost )
+        {
+            gridHeight = height;
+            gridWidth = width;
+            bestCost = cost;
+        }
+    }
+}
+
+} // namespace El
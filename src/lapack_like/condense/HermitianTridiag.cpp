@@ -46,8 +46,12 @@ void Ger2Sub
 #include "./HermitianTridiag/UpperBlocked.hpp"
 #include "./HermitianTridiag/UpperBlockedSquare.hpp"
 
+#include "./HermitianTridiag/TwoStage.hpp"
+
 #include "./HermitianTridiag/ApplyQ.hpp"
 
+#include "./Subgrid.hpp"
+
 namespace El {
 
 template<typename F>
@@ -69,6 +73,7 @@ void HermitianTridiag
   const HermitianTridiagCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_TRACE_REGION("HermitianTridiag");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     DistMatrixWriteProxy<F,F,STAR,STAR>
@@ -84,77 +89,60 @@ void HermitianTridiag
             herm_tridiag::LowerBlocked( A, householderScalars, ctrl.symvCtrl );
         else
             herm_tridiag::UpperBlocked( A, householderScalars, ctrl.symvCtrl );
+        return;
     }
-    else if( ctrl.approach == HERMITIAN_TRIDIAG_SQUARE )
+
+    // Use the fast square-grid algorithm whenever the grid is square
+    auto reduceInPlace =
+      [&]( DistMatrix<F>& B, DistMatrix<F,STAR,STAR>& scalars )
+      {
+          const bool square = ( B.Grid().Height() == B.Grid().Width() );
+          if( uplo == LOWER && square )
+              herm_tridiag::LowerBlockedSquare( B, scalars, ctrl.symvCtrl );
+          else if( uplo == LOWER )
+              herm_tridiag::LowerBlocked( B, scalars, ctrl.symvCtrl );
+          else if( square )
+              herm_tridiag::UpperBlockedSquare( B, scalars, ctrl.symvCtrl );
+          else
+              herm_tridiag::UpperBlocked( B, scalars, ctrl.symvCtrl );
+      };
+    auto reduceOnSubgrid =
+      [&]( DistMatrix<F>& ASub )
+      {
+          DistMatrix<F,STAR,STAR> householderScalarsSub(ASub.Grid());
+          if( ASub.Participating() )
+              reduceInPlace( ASub, householderScalarsSub );
+          const bool includeViewers = true;
+          householderScalarsSub.MakeConsistent( includeViewers );
+          householderScalars = householderScalarsSub;
+      };
+
+    if( ctrl.approach == HERMITIAN_TRIDIAG_SQUARE )
     {
         // Drop down to a square mesh 
-        const Int p = grid.Size();
-        const Int pSqrt = Int(sqrt(double(p)));
-
-        vector<int> squareRanks(pSqrt*pSqrt);
-        if( ctrl.order == grid.Order() )
-        {
-            for( Int j=0; j<pSqrt; ++j )
-                for( Int i=0; i<pSqrt; ++i )
-                    squareRanks[i+j*pSqrt] = i+j*pSqrt;
-        }
+        const int pSqrt = int(sqrt(double(grid.Size())));
+        condense::ReduceOnSubgrid
+        ( A, pSqrt, pSqrt, ctrl.order, reduceOnSubgrid );
+    }
+    else if( ctrl.approach == HERMITIAN_TRIDIAG_ADAPTIVE )
+    {
+        // Weigh the (possibly square) subgrids against the current grid,
+        // including the cost of moving A between them
+        int gridHeight, gridWidth;
+        SelectCondenseGrid
+        ( CONDENSE_HERMITIAN_TRIDIAG, A.Height(), A.Width(), grid,
+          gridHeight, gridWidth, sizeof(F) );
+        if( gridHeight == grid.Height() && gridWidth == grid.Width() )
+            reduceInPlace( A, householderScalars );
         else
-        {
-            for( Int j=0; j<pSqrt; ++j )
-                for( Int i=0; i<pSqrt; ++i )
-                    squareRanks[i+j*pSqrt] = j+i*pSqrt;
-        }
-
-        mpi::Group owningGroup = grid.OwningGroup();
-        mpi::Group squareGroup;
-        mpi::Incl
-        ( owningGroup, squareRanks.size(), squareRanks.data(), squareGroup );
-
-        mpi::Comm viewingComm = grid.ViewingComm();
-        const Grid squareGrid( viewingComm, squareGroup, pSqrt );
-        DistMatrix<F> ASquare(squareGrid);
-        DistMatrix<F,STAR,STAR> householderScalarsSquare(squareGrid);
-
-        // Perform the fast tridiagonalization on the square grid
-        ASquare = A;
-        if( ASquare.Participating() )
-        {
-            if( uplo == LOWER )
-                herm_tridiag::LowerBlockedSquare
-                ( ASquare, householderScalarsSquare, ctrl.symvCtrl );
-            else
-                herm_tridiag::UpperBlockedSquare
-                ( ASquare, householderScalarsSquare, ctrl.symvCtrl );
-        }
-        const bool includeViewers = true;
-        householderScalarsSquare.MakeConsistent( includeViewers );
-        A = ASquare;
-        householderScalars = householderScalarsSquare;
-
-        mpi::Free( squareGroup );
+            condense::ReduceOnSubgrid
+            ( A, gridHeight, gridWidth, ctrl.order, reduceOnSubgrid );
     }
     else
     {
         // Use the normal approach unless we're already on a square 
         // grid, in which case we use the fast square method.
-        if( grid.Height() == grid.Width() )
-        {
-            if( uplo == LOWER )
-                herm_tridiag::LowerBlockedSquare
-                ( A, householderScalars, ctrl.symvCtrl );
-            else
-                herm_tridiag::UpperBlockedSquare
-                ( A, householderScalars, ctrl.symvCtrl ); 
-        }
-        else
-        {
-            if( uplo == LOWER )
-                herm_tridiag::LowerBlocked
-                ( A, householderScalars, ctrl.symvCtrl );
-            else
-                herm_tridiag::UpperBlocked
-                ( A, householderScalars, ctrl.symvCtrl );
-        }
+        reduceInPlace( A, householderScalars );
     }
 }
 
@@ -179,6 +167,11 @@ void ExplicitCondensed
   const HermitianTridiagCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.twoStage )
+    {
+        herm_tridiag::TwoStage( uplo, A, ctrl.bandwidth );
+        return;
+    }
     DistMatrix<F,STAR,STAR> householderScalars(A.Grid());
     HermitianTridiag( uplo, A, householderScalars, ctrl );
     if( uplo == UPPER )
@@ -0,0 +1,244 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+// Two-stage reduction to real symmetric tridiagonal form which discards the
+// unitary transformations:
+//
+//  1) A full-to-band reduction of the lower triangle, where each panel of
+//     'bandwidth' columns is reduced with a Householder QR factorization and
+//     the trailing matrix receives the two-sided update
+//
+//       A22 := (I - V T V^H)^H A22 (I - V T V^H) = A22 - V W^H - W V^H,
+//
+//     with Y = A22 V T and W = Y - V (T^H V^H Y) / 2, so that all of the
+//     O(n^3) work is performed by Hemm, Gemm, and Her2k.
+//
+//  2) A band-to-tridiagonal reduction via Schwarz's Givens-based bulge chase,
+//     which only requires O(n^2 bandwidth) work on a compact copy of the
+//     band.
+
+// Form the triangular factor T such that H_0^H ... H_{b-1}^H = I - V T V^H,
+// given the Gram matrix G = V^H V and the Householder scalars.
+template<typename F>
+void BandReflectorFactor
+( const Matrix<F>& G, const Matrix<F>& householderScalars, Matrix<F>& T )
+{
+    EL_DEBUG_CSE
+    const Int b = G.Height();
+    Zeros( T, b, b );
+    for( Int k=0; k<b; ++k )
+    {
+        const F tauConj = Conj(householderScalars(k));
+        T(k,k) = tauConj;
+        for( Int i=0; i<k; ++i )
+        {
+            F gamma = 0;
+            for( Int l=i; l<k; ++l )
+                gamma += T(i,l)*G(l,k);
+            T(i,k) = -tauConj*gamma;
+        }
+    }
+}
+
+template<typename F>
+void LowerReduceToBand( DistMatrix<F>& A, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+
+    DistMatrix<F,STAR,STAR> householderScalars(g), G(g), T(g), Z(g), M(g);
+    DistMatrix<Real,STAR,STAR> signature(g);
+    DistMatrix<F> V(g), AV(g), W(g);
+    for( Int k=0; k+bandwidth+1<n; k+=bandwidth )
+    {
+        const Range<Int> indPanel( k+bandwidth, n ), indB( k, k+bandwidth );
+        auto P = A( indPanel, indB );
+        auto A22 = A( indPanel, indPanel );
+
+        QR( P, householderScalars, signature );
+        const Int minDim = householderScalars.Height();
+
+        // Absorb the signature into the reflectors rather than R
+        auto R = P( IR(0,minDim), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
+        V = P( ALL, IR(0,minDim) );
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+        MakeTrapezoidal( UPPER, P );
+
+        Gemm( ADJOINT, NORMAL, F(1), V, V, G );
+        T.Resize( minDim, minDim );
+        BandReflectorFactor
+        ( G.LockedMatrix(), householderScalars.LockedMatrix(), T.Matrix() );
+
+        // W := A22 V T - V (T^H (V^H A22 V T)) / 2
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), AV );
+        Gemm( NORMAL, NORMAL, F(1), AV, T, W );
+        Gemm( ADJOINT, NORMAL, F(1), V, W, Z );
+        M.Resize( minDim, minDim );
+        Gemm
+        ( ADJOINT, NORMAL,
+          F(1), T.LockedMatrix(), Z.LockedMatrix(), F(0), M.Matrix() );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), V, M, F(1), W );
+
+        Her2k( LOWER, NORMAL, F(-1), V, W, Real(1), A22 );
+    }
+}
+
+// Overwrite the 2x2 window of indices (p,p+1) of the Hermitian band matrix
+// stored in the lower band format B(i-j,j) = A(i,j), with i-j <= width, with
+// G A G^H, where G = [c, s; -conj(s), c].
+template<typename F>
+void RotateBand
+( Matrix<F>& B, Int width, Int p, const Base<F>& c, const F& s )
+{
+    EL_DEBUG_CSE
+    const Int n = B.Width();
+    auto entry = [&]( Int i, Int j ) -> F& { return B(i-j,j); };
+
+    // Rotate the rows to the left of the window
+    for( Int j=Max(p+1-width,Int(0)); j<p; ++j )
+    {
+        F& x = entry(p,j);
+        F& y = entry(p+1,j);
+        const F xOld = x;
+        x = c*xOld + s*y;
+        y = -Conj(s)*xOld + c*y;
+    }
+
+    // Rotate the columns beneath the window
+    for( Int i=p+2; i<=Min(p+width,n-1); ++i )
+    {
+        F& x = entry(i,p);
+        F& y = entry(i,p+1);
+        const F xOld = x;
+        x = xOld*c + y*Conj(s);
+        y = -xOld*s + y*c;
+    }
+
+    // Transform the diagonal block
+    const F alpha = entry(p,p);
+    const F beta = entry(p+1,p);
+    const F delta = entry(p+1,p+1);
+    const F tau00 = c*alpha + s*beta;
+    const F tau01 = c*Conj(beta) + s*delta;
+    const F tau10 = -Conj(s)*alpha + c*beta;
+    const F tau11 = -Conj(s)*Conj(beta) + c*delta;
+    entry(p,p) = RealPart(tau00*c + tau01*Conj(s));
+    entry(p+1,p) = tau10*c + tau11*Conj(s);
+    entry(p+1,p+1) = RealPart(-tau10*s + tau11*c);
+}
+
+// Reduce a Hermitian band matrix with the given bandwidth, stored in the
+// lower band format B(i-j,j) = A(i,j) with room for bandwidth+2 diagonals,
+// to tridiagonal form by annihilating one diagonal at a time and chasing
+// each resulting bulge off of the bottom of the matrix.
+template<typename F>
+void BandToTridiag( Matrix<F>& B, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = B.Width();
+    auto entry = [&]( Int i, Int j ) -> F& { return B(i-j,j); };
+    for( Int d=bandwidth; d>=2; --d )
+    {
+        for( Int k=0; k+d<n; ++k )
+        {
+            // Annihilate A(k+d,k) and then the bulge A(p+1,col) that each
+            // rotation introduces d rows further down
+            Int col = k;
+            for( Int p=k+d-1; p+1<n; col=p, p+=d )
+            {
+                F& phi = entry(p,col);
+                F& gamma = entry(p+1,col);
+                if( gamma == F(0) )
+                    break;
+                Real c;
+                F s;
+                const F rho = Givens( phi, gamma, c, s );
+                RotateBand( B, d+1, p, c, s );
+                phi = rho;
+                gamma = 0;
+            }
+        }
+    }
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo, AbstractDistMatrix<F>& APre, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    EL_TRACE_REGION("HermitianTridiag::TwoStage");
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+    )
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    const Int n = A.Height();
+    if( bandwidth <= 0 )
+        bandwidth = Blocksize();
+    bandwidth = Max(Min(bandwidth,n-1),Int(1));
+
+    if( uplo == UPPER )
+        MakeHermitian( UPPER, A );
+    LowerReduceToBand( A, bandwidth );
+
+    // Replicate the band (with room for the bulge) on every process so that
+    // the chase requires no further communication
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    Matrix<F> B;
+    Zeros( B, bandwidth+2, n );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i >= j && i-j <= bandwidth )
+                B(i-j,j) = A.GetLocal(iLoc,jLoc);
+        }
+    }
+    mpi::AllReduce( B.Buffer(), B.Height()*B.Width(), A.DistComm() );
+
+    BandToTridiag( B, bandwidth );
+
+    // The off-diagonal can be made real (and nonnegative) through a diagonal
+    // unitary similarity transformation. Both triangles of the tridiagonal
+    // matrix are filled.
+    Zero( A );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i == j )
+                A.SetLocal( iLoc, jLoc, RealPart(B(0,j)) );
+            else if( i == j+1 )
+                A.SetLocal( iLoc, jLoc, Abs(B(1,j)) );
+            else if( i+1 == j )
+                A.SetLocal( iLoc, jLoc, Abs(B(1,i)) );
+        }
+    }
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
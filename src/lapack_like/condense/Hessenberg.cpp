@@ -12,6 +12,9 @@
 #include "./Hessenberg/UpperBlocked.hpp"
 #include "./Hessenberg/ApplyQ.hpp"
 #include "./Hessenberg/FormQ.hpp"
+#include "./Hessenberg/TwoStage.hpp"
+
+#include "./Subgrid.hpp"
 
 namespace El {
 
@@ -31,22 +34,71 @@ void Hessenberg
 template<typename F> 
 void Hessenberg
 ( UpperOrLower uplo,
-  AbstractDistMatrix<F>& A,
-  AbstractDistMatrix<F>& householderScalars )
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  const HessenbergCtrl& ctrl )
 {
     EL_DEBUG_CSE
-    if( uplo == UPPER )
-        hessenberg::UpperBlocked( A, householderScalars );
-    else
-        hessenberg::LowerBlocked( A, householderScalars );
+    auto reduce =
+      [&]( AbstractDistMatrix<F>& B, AbstractDistMatrix<F>& scalars )
+      {
+          if( uplo == UPPER )
+              hessenberg::UpperBlocked( B, scalars );
+          else
+              hessenberg::LowerBlocked( B, scalars );
+      };
+
+    const Grid& grid = APre.Grid();
+    int gridHeight=grid.Height(), gridWidth=grid.Width();
+    if( ctrl.adaptiveGrid )
+        SelectCondenseGrid
+        ( CONDENSE_HESSENBERG, APre.Height(), APre.Width(), grid,
+          gridHeight, gridWidth, sizeof(F) );
+    if( gridHeight == grid.Height() && gridWidth == grid.Width() )
+    {
+        reduce( APre, householderScalarsPre );
+        return;
+    }
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    condense::ReduceOnSubgrid
+    ( A, gridHeight, gridWidth, grid.Order(),
+      [&]( DistMatrix<F>& ASub )
+      {
+          DistMatrix<F,STAR,STAR> householderScalarsSub(ASub.Grid());
+          if( ASub.Participating() )
+              reduce( ASub, householderScalarsSub );
+          const bool includeViewers = true;
+          householderScalarsSub.MakeConsistent( includeViewers );
+          householderScalars = householderScalarsSub;
+      } );
 }
 
 namespace hessenberg {
 
 template<typename F>
-void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A )
+void ExplicitCondensed
+( UpperOrLower uplo, Matrix<F>& A, const HessenbergCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.twoStage )
+    {
+        // A lower Hessenberg matrix is the adjoint of an upper one
+        if( uplo == LOWER )
+        {
+            Matrix<F> AAdj;
+            Adjoint( A, AAdj );
+            TwoStage( AAdj, ctrl.bandwidth );
+            Adjoint( AAdj, A );
+        }
+        else
+            TwoStage( A, ctrl.bandwidth );
+        return;
+    }
     Matrix<F> householderScalars;
     Hessenberg( uplo, A, householderScalars );
     if( uplo == LOWER )
@@ -56,11 +108,26 @@ void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A )
 }
 
 template<typename F> 
-void ExplicitCondensed( UpperOrLower uplo, AbstractDistMatrix<F>& A )
+void ExplicitCondensed
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, const HessenbergCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.twoStage )
+    {
+        // A lower Hessenberg matrix is the adjoint of an upper one
+        if( uplo == LOWER )
+        {
+            DistMatrix<F> AAdj(A.Grid());
+            Adjoint( A, AAdj );
+            TwoStage( AAdj, ctrl.bandwidth );
+            Adjoint( AAdj, A );
+        }
+        else
+            TwoStage( A, ctrl.bandwidth );
+        return;
+    }
     DistMatrix<F,STAR,STAR> householderScalars(A.Grid());
-    Hessenberg( uplo, A, householderScalars );
+    Hessenberg( uplo, A, householderScalars, ctrl );
     if( uplo == LOWER )
         MakeTrapezoidal( LOWER, A, 1 );
     else
@@ -77,11 +144,21 @@ void ExplicitCondensed( UpperOrLower uplo, AbstractDistMatrix<F>& A )
   template void Hessenberg \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<F>& A, \
-    AbstractDistMatrix<F>& householderScalars ); \
+    AbstractDistMatrix<F>& householderScalars, \
+    const HessenbergCtrl& ctrl ); \
   template void hessenberg::ExplicitCondensed \
-  ( UpperOrLower uplo, Matrix<F>& A ); \
+  ( UpperOrLower uplo, Matrix<F>& A, const HessenbergCtrl& ctrl ); \
   template void hessenberg::ExplicitCondensed \
-  ( UpperOrLower uplo, AbstractDistMatrix<F>& A ); \
+  ( UpperOrLower uplo, AbstractDistMatrix<F>& A, \
+    const HessenbergCtrl& ctrl ); \
+  template void hessenberg::TwoStage \
+  ( Matrix<F>& A, Int bandwidth ); \
+  template void hessenberg::TwoStage \
+  ( Matrix<F>& A, Matrix<F>& Q, Int bandwidth ); \
+  template void hessenberg::TwoStage \
+  ( AbstractDistMatrix<F>& A, Int bandwidth ); \
+  template void hessenberg::TwoStage \
+  ( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& Q, Int bandwidth ); \
   template void hessenberg::ApplyQ \
   ( LeftOrRight side, UpperOrLower uplo, Orientation orientation, \
     const Matrix<F>& A, \
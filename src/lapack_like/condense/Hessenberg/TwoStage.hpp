@@ -0,0 +1,291 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HESSENBERG_TWOSTAGE_HPP
+#define EL_HESSENBERG_TWOSTAGE_HPP
+
+#include "../HermitianTridiag/TwoStage.hpp"
+
+namespace El {
+namespace hessenberg {
+
+// Two-stage reduction to upper Hessenberg form, A := Q^H A Q:
+//
+//  1) A full-to-block-Hessenberg reduction, where each panel of 'bandwidth'
+//     columns below the 'bandwidth'-th subdiagonal is reduced with a
+//     Householder QR factorization, and, with W = I - V T V^H,
+//
+//       A(ind2,ind2) := W^H A(ind2,ind2),  A(:,ind2) := A(:,ind2) W,
+//
+//     so that all of the O(n^3) work is performed by Gemm rather than by
+//     the Gemv's against the trailing matrix within the panel factorizations
+//     of the one-stage algorithm.
+//
+//  2) A block-Hessenberg-to-Hessenberg reduction which annihilates each
+//     column below the first subdiagonal with a reflector of length
+//     'bandwidth' and chases the bulge introduced by its application from
+//     the right off of the bottom of the matrix, 'bandwidth' rows at a time.
+//     Unlike the Hermitian case, the transformations touch full rows and
+//     columns, so this stage also requires O(n^3) work, but only in
+//     operations on strips of width 'bandwidth'.
+
+template<typename F>
+void ReduceToBlock( Matrix<F>& A, Int bandwidth, Matrix<F>* Q )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+
+    Matrix<F> householderScalars, G, T, V, VTAdj, Y, Z;
+    Matrix<Real> signature;
+    for( Int k=0; k+bandwidth+1<n; k+=bandwidth )
+    {
+        const Range<Int> ind2( k+bandwidth, n ), indB( k, k+bandwidth );
+        auto P = A( ind2, indB );
+        auto A22 = A( ind2, ind2 );
+        auto ARight = A( ALL, ind2 );
+
+        QR( P, householderScalars, signature );
+        const Int minDim = householderScalars.Height();
+
+        // Absorb the signature into the reflectors rather than R
+        auto R = P( IR(0,minDim), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
+        V = P( ALL, IR(0,minDim) );
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+        MakeTrapezoidal( UPPER, P );
+
+        Gemm( ADJOINT, NORMAL, F(1), V, V, G );
+        herm_tridiag::BandReflectorFactor( G, householderScalars, T );
+
+        // A22 := A22 - V (T^H (V^H A22))
+        Gemm( NORMAL, ADJOINT, F(1), V, T, VTAdj );
+        Gemm( ADJOINT, NORMAL, F(1), V, A22, Z );
+        Gemm( NORMAL, NORMAL, F(-1), VTAdj, Z, F(1), A22 );
+
+        // A(:,ind2) := A(:,ind2) - ((A(:,ind2) V) T) V^H
+        Gemm( NORMAL, NORMAL, F(1), ARight, V, Z );
+        Gemm( NORMAL, NORMAL, F(1), Z, T, Y );
+        Gemm( NORMAL, ADJOINT, F(-1), Y, V, F(1), ARight );
+
+        if( Q != nullptr )
+        {
+            auto QRight = (*Q)( ALL, ind2 );
+            Gemm( NORMAL, NORMAL, F(1), QRight, V, Z );
+            Gemm( NORMAL, NORMAL, F(1), Z, T, Y );
+            Gemm( NORMAL, ADJOINT, F(-1), Y, V, F(1), QRight );
+        }
+    }
+}
+
+template<typename F>
+void ReduceToBlock( DistMatrix<F>& A, Int bandwidth, DistMatrix<F>* Q )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+
+    DistMatrix<F,STAR,STAR> householderScalars(g), G(g), T(g);
+    DistMatrix<Real,STAR,STAR> signature(g);
+    DistMatrix<F> V(g), VTAdj(g), TDist(g), Y(g), Z(g);
+    for( Int k=0; k+bandwidth+1<n; k+=bandwidth )
+    {
+        const Range<Int> ind2( k+bandwidth, n ), indB( k, k+bandwidth );
+        auto P = A( ind2, indB );
+        auto A22 = A( ind2, ind2 );
+        auto ARight = A( ALL, ind2 );
+
+        QR( P, householderScalars, signature );
+        const Int minDim = householderScalars.Height();
+
+        // Absorb the signature into the reflectors rather than R
+        auto R = P( IR(0,minDim), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
+        V = P( ALL, IR(0,minDim) );
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+        MakeTrapezoidal( UPPER, P );
+
+        Gemm( ADJOINT, NORMAL, F(1), V, V, G );
+        T.Resize( minDim, minDim );
+        herm_tridiag::BandReflectorFactor
+        ( G.LockedMatrix(), householderScalars.LockedMatrix(), T.Matrix() );
+        TDist = T;
+
+        // A22 := A22 - V (T^H (V^H A22))
+        Gemm( NORMAL, ADJOINT, F(1), V, TDist, VTAdj );
+        Gemm( ADJOINT, NORMAL, F(1), V, A22, Z );
+        Gemm( NORMAL, NORMAL, F(-1), VTAdj, Z, F(1), A22 );
+
+        // A(:,ind2) := A(:,ind2) - ((A(:,ind2) V) T) V^H
+        Gemm( NORMAL, NORMAL, F(1), ARight, V, Z );
+        Gemm( NORMAL, NORMAL, F(1), Z, TDist, Y );
+        Gemm( NORMAL, ADJOINT, F(-1), Y, V, F(1), ARight );
+
+        if( Q != nullptr )
+        {
+            auto QRight = (*Q)( ALL, ind2 );
+            Gemm( NORMAL, NORMAL, F(1), QRight, V, Z );
+            Gemm( NORMAL, NORMAL, F(1), Z, TDist, Y );
+            Gemm( NORMAL, ADJOINT, F(-1), Y, V, F(1), QRight );
+        }
+    }
+}
+
+// Reduce an upper block-Hessenberg matrix with the given number of
+// subdiagonals to upper Hessenberg form with the similarity transformations
+// A := H A H^H, each of which is also applied from the right to the rows of
+// Q which are stored in QLoc (if it is non-null).
+template<typename F>
+void ChaseToHessenberg( Matrix<F>& A, Int bandwidth, Matrix<F>* QLoc )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( bandwidth <= 1 )
+        return;
+    Matrix<F> u, y, z;
+    for( Int j=0; j+2<n; ++j )
+    {
+        // Annihilate A(j+2:j+bandwidth,j) and then the bulge beneath the
+        // band that each application from the right introduces into the
+        // first column of its window
+        Int col = j;
+        for( Int start=j+1; start+1<n; col=start, start+=bandwidth )
+        {
+            const Int end = Min( start+bandwidth, n );
+            const Range<Int> indR( start, end );
+
+            F alpha = A(start,col);
+            auto a21 = A( IR(start+1,end), IR(col) );
+            const F tau = LeftReflector( alpha, a21 );
+            u.Resize( end-start, 1 );
+            u(0) = F(1);
+            auto u1 = u( IR(1,end-start), ALL );
+            u1 = a21;
+            A(start,col) = alpha;
+            Zero( a21 );
+            if( tau == F(0) )
+                break;
+
+            // A(indR,col+1:n) := H A(indR,col+1:n)
+            auto ARow = A( indR, IR(col+1,n) );
+            Gemv( ADJOINT, F(1), ARow, u, z );
+            Ger( -tau, u, z, ARow );
+
+            // A(0:end+bandwidth,indR) := A(0:end+bandwidth,indR) H^H
+            auto ACol = A( IR(0,Min(end+bandwidth,n)), indR );
+            Gemv( NORMAL, F(1), ACol, u, y );
+            Ger( -Conj(tau), y, u, ACol );
+
+            if( QLoc != nullptr )
+            {
+                auto QCol = (*QLoc)( ALL, indR );
+                Gemv( NORMAL, F(1), QCol, u, y );
+                Ger( -Conj(tau), y, u, QCol );
+            }
+        }
+    }
+}
+
+template<typename F>
+void TwoStage( Matrix<F>& A, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    EL_TRACE_REGION("Hessenberg::TwoStage");
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    const Int n = A.Height();
+    if( bandwidth <= 0 )
+        bandwidth = Blocksize();
+    bandwidth = Max(Min(bandwidth,n-1),Int(1));
+
+    ReduceToBlock( A, bandwidth, (Matrix<F>*)nullptr );
+    ChaseToHessenberg( A, bandwidth, (Matrix<F>*)nullptr );
+}
+
+template<typename F>
+void TwoStage( Matrix<F>& A, Matrix<F>& Q, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    EL_TRACE_REGION("Hessenberg::TwoStage");
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    const Int n = A.Height();
+    if( bandwidth <= 0 )
+        bandwidth = Blocksize();
+    bandwidth = Max(Min(bandwidth,n-1),Int(1));
+
+    Identity( Q, n, n );
+    ReduceToBlock( A, bandwidth, &Q );
+    ChaseToHessenberg( A, bandwidth, &Q );
+}
+
+// The block-Hessenberg matrix is replicated on every process so that the
+// chase requires no further communication, while the transformations are
+// applied to Q in parallel, as each process owns full rows of Q[VC,* ].
+template<typename F>
+void TwoStage( AbstractDistMatrix<F>& APre, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    EL_TRACE_REGION("Hessenberg::TwoStage");
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+    )
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    const Int n = A.Height();
+    if( bandwidth <= 0 )
+        bandwidth = Blocksize();
+    bandwidth = Max(Min(bandwidth,n-1),Int(1));
+
+    ReduceToBlock( A, bandwidth, (DistMatrix<F>*)nullptr );
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+    ChaseToHessenberg( A_STAR_STAR.Matrix(), bandwidth, (Matrix<F>*)nullptr );
+    A = A_STAR_STAR;
+}
+
+template<typename F>
+void TwoStage
+( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& QPre, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    EL_TRACE_REGION("Hessenberg::TwoStage");
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, QPre );
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+    )
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MC,MR> QProx( QPre );
+    auto& A = AProx.Get();
+    auto& Q = QProx.Get();
+    const Int n = A.Height();
+    if( bandwidth <= 0 )
+        bandwidth = Blocksize();
+    bandwidth = Max(Min(bandwidth,n-1),Int(1));
+
+    Identity( Q, n, n );
+    ReduceToBlock( A, bandwidth, &Q );
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+    DistMatrix<F,VC,STAR> Q_VC_STAR( Q );
+    ChaseToHessenberg( A_STAR_STAR.Matrix(), bandwidth, &Q_VC_STAR.Matrix() );
+    A = A_STAR_STAR;
+    Q = Q_VC_STAR;
+}
+
+} // namespace hessenberg
+} // namespace El
+
+#endif // ifndef EL_HESSENBERG_TWOSTAGE_HPP
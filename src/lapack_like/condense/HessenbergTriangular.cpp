@@ -0,0 +1,224 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace hess_tri {
+
+// Reduce the pencil (A,B), with B upper triangular, to Hessenberg-triangular
+// form by zeroing each column of A from the bottom up with rotations from the
+// left and immediately removing the resulting fill-in of B with rotations
+// from the right (cf. LAPACK's {s,d,c,z}gghrd). The rotations are
+// accumulated into the columns of Q and Z, which are allowed to only be a
+// subset of the rows of the Schur vectors (e.g., the local rows of a
+// [VC,STAR] distribution).
+template<typename F>
+void ReduceTriangular
+( Matrix<F>& A,
+  Matrix<F>& B,
+  Matrix<F>& Q,
+  Matrix<F>& Z )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int QHeight = Q.Height();
+    const Int ZHeight = Z.Height();
+
+    // Apply [c s; -conj(s) c] from the left to rows i-1 and i of M
+    auto rotateRows =
+      [&]( Matrix<F>& M, Int i, Int jBeg, const Real& c, const F& s )
+      {
+          for( Int j=jBeg; j<n; ++j )
+          {
+              const F alpha0 = M(i-1,j);
+              const F alpha1 = M(i,j);
+              M(i-1,j) =        c*alpha0 + s*alpha1;
+              M(i,  j) = -Conj(s)*alpha0 + c*alpha1;
+          }
+      };
+    // Apply the adjoint of [c s; -conj(s) c] from the right to columns j-1
+    // and j of M
+    auto rotateCols =
+      [&]( Matrix<F>& M, Int j, Int iEnd, const Real& c, const F& s )
+      {
+          for( Int i=0; i<iEnd; ++i )
+          {
+              const F alpha0 = M(i,j-1);
+              const F alpha1 = M(i,j);
+              M(i,j-1) = c*alpha0 + Conj(s)*alpha1;
+              M(i,j  ) = -s*alpha0 + c*alpha1;
+          }
+      };
+
+    Real c;
+    F s;
+    for( Int j=0; j<n-2; ++j )
+    {
+        for( Int i=n-1; i>j+1; --i )
+        {
+            // Zero A(i,j) by rotating rows i-1 and i...
+            A(i-1,j) = Givens( A(i-1,j), A(i,j), c, s );
+            A(i,j) = 0;
+            rotateRows( A, i, j+1, c, s );
+            rotateRows( B, i, i-1, c, s );
+            rotateCols( Q, i, QHeight, c, s );
+
+            // ...and remove the fill-in B(i,i-1) by rotating columns i-1
+            // and i
+            B(i,i) = Givens( B(i,i), B(i,i-1), c, s );
+            B(i,i-1) = 0;
+            s = -s;
+            rotateCols( A, i, n, c, s );
+            rotateCols( B, i, i, c, s );
+            rotateCols( Z, i, ZHeight, c, s );
+        }
+    }
+}
+
+} // namespace hess_tri
+
+template<typename F>
+void HessenbergTriangular
+( Matrix<F>& A,
+  Matrix<F>& B,
+  Matrix<F>& Q,
+  Matrix<F>& Z )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( A.Width() != n || B.Height() != n || B.Width() != n )
+        LogicError("A and B must be square and of the same size");
+
+    // Reduce B to upper-triangular form, B = Q_B R, and form Q_B^H A
+    Matrix<F> householderScalars;
+    Matrix<Base<F>> signature;
+    QR( B, householderScalars, signature );
+    qr::ApplyQ( LEFT, ADJOINT, B, householderScalars, signature, A );
+    Identity( Q, n, n );
+    qr::ApplyQ( LEFT, NORMAL, B, householderScalars, signature, Q );
+    MakeTrapezoidal( UPPER, B );
+
+    Identity( Z, n, n );
+    hess_tri::ReduceTriangular( A, B, Q, Z );
+}
+
+template<typename F>
+void HessenbergTriangular( Matrix<F>& A, Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( A.Width() != n || B.Height() != n || B.Width() != n )
+        LogicError("A and B must be square and of the same size");
+
+    Matrix<F> householderScalars;
+    Matrix<Base<F>> signature;
+    QR( B, householderScalars, signature );
+    qr::ApplyQ( LEFT, ADJOINT, B, householderScalars, signature, A );
+    MakeTrapezoidal( UPPER, B );
+
+    Matrix<F> Q, Z;
+    hess_tri::ReduceTriangular( A, B, Q, Z );
+}
+
+// The QR factorization of B and the application of its Householder
+// reflectors are performed in parallel, whereas the (inherently sequential)
+// Givens phase is performed redundantly on [STAR,STAR] copies of the pencil
+// while each process only accumulates the rotations into its own rows of
+// the [VC,STAR] Schur vectors.
+template<typename F>
+void HessenbergTriangular
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& BPre,
+  AbstractDistMatrix<F>& QPre,
+  AbstractDistMatrix<F>& ZPre )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre ), BProx( BPre );
+    auto& A = AProx.Get();
+    auto& B = BProx.Get();
+    DistMatrixWriteProxy<F,F,VC,STAR> QProx( QPre ), ZProx( ZPre );
+    auto& Q = QProx.Get();
+    auto& Z = ZProx.Get();
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    if( A.Width() != n || B.Height() != n || B.Width() != n )
+        LogicError("A and B must be square and of the same size");
+
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Base<F>,MD,STAR> signature(g);
+    QR( B, householderScalars, signature );
+    qr::ApplyQ( LEFT, ADJOINT, B, householderScalars, signature, A );
+    Identity( Q, n, n );
+    qr::ApplyQ( LEFT, NORMAL, B, householderScalars, signature, Q );
+    MakeTrapezoidal( UPPER, B );
+
+    Identity( Z, n, n );
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    hess_tri::ReduceTriangular
+    ( A_STAR_STAR.Matrix(), B_STAR_STAR.Matrix(), Q.Matrix(), Z.Matrix() );
+    A = A_STAR_STAR;
+    B = B_STAR_STAR;
+}
+
+template<typename F>
+void HessenbergTriangular
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre ), BProx( BPre );
+    auto& A = AProx.Get();
+    auto& B = BProx.Get();
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    if( A.Width() != n || B.Height() != n || B.Width() != n )
+        LogicError("A and B must be square and of the same size");
+
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Base<F>,MD,STAR> signature(g);
+    QR( B, householderScalars, signature );
+    qr::ApplyQ( LEFT, ADJOINT, B, householderScalars, signature, A );
+    MakeTrapezoidal( UPPER, B );
+
+    Matrix<F> Q, Z;
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    hess_tri::ReduceTriangular
+    ( A_STAR_STAR.Matrix(), B_STAR_STAR.Matrix(), Q, Z );
+    A = A_STAR_STAR;
+    B = B_STAR_STAR;
+}
+
+#define PROTO(F) \
+  template void HessenbergTriangular \
+  ( Matrix<F>& A, \
+    Matrix<F>& B, \
+    Matrix<F>& Q, \
+    Matrix<F>& Z ); \
+  template void HessenbergTriangular \
+  ( Matrix<F>& A, \
+    Matrix<F>& B ); \
+  template void HessenbergTriangular \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& B, \
+    AbstractDistMatrix<F>& Q, \
+    AbstractDistMatrix<F>& Z ); \
+  template void HessenbergTriangular \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& B );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
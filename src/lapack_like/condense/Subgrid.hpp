@@ -0,0 +1,62 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CONDENSE_SUBGRID_HPP
+#define EL_CONDENSE_SUBGRID_HPP
+
+namespace El {
+namespace condense {
+
+// Redistribute A to the gridHeight x gridWidth grid over the first processes
+// of its grid, run 'reduce' on the result, and redistribute it back. Since
+// 'reduce' is called on every process of the original grid, it must skip the
+// reduction on non-participating processes and then make its outputs
+// consistent. A square subgrid uses the given ordering (by transposing the
+// ranks if it differs from that of A's grid), and a nonsquare one that of A.
+template<typename F,typename ReduceType>
+void ReduceOnSubgrid
+( DistMatrix<F>& A, int gridHeight, int gridWidth, GridOrder order,
+  ReduceType reduce )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    const int subgridSize = gridHeight*gridWidth;
+    const bool square = ( gridHeight == gridWidth );
+
+    vector<int> subgridRanks(subgridSize);
+    if( square && order != grid.Order() )
+    {
+        for( int j=0; j<gridWidth; ++j )
+            for( int i=0; i<gridHeight; ++i )
+                subgridRanks[i+j*gridHeight] = j+i*gridHeight;
+    }
+    else
+    {
+        for( int k=0; k<subgridSize; ++k )
+            subgridRanks[k] = k;
+    }
+
+    mpi::Group subgroup;
+    mpi::Incl
+    ( grid.OwningGroup(), subgridSize, subgridRanks.data(), subgroup );
+    {
+        const Grid subgrid
+        ( grid.ViewingComm(), subgroup, gridHeight,
+          square ? order : grid.Order() );
+        DistMatrix<F> ASub(subgrid);
+        ASub = A;
+        reduce( ASub );
+        A = ASub;
+    }
+    mpi::Free( subgroup );
+}
+
+} // namespace condense
+} // namespace El
+
+#endif // ifndef EL_CONDENSE_SUBGRID_HPP
@@ -20,12 +20,97 @@ Real DampScaling( const Real& alpha )
         return Max(alpha,tol);
 }
 
+namespace ruiz {
+
+// A := A inv(diag(colScale)), while computing the maximum norm of each row of
+// the result within the same pass over A
+template<typename Field>
+void ScaleColumnsWithRowMaxNorms
+( const Matrix<Base<Field>>& colScale,
+        Matrix<Field>& A,
+        Matrix<Base<Field>>& rowMax )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Zeros( rowMax, m, 1 );
+    Field* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    Real* rowMaxBuf = rowMax.Buffer();
+    for( Int j=0; j<n; ++j )
+    {
+        const Real scaleInv = Real(1)/colScale(j);
+        Field* aCol = &ABuf[j*ALDim];
+        for( Int i=0; i<m; ++i )
+        {
+            aCol[i] *= scaleInv;
+            rowMaxBuf[i] = Max(rowMaxBuf[i],Abs(aCol[i]));
+        }
+    }
+}
+
+// A := inv(diag(rowScale)) A, while computing the maximum norm of each column
+// of the result within the same pass over A
+template<typename Field>
+void ScaleRowsWithColumnMaxNorms
+( const Matrix<Base<Field>>& rowScale,
+        Matrix<Field>& A,
+        Matrix<Base<Field>>& colMax )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    colMax.Resize( n, 1 );
+    vector<Real> rowScaleInv( m );
+    for( Int i=0; i<m; ++i )
+        rowScaleInv[i] = Real(1)/rowScale(i);
+    Field* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    Real* colMaxBuf = colMax.Buffer();
+    EL_PARALLEL_FOR_GRAIN(m*n)
+    for( Int j=0; j<n; ++j )
+    {
+        Field* aCol = &ABuf[j*ALDim];
+        Real maxAbs = 0;
+        for( Int i=0; i<m; ++i )
+        {
+            aCol[i] *= rowScaleInv[i];
+            maxAbs = Max(maxAbs,Abs(aCol[i]));
+        }
+        colMaxBuf[j] = maxAbs;
+    }
+}
+
+// Turn the maximum norms into (damped) scalings and return the largest
+// deviation of the scalings from one
+template<typename Real>
+Real MaxNormsToScaling( Matrix<Real>& scale )
+{
+    EL_DEBUG_CSE
+    Real deviation = 0;
+    const Int n = scale.Height();
+    for( Int j=0; j<n; ++j )
+    {
+        scale(j) = DampScaling( scale(j) );
+        deviation = Max(deviation,Abs(Real(1)-scale(j)));
+    }
+    return deviation;
+}
+
+} // namespace ruiz
+
+// Each sweep rescales the columns and then the rows, but the row rescaling of
+// one sweep is fused with the computation of the column maxima of the next
+// (and the column rescaling with the computation of the row maxima), so that
+// each sweep requires only two passes over A.
 template<typename Field>
 void RuizEquil
 ( Matrix<Field>& A,
   Matrix<Base<Field>>& dRow,
   Matrix<Base<Field>>& dCol,
-  bool progress )
+  const RuizEquilCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
@@ -33,38 +118,50 @@ void RuizEquil
     const Int n = A.Width();
     Ones( dRow, m, 1 );
     Ones( dCol, n, 1 );
-
-    // TODO(poulson): Expose these as control parameters
-    // For now, simply hard-code the number of iterations
-    const Int maxIter = 4;
+    if( ctrl.maxIter <= 0 )
+        return;
 
     Matrix<Real> rowScale, colScale;
+    ColumnMaxNorms( A, colScale );
     const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
+    for( Int iter=0; iter<ctrl.maxIter; ++iter )
     {
+        if( iter > 0 )
+        {
+            // Rescale the rows from the previous sweep
+            DiagonalScale( LEFT, NORMAL, rowScale, dRow );
+            ruiz::ScaleRowsWithColumnMaxNorms( rowScale, A, colScale );
+        }
+
         // Rescale the columns
         // -------------------
-        ColumnMaxNorms( A, colScale );
-        EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+        const Real colDeviation = ruiz::MaxNormsToScaling( colScale );
         DiagonalScale( LEFT, NORMAL, colScale, dCol );
-        DiagonalSolve( RIGHT, NORMAL, colScale, A );
+        ruiz::ScaleColumnsWithRowMaxNorms( colScale, A, rowScale );
 
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, rowScale );
-        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, rowScale, dRow );
-        DiagonalSolve( LEFT, NORMAL, rowScale, A );
+        // Form the row rescaling
+        // ----------------------
+        ruiz::MaxNormsToScaling( rowScale );
+        if( ctrl.progress )
+            Output("Sweep ",iter,": column scaling deviation ",colDeviation);
+        if( colDeviation <= ctrl.tol )
+            break;
     }
     SetIndent( indent );
+    DiagonalScale( LEFT, NORMAL, rowScale, dRow );
+    DiagonalSolve( LEFT, NORMAL, rowScale, A );
 }
 
+// The distributed variant additionally only performs a single reduction of
+// the row maxima and a single reduction of the column maxima per sweep, with
+// the (global) deviation of the column scaling from one piggybacking on the
+// reduction of the row maxima.
 template<typename Field>
 void RuizEquil
 ( AbstractDistMatrix<Field>& APre,
   AbstractDistMatrix<Base<Field>>& dRowPre,
   AbstractDistMatrix<Base<Field>>& dColPre,
-  bool progress )
+  const RuizEquilCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
@@ -86,31 +183,81 @@ void RuizEquil
     const Int n = A.Width();
     Ones( dRow, m, 1 );
     Ones( dCol, n, 1 );
+    if( ctrl.maxIter <= 0 )
+        return;
 
-    // TODO(poulson): Expose these as control parameters
-    // For now, simply hard-code the number of iterations
-    const Int maxIter = 4;
+    auto& ALoc = A.Matrix();
+    auto& dRowLoc = dRow.Matrix();
+    auto& dColLoc = dCol.Matrix();
+    const Int mLocal = A.LocalHeight();
+    const Int nLocal = A.LocalWidth();
 
-    DistMatrix<Real,MC,STAR> rowScale(A.Grid());
-    DistMatrix<Real,MR,STAR> colScale(A.Grid());
+    Matrix<Real> rowScale, colScale;
+    vector<Real> rowBuf( mLocal+1 );
+    ColumnMaxNorms( A.LockedMatrix(), colScale );
     const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
+    for( Int iter=0; iter<ctrl.maxIter; ++iter )
     {
+        if( iter > 0 )
+        {
+            // Rescale the rows from the previous sweep
+            DiagonalScale( LEFT, NORMAL, rowScale, dRowLoc );
+            ruiz::ScaleRowsWithColumnMaxNorms( rowScale, ALoc, colScale );
+        }
+        mpi::AllReduce( colScale.Buffer(), nLocal, mpi::MAX, A.ColComm() );
+
         // Rescale the columns
         // -------------------
-        ColumnMaxNorms( A, colScale );
-        EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, colScale, dCol );
-        DiagonalSolve( RIGHT, NORMAL, colScale, A );
+        const Real colDeviationLoc = ruiz::MaxNormsToScaling( colScale );
+        DiagonalScale( LEFT, NORMAL, colScale, dColLoc );
+        ruiz::ScaleColumnsWithRowMaxNorms( colScale, ALoc, rowScale );
 
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, rowScale );
-        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, rowScale, dRow );
-        DiagonalSolve( LEFT, NORMAL, rowScale, A );
+        // Form the row rescaling
+        // ----------------------
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+            rowBuf[iLoc] = rowScale(iLoc);
+        rowBuf[mLocal] = colDeviationLoc;
+        mpi::AllReduce( rowBuf.data(), mLocal+1, mpi::MAX, A.RowComm() );
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+            rowScale(iLoc) = rowBuf[iLoc];
+        const Real colDeviation = rowBuf[mLocal];
+        ruiz::MaxNormsToScaling( rowScale );
+        if( ctrl.progress )
+            OutputFromRoot
+            (A.Grid().Comm(),"Sweep ",iter,": column scaling deviation ",
+             colDeviation);
+        if( colDeviation <= ctrl.tol )
+            break;
     }
     SetIndent( indent );
+    DiagonalScale( LEFT, NORMAL, rowScale, dRowLoc );
+    DiagonalSolve( LEFT, NORMAL, rowScale, ALoc );
+}
+
+template<typename Field>
+void RuizEquil
+( Matrix<Field>& A,
+  Matrix<Base<Field>>& dRow,
+  Matrix<Base<Field>>& dCol,
+  bool progress )
+{
+    EL_DEBUG_CSE
+    RuizEquilCtrl<Base<Field>> ctrl;
+    ctrl.progress = progress;
+    RuizEquil( A, dRow, dCol, ctrl );
+}
+
+template<typename Field>
+void RuizEquil
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Base<Field>>& dRow,
+  AbstractDistMatrix<Base<Field>>& dCol,
+  bool progress )
+{
+    EL_DEBUG_CSE
+    RuizEquilCtrl<Base<Field>> ctrl;
+    ctrl.progress = progress;
+    RuizEquil( A, dRow, dCol, ctrl );
 }
 
 template<typename Field>
@@ -206,20 +353,35 @@ void StackedRuizEquil
     // For now, simply hard-code the number of iterations
     const Int maxIter = 4;
 
-    DistMatrix<Real,MC,STAR> rowScale(A.Grid());
+    DistMatrix<Real,MC,STAR> rowScaleA(A.Grid()), rowScaleB(B.Grid());
     DistMatrix<Real,MR,STAR> colScale(A.Grid()), colScaleB(B.Grid());
+    rowScaleA.AlignWith( A );
+    rowScaleB.AlignWith( B );
+    colScale.AlignWith( A );
+    colScaleB.AlignWith( B );
+    rowScaleA.Resize( mA, 1 );
+    rowScaleB.Resize( mB, 1 );
+    colScale.Resize( n, 1 );
+    colScaleB.Resize( n, 1 );
+    auto& rowScaleALoc = rowScaleA.Matrix();
+    auto& rowScaleBLoc = rowScaleB.Matrix();
     auto& colScaleLoc = colScale.Matrix();
     auto& colScaleBLoc = colScaleB.Matrix();
+    const Int mALocal = A.LocalHeight();
+    const Int mBLocal = B.LocalHeight();
+    vector<Real> rowMaxes( mALocal+mBLocal );
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
         // Rescale the columns
         // -------------------
-        ColumnMaxNorms( A, colScale );
-        ColumnMaxNorms( B, colScaleB );
+        // Combine the local maxima of A and B before a single reduction
+        ColumnMaxNorms( A.LockedMatrix(), colScaleLoc );
+        ColumnMaxNorms( B.LockedMatrix(), colScaleBLoc );
         for( Int jLoc=0; jLoc<nLocal; ++jLoc )
             colScaleLoc(jLoc) =
               Max(colScaleLoc(jLoc),colScaleBLoc(jLoc));
+        mpi::AllReduce( colScaleLoc.Buffer(), nLocal, mpi::MAX, A.ColComm() );
         EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
         DiagonalScale( LEFT, NORMAL, colScale, dCol );
         DiagonalSolve( RIGHT, NORMAL, colScale, A );
@@ -227,15 +389,27 @@ void StackedRuizEquil
 
         // Rescale the rows
         // ----------------
-        RowMaxNorms( A, rowScale );
-        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, rowScale, dRowA );
-        DiagonalSolve( LEFT, NORMAL, rowScale, A );
+        // The row maxima of A and B share a single reduction
+        RowMaxNorms( A.LockedMatrix(), rowScaleALoc );
+        RowMaxNorms( B.LockedMatrix(), rowScaleBLoc );
+        for( Int iLoc=0; iLoc<mALocal; ++iLoc )
+            rowMaxes[iLoc] = rowScaleALoc(iLoc);
+        for( Int iLoc=0; iLoc<mBLocal; ++iLoc )
+            rowMaxes[mALocal+iLoc] = rowScaleBLoc(iLoc);
+        mpi::AllReduce
+        ( rowMaxes.data(), mALocal+mBLocal, mpi::MAX, A.RowComm() );
+        for( Int iLoc=0; iLoc<mALocal; ++iLoc )
+            rowScaleALoc(iLoc) = rowMaxes[iLoc];
+        for( Int iLoc=0; iLoc<mBLocal; ++iLoc )
+            rowScaleBLoc(iLoc) = rowMaxes[mALocal+iLoc];
 
-        RowMaxNorms( B, rowScale );
-        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, rowScale, dRowB );
-        DiagonalSolve( LEFT, NORMAL, rowScale, B );
+        EntrywiseMap( rowScaleA, MakeFunction(DampScaling<Real>) );
+        DiagonalScale( LEFT, NORMAL, rowScaleA, dRowA );
+        DiagonalSolve( LEFT, NORMAL, rowScaleA, A );
+
+        EntrywiseMap( rowScaleB, MakeFunction(DampScaling<Real>) );
+        DiagonalScale( LEFT, NORMAL, rowScaleB, dRowB );
+        DiagonalSolve( LEFT, NORMAL, rowScaleB, B );
     }
     SetIndent( indent );
 }
@@ -243,6 +417,16 @@ void StackedRuizEquil
 
 #define PROTO(Field) \
   template void RuizEquil \
+  ( Matrix<Field>& A, \
+    Matrix<Base<Field>>& dRow, \
+    Matrix<Base<Field>>& dCol, \
+    const RuizEquilCtrl<Base<Field>>& ctrl ); \
+  template void RuizEquil \
+  ( AbstractDistMatrix<Field>& A, \
+    AbstractDistMatrix<Base<Field>>& dRow, \
+    AbstractDistMatrix<Base<Field>>& dCol, \
+    const RuizEquilCtrl<Base<Field>>& ctrl ); \
+  template void RuizEquil \
   ( Matrix<Field>& A, \
     Matrix<Base<Field>>& dRow, \
     Matrix<Base<Field>>& dCol, \
@@ -68,38 +68,50 @@ namespace El {
 
 namespace lse {
 
-template<typename F>
-void Overwrite
-( Matrix<F>& A,
-  Matrix<F>& B,
-  Matrix<F>& C,
-  Matrix<F>& D,
-  Matrix<F>& X, bool computeResidual )
+namespace {
+
+void CheckSizes
+( Int m, Int n, Int p, Int CHeight, Int DHeight, Int CWidth, Int DWidth )
 {
-    EL_DEBUG_CSE
-    const Int m = A.Height();
-    const Int n = A.Width();
-    const Int p = B.Height();
-    const Int numRhs = D.Width();
-    if( m != C.Height() )
+    if( m != CHeight )
         LogicError("A and C must be the same height");
-    if( p != D.Height() )
+    if( p != DHeight )
         LogicError("B and D must be the same height");
-    if( numRhs != C.Width() )
+    if( CWidth != DWidth )
         LogicError("C and D must be the same width");
     if( n < p )
         LogicError("LSE requires width(A) >= height(B)");
     if( m+p < n )
         LogicError("LSE requires height(A)+height(B) >= width(A)");
-    const bool checkIfSingular = true;
+}
 
-    // Compute the implicit Generalized RQ decomposition of (B,A)
-    Matrix<F> tA, tB;
-    Matrix<Base<F>> dA, dB;
-    GRQ( B, tB, dB, A, tA, dA );
+} // anonymous namespace
+
+// Given the implicit Generalized RQ factorization of (B,A), overwrite X with
+// the solution, C with either Z^H C or the rotated residual, and D with
+// arbitrary values
+template<typename F>
+void SolveAfterGRQ
+( const Matrix<F>& A,
+  const Matrix<F>& householderScalarsA,
+  const Matrix<Base<F>>& signatureA,
+  const Matrix<F>& B,
+  const Matrix<F>& householderScalarsB,
+  const Matrix<Base<F>>& signatureB,
+        Matrix<F>& C,
+        Matrix<F>& D,
+        Matrix<F>& X, bool computeResidual )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int p = B.Height();
+    const Int numRhs = D.Width();
+    const bool checkIfSingular = true;
 
     // G := Z^H C
-    qr::ApplyQ( LEFT, ADJOINT, A, tA, dA, C );
+    qr::ApplyQ
+    ( LEFT, ADJOINT, A, householderScalarsA, signatureA, C );
 
     // Partition the relevant matrices
     Zeros( X, n, numRhs );
@@ -107,11 +119,9 @@ void Overwrite
     auto ind2 = IR(n-p,END);
     auto Y1 = X( ind1, ALL );
     auto Y2 = X( ind2, ALL );
-    auto T11 = B( ALL, ind1 );
     auto T12 = B( ALL, ind2 );
     auto R11 = A( ind1, ind1 );
     auto R12 = A( ind1, ind2 );
-    auto R21 = A( ind2, ind1 );
     auto R22 = A( ind2, ind2 );
     auto G1 = C( ind1, ALL );
     auto G2 = C( ind2, ALL );
@@ -138,7 +148,7 @@ void Overwrite
         if( m < n )
         {
             Matrix<F> R22L, R22R;
-            PartitionLeft( R22, R22L, R22R, n-m );
+            LockedPartitionLeft( R22, R22L, R22R, n-m );
             Matrix<F> DT, DB;
             PartitionUp( D, DT, DB, n-m );
             Gemm( NORMAL, NORMAL, F(-1), R22R, DB, F(1), G2 );
@@ -148,7 +158,7 @@ void Overwrite
         else
         {
             Matrix<F> R22T, R22B;
-            PartitionUp( R22, R22T, R22B, m-n );
+            LockedPartitionUp( R22, R22T, R22B, m-n );
             Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R22T, D );
             Matrix<F> G2T, G2B;
             PartitionUp( G2, G2T, G2B, m-n );
@@ -158,69 +168,43 @@ void Overwrite
     }
 
     // X := Q^H Y
-    rq::ApplyQ( LEFT, ADJOINT, B, tB, dB, X );
+    rq::ApplyQ
+    ( LEFT, ADJOINT, B, householderScalarsB, signatureB, X );
 }
 
 template<typename F>
-void Overwrite
-( AbstractDistMatrix<F>& APre,
-  AbstractDistMatrix<F>& BPre,
-  AbstractDistMatrix<F>& CPre,
-  AbstractDistMatrix<F>& DPre,
-  AbstractDistMatrix<F>& XPre,
-  bool computeResidual )
+void SolveAfterGRQ
+( const DistMatrix<F>& A,
+  const DistMatrix<F,MD,STAR>& householderScalarsA,
+  const DistMatrix<Base<F>,MD,STAR>& signatureA,
+  const DistMatrix<F>& B,
+  const DistMatrix<F,MD,STAR>& householderScalarsB,
+  const DistMatrix<Base<F>,MD,STAR>& signatureB,
+        DistMatrix<F>& C,
+        DistMatrix<F>& D,
+        DistMatrix<F>& X, bool computeResidual )
 {
     EL_DEBUG_CSE
-
-    DistMatrixReadWriteProxy<F,F,MC,MR>
-      AProx( APre ),
-      BProx( BPre ),
-      CProx( CPre ),
-      DProx( DPre );
-    DistMatrixWriteProxy<F,F,MC,MR>
-      XProx( XPre );
-    auto& A = AProx.Get();
-    auto& B = BProx.Get();
-    auto& C = CProx.Get();
-    auto& D = DProx.Get();
-    auto& X = XProx.Get();
-
     const Int m = A.Height();
     const Int n = A.Width();
     const Int p = B.Height();
     const Int numRhs = D.Width();
-    if( m != C.Height() )
-        LogicError("A and C must be the same height");
-    if( p != D.Height() )
-        LogicError("B and D must be the same height");
-    if( numRhs != C.Width() )
-        LogicError("C and D must be the same width");
-    if( n < p )
-        LogicError("LSE requires width(A) >= height(B)");
-    if( m+p < n )
-        LogicError("LSE requires height(A)+height(B) >= width(A)");
     const Grid& g = A.Grid();
-    if( g != B.Grid() || g != C.Grid() || g != D.Grid() )
-        LogicError("All matrices must be distributed over the same grid");
     X.SetGrid( g );
     const bool checkIfSingular = true;
 
-    // Compute the implicit Generalized RQ decomposition of (B,A)
-    DistMatrix<F,MD,STAR> tA(g), tB(g);
-    DistMatrix<Base<F>,MD,STAR> dA(g), dB(g);
-    GRQ( B, tB, dB, A, tA, dA );
-
     // G := Z^H C
-    qr::ApplyQ( LEFT, ADJOINT, A, tA, dA, C );
+    qr::ApplyQ
+    ( LEFT, ADJOINT, A, householderScalarsA, signatureA, C );
 
     // Partition the relevant matrices
     Zeros( X, n, numRhs );
     DistMatrix<F> Y1(g), Y2(g);
     PartitionUp( X, Y1, Y2, p );
     DistMatrix<F> T11(g), T12(g);
-    PartitionLeft( B, T11, T12, p );
+    LockedPartitionLeft( B, T11, T12, p );
     DistMatrix<F> R11(g), R12(g), R21(g), R22(g);
-    PartitionDownDiagonal( A, R11, R12, R21, R22, n-p );
+    LockedPartitionDownDiagonal( A, R11, R12, R21, R22, n-p );
     DistMatrix<F> G1(g), G2(g);
     PartitionDown( C, G1, G2, n-p );
 
@@ -237,16 +221,11 @@ void Overwrite
 
     if( computeResidual )
     {
-        // R22 is upper-trapezoidal, and so it is best to decompose it in terms
-        // of its upper-left triangular block and either its bottom zero
-        // block or right non-zero block. Putting k=Min(p,m-(n-p)), then
-        // the k x k upper-left block is upper-triangular. If m >= n, the
-        // bottom m-(n-p) - k = m-n rows are zero, otherwise the right
-        // p - k = n-m.columns are nonzero.
+        // See the sequential implementation for a description of R22
         if( m < n )
         {
             DistMatrix<F> R22L(g), R22R(g);
-            PartitionLeft( R22, R22L, R22R, n-m );
+            LockedPartitionLeft( R22, R22L, R22R, n-m );
             DistMatrix<F> DT(g), DB(g);
             PartitionUp( D, DT, DB, n-m );
             Gemm( NORMAL, NORMAL, F(-1), R22R, DB, F(1), G2 );
@@ -256,7 +235,7 @@ void Overwrite
         else
         {
             DistMatrix<F> R22T(g), R22B(g);
-            PartitionUp( R22, R22T, R22B, m-n );
+            LockedPartitionUp( R22, R22T, R22B, m-n );
             Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R22T, D );
             DistMatrix<F> G2T(g), G2B(g);
             PartitionUp( G2, G2T, G2B, m-n );
@@ -266,7 +245,169 @@ void Overwrite
     }
 
     // X := Q^H Y
-    rq::ApplyQ( LEFT, ADJOINT, B, tB, dB, X );
+    rq::ApplyQ
+    ( LEFT, ADJOINT, B, householderScalarsB, signatureB, X );
+}
+
+template<typename F>
+void Overwrite
+( Matrix<F>& A,
+  Matrix<F>& B,
+  Matrix<F>& C,
+  Matrix<F>& D,
+  Matrix<F>& X, bool computeResidual )
+{
+    EL_DEBUG_CSE
+    CheckSizes
+    ( A.Height(), A.Width(), B.Height(),
+      C.Height(), D.Height(), C.Width(), D.Width() );
+
+    // Compute the implicit Generalized RQ decomposition of (B,A)
+    Matrix<F> tA, tB;
+    Matrix<Base<F>> dA, dB;
+    GRQ( B, tB, dB, A, tA, dA );
+
+    SolveAfterGRQ( A, tA, dA, B, tB, dB, C, D, X, computeResidual );
+}
+
+template<typename F>
+void Overwrite
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& BPre,
+  AbstractDistMatrix<F>& CPre,
+  AbstractDistMatrix<F>& DPre,
+  AbstractDistMatrix<F>& XPre,
+  bool computeResidual )
+{
+    EL_DEBUG_CSE
+
+    DistMatrixReadWriteProxy<F,F,MC,MR>
+      AProx( APre ),
+      BProx( BPre ),
+      CProx( CPre ),
+      DProx( DPre );
+    DistMatrixWriteProxy<F,F,MC,MR>
+      XProx( XPre );
+    auto& A = AProx.Get();
+    auto& B = BProx.Get();
+    auto& C = CProx.Get();
+    auto& D = DProx.Get();
+    auto& X = XProx.Get();
+
+    CheckSizes
+    ( A.Height(), A.Width(), B.Height(),
+      C.Height(), D.Height(), C.Width(), D.Width() );
+    const Grid& g = A.Grid();
+    if( g != B.Grid() || g != C.Grid() || g != D.Grid() )
+        LogicError("All matrices must be distributed over the same grid");
+
+    // Compute the implicit Generalized RQ decomposition of (B,A)
+    DistMatrix<F,MD,STAR> tA(g), tB(g);
+    DistMatrix<Base<F>,MD,STAR> dA(g), dB(g);
+    GRQ( B, tB, dB, A, tA, dA );
+
+    SolveAfterGRQ( A, tA, dA, B, tB, dB, C, D, X, computeResidual );
+}
+
+template<typename F>
+void Factor
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+        Factorization<F>& factorization )
+{
+    EL_DEBUG_CSE
+    if( B.Width() != A.Width() )
+        LogicError("A and B must be the same width");
+    if( A.Width() < B.Height() )
+        LogicError("LSE requires width(A) >= height(B)");
+    if( A.Height()+B.Height() < A.Width() )
+        LogicError("LSE requires height(A)+height(B) >= width(A)");
+    factorization.A = A;
+    factorization.B = B;
+    GRQ
+    ( factorization.B,
+      factorization.householderScalarsB,
+      factorization.signatureB,
+      factorization.A,
+      factorization.householderScalarsA,
+      factorization.signatureA );
+}
+
+template<typename F>
+void Factor
+( const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& B,
+        DistFactorization<F>& factorization )
+{
+    EL_DEBUG_CSE
+    if( B.Width() != A.Width() )
+        LogicError("A and B must be the same width");
+    if( A.Width() < B.Height() )
+        LogicError("LSE requires width(A) >= height(B)");
+    if( A.Height()+B.Height() < A.Width() )
+        LogicError("LSE requires height(A)+height(B) >= width(A)");
+    const Grid& g = A.Grid();
+    factorization.A.SetGrid( g );
+    factorization.B.SetGrid( g );
+    factorization.householderScalarsA.SetGrid( g );
+    factorization.householderScalarsB.SetGrid( g );
+    factorization.signatureA.SetGrid( g );
+    factorization.signatureB.SetGrid( g );
+    factorization.A = A;
+    factorization.B = B;
+    GRQ
+    ( factorization.B,
+      factorization.householderScalarsB,
+      factorization.signatureB,
+      factorization.A,
+      factorization.householderScalarsA,
+      factorization.signatureA );
+}
+
+template<typename F>
+void SolveAfter
+( const Factorization<F>& factorization,
+  const Matrix<F>& C,
+  const Matrix<F>& D,
+        Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    const auto& A = factorization.A;
+    const auto& B = factorization.B;
+    CheckSizes
+    ( A.Height(), A.Width(), B.Height(),
+      C.Height(), D.Height(), C.Width(), D.Width() );
+    Matrix<F> CCopy( C ), DCopy( D );
+    SolveAfterGRQ
+    ( A, factorization.householderScalarsA, factorization.signatureA,
+      B, factorization.householderScalarsB, factorization.signatureB,
+      CCopy, DCopy, X, false );
+}
+
+template<typename F>
+void SolveAfter
+( const DistFactorization<F>& factorization,
+  const AbstractDistMatrix<F>& C,
+  const AbstractDistMatrix<F>& D,
+        AbstractDistMatrix<F>& XPre )
+{
+    EL_DEBUG_CSE
+    const auto& A = factorization.A;
+    const auto& B = factorization.B;
+    CheckSizes
+    ( A.Height(), A.Width(), B.Height(),
+      C.Height(), D.Height(), C.Width(), D.Width() );
+    const Grid& g = A.Grid();
+    if( g != C.Grid() || g != D.Grid() )
+        LogicError("All matrices must be distributed over the same grid");
+
+    DistMatrixWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& X = XProx.Get();
+    DistMatrix<F> CCopy( C ), DCopy( D );
+    SolveAfterGRQ
+    ( A, factorization.householderScalarsA, factorization.signatureA,
+      B, factorization.householderScalarsB, factorization.signatureB,
+      CCopy, DCopy, X, false );
 }
 
 } // namespace lse
@@ -297,6 +438,55 @@ void LSE
     lse::Overwrite( ACopy, BCopy, CCopy, DCopy, X );
 }
 
+// Since the Generalized RQ factorization of (B,A_k) begins with the RQ
+// factorization of B, followed by the QR factorization of A_k Q^H, the former
+// is computed once and each problem only requires the latter.
+template<typename F>
+void LSE
+( const vector<Matrix<F>>& A,
+  const Matrix<F>& B,
+  const vector<Matrix<F>>& C,
+  const vector<Matrix<F>>& D,
+        vector<Matrix<F>>& X,
+  Int numThreads )
+{
+    EL_DEBUG_CSE
+    const Int numProblems = A.size();
+    if( Int(C.size()) != numProblems || Int(D.size()) != numProblems )
+        LogicError("A, C, and D must contain the same number of matrices");
+    const Int n = B.Width();
+    const Int p = B.Height();
+    for( Int k=0; k<numProblems; ++k )
+    {
+        if( A[k].Width() != n )
+            LogicError("A[",k,"] and B must be the same width");
+        lse::CheckSizes
+        ( A[k].Height(), n, p,
+          C[k].Height(), D[k].Height(), C[k].Width(), D[k].Width() );
+    }
+    X.resize( numProblems );
+
+    Matrix<F> BFact( B ), tB;
+    Matrix<Base<F>> dB;
+    RQ( BFact, tB, dB );
+
+    TaskGraph graph;
+    for( Int k=0; k<numProblems; ++k )
+    {
+        auto task = [&,k]()
+          {
+            Matrix<F> AFact( A[k] ), tA, CCopy( C[k] ), DCopy( D[k] );
+            Matrix<Base<F>> dA;
+            rq::ApplyQ( RIGHT, ADJOINT, BFact, tB, dB, AFact );
+            QR( AFact, tA, dA );
+            lse::SolveAfterGRQ
+            ( AFact, tA, dA, BFact, tB, dB, CCopy, DCopy, X[k], false );
+          };
+        graph.Insert( task, {}, {&X[k]} );
+    }
+    graph.Execute( numThreads );
+}
+
 #define PROTO(F) \
   template void lse::Overwrite \
   ( Matrix<F>& A, \
@@ -319,6 +509,31 @@ void LSE
   template void LSE \
   ( const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& B, \
+    const AbstractDistMatrix<F>& C, \
+    const AbstractDistMatrix<F>& D, \
+          AbstractDistMatrix<F>& X ); \
+  template void LSE \
+  ( const vector<Matrix<F>>& A, \
+    const Matrix<F>& B, \
+    const vector<Matrix<F>>& C, \
+    const vector<Matrix<F>>& D, \
+          vector<Matrix<F>>& X, \
+    Int numThreads ); \
+  template void lse::Factor \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& B, \
+          lse::Factorization<F>& factorization ); \
+  template void lse::Factor \
+  ( const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& B, \
+          lse::DistFactorization<F>& factorization ); \
+  template void lse::SolveAfter \
+  ( const lse::Factorization<F>& factorization, \
+    const Matrix<F>& C, \
+    const Matrix<F>& D, \
+          Matrix<F>& X ); \
+  template void lse::SolveAfter \
+  ( const lse::DistFactorization<F>& factorization, \
     const AbstractDistMatrix<F>& C, \
     const AbstractDistMatrix<F>& D, \
           AbstractDistMatrix<F>& X );
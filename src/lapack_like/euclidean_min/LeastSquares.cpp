@@ -67,6 +67,161 @@ void Overwrite
     }
 }
 
+// Return the n x n triangular factor from a TSQR factorization of A
+template<typename F>
+DistMatrix<F,STAR,STAR>
+TSQRTriangle
+( const DistMatrix<F,VC,STAR>& A, const qr::TreeData<F>& treeData )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int n = A.Width();
+    DistMatrix<F,CIRC,CIRC> RRoot(g);
+    if( A.ColRank() == 0 )
+    {
+        auto RTop = qr::ts::RootQR( A, treeData )( IR(0,n), IR(0,n) );
+        CopyFromRoot( RTop, RRoot );
+        MakeTrapezoidal( UPPER, RRoot );
+    }
+    else
+        CopyFromNonRoot( RRoot );
+    DistMatrix<F,STAR,STAR> R(g);
+    R = RRoot;
+    return R;
+}
+
+template<typename F>
+bool IsTallSkinny
+( const AbstractDistMatrix<F>& A, const DenseLeastSquaresCtrl& ctrl )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    return m >= ctrl.tallSkinnyRatio*n && m >= A.Grid().Size()*n;
+}
+
+// Since [VC,STAR] TSQR leaves the top n rows of Q^H B in the top n local
+// rows of the root process, the triangular solve is performed there
+template<typename F>
+void TallSkinny
+( const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& B,
+        AbstractDistMatrix<F>& X,
+  const DenseLeastSquaresCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int n = A.Width();
+
+    DistMatrix<F,VC,STAR> A_VC_STAR( A );
+    DistMatrix<F,VC,STAR> B_VC_STAR(g);
+    B_VC_STAR.AlignWith( A_VC_STAR );
+    B_VC_STAR = B;
+
+    auto treeData = qr::TS( A_VC_STAR, ctrl.tsqrCtrl );
+    qr::ts::ApplyQ( ADJOINT, A_VC_STAR, treeData, B_VC_STAR );
+
+    DistMatrix<F,CIRC,CIRC> XRoot(g);
+    if( A_VC_STAR.ColRank() == 0 )
+    {
+        auto RTop = qr::ts::RootQR( A_VC_STAR, treeData )( IR(0,n), IR(0,n) );
+        Matrix<F> XLoc( B_VC_STAR.Matrix()( IR(0,n), ALL ) );
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), RTop, XLoc );
+        CopyFromRoot( XLoc, XRoot );
+    }
+    else
+        CopyFromNonRoot( XRoot );
+    Copy( XRoot, X );
+}
+
+template<typename F>
+void SemiNormal
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& X,
+  const DenseLeastSquaresCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int k = B.Width();
+
+    Matrix<F> R( A );
+    qr::ExplicitTriang( R );
+
+    // Solve R^H R X = A^H B
+    Zeros( X, n, k );
+    Gemm( ADJOINT, NORMAL, F(1), A, B, F(0), X );
+    Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), R, X );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R, X );
+
+    // Correct with the residual
+    Matrix<F> E, dX;
+    for( Int it=0; it<ctrl.refineIts; ++it )
+    {
+        E = B;
+        Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), E );
+        Zeros( dX, n, k );
+        Gemm( ADJOINT, NORMAL, F(1), A, E, F(0), dX );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), R, dX );
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R, dX );
+        X += dX;
+    }
+}
+
+template<typename F>
+void SemiNormal
+( const AbstractDistMatrix<F>& APre,
+  const AbstractDistMatrix<F>& BPre,
+        AbstractDistMatrix<F>& XPre,
+  const DenseLeastSquaresCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre ), BProx( BPre );
+    DistMatrixWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& X = XProx.Get();
+    const Grid& g = A.Grid();
+    const Int n = A.Width();
+    const Int k = B.Width();
+
+    // Only the (replicated) triangular factor is needed
+    DistMatrix<F,STAR,STAR> R(g);
+    if( IsTallSkinny( A, ctrl ) )
+    {
+        DistMatrix<F,VC,STAR> A_VC_STAR( A );
+        auto treeData = qr::TS( A_VC_STAR, ctrl.tsqrCtrl );
+        R = TSQRTriangle( A_VC_STAR, treeData );
+    }
+    else
+    {
+        DistMatrix<F> RDist( A );
+        qr::ExplicitTriang( RDist );
+        R = RDist;
+    }
+
+    DistMatrix<F> Y(g);
+    DistMatrix<F,STAR,STAR> Y_STAR_STAR(g);
+    auto seminormalSolve = [&]( const DistMatrix<F>& E, DistMatrix<F>& Z )
+    {
+        Zeros( Y, n, k );
+        Gemm( ADJOINT, NORMAL, F(1), A, E, F(0), Y );
+        Y_STAR_STAR = Y;
+        LocalTrsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), R, Y_STAR_STAR );
+        LocalTrsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R, Y_STAR_STAR );
+        Z = Y_STAR_STAR;
+    };
+
+    seminormalSolve( B, X );
+    DistMatrix<F> E(g), dX(g);
+    for( Int it=0; it<ctrl.refineIts; ++it )
+    {
+        E = B;
+        Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), E );
+        seminormalSolve( E, dX );
+        X += dX;
+    }
+}
+
 } // namespace ls
 
 template<typename F>
@@ -74,9 +229,18 @@ void LeastSquares
 ( Orientation orientation,
   const Matrix<F>& A,
   const Matrix<F>& B,
-        Matrix<F>& X )
+        Matrix<F>& X,
+  const DenseLeastSquaresCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    EL_TRACE_REGION("LeastSquares");
+    // TSQR is pointless without distribution
+    if( ctrl.alg == LS_SEMINORMAL && orientation == NORMAL &&
+        A.Height() >= A.Width() )
+    {
+        ls::SemiNormal( A, B, X, ctrl );
+        return;
+    }
     Matrix<F> ACopy( A );
     ls::Overwrite( orientation, ACopy, B, X );
 }
@@ -86,13 +250,93 @@ void LeastSquares
 ( Orientation orientation,
   const AbstractDistMatrix<F>& A,
   const AbstractDistMatrix<F>& B,
-        AbstractDistMatrix<F>& X )
+        AbstractDistMatrix<F>& X,
+  const DenseLeastSquaresCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    EL_TRACE_REGION("LeastSquares");
+    if( orientation == NORMAL && A.Height() >= A.Width() )
+    {
+        if( ctrl.alg == LS_SEMINORMAL )
+        {
+            ls::SemiNormal( A, B, X, ctrl );
+            return;
+        }
+        const bool tallSkinny = ls::IsTallSkinny( A, ctrl );
+        if( ctrl.alg == LS_TSQR && !tallSkinny )
+            LogicError
+            ("TSQR requires the height of A to be at least its width times "
+             "the number of processes");
+        if( ctrl.alg == LS_TSQR || (ctrl.alg == LS_AUTO && tallSkinny) )
+        {
+            ls::TallSkinny( A, B, X, ctrl );
+            return;
+        }
+    }
     DistMatrix<F> ACopy( A );
     ls::Overwrite( orientation, ACopy, B, X );
 }
 
+template<typename F>
+StreamingLeastSquares<F>::StreamingLeastSquares
+( Int width, Int numRHS, const Grid& grid )
+: width_(width), numRHS_(numRHS), T_(grid)
+{
+    EL_DEBUG_CSE
+    Zeros( T_, width+numRHS, width+numRHS );
+}
+
+template<typename F>
+void StreamingLeastSquares<F>::AddRows
+( const AbstractDistMatrix<F>& ABlock,
+  const AbstractDistMatrix<F>& BBlock )
+{
+    EL_DEBUG_CSE
+    const Int mBlock = ABlock.Height();
+    const Int nAug = width_ + numRHS_;
+    if( ABlock.Width() != width_ || BBlock.Width() != numRHS_ )
+        LogicError("Row blocks must conform with the problem dimensions");
+    if( BBlock.Height() != mBlock )
+        LogicError("ABlock and BBlock must have the same height");
+
+    const Grid& g = T_.Grid();
+    DistMatrix<F> Z(g);
+    Zeros( Z, nAug+mBlock, nAug );
+    auto ZT = Z( IR(0,nAug), ALL );
+    auto ZBA = Z( IR(nAug,END), IR(0,width_) );
+    auto ZBB = Z( IR(nAug,END), IR(width_,END) );
+    ZT = T_;
+    ZBA = ABlock;
+    ZBB = BBlock;
+
+    qr::ExplicitTriang( Z );
+    T_ = Z;
+    height_ += mBlock;
+}
+
+template<typename F>
+void StreamingLeastSquares<F>::Solve( AbstractDistMatrix<F>& X ) const
+{
+    EL_DEBUG_CSE
+    if( height_ < width_ )
+        LogicError("Fewer rows than columns have been absorbed");
+    const Range<Int> indR( 0, width_ ), indC( width_, width_+numRHS_ );
+    DistMatrix<F> XDist( T_(indR,indC) );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), T_(indR,indR), XDist );
+    Copy( XDist, X );
+}
+
+template<typename F>
+Base<F> StreamingLeastSquares<F>::ResidualNorm() const
+{
+    EL_DEBUG_CSE
+    const Range<Int> indS( width_, width_+numRHS_ );
+    return FrobeniusNorm( T_(indS,indS) );
+}
+
+template<typename F>
+Int StreamingLeastSquares<F>::Height() const
+{ return height_; }
 
 #define PROTO(F) \
   template void ls::Overwrite \
@@ -109,12 +353,15 @@ void LeastSquares
   ( Orientation orientation, \
     const Matrix<F>& A, \
     const Matrix<F>& B, \
-          Matrix<F>& X ); \
+          Matrix<F>& X, \
+    const DenseLeastSquaresCtrl& ctrl ); \
   template void LeastSquares \
   ( Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& B, \
-          AbstractDistMatrix<F>& X );
+          AbstractDistMatrix<F>& X, \
+    const DenseLeastSquaresCtrl& ctrl ); \
+  template class StreamingLeastSquares<F>;
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,389 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Given the SVD W = U diag(s) V^H and C = U^H B, the Ridge solution for the
+// parameter gamma is
+//
+//   X(gamma) = V diag(s_i / (s_i^2 + gamma^2)) C,
+//
+// and, with w_i = || C(i,:) ||_2^2 and rho_0 = || B ||_F^2 - || C ||_F^2,
+//
+//   || X(gamma) ||_F^2 = sum_i w_i s_i^2 / (s_i^2 + gamma^2)^2,
+//   || W X(gamma) - B ||_F^2 = rho_0 + sum_i w_i gamma^4 / (s_i^2 + gamma^2)^2,
+//   trace(H(gamma)) = sum_i s_i^2 / (s_i^2 + gamma^2),
+//
+// so that every criterion costs O(n) per parameter and all of the solutions
+// are formed with a single Gemm against the stacked, filtered coefficients.
+
+namespace El {
+namespace reg_path {
+
+template<typename Real>
+Real Filter( const Real& sigma, const Real& gamma )
+{
+    const Real denom = sigma*sigma + gamma*gamma;
+    return ( denom == Real(0) ? Real(0) : sigma / denom );
+}
+
+// Return the curvature of (log || r ||, log || x ||), parameterized by
+// t = log(gamma), given eta = || x ||^2 and rho = || r ||^2 along with their
+// first two derivatives with respect to gamma
+template<typename Real>
+Real LCurveCurvature
+( const Real& gamma,
+  const Real& eta, const Real& etaP, const Real& etaPP,
+  const Real& rho, const Real& rhoP, const Real& rhoPP )
+{
+    if( eta <= Real(0) || rho <= Real(0) || gamma <= Real(0) )
+        return Real(0);
+    const Real etaT = gamma*etaP;
+    const Real etaTT = gamma*gamma*etaPP + gamma*etaP;
+    const Real rhoT = gamma*rhoP;
+    const Real rhoTT = gamma*gamma*rhoPP + gamma*rhoP;
+    const Real xT = rhoT / (2*rho);
+    const Real xTT = rhoTT/(2*rho) - rhoT*rhoT/(2*rho*rho);
+    const Real yT = etaT / (2*eta);
+    const Real yTT = etaTT/(2*eta) - etaT*etaT/(2*eta*eta);
+    const Real speedSq = xT*xT + yT*yT;
+    if( speedSq == Real(0) )
+        return Real(0);
+    return (xT*yTT - yT*xTT) / (speedSq*Sqrt(speedSq));
+}
+
+template<typename Real>
+RegularizationPathInfo<Real> Criteria
+( const Matrix<Real>& s,
+  const Matrix<Real>& w,
+  const Real& frobBSquared,
+  Int m,
+  const Matrix<Real>& gammas )
+{
+    EL_DEBUG_CSE
+    const Int r = s.Height();
+    const Int numGammas = gammas.Height();
+
+    Real rho0 = frobBSquared;
+    for( Int i=0; i<r; ++i )
+        rho0 -= w(i);
+    rho0 = Max( rho0, Real(0) );
+
+    RegularizationPathInfo<Real> info;
+    Zeros( info.residualNorms, numGammas, 1 );
+    Zeros( info.solutionNorms, numGammas, 1 );
+    Zeros( info.gcv, numGammas, 1 );
+    Zeros( info.lCurveCurvatures, numGammas, 1 );
+    for( Int j=0; j<numGammas; ++j )
+    {
+        const Real gamma = gammas(j);
+        const Real gammaSq = gamma*gamma;
+        Real eta=0, etaP=0, etaPP=0, rho=rho0, trace=0;
+        for( Int i=0; i<r; ++i )
+        {
+            const Real sigmaSq = s(i)*s(i);
+            const Real denom = sigmaSq + gammaSq;
+            if( sigmaSq == Real(0) )
+            {
+                // The minimum-length solution has no component here
+                rho += w(i);
+                continue;
+            }
+            const Real denomSq = denom*denom;
+            eta += w(i)*sigmaSq/denomSq;
+            rho += w(i)*gammaSq*gammaSq/denomSq;
+            trace += sigmaSq/denom;
+            etaP += w(i)*sigmaSq/(denomSq*denom);
+            etaPP += w(i)*sigmaSq*
+              (Real(1)/(denomSq*denom) - 6*gammaSq/(denomSq*denomSq));
+        }
+        etaP *= -4*gamma;
+        etaPP *= -4;
+        const Real rhoP = -gammaSq*etaP;
+        const Real rhoPP = -2*gamma*etaP - gammaSq*etaPP;
+
+        info.residualNorms(j) = Sqrt( rho );
+        info.solutionNorms(j) = Sqrt( eta );
+        const Real dof = m - trace;
+        info.gcv(j) = rho / (dof*dof);
+        info.lCurveCurvatures(j) =
+          LCurveCurvature( gamma, eta, etaP, etaPP, rho, rhoP, rhoPP );
+
+        if( info.gcvIndex < 0 || info.gcv(j) < info.gcv(info.gcvIndex) )
+            info.gcvIndex = j;
+        if( info.lCurveIndex < 0 ||
+            info.lCurveCurvatures(j) > info.lCurveCurvatures(info.lCurveIndex) )
+            info.lCurveIndex = j;
+    }
+    return info;
+}
+
+// w_i := || C(i,:) ||_2^2
+template<typename Field>
+void RowNormsSquared( const Matrix<Field>& C, Matrix<Base<Field>>& w )
+{
+    EL_DEBUG_CSE
+    Zeros( w, C.Height(), 1 );
+    for( Int l=0; l<C.Width(); ++l )
+        for( Int i=0; i<C.Height(); ++i )
+            w(i) += Abs( C(i,l) )*Abs( C(i,l) );
+}
+
+template<typename Field>
+void FormOp
+( Orientation orientation, const Matrix<Field>& A, Matrix<Field>& W )
+{
+    EL_DEBUG_CSE
+    if( orientation == NORMAL )
+        W = A;
+    else if( orientation == ADJOINT )
+        Adjoint( A, W );
+    else
+        Transpose( A, W );
+}
+
+template<typename Field>
+void FormOp
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+        DistMatrix<Field>& W )
+{
+    EL_DEBUG_CSE
+    if( orientation == NORMAL )
+        Copy( A, W );
+    else if( orientation == ADJOINT )
+        Adjoint( A, W );
+    else
+        Transpose( A, W );
+}
+
+// Overwrites W
+template<typename Field>
+RegularizationPathInfo<Base<Field>> Normal
+(       Matrix<Field>& W,
+  const Matrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = W.Height();
+    const Int n = W.Width();
+    const Int k = B.Width();
+    const Int numGammas = gammas.Height();
+    if( B.Height() != m )
+        LogicError("B must have the same height as op(A)");
+
+    Matrix<Field> U, V;
+    Matrix<Real> s;
+    SVDCtrl<Real> ctrl;
+    ctrl.overwrite = true;
+    SVD( W, U, s, V, ctrl );
+    const Int r = s.Height();
+
+    Matrix<Field> C;
+    Zeros( C, r, k );
+    Gemm( ADJOINT, NORMAL, Field(1), U, B, Field(0), C );
+    Matrix<Real> w;
+    RowNormsSquared( C, w );
+    const Real frobB = FrobeniusNorm( B );
+    auto info = Criteria( s, w, frobB*frobB, m, gammas );
+
+    Matrix<Field> Z;
+    Zeros( Z, r, k*numGammas );
+    for( Int j=0; j<numGammas; ++j )
+        for( Int l=0; l<k; ++l )
+            for( Int i=0; i<r; ++i )
+                Z(i,j*k+l) = Filter(s(i),gammas(j))*C(i,l);
+    Zeros( X, n, k*numGammas );
+    Gemm( NORMAL, NORMAL, Field(1), V, Z, Field(0), X );
+    return info;
+}
+
+// Overwrites W. The filtered coefficients are formed directly in their
+// final distribution from the (small) replicated C and singular values.
+template<typename Field>
+RegularizationPathInfo<Base<Field>> Normal
+(       DistMatrix<Field>& W,
+  const AbstractDistMatrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        AbstractDistMatrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = W.Grid();
+    const Int m = W.Height();
+    const Int n = W.Width();
+    const Int k = B.Width();
+    const Int numGammas = gammas.Height();
+    if( B.Height() != m )
+        LogicError("B must have the same height as op(A)");
+
+    DistMatrix<Field> U(g), V(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    SVDCtrl<Real> ctrl;
+    ctrl.overwrite = true;
+    SVD( W, U, s, V, ctrl );
+    const Int r = s.Height();
+
+    DistMatrix<Field> C(g);
+    Zeros( C, r, k );
+    Gemm( ADJOINT, NORMAL, Field(1), U, B, Field(0), C );
+    DistMatrix<Field,STAR,STAR> C_STAR_STAR( C );
+    DistMatrix<Real,STAR,STAR> s_STAR_STAR( s );
+    const auto& CLoc = C_STAR_STAR.LockedMatrix();
+    const auto& sLoc = s_STAR_STAR.LockedMatrix();
+    Matrix<Real> w;
+    RowNormsSquared( CLoc, w );
+    const Real frobB = FrobeniusNorm( B );
+    auto info = Criteria( sLoc, w, frobB*frobB, m, gammas );
+
+    DistMatrix<Field> Z(g);
+    Zeros( Z, r, k*numGammas );
+    for( Int jLoc=0; jLoc<Z.LocalWidth(); ++jLoc )
+    {
+        const Int col = Z.GlobalCol(jLoc);
+        const Int j = col / k;
+        const Int l = col % k;
+        for( Int iLoc=0; iLoc<Z.LocalHeight(); ++iLoc )
+        {
+            const Int i = Z.GlobalRow(iLoc);
+            Z.SetLocal( iLoc, jLoc, Filter(sLoc(i),gammas(j))*CLoc(i,l) );
+        }
+    }
+    Zeros( X, n, k*numGammas );
+    Gemm( NORMAL, NORMAL, Field(1), V, Z, Field(0), X );
+    return info;
+}
+
+} // namespace reg_path
+
+template<typename Field>
+RegularizationPathInfo<Base<Field>> RidgePath
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> W;
+    reg_path::FormOp( orientation, A, W );
+    return reg_path::Normal( W, B, gammas, X );
+}
+
+template<typename Field>
+RegularizationPathInfo<Base<Field>> RidgePath
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        AbstractDistMatrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Field> W(A.Grid());
+    reg_path::FormOp( orientation, A, W );
+    return reg_path::Normal( W, B, gammas, X );
+}
+
+template<typename Field>
+RegularizationPathInfo<Base<Field>> TikhonovPath
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Field>& G,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> W;
+    reg_path::FormOp( orientation, A, W );
+    if( G.Height() != G.Width() || G.Height() != W.Width() )
+        LogicError("G must be square and conform with op(A)");
+
+    // W := W inv(G) = (inv(G)^H W^H)^H
+    Matrix<Field> GFact( G ), WAdj;
+    Permutation P;
+    LU( GFact, P );
+    Adjoint( W, WAdj );
+    lu::SolveAfter( ADJOINT, GFact, P, WAdj );
+    Adjoint( WAdj, W );
+
+    // Solve the standard-form problems for Y = G X and then recover X
+    auto info = reg_path::Normal( W, B, gammas, X );
+    lu::SolveAfter( NORMAL, GFact, P, X );
+    return info;
+}
+
+template<typename Field>
+RegularizationPathInfo<Base<Field>> TikhonovPath
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+  const AbstractDistMatrix<Field>& G,
+  const Matrix<Base<Field>>& gammas,
+        AbstractDistMatrix<Field>& XPre )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    DistMatrix<Field> W(g);
+    reg_path::FormOp( orientation, A, W );
+    if( G.Height() != G.Width() || G.Height() != W.Width() )
+        LogicError("G must be square and conform with op(A)");
+
+    DistMatrixWriteProxy<Field,Field,MC,MR> XProx( XPre );
+    auto& X = XProx.Get();
+
+    DistMatrix<Field> GFact( G ), WAdj(g);
+    DistPermutation P(g);
+    LU( GFact, P );
+    Adjoint( W, WAdj );
+    lu::SolveAfter( ADJOINT, GFact, P, WAdj );
+    Adjoint( WAdj, W );
+
+    auto info = reg_path::Normal( W, B, gammas, X );
+    lu::SolveAfter( NORMAL, GFact, P, X );
+    return info;
+}
+
+#define PROTO(Field) \
+  template RegularizationPathInfo<Base<Field>> RidgePath \
+  ( Orientation orientation, \
+    const Matrix<Field>& A, \
+    const Matrix<Field>& B, \
+    const Matrix<Base<Field>>& gammas, \
+          Matrix<Field>& X ); \
+  template RegularizationPathInfo<Base<Field>> RidgePath \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Field>& B, \
+    const Matrix<Base<Field>>& gammas, \
+          AbstractDistMatrix<Field>& X ); \
+  template RegularizationPathInfo<Base<Field>> TikhonovPath \
+  ( Orientation orientation, \
+    const Matrix<Field>& A, \
+    const Matrix<Field>& B, \
+    const Matrix<Field>& G, \
+    const Matrix<Base<Field>>& gammas, \
+          Matrix<Field>& X ); \
+  template RegularizationPathInfo<Base<Field>> TikhonovPath \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Field>& B, \
+    const AbstractDistMatrix<Field>& G, \
+    const Matrix<Base<Field>>& gammas, \
+          AbstractDistMatrix<Field>& X );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
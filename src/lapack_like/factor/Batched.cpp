@@ -0,0 +1,227 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace batched {
+
+// Unblocked, right-looking factorizations of a single member of a batch.
+// Each returns false (rather than throwing) upon breakdown since they are
+// called from within threaded loops.
+
+template<typename Field>
+bool LowerCholesky( Int n, Field* A, Int ALDim )
+{
+    typedef Base<Field> Real;
+    for( Int k=0; k<n; ++k )
+    {
+        const Real delta = RealPart(A[k+k*ALDim]);
+        if( delta <= Real(0) )
+            return false;
+        const Real deltaSqrt = Sqrt(delta);
+        A[k+k*ALDim] = deltaSqrt;
+        const Real deltaInv = Real(1)/deltaSqrt;
+        Field* a21 = &A[(k+1)+k*ALDim];
+        for( Int i=0; i<n-(k+1); ++i )
+            a21[i] *= deltaInv;
+
+        // A22 := A22 - a21 a21^H (lower triangle only)
+        for( Int j=k+1; j<n; ++j )
+        {
+            const Field gamma = Conj(A[j+k*ALDim]);
+            Field* aCol = &A[j*ALDim];
+            EL_SIMD
+            for( Int i=j; i<n; ++i )
+                aCol[i] -= A[i+k*ALDim]*gamma;
+        }
+    }
+    return true;
+}
+
+template<typename Field>
+bool UpperCholesky( Int n, Field* A, Int ALDim )
+{
+    typedef Base<Field> Real;
+    for( Int k=0; k<n; ++k )
+    {
+        const Real delta = RealPart(A[k+k*ALDim]);
+        if( delta <= Real(0) )
+            return false;
+        const Real deltaSqrt = Sqrt(delta);
+        A[k+k*ALDim] = deltaSqrt;
+        const Real deltaInv = Real(1)/deltaSqrt;
+        for( Int j=k+1; j<n; ++j )
+            A[k+j*ALDim] *= deltaInv;
+
+        // A22 := A22 - a12^H a12 (upper triangle only)
+        for( Int j=k+1; j<n; ++j )
+        {
+            const Field gamma = A[k+j*ALDim];
+            Field* aCol = &A[j*ALDim];
+            for( Int i=k+1; i<=j; ++i )
+                aCol[i] -= Conj(A[k+i*ALDim])*gamma;
+        }
+    }
+    return true;
+}
+
+template<typename Field>
+bool LU( Int m, Int n, Field* A, Int ALDim, Int* pivots )
+{
+    const Int minDim = Min(m,n);
+    for( Int k=0; k<minDim; ++k )
+    {
+        const Int iPiv = k + blas::MaxInd( m-k, &A[k+k*ALDim], 1 );
+        pivots[k] = iPiv;
+        if( iPiv != k )
+            for( Int j=0; j<n; ++j )
+                std::swap( A[k+j*ALDim], A[iPiv+j*ALDim] );
+
+        const Field alpha = A[k+k*ALDim];
+        if( alpha == Field(0) )
+            return false;
+        const Field alphaInv = Field(1) / alpha;
+        Field* a21 = &A[(k+1)+k*ALDim];
+        const Int a21Height = m-(k+1);
+        for( Int i=0; i<a21Height; ++i )
+            a21[i] *= alphaInv;
+
+        // A22 := A22 - a21 a12
+        for( Int j=k+1; j<n; ++j )
+        {
+            const Field gamma = A[k+j*ALDim];
+            Field* aCol = &A[(k+1)+j*ALDim];
+            EL_SIMD
+            for( Int i=0; i<a21Height; ++i )
+                aCol[i] -= a21[i]*gamma;
+        }
+    }
+    return true;
+}
+
+} // namespace batched
+
+template<typename Field>
+void BatchedCholesky
+( UpperOrLower uplo, Int n,
+  Field* A, Int ALDim, Int AStride,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( n < 0 || batchSize < 0 )
+          LogicError("Batch dimensions must be non-negative");
+      if( ALDim < Max(n,1) )
+          LogicError("Invalid leading dimension in BatchedCholesky");
+    )
+    vector<byte> success( batchSize );
+    EL_PARALLEL_FOR_GRAIN(batchSize*n*n*n)
+    for( Int b=0; b<batchSize; ++b )
+        success[b] =
+          ( uplo == LOWER ?
+            batched::LowerCholesky( n, &A[b*AStride], ALDim ) :
+            batched::UpperCholesky( n, &A[b*AStride], ALDim ) );
+    for( Int b=0; b<batchSize; ++b )
+        if( !success[b] )
+            throw NonHPDMatrixException();
+}
+
+template<typename Field>
+void BatchedCholesky
+( UpperOrLower uplo, Int n,
+  const vector<Field*>& A, Int ALDim )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = A.size();
+    vector<byte> success( batchSize );
+    EL_PARALLEL_FOR_GRAIN(batchSize*n*n*n)
+    for( Int b=0; b<batchSize; ++b )
+        success[b] =
+          ( uplo == LOWER ?
+            batched::LowerCholesky( n, A[b], ALDim ) :
+            batched::UpperCholesky( n, A[b], ALDim ) );
+    for( Int b=0; b<batchSize; ++b )
+        if( !success[b] )
+            throw NonHPDMatrixException();
+}
+
+template<typename Field>
+void BatchedLU
+( Int m, Int n,
+  Field* A, Int ALDim, Int AStride,
+  Int* pivots, Int pivotStride,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( m < 0 || n < 0 || batchSize < 0 )
+          LogicError("Batch dimensions must be non-negative");
+      if( ALDim < Max(m,1) )
+          LogicError("Invalid leading dimension in BatchedLU");
+      if( pivotStride < Min(m,n) )
+          LogicError("Pivot stride was too small");
+    )
+    vector<byte> success( batchSize );
+    EL_PARALLEL_FOR_GRAIN(batchSize*m*n*Min(m,n))
+    for( Int b=0; b<batchSize; ++b )
+        success[b] =
+          batched::LU( m, n, &A[b*AStride], ALDim, &pivots[b*pivotStride] );
+    for( Int b=0; b<batchSize; ++b )
+        if( !success[b] )
+            throw SingularMatrixException();
+}
+
+template<typename Field>
+void BatchedLU
+( Int m, Int n,
+  const vector<Field*>& A, Int ALDim,
+  const vector<Int*>& pivots )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = A.size();
+    EL_DEBUG_ONLY(
+      if( Int(pivots.size()) != batchSize )
+          LogicError("Batch sizes of A and pivots do not match");
+    )
+    vector<byte> success( batchSize );
+    EL_PARALLEL_FOR_GRAIN(batchSize*m*n*Min(m,n))
+    for( Int b=0; b<batchSize; ++b )
+        success[b] = batched::LU( m, n, A[b], ALDim, pivots[b] );
+    for( Int b=0; b<batchSize; ++b )
+        if( !success[b] )
+            throw SingularMatrixException();
+}
+
+#define PROTO(Field) \
+  template void BatchedCholesky \
+  ( UpperOrLower uplo, Int n, \
+    Field* A, Int ALDim, Int AStride, \
+    Int batchSize ); \
+  template void BatchedCholesky \
+  ( UpperOrLower uplo, Int n, \
+    const vector<Field*>& A, Int ALDim ); \
+  template void BatchedLU \
+  ( Int m, Int n, \
+    Field* A, Int ALDim, Int AStride, \
+    Int* pivots, Int pivotStride, \
+    Int batchSize ); \
+  template void BatchedLU \
+  ( Int m, Int n, \
+    const vector<Field*>& A, Int ALDim, \
+    const vector<Int*>& pivots );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include <El/blas_like/level3/BlockCyclic.hpp>
 
 #include "./Cholesky/LowerVariant3.hpp"
 #include "./Cholesky/UpperVariant3.hpp"
@@ -14,7 +15,10 @@
 #include "./Cholesky/ReverseUpperVariant3.hpp"
 #include "./Cholesky/PivotedLowerVariant3.hpp"
 #include "./Cholesky/PivotedUpperVariant3.hpp"
+#include "./Cholesky/Recursive.hpp"
 #include "./Cholesky/SolveAfter.hpp"
+#include "./Cholesky/OutOfCore.hpp"
+#include "./Cholesky/Block.hpp"
 
 #include "./Cholesky/LowerMod.hpp"
 #include "./Cholesky/UpperMod.hpp"
@@ -31,7 +35,15 @@ void Cholesky( UpperOrLower uplo, Matrix<F>& A )
       if( A.Height() != A.Width() )
           LogicError("A must be square");
     )
-    if( uplo == LOWER )
+    if( !IsBlasScalar<F>::value )
+    {
+        const Int cutoff = LocalRecursionCutoff<F>();
+        if( uplo == LOWER )
+            cholesky::LowerRecursive( A, cutoff );
+        else
+            cholesky::UpperRecursive( A, cutoff );
+    }
+    else if( uplo == LOWER )
         cholesky::LowerVariant3Blocked( A );
     else
         cholesky::UpperVariant3Blocked( A );
@@ -96,16 +108,36 @@ template<typename F>
 void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
 {
     EL_DEBUG_CSE
+    EL_TRACE_REGION("Cholesky");
     if( scalapack )
     {
         cholesky::ScaLAPACKHelper( uplo, A );
     }
+    else if( block_cyclic::IsMCMRBlock(A) && block_cyclic::HasSquareBlocks(A) )
+    {
+        // Avoid redistributing block-cyclic matrices into [MC,MR]
+        auto& ABlock = static_cast<DistMatrix<F,MC,MR,BLOCK>&>(A);
+        if( uplo == LOWER )
+            cholesky::BlockLower( ABlock );
+        else
+            cholesky::BlockUpper( ABlock );
+    }
     else
     {
         if( uplo == LOWER )
-            cholesky::LowerVariant3Blocked( A );
+        {
+            if( FactorLookahead() )
+                cholesky::LowerVariant3LookaheadBlocked( A );
+            else
+                cholesky::LowerVariant3Blocked( A );
+        }
         else
-            cholesky::UpperVariant3Blocked( A );
+        {
+            if( FactorLookahead() )
+                cholesky::UpperVariant3LookaheadBlocked( A );
+            else
+                cholesky::UpperVariant3Blocked( A );
+        }
     }
 }
 
@@ -114,6 +146,7 @@ void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, DistPermutation& p )
 {
     EL_DEBUG_CSE
+    EL_TRACE_REGION("Cholesky");
     if( uplo == LOWER )
         cholesky::PivotedLowerVariant3Blocked( A, p );
     else
@@ -218,6 +251,10 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
   ( UpperOrLower uplo, \
     AbstractDistMatrix<F>& A, \
     DistPermutation& p ); \
+  template void OutOfCoreCholesky<F> \
+  ( const Grid& grid, \
+    const string& filename, \
+    const OutOfCoreCtrl& ctrl ); \
   template void CholeskyMod \
   ( UpperOrLower uplo, Matrix<F>& T, Base<F> alpha, Matrix<F>& V ); \
   template void CholeskyMod \
@@ -0,0 +1,156 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_BLOCK_HPP
+#define EL_CHOLESKY_BLOCK_HPP
+
+namespace El {
+namespace cholesky {
+
+// Right-looking Cholesky factorizations of [MC,MR,BLOCK] matrices whose
+// diagonal blocks are distribution blocks (as in PDPOTRF). The diagonal
+// block is factored redundantly (so that a failure is reported on every
+// process), the panel is solved by its owning process column (row), and the
+// trailing update is computed locally from the panel and its transpose.
+
+template<typename F>
+void BlockLower( DistMatrix<F,MC,MR,BLOCK>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Int n = A.Height();
+    const Int bsize = A.BlockHeight();
+    const Int cut = A.ColCut();
+    auto& ALoc = A.Matrix();
+
+    Matrix<F> A11, L21, L21Trans;
+    for( Int k=0; k<n; )
+    {
+        const Int kEnd = block_cyclic::BlockEnd( k, bsize, cut, n );
+        const Int nb = kEnd - k;
+
+        block_cyclic::BroadcastBlock( A, k, kEnd, k, kEnd, A11 );
+        Cholesky( LOWER, A11 );
+        block_cyclic::StoreBlock( A, k, k, A11 );
+
+        // A21 := A21 L11^-H
+        const Int iLoc0 = A.LocalRowOffset(kEnd);
+        if( A.RowRank() == A.ColOwner(k) )
+        {
+            const Int jLoc = A.LocalColOffset(k);
+            auto A21Loc = ALoc( IR(iLoc0,END), IR(jLoc,jLoc+nb) );
+            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21Loc );
+        }
+
+        // A22 := A22 - L21 L21^H, one local column block at a time
+        block_cyclic::BroadcastColPanel( A, kEnd, n, k, kEnd, L21 );
+        block_cyclic::TransposeColPanel( A, kEnd, L21, L21Trans );
+        const Int jLoc0 = A.LocalColOffset(kEnd);
+        const Int localWidth = A.LocalWidth();
+        for( Int jLoc=jLoc0; jLoc<localWidth; )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            const Int jEnd = block_cyclic::BlockEnd( j, bsize, cut, n );
+            const Int width = jEnd - j;
+            auto L21TransBlock =
+              L21Trans( IR(jLoc-jLoc0,jLoc-jLoc0+width), ALL );
+            if( A.ColRank() == A.RowOwner(j) )
+            {
+                const Int iLoc = A.LocalRowOffset(j);
+                auto ADiag = ALoc( IR(iLoc,iLoc+width), IR(jLoc,jLoc+width) );
+                Trrk
+                ( LOWER, NORMAL, ADJOINT,
+                  F(-1), L21(IR(iLoc-iLoc0,iLoc-iLoc0+width),ALL),
+                         L21TransBlock,
+                  F(1), ADiag );
+            }
+            const Int iLocBelow = A.LocalRowOffset(jEnd);
+            auto ABelow = ALoc( IR(iLocBelow,END), IR(jLoc,jLoc+width) );
+            Gemm
+            ( NORMAL, ADJOINT,
+              F(-1), L21(IR(iLocBelow-iLoc0,END),ALL), L21TransBlock,
+              F(1), ABelow );
+            jLoc += width;
+        }
+        k = kEnd;
+    }
+}
+
+template<typename F>
+void BlockUpper( DistMatrix<F,MC,MR,BLOCK>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Int n = A.Height();
+    const Int bsize = A.BlockHeight();
+    const Int cut = A.ColCut();
+    auto& ALoc = A.Matrix();
+
+    Matrix<F> A11, U12, U12Trans;
+    for( Int k=0; k<n; )
+    {
+        const Int kEnd = block_cyclic::BlockEnd( k, bsize, cut, n );
+        const Int nb = kEnd - k;
+
+        block_cyclic::BroadcastBlock( A, k, kEnd, k, kEnd, A11 );
+        Cholesky( UPPER, A11 );
+        block_cyclic::StoreBlock( A, k, k, A11 );
+
+        // A12 := U11^-H A12
+        const Int jLoc0 = A.LocalColOffset(kEnd);
+        if( A.ColRank() == A.RowOwner(k) )
+        {
+            const Int iLoc = A.LocalRowOffset(k);
+            auto A12Loc = ALoc( IR(iLoc,iLoc+nb), IR(jLoc0,END) );
+            Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11, A12Loc );
+        }
+
+        // A22 := A22 - U12^H U12, one local row block at a time
+        block_cyclic::BroadcastRowPanel( A, k, kEnd, kEnd, n, U12 );
+        block_cyclic::TransposeRowPanel( A, kEnd, U12, U12Trans );
+        const Int iLoc0 = A.LocalRowOffset(kEnd);
+        const Int localHeight = A.LocalHeight();
+        for( Int iLoc=iLoc0; iLoc<localHeight; )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            const Int iEnd = block_cyclic::BlockEnd( i, bsize, cut, n );
+            const Int height = iEnd - i;
+            auto U12TransBlock =
+              U12Trans( ALL, IR(iLoc-iLoc0,iLoc-iLoc0+height) );
+            if( A.RowRank() == A.ColOwner(i) )
+            {
+                const Int jLoc = A.LocalColOffset(i);
+                auto ADiag = ALoc( IR(iLoc,iLoc+height), IR(jLoc,jLoc+height) );
+                Trrk
+                ( UPPER, ADJOINT, NORMAL,
+                  F(-1), U12TransBlock,
+                         U12(ALL,IR(jLoc-jLoc0,jLoc-jLoc0+height)),
+                  F(1), ADiag );
+            }
+            const Int jLocRight = A.LocalColOffset(iEnd);
+            auto ARight = ALoc( IR(iLoc,iLoc+height), IR(jLocRight,END) );
+            Gemm
+            ( ADJOINT, NORMAL,
+              F(-1), U12TransBlock, U12(ALL,IR(jLocRight-jLoc0,END)),
+              F(1), ARight );
+            iLoc += height;
+        }
+        k = kEnd;
+    }
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_BLOCK_HPP
@@ -49,7 +49,7 @@ void LowerVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("Cholesky",n);
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -87,7 +87,7 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("Cholesky",n,grid);
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -125,6 +125,110 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
     }
 }
 
+// A look-ahead variant of the above: the columns of the next panel are
+// updated first, their [VC,* ] redistribution is started, and only then is the
+// remainder of the trailing matrix updated, so that the communication of the
+// next panel is overlapped with the bulk of the current update.
+template<typename F>
+void LowerVariant3LookaheadBlocked( AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    DistMatrix<F,VR,  STAR> A21_VR_STAR(grid);
+    DistMatrix<F,STAR,MC  > A21Trans_STAR_MC(grid);
+    DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(grid);
+
+    // The [VC,* ] copies of the current and next panels
+    vector<DistMatrix<F,VC,STAR>> A21_VC_STAR(2,DistMatrix<F,VC,STAR>(grid));
+    RedistFuture<F> future;
+    bool nextPending = false;
+
+    const Int n = A.Height();
+    const Int bsize = TunedBlocksize<F>("Cholesky",n,grid);
+    Int slot = 0;
+    for( Int k=0; k<n; k+=bsize, slot=1-slot )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int nbNext = Min(bsize,n-(k+nb));
+
+        const Range<Int> ind1( k,           k+nb        ),
+                         ind2( k+nb,        n           ),
+                         indN( 0,           nbNext      ),
+                         indR( nbNext,      n-(k+nb)    ),
+                         ind2N( k+nb,       k+nb+nbNext ),
+                         ind2R( k+nb+nbNext, n          );
+
+        auto A11 = A( ind1, ind1 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        // The panel was already updated by the previous iteration
+        A11_STAR_STAR = A11;
+        Cholesky( LOWER, A11_STAR_STAR );
+        A11 = A11_STAR_STAR;
+
+        if( nextPending )
+        {
+            future.Wait();
+            nextPending = false;
+        }
+        else
+        {
+            A21_VC_STAR[slot].AlignWith( A22 );
+            A21_VC_STAR[slot] = A21;
+        }
+        auto& A21Cur_VC_STAR = A21_VC_STAR[slot];
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT,
+          F(1), A11_STAR_STAR, A21Cur_VC_STAR );
+
+        A21_VR_STAR.AlignWith( A22 );
+        A21_VR_STAR = A21Cur_VC_STAR;
+        A21Trans_STAR_MC.AlignWith( A22 );
+        A21Adj_STAR_MR.AlignWith( A22 );
+        Transpose( A21Cur_VC_STAR, A21Trans_STAR_MC );
+        Adjoint( A21_VR_STAR, A21Adj_STAR_MR );
+
+        if( nbNext > 0 )
+        {
+            // Update the columns of the next panel
+            auto A21Trans_STAR_MC_N = A21Trans_STAR_MC( ALL, indN );
+            auto A21Trans_STAR_MC_R = A21Trans_STAR_MC( ALL, indR );
+            auto A21Adj_STAR_MR_N = A21Adj_STAR_MR( ALL, indN );
+            auto A21Adj_STAR_MR_R = A21Adj_STAR_MR( ALL, indR );
+            auto A22NN = A( ind2N, ind2N );
+            auto A22RN = A( ind2R, ind2N );
+            auto A22RR = A( ind2R, ind2R );
+            LocalTrrk
+            ( LOWER, TRANSPOSE,
+              F(-1), A21Trans_STAR_MC_N, A21Adj_STAR_MR_N, F(1), A22NN );
+            LocalGemm
+            ( TRANSPOSE, NORMAL,
+              F(-1), A21Trans_STAR_MC_R, A21Adj_STAR_MR_N, F(1), A22RN );
+
+            // Start redistributing the next panel and then update the rest
+            auto& A21Next_VC_STAR = A21_VC_STAR[1-slot];
+            A21Next_VC_STAR.AlignWith( A22RR );
+            future = CopyAsync( A22RN, A21Next_VC_STAR );
+            nextPending = true;
+            LocalTrrk
+            ( LOWER, TRANSPOSE,
+              F(-1), A21Trans_STAR_MC_R, A21Adj_STAR_MR_R, F(1), A22RR );
+        }
+
+        Transpose( A21Trans_STAR_MC, A21 );
+    }
+}
+
 } // namespace cholesky
 } // namespace El
 
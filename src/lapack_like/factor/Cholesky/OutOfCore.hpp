@@ -0,0 +1,88 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_OUTOFCORE_HPP
+#define EL_CHOLESKY_OUTOFCORE_HPP
+
+#include "../OutOfCore.hpp"
+
+namespace El {
+
+// Left-looking: for each column panel A(k:n-1,K), with K = [k,k+nb),
+//
+//   A(k:n-1,K) -= L(k:n-1,J) L(K,J)^H
+//
+// for every previously factored panel J, and then A(K,K) = L(K,K) L(K,K)^H
+// and L(k+nb:n-1,K) = A(k+nb:n-1,K) inv(L(K,K))^H. Only the current panel
+// and two of the previous panels (the one in use and the one being read)
+// are held in memory.
+template<typename F>
+void OutOfCoreCholesky
+( const Grid& g, const string& filename, const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    Int n, width;
+    ooc::ReadHeader<F>( filename, n, width );
+    if( n != width )
+        LogicError("A must be square");
+    const Int bsize = ooc::PanelWidth( ctrl, g );
+
+    DistMatrix<F,STAR,VR> A(g);
+    DistMatrix<F,STAR,VR> LBufs[2] = { DistMatrix<F,STAR,VR>(g),
+                                       DistMatrix<F,STAR,VR>(g) };
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        if( ctrl.progress && g.Rank() == 0 )
+            Output("Panel ",k/bsize," of ",(n+bsize-1)/bsize);
+
+        A.Resize( n-k, nb );
+        auto readA =
+          ooc::ReadPanelAsync( filename, n, k, k, A, ctrl.asyncRead );
+        std::future<void> readL;
+        if( k > 0 )
+        {
+            LBufs[0].Resize( n-k, Min(bsize,k) );
+            readL = ooc::ReadPanelAsync
+              ( filename, n, k, 0, LBufs[0], ctrl.asyncRead );
+        }
+        readA.get();
+
+        auto A1 = A( IR(0,nb), ALL );
+        for( Int j=0, t=0; j<k; j+=bsize, t=1-t )
+        {
+            // Start reading the next previous panel before using this one
+            readL.get();
+            const Int jNext = j+bsize;
+            if( jNext < k )
+            {
+                LBufs[1-t].Resize( n-k, Min(bsize,k-jNext) );
+                readL = ooc::ReadPanelAsync
+                  ( filename, n, k, jNext, LBufs[1-t], ctrl.asyncRead );
+            }
+
+            auto& L = LBufs[t];
+            auto L1 = L( IR(0,nb), ALL );
+            auto L2 = L( IR(nb,END), ALL );
+            auto A2 = A( IR(nb,END), ALL );
+            Herk( LOWER, NORMAL, Real(-1), L1, Real(1), A1 );
+            Gemm( NORMAL, ADJOINT, F(-1), L2, L1, F(1), A2 );
+        }
+
+        auto A2 = A( IR(nb,END), ALL );
+        Cholesky( LOWER, A1 );
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A1, A2 );
+        ooc::WritePanel( filename, n, k, k, A );
+        mpi::Barrier( g.Comm() );
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_OUTOFCORE_HPP
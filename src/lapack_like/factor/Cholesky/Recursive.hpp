@@ -0,0 +1,64 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_RECURSIVE_HPP
+#define EL_CHOLESKY_RECURSIVE_HPP
+
+namespace El {
+namespace cholesky {
+
+// Cache-oblivious variants for scalar types without LAPACK support: the
+// matrix is split in half, so that all but O(cutoff^3) of the work is
+// performed within (recursive) Trsm and Trrk updates.
+
+template<typename F>
+void LowerRecursive( Matrix<F>& A, Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n <= cutoff )
+    {
+        LowerVariant3Unblocked( A );
+        return;
+    }
+    const Range<Int> ind1( 0, n/2 ), ind2( n/2, n );
+    auto A11 = A( ind1, ind1 );
+    auto A21 = A( ind2, ind1 );
+    auto A22 = A( ind2, ind2 );
+
+    LowerRecursive( A11, cutoff );
+    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 );
+    Trrk( LOWER, NORMAL, ADJOINT, F(-1), A21, A21, F(1), A22 );
+    LowerRecursive( A22, cutoff );
+}
+
+template<typename F>
+void UpperRecursive( Matrix<F>& A, Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n <= cutoff )
+    {
+        UpperVariant3Unblocked( A );
+        return;
+    }
+    const Range<Int> ind1( 0, n/2 ), ind2( n/2, n );
+    auto A11 = A( ind1, ind1 );
+    auto A12 = A( ind1, ind2 );
+    auto A22 = A( ind2, ind2 );
+
+    UpperRecursive( A11, cutoff );
+    Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11, A12 );
+    Trrk( UPPER, ADJOINT, NORMAL, F(-1), A12, A12, F(1), A22 );
+    UpperRecursive( A22, cutoff );
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_RECURSIVE_HPP
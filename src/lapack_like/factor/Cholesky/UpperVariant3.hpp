@@ -54,7 +54,7 @@ void UpperVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("Cholesky",n);
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -91,7 +91,7 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A12_STAR_MR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("Cholesky",n,grid);
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -122,6 +122,103 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
     }
 }
 
+// A look-ahead variant of the above: the rows of the next panel are updated
+// first, their [* ,MR] redistribution is started, and only then is the
+// remainder of the trailing matrix updated, so that the communication of the
+// next panel is overlapped with the bulk of the current update.
+template<typename F>
+void UpperVariant3LookaheadBlocked( AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(grid);
+    DistMatrix<F,STAR,MC  > A12_STAR_MC(grid);
+    DistMatrix<F,STAR,MR  > A12_STAR_MR(grid);
+
+    // The [* ,MR] copy of the next panel
+    DistMatrix<F,STAR,MR> A12Next_STAR_MR(grid);
+    RedistFuture<F> future;
+    bool nextPending = false;
+
+    const Int n = A.Height();
+    const Int bsize = TunedBlocksize<F>("Cholesky",n,grid);
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int nbNext = Min(bsize,n-(k+nb));
+
+        const Range<Int> ind1( k,           k+nb        ),
+                         ind2( k+nb,        n           ),
+                         indN( 0,           nbNext      ),
+                         indR( nbNext,      n-(k+nb)    ),
+                         ind2N( k+nb,       k+nb+nbNext ),
+                         ind2R( k+nb+nbNext, n          );
+
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+
+        // The panel was already updated by the previous iteration
+        A11_STAR_STAR = A11;
+        Cholesky( UPPER, A11_STAR_STAR );
+        A11 = A11_STAR_STAR;
+
+        A12_STAR_VR.AlignWith( A22 );
+        if( nextPending )
+        {
+            future.Wait();
+            nextPending = false;
+            A12_STAR_VR = A12Next_STAR_MR;
+        }
+        else
+            A12_STAR_VR = A12;
+        LocalTrsm
+        ( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+
+        A12_STAR_MC.AlignWith( A22 );
+        A12_STAR_MC = A12_STAR_VR;
+        A12_STAR_MR.AlignWith( A22 );
+        A12_STAR_MR = A12_STAR_VR;
+
+        if( nbNext > 0 )
+        {
+            // Update the rows of the next panel
+            auto A12_STAR_MC_N = A12_STAR_MC( ALL, indN );
+            auto A12_STAR_MC_R = A12_STAR_MC( ALL, indR );
+            auto A12_STAR_MR_N = A12_STAR_MR( ALL, indN );
+            auto A12_STAR_MR_R = A12_STAR_MR( ALL, indR );
+            auto A22NN = A( ind2N, ind2N );
+            auto A22NR = A( ind2N, ind2R );
+            auto A22RR = A( ind2R, ind2R );
+            LocalTrrk
+            ( UPPER, ADJOINT,
+              F(-1), A12_STAR_MC_N, A12_STAR_MR_N, F(1), A22NN );
+            LocalGemm
+            ( ADJOINT, NORMAL,
+              F(-1), A12_STAR_MC_N, A12_STAR_MR_R, F(1), A22NR );
+
+            // Start redistributing the next panel and then update the rest
+            A12Next_STAR_MR.AlignWith( A22RR );
+            future = CopyAsync( A22NR, A12Next_STAR_MR );
+            nextPending = true;
+            LocalTrrk
+            ( UPPER, ADJOINT,
+              F(-1), A12_STAR_MC_R, A12_STAR_MR_R, F(1), A22RR );
+        }
+
+        A12 = A12_STAR_MR;
+    }
+}
+
 } // namespace cholesky
 } // namespace El
 
@@ -40,7 +40,13 @@ void GQR
     auto& A = AProx.Get();
     auto& B = BProx.Get();
 
-    QR( A, householderScalarsA, signatureA );
+    // A sufficiently tall A is factored with TSQR panels, which produce the
+    // same implicit representation with far fewer reductions
+    const Int gridSize = A.Grid().Size();
+    if( gridSize > 1 && A.Height() >= gridSize*A.Width() )
+        qr::CA( A, householderScalarsA, signatureA );
+    else
+        QR( A, householderScalarsA, signatureA );
     qr::ApplyQ( LEFT, ADJOINT, A, householderScalarsA, signatureA, B );
     RQ( B, householderScalarsB, signatureB );
 }
@@ -42,7 +42,13 @@ void GRQ
 
     RQ( A, householderScalarsA, signatureA );
     rq::ApplyQ( RIGHT, ADJOINT, A, householderScalarsA, signatureA, B );
-    QR( B, householderScalarsB, signatureB );
+    // A sufficiently tall B is factored with TSQR panels, which produce the
+    // same implicit representation with far fewer reductions
+    const Int gridSize = B.Grid().Size();
+    if( gridSize > 1 && B.Height() >= gridSize*B.Width() )
+        qr::CA( B, householderScalarsB, signatureB );
+    else
+        QR( B, householderScalarsB, signatureB );
 }
 
 namespace grq {
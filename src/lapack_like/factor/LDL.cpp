@@ -21,6 +21,7 @@
 #include "./LDL/dense/Var3.hpp"
 
 #include "./LDL/dense/Pivoted.hpp"
+#include "./LDL/dense/Aasen.hpp"
 
 #include "./LDL/dense/MultiplyAfter.hpp"
 #include "./LDL/dense/SolveAfter.hpp"
@@ -100,6 +101,14 @@ void LDL
   template InertiaType ldl::Inertia \
   ( const AbstractDistMatrix<Base<Field>>& d, \
     const AbstractDistMatrix<Field>& dSub ); \
+  template SafeProduct<Base<Field>> ldl::DeterminantAndInertia \
+  ( const Matrix<Base<Field>>& d, \
+    const Matrix<Field>& dSub, \
+    InertiaType& inertia ); \
+  template SafeProduct<Base<Field>> ldl::DeterminantAndInertia \
+  ( const AbstractDistMatrix<Base<Field>>& d, \
+    const AbstractDistMatrix<Field>& dSub, \
+    InertiaType& inertia ); \
   template void ldl::MultiplyAfter \
   ( const Matrix<Field>& A, \
           Matrix<Field>& B, \
@@ -139,7 +148,14 @@ void LDL
     const AbstractDistMatrix<Field>& dSub, \
     const DistPermutation& p, \
           AbstractDistMatrix<Field>& B, \
-     bool conjugated );
+     bool conjugated ); \
+  template void ldl::Aasen \
+  ( Matrix<Field>& A, Permutation& P, bool conjugate ); \
+  template void ldl::SolveAfterAasen \
+  ( const Matrix<Field>& A, \
+    const Permutation& P, \
+          Matrix<Field>& B, \
+    bool conjugated );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
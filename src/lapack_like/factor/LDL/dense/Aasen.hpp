@@ -0,0 +1,215 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LDL_AASEN_HPP
+#define EL_LDL_AASEN_HPP
+
+namespace El {
+namespace ldl {
+
+// Aasen's method computes P A P^T = L T L^{T/H}, where L is unit lower
+// triangular with L(:,0) = e_0 and T is symmetric (Hermitian) tridiagonal.
+// Unlike Bunch-Kaufman, each pivot is chosen by a single maximum search over
+// a column, so that no 2x2 pivot decisions (or the associated row queries)
+// are ever required.
+//
+// On exit, the diagonal and subdiagonal of A respectively hold the diagonal
+// and subdiagonal of T, and, for k >= 1, L(k+1:n-1,k) is stored in
+// A(k+1:n-1,k-1). The strictly upper triangle of A is not referenced.
+//
+// This is the left-looking (level-2) formulation, where the j'th column of
+// H = T L^{T/H} is formed from the previously computed entries of T and the
+// j'th row of L, and then
+//
+//   A(j+1:n-1,j) - L(j+1:n-1,0:j) H(0:j,j) = L(j+1:n-1,j+1) T(j+1,j).
+//
+// NOTE: A blocked, distributed variant is not yet available.
+template<typename F>
+void Aasen( Matrix<F>& A, Permutation& P, bool conjugate )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    const Int n = A.Height();
+    P.MakeIdentity( n );
+    P.ReserveSwaps( n );
+    if( n == 0 )
+        return;
+
+    auto conj = [&]( const F& alpha )
+    { return conjugate ? Conj(alpha) : alpha; };
+    // The (i,k) entry of L for i >= k
+    auto lEntry = [&]( Int i, Int k ) -> F
+    {
+        if( k == i ) return F(1);
+        if( k == 0 ) return F(0);
+        return A(i,k-1);
+    };
+
+    Matrix<F> h, v;
+    for( Int j=0; j<n; ++j )
+    {
+        // h := H(0:j,j), where T(k,k) = A(k,k) and T(k+1,k) = A(k+1,k) for
+        // k < j, and T(j,j) is implied by A(j,j) = L(j,0:j) H(0:j,j)
+        Zeros( h, j+1, 1 );
+        for( Int k=0; k<j; ++k )
+        {
+            F eta = A(k,k)*conj(lEntry(j,k));
+            if( k > 0 )
+                eta += A(k,k-1)*conj(lEntry(j,k-1));
+            eta += conj(A(k+1,k))*conj(lEntry(j,k+1));
+            h(k) = eta;
+        }
+        F eta = A(j,j);
+        for( Int k=1; k<j; ++k )
+            eta -= A(j,k-1)*h(k);
+        h(j) = eta;
+        F alpha = eta;
+        if( j > 0 )
+            alpha -= A(j,j-1)*conj(lEntry(j,j-1));
+        if( conjugate )
+            alpha = RealPart(alpha);
+
+        if( j == n-1 )
+        {
+            A(j,j) = alpha;
+            break;
+        }
+
+        // v := A(j+1:n-1,j) - L(j+1:n-1,1:j) H(1:j,j)
+        const Range<Int> indB( j+1, n );
+        v = A( indB, IR(j,j+1) );
+        if( j > 0 )
+        {
+            auto LB = A( indB, IR(0,j) );
+            auto h1 = h( IR(1,j+1), ALL );
+            Gemv( NORMAL, F(-1), LB, h1, F(1), v );
+        }
+
+        // Pivot the largest entry of v into the subdiagonal
+        const Int q = VectorMaxAbsLoc( v ).index + (j+1);
+        if( q != j+1 )
+        {
+            SymmetricSwap( LOWER, A, j+1, q, conjugate );
+            std::swap( v(0), v(q-(j+1)) );
+            P.Swap( j+1, q );
+        }
+
+        A(j,j) = alpha;
+        const F beta = v(0);
+        A(j+1,j) = beta;
+        for( Int i=j+2; i<n; ++i )
+            A(i,j) = ( beta == F(0) ? F(0) : v(i-(j+1))/beta );
+    }
+}
+
+namespace aasen {
+
+// Overwrite B with inv(T) B using Gaussian elimination with partial pivoting
+// on the (generally nonsymmetric after pivoting) tridiagonal matrix T
+template<typename F>
+void TridiagonalSolve
+( Matrix<F> d, Matrix<F> dSub, Matrix<F> dSup, Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = d.Height();
+    const Int numRHS = B.Width();
+    Matrix<F> dSup2;
+    Zeros( dSup2, Max(n-2,Int(0)), 1 );
+    for( Int i=0; i<n-1; ++i )
+    {
+        if( Abs(d(i)) >= Abs(dSub(i)) )
+        {
+            if( d(i) == F(0) )
+                throw SingularMatrixException();
+            const F phi = dSub(i) / d(i);
+            d(i+1) -= phi*dSup(i);
+            for( Int j=0; j<numRHS; ++j )
+                B(i+1,j) -= phi*B(i,j);
+        }
+        else
+        {
+            // Interchange rows i and i+1
+            const F phi = d(i) / dSub(i);
+            d(i) = dSub(i);
+            const F tau = dSup(i);
+            dSup(i) = d(i+1);
+            d(i+1) = tau - phi*d(i+1);
+            if( i < n-2 )
+            {
+                dSup2(i) = dSup(i+1);
+                dSup(i+1) *= -phi;
+            }
+            for( Int j=0; j<numRHS; ++j )
+            {
+                const F beta = B(i,j);
+                B(i,j) = B(i+1,j);
+                B(i+1,j) = beta - phi*B(i+1,j);
+            }
+        }
+    }
+    if( n > 0 && d(n-1) == F(0) )
+        throw SingularMatrixException();
+
+    for( Int j=0; j<numRHS; ++j )
+    {
+        for( Int i=n-1; i>=0; --i )
+        {
+            F beta = B(i,j);
+            if( i+1 < n )
+                beta -= dSup(i)*B(i+1,j);
+            if( i+2 < n )
+                beta -= dSup2(i)*B(i+2,j);
+            B(i,j) = beta / d(i);
+        }
+    }
+}
+
+} // namespace aasen
+
+template<typename F>
+void SolveAfterAasen
+( const Matrix<F>& A,
+  const Permutation& P,
+        Matrix<F>& B,
+  bool conjugated )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( A.Height() != B.Height() )
+          LogicError("A and B must be the same height");
+    )
+    const Int n = A.Height();
+    if( n == 0 )
+        return;
+    const Orientation orientation = ( conjugated ? ADJOINT : TRANSPOSE );
+
+    // Since L(0,0) is the only nonzero in the first column of L, the unit
+    // lower triangle of A(1:n-1,0:n-2) holds L(1:n-1,1:n-1)
+    auto L = A( IR(1,n), IR(0,n-1) );
+    auto B1 = B( IR(1,n), ALL );
+
+    auto d = GetDiagonal( A );
+    auto dSub = GetDiagonal( A, -1 );
+    Matrix<F> dSup( dSub );
+    if( conjugated )
+        Conjugate( dSup );
+
+    P.PermuteRows( B );
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L, B1 );
+    aasen::TridiagonalSolve( d, dSub, dSup, B );
+    Trsm( LEFT, LOWER, orientation, UNIT, F(1), L, B1 );
+    P.InversePermuteRows( B );
+}
+
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_LDL_AASEN_HPP
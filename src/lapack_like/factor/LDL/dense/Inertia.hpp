@@ -172,6 +172,177 @@ InertiaType Inertia
     return Inertia( d_MC_STAR, dPrev_MC_STAR, dSub_MC_STAR, dSubPrev_MC_STAR );
 }
 
+// Since each 2x2 pivot block has one positive and one negative eigenvalue,
+// the sign of det(A) = det(D) is (-1)^numNegative, and only the logarithm of
+// its magnitude needs to be accumulated alongside the inertia.
+
+// log| delta0 delta1 - |epsilon|^2 |, with scaling to avoid overflow
+template<typename F>
+Base<F> LogAbsDet2x2( Base<F> delta0, Base<F> delta1, F epsilon )
+{
+    typedef Base<F> Real;
+    const Real gamma = Max( Max(Abs(delta0),Abs(delta1)), Abs(epsilon) );
+    const Real epsAbs = Abs(epsilon) / gamma;
+    const Real det = (delta0/gamma)*(delta1/gamma) - epsAbs*epsAbs;
+    return 2*Log(gamma) + Log(Abs(det));
+}
+
+template<typename Real>
+SafeProduct<Real> SafeDeterminantFromInertia
+( Int n, Real logAbsDet, const InertiaType& inertia )
+{
+    SafeProduct<Real> det( n );
+    if( inertia.numZero > 0 )
+    {
+        det.rho = 0;
+        det.kappa = 0;
+    }
+    else
+    {
+        det.rho = ( inertia.numNegative % 2 == 0 ? Real(1) : Real(-1) );
+        det.kappa = ( n == 0 ? Real(0) : logAbsDet/n );
+    }
+    return det;
+}
+
+template<typename F>
+SafeProduct<Base<F>> DeterminantAndInertia
+( const Matrix<Base<F>>& d, const Matrix<F>& dSub, InertiaType& inertia )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = d.Height();
+    EL_DEBUG_ONLY(
+      if( n != 0 && dSub.Height() != n-1 )
+          LogicError("dSub was the wrong length");
+    )
+    inertia.numPositive = inertia.numNegative = inertia.numZero = 0;
+
+    Real logAbsDet = 0;
+    Int k=0;
+    while( k < n )
+    {
+        const Int nb = ( k<n-1 && dSub(k) != F(0) ? 2 : 1 );
+        if( nb == 1 )
+        {
+            const Real delta = d(k);
+            if( delta > Real(0) )
+                ++inertia.numPositive;
+            else if( delta < Real(0) )
+                ++inertia.numNegative;
+            else
+                ++inertia.numZero;
+            if( delta != Real(0) )
+                logAbsDet += Log(Abs(delta));
+        }
+        else
+        {
+            ++inertia.numPositive;
+            ++inertia.numNegative;
+            logAbsDet += LogAbsDet2x2( d(k), d(k+1), dSub(k) );
+        }
+
+        k += nb;
+    }
+
+    return SafeDeterminantFromInertia( n, logAbsDet, inertia );
+}
+
+// Each 2x2 block is counted by the owner of its first row and its
+// determinant is accumulated by the owner of its second row (which holds
+// the first row's entries in dPrev and dSubPrev)
+template<typename F>
+SafeProduct<Base<F>> DeterminantAndInertia
+( const DistMatrix<Base<F>,MC,STAR>& d,
+  const DistMatrix<Base<F>,MC,STAR>& dPrev,
+  const DistMatrix<F,MC,STAR>& dSub,
+  const DistMatrix<F,MC,STAR>& dSubPrev,
+  InertiaType& inertia )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = d.Height();
+    const Int mLocal = d.LocalHeight();
+    const Int prevOff = ( dPrev.ColShift()==d.ColShift()-1 ? 0 : -1 );
+
+    // Pack the three counts and the log of the magnitude into a single
+    // buffer so that only one reduction is required
+    Real localData[4] = { Real(0), Real(0), Real(0), Real(0) };
+    for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+    {
+        const Int i = d.GlobalRow(iLoc);
+        const Int iLocPrev = iLoc + prevOff;
+        if( i<n-1 && dSub.GetLocal(iLoc,0) != F(0) )
+        {
+            // Handle 2x2 starting at i
+            localData[0] += 1;
+            localData[1] += 1;
+        }
+        else if( i>0 && dSubPrev.GetLocal(iLocPrev,0) != F(0) )
+        {
+            // Handle 2x2 starting at i-1
+            localData[3] +=
+              LogAbsDet2x2
+              ( dPrev.GetLocal(iLocPrev,0), d.GetLocal(iLoc,0),
+                dSubPrev.GetLocal(iLocPrev,0) );
+        }
+        else
+        {
+            // Handle 1x1
+            const Real delta = d.GetLocal(iLoc,0);
+            if( delta > 0 )
+                localData[0] += 1;
+            else if( delta < 0 )
+                localData[1] += 1;
+            else
+                localData[2] += 1;
+            if( delta != Real(0) )
+                localData[3] += Log(Abs(delta));
+        }
+    }
+    mpi::AllReduce( localData, 4, d.ColComm() );
+    inertia.numPositive = Int(localData[0]);
+    inertia.numNegative = Int(localData[1]);
+    inertia.numZero = Int(localData[2]);
+
+    return SafeDeterminantFromInertia( n, localData[3], inertia );
+}
+
+template<typename F>
+SafeProduct<Base<F>> DeterminantAndInertia
+( const AbstractDistMatrix<Base<F>>& d,
+  const AbstractDistMatrix<F>& dSub,
+  InertiaType& inertia )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = d.Grid();
+
+    DistMatrix<Real,MC,STAR> d_MC_STAR(g);
+    DistMatrix<F,MC,STAR> dSub_MC_STAR(g);
+    d_MC_STAR.AlignCols( 0 );
+    dSub_MC_STAR.AlignCols( 0 );
+    d_MC_STAR = d;
+    dSub_MC_STAR = dSub;
+
+    // Handle the easy case
+    const Int colStride = g.Height();
+    if( colStride == 1 )
+        return DeterminantAndInertia
+        ( d_MC_STAR.LockedMatrix(), dSub_MC_STAR.LockedMatrix(), inertia );
+
+    DistMatrix<Real,MC,STAR> dPrev_MC_STAR(g);
+    DistMatrix<F,MC,STAR> dSubPrev_MC_STAR(g);
+    const Int colAlignPrev = 1 % colStride;
+    dPrev_MC_STAR.AlignCols( colAlignPrev );
+    dSubPrev_MC_STAR.AlignCols( colAlignPrev );
+    dPrev_MC_STAR = d;
+    dSubPrev_MC_STAR = dSub;
+
+    return DeterminantAndInertia
+    ( d_MC_STAR, dPrev_MC_STAR, dSub_MC_STAR, dSubPrev_MC_STAR, inertia );
+}
+
 } // namespace ldl
 } // namespace El
 
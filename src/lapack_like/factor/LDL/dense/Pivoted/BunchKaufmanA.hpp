@@ -221,85 +221,142 @@ PanelBunchKaufmanA
     return pivot;
 }
 
+// The distributed panel pivot searches below avoid querying individual
+// entries and reducing the maximum of each candidate vector separately:
+// every process writes its (disjoint) portion of the updated candidate
+// entries into a zero-initialized buffer, and a single summation then
+// replicates the whole vector, so that each candidate column costs one
+// collective and all of the pivot decisions are made redundantly.
+
+// Return A(k:n-1,k) - X(k:n-1,0:k-1) Y(k,0:k-1)^T on every process
 template<typename F>
-LDLPivot
-PanelBunchKaufmanA
-( const DistMatrix<F>& A, 
+vector<F> GatherPanelColumn
+( const DistMatrix<F>& A,
   const DistMatrix<F,MC,STAR>& X,
-  const DistMatrix<F,MR,STAR>& Y, 
-  Base<F> gamma )
+  const DistMatrix<F,MR,STAR>& Y )
 {
     EL_DEBUG_CSE
-    typedef Base<F> Real;
     const Int n = A.Height();
     const Int k = X.Width();
-    if( A.ColAlign() != X.ColAlign() || A.RowAlign() != Y.ColAlign() )
-        LogicError("X and Y were not properly aligned with A");
-    if( gamma == Real(0) )
-        gamma = LDLPivotConstant<Real>( BUNCH_KAUFMAN_A );
-
-    const Range<Int> ind0( 0,   k   ),
-                     ind1( k,   k+1 ),  ind1Off( 0, 1   ),
-                     ind2( k+1, n   ),  ind2Off( 1, n-k ),
-                     indB( k,   n   );
+    const Range<Int> ind0( 0, k ), ind1( k, k+1 ), indB( k, n );
 
+    vector<F> z( n-k, F(0) );
     auto aB1 = A( indB, ind1 );
-    auto zB1( aB1 );
-    // A(k:n-1,k) -= X(k:n-1,0:k-1) Y(k,0:k-1)^T
     if( aB1.RowAlign() == aB1.RowRank() )
     {
+        auto zB1( aB1 );
         auto XB0 = X( indB, ind0 );
         auto y10 = Y( ind1, ind0 );
         LocalGemv( NORMAL, F(-1), XB0, y10, F(1), zB1 );
-    } 
-
-    const Real alpha11Abs = Abs(zB1.Get(0,0));
-    const auto a21Max = VectorMaxAbsLoc( zB1(ind2Off,ind1Off) );
-    if( a21Max.value == Real(0) && alpha11Abs == Real(0) )
-        throw SingularMatrixException();
-
-    LDLPivot pivot;
-    if( alpha11Abs >= gamma*a21Max.value )
-    {
-        pivot.nb = 1;
-        pivot.from[0] = k;
-        return pivot;
+        for( Int iLoc=0; iLoc<zB1.LocalHeight(); ++iLoc )
+            z[zB1.GlobalRow(iLoc)] = zB1.GetLocal(iLoc,0);
     }
+    mpi::AllReduce( z.data(), n-k, A.Grid().Comm() );
+    return z;
+}
 
-    // Find maximum off-diag value in row r (exploit symmetry)
-    const Int r = a21Max.index + (k+1);
-    const Range<Int> indrM( k, r   ),
-                     indr1( r, r+1 ), indr1Off( 0, 1   ),
-                                      indr2Off( 1, n-r ),
-                     indrB( r, n   );
-    auto aLeft   = A( indr1, indrM );
-    auto aBottom = A( indrB, indr1 );
-        
-    auto zLeft( aLeft );
-    auto zBottom( aBottom );
-    auto zStrictBottom = zBottom( indr2Off, indr1Off );
+// Return the updated row A(r,k:r-1) followed by the updated column
+// A(r:n-1,r) on every process
+template<typename F>
+vector<F> GatherPanelRow
+( const DistMatrix<F>& A,
+  const DistMatrix<F,MC,STAR>& X,
+  const DistMatrix<F,MR,STAR>& Y,
+  Int r )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int k = X.Width();
+    const Range<Int> ind0( 0, k ), indrM( k, r ), indr1( r, r+1 ),
+                     indrB( r, n );
 
-    // Update necessary components out-of-place
-    // ----------------------------------------
+    vector<F> z( n-k, F(0) );
 
     // A(r,k:r-1) -= X(r,0:k-1) Y(k:r-1,0:k-1)^T
+    auto aLeft = A( indr1, indrM );
     if( aLeft.ColAlign() == aLeft.ColRank() )
     {
+        auto zLeft( aLeft );
         auto xr10 = X( indr1, ind0 );
         auto YrM0 = Y( indrM, ind0 );
         LocalGemv( NORMAL, F(-1), YrM0, xr10, F(1), zLeft );
+        for( Int jLoc=0; jLoc<zLeft.LocalWidth(); ++jLoc )
+            z[zLeft.GlobalCol(jLoc)] = zLeft.GetLocal(0,jLoc);
     }
 
     // A(r:n-1,r) -= X(r:n-1,0:k-1) Y(r,0:k-1)^T
+    auto aBottom = A( indrB, indr1 );
     if( aBottom.RowAlign() == aBottom.RowRank() )
     {
+        auto zBottom( aBottom );
         auto XrB0 = X( indrB, ind0 );
         auto yr10 = Y( indr1, ind0 );
         LocalGemv( NORMAL, F(-1), XrB0, yr10, F(1), zBottom );
-    } 
+        for( Int iLoc=0; iLoc<zBottom.LocalHeight(); ++iLoc )
+            z[(r-k)+zBottom.GlobalRow(iLoc)] = zBottom.GetLocal(iLoc,0);
+    }
+    mpi::AllReduce( z.data(), n-k, A.Grid().Comm() );
+    return z;
+}
 
-    const auto leftMax   = VectorMaxAbsLoc( zLeft );
-    const auto bottomMax = VectorMaxAbsLoc( zStrictBottom );
+// Return the (first) maximum absolute value of z(begin:end-1) along with its
+// index relative to begin
+template<typename F>
+ValueInt<Base<F>> MaxAbsLoc( const vector<F>& z, Int begin, Int end )
+{
+    ValueInt<Base<F>> pivot;
+    pivot.value = 0;
+    pivot.index = -1;
+    for( Int i=begin; i<end; ++i )
+    {
+        const Base<F> alphaAbs = Abs(z[i]);
+        if( alphaAbs > pivot.value || pivot.index == -1 )
+        {
+            pivot.value = alphaAbs;
+            pivot.index = i-begin;
+        }
+    }
+    return pivot;
+}
+
+template<typename F>
+LDLPivot
+PanelBunchKaufmanA
+( const DistMatrix<F>& A, 
+  const DistMatrix<F,MC,STAR>& X,
+  const DistMatrix<F,MR,STAR>& Y, 
+  Base<F> gamma )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int k = X.Width();
+    if( A.ColAlign() != X.ColAlign() || A.RowAlign() != Y.ColAlign() )
+        LogicError("X and Y were not properly aligned with A");
+    if( gamma == Real(0) )
+        gamma = LDLPivotConstant<Real>( BUNCH_KAUFMAN_A );
+
+    // A(k:n-1,k) -= X(k:n-1,0:k-1) Y(k,0:k-1)^T
+    const auto zB1 = GatherPanelColumn( A, X, Y );
+
+    const Real alpha11Abs = Abs(zB1[0]);
+    const auto a21Max = MaxAbsLoc( zB1, 1, n-k );
+    if( a21Max.value == Real(0) && alpha11Abs == Real(0) )
+        throw SingularMatrixException();
+
+    LDLPivot pivot;
+    if( alpha11Abs >= gamma*a21Max.value )
+    {
+        pivot.nb = 1;
+        pivot.from[0] = k;
+        return pivot;
+    }
+
+    // Find maximum off-diag value in row r (exploit symmetry)
+    const Int r = a21Max.index + (k+1);
+    const auto zRow = GatherPanelRow( A, X, Y, r );
+    const auto leftMax   = MaxAbsLoc( zRow, 0, r-k );
+    const auto bottomMax = MaxAbsLoc( zRow, (r-k)+1, n-k );
     const Real rowMaxVal = Max(leftMax.value,bottomMax.value);
 
     if( alpha11Abs >= gamma*a21Max.value*(a21Max.value/rowMaxVal) )
@@ -309,7 +366,7 @@ PanelBunchKaufmanA
         return pivot;
     }
 
-    if( Abs(zBottom.Get(0,0)) >= gamma*rowMaxVal )
+    if( Abs(zRow[r-k]) >= gamma*rowMaxVal )
     {
         pivot.nb = 1;
         pivot.from[0] = r;
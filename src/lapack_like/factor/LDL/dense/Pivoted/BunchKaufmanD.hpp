@@ -213,23 +213,11 @@ PanelBunchKaufmanD
     if( gamma == Real(0) )
         gamma = LDLPivotConstant<Real>( BUNCH_KAUFMAN_D );
 
-    const Range<Int> ind0( 0, k   ),
-                     ind1( k, k+1 ), ind1Off( 0, 1   ),
-                                     ind2Off( 1, n-k ), 
-                     indB( k, n   );
-
-    auto aB1 = A( indB, ind1 );
-    auto zB1( aB1 );
     // A(k:n-1,k) -= X(k:n-1,0:k-1) Y(k,0:k-1)^T
-    if( aB1.RowAlign() == aB1.RowRank() )
-    {
-        auto XB0 = X( indB, ind0 );
-        auto y10 = Y( ind1, ind0 );
-        LocalGemv( NORMAL, F(-1), XB0, y10, F(1), zB1 );
-    } 
+    const auto zB1 = GatherPanelColumn( A, X, Y );
 
-    const Real alpha11Abs = Abs(zB1.Get(0,0));
-    const auto a21Max = VectorMaxAbsLoc( zB1(ind2Off,ind1Off) );
+    const Real alpha11Abs = Abs(zB1[0]);
+    const auto a21Max = MaxAbsLoc( zB1, 1, n-k );
     if( a21Max.value == Real(0) && alpha11Abs == Real(0) )
         throw SingularMatrixException();
 
@@ -243,36 +231,9 @@ PanelBunchKaufmanD
 
     // Find maximum off-diag value in row r (exploit symmetry)
     const Int r = a21Max.index + (k+1);
-    const Range<Int> indrM( k, r   ),
-                     indr1( r, r+1 ),
-                     indrB( r, n   );
-    auto aLeft   = A( indr1, indrM );
-    auto aBottom = A( indrB, indr1 );
-        
-    auto zLeft( aLeft );
-    auto zBottom( aBottom );
-
-    // Update necessary components out-of-place
-    // ----------------------------------------
-
-    // A(r,k:r-1) -= X(r,0:k-1) Y(k:r-1,0:k-1)^T
-    if( aLeft.ColAlign() == aLeft.ColRank() )
-    {
-        auto xr10 = X( indr1, ind0 );
-        auto YrM0 = Y( indrM, ind0 );
-        LocalGemv( NORMAL, F(-1), YrM0, xr10, F(1), zLeft );
-    }
-
-    // A(r:n-1,r) -= X(r:n-1,0:k-1) Y(r,0:k-1)^T
-    if( aBottom.RowAlign() == aBottom.RowRank() )
-    {
-        auto XrB0 = X( indrB, ind0 );
-        auto yr10 = Y( indr1, ind0 );
-        LocalGemv( NORMAL, F(-1), XrB0, yr10, F(1), zBottom );
-    } 
-
-    const auto leftMax   = VectorMaxAbsLoc( zLeft );
-    const auto bottomMax = VectorMaxAbsLoc( zBottom );
+    const auto zRow = GatherPanelRow( A, X, Y, r );
+    const auto leftMax   = MaxAbsLoc( zRow, 0, r-k );
+    const auto bottomMax = MaxAbsLoc( zRow, r-k, n-k );
     const Real rowMaxVal = Max(leftMax.value,bottomMax.value);
 
     if( alpha11Abs >= gamma*a21Max.value*(a21Max.value/rowMaxVal) )
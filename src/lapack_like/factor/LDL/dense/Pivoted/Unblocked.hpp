@@ -119,7 +119,7 @@ Unblocked
             auto A22 = A( ind2, ind2 );
             Y21 = A21;
 
-            auto D11Inv = D11;
+            SmallMatrix<F,2,2> D11Inv( D11 );
             Symmetric2x2Inv( LOWER, D11Inv, conjugate );
             MakeSymmetric( LOWER, D11Inv, conjugate );
             Transform2x2Cols( D11Inv, A21, 0, 1 );
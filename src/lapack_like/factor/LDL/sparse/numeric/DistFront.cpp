@@ -290,6 +290,25 @@ void DistFront<Field>::Pull
         vector<Int>& mappedTargets,
         vector<Int>& colOffs,
   bool conjugate )
+{
+    EL_DEBUG_CSE
+    DistPullPlan plan;
+    FormPullPlan
+    ( A, reordering, rootSep, rootInfo,
+      mappedSources, mappedTargets, colOffs, plan );
+    Pull( A, rootSep, rootInfo, plan, conjugate );
+}
+
+template<typename Field>
+void DistFront<Field>::FormPullPlan
+( const DistSparseMatrix<Field>& A,
+  const DistMap& reordering,
+  const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo,
+        vector<Int>& mappedSources,
+        vector<Int>& mappedTargets,
+        vector<Int>& colOffs,
+        DistPullPlan& plan ) const
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -302,8 +321,11 @@ void DistFront<Field>::Pull
     const int commSize = grid.Size();
     Timer timer;
 
-    A.MappedSources( reordering, mappedSources );
-    A.MappedTargets( reordering, mappedTargets, colOffs );
+    // Only form the mapped sources and targets if they were not provided
+    if( Int(mappedSources.size()) != A.LocalHeight() )
+        A.MappedSources( reordering, mappedSources );
+    if( Int(colOffs.size()) != A.NumLocalEntries() )
+        A.MappedTargets( reordering, mappedTargets, colOffs );
 
     // Set up the indices for the rows we need from each process
     if( time && commRank == 0 )
@@ -336,7 +358,7 @@ void DistFront<Field>::Pull
               ++rRowSizes[ A.RowOwner(sep.inds[t]) ];
       };
     rRowAccumulate( rootSep, rootInfo );
-    vector<int> rRowOffs;
+    vector<int>& rRowOffs = plan.recvRowOffs;
     const Int numRecvRows = Scan( rRowSizes, rRowOffs );
     if( time && commRank == 0 )
         Output("Row index setup: ",timer.Stop()," secs");
@@ -391,12 +413,13 @@ void DistFront<Field>::Pull
     if( time && commRank == 0 )
         Output("AllToAll: ",timer.Stop()," secs");
 
-    // Pack the number of nonzeros per row (and the nonzeros themselves)
+    // Pack the number of nonzeros per row (and the locations of the nonzeros)
     if( time && commRank == 0 )
         timer.Start();
     const Int firstLocalRow = A.FirstLocalRow();
     vector<Int> sRowLengths( numSendRows );
-    vector<int> sEntriesSizes(commSize,0);
+    vector<int>& sEntriesSizes = plan.sendSizes;
+    sEntriesSizes.assign( commSize, 0 );
     for( Int q=0; q<commSize; ++q )
     {
         const Int size = sRowSizes[q];
@@ -420,9 +443,10 @@ void DistFront<Field>::Pull
             }
         }
     }
-    vector<int> sEntriesOffs;
+    vector<int>& sEntriesOffs = plan.sendOffs;
     const int numSendEntries = Scan( sEntriesSizes, sEntriesOffs );
-    vector<Field> sEntries( numSendEntries );
+    plan.numLocalEntries = A.NumLocalEntries();
+    plan.sendInds.resize( numSendEntries );
     vector<Int> sTargets( numSendEntries );
     for( Int q=0; q<commSize; ++q )
     {
@@ -441,8 +465,7 @@ void DistFront<Field>::Pull
                 const Int iReord = mappedTargets[colOffs[rowOff+e]];
                 if( iReord >= jReord )
                 {
-                    const Field value = A.Value( rowOff+e );
-                    sEntries[index] = (conjugate ? Conj(value) : value);
+                    plan.sendInds[index] = rowOff+e;
                     sTargets[index] = iReord;
                     ++index;
                 }
@@ -456,14 +479,16 @@ void DistFront<Field>::Pull
     if( time && commRank == 0 )
         Output("Payload pack: ",timer.Stop()," secs");
 
-    // Send back the number of nonzeros per row and the nonzeros themselves
+    // Send back the number of nonzeros per row and their targets
     if( time && commRank == 0 )
         timer.Start();
-    vector<Int> rRowLengths( numRecvRows );
+    vector<Int>& rRowLengths = plan.recvRowLengths;
+    rRowLengths.resize( numRecvRows );
     mpi::AllToAll
     ( sRowLengths.data(), sRowSizes.data(), sRowOffs.data(),
       rRowLengths.data(), rRowSizes.data(), rRowOffs.data(), grid.Comm() );
-    vector<int> rEntriesSizes(commSize,0);
+    vector<int>& rEntriesSizes = plan.recvSizes;
+    rEntriesSizes.assign( commSize, 0 );
     for( Int q=0; q<commSize; ++q )
     {
         const Int size = rRowSizes[q];
@@ -471,30 +496,57 @@ void DistFront<Field>::Pull
         for( Int s=0; s<size; ++s )
             rEntriesSizes[q] += rRowLengths[off+s];
     }
-    vector<int> rEntriesOffs;
+    vector<int>& rEntriesOffs = plan.recvOffs;
     const int numRecvEntries = Scan( rEntriesSizes, rEntriesOffs );
-    vector<Field> rEntries( numRecvEntries );
-    vector<Int> rTargets( numRecvEntries );
-    mpi::AllToAll
-    ( sEntries.data(), sEntriesSizes.data(), sEntriesOffs.data(),
-      rEntries.data(), rEntriesSizes.data(), rEntriesOffs.data(), grid.Comm() );
+    plan.recvTargets.resize( numRecvEntries );
     mpi::AllToAll
     ( sTargets.data(), sEntriesSizes.data(), sEntriesOffs.data(),
-      rTargets.data(), rEntriesSizes.data(), rEntriesOffs.data(), grid.Comm() );
+      plan.recvTargets.data(), rEntriesSizes.data(), rEntriesOffs.data(),
+      grid.Comm() );
     if( time && commRank == 0 )
         Output("AllToAll time: ",timer.Stop()," secs");
+}
+
+template<typename Field>
+void DistFront<Field>::Pull
+( const DistSparseMatrix<Field>& A,
+  const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo,
+  const DistPullPlan& plan,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    if( A.NumLocalEntries() != plan.numLocalEntries )
+        LogicError
+        ("Expected ",plan.numLocalEntries," local nonzeros but received ",
+         A.NumLocalEntries());
+    const Grid& grid = A.Grid();
+
+    // Pack and exchange the nonzeros
+    const Int numSendEntries = plan.sendInds.size();
+    const Field* AValBuf = A.LockedValueBuffer();
+    vector<Field> sEntries( numSendEntries );
+    for( Int k=0; k<numSendEntries; ++k )
+    {
+        const Field value = AValBuf[plan.sendInds[k]];
+        sEntries[k] = (conjugate ? Conj(value) : value);
+    }
+    vector<Field> rEntries( plan.recvTargets.size() );
+    mpi::AllToAll
+    ( sEntries.data(), plan.sendSizes.data(), plan.sendOffs.data(),
+      rEntries.data(), plan.recvSizes.data(), plan.recvOffs.data(),
+      grid.Comm() );
+    SwapClear( sEntries );
 
     // Unpack the received entries
-    if( time && commRank == 0 )
-        timer.Start();
     // TODO(poulson): Modify constructor of [Dist]Front to default to SYMM_2D?
     type = SYMM_2D;
     isHermitian = conjugate;
+    auto rowOffs = plan.recvRowOffs;
+    auto entryOffs = plan.recvOffs;
     UnpackEntries
     ( rootSep, rootInfo, *this,
-      A, rRowLengths, rEntries, rTargets, rRowOffs, rEntriesOffs );
-    if( time && commRank == 0 )
-        Output("Unpack: ",timer.Stop()," secs");
+      A, plan.recvRowLengths, rEntries, plan.recvTargets, rowOffs, entryOffs );
 }
 
 template<typename Field>
@@ -66,6 +66,7 @@ void DistSparseLDLFactorization<Field>::Initialize
 
     initialized_ = true;
     factored_ = false;
+    formedPullMetadata_ = false;
 }
 
 template<typename Field>
@@ -88,6 +89,7 @@ void DistSparseLDLFactorization<Field>::Initialize2DGridGraph
 
     initialized_ = true;
     factored_ = false;
+    formedPullMetadata_ = false;
 }
 
 template<typename Field>
@@ -111,6 +113,7 @@ void DistSparseLDLFactorization<Field>::Initialize3DGridGraph
 
     initialized_ = true;
     factored_ = false;
+    formedPullMetadata_ = false;
 }
 
 template<typename Field>
@@ -156,14 +159,27 @@ void DistSparseLDLFactorization<Field>::ChangeNonzeroValues
     {
         ANew.MappedSources( map_, mappedSources_ );
         ANew.MappedTargets( map_, mappedTargets_, columnOffsets_ );
+        front_->FormPullPlan
+        ( ANew, map_, *separator_, *info_,
+          mappedSources_, mappedTargets_, columnOffsets_, pullPlan_ );
         formedPullMetadata_ = true;
     }
     front_->Pull
-    ( ANew, map_, *separator_, *info_,
-      mappedSources_, mappedTargets_, columnOffsets_ );
+    ( ANew, *separator_, *info_, pullPlan_, front_->isHermitian );
     factored_ = false;
 }
 
+template<typename Field>
+void DistSparseLDLFactorization<Field>::Refactor
+( const DistSparseMatrix<Field>& ANew, LDLFrontType frontType )
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'Refactor()'");
+    ChangeNonzeroValues( ANew );
+    Factor( frontType );
+}
+
 template<typename Field>
 void DistSparseLDLFactorization<Field>::Solve( DistMultiVec<Field>& B ) const
 {
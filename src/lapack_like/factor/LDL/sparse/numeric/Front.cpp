@@ -206,6 +206,160 @@ void Front<Field>::Pull
     pull( rootInfo, *this );
 }
 
+template<typename Field>
+void Front<Field>::FormPullPlan
+( const SparseMatrix<Field>& A,
+  const vector<Int>& reordering,
+  const NodeInfo& rootInfo,
+        PullPlan& plan ) const
+{
+    EL_DEBUG_CSE
+    const Int n = reordering.size();
+    vector<Int> invReorder(n);
+    for( Int j=0; j<n; ++j )
+        invReorder[reordering[j]] = j;
+
+    plan.numEntries = A.NumEntries();
+    SwapClear( plan.sources );
+    SwapClear( plan.fronts );
+    SwapClear( plan.rows );
+    SwapClear( plan.cols );
+    SwapClear( plan.kinds );
+    plan.sources.reserve( plan.numEntries );
+    plan.fronts.reserve( plan.numEntries );
+    plan.rows.reserve( plan.numEntries );
+    plan.cols.reserve( plan.numEntries );
+    plan.kinds.reserve( plan.numEntries );
+    auto push =
+      [&]( Int e, Int frontIndex, Int row, Int col, PullDestination kind )
+      {
+          plan.sources.push_back( e );
+          plan.fronts.push_back( frontIndex );
+          plan.rows.push_back( row );
+          plan.cols.push_back( col );
+          plan.kinds.push_back( kind );
+      };
+
+    // This traversal must match the (preorder) traversal of Refill
+    const Int* AColBuf = A.LockedTargetBuffer();
+    const Int* AOffsetBuf = A.LockedOffsetBuffer();
+    Int frontIndex = 0;
+    function<void(const NodeInfo&,const Front<Field>&)> form =
+      [&]( const NodeInfo& node, const Front<Field>& front )
+      {
+        const Int myIndex = frontIndex++;
+        for( Int t=0; t<node.size; ++t )
+        {
+            const Int j = invReorder[node.off+t];
+            const Int rowOff = AOffsetBuf[j];
+            const Int numConn = AOffsetBuf[j+1] - rowOff;
+            for( Int k=0; k<numConn; ++k )
+            {
+                const Int e = rowOff+k;
+                const Int i = reordering[AColBuf[e]];
+                if( i < node.off+t )
+                    continue;
+                else if( i < node.off+node.size )
+                {
+                    if( front.sparseLeaf )
+                    {
+                        const Int iRel = i-node.off;
+                        if( iRel == t )
+                        {
+                            push
+                            ( e, myIndex, front.workSparse.Offset(t,t), 0,
+                              PULL_SPARSE_DIAGONAL );
+                        }
+                        else
+                        {
+                            push
+                            ( e, myIndex, front.workSparse.Offset(iRel,t), 0,
+                              PULL_SPARSE );
+                            push
+                            ( e, myIndex, front.workSparse.Offset(t,iRel), 0,
+                              PULL_SPARSE_MIRROR );
+                        }
+                    }
+                    else
+                        push( e, myIndex, i-node.off, t, PULL_DENSE );
+                }
+                else
+                {
+                    const Int origOff = Find( node.origLowerStruct, i );
+                    const Int row = node.origLowerRelInds[origOff];
+                    if( front.sparseLeaf )
+                        push( e, myIndex, row-node.size, t, PULL_DENSE );
+                    else
+                        push( e, myIndex, row, t, PULL_DENSE );
+                }
+            }
+        }
+        const Int numChildren = node.children.size();
+        for( Int c=0; c<numChildren; ++c )
+            form( *node.children[c], *front.children[c] );
+      };
+    form( rootInfo, *this );
+}
+
+template<typename Field>
+void Front<Field>::Refill( const SparseMatrix<Field>& A, const PullPlan& plan )
+{
+    EL_DEBUG_CSE
+    if( A.NumEntries() != plan.numEntries )
+        LogicError
+        ("Expected ",plan.numEntries," nonzeros but received ",
+         A.NumEntries());
+
+    // Zero the fronts in place and mark them as unfactored
+    vector<Front<Field>*> fronts;
+    function<void(Front<Field>&)> reset =
+      [&]( Front<Field>& front )
+      {
+        fronts.push_back( &front );
+        front.type = SYMM_2D;
+        Zero( front.LDense );
+        if( front.sparseLeaf )
+        {
+            Field* workBuf = front.workSparse.ValueBuffer();
+            const Int numWorkEntries = front.workSparse.NumEntries();
+            for( Int e=0; e<numWorkEntries; ++e )
+                workBuf[e] = 0;
+        }
+        for( auto& child : front.children )
+            reset( *child );
+      };
+    reset( *this );
+
+    const Field* AValBuf = A.LockedValueBuffer();
+    const Int numDests = plan.sources.size();
+    for( Int k=0; k<numDests; ++k )
+    {
+        Front<Field>& front = *fronts[plan.fronts[k]];
+        const Field transVal = AValBuf[plan.sources[k]];
+        // Since SuiteSparse makes use of column-major ordering, and Elemental
+        // uses row-major ordering of its sparse matrices, the sparse leaves
+        // implicitly store the transpose.
+        switch( plan.kinds[k] )
+        {
+        case PULL_DENSE:
+            front.LDense(plan.rows[k],plan.cols[k]) =
+              isHermitian ? Conj(transVal) : transVal;
+            break;
+        case PULL_SPARSE:
+            front.workSparse.ValueBuffer()[plan.rows[k]] = transVal;
+            break;
+        case PULL_SPARSE_DIAGONAL:
+            front.workSparse.ValueBuffer()[plan.rows[k]] =
+              isHermitian ? Field(RealPart(transVal)) : transVal;
+            break;
+        case PULL_SPARSE_MIRROR:
+            front.workSparse.ValueBuffer()[plan.rows[k]] =
+              isHermitian ? Conj(transVal) : transVal;
+            break;
+        }
+    }
+}
+
 template<typename Field>
 void Front<Field>::PullUpdate
 ( const SparseMatrix<Field>& A,
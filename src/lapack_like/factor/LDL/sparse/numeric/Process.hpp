@@ -28,6 +28,18 @@
 namespace El {
 namespace ldl {
 
+// Subtrees with fewer than this many indices are factored within the task of
+// their parent rather than in a task of their own
+inline Int TaskCutoff() { return 1000; }
+
+inline Int SubtreeSize( const NodeInfo& info )
+{
+    Int size = info.size;
+    for( const auto& child : info.children )
+        size += SubtreeSize( *child );
+    return size;
+}
+
 template<typename Field>
 void Process
 ( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
@@ -50,22 +62,33 @@ void Process
         if( PivotedFactorization(factorType) )
             Zeros( front.subdiag, Max(n-1,0), 1 );
 
-        Zeros( front.LSparse, numSources, numSources );
-        front.LSparse.ForceNumEntries( numEntries );
+        // The structure of the sparse factor is known from the symbolic
+        // analysis, so it is only formed for the first factorization
+        const bool formStruct =
+          front.LSparse.Height() != numSources ||
+          front.LSparse.NumEntries() != numEntries;
+        if( formStruct )
+        {
+            Zeros( front.LSparse, numSources, numSources );
+            front.LSparse.ForceNumEntries( numEntries );
+        }
         Field* LValBuf = front.LSparse.ValueBuffer();
         Int* LRowBuf = front.LSparse.SourceBuffer();
         Int* LColBuf = front.LSparse.TargetBuffer();
         Int* LOffsetBuf = front.LSparse.OffsetBuffer();
 
-        for( Int i=0; i<numSources; ++i )
+        if( formStruct )
         {
-            const Int iStart = info.LOffsets[i];
-            const Int iEnd = info.LOffsets[i+1];
-            LOffsetBuf[i] = iStart;
-            for( Int e=iStart; e<iEnd; ++e )
-                LRowBuf[e] = i;
+            for( Int i=0; i<numSources; ++i )
+            {
+                const Int iStart = info.LOffsets[i];
+                const Int iEnd = info.LOffsets[i+1];
+                LOffsetBuf[i] = iStart;
+                for( Int e=iStart; e<iEnd; ++e )
+                    LRowBuf[e] = i;
+            }
+            LOffsetBuf[numSources] = info.LOffsets[numSources];
         }
-        LOffsetBuf[numSources] = info.LOffsets[numSources];
         front.diag.Resize( numSources, 1 );
 
         // Factor the transpose of L
@@ -119,12 +142,27 @@ void Process
               LogicError("Front was not the proper size");
         )
 
-        // Process children and add in their updates
+        // Process the children (concurrently, if their subtrees are large
+        // enough to amortize the cost of a task)
         const int numChildren = info.children.size();
         for( Int c=0; c<numChildren; ++c )
         {
-            Process( *info.children[c], *front.children[c], factorType );
+            const NodeInfo* childInfo = info.children[c].get();
+            Front<Field>* childFront = front.children[c].get();
+#ifdef EL_HYBRID
+            const bool spawn =
+              numChildren > 1 && SubtreeSize(*childInfo) >= TaskCutoff();
+            #pragma omp task firstprivate(childInfo,childFront) if(spawn)
+#endif
+            Process( *childInfo, *childFront, factorType );
+        }
+#ifdef EL_HYBRID
+        #pragma omp taskwait
+#endif
 
+        // Add in the updates of the children
+        for( Int c=0; c<numChildren; ++c )
+        {
             auto& childU = front.children[c]->workDense;
             const int childUSize = childU.Height();
             for( int jChild=0; jChild<childUSize; ++jChild )
@@ -146,6 +184,25 @@ void Process
     }
 }
 
+// Factor a sequential elimination tree, with independent subtrees processed
+// as tasks by a team of threads when the library is built with OpenMP
+template<typename Field>
+void ProcessTree
+( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    if( !omp_in_parallel() )
+    {
+        #pragma omp parallel
+        #pragma omp single
+        Process( info, front, factorType );
+        return;
+    }
+#endif
+    Process( info, front, factorType );
+}
+
 template<typename Field>
 void Process
 ( const DistNodeInfo& info, DistFront<Field>& front, LDLFrontType factorType )
@@ -158,7 +215,7 @@ void Process
         const Grid& grid = info.Grid();
         auto& frontDup = *front.duplicate;
 
-        Process( *info.duplicate, frontDup, factorType );
+        ProcessTree( *info.duplicate, frontDup, factorType );
 
         // Pull the relevant information up from the duplicate
         front.type = frontDup.type;
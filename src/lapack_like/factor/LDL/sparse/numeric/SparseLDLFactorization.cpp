@@ -52,6 +52,7 @@ void SparseLDLFactorization<Field>::Initialize
     ( A.LockedGraph(), map_, *separator_, *info_, bisectCtrl );
     InvertMap( map_, inverseMap_ );
     front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
+    formedPullPlan_ = false;
 
     initialized_ = true;
     factored_ = false;
@@ -73,6 +74,7 @@ void SparseLDLFactorization<Field>::Initialize2DGridGraph
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
     front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
+    formedPullPlan_ = false;
 
     initialized_ = true;
     factored_ = false;
@@ -95,6 +97,7 @@ void SparseLDLFactorization<Field>::Initialize3DGridGraph
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
     front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
+    formedPullPlan_ = false;
 
     initialized_ = true;
     factored_ = false;
@@ -115,7 +118,7 @@ void SparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     ChangeFrontType( SYMM_2D );
     
     // Perform the initial factorization
-    ldl::Process( *info_, *front_, InitialFactorType(frontType) );
+    ldl::ProcessTree( *info_, *front_, InitialFactorType(frontType) );
     factored_ = true;
     
     // Convert the fronts from the initial factorization to the requested form
@@ -138,10 +141,28 @@ void SparseLDLFactorization<Field>::ChangeNonzeroValues
     EL_DEBUG_CSE
     if( !initialized_ )
         LogicError("Must initialize before calling 'ChangeNonzeroValues()'");
-    front_->Pull( ANew, map_, *info_ );
+    front_->Pull( ANew, map_, *info_, front_->isHermitian );
+    formedPullPlan_ = false;
     factored_ = false;
 }
 
+template<typename Field>
+void SparseLDLFactorization<Field>::Refactor
+( const SparseMatrix<Field>& ANew, LDLFrontType frontType )
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'Refactor()'");
+    if( !formedPullPlan_ )
+    {
+        front_->FormPullPlan( ANew, map_, *info_, pullPlan_ );
+        formedPullPlan_ = true;
+    }
+    front_->Refill( ANew, pullPlan_ );
+    factored_ = false;
+    Factor( frontType );
+}
+
 template<typename Field>
 void SparseLDLFactorization<Field>::Solve( Matrix<Field>& B ) const
 {
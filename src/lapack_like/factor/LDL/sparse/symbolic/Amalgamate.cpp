@@ -0,0 +1,118 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+// The number of entries in the lower trapezoid of a front with 'size'
+// pivots and 'lowerSize' update indices
+inline double FrontEntries( Int size, Int lowerSize )
+{ return (double(size)*(size+1))/2 + double(size)*lowerSize; }
+
+// Merge child 'c' of the given node (whose indices immediately precede those
+// of the node) into the node, adopting the grandchildren in its place
+inline void MergeChild( Separator& sep, NodeInfo& node, Int c )
+{
+    EL_DEBUG_CSE
+    unique_ptr<Separator> childSep( std::move(sep.children[c]) );
+    unique_ptr<NodeInfo> child( std::move(node.children[c]) );
+    EL_DEBUG_ONLY(
+      if( child->off+child->size != node.off )
+          LogicError("Merged child was not contiguous with its parent");
+    )
+
+    // The merged separator lists the child indices first
+    vector<Int> inds( childSep->inds );
+    inds.insert( inds.end(), sep.inds.begin(), sep.inds.end() );
+    sep.off = childSep->off;
+    SwapClear( sep.inds );
+    sep.inds = std::move(inds);
+
+    // The original lower structure of the child, minus our own indices,
+    // joins ours
+    const Int newEnd = node.off + node.size;
+    vector<Int> childStruct;
+    for( const Int& i : child->origLowerStruct )
+        if( i >= newEnd )
+            childStruct.push_back( i );
+    node.origLowerStruct = Union( node.origLowerStruct, childStruct );
+    node.off = child->off;
+    node.size += child->size;
+
+    // Splice the grandchildren into the position of the merged child
+    const Int numGrandchildren = child->children.size();
+    for( Int g=0; g<numGrandchildren; ++g )
+    {
+        child->children[g]->parent = &node;
+        childSep->children[g]->parent = &sep;
+    }
+    node.children.erase( node.children.begin()+c );
+    sep.children.erase( sep.children.begin()+c );
+    node.children.insert
+    ( node.children.begin()+c,
+      std::make_move_iterator(child->children.begin()),
+      std::make_move_iterator(child->children.end()) );
+    sep.children.insert
+    ( sep.children.begin()+c,
+      std::make_move_iterator(childSep->children.begin()),
+      std::make_move_iterator(childSep->children.end()) );
+}
+
+inline void AmalgamateRecursion
+( Separator& sep, NodeInfo& node, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    for( size_t c=0; c<node.children.size(); ++c )
+        AmalgamateRecursion( *sep.children[c], *node.children[c], ctrl );
+
+    // Repeatedly absorb the child whose indices immediately precede ours.
+    // Our lower structure is unchanged by a merge since that of the child is
+    // contained within our indices and our lower structure.
+    const Int lowerSize = node.lowerStruct.size();
+    while( true )
+    {
+        const Int numChildren = node.children.size();
+        Int c=0;
+        for( ; c<numChildren; ++c )
+            if( node.children[c]->off+node.children[c]->size == node.off )
+                break;
+        if( c == numChildren )
+            break;
+        const NodeInfo& child = *node.children[c];
+        if( child.children.empty() )
+            break;
+
+        const Int childLowerSize = child.lowerStruct.size();
+        const Int mergedSize = child.size + node.size;
+        const double mergedEntries = FrontEntries( mergedSize, lowerSize );
+        const double explicitZeros = mergedEntries -
+          FrontEntries( child.size, childLowerSize ) -
+          FrontEntries( node.size, lowerSize );
+        if( mergedSize > ctrl.relaxSize &&
+            explicitZeros > ctrl.relaxFraction*mergedEntries )
+            break;
+
+        MergeChild( sep, node, c );
+    }
+}
+
+void Amalgamate( Separator& sep, NodeInfo& info, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( !ctrl.amalgamate )
+        return;
+
+    // The merge criteria require the lower structure of each node
+    Analysis( info );
+    AmalgamateRecursion( sep, info, ctrl );
+}
+
+} // namespace ldl
+} // namespace El
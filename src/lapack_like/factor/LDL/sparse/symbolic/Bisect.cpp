@@ -0,0 +1,793 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#ifdef HYDROGEN_HAVE_PARMETIS
+#include <parmetis.h>
+#endif
+
+namespace El {
+
+namespace {
+
+// Form the subgraphs of the left and right halves of a bisection. Targets
+// within the original graph are mapped to their new indices, and the targets
+// outside of it (connections to ancestor separators) are preserved, so that
+// the targets of each child remain relative to the child's offset.
+void BuildChildren
+( const Graph& graph,
+  const vector<Int>& map,
+  Int leftChildSize,
+  Int rightChildSize,
+  Graph& leftChild,
+  Graph& rightChild )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    const Int numTargets = graph.NumTargets();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+
+    leftChild.Resize( leftChildSize, numTargets );
+    rightChild.Resize( rightChildSize, numTargets-leftChildSize );
+    for( Int s=0; s<numSources; ++s )
+    {
+        const Int source = map[s];
+        const bool onLeft = source < leftChildSize;
+        if( !onLeft && source >= leftChildSize+rightChildSize )
+            continue;
+        Graph& child = onLeft ? leftChild : rightChild;
+        const Int shift = onLeft ? 0 : leftChildSize;
+        for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+        {
+            const Int target = targetBuf[e];
+            const Int mappedTarget = target < numSources ? map[target] : target;
+            child.QueueConnection( source-shift, mappedTarget-shift );
+        }
+    }
+    leftChild.ProcessQueues();
+    rightChild.ProcessQueues();
+}
+
+// Split the processes into the lower half, which owns the left child, and the
+// upper half, which owns the right child
+void SplitGrid
+( const El::Grid& grid,
+  unique_ptr<El::Grid>& childGrid,
+  bool& childIsOnLeft )
+{
+    EL_DEBUG_CSE
+    const int commSize = grid.Size();
+    const int commRank = grid.Rank();
+    childIsOnLeft = commRank < commSize/2;
+    mpi::Comm childComm;
+    mpi::Split( grid.Comm(), childIsOnLeft ? 0 : 1, commRank, childComm );
+    childGrid.reset( new El::Grid(childComm) );
+    mpi::Free( childComm );
+}
+
+// Fill in the local portions of the map and of this process's child from a
+// bisection which was redundantly computed on every process
+void DistributeChildren
+( const DistGraph& graph,
+  const Graph& seqLeftChild,
+  const Graph& seqRightChild,
+  const vector<Int>& seqMap,
+  unique_ptr<El::Grid>& childGrid,
+  DistGraph& child,
+  DistMap& map,
+  bool& childIsOnLeft )
+{
+    EL_DEBUG_CSE
+    const El::Grid& grid = graph.Grid();
+
+    map.SetGrid( grid );
+    map.Resize( graph.NumSources() );
+    const Int numLocalSources = map.NumLocalSources();
+    const Int firstLocalSource = map.FirstLocalSource();
+    for( Int s=0; s<numLocalSources; ++s )
+        map.SetLocal( s, seqMap[s+firstLocalSource] );
+
+    SplitGrid( grid, childGrid, childIsOnLeft );
+
+    const Graph& seqChild = childIsOnLeft ? seqLeftChild : seqRightChild;
+    child.SetGrid( *childGrid );
+    child.Resize( seqChild.NumSources(), seqChild.NumTargets() );
+    const Int numLocalChildSources = child.NumLocalSources();
+    const Int firstLocalChildSource = child.FirstLocalSource();
+    const Int* offsetBuf = seqChild.LockedOffsetBuffer();
+    const Int* targetBuf = seqChild.LockedTargetBuffer();
+    child.Reserve
+    ( offsetBuf[firstLocalChildSource+numLocalChildSources] -
+      offsetBuf[firstLocalChildSource] );
+    for( Int sLoc=0; sLoc<numLocalChildSources; ++sLoc )
+    {
+        const Int s = sLoc + firstLocalChildSource;
+        for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+            child.QueueLocalConnection( sLoc, targetBuf[e] );
+    }
+    child.ProcessLocalQueues();
+}
+
+// Order the vertices of the connected component containing 'root' by the
+// level sets of a breadth-first search, appending them to 'order' and the
+// starting index of each level to 'levelOffs'
+void LevelSets
+( const Graph& graph,
+  Int root,
+  vector<Int>& level,
+  Int mark,
+  vector<Int>& order,
+  vector<Int>& levelOffs )
+{
+    const Int numSources = graph.NumSources();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+
+    const Int start = order.size();
+    order.push_back( root );
+    level[root] = mark;
+    levelOffs.push_back( start );
+    Int levelBeg = start;
+    while( levelBeg < Int(order.size()) )
+    {
+        const Int levelEnd = order.size();
+        for( Int k=levelBeg; k<levelEnd; ++k )
+        {
+            const Int s = order[k];
+            for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+            {
+                const Int t = targetBuf[e];
+                if( t < numSources && level[t] != mark )
+                {
+                    level[t] = mark;
+                    order.push_back( t );
+                }
+            }
+        }
+        if( Int(order.size()) > levelEnd )
+            levelOffs.push_back( levelEnd );
+        levelBeg = levelEnd;
+    }
+}
+
+// The parts of a distributed bisection
+enum BisectPart
+{
+  LEFT_PART=0,
+  RIGHT_PART=1,
+  SEPARATOR_PART=2
+};
+
+// The blocksize of the 1D distribution of a DistGraph or DistMap
+Int SourceBlocksize( Int numSources, int commSize )
+{
+    Int blocksize = numSources / commSize;
+    if( blocksize*commSize < numSources || numSources == 0 )
+        ++blocksize;
+    return blocksize;
+}
+
+// Breadth-first search from the given local roots (which may lie on any
+// number of processes), numbering the level sets from 'firstLevel'. Each edge
+// of the graph joins sources whose levels differ by at most one, so that
+// every level separates the levels before it from those after it. Returns
+// the number of levels.
+Int DistLevelSets
+( const DistGraph& graph,
+  const vector<Int>& localRoots,
+        vector<Int>& level,
+        Int firstLevel )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = graph.Grid().Comm();
+    const int commSize = graph.Grid().Size();
+    const Int numSources = graph.NumSources();
+    const Int firstLocalSource = graph.FirstLocalSource();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+
+    vector<Int> frontier, nextFrontier, remoteTargets;
+    for( const Int& sLoc : localRoots )
+    {
+        if( level[sLoc] == -1 )
+        {
+            level[sLoc] = firstLevel;
+            frontier.push_back( sLoc );
+        }
+    }
+
+    vector<int> sendSizes( commSize ), sendOffs;
+    Int numLevels = 0;
+    while( mpi::AllReduce( Int(frontier.size()), mpi::SUM, comm ) != 0 )
+    {
+        ++numLevels;
+        const Int nextLevel = firstLevel + numLevels;
+        nextFrontier.clear();
+        remoteTargets.clear();
+        for( const Int& sLoc : frontier )
+        {
+            for( Int e=offsetBuf[sLoc]; e<offsetBuf[sLoc+1]; ++e )
+            {
+                const Int t = targetBuf[e];
+                if( t >= numSources )
+                    continue;
+                if( graph.IsLocalSource(t) )
+                {
+                    const Int tLoc = t - firstLocalSource;
+                    if( level[tLoc] == -1 )
+                    {
+                        level[tLoc] = nextLevel;
+                        nextFrontier.push_back( tLoc );
+                    }
+                }
+                else
+                    remoteTargets.push_back( t );
+            }
+        }
+
+        // The owners are nondecreasing in the sorted targets, so the sorted
+        // targets can be sent as is
+        std::sort( remoteTargets.begin(), remoteTargets.end() );
+        remoteTargets.erase
+        ( std::unique( remoteTargets.begin(), remoteTargets.end() ),
+          remoteTargets.end() );
+        std::fill( sendSizes.begin(), sendSizes.end(), 0 );
+        for( const Int& t : remoteTargets )
+            ++sendSizes[graph.SourceOwner(t)];
+        Scan( sendSizes, sendOffs );
+        auto requests =
+          mpi::AllToAll( remoteTargets, sendSizes, sendOffs, comm );
+        for( const Int& t : requests )
+        {
+            const Int tLoc = t - firstLocalSource;
+            if( level[tLoc] == -1 )
+            {
+                level[tLoc] = nextLevel;
+                nextFrontier.push_back( tLoc );
+            }
+        }
+        frontier.swap( nextFrontier );
+    }
+    return numLevels;
+}
+
+// The distributed analogue of the sequential level-set bisection: the roots
+// are pushed towards pseudo-peripheral sources with up to ctrl.numDistSeps
+// trial searches, and any sources left unreached (in other connected
+// components) are swept up by further searches seeded from the first
+// unreached source of each process.
+void LevelSetBisect
+( const DistGraph& graph,
+        vector<int>& parts,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = graph.Grid().Comm();
+    const Int numSources = graph.NumSources();
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int firstLocalSource = graph.FirstLocalSource();
+
+    vector<Int> level( numLocalSources, -1 ), localRoots;
+    Int numLevels = 0;
+    if( numSources > 0 )
+    {
+        Int root = 0;
+        const Int numTrials = Max(ctrl.numDistSeps,1);
+        for( Int trial=0; trial<numTrials; ++trial )
+        {
+            vector<Int> trialLevel( numLocalSources, -1 );
+            localRoots.clear();
+            if( graph.IsLocalSource(root) )
+                localRoots.push_back( root-firstLocalSource );
+            const Int numTrialLevels =
+              DistLevelSets( graph, localRoots, trialLevel, 0 );
+
+            Int lastSource = numSources;
+            for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+                if( trialLevel[sLoc] == numTrialLevels-1 )
+                    lastSource = Min( lastSource, sLoc+firstLocalSource );
+            root = mpi::AllReduce( lastSource, mpi::MIN, comm );
+        }
+        localRoots.clear();
+        if( graph.IsLocalSource(root) )
+            localRoots.push_back( root-firstLocalSource );
+        numLevels = DistLevelSets( graph, localRoots, level, 0 );
+    }
+    while( true )
+    {
+        localRoots.clear();
+        for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+        {
+            if( level[sLoc] == -1 )
+            {
+                localRoots.push_back( sLoc );
+                break;
+            }
+        }
+        if( mpi::AllReduce( Int(localRoots.size()), mpi::SUM, comm ) == 0 )
+            break;
+        numLevels += DistLevelSets( graph, localRoots, level, numLevels );
+    }
+
+    vector<Int> levelSizes( numLevels, 0 );
+    for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+        ++levelSizes[level[sLoc]];
+    mpi::AllReduce( levelSizes.data(), numLevels, mpi::SUM, comm );
+
+    // Choose the smallest level which leaves at least a quarter of the
+    // sources on each side, falling back to the level containing the median
+    Int sepLevel = -1, medianLevel = 0, before = 0;
+    for( Int k=0; k<numLevels; ++k )
+    {
+        const Int size = levelSizes[k];
+        const Int after = numSources - before - size;
+        if( before <= numSources/2 )
+            medianLevel = k;
+        if( 4*Min(before,after) >= numSources &&
+            (sepLevel == -1 || size < levelSizes[sepLevel]) )
+            sepLevel = k;
+        before += size;
+    }
+    if( sepLevel == -1 )
+        sepLevel = medianLevel;
+
+    parts.resize( numLocalSources );
+    for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+    {
+        if( level[sLoc] < sepLevel )
+            parts[sLoc] = LEFT_PART;
+        else if( level[sLoc] > sepLevel )
+            parts[sLoc] = RIGHT_PART;
+        else
+            parts[sLoc] = SEPARATOR_PART;
+    }
+}
+
+#ifdef HYDROGEN_HAVE_PARMETIS
+// Compute an edge bisection with ParMETIS, keeping the best of
+// ctrl.numDistSeps random seeds, and convert it into a vertex separator by
+// moving the boundary of the side with the fewest boundary sources into the
+// separator. Returns false if ParMETIS cannot be applied since a process does
+// not own any sources.
+bool ParMETISBisect
+( const DistGraph& graph,
+        vector<int>& parts,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const El::Grid& grid = graph.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+    const Int numSources = graph.NumSources();
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int firstLocalSource = graph.FirstLocalSource();
+    const Int numLocalEdges = graph.NumLocalEdges();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+    if( mpi::AllReduce( numLocalSources, mpi::MIN, comm ) == 0 )
+        return false;
+
+    // ParMETIS expects the adjacency structure without self-connections
+    // (and we drop the connections to the ancestor separators)
+    const Int blocksize = graph.Blocksize();
+    vector<idx_t> vtxDist( commSize+1 ), xAdj( numLocalSources+1 ), adjncy;
+    for( int q=0; q<=commSize; ++q )
+        vtxDist[q] = Min( q*blocksize, numSources );
+    adjncy.reserve( numLocalEdges );
+    xAdj[0] = 0;
+    for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+    {
+        const Int s = sLoc + firstLocalSource;
+        for( Int e=offsetBuf[sLoc]; e<offsetBuf[sLoc+1]; ++e )
+        {
+            const Int t = targetBuf[e];
+            if( t != s && t < numSources )
+                adjncy.push_back( t );
+        }
+        xAdj[sLoc+1] = adjncy.size();
+    }
+
+    idx_t weightFlag=0, numFlag=0, numCon=1, numParts=2, edgeCut;
+    real_t tpWeights[2] = { real_t(0.5), real_t(0.5) };
+    real_t imbalanceTol = 1.05;
+    MPI_Comm parComm = comm.comm;
+
+    vector<idx_t> part( numLocalSources ), trialPart( numLocalSources );
+    vector<Int> targetParts;
+    vector<char> onBoundary( numLocalSources );
+    Int bestSepSize = numSources+1;
+    const Int numTrials = Max(ctrl.numDistSeps,1);
+    for( Int trial=0; trial<numTrials; ++trial )
+    {
+        idx_t options[3] = { 1, 0, idx_t(trial) };
+        const int retval = ParMETIS_V3_PartKway
+        ( vtxDist.data(), xAdj.data(), adjncy.data(), nullptr, nullptr,
+          &weightFlag, &numFlag, &numCon, &numParts, tpWeights,
+          &imbalanceTol, options, &edgeCut, trialPart.data(), &parComm );
+        if( retval != METIS_OK )
+            RuntimeError("ParMETIS_V3_PartKway returned ",retval);
+
+        // Find the sources adjacent to the other part
+        DistMap partMap( numSources, grid );
+        for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+            partMap.SetLocal( sLoc, trialPart[sLoc] );
+        targetParts.assign( targetBuf, targetBuf+numLocalEdges );
+        partMap.Translate( targetParts );
+        Int boundarySizes[2] = { 0, 0 };
+        for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+        {
+            onBoundary[sLoc] = false;
+            for( Int e=offsetBuf[sLoc]; e<offsetBuf[sLoc+1]; ++e )
+                if( targetBuf[e] < numSources &&
+                    targetParts[e] != trialPart[sLoc] )
+                    onBoundary[sLoc] = true;
+            if( onBoundary[sLoc] )
+                ++boundarySizes[trialPart[sLoc]];
+        }
+        mpi::AllReduce( boundarySizes, 2, mpi::SUM, comm );
+        const idx_t sepPart = ( boundarySizes[0] <= boundarySizes[1] ? 0 : 1 );
+        const Int sepSize = boundarySizes[sepPart];
+        if( sepSize >= bestSepSize )
+            continue;
+
+        bestSepSize = sepSize;
+        parts.resize( numLocalSources );
+        for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+        {
+            if( onBoundary[sLoc] && trialPart[sLoc] == sepPart )
+                parts[sLoc] = SEPARATOR_PART;
+            else
+                parts[sLoc] = ( trialPart[sLoc] == 0 ? LEFT_PART : RIGHT_PART );
+        }
+    }
+    return true;
+}
+#endif // ifdef HYDROGEN_HAVE_PARMETIS
+
+// Number the sources of each part contiguously, in order of their owners,
+// with the left part first, followed by the right part and the separator.
+// Returns the size of the separator.
+Int MapParts
+( const DistGraph& graph,
+  const vector<int>& parts,
+        DistMap& map,
+        Int& leftChildSize,
+        Int& rightChildSize )
+{
+    EL_DEBUG_CSE
+    const El::Grid& grid = graph.Grid();
+    const Int numLocalSources = graph.NumLocalSources();
+
+    Int localSizes[3] = { 0, 0, 0 };
+    for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+        ++localSizes[parts[sLoc]];
+    Int sizes[3], localEnds[3];
+    mpi::AllReduce( localSizes, sizes, 3, mpi::SUM, grid.Comm() );
+    mpi::Scan( localSizes, localEnds, 3, mpi::SUM, grid.Comm() );
+    leftChildSize = sizes[LEFT_PART];
+    rightChildSize = sizes[RIGHT_PART];
+
+    Int offsets[3];
+    offsets[LEFT_PART] = localEnds[LEFT_PART] - localSizes[LEFT_PART];
+    offsets[RIGHT_PART] =
+      leftChildSize + localEnds[RIGHT_PART] - localSizes[RIGHT_PART];
+    offsets[SEPARATOR_PART] = leftChildSize + rightChildSize +
+      localEnds[SEPARATOR_PART] - localSizes[SEPARATOR_PART];
+
+    map.SetGrid( grid );
+    map.Resize( graph.NumSources() );
+    for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+        map.SetLocal( sLoc, offsets[parts[sLoc]]++ );
+    return sizes[SEPARATOR_PART];
+}
+
+// Send the (mapped) connections of each source of the two halves directly to
+// the process which owns it within the corresponding child, so that the
+// graph is never gathered. As in BuildChildren, the targets outside of the
+// graph are preserved so that they remain relative to the child's offset.
+void RedistributeChildren
+( const DistGraph& graph,
+  const DistMap& map,
+        Int leftChildSize,
+        Int rightChildSize,
+        unique_ptr<El::Grid>& childGrid,
+        DistGraph& child,
+        bool& childIsOnLeft )
+{
+    EL_DEBUG_CSE
+    const El::Grid& grid = graph.Grid();
+    const int commSize = grid.Size();
+    const Int numTargets = graph.NumTargets();
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int numLocalEdges = graph.NumLocalEdges();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+
+    vector<Int> mappedTargets( targetBuf, targetBuf+numLocalEdges );
+    map.Translate( mappedTargets );
+
+    const int leftCommSize = commSize/2;
+    const Int leftBlocksize = SourceBlocksize( leftChildSize, leftCommSize );
+    const Int rightBlocksize =
+      SourceBlocksize( rightChildSize, commSize-leftCommSize );
+    auto childOwner =
+      [&]( Int i )
+      {
+          if( i < leftChildSize )
+              return int(i/leftBlocksize);
+          else
+              return leftCommSize + int((i-leftChildSize)/rightBlocksize);
+      };
+
+    vector<int> sendSizes( commSize, 0 ), sendOffs;
+    for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+    {
+        const Int i = map.GetLocal( sLoc );
+        if( i < leftChildSize+rightChildSize )
+            sendSizes[childOwner(i)] += 2*(offsetBuf[sLoc+1]-offsetBuf[sLoc]);
+    }
+    const int numSends = Scan( sendSizes, sendOffs );
+    vector<Int> sendBuf( numSends );
+    auto offs = sendOffs;
+    for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+    {
+        const Int i = map.GetLocal( sLoc );
+        if( i >= leftChildSize+rightChildSize )
+            continue;
+        const int q = childOwner( i );
+        const Int shift = ( i < leftChildSize ? 0 : leftChildSize );
+        for( Int e=offsetBuf[sLoc]; e<offsetBuf[sLoc+1]; ++e )
+        {
+            sendBuf[offs[q]++] = i - shift;
+            sendBuf[offs[q]++] = mappedTargets[e] - shift;
+        }
+    }
+    auto recvBuf = mpi::AllToAll( sendBuf, sendSizes, sendOffs, grid.Comm() );
+    SwapClear( sendBuf );
+
+    SplitGrid( grid, childGrid, childIsOnLeft );
+    child.SetGrid( *childGrid );
+    if( childIsOnLeft )
+        child.Resize( leftChildSize, numTargets );
+    else
+        child.Resize( rightChildSize, numTargets-leftChildSize );
+    const Int firstLocalChildSource = child.FirstLocalSource();
+    const Int numRecvEdges = recvBuf.size() / 2;
+    child.Reserve( numRecvEdges );
+    for( Int k=0; k<numRecvEdges; ++k )
+        child.QueueLocalConnection
+        ( recvBuf[2*k]-firstLocalChildSource, recvBuf[2*k+1] );
+    child.ProcessLocalQueues();
+}
+
+} // anonymous namespace
+
+Int Bisect
+( const Graph& graph,
+        Graph& leftChild,
+        Graph& rightChild,
+        vector<Int>& map,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+
+    // Build the level structure of each connected component, starting each
+    // search from the last vertex reached by the previous one so that the
+    // roots tend towards pseudo-peripheral vertices
+    vector<Int> order, levelOffs, level( numSources, -1 );
+    order.reserve( numSources );
+    Int mark = -1;
+    for( Int s=0; s<numSources; ++s )
+    {
+        if( level[s] != -1 )
+            continue;
+        Int root = s;
+        const Int numTrials = Max(ctrl.numSeqSeps,1);
+        for( Int trial=0; trial<numTrials; ++trial )
+        {
+            vector<Int> trialOrder, trialOffs;
+            LevelSets( graph, root, level, --mark, trialOrder, trialOffs );
+            root = trialOrder.back();
+        }
+        LevelSets( graph, root, level, numSources, order, levelOffs );
+    }
+    const Int numLevels = levelOffs.size();
+    levelOffs.push_back( numSources );
+
+    // Choose the smallest level which leaves at least a quarter of the
+    // vertices on each side, falling back to the level containing the median
+    Int sepLevel = -1, medianLevel = 0;
+    for( Int k=0; k<numLevels; ++k )
+    {
+        const Int before = levelOffs[k];
+        const Int size = levelOffs[k+1] - before;
+        const Int after = numSources - before - size;
+        if( before <= numSources/2 )
+            medianLevel = k;
+        if( 4*Min(before,after) >= numSources &&
+            (sepLevel == -1 || size < levelOffs[sepLevel+1]-levelOffs[sepLevel]) )
+            sepLevel = k;
+    }
+    if( sepLevel == -1 )
+        sepLevel = medianLevel;
+
+    const Int leftChildSize = levelOffs[sepLevel];
+    const Int sepSize = levelOffs[sepLevel+1] - leftChildSize;
+    const Int rightChildSize = numSources - leftChildSize - sepSize;
+
+    // The left vertices keep their positions in the level ordering while the
+    // separator is moved to the end
+    map.resize( numSources );
+    for( Int k=0; k<leftChildSize; ++k )
+        map[order[k]] = k;
+    for( Int k=0; k<sepSize; ++k )
+        map[order[leftChildSize+k]] = leftChildSize+rightChildSize+k;
+    for( Int k=0; k<rightChildSize; ++k )
+        map[order[leftChildSize+sepSize+k]] = leftChildSize+k;
+    EL_DEBUG_ONLY(EnsurePermutation( map ))
+
+    BuildChildren
+    ( graph, map, leftChildSize, rightChildSize, leftChild, rightChild );
+    return sepSize;
+}
+
+Int Bisect
+( const DistGraph& graph,
+        unique_ptr<El::Grid>& childGrid,
+        DistGraph& child,
+        DistMap& map,
+        bool& childIsOnLeft,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( graph.Grid().Size() == 1 )
+        LogicError("This routine assumes at least two processes");
+
+    if( ctrl.sequential )
+    {
+        Graph seqGraph( graph );
+        Graph leftChild, rightChild;
+        vector<Int> seqMap;
+        const Int sepSize =
+          Bisect( seqGraph, leftChild, rightChild, seqMap, ctrl );
+
+        DistributeChildren
+        ( graph, leftChild, rightChild, seqMap, childGrid, child, map,
+          childIsOnLeft );
+        return sepSize;
+    }
+
+    vector<int> parts;
+    bool bisected = false;
+#ifdef HYDROGEN_HAVE_PARMETIS
+    bisected = ParMETISBisect( graph, parts, ctrl );
+#endif
+    if( !bisected )
+        LevelSetBisect( graph, parts, ctrl );
+
+    Int leftChildSize, rightChildSize;
+    const Int sepSize =
+      MapParts( graph, parts, map, leftChildSize, rightChildSize );
+    EL_DEBUG_ONLY(EnsurePermutation( map ))
+    RedistributeChildren
+    ( graph, map, leftChildSize, rightChildSize, childGrid, child,
+      childIsOnLeft );
+    return sepSize;
+}
+
+namespace {
+
+// Map the natural ordering of an nx x ny x nz box onto the left box, right
+// box, and separator plane normal to the longest dimension
+Int NaturalMap
+( Int nx, Int ny, Int nz,
+  Int& nxLeft, Int& nyLeft, Int& nzLeft,
+  Int& nxRight, Int& nyRight, Int& nzRight,
+  vector<Int>& map )
+{
+    EL_DEBUG_CSE
+    nxLeft = nxRight = nx;
+    nyLeft = nyRight = ny;
+    nzLeft = nzRight = nz;
+    Int dim = 0, length = nx;
+    if( ny > length ) { dim = 1; length = ny; }
+    if( nz > length ) { dim = 2; length = nz; }
+    const Int mid = length/2;
+    if( dim == 0 ) { nxLeft = mid; nxRight = nx-mid-1; }
+    if( dim == 1 ) { nyLeft = mid; nyRight = ny-mid-1; }
+    if( dim == 2 ) { nzLeft = mid; nzRight = nz-mid-1; }
+
+    const Int leftChildSize = nxLeft*nyLeft*nzLeft;
+    const Int rightChildSize = nxRight*nyRight*nzRight;
+    const Int numSources = nx*ny*nz;
+    const Int sepSize = numSources - leftChildSize - rightChildSize;
+
+    map.resize( numSources );
+    Int leftOff=0, rightOff=leftChildSize, sepOff=leftChildSize+rightChildSize;
+    for( Int z=0; z<nz; ++z )
+    {
+        for( Int y=0; y<ny; ++y )
+        {
+            for( Int x=0; x<nx; ++x )
+            {
+                const Int coord = ( dim == 0 ? x : (dim == 1 ? y : z) );
+                const Int s = x + y*nx + z*nx*ny;
+                if( coord < mid )
+                    map[s] = leftOff++;
+                else if( coord > mid )
+                    map[s] = rightOff++;
+                else
+                    map[s] = sepOff++;
+            }
+        }
+    }
+    return sepSize;
+}
+
+} // anonymous namespace
+
+Int NaturalBisect
+( Int nx, Int ny, Int nz,
+  const Graph& graph,
+  Int& nxLeft, Int& nyLeft, Int& nzLeft,
+  Graph& leftChild,
+  Int& nxRight, Int& nyRight, Int& nzRight,
+  Graph& rightChild,
+  vector<Int>& map )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    if( numSources != nx*ny*nz )
+        LogicError("The graph was not an nx x ny x nz grid graph");
+    if( numSources == 0 )
+        LogicError("Cannot bisect an empty graph");
+
+    const Int sepSize =
+      NaturalMap( nx, ny, nz, nxLeft, nyLeft, nzLeft,
+                  nxRight, nyRight, nzRight, map );
+    BuildChildren
+    ( graph, map, nxLeft*nyLeft*nzLeft, nxRight*nyRight*nzRight,
+      leftChild, rightChild );
+    return sepSize;
+}
+
+Int NaturalBisect
+( Int nx, Int ny, Int nz,
+  const DistGraph& graph,
+  Int& nxChild, Int& nyChild, Int& nzChild,
+  unique_ptr<El::Grid>& childGrid,
+  DistGraph& child,
+  DistMap& map,
+  bool& childIsOnLeft )
+{
+    EL_DEBUG_CSE
+    if( graph.Grid().Size() == 1 )
+        LogicError("This routine assumes at least two processes");
+
+    Graph seqGraph( graph );
+    Int nxLeft, nyLeft, nzLeft, nxRight, nyRight, nzRight;
+    Graph leftChild, rightChild;
+    vector<Int> seqMap;
+    const Int sepSize =
+      NaturalBisect
+      ( nx, ny, nz, seqGraph,
+        nxLeft, nyLeft, nzLeft, leftChild,
+        nxRight, nyRight, nzRight, rightChild, seqMap );
+
+    DistributeChildren
+    ( graph, leftChild, rightChild, seqMap, childGrid, child, map,
+      childIsOnLeft );
+    nxChild = childIsOnLeft ? nxLeft : nxRight;
+    nyChild = childIsOnLeft ? nyLeft : nyRight;
+    nzChild = childIsOnLeft ? nzLeft : nzRight;
+    return sepSize;
+}
+
+} // namespace El
@@ -14,6 +14,8 @@
 namespace El {
 namespace ldl {
 
+using std::set;
+
 inline void
 NaturalNestedDissectionRecursion
 (       Int nx,
@@ -297,6 +299,7 @@ NaturalNestedDissectionRecursion
         NaturalNestedDissectionRecursion
         ( nx, ny, nz, seqGraph, perm.Map(),
           *sep.duplicate, *info.duplicate, off, cutoff );
+        Amalgamate( *sep.duplicate, *info.duplicate );
 
         // Pull information up from the duplicates
         sep.off = sep.duplicate->off;
@@ -326,8 +329,9 @@ void NaturalNestedDissection
 
     NaturalNestedDissectionRecursion
     ( nx, ny, nz, graph, perm, sep, info, 0, cutoff );
+    Amalgamate( sep, info );
 
-    // Construct the distributed reordering
+    // Construct the reordering
     sep.BuildMap( map );
     EL_DEBUG_ONLY(EnsurePermutation( map ))
 
@@ -14,6 +14,8 @@
 namespace El {
 namespace ldl {
 
+using std::set;
+
 void AMDOrder
 ( const vector<Int>& subOffsets,
   const vector<Int>& subTargets,
@@ -377,6 +379,7 @@ NestedDissectionRecursion
         info.duplicate.reset( new NodeInfo(&info) );
         NestedDissectionRecursion
         ( seqGraph, perm.Map(), *sep.duplicate, *info.duplicate, off, ctrl );
+        Amalgamate( *sep.duplicate, *info.duplicate, ctrl );
 
         // Pull information up from the duplicates
         sep.off = sep.duplicate->off;
@@ -402,8 +405,9 @@ void NestedDissection
         perm[s] = s;
 
     NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+    Amalgamate( sep, info, ctrl );
 
-    // Construct the distributed reordering
+    // Construct the reordering
     sep.BuildMap( map );
     EL_DEBUG_ONLY(EnsurePermutation(map))
 
@@ -7,12 +7,18 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include <El/blas_like/level3/BlockCyclic.hpp>
 
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/Recursive.hpp"
+#include "./LU/TournamentPanel.hpp"
+#include "./LU/Lookahead.hpp"
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
+#include "./LU/OutOfCore.hpp"
+#include "./LU/Block.hpp"
 
 namespace El {
 
@@ -25,7 +31,7 @@ void LU( Matrix<F>& A )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("LU",minDim);
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -47,6 +53,14 @@ template<typename F>
 void LU( AbstractDistMatrix<F>& APre )
 {
     EL_DEBUG_CSE
+    EL_TRACE_REGION("LU");
+    if( block_cyclic::IsMCMRBlock(APre) &&
+        block_cyclic::HasSquareBlocks(APre) )
+    {
+        // Avoid redistributing block-cyclic matrices into [MC,MR]
+        lu::Block( static_cast<DistMatrix<F,MC,MR,BLOCK>&>(APre) );
+        return;
+    }
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -60,7 +74,7 @@ void LU( AbstractDistMatrix<F>& APre )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("LU",minDim,g);
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -105,11 +119,16 @@ template<typename F>
 void LU( Matrix<F>& A, Permutation& P )
 {
     EL_DEBUG_CSE
+    if( !IsBlasScalar<F>::value )
+    {
+        lu::Recursive( A, P, LocalRecursionCutoff<F>() );
+        return;
+    }
 
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("LU",minDim);
 
     P.MakeIdentity( m );
     P.ReserveSwaps( minDim );
@@ -152,12 +171,35 @@ void LU
 }
 
 template<typename F>
-void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
+void LU( AbstractDistMatrix<F>& A, DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    LU( A, P, LU_PARTIAL );
+}
+
+template<typename F>
+void LU
+( AbstractDistMatrix<F>& APre, DistPermutation& P, LUPivotType pivotType )
 {
     EL_DEBUG_CSE
+    EL_TRACE_REGION("LU");
+    if( pivotType != LU_PARTIAL && pivotType != LU_CALU )
+        LogicError("Only partial and tournament pivoting are supported here");
+    if( pivotType == LU_PARTIAL && block_cyclic::IsMCMRBlock(APre) &&
+        block_cyclic::HasSquareBlocks(APre) )
+    {
+        // Avoid redistributing block-cyclic matrices into [MC,MR]
+        lu::Block( static_cast<DistMatrix<F,MC,MR,BLOCK>&>(APre), P );
+        return;
+    }
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
+    if( FactorLookahead() )
+    {
+        lu::LookaheadBlocked( A, P, pivotType );
+        return;
+    }
 
     const Grid& g = A.Grid();
     DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g);
@@ -176,7 +218,7 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
     DistPermutation PB(g);
 
     vector<F> panelBuf, pivotBuf;
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("LU",minDim,g);
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -199,7 +241,11 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
         ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
         A11_STAR_STAR = A11;
         A21_MC_STAR = A21;
-        lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        if( pivotType == LU_CALU )
+            lu::TournamentPanel
+            ( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        else
+            lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
 
         PB.PermuteRows( AB );
 
@@ -241,6 +287,10 @@ void LU
   ( AbstractDistMatrix<F>& A, \
     DistPermutation& P ); \
   template void LU \
+  ( AbstractDistMatrix<F>& A, \
+    DistPermutation& P, \
+    LUPivotType pivotType ); \
+  template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
     Permutation& Q ); \
@@ -248,6 +298,11 @@ void LU
   ( AbstractDistMatrix<F>& A, \
     DistPermutation& P, \
     DistPermutation& Q ); \
+  template void OutOfCoreLU<F> \
+  ( const Grid& grid, \
+    const string& filename, \
+    DistPermutation& P, \
+    const OutOfCoreCtrl& ctrl ); \
   template void LUMod \
   (       Matrix<F>& A, \
           Permutation& P, \
@@ -0,0 +1,226 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_BLOCK_HPP
+#define EL_LU_BLOCK_HPP
+
+namespace El {
+namespace lu {
+
+// Exchange rows i0 and i1 within the local columns jLocBeg:jLocEnd-1 of an
+// [MC,MR,BLOCK] matrix
+template<typename F>
+void BlockSwapRows
+( DistMatrix<F,MC,MR,BLOCK>& A,
+  Int i0, Int i1, Int jLocBeg, Int jLocEnd,
+  vector<F>& buffer )
+{
+    EL_DEBUG_CSE
+    const Int width = jLocEnd - jLocBeg;
+    if( i0 == i1 || width <= 0 )
+        return;
+    const int owner0 = A.RowOwner(i0);
+    const int owner1 = A.RowOwner(i1);
+    const int colRank = A.ColRank();
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    if( owner0 == owner1 )
+    {
+        if( colRank == owner0 )
+            blas::Swap
+            ( width, &ABuf[A.LocalRowOffset(i0)+jLocBeg*ALDim], ALDim,
+                     &ABuf[A.LocalRowOffset(i1)+jLocBeg*ALDim], ALDim );
+    }
+    else if( colRank == owner0 || colRank == owner1 )
+    {
+        const Int i = ( colRank == owner0 ? i0 : i1 );
+        const int partner = ( colRank == owner0 ? owner1 : owner0 );
+        F* rowBuf = &ABuf[A.LocalRowOffset(i)+jLocBeg*ALDim];
+        FastResize( buffer, width );
+        for( Int t=0; t<width; ++t )
+            buffer[t] = rowBuf[t*ALDim];
+        mpi::SendRecv( buffer.data(), width, partner, partner, A.ColComm() );
+        for( Int t=0; t<width; ++t )
+            rowBuf[t*ALDim] = buffer[t];
+    }
+}
+
+// Factor the panel A(k:m-1,k:kEnd-1), which lies within a single process
+// column, using (optional) partial pivoting as in PDGETF2. Only the owning
+// process column should call this routine. The pivots are returned relative
+// to the beginning of the matrix, and false is returned if an exactly zero
+// pivot was encountered.
+template<typename F>
+bool BlockPanel
+( DistMatrix<F,MC,MR,BLOCK>& A,
+  Int k, Int kEnd,
+  bool pivot,
+  vector<Int>& pivots,
+  vector<F>& buffer )
+{
+    EL_DEBUG_CSE
+    EL_TRACE_REGION("Panel");
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int nb = kEnd - k;
+    const Int jLoc0 = A.LocalColOffset(k);
+    const Int localHeight = A.LocalHeight();
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    mpi::Comm colComm = A.ColComm();
+    mpi::Op maxLocOp = mpi::MaxLocOp<Real>();
+
+    FastResize( pivots, nb );
+    vector<F> pivotRow;
+    for( Int t=0; t<nb; ++t )
+    {
+        const Int j = k + t;
+        const Int jLoc = jLoc0 + t;
+        const Int iLoc = A.LocalRowOffset(j);
+
+        Int iPiv = j;
+        if( pivot )
+        {
+            // Store the index/value of the local pivot candidate
+            ValueInt<Real> localPivot;
+            if( iLoc < localHeight )
+            {
+                const Int iLocMax = iLoc +
+                  blas::MaxInd( localHeight-iLoc, &ABuf[iLoc+jLoc*ALDim], 1 );
+                localPivot.value = Abs(ABuf[iLocMax+jLoc*ALDim]);
+                localPivot.index = A.GlobalRow(iLocMax);
+            }
+            else
+            {
+                localPivot.value = -1;
+                localPivot.index = m;
+            }
+            iPiv = mpi::AllReduce( localPivot, maxLocOp, colComm ).index;
+            BlockSwapRows( A, j, iPiv, jLoc0, jLoc0+nb, buffer );
+        }
+        pivots[t] = iPiv;
+
+        // Broadcast the remainder of the pivot row within the panel
+        const int pivotOwner = A.RowOwner(j);
+        FastResize( pivotRow, nb-t );
+        if( A.ColRank() == pivotOwner )
+            for( Int s=0; s<nb-t; ++s )
+                pivotRow[s] = ABuf[iLoc+(jLoc+s)*ALDim];
+        mpi::Broadcast( pivotRow.data(), nb-t, pivotOwner, colComm );
+        if( pivotRow[0] == F(0) )
+            return false;
+
+        // Form the column of L and update the rest of the panel
+        const Int iLocBelow = A.LocalRowOffset(j+1);
+        const Int belowHeight = localHeight - iLocBelow;
+        const F alpha11Inv = F(1) / pivotRow[0];
+        blas::Scal( belowHeight, alpha11Inv, &ABuf[iLocBelow+jLoc*ALDim], 1 );
+        blas::Geru
+        ( belowHeight, nb-t-1, F(-1),
+          &ABuf[iLocBelow+jLoc*ALDim], 1, &pivotRow[1], 1,
+          &ABuf[iLocBelow+(jLoc+1)*ALDim], ALDim );
+    }
+    return true;
+}
+
+// Right-looking LU factorization of an [MC,MR,BLOCK] matrix whose diagonal
+// blocks are distribution blocks (as in PDGETRF). Each panel is factored
+// within its owning process column, its pivots are broadcast within process
+// rows and applied to the rest of the matrix, the owning process row solves
+// for its block row of U, and the trailing update is local.
+template<typename F>
+void BlockHelper
+( DistMatrix<F,MC,MR,BLOCK>& A, bool pivot, DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int bsize = A.BlockWidth();
+    const Int cut = A.RowCut();
+    const Int localWidth = A.LocalWidth();
+    auto& ALoc = A.Matrix();
+    if( pivot )
+    {
+        P.SetGrid( A.Grid() );
+        P.MakeIdentity( m );
+        P.ReserveSwaps( minDim );
+    }
+
+    vector<Int> pivots;
+    vector<F> buffer;
+    Matrix<F> L1, U12;
+    for( Int k=0; k<minDim; )
+    {
+        const Int kEnd = block_cyclic::BlockEnd( k, bsize, cut, minDim );
+        const Int nb = kEnd - k;
+        const int ownerCol = A.ColOwner(k);
+        const Int jLoc0 = A.LocalColOffset(k);
+        const Int jLoc1 = A.LocalColOffset(kEnd);
+
+        // The owning process column factors the panel and then broadcasts the
+        // pivots (and whether the factorization succeeded) within process rows
+        bool succeeded = true;
+        if( A.RowRank() == ownerCol )
+            succeeded = BlockPanel( A, k, kEnd, pivot, pivots, buffer );
+        FastResize( pivots, nb+1 );
+        pivots[nb] = succeeded;
+        mpi::Broadcast( pivots.data(), nb+1, ownerCol, A.RowComm() );
+        if( !pivots[nb] )
+            throw SingularMatrixException();
+        if( pivot )
+        {
+            for( Int t=0; t<nb; ++t )
+            {
+                P.Swap( k+t, pivots[t] );
+                BlockSwapRows( A, k+t, pivots[t], 0, jLoc0, buffer );
+                BlockSwapRows( A, k+t, pivots[t], jLoc1, localWidth, buffer );
+            }
+        }
+
+        // L1[MC,* ] <- A(k:m-1,k:kEnd-1)
+        block_cyclic::BroadcastColPanel( A, k, m, k, kEnd, L1 );
+
+        // A12 := L11^-1 A12
+        const Int iLoc = A.LocalRowOffset(k);
+        if( A.ColRank() == A.RowOwner(k) )
+        {
+            auto A12Loc = ALoc( IR(iLoc,iLoc+nb), IR(jLoc1,END) );
+            Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L1(IR(0,nb),ALL), A12Loc );
+        }
+
+        // A22 := A22 - L21 U12
+        block_cyclic::BroadcastRowPanel( A, k, kEnd, kEnd, n, U12 );
+        const Int iLocEnd = A.LocalRowOffset(kEnd);
+        auto A22Loc = ALoc( IR(iLocEnd,END), IR(jLoc1,END) );
+        Gemm
+        ( NORMAL, NORMAL,
+          F(-1), L1(IR(iLocEnd-iLoc,END),ALL), U12, F(1), A22Loc );
+        k = kEnd;
+    }
+}
+
+template<typename F>
+void Block( DistMatrix<F,MC,MR,BLOCK>& A )
+{
+    EL_DEBUG_CSE
+    DistPermutation P( A.Grid() );
+    BlockHelper( A, false, P );
+}
+
+template<typename F>
+void Block( DistMatrix<F,MC,MR,BLOCK>& A, DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    BlockHelper( A, true, P );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_BLOCK_HPP
@@ -0,0 +1,128 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_LOOKAHEAD_HPP
+#define EL_LU_LOOKAHEAD_HPP
+
+namespace El {
+namespace lu {
+
+// A look-ahead variant of the right-looking partially-pivoted LU: the columns
+// of the next panel are updated first, their [MC,* ] redistribution is
+// started, and only then is the remainder of the trailing matrix updated, so
+// that the communication of the next panel is overlapped with the bulk of the
+// current update.
+template<typename F>
+void LookaheadBlocked
+( DistMatrix<F>& A, DistPermutation& P, LUPivotType pivotType )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,  MC,  STAR> A21_MC_STAR(g);
+    DistMatrix<F,  STAR,VR  > A12_STAR_VR(g);
+    DistMatrix<F,  STAR,MR  > A12_STAR_MR(g);
+
+    // The [MC,* ] copy of the next panel (including its diagonal block)
+    DistMatrix<F,  MC,  STAR> AB1Next_MC_STAR(g);
+    RedistFuture<F> future;
+    bool nextPending = false;
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    P.SetGrid( g );
+
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+
+    DistPermutation PB(g);
+
+    vector<F> panelBuf, pivotBuf;
+    const Int bsize = TunedBlocksize<F>("LU",minDim,g);
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+        const Int nbNext = Min(bsize,minDim-(k+nb));
+        const IR ind1( k, k+nb ), ind2( k+nb, END ), indB( k, END ),
+                 indN( 0, nbNext ), indR( nbNext, END ),
+                 ind2N( k+nb, k+nb+nbNext ), ind2R( k+nb+nbNext, END );
+
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        auto AB  = A( indB, ALL );
+
+        const Int A21Height = A21.Height();
+        const Int A21LocHeight = A21.LocalHeight();
+        const Int panelLDim = nb+A21LocHeight;
+        FastResize( panelBuf, panelLDim*nb );
+        A11_STAR_STAR.Attach
+        ( nb, nb, g, 0, 0, &panelBuf[0], panelLDim, 0 );
+        A21_MC_STAR.Attach
+        ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
+        if( nextPending )
+        {
+            // The panel was already updated by the previous iteration
+            future.Wait();
+            nextPending = false;
+            A11_STAR_STAR = AB1Next_MC_STAR( IR(0,nb), ALL );
+            A21_MC_STAR = AB1Next_MC_STAR( IR(nb,END), ALL );
+        }
+        else
+        {
+            A11_STAR_STAR = A11;
+            A21_MC_STAR = A21;
+        }
+        if( pivotType == LU_CALU )
+            TournamentPanel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        else
+            Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+
+        PB.PermuteRows( AB );
+
+        A12_STAR_VR.AlignWith( A22 );
+        A12_STAR_VR = A12;
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+
+        A12_STAR_MR.AlignWith( A22 );
+        A12_STAR_MR = A12_STAR_VR;
+        if( nbNext > 0 )
+        {
+            // Update the columns of the next panel
+            auto A12N_STAR_MR = A12_STAR_MR( ALL, indN );
+            auto A12R_STAR_MR = A12_STAR_MR( ALL, indR );
+            auto A22N = A( ind2, ind2N );
+            auto A22R = A( ind2, ind2R );
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12N_STAR_MR, F(1), A22N );
+
+            // Start redistributing the next panel and then update the rest
+            AB1Next_MC_STAR.AlignWith( A22N );
+            future = CopyAsync( A22N, AB1Next_MC_STAR );
+            nextPending = true;
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12R_STAR_MR, F(1), A22R );
+        }
+        else
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
+
+        A11 = A11_STAR_STAR;
+        A12 = A12_STAR_MR;
+        A21 = A21_MC_STAR;
+    }
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_LOOKAHEAD_HPP
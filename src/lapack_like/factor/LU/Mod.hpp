@@ -330,10 +330,12 @@ void RankOneMod
     for( Int i=minDim-2; i>=0; --i )
     {
         // Decide if we should pivot the i'th and i+1'th rows of w
-        const F lambdaSub = A.Get(i+1,i);
-        const F ups_ii = A.Get(i,i);
-        const F omega_i = w.Get( i, 0 );
-        const F omega_ip1 = w.Get( i+1, 0 );
+        const auto AValues = A.GetMany( {{i+1,i},{i,i}} );
+        const auto wValues = w.GetMany( {{i,0},{i+1,0}} );
+        const F lambdaSub = AValues[0];
+        const F ups_ii = AValues[1];
+        const F omega_i = wValues[0];
+        const F omega_ip1 = wValues[1];
         const Real rightTerm = Abs(lambdaSub*omega_i+omega_ip1);
         const bool pivot = ( Abs(omega_i) < tau*rightTerm );
 
@@ -450,8 +452,9 @@ void RankOneMod
     for( Int i=0; i<minDim-1; ++i )
     {
         // Decide if we should pivot the i'th and i+1'th rows U
-        const F lambdaSub = A.Get( i+1, i );
-        const F ups_ii = A.Get( i, i );
+        const auto AValues = A.GetMany( {{i+1,i},{i,i}} );
+        const F lambdaSub = AValues[0];
+        const F ups_ii = AValues[1];
         const F ups_ip1i = uSub.Get( i, 0 );
         const Real rightTerm = Abs(lambdaSub*ups_ii+ups_ip1i);
         const bool pivot = ( Abs(ups_ii) < tau*rightTerm );
@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_OUTOFCORE_HPP
+#define EL_LU_OUTOFCORE_HPP
+
+#include "../OutOfCore.hpp"
+
+namespace El {
+namespace lu {
+
+// Apply the row interchanges t <-> swapDests[t], for t in [tBeg,tEnd), to
+// the panel whose first row is row rowBeg of the full matrix. Since every
+// process owns entire columns of the panel, no communication is required.
+template<typename F>
+void ApplyPanelSwaps
+( const vector<Int>& swapDests, Int tBeg, Int tEnd, Int rowBeg,
+  DistMatrix<F,STAR,VR>& A )
+{
+    EL_DEBUG_CSE
+    auto& ALoc = A.Matrix();
+    for( Int t=tBeg; t<tEnd; ++t )
+        if( swapDests[t] != t )
+            RowSwap( ALoc, t-rowBeg, swapDests[t]-rowBeg );
+}
+
+} // namespace lu
+
+// Left-looking: for each column panel A(:,K), with K = [k,k+nb), the
+// previous row interchanges are applied and then, for every previously
+// factored panel J = [j,j+jb),
+//
+//   U(J,K) := inv(L(J,J)) A(J,K),
+//   A(j+jb:m-1,K) -= L(j+jb:m-1,J) U(J,K),
+//
+// before A(k:m-1,K) is factored in memory with partial pivoting. The
+// previous panels are stored without the row interchanges from later
+// panels, which are instead applied after each read, and a final pass
+// brings each of them up to date.
+template<typename F>
+void OutOfCoreLU
+( const Grid& g,
+  const string& filename,
+  DistPermutation& P,
+  const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Int m, n;
+    ooc::ReadHeader<F>( filename, m, n );
+    const Int minDim = Min(m,n);
+    const Int bsize = ooc::PanelWidth( ctrl, g );
+
+    vector<Int> swapDests( minDim );
+    DistMatrix<F,STAR,VR> A(g);
+    DistMatrix<F,STAR,VR> LBufs[2] = { DistMatrix<F,STAR,VR>(g),
+                                       DistMatrix<F,STAR,VR>(g) };
+    DistPermutation PPanel(g);
+    DistMatrix<Int,STAR,STAR> panelDests(g);
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int kPiv = Min(k,minDim);
+        if( ctrl.progress && g.Rank() == 0 )
+            Output("Panel ",k/bsize," of ",(n+bsize-1)/bsize);
+
+        A.Resize( m, nb );
+        auto readA =
+          ooc::ReadPanelAsync( filename, m, 0, k, A, ctrl.asyncRead );
+        std::future<void> readL;
+        if( kPiv > 0 )
+        {
+            LBufs[0].Resize( m, Min(bsize,kPiv) );
+            readL = ooc::ReadPanelAsync
+              ( filename, m, 0, 0, LBufs[0], ctrl.asyncRead );
+        }
+        readA.get();
+        lu::ApplyPanelSwaps( swapDests, 0, kPiv, 0, A );
+
+        for( Int j=0, t=0; j<kPiv; j+=bsize, t=1-t )
+        {
+            const Int jb = Min(bsize,kPiv-j);
+            readL.get();
+            const Int jNext = j+bsize;
+            if( jNext < kPiv )
+            {
+                LBufs[1-t].Resize( m-jNext, Min(bsize,kPiv-jNext) );
+                readL = ooc::ReadPanelAsync
+                  ( filename, m, jNext, jNext, LBufs[1-t], ctrl.asyncRead );
+            }
+
+            auto& L = LBufs[t];
+            lu::ApplyPanelSwaps( swapDests, j+jb, kPiv, j, L );
+            auto L11 = L( IR(0,jb), ALL );
+            auto L21 = L( IR(jb,END), ALL );
+            auto A1 = A( IR(j,j+jb), ALL );
+            auto A2 = A( IR(j+jb,END), ALL );
+            Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L11, A1 );
+            Gemm( NORMAL, NORMAL, F(-1), L21, A1, F(1), A2 );
+        }
+
+        if( k < minDim )
+        {
+            auto AB = A( IR(k,END), ALL );
+            LU( AB, PPanel );
+            panelDests = PPanel.SwapDestinations();
+            const Int numPiv = Min(nb,m-k);
+            for( Int t=0; t<numPiv; ++t )
+                swapDests[k+t] = k + panelDests.GetLocal(t,0);
+        }
+        ooc::WritePanel( filename, m, 0, k, A );
+        mpi::Barrier( g.Comm() );
+    }
+
+    // Apply the row interchanges from later panels to each of the panels of L
+    for( Int j=0; j+bsize<minDim; j+=bsize )
+    {
+        const Int jb = Min(bsize,minDim-j);
+        auto& L = LBufs[0];
+        L.Resize( m-j, jb );
+        ooc::ReadPanel( filename, m, j, j, L );
+        lu::ApplyPanelSwaps( swapDests, j+jb, minDim, j, L );
+        ooc::WritePanel( filename, m, j, j, L );
+    }
+    mpi::Barrier( g.Comm() );
+
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+    for( Int t=0; t<minDim; ++t )
+        P.Swap( t, swapDests[t] );
+}
+
+} // namespace El
+
+#endif // ifndef EL_LU_OUTOFCORE_HPP
@@ -74,6 +74,7 @@ void Panel
   vector<F>& pivotBuffer )
 {
     EL_DEBUG_CSE
+    EL_TRACE_REGION("Panel");
     typedef Base<F> Real;
     const Int n = A.Width();
     const Int BLocHeight = B.LocalHeight();
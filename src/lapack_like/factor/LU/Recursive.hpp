@@ -0,0 +1,96 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_RECURSIVE_HPP
+#define EL_LU_RECURSIVE_HPP
+
+namespace El {
+namespace lu {
+
+// Toledo's recursive LU with partial pivoting, intended for scalar types
+// without LAPACK support. The left half of the columns is factored
+// recursively, its row interchanges are applied to the right half, and,
+// after the Trsm and Gemm updates of the right half, the trailing matrix is
+// factored recursively and its interchanges are applied to the left half.
+// Row k was interchanged with row swapDests[k] for k < min(m,n).
+
+template<typename F>
+void RecursiveHelper( Matrix<F>& A, Int* swapDests, Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim <= cutoff )
+    {
+        F* ABuf = A.Buffer();
+        const Int ALDim = A.LDim();
+        for( Int k=0; k<minDim; ++k )
+        {
+            const Int iPiv = k + blas::MaxInd( m-k, &ABuf[k+k*ALDim], 1 );
+            swapDests[k] = iPiv;
+            if( iPiv != k )
+                blas::Swap( n, &ABuf[k], ALDim, &ABuf[iPiv], ALDim );
+
+            const F alpha = ABuf[k+k*ALDim];
+            if( alpha == F(0) )
+                throw SingularMatrixException();
+            blas::Scal( m-(k+1), F(1)/alpha, &ABuf[(k+1)+k*ALDim], 1 );
+            blas::Geru
+            ( m-(k+1), n-(k+1),
+              F(-1), &ABuf[(k+1)+k*ALDim], 1,
+                     &ABuf[k+(k+1)*ALDim], ALDim,
+                     &ABuf[(k+1)+(k+1)*ALDim], ALDim );
+        }
+        return;
+    }
+
+    const Int n1 = minDim/2;
+    const Range<Int> ind1( 0, n1 ), ind2( n1, END );
+    auto AL  = A( ALL,  ind1 );
+    auto AR  = A( ALL,  ind2 );
+    auto A11 = A( ind1, ind1 );
+    auto A12 = A( ind1, ind2 );
+    auto A21 = A( ind2, ind1 );
+    auto A22 = A( ind2, ind2 );
+
+    RecursiveHelper( AL, swapDests, cutoff );
+    for( Int k=0; k<n1; ++k )
+        if( swapDests[k] != k )
+            RowSwap( AR, k, swapDests[k] );
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
+    Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 );
+
+    RecursiveHelper( A22, &swapDests[n1], cutoff );
+    for( Int k=n1; k<minDim; ++k )
+    {
+        if( swapDests[k] != k-n1 )
+            RowSwap( A21, k-n1, swapDests[k] );
+        swapDests[k] += n1;
+    }
+}
+
+template<typename F>
+void Recursive( Matrix<F>& A, Permutation& P, Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int minDim = Min(m,A.Width());
+    vector<Int> swapDests( minDim );
+    RecursiveHelper( A, swapDests.data(), cutoff );
+
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+    for( Int k=0; k<minDim; ++k )
+        P.Swap( k, swapDests[k] );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_RECURSIVE_HPP
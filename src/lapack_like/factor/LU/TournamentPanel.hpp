@@ -0,0 +1,238 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_TOURNAMENTPANEL_HPP
+#define EL_LU_TOURNAMENTPANEL_HPP
+
+namespace El {
+namespace lu {
+
+// Select (up to) n pivot rows from the h x n candidate matrix C via partial
+// pivoting on a copy, returning the *original* values of the selected rows
+// (in pivot order) in the n x n matrix W along with their panel indices.
+// Candidates with a negative index are padding and are never selected.
+template<typename F>
+void SelectPivotRows
+( Int h, Int n,
+  const F* CBuf, Int CLDim, const Int* candInds,
+        F* WBuf, Int* winnerInds )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    Matrix<F> C( h, n );
+    for( Int j=0; j<n; ++j )
+        MemCopy( C.Buffer(0,j), &CBuf[j*CLDim], h );
+    vector<Int> perm( h );
+    for( Int i=0; i<h; ++i )
+        perm[i] = i;
+
+    Int numSelected = 0;
+    for( Int k=0; k<n && k<h; ++k )
+    {
+        // Find the largest (non-padding) candidate in column k
+        Int iPiv = -1;
+        Real maxAbs = -1;
+        for( Int i=k; i<h; ++i )
+        {
+            if( candInds[perm[i]] < 0 )
+                continue;
+            const Real alphaAbs = Abs(C(i,k));
+            if( alphaAbs > maxAbs )
+            {
+                maxAbs = alphaAbs;
+                iPiv = i;
+            }
+        }
+        if( iPiv < 0 )
+            break;
+        if( iPiv != k )
+        {
+            blas::Swap
+            ( n, C.Buffer(k,0), C.LDim(), C.Buffer(iPiv,0), C.LDim() );
+            std::swap( perm[k], perm[iPiv] );
+        }
+        ++numSelected;
+
+        // A zero pivot implies the panel is singular, which will be detected
+        // when the selected rows are factored
+        const F alpha = C(k,k);
+        if( alpha == F(0) )
+            continue;
+        blas::Scal( h-(k+1), F(1)/alpha, C.Buffer(k+1,k), 1 );
+        blas::Geru
+        ( h-(k+1), n-(k+1),
+          F(-1), C.LockedBuffer(k+1,k), 1, C.LockedBuffer(k,k+1), C.LDim(),
+                 C.Buffer(k+1,k+1), C.LDim() );
+    }
+
+    for( Int k=0; k<numSelected; ++k )
+    {
+        winnerInds[k] = candInds[perm[k]];
+        for( Int j=0; j<n; ++j )
+            WBuf[k+j*n] = CBuf[perm[k]+j*CLDim];
+    }
+    for( Int k=numSelected; k<n; ++k )
+    {
+        winnerInds[k] = -1;
+        for( Int j=0; j<n; ++j )
+            WBuf[k+j*n] = 0;
+    }
+}
+
+// Communication-avoiding (tournament) pivoting for the same stacked panel
+// layout as lu::Panel: rather than an AllReduce per column, each process
+// selects n candidate rows from its portion of the panel, and the candidates
+// are then played off pairwise up a binary tree over the process column
+// before the winners are broadcast, so that only O(log p) messages are
+// required per panel. The winning rows are then swapped into place and the
+// panel is factored without further pivoting.
+//
+// NOTE: Unlike lu::Panel, A[*,*] is assumed to be correct on every process.
+template<typename F>
+void TournamentPanel
+( DistMatrix<F,  STAR,STAR>& A,
+  DistMatrix<F,  MC,  STAR>& B,
+  DistPermutation& P,
+  DistPermutation& PB,
+  Int offset,
+  vector<F>& pivotBuffer )
+{
+    EL_DEBUG_CSE
+    EL_TRACE_REGION("TournamentPanel");
+    const Int n = A.Width();
+    const Int BLocHeight = B.LocalHeight();
+    F* ABuf = A.Buffer();
+    F* BBuf = B.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    mpi::Comm colComm = B.ColComm();
+    const int colRank = mpi::Rank( colComm );
+    const int colSize = mpi::Size( colComm );
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( n != B.Width() )
+          LogicError("A and B must be the same width");
+      if( A.Height() != n )
+          LogicError("A must be square");
+      if( A.Buffer()+n != B.Buffer() )
+          LogicError("Buffers of A and B did not properly align");
+    )
+
+    PB.MakeIdentity( A.Height()+B.Height() );
+    PB.ReserveSwaps( n );
+
+    // Form the local candidates: the rows of A (on the root only) followed
+    // by the local rows of B
+    const Int numLocalCands = ( colRank == 0 ? n : 0 ) + BLocHeight;
+    const Int candOff = ( colRank == 0 ? 0 : n );
+    const F* candBuf = &ABuf[candOff];
+    vector<Int> candInds( Max(numLocalCands,Int(1)) );
+    for( Int i=0; i<numLocalCands; ++i )
+    {
+        const Int iLoc = i + candOff;
+        candInds[i] = ( iLoc < n ? iLoc : B.GlobalRow(iLoc-n)+n );
+    }
+
+    // Play the leaf round
+    vector<F> winners(n*n), incoming(n*n), merged(2*n*n);
+    vector<Int> winnerInds(n), incomingInds(n), mergedInds(2*n);
+    SelectPivotRows
+    ( numLocalCands, n, candBuf, ALDim, candInds.data(),
+      winners.data(), winnerInds.data() );
+
+    // Play off the winners up a binary tree rooted at process 0
+    for( int step=1; step<colSize; step*=2 )
+    {
+        if( colRank % (2*step) == 0 )
+        {
+            const int partner = colRank + step;
+            if( partner >= colSize )
+                continue;
+            mpi::Recv( incoming.data(), n*n, partner, colComm );
+            mpi::Recv( incomingInds.data(), n, partner, colComm );
+            for( Int j=0; j<n; ++j )
+            {
+                MemCopy( &merged[j*2*n], &winners[j*n], n );
+                MemCopy( &merged[n+j*2*n], &incoming[j*n], n );
+            }
+            MemCopy( &mergedInds[0], winnerInds.data(), n );
+            MemCopy( &mergedInds[n], incomingInds.data(), n );
+            SelectPivotRows
+            ( 2*n, n, merged.data(), 2*n, mergedInds.data(),
+              winners.data(), winnerInds.data() );
+        }
+        else
+        {
+            const int partner = colRank - step;
+            mpi::Send( winners.data(), n*n, partner, colComm );
+            mpi::Send( winnerInds.data(), n, partner, colComm );
+            break;
+        }
+    }
+    mpi::Broadcast( winners.data(), n*n, 0, colComm );
+    mpi::Broadcast( winnerInds.data(), n, 0, colComm );
+
+    // Convert the winners into a sequence of swaps. Since each swap moves
+    // the current occupant of row k < n into the old position of the winner,
+    // every row displaced into B is an original row of A.
+    std::map<Int,Int> rowAt, posOf;
+    auto occupant = [&]( Int pos )
+    {
+        auto it = rowAt.find( pos );
+        return it == rowAt.end() ? pos : it->second;
+    };
+    auto position = [&]( Int row )
+    {
+        auto it = posOf.find( row );
+        return it == posOf.end() ? row : it->second;
+    };
+    for( Int k=0; k<n; ++k )
+    {
+        if( winnerInds[k] < 0 )
+            throw SingularMatrixException();
+        const Int iPiv = position( winnerInds[k] );
+        const Int displaced = occupant( k );
+        P.Swap( k+offset, iPiv+offset );
+        PB.Swap( k, iPiv );
+        rowAt[k] = winnerInds[k];
+        posOf[winnerInds[k]] = k;
+        rowAt[iPiv] = displaced;
+        posOf[displaced] = iPiv;
+    }
+
+    // Apply the swaps locally: the displaced rows of A which land in B are
+    // known to every process, and the new top rows are the winners
+    pivotBuffer.resize( n*n );
+    for( Int j=0; j<n; ++j )
+        MemCopy( &pivotBuffer[j*n], &ABuf[j*ALDim], n );
+    for( const auto& entry : rowAt )
+    {
+        const Int pos = entry.first;
+        if( pos < n || !B.IsLocalRow(pos-n) )
+            continue;
+        const Int iLoc = B.LocalRow(pos-n);
+        const Int origRow = entry.second;
+        EL_DEBUG_ONLY(
+          if( origRow >= n )
+              LogicError("Row displaced into B did not originate in A");
+        )
+        for( Int j=0; j<n; ++j )
+            BBuf[iLoc+j*BLDim] = pivotBuffer[origRow+j*n];
+    }
+    for( Int j=0; j<n; ++j )
+        MemCopy( &ABuf[j*ALDim], &winners[j*n], n );
+
+    // Factor the pivoted panel without further pivoting
+    Matrix<F> panel( n+BLocHeight, n, ABuf, ALDim );
+    Unb( panel );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TOURNAMENTPANEL_HPP
@@ -0,0 +1,112 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_OUTOFCORE_HPP
+#define EL_FACTOR_OUTOFCORE_HPP
+
+#include <future>
+
+namespace El {
+namespace ooc {
+
+// The out-of-core factorizations operate on a matrix stored in the BINARY
+// format of read::Binary and write::Binary, i.e., the height and width
+// followed by the column-major entries. The file must be visible to every
+// process, and each column panel is read into (and written from) a
+// [STAR,VR] distribution so that every process only touches contiguous
+// column segments of the file and row interchanges require no
+// communication.
+
+inline std::streamoff MetaBytes() { return 2*sizeof(Int); }
+
+template<typename T>
+void ReadHeader( const string& filename, Int& height, Int& width )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.read( (char*)&height, sizeof(Int) );
+    file.read( (char*)&width,  sizeof(Int) );
+    const Int numBytes = FileSize( file );
+    const Int numBytesExp = MetaBytes() + height*width*sizeof(T);
+    if( numBytes != numBytesExp )
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+}
+
+// Read the entries of the file (with the given height) in rows
+// [rowBeg,rowBeg+P.Height()) and columns [colBeg,colBeg+P.Width()) into P.
+// No communication is performed, so this may be run asynchronously.
+template<typename T>
+void ReadPanel
+( const string& filename, Int height, Int rowBeg, Int colBeg,
+  DistMatrix<T,STAR,VR>& P )
+{
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    const Int panelHeight = P.Height();
+    const Int localWidth = P.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = colBeg + P.GlobalCol(jLoc);
+        file.seekg( MetaBytes() + (rowBeg+j*height)*sizeof(T) );
+        file.read( (char*)P.Buffer(0,jLoc), panelHeight*sizeof(T) );
+    }
+    if( !file )
+        RuntimeError("Could not read panel from ",filename);
+}
+
+// Start reading a panel and return a future which completes the read. If
+// 'async' is false, the read is deferred until the future is waited on.
+// P must already have its final size and must not be accessed until then.
+template<typename T>
+std::future<void> ReadPanelAsync
+( const string& filename, Int height, Int rowBeg, Int colBeg,
+  DistMatrix<T,STAR,VR>& P, bool async )
+{
+    auto policy = ( async ? std::launch::async : std::launch::deferred );
+    return std::async
+    ( policy,
+      [=,&P]() { ReadPanel( filename, height, rowBeg, colBeg, P ); } );
+}
+
+template<typename T>
+void WritePanel
+( const string& filename, Int height, Int rowBeg, Int colBeg,
+  const DistMatrix<T,STAR,VR>& P )
+{
+    EL_DEBUG_CSE
+    std::fstream file
+    ( filename.c_str(), std::ios::in | std::ios::out | std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    const Int panelHeight = P.Height();
+    const Int localWidth = P.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = colBeg + P.GlobalCol(jLoc);
+        file.seekp( MetaBytes() + (rowBeg+j*height)*sizeof(T) );
+        file.write
+        ( (const char*)P.LockedBuffer(0,jLoc), panelHeight*sizeof(T) );
+    }
+    if( !file )
+        RuntimeError("Could not write panel to ",filename);
+}
+
+inline Int PanelWidth( const OutOfCoreCtrl& ctrl, const Grid& g )
+{
+    // By default, give each process one algorithmic block of columns
+    return ( ctrl.panelWidth > 0 ? ctrl.panelWidth : g.Size()*Blocksize() );
+}
+
+} // namespace ooc
+} // namespace El
+
+#endif // ifndef EL_FACTOR_OUTOFCORE_HPP
@@ -7,17 +7,22 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include <El/blas_like/level3/BlockCyclic.hpp>
 
 #include "./QR/ApplyQ.hpp"
 #include "./QR/BusingerGolub.hpp"
 #include "./QR/Cholesky.hpp"
+#include "./QR/RandomizedPivoting.hpp"
 #include "./QR/Householder.hpp"
+#include "./QR/Block.hpp"
 #include "./QR/SolveAfter.hpp"
 #include "./QR/Explicit.hpp"
 
 #include "./QR/ColSwap.hpp"
 
 #include "./QR/TS.hpp"
+#include "./QR/CA.hpp"
+#include "./QR/Updatable.hpp"
 
 namespace El {
 
@@ -72,6 +77,24 @@ void QR
   AbstractDistMatrix<Base<F>>& signature )
 {
     EL_DEBUG_CSE
+    EL_TRACE_REGION("QR");
+    if( block_cyclic::IsMCMRBlock(A) && block_cyclic::HasSquareBlocks(A) )
+    {
+        // Avoid redistributing block-cyclic matrices into [MC,MR]
+        DistMatrixWriteProxy<F,F,STAR,STAR>
+          householderScalarsProx( householderScalars );
+        DistMatrixWriteProxy<Base<F>,Base<F>,STAR,STAR>
+          signatureProx( signature );
+        auto& householderScalarsSTAR = householderScalarsProx.Get();
+        auto& signatureSTAR = signatureProx.Get();
+        const Int minDim = Min(A.Height(),A.Width());
+        householderScalarsSTAR.Resize( minDim, 1 );
+        signatureSTAR.Resize( minDim, 1 );
+        qr::Block
+        ( static_cast<DistMatrix<F,MC,MR,BLOCK>&>(A),
+          householderScalarsSTAR.Matrix(), signatureSTAR.Matrix() );
+        return;
+    }
     qr::Householder( A, householderScalars, signature );
 }
 
@@ -87,7 +110,10 @@ void QR
   const QRCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
-    qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
+    if( ctrl.randomized && !ctrl.smallestFirst )
+        qr::RandomizedPivoting( A, householderScalars, signature, Omega, ctrl );
+    else
+        qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
 }
 
 template<typename F>
@@ -99,7 +125,11 @@ void QR
   const QRCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
-    qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
+    EL_TRACE_REGION("QR");
+    if( ctrl.randomized && !ctrl.smallestFirst )
+        qr::RandomizedPivoting( A, householderScalars, signature, Omega, ctrl );
+    else
+        qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
 }
 
 #define PROTO(F) \
@@ -175,6 +205,22 @@ void QR
     const AbstractDistMatrix<F>& householderScalars, \
     const AbstractDistMatrix<Base<F>>& signature, \
           AbstractDistMatrix<F>& B ); \
+  template void qr::ApplyQ \
+  ( LeftOrRight side, \
+    Orientation orientation, \
+    const Matrix<F>& A, \
+    const Matrix<F>& householderScalars, \
+    const Matrix<Base<F>>& signature, \
+          Matrix<F>& B, \
+          PackedReflectorPanels<F>& panels ); \
+  template void qr::ApplyQ \
+  ( LeftOrRight side, \
+    Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const AbstractDistMatrix<Base<F>>& signature, \
+          AbstractDistMatrix<F>& B, \
+          DistPackedReflectorPanels<F>& panels ); \
   template void qr::SolveAfter \
   ( Orientation orientation, \
     const Matrix<F>& A, \
@@ -191,14 +237,23 @@ void QR
           AbstractDistMatrix<F>& X ); \
   template void qr::Cholesky \
   ( Matrix<F>& A, \
-    Matrix<F>& R ); \
+    Matrix<F>& R, \
+    const qr::CholeskyQRCtrl& ctrl ); \
   template void qr::Cholesky \
   ( AbstractDistMatrix<F>& A, \
-    AbstractDistMatrix<F>& R ); \
-  template qr::TreeData<F> qr::TS( const AbstractDistMatrix<F>& A ); \
+    AbstractDistMatrix<F>& R, \
+    const qr::CholeskyQRCtrl& ctrl ); \
+  template qr::TreeData<F> qr::TS \
+  ( const AbstractDistMatrix<F>& A, const qr::TSQRCtrl& ctrl ); \
   template void qr::ExplicitTS \
   ( AbstractDistMatrix<F>& A, \
-    AbstractDistMatrix<F>& R ); \
+    AbstractDistMatrix<F>& R, \
+    const qr::TSQRCtrl& ctrl ); \
+  template void qr::CA \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    AbstractDistMatrix<Base<F>>& signature, \
+    const qr::TSQRCtrl& ctrl ); \
   template Matrix<F>& qr::ts::RootQR \
   ( const AbstractDistMatrix<F>& A, TreeData<F>& treeData ); \
   template const Matrix<F>& qr::ts::RootQR \
@@ -206,7 +261,13 @@ void QR
   template void qr::ts::Reduce \
   ( const AbstractDistMatrix<F>& A, TreeData<F>& treeData ); \
   template void qr::ts::Scatter \
-  ( AbstractDistMatrix<F>& A, const TreeData<F>& treeData );
+  ( AbstractDistMatrix<F>& A, const TreeData<F>& treeData ); \
+  template void qr::ts::ApplyQ \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const TreeData<F>& treeData, \
+          AbstractDistMatrix<F>& B ); \
+  template class UpdatableQR<F>;
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -12,6 +12,29 @@
 namespace El {
 namespace qr {
 
+// Apply D, the diagonal matrix of signs, which multiplies the first minDim
+// rows (or columns) of the explicit Q
+template<class SignatureMatrix,class FMatrix>
+void ApplySignature
+( LeftOrRight side,
+  Orientation orientation,
+  Int minDim,
+  const SignatureMatrix& signature,
+        FMatrix& B )
+{
+    EL_DEBUG_CSE
+    if( side == LEFT )
+    {
+        auto BTop = B( IR(0,minDim), ALL );
+        DiagonalScale( side, orientation, signature, BTop );
+    }
+    else
+    {
+        auto BLeft = B( ALL, IR(0,minDim) );
+        DiagonalScale( side, orientation, signature, BLeft );
+    }
+}
+
 template<typename F>
 void ApplyQ
 ( LeftOrRight side,
@@ -19,7 +42,8 @@ void ApplyQ
   const Matrix<F>& A,
   const Matrix<F>& householderScalars,
   const Matrix<Base<F>>& signature,
-        Matrix<F>& B )
+        Matrix<F>& B,
+        PackedReflectorPanels<F>* panels )
 {
     EL_DEBUG_CSE
     const bool normal = (orientation==NORMAL);
@@ -30,40 +54,20 @@ void ApplyQ
     const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
     const Conjugation conjugation =  ( normal ? CONJUGATED : UNCONJUGATED );
 
-    const Int m = B.Height();
-    const Int n = B.Width();
-
     if( applyDFirst )
-    {
-        if( onLeft )
-        {
-            auto BTop = B( IR(0,minDim), IR(0,n) );
-            DiagonalScale( side, orientation, signature, BTop );
-        }
-        else
-        {
-            auto BLeft = B( IR(0,m), IR(0,minDim) );
-            DiagonalScale( side, orientation, signature, BLeft );
-        }
-    }
+        ApplySignature( side, orientation, minDim, signature, B );
 
-    ApplyPackedReflectors
-    ( side, LOWER, VERTICAL, direction, conjugation, 0,
-      A, householderScalars, B );
+    if( panels == nullptr )
+        ApplyPackedReflectors
+        ( side, LOWER, VERTICAL, direction, conjugation, 0,
+          A, householderScalars, B );
+    else
+        ApplyPackedReflectors
+        ( side, LOWER, VERTICAL, direction, conjugation, 0,
+          A, householderScalars, B, *panels );
 
     if( !applyDFirst )
-    {
-        if( onLeft )
-        {
-            auto BTop = B( IR(0,minDim), IR(0,n) );
-            DiagonalScale( side, orientation, signature, BTop );
-        }
-        else
-        {
-            auto BLeft = B( IR(0,m), IR(0,minDim) );
-            DiagonalScale( side, orientation, signature, BLeft );
-        }
-    }
+        ApplySignature( side, orientation, minDim, signature, B );
 }
 
 template<typename F>
@@ -73,7 +77,8 @@ void ApplyQ
   const AbstractDistMatrix<F>& APre,
   const AbstractDistMatrix<F>& householderScalars,
   const AbstractDistMatrix<Base<F>>& signature,
-        AbstractDistMatrix<F>& BPre )
+        AbstractDistMatrix<F>& BPre,
+        DistPackedReflectorPanels<F>* panels )
 {
     EL_DEBUG_CSE
     const bool normal = (orientation==NORMAL);
@@ -89,40 +94,78 @@ void ApplyQ
     auto& A = AProx.GetLocked();
     auto& B = BProx.Get();
 
-    const Int m = B.Height();
-    const Int n = B.Width();
-
     if( applyDFirst )
-    {
-        if( onLeft )
-        {
-            auto BTop = B( IR(0,minDim), IR(0,n) );
-            DiagonalScale( side, orientation, signature, BTop );
-        }
-        else
-        {
-            auto BLeft = B( IR(0,m), IR(0,minDim) );
-            DiagonalScale( side, orientation, signature, BLeft );
-        }
-    }
+        ApplySignature( side, orientation, minDim, signature, B );
 
-    ApplyPackedReflectors
-    ( side, LOWER, VERTICAL, direction, conjugation, 0,
-      A, householderScalars, B );
+    if( panels == nullptr )
+        ApplyPackedReflectors
+        ( side, LOWER, VERTICAL, direction, conjugation, 0,
+          A, householderScalars, B );
+    else
+        ApplyPackedReflectors
+        ( side, LOWER, VERTICAL, direction, conjugation, 0,
+          A, householderScalars, B, *panels );
 
     if( !applyDFirst )
-    {
-        if( onLeft )
-        {
-            auto BTop = B( IR(0,minDim), IR(0,n) );
-            DiagonalScale( side, orientation, signature, BTop );
-        }
-        else
-        {
-            auto BLeft = B( IR(0,m), IR(0,minDim) );
-            DiagonalScale( side, orientation, signature, BLeft );
-        }
-    }
+        ApplySignature( side, orientation, minDim, signature, B );
+}
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& householderScalars,
+  const Matrix<Base<F>>& signature,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    ApplyQ
+    ( side, orientation, A, householderScalars, signature, B,
+      (PackedReflectorPanels<F>*)nullptr );
+}
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const AbstractDistMatrix<Base<F>>& signature,
+        AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    ApplyQ
+    ( side, orientation, A, householderScalars, signature, B,
+      (DistPackedReflectorPanels<F>*)nullptr );
+}
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& householderScalars,
+  const Matrix<Base<F>>& signature,
+        Matrix<F>& B,
+        PackedReflectorPanels<F>& panels )
+{
+    EL_DEBUG_CSE
+    ApplyQ( side, orientation, A, householderScalars, signature, B, &panels );
+}
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const AbstractDistMatrix<Base<F>>& signature,
+        AbstractDistMatrix<F>& B,
+        DistPackedReflectorPanels<F>& panels )
+{
+    EL_DEBUG_CSE
+    ApplyQ( side, orientation, A, householderScalars, signature, B, &panels );
 }
 
 } // namespace qr
@@ -0,0 +1,238 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_BLOCK_HPP
+#define EL_QR_BLOCK_HPP
+
+namespace El {
+namespace qr {
+
+// The analogue of reflector::Col for a column vector x whose local entries
+// are stored contiguously and which is distributed over colComm
+template<typename F>
+F BlockReflector( F& chi, Int xLocHeight, F* xBuf, mpi::Comm colComm )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const int colStride = mpi::Size( colComm );
+    vector<Real> localNorms(colStride);
+    Real localNorm = blas::Nrm2( xLocHeight, xBuf, 1 );
+    mpi::AllGather( &localNorm, 1, localNorms.data(), 1, colComm );
+    Real norm = blas::Nrm2( colStride, localNorms.data(), 1 );
+
+    F alpha = chi;
+    if( norm == Real(0) && ImagPart(alpha) == Real(0) )
+    {
+        chi = -chi;
+        return F(2);
+    }
+
+    Real beta;
+    if( RealPart(alpha) <= 0 )
+        beta = SafeNorm( alpha, norm );
+    else
+        beta = -SafeNorm( alpha, norm );
+
+    // Rescale if the vector is too small
+    const Real safeMin = limits::SafeMin<Real>();
+    const Real epsilon = limits::Epsilon<Real>();
+    const Real safeInv = safeMin/epsilon;
+    Int count = 0;
+    if( Abs(beta) < safeInv )
+    {
+        Real invOfSafeInv = Real(1)/safeInv;
+        do
+        {
+            ++count;
+            blas::Scal( xLocHeight, F(invOfSafeInv), xBuf, 1 );
+            alpha *= invOfSafeInv;
+            beta *= invOfSafeInv;
+        } while( Abs(beta) < safeInv );
+
+        localNorm = blas::Nrm2( xLocHeight, xBuf, 1 );
+        mpi::AllGather( &localNorm, 1, localNorms.data(), 1, colComm );
+        norm = blas::Nrm2( colStride, localNorms.data(), 1 );
+        if( RealPart(alpha) <= 0 )
+            beta = SafeNorm( alpha, norm );
+        else
+            beta = -SafeNorm( alpha, norm );
+    }
+
+    F tau = (beta-Conj(alpha)) / beta;
+    blas::Scal( xLocHeight, F(1)/(alpha-beta), xBuf, 1 );
+
+    // Undo the scaling
+    for( Int j=0; j<count; ++j )
+        beta *= safeInv;
+
+    chi = beta;
+    return tau;
+}
+
+// The analogue of PanelHouseholder for the panel A(k:m-1,k:kEnd-1), which
+// lies within a single process column. Only the owning process column should
+// call this routine.
+template<typename F>
+void BlockPanel
+( DistMatrix<F,MC,MR,BLOCK>& A,
+  Int k, Int kEnd,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature )
+{
+    EL_DEBUG_CSE
+    EL_TRACE_REGION("Panel");
+    typedef Base<F> Real;
+    const Int nb = kEnd - k;
+    const Int jLoc0 = A.LocalColOffset(k);
+    const Int localHeight = A.LocalHeight();
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    mpi::Comm colComm = A.ColComm();
+    const int colRank = A.ColRank();
+
+    vector<F> z;
+    for( Int t=0; t<nb; ++t )
+    {
+        const Int j = k + t;
+        const Int jLoc = jLoc0 + t;
+        const Int iLoc = A.LocalRowOffset(j);
+        const Int iLocBelow = A.LocalRowOffset(j+1);
+        const int ownerRow = A.RowOwner(j);
+        const bool inOwnerRow = ( colRank == ownerRow );
+
+        // Find tau and u such that
+        //  / I - tau | 1 | | 1, u^H | \ | alpha11 | = | beta |
+        //  \         | u |            / |     a21 | = |    0 |
+        F alpha = 0;
+        if( inOwnerRow )
+            alpha = ABuf[iLoc+jLoc*ALDim];
+        mpi::Broadcast( alpha, ownerRow, colComm );
+        const F tau =
+          BlockReflector
+          ( alpha, localHeight-iLocBelow, &ABuf[iLocBelow+jLoc*ALDim],
+            colComm );
+        householderScalars(t) = tau;
+        signature(t) = ( RealPart(alpha) >= Real(0) ? Real(1) : Real(-1) );
+
+        // AB2 := Hous(aB1,tau) AB2
+        //      = AB2 - tau aB1 (AB2^H aB1)^H,
+        // where aB1 is temporarily set to | 1 |
+        //                                 | u |
+        if( inOwnerRow )
+            ABuf[iLoc+jLoc*ALDim] = F(1);
+        const Int BLocHeight = localHeight - iLoc;
+        const Int width = nb - t - 1;
+        z.assign( width, F(0) );
+        if( BLocHeight > 0 && width > 0 )
+            blas::Gemv
+            ( 'C', BLocHeight, width,
+              F(1), &ABuf[iLoc+(jLoc+1)*ALDim], ALDim,
+                    &ABuf[iLoc+jLoc*ALDim], 1,
+              F(0), z.data(), 1 );
+        mpi::AllReduce( z.data(), width, colComm );
+        if( BLocHeight > 0 && width > 0 )
+            blas::Ger
+            ( BLocHeight, width,
+              -tau, &ABuf[iLoc+jLoc*ALDim], 1, z.data(), 1,
+                    &ABuf[iLoc+(jLoc+1)*ALDim], ALDim );
+        if( inOwnerRow )
+            ABuf[iLoc+jLoc*ALDim] = alpha;
+    }
+
+    // Rescale R so that its diagonal is non-negative
+    if( colRank == A.RowOwner(k) )
+    {
+        const Int iLoc = A.LocalRowOffset(k);
+        for( Int t=0; t<nb; ++t )
+            for( Int s=t; s<nb; ++s )
+                ABuf[(iLoc+t)+(jLoc0+s)*ALDim] *= signature(t);
+    }
+}
+
+// Householder QR factorization of an [MC,MR,BLOCK] matrix whose diagonal
+// blocks are distribution blocks (as in PDGEQRF). Each panel is factored
+// within its owning process column, and the resulting block reflector is
+// applied to the trailing matrix in its compact WY form using the panel
+// broadcast within process rows. The Householder scalars and signature are
+// returned redundantly on every process.
+template<typename F>
+void Block
+( DistMatrix<F,MC,MR,BLOCK>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int bsize = A.BlockWidth();
+    const Int cut = A.RowCut();
+    auto& ALoc = A.Matrix();
+    Zeros( householderScalars, minDim, 1 );
+    Zeros( signature, minDim, 1 );
+
+    Matrix<F> V, SInv, Z;
+    for( Int k=0; k<minDim; )
+    {
+        const Int kEnd = block_cyclic::BlockEnd( k, bsize, cut, minDim );
+        const Int nb = kEnd - k;
+        const int ownerCol = A.ColOwner(k);
+        const Int jLoc1 = A.LocalColOffset(kEnd);
+
+        auto householderScalars1 = householderScalars( IR(k,kEnd), ALL );
+        auto sig1 = signature( IR(k,kEnd), ALL );
+        if( A.RowRank() == ownerCol )
+            BlockPanel( A, k, kEnd, householderScalars1, sig1 );
+        mpi::Broadcast
+        ( householderScalars1.Buffer(), nb, ownerCol, A.RowComm() );
+        mpi::Broadcast( sig1.Buffer(), nb, ownerCol, A.RowComm() );
+        if( kEnd == n )
+            break;
+
+        // V[MC,* ] <- the unit lower-trapezoidal Householder vectors
+        block_cyclic::BroadcastColPanel( A, k, m, k, kEnd, V );
+        const Int iLoc = A.LocalRowOffset(k);
+        const bool inOwnerRow = ( A.ColRank() == A.RowOwner(k) );
+        if( inOwnerRow )
+        {
+            auto V1 = V( IR(0,nb), ALL );
+            MakeTrapezoidal( LOWER, V1 );
+            FillDiagonal( V1, F(1) );
+        }
+
+        // Form the small triangular matrix needed for the UT transform
+        SInv.Resize( nb, nb, nb );
+        Zero( SInv );
+        Herk( LOWER, ADJOINT, Base<F>(1), V, Base<F>(0), SInv );
+        mpi::AllReduce( SInv.Buffer(), nb*nb, A.ColComm() );
+        for( Int t=0; t<nb; ++t )
+            SInv(t,t) = F(1) / householderScalars1(t);
+
+        // AB2 := (I - V inv(SInv) V^H) AB2
+        auto AB2Loc = ALoc( IR(iLoc,END), IR(jLoc1,END) );
+        Z.Resize( nb, AB2Loc.Width(), nb );
+        Zero( Z );
+        Gemm( ADJOINT, NORMAL, F(1), V, AB2Loc, F(0), Z );
+        mpi::AllReduce( Z.Buffer(), Z.Height()*Z.Width(), A.ColComm() );
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv, Z );
+        Gemm( NORMAL, NORMAL, F(-1), V, Z, F(1), AB2Loc );
+
+        // Apply the signature to the trailing portion of the rows of R
+        if( inOwnerRow )
+        {
+            auto R12Loc = ALoc( IR(iLoc,iLoc+nb), IR(jLoc1,END) );
+            DiagonalScale( LEFT, NORMAL, sig1, R12Loc );
+        }
+        k = kEnd;
+    }
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_BLOCK_HPP
@@ -0,0 +1,132 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_CA_HPP
+#define EL_QR_CA_HPP
+
+#include "./PanelHouseholder.hpp"
+#include "./TS.hpp"
+
+namespace El {
+namespace qr {
+
+// Factor the panel A with TSQR and then reconstruct its Householder vectors
+// from the explicit tall-skinny Q (following Ballard et al.'s "Reconstructing
+// Householder vectors from tall-skinny QR"), so that the result has the same
+// format as PanelHouseholder. If Q = [Q1; Q2] with Q1 square and S is the
+// diagonal matrix with S(j,j) = -sgn(real(Q1(j,j))), then the unpivoted LU
+// factorization
+//
+//   | Q1 - S | = | Y1 | U
+//   |   Q2   |   | Y2 |
+//
+// is stable, and Y holds the Householder vectors of the reflectors whose
+// product, scaled on the right by S, begins with the columns of Q.
+template<typename F>
+void TSPanel
+( DistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  AbstractDistMatrix<Base<F>>& signature,
+  const TSQRCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < g.Size()*n )
+    {
+        // The panel is too short for every process to hold a square block
+        PanelHouseholder( A, householderScalars, signature );
+        return;
+    }
+
+    DistMatrix<F,VC,STAR> Q_VC_STAR( A );
+    DistMatrix<F,STAR,STAR> R(g);
+    {
+        auto treeData = TS( Q_VC_STAR, ctrl );
+        R = ts::FormR( Q_VC_STAR, treeData );
+        ts::FormQ( Q_VC_STAR, treeData );
+    }
+
+    auto Q1 = Q_VC_STAR( IR(0,n), ALL );
+    auto Q2 = Q_VC_STAR( IR(n,END), ALL );
+    DistMatrix<F,STAR,STAR> Q1_STAR_STAR( Q1 );
+    Matrix<F>& Y1 = Q1_STAR_STAR.Matrix();
+    Matrix<Real> sgn( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        sgn(j) = ( RealPart(Y1(j,j)) >= Real(0) ? Real(-1) : Real(1) );
+        Y1(j,j) -= sgn(j);
+    }
+    LU( Y1 );
+    LocalTrsm
+    ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), Q1_STAR_STAR, Q2 );
+
+    // Since A = (Q S) (S R), and the diagonal of R is non-negative, S is the
+    // signature and R is left unchanged
+    for( Int j=0; j<n; ++j )
+    {
+        householderScalars.Set( j, 0, -sgn(j)*Conj(Y1(j,j)) );
+        signature.Set( j, 0, sgn(j) );
+    }
+
+    // Overwrite the upper triangle of the unit lower factor with R
+    const Matrix<F>& RLoc = R.LockedMatrix();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<=j; ++i )
+            Y1(i,j) = RLoc(i,j);
+    Q1 = Q1_STAR_STAR;
+    A = Q_VC_STAR;
+}
+
+template<typename F>
+void CA
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  AbstractDistMatrix<Base<F>>& signaturePre,
+  const TSQRCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre, signaturePre ))
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Int minDim = Min(m,n);
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MD,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<Base<F>,Base<F>,MD,STAR> signatureProx( signaturePre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+
+    const Int bsize = TunedBlocksize<F>("QR",minDim,A.Grid());
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+        const Range<Int> ind1( k,    k+nb ),
+                         indB( k,    END  ),
+                         ind2( k+nb, END  );
+
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        auto sig1 = signature( ind1, ALL );
+
+        TSPanel( AB1, householderScalars1, sig1, ctrl );
+        ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
+    }
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_CA_HPP
@@ -12,26 +12,127 @@
 namespace El {
 namespace qr {
 
-// NOTE: This version is designed for tall-skinny matrices and is much less
-//       numerically stable than Householder-based QR factorizations
+namespace cholesky {
+
+template<typename F>
+void AccumulateGram( const Matrix<F>& A, Matrix<F>& G )
+{
+    EL_DEBUG_CSE
+    Herk( UPPER, ADJOINT, Base<F>(1), A, Base<F>(1), G );
+}
+
+// Accumulate the Gram matrix in a higher precision, one block of rows at a
+// time so that only a small portion of A is ever promoted
+template<typename F,typename FGram>
+void AccumulateGram( const Matrix<F>& A, Matrix<FGram>& G )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int bsize = Max( Blocksize(), n );
+    Matrix<FGram> AChunk;
+    for( Int i=0; i<m; i+=bsize )
+    {
+        const Int mb = Min(bsize,m-i);
+        Copy( A( IR(i,i+mb), ALL ), AChunk );
+        Herk( UPPER, ADJOINT, Base<FGram>(1), AChunk, Base<FGram>(1), G );
+    }
+}
+
+// Return the upper-triangular Cholesky factor of A^H A + shift I, where the
+// contributions of each process in 'comm' are summed and both the Gram matrix
+// and its factorization are formed in the precision of FGram
+template<typename FGram,typename F>
+void GramFactor
+( const Matrix<F>& A, Base<F> shift, Matrix<F>& R, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<FGram> RealGram;
+    const Int n = A.Width();
+    Matrix<FGram> G;
+    Zeros( G, n, n );
+    AccumulateGram( A, G );
+    if( mpi::Size(comm) > 1 )
+        mpi::AllReduce( G.Buffer(), n*n, comm );
+    if( shift != Base<F>(0) )
+        for( Int j=0; j<n; ++j )
+            G(j,j) += RealGram(shift);
+    El::Cholesky( UPPER, G );
+    MakeTrapezoidal( UPPER, G );
+    Copy( G, R );
+}
+
+template<typename F>
+void Passes
+( Matrix<F>& A, Matrix<F>& R,
+  Int m, Base<F> frobNorm, mpi::Comm comm, const CholeskyQRCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Width();
+
+    Int numPasses = 1;
+    Real shift = 0;
+    if( ctrl.variant == CHOLESKY_QR2 )
+    {
+        numPasses = 2;
+    }
+    else if( ctrl.variant == SHIFTED_CHOLESKY_QR3 )
+    {
+        // The shift of Fukaya et al., with the two-norm of A bounded by its
+        // Frobenius norm
+        numPasses = 3;
+        const Real eps = limits::Epsilon<Real>();
+        shift = 11*(Real(m)*n + Real(n)*(n+1))*eps*frobNorm*frobNorm;
+    }
+
+    Matrix<F> RPass;
+    for( Int pass=0; pass<numPasses; ++pass )
+    {
+        const Real passShift = ( pass == 0 ? shift : Real(0) );
+        if( ctrl.promoteGram )
+            GramFactor<Promote<F>>( A, passShift, RPass, comm );
+        else
+            GramFactor<F>( A, passShift, RPass, comm );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), RPass, A );
+        if( pass == 0 )
+            R = RPass;
+        else
+            Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), RPass, R );
+    }
+}
+
+} // namespace cholesky
+
+// NOTE: One-pass Cholesky QR is designed for tall-skinny matrices and is much
+//       less numerically stable than Householder-based QR factorizations,
+//       as the orthogonality of Q degrades with the square of the condition
+//       number of A. CholeskyQR2 repeats the process once on the computed Q,
+//       which restores orthogonality to the level of machine precision for
+//       condition numbers up to about 1/sqrt(eps), and shifted CholeskyQR3
+//       precedes CholeskyQR2 with a shifted pass which extends this to
+//       numerically full-rank A.
 //
 // Computes the QR factorization of full-rank tall-skinny matrix A and
 // overwrites A with Q
 //
 
 template<typename F>
-void Cholesky( Matrix<F>& A, Matrix<F>& R )
+void Cholesky( Matrix<F>& A, Matrix<F>& R, const CholeskyQRCtrl& ctrl )
 {
     EL_DEBUG_CSE
     if( A.Height() < A.Width() )
         LogicError("A^H A will be singular");
-    Herk( UPPER, ADJOINT, Base<F>(1), A, R );
-    El::Cholesky( UPPER, R );
-    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, A );
+    const Base<F> frobNorm =
+      ( ctrl.variant == SHIFTED_CHOLESKY_QR3 ? FrobeniusNorm(A) : Base<F>(0) );
+    cholesky::Passes( A, R, A.Height(), frobNorm, mpi::COMM_SELF, ctrl );
 }
 
 template<typename F>
-void Cholesky( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
+void Cholesky
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& RPre,
+  const CholeskyQRCtrl& ctrl )
 {
     EL_DEBUG_CSE
     const Int m = APre.Height();
@@ -44,11 +145,11 @@ void Cholesky( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
     auto& A = AProx.Get();
     auto& R = RProx.Get();
 
-    Zeros( R, n, n );
-    Herk( UPPER, ADJOINT, Base<F>(1), A.Matrix(), Base<F>(0), R.Matrix() );
-    El::AllReduce( R, A.ColComm() );
-    El::Cholesky( UPPER, R.Matrix() );
-    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R.Matrix(), A.Matrix() );
+    const Base<F> frobNorm =
+      ( ctrl.variant == SHIFTED_CHOLESKY_QR3 ? FrobeniusNorm(A) : Base<F>(0) );
+    R.Resize( n, n );
+    cholesky::Passes
+    ( A.Matrix(), R.Matrix(), m, frobNorm, A.ColComm(), ctrl );
 }
 
 } // namespace qr
@@ -0,0 +1,258 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_RANDOMIZEDPIVOTING_HPP
+#define EL_QR_RANDOMIZEDPIVOTING_HPP
+
+#include "./ApplyQ.hpp"
+#include "./BusingerGolub.hpp"
+#include "./PanelHouseholder.hpp"
+
+namespace El {
+namespace qr {
+
+// Randomized blocked column pivoting in the spirit of Martinsson et al.'s
+// HQRRP: each block of pivots is chosen by running Businger-Golub on a small
+// Gaussian sketch Y = G A of the remaining columns, the chosen columns are
+// swapped into place, and the panel is then factored with (unpivoted)
+// blocked Householder. Rather than resketching, if
+//
+//   A [P1, P2] = Q | R11 R12 |,  then  Y2 - Y1 inv(R11) R12 = (G Q)_2 A22,
+//                  |   0 A22 |
+//
+// which is a sketch of the trailing matrix by the Gaussian matrix (G Q)_2.
+// The sketch is replicated on every process, so the pivot selection
+// requires no communication.
+//
+// NOTE: ctrl.smallestFirst and ctrl.alwaysRecomputeNorms are not supported,
+//       and the adaptive rank is determined from the diagonal of R once
+//       each panel has been factored.
+
+namespace rand_piv {
+
+// Select a block of numPivots columns from the sketch Y and return the
+// corresponding (local) swap destinations
+template<typename F>
+void SelectPivots( Matrix<F>& Y, Int numPivots, Matrix<Int>& swapDests )
+{
+    EL_DEBUG_CSE
+    Matrix<F> YCopy( Y ), householderScalars;
+    Matrix<Base<F>> signature;
+    Permutation P;
+    QRCtrl<Base<F>> ctrl;
+    ctrl.boundRank = true;
+    ctrl.maxRank = numPivots;
+    BusingerGolub( YCopy, householderScalars, signature, P, ctrl );
+    swapDests = P.SwapDestinations();
+    P.PermuteCols( Y );
+}
+
+// Y2 := Y2 - Y1 inv(R11) R12
+template<typename F>
+void Downdate
+( Matrix<F>& Y, const Matrix<F>& R1, Int nb )
+{
+    EL_DEBUG_CSE
+    auto Y1 = Y( ALL, IR(0,nb) );
+    auto Y2 = Y( ALL, IR(nb,END) );
+    auto R11 = R1( ALL, IR(0,nb) );
+    auto R12 = R1( ALL, IR(nb,END) );
+    Matrix<F> W( Y1 );
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R11, W );
+    Gemm( NORMAL, NORMAL, F(-1), W, R12, F(1), Y2 );
+}
+
+// Return the number of leading diagonal entries of R11 which are above the
+// adaptive threshold
+template<typename F>
+Int NumAboveTol( const Matrix<F>& R1, Int nb, Base<F> tol )
+{
+    for( Int j=0; j<nb; ++j )
+        if( Abs(R1(j,j)) <= tol )
+            return j;
+    return nb;
+}
+
+} // namespace rand_piv
+
+template<typename F>
+void RandomizedPivoting
+(       Matrix<F>& A,
+        Matrix<F>& householderScalars,
+        Matrix<Base<F>>& signature,
+        Permutation& Omega,
+  const QRCtrl<Base<F>> ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int maxSteps = ( ctrl.boundRank ? Min(ctrl.maxRank,minDim) : minDim );
+    householderScalars.Resize( maxSteps, 1 );
+    signature.Resize( maxSteps, 1 );
+
+    Real adaptiveTol = 0;
+    if( ctrl.adaptive )
+    {
+        vector<Real> norms;
+        adaptiveTol = ctrl.tol*ColNorms( A, norms );
+    }
+
+    Omega.MakeIdentity( n );
+    Omega.ReserveSwaps( n );
+
+    const Int bsize = Blocksize();
+    Matrix<F> G, Y;
+    Gaussian( G, bsize+ctrl.oversampling, m );
+    Gemm( NORMAL, NORMAL, F(1), G, A, Y );
+
+    Matrix<Int> swapDests;
+    Int k=0;
+    while( k < maxSteps )
+    {
+        const Int nb = Min(bsize,maxSteps-k);
+        const Range<Int> ind1( k, k+nb ), indB( k, END ), ind2( k+nb, END );
+
+        // Choose the next block of pivots from the sketch
+        auto YR = Y( ALL, indB );
+        rand_piv::SelectPivots( YR, nb, swapDests );
+        auto AR = A( ALL, indB );
+        for( Int t=0; t<nb; ++t )
+        {
+            const Int dest = swapDests(t);
+            Omega.Swap( k+t, k+dest );
+            if( dest != t )
+                ColSwap( AR, t, dest );
+        }
+
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        auto sig1 = signature( ind1, ALL );
+        PanelHouseholder( AB1, householderScalars1, sig1 );
+        ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
+
+        auto R1 = A( ind1, indB );
+        if( ctrl.adaptive )
+        {
+            const Int numKept = rand_piv::NumAboveTol( R1, nb, adaptiveTol );
+            if( numKept < nb )
+            {
+                k += numKept;
+                break;
+            }
+        }
+        rand_piv::Downdate( YR, R1, nb );
+        k += nb;
+    }
+    householderScalars.Resize( k, 1 );
+    signature.Resize( k, 1 );
+}
+
+template<typename F>
+void RandomizedPivoting
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  AbstractDistMatrix<Base<F>>& signaturePre,
+  DistPermutation& Omega,
+  const QRCtrl<Base<F>> ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre, signaturePre ))
+    typedef Base<F> Real;
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MD,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<Base<F>,Base<F>,MD,STAR> signatureProx( signaturePre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+    const Grid& g = A.Grid();
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int maxSteps = ( ctrl.boundRank ? Min(ctrl.maxRank,minDim) : minDim );
+    householderScalars.Resize( maxSteps, 1 );
+    signature.Resize( maxSteps, 1 );
+
+    Real adaptiveTol = 0;
+    if( ctrl.adaptive )
+    {
+        vector<Real> norms;
+        adaptiveTol = ctrl.tol*ColNorms( A, norms );
+    }
+
+    Omega.MakeIdentity( n );
+    Omega.ReserveSwaps( n );
+
+    // Form the sketch and replicate it
+    const Int bsize = TunedBlocksize<F>("QR",minDim,g);
+    DistMatrix<F,STAR,STAR> Y_STAR_STAR(g);
+    {
+        DistMatrix<F> G(g), Y(g);
+        Gaussian( G, bsize+ctrl.oversampling, m );
+        Gemm( NORMAL, NORMAL, F(1), G, A, Y );
+        Y_STAR_STAR = Y;
+    }
+    auto& Y = Y_STAR_STAR.Matrix();
+
+    DistMatrix<F,STAR,STAR> R1_STAR_STAR(g);
+    DistPermutation PB(g);
+    Matrix<Int> swapDests;
+    Int k=0;
+    while( k < maxSteps )
+    {
+        const Int nb = Min(bsize,maxSteps-k);
+        const Range<Int> ind1( k, k+nb ), indB( k, END ), ind2( k+nb, END );
+
+        // Choose the next block of pivots from the sketch (redundantly on
+        // every process) and apply them to the columns of A
+        auto YR = Y( ALL, indB );
+        rand_piv::SelectPivots( YR, nb, swapDests );
+        PB.MakeIdentity( n-k );
+        PB.ReserveSwaps( nb );
+        for( Int t=0; t<nb; ++t )
+        {
+            Omega.Swap( k+t, k+swapDests(t) );
+            PB.Swap( t, swapDests(t) );
+        }
+        auto AR = A( ALL, indB );
+        PB.PermuteCols( AR );
+
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        auto sig1 = signature( ind1, ALL );
+        PanelHouseholder( AB1, householderScalars1, sig1 );
+        ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
+
+        R1_STAR_STAR = A( ind1, indB );
+        const auto& R1 = R1_STAR_STAR.LockedMatrix();
+        if( ctrl.adaptive )
+        {
+            const Int numKept = rand_piv::NumAboveTol( R1, nb, adaptiveTol );
+            if( numKept < nb )
+            {
+                k += numKept;
+                break;
+            }
+        }
+        rand_piv::Downdate( YR, R1, nb );
+        k += nb;
+    }
+    householderScalars.Resize( k, 1 );
+    signature.Resize( k, 1 );
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_RANDOMIZEDPIVOTING_HPP
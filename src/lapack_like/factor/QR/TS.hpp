@@ -13,6 +13,89 @@ namespace El {
 namespace qr {
 namespace ts {
 
+// The role of a process in a single stage of a TSQR reduction tree: it
+// either sends its triangle to its parent or absorbs the triangles of each of
+// its children (a process which has already sent its triangle is idle).
+struct TreeStage
+{
+    Int parent=-1;
+    vector<Int> children;
+};
+
+// Every process returns the same number of stages, and only the root is
+// active in the last stage.
+inline vector<TreeStage>
+Schedule( Int rank, Int p, const TSQRCtrl& ctrl )
+{
+    Int groupSize;
+    if( ctrl.tree == TSQR_BINARY )
+        groupSize = 1;
+    else if( ctrl.tree == TSQR_FLAT )
+        groupSize = p;
+    else
+        groupSize = Min(Max(ctrl.groupSize,Int(1)),p);
+
+    vector<TreeStage> stages;
+    bool sent = false;
+
+    // A flat reduction within each group
+    if( groupSize > 1 )
+    {
+        TreeStage stage;
+        const Int leader = rank - rank % groupSize;
+        if( rank == leader )
+        {
+            for( Int child=leader+1; child<Min(leader+groupSize,p); ++child )
+                stage.children.push_back( child );
+        }
+        else
+        {
+            stage.parent = leader;
+            sent = true;
+        }
+        stages.push_back( stage );
+    }
+
+    // A binomial reduction over the group leaders
+    const Int numLeaders = (p+groupSize-1) / groupSize;
+    const Int leaderRank = rank / groupSize;
+    for( Int step=1; step<numLeaders; step*=2 )
+    {
+        TreeStage stage;
+        if( !sent )
+        {
+            if( leaderRank % (2*step) == 0 )
+            {
+                if( leaderRank+step < numLeaders )
+                    stage.children.push_back( (leaderRank+step)*groupSize );
+            }
+            else
+            {
+                stage.parent = (leaderRank-step)*groupSize;
+                sent = true;
+            }
+        }
+        stages.push_back( stage );
+    }
+    return stages;
+}
+
+// Resolve a nonpositive hybrid group size to the number of processes in the
+// column communicator which share a node
+inline TSQRCtrl ResolveCtrl( mpi::Comm colComm, const TSQRCtrl& ctrl )
+{
+    TSQRCtrl resolved = ctrl;
+    if( ctrl.tree == TSQR_HYBRID && ctrl.groupSize <= 0 )
+    {
+        mpi::Comm nodeComm;
+        mpi::SplitShared( colComm, mpi::Rank(colComm), nodeComm );
+        const Int nodeSize = mpi::Size( nodeComm );
+        mpi::Free( nodeComm );
+        resolved.groupSize = mpi::AllReduce( nodeSize, mpi::MIN, colComm );
+    }
+    return resolved;
+}
+
 template<typename F>
 void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
 {
@@ -30,57 +113,59 @@ void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
     const Int rank = mpi::Rank( colComm );
     if( m < p*n )
         LogicError("TSQR currently assumes height >= width*numProcesses");
-    if( !PowerOfTwo(p) )
-        LogicError("TSQR currently requires power-of-two number of processes");
-    const Int logp = FlooredLog2(p);
+    treeData.ctrl = ResolveCtrl( colComm, treeData.ctrl );
+    const auto stages = Schedule( rank, p, treeData.ctrl );
+    const Int numStages = stages.size();
 
     Matrix<F> lastZ;
     lastZ = treeData.QR0( IR(0,n), IR(0,n) );
+    MakeTrapezoidal( UPPER, lastZ );
 
-    treeData.QRList.resize( logp );
-    treeData.householderScalarsList.resize( logp );
-    treeData.signatureList.resize( logp );
+    treeData.QRList.resize( numStages );
+    treeData.householderScalarsList.resize( numStages );
+    treeData.signatureList.resize( numStages );
 
-    // Run the binary tree reduction
-    Matrix<F> ZTop(n,n,n), ZBot(n,n,n);
-    for( Int stage=0; stage<logp; ++stage )
+    // Run the reduction up the tree
+    Matrix<F> Z(n,n,n);
+    for( Int stage=0; stage<numStages; ++stage )
     {
-        // Pack, then send and receive n x n matrices
-        const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
-        const bool top = rank < partner;
-        if( top )
-        {
-            ZTop = lastZ;
-            MakeTrapezoidal( UPPER, ZTop );
-            mpi::Recv( ZBot.Buffer(), n*n, partner, colComm );
-        }
-        else
+        const auto& treeStage = stages[stage];
+        if( treeStage.parent >= 0 )
         {
-            ZBot = lastZ;
-            MakeTrapezoidal( UPPER, ZBot );
-            mpi::Send( ZBot.LockedBuffer(), n*n, partner, colComm );
+            Z = lastZ;
+            mpi::Send( Z.LockedBuffer(), n*n, treeStage.parent, colComm );
             break;
         }
+        const Int numChildren = treeStage.children.size();
+        if( numChildren == 0 )
+            continue;
 
+        // Stack our triangle on top of those of our children
         auto& QRFact = treeData.QRList[stage];
         auto& householderScalars = treeData.householderScalarsList[stage];
         auto& signature = treeData.signatureList[stage];
-        QRFact.Resize( 2*n, n, 2*n );
+        const Int stackHeight = (numChildren+1)*n;
+        QRFact.Resize( stackHeight, n, stackHeight );
         householderScalars.Resize( n, 1 );
         signature.Resize( n, 1 );
-        auto QRFactTop = QRFact( IR(0,n),   IR(0,n) );
-        auto QRFactBot = QRFact( IR(n,2*n), IR(0,n) );
-        QRFactTop = ZTop;
-        QRFactBot = ZBot;
+        auto QRFactTop = QRFact( IR(0,n), IR(0,n) );
+        QRFactTop = lastZ;
+        for( Int c=0; c<numChildren; ++c )
+        {
+            mpi::Recv( Z.Buffer(), n*n, treeStage.children[c], colComm );
+            auto QRFactChild = QRFact( IR((c+1)*n,(c+2)*n), IR(0,n) );
+            QRFactChild = Z;
+        }
 
         // Note that the last QR is not performed by this routine, as many
         // higher-level routines, such as TS-SVT, are simplified if the final
         // small matrix is left alone.
-        if( stage < logp-1 )
+        if( stage < numStages-1 )
         {
-            // TODO: Exploit double-triangular structure
+            // TODO: Exploit the triangular structure of the blocks
             QR( QRFact, householderScalars, signature );
             lastZ = QRFact( IR(0,n), IR(0,n) );
+            MakeTrapezoidal( UPPER, lastZ );
         }
     }
 }
@@ -201,51 +286,51 @@ void Scatter( AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
     const Int rank = mpi::Rank( colComm );
     if( m < p*n )
         LogicError("TSQR currently assumes height >= width*numProcesses");
-    if( !PowerOfTwo(p) )
-        LogicError("TSQR currently requires power-of-two number of processes");
-    const Int logp = FlooredLog2(p);
-
-    // Run the binary tree scatter
-    Matrix<F> Z(2*n,n,2*n), ZHalf(n,n,n);
-    if( rank == 0 )
-        Z = RootQR( A, treeData );
-    auto ZTop = Z( IR(0,n),   IR(0,n) );
-    auto ZBot = Z( IR(n,2*n), IR(0,n) );
-    for( Int revStage=0; revStage<logp; ++revStage )
+    const auto stages = Schedule( rank, p, treeData.ctrl );
+    const Int numStages = stages.size();
+
+    // Run the scatter down the tree
+    Matrix<F> Z, ZHalf(n,n,n);
+    for( Int stage=numStages-1; stage>=0; --stage )
     {
-        const Int stage = (logp-1)-revStage;
-        // Skip this stage if the first stage bits of our rank are not zero
-        if( stage>0 && (Unsigned(rank) & ((Unsigned(1)<<stage)-1)) )
+        const auto& treeStage = stages[stage];
+        if( treeStage.parent >= 0 )
+        {
+            mpi::Recv( ZHalf.Buffer(), n*n, treeStage.parent, colComm );
+            continue;
+        }
+        const Int numChildren = treeStage.children.size();
+        if( numChildren == 0 )
             continue;
 
-        const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
-        const bool top = rank < partner;
-        if( top )
+        if( stage == numStages-1 )
         {
-            if( stage < logp-1 )
-            {
-                // Multiply by the current Q
-                ZTop = ZHalf;
-                Zero( ZBot );
-
-                // TODO: Exploit sparsity?
-                ApplyQ
-                ( LEFT, NORMAL,
-                  treeData.QRList[stage],
-                  treeData.householderScalarsList[stage],
-                  treeData.signatureList[stage],
-                  Z );
-            }
-            // Send bottom-half to partner and keep top half
-            ZHalf = ZBot;
-            mpi::Send( ZHalf.LockedBuffer(), n*n, partner, colComm );
-            ZHalf = ZTop;
+            Z = RootQR( A, treeData );
         }
         else
         {
-            // Recv top half from partner
-            mpi::Recv( ZHalf.Buffer(), n*n, partner, colComm );
+            // Multiply by the current Q
+            Zeros( Z, (numChildren+1)*n, n );
+            auto ZTop = Z( IR(0,n), IR(0,n) );
+            ZTop = ZHalf;
+
+            // TODO: Exploit sparsity?
+            qr::ApplyQ
+            ( LEFT, NORMAL,
+              treeData.QRList[stage],
+              treeData.householderScalarsList[stage],
+              treeData.signatureList[stage],
+              Z );
         }
+
+        // Send the blocks of the children and keep the top block
+        for( Int c=0; c<numChildren; ++c )
+        {
+            ZHalf = Z( IR((c+1)*n,(c+2)*n), IR(0,n) );
+            mpi::Send
+            ( ZHalf.LockedBuffer(), n*n, treeStage.children[c], colComm );
+        }
+        ZHalf = Z( IR(0,n), IR(0,n) );
     }
 
     // Apply the initial Q
@@ -254,12 +339,94 @@ void Scatter( AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
     ATop = ZHalf;
 
     // TODO: Exploit sparsity
-    ApplyQ
+    qr::ApplyQ
     ( LEFT, NORMAL,
       treeData.QR0, treeData.householderScalars0, treeData.signature0,
       A.Matrix() );
 }
 
+template<typename F>
+void ApplyQ
+( Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const TreeData<F>& treeData,
+        AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    if( A.RowDist() != STAR || B.RowDist() != STAR )
+        LogicError("Invalid row distribution for TSQR");
+    if( A.ColDist() != B.ColDist() || A.ColAlign() != B.ColAlign() ||
+        A.Height() != B.Height() )
+        LogicError("B must have the same rows and distribution as A");
+    const Int n = A.Width();
+    const Int k = B.Width();
+    const mpi::Comm colComm = A.ColComm();
+    const Int p = mpi::Size( colComm );
+    const Int rank = mpi::Rank( colComm );
+    const bool normal = ( orientation == NORMAL );
+    auto& BLoc = B.Matrix();
+    const auto stages = Schedule( rank, p, treeData.ctrl );
+    const Int numStages = stages.size();
+
+    // Each stage of the tree mixes the top n rows of the local portions of B
+    // held by a parent and its children
+    auto BTop = BLoc( IR(0,n), ALL );
+    Matrix<F> Z, ZBlock;
+    auto applyStage = [&]( Int stage )
+    {
+        const auto& treeStage = stages[stage];
+        if( treeStage.parent >= 0 )
+        {
+            ZBlock = BTop;
+            mpi::Send( ZBlock.LockedBuffer(), n*k, treeStage.parent, colComm );
+            mpi::Recv( ZBlock.Buffer(), n*k, treeStage.parent, colComm );
+            BTop = ZBlock;
+            return;
+        }
+        const Int numChildren = treeStage.children.size();
+        if( numChildren == 0 )
+            return;
+        Z.Resize( (numChildren+1)*n, k );
+        ZBlock.Resize( n, k, n );
+        auto ZTop = Z( IR(0,n), ALL );
+        ZTop = BTop;
+        for( Int c=0; c<numChildren; ++c )
+        {
+            mpi::Recv( ZBlock.Buffer(), n*k, treeStage.children[c], colComm );
+            auto ZChild = Z( IR((c+1)*n,(c+2)*n), ALL );
+            ZChild = ZBlock;
+        }
+        qr::ApplyQ
+        ( LEFT, orientation,
+          treeData.QRList[stage],
+          treeData.householderScalarsList[stage],
+          treeData.signatureList[stage],
+          Z );
+        for( Int c=0; c<numChildren; ++c )
+        {
+            ZBlock = Z( IR((c+1)*n,(c+2)*n), ALL );
+            mpi::Send
+            ( ZBlock.LockedBuffer(), n*k, treeStage.children[c], colComm );
+        }
+        BTop = ZTop;
+    };
+
+    if( normal )
+    {
+        for( Int stage=numStages-1; stage>=0; --stage )
+            applyStage( stage );
+    }
+    qr::ApplyQ
+    ( LEFT, orientation,
+      treeData.QR0, treeData.householderScalars0, treeData.signature0,
+      BLoc );
+    if( !normal )
+    {
+        for( Int stage=0; stage<numStages; ++stage )
+            applyStage( stage );
+    }
+}
+
 template<typename F>
 inline DistMatrix<F,STAR,STAR>
 FormR( const AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
@@ -316,11 +483,12 @@ FormQ( AbstractDistMatrix<F>& A, TreeData<F>& treeData )
 } // namespace ts
 
 template<typename F>
-TreeData<F> TS( const AbstractDistMatrix<F>& A )
+TreeData<F> TS( const AbstractDistMatrix<F>& A, const TSQRCtrl& ctrl )
 {
     if( A.RowDist() != STAR )
         LogicError("Invalid row distribution for TSQR");
     TreeData<F> treeData;
+    treeData.ctrl = ctrl;
     treeData.QR0 = A.LockedMatrix();
     QR( treeData.QR0, treeData.householderScalars0, treeData.signature0 );
 
@@ -338,9 +506,10 @@ TreeData<F> TS( const AbstractDistMatrix<F>& A )
 }
 
 template<typename F>
-void ExplicitTS( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& R )
+void ExplicitTS
+( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& R, const TSQRCtrl& ctrl )
 {
-    auto treeData = TS( A );
+    auto treeData = TS( A, ctrl );
     Copy( ts::FormR( A, treeData ), R );
     ts::FormQ( A, treeData );
 }
@@ -0,0 +1,212 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_UPDATABLE_HPP
+#define EL_QR_UPDATABLE_HPP
+
+namespace El {
+
+namespace qr {
+
+// Overwrite the m x n matrix S, which is upper-triangular apart from its
+// first 'bandwidth' subdiagonals (with m = n + bandwidth), with its triangular
+// QR factor (with non-negative diagonal) using a sweep of reflectors of
+// length bandwidth+1
+template<typename F>
+void RetriangularizeBand( Matrix<F>& S, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = S.Height();
+    const Int n = S.Width();
+    Matrix<F> z;
+    for( Int k=0; k<n; ++k )
+    {
+        const Int last = Min(k+bandwidth+1,m);
+        const Range<Int> ind1( k ), ind2( k+1, last ), indB( k, last ),
+                         indR( k+1, n );
+
+        auto alpha11 = S( ind1, ind1 );
+        auto a21     = S( ind2, ind1 );
+        auto aB1     = S( indB, ind1 );
+        auto ABR     = S( indB, indR );
+
+        const F tau = LeftReflector( alpha11, a21 );
+        const F beta = alpha11(0);
+        alpha11(0) = 1;
+        Zeros( z, ABR.Width(), 1 );
+        Gemv( ADJOINT, F(1), ABR, aB1, F(0), z );
+        Ger( -tau, aB1, z, ABR );
+        alpha11(0) = beta;
+        Zero( a21 );
+
+        // Flip the sign of the row if its diagonal entry is negative
+        if( RealPart(beta) < Real(0) )
+        {
+            auto sk = S( ind1, IR(k,n) );
+            sk *= -1;
+        }
+    }
+}
+
+} // namespace qr
+
+template<typename Field>
+UpdatableQR<Field>::UpdatableQR( const Grid& grid )
+: R_(grid)
+{ }
+
+template<typename Field>
+void UpdatableQR<Field>::Initialize( const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() < A.Width() )
+        LogicError("UpdatableQR requires a matrix with full column rank");
+    R_.SetGrid( A.Grid() );
+    R_ = A;
+    qr::ExplicitTriang( R_ );
+    height_ = A.Height();
+}
+
+template<typename Field>
+void UpdatableQR<Field>::AddRows( const AbstractDistMatrix<Field>& W )
+{
+    EL_DEBUG_CSE
+    if( W.Width() != Width() )
+        LogicError("W must have the same width as A");
+    DistMatrix<Field> V(R_.Grid());
+    Adjoint( W, V );
+    CholeskyMod( UPPER, R_, Base<Field>(1), V );
+    height_ += W.Height();
+}
+
+template<typename Field>
+void UpdatableQR<Field>::RemoveRows( const AbstractDistMatrix<Field>& W )
+{
+    EL_DEBUG_CSE
+    if( W.Width() != Width() )
+        LogicError("W must have the same width as A");
+    if( height_-W.Height() < Width() )
+        LogicError("Cannot remove ",W.Height()," rows from a ",height_," x ",
+                   Width()," matrix with full column rank");
+    DistMatrix<Field> V(R_.Grid());
+    Adjoint( W, V );
+    CholeskyMod( UPPER, R_, Base<Field>(-1), V );
+    height_ -= W.Height();
+}
+
+template<typename Field>
+void UpdatableQR<Field>::AddColumns
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& C )
+{
+    EL_DEBUG_CSE
+    const Int n = Width();
+    const Int k = C.Width();
+    if( A.Height() != height_ || A.Width() != n )
+        LogicError("A does not match the current factorization");
+    if( C.Height() != height_ )
+        LogicError("C must have the same height as A");
+    if( height_ < n+k )
+        LogicError("UpdatableQR requires a matrix with full column rank");
+    const Grid& g = R_.Grid();
+
+    // Orthogonalize C against Q = A inv(R) with two passes of classical
+    // Gram-Schmidt, accumulating R12 = Q^H C
+    DistMatrix<Field> R12(g), Z(g), CPerp(C);
+    Zeros( R12, n, k );
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Gemm( ADJOINT, NORMAL, Field(1), A, CPerp, Z );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, Field(1), R_, Z );
+        R12 += Z;
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), R_, Z );
+        Gemm( NORMAL, NORMAL, Field(-1), A, Z, Field(1), CPerp );
+    }
+    qr::ExplicitTriang( CPerp );
+
+    DistMatrix<Field> RNew(g);
+    Zeros( RNew, n+k, n+k );
+    auto RNewTL = RNew( IR(0,n), IR(0,n) );
+    auto RNewTR = RNew( IR(0,n), IR(n,n+k) );
+    auto RNewBR = RNew( IR(n,n+k), IR(n,n+k) );
+    RNewTL = R_;
+    RNewTR = R12;
+    RNewBR = CPerp;
+    R_ = RNew;
+}
+
+template<typename Field>
+void UpdatableQR<Field>::DeleteColumns( Int j, Int numCols )
+{
+    EL_DEBUG_CSE
+    const Int n = Width();
+    if( j < 0 || numCols < 0 || j+numCols > n )
+        LogicError
+        ("Invalid deletion of columns [",j,",",j+numCols,") of ",n);
+    if( numCols == 0 )
+        return;
+    const Int nNew = n - numCols;
+    const Grid& g = R_.Grid();
+
+    DistMatrix<Field> RNew(g);
+    Zeros( RNew, nNew, nNew );
+    auto RNewL = RNew( ALL, IR(0,j) );
+    auto RNewTR = RNew( IR(0,j), IR(j,nNew) );
+    auto RNewBR = RNew( IR(j,nNew), IR(j,nNew) );
+    RNewL = R_( IR(0,nNew), IR(0,j) );
+    RNewTR = R_( IR(0,j), IR(j+numCols,n) );
+
+    // The remaining trailing columns have numCols nonzero subdiagonals, and
+    // the O(numCols (n-j)^2) sweep which removes them is performed on a
+    // single process
+    DistMatrix<Field,CIRC,CIRC> S( R_( IR(j,n), IR(j+numCols,n) ) );
+    if( S.CrossRank() == S.Root() )
+        qr::RetriangularizeBand( S.Matrix(), numCols );
+    RNewBR = S( IR(0,nNew-j), ALL );
+    R_ = RNew;
+}
+
+template<typename Field>
+void UpdatableQR<Field>::LeastSquares
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+        AbstractDistMatrix<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    if( A.Height() != height_ || A.Width() != Width() )
+        LogicError("A does not match the current factorization");
+    if( B.Height() != height_ )
+        LogicError("B must have the same height as A");
+
+    // X := inv(R) inv(R)^H A^H B
+    Gemm( ADJOINT, NORMAL, Field(1), A, B, X );
+    Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, Field(1), R_, X );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), R_, X );
+
+    // Correct the seminormal solution with one step of refinement
+    DistMatrix<Field> E(B), dX(R_.Grid());
+    Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), E );
+    Gemm( ADJOINT, NORMAL, Field(1), A, E, dX );
+    Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, Field(1), R_, dX );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), R_, dX );
+    Axpy( Field(1), dX, X );
+}
+
+template<typename Field>
+Int UpdatableQR<Field>::Height() const { return height_; }
+
+template<typename Field>
+Int UpdatableQR<Field>::Width() const { return R_.Width(); }
+
+template<typename Field>
+const DistMatrix<Field>& UpdatableQR<Field>::R() const { return R_; }
+
+} // namespace El
+
+#endif // ifndef EL_QR_UPDATABLE_HPP
@@ -0,0 +1,438 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace rfp {
+
+Int Order( Int height, Int width )
+{
+    if( height == 2*width+1 )
+        return height-1;
+    if( height == 2*width-1 )
+        return height;
+    LogicError
+    ("A ",height," x ",width," matrix is not in rectangular full packed form");
+    return 0;
+}
+
+Int Height( Int n ) { return ( n % 2 == 0 ? n+1 : n ); }
+Int Width( Int n ) { return ( n+1 ) / 2; }
+
+// The index ranges of the blocks of the packed array holding the lower
+// triangle of A11, the upper triangle of A22^H, and A21
+struct Blocks
+{
+    Int n1, n2;
+    Range<Int> I11, J11, I22, J22, I21, J21;
+
+    Blocks( Int n )
+    {
+        n1 = (n+1)/2;
+        n2 = n - n1;
+        if( n % 2 == 0 )
+        {
+            I11 = IR(1,n1+1); J11 = IR(0,n1);
+            I22 = IR(0,n2);   J22 = IR(0,n2);
+            I21 = IR(n1+1,n+1); J21 = IR(0,n1);
+        }
+        else
+        {
+            I11 = IR(0,n1);   J11 = IR(0,n1);
+            I22 = IR(0,n2);   J22 = IR(1,n1);
+            I21 = IR(n1,n);   J21 = IR(0,n1);
+        }
+    }
+};
+
+template<typename Field>
+void Pack( UpperOrLower uplo, const Matrix<Field>& A, Matrix<Field>& ARFP )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( uplo == UPPER )
+    {
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+        Pack( LOWER, AAdj, ARFP );
+        return;
+    }
+    const Int n = A.Height();
+    const Blocks b( n );
+    Zeros( ARFP, Height(n), Width(n) );
+    auto ARFP11 = ARFP( b.I11, b.J11 );
+    auto ARFP21 = ARFP( b.I21, b.J21 );
+    auto ARFP22Adj = ARFP( b.I22, b.J22 );
+    const Range<Int> ind1(0,b.n1), ind2(b.n1,n);
+
+    AxpyTrapezoid( LOWER, Field(1), A(ind1,ind1), ARFP11 );
+    Copy( A(ind2,ind1), ARFP21 );
+    Matrix<Field> A22Adj;
+    Adjoint( A(ind2,ind2), A22Adj );
+    AxpyTrapezoid( UPPER, Field(1), A22Adj, ARFP22Adj );
+}
+
+template<typename Field>
+void Pack
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& ARFPPre )
+{
+    EL_DEBUG_CSE
+    if( APre.Height() != APre.Width() )
+        LogicError("A must be square");
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> ARFPProx( ARFPPre );
+    auto& A = AProx.GetLocked();
+    auto& ARFP = ARFPProx.Get();
+    if( uplo == UPPER )
+    {
+        DistMatrix<Field> AAdj( A.Grid() );
+        Adjoint( A, AAdj );
+        Pack( LOWER, AAdj, ARFP );
+        return;
+    }
+    const Int n = A.Height();
+    const Blocks b( n );
+    Zeros( ARFP, Height(n), Width(n) );
+    auto ARFP11 = ARFP( b.I11, b.J11 );
+    auto ARFP21 = ARFP( b.I21, b.J21 );
+    auto ARFP22Adj = ARFP( b.I22, b.J22 );
+    const Range<Int> ind1(0,b.n1), ind2(b.n1,n);
+
+    AxpyTrapezoid( LOWER, Field(1), A(ind1,ind1), ARFP11 );
+    Copy( A(ind2,ind1), ARFP21 );
+    DistMatrix<Field> A22Adj( A.Grid() );
+    Adjoint( A(ind2,ind2), A22Adj );
+    AxpyTrapezoid( UPPER, Field(1), A22Adj, ARFP22Adj );
+}
+
+template<typename Field>
+void Unpack( const Matrix<Field>& ARFP, Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    const Int n = Order( ARFP.Height(), ARFP.Width() );
+    const Blocks b( n );
+    Zeros( A, n, n );
+    const Range<Int> ind1(0,b.n1), ind2(b.n1,n);
+    auto A11 = A( ind1, ind1 );
+    auto A21 = A( ind2, ind1 );
+    auto A22 = A( ind2, ind2 );
+
+    AxpyTrapezoid( LOWER, Field(1), ARFP(b.I11,b.J11), A11 );
+    Copy( ARFP(b.I21,b.J21), A21 );
+    Matrix<Field> A22Full;
+    Adjoint( ARFP(b.I22,b.J22), A22Full );
+    AxpyTrapezoid( LOWER, Field(1), A22Full, A22 );
+}
+
+template<typename Field>
+void Unpack
+( const AbstractDistMatrix<Field>& ARFPPre, AbstractDistMatrix<Field>& APre )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Field,Field,MC,MR> ARFPProx( ARFPPre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> AProx( APre );
+    auto& ARFP = ARFPProx.GetLocked();
+    auto& A = AProx.Get();
+    const Int n = Order( ARFP.Height(), ARFP.Width() );
+    const Blocks b( n );
+    Zeros( A, n, n );
+    const Range<Int> ind1(0,b.n1), ind2(b.n1,n);
+    auto A11 = A( ind1, ind1 );
+    auto A21 = A( ind2, ind1 );
+    auto A22 = A( ind2, ind2 );
+
+    AxpyTrapezoid( LOWER, Field(1), ARFP(b.I11,b.J11), A11 );
+    Copy( ARFP(b.I21,b.J21), A21 );
+    DistMatrix<Field> A22Full( A.Grid() );
+    Adjoint( ARFP(b.I22,b.J22), A22Full );
+    AxpyTrapezoid( LOWER, Field(1), A22Full, A22 );
+}
+
+// Since A22 is stored as the upper triangle of A22^H, its Cholesky factor is
+// stored as L22^H, which is exactly the factor of an upper Cholesky
+// factorization of the stored block
+template<typename Field>
+void Cholesky( Matrix<Field>& ARFP )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = Order( ARFP.Height(), ARFP.Width() );
+    const Blocks b( n );
+    auto A11 = ARFP( b.I11, b.J11 );
+    auto A21 = ARFP( b.I21, b.J21 );
+    auto A22Adj = ARFP( b.I22, b.J22 );
+
+    El::Cholesky( LOWER, A11 );
+    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, Field(1), A11, A21 );
+    Herk( UPPER, NORMAL, Real(-1), A21, Real(1), A22Adj );
+    El::Cholesky( UPPER, A22Adj );
+}
+
+template<typename Field>
+void Cholesky( AbstractDistMatrix<Field>& ARFPPre )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> ARFPProx( ARFPPre );
+    auto& ARFP = ARFPProx.Get();
+    const Int n = Order( ARFP.Height(), ARFP.Width() );
+    const Blocks b( n );
+    auto A11 = ARFP( b.I11, b.J11 );
+    auto A21 = ARFP( b.I21, b.J21 );
+    auto A22Adj = ARFP( b.I22, b.J22 );
+
+    El::Cholesky( LOWER, A11 );
+    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, Field(1), A11, A21 );
+    Herk( UPPER, NORMAL, Real(-1), A21, Real(1), A22Adj );
+    El::Cholesky( UPPER, A22Adj );
+}
+
+template<typename Field>
+void Trsm
+( Orientation orientation,
+  Field alpha,
+  const Matrix<Field>& LRFP,
+        Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( orientation == TRANSPOSE && IsComplex<Field>::value )
+        LogicError("Only NORMAL and ADJOINT solves are supported");
+    const Int n = Order( LRFP.Height(), LRFP.Width() );
+    if( B.Height() != n )
+        LogicError("Nonconformal solve");
+    const Blocks b( n );
+    auto L11 = LRFP( b.I11, b.J11 );
+    auto L21 = LRFP( b.I21, b.J21 );
+    auto L22Adj = LRFP( b.I22, b.J22 );
+    auto B1 = B( IR(0,b.n1), ALL );
+    auto B2 = B( IR(b.n1,n), ALL );
+
+    if( orientation == NORMAL )
+    {
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, alpha, L11, B1 );
+        Gemm( NORMAL, NORMAL, Field(-1), L21, B1, alpha, B2 );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, Field(1), L22Adj, B2 );
+    }
+    else
+    {
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, alpha, L22Adj, B2 );
+        Gemm( ADJOINT, NORMAL, Field(-1), L21, B2, alpha, B1 );
+        Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, Field(1), L11, B1 );
+    }
+}
+
+template<typename Field>
+void Trsm
+( Orientation orientation,
+  Field alpha,
+  const AbstractDistMatrix<Field>& LRFPPre,
+        AbstractDistMatrix<Field>& BPre )
+{
+    EL_DEBUG_CSE
+    if( orientation == TRANSPOSE && IsComplex<Field>::value )
+        LogicError("Only NORMAL and ADJOINT solves are supported");
+    DistMatrixReadProxy<Field,Field,MC,MR> LRFPProx( LRFPPre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& LRFP = LRFPProx.GetLocked();
+    auto& B = BProx.Get();
+    const Int n = Order( LRFP.Height(), LRFP.Width() );
+    if( B.Height() != n )
+        LogicError("Nonconformal solve");
+    const Blocks b( n );
+    auto L11 = LRFP( b.I11, b.J11 );
+    auto L21 = LRFP( b.I21, b.J21 );
+    auto L22Adj = LRFP( b.I22, b.J22 );
+    auto B1 = B( IR(0,b.n1), ALL );
+    auto B2 = B( IR(b.n1,n), ALL );
+
+    if( orientation == NORMAL )
+    {
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, alpha, L11, B1 );
+        Gemm( NORMAL, NORMAL, Field(-1), L21, B1, alpha, B2 );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, Field(1), L22Adj, B2 );
+    }
+    else
+    {
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, alpha, L22Adj, B2 );
+        Gemm( ADJOINT, NORMAL, Field(-1), L21, B2, alpha, B1 );
+        Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, Field(1), L11, B1 );
+    }
+}
+
+template<typename Field>
+void Herk
+( Orientation orientation,
+  Base<Field> alpha,
+  const Matrix<Field>& A,
+  Base<Field> beta,
+        Matrix<Field>& CRFP )
+{
+    EL_DEBUG_CSE
+    if( orientation == TRANSPOSE && IsComplex<Field>::value )
+        LogicError("Only NORMAL and ADJOINT updates are supported");
+    const Int n = Order( CRFP.Height(), CRFP.Width() );
+    const Blocks b( n );
+    auto C11 = CRFP( b.I11, b.J11 );
+    auto C21 = CRFP( b.I21, b.J21 );
+    auto C22Adj = CRFP( b.I22, b.J22 );
+    const Range<Int> ind1(0,b.n1), ind2(b.n1,n);
+
+    if( orientation == NORMAL )
+    {
+        if( A.Height() != n )
+            LogicError("Nonconformal update");
+        auto A1 = A( ind1, ALL );
+        auto A2 = A( ind2, ALL );
+        Herk( LOWER, NORMAL, alpha, A1, beta, C11 );
+        Gemm( NORMAL, ADJOINT, Field(alpha), A2, A1, Field(beta), C21 );
+        Herk( UPPER, NORMAL, alpha, A2, beta, C22Adj );
+    }
+    else
+    {
+        if( A.Width() != n )
+            LogicError("Nonconformal update");
+        auto A1 = A( ALL, ind1 );
+        auto A2 = A( ALL, ind2 );
+        Herk( LOWER, ADJOINT, alpha, A1, beta, C11 );
+        Gemm( ADJOINT, NORMAL, Field(alpha), A2, A1, Field(beta), C21 );
+        Herk( UPPER, ADJOINT, alpha, A2, beta, C22Adj );
+    }
+}
+
+template<typename Field>
+void Herk
+( Orientation orientation,
+  Base<Field> alpha,
+  const AbstractDistMatrix<Field>& APre,
+  Base<Field> beta,
+        AbstractDistMatrix<Field>& CRFPPre )
+{
+    EL_DEBUG_CSE
+    if( orientation == TRANSPOSE && IsComplex<Field>::value )
+        LogicError("Only NORMAL and ADJOINT updates are supported");
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> CRFPProx( CRFPPre );
+    auto& A = AProx.GetLocked();
+    auto& CRFP = CRFPProx.Get();
+    const Int n = Order( CRFP.Height(), CRFP.Width() );
+    const Blocks b( n );
+    auto C11 = CRFP( b.I11, b.J11 );
+    auto C21 = CRFP( b.I21, b.J21 );
+    auto C22Adj = CRFP( b.I22, b.J22 );
+    const Range<Int> ind1(0,b.n1), ind2(b.n1,n);
+
+    if( orientation == NORMAL )
+    {
+        if( A.Height() != n )
+            LogicError("Nonconformal update");
+        auto A1 = A( ind1, ALL );
+        auto A2 = A( ind2, ALL );
+        Herk( LOWER, NORMAL, alpha, A1, beta, C11 );
+        Gemm( NORMAL, ADJOINT, Field(alpha), A2, A1, Field(beta), C21 );
+        Herk( UPPER, NORMAL, alpha, A2, beta, C22Adj );
+    }
+    else
+    {
+        if( A.Width() != n )
+            LogicError("Nonconformal update");
+        auto A1 = A( ALL, ind1 );
+        auto A2 = A( ALL, ind2 );
+        Herk( LOWER, ADJOINT, alpha, A1, beta, C11 );
+        Gemm( ADJOINT, NORMAL, Field(alpha), A2, A1, Field(beta), C21 );
+        Herk( UPPER, ADJOINT, alpha, A2, beta, C22Adj );
+    }
+}
+
+template<typename Field>
+void SolveAfter( const Matrix<Field>& LRFP, Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    Trsm( NORMAL, Field(1), LRFP, B );
+    Trsm( ADJOINT, Field(1), LRFP, B );
+}
+
+template<typename Field>
+void SolveAfter
+( const AbstractDistMatrix<Field>& LRFP, AbstractDistMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    Trsm( NORMAL, Field(1), LRFP, B );
+    Trsm( ADJOINT, Field(1), LRFP, B );
+}
+
+template<typename Field>
+void HPDSolve( Matrix<Field>& ARFP, Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    Cholesky( ARFP );
+    SolveAfter( ARFP, B );
+}
+
+template<typename Field>
+void HPDSolve( AbstractDistMatrix<Field>& ARFP, AbstractDistMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    Cholesky( ARFP );
+    SolveAfter( ARFP, B );
+}
+
+#define PROTO(Field) \
+  template void Pack \
+  ( UpperOrLower uplo, const Matrix<Field>& A, Matrix<Field>& ARFP ); \
+  template void Pack \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& ARFP ); \
+  template void Unpack( const Matrix<Field>& ARFP, Matrix<Field>& A ); \
+  template void Unpack \
+  ( const AbstractDistMatrix<Field>& ARFP, AbstractDistMatrix<Field>& A ); \
+  template void Cholesky( Matrix<Field>& ARFP ); \
+  template void Cholesky( AbstractDistMatrix<Field>& ARFP ); \
+  template void Trsm \
+  ( Orientation orientation, \
+    Field alpha, \
+    const Matrix<Field>& LRFP, \
+          Matrix<Field>& B ); \
+  template void Trsm \
+  ( Orientation orientation, \
+    Field alpha, \
+    const AbstractDistMatrix<Field>& LRFP, \
+          AbstractDistMatrix<Field>& B ); \
+  template void Herk \
+  ( Orientation orientation, \
+    Base<Field> alpha, \
+    const Matrix<Field>& A, \
+    Base<Field> beta, \
+          Matrix<Field>& CRFP ); \
+  template void Herk \
+  ( Orientation orientation, \
+    Base<Field> alpha, \
+    const AbstractDistMatrix<Field>& A, \
+    Base<Field> beta, \
+          AbstractDistMatrix<Field>& CRFP ); \
+  template void SolveAfter \
+  ( const Matrix<Field>& LRFP, Matrix<Field>& B ); \
+  template void SolveAfter \
+  ( const AbstractDistMatrix<Field>& LRFP, AbstractDistMatrix<Field>& B ); \
+  template void HPDSolve( Matrix<Field>& ARFP, Matrix<Field>& B ); \
+  template void HPDSolve \
+  ( AbstractDistMatrix<Field>& ARFP, AbstractDistMatrix<Field>& B );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace rfp
+} // namespace El
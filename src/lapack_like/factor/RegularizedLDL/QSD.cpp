@@ -0,0 +1,187 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace reg_ldl {
+
+// Unblocked serial LDL^H without pivoting, where the first n0 pivots are
+// expected to be positive and the remainder negative. Any pivot of the wrong
+// sign, or of magnitude less than regCand(j), is replaced by +-regCand(j).
+template<typename Field>
+void QSDUnb
+( Int n0,
+  Matrix<Field>& A,
+  const Matrix<Base<Field>>& regCand,
+  Matrix<Base<Field>>& reg )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<n; ++j )
+    {
+        const Int a21Height = n - (j+1);
+
+        const Real sgn = ( j < n0 ? Real(1) : Real(-1) );
+        Real alpha11 = RealPart(A(j,j));
+        if( sgn*alpha11 < regCand(j) )
+        {
+            reg(j) = sgn*regCand(j) - alpha11;
+            alpha11 = sgn*regCand(j);
+        }
+        A(j,j) = alpha11;
+
+        const Real alpha11Inv = Real(1)/alpha11;
+        Field* a21 = A.Buffer(j+1,j  );
+        Field* A22 = A.Buffer(j+1,j+1);
+
+        blas::Her( 'L', a21Height, -alpha11Inv, a21, 1, A22, ALDim );
+        blas::Scal( a21Height, alpha11Inv, a21, 1 );
+    }
+}
+
+template<typename Field>
+void RegularizedQSDLDL
+( Int n0,
+  Matrix<Field>& A,
+  const Matrix<Base<Field>>& regCand,
+  Matrix<Base<Field>>& reg )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( regCand.Height() != A.Height() || regCand.Width() != 1 )
+          LogicError("regCand must be a column vector of the height of A");
+    )
+    const Int n = A.Height();
+    Zeros( reg, n, 1 );
+
+    Matrix<Field> d1, S21;
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A11 = A( ind1, ind1 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+        auto regCand1 = regCand( ind1, ALL );
+        auto reg1 = reg( ind1, ALL );
+
+        QSDUnb( n0-k, A11, regCand1, reg1 );
+        GetDiagonal( A11, d1 );
+        Trsm( RIGHT, LOWER, ADJOINT, UNIT, Field(1), A11, A21 );
+        S21 = A21;
+        DiagonalSolve( RIGHT, NORMAL, d1, A21 );
+        Trrk( LOWER, NORMAL, ADJOINT, Field(-1), S21, A21, Field(1), A22 );
+    }
+}
+
+template<typename Field>
+void RegularizedQSDLDL
+( Int n0,
+  AbstractDistMatrix<Field>& APre,
+  const AbstractDistMatrix<Base<Field>>& regCandPre,
+  AbstractDistMatrix<Base<Field>>& reg )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( regCandPre.Height() != APre.Height() || regCandPre.Width() != 1 )
+          LogicError("regCand must be a column vector of the height of A");
+    )
+    typedef Base<Field> Real;
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    const Int n = A.Height();
+
+    DistMatrixReadProxy<Real,Real,STAR,STAR> regCandProx( regCandPre );
+    const auto& regCand = regCandProx.GetLocked().LockedMatrix();
+
+    // Every process redundantly factors each diagonal block, so the
+    // regularization can be accumulated without any communication
+    DistMatrix<Real,STAR,STAR> reg_STAR_STAR(g);
+    Zeros( reg_STAR_STAR, n, 1 );
+
+    DistMatrix<Field,STAR,STAR> A11_STAR_STAR(g), d1_STAR_STAR(g);
+    DistMatrix<Field,VC,  STAR> A21_VC_STAR(g);
+    DistMatrix<Field,VR,  STAR> A21_VR_STAR(g);
+    DistMatrix<Field,STAR,MC  > S21Trans_STAR_MC(g);
+    DistMatrix<Field,STAR,MR  > A21Trans_STAR_MR(g);
+
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A11 = A( ind1, ind1 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+        auto regCand1 = regCand( ind1, ALL );
+        auto reg1 = reg_STAR_STAR.Matrix()( ind1, ALL );
+
+        A11_STAR_STAR = A11;
+        QSDUnb( n0-k, A11_STAR_STAR.Matrix(), regCand1, reg1 );
+        GetDiagonal( A11_STAR_STAR, d1_STAR_STAR );
+        A11 = A11_STAR_STAR;
+
+        A21_VC_STAR.AlignWith( A22 );
+        A21_VC_STAR = A21;
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, UNIT,
+          Field(1), A11_STAR_STAR, A21_VC_STAR );
+
+        S21Trans_STAR_MC.AlignWith( A22 );
+        Transpose( A21_VC_STAR, S21Trans_STAR_MC );
+        DiagonalSolve( RIGHT, NORMAL, d1_STAR_STAR, A21_VC_STAR );
+        A21_VR_STAR.AlignWith( A22 );
+        A21_VR_STAR = A21_VC_STAR;
+        A21Trans_STAR_MR.AlignWith( A22 );
+        Transpose( A21_VR_STAR, A21Trans_STAR_MR, true );
+        LocalTrrk
+        ( LOWER, TRANSPOSE,
+          Field(-1), S21Trans_STAR_MC, A21Trans_STAR_MR, Field(1), A22 );
+
+        A21 = A21_VC_STAR;
+    }
+    Copy( reg_STAR_STAR, reg );
+}
+
+#define PROTO(Field) \
+  template void RegularizedQSDLDL \
+  ( Int n0, \
+    Matrix<Field>& A, \
+    const Matrix<Base<Field>>& regCand, \
+    Matrix<Base<Field>>& reg ); \
+  template void RegularizedQSDLDL \
+  ( Int n0, \
+    AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Base<Field>>& regCand, \
+    AbstractDistMatrix<Base<Field>>& reg );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace reg_ldl
+} // namespace El
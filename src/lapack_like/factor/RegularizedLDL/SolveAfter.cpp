@@ -689,6 +689,132 @@ Int FGMRESSolveAfter
     return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
 }
 
+// Use either pipelined CG or pipelined MINRES, which require A to be
+// Hermitian and the preconditioner to be HPD
+template<typename Field>
+Int HermitianSolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const SparseLDLFactorization<Field>& sparseLDLFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( Matrix<Field>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, sparseLDLFact, W, ctrl.relTolRefine, ctrl.maxRefineIts,
+          ctrl.progress );
+      };
+
+    if( ctrl.alg == REG_SOLVE_CG )
+        return
+          CG( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+    else
+        return
+          MINRES( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+}
+
+template<typename Field>
+Int HermitianSolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const Matrix<Base<Field>>& d,
+  const SparseLDLFactorization<Field>& sparseLDLFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( Matrix<Field>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, d, sparseLDLFact, W, ctrl.relTolRefine, ctrl.maxRefineIts,
+          ctrl.progress );
+      };
+
+    if( ctrl.alg == REG_SOLVE_CG )
+        return
+          CG( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+    else
+        return
+          MINRES( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+}
+
+template<typename Field>
+Int HermitianSolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistSparseLDLFactorization<Field>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta, DistMultiVec<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<Field>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, sparseLDLFact, W, ctrl.relTolRefine, ctrl.maxRefineIts,
+          ctrl.progress );
+      };
+
+    if( ctrl.alg == REG_SOLVE_CG )
+        return
+          CG( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+    else
+        return
+          MINRES( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+}
+
+template<typename Field>
+Int HermitianSolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistMultiVec<Base<Field>>& d,
+  const DistSparseLDLFactorization<Field>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta, DistMultiVec<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<Field>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, d, sparseLDLFact, W, ctrl.relTolRefine, ctrl.maxRefineIts,
+          ctrl.progress );
+      };
+
+    if( ctrl.alg == REG_SOLVE_CG )
+        return
+          CG( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+    else
+        return
+          MINRES( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+}
+
 // TODO(poulson): Add RGMRES
 
 template<typename Field>
@@ -721,6 +847,9 @@ Int SolveAfter
           ctrl.relTolRefine,
           ctrl.maxRefineIts, 
           ctrl.progress );
+    case REG_SOLVE_CG:
+    case REG_SOLVE_MINRES:
+        return HermitianSolveAfter( A, reg, sparseLDLFact, B, ctrl );
     default:
         LogicError("Invalid refinement algorithm");
         return -1;
@@ -758,6 +887,9 @@ Int SolveAfter
           ctrl.relTolRefine,
           ctrl.maxRefineIts, 
           ctrl.progress );
+    case REG_SOLVE_CG:
+    case REG_SOLVE_MINRES:
+        return HermitianSolveAfter( A, reg, d, sparseLDLFact, B, ctrl );
     default:
         LogicError("Invalid refinement algorithm");
         return -1;
@@ -794,6 +926,9 @@ Int SolveAfter
           ctrl.relTolRefine,
           ctrl.maxRefineIts, 
           ctrl.progress );
+    case REG_SOLVE_CG:
+    case REG_SOLVE_MINRES:
+        return HermitianSolveAfter( A, reg, sparseLDLFact, B, ctrl );
     default:
         LogicError("Invalid refinement algorithm");
         return -1;
@@ -831,12 +966,189 @@ Int SolveAfter
           ctrl.relTolRefine,
           ctrl.maxRefineIts, 
           ctrl.progress );
+    case REG_SOLVE_CG:
+    case REG_SOLVE_MINRES:
+        return HermitianSolveAfter( A, reg, d, sparseLDLFact, B, ctrl );
     default:
         LogicError("Invalid refinement algorithm");
         return -1;
     }
 }
 
+// Dense matrices
+// ==============
+
+template<typename Field>
+Int SolveAfter
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const Matrix<Field>& AFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      {
+          Hemm( LEFT, uplo, alpha, A, X, beta, Y );
+      };
+    auto applyARegularized =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Y = X;
+          DiagonalScale( LEFT, NORMAL, reg, Y );
+          Hemm( LEFT, uplo, Field(1), A, X, Field(1), Y );
+      };
+    auto applyAInv =
+      [&]( Matrix<Field>& Y )
+      {
+          ldl::SolveAfter( AFact, Y, true );
+      };
+    auto precond =
+      [&]( Matrix<Field>& W )
+      {
+        RefinedSolve
+        ( applyARegularized, applyAInv, W, ctrl.relTolRefine,
+          ctrl.maxRefineIts, ctrl.progress );
+      };
+
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+    case REG_SOLVE_CG:
+        return
+          CG( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+    case REG_SOLVE_MINRES:
+        return
+          MINRES( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+// Monotone (batch) iterative refinement of A X = B using the approximate
+// inverse 'applyAInv', following refined_solve::Single
+template<typename Field,class ApplyAType,class ApplyAInvType>
+Int DistRefinedSolve
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+        DistMatrix<Field>& B,
+        Base<Field> relTol,
+        Int maxRefineIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = B.Grid();
+    if( maxRefineIts <= 0 )
+    {
+        applyAInv( B );
+        return 0;
+    }
+
+    const Real bNorm = MaxNorm( B );
+    if( bNorm == Real(0) )
+        return 0;
+
+    DistMatrix<Field> BOrig(B), X(B), dX(g), XCand(g), Y(g);
+    applyAInv( X );
+    applyA( X, Y );
+    B -= Y;
+    Real errorNorm = MaxNorm( B );
+    if( progress )
+        OutputFromRoot(g.Comm(),"original rel error: ",errorNorm/bNorm);
+
+    Int refineIt = 0;
+    while( true )
+    {
+        if( errorNorm/bNorm <= relTol )
+        {
+            if( progress )
+                OutputFromRoot(g.Comm(),errorNorm/bNorm," <= ",relTol);
+            break;
+        }
+
+        dX = B;
+        applyAInv( dX );
+        XCand = X;
+        XCand += dX;
+
+        applyA( XCand, Y );
+        B = BOrig;
+        B -= Y;
+        const Real newErrorNorm = MaxNorm( B );
+        if( progress )
+            OutputFromRoot(g.Comm(),"refined rel error: ",newErrorNorm/bNorm);
+
+        if( newErrorNorm < errorNorm )
+            X = XCand;
+        else
+            break;
+
+        errorNorm = newErrorNorm;
+        ++refineIt;
+        if( refineIt >= maxRefineIts )
+            break;
+    }
+    B = X;
+    return refineIt;
+}
+
+// There are not yet Krylov solvers for DistMatrix, so the outer Krylov
+// iteration is replaced by iterative refinement against A, preconditioned by
+// the inner refinement against A + diag(reg)
+template<typename Field>
+Int SolveAfter
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Base<Field>>& reg,
+  const AbstractDistMatrix<Field>& AFact,
+        AbstractDistMatrix<Field>& BPre,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+
+    auto applyA =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      {
+          Zeros( Y, X.Height(), X.Width() );
+          Hemm( LEFT, uplo, Field(1), A, X, Field(0), Y );
+      };
+    auto applyARegularized =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      {
+          Y = X;
+          DiagonalScale( LEFT, NORMAL, reg, Y );
+          Hemm( LEFT, uplo, Field(1), A, X, Field(1), Y );
+      };
+    auto applyAInv =
+      [&]( DistMatrix<Field>& Y )
+      {
+          ldl::SolveAfter( AFact, Y, true );
+      };
+    auto precond =
+      [&]( DistMatrix<Field>& W )
+      {
+        DistRefinedSolve
+        ( applyARegularized, applyAInv, W, ctrl.relTolRefine,
+          ctrl.maxRefineIts, ctrl.progress );
+      };
+
+    return DistRefinedSolve
+      ( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+}
+
 #define PROTO(Field) \
   template Int RegularizedSolveAfter \
   ( const SparseMatrix<Field>& A, \
@@ -889,6 +1201,20 @@ Int SolveAfter
     const DistMultiVec<Base<Field>>& d, \
     const DistSparseLDLFactorization<Field>& sparseLDLFact, \
           DistMultiVec<Field>& B, \
+    const RegSolveCtrl<Base<Field>>& ctrl ); \
+  template Int SolveAfter \
+  ( UpperOrLower uplo, \
+    const Matrix<Field>& A, \
+    const Matrix<Base<Field>>& reg, \
+    const Matrix<Field>& AFact, \
+          Matrix<Field>& B, \
+    const RegSolveCtrl<Base<Field>>& ctrl ); \
+  template Int SolveAfter \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Base<Field>>& reg, \
+    const AbstractDistMatrix<Field>& AFact, \
+          AbstractDistMatrix<Field>& B, \
     const RegSolveCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
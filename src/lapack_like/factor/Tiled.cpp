@@ -0,0 +1,284 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./LU/Panel.hpp"
+#include "./QR/ApplyQ.hpp"
+#include "./QR/PanelHouseholder.hpp"
+
+namespace El {
+
+namespace tiled {
+
+// The views of the tiles of a matrix, which also serve as the handles of the
+// data read and written by the tasks
+template<typename F>
+struct Tiles
+{
+    vector<Int> rowOffsets, colOffsets;
+    Int mt, nt;
+    vector<Matrix<F>> tiles;
+
+    Tiles( Matrix<F>& A, Int tileSize, Int split=0 )
+    : rowOffsets(TileOffsets(A.Height(),tileSize,split)),
+      colOffsets(TileOffsets(A.Width(),tileSize,split)),
+      mt(rowOffsets.size()-1), nt(colOffsets.size()-1),
+      tiles(mt*nt)
+    {
+        for( Int j=0; j<nt; ++j )
+            for( Int i=0; i<mt; ++i )
+                tiles[i+j*mt] =
+                  A( IR(rowOffsets[i],rowOffsets[i+1]),
+                     IR(colOffsets[j],colOffsets[j+1]) );
+    }
+
+    Matrix<F>& operator()( Int i, Int j ) { return tiles[i+j*mt]; }
+
+    // The tiles of column j from tile row k downwards
+    vector<const void*> Below( Int k, Int j )
+    {
+        vector<const void*> handles;
+        for( Int i=k; i<mt; ++i )
+            handles.push_back( &tiles[i+j*mt] );
+        return handles;
+    }
+
+    // The rows from tile row k downwards within tile column j
+    Matrix<F> BelowView( Matrix<F>& A, Int k, Int j )
+    { return A( IR(rowOffsets[k],END), IR(colOffsets[j],colOffsets[j+1]) ); }
+};
+
+Int TileSize( const TiledCtrl& ctrl )
+{ return ( ctrl.tileSize > 0 ? ctrl.tileSize : Blocksize() ); }
+
+} // namespace tiled
+
+template<typename F>
+void TiledCholesky
+( UpperOrLower uplo, Matrix<F>& A, const TiledCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    typedef Base<F> Real;
+    tiled::Tiles<F> T( A, tiled::TileSize(ctrl) );
+    const Int nt = T.nt;
+
+    // The factorization of the next diagonal tile, as well as the solves
+    // and updates which it depends upon, are prioritized
+    TaskGraph graph;
+    for( Int k=0; k<nt; ++k )
+    {
+        const Int critical = 3*(nt-k);
+        auto& AKK = T(k,k);
+        graph.Insert
+        ( [&]() { Cholesky( uplo, AKK ); }, {}, {&AKK}, critical );
+        for( Int i=k+1; i<nt; ++i )
+        {
+            const Int priority = ( i==k+1 ? critical-1 : 0 );
+            auto& AOff = ( uplo==LOWER ? T(i,k) : T(k,i) );
+            if( uplo == LOWER )
+                graph.Insert
+                ( [&]()
+                  { Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), AKK, AOff ); },
+                  {&AKK}, {&AOff}, priority );
+            else
+                graph.Insert
+                ( [&]()
+                  { Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), AKK, AOff ); },
+                  {&AKK}, {&AOff}, priority );
+        }
+        for( Int j=k+1; j<nt; ++j )
+        {
+            const Int priority = ( j==k+1 ? critical-2 : 0 );
+            auto& AJJ = T(j,j);
+            if( uplo == LOWER )
+            {
+                auto& AJK = T(j,k);
+                graph.Insert
+                ( [&]()
+                  { Herk( LOWER, NORMAL, Real(-1), AJK, Real(1), AJJ ); },
+                  {&AJK}, {&AJJ}, priority );
+                for( Int i=j+1; i<nt; ++i )
+                {
+                    auto& AIK = T(i,k);
+                    auto& AIJ = T(i,j);
+                    graph.Insert
+                    ( [&]()
+                      { Gemm( NORMAL, ADJOINT, F(-1), AIK, AJK, F(1), AIJ ); },
+                      {&AIK,&AJK}, {&AIJ}, priority );
+                }
+            }
+            else
+            {
+                auto& AKJ = T(k,j);
+                graph.Insert
+                ( [&]()
+                  { Herk( UPPER, ADJOINT, Real(-1), AKJ, Real(1), AJJ ); },
+                  {&AKJ}, {&AJJ}, priority );
+                for( Int i=j+1; i<nt; ++i )
+                {
+                    auto& AKI = T(k,i);
+                    auto& AJI = T(j,i);
+                    graph.Insert
+                    ( [&]()
+                      { Gemm( ADJOINT, NORMAL, F(-1), AKJ, AKI, F(1), AJI ); },
+                      {&AKJ,&AKI}, {&AJI}, priority );
+                }
+            }
+        }
+    }
+    graph.Execute( ctrl.numThreads );
+}
+
+template<typename F>
+void TiledLU( Matrix<F>& A, Permutation& P, const TiledCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    tiled::Tiles<F> T( A, tiled::TileSize(ctrl), minDim );
+    const Int nt = T.nt;
+    Int numPanels = 0;
+    while( numPanels < nt && T.colOffsets[numPanels+1] <= minDim )
+        ++numPanels;
+
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+    vector<Permutation> panelPerms( numPanels );
+
+    TaskGraph graph;
+    for( Int k=0; k<numPanels; ++k )
+    {
+        const Int critical = 2*(numPanels-k);
+        const Int offset = T.rowOffsets[k];
+        auto& PB = panelPerms[k];
+        auto& AKK = T(k,k);
+        graph.Insert
+        ( [&,k,offset]()
+          {
+              auto APan = T.BelowView( A, k, k );
+              lu::Panel( APan, P, PB, offset );
+          },
+          {}, T.Below(k,k), critical );
+
+        // Apply the interchanges to every other tile column (and solve for
+        // the block row of U to the right of the panel)
+        for( Int j=0; j<nt; ++j )
+        {
+            if( j == k )
+                continue;
+            const Int priority = ( j==k+1 ? critical-1 : 0 );
+            graph.Insert
+            ( [&,j,k]()
+              {
+                  auto AB = T.BelowView( A, k, j );
+                  PB.PermuteRows( AB );
+                  if( j > k )
+                      Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), AKK, T(k,j) );
+              },
+              {&AKK}, T.Below(k,j), priority );
+        }
+
+        for( Int j=k+1; j<nt; ++j )
+        {
+            const Int priority = ( j==k+1 ? critical-1 : 0 );
+            auto& AKJ = T(k,j);
+            for( Int i=k+1; i<T.mt; ++i )
+            {
+                auto& AIK = T(i,k);
+                auto& AIJ = T(i,j);
+                graph.Insert
+                ( [&]()
+                  { Gemm( NORMAL, NORMAL, F(-1), AIK, AKJ, F(1), AIJ ); },
+                  {&AIK,&AKJ}, {&AIJ}, priority );
+            }
+        }
+    }
+    graph.Execute( ctrl.numThreads );
+}
+
+template<typename F>
+void TiledQR
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature,
+  const TiledCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+    tiled::Tiles<F> T( A, tiled::TileSize(ctrl), minDim );
+    const Int nt = T.nt;
+    Int numPanels = 0;
+    while( numPanels < nt && T.colOffsets[numPanels+1] <= minDim )
+        ++numPanels;
+
+    vector<Matrix<F>> panels, panelScalars;
+    vector<Matrix<Base<F>>> panelSignatures;
+    for( Int k=0; k<numPanels; ++k )
+    {
+        const IR ind1( T.colOffsets[k], T.colOffsets[k+1] );
+        panels.push_back( T.BelowView( A, k, k ) );
+        panelScalars.push_back( householderScalars(ind1,ALL) );
+        panelSignatures.push_back( signature(ind1,ALL) );
+    }
+
+    TaskGraph graph;
+    for( Int k=0; k<numPanels; ++k )
+    {
+        const Int critical = 2*(numPanels-k);
+        auto& APan = panels[k];
+        auto& householderScalars1 = panelScalars[k];
+        auto& sig1 = panelSignatures[k];
+        const auto panelHandles = T.Below(k,k);
+        graph.Insert
+        ( [&]() { qr::PanelHouseholder( APan, householderScalars1, sig1 ); },
+          {}, panelHandles, critical );
+        for( Int j=k+1; j<nt; ++j )
+        {
+            const Int priority = ( j==k+1 ? critical-1 : 0 );
+            graph.Insert
+            ( [&,j,k]()
+              {
+                  auto AB = T.BelowView( A, k, j );
+                  qr::ApplyQ
+                  ( LEFT, ADJOINT, APan, householderScalars1, sig1, AB );
+              },
+              panelHandles, T.Below(k,j), priority );
+        }
+    }
+    graph.Execute( ctrl.numThreads );
+}
+
+#define PROTO(F) \
+  template void TiledCholesky \
+  ( UpperOrLower uplo, Matrix<F>& A, const TiledCtrl& ctrl ); \
+  template void TiledLU \
+  ( Matrix<F>& A, Permutation& P, const TiledCtrl& ctrl ); \
+  template void TiledQR \
+  ( Matrix<F>& A, \
+    Matrix<F>& householderScalars, \
+    Matrix<Base<F>>& signature, \
+    const TiledCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,418 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// f(A) B is approximated from the block Krylov subspace generated by A and B.
+// With B = V_0 R_0 and the block Arnoldi relation A V_m = V_{m+1} H_{m+1,m},
+// the approximation after m steps is
+//
+//   X_m = V_m f(H_m) E_1 R_0,
+//
+// where E_1 selects the first block column. Since V_m is orthonormal,
+// || X_m - X_{m-1} ||_F is the norm of the change in the small coefficient
+// matrix f(H_m) E_1 R_0, which is used as the stopping criterion. Each new
+// block is orthogonalized against all of the previous ones twice (even for
+// Hermitian A) so that the basis remains orthonormal in finite precision.
+
+namespace El {
+namespace krylov_func {
+
+template<typename Field>
+void Promote( const Matrix<Field>& A, Matrix<Complex<Base<Field>>>& AC )
+{
+    EL_DEBUG_CSE
+    AC.Resize( A.Height(), A.Width() );
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            AC(i,j) = A(i,j);
+}
+
+template<typename Real>
+void Narrow( const Matrix<Complex<Real>>& YC, Matrix<Real>& Y )
+{
+    EL_DEBUG_CSE
+    RealPart( YC, Y );
+}
+
+template<typename Real>
+void Narrow( const Matrix<Complex<Real>>& YC, Matrix<Complex<Real>>& Y )
+{
+    EL_DEBUG_CSE
+    Y = YC;
+}
+
+// Y := f(H) E_1 R_0 = Q f(Lambda) Q(0:k,:)^H R_0 for Hermitian H
+template<typename Field>
+void HermitianCoefficients
+( const Matrix<Field>& H,
+  const Matrix<Field>& R0,
+        Matrix<Field>& Y,
+  const function<Base<Field>(const Base<Field>&)>& func )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = H.Height();
+    const Int k = R0.Height();
+
+    Matrix<Field> T( H ), Q;
+    Matrix<Real> w;
+    HermitianEig( LOWER, T, w, Q );
+
+    Matrix<Field> Z;
+    Zeros( Z, m, k );
+    Gemm( ADJOINT, NORMAL, Field(1), Q(IR(0,k),ALL), R0, Field(0), Z );
+    for( Int i=0; i<m; ++i )
+    {
+        const Real fOmega = func( w(i) );
+        for( Int j=0; j<k; ++j )
+            Z(i,j) *= fOmega;
+    }
+    Zeros( Y, m, k );
+    Gemm( NORMAL, NORMAL, Field(1), Q, Z, Field(0), Y );
+}
+
+// Y := f(H) E_1 R_0 = S f(Lambda) inv(S) E_1 R_0 for diagonalizable H
+template<typename Field>
+void GeneralCoefficients
+( const Matrix<Field>& H,
+  const Matrix<Field>& R0,
+        Matrix<Field>& Y,
+  const function<Complex<Base<Field>>(const Complex<Base<Field>>&)>& func )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Base<Field>> C;
+    const Int m = H.Height();
+    const Int k = R0.Height();
+
+    Matrix<Field> T( H );
+    Matrix<C> w, S;
+    Eig( T, w, S );
+
+    Matrix<C> Z, SCopy( S );
+    Zeros( Z, m, k );
+    auto ZTop = Z( IR(0,k), ALL );
+    Promote( R0, ZTop );
+    LinearSolve( SCopy, Z );
+    for( Int i=0; i<m; ++i )
+    {
+        const C fLambda = func( w(i) );
+        for( Int j=0; j<k; ++j )
+            Z(i,j) *= fLambda;
+    }
+    Matrix<C> YC;
+    Zeros( YC, m, k );
+    Gemm( NORMAL, NORMAL, C(1), S, Z, C(0), YC );
+    Narrow( YC, Y );
+}
+
+template<typename Field>
+void Driver
+( const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const function<void(const Matrix<Field>&,Matrix<Field>&)>& applyA,
+  const function<void(const Matrix<Field>&,const Matrix<Field>&,
+                      Matrix<Field>&)>& coefficients,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = B.Height();
+    const Int k = B.Width();
+    const Real eps = limits::Epsilon<Real>();
+
+    vector<Matrix<Field>> V(1);
+    Matrix<Field> R0;
+    V[0] = B;
+    qr::Explicit( V[0], R0 );
+    if( FrobeniusNorm(R0) == Real(0) )
+    {
+        Zeros( X, n, k );
+        return;
+    }
+
+    Matrix<Field> H, W, C, R, Y, YOld;
+    Zeros( H, (ctrl.maxIts+1)*k, ctrl.maxIts*k );
+    for( Int j=0; j<ctrl.maxIts; ++j )
+    {
+        const Range<Int> indj( j*k, (j+1)*k );
+        Zeros( W, n, k );
+        applyA( V[j], W );
+        for( Int pass=0; pass<2; ++pass )
+        {
+            for( Int i=0; i<=j; ++i )
+            {
+                Zeros( C, k, k );
+                Gemm( ADJOINT, NORMAL, Field(1), V[i], W, Field(0), C );
+                Gemm( NORMAL, NORMAL, Field(-1), V[i], C, Field(1), W );
+                auto Hij = H( IR(i*k,(i+1)*k), indj );
+                Hij += C;
+            }
+        }
+        qr::Explicit( W, R );
+        auto HSub = H( IR((j+1)*k,(j+2)*k), indj );
+        HSub = R;
+
+        const Int m = (j+1)*k;
+        coefficients( H(IR(0,m),IR(0,m)), R0, Y );
+        Matrix<Field> E( Y );
+        if( j > 0 )
+        {
+            auto ETop = E( IR(0,j*k), ALL );
+            ETop -= YOld;
+        }
+        const Real normY = FrobeniusNorm( Y );
+        const Real change = FrobeniusNorm( E ) / normY;
+        // An (numerically) invariant subspace yields the exact result
+        const Real normH = FrobeniusNorm( H(IR(0,m+k),IR(0,m)) );
+        const bool invariant = FrobeniusNorm( R ) <= eps*normH;
+        if( ctrl.progress )
+            Output("step ",j,": relative change ",change);
+        if( invariant || (j > 0 && change <= ctrl.relTol) )
+        {
+            Zeros( X, n, k );
+            for( Int i=0; i<=j; ++i )
+                Gemm
+                ( NORMAL, NORMAL, Field(1), V[i], Y(IR(i*k,(i+1)*k),ALL),
+                  Field(1), X );
+            return;
+        }
+        V.push_back( W );
+        YOld = Y;
+    }
+    RuntimeError
+    ("Block Krylov approximation of f(A) B did not converge in ",ctrl.maxIts,
+     " steps");
+}
+
+template<typename Field>
+void Driver
+( const DistMatrix<Field>& B,
+        DistMatrix<Field>& X,
+  const function<void(const DistMatrix<Field>&,DistMatrix<Field>&)>& applyA,
+  const function<void(const Matrix<Field>&,const Matrix<Field>&,
+                      Matrix<Field>&)>& coefficients,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = B.Grid();
+    const Int n = B.Height();
+    const Int k = B.Width();
+    const Real eps = limits::Epsilon<Real>();
+
+    // The basis is distributed while the small projected problem is stored
+    // (and solved) redundantly
+    vector<DistMatrix<Field>> V( 1, DistMatrix<Field>(g) );
+    DistMatrix<Field> RDist(g);
+    V[0] = B;
+    qr::Explicit( V[0], RDist );
+    Matrix<Field> R0;
+    {
+        DistMatrix<Field,STAR,STAR> R_STAR_STAR( RDist );
+        R0 = R_STAR_STAR.Matrix();
+    }
+    if( FrobeniusNorm(R0) == Real(0) )
+    {
+        Zeros( X, n, k );
+        return;
+    }
+
+    DistMatrix<Field> W(g), C(g);
+    DistMatrix<Field,STAR,STAR> C_STAR_STAR(g), Y_STAR_STAR(g);
+    Matrix<Field> H, R, Y, YOld;
+    Zeros( H, (ctrl.maxIts+1)*k, ctrl.maxIts*k );
+    for( Int j=0; j<ctrl.maxIts; ++j )
+    {
+        const Range<Int> indj( j*k, (j+1)*k );
+        Zeros( W, n, k );
+        applyA( V[j], W );
+        for( Int pass=0; pass<2; ++pass )
+        {
+            for( Int i=0; i<=j; ++i )
+            {
+                Zeros( C, k, k );
+                Gemm( ADJOINT, NORMAL, Field(1), V[i], W, Field(0), C );
+                Gemm( NORMAL, NORMAL, Field(-1), V[i], C, Field(1), W );
+                C_STAR_STAR = C;
+                auto Hij = H( IR(i*k,(i+1)*k), indj );
+                Hij += C_STAR_STAR.Matrix();
+            }
+        }
+        qr::Explicit( W, RDist );
+        C_STAR_STAR = RDist;
+        R = C_STAR_STAR.Matrix();
+        auto HSub = H( IR((j+1)*k,(j+2)*k), indj );
+        HSub = R;
+
+        const Int m = (j+1)*k;
+        coefficients( H(IR(0,m),IR(0,m)), R0, Y );
+        Matrix<Field> E( Y );
+        if( j > 0 )
+        {
+            auto ETop = E( IR(0,j*k), ALL );
+            ETop -= YOld;
+        }
+        const Real normY = FrobeniusNorm( Y );
+        const Real change = FrobeniusNorm( E ) / normY;
+        const Real normH = FrobeniusNorm( H(IR(0,m+k),IR(0,m)) );
+        const bool invariant = FrobeniusNorm( R ) <= eps*normH;
+        if( ctrl.progress )
+            OutputFromRoot(g.Comm(),"step ",j,": relative change ",change);
+        if( invariant || (j > 0 && change <= ctrl.relTol) )
+        {
+            Y_STAR_STAR.Resize( m, k );
+            Y_STAR_STAR.Matrix() = Y;
+            DistMatrix<Field> YDist( Y_STAR_STAR );
+            Zeros( X, n, k );
+            for( Int i=0; i<=j; ++i )
+                Gemm
+                ( NORMAL, NORMAL, Field(1), V[i], YDist(IR(i*k,(i+1)*k),ALL),
+                  Field(1), X );
+            return;
+        }
+        V.push_back( W );
+        YOld = Y;
+    }
+    RuntimeError
+    ("Block Krylov approximation of f(A) B did not converge in ",ctrl.maxIts,
+     " steps");
+}
+
+} // namespace krylov_func
+
+template<typename Field>
+void HermitianFunctionTimes
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  function<Base<Field>(const Base<Field>&)> func,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Hermitian matrices must be square");
+    if( A.Height() != B.Height() )
+        LogicError("A and B must have the same height");
+    auto applyA = [&]( const Matrix<Field>& V, Matrix<Field>& W )
+      { Hemm( LEFT, uplo, Field(1), A, V, Field(0), W ); };
+    auto coefficients =
+      [&]( const Matrix<Field>& H, const Matrix<Field>& R0, Matrix<Field>& Y )
+      { krylov_func::HermitianCoefficients( H, R0, Y, func ); };
+    krylov_func::Driver<Field>( B, X, applyA, coefficients, ctrl );
+}
+
+template<typename Field>
+void HermitianFunctionTimes
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& APre,
+  const AbstractDistMatrix<Field>& BPre,
+        AbstractDistMatrix<Field>& XPre,
+  function<Base<Field>(const Base<Field>&)> func,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( APre.Height() != APre.Width() )
+        LogicError("Hermitian matrices must be square");
+    if( APre.Height() != BPre.Height() )
+        LogicError("A and B must have the same height");
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre ), BProx( BPre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> XProx( XPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& X = XProx.Get();
+    auto applyA = [&]( const DistMatrix<Field>& V, DistMatrix<Field>& W )
+      { Hemm( LEFT, uplo, Field(1), A, V, Field(0), W ); };
+    auto coefficients =
+      [&]( const Matrix<Field>& H, const Matrix<Field>& R0, Matrix<Field>& Y )
+      { krylov_func::HermitianCoefficients( H, R0, Y, func ); };
+    krylov_func::Driver<Field>( B, X, applyA, coefficients, ctrl );
+}
+
+template<typename Field>
+void MatrixFunctionTimes
+( const Matrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  function<Complex<Base<Field>>(const Complex<Base<Field>>&)> func,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( A.Height() != B.Height() )
+        LogicError("A and B must have the same height");
+    auto applyA = [&]( const Matrix<Field>& V, Matrix<Field>& W )
+      { Gemm( NORMAL, NORMAL, Field(1), A, V, Field(0), W ); };
+    auto coefficients =
+      [&]( const Matrix<Field>& H, const Matrix<Field>& R0, Matrix<Field>& Y )
+      { krylov_func::GeneralCoefficients( H, R0, Y, func ); };
+    krylov_func::Driver<Field>( B, X, applyA, coefficients, ctrl );
+}
+
+template<typename Field>
+void MatrixFunctionTimes
+( const AbstractDistMatrix<Field>& APre,
+  const AbstractDistMatrix<Field>& BPre,
+        AbstractDistMatrix<Field>& XPre,
+  function<Complex<Base<Field>>(const Complex<Base<Field>>&)> func,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( APre.Height() != APre.Width() )
+        LogicError("A must be square");
+    if( APre.Height() != BPre.Height() )
+        LogicError("A and B must have the same height");
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre ), BProx( BPre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> XProx( XPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& X = XProx.Get();
+    auto applyA = [&]( const DistMatrix<Field>& V, DistMatrix<Field>& W )
+      { Gemm( NORMAL, NORMAL, Field(1), A, V, Field(0), W ); };
+    auto coefficients =
+      [&]( const Matrix<Field>& H, const Matrix<Field>& R0, Matrix<Field>& Y )
+      { krylov_func::GeneralCoefficients( H, R0, Y, func ); };
+    krylov_func::Driver<Field>( B, X, applyA, coefficients, ctrl );
+}
+
+#define PROTO(Field) \
+  template void HermitianFunctionTimes \
+  ( UpperOrLower uplo, \
+    const Matrix<Field>& A, \
+    const Matrix<Field>& B, \
+          Matrix<Field>& X, \
+    function<Base<Field>(const Base<Field>&)> func, \
+    const KrylovFunctionCtrl<Base<Field>>& ctrl ); \
+  template void HermitianFunctionTimes \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Field>& B, \
+          AbstractDistMatrix<Field>& X, \
+    function<Base<Field>(const Base<Field>&)> func, \
+    const KrylovFunctionCtrl<Base<Field>>& ctrl ); \
+  template void MatrixFunctionTimes \
+  ( const Matrix<Field>& A, \
+    const Matrix<Field>& B, \
+          Matrix<Field>& X, \
+    function<Complex<Base<Field>>(const Complex<Base<Field>>&)> func, \
+    const KrylovFunctionCtrl<Base<Field>>& ctrl ); \
+  template void MatrixFunctionTimes \
+  ( const AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Field>& B, \
+          AbstractDistMatrix<Field>& X, \
+    function<Complex<Base<Field>>(const Complex<Base<Field>>&)> func, \
+    const KrylovFunctionCtrl<Base<Field>>& ctrl );
+
+// The general case relies upon Eig, which is only instantiated for the
+// standard datatypes
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 
+#include "./General/GaussJordan.hpp"
 #include "./General/LUPartialPiv.hpp"
 
 namespace El {
@@ -40,7 +41,9 @@ void LocalInverse( DistMatrix<Field,STAR,STAR>& A )
   template void inverse::AfterLUPartialPiv \
   ( Matrix<Field>& A, const Permutation& P ); \
   template void inverse::AfterLUPartialPiv \
-  ( AbstractDistMatrix<Field>& A, const DistPermutation& P );
+  ( AbstractDistMatrix<Field>& A, const DistPermutation& P ); \
+  template void inverse::GaussJordan( Matrix<Field>& A ); \
+  template void inverse::GaussJordan( AbstractDistMatrix<Field>& A );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
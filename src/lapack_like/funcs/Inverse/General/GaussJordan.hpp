@@ -0,0 +1,226 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_INVERSE_GAUSSJORDAN_HPP
+#define EL_INVERSE_GAUSSJORDAN_HPP
+
+namespace El {
+namespace inverse {
+
+// Blocked Gauss-Jordan elimination with partial pivoting, in the spirit of
+// Quintana-Orti et al.'s "A note on parallel matrix inversion". At step k,
+// the column panel below the diagonal is factored as P_k [A11; A21] =
+// [L1; L2] U (with the row interchanges applied to the entire rows), and the
+// elimination matrix for block column k is stored in place of that column:
+//
+//   | A01 |     | -A01 inv(A11) |
+//   | A11 | :=  |      inv(A11) |,
+//   | A21 |     | -A21 inv(A11) |
+//
+// after every other block column J is updated as
+//
+//   A1J := inv(A11) A1J, A0J -= A01 A1J, A2J -= A21 inv(A11) A1J_old.
+//
+// Unlike the LU/TriangularInverse/Trsm approach, the matrix is traversed
+// only once and nearly all of the work is in a single rank-nb update of the
+// entire matrix per step. Since the result is inv(P A) = inv(A) inv(P), the
+// accumulated row interchanges are finally applied to the columns.
+
+template<typename Field>
+void GaussJordanUpdate
+( const Matrix<Field>& LU11,
+  const Matrix<Field>& A01,
+  const Matrix<Field>& A21,
+        Matrix<Field>& A0J,
+        Matrix<Field>& A1J,
+        Matrix<Field>& A2J )
+{
+    EL_DEBUG_CSE
+    Trsm( LEFT, LOWER, NORMAL, UNIT, Field(1), LU11, A1J );
+    Gemm( NORMAL, NORMAL, Field(-1), A21, A1J, Field(1), A2J );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), LU11, A1J );
+    Gemm( NORMAL, NORMAL, Field(-1), A01, A1J, Field(1), A0J );
+}
+
+template<typename Field>
+void GaussJordan( Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Cannot invert non-square matrices");
+    const Int n = A.Height();
+
+    Permutation P, PB;
+    P.MakeIdentity( n );
+    P.ReserveSwaps( n );
+
+    Matrix<Field> LU11;
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const IR ind0( 0, k ), ind1( k, k+nb ), ind2( k+nb, END ),
+                 indB( k, END );
+
+        auto A01 = A( ind0, ind1 );
+        auto A11 = A( ind1, ind1 );
+        auto A21 = A( ind2, ind1 );
+
+        auto AB0 = A( indB, ind0 );
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+
+        LU( AB1, PB );
+        P.SwapSequence( PB, k );
+        PB.PermuteRows( AB0 );
+        PB.PermuteRows( AB2 );
+        LU11 = A11;
+
+        // Update the block columns to the left and right of the panel
+        for( const IR& indJ : { ind0, ind2 } )
+        {
+            auto A0J = A( ind0, indJ );
+            auto A1J = A( ind1, indJ );
+            auto A2J = A( ind2, indJ );
+            GaussJordanUpdate( LU11, A01, A21, A0J, A1J, A2J );
+        }
+
+        // Overwrite the panel with the elimination matrix
+        Trsm( RIGHT, LOWER, NORMAL, UNIT, Field(-1), LU11, A21 );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(-1), LU11, A01 );
+        Trsm( RIGHT, LOWER, NORMAL, UNIT, Field(1), LU11, A01 );
+        Identity( A11, nb, nb );
+        Trsm( LEFT, LOWER, NORMAL, UNIT, Field(1), LU11, A11 );
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), LU11, A11 );
+    }
+
+    // inv(A) := inv(P A) P
+    P.InversePermuteCols( A );
+}
+
+template<typename Field>
+void GaussJordanUpdate
+( const DistMatrix<Field,STAR,STAR>& LU11,
+  const DistMatrix<Field,MC,  STAR>& A01_MC_STAR,
+  const DistMatrix<Field,MC,  STAR>& A21_MC_STAR,
+        DistMatrix<Field>& A0J,
+        DistMatrix<Field>& A1J,
+        DistMatrix<Field>& A2J )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A1J.Grid();
+    DistMatrix<Field,STAR,VR> A1J_STAR_VR(g);
+    DistMatrix<Field,STAR,MR> A1J_STAR_MR(g);
+
+    A1J_STAR_VR.AlignWith( A2J );
+    A1J_STAR_VR = A1J;
+    LocalTrsm
+    ( LEFT, LOWER, NORMAL, UNIT, Field(1), LU11, A1J_STAR_VR );
+    A1J_STAR_MR.AlignWith( A2J );
+    A1J_STAR_MR = A1J_STAR_VR;
+    LocalGemm
+    ( NORMAL, NORMAL, Field(-1), A21_MC_STAR, A1J_STAR_MR, Field(1), A2J );
+
+    LocalTrsm
+    ( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), LU11, A1J_STAR_VR );
+    A1J_STAR_MR = A1J_STAR_VR;
+    LocalGemm
+    ( NORMAL, NORMAL, Field(-1), A01_MC_STAR, A1J_STAR_MR, Field(1), A0J );
+    A1J = A1J_STAR_MR;
+}
+
+template<typename Field>
+void GaussJordan( AbstractDistMatrix<Field>& APre )
+{
+    EL_DEBUG_CSE
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    if( A.Height() != A.Width() )
+        LogicError("Cannot invert non-square matrices");
+    const Int n = A.Height();
+
+    const Grid& g = A.Grid();
+    DistPermutation P(g), PB(g);
+    P.MakeIdentity( n );
+    P.ReserveSwaps( n );
+
+    DistMatrix<Field,STAR,STAR> LU11_STAR_STAR(g), A11_STAR_STAR(g);
+    DistMatrix<Field,MC,  STAR> A01_MC_STAR(g), A21_MC_STAR(g);
+    DistMatrix<Field,VC,  STAR> A01_VC_STAR(g), A21_VC_STAR(g);
+
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const IR ind0( 0, k ), ind1( k, k+nb ), ind2( k+nb, END ),
+                 indB( k, END );
+
+        auto A01 = A( ind0, ind1 );
+        auto A11 = A( ind1, ind1 );
+        auto A21 = A( ind2, ind1 );
+
+        auto AB0 = A( indB, ind0 );
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+
+        LU( AB1, PB );
+        P.SwapSequence( PB, k );
+        PB.PermuteRows( AB0 );
+        PB.PermuteRows( AB2 );
+
+        // The panel is replicated once and reused for both of the
+        // remaining block columns
+        LU11_STAR_STAR = A11;
+        A01_MC_STAR.AlignWith( A );
+        A01_MC_STAR = A01;
+        A21_MC_STAR.AlignWith( A21 );
+        A21_MC_STAR = A21;
+        for( const IR& indJ : { ind0, ind2 } )
+        {
+            auto A0J = A( ind0, indJ );
+            auto A1J = A( ind1, indJ );
+            auto A2J = A( ind2, indJ );
+            GaussJordanUpdate
+            ( LU11_STAR_STAR, A01_MC_STAR, A21_MC_STAR, A0J, A1J, A2J );
+        }
+
+        // Overwrite the panel with the elimination matrix
+        A21_VC_STAR.AlignWith( A21 );
+        A21_VC_STAR = A21_MC_STAR;
+        LocalTrsm
+        ( RIGHT, LOWER, NORMAL, UNIT, Field(-1), LU11_STAR_STAR, A21_VC_STAR );
+        A21 = A21_VC_STAR;
+
+        A01_VC_STAR.AlignWith( A01 );
+        A01_VC_STAR = A01_MC_STAR;
+        LocalTrsm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT,
+          Field(-1), LU11_STAR_STAR, A01_VC_STAR );
+        LocalTrsm
+        ( RIGHT, LOWER, NORMAL, UNIT, Field(1), LU11_STAR_STAR, A01_VC_STAR );
+        A01 = A01_VC_STAR;
+
+        Identity( A11_STAR_STAR, nb, nb );
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, UNIT, Field(1), LU11_STAR_STAR, A11_STAR_STAR );
+        LocalTrsm
+        ( LEFT, UPPER, NORMAL, NON_UNIT,
+          Field(1), LU11_STAR_STAR, A11_STAR_STAR );
+        A11 = A11_STAR_STAR;
+    }
+
+    // inv(A) := inv(P A) P
+    P.InversePermuteCols( A );
+}
+
+} // namespace inverse
+} // namespace El
+
+#endif // ifndef EL_INVERSE_GAUSSJORDAN_HPP
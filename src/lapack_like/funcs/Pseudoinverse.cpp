@@ -140,10 +140,53 @@ void HermitianPseudoinverse
     HermitianFromEVD( uplo, A, w, Z );
 }
 
+// Replace A with W inv(T) U^H, where A ~= U T W^H is a rank-revealing
+// factorization
+
+template<typename Field>
+void Pseudoinverse( Matrix<Field>& A, const RankRevealCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == RANK_REVEAL_SVD )
+    {
+        Pseudoinverse( A, ctrl.tol );
+        return;
+    }
+    Matrix<Field> U, T, W;
+    RankReveal( A, U, T, W, ctrl );
+
+    // U := U inv(T)^H, so that pinvA = W U^H
+    Trsm( RIGHT, UPPER, ADJOINT, NON_UNIT, Field(1), T, U );
+    Gemm( NORMAL, ADJOINT, Field(1), W, U, A );
+}
+
+template<typename Field>
+void Pseudoinverse
+( AbstractDistMatrix<Field>& A, const RankRevealCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == RANK_REVEAL_SVD )
+    {
+        Pseudoinverse( A, ctrl.tol );
+        return;
+    }
+    const Grid& g = A.Grid();
+    DistMatrix<Field> U(g), T(g), W(g);
+    RankReveal( A, U, T, W, ctrl );
+
+    // U := U inv(T)^H, so that pinvA = W U^H
+    Trsm( RIGHT, UPPER, ADJOINT, NON_UNIT, Field(1), T, U );
+    Gemm( NORMAL, ADJOINT, Field(1), W, U, A );
+}
+
 #define PROTO(Field) \
   template void Pseudoinverse( Matrix<Field>& A, Base<Field> tolerance ); \
   template void Pseudoinverse \
   ( AbstractDistMatrix<Field>& A, Base<Field> tolerance ); \
+  template void Pseudoinverse \
+  ( Matrix<Field>& A, const RankRevealCtrl<Base<Field>>& ctrl ); \
+  template void Pseudoinverse \
+  ( AbstractDistMatrix<Field>& A, const RankRevealCtrl<Base<Field>>& ctrl ); \
   template void HermitianPseudoinverse \
   ( UpperOrLower uplo, Matrix<Field>& A, Base<Field> tolerance ); \
   template void HermitianPseudoinverse \
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "../spectral/Pseudospectra/Farm.hpp"
 
 // See Chapter 5 of Nicholas J. Higham's "Functions of Matrices: Theory and
 // Computation", which is currently available at:
@@ -28,15 +29,21 @@ NewtonStep
 
     // Calculate mu while forming XNew := inv(X)
     Real mu=1;
-    Permutation P;
     XNew = X;
-    LU( XNew, P );
     if( scaling == SIGN_SCALE_DET )
     {
+        Permutation P;
+        LU( XNew, P );
         SafeProduct<Field> det = det::AfterLUPartialPiv( XNew, P );
         mu = Real(1)/Exp(det.kappa);
+        inverse::AfterLUPartialPiv( XNew, P );
+    }
+    else
+    {
+        // The single-sweep Gauss-Jordan inversion avoids the separate
+        // triangular inversion and solve of the LU-based approach
+        inverse::GaussJordan( XNew );
     }
-    inverse::AfterLUPartialPiv( XNew, P );
     if( scaling == SIGN_SCALE_FROB )
         mu = Sqrt( FrobeniusNorm(XNew)/FrobeniusNorm(X) );
 
@@ -59,15 +66,21 @@ NewtonStep
 
     // Calculate mu while forming B := inv(X)
     Real mu=1;
-    DistPermutation P( X.Grid() );
     XNew = X;
-    LU( XNew, P );
     if( scaling == SIGN_SCALE_DET )
     {
+        DistPermutation P( X.Grid() );
+        LU( XNew, P );
         SafeProduct<Field> det = det::AfterLUPartialPiv( XNew, P );
         mu = Real(1)/Exp(det.kappa);
+        inverse::AfterLUPartialPiv( XNew, P );
+    }
+    else
+    {
+        // The single-sweep Gauss-Jordan inversion avoids the separate
+        // triangular inversion and solve of the LU-based approach
+        inverse::GaussJordan( XNew );
     }
-    inverse::AfterLUPartialPiv( XNew, P );
     if( scaling == SIGN_SCALE_FROB )
         mu = Sqrt( FrobeniusNorm(XNew)/FrobeniusNorm(X) );
 
@@ -78,42 +91,190 @@ NewtonStep
     Axpy( halfMu, X, XNew );
 }
 
+// Form R := I - X^2 and return || R ||_1
+template<typename Field>
+Base<Field>
+Residual( const Matrix<Field>& X, Matrix<Field>& R )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height();
+    Identity( R, n, n );
+    Gemm( NORMAL, NORMAL, Field(-1), X, X, Field(1), R );
+    return OneNorm( R );
+}
+
+template<typename Field>
+Base<Field>
+Residual( const DistMatrix<Field>& X, DistMatrix<Field>& R )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height();
+    Identity( R, n, n );
+    Gemm( NORMAL, NORMAL, Field(-1), X, X, Field(1), R );
+    return OneNorm( R );
+}
+
+// Given R = I - X^2, form XNew := 1/2 X (3I - X^2) = X + 1/2 X R, which only
+// requires a single Gemm
 template<typename Field>
 void
 NewtonSchulzStep
 ( const Matrix<Field>& X,
-        Matrix<Field>& XTmp,
+  const Matrix<Field>& R,
         Matrix<Field>& XNew )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
-    const Int n = X.Height();
-
-    // XTmp := 3I - X^2
-    Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
-
-    // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    XNew = X;
+    Gemm( NORMAL, NORMAL, Field(1)/Field(2), X, R, Field(1), XNew );
 }
 
 template<typename Field>
 void
 NewtonSchulzStep
 ( const DistMatrix<Field>& X,
-        DistMatrix<Field>& XTmp,
+  const DistMatrix<Field>& R,
         DistMatrix<Field>& XNew )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
+    XNew = X;
+    Gemm( NORMAL, NORMAL, Field(1)/Field(2), X, R, Field(1), XNew );
+}
+
+// The principal Pade iteration of order m can be written in the
+// partial-fraction form
+//
+//   X := (1/m) sum_{i=1}^m (1/xi_i) inv(X^2 + alpha_i^2 I) X,
+//
+// where xi_i = (1 + cos((2i-1) pi/(2m)))/2 and alpha_i^2 = 1/xi_i - 1
+// (see Kenney and Laub, "Rational iterative methods for the matrix sign
+// function"). Its error is raised to the (2m)'th power each iteration and
+// the m shifted solves are independent of each other.
+template<typename Real>
+void PadeCoefficients( Int m, vector<Real>& xi, vector<Real>& alphaSq )
+{
+    EL_DEBUG_CSE
+    xi.resize( m );
+    alphaSq.resize( m );
+    for( Int i=0; i<m; ++i )
+    {
+        xi[i] = (1 + Cos(Real(2*i+1)*Pi<Real>()/Real(2*m))) / 2;
+        alphaSq[i] = 1/xi[i] - 1;
+    }
+}
+
+// Add the terms i = first, first+stride, ... of the Pade iteration to XNew
+template<typename Field>
+void PadeTerms
+( const Matrix<Field>& X,
+  const Matrix<Field>& XSquared,
+        Matrix<Field>& XNew,
+  Int first, Int stride,
+  const vector<Base<Field>>& xi,
+  const vector<Base<Field>>& alphaSq )
+{
+    EL_DEBUG_CSE
+    const Int m = xi.size();
+    Matrix<Field> T, Y;
+    for( Int i=first; i<m; i+=stride )
+    {
+        T = XSquared;
+        ShiftDiagonal( T, Field(alphaSq[i]) );
+        Y = X;
+        LinearSolve( T, Y );
+        Axpy( Field(1)/(Field(m)*xi[i]), Y, XNew );
+    }
+}
+
+template<typename Field>
+void PadeTerms
+( const DistMatrix<Field>& X,
+  const DistMatrix<Field>& XSquared,
+        DistMatrix<Field>& XNew,
+  Int first, Int stride,
+  const vector<Base<Field>>& xi,
+  const vector<Base<Field>>& alphaSq )
+{
+    EL_DEBUG_CSE
+    const Int m = xi.size();
+    DistMatrix<Field> T( X.Grid() ), Y( X.Grid() );
+    for( Int i=first; i<m; i+=stride )
+    {
+        T = XSquared;
+        ShiftDiagonal( T, Field(alphaSq[i]) );
+        Y = X;
+        LinearSolve( T, Y );
+        Axpy( Field(1)/(Field(m)*xi[i]), Y, XNew );
+    }
+}
+
+template<typename Field>
+void PadeStep
+( const Matrix<Field>& X,
+        Matrix<Field>& XNew,
+  const vector<Base<Field>>& xi,
+  const vector<Base<Field>>& alphaSq )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height();
+    Matrix<Field> XSquared;
+    Zeros( XSquared, n, n );
+    Gemm( NORMAL, NORMAL, Field(1), X, X, Field(0), XSquared );
+    Zeros( XNew, n, n );
+    PadeTerms( X, XSquared, XNew, 0, 1, xi, alphaSq );
+}
+
+// When there are several subgrids, each holds a copy of X and X^2 and
+// computes every numSubgrids'th term, and the partial sums are then
+// accumulated on the full grid
+template<typename Field>
+void PadeStep
+( const DistMatrix<Field>& X,
+        DistMatrix<Field>& XNew,
+  const vector<Base<Field>>& xi,
+  const vector<Base<Field>>& alphaSq,
+  const vector<unique_ptr<Grid>>& subgrids,
+        Int mySubgrid )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = X.Grid();
     const Int n = X.Height();
+    DistMatrix<Field> XSquared( grid );
+    Zeros( XSquared, n, n );
+    Gemm( NORMAL, NORMAL, Field(1), X, X, Field(0), XSquared );
+    Zeros( XNew, n, n );
+
+    const Int numSubgrids = subgrids.size();
+    if( numSubgrids <= 1 )
+    {
+        PadeTerms( X, XSquared, XNew, 0, 1, xi, alphaSq );
+        return;
+    }
 
-    // XTmp := 3I - X^2
-    Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    const Grid& subgrid = *subgrids[mySubgrid];
+    DistMatrix<Field> XSub( subgrid ), XSquaredSub( subgrid ),
+                      XNewSub( subgrid );
+    pspec::Replicate( X, subgrids, mySubgrid, XSub );
+    pspec::Replicate( XSquared, subgrids, mySubgrid, XSquaredSub );
+    Zeros( XNewSub, n, n );
+    PadeTerms
+    ( XSub, XSquaredSub, XNewSub, mySubgrid, numSubgrids, xi, alphaSq );
 
-    // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    DistMatrix<Field> T( grid );
+    for( Int q=0; q<numSubgrids; ++q )
+    {
+        if( q == mySubgrid )
+        {
+            T = XNewSub;
+        }
+        else
+        {
+            // Only the members of subgrid q contribute data
+            DistMatrix<Field> XNewOther( *subgrids[q] );
+            XNewOther.Resize( n, n );
+            T = XNewOther;
+        }
+        XNew += T;
+    }
 }
 
 // Please see Chapter 5 of Higham's
@@ -197,7 +358,524 @@ Newton( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
     return numIts;
 }
 
-// TODO: NewtonSchulzHybrid which estimates when || X^2 - I ||_2 < 1
+// Newton's iteration requires an inversion per step, whereas the
+// Newton-Schulz iteration only requires two Gemm's but is only (locally)
+// convergent when || I - X^2 || < 1. We therefore run scaled Newton steps
+// until the relative change in the iterates drops below ctrl.switchTol, at
+// which point || I - X^2 ||_1 is computed and, if it is also below
+// ctrl.switchTol, we switch to Newton-Schulz (falling back to Newton should
+// the residual ever exceed one).
+template<typename Field>
+Int
+NewtonSchulzHybrid( Matrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = A.Height()*limits::Epsilon<Real>();
+
+    Int numIts=0;
+    bool schulz=false, haveResidual=false;
+    Matrix<Field> B, R;
+    Matrix<Field> *X=&A, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        if( schulz )
+        {
+            if( !haveResidual && Residual( *X, R ) >= Real(1) )
+                schulz = false;
+            haveResidual = false;
+        }
+        if( schulz )
+            NewtonSchulzStep( *X, R, *XNew );
+        else
+            NewtonStep( *X, *XNew, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress )
+            cout << "after " << numIts << " hybrid iter's ("
+                 << (schulz ? "Newton-Schulz" : "Newton") << "): "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+        if( !schulz && oneDiff/oneNew <= ctrl.switchTol )
+        {
+            schulz = haveResidual = ( Residual( *X, R ) <= ctrl.switchTol );
+        }
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
+
+template<typename Field>
+Int
+NewtonSchulzHybrid( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = A.Height()*limits::Epsilon<Real>();
+
+    Int numIts=0;
+    bool schulz=false, haveResidual=false;
+    DistMatrix<Field> B( A.Grid() ), R( A.Grid() );
+    DistMatrix<Field> *X=&A, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        if( schulz )
+        {
+            if( !haveResidual && Residual( *X, R ) >= Real(1) )
+                schulz = false;
+            haveResidual = false;
+        }
+        if( schulz )
+            NewtonSchulzStep( *X, R, *XNew );
+        else
+            NewtonStep( *X, *XNew, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress && A.Grid().Rank() == 0 )
+            cout << "after " << numIts << " hybrid iter's ("
+                 << (schulz ? "Newton-Schulz" : "Newton") << "): "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+        if( !schulz && oneDiff/oneNew <= ctrl.switchTol )
+        {
+            schulz = haveResidual = ( Residual( *X, R ) <= ctrl.switchTol );
+        }
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
+
+// Unless scaling is disabled, the first step is a scaled Newton step so that
+// the eigenvalues are brought near the unit circle before the Pade
+// iterations begin
+template<typename Field>
+Int
+Pade( Matrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( ctrl.padeOrder < 1 )
+        LogicError("The Pade order must be positive");
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = A.Height()*limits::Epsilon<Real>();
+    vector<Real> xi, alphaSq;
+    PadeCoefficients( ctrl.padeOrder, xi, alphaSq );
+
+    Int numIts=0;
+    Matrix<Field> B;
+    Matrix<Field> *X=&A, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        if( numIts == 0 && ctrl.scaling != SIGN_SCALE_NONE )
+            NewtonStep( *X, *XNew, ctrl.scaling );
+        else
+            PadeStep( *X, *XNew, xi, alphaSq );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress )
+            cout << "after " << numIts << " Pade iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
+
+template<typename Field>
+Int
+Pade( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( ctrl.padeOrder < 1 )
+        LogicError("The Pade order must be positive");
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = A.Height()*limits::Epsilon<Real>();
+    vector<Real> xi, alphaSq;
+    PadeCoefficients( ctrl.padeOrder, xi, alphaSq );
+
+    const Grid& grid = A.Grid();
+    const Int numSubgrids =
+      Max( Min( Min( ctrl.numSubgrids, ctrl.padeOrder ), Int(grid.Size()) ),
+           Int(1) );
+    vector<unique_ptr<Grid>> subgrids;
+    Int mySubgrid = 0;
+    if( numSubgrids > 1 )
+        mySubgrid = pspec::FarmGrids( grid, numSubgrids, subgrids );
+
+    Int numIts=0;
+    DistMatrix<Field> B( grid );
+    DistMatrix<Field> *X=&A, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        if( numIts == 0 && ctrl.scaling != SIGN_SCALE_NONE )
+            NewtonStep( *X, *XNew, ctrl.scaling );
+        else
+            PadeStep( *X, *XNew, xi, alphaSq, subgrids, mySubgrid );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress && grid.Rank() == 0 )
+            cout << "after " << numIts << " Pade iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
+
+// Fall back to iterations with fewer n x n temporaries (each of which holds
+// 1/numProcs of its entries on each process) when those of the requested
+// iteration would not fit within the memory budget
+template<typename Field>
+SignCtrl<Base<Field>>
+BudgetedCtrl( Int n, Int numProcs, SignCtrl<Base<Field>> ctrl )
+{
+    EL_DEBUG_CSE
+    if( MemoryBudget() == 0 )
+        return ctrl;
+    const double matrixBytes = double(n)*n*sizeof(Field)/numProcs;
+    if( ctrl.method == SIGN_PADE )
+    {
+        // Each subgrid holds its own copies of X, X^2, and its partial sum
+        while( ctrl.numSubgrids > 1 &&
+               !FitsMemoryBudget( (6+3*ctrl.numSubgrids)*matrixBytes ) )
+            --ctrl.numSubgrids;
+        if( FitsMemoryBudget( 9*matrixBytes ) )
+            return ctrl;
+        ctrl.method = SIGN_NEWTON_SCHULZ_HYBRID;
+    }
+    if( ctrl.method == SIGN_NEWTON_SCHULZ_HYBRID &&
+        !FitsMemoryBudget( 3*matrixBytes ) )
+        ctrl.method = SIGN_NEWTON;
+    return ctrl;
+}
+
+template<typename Field>
+Int
+Iterate( Matrix<Field>& A, const SignCtrl<Base<Field>>& ctrlPre )
+{
+    EL_DEBUG_CSE
+    const auto ctrl = BudgetedCtrl<Field>( A.Height(), 1, ctrlPre );
+    switch( ctrl.method )
+    {
+    case SIGN_NEWTON: return Newton( A, ctrl );
+    case SIGN_NEWTON_SCHULZ_HYBRID: return NewtonSchulzHybrid( A, ctrl );
+    case SIGN_PADE: return Pade( A, ctrl );
+    default: LogicError("Unsupported sign method"); return 0;
+    }
+}
+
+template<typename Field>
+Int
+Iterate( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrlPre )
+{
+    EL_DEBUG_CSE
+    const auto ctrl =
+      BudgetedCtrl<Field>( A.Height(), A.Grid().Size(), ctrlPre );
+    switch( ctrl.method )
+    {
+    case SIGN_NEWTON: return Newton( A, ctrl );
+    case SIGN_NEWTON_SCHULZ_HYBRID: return NewtonSchulzHybrid( A, ctrl );
+    case SIGN_PADE: return Pade( A, ctrl );
+    default: LogicError("Unsupported sign method"); return 0;
+    }
+}
+
+// A matrix W of even order 2n is Hamiltonian when H = J W is Hermitian,
+// where J = [0, I; -I, 0]. Since inv(J) = -J, J inv(W) = J inv(H) J, and so
+// the scaled Newton iteration, X := (mu X + inv(X)/mu)/2, preserves the
+// structure and can be run on H = J X instead:
+//
+//   H := (mu H + J inv(H) J/mu)/2.
+//
+// inv(H) only requires a pivoted LDL^H factorization rather than an LU
+// factorization (roughly a third of the work), |det(X)| = |det(H)| can be
+// read off of the same factorization, and || X ||_p = || H ||_p for any of
+// the norms used below since J is a signed permutation.
+
+// Y := J X = [X21, X22; -X11, -X12], or Y := inv(J) X = -J X if 'inverse'
+template<typename Field>
+void ApplyJ( const Matrix<Field>& X, Matrix<Field>& Y, bool inverse=false )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height()/2;
+    const Range<Int> ind1(0,n), ind2(n,2*n);
+    const Field sgn = ( inverse ? Field(-1) : Field(1) );
+    Y.Resize( 2*n, 2*n );
+    auto YT = Y( ind1, ALL );
+    auto YB = Y( ind2, ALL );
+    YT = X( ind2, ALL );
+    YB = X( ind1, ALL );
+    YT *= sgn;
+    YB *= -sgn;
+}
+
+template<typename Field>
+void ApplyJ
+( const DistMatrix<Field>& X, DistMatrix<Field>& Y, bool inverse=false )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height()/2;
+    const Range<Int> ind1(0,n), ind2(n,2*n);
+    const Field sgn = ( inverse ? Field(-1) : Field(1) );
+    Y.Resize( 2*n, 2*n );
+    auto YT = Y( ind1, ALL );
+    auto YB = Y( ind2, ALL );
+    YT = X( ind2, ALL );
+    YB = X( ind1, ALL );
+    YT *= sgn;
+    YB *= -sgn;
+}
+
+// Y := J Y J = [-Y22, Y21; Y12, -Y11]
+template<typename Field>
+void ConjugateByJ( Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    const Int n = Y.Height()/2;
+    const Range<Int> ind1(0,n), ind2(n,2*n);
+    Matrix<Field> Z( Y );
+    auto Y11 = Y( ind1, ind1 );
+    auto Y12 = Y( ind1, ind2 );
+    auto Y21 = Y( ind2, ind1 );
+    auto Y22 = Y( ind2, ind2 );
+    Y11 = Z( ind2, ind2 );
+    Y12 = Z( ind2, ind1 );
+    Y21 = Z( ind1, ind2 );
+    Y22 = Z( ind1, ind1 );
+    Y11 *= -1;
+    Y22 *= -1;
+}
+
+template<typename Field>
+void ConjugateByJ( DistMatrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    const Int n = Y.Height()/2;
+    const Range<Int> ind1(0,n), ind2(n,2*n);
+    DistMatrix<Field> Z( Y );
+    auto Y11 = Y( ind1, ind1 );
+    auto Y12 = Y( ind1, ind2 );
+    auto Y21 = Y( ind2, ind1 );
+    auto Y22 = Y( ind2, ind2 );
+    Y11 = Z( ind2, ind2 );
+    Y12 = Z( ind2, ind1 );
+    Y21 = Z( ind1, ind2 );
+    Y22 = Z( ind1, ind1 );
+    Y11 *= -1;
+    Y22 *= -1;
+}
+
+template<typename Field>
+void
+HamiltonianNewtonStep
+( const Matrix<Field>& H,
+        Matrix<Field>& HNew,
+  SignScaling scaling=SIGN_SCALE_FROB )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    // Calculate mu while forming HNew := inv(H)
+    Real mu=1;
+    HNew = H;
+    Permutation P;
+    Matrix<Field> dSub;
+    LDL( HNew, dSub, P, true );
+    if( scaling == SIGN_SCALE_DET )
+    {
+        InertiaType inertia;
+        auto d = GetRealPartOfDiagonal( HNew );
+        SafeProduct<Real> det = ldl::DeterminantAndInertia( d, dSub, inertia );
+        mu = Real(1)/Exp(det.kappa);
+    }
+    TriangularInverse( LOWER, UNIT, HNew );
+    Trdtrmm( LOWER, HNew, dSub, true );
+    MakeHermitian( LOWER, HNew );
+    P.InversePermuteRows( HNew );
+    P.InversePermuteCols( HNew );
+    if( scaling == SIGN_SCALE_FROB )
+        mu = Sqrt( FrobeniusNorm(HNew)/FrobeniusNorm(H) );
+
+    // Overwrite HNew with the new iterate
+    ConjugateByJ( HNew );
+    const Real halfMu = mu/Real(2);
+    const Real halfMuInv = Real(1)/(2*mu);
+    HNew *= halfMuInv;
+    Axpy( halfMu, H, HNew );
+}
+
+template<typename Field>
+void
+HamiltonianNewtonStep
+( const DistMatrix<Field>& H,
+        DistMatrix<Field>& HNew,
+  SignScaling scaling=SIGN_SCALE_FROB )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = H.Grid();
+
+    // Calculate mu while forming HNew := inv(H)
+    Real mu=1;
+    HNew = H;
+    DistPermutation P( g );
+    DistMatrix<Field,MD,STAR> dSub( g );
+    LDL( HNew, dSub, P, true );
+    if( scaling == SIGN_SCALE_DET )
+    {
+        InertiaType inertia;
+        auto d = GetRealPartOfDiagonal( HNew );
+        SafeProduct<Real> det = ldl::DeterminantAndInertia( d, dSub, inertia );
+        mu = Real(1)/Exp(det.kappa);
+    }
+    TriangularInverse( LOWER, UNIT, HNew );
+    Trdtrmm( LOWER, HNew, dSub, true );
+    MakeHermitian( LOWER, HNew );
+    P.InversePermuteRows( HNew );
+    P.InversePermuteCols( HNew );
+    if( scaling == SIGN_SCALE_FROB )
+        mu = Sqrt( FrobeniusNorm(HNew)/FrobeniusNorm(H) );
+
+    // Overwrite HNew with the new iterate
+    ConjugateByJ( HNew );
+    const Real halfMu = mu/Real(2);
+    const Real halfMuInv = Real(1)/(2*mu);
+    HNew *= halfMuInv;
+    Axpy( halfMu, H, HNew );
+}
+
+template<typename Field>
+Int
+HamiltonianNewton( Matrix<Field>& H, const SignCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = H.Height()*limits::Epsilon<Real>();
+
+    Int numIts=0;
+    Matrix<Field> B;
+    Matrix<Field> *X=&H, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        HamiltonianNewtonStep( *X, *XNew, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress )
+            cout << "after " << numIts << " Hamiltonian Newton iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+    }
+    if( X != &H )
+        H = *X;
+    return numIts;
+}
+
+template<typename Field>
+Int
+HamiltonianNewton( DistMatrix<Field>& H, const SignCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = H.Height()*limits::Epsilon<Real>();
+
+    Int numIts=0;
+    DistMatrix<Field> B( H.Grid() );
+    DistMatrix<Field> *X=&H, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        HamiltonianNewtonStep( *X, *XNew, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress && H.Grid().Rank() == 0 )
+            cout << "after " << numIts << " Hamiltonian Newton iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+    }
+    if( X != &H )
+        H = *X;
+    return numIts;
+}
 
 } // namespace sign
 
@@ -205,7 +883,7 @@ template<typename Field>
 void Sign( Matrix<Field>& A, const SignCtrl<Base<Field>> ctrl )
 {
     EL_DEBUG_CSE
-    sign::Newton( A, ctrl );
+    sign::Iterate( A, ctrl );
 }
 
 template<typename Field>
@@ -214,7 +892,7 @@ void Sign
 {
     EL_DEBUG_CSE
     Matrix<Field> ACopy( A );
-    sign::Newton( A, ctrl );
+    sign::Iterate( A, ctrl );
     Gemm( NORMAL, NORMAL, Field(1), A, ACopy, N );
 }
 
@@ -226,7 +904,7 @@ void Sign( AbstractDistMatrix<Field>& APre, const SignCtrl<Base<Field>> ctrl )
     DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    sign::Newton( A, ctrl );
+    sign::Iterate( A, ctrl );
 }
 
 template<typename Field>
@@ -243,10 +921,39 @@ void Sign
     auto& N = NProx.Get();
 
     DistMatrix<Field> ACopy( A );
-    sign::Newton( A, ctrl );
+    sign::Iterate( A, ctrl );
     Gemm( NORMAL, NORMAL, Field(1), A, ACopy, N );
 }
 
+template<typename Field>
+void HamiltonianSign( Matrix<Field>& W, const SignCtrl<Base<Field>> ctrl )
+{
+    EL_DEBUG_CSE
+    if( W.Height() != W.Width() || W.Height() % 2 != 0 )
+        LogicError("Hamiltonian matrices must be square of even order");
+    Matrix<Field> H;
+    sign::ApplyJ( W, H );
+    sign::HamiltonianNewton( H, ctrl );
+    sign::ApplyJ( H, W, true );
+}
+
+template<typename Field>
+void HamiltonianSign
+( AbstractDistMatrix<Field>& WPre, const SignCtrl<Base<Field>> ctrl )
+{
+    EL_DEBUG_CSE
+    if( WPre.Height() != WPre.Width() || WPre.Height() % 2 != 0 )
+        LogicError("Hamiltonian matrices must be square of even order");
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> WProx( WPre );
+    auto& W = WProx.Get();
+
+    DistMatrix<Field> H( W.Grid() );
+    sign::ApplyJ( W, H );
+    sign::HamiltonianNewton( H, ctrl );
+    sign::ApplyJ( H, W, true );
+}
+
 // The Hermitian sign decomposition is equivalent to the Hermitian polar
 // decomposition... A = (U sgn(Lambda) U') (U sgn(Lambda)Lambda U')
 //                    = (U sgn(Lambda) U') (U |Lambda| U')
@@ -416,6 +1123,10 @@ void HermitianSign
   template void Sign \
   ( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& N, \
     const SignCtrl<Base<Field>> ctrl ); \
+  template void HamiltonianSign \
+  ( Matrix<Field>& W, const SignCtrl<Base<Field>> ctrl ); \
+  template void HamiltonianSign \
+  ( AbstractDistMatrix<Field>& W, const SignCtrl<Base<Field>> ctrl ); \
   template void HermitianSign \
   ( UpperOrLower uplo, Matrix<Field>& A, \
     const HermitianEigCtrl<Field>& ctrl ); \
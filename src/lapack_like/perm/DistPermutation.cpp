@@ -212,6 +212,184 @@ void PermuteRows
     }
 }
 
+// Compose a sequence of swaps (or its inverse) into the list of
+// (destination, source) pairs such that applying the sequence is equivalent
+// to setting A(dest,:) := A(source,:) for each pair, with the sources
+// referring to the original matrix. Only the touched indices are tracked.
+void ComposeSwaps
+( const Matrix<Int>& origins,
+        bool implicitOrigins,
+  const Matrix<Int>& dests,
+        Int numSwaps,
+        bool inverse,
+        vector<pair<Int,Int>>& moves )
+{
+    EL_DEBUG_CSE
+    std::map<Int,Int> sources;
+    auto source = [&]( Int i )
+    {
+        auto entry = sources.find( i );
+        return entry == sources.end() ? i : entry->second;
+    };
+    for( Int k=0; k<numSwaps; ++k )
+    {
+        const Int j = ( inverse ? numSwaps-1-k : k );
+        const Int origin = ( implicitOrigins ? j : origins(j) );
+        const Int dest = dests(j);
+        if( origin == dest )
+            continue;
+        const Int originSource = source( origin );
+        sources[origin] = source( dest );
+        sources[dest] = originSource;
+    }
+
+    moves.clear();
+    for( const auto& entry : sources )
+        if( entry.first != entry.second )
+            moves.emplace_back( entry.first, entry.second );
+}
+
+// Set A(dest+offset,:) := A(source+offset,:) for each (dest,source) pair
+// using a single AllToAll over the column communicator. Since every process
+// knows the full list of moves, the rows are packed and unpacked in the
+// order of the list and no indices need to be communicated.
+template<typename T>
+void MoveRows
+(       AbstractDistMatrix<T>& A,
+  const vector<pair<Int,Int>>& moves,
+        Int offset )
+{
+    EL_DEBUG_CSE
+    if( moves.empty() || A.Width() == 0 || !A.Participating() )
+        return;
+
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    const Int localWidth = A.LocalWidth();
+    const int colRank = A.ColRank();
+    const int colStride = A.ColStride();
+
+    vector<int> sendCounts(colStride,0), recvCounts(colStride,0);
+    for( const auto& move : moves )
+    {
+        const int destOwner = A.RowOwner( move.first+offset );
+        const int sourceOwner = A.RowOwner( move.second+offset );
+        if( sourceOwner == colRank )
+            sendCounts[destOwner] += localWidth;
+        if( destOwner == colRank )
+            recvCounts[sourceOwner] += localWidth;
+    }
+    vector<int> sendDispls, recvDispls;
+    const int totalSend = Scan( sendCounts, sendDispls );
+    const int totalRecv = Scan( recvCounts, recvDispls );
+
+    // Pack the source rows in the order of the moves
+    auto offsets = sendDispls;
+    vector<T> sendData;
+    FastResize( sendData, mpi::Pad(totalSend) );
+    for( const auto& move : moves )
+    {
+        const Int source = move.second+offset;
+        if( A.RowOwner(source) != colRank )
+            continue;
+        const int rank = A.RowOwner( move.first+offset );
+        StridedMemCopy
+        ( &sendData[offsets[rank]], 1,
+          &ABuf[A.LocalRow(source)], ALDim, localWidth );
+        offsets[rank] += localWidth;
+    }
+
+    vector<T> recvData;
+    FastResize( recvData, mpi::Pad(totalRecv) );
+    mpi::AllToAll
+    ( sendData.data(), sendCounts.data(), sendDispls.data(),
+      recvData.data(), recvCounts.data(), recvDispls.data(),
+      A.ColComm() );
+
+    // Unpack the destination rows in the same order
+    offsets = recvDispls;
+    for( const auto& move : moves )
+    {
+        const Int dest = move.first+offset;
+        if( A.RowOwner(dest) != colRank )
+            continue;
+        const int rank = A.RowOwner( move.second+offset );
+        StridedMemCopy
+        ( &ABuf[A.LocalRow(dest)], ALDim,
+          &recvData[offsets[rank]], 1, localWidth );
+        offsets[rank] += localWidth;
+    }
+}
+
+// The column analogue of MoveRows
+template<typename T>
+void MoveCols
+(       AbstractDistMatrix<T>& A,
+  const vector<pair<Int,Int>>& moves,
+        Int offset )
+{
+    EL_DEBUG_CSE
+    if( moves.empty() || A.Height() == 0 || !A.Participating() )
+        return;
+
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    const Int localHeight = A.LocalHeight();
+    const int rowRank = A.RowRank();
+    const int rowStride = A.RowStride();
+
+    vector<int> sendCounts(rowStride,0), recvCounts(rowStride,0);
+    for( const auto& move : moves )
+    {
+        const int destOwner = A.ColOwner( move.first+offset );
+        const int sourceOwner = A.ColOwner( move.second+offset );
+        if( sourceOwner == rowRank )
+            sendCounts[destOwner] += localHeight;
+        if( destOwner == rowRank )
+            recvCounts[sourceOwner] += localHeight;
+    }
+    vector<int> sendDispls, recvDispls;
+    const int totalSend = Scan( sendCounts, sendDispls );
+    const int totalRecv = Scan( recvCounts, recvDispls );
+
+    // Pack the source columns in the order of the moves
+    auto offsets = sendDispls;
+    vector<T> sendData;
+    FastResize( sendData, mpi::Pad(totalSend) );
+    for( const auto& move : moves )
+    {
+        const Int source = move.second+offset;
+        if( A.ColOwner(source) != rowRank )
+            continue;
+        const int rank = A.ColOwner( move.first+offset );
+        MemCopy
+        ( &sendData[offsets[rank]], &ABuf[A.LocalCol(source)*ALDim],
+          localHeight );
+        offsets[rank] += localHeight;
+    }
+
+    vector<T> recvData;
+    FastResize( recvData, mpi::Pad(totalRecv) );
+    mpi::AllToAll
+    ( sendData.data(), sendCounts.data(), sendDispls.data(),
+      recvData.data(), recvCounts.data(), recvDispls.data(),
+      A.RowComm() );
+
+    // Unpack the destination columns in the same order
+    offsets = recvDispls;
+    for( const auto& move : moves )
+    {
+        const Int dest = move.first+offset;
+        if( A.ColOwner(dest) != rowRank )
+            continue;
+        const int rank = A.ColOwner( move.second+offset );
+        MemCopy
+        ( &ABuf[A.LocalCol(dest)*ALDim], &recvData[offsets[rank]],
+          localHeight );
+        offsets[rank] += localHeight;
+    }
+}
+
 void InvertPermutation
 ( const AbstractDistMatrix<Int>& pPre,
         AbstractDistMatrix<Int>& pInvPre )
@@ -336,6 +514,10 @@ void DistPermutation::Empty()
     invPerm_.Empty();
     staleInverse_ = false;
 
+    composedSwaps_.clear();
+    composedInverseSwaps_.clear();
+    staleComposition_ = true;
+
     rowMeta_.clear();
     colMeta_.clear();
     staleMeta_ = false;
@@ -362,6 +544,7 @@ void DistPermutation::MakeIdentity( Int size )
 
     numSwaps_ = 0;
     implicitSwapOrigins_ = true;
+    staleComposition_ = true;
 }
 
 void DistPermutation::ReserveSwaps( Int maxSwaps )
@@ -391,6 +574,7 @@ void DistPermutation::Swap( Int origin, Int dest )
 
     if( origin != dest )
         parity_ = !parity_;
+    staleComposition_ = true;
     if( swapSequence_ && numSwaps_ == swapDests_.Height() )
         MakeArbitrary();
     if( !swapSequence_ )
@@ -558,6 +742,23 @@ void DistPermutation::SetImage( Int origin, Int dest )
     staleMeta_ = true;
 }
 
+void DistPermutation::SetPreimages( const AbstractDistMatrix<Int>& p )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( p.Width() != 1 )
+          LogicError("The preimages must be a column vector");
+    )
+    Empty();
+    size_ = p.Height();
+    swapSequence_ = false;
+    perm_ = p;
+    invPerm_.Resize( size_, 1 );
+    staleInverse_ = true;
+    staleParity_ = true;
+    staleMeta_ = true;
+}
+
 void DistPermutation::MakeArbitrary() const
 {
     EL_DEBUG_CSE
@@ -615,6 +816,7 @@ const DistPermutation& DistPermutation::operator=( const Permutation& P )
     staleParity_ = P.staleParity_;
     staleInverse_ = P.staleInverse_;
     staleMeta_ = true;
+    staleComposition_ = true;
 
     return *this;
 }
@@ -643,6 +845,10 @@ const DistPermutation& DistPermutation::operator=( const DistPermutation& P )
     rowMeta_ = P.rowMeta_;
     staleMeta_ = P.staleMeta_;
 
+    composedSwaps_ = P.composedSwaps_;
+    composedInverseSwaps_ = P.composedInverseSwaps_;
+    staleComposition_ = P.staleComposition_;
+
     return *this;
 }
 
@@ -720,49 +926,43 @@ const DistMatrix<Int,VC,STAR> DistPermutation::SwapDestinations() const
     return swapDests_(IR(0,numSwaps_),ALL);
 }
 
-template<typename T>
-void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
+const vector<pair<Int,Int>>&
+DistPermutation::ComposedSwaps( bool inverse ) const
 {
     EL_DEBUG_CSE
-    // TODO(poulson): Use an (MC,MR) proxy for A?
-    if( swapSequence_ )
+    if( staleComposition_ )
     {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
-            return;
-
         auto activeInd = IR(0,numSwaps_);
-
-        // TODO(poulson): Introduce an std::map for caching the pivots this
-        // process needs to care about to avoid redundant [STAR,STAR] formations
-        //
-        // TODO(poulson): Decide on the data structure; an std::vector of pivot
-        // origins and destinations?
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
-        else
+        DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
+        Matrix<Int> originsLoc;
+        if( !implicitSwapOrigins_ )
         {
             DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
               swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
+            originsLoc = origins_STAR_STAR.Matrix();
         }
+        auto& destsLoc = dests_STAR_STAR.Matrix();
+        ComposeSwaps
+        ( originsLoc, implicitSwapOrigins_, destsLoc, numSwaps_, false,
+          composedSwaps_ );
+        ComposeSwaps
+        ( originsLoc, implicitSwapOrigins_, destsLoc, numSwaps_, true,
+          composedInverseSwaps_ );
+        staleComposition_ = false;
+    }
+    return inverse ? composedInverseSwaps_ : composedSwaps_;
+}
+
+template<typename T>
+void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
+{
+    EL_DEBUG_CSE
+    // TODO(poulson): Use an (MC,MR) proxy for A?
+    if( swapSequence_ )
+    {
+        if( A.Height() == 0 || A.Width() == 0 )
+            return;
+        MoveCols( A, ComposedSwaps(false), offset );
     }
     else
     {
@@ -818,36 +1018,9 @@ void DistPermutation::InversePermuteCols
     // TODO(poulson): Use an (MC,MR) proxy for A?
     if( swapSequence_ )
     {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
+        if( A.Height() == 0 || A.Width() == 0 )
             return;
-
-        auto activeInd = IR(0,numSwaps_);
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
+        MoveCols( A, ComposedSwaps(true), offset );
     }
     else
     {
@@ -902,36 +1075,9 @@ void DistPermutation::PermuteRows( AbstractDistMatrix<T>& A, Int offset ) const
     // TODO(poulson): Use an (MC,MR) proxy for A?
     if( swapSequence_ )
     {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
+        if( A.Height() == 0 || A.Width() == 0 )
             return;
-
-        auto activeInd = IR(0,numSwaps_);
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
+        MoveRows( A, ComposedSwaps(false), offset );
     }
     else
     {
@@ -987,36 +1133,9 @@ void DistPermutation::InversePermuteRows
     // TODO(poulson): Use an (MC,MR) proxy for A?
     if( swapSequence_ )
     {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
+        if( A.Height() == 0 || A.Width() == 0 )
             return;
-
-        auto activeInd = IR(0,numSwaps_);
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
+        MoveRows( A, ComposedSwaps(true), offset );
     }
     else
     {
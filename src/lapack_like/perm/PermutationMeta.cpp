@@ -91,9 +91,11 @@ PermutationMeta::PermutationMeta
     }
 
     // Construct the send and recv displacements from the counts
+    Scan( sendCounts, sendDispls );
+    Scan( recvCounts, recvDispls );
     EL_DEBUG_ONLY(
-      const Int totalSend = Scan( sendCounts, sendDispls );
-      const Int totalRecv = Scan( recvCounts, recvDispls );
+      const Int totalSend = TotalSend();
+      const Int totalRecv = TotalRecv();
       if( totalSend != totalRecv )
           LogicError
           ("Send and recv counts do not match: send=",totalSend,", recv=",
@@ -0,0 +1,306 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../Norm/Estimate.hpp"
+
+namespace El {
+namespace condest {
+
+// Estimate the norm of inv(A), where applyInv( orientation, X ) overwrites
+// X := op(inv(A)) X
+template<typename Field,class MatrixType,class ApplyType>
+Base<Field> InverseNorm
+( NormType type,
+  Int n,
+  const ApplyType& applyInv,
+        MatrixType& X,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( type == ONE_NORM )
+    {
+        return estimate::BlockOneNorm<Field>
+          ( n, applyInv, X, ctrl.blockSize, ctrl.maxBlockIts );
+    }
+    else if( type == INFINITY_NORM )
+    {
+        // || inv(A) ||_oo = || inv(A)^H ||_1
+        auto applyInvAdj = [&]( Orientation orientation, MatrixType& Y )
+        { applyInv( orientation == NORMAL ? ADJOINT : NORMAL, Y ); };
+        return estimate::BlockOneNorm<Field>
+          ( n, applyInvAdj, X, ctrl.blockSize, ctrl.maxBlockIts );
+    }
+    else if( type == TWO_NORM )
+    {
+        return estimate::LanczosTwoNorm<Field>
+          ( n, applyInv, X, ctrl.numLanczosSteps );
+    }
+    else if( type == FROBENIUS_NORM )
+    {
+        return estimate::HutchinsonFrobeniusNorm<Field>
+          ( n, applyInv, X, ctrl.numProbes );
+    }
+    else
+        LogicError("Unsupported norm type for condition estimation");
+    return Base<Field>(0);
+}
+
+template<typename Field>
+bool SingularDiagonal( const Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    const Int minDim = Min(A.Height(),A.Width());
+    for( Int i=0; i<minDim; ++i )
+        if( A(i,i) == Field(0) )
+            return true;
+    return false;
+}
+
+template<typename Field>
+bool SingularDiagonal( const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( A );
+    DistMatrix<Field,MD,STAR> d( A.Grid() );
+    GetDiagonal( AProx.GetLocked(), d );
+    return ZeroNorm( d ) < d.Height();
+}
+
+template<typename Field>
+Base<Field> AfterLUPartialPiv
+( const Matrix<Field>& A,
+  const Permutation& P,
+        Base<Field> normA,
+        NormType type,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Expected a square LU factorization");
+    if( SingularDiagonal( A ) )
+        return limits::Infinity<Base<Field>>();
+    auto applyInv = [&]( Orientation orientation, Matrix<Field>& X )
+    { lu::SolveAfter( orientation, A, P, X ); };
+    Matrix<Field> X;
+    return normA*InverseNorm<Field>( type, A.Height(), applyInv, X, ctrl );
+}
+
+template<typename Field>
+Base<Field> AfterLUPartialPiv
+( const AbstractDistMatrix<Field>& A,
+  const DistPermutation& P,
+        Base<Field> normA,
+        NormType type,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Expected a square LU factorization");
+    if( SingularDiagonal( A ) )
+        return limits::Infinity<Base<Field>>();
+    auto applyInv = [&]( Orientation orientation, DistMatrix<Field>& X )
+    { lu::SolveAfter( orientation, A, P, X ); };
+    DistMatrix<Field> X( A.Grid() );
+    return normA*InverseNorm<Field>( type, A.Height(), applyInv, X, ctrl );
+}
+
+template<typename Field>
+Base<Field> AfterCholesky
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+        Base<Field> normA,
+        NormType type,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Expected a square Cholesky factorization");
+    if( SingularDiagonal( A ) )
+        return limits::Infinity<Base<Field>>();
+    // inv(A) is Hermitian
+    auto applyInv = [&]( Orientation, Matrix<Field>& X )
+    { cholesky::SolveAfter( uplo, NORMAL, A, X ); };
+    Matrix<Field> X;
+    return normA*InverseNorm<Field>( type, A.Height(), applyInv, X, ctrl );
+}
+
+template<typename Field>
+Base<Field> AfterCholesky
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+        Base<Field> normA,
+        NormType type,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Expected a square Cholesky factorization");
+    if( SingularDiagonal( A ) )
+        return limits::Infinity<Base<Field>>();
+    auto applyInv = [&]( Orientation, DistMatrix<Field>& X )
+    { cholesky::SolveAfter( uplo, NORMAL, A, X ); };
+    DistMatrix<Field> X( A.Grid() );
+    return normA*InverseNorm<Field>( type, A.Height(), applyInv, X, ctrl );
+}
+
+// || A ||_2 via Lanczos on A^H A
+template<typename Field,class MatrixType>
+Base<Field> TwoNorm
+( const MatrixType& A,
+        MatrixType& v,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto apply = [&]( Orientation orientation, MatrixType& X )
+    {
+        MatrixType Y( X );
+        Gemv( orientation, Field(1), A, X, Y );
+        X = Y;
+    };
+    return estimate::LanczosTwoNorm<Field>
+      ( A.Height(), apply, v, ctrl.numLanczosSteps );
+}
+
+// The two-norm condition number of a rectangular matrix is that of the
+// triangular factor of the QR factorization of A (or A^H)
+template<typename Field,class MatrixType>
+Base<Field> RectangularTwoCondition
+( MatrixType& A, const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() < A.Width() )
+    {
+        MatrixType ACopy( A );
+        Adjoint( ACopy, A );
+    }
+    qr::ExplicitTriang( A );
+    const Int n = A.Width();
+    auto ATop = A( IR(0,n), ALL );
+    MatrixType R( ATop );
+    MakeTrapezoidal( UPPER, R );
+    if( SingularDiagonal( R ) )
+        return limits::Infinity<Base<Field>>();
+
+    auto applyR = [&]( Orientation orientation, MatrixType& X )
+    { Trmm( LEFT, UPPER, orientation, NON_UNIT, Field(1), R, X ); };
+    auto applyInv = [&]( Orientation orientation, MatrixType& X )
+    { Trsm( LEFT, UPPER, orientation, NON_UNIT, Field(1), R, X ); };
+    MatrixType X( R );
+    const Base<Field> normR = estimate::LanczosTwoNorm<Field>
+      ( n, applyR, X, ctrl.numLanczosSteps );
+    return normR*InverseNorm<Field>( TWO_NORM, n, applyInv, X, ctrl );
+}
+
+} // namespace condest
+
+template<typename Field>
+Base<Field> ConditionEstimate
+( const Matrix<Field>& A,
+  NormType type,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( A.Height() != A.Width() )
+    {
+        if( type != TWO_NORM )
+            LogicError("Only two-norm estimates support rectangular matrices");
+        Matrix<Field> ACopy( A );
+        return condest::RectangularTwoCondition<Field>( ACopy, ctrl );
+    }
+
+    Real normA;
+    if( type == TWO_NORM )
+    {
+        Matrix<Field> v;
+        normA = condest::TwoNorm<Field>( A, v, ctrl );
+    }
+    else
+        normA = Norm( A, type );
+
+    Matrix<Field> ALU( A );
+    Permutation P;
+    LU( ALU, P );
+    return condest::AfterLUPartialPiv( ALU, P, normA, type, ctrl );
+}
+
+template<typename Field>
+Base<Field> ConditionEstimate
+( const AbstractDistMatrix<Field>& APre,
+  NormType type,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = APre.Grid();
+    if( APre.Height() != APre.Width() )
+    {
+        if( type != TWO_NORM )
+            LogicError("Only two-norm estimates support rectangular matrices");
+        DistMatrix<Field> A( APre );
+        return condest::RectangularTwoCondition<Field>( A, ctrl );
+    }
+
+    DistMatrix<Field> A( APre );
+    Real normA;
+    if( type == TWO_NORM )
+    {
+        DistMatrix<Field> v(g);
+        normA = condest::TwoNorm<Field>( A, v, ctrl );
+    }
+    else
+        normA = Norm( A, type );
+
+    DistPermutation P(g);
+    LU( A, P );
+    return condest::AfterLUPartialPiv( A, P, normA, type, ctrl );
+}
+
+#define PROTO(Field) \
+  template Base<Field> ConditionEstimate \
+  ( const Matrix<Field>& A, \
+    NormType type, \
+    const NormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> ConditionEstimate \
+  ( const AbstractDistMatrix<Field>& A, \
+    NormType type, \
+    const NormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> condest::AfterLUPartialPiv \
+  ( const Matrix<Field>& A, \
+    const Permutation& P, \
+          Base<Field> normA, \
+          NormType type, \
+    const NormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> condest::AfterLUPartialPiv \
+  ( const AbstractDistMatrix<Field>& A, \
+    const DistPermutation& P, \
+          Base<Field> normA, \
+          NormType type, \
+    const NormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> condest::AfterCholesky \
+  ( UpperOrLower uplo, \
+    const Matrix<Field>& A, \
+          Base<Field> normA, \
+          NormType type, \
+    const NormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> condest::AfterCholesky \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<Field>& A, \
+          Base<Field> normA, \
+          NormType type, \
+    const NormEstimateCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -44,6 +44,80 @@ InertiaType Inertia
     return ldl::Inertia( GetRealPartOfDiagonal(A), dSub );
 }
 
+template<typename Field>
+SafeProduct<Base<Field>> LDLDeterminantAndInertia
+( UpperOrLower uplo,
+  Matrix<Field>& A,
+  InertiaType& inertia,
+  bool canOverwrite,
+  const LDLPivotCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( uplo == UPPER )
+        LogicError("This option not yet supported");
+    if( !canOverwrite )
+    {
+        Matrix<Field> B( A );
+        return LDLDeterminantAndInertia( uplo, B, inertia, true, ctrl );
+    }
+    Permutation p;
+    Matrix<Field> dSub;
+    LDL( A, dSub, p, true, ctrl );
+    return ldl::DeterminantAndInertia
+      ( GetRealPartOfDiagonal(A), dSub, inertia );
+}
+
+template<typename Field>
+SafeProduct<Base<Field>> LDLDeterminantAndInertia
+( UpperOrLower uplo,
+  AbstractDistMatrix<Field>& APre,
+  InertiaType& inertia,
+  bool canOverwrite,
+  const LDLPivotCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( uplo == UPPER )
+        LogicError("This option not yet supported");
+    if( !canOverwrite )
+    {
+        DistMatrix<Field> B( APre );
+        return LDLDeterminantAndInertia( uplo, B, inertia, true, ctrl );
+    }
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistPermutation p( A.Grid() );
+    DistMatrix<Field,MD,STAR> dSub( A.Grid() );
+    LDL( A, dSub, p, true, ctrl );
+    return ldl::DeterminantAndInertia
+      ( GetRealPartOfDiagonal(A), dSub, inertia );
+}
+
+template<typename Field>
+SafeProduct<Base<Field>> LDLDeterminantAndInertia
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+  InertiaType& inertia,
+  const LDLPivotCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> B( A );
+    return LDLDeterminantAndInertia( uplo, B, inertia, true, ctrl );
+}
+
+template<typename Field>
+SafeProduct<Base<Field>> LDLDeterminantAndInertia
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+  InertiaType& inertia,
+  const LDLPivotCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Field> B( A );
+    return LDLDeterminantAndInertia( uplo, B, inertia, true, ctrl );
+}
+
 #define PROTO(Field) \
   template InertiaType Inertia \
   ( UpperOrLower uplo, \
@@ -52,6 +126,28 @@ InertiaType Inertia
   template InertiaType Inertia \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<Field>& A, \
+    const LDLPivotCtrl<Base<Field>>& ctrl ); \
+  template SafeProduct<Base<Field>> LDLDeterminantAndInertia \
+  ( UpperOrLower uplo, \
+    Matrix<Field>& A, \
+    InertiaType& inertia, \
+    bool canOverwrite, \
+    const LDLPivotCtrl<Base<Field>>& ctrl ); \
+  template SafeProduct<Base<Field>> LDLDeterminantAndInertia \
+  ( UpperOrLower uplo, \
+    AbstractDistMatrix<Field>& A, \
+    InertiaType& inertia, \
+    bool canOverwrite, \
+    const LDLPivotCtrl<Base<Field>>& ctrl ); \
+  template SafeProduct<Base<Field>> LDLDeterminantAndInertia \
+  ( UpperOrLower uplo, \
+    const Matrix<Field>& A, \
+    InertiaType& inertia, \
+    const LDLPivotCtrl<Base<Field>>& ctrl ); \
+  template SafeProduct<Base<Field>> LDLDeterminantAndInertia \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<Field>& A, \
+    InertiaType& inertia, \
     const LDLPivotCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
@@ -0,0 +1,263 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_NORM_ESTIMATE_HPP
+#define EL_NORM_ESTIMATE_HPP
+
+// Building blocks shared by the norm and condition-number estimators. Each is
+// written in terms of a 'MatrixType', which is either Matrix<Field> or
+// DistMatrix<Field>, so that the sequential and distributed estimators are
+// identical; the (small) quantities which drive the decisions, e.g., the
+// Lanczos tridiagonals, are redundantly available on every process.
+
+namespace El {
+namespace estimate {
+
+// Replicate a thin block on every process
+template<typename Field>
+void Gather( const Matrix<Field>& A, Matrix<Field>& ALoc )
+{ ALoc = A; }
+
+template<typename Field,Dist U,Dist V>
+void Gather( const DistMatrix<Field,U,V>& A, Matrix<Field>& ALoc )
+{
+    DistMatrix<Field,STAR,STAR> A_STAR_STAR( A );
+    ALoc = A_STAR_STAR.Matrix();
+}
+
+// Run (up to) 'numSteps' steps of Lanczos, with full reorthogonalization,
+// on the Hermitian operator M applied via apply( X, Y ) [Y := M X], starting
+// from the direction of v. The tridiagonal projection is returned via its
+// diagonal d and subdiagonal e.
+template<typename Field,class MatrixType,class ApplyType>
+void Lanczos
+( const ApplyType& apply,
+  const MatrixType& v,
+        Int numSteps,
+        Matrix<Base<Field>>& d,
+        Matrix<Base<Field>>& e )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int n = v.Height();
+    numSteps = Min(numSteps,n);
+
+    MatrixType V(v), w(v), h(v);
+    Zeros( V, n, numSteps );
+    Zeros( d, numSteps, 1 );
+    Zeros( e, Max(numSteps-1,Int(0)), 1 );
+    if( numSteps == 0 )
+        return;
+    {
+        auto v0 = V( ALL, IR(0) );
+        v0 = v;
+        v0 *= Real(1)/FrobeniusNorm( v );
+    }
+
+    Real scale = 0;
+    for( Int k=0; k<numSteps; ++k )
+    {
+        auto vk = V( ALL, IR(k) );
+        apply( vk, w );
+        d(k) = RealPart(Dot(vk,w));
+
+        // Twice is enough
+        auto VK = V( ALL, IR(0,k+1) );
+        for( Int pass=0; pass<2; ++pass )
+        {
+            Gemv( ADJOINT, Field(1), VK, w, h );
+            Gemv( NORMAL, Field(-1), VK, h, Field(1), w );
+        }
+
+        const Real beta = FrobeniusNorm( w );
+        scale = Max( scale, Abs(d(k))+beta );
+        if( k == numSteps-1 )
+            break;
+        if( beta <= eps*scale )
+        {
+            // An invariant subspace was found
+            d.Resize( k+1, 1 );
+            e.Resize( k, 1 );
+            break;
+        }
+        e(k) = beta;
+        auto vkp1 = V( ALL, IR(k+1) );
+        vkp1 = w;
+        vkp1 *= Real(1)/beta;
+    }
+}
+
+// The largest eigenvalue of the symmetric tridiagonal matrix (d, e)
+template<typename Real>
+Real MaxRitzValue( const Matrix<Real>& d, const Matrix<Real>& e )
+{
+    EL_DEBUG_CSE
+    if( d.Height() == 0 )
+        return Real(0);
+    Matrix<Real> w;
+    HermitianTridiagEig( d, e, w );
+    return w(w.Height()-1);
+}
+
+// Given the Lanczos tridiagonal (d, e) of M started from the unit vector u,
+// return the Gauss quadrature approximation of u^H f(M) u
+template<typename Real>
+Real GaussQuadrature
+( const Matrix<Real>& d,
+  const Matrix<Real>& e,
+  const function<Real(const Real&)>& func )
+{
+    EL_DEBUG_CSE
+    if( d.Height() == 0 )
+        return Real(0);
+    Matrix<Real> w, Q;
+    HermitianTridiagEig( d, e, w, Q );
+    Real sum = 0;
+    for( Int j=0; j<w.Height(); ++j )
+        sum += Q(0,j)*Q(0,j)*func(w(j));
+    return sum;
+}
+
+// Estimate || B ||_1 for an n x n operator B with the block 1-norm estimator
+// of Higham and Tisseur (a block generalization of Hager's method), where
+// apply( orientation, X ) overwrites X := op(B) X. X serves as workspace and
+// determines the distribution of the iterates.
+template<typename Field,class MatrixType,class ApplyType>
+Base<Field> BlockOneNorm
+( Int n,
+  const ApplyType& apply,
+        MatrixType& X,
+        Int blockSize,
+        Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int t = Min(blockSize,n);
+    if( t == 0 )
+        return Real(0);
+
+    // X := [ones, random +-1's] / n
+    Rademacher( X, n, t );
+    {
+        auto x0 = X( ALL, IR(0) );
+        Fill( x0, Field(1) );
+    }
+    X *= Real(1)/Real(n);
+
+    function<Field(const Field&)> sign =
+      []( const Field& alpha )
+      { return alpha == Field(0) ? Field(1) : alpha/Abs(alpha); };
+
+    vector<bool> visited( n, false );
+    vector<pair<Real,Int>> rowMaxes( n );
+    Matrix<Field> XLoc;
+    Real estimate = 0;
+    for( Int it=0; it<maxIts; ++it )
+    {
+        // The estimate is the largest column one-norm of B X
+        apply( NORMAL, X );
+        Gather( X, XLoc );
+        Real newEstimate = 0;
+        for( Int j=0; j<XLoc.Width(); ++j )
+        {
+            Real colNorm = 0;
+            for( Int i=0; i<n; ++i )
+                colNorm += Abs(XLoc(i,j));
+            newEstimate = Max( newEstimate, colNorm );
+        }
+        if( it > 0 && newEstimate <= estimate )
+            break;
+        estimate = newEstimate;
+        if( it == maxIts-1 )
+            break;
+
+        // Z := B^H sign(B X), whose largest rows point towards the
+        // maximizing unit vectors
+        EntrywiseMap( X, sign );
+        apply( ADJOINT, X );
+        Gather( X, XLoc );
+        for( Int i=0; i<n; ++i )
+        {
+            Real rowMax = 0;
+            for( Int j=0; j<XLoc.Width(); ++j )
+                rowMax = Max( rowMax, Abs(XLoc(i,j)) );
+            rowMaxes[i] = pair<Real,Int>( rowMax, i );
+        }
+        std::sort
+        ( rowMaxes.begin(), rowMaxes.end(),
+          []( const pair<Real,Int>& a, const pair<Real,Int>& b )
+          { return a.first > b.first; } );
+        if( it > 0 && visited[rowMaxes[0].second] )
+            break;
+
+        // Move to the unvisited unit vectors with the largest gradients
+        vector<Int> newIndices;
+        for( Int i=0; i<n && Int(newIndices.size())<t; ++i )
+            if( !visited[rowMaxes[i].second] )
+                newIndices.push_back( rowMaxes[i].second );
+        if( newIndices.empty() )
+            break;
+        Zeros( X, n, newIndices.size() );
+        for( Int j=0; j<Int(newIndices.size()); ++j )
+        {
+            visited[newIndices[j]] = true;
+            X.Set( newIndices[j], j, Field(1) );
+        }
+    }
+    return estimate;
+}
+
+// Estimate || B ||_F for an n x n operator B as || B Z ||_F / sqrt(k), where
+// Z is an n x k Rademacher matrix, i.e., with Hutchinson's trace estimator
+// applied to B^H B
+template<typename Field,class MatrixType,class ApplyType>
+Base<Field> HutchinsonFrobeniusNorm
+( Int n,
+  const ApplyType& apply,
+        MatrixType& Z,
+        Int numProbes )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( n == 0 || numProbes <= 0 )
+        return Real(0);
+    Rademacher( Z, n, numProbes );
+    apply( NORMAL, Z );
+    return FrobeniusNorm( Z ) / Sqrt( Real(numProbes) );
+}
+
+// Estimate || B ||_2 for an n x n operator B as the square root of the
+// largest Ritz value of B B^H, where B is applied as in BlockOneNorm
+template<typename Field,class MatrixType,class ApplyType>
+Base<Field> LanczosTwoNorm
+( Int n,
+  const ApplyType& apply,
+        MatrixType& v,
+        Int numSteps )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( n == 0 )
+        return Real(0);
+    auto applyGram = [&]( const MatrixType& X, MatrixType& Y )
+    {
+        Y = X;
+        apply( ADJOINT, Y );
+        apply( NORMAL, Y );
+    };
+    Gaussian( v, n, 1 );
+    Matrix<Real> d, e;
+    Lanczos<Field>( applyGram, v, numSteps, d, e );
+    return Sqrt( Max( MaxRitzValue( d, e ), Real(0) ) );
+}
+
+} // namespace estimate
+} // namespace El
+
+#endif // ifndef EL_NORM_ESTIMATE_HPP
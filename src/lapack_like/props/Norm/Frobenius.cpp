@@ -183,9 +183,58 @@ Base<Field> SymmetricFrobeniusNorm
     return HermitianFrobeniusNorm( uplo, A );
 }
 
+template<typename Field>
+Base<Field> FrobeniusNorm( const SparseMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Real scale = 0;
+    Real scaledSquare = 1;
+    const Int numEntries = A.NumEntries();
+    const Field* valBuf = A.LockedValueBuffer();
+    for( Int e=0; e<numEntries; ++e )
+        UpdateScaledSquare( valBuf[e], scale, scaledSquare );
+    return scale*Sqrt(scaledSquare);
+}
+
+template<typename Field>
+Base<Field> FrobeniusNorm( const DistSparseMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Real localScale = 0;
+    Real localScaledSquare = 1;
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Field* valBuf = A.LockedValueBuffer();
+    for( Int e=0; e<numLocalEntries; ++e )
+        UpdateScaledSquare( valBuf[e], localScale, localScaledSquare );
+    return NormFromScaledSquare
+      ( localScale, localScaledSquare, A.Grid().Comm() );
+}
+
+template<typename Field>
+Base<Field> FrobeniusNorm( const DistMultiVec<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Real localScale = 0;
+    Real localScaledSquare = 1;
+    const Int localHeight = A.LocalHeight();
+    const Int width = A.Width();
+    const Matrix<Field>& ALoc = A.LockedMatrix();
+    for( Int j=0; j<width; ++j )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            UpdateScaledSquare( ALoc(iLoc,j), localScale, localScaledSquare );
+    return NormFromScaledSquare
+      ( localScale, localScaledSquare, A.Grid().Comm() );
+}
+
 #define PROTO(Field) \
   template Base<Field> FrobeniusNorm( const Matrix<Field>& A ); \
   template Base<Field> FrobeniusNorm ( const AbstractDistMatrix<Field>& A ); \
+  template Base<Field> FrobeniusNorm( const SparseMatrix<Field>& A ); \
+  template Base<Field> FrobeniusNorm( const DistSparseMatrix<Field>& A ); \
+  template Base<Field> FrobeniusNorm( const DistMultiVec<Field>& A ); \
   template Base<Field> HermitianFrobeniusNorm \
   ( UpperOrLower uplo, const Matrix<Field>& A ); \
   template Base<Field> HermitianFrobeniusNorm \
@@ -125,9 +125,48 @@ SymmetricMaxNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
     return HermitianMaxNorm( uplo, A );
 }
 
+template<typename Ring>
+Base<Ring> MaxNorm( const SparseMatrix<Ring>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Ring> Real;
+    const Int numEntries = A.NumEntries();
+    const Ring* valBuf = A.LockedValueBuffer();
+
+    Real maxAbs = 0;
+    for( Int e=0; e<numEntries; ++e )
+        maxAbs = Max( maxAbs, Abs(valBuf[e]) );
+    return maxAbs;
+}
+
+template<typename Ring>
+Base<Ring> MaxNorm( const DistSparseMatrix<Ring>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Ring> Real;
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Ring* valBuf = A.LockedValueBuffer();
+
+    Real localMaxAbs = 0;
+    for( Int e=0; e<numLocalEntries; ++e )
+        localMaxAbs = Max( localMaxAbs, Abs(valBuf[e]) );
+    return mpi::AllReduce( localMaxAbs, mpi::MAX, A.Grid().Comm() );
+}
+
+template<typename Ring>
+Base<Ring> MaxNorm( const DistMultiVec<Ring>& A )
+{
+    EL_DEBUG_CSE
+    const Base<Ring> localMaxAbs = MaxNorm( A.LockedMatrix() );
+    return mpi::AllReduce( localMaxAbs, mpi::MAX, A.Grid().Comm() );
+}
+
 #define PROTO(Ring) \
   template Base<Ring> MaxNorm( const Matrix<Ring>& A ); \
   template Base<Ring> MaxNorm ( const AbstractDistMatrix<Ring>& A ); \
+  template Base<Ring> MaxNorm( const SparseMatrix<Ring>& A ); \
+  template Base<Ring> MaxNorm( const DistSparseMatrix<Ring>& A ); \
+  template Base<Ring> MaxNorm( const DistMultiVec<Ring>& A ); \
   template Base<Ring> HermitianMaxNorm \
   ( UpperOrLower uplo, const Matrix<Ring>& A ); \
   template Base<Ring> HermitianMaxNorm \
@@ -0,0 +1,253 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./Estimate.hpp"
+
+namespace El {
+namespace schatten_est {
+
+// || A ||_p^p = tr((A^H A)^{p/2}) is approximated by averaging
+// r z^H (A^H A)^{p/2} z / (z^H z) over Rademacher vectors z, where the
+// quadratic forms are approximated by Lanczos (Gauss) quadrature over the
+// smaller of the r x r Gramians A^H A and A A^H. The workspace z determines
+// the distribution.
+template<typename Field,class MatrixType>
+Base<Field> Schatten
+( const MatrixType& A,
+        Base<Field> p,
+        MatrixType& z,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int r = Min(m,n);
+    if( r == 0 )
+        return Real(0);
+    if( p <= Real(0) )
+        LogicError("p must be positive");
+
+    const Orientation firstOrient = ( m >= n ? NORMAL : ADJOINT );
+    const Orientation secondOrient = ( m >= n ? ADJOINT : NORMAL );
+    auto applyGram = [&]( const MatrixType& X, MatrixType& Y )
+    {
+        MatrixType T( X );
+        Gemv( firstOrient, Field(1), A, X, T );
+        Gemv( secondOrient, Field(1), A, T, Y );
+    };
+    function<Real(const Real&)> func =
+      [&]( const Real& theta ) { return Pow( Max(theta,Real(0)), p/2 ); };
+
+    const Int numProbes = Max( ctrl.numProbes, Int(1) );
+    Matrix<Real> d, e;
+    Real trace = 0;
+    for( Int probe=0; probe<numProbes; ++probe )
+    {
+        Rademacher( z, r, 1 );
+        estimate::Lanczos<Field>( applyGram, z, ctrl.numLanczosSteps, d, e );
+        trace += r*estimate::GaussQuadrature( d, e, func );
+    }
+    trace /= numProbes;
+    return Pow( trace, 1/p );
+}
+
+template<typename Real>
+Real KyFanSchattenFromSingularValues( const Matrix<Real>& s, Int k, Real p )
+{
+    Real sum = 0;
+    for( Int j=0; j<Min(k,s.Height()); ++j )
+        sum += Pow( s(j), p );
+    return Pow( sum, 1/p );
+}
+
+// The largest k singular values of A are approximated by those of Q^H A,
+// where Q is an orthonormal basis for the range of (A A^H)^q A Omega, with
+// Omega an n x (k+oversampling) Gaussian matrix. Y and W are workspaces
+// which determine the distribution.
+template<typename Field,class MatrixType>
+void DominantSingularValues
+( const MatrixType& A,
+        Int k,
+        MatrixType& Y,
+        MatrixType& W,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int ell = Min( k+ctrl.oversampling, Min(m,n) );
+
+    Gaussian( W, n, ell );
+    Gemm( NORMAL, NORMAL, Field(1), A, W, Y );
+    qr::ExplicitUnitary( Y );
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        Gemm( ADJOINT, NORMAL, Field(1), A, Y, W );
+        qr::ExplicitUnitary( W );
+        Gemm( NORMAL, NORMAL, Field(1), A, W, Y );
+        qr::ExplicitUnitary( Y );
+    }
+    Gemm( ADJOINT, NORMAL, Field(1), Y, A, W );
+}
+
+} // namespace schatten_est
+
+template<typename Field>
+Base<Field> SchattenNormEstimate
+( const Matrix<Field>& A,
+  Base<Field> p,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> z;
+    return schatten_est::Schatten<Field>( A, p, z, ctrl );
+}
+
+template<typename Field>
+Base<Field> SchattenNormEstimate
+( const AbstractDistMatrix<Field>& APre,
+  Base<Field> p,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    DistMatrix<Field> z( A.Grid() );
+    return schatten_est::Schatten<Field>( A, p, z, ctrl );
+}
+
+template<typename Field>
+Base<Field> NuclearNormEstimate
+( const Matrix<Field>& A,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return SchattenNormEstimate( A, Base<Field>(1), ctrl );
+}
+
+template<typename Field>
+Base<Field> NuclearNormEstimate
+( const AbstractDistMatrix<Field>& A,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return SchattenNormEstimate( A, Base<Field>(1), ctrl );
+}
+
+template<typename Field>
+Base<Field> KyFanSchattenNormEstimate
+( const Matrix<Field>& A,
+  Int k,
+  Base<Field> p,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( k < 1 || k > Min(A.Height(),A.Width()) )
+        LogicError("k must be in [1,min(m,n)]");
+    if( p < Real(1) )
+        LogicError("p must be at least one");
+
+    Matrix<Field> Y, W;
+    schatten_est::DominantSingularValues<Field>( A, k, Y, W, ctrl );
+    Matrix<Real> s;
+    SVD( W, s );
+    return schatten_est::KyFanSchattenFromSingularValues( s, k, p );
+}
+
+template<typename Field>
+Base<Field> KyFanSchattenNormEstimate
+( const AbstractDistMatrix<Field>& APre,
+  Int k,
+  Base<Field> p,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( k < 1 || k > Min(APre.Height(),APre.Width()) )
+        LogicError("k must be in [1,min(m,n)]");
+    if( p < Real(1) )
+        LogicError("p must be at least one");
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    DistMatrix<Field> Y(g), W(g);
+    schatten_est::DominantSingularValues<Field>( A, k, Y, W, ctrl );
+    DistMatrix<Real,VR,STAR> s(g);
+    SVD( W, s );
+    Matrix<Real> sLoc;
+    estimate::Gather( s, sLoc );
+    return schatten_est::KyFanSchattenFromSingularValues( sLoc, k, p );
+}
+
+template<typename Field>
+Base<Field> KyFanNormEstimate
+( const Matrix<Field>& A,
+  Int k,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return KyFanSchattenNormEstimate( A, k, Base<Field>(1), ctrl );
+}
+
+template<typename Field>
+Base<Field> KyFanNormEstimate
+( const AbstractDistMatrix<Field>& A,
+  Int k,
+  const NormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return KyFanSchattenNormEstimate( A, k, Base<Field>(1), ctrl );
+}
+
+#define PROTO(Field) \
+  template Base<Field> SchattenNormEstimate \
+  ( const Matrix<Field>& A, \
+    Base<Field> p, \
+    const NormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> SchattenNormEstimate \
+  ( const AbstractDistMatrix<Field>& A, \
+    Base<Field> p, \
+    const NormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> NuclearNormEstimate \
+  ( const Matrix<Field>& A, \
+    const NormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> NuclearNormEstimate \
+  ( const AbstractDistMatrix<Field>& A, \
+    const NormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> KyFanSchattenNormEstimate \
+  ( const Matrix<Field>& A, \
+    Int k, \
+    Base<Field> p, \
+    const NormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> KyFanSchattenNormEstimate \
+  ( const AbstractDistMatrix<Field>& A, \
+    Int k, \
+    Base<Field> p, \
+    const NormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> KyFanNormEstimate \
+  ( const Matrix<Field>& A, \
+    Int k, \
+    const NormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> KyFanNormEstimate \
+  ( const AbstractDistMatrix<Field>& A, \
+    Int k, \
+    const NormEstimateCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
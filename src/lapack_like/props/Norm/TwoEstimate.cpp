@@ -248,10 +248,70 @@ Base<Field> SymmetricTwoNormEstimate
     return estimate;
 }
 
+template<typename Field>
+Base<Field> TwoNormEstimate
+( const LinearOperator<Field>& A, Base<Field> tol, Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    Int numIts=0;
+    Real estimate=0, lastEst;
+    if( A.Distributed() )
+    {
+        const Grid& g = A.Grid();
+        DistMultiVec<Field> x(g), y(g);
+        Zeros( y, n, 1 );
+        MakeGaussian( y.Matrix() );
+        do
+        {
+            lastEst = estimate;
+            A( y, x );
+            Real xNorm = FrobeniusNorm( x );
+            if( xNorm == Real(0) )
+            {
+                MakeGaussian( x.Matrix() );
+                xNorm = FrobeniusNorm( x );
+            }
+            x.Matrix() *= Real(1)/xNorm;
+            A.ApplyAdjoint( x, y );
+            estimate = FrobeniusNorm( y );
+        } while( ++numIts < maxIts && Abs(estimate-lastEst) > tol*Max(m,n) );
+    }
+    else
+    {
+        Matrix<Field> x, y;
+        Gaussian( y, n, 1 );
+        do
+        {
+            lastEst = estimate;
+            A( y, x );
+            Real xNorm = FrobeniusNorm( x );
+            if( xNorm == Real(0) )
+            {
+                Gaussian( x, m, 1 );
+                xNorm = FrobeniusNorm( x );
+            }
+            x *= Real(1)/xNorm;
+            A.ApplyAdjoint( x, y );
+            estimate = FrobeniusNorm( y );
+        } while( ++numIts < maxIts && Abs(estimate-lastEst) > tol*Max(m,n) );
+    }
+
+    if( Abs(estimate-lastEst) > tol*Max(m,n) )
+        RuntimeError("Two-norm estimate did not converge in time");
+
+    return estimate;
+}
+
 #define PROTO(Field) \
   template Base<Field> TwoNormEstimate \
   ( const Matrix<Field>& A, Base<Field> tol, Int maxIts ); \
   template Base<Field> TwoNormEstimate \
+  ( const LinearOperator<Field>& A, Base<Field> tol, Int maxIts ); \
+  template Base<Field> TwoNormEstimate \
   ( const AbstractDistMatrix<Field>& A, Base<Field> tol, Int maxIts ); \
   template Base<Field> HermitianTwoNormEstimate \
   ( UpperOrLower uplo, const Matrix<Field>& A, Base<Field> tol, Int maxIts ); \
@@ -0,0 +1,354 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Every probe vector is carried in a single multi-vector, so that each
+// application of the operator and each orthogonalization acts upon all of
+// them at once (with Gemm's over the local rows and an all-reduce of the
+// small Gram matrices when the operator is distributed).
+
+namespace El {
+namespace trace_est {
+
+template<typename Field>
+Matrix<Field>& Local( Matrix<Field>& X ) { return X; }
+template<typename Field>
+const Matrix<Field>& Local( const Matrix<Field>& X ) { return X; }
+template<typename Field>
+Matrix<Field>& Local( DistMultiVec<Field>& X ) { return X.Matrix(); }
+template<typename Field>
+const Matrix<Field>& Local( const DistMultiVec<Field>& X )
+{ return X.LockedMatrix(); }
+
+// C := X^H Y
+template<typename Field>
+void InnerProducts
+( const Matrix<Field>& X, const Matrix<Field>& Y, Matrix<Field>& C )
+{
+    EL_DEBUG_CSE
+    Zeros( C, X.Width(), Y.Width() );
+    Gemm( ADJOINT, NORMAL, Field(1), X, Y, Field(0), C );
+}
+
+template<typename Field>
+void InnerProducts
+( const DistMultiVec<Field>& X,
+  const DistMultiVec<Field>& Y,
+        Matrix<Field>& C )
+{
+    EL_DEBUG_CSE
+    Zeros( C, X.Width(), Y.Width() );
+    Gemm
+    ( ADJOINT, NORMAL,
+      Field(1), X.LockedMatrix(), Y.LockedMatrix(), Field(0), C );
+    mpi::AllReduce( C.Buffer(), C.Height()*C.Width(), X.Grid().Comm() );
+}
+
+template<typename Field>
+void Probes( Int n, Int numProbes, bool gaussian, Matrix<Field>& Z )
+{
+    EL_DEBUG_CSE
+    if( gaussian )
+        Gaussian( Z, n, numProbes );
+    else
+        Rademacher( Z, n, numProbes );
+}
+
+template<typename Field>
+void Probes( Int n, Int numProbes, bool gaussian, DistMultiVec<Field>& Z )
+{
+    EL_DEBUG_CSE
+    Zeros( Z, n, numProbes );
+    auto& ZLoc = Z.Matrix();
+    if( gaussian )
+        Gaussian( ZLoc, ZLoc.Height(), numProbes );
+    else
+        Rademacher( ZLoc, ZLoc.Height(), numProbes );
+}
+
+// Y := A X
+template<typename Field,class MultiVecType>
+void Apply
+( const LinearOperator<Field>& A, const MultiVecType& X, MultiVecType& Y )
+{
+    EL_DEBUG_CSE
+    Zeros( Y, A.Height(), X.Width() );
+    A.Apply( NORMAL, Field(1), X, Field(0), Y );
+}
+
+template<typename Field>
+Field SumDiagonal( const Matrix<Field>& C )
+{
+    Field sum = 0;
+    for( Int j=0; j<Min(C.Height(),C.Width()); ++j )
+        sum += C(j,j);
+    return sum;
+}
+
+// Overwrite X with an orthonormal basis for its range using shifted
+// Cholesky QR followed by two unshifted passes, which is robust to the
+// numerical rank deficiency of A S in Hutch++
+template<typename Field,class MultiVecType>
+void Orthonormalize( MultiVecType& X )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    Matrix<Field> G;
+    for( Int pass=0; pass<3; ++pass )
+    {
+        InnerProducts( X, X, G );
+        if( pass == 0 )
+        {
+            const Real shift = 10*X.Width()*eps*RealPart(SumDiagonal(G));
+            ShiftDiagonal( G, Field(shift) );
+        }
+        Cholesky( UPPER, G );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), G, Local(X) );
+    }
+}
+
+template<typename Field,class MultiVecType>
+Field Hutchinson
+( const LinearOperator<Field>& A,
+        MultiVecType& Z,
+  const TraceEstimateCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int numProbes = Max( ctrl.numProbes, Int(1) );
+    Probes( n, numProbes, false, Z );
+    MultiVecType W( Z );
+    Apply( A, Z, W );
+    Matrix<Field> C;
+    InnerProducts( Z, W, C );
+    return SumDiagonal( C ) / Field(numProbes);
+}
+
+// The Hutch++ estimator of Meyer, Musco, Musco, and Woodruff: a third of the
+// probes sketch the dominant range of A, Q, whose contribution tr(Q^H A Q) is
+// computed exactly, while Hutchinson's estimator is applied to the deflated
+// operator (I - Q Q^H) A (I - Q Q^H) with the remaining probes
+template<typename Field,class MultiVecType>
+Field HutchPlusPlus
+( const LinearOperator<Field>& A,
+        MultiVecType& Z,
+  const TraceEstimateCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int numProbes = Max( ctrl.numProbes, Int(3) );
+    const Int sketchSize = Min( numProbes/3, n );
+    const Int numRemaining = numProbes - 2*sketchSize;
+
+    MultiVecType Q( Z ), W( Z );
+    Probes( n, sketchSize, true, Z );
+    Apply( A, Z, Q );
+    Orthonormalize<Field>( Q );
+
+    Matrix<Field> C;
+    Apply( A, Q, W );
+    InnerProducts( Q, W, C );
+    const Field sketchTrace = SumDiagonal( C );
+
+    // Z := (I - Q Q^H) Z for fresh Rademacher probes
+    Probes( n, numRemaining, false, Z );
+    InnerProducts( Q, Z, C );
+    Gemm( NORMAL, NORMAL, Field(-1), Local(Q), C, Field(1), Local(Z) );
+    Apply( A, Z, W );
+    InnerProducts( Z, W, C );
+    return sketchTrace + SumDiagonal( C ) / Field(numRemaining);
+}
+
+// Estimate tr(f(A)) = E[ tr(Z^H f(A) Z) ] / k for n x k Rademacher probes Z
+// via block Lanczos: with Z = Q_0 R_0 and the block-tridiagonal projection
+// T = V Lambda V^H, Z^H f(A) Z ~= (E_0^H V R_0)^H f(Lambda) (E_0^H V R_0).
+// The three-term block recurrence is used without reorthogonalization so
+// that only three blocks of vectors are stored, which is the usual practice
+// for stochastic Lanczos quadrature.
+template<typename Field,class MultiVecType>
+Base<Field> BlockLanczosQuadrature
+( const LinearOperator<Field>& A,
+        MultiVecType& Z,
+  const function<Base<Field>(const Base<Field>&)>& func,
+  const TraceEstimateCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int n = A.Height();
+    const Int b = Min( Max(ctrl.numProbes,Int(1)), n );
+    const Int numSteps = Max( Min(ctrl.numLanczosSteps,n/b), Int(1) );
+
+    Probes( n, b, false, Z );
+    Matrix<Field> R0;
+    InnerProducts( Z, Z, R0 );
+    Cholesky( UPPER, R0 );
+    MakeTrapezoidal( UPPER, R0 );
+    MultiVecType Q( Z ), QPrev( Z ), W( Z );
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), R0, Local(Q) );
+
+    Matrix<Field> T, Aj, AjAdj, Bj, BjAdj, BPrev, C;
+    Zeros( T, numSteps*b, numSteps*b );
+    Int numBlocks = 0;
+    Real scale = 0;
+    for( Int j=0; j<numSteps; ++j )
+    {
+        Apply( A, Q, W );
+        if( j > 0 )
+            Gemm
+            ( NORMAL, ADJOINT,
+              Field(-1), Local(QPrev), BPrev, Field(1), Local(W) );
+        InnerProducts( Q, W, Aj );
+        Adjoint( Aj, AjAdj );
+        Aj += AjAdj;
+        Aj *= Real(1)/Real(2);
+        Gemm( NORMAL, NORMAL, Field(-1), Local(Q), Aj, Field(1), Local(W) );
+
+        // A single local reorthogonalization against the current block
+        InnerProducts( Q, W, C );
+        Gemm( NORMAL, NORMAL, Field(-1), Local(Q), C, Field(1), Local(W) );
+
+        const IR indj( j*b, (j+1)*b ), indjp1( (j+1)*b, (j+2)*b );
+        auto Tjj = T( indj, indj );
+        Tjj = Aj;
+        numBlocks = j+1;
+        scale = Max( scale, FrobeniusNorm(Aj) );
+        if( j == numSteps-1 )
+            break;
+
+        // W = Q_{j+1} B_j
+        InnerProducts( W, W, Bj );
+        try { Cholesky( UPPER, Bj ); }
+        catch( NonHPDMatrixException& e ) { break; }
+        MakeTrapezoidal( UPPER, Bj );
+        Real minDiag = limits::Max<Real>();
+        for( Int i=0; i<b; ++i )
+            minDiag = Min( minDiag, RealPart(Bj(i,i)) );
+        scale = Max( scale, FrobeniusNorm(Bj) );
+        if( minDiag <= Sqrt(eps)*scale )
+        {
+            // (Numerically) an invariant subspace was found
+            break;
+        }
+        auto Tjp1j = T( indjp1, indj );
+        Tjp1j = Bj;
+        Adjoint( Bj, BjAdj );
+        auto Tjjp1 = T( indj, indjp1 );
+        Tjjp1 = BjAdj;
+
+        QPrev = Q;
+        BPrev = Bj;
+        Q = W;
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), Bj, Local(Q) );
+    }
+
+    Matrix<Field> TActive( T( IR(0,numBlocks*b), IR(0,numBlocks*b) ) );
+    Matrix<Real> w;
+    Matrix<Field> V, M;
+    HermitianEig( LOWER, TActive, w, V );
+    Gemm( ADJOINT, NORMAL, Field(1), V( IR(0,b), ALL ), R0, M );
+
+    Real sum = 0;
+    for( Int i=0; i<w.Height(); ++i )
+    {
+        Real weight = 0;
+        for( Int l=0; l<b; ++l )
+            weight += RealPart(Conj(M(i,l))*M(i,l));
+        sum += weight*func(w(i));
+    }
+    return sum / b;
+}
+
+} // namespace trace_est
+
+template<typename Field>
+Field TraceEstimate
+( const LinearOperator<Field>& A, const TraceEstimateCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Cannot estimate the trace of a nonsquare operator");
+    if( A.Height() == 0 )
+        return Field(0);
+    if( A.Distributed() )
+    {
+        DistMultiVec<Field> Z( A.Grid() );
+        if( ctrl.estimator == TRACE_HUTCHINSON )
+            return trace_est::Hutchinson( A, Z, ctrl );
+        else
+            return trace_est::HutchPlusPlus( A, Z, ctrl );
+    }
+    else
+    {
+        Matrix<Field> Z;
+        if( ctrl.estimator == TRACE_HUTCHINSON )
+            return trace_est::Hutchinson( A, Z, ctrl );
+        else
+            return trace_est::HutchPlusPlus( A, Z, ctrl );
+    }
+}
+
+template<typename Field>
+Base<Field> HermitianTraceFunctionEstimate
+( const LinearOperator<Field>& A,
+  function<Base<Field>(const Base<Field>&)> func,
+  const TraceEstimateCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Expected a square (Hermitian) operator");
+    if( A.Height() == 0 )
+        return Base<Field>(0);
+    if( A.Distributed() )
+    {
+        DistMultiVec<Field> Z( A.Grid() );
+        return trace_est::BlockLanczosQuadrature( A, Z, func, ctrl );
+    }
+    else
+    {
+        Matrix<Field> Z;
+        return trace_est::BlockLanczosQuadrature( A, Z, func, ctrl );
+    }
+}
+
+template<typename Field>
+Base<Field> HPDLogDetEstimate
+( const LinearOperator<Field>& A, const TraceEstimateCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    function<Real(const Real&)> logFunc =
+      []( const Real& lambda )
+      {
+          if( lambda <= Real(0) )
+              RuntimeError("Operator was not numerically HPD");
+          return Log( lambda );
+      };
+    return HermitianTraceFunctionEstimate( A, logFunc, ctrl );
+}
+
+#define PROTO(Field) \
+  template Field TraceEstimate \
+  ( const LinearOperator<Field>& A, const TraceEstimateCtrl& ctrl ); \
+  template Base<Field> HermitianTraceFunctionEstimate \
+  ( const LinearOperator<Field>& A, \
+    function<Base<Field>(const Base<Field>&)> func, \
+    const TraceEstimateCtrl& ctrl ); \
+  template Base<Field> HPDLogDetEstimate \
+  ( const LinearOperator<Field>& A, const TraceEstimateCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,200 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace bkz {
+
+// Schnorr-Euchner enumeration: a depth-first search over the levels of R
+// (from the last to the first) which visits the candidates for each
+// coordinate in the zig-zag order of their distance from the center implied
+// by the coordinates above it. Since x and -x have the same norm, only
+// positive values of the last nonzero coordinate are considered.
+template<typename Real>
+bool Enumerate( const Matrix<Real>& R, Real radiusSq, Matrix<Real>& x )
+{
+    EL_DEBUG_CSE
+    const Int n = R.Height();
+    EL_DEBUG_ONLY(
+      if( R.Width() != n )
+          LogicError("R must be square");
+      for( Int i=0; i<n; ++i )
+          if( R(i,i) <= Real(0) )
+              LogicError("R must have a positive diagonal");
+    )
+    if( n == 0 )
+        return false;
+
+    vector<Real> y(n,Real(0)), centers(n,Real(0)), partialNormsSq(n+1,Real(0)),
+      steps(n,Real(0)), stepDirs(n,Real(0));
+    y[0] = 1;
+    Int top = 0;
+    Int i = 0;
+    Real bestNormSq = radiusSq;
+    bool found = false;
+    while( true )
+    {
+        const Real diff = (y[i]-centers[i])*R(i,i);
+        const Real normSq = partialNormsSq[i+1] + diff*diff;
+        if( normSq < bestNormSq )
+        {
+            if( i > 0 )
+            {
+                // Descend to the next level
+                partialNormsSq[i] = normSq;
+                --i;
+                Real center = 0;
+                for( Int j=i+1; j<=top; ++j )
+                    center -= R(i,j)*y[j];
+                centers[i] = center / R(i,i);
+                y[i] = Round( centers[i] );
+                stepDirs[i] = ( centers[i] >= y[i] ? Real(1) : Real(-1) );
+                steps[i] = stepDirs[i];
+                continue;
+            }
+            bestNormSq = normSq;
+            Zeros( x, n, 1 );
+            for( Int j=0; j<=top; ++j )
+                x(j) = y[j];
+            found = true;
+        }
+        else
+        {
+            ++i;
+            if( i == n )
+                break;
+        }
+
+        // Move to the next candidate at level i
+        if( i >= top )
+        {
+            y[i] += 1;
+            top = i;
+        }
+        else
+        {
+            y[i] += steps[i];
+            stepDirs[i] = -stepDirs[i];
+            steps[i] = stepDirs[i] - steps[i];
+        }
+    }
+    return found;
+}
+
+} // namespace bkz
+
+template<typename Real>
+BKZInfo<Real> BKZ
+( Matrix<Real>& B,
+  Matrix<Real>& R,
+  const BKZCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.blocksize < 2 )
+        LogicError("The BKZ blocksize must be at least two");
+    const Int m = B.Height();
+
+    BKZInfo<Real> info;
+    info.numTours = 0;
+    info.numInsertions = 0;
+    info.lllInfo = LLL( B, R, ctrl.lllCtrl );
+    const Int rank = info.lllInfo.rank;
+    Int numSwaps = info.lllInfo.numSwaps;
+    Int numPromotions = info.lllInfo.numPromotions;
+
+    Matrix<Real> RBlock, x, BExt, RExt;
+    while( true )
+    {
+        bool inserted = false;
+        for( Int k=0; k<rank-1; ++k )
+        {
+            const Int kEnd = Min( k+ctrl.blocksize, rank );
+            RBlock = R( IR(k,kEnd), IR(k,kEnd) );
+            const Real radiusSq = ctrl.lllCtrl.delta*R(k,k)*R(k,k);
+            if( !bkz::Enumerate( RBlock, radiusSq, x ) )
+                continue;
+
+            // Insert B(:,k:kEnd) x before column k and remove the resulting
+            // linear dependence with LLL
+            Zeros( BExt, m, rank+1 );
+            auto BExtL = BExt( ALL, IR(0,k) );
+            auto bExt = BExt( ALL, IR(k) );
+            auto BExtR = BExt( ALL, IR(k+1,rank+1) );
+            BExtL = B( ALL, IR(0,k) );
+            Gemv( NORMAL, Real(1), B(ALL,IR(k,kEnd)), x, bExt );
+            BExtR = B( ALL, IR(k,rank) );
+
+            auto lllInfo = LLL( BExt, RExt, ctrl.lllCtrl );
+            if( lllInfo.rank != rank )
+                RuntimeError
+                ("Inserting an enumerated vector changed the rank from ",rank,
+                 " to ",lllInfo.rank);
+            auto BActive = B( ALL, IR(0,rank) );
+            BActive = BExt( ALL, IR(0,rank) );
+            R = RExt( IR(0,rank), IR(0,rank) );
+            numSwaps += lllInfo.numSwaps;
+            numPromotions += lllInfo.numPromotions;
+            info.lllInfo = lllInfo;
+            ++info.numInsertions;
+            inserted = true;
+        }
+        ++info.numTours;
+        if( ctrl.progress )
+            Output
+            ("BKZ tour ",info.numTours,": ",info.numInsertions,
+             " insertions so far");
+        if( !inserted ||
+            (ctrl.maxTours > 0 && info.numTours >= ctrl.maxTours) )
+            break;
+    }
+
+    // Report with respect to the original basis
+    info.lllInfo.nullity = B.Width() - rank;
+    info.lllInfo.numSwaps = numSwaps;
+    info.lllInfo.numPromotions = numPromotions;
+    if( R.Width() != B.Width() )
+    {
+        Matrix<Real> RActive( R );
+        Zeros( R, Min(m,B.Width()), B.Width() );
+        auto RTL = R( IR(0,rank), IR(0,rank) );
+        RTL = RActive( IR(0,rank), IR(0,rank) );
+    }
+    return info;
+}
+
+template<typename Real>
+BKZInfo<Real> BKZ
+( Matrix<Real>& B,
+  const BKZCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> R;
+    return BKZ( B, R, ctrl );
+}
+
+#define PROTO(Real) \
+  template bool bkz::Enumerate \
+  ( const Matrix<Real>& R, Real radiusSq, Matrix<Real>& x ); \
+  template BKZInfo<Real> BKZ \
+  ( Matrix<Real>& B, \
+    const BKZCtrl<Real>& ctrl ); \
+  template BKZInfo<Real> BKZ \
+  ( Matrix<Real>& B, \
+    Matrix<Real>& R, \
+    const BKZCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
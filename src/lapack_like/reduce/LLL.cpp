@@ -0,0 +1,479 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace lll {
+
+// Move column 'from' of A to position 'to', shifting the columns in between
+template<typename F>
+void MoveColumn( Matrix<F>& A, Int from, Int to )
+{
+    EL_DEBUG_CSE
+    if( from == to || A.Width() == 0 )
+        return;
+    const Int m = A.Height();
+    Matrix<F> a( A(ALL,IR(from)) );
+    if( from > to )
+    {
+        for( Int j=from; j>to; --j )
+            blas::Copy( m, A.LockedBuffer(0,j-1), 1, A.Buffer(0,j), 1 );
+    }
+    else
+    {
+        for( Int j=from; j<to; ++j )
+            blas::Copy( m, A.LockedBuffer(0,j+1), 1, A.Buffer(0,j), 1 );
+    }
+    blas::Copy( m, a.LockedBuffer(), 1, A.Buffer(0,to), 1 );
+}
+
+// The multipliers above which the cancellation in a size reduction may have
+// destroyed the accuracy of the updated Gram-Schmidt coefficients
+template<typename Real>
+Real CancellationThreshold()
+{ return Real(1)/Sqrt(limits::Epsilon<Real>()); }
+
+// Size-reduce the coefficients r (of length at least k) of a column against
+// columns jBeg through k-1 of the upper-triangular R, storing the integer
+// multipliers in mu and returning the largest of their magnitudes
+template<typename F>
+Base<F> SizeReduce
+( Int jBeg, Int k, const Matrix<F>& R, Matrix<F>& r, Matrix<F>& mu )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    Zeros( mu, k, 1 );
+    Real maxAbsMu = 0;
+    for( Int j=k-1; j>=jBeg; --j )
+    {
+        const F rho = R(j,j);
+        if( rho == F(0) )
+            continue;
+        const F chi = Round( r(j)/rho );
+        if( chi == F(0) )
+            continue;
+        mu(j) = chi;
+        maxAbsMu = Max( maxAbsMu, Abs(chi) );
+        blas::Axpy( j+1, -chi, R.LockedBuffer(0,j), 1, r.Buffer(), 1 );
+    }
+    return maxAbsMu;
+}
+
+// The state of a reduction in a particular precision. QR holds the
+// Householder factorization of the (zero-padded to at least n rows) basis
+// in the format of El::QR, and the leading 'numValid' columns of its upper
+// triangle are the up-to-date (size-reduced) coefficients of the basis.
+template<typename F>
+struct State
+{
+    Matrix<F> B, U;
+    bool formU;
+
+    Matrix<F> QR, householderScalars;
+    Matrix<Base<F>> signature;
+
+    Int numActive;
+    Int numValid;
+};
+
+// Form the Householder factorization of the basis with blocked reflectors
+// and then simultaneously size-reduce every column against it. Returns false
+// if the working precision was insufficient.
+template<typename F>
+bool InitialReduction( State<F>& state, const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = state.B.Height();
+    const Int n = state.numActive;
+    const Int mPad = Max(m,n);
+    const Real threshold = CancellationThreshold<Real>();
+
+    Zeros( state.QR, mPad, n );
+    auto QRTop = state.QR( IR(0,m), ALL );
+    QRTop = state.B( ALL, IR(0,n) );
+    QR( state.QR, state.householderScalars, state.signature );
+
+    // Every column is reduced against a snapshot of the factorization and
+    // the basis so that the columns may be updated independently
+    const Matrix<F> RSnap( state.QR ), BSnap( state.B );
+    Matrix<F> USnap;
+    if( state.formU )
+        USnap = state.U;
+
+    const Int blocksize = Max( Blocksize(), Int(1) );
+    vector<Real> maxAbsMus( n, Real(0) );
+    TaskGraph graph;
+    for( Int kBeg=0; kBeg<n; kBeg+=blocksize )
+    {
+        const Int kEnd = Min( kBeg+blocksize, n );
+        auto task = [&,kBeg,kEnd]()
+        {
+            Matrix<F> r, mu;
+            for( Int k=kBeg; k<kEnd; ++k )
+            {
+                r = RSnap( IR(0,k), IR(k) );
+                const Real maxAbsMu = SizeReduce( 0, k, RSnap, r, mu );
+                maxAbsMus[k] = maxAbsMu;
+                if( maxAbsMu == Real(0) )
+                    continue;
+                auto rk = state.QR( IR(0,k), IR(k) );
+                rk = r;
+
+                auto bk = state.B( ALL, IR(k) );
+                Gemv( NORMAL, F(-1), BSnap(ALL,IR(0,k)), mu, F(1), bk );
+                if( state.formU )
+                {
+                    auto uk = state.U( ALL, IR(k) );
+                    Gemv( NORMAL, F(-1), USnap(ALL,IR(0,k)), mu, F(1), uk );
+                }
+            }
+        };
+        graph.Insert
+        ( task, {&RSnap,&BSnap,&USnap}, {&maxAbsMus[kBeg]} );
+    }
+    graph.Execute( ctrl.numThreads );
+
+    if( MaxNorm(state.B) >= Real(1)/limits::Epsilon<Real>() )
+        return false;
+    // Zero columns must be processed (and removed) by the main loop
+    state.numValid = n;
+    for( Int k=0; k<n; ++k )
+    {
+        if( maxAbsMus[k] > threshold ||
+            MaxNorm(state.B(ALL,IR(k))) == Real(0) )
+        {
+            state.numValid = k;
+            break;
+        }
+    }
+    return true;
+}
+
+// Size-reduce column k against the (valid) leading k columns and compute its
+// Householder reflector. Returns false if the working precision was
+// insufficient.
+template<typename F>
+bool ProcessColumn( State<F>& state, Int k, const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = state.B.Height();
+    const Int mPad = state.QR.Height();
+    const Real threshold = CancellationThreshold<Real>();
+    const Int jBeg = ( ctrl.variant == LLL_WEAK ? Max(k-1,Int(0)) : 0 );
+
+    auto QRPrev = state.QR( ALL, IR(0,k) );
+    auto tPrev = state.householderScalars( IR(0,k), ALL );
+    auto dPrev = state.signature( IR(0,k), ALL );
+    auto bk = state.B( ALL, IR(k) );
+
+    Matrix<F> r, mu;
+    for( Int it=0; ; ++it )
+    {
+        if( it == ctrl.maxSizeReductionIts )
+            return false;
+
+        // r := Q^H b_k
+        Zeros( r, mPad, 1 );
+        auto rTop = r( IR(0,m), ALL );
+        rTop = bk;
+        if( k > 0 )
+            qr::ApplyQ( LEFT, ADJOINT, QRPrev, tPrev, dPrev, r );
+
+        const Real maxAbsMu = SizeReduce( jBeg, k, state.QR, r, mu );
+        if( maxAbsMu == Real(0) )
+            break;
+        Gemv( NORMAL, F(-1), state.B(ALL,IR(0,k)), mu, F(1), bk );
+        if( state.formU )
+        {
+            auto uk = state.U( ALL, IR(k) );
+            Gemv( NORMAL, F(-1), state.U(ALL,IR(0,k)), mu, F(1), uk );
+        }
+        if( MaxNorm(bk) >= Real(1)/limits::Epsilon<Real>() )
+            return false;
+        if( maxAbsMu <= threshold )
+            break;
+        // Otherwise recompute the coefficients from the updated column
+    }
+
+    auto qrk = state.QR( ALL, IR(k) );
+    qrk = r;
+    auto alpha11 = state.QR( IR(k), IR(k) );
+    auto a21 = state.QR( IR(k+1,mPad), IR(k) );
+    state.householderScalars(k) = LeftReflector( alpha11, a21 );
+    const Real beta = RealPart(state.QR(k,k));
+    state.signature(k) = ( beta >= Real(0) ? Real(1) : Real(-1) );
+    state.QR(k,k) *= state.signature(k);
+    return true;
+}
+
+// Returns false if the working precision was insufficient, in which case the
+// basis (and U) remain valid and may be reduced further in higher precision
+template<typename F>
+bool Kernel
+( State<F>& state, const LLLCtrl<Base<F>>& ctrl, LLLInfo<Base<F>>& info )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const bool deep = ( ctrl.variant == LLL_DEEP );
+
+    if( !InitialReduction( state, ctrl ) )
+        return false;
+
+    const auto& QR = state.QR;
+    Int k = 0;
+    while( k < state.numActive )
+    {
+        if( k >= state.numValid )
+        {
+            if( !ProcessColumn( state, k, ctrl ) )
+                return false;
+            state.numValid = k+1;
+
+            // Linear dependencies result in zero columns, which are moved to
+            // the end of the basis
+            if( MaxNorm(state.B(ALL,IR(k))) == Real(0) )
+            {
+                MoveColumn( state.B, k, state.numActive-1 );
+                if( state.formU )
+                    MoveColumn( state.U, k, state.numActive-1 );
+                --state.numActive;
+                state.numValid = k;
+                continue;
+            }
+        }
+        if( k == 0 )
+        {
+            ++k;
+            continue;
+        }
+
+        Int insertion = k;
+        if( deep )
+        {
+            Real C = 0;
+            for( Int i=0; i<=k; ++i )
+                C += Abs(QR(i,k))*Abs(QR(i,k));
+            for( Int i=0; i<k; ++i )
+            {
+                if( C < ctrl.delta*Abs(QR(i,i))*Abs(QR(i,i)) )
+                {
+                    insertion = i;
+                    break;
+                }
+                C -= Abs(QR(i,k))*Abs(QR(i,k));
+            }
+        }
+        else
+        {
+            const Real rhoPrev = Abs(QR(k-1,k-1));
+            const Real nuPrev = Abs(QR(k-1,k));
+            const Real rho = Abs(QR(k,k));
+            if( ctrl.delta*rhoPrev*rhoPrev > nuPrev*nuPrev + rho*rho )
+                insertion = k-1;
+        }
+
+        if( insertion == k )
+        {
+            ++k;
+            continue;
+        }
+        MoveColumn( state.B, k, insertion );
+        if( state.formU )
+            MoveColumn( state.U, k, insertion );
+        ++info.numSwaps;
+        k = insertion;
+        state.numValid = insertion;
+    }
+    return true;
+}
+
+template<typename Real,typename RealProm>
+LLLCtrl<RealProm> PromoteCtrl( const LLLCtrl<Real>& ctrl )
+{
+    LLLCtrl<RealProm> ctrlProm;
+    ctrlProm.delta = RealProm(ctrl.delta);
+    ctrlProm.variant = ctrl.variant;
+    ctrlProm.presort = false;
+    ctrlProm.smallestFirst = ctrl.smallestFirst;
+    ctrlProm.numThreads = ctrl.numThreads;
+    ctrlProm.maxSizeReductionIts = ctrl.maxSizeReductionIts;
+    ctrlProm.progress = ctrl.progress;
+    return ctrlProm;
+}
+
+template<typename F>
+LLLInfo<Base<F>> Helper
+( Matrix<F>& B,
+  Matrix<F>& U,
+  Matrix<F>& R,
+  bool formU,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    typedef Promote<F> FProm;
+    typedef Base<FProm> RealProm;
+    const Int m = B.Height();
+    const Int n = B.Width();
+
+    LLLInfo<Real> info;
+    info.numSwaps = 0;
+    info.numPromotions = 0;
+
+    if( ctrl.presort && n > 0 )
+    {
+        QRCtrl<Real> qrCtrl;
+        qrCtrl.colPiv = true;
+        qrCtrl.smallestFirst = ctrl.smallestFirst;
+        Matrix<F> BCopy( B ), householderScalars;
+        Matrix<Real> signature;
+        Permutation Omega;
+        QR( BCopy, householderScalars, signature, Omega, qrCtrl );
+        Omega.PermuteCols( B );
+        if( formU )
+            Omega.PermuteCols( U );
+    }
+
+    State<F> state;
+    state.formU = formU;
+    state.B = B;
+    if( formU )
+        state.U = U;
+    state.numActive = n;
+    state.numValid = 0;
+    if( !Kernel( state, ctrl, info ) )
+    {
+        if( IsSame<F,FProm>::value )
+            RuntimeError
+            ("LLL lost precision in ",TypeName<F>(),
+             " and no higher precision is available");
+        if( ctrl.progress )
+            Output
+            ("LLL lost precision in ",TypeName<F>(),", continuing in ",
+             TypeName<FProm>());
+
+        Matrix<FProm> BProm, UProm, RProm;
+        Copy( state.B, BProm );
+        if( formU )
+            Copy( state.U, UProm );
+        auto infoProm =
+          Helper
+          ( BProm, UProm, RProm, formU, PromoteCtrl<Real,RealProm>(ctrl) );
+        Copy( BProm, B );
+        if( formU )
+            Copy( UProm, U );
+        Copy( RProm, R );
+
+        info.delta = Real(infoProm.delta);
+        info.eta = Real(infoProm.eta);
+        info.rank = infoProm.rank;
+        info.nullity = infoProm.nullity;
+        info.numSwaps += infoProm.numSwaps;
+        info.numPromotions = infoProm.numPromotions + 1;
+        return info;
+    }
+    B = state.B;
+    if( formU )
+        U = state.U;
+
+    const Int rank = state.numActive;
+    info.rank = rank;
+    info.nullity = n - rank;
+    R = state.QR( IR(0,Min(m,n)), ALL );
+    MakeTrapezoidal( UPPER, R );
+    if( rank < R.Width() )
+    {
+        auto RRight = R( ALL, IR(rank,END) );
+        Zero( RRight );
+    }
+
+    // Measure the quality of the reduced basis
+    info.delta = 1;
+    info.eta = 0;
+    for( Int k=0; k<rank; ++k )
+    {
+        if( k > 0 )
+        {
+            const Real rhoPrev = Abs(R(k-1,k-1));
+            const Real nuPrev = Abs(R(k-1,k));
+            const Real rho = Abs(R(k,k));
+            if( rhoPrev > Real(0) )
+                info.delta =
+                  Min( info.delta, (nuPrev*nuPrev+rho*rho)/(rhoPrev*rhoPrev) );
+        }
+        for( Int j=0; j<k; ++j )
+            if( R(j,j) != F(0) )
+                info.eta = Max( info.eta, Abs(R(j,k))/Abs(R(j,j)) );
+    }
+    if( ctrl.progress )
+        Output
+        ("LLL: rank=",info.rank,", nullity=",info.nullity,", numSwaps=",
+         info.numSwaps,", delta=",info.delta,", eta=",info.eta);
+    return info;
+}
+
+} // namespace lll
+
+template<typename Field>
+LLLInfo<Base<Field>> LLL
+( Matrix<Field>& B,
+  const LLLCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> U, R;
+    return lll::Helper( B, U, R, false, ctrl );
+}
+
+template<typename Field>
+LLLInfo<Base<Field>> LLL
+( Matrix<Field>& B,
+  Matrix<Field>& R,
+  const LLLCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> U;
+    return lll::Helper( B, U, R, false, ctrl );
+}
+
+template<typename Field>
+LLLInfo<Base<Field>> LLL
+( Matrix<Field>& B,
+  Matrix<Field>& U,
+  Matrix<Field>& R,
+  const LLLCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Identity( U, B.Width(), B.Width() );
+    return lll::Helper( B, U, R, true, ctrl );
+}
+
+#define PROTO(Field) \
+  template LLLInfo<Base<Field>> LLL \
+  ( Matrix<Field>& B, \
+    const LLLCtrl<Base<Field>>& ctrl ); \
+  template LLLInfo<Base<Field>> LLL \
+  ( Matrix<Field>& B, \
+    Matrix<Field>& R, \
+    const LLLCtrl<Base<Field>>& ctrl ); \
+  template LLLInfo<Base<Field>> LLL \
+  ( Matrix<Field>& B, \
+    Matrix<Field>& U, \
+    Matrix<Field>& R, \
+    const LLLCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -9,6 +9,7 @@
 #include <El.hpp>
 
 #include "./ApplyPacked/Util.hpp"
+#include "./ApplyPacked/Cached.hpp"
 #include "./ApplyPacked/LLHB.hpp"
 #include "./ApplyPacked/LLHF.hpp"
 #include "./ApplyPacked/LLVB.hpp"
@@ -186,6 +187,93 @@ void ApplyPackedReflectors
     }
 }
 
+template<typename F>
+void FormPackedReflectorPanels
+( UpperOrLower uplo, Int offset,
+  const Matrix<F>& H,
+  PackedReflectorPanels<F>& panels )
+{
+    EL_DEBUG_CSE
+    apply_packed_reflectors::FormPanels( uplo, offset, H, panels );
+}
+
+template<typename F>
+void FormPackedReflectorPanels
+( UpperOrLower uplo, Int offset,
+  const AbstractDistMatrix<F>& H,
+  DistPackedReflectorPanels<F>& panels )
+{
+    EL_DEBUG_CSE
+    apply_packed_reflectors::FormPanels( uplo, offset, H, panels );
+}
+
+template<typename F>
+void ApplyPackedReflectors
+( LeftOrRight side, UpperOrLower uplo,
+  VerticalOrHorizontal dir, ForwardOrBackward order,
+  Conjugation conjugation,
+  Int offset,
+  const Matrix<F>& H,
+  const Matrix<F>& householderScalars,
+        Matrix<F>& A,
+        PackedReflectorPanels<F>& panels )
+{
+    EL_DEBUG_CSE
+    if( dir == HORIZONTAL )
+    {
+        ApplyPackedReflectors
+        ( side, uplo, dir, order, conjugation, offset,
+          H, householderScalars, A );
+        return;
+    }
+    EL_DEBUG_ONLY(
+      if( (side == LEFT && H.Height() != A.Height()) ||
+          (side == RIGHT && H.Height() != A.Width()) )
+          LogicError("H and A do not conform");
+      if( householderScalars.Height() != H.DiagonalLength(offset) )
+          LogicError
+          ("householderScalars must be the same length as H's offset diag");
+    )
+    if( !panels.Formed() || panels.uplo != uplo || panels.offset != offset )
+        FormPackedReflectorPanels( uplo, offset, H, panels );
+    apply_packed_reflectors::ApplyPanels
+    ( side, order, conjugation, householderScalars, A, panels );
+}
+
+template<typename F>
+void ApplyPackedReflectors
+( LeftOrRight side, UpperOrLower uplo,
+  VerticalOrHorizontal dir, ForwardOrBackward order,
+  Conjugation conjugation,
+  Int offset,
+  const AbstractDistMatrix<F>& H,
+  const AbstractDistMatrix<F>& householderScalars,
+        AbstractDistMatrix<F>& A,
+        DistPackedReflectorPanels<F>& panels )
+{
+    EL_DEBUG_CSE
+    if( dir == HORIZONTAL )
+    {
+        ApplyPackedReflectors
+        ( side, uplo, dir, order, conjugation, offset,
+          H, householderScalars, A );
+        return;
+    }
+    EL_DEBUG_ONLY(
+      AssertSameGrids( H, householderScalars, A );
+      if( (side == LEFT && H.Height() != A.Height()) ||
+          (side == RIGHT && H.Height() != A.Width()) )
+          LogicError("H and A do not conform");
+      if( householderScalars.Height() != H.DiagonalLength(offset) )
+          LogicError
+          ("householderScalars must be the same length as H's offset diag");
+    )
+    if( !panels.Formed() || panels.uplo != uplo || panels.offset != offset )
+        FormPackedReflectorPanels( uplo, offset, H, panels );
+    apply_packed_reflectors::ApplyPanels
+    ( side, order, conjugation, householderScalars, A, panels );
+}
+
 #define PROTO(F) \
   template void ApplyPackedReflectors \
   ( LeftOrRight side, UpperOrLower uplo, \
@@ -200,7 +288,31 @@ void ApplyPackedReflectors
     Conjugation conjugation, Int offset, \
     const AbstractDistMatrix<F>& H, \
     const AbstractDistMatrix<F>& householderScalars, \
-          AbstractDistMatrix<F>& A );
+          AbstractDistMatrix<F>& A ); \
+  template void FormPackedReflectorPanels \
+  ( UpperOrLower uplo, Int offset, \
+    const Matrix<F>& H, \
+    PackedReflectorPanels<F>& panels ); \
+  template void FormPackedReflectorPanels \
+  ( UpperOrLower uplo, Int offset, \
+    const AbstractDistMatrix<F>& H, \
+    DistPackedReflectorPanels<F>& panels ); \
+  template void ApplyPackedReflectors \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    VerticalOrHorizontal dir, ForwardOrBackward order, \
+    Conjugation conjugation, Int offset, \
+    const Matrix<F>& H, \
+    const Matrix<F>& householderScalars, \
+          Matrix<F>& A, \
+          PackedReflectorPanels<F>& panels ); \
+  template void ApplyPackedReflectors \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    VerticalOrHorizontal dir, ForwardOrBackward order, \
+    Conjugation conjugation, Int offset, \
+    const AbstractDistMatrix<F>& H, \
+    const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& A, \
+          DistPackedReflectorPanels<F>& panels );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,281 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_APPLYPACKEDREFLECTORS_CACHED_HPP
+#define EL_APPLYPACKEDREFLECTORS_CACHED_HPP
+
+namespace El {
+namespace apply_packed_reflectors {
+
+// Each of the vertical variants forms, for every panel of reflectors, the
+// explicit vectors V and the triangular matrix SInv from the Gram matrix
+// V^H V, with its diagonal replaced by the inverses of the (possibly
+// conjugated) Householder scalars. The panel boundaries do not depend upon
+// the side or order of the application, and only the triangle of V^H V
+// which is used does, via
+//
+//   (LEFT,FORWARD) and (RIGHT,BACKWARD)  ->  LOWER,
+//   (LEFT,BACKWARD) and (RIGHT,FORWARD)  ->  UPPER,
+//
+// so that retaining V and the full Gram matrix for each panel suffices for
+// every vertical variant.
+
+inline UpperOrLower
+PanelTriangle( LeftOrRight side, ForwardOrBackward order )
+{ return ( (side==LEFT) == (order==FORWARD) ? LOWER : UPPER ); }
+
+// The range of the rows of H (and of the rows or columns of A) touched by
+// the panel of reflectors beginning at the k'th one
+inline Range<Int>
+PanelRange( UpperOrLower uplo, Int offset, Int height, Int k, Int nb )
+{
+    const Int ki = k + ( offset>=0 ? 0 : -offset );
+    if( uplo == LOWER )
+        return IR(ki,height);
+    else
+        return IR(0,ki+nb);
+}
+
+template<typename F>
+void FormPanels
+( UpperOrLower uplo, Int offset,
+  const Matrix<F>& H,
+  PackedReflectorPanels<F>& panels )
+{
+    EL_DEBUG_CSE
+    const Int m = H.Height();
+    const Int diagLength = H.DiagonalLength(offset);
+    const Int jOff = ( offset>=0 ? offset : 0 );
+    const Int bsize = Blocksize();
+
+    panels.Empty();
+    panels.uplo = uplo;
+    panels.offset = offset;
+    panels.blocksize = bsize;
+    for( Int k=0; k<diagLength; k+=bsize )
+    {
+        const Int nb = Min(bsize,diagLength-k);
+        const Int kj = k+jOff;
+        const Range<Int> ind = PanelRange( uplo, offset, m, k, nb );
+
+        // Convert to an explicit matrix of (scaled) Householder vectors
+        panels.vectors.emplace_back( H( ind, IR(kj,kj+nb) ) );
+        auto& V = panels.vectors.back();
+        const Int diagOffset = ( uplo==LOWER ? 0 : V.Width()-V.Height() );
+        MakeTrapezoidal( uplo, V, diagOffset );
+        FillDiagonal( V, F(1), diagOffset );
+
+        panels.grams.emplace_back();
+        auto& G = panels.grams.back();
+        Herk( LOWER, ADJOINT, Base<F>(1), V, G );
+        MakeHermitian( LOWER, G );
+    }
+}
+
+template<typename F>
+void FormPanels
+( UpperOrLower uplo, Int offset,
+  const AbstractDistMatrix<F>& H,
+  DistPackedReflectorPanels<F>& panels )
+{
+    EL_DEBUG_CSE
+    const Int m = H.Height();
+    const Int diagLength = H.DiagonalLength(offset);
+    const Int jOff = ( offset>=0 ? offset : 0 );
+    const Int bsize = Blocksize();
+
+    const Grid& g = H.Grid();
+    auto HPan = unique_ptr<AbstractDistMatrix<F>>( H.Construct(g,H.Root()) );
+    DistMatrix<F> HPanCopy(g);
+
+    panels.Empty();
+    panels.uplo = uplo;
+    panels.offset = offset;
+    panels.blocksize = bsize;
+    for( Int k=0; k<diagLength; k+=bsize )
+    {
+        const Int nb = Min(bsize,diagLength-k);
+        const Int kj = k+jOff;
+        const Range<Int> ind = PanelRange( uplo, offset, m, k, nb );
+
+        // Convert to an explicit matrix of (scaled) Householder vectors
+        LockedView( *HPan, H, ind, IR(kj,kj+nb) );
+        Copy( *HPan, HPanCopy );
+        const Int diagOffset =
+          ( uplo==LOWER ? 0 : HPanCopy.Width()-HPanCopy.Height() );
+        MakeTrapezoidal( uplo, HPanCopy, diagOffset );
+        FillDiagonal( HPanCopy, F(1), diagOffset );
+        panels.vectors.emplace_back( HPanCopy );
+        const auto& V = panels.vectors.back();
+
+        panels.grams.emplace_back( g );
+        auto& G = panels.grams.back();
+        Zeros( G, nb, nb );
+        Herk
+        ( LOWER, ADJOINT,
+          Base<F>(1), V.LockedMatrix(),
+          Base<F>(0), G.Matrix() );
+        El::AllReduce( G, V.ColComm() );
+        MakeHermitian( LOWER, G.Matrix() );
+
+        panels.vectors_MC_STAR.emplace_back( g );
+        panels.vectors_MR_STAR.emplace_back( g );
+    }
+}
+
+template<typename F>
+void ApplyPanels
+( LeftOrRight side, ForwardOrBackward order,
+  Conjugation conjugation,
+  const Matrix<F>& householderScalars,
+        Matrix<F>& A,
+  const PackedReflectorPanels<F>& panels )
+{
+    EL_DEBUG_CSE
+    const Int numPanels = panels.vectors.size();
+    const Int bsize = panels.blocksize;
+    const Int height = ( side==LEFT ? A.Height() : A.Width() );
+    const UpperOrLower triangle = PanelTriangle( side, order );
+
+    Matrix<F> SInv, Z;
+    for( Int t=0; t<numPanels; ++t )
+    {
+        const Int p = ( order==FORWARD ? t : numPanels-1-t );
+        const Int k = p*bsize;
+        const auto& V = panels.vectors[p];
+        const Int nb = V.Width();
+        const Range<Int> ind =
+          PanelRange( panels.uplo, panels.offset, height, k, nb );
+        auto householderScalars1 = householderScalars( IR(k,k+nb), ALL );
+
+        SInv = panels.grams[p];
+        FixDiagonal( conjugation, householderScalars1, SInv );
+
+        if( side == LEFT )
+        {
+            auto ASub = A( ind, ALL );
+            // ASub := (I - V inv(SInv) V') ASub
+            Gemm( ADJOINT, NORMAL, F(1), V, ASub, Z );
+            Trsm( LEFT, triangle, NORMAL, NON_UNIT, F(1), SInv, Z );
+            Gemm( NORMAL, NORMAL, F(-1), V, Z, F(1), ASub );
+        }
+        else
+        {
+            auto ASub = A( ALL, ind );
+            // ASub := ASub (I - V inv(SInv) V')
+            Gemm( NORMAL, NORMAL, F(1), ASub, V, Z );
+            Trsm( RIGHT, triangle, NORMAL, NON_UNIT, F(1), SInv, Z );
+            Gemm( NORMAL, ADJOINT, F(-1), Z, V, F(1), ASub );
+        }
+    }
+}
+
+template<typename F>
+void ApplyPanels
+( LeftOrRight side, ForwardOrBackward order,
+  Conjugation conjugation,
+  const AbstractDistMatrix<F>& householderScalarsPre,
+        AbstractDistMatrix<F>& APre,
+        DistPackedReflectorPanels<F>& panels )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    auto& householderScalars = householderScalarsProx.GetLocked();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    const Int numPanels = panels.vectors.size();
+    const Int bsize = panels.blocksize;
+    const Int height = ( side==LEFT ? A.Height() : A.Width() );
+    const UpperOrLower triangle = PanelTriangle( side, order );
+
+    const Grid& g = A.Grid();
+    DistMatrix<F,STAR,STAR> SInv_STAR_STAR(g);
+    DistMatrix<F,STAR,MR> Z_STAR_MR(g);
+    DistMatrix<F,STAR,VR> Z_STAR_VR(g);
+    DistMatrix<F,STAR,MC> ZAdj_STAR_MC(g);
+    DistMatrix<F,STAR,VC> ZAdj_STAR_VC(g);
+    for( Int t=0; t<numPanels; ++t )
+    {
+        const Int p = ( order==FORWARD ? t : numPanels-1-t );
+        const Int k = p*bsize;
+        const auto& V = panels.vectors[p];
+        const Int nb = V.Width();
+        const Range<Int> ind =
+          PanelRange( panels.uplo, panels.offset, height, k, nb );
+
+        SInv_STAR_STAR = panels.grams[p];
+        auto householderScalars1 = householderScalars( IR(k,k+nb), ALL );
+        FixDiagonal( conjugation, householderScalars1, SInv_STAR_STAR );
+
+        if( side == LEFT )
+        {
+            auto ASub = A( ind, ALL );
+            auto& V_MC_STAR = panels.vectors_MC_STAR[p];
+            if( V_MC_STAR.Height() != V.Height() ||
+                V_MC_STAR.ColAlign() != ASub.ColAlign() )
+            {
+                V_MC_STAR.Empty();
+                V_MC_STAR.AlignWith( ASub );
+                V_MC_STAR = V;
+            }
+
+            // Z := V' ASub
+            Z_STAR_MR.AlignWith( ASub );
+            LocalGemm( ADJOINT, NORMAL, F(1), V_MC_STAR, ASub, Z_STAR_MR );
+            Z_STAR_VR.AlignWith( ASub );
+            Contract( Z_STAR_MR, Z_STAR_VR );
+
+            // Z := inv(SInv) V' ASub
+            LocalTrsm
+            ( LEFT, triangle, NORMAL, NON_UNIT, F(1), SInv_STAR_STAR,
+              Z_STAR_VR );
+
+            // ASub := (I - V inv(SInv) V') ASub = ASub - V Z
+            Z_STAR_MR = Z_STAR_VR;
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), V_MC_STAR, Z_STAR_MR, F(1), ASub );
+        }
+        else
+        {
+            auto ASub = A( ALL, ind );
+            auto& V_MR_STAR = panels.vectors_MR_STAR[p];
+            if( V_MR_STAR.Height() != V.Height() ||
+                V_MR_STAR.ColAlign() != ASub.RowAlign() )
+            {
+                V_MR_STAR.Empty();
+                V_MR_STAR.AlignWith( ASub );
+                V_MR_STAR = V;
+            }
+
+            // Z := ASub V
+            ZAdj_STAR_MC.AlignWith( ASub );
+            LocalGemm
+            ( ADJOINT, ADJOINT, F(1), V_MR_STAR, ASub, ZAdj_STAR_MC );
+            ZAdj_STAR_VC.AlignWith( ASub );
+            Contract( ZAdj_STAR_MC, ZAdj_STAR_VC );
+
+            // Z := ASub V inv(SInv)
+            LocalTrsm
+            ( LEFT, triangle, ADJOINT, NON_UNIT, F(1), SInv_STAR_STAR,
+              ZAdj_STAR_VC );
+
+            // ASub := ASub (I - V inv(SInv) V') = ASub - Z V'
+            ZAdj_STAR_MC = ZAdj_STAR_VC;
+            LocalGemm
+            ( ADJOINT, ADJOINT, F(-1), ZAdj_STAR_MC, V_MR_STAR, F(1), ASub );
+        }
+    }
+}
+
+} // namespace apply_packed_reflectors
+} // namespace El
+
+#endif // ifndef EL_APPLYPACKEDREFLECTORS_CACHED_HPP
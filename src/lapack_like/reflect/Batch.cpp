@@ -0,0 +1,157 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename F>
+ReflectorBatch<F>::ReflectorBatch( mpi::Comm comm )
+: comm_(comm)
+{ }
+
+template<typename F>
+void ReflectorBatch<F>::AddReflector
+( Int id, F tau, const Matrix<F>& v, const vector<int>& targets )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( v.Width() != 1 && v.Height() != 1 && v.Height()*v.Width() != 0 )
+          LogicError("v must be a vector");
+      if( reflectors_.count(id) )
+          LogicError("Reflector ",id," was already registered");
+    )
+    auto& reflector = reflectors_[id];
+    reflector.tau = tau;
+    // Store v as a column vector
+    if( v.Width() == 1 )
+        reflector.v = v;
+    else
+        Transpose( v, reflector.v );
+
+    const int commRank = mpi::Rank( comm_ );
+    for( const int target : targets )
+        if( target != commRank )
+            sends_.push_back( std::make_pair(target,id) );
+}
+
+template<typename F>
+void ReflectorBatch<F>::QueueApply
+( LeftOrRight side, Int id, Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    Apply apply;
+    apply.side = side;
+    apply.id = id;
+    apply.A = &A;
+    applies_.push_back( apply );
+}
+
+template<typename F>
+void ReflectorBatch<F>::Execute()
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm_ );
+
+    // Pack the (id,length) header and the [tau; v] entries of each reflector
+    // which is sent to another process
+    std::sort( sends_.begin(), sends_.end() );
+    vector<int> headerCounts(commSize,0), entryCounts(commSize,0);
+    for( const auto& send : sends_ )
+    {
+        headerCounts[send.first] += 2;
+        entryCounts[send.first] += reflectors_[send.second].v.Height() + 1;
+    }
+    vector<int> headerOffs, entryOffs;
+    const int numHeaders = Scan( headerCounts, headerOffs );
+    const int numEntries = Scan( entryCounts, entryOffs );
+    vector<Int> sendHeaders;
+    vector<F> sendEntries;
+    sendHeaders.reserve( numHeaders );
+    sendEntries.reserve( numEntries );
+    for( const auto& send : sends_ )
+    {
+        const auto& reflector = reflectors_[send.second];
+        const Int length = reflector.v.Height();
+        sendHeaders.push_back( send.second );
+        sendHeaders.push_back( length );
+        sendEntries.push_back( reflector.tau );
+        for( Int i=0; i<length; ++i )
+            sendEntries.push_back( reflector.v(i) );
+    }
+    sends_.clear();
+
+    // Exchange the reflectors (for which the headers arrive in the same order
+    // as the entries) and unpack them
+    auto recvHeaders =
+      mpi::AllToAll( sendHeaders, headerCounts, headerOffs, comm_ );
+    auto recvEntries =
+      mpi::AllToAll( sendEntries, entryCounts, entryOffs, comm_ );
+    Int entryOff = 0;
+    for( Int k=0; k<Int(recvHeaders.size()); k+=2 )
+    {
+        const Int id = recvHeaders[k];
+        const Int length = recvHeaders[k+1];
+        auto& reflector = reflectors_[id];
+        reflector.tau = recvEntries[entryOff++];
+        reflector.v.Resize( length, 1 );
+        for( Int i=0; i<length; ++i )
+            reflector.v(i) = recvEntries[entryOff++];
+    }
+
+    // Perform all of the applications locally
+    Matrix<F> u, z;
+    for( const auto& apply : applies_ )
+    {
+        auto it = reflectors_.find( apply.id );
+        if( it == reflectors_.end() )
+            LogicError("Reflector ",apply.id," was not available");
+        const auto& reflector = it->second;
+        const Int length = reflector.v.Height() + 1;
+        u.Resize( length, 1 );
+        u(0) = F(1);
+        auto u1 = u( IR(1,length), ALL );
+        u1 = reflector.v;
+
+        Matrix<F>& A = *apply.A;
+        if( apply.side == LEFT )
+        {
+            EL_DEBUG_ONLY(
+              if( A.Height() != length )
+                  LogicError("Reflector ",apply.id," does not conform");
+            )
+            // A := (I - tau u u') A = A - tau u (A' u)'
+            Gemv( ADJOINT, F(1), A, u, z );
+            Ger( -reflector.tau, u, z, A );
+        }
+        else
+        {
+            EL_DEBUG_ONLY(
+              if( A.Width() != length )
+                  LogicError("Reflector ",apply.id," does not conform");
+            )
+            // A := A (I - tau u u') = A - tau (A u) u'
+            Gemv( NORMAL, F(1), A, u, z );
+            Ger( -reflector.tau, z, u, A );
+        }
+    }
+    applies_.clear();
+    reflectors_.clear();
+}
+
+#define PROTO(F) \
+  template class ReflectorBatch<F>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,744 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace band {
+
+template<typename Field>
+Field Op( Orientation orientation, const Field& alpha )
+{ return orientation == ADJOINT ? Conj(alpha) : alpha; }
+
+// Send 'count' entries to the process 'to' while receiving 'count' entries
+// from the process 'from' of a chain, where either neighbor may lie outside
+// of [0,commSize). The sends and receives are ordered by the parity of the
+// rank so that no cycle of blocking sends can form.
+template<typename T>
+void ChainSendRecv
+( const T* sendBuf, int to, T* recvBuf, int from, int count, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const bool haveTo = ( to >= 0 && to < commSize && count > 0 );
+    const bool haveFrom = ( from >= 0 && from < commSize && count > 0 );
+    if( commRank % 2 == 0 )
+    {
+        if( haveTo )
+            mpi::Send( sendBuf, count, to, comm );
+        if( haveFrom )
+            mpi::Recv( recvBuf, count, from, comm );
+    }
+    else
+    {
+        if( haveFrom )
+            mpi::Recv( recvBuf, count, from, comm );
+        if( haveTo )
+            mpi::Send( sendBuf, count, to, comm );
+    }
+}
+
+// Return a pointer to column j of a banded matrix (in the LAPACK format)
+// which is offset so that its i'th entry is A(i,j)
+template<typename Field>
+Field* BandColumn( Matrix<Field>& band, Int upperBW, Int j )
+{ return band.Buffer() + (upperBW-j) + j*band.LDim(); }
+template<typename Field>
+const Field* BandColumn( const Matrix<Field>& band, Int upperBW, Int j )
+{ return band.LockedBuffer() + (upperBW-j) + j*band.LDim(); }
+
+} // namespace band
+
+// BandMatrix
+// ==========
+
+template<typename Field>
+BandMatrix<Field>::BandMatrix( Int n, Int lowerBW, Int upperBW )
+{
+    EL_DEBUG_CSE
+    Resize( n, lowerBW, upperBW );
+}
+
+template<typename Field>
+BandMatrix<Field>::BandMatrix
+( const Matrix<Field>& A, Int lowerBW, Int upperBW )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Banded matrices must be square");
+    Resize( A.Height(), lowerBW, upperBW );
+    for( Int j=0; j<n_; ++j )
+    {
+        const Int iBeg = Max( j-upperBW_, Int(0) );
+        const Int iEnd = Min( j+lowerBW_+1, n_ );
+        for( Int i=iBeg; i<iEnd; ++i )
+            band_(upperBW_+i-j,j) = A(i,j);
+    }
+}
+
+template<typename Field>
+void BandMatrix<Field>::Resize( Int n, Int lowerBW, Int upperBW )
+{
+    EL_DEBUG_CSE
+    if( n < 0 || lowerBW < 0 || upperBW < 0 )
+        LogicError
+        ("Invalid banded matrix dimensions: n=",n,", lowerBW=",lowerBW,
+         ", upperBW=",upperBW);
+    n_ = n;
+    lowerBW_ = Min( lowerBW, Max(n-1,Int(0)) );
+    upperBW_ = Min( upperBW, Max(n-1,Int(0)) );
+    Zeros( band_, lowerBW_+upperBW_+1, n_ );
+    factored_ = false;
+}
+
+template<typename Field>
+Field BandMatrix<Field>::Get( Int i, Int j ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( i < 0 || i >= n_ || j < 0 || j >= n_ )
+          LogicError("(",i,",",j,") is out of bounds");
+    )
+    if( i-j > lowerBW_ || j-i > upperBW_ )
+        return Field(0);
+    return band_(upperBW_+i-j,j);
+}
+
+template<typename Field>
+void BandMatrix<Field>::Set( Int i, Int j, Field value )
+{
+    EL_DEBUG_CSE
+    if( i < 0 || i >= n_ || j < 0 || j >= n_ ||
+        i-j > lowerBW_ || j-i > upperBW_ )
+        LogicError("(",i,",",j,") is outside of the band");
+    band_(upperBW_+i-j,j) = value;
+}
+
+template<typename Field>
+void BandMatrix<Field>::Update( Int i, Int j, Field value )
+{
+    EL_DEBUG_CSE
+    if( i < 0 || i >= n_ || j < 0 || j >= n_ ||
+        i-j > lowerBW_ || j-i > upperBW_ )
+        LogicError("(",i,",",j,") is outside of the band");
+    band_(upperBW_+i-j,j) += value;
+}
+
+template<typename Field>
+void BandMatrix<Field>::Apply
+( Orientation orientation,
+  Field alpha, const Matrix<Field>& X,
+  Field beta,        Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    if( X.Height() != n_ || Y.Height() != n_ || Y.Width() != X.Width() )
+        LogicError
+        ("Nonconformal application of a banded matrix of order ",n_," to a ",
+         X.Height()," x ",X.Width()," matrix with a ",Y.Height()," x ",
+         Y.Width()," result");
+    if( beta == Field(0) )
+        Zero( Y );
+    else if( beta != Field(1) )
+        Y *= beta;
+
+    const Int numRHS = X.Width();
+    for( Int k=0; k<numRHS; ++k )
+    {
+        for( Int j=0; j<n_; ++j )
+        {
+            const Int iBeg = Max( j-upperBW_, Int(0) );
+            const Int iEnd = Min( j+lowerBW_+1, n_ );
+            const Field* bandCol = band::BandColumn( band_, upperBW_, j );
+            if( orientation == NORMAL )
+            {
+                const Field gamma = alpha*X(j,k);
+                for( Int i=iBeg; i<iEnd; ++i )
+                    Y(i,k) += bandCol[i]*gamma;
+            }
+            else
+            {
+                Field gamma = 0;
+                for( Int i=iBeg; i<iEnd; ++i )
+                    gamma += band::Op(orientation,bandCol[i])*X(i,k);
+                Y(j,k) += alpha*gamma;
+            }
+        }
+    }
+}
+
+template<typename Field>
+void BandMatrix<Field>::Trsm
+( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag,
+  Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( B.Height() != n_ )
+        LogicError("Nonconformal banded triangular solve");
+    const bool unit = ( diag == UNIT );
+    const Int numRHS = B.Width();
+    for( Int k=0; k<numRHS; ++k )
+    {
+        Field* b = B.Buffer(0,k);
+        if( uplo == LOWER && orientation == NORMAL )
+        {
+            for( Int j=0; j<n_; ++j )
+            {
+                const Field* bandCol = band::BandColumn( band_, upperBW_, j );
+                if( !unit )
+                    b[j] /= bandCol[j];
+                const Int iEnd = Min( j+lowerBW_+1, n_ );
+                for( Int i=j+1; i<iEnd; ++i )
+                    b[i] -= bandCol[i]*b[j];
+            }
+        }
+        else if( uplo == UPPER && orientation == NORMAL )
+        {
+            for( Int j=n_-1; j>=0; --j )
+            {
+                const Field* bandCol = band::BandColumn( band_, upperBW_, j );
+                if( !unit )
+                    b[j] /= bandCol[j];
+                const Int iBeg = Max( j-upperBW_, Int(0) );
+                for( Int i=iBeg; i<j; ++i )
+                    b[i] -= bandCol[i]*b[j];
+            }
+        }
+        else if( uplo == LOWER )
+        {
+            for( Int j=n_-1; j>=0; --j )
+            {
+                const Field* bandCol = band::BandColumn( band_, upperBW_, j );
+                const Int iEnd = Min( j+lowerBW_+1, n_ );
+                for( Int i=j+1; i<iEnd; ++i )
+                    b[j] -= band::Op(orientation,bandCol[i])*b[i];
+                if( !unit )
+                    b[j] /= band::Op(orientation,bandCol[j]);
+            }
+        }
+        else
+        {
+            for( Int j=0; j<n_; ++j )
+            {
+                const Field* bandCol = band::BandColumn( band_, upperBW_, j );
+                const Int iBeg = Max( j-upperBW_, Int(0) );
+                for( Int i=iBeg; i<j; ++i )
+                    b[j] -= band::Op(orientation,bandCol[i])*b[i];
+                if( !unit )
+                    b[j] /= band::Op(orientation,bandCol[j]);
+            }
+        }
+    }
+}
+
+template<typename Field>
+void BandMatrix<Field>::Factor()
+{
+    EL_DEBUG_CSE
+    if( factored_ )
+        LogicError("The banded matrix was already factored");
+    for( Int j=0; j<n_; ++j )
+    {
+        Field* bandCol = band::BandColumn( band_, upperBW_, j );
+        const Field pivot = bandCol[j];
+        if( pivot == Field(0) )
+            throw SingularMatrixException();
+        const Int iEnd = Min( j+lowerBW_+1, n_ );
+        for( Int i=j+1; i<iEnd; ++i )
+            bandCol[i] /= pivot;
+
+        // Since no pivoting is performed, the Schur complement update stays
+        // within the band
+        const Int kEnd = Min( j+upperBW_+1, n_ );
+        for( Int k=j+1; k<kEnd; ++k )
+        {
+            Field* updateCol = band::BandColumn( band_, upperBW_, k );
+            const Field eta = updateCol[j];
+            for( Int i=j+1; i<iEnd; ++i )
+                updateCol[i] -= bandCol[i]*eta;
+        }
+    }
+    factored_ = true;
+}
+
+template<typename Field>
+void BandMatrix<Field>::Solve( Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Factor must be called before Solve");
+    Trsm( LOWER, NORMAL, UNIT, B );
+    Trsm( UPPER, NORMAL, NON_UNIT, B );
+}
+
+template<typename Field>
+void BandMatrix<Field>::Form( Matrix<Field>& A ) const
+{
+    EL_DEBUG_CSE
+    Zeros( A, n_, n_ );
+    for( Int j=0; j<n_; ++j )
+    {
+        const Int iBeg = Max( j-upperBW_, Int(0) );
+        const Int iEnd = Min( j+lowerBW_+1, n_ );
+        for( Int i=iBeg; i<iEnd; ++i )
+            A(i,j) = band_(upperBW_+i-j,j);
+    }
+}
+
+// DistBandMatrix
+// ==============
+
+template<typename Field>
+DistBandMatrix<Field>::DistBandMatrix( const El::Grid& grid )
+: grid_(&grid)
+{
+    EL_DEBUG_CSE
+    Resize( 0, 0, 0 );
+}
+
+template<typename Field>
+DistBandMatrix<Field>::DistBandMatrix
+( Int n, Int lowerBW, Int upperBW, const El::Grid& grid )
+: grid_(&grid)
+{
+    EL_DEBUG_CSE
+    Resize( n, lowerBW, upperBW );
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::Resize( Int n, Int lowerBW, Int upperBW )
+{
+    EL_DEBUG_CSE
+    if( n < 0 || lowerBW < 0 || upperBW < 0 )
+        LogicError
+        ("Invalid banded matrix dimensions: n=",n,", lowerBW=",lowerBW,
+         ", upperBW=",upperBW);
+    n_ = n;
+    lowerBW_ = Min( lowerBW, Max(n-1,Int(0)) );
+    upperBW_ = Min( upperBW, Max(n-1,Int(0)) );
+
+    // Mirror the distribution of DistMultiVec
+    const int commSize = grid_->Size();
+    blocksize_ = n_ / commSize;
+    if( blocksize_*commSize < n_ || n_ == 0 )
+        ++blocksize_;
+
+    Zeros( localBand_, lowerBW_+upperBW_+1, LocalHeight() );
+    SwapClear( remoteUpdates_ );
+    factored_ = false;
+    diag_.Resize( 0, 0, 0 );
+    V_.Empty();
+    W_.Empty();
+    reduced_.Empty();
+}
+
+template<typename Field>
+Int DistBandMatrix<Field>::FirstLocalRow() const EL_NO_EXCEPT
+{ return blocksize_*grid_->Rank(); }
+
+template<typename Field>
+Int DistBandMatrix<Field>::LocalHeight() const EL_NO_EXCEPT
+{ return Min(blocksize_,Max(n_-blocksize_*grid_->Rank(),Int(0))); }
+
+template<typename Field>
+bool DistBandMatrix<Field>::IsLocalRow( Int i ) const EL_NO_EXCEPT
+{
+    const Int firstLocalRow = FirstLocalRow();
+    return i >= firstLocalRow && i < firstLocalRow+LocalHeight();
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::QueueUpdate
+( Int i, Int j, Field value, bool passive )
+{
+    EL_DEBUG_CSE
+    if( IsLocalRow(i) )
+        UpdateLocal( i-FirstLocalRow(), j, value );
+    else if( !passive )
+        remoteUpdates_.push_back( Entry<Field>{i,j,value} );
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::ProcessQueues()
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = grid_->Comm();
+    const int commSize = grid_->Size();
+
+    // Send the remote updates to the owners of their rows
+    const Int numRemoteUpdates = remoteUpdates_.size();
+    vector<int> sendSizes( commSize, 0 );
+    for( Int s=0; s<numRemoteUpdates; ++s )
+        ++sendSizes[remoteUpdates_[s].i/blocksize_];
+    vector<int> recvSizes( commSize );
+    mpi::AllToAll( sendSizes.data(), 1, recvSizes.data(), 1, comm );
+    vector<int> sendOffs, recvOffs;
+    const int numSends = Scan( sendSizes, sendOffs );
+    const int numRecvs = Scan( recvSizes, recvOffs );
+
+    vector<Entry<Field>> sendBuf( numSends );
+    auto offs = sendOffs;
+    for( Int s=0; s<numRemoteUpdates; ++s )
+    {
+        const Entry<Field>& entry = remoteUpdates_[s];
+        sendBuf[offs[entry.i/blocksize_]++] = entry;
+    }
+    SwapClear( remoteUpdates_ );
+
+    vector<Entry<Field>> recvBuf( numRecvs );
+    mpi::AllToAll
+    ( sendBuf.data(), sendSizes.data(), sendOffs.data(),
+      recvBuf.data(), recvSizes.data(), recvOffs.data(), comm );
+
+    const Int firstLocalRow = FirstLocalRow();
+    for( const auto& entry : recvBuf )
+        UpdateLocal( entry.i-firstLocalRow, entry.j, entry.value );
+}
+
+template<typename Field>
+Field DistBandMatrix<Field>::GetLocal( Int iLoc, Int j ) const
+{
+    EL_DEBUG_CSE
+    const Int i = FirstLocalRow() + iLoc;
+    if( i-j > lowerBW_ || j-i > upperBW_ )
+        return Field(0);
+    return localBand_(lowerBW_+j-i,iLoc);
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::SetLocal( Int iLoc, Int j, Field value )
+{
+    EL_DEBUG_CSE
+    const Int i = FirstLocalRow() + iLoc;
+    if( iLoc < 0 || iLoc >= LocalHeight() || j < 0 || j >= n_ ||
+        i-j > lowerBW_ || j-i > upperBW_ )
+        LogicError("(",i,",",j,") is outside of the local band");
+    localBand_(lowerBW_+j-i,iLoc) = value;
+    factored_ = false;
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::UpdateLocal( Int iLoc, Int j, Field value )
+{
+    EL_DEBUG_CSE
+    const Int i = FirstLocalRow() + iLoc;
+    if( iLoc < 0 || iLoc >= LocalHeight() || j < 0 || j >= n_ ||
+        i-j > lowerBW_ || j-i > upperBW_ )
+        LogicError("(",i,",",j,") is outside of the local band");
+    localBand_(lowerBW_+j-i,iLoc) += value;
+    factored_ = false;
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::CheckDistribution() const
+{
+    EL_DEBUG_CSE
+    const int commSize = grid_->Size();
+    if( commSize == 1 )
+        return;
+    const Int minLocalHeight = n_ - blocksize_*(commSize-1);
+    if( minLocalHeight < Max(Max(lowerBW_,upperBW_),Int(1)) )
+        LogicError
+        ("Each of the ",commSize," processes must own at least ",
+         Max(Max(lowerBW_,upperBW_),Int(1))," rows, but the last owns ",
+         Max(minLocalHeight,Int(0)));
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::Apply
+( Orientation orientation,
+  Field alpha, const DistMultiVec<Field>& X,
+  Field beta,        DistMultiVec<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    if( X.Height() != n_ || Y.Height() != n_ || Y.Width() != X.Width() )
+        LogicError
+        ("Nonconformal application of a banded matrix of order ",n_," to a ",
+         X.Height()," x ",X.Width()," DistMultiVec with a ",Y.Height()," x ",
+         Y.Width()," result");
+    if( X.Blocksize() != blocksize_ || Y.Blocksize() != blocksize_ )
+        LogicError("X and Y must be distributed like the banded matrix");
+    CheckDistribution();
+    mpi::Comm comm = grid_->Comm();
+    const int commRank = grid_->Rank();
+    const Int localHeight = LocalHeight();
+    const Int firstLocalRow = FirstLocalRow();
+    const Int numRHS = X.Width();
+    const Int kl = lowerBW_;
+    const Int ku = upperBW_;
+
+    Matrix<Field>& YLoc = Y.Matrix();
+    if( beta == Field(0) )
+        Zero( YLoc );
+    else if( beta != Field(1) )
+        YLoc *= beta;
+
+    // The local rows interact with the global indices
+    // [firstLocalRow-kl,firstLocalRow+localHeight+ku), which we index within
+    // an extended matrix
+    const Int extHeight = kl + localHeight + ku;
+    Matrix<Field> XExt, YExt;
+    Zeros( XExt, extHeight, numRHS );
+    const Matrix<Field>& XLoc = X.LockedMatrix();
+    if( orientation == NORMAL )
+    {
+        // Receive the bottom kl rows of the previous process and the top ku
+        // rows of the next
+        auto XExtMid = XExt( IR(kl,kl+localHeight), ALL );
+        XExtMid = XLoc;
+        Matrix<Field> sendBuf, recvBuf;
+        sendBuf = XLoc( IR(localHeight-kl,localHeight), ALL );
+        Zeros( recvBuf, kl, numRHS );
+        band::ChainSendRecv
+        ( sendBuf.LockedBuffer(), commRank+1,
+          recvBuf.Buffer(), commRank-1, kl*numRHS, comm );
+        if( commRank > 0 )
+        {
+            auto XExtTop = XExt( IR(0,kl), ALL );
+            XExtTop = recvBuf;
+        }
+        sendBuf = XLoc( IR(0,ku), ALL );
+        Zeros( recvBuf, ku, numRHS );
+        band::ChainSendRecv
+        ( sendBuf.LockedBuffer(), commRank-1,
+          recvBuf.Buffer(), commRank+1, ku*numRHS, comm );
+        if( firstLocalRow+localHeight < n_ )
+        {
+            auto XExtBot = XExt( IR(kl+localHeight,extHeight), ALL );
+            XExtBot = recvBuf;
+        }
+
+        for( Int k=0; k<numRHS; ++k )
+        {
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Int i = firstLocalRow + iLoc;
+                const Int jBeg = Max( i-kl, Int(0) );
+                const Int jEnd = Min( i+ku+1, n_ );
+                Field gamma = 0;
+                for( Int j=jBeg; j<jEnd; ++j )
+                    gamma += localBand_(kl+j-i,iLoc)*
+                             XExt(j-firstLocalRow+kl,k);
+                YLoc(iLoc,k) += alpha*gamma;
+            }
+        }
+    }
+    else
+    {
+        Zeros( YExt, extHeight, numRHS );
+        for( Int k=0; k<numRHS; ++k )
+        {
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Int i = firstLocalRow + iLoc;
+                const Int jBeg = Max( i-kl, Int(0) );
+                const Int jEnd = Min( i+ku+1, n_ );
+                const Field gamma = alpha*XLoc(iLoc,k);
+                for( Int j=jBeg; j<jEnd; ++j )
+                    YExt(j-firstLocalRow+kl,k) +=
+                      band::Op(orientation,localBand_(kl+j-i,iLoc))*gamma;
+            }
+        }
+        YLoc += YExt( IR(kl,kl+localHeight), ALL );
+
+        // Return the contributions to the top kl rows of the previous
+        // process's block and to the bottom ku rows of the next
+        Matrix<Field> sendBuf, recvBuf;
+        sendBuf = YExt( IR(0,kl), ALL );
+        Zeros( recvBuf, kl, numRHS );
+        band::ChainSendRecv
+        ( sendBuf.LockedBuffer(), commRank-1,
+          recvBuf.Buffer(), commRank+1, kl*numRHS, comm );
+        if( firstLocalRow+localHeight < n_ )
+        {
+            auto YBot = YLoc( IR(localHeight-kl,localHeight), ALL );
+            YBot += recvBuf;
+        }
+        sendBuf = YExt( IR(kl+localHeight,extHeight), ALL );
+        Zeros( recvBuf, ku, numRHS );
+        band::ChainSendRecv
+        ( sendBuf.LockedBuffer(), commRank+1,
+          recvBuf.Buffer(), commRank-1, ku*numRHS, comm );
+        if( commRank > 0 )
+        {
+            auto YTop = YLoc( IR(0,ku), ALL );
+            YTop += recvBuf;
+        }
+    }
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::Factor()
+{
+    EL_DEBUG_CSE
+    if( !remoteUpdates_.empty() )
+        LogicError("ProcessQueues must be called before Factor");
+    CheckDistribution();
+    const int commSize = grid_->Size();
+    const int commRank = grid_->Rank();
+    const Int localHeight = LocalHeight();
+    const Int firstLocalRow = FirstLocalRow();
+    const Int lastLocalRow = firstLocalRow + localHeight;
+    const Int kl = lowerBW_;
+    const Int ku = upperBW_;
+
+    // Factor the diagonal block
+    diag_.Resize( localHeight, kl, ku );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalRow + iLoc;
+        const Int jBeg = Max( i-kl, firstLocalRow );
+        const Int jEnd = Min( i+ku+1, lastLocalRow );
+        for( Int j=jBeg; j<jEnd; ++j )
+            diag_.Set( iLoc, j-firstLocalRow, localBand_(kl+j-i,iLoc) );
+    }
+    diag_.Factor();
+    const Int s = kl + ku;
+    if( commSize == 1 || s == 0 )
+    {
+        factored_ = true;
+        return;
+    }
+
+    // V := inv(A_p) [0; B_p], where B_p couples the bottom ku rows to the top
+    // ku unknowns of the next process
+    Zeros( V_, localHeight, ku );
+    if( commRank < commSize-1 )
+    {
+        for( Int a=0; a<ku; ++a )
+        {
+            const Int iLoc = localHeight - ku + a;
+            const Int i = firstLocalRow + iLoc;
+            for( Int b=0; b<=a; ++b )
+                V_(iLoc,b) = localBand_(kl+(lastLocalRow+b)-i,iLoc);
+        }
+        diag_.Solve( V_ );
+    }
+
+    // W := inv(A_p) [C_p; 0], where C_p couples the top kl rows to the bottom
+    // kl unknowns of the previous process
+    Zeros( W_, localHeight, kl );
+    if( commRank > 0 )
+    {
+        for( Int a=0; a<kl; ++a )
+        {
+            const Int i = firstLocalRow + a;
+            for( Int b=a; b<kl; ++b )
+                W_(a,b) = localBand_(kl+(firstLocalRow-kl+b)-i,a);
+        }
+        diag_.Solve( W_ );
+    }
+
+    // Gather the top ku and bottom kl rows of [W_p, V_p] from each process
+    Matrix<Field> S;
+    Zeros( S, s, s );
+    auto STL = S( IR(0,ku), IR(0,kl) );
+    auto STR = S( IR(0,ku), IR(kl,s) );
+    auto SBL = S( IR(ku,s), IR(0,kl) );
+    auto SBR = S( IR(ku,s), IR(kl,s) );
+    STL = W_( IR(0,ku), ALL );
+    STR = V_( IR(0,ku), ALL );
+    SBL = W_( IR(localHeight-kl,localHeight), ALL );
+    SBR = V_( IR(localHeight-kl,localHeight), ALL );
+    vector<Field> SAll( s*s*commSize );
+    mpi::AllGather( S.LockedBuffer(), s*s, SAll.data(), s*s, grid_->Comm() );
+
+    // The reduced system for z = [t_0; b_0; t_1; b_1; ...], where t_p and b_p
+    // are the top ku and bottom kl entries of the solution on process p, is
+    //
+    //   [t_p; b_p] + [V_p^T; V_p^B] t_{p+1} + [W_p^T; W_p^B] b_{p-1}
+    //     = [g_p^T; g_p^B],
+    //
+    // with g_p = inv(A_p) f_p
+    const Int N = s*commSize;
+    Identity( reduced_, N, N );
+    for( Int p=0; p<commSize; ++p )
+    {
+        const Field* SBuf = &SAll[p*s*s];
+        for( Int r=0; r<s; ++r )
+        {
+            if( p > 0 )
+                for( Int c=0; c<kl; ++c )
+                    reduced_(p*s+r,(p-1)*s+ku+c) = SBuf[r+c*s];
+            if( p < commSize-1 )
+                for( Int c=0; c<ku; ++c )
+                    reduced_(p*s+r,(p+1)*s+c) = SBuf[r+(kl+c)*s];
+        }
+    }
+    LU( reduced_, reducedPerm_ );
+    factored_ = true;
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::Solve( DistMultiVec<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Factor must be called before Solve");
+    if( B.Height() != n_ )
+        LogicError("A and B did not conform");
+    if( B.Blocksize() != blocksize_ )
+        LogicError("B must be distributed like the banded matrix");
+    const int commSize = grid_->Size();
+    const int commRank = grid_->Rank();
+    const Int localHeight = LocalHeight();
+    const Int numRHS = B.Width();
+    const Int kl = lowerBW_;
+    const Int ku = upperBW_;
+    const Int s = kl + ku;
+
+    // G := inv(A_p) F
+    Matrix<Field>& G = B.Matrix();
+    diag_.Solve( G );
+    if( commSize == 1 || s == 0 )
+        return;
+
+    // Gather and solve the right-hand sides of the reduced system
+    Matrix<Field> GEnds;
+    Zeros( GEnds, s, numRHS );
+    auto GEndsT = GEnds( IR(0,ku), ALL );
+    auto GEndsB = GEnds( IR(ku,s), ALL );
+    GEndsT = G( IR(0,ku), ALL );
+    GEndsB = G( IR(localHeight-kl,localHeight), ALL );
+    vector<Field> GAll( s*numRHS*commSize );
+    mpi::AllGather
+    ( GEnds.LockedBuffer(), s*numRHS, GAll.data(), s*numRHS, grid_->Comm() );
+    const Int N = s*commSize;
+    Matrix<Field> Z( N, numRHS );
+    for( Int p=0; p<commSize; ++p )
+        for( Int k=0; k<numRHS; ++k )
+            for( Int r=0; r<s; ++r )
+                Z(p*s+r,k) = GAll[p*s*numRHS+r+k*s];
+    lu::SolveAfter( NORMAL, reduced_, reducedPerm_, Z );
+
+    // x_p := g_p - V_p t_{p+1} - W_p b_{p-1}
+    if( commRank < commSize-1 && ku > 0 )
+    {
+        auto tNext = Z( IR((commRank+1)*s,(commRank+1)*s+ku), ALL );
+        Gemm( NORMAL, NORMAL, Field(-1), V_, tNext, Field(1), G );
+    }
+    if( commRank > 0 && kl > 0 )
+    {
+        auto bPrev = Z( IR((commRank-1)*s+ku,commRank*s), ALL );
+        Gemm( NORMAL, NORMAL, Field(-1), W_, bPrev, Field(1), G );
+    }
+}
+
+#define PROTO(Field) \
+  template class BandMatrix<Field>; \
+  template class DistBandMatrix<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
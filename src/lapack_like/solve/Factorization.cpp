@@ -0,0 +1,440 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+Factorization<Field>::Factorization
+( FactorizationType type, const Matrix<Field>& A )
+: type_(type), n_(A.Height())
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Only square matrices can be factored");
+    A_ = A;
+    Factor();
+}
+
+template<typename Field>
+Factorization<Field>::Factorization
+( FactorizationType type, const AbstractDistMatrix<Field>& A )
+: type_(type), n_(A.Height()), grid_(&A.Grid())
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Only square matrices can be factored");
+    const El::Grid& g = A.Grid();
+    ADist_.SetGrid( g );
+    householderScalarsDist_.SetGrid( g );
+    signatureDist_.SetGrid( g );
+    dDist_.SetGrid( g );
+    dSubDist_.SetGrid( g );
+    PDist_.SetGrid( g );
+    UDist_.SetGrid( g );
+    VDist_.SetGrid( g );
+    YDist_.SetGrid( g );
+    ZDist_.SetGrid( g );
+    Copy( A, ADist_ );
+    Factor();
+}
+
+template<typename Field>
+void Factorization<Field>::Factor()
+{
+    EL_DEBUG_CSE
+    const bool conjugate = true;
+    if( Distributed() )
+    {
+        switch( type_ )
+        {
+        case LU_FACTORIZATION: LU( ADist_, PDist_ ); break;
+        case CHOLESKY_FACTORIZATION: Cholesky( LOWER, ADist_ ); break;
+        case LDL_FACTORIZATION:
+        {
+            DistMatrix<Field,MD,STAR> dSub( *grid_ );
+            LDL( ADist_, dSub, PDist_, conjugate );
+            // Store the (quasi-)diagonal in the form needed for solves
+            Copy( GetDiagonal(ADist_), dDist_ );
+            Copy( dSub, dSubDist_ );
+            break;
+        }
+        case QR_FACTORIZATION:
+            QR( ADist_, householderScalarsDist_, signatureDist_ );
+            break;
+        default: LogicError("Unsupported factorization type");
+        }
+    }
+    else
+    {
+        switch( type_ )
+        {
+        case LU_FACTORIZATION: LU( A_, P_ ); break;
+        case CHOLESKY_FACTORIZATION: Cholesky( LOWER, A_ ); break;
+        case LDL_FACTORIZATION: LDL( A_, dSub_, P_, conjugate ); break;
+        case QR_FACTORIZATION:
+            QR( A_, householderScalars_, signature_ );
+            break;
+        default: LogicError("Unsupported factorization type");
+        }
+    }
+}
+
+// Each of the base solves only handles the NORMAL and ADJOINT orientations
+template<typename Field>
+void Factorization<Field>::BaseSolve
+( Orientation orientation, Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    const bool conjugated = true;
+    switch( type_ )
+    {
+    case LU_FACTORIZATION:
+        lu::SolveAfter( orientation, A_, P_, B );
+        break;
+    case CHOLESKY_FACTORIZATION:
+        cholesky::SolveAfter( LOWER, NORMAL, A_, B );
+        break;
+    case LDL_FACTORIZATION:
+        ldl::SolveAfter( A_, dSub_, P_, B, conjugated );
+        break;
+    case QR_FACTORIZATION:
+        if( orientation == NORMAL )
+        {
+            qr::ApplyQ
+            ( LEFT, ADJOINT, A_, householderScalars_, signature_, B );
+            Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), A_, B );
+        }
+        else
+        {
+            Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, Field(1), A_, B );
+            qr::ApplyQ
+            ( LEFT, NORMAL, A_, householderScalars_, signature_, B );
+        }
+        break;
+    default: LogicError("Unsupported factorization type");
+    }
+}
+
+template<typename Field>
+void Factorization<Field>::BaseSolve
+( Orientation orientation, DistMatrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    const bool conjugated = true;
+    switch( type_ )
+    {
+    case LU_FACTORIZATION:
+        if( orientation == NORMAL )
+        {
+            PDist_.PermuteRows( B );
+            CachedTrsm( LOWER, NORMAL, UNIT, B );
+            CachedTrsm( UPPER, NORMAL, NON_UNIT, B );
+        }
+        else
+        {
+            CachedTrsm( UPPER, ADJOINT, NON_UNIT, B );
+            CachedTrsm( LOWER, ADJOINT, UNIT, B );
+            PDist_.InversePermuteRows( B );
+        }
+        break;
+    case CHOLESKY_FACTORIZATION:
+        CachedTrsm( LOWER, NORMAL, NON_UNIT, B );
+        CachedTrsm( LOWER, ADJOINT, NON_UNIT, B );
+        break;
+    case LDL_FACTORIZATION:
+        PDist_.PermuteRows( B );
+        CachedTrsm( LOWER, NORMAL, UNIT, B );
+        QuasiDiagonalSolve( LEFT, LOWER, dDist_, dSubDist_, B, conjugated );
+        CachedTrsm( LOWER, ADJOINT, UNIT, B );
+        PDist_.InversePermuteRows( B );
+        break;
+    case QR_FACTORIZATION:
+        if( orientation == NORMAL )
+        {
+            qr::ApplyQ
+            ( LEFT, ADJOINT, ADist_, householderScalarsDist_, signatureDist_,
+              B );
+            CachedTrsm( UPPER, NORMAL, NON_UNIT, B );
+        }
+        else
+        {
+            CachedTrsm( UPPER, ADJOINT, NON_UNIT, B );
+            qr::ApplyQ
+            ( LEFT, NORMAL, ADist_, householderScalarsDist_, signatureDist_,
+              B );
+        }
+        break;
+    default: LogicError("Unsupported factorization type");
+    }
+}
+
+// A variant of the blocked left Trsm's (e.g., trsm::LLNLarge) whose
+// redistributions of the triangular matrix are computed once. Since both the
+// factor and X are [MC,MR] with zero alignments, the cached panels are
+// aligned with the corresponding rows of X.
+template<typename Field>
+void Factorization<Field>::CachedTrsm
+( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag,
+  DistMatrix<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    const El::Grid& g = *grid_;
+    const Int bsize = Blocksize();
+    const Int numBlocks = ( n_ > 0 ? (n_+bsize-1)/bsize : 0 );
+    const bool normal = ( orientation == NORMAL );
+    const bool forward = ( (uplo == LOWER) == normal );
+    TrsmCache& cache = caches_[2*(uplo==UPPER)+(normal ? 0 : 1)];
+
+    auto remaining = [&]( Int k, Int nb )
+    { return forward ? IR(k+nb,n_) : IR(0,k); };
+    if( cache.blocksize != bsize )
+    {
+        cache.blocksize = bsize;
+        cache.diagBlocks.clear();
+        cache.normalPanels.clear();
+        cache.adjointPanels.clear();
+        cache.diagBlocks.reserve( numBlocks );
+        for( Int b=0; b<numBlocks; ++b )
+        {
+            const Int k = b*bsize;
+            const Int nb = Min(bsize,n_-k);
+            const Range<Int> ind1( k, k+nb ), ind2 = remaining( k, nb );
+            cache.diagBlocks.emplace_back( g );
+            cache.diagBlocks.back() = ADist_( ind1, ind1 );
+            if( normal )
+            {
+                auto A21 = ADist_( ind2, ind1 );
+                cache.normalPanels.emplace_back( g );
+                cache.normalPanels.back().AlignWith( A21 );
+                cache.normalPanels.back() = A21;
+            }
+            else
+            {
+                cache.adjointPanels.emplace_back( g );
+                cache.adjointPanels.back().AlignRows( ind2.beg % g.Height() );
+                cache.adjointPanels.back() = ADist_( ind1, ind2 );
+            }
+        }
+    }
+
+    DistMatrix<Field,STAR,VR> X1_STAR_VR(g);
+    DistMatrix<Field,STAR,MR> X1_STAR_MR(g);
+    for( Int step=0; step<numBlocks; ++step )
+    {
+        const Int b = ( forward ? step : numBlocks-1-step );
+        const Int k = b*bsize;
+        const Int nb = Min(bsize,n_-k);
+        const Range<Int> ind1( k, k+nb ), ind2 = remaining( k, nb );
+        auto X1 = X( ind1, ALL );
+        auto X2 = X( ind2, ALL );
+
+        X1_STAR_VR = X1;
+        LocalTrsm
+        ( LEFT, uplo, orientation, diag, Field(1), cache.diagBlocks[b],
+          X1_STAR_VR );
+        X1_STAR_MR.AlignWith( X2 );
+        X1_STAR_MR = X1_STAR_VR;
+        X1 = X1_STAR_MR;
+        if( normal )
+            LocalGemm
+            ( NORMAL, NORMAL,
+              Field(-1), cache.normalPanels[b], X1_STAR_MR, Field(1), X2 );
+        else
+            LocalGemm
+            ( orientation, NORMAL,
+              Field(-1), cache.adjointPanels[b], X1_STAR_MR, Field(1), X2 );
+    }
+}
+
+// K := I + V^H Y, where Y = inv(A) U, so that the adjoint solves may use
+// K^H = I + U^H Z, where Z = inv(A)^H V
+template<typename Field>
+void Factorization<Field>::FormCapacitance()
+{
+    EL_DEBUG_CSE
+    const Int rank = UpdateRank();
+    if( Distributed() )
+    {
+        DistMatrix<Field,STAR,STAR> K_STAR_STAR(*grid_);
+        Identity( K_STAR_STAR, rank, rank );
+        Gemm
+        ( ADJOINT, NORMAL, Field(1), VDist_, YDist_, Field(1), K_STAR_STAR );
+        K_ = K_STAR_STAR.Matrix();
+    }
+    else
+    {
+        Identity( K_, rank, rank );
+        Gemm( ADJOINT, NORMAL, Field(1), V_, Y_, Field(1), K_ );
+    }
+    LU( K_, KPerm_ );
+}
+
+template<typename Field>
+void Factorization<Field>::LowRankUpdate
+( const Matrix<Field>& U, const Matrix<Field>& V )
+{
+    EL_DEBUG_CSE
+    if( Distributed() )
+        LogicError("Expected a distributed low-rank update");
+    if( U.Height() != n_ || V.Height() != n_ || U.Width() != V.Width() )
+        LogicError("U and V must be n x r");
+    // Only the columns of the new update require solves
+    Matrix<Field> YNew( U ), ZNew( V );
+    BaseSolve( NORMAL, YNew );
+    BaseSolve( ADJOINT, ZNew );
+    if( UpdateRank() == 0 )
+    {
+        U_ = U;
+        V_ = V;
+        Y_ = YNew;
+        Z_ = ZNew;
+    }
+    else
+    {
+        Matrix<Field> UOld( U_ ), VOld( V_ ), YOld( Y_ ), ZOld( Z_ );
+        HCat( UOld, U, U_ );
+        HCat( VOld, V, V_ );
+        HCat( YOld, YNew, Y_ );
+        HCat( ZOld, ZNew, Z_ );
+    }
+    FormCapacitance();
+}
+
+template<typename Field>
+void Factorization<Field>::LowRankUpdate
+( const AbstractDistMatrix<Field>& U, const AbstractDistMatrix<Field>& V )
+{
+    EL_DEBUG_CSE
+    if( !Distributed() )
+        LogicError("Expected a sequential low-rank update");
+    if( U.Height() != n_ || V.Height() != n_ || U.Width() != V.Width() )
+        LogicError("U and V must be n x r");
+    const El::Grid& g = *grid_;
+    DistMatrix<Field> YNew(g), ZNew(g);
+    Copy( U, YNew );
+    Copy( V, ZNew );
+    BaseSolve( NORMAL, YNew );
+    BaseSolve( ADJOINT, ZNew );
+    if( UpdateRank() == 0 )
+    {
+        Copy( U, UDist_ );
+        Copy( V, VDist_ );
+        YDist_ = YNew;
+        ZDist_ = ZNew;
+    }
+    else
+    {
+        DistMatrix<Field> UOld( UDist_ ), VOld( VDist_ ), YOld( YDist_ ),
+          ZOld( ZDist_ );
+        HCat( UOld, U, UDist_ );
+        HCat( VOld, V, VDist_ );
+        HCat( YOld, YNew, YDist_ );
+        HCat( ZOld, ZNew, ZDist_ );
+    }
+    FormCapacitance();
+}
+
+template<typename Field>
+void Factorization<Field>::ClearUpdates()
+{
+    EL_DEBUG_CSE
+    U_.Empty();
+    V_.Empty();
+    Y_.Empty();
+    Z_.Empty();
+    UDist_.Empty();
+    VDist_.Empty();
+    YDist_.Empty();
+    ZDist_.Empty();
+    K_.Empty();
+}
+
+template<typename Field>
+void Factorization<Field>::Solve
+( Orientation orientation, Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( Distributed() )
+        LogicError("Expected distributed right-hand sides");
+    if( B.Height() != n_ )
+        LogicError("A and B did not conform");
+    if( orientation == TRANSPOSE )
+    {
+        // inv(A^T) B = conj(inv(A^H) conj(B))
+        Conjugate( B );
+        Solve( ADJOINT, B );
+        Conjugate( B );
+        return;
+    }
+    BaseSolve( orientation, B );
+
+    const Int rank = UpdateRank();
+    if( rank == 0 )
+        return;
+    const bool normal = ( orientation == NORMAL );
+    Matrix<Field> W;
+    Gemm( ADJOINT, NORMAL, Field(1), normal ? V_ : U_, B, W );
+    lu::SolveAfter( orientation, K_, KPerm_, W );
+    Gemm( NORMAL, NORMAL, Field(-1), normal ? Y_ : Z_, W, Field(1), B );
+}
+
+template<typename Field>
+void Factorization<Field>::Solve
+( Orientation orientation, AbstractDistMatrix<Field>& BPre ) const
+{
+    EL_DEBUG_CSE
+    if( !Distributed() )
+        LogicError("Expected sequential right-hand sides");
+    if( BPre.Height() != n_ )
+        LogicError("A and B did not conform");
+    if( orientation == TRANSPOSE )
+    {
+        // inv(A^T) B = conj(inv(A^H) conj(B))
+        Conjugate( BPre );
+        Solve( ADJOINT, BPre );
+        Conjugate( BPre );
+        return;
+    }
+    // The cached panels assume that B is aligned with the factor
+    ElementalProxyCtrl control;
+    control.colConstrain = true;
+    control.rowConstrain = true;
+    control.colAlign = 0;
+    control.rowAlign = 0;
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre, control );
+    auto& B = BProx.Get();
+    BaseSolve( orientation, B );
+
+    const Int rank = UpdateRank();
+    if( rank == 0 )
+        return;
+    const bool normal = ( orientation == NORMAL );
+    DistMatrix<Field,STAR,STAR> W_STAR_STAR( *grid_ );
+    Zeros( W_STAR_STAR, rank, B.Width() );
+    Gemm
+    ( ADJOINT, NORMAL, Field(1), normal ? VDist_ : UDist_, B,
+      Field(0), W_STAR_STAR );
+    lu::SolveAfter( orientation, K_, KPerm_, W_STAR_STAR.Matrix() );
+    DistMatrix<Field> W( W_STAR_STAR );
+    Gemm
+    ( NORMAL, NORMAL, Field(-1), normal ? YDist_ : ZDist_, W, Field(1), B );
+}
+
+#define PROTO(Field) \
+  template class Factorization<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,498 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace hodlr {
+
+// Compute an interpolative decomposition B ~= B(:,skeleton) W of an m x n
+// block from the sketches Omega B returned by sketch(l,S), which must return
+// B itself when l = m. The number of sketch rows is doubled until the rank
+// falls at least 'oversample' below it (or the rank is saturated).
+template<typename Field,class SketchFunc>
+void Interpolate
+( Int m, Int n, const SketchFunc& sketch,
+  const HODLRCtrl<Base<Field>>& ctrl,
+  vector<Int>& skeleton, Matrix<Field>& W )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    QRCtrl<Real> qrCtrl;
+    qrCtrl.colPiv = true;
+    qrCtrl.adaptive = true;
+    qrCtrl.tol = ctrl.relTol;
+    if( ctrl.maxRank > 0 )
+    {
+        qrCtrl.boundRank = true;
+        qrCtrl.maxRank = ctrl.maxRank;
+    }
+
+    Matrix<Field> S, Z;
+    Permutation Omega;
+    Int rank = 0;
+    Int l = Min( m, Max(2*ctrl.oversample,Int(1)) );
+    while( true )
+    {
+        sketch( l, S );
+        ID( S, Omega, Z, qrCtrl, true );
+        rank = Z.Height();
+        if( l == m || rank == n || rank+ctrl.oversample <= l ||
+            (ctrl.maxRank > 0 && rank >= ctrl.maxRank) )
+            break;
+        l = Min( 2*l, m );
+    }
+
+    // Column j of S Omega^T is column perm(0,j) of S
+    Matrix<Int> perm( 1, n );
+    for( Int j=0; j<n; ++j )
+        perm(0,j) = j;
+    Omega.PermuteCols( perm );
+
+    skeleton.resize( rank );
+    Zeros( W, rank, n );
+    for( Int j=0; j<rank; ++j )
+    {
+        skeleton[j] = perm(0,j);
+        W(j,perm(0,j)) = Field(1);
+    }
+    for( Int j=rank; j<n; ++j )
+        for( Int i=0; i<rank; ++i )
+            W(i,perm(0,j)) = Z(i,j-rank);
+}
+
+// Y := Y + alpha op(U W) X
+template<typename Field>
+void LowRankUpdate
+( Orientation orientation,
+  Field alpha, const Matrix<Field>& U, const Matrix<Field>& W,
+               const Matrix<Field>& X, Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    if( U.Width() == 0 )
+        return;
+    const bool normal = ( orientation == NORMAL );
+    Matrix<Field> T;
+    Gemm( orientation, NORMAL, Field(1), (normal ? W : U), X, T );
+    Gemm( orientation, NORMAL, alpha, (normal ? U : W), T, Field(1), Y );
+}
+
+// The number of nodes of the tree produced by recursive bisection
+inline Int NumNodes( Int size, Int leafSize )
+{
+    if( size <= leafSize )
+        return 1;
+    return 1 + NumNodes( size/2, leafSize ) + NumNodes( size-size/2, leafSize );
+}
+
+} // namespace hodlr
+
+// The nodes are stored in preorder and are allocated up front so that they
+// are never relocated
+template<typename Field>
+void HODLRMatrix<Field>::BuildTree( Int leafSize )
+{
+    EL_DEBUG_CSE
+    nodes_ = vector<Node>( hodlr::NumNodes( n_, leafSize ) );
+    Int numNodes = 0;
+    BuildSubtree( 0, n_, leafSize, numNodes );
+}
+
+template<typename Field>
+Int HODLRMatrix<Field>::BuildSubtree
+( Int offset, Int size, Int leafSize, Int& numNodes )
+{
+    EL_DEBUG_CSE
+    const Int index = numNodes++;
+    Node& node = nodes_[index];
+    node.offset = offset;
+    node.size = size;
+    if( size > leafSize )
+    {
+        const Int leftSize = size/2;
+        node.left = BuildSubtree( offset, leftSize, leafSize, numNodes );
+        node.right =
+          BuildSubtree( offset+leftSize, size-leftSize, leafSize, numNodes );
+    }
+    return index;
+}
+
+template<typename Field>
+HODLRMatrix<Field>::HODLRMatrix
+( const Matrix<Field>& A, const HODLRCtrl<Base<Field>>& ctrl )
+: n_(A.Height())
+{
+    EL_DEBUG_CSE
+    if( A.Width() != n_ )
+        LogicError("A must be square");
+    if( ctrl.leafSize < 1 )
+        LogicError("The leaf size must be positive");
+    if( n_ == 0 )
+        return;
+    BuildTree( ctrl.leafSize );
+
+    vector<Int> skeleton;
+    auto compress = [&]( Range<Int> I, Range<Int> J,
+                         Matrix<Field>& U, Matrix<Field>& W )
+      {
+          auto B = A( I, J );
+          auto sketch = [&]( Int l, Matrix<Field>& S )
+            {
+                if( l == B.Height() )
+                {
+                    S = B;
+                    return;
+                }
+                Matrix<Field> G;
+                Gaussian( G, l, B.Height() );
+                Gemm( NORMAL, NORMAL, Field(1), G, B, S );
+            };
+          hodlr::Interpolate
+          ( B.Height(), B.Width(), sketch, ctrl, skeleton, W );
+          for( auto& j : skeleton )
+              j += J.beg;
+          GetSubmatrix( A, I, skeleton, U );
+      };
+    for( auto& node : nodes_ )
+    {
+        if( node.left < 0 )
+        {
+            const Range<Int> I( node.offset, node.offset+node.size );
+            node.D = A( I, I );
+            continue;
+        }
+        const Node& left = nodes_[node.left];
+        const Node& right = nodes_[node.right];
+        const Range<Int> I1( left.offset, left.offset+left.size );
+        const Range<Int> I2( right.offset, right.offset+right.size );
+        compress( I1, I2, node.U12, node.W12 );
+        compress( I2, I1, node.U21, node.W21 );
+    }
+}
+
+template<typename Field>
+HODLRMatrix<Field>::HODLRMatrix
+( const AbstractDistMatrix<Field>& APre, const HODLRCtrl<Base<Field>>& ctrl )
+: n_(APre.Height()), grid_(&APre.Grid())
+{
+    EL_DEBUG_CSE
+    if( APre.Width() != n_ )
+        LogicError("A must be square");
+    if( ctrl.leafSize < 1 )
+        LogicError("The leaf size must be positive");
+    if( n_ == 0 )
+        return;
+    BuildTree( ctrl.leafSize );
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const El::Grid& g = A.Grid();
+
+    // Every process receives each (small) sketch and computes the same
+    // interpolative decomposition from it
+    vector<Int> skeleton;
+    auto compress = [&]( Range<Int> I, Range<Int> J,
+                         Matrix<Field>& U, Matrix<Field>& W )
+      {
+          auto B = A( I, J );
+          auto sketch = [&]( Int l, Matrix<Field>& S )
+            {
+                DistMatrix<Field,STAR,STAR> S_STAR_STAR(g);
+                if( l == B.Height() )
+                {
+                    Copy( B, S_STAR_STAR );
+                }
+                else
+                {
+                    DistMatrix<Field> G(g), SDist(g);
+                    Gaussian( G, l, B.Height() );
+                    Gemm( NORMAL, NORMAL, Field(1), G, B, SDist );
+                    Copy( SDist, S_STAR_STAR );
+                }
+                S = S_STAR_STAR.Matrix();
+            };
+          hodlr::Interpolate
+          ( B.Height(), B.Width(), sketch, ctrl, skeleton, W );
+          for( auto& j : skeleton )
+              j += J.beg;
+          DistMatrix<Field,STAR,STAR> U_STAR_STAR(g);
+          GetSubmatrix( A, I, skeleton, U_STAR_STAR );
+          U = U_STAR_STAR.Matrix();
+      };
+    for( auto& node : nodes_ )
+    {
+        if( node.left < 0 )
+        {
+            const Range<Int> I( node.offset, node.offset+node.size );
+            DistMatrix<Field,STAR,STAR> D_STAR_STAR( A(I,I) );
+            node.D = D_STAR_STAR.Matrix();
+            continue;
+        }
+        const Node& left = nodes_[node.left];
+        const Node& right = nodes_[node.right];
+        const Range<Int> I1( left.offset, left.offset+left.size );
+        const Range<Int> I2( right.offset, right.offset+right.size );
+        compress( I1, I2, node.U12, node.W12 );
+        compress( I2, I1, node.U21, node.W21 );
+    }
+}
+
+template<typename Field>
+void HODLRMatrix<Field>::ApplyNode
+( Int index, Orientation orientation,
+  Field alpha, const Matrix<Field>& X, Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    const Node& node = nodes_[index];
+    if( node.left < 0 )
+    {
+        const Range<Int> I( node.offset, node.offset+node.size );
+        auto YI = Y( I, ALL );
+        Gemm( orientation, NORMAL, alpha, node.D, X(I,ALL), Field(1), YI );
+        return;
+    }
+    ApplyNode( node.left, orientation, alpha, X, Y );
+    ApplyNode( node.right, orientation, alpha, X, Y );
+
+    const Node& left = nodes_[node.left];
+    const Node& right = nodes_[node.right];
+    const Range<Int> I1( left.offset, left.offset+left.size );
+    const Range<Int> I2( right.offset, right.offset+right.size );
+    auto X1 = X( I1, ALL );
+    auto X2 = X( I2, ALL );
+    auto Y1 = Y( I1, ALL );
+    auto Y2 = Y( I2, ALL );
+    if( orientation == NORMAL )
+    {
+        hodlr::LowRankUpdate( orientation, alpha, node.U12, node.W12, X2, Y1 );
+        hodlr::LowRankUpdate( orientation, alpha, node.U21, node.W21, X1, Y2 );
+    }
+    else
+    {
+        hodlr::LowRankUpdate( orientation, alpha, node.U21, node.W21, X2, Y1 );
+        hodlr::LowRankUpdate( orientation, alpha, node.U12, node.W12, X1, Y2 );
+    }
+}
+
+template<typename Field>
+void HODLRMatrix<Field>::Apply
+( Orientation orientation,
+  Field alpha, const Matrix<Field>& X,
+  Field beta,        Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    if( X.Height() != n_ || Y.Height() != n_ || Y.Width() != X.Width() )
+        LogicError
+        ("Nonconformal application of an operator of order ",n_," to a ",
+         X.Height()," x ",X.Width()," matrix with a ",Y.Height()," x ",
+         Y.Width()," result");
+    if( beta == Field(0) )
+        Zero( Y );
+    else if( beta != Field(1) )
+        Y *= beta;
+    if( n_ > 0 )
+        ApplyNode( 0, orientation, alpha, X, Y );
+}
+
+template<typename Field>
+void HODLRMatrix<Field>::Apply
+( Orientation orientation,
+  Field alpha, const DistMultiVec<Field>& X,
+  Field beta,        DistMultiVec<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    if( X.Height() != n_ || Y.Height() != n_ || Y.Width() != X.Width() )
+        LogicError
+        ("Nonconformal application of an operator of order ",n_," to a ",
+         X.Height()," x ",X.Width()," DistMultiVec with a ",Y.Height()," x ",
+         Y.Width()," result");
+    DistMatrix<Field,STAR,STAR> X_STAR_STAR( X.Grid() );
+    Copy( X, X_STAR_STAR );
+    Matrix<Field> YFull;
+    Zeros( YFull, n_, X.Width() );
+    Apply( orientation, alpha, X_STAR_STAR.Matrix(), Field(0), YFull );
+
+    const Int firstLocalRow = Y.FirstLocalRow();
+    const Int localHeight = Y.LocalHeight();
+    Matrix<Field>& YLoc = Y.Matrix();
+    if( beta == Field(0) )
+        Zero( YLoc );
+    else if( beta != Field(1) )
+        YLoc *= beta;
+    YLoc += YFull( IR(firstLocalRow,firstLocalRow+localHeight), ALL );
+}
+
+template<typename Field>
+void HODLRMatrix<Field>::FactorNode( Int index )
+{
+    EL_DEBUG_CSE
+    Node& node = nodes_[index];
+    if( node.left < 0 )
+    {
+        node.DFact = node.D;
+        LU( node.DFact, node.DPerm );
+        return;
+    }
+    FactorNode( node.left );
+    FactorNode( node.right );
+
+    // By the Sherman-Morrison-Woodbury formula,
+    //
+    //   inv(A) = inv(D) - [Y1, 0; 0, Y2] inv(K) [0, W12; W21, 0] inv(D),
+    //
+    // where D = diag(A11,A22)
+    node.Y1 = node.U12;
+    SolveNode( node.left, node.Y1 );
+    node.Y2 = node.U21;
+    SolveNode( node.right, node.Y2 );
+    const Int rank12 = node.U12.Width();
+    const Int rank21 = node.U21.Width();
+    const Int rank = rank12 + rank21;
+    Identity( node.K, rank, rank );
+    if( rank12 == 0 || rank21 == 0 )
+        return;
+    auto K12 = node.K( IR(0,rank12), IR(rank12,rank) );
+    auto K21 = node.K( IR(rank12,rank), IR(0,rank12) );
+    Gemm( NORMAL, NORMAL, Field(1), node.W12, node.Y2, Field(0), K12 );
+    Gemm( NORMAL, NORMAL, Field(1), node.W21, node.Y1, Field(0), K21 );
+    LU( node.K, node.KPerm );
+}
+
+template<typename Field>
+void HODLRMatrix<Field>::Factor()
+{
+    EL_DEBUG_CSE
+    if( n_ > 0 )
+        FactorNode( 0 );
+    factored_ = true;
+}
+
+template<typename Field>
+void HODLRMatrix<Field>::SolveNode( Int index, Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    const Node& node = nodes_[index];
+    if( node.left < 0 )
+    {
+        lu::SolveAfter( NORMAL, node.DFact, node.DPerm, B );
+        return;
+    }
+    const Int leftSize = nodes_[node.left].size;
+    auto B1 = B( IR(0,leftSize), ALL );
+    auto B2 = B( IR(leftSize,node.size), ALL );
+    SolveNode( node.left, B1 );
+    SolveNode( node.right, B2 );
+
+    const Int rank12 = node.U12.Width();
+    const Int rank21 = node.U21.Width();
+    const Int rank = rank12 + rank21;
+    if( rank12 == 0 && rank21 == 0 )
+        return;
+    Matrix<Field> T;
+    Zeros( T, rank, B.Width() );
+    auto T1 = T( IR(0,rank12), ALL );
+    auto T2 = T( IR(rank12,rank), ALL );
+    Gemm( NORMAL, NORMAL, Field(1), node.W12, B2, Field(0), T1 );
+    Gemm( NORMAL, NORMAL, Field(1), node.W21, B1, Field(0), T2 );
+    if( rank12 != 0 && rank21 != 0 )
+        lu::SolveAfter( NORMAL, node.K, node.KPerm, T );
+    Gemm( NORMAL, NORMAL, Field(-1), node.Y1, T1, Field(1), B1 );
+    Gemm( NORMAL, NORMAL, Field(-1), node.Y2, T2, Field(1), B2 );
+}
+
+template<typename Field>
+void HODLRMatrix<Field>::Solve( Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Factor must be called before Solve");
+    if( B.Height() != n_ )
+        LogicError("A and B did not conform");
+    if( n_ > 0 )
+        SolveNode( 0, B );
+}
+
+template<typename Field>
+void HODLRMatrix<Field>::Solve( DistMultiVec<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Factor must be called before Solve");
+    if( B.Height() != n_ )
+        LogicError("A and B did not conform");
+    DistMatrix<Field,STAR,STAR> B_STAR_STAR( B.Grid() );
+    Copy( B, B_STAR_STAR );
+    Matrix<Field>& BFull = B_STAR_STAR.Matrix();
+    if( n_ > 0 )
+        SolveNode( 0, BFull );
+    const Int firstLocalRow = B.FirstLocalRow();
+    const Int localHeight = B.LocalHeight();
+    B.Matrix() = BFull( IR(firstLocalRow,firstLocalRow+localHeight), ALL );
+}
+
+template<typename Field>
+void HODLRMatrix<Field>::Form( Matrix<Field>& A ) const
+{
+    EL_DEBUG_CSE
+    Zeros( A, n_, n_ );
+    for( const auto& node : nodes_ )
+    {
+        if( node.left < 0 )
+        {
+            const Range<Int> I( node.offset, node.offset+node.size );
+            auto AII = A( I, I );
+            AII = node.D;
+            continue;
+        }
+        const Node& left = nodes_[node.left];
+        const Node& right = nodes_[node.right];
+        const Range<Int> I1( left.offset, left.offset+left.size );
+        const Range<Int> I2( right.offset, right.offset+right.size );
+        auto A12 = A( I1, I2 );
+        auto A21 = A( I2, I1 );
+        Gemm( NORMAL, NORMAL, Field(1), node.U12, node.W12, Field(0), A12 );
+        Gemm( NORMAL, NORMAL, Field(1), node.U21, node.W21, Field(0), A21 );
+    }
+}
+
+template<typename Field>
+Int HODLRMatrix<Field>::MaxRank() const
+{
+    EL_DEBUG_CSE
+    Int maxRank = 0;
+    for( const auto& node : nodes_ )
+        maxRank = Max( maxRank, Max(node.U12.Width(),node.U21.Width()) );
+    return maxRank;
+}
+
+template<typename Field>
+Int HODLRMatrix<Field>::NumEntries() const
+{
+    EL_DEBUG_CSE
+    Int numEntries = 0;
+    for( const auto& node : nodes_ )
+        numEntries += node.D.Height()*node.D.Width() +
+          node.U12.Height()*node.U12.Width() +
+          node.W12.Height()*node.W12.Width() +
+          node.U21.Height()*node.U21.Width() +
+          node.W21.Height()*node.W21.Width();
+    return numEntries;
+}
+
+#define PROTO(Field) \
+  template class HODLRMatrix<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
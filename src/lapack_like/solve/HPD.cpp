@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./MixedPrecision.hpp"
+
 namespace El {
 
 namespace hpd_solve {
@@ -68,6 +70,58 @@ void HPDSolve
     hpd_solve::Overwrite( uplo, orientation, ACopy, B );
 }
 
+template<typename Field>
+void HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> LField;
+    Matrix<LField> ALow, BLow;
+    Copy( A, ALow );
+    Cholesky( uplo, ALow );
+    auto lowSolve = [&]( Matrix<Field>& X )
+    {
+        Copy( X, BLow );
+        cholesky::SolveAfter( uplo, orientation, ALow, BLow );
+        Copy( BLow, X );
+    };
+    Matrix<Field> AFull( A );
+    MakeHermitian( uplo, AFull );
+    mixed_solve::Refine( orientation, AFull, lowSolve, B, ctrl );
+}
+
+template<typename Field>
+void HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& BPre,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> LField;
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+    const Grid& g = B.Grid();
+
+    DistMatrix<LField> ALow(g), BLow(g);
+    Copy( A, ALow );
+    Cholesky( uplo, ALow );
+    auto lowSolve = [&]( DistMatrix<Field>& X )
+    {
+        Copy( X, BLow );
+        cholesky::SolveAfter( uplo, orientation, ALow, BLow );
+        Copy( BLow, X );
+    };
+    DistMatrix<Field> AFull( A );
+    MakeHermitian( uplo, AFull );
+    mixed_solve::Refine( orientation, AFull, lowSolve, B, ctrl );
+}
+
 
 #define PROTO(Field) \
   template void hpd_solve::Overwrite \
@@ -81,7 +135,15 @@ void HPDSolve
     const Matrix<Field>& A, Matrix<Field>& B ); \
   template void HPDSolve \
   ( UpperOrLower uplo, Orientation orientation, \
-    const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B );
+    const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B ); \
+  template void HPDSolve \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const Matrix<Field>& A, Matrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template void HPDSolve \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
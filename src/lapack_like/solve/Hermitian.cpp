@@ -54,6 +54,28 @@ void HermitianSolve
     SymmetricSolve( uplo, orientation, A, B, true, ctrl );
 }
 
+template<typename Field>
+void HermitianSolve
+( const SparseMatrix<Field>& A,
+        Matrix<Field>& B,
+  bool tryLDL,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    SymmetricSolve( A, B, true, tryLDL, ctrl );
+}
+
+template<typename Field>
+void HermitianSolve
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& B,
+  bool tryLDL,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    SymmetricSolve( A, B, true, tryLDL, ctrl );
+}
+
 
 #define PROTO(Field) \
   template void herm_solve::Overwrite \
@@ -71,7 +93,17 @@ void HermitianSolve
   template void HermitianSolve \
   ( UpperOrLower uplo, Orientation orientation, \
     const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B, \
-    const LDLPivotCtrl<Base<Field>>& ctrl );
+    const LDLPivotCtrl<Base<Field>>& ctrl ); \
+  template void HermitianSolve \
+  ( const SparseMatrix<Field>& A, \
+          Matrix<Field>& B, \
+    bool tryLDL, \
+    const BisectCtrl& ctrl ); \
+  template void HermitianSolve \
+  ( const DistSparseMatrix<Field>& A, \
+          DistMultiVec<Field>& B, \
+    bool tryLDL, \
+    const BisectCtrl& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+void LinearSolve
+( const KroneckerOperator<Field>& K,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Int nA = K.A().Height();
+    const Int nB = K.B().Height();
+    if( K.A().Width() != nA || K.B().Width() != nB )
+        LogicError("The factors of K must be square");
+    if( X.Height() != nA*nB )
+        LogicError("K and X did not conform");
+    const Int numRHS = X.Width();
+    if( nA*nB == 0 || numRHS == 0 )
+        return;
+
+    Matrix<Field> ALU( K.A() ), BLU( K.B() );
+    Permutation PA, PB;
+    LU( ALU, PA );
+    LU( BLU, PB );
+
+    // The columns of X are collectively the vectorization of the
+    // nB x (nA numRHS) matrix [X_0, X_1, ...]
+    Matrix<Field> XCont, Z;
+    const bool contiguous = ( X.LDim() == X.Height() );
+    if( contiguous )
+        Z.Attach( nB, nA*numRHS, X.Buffer(), nB );
+    else
+    {
+        XCont = X;
+        Z.Attach( nB, nA*numRHS, XCont.Buffer(), nB );
+    }
+
+    // [X_0, X_1, ...] := inv(B) [X_0, X_1, ...]
+    lu::SolveAfter( NORMAL, BLU, PB, Z );
+
+    // [X_0^T, X_1^T, ...] := inv(A) [X_0^T, X_1^T, ...]
+    Matrix<Field> ZTrans( nA, nB*numRHS ), Zk, ZTransk;
+    for( Int k=0; k<numRHS; ++k )
+    {
+        View( Zk, Z, ALL, IR(k*nA,(k+1)*nA) );
+        View( ZTransk, ZTrans, ALL, IR(k*nB,(k+1)*nB) );
+        Transpose( Zk, ZTransk );
+    }
+    lu::SolveAfter( NORMAL, ALU, PA, ZTrans );
+    for( Int k=0; k<numRHS; ++k )
+    {
+        View( Zk, Z, ALL, IR(k*nA,(k+1)*nA) );
+        View( ZTransk, ZTrans, ALL, IR(k*nB,(k+1)*nB) );
+        Transpose( ZTransk, Zk );
+    }
+
+    if( !contiguous )
+        X = XCont;
+}
+
+template<typename Field>
+void LinearSolve
+( const DistKroneckerOperator<Field>& K,
+        DistMultiVec<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Grid& g = K.Grid();
+    const Int nA = K.A().Height();
+    const Int nB = K.B().Height();
+    if( K.A().Width() != nA || K.B().Width() != nB )
+        LogicError("The factors of K must be square");
+    if( X.Height() != nA*nB )
+        LogicError("K and X did not conform");
+    if( X.Grid() != g )
+        LogicError("K and X must share a grid");
+    const Int numRHS = X.Width();
+    if( nA*nB == 0 || numRHS == 0 )
+        return;
+
+    DistMatrix<Field> ALU( K.A() ), BLU( K.B() );
+    DistPermutation PA(g), PB(g);
+    LU( ALU, PA );
+    LU( BLU, PB );
+
+    // See the sequential implementation
+    DistMatrix<Field> Z(g), ZTrans(g);
+    Reshape( nB, nA*numRHS, X, Z );
+    lu::SolveAfter( NORMAL, BLU, PB, Z );
+    ZTrans.Resize( nA, nB*numRHS );
+    for( Int k=0; k<numRHS; ++k )
+    {
+        auto Zk = Z( ALL, IR(k*nA,(k+1)*nA) );
+        auto ZTransk = ZTrans( ALL, IR(k*nB,(k+1)*nB) );
+        Transpose( Zk, ZTransk );
+    }
+    lu::SolveAfter( NORMAL, ALU, PA, ZTrans );
+    for( Int k=0; k<numRHS; ++k )
+    {
+        auto Zk = Z( ALL, IR(k*nA,(k+1)*nA) );
+        auto ZTransk = ZTrans( ALL, IR(k*nB,(k+1)*nB) );
+        Transpose( ZTransk, Zk );
+    }
+    Reshape( nA*nB, numRHS, Z, X );
+}
+
+#define PROTO(Field) \
+  template void LinearSolve \
+  ( const KroneckerOperator<Field>& K, \
+          Matrix<Field>& X ); \
+  template void LinearSolve \
+  ( const DistKroneckerOperator<Field>& K, \
+          DistMultiVec<Field>& X );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
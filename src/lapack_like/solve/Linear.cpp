@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./MixedPrecision.hpp"
+
 namespace El {
 
 namespace lu {
@@ -293,6 +295,54 @@ void LinearSolve
     lin_solve::Overwrite( ACopy, B );
 }
 
+template<typename Field>
+void LinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> LField;
+    Matrix<LField> ALow, BLow;
+    Copy( A, ALow );
+    Permutation P;
+    LU( ALow, P );
+    auto lowSolve = [&]( Matrix<Field>& X )
+    {
+        Copy( X, BLow );
+        lu::SolveAfter( NORMAL, ALow, P, BLow );
+        Copy( BLow, X );
+    };
+    mixed_solve::Refine( NORMAL, A, lowSolve, B, ctrl );
+}
+
+template<typename Field>
+void LinearSolve
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> LField;
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+    const Grid& g = A.Grid();
+
+    DistMatrix<LField> ALow(g), BLow(g);
+    Copy( A, ALow );
+    DistPermutation P(g);
+    LU( ALow, P );
+    auto lowSolve = [&]( DistMatrix<Field>& X )
+    {
+        Copy( X, BLow );
+        lu::SolveAfter( NORMAL, ALow, P, BLow );
+        Copy( BLow, X );
+    };
+    mixed_solve::Refine( NORMAL, A, lowSolve, B, ctrl );
+}
+
 
 #define PROTO(Field) \
   template void lin_solve::Overwrite( Matrix<Field>& A, Matrix<Field>& B ); \
@@ -302,7 +352,15 @@ void LinearSolve
   template void LinearSolve \
   ( const AbstractDistMatrix<Field>& A, \
           AbstractDistMatrix<Field>& B, \
-    bool scalapack );
+    bool scalapack ); \
+  template void LinearSolve \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template void LinearSolve \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,138 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_MIXEDPRECISION_HPP
+#define EL_SOLVE_MIXEDPRECISION_HPP
+
+namespace El {
+namespace mixed_solve {
+
+// In what follows, A is the explicit (working-precision) matrix whose
+// orientation is to be solved against, and 'lowSolve' should have the form
+//
+//   void lowSolve( Matrix<Field>& b )
+//
+// and overwrite b with an approximation of inv(op(A)) b computed from a
+// low-precision factorization.
+
+template<typename Field,class LowSolveType>
+Int Refine
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const LowSolveType& lowSolve,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.gmres )
+    {
+        auto applyA =
+          [&]( Field alpha, const Matrix<Field>& x,
+               Field beta,        Matrix<Field>& y )
+          { Gemv( orientation, alpha, A, x, beta, y ); };
+        return FGMRES
+        ( applyA, lowSolve, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    }
+    else if( ctrl.promoteResiduals )
+    {
+        typedef Promote<Field> PField;
+        Matrix<PField> AProm;
+        Copy( A, AProm );
+        auto applyA =
+          [&]( const Matrix<PField>& x, Matrix<PField>& y )
+          { Gemm( orientation, NORMAL, PField(1), AProm, x, PField(0), y ); };
+        return PromotedRefinedSolve
+        ( applyA, lowSolve, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+    }
+    else
+    {
+        auto applyA =
+          [&]( const Matrix<Field>& x, Matrix<Field>& y )
+          { Gemm( orientation, NORMAL, Field(1), A, x, Field(0), y ); };
+        return RefinedSolve
+        ( applyA, lowSolve, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+    }
+}
+
+// Classical refinement of all of the columns of B at once, with the
+// residuals formed in RField. The iteration stops once the relative residual
+// falls below the tolerance or fails to decrease.
+template<typename RField,typename Field,class LowSolveType>
+Int RefineBatch
+( Orientation orientation,
+  const DistMatrix<Field>& A,
+  const LowSolveType& lowSolve,
+        DistMatrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<RField> RReal;
+    const Grid& g = A.Grid();
+
+    DistMatrix<RField> ARes(g), BOrig(g), X(g), XCand(g), R(g);
+    Copy( A, ARes );
+    Copy( B, BOrig );
+    const RReal bNorm = MaxNorm( BOrig );
+    auto residualNorm = [&]( const DistMatrix<RField>& Y )
+    {
+        R = BOrig;
+        Gemm( orientation, NORMAL, RField(-1), ARes, Y, RField(1), R );
+        return MaxNorm( R );
+    };
+
+    // Compute the initial guess
+    lowSolve( B );
+    Copy( B, X );
+    RReal errorNorm = residualNorm( X );
+    if( ctrl.progress && g.Rank() == 0 )
+        Output("original rel error: ",errorNorm/bNorm);
+
+    Int refineIt = 0;
+    while( refineIt < ctrl.maxIts && errorNorm > RReal(ctrl.relTol)*bNorm )
+    {
+        Copy( R, B );
+        lowSolve( B );
+        Copy( B, XCand );
+        XCand += X;
+
+        const RReal newErrorNorm = residualNorm( XCand );
+        if( ctrl.progress && g.Rank() == 0 )
+            Output("refined rel error: ",newErrorNorm/bNorm);
+        if( newErrorNorm >= errorNorm )
+            break;
+        X = XCand;
+        errorNorm = newErrorNorm;
+        ++refineIt;
+    }
+    Copy( X, B );
+    return refineIt;
+}
+
+template<typename Field,class LowSolveType>
+Int Refine
+( Orientation orientation,
+  const DistMatrix<Field>& A,
+  const LowSolveType& lowSolve,
+        DistMatrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.gmres )
+        LogicError("GMRES-IR is not yet supported for distributed matrices");
+    if( ctrl.promoteResiduals )
+        return RefineBatch<Promote<Field>>
+               ( orientation, A, lowSolve, B, ctrl );
+    else
+        return RefineBatch<Field>( orientation, A, lowSolve, B, ctrl );
+}
+
+} // namespace mixed_solve
+} // namespace El
+
+#endif // ifndef EL_SOLVE_MIXEDPRECISION_HPP
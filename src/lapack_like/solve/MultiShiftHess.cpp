@@ -271,8 +271,9 @@ LN
     {
         LockedView( *hB, H, IR(k+2,m), IR(k+1) );
         hB_STAR_STAR = *hB;
-        const Field etakkp1 = H.Get(k,k+1);
-        const Field etakp1kp1 = H.Get(k+1,k+1);
+        const auto etas = H.GetMany( {{k,k+1},{k+1,k+1}} );
+        const Field etakkp1 = etas[0];
+        const Field etakp1kp1 = etas[1];
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
             // Find the Givens rotation needed to zero H(k,k+1),
@@ -393,8 +394,9 @@ UN
     {
         LockedView( *hT, H, IR(0,k-1), IR(k-1) );
         hT_STAR_STAR = *hT;
-        const Field etakkm1 = H.Get(k,k-1);
-        const Field etakm1km1 = H.Get(k-1,k-1);
+        const auto etas = H.GetMany( {{k,k-1},{k-1,k-1}} );
+        const Field etakkm1 = etas[0];
+        const Field etakm1km1 = etas[1];
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
             // Find the Givens rotation needed to zero H(k,k-1),
@@ -458,12 +460,10 @@ UN
 
 // TODO: UT and LT
 
-} // namespace mshs
-
 template<typename Field>
-void MultiShiftHessSolve
+void
+Sweep
 ( UpperOrLower uplo,
-  Orientation orientation,
   Field alpha,
   const Matrix<Field>& H,
   const Matrix<Field>& shifts,
@@ -471,19 +471,163 @@ void MultiShiftHessSolve
 {
     EL_DEBUG_CSE
     if( uplo == LOWER )
+        LN( alpha, H, shifts, X );
+    else
+        UN( alpha, H, shifts, X );
+}
+
+// Each sweep reads all of H once per shift, so the shifts are split into
+// blocks which are each swept to completion before the next is begun (so that
+// the Givens rotations and the working columns of a block can remain in
+// cache), and the independent blocks are spread over threads
+template<typename Field>
+void
+Blocked
+( UpperOrLower uplo,
+  Field alpha,
+  const Matrix<Field>& H,
+  const Matrix<Field>& shifts,
+        Matrix<Field>& X,
+  const MultiShiftHessCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = X.Height();
+    const Int n = X.Width();
+    const Int blocksize = ( ctrl.shiftBlocksize > 0 ? ctrl.shiftBlocksize : n );
+    if( m == 0 || n <= blocksize )
     {
-        if( orientation == NORMAL )
-            mshs::LN( alpha, H, shifts, X );
-        else
-            LogicError("This option is not yet supported");
+        Sweep( uplo, alpha, H, shifts, X );
+        return;
     }
-    else
+
+    auto sweepBlock =
+      [&]( Int jBeg )
+      {
+          const Range<Int> indBlock( jBeg, Min(jBeg+blocksize,n) );
+          auto XBlock = X( ALL, indBlock );
+          auto shiftsBlock = shifts( indBlock, ALL );
+          Sweep( uplo, alpha, H, shiftsBlock, XBlock );
+      };
+    if( ctrl.numThreads == 1 )
     {
-        if( orientation == NORMAL )
-            mshs::UN( alpha, H, shifts, X );
-        else
-            LogicError("This option is not yet supported");
+        for( Int jBeg=0; jBeg<n; jBeg+=blocksize )
+            sweepBlock( jBeg );
+        return;
     }
+    TaskGraph graph;
+    for( Int jBeg=0; jBeg<n; jBeg+=blocksize )
+        graph.Insert
+        ( [&,jBeg]() { sweepBlock( jBeg ); },
+          vector<const void*>(), { X.LockedBuffer(0,jBeg) } );
+    graph.Execute( ctrl.numThreads );
+}
+
+// In mixed precision, the sweeps are performed in Demote<Field> and the
+// solutions are then refined using residuals formed in the working precision,
+//
+//   r_j := y_j - (H - sigma_j I) x_j,
+//
+// which only requires a Gemm against (the Hessenberg part of) H.
+template<typename Field>
+void
+Sequential
+( UpperOrLower uplo,
+  Field alpha,
+  const Matrix<Field>& H,
+  const Matrix<Field>& shifts,
+        Matrix<Field>& X,
+  const MultiShiftHessCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+    if( !ctrl.mixedPrecision || IsSame<FieldLow,Field>::value )
+    {
+        Blocked( uplo, alpha, H, shifts, X, ctrl );
+        return;
+    }
+    typedef Base<Field> Real;
+    const Int m = X.Height();
+    const Int n = X.Width();
+
+    Matrix<Field> HHess( H ), Y, R;
+    MakeTrapezoidal( uplo, HHess, (uplo==UPPER ? -1 : 1) );
+    Matrix<FieldLow> HLow, shiftsLow, XLow;
+    Copy( HHess, HLow );
+    Copy( shifts, shiftsLow );
+
+    X *= alpha;
+    Y = X;
+    Copy( Y, XLow );
+    Blocked( uplo, FieldLow(1), HLow, shiftsLow, XLow, ctrl );
+    Copy( XLow, X );
+
+    const Real eps = limits::Epsilon<Real>();
+    const Real normH = FrobeniusNorm( HHess ) + MaxNorm( shifts );
+    const Real normY = FrobeniusNorm( Y );
+    for( Int it=0; it<ctrl.maxRefineIts; ++it )
+    {
+        R = Y;
+        Gemm( NORMAL, NORMAL, Field(-1), HHess, X, Field(1), R );
+        for( Int j=0; j<n; ++j )
+            blas::Axpy
+            ( m, shifts(j), X.LockedBuffer(0,j), 1, R.Buffer(0,j), 1 );
+        if( FrobeniusNorm(R) <= 10*eps*(normH*FrobeniusNorm(X)+normY) )
+            break;
+
+        Copy( R, XLow );
+        Blocked( uplo, FieldLow(1), HLow, shiftsLow, XLow, ctrl );
+        Copy( XLow, R );
+        X += R;
+    }
+}
+
+// Rather than gathering a column of H for every step of each sweep, H is
+// replicated on every process once, and each process then independently
+// solves against its local shifts
+template<typename Field>
+void
+Replicated
+( UpperOrLower uplo,
+  Field alpha,
+  const AbstractDistMatrix<Field>& H,
+  const AbstractDistMatrix<Field>& shiftsPre,
+        AbstractDistMatrix<Field>& XPre,
+  const MultiShiftHessCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+
+    DistMatrixReadWriteProxy<Field,Field,STAR,VR> XProx( XPre );
+    auto& X = XProx.Get();
+
+    ElementalProxyCtrl proxCtrl;
+    proxCtrl.colConstrain = true;
+    proxCtrl.colAlign = X.RowAlign();
+
+    DistMatrixReadProxy<Field,Field,VR,STAR> shiftsProx( shiftsPre, proxCtrl );
+    auto& shifts = shiftsProx.GetLocked();
+
+    DistMatrix<Field,STAR,STAR> H_STAR_STAR( H );
+    Sequential
+    ( uplo, alpha, H_STAR_STAR.LockedMatrix(), shifts.LockedMatrix(),
+      X.Matrix(), ctrl );
+}
+
+} // namespace mshs
+
+template<typename Field>
+void MultiShiftHessSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  Field alpha,
+  const Matrix<Field>& H,
+  const Matrix<Field>& shifts,
+        Matrix<Field>& X,
+  const MultiShiftHessCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( orientation != NORMAL )
+        LogicError("This option is not yet supported");
+    mshs::Sequential( uplo, alpha, H, shifts, X, ctrl );
 }
 
 template<typename Field>
@@ -493,10 +637,17 @@ void MultiShiftHessSolve
   Field alpha,
   const AbstractDistMatrix<Field>& H,
   const AbstractDistMatrix<Field>& shifts,
-        AbstractDistMatrix<Field>& X )
+        AbstractDistMatrix<Field>& X,
+  const MultiShiftHessCtrl& ctrl )
 {
     EL_DEBUG_CSE
-    if( uplo == LOWER )
+    if( ctrl.replicateH )
+    {
+        if( orientation != NORMAL )
+            LogicError("This option is not yet supported");
+        mshs::Replicated( uplo, alpha, H, shifts, X, ctrl );
+    }
+    else if( uplo == LOWER )
     {
         if( orientation == NORMAL )
             mshs::LN( alpha, H, shifts, X );
@@ -519,14 +670,16 @@ void MultiShiftHessSolve
     Field alpha, \
     const Matrix<Field>& H, \
     const Matrix<Field>& shifts, \
-          Matrix<Field>& X ); \
+          Matrix<Field>& X, \
+    const MultiShiftHessCtrl& ctrl ); \
   template void MultiShiftHessSolve \
   ( UpperOrLower uplo, \
     Orientation orientation, \
     Field alpha, \
     const AbstractDistMatrix<Field>& H, \
     const AbstractDistMatrix<Field>& shifts, \
-          AbstractDistMatrix<Field>& X );
+          AbstractDistMatrix<Field>& X, \
+    const MultiShiftHessCtrl& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -17,15 +17,59 @@ namespace El {
 //
 // where F and G are Symmetric Positive Semi-Definite (and F is n0 x n0).
 
+// The dense solvers factor J + diag(regPerm) with the pivot-free, dynamically
+// regularized LDL^H of reg_ldl::RegularizedQSDLDL, which is purely level-3,
+// and then remove the temporary (dynamic) regularization with iterative
+// refinement and the permanent regularization with ctrl.solveCtrl.alg.
+
 template<typename Field>
 void SQSDSolve
-( Int n0, UpperOrLower uplo, const Matrix<Field>& A, Matrix<Field>& B )
+( Int n0,
+  UpperOrLower uplo,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const SQSDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
-    const Orientation orient = NORMAL;
-    const bool conjugate = true;
-    // TODO(poulson): LDLPivotCtrl control structure
-    return SymmetricSolve( uplo, orient, A, B, conjugate );
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+
+    Real scale = Real(1);
+    if( ctrl.scaleTwoNorm )
+    {
+        scale = HermitianTwoNormEstimate
+          ( uplo, A, Real(1e-6), ctrl.basisSize );
+        if( scale == Real(0) )
+            scale = Real(1);
+    }
+
+    Matrix<Real> regPerm, regCand, regDyn;
+    regPerm.Resize( n, 1 );
+    regCand.Resize( n, 1 );
+    for( Int i=0; i<n; ++i )
+    {
+        if( i < n0 )
+        {
+            regPerm(i) = ctrl.reg0Perm*scale;
+            regCand(i) = ctrl.reg0Tmp*scale;
+        }
+        else
+        {
+            regPerm(i) = -ctrl.reg1Perm*scale;
+            regCand(i) = ctrl.reg1Tmp*scale;
+        }
+    }
+
+    // The regularized factorization only accesses the lower triangle
+    Matrix<Field> AFact;
+    if( uplo == LOWER )
+        AFact = A;
+    else
+        Adjoint( A, AFact );
+    UpdateRealPartOfDiagonal( AFact, Real(1), regPerm );
+
+    reg_ldl::RegularizedQSDLDL( n0, AFact, regCand, regDyn );
+    reg_ldl::SolveAfter( uplo, A, regPerm, AFact, B, ctrl.solveCtrl );
 }
 
 template<typename Field>
@@ -33,13 +77,51 @@ void SQSDSolve
 ( Int n0,
   UpperOrLower uplo,
   const AbstractDistMatrix<Field>& A,
-        AbstractDistMatrix<Field>& B )
+        AbstractDistMatrix<Field>& B,
+  const SQSDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
-    const Orientation orient = NORMAL;
-    const bool conjugate = true;
-    // TODO(poulson): LDLPivotCtrl control structure
-    return SymmetricSolve( uplo, orient, A, B, conjugate );
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+
+    Real scale = Real(1);
+    if( ctrl.scaleTwoNorm )
+    {
+        scale = HermitianTwoNormEstimate
+          ( uplo, A, Real(1e-6), ctrl.basisSize );
+        if( scale == Real(0) )
+            scale = Real(1);
+    }
+
+    DistMatrix<Real,MC,STAR> regPerm(g), regCand(g), regDyn(g);
+    regPerm.Resize( n, 1 );
+    regCand.Resize( n, 1 );
+    for( Int iLoc=0; iLoc<regPerm.LocalHeight(); ++iLoc )
+    {
+        const Int i = regPerm.GlobalRow(iLoc);
+        if( i < n0 )
+        {
+            regPerm.SetLocal( iLoc, 0, ctrl.reg0Perm*scale );
+            regCand.SetLocal( iLoc, 0, ctrl.reg0Tmp*scale );
+        }
+        else
+        {
+            regPerm.SetLocal( iLoc, 0, -ctrl.reg1Perm*scale );
+            regCand.SetLocal( iLoc, 0, ctrl.reg1Tmp*scale );
+        }
+    }
+
+    // The regularized factorization only accesses the lower triangle
+    DistMatrix<Field> AFact(g);
+    if( uplo == LOWER )
+        Copy( A, AFact );
+    else
+        Adjoint( A, AFact );
+    UpdateRealPartOfDiagonal( AFact, Real(1), regPerm );
+
+    reg_ldl::RegularizedQSDLDL( n0, AFact, regCand, regDyn );
+    reg_ldl::SolveAfter( uplo, A, regPerm, AFact, B, ctrl.solveCtrl );
 }
 
 
@@ -48,12 +130,14 @@ void SQSDSolve
   ( Int n0, \
     UpperOrLower uplo, \
     const Matrix<Field>& A, \
-          Matrix<Field>& B ); \
+          Matrix<Field>& B, \
+    const SQSDCtrl<Base<Field>>& ctrl ); \
   template void SQSDSolve \
   ( Int n0, \
     UpperOrLower uplo, \
     const AbstractDistMatrix<Field>& A, \
-          AbstractDistMatrix<Field>& B );
+          AbstractDistMatrix<Field>& B, \
+    const SQSDCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,225 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace El {
+
+template<typename Field>
+struct SolveQueue<Field>::State
+{
+    typedef std::chrono::steady_clock Clock;
+
+    struct Request
+    {
+        Matrix<Field> B;
+        std::promise<Matrix<Field>> promise;
+        Clock::time_point arrival;
+    };
+
+    const Factorization<Field>& factorization;
+    const Orientation orientation;
+    const SolveQueueCtrl ctrl;
+
+    mutable std::mutex mutex;
+    std::condition_variable cond;
+    std::deque<Request> queue;
+    Int numQueuedCols=0;
+    bool flush=false, stop=false;
+    Int numBatches=0, numSolved=0;
+
+    std::thread worker;
+
+    State
+    ( const Factorization<Field>& fact,
+      Orientation orient,
+      const SolveQueueCtrl& queueCtrl )
+    : factorization(fact), orientation(orient), ctrl(queueCtrl)
+    { }
+
+    void Run( vector<Int> blocksizeStack );
+    void SolveBatch( vector<Request>& batch, Int numCols );
+};
+
+template<typename Field>
+void SolveQueue<Field>::State::SolveBatch
+( vector<Request>& batch, Int numCols )
+{
+    EL_DEBUG_CSE
+    const Int n = factorization.Height();
+    try
+    {
+        Matrix<Field> B( n, numCols );
+        Int offset = 0;
+        for( auto& request : batch )
+        {
+            const Int width = request.B.Width();
+            auto BSub = B( ALL, IR(offset,offset+width) );
+            BSub = request.B;
+            offset += width;
+        }
+        factorization.Solve( orientation, B );
+        offset = 0;
+        for( auto& request : batch )
+        {
+            const Int width = request.B.Width();
+            Matrix<Field> X = B( ALL, IR(offset,offset+width) );
+            request.promise.set_value( std::move(X) );
+            offset += width;
+        }
+    }
+    catch( ... )
+    {
+        for( auto& request : batch )
+        {
+            try { request.promise.set_exception( std::current_exception() ); }
+            catch( const std::future_error& ) { }
+        }
+    }
+}
+
+template<typename Field>
+void SolveQueue<Field>::State::Run( vector<Int> blocksizeStack )
+{
+    CurrentContext().blocksizeStack = blocksizeStack;
+    const auto maxLatency =
+      std::chrono::duration_cast<Clock::duration>
+      (std::chrono::duration<double>(ctrl.maxLatency));
+    const Int maxBatchSize = Max( ctrl.maxBatchSize, Int(1) );
+    while( true )
+    {
+        std::unique_lock<std::mutex> lock( mutex );
+        cond.wait( lock, [&]() { return stop || !queue.empty(); } );
+        if( queue.empty() )
+            break;
+
+        // Wait for a full batch, a flush, or the deadline of the oldest
+        // right-hand side
+        const auto deadline = queue.front().arrival + maxLatency;
+        cond.wait_until
+        ( lock, deadline,
+          [&]() { return stop || flush || numQueuedCols >= maxBatchSize; } );
+
+        // Pull at least one request and at most maxBatchSize columns
+        vector<Request> batch;
+        Int numCols = 0;
+        while( !queue.empty() &&
+               (batch.empty() ||
+                numCols+queue.front().B.Width() <= maxBatchSize) )
+        {
+            numCols += queue.front().B.Width();
+            batch.push_back( std::move(queue.front()) );
+            queue.pop_front();
+        }
+        numQueuedCols -= numCols;
+        if( queue.empty() )
+            flush = false;
+        lock.unlock();
+
+        SolveBatch( batch, numCols );
+
+        lock.lock();
+        ++numBatches;
+        numSolved += batch.size();
+    }
+}
+
+template<typename Field>
+SolveQueue<Field>::SolveQueue
+( const Factorization<Field>& factorization,
+  Orientation orientation,
+  const SolveQueueCtrl& ctrl )
+: state_(new State(factorization,orientation,ctrl))
+{
+    EL_DEBUG_CSE
+    if( factorization.Distributed() )
+        LogicError
+        ("SolveQueue requires a sequential factorization since distributed "
+         "solves are collective");
+    State* state = state_.get();
+    const auto blocksizeStack = CurrentContext().blocksizeStack;
+    state->worker =
+      std::thread( [state,blocksizeStack]() { state->Run(blocksizeStack); } );
+}
+
+template<typename Field>
+SolveQueue<Field>::~SolveQueue()
+{
+    {
+        std::lock_guard<std::mutex> lock( state_->mutex );
+        state_->stop = true;
+    }
+    state_->cond.notify_all();
+    if( state_->worker.joinable() )
+        state_->worker.join();
+}
+
+template<typename Field>
+std::future<Matrix<Field>> SolveQueue<Field>::Submit( const Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( B.Height() != state_->factorization.Height() )
+        LogicError
+        ("Expected ",state_->factorization.Height()," rows but received ",
+         B.Height());
+    typename State::Request request;
+    request.B = B;
+    request.arrival = State::Clock::now();
+    auto future = request.promise.get_future();
+    {
+        std::lock_guard<std::mutex> lock( state_->mutex );
+        state_->numQueuedCols += B.Width();
+        state_->queue.push_back( std::move(request) );
+    }
+    state_->cond.notify_all();
+    return future;
+}
+
+template<typename Field>
+void SolveQueue<Field>::Flush()
+{
+    EL_DEBUG_CSE
+    {
+        std::lock_guard<std::mutex> lock( state_->mutex );
+        if( !state_->queue.empty() )
+            state_->flush = true;
+    }
+    state_->cond.notify_all();
+}
+
+template<typename Field>
+Int SolveQueue<Field>::NumBatches() const
+{
+    std::lock_guard<std::mutex> lock( state_->mutex );
+    return state_->numBatches;
+}
+
+template<typename Field>
+Int SolveQueue<Field>::NumSolved() const
+{
+    std::lock_guard<std::mutex> lock( state_->mutex );
+    return state_->numSolved;
+}
+
+#define PROTO(Field) \
+  template class SolveQueue<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./MixedPrecision.hpp"
+
 namespace El {
 
 namespace symm_solve {
@@ -96,6 +98,115 @@ void SymmetricSolve
     symm_solve::Overwrite( uplo, orientation, ACopy, B, hermitian, ctrl );
 }
 
+template<typename Field>
+void SymmetricSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  bool hermitian,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( uplo == UPPER )
+        LogicError("Upper Bunch-Kaufman is not yet supported");
+    typedef Demote<Field> LField;
+    Matrix<LField> ALow, dSub, BLow;
+    Copy( A, ALow );
+    Permutation p;
+    LDL( ALow, dSub, p, hermitian );
+    const bool conjFlip = (orientation == ADJOINT && !hermitian) ||
+                          (orientation == TRANSPOSE && hermitian);
+    auto lowSolve = [&]( Matrix<Field>& X )
+    {
+        Copy( X, BLow );
+        if( conjFlip )
+            Conjugate( BLow );
+        ldl::SolveAfter( ALow, dSub, p, BLow, hermitian );
+        if( conjFlip )
+            Conjugate( BLow );
+        Copy( BLow, X );
+    };
+    Matrix<Field> AFull( A );
+    MakeSymmetric( uplo, AFull, hermitian );
+    mixed_solve::Refine( orientation, AFull, lowSolve, B, ctrl );
+}
+
+template<typename Field>
+void SymmetricSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& BPre,
+  bool hermitian,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( uplo == UPPER )
+        LogicError("Upper Bunch-Kaufman is not yet supported");
+    typedef Demote<Field> LField;
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+    const Grid& g = B.Grid();
+
+    DistMatrix<LField> ALow(g), BLow(g);
+    DistMatrix<LField,MD,STAR> dSub(g);
+    Copy( A, ALow );
+    DistPermutation p(g);
+    LDL( ALow, dSub, p, hermitian );
+    const bool conjFlip = (orientation == ADJOINT && !hermitian) ||
+                          (orientation == TRANSPOSE && hermitian);
+    auto lowSolve = [&]( DistMatrix<Field>& X )
+    {
+        Copy( X, BLow );
+        if( conjFlip )
+            Conjugate( BLow );
+        ldl::SolveAfter( ALow, dSub, p, BLow, hermitian );
+        if( conjFlip )
+            Conjugate( BLow );
+        Copy( BLow, X );
+    };
+    DistMatrix<Field> AFull( A );
+    MakeSymmetric( uplo, AFull, hermitian );
+    mixed_solve::Refine( orientation, AFull, lowSolve, B, ctrl );
+}
+
+template<typename Field>
+void SymmetricSolve
+( const SparseMatrix<Field>& A,
+        Matrix<Field>& B,
+  bool hermitian,
+  bool tryLDL,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( !tryLDL )
+        LogicError("Sparse solves without an LDL factorization are not yet "
+                   "supported");
+    SparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( A, hermitian, ctrl );
+    sparseLDLFact.Factor();
+    sparseLDLFact.Solve( B );
+}
+
+template<typename Field>
+void SymmetricSolve
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& B,
+  bool hermitian,
+  bool tryLDL,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( !tryLDL )
+        LogicError("Sparse solves without an LDL factorization are not yet "
+                   "supported");
+    DistSparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( A, hermitian, ctrl );
+    sparseLDLFact.Factor();
+    sparseLDLFact.Solve( B );
+}
+
 
 #define PROTO(Field) \
   template void symm_solve::Overwrite \
@@ -125,7 +236,33 @@ void SymmetricSolve
     const AbstractDistMatrix<Field>& A, \
           AbstractDistMatrix<Field>& B, \
     bool hermitian, \
-    const LDLPivotCtrl<Base<Field>>& ctrl );
+    const LDLPivotCtrl<Base<Field>>& ctrl ); \
+  template void SymmetricSolve \
+  ( UpperOrLower uplo, \
+    Orientation orientation, \
+    const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    bool hermitian, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template void SymmetricSolve \
+  ( UpperOrLower uplo, \
+    Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& B, \
+    bool hermitian, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template void SymmetricSolve \
+  ( const SparseMatrix<Field>& A, \
+          Matrix<Field>& B, \
+    bool hermitian, \
+    bool tryLDL, \
+    const BisectCtrl& ctrl ); \
+  template void SymmetricSolve \
+  ( const DistSparseMatrix<Field>& A, \
+          DistMultiVec<Field>& B, \
+    bool hermitian, \
+    bool tryLDL, \
+    const BisectCtrl& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
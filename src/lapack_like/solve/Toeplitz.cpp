@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+// The Levinson recursion for a general square Toeplitz matrix, with
+// A(i,j) = t(i-j) = a[i-j+(n-1)], maintains the solutions f and b of
+// A_k f = e_0 and A_k b = e_{k-1} for the leading k x k submatrix A_k, along
+// with the solutions of A_k X_k = Y_k for the leading k rows of each
+// right-hand side. Since
+//
+//   A_{k+1} [f; 0] = e_0 + epsF e_k  and  A_{k+1} [0; b] = epsB e_0 + e_k,
+//
+// the extended vectors are
+//
+//   f := ([f; 0] - epsF [0; b]) / (1 - epsF epsB),
+//   b := ([0; b] - epsB [f; 0]) / (1 - epsF epsB),
+//
+// and each right-hand side is extended as x := [x; 0] + (y_k - epsX) b, where
+// epsX is the product of the last row of A_{k+1} with [x; 0]. The cost is
+// O(n^2 (1 + numRHS)) work and O(n) workspace, but every leading principal
+// submatrix must be nonsingular.
+template<typename Field>
+void LinearSolve
+( const ToeplitzOperator<Field>& A,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("A must be square");
+    if( X.Height() != n )
+        LogicError("A and X did not conform");
+    const Int numRHS = X.Width();
+    if( n == 0 || numRHS == 0 )
+        return;
+    const vector<Field>& a = A.Entries();
+    auto t = [&]( Int k ) { return a[k+(n-1)]; };
+
+    if( t(0) == Field(0) )
+        RuntimeError("The leading 1 x 1 submatrix was singular");
+    vector<Field> f(n), b(n), fNew(n), bNew(n);
+    f[0] = b[0] = Field(1)/t(0);
+    for( Int j=0; j<numRHS; ++j )
+        X(0,j) = f[0]*X(0,j);
+
+    for( Int k=1; k<n; ++k )
+    {
+        Field epsF=0, epsB=0;
+        for( Int i=0; i<k; ++i )
+        {
+            epsF += t(k-i)*f[i];
+            epsB += t(-(i+1))*b[i];
+        }
+        const Field denom = Field(1) - epsF*epsB;
+        if( denom == Field(0) )
+            RuntimeError
+            ("The leading ",k+1," x ",k+1," submatrix was singular");
+        const Field denomInv = Field(1)/denom;
+        for( Int i=0; i<=k; ++i )
+        {
+            const Field fPrev = ( i < k ? f[i] : Field(0) );
+            const Field bPrev = ( i > 0 ? b[i-1] : Field(0) );
+            fNew[i] = (fPrev - epsF*bPrev)*denomInv;
+            bNew[i] = (bPrev - epsB*fPrev)*denomInv;
+        }
+        f.swap( fNew );
+        b.swap( bNew );
+
+        for( Int j=0; j<numRHS; ++j )
+        {
+            Field epsX=0;
+            for( Int i=0; i<k; ++i )
+                epsX += t(k-i)*X(i,j);
+            const Field gamma = X(k,j) - epsX;
+            for( Int i=0; i<k; ++i )
+                X(i,j) += gamma*b[i];
+            X(k,j) = gamma*b[k];
+        }
+    }
+}
+
+template<typename Field>
+void LinearSolve
+( const ToeplitzOperator<Field>& A,
+        DistMultiVec<Field>& X )
+{
+    EL_DEBUG_CSE
+    // The recursion is inherently sequential, and so every process
+    // redundantly solves against all of X and keeps its own rows
+    DistMatrix<Field,STAR,STAR> X_STAR_STAR( X.Grid() );
+    Copy( X, X_STAR_STAR );
+    LinearSolve( A, X_STAR_STAR.Matrix() );
+    const Int firstLocalRow = X.FirstLocalRow();
+    X.Matrix() =
+      X_STAR_STAR.LockedMatrix()
+      ( IR(firstLocalRow,firstLocalRow+X.LocalHeight()), ALL );
+}
+
+#define PROTO(Field) \
+  template void LinearSolve \
+  ( const ToeplitzOperator<Field>& A, \
+          Matrix<Field>& X ); \
+  template void LinearSolve \
+  ( const ToeplitzOperator<Field>& A, \
+          DistMultiVec<Field>& X );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
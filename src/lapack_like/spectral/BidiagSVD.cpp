@@ -10,6 +10,7 @@
 
 #include "./BidiagSVD/QR.hpp"
 #include "./BidiagSVD/DivideAndConquer.hpp"
+#include "./BidiagSVD/DQDS.hpp"
 
 namespace El {
 
@@ -215,6 +216,21 @@ void PrepareBidiagonal
       cDeflateList, sDeflateList, cFlipList, sFlipList, ctrl );
 }
 
+// Overwrite s, which is initially the main diagonal of a square upper
+// bidiagonal matrix, with its singular values
+template<typename Real>
+void ValuesOnly
+( Matrix<Real>& s,
+  Matrix<Real>& superDiag,
+  BidiagSVDInfo& info,
+  const BidiagSVDCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.useDQDS && DQDS( s, superDiag, info.dqdsInfo, ctrl ) )
+        return;
+    info.qrInfo = bidiag_svd::QRAlg( s, superDiag, ctrl );
+}
+
 template<typename Real>
 BidiagSVDInfo
 Helper
@@ -244,7 +260,7 @@ Helper
     if( square )
     {
         s = mainDiag;
-        info.qrInfo = bidiag_svd::QRAlg( s, offDiag, ctrl );
+        ValuesOnly( s, offDiag, info, ctrl );
         Sort( s, DESCENDING );
     }
     else if( uplo == LOWER )
@@ -252,7 +268,7 @@ Helper
         // We were non-square and lower bidiagonal.
         auto offDiag0 = offDiag( IR(0,n-1), ALL );
         s = mainDiag;
-        info.qrInfo = bidiag_svd::QRAlg( s, offDiag0, ctrl );
+        ValuesOnly( s, offDiag0, info, ctrl );
         Sort( s, DESCENDING );
     }
     else
@@ -260,7 +276,7 @@ Helper
         // We were non-square and upper bidiagonal.
         auto offDiag0 = offDiag( IR(0,m-1), ALL );
         s = mainDiag;
-        info.qrInfo = bidiag_svd::QRAlg( s, offDiag0, ctrl );
+        ValuesOnly( s, offDiag0, info, ctrl );
         Sort( s, DESCENDING );
     }
 
@@ -377,8 +393,7 @@ Helper
             if( grid.VCRank() == 0 )
             {
                 s = mainDiag;
-                info.qrInfo =
-                  bidiag_svd::QRAlg( s.Matrix(), offDiag.Matrix(), ctrl );
+                ValuesOnly( s.Matrix(), offDiag.Matrix(), info, ctrl );
                 PackQRInfo( info.qrInfo, packedQRInfo );
             }
             s.Resize( minDim, 1 );
@@ -391,8 +406,7 @@ Helper
         {
             // Let's cross our fingers and ignore the forward instability
             s = mainDiag;
-            info.qrInfo =
-              bidiag_svd::QRAlg( s.Matrix(), offDiag.Matrix(), ctrl );
+            ValuesOnly( s.Matrix(), offDiag.Matrix(), info, ctrl );
         }
     }
     else if( uplo == LOWER )
@@ -406,8 +420,7 @@ Helper
             if( grid.VCRank() == 0 )
             {
                 s = mainDiag;
-                info.qrInfo =
-                  bidiag_svd::QRAlg( s.Matrix(), offDiag0.Matrix(), ctrl );
+                ValuesOnly( s.Matrix(), offDiag0.Matrix(), info, ctrl );
                 PackQRInfo( info.qrInfo, packedQRInfo );
             }
             s.Resize( minDim, 1 );
@@ -420,8 +433,7 @@ Helper
         {
             // Let's cross our fingers and ignore the forward instability
             s = mainDiag;
-            info.qrInfo =
-              bidiag_svd::QRAlg( s.Matrix(), offDiag0.Matrix(), ctrl );
+            ValuesOnly( s.Matrix(), offDiag0.Matrix(), info, ctrl );
         }
     }
     else
@@ -435,8 +447,7 @@ Helper
             if( grid.VCRank() == 0 )
             {
                 s = mainDiag;
-                info.qrInfo =
-                  bidiag_svd::QRAlg( s.Matrix(), offDiag0.Matrix(), ctrl );
+                ValuesOnly( s.Matrix(), offDiag0.Matrix(), info, ctrl );
                 PackQRInfo( info.qrInfo, packedQRInfo );
             }
             s.Resize( minDim, 1 );
@@ -449,8 +460,7 @@ Helper
         {
             // Let's cross our fingers and ignore the forward instability
             s = mainDiag;
-            info.qrInfo =
-              bidiag_svd::QRAlg( s.Matrix(), offDiag0.Matrix(), ctrl );
+            ValuesOnly( s.Matrix(), offDiag0.Matrix(), info, ctrl );
         }
     }
     Sort( s, DESCENDING );
@@ -0,0 +1,247 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BIDIAG_SVD_DQDS_HPP
+#define EL_BIDIAG_SVD_DQDS_HPP
+
+namespace El {
+namespace bidiag_svd {
+
+// The differential quotient-difference algorithm with shifts (dqds) of
+//
+//   K. Vince Fernando and Beresford N. Parlett,
+//   "Accurate singular values and differential qd algorithms",
+//   Numerische Mathematik, 67(2), pp. 191--229, 1994 [CITATION],
+//
+// which computes the singular values of an upper bidiagonal matrix B to high
+// relative accuracy by operating on the squares of its entries, i.e., on the
+// qd arrays q = diag(B)^2 and e = superdiag(B)^2 of B B^T. Each transform
+// maps the arrays of B B^T to those of B' B'^T = B^T B - tau I, and a shift
+// is only accepted if no negative pivot arises (which guarantees that the
+// shifted matrix remained positive definite).
+//
+// Rather than the intricate shift heuristics of LAPACK's {s,d}lasq4, each
+// shift is the Newton step from the origin on the characteristic polynomial,
+//
+//   tau = 1 / trace(inv(B B^T)) = 1 / || inv(B) ||_F^2,
+//
+// which is a lower bound for the smallest eigenvalue (so that rejections can
+// only result from rounding errors) and which converges quadratically once
+// the smallest eigenvalue has separated from the rest.
+
+namespace dqds {
+
+template<typename Real>
+Real NewtonShift( const vector<Real>& q, const vector<Real>& e, Int n )
+{
+    Real colNormSq = 1;
+    Real traceInv = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        if( q[j] == Real(0) )
+            return Real(0);
+        if( j > 0 )
+            colNormSq = 1 + (e[j-1]/q[j-1])*colNormSq;
+        traceInv += colNormSq/q[j];
+    }
+    return ( traceInv > Real(0) ? 1/traceInv : Real(0) );
+}
+
+// Attempt a dqds transform of the leading n entries with shift tau
+template<typename Real>
+bool Transform
+( vector<Real>& q, vector<Real>& e, Int n, const Real& tau,
+  vector<Real>& qNew, vector<Real>& eNew )
+{
+    Real d = q[0] - tau;
+    if( d < Real(0) )
+        return false;
+    for( Int i=0; i<n-1; ++i )
+    {
+        qNew[i] = d + e[i];
+        const Real t = q[i+1]/qNew[i];
+        eNew[i] = e[i]*t;
+        d = d*t - tau;
+        if( d < Real(0) )
+            return false;
+    }
+    qNew[n-1] = d;
+    std::swap( q, qNew );
+    std::swap( e, eNew );
+    return true;
+}
+
+// The eigenvalues of B B^T for the 2 x 2 upper bidiagonal B with qd arrays
+// [q0,q1] and [e0]
+template<typename Real>
+void TwoByTwo
+( const Real& q0, const Real& e0, const Real& q1, Real& big, Real& small )
+{
+    const Real trace = q0 + e0 + q1;
+    const Real det = q0*q1;
+    big = (trace + Sqrt(Max(trace*trace-4*det,Real(0))))/2;
+    small = ( big > Real(0) ? det/big : Real(0) );
+}
+
+// Compute the eigenvalues of an unreduced (positive) set of qd arrays,
+// returning false if the maximum number of transforms was exceeded
+template<typename Real>
+bool Segment
+( vector<Real>& q,
+  vector<Real>& e,
+  vector<Real>& values,
+  Int maxSweeps,
+  DQDSInfo& info )
+{
+    EL_DEBUG_CSE
+    Int n = q.size();
+    const Real tol = limits::Epsilon<Real>();
+    const Real tol2 = tol*tol;
+
+    // dqds converges the smallest eigenvalues to the bottom, so start with
+    // the larger end of the diagonal at the top
+    if( q[0] < q[n-1] )
+    {
+        std::reverse( q.begin(), q.end() );
+        std::reverse( e.begin(), e.end() );
+    }
+
+    vector<Real> qNew(n), eNew(Max(n-1,Int(0)));
+    Real sigma = 0, tau = 0;
+    while( n > 0 )
+    {
+        if( n == 1 )
+        {
+            values.push_back( sigma+q[0] );
+            break;
+        }
+
+        // Deflate a converged eigenvalue from the bottom
+        if( e[n-2] <= tol2*(sigma+q[n-1]) )
+        {
+            values.push_back( sigma+q[n-1] );
+            --n;
+            tau = NewtonShift( q, e, n );
+            continue;
+        }
+
+        // Deflate a decoupled 2 x 2 block from the bottom
+        Real big, small;
+        TwoByTwo( q[n-2], e[n-2], q[n-1], big, small );
+        if( n == 2 || e[n-3] <= tol2*(sigma+small) )
+        {
+            values.push_back( sigma+big );
+            values.push_back( sigma+small );
+            n -= 2;
+            if( n > 0 )
+                tau = NewtonShift( q, e, n );
+            continue;
+        }
+
+        Int numRejections = 0;
+        while( !Transform( q, e, n, tau, qNew, eNew ) )
+        {
+            // The shift can only be rejected due to rounding errors, so
+            // back off and eventually resort to a zero shift
+            ++info.numRejectedShifts;
+            ++numRejections;
+            if( tau == Real(0) )
+                return false;
+            tau = ( numRejections < 3 ? tau/2 : Real(0) );
+        }
+        if( ++info.numSweeps > maxSweeps )
+            return false;
+        sigma += tau;
+        tau = NewtonShift( q, e, n );
+    }
+    return true;
+}
+
+} // namespace dqds
+
+// Overwrite mainDiag with the (unsorted) singular values of the square upper
+// bidiagonal matrix with the given diagonal and superdiagonal. If false is
+// returned, the dqds iteration was not applicable (due to an exactly zero
+// diagonal entry) or failed to converge, and mainDiag is left unchanged.
+template<typename Real>
+bool DQDS
+( Matrix<Real>& mainDiag,
+  const Matrix<Real>& superDiag,
+  DQDSInfo& info,
+  const BidiagSVDCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = mainDiag.Height();
+    if( n == 0 )
+        return true;
+
+    // Scale the entries to at most one in magnitude so that their squares
+    // cannot overflow
+    Real scale = 0;
+    for( Int i=0; i<n; ++i )
+        scale = Max( scale, Abs(mainDiag(i)) );
+    for( Int i=0; i<n-1; ++i )
+        scale = Max( scale, Abs(superDiag(i)) );
+    if( scale == Real(0) )
+        return true;
+    for( Int i=0; i<n; ++i )
+        if( mainDiag(i) == Real(0) )
+            return false;
+
+    vector<Real> values, q, e;
+    values.reserve( n );
+    const Int maxSweeps = 30*n;
+    Int segBeg = 0;
+    while( segBeg < n )
+    {
+        // Split at (squared) superdiagonal entries which are exactly zero
+        Int segEnd = segBeg+1;
+        while( segEnd < n )
+        {
+            const Real beta = superDiag(segEnd-1)/scale;
+            if( beta*beta == Real(0) )
+                break;
+            ++segEnd;
+        }
+        const Int segSize = segEnd - segBeg;
+        q.resize( segSize );
+        e.resize( segSize-1 );
+        for( Int i=0; i<segSize; ++i )
+        {
+            const Real alpha = mainDiag(segBeg+i)/scale;
+            q[i] = alpha*alpha;
+            if( q[i] == Real(0) )
+                return false;
+        }
+        for( Int i=0; i<segSize-1; ++i )
+        {
+            const Real beta = superDiag(segBeg+i)/scale;
+            e[i] = beta*beta;
+        }
+        if( !dqds::Segment( q, e, values, maxSweeps, info ) )
+        {
+            if( ctrl.progress )
+                Output("dqds failed after ",info.numSweeps," transforms");
+            return false;
+        }
+        segBeg = segEnd;
+    }
+    if( ctrl.progress )
+        Output
+        ("dqds required ",info.numSweeps," transforms (with ",
+         info.numRejectedShifts," rejected shifts)");
+
+    for( Int i=0; i<n; ++i )
+        mainDiag(i) = scale*Sqrt(values[i]);
+    return true;
+}
+
+} // namespace bidiag_svd
+} // namespace El
+
+#endif // ifndef EL_BIDIAG_SVD_DQDS_HPP
@@ -11,11 +11,79 @@
 
 // TODO(poulson): Move said routine into a utility function
 #include "../Schur/SDC.hpp"
-using El::schur::SplitGrid;
 
 namespace El {
 namespace bidiag_svd {
 
+// Solve the secular equation for each of the columns of VSecular, where
+// column jLoc corresponds to the undeflated index firstCol + jLoc*colStride,
+// storing the singular value in dSecular(jLoc) and the products
+//
+//   (dUndeflated - dSecular(jLoc)) .* (dUndeflated + dSecular(jLoc))
+//
+// in the column, with plusShift (of the same size) as a workspace. The
+// contributions of these columns to the (unsigned) corrected update vector
+// are multiplied into rCorrected.
+//
+// The solves are batched through SecularSingularValues, and the products
+// forming rCorrected are then computed one row at a time so that no two
+// threads update the same entry.
+template<typename Real>
+void SolveSecularColumns
+( const Matrix<Real>& dUndeflated,
+  const Matrix<Real>& rUndeflated,
+  const Real& rho,
+        Matrix<Real>& dSecular,
+        Matrix<Real>& VSecular,
+        Matrix<Real>& plusShift,
+        Int firstCol,
+        Int colStride,
+        Matrix<Real>& rCorrected,
+        SecularSVDInfo& secularInfo,
+  const SecularSVDCtrl<Real>& secularCtrl,
+  bool progress )
+{
+    EL_DEBUG_CSE
+    const Int numUndeflated = VSecular.Height();
+    const Int numLocal = VSecular.Width();
+
+    auto batchInfo =
+      SecularSingularValues
+      ( firstCol, colStride, numLocal, dUndeflated, rho, rUndeflated,
+        dSecular, VSecular, plusShift, secularCtrl );
+    secularInfo.numIterations += batchInfo.numIterations;
+    secularInfo.numAlternations += batchInfo.numAlternations;
+    secularInfo.numCubicIterations += batchInfo.numCubicIterations;
+    secularInfo.numCubicFailures += batchInfo.numCubicFailures;
+    if( progress )
+        for( Int jLoc=0; jLoc<numLocal; ++jLoc )
+            Output
+            ("Secular singular value ",firstCol+jLoc*colStride," is ",
+             dSecular(jLoc));
+
+    EL_PARALLEL_FOR_GRAIN(numLocal*numUndeflated)
+    for( Int jLoc=0; jLoc<numLocal; ++jLoc )
+        for( Int k=0; k<numUndeflated; ++k )
+            VSecular(k,jLoc) *= plusShift(k,jLoc);
+
+    EL_PARALLEL_FOR_GRAIN(numLocal*numUndeflated)
+    for( Int k=0; k<numUndeflated; ++k )
+    {
+        Real product = rCorrected(k);
+        for( Int jLoc=0; jLoc<numLocal; ++jLoc )
+        {
+            const Int j = firstCol + jLoc*colStride;
+            if( j == k )
+                product *= VSecular(k,jLoc);
+            else
+                product *= VSecular(k,jLoc) /
+                  ((dUndeflated(j)+dUndeflated(k))*
+                   (dUndeflated(j)-dUndeflated(k)));
+        }
+        rCorrected(k) = product;
+    }
+}
+
 // The following is analogous to LAPACK's {s,d}lasd{1,2,3} [CITATION] but does
 // not accept initial sorting permutations for s0 and s1, nor does it enforce
 // any ordering on the resulting singular values. Several bugs in said LAPACK
@@ -610,43 +678,14 @@ Merge
     // For temporarily storing dUndeflated + d(j)
     Matrix<Real> plusShift;
     if( ctrl.wantU )
-        View( plusShift, USecular, ALL, IR(0) );
+        View( plusShift, USecular );
     else
-        plusShift.Resize( numUndeflated, 1 );
-
-    for( Int j=0; j<numUndeflated; ++j )
-    {
-        auto minusShift = VSecular( ALL, IR(j) );
+        plusShift.Resize( numUndeflated, numUndeflated );
 
-        auto valueInfo =
-          SecularSingularValue
-          ( j, dUndeflated, rho, rUndeflated, d(j), minusShift, plusShift,
-            dcCtrl.secularCtrl );
-        if( ctrl.progress )
-            Output("Secular singular value ",j," is ",d(j));
-
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        // minusShift currently holds dUndeflated-d(j) and plusShift
-        // holds dUndeflated+d(j). Overwrite minusShift with their
-        // element-wise product since that is all we require from here on
-        // out.
-        for( Int k=0; k<numUndeflated; ++k )
-            minusShift(k) *= plusShift(k);
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
-        {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) /
-              ((dUndeflated(j)+dUndeflated(k))*
-               (dUndeflated(j)-dUndeflated(k)));
-        }
-    }
+    auto dSecular = d( undeflatedInd, ALL );
+    SolveSecularColumns
+    ( dUndeflated, rUndeflated, rho, dSecular, VSecular, plusShift,
+      0, 1, rCorrected, secularInfo, dcCtrl.secularCtrl, ctrl.progress );
     for( Int j=0; j<numUndeflated; ++j )
         rCorrected(j) = Sgn(rUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
 
@@ -1468,44 +1507,20 @@ Merge
     auto& VSecularLoc = VSecular.Matrix();
 
     // For temporarily storing dUndeflated + d(j)
-    Matrix<Real> plusShift( numUndeflated, 1 );
-
     const Int numUndeflatedLoc = VSecularLoc.Width();
-    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
-    {
-        const Int j = VSecular.GlobalCol(jLoc);
-        auto minusShift = VSecularLoc( ALL, IR(jLoc) );
-
-        auto valueInfo =
-          SecularSingularValue
-          ( j, dUndeflated, rho, rUndeflated, dSecularLoc(jLoc),
-            minusShift, plusShift, dcCtrl.secularCtrl );
-        if( ctrl.progress && amRoot )
-            Output("Secular singular value ",j," is ",dSecularLoc(jLoc));
-
-        // We will sum these across all of the processors at the top-level
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        // minusShift currently holds dUndeflated-d(j) and plusShift
-        // holds dUndeflated+d(j). Overwrite minusShift with their
-        // element-wise product since that is all we require from here on
-        // out.
-        for( Int k=0; k<numUndeflated; ++k )
-            minusShift(k) *= plusShift(k);
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
-        {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) /
-              ((dUndeflated(j)+dUndeflated(k))*
-               (dUndeflated(j)-dUndeflated(k)));
-        }
-    }
+    Matrix<Real> plusShift;
+    if( ctrl.wantU )
+        View( plusShift, USecularLoc );
+    else
+        plusShift.Resize( numUndeflated, numUndeflatedLoc );
+
+    // Each process solves for its local columns (as a threaded batch), and
+    // we will sum the iteration counts across all of the processors at the
+    // top-level
+    SolveSecularColumns
+    ( dUndeflated, rUndeflated, rho, dSecularLoc, VSecularLoc, plusShift,
+      VSecular.RowShift(), VSecular.RowStride(), rCorrected, secularInfo,
+      dcCtrl.secularCtrl, ctrl.progress && amRoot );
     AllReduce( rCorrected, g.VRComm(), mpi::PROD );
     for( Int j=0; j<numUndeflated; ++j )
         rCorrected(j) = Sgn(rUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
@@ -1795,11 +1810,33 @@ DivideAndConquer
         Zeros( V1, 2, n-(split+1) );
     }
 
-    Matrix<Real> s0;
-    auto info0 = DivideAndConquer( mainDiag0, superDiag0, U0, s0, V0, ctrl );
-
-    Matrix<Real> s1;
-    auto info1 = DivideAndConquer( mainDiag1, superDiag1, U1, s1, V1, ctrl );
+    Matrix<Real> s0, s1;
+    DCInfo info0, info1;
+    if( dcCtrl.numThreads > 1 )
+    {
+        // The subproblems only write to disjoint views, so they can be
+        // solved concurrently, with the threads divided between them
+        auto ctrl0( ctrl ), ctrl1( ctrl );
+        ctrl0.dcCtrl.numThreads = dcCtrl.numThreads/2;
+        ctrl1.dcCtrl.numThreads = dcCtrl.numThreads-ctrl0.dcCtrl.numThreads;
+        TaskGraph graph;
+        graph.Insert
+        ( [&]()
+          { info0 =
+              DivideAndConquer( mainDiag0, superDiag0, U0, s0, V0, ctrl0 ); },
+          {&mainDiag0,&superDiag0}, {&U0,&s0,&V0} );
+        graph.Insert
+        ( [&]()
+          { info1 =
+              DivideAndConquer( mainDiag1, superDiag1, U1, s1, V1, ctrl1 ); },
+          {&mainDiag1,&superDiag1}, {&U1,&s1,&V1} );
+        graph.Execute( 2 );
+    }
+    else
+    {
+        info0 = DivideAndConquer( mainDiag0, superDiag0, U0, s0, V0, ctrl );
+        info1 = DivideAndConquer( mainDiag1, superDiag1, U1, s1, V1, ctrl );
+    }
 
     if( !ctrl.wantV )
     {
@@ -1989,7 +2026,7 @@ DivideAndConquer
     const Int split = m/2;
     const Grid *leftGrid, *rightGrid;
     const bool splitGrid =
-      SplitGrid( split, m-(split+1), grid, leftGrid, rightGrid );
+      schur::SplitGrid( split, m-(split+1), grid, leftGrid, rightGrid );
 
     const Real alpha = mainDiag(split);
     const Real beta = superDiag(split);
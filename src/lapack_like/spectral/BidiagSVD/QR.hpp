@@ -130,8 +130,9 @@ template<typename Field>
 void Sweep
 (       Matrix<Base<Field>>& mainDiag,
         Matrix<Base<Field>>& superDiag,
-        Matrix<Field>& U,
-        Matrix<Field>& V,
+        GivensSequenceQueue<Field>& UQueue,
+        GivensSequenceQueue<Field>& VQueue,
+        Int offset,
   const Base<Field>& shift,
         ForwardOrBackward direction,
         Matrix<Base<Field>>& cUList,
@@ -260,13 +261,11 @@ void Sweep
         }
         if( ctrl.wantU )
         {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, FORWARD, cUList, sUList, U );
+            UQueue.Push( FORWARD, offset, cUList, sUList );
         }
         if( ctrl.wantV )
         {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, FORWARD, cVList, sVList, V );
+            VQueue.Push( FORWARD, offset, cVList, sVList );
         }
     }
     else
@@ -366,13 +365,11 @@ void Sweep
         }
         if( ctrl.wantU )
         {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, BACKWARD, cUList, sUList, U );
+            UQueue.Push( BACKWARD, offset, cUList, sUList );
         }
         if( ctrl.wantV )
         {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, BACKWARD, cVList, sVList, V );
+            VQueue.Push( BACKWARD, offset, cVList, sVList );
         }
     }
 }
@@ -400,7 +397,6 @@ Helper
     EL_DEBUG_CSE
     typedef Base<Field> Real;
     const Int n = mainDiag.Height();
-    const Int mU = U.Height();
     const Int mV = V.Height();
     const Real eps = limits::Epsilon<Real>();
     const Real safeMin = limits::SafeMin<Real>();
@@ -465,7 +461,9 @@ Helper
     ForwardOrBackward direction = FORWARD;
     Matrix<Real> cUList(n,1), sUList(n,1), cVList(n,1), sVList(n,1);
     Matrix<Real> mainDiagSub, superDiagSub;
-    Matrix<Field> USub, VSub;
+    // The sweeps are only applied to U and V in batches
+    // (see GivensSequenceQueue)
+    GivensSequenceQueue<Field> UQueue( U ), VQueue( V );
     while( winEnd > 0 )
     {
         if( info.numInnerLoops > maxInnerLoops )
@@ -537,15 +535,11 @@ Helper
                 sigmaMin *= sgnMin; // The signs will be fixed at the end
                 if( ctrl.wantU )
                 {
-                    blas::Rot
-                    ( mU, U.Buffer(0,winBeg  ), 1,
-                          U.Buffer(0,winBeg+1), 1, cU, sU );
+                    UQueue.PushRotation( winBeg, cU, sU );
                 }
                 if( ctrl.wantV )
                 {
-                    blas::Rot
-                    ( mV, V.Buffer(0,winBeg  ), 1,
-                          V.Buffer(0,winBeg+1), 1, cV, sV );
+                    VQueue.PushRotation( winBeg, cV, sV );
                 }
             }
             else
@@ -731,16 +725,8 @@ Helper
         // views
         View( mainDiagSub, mainDiag, IR(winBeg,winEnd), ALL );
         View( superDiagSub, superDiag, IR(winBeg,winEnd-1), ALL );
-        if( ctrl.wantU )
-        {
-            View( USub, U, ALL, IR(winBeg,winEnd) );
-        }
-        if( ctrl.wantV )
-        {
-            View( VSub, V, ALL, IR(winBeg,winEnd) );
-        }
         Sweep
-        ( mainDiagSub, superDiagSub, USub, VSub, shift, direction,
+        ( mainDiagSub, superDiagSub, UQueue, VQueue, winBeg, shift, direction,
           cUList, sUList, cVList, sVList, ctrl );
 
         // Test for convergence of the last off-diagonal of the sweep
@@ -756,6 +742,9 @@ Helper
         }
     }
 
+    UQueue.Flush();
+    VQueue.Flush();
+
     // Force the singular values to be positive (absorbing signs into V)
     for( Int j=0; j<info.numUnconverged; ++j )
         mainDiag(j) = Real(-1);
@@ -125,7 +125,9 @@ CubicSecular
 
     bool rescale = false;
     Real scaleInv(1);
-    Matrix<Real> zScaled(3,1), dScaled(3,1);
+    Real zScaledBuf[3], dScaledBuf[3];
+    Matrix<Real> zScaled( 3, 1, zScaledBuf, 3 ),
+                 dScaled( 3, 1, dScaledBuf, 3 );
     Real maxDenomAbs;
     if( rightRoot )
     {
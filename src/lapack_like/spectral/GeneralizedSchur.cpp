@@ -0,0 +1,120 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename F>
+HessenbergQZInfo
+GeneralizedSchur
+( Matrix<F>& A,
+  Matrix<F>& B,
+  Matrix<F>& alpha,
+  Matrix<F>& beta,
+  const HessenbergQZCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    HessenbergTriangular( A, B );
+    return HessenbergQZ( A, B, alpha, beta, ctrl );
+}
+
+template<typename F>
+HessenbergQZInfo
+GeneralizedSchur
+( Matrix<F>& A,
+  Matrix<F>& B,
+  Matrix<F>& alpha,
+  Matrix<F>& beta,
+  Matrix<F>& Q,
+  Matrix<F>& Z,
+  const HessenbergQZCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    HessenbergTriangular( A, B, Q, Z );
+    auto ctrlMod( ctrl );
+    ctrlMod.accumulateSchurVecs = true;
+    return HessenbergQZ( A, B, alpha, beta, Q, Z, ctrlMod );
+}
+
+template<typename F>
+HessenbergQZInfo
+GeneralizedSchur
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& B,
+  AbstractDistMatrix<F>& alpha,
+  AbstractDistMatrix<F>& beta,
+  const HessenbergQZCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    HessenbergTriangular( A, B );
+    return HessenbergQZ( A, B, alpha, beta, ctrl );
+}
+
+template<typename F>
+HessenbergQZInfo
+GeneralizedSchur
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& B,
+  AbstractDistMatrix<F>& alpha,
+  AbstractDistMatrix<F>& beta,
+  AbstractDistMatrix<F>& QPre,
+  AbstractDistMatrix<F>& ZPre,
+  const HessenbergQZCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    // Both stages accumulate into [VC,STAR] Schur vectors
+    DistMatrixWriteProxy<F,F,VC,STAR> QProx( QPre ), ZProx( ZPre );
+    auto& Q = QProx.Get();
+    auto& Z = ZProx.Get();
+
+    HessenbergTriangular( A, B, Q, Z );
+    auto ctrlMod( ctrl );
+    ctrlMod.accumulateSchurVecs = true;
+    return HessenbergQZ( A, B, alpha, beta, Q, Z, ctrlMod );
+}
+
+#define PROTO(F) \
+  template HessenbergQZInfo GeneralizedSchur \
+  ( Matrix<F>& A, \
+    Matrix<F>& B, \
+    Matrix<F>& alpha, \
+    Matrix<F>& beta, \
+    const HessenbergQZCtrl& ctrl ); \
+  template HessenbergQZInfo GeneralizedSchur \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& B, \
+    AbstractDistMatrix<F>& alpha, \
+    AbstractDistMatrix<F>& beta, \
+    const HessenbergQZCtrl& ctrl ); \
+  template HessenbergQZInfo GeneralizedSchur \
+  ( Matrix<F>& A, \
+    Matrix<F>& B, \
+    Matrix<F>& alpha, \
+    Matrix<F>& beta, \
+    Matrix<F>& Q, \
+    Matrix<F>& Z, \
+    const HessenbergQZCtrl& ctrl ); \
+  template HessenbergQZInfo GeneralizedSchur \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& B, \
+    AbstractDistMatrix<F>& alpha, \
+    AbstractDistMatrix<F>& beta, \
+    AbstractDistMatrix<F>& Q, \
+    AbstractDistMatrix<F>& Z, \
+    const HessenbergQZCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_REAL_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
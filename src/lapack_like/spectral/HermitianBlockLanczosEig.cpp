@@ -0,0 +1,96 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+// Explicit Hermitian matrices are applied with Hemm through the
+// operator-based block Lanczos routines in El/lapack_like/spectral/
+// BlockLanczos.hpp
+
+template<typename Field>
+HermitianBlockLanczosInfo
+HermitianBlockLanczosEig
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+        Int numEig,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const HermitianBlockLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("Hermitian matrices must be square");
+    auto applyA =
+      [&]( const Matrix<Field>& Z, Matrix<Field>& AZ )
+      {
+          Zeros( AZ, n, Z.Width() );
+          Hemm( LEFT, uplo, Field(1), A, Z, Field(0), AZ );
+      };
+    return HermitianBlockLanczosEig<Field>( n, applyA, numEig, w, X, ctrl );
+}
+
+template<typename Field>
+HermitianBlockLanczosInfo
+HermitianBlockLanczosEig
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& APre,
+        Int numEig,
+        AbstractDistMatrix<Base<Field>>& wPre,
+        AbstractDistMatrix<Field>& XPre,
+  const HermitianBlockLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = APre.Height();
+    if( APre.Width() != n )
+        LogicError("Hermitian matrices must be square");
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<Field,Field,VC,STAR> XProx( XPre );
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    auto& A = AProx.GetLocked();
+    auto& X = XProx.Get();
+    auto& w = wProx.Get();
+
+    auto applyA =
+      [&]( const DistMatrix<Field,VC,STAR>& Z, DistMatrix<Field,VC,STAR>& AZ )
+      {
+          Zeros( AZ, n, Z.Width() );
+          Hemm( LEFT, uplo, Field(1), A, Z, Field(0), AZ );
+      };
+    return HermitianBlockLanczosEig<Field>
+      ( A.Grid(), n, applyA, numEig, w, X, ctrl );
+}
+
+#define PROTO(Field) \
+  template HermitianBlockLanczosInfo HermitianBlockLanczosEig \
+  ( UpperOrLower uplo, \
+    const Matrix<Field>& A, \
+    Int numEig, \
+    Matrix<Base<Field>>& w, \
+    Matrix<Field>& X, \
+    const HermitianBlockLanczosCtrl<Base<Field>>& ctrl ); \
+  template HermitianBlockLanczosInfo HermitianBlockLanczosEig \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<Field>& A, \
+    Int numEig, \
+    AbstractDistMatrix<Base<Field>>& w, \
+    AbstractDistMatrix<Field>& X, \
+    const HermitianBlockLanczosCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
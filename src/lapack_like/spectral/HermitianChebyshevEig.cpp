@@ -0,0 +1,381 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+// Chebyshev-filtered subspace iteration in the spirit of ChASE and of the
+// CheFSI method of Zhou and Saad: each iteration performs a Rayleigh-Ritz
+// projection onto the current basis, then filters the basis with a
+// Chebyshev polynomial which is small on [theta_{b-1},upperBound] (where
+// theta_{b-1} is the largest Ritz value and upperBound bounds the spectrum
+// from above) and large below it, and then orthonormalizes the result.
+//
+// Converged vectors are not locked, so every iteration filters the entire
+// basis.
+
+namespace herm_eig {
+
+template<typename Real>
+Int ChebyshevBasisSize
+( Int n, Int numEig, const HermitianChebyshevCtrl<Real>& ctrl )
+{
+    const Int numGuardVectors =
+      ( ctrl.numGuardVectors > 0 ?
+        ctrl.numGuardVectors : Max(numEig/4,Int(8)) );
+    return Min( n, numEig+numGuardVectors );
+}
+
+// Bound the spectrum of A from above by the largest eigenvalue of the
+// tridiagonal matrix from a short Lanczos process plus the norm of the final
+// residual
+template<typename F,class MatrixType>
+Base<F> LanczosUpperBound
+( UpperOrLower uplo,
+  const MatrixType& A,
+        MatrixType& vPrev,
+        MatrixType& v,
+        MatrixType& u,
+        Int numSteps )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    numSteps = Max(Min(numSteps,n),Int(1));
+
+    Matrix<Real> T;
+    Zeros( T, numSteps, numSteps );
+    Zeros( vPrev, n, 1 );
+    Zeros( u, n, 1 );
+    Gaussian( v, n, 1 );
+    v *= F(1)/FrobeniusNorm(v);
+
+    Real beta = 0;
+    for( Int k=0; k<numSteps; ++k )
+    {
+        Hemm( LEFT, uplo, F(1), A, v, F(0), u );
+        if( k > 0 )
+            Axpy( F(-beta), vPrev, u );
+        const Real alpha = RealPart(Dot(v,u));
+        T(k,k) = alpha;
+        Axpy( F(-alpha), v, u );
+
+        beta = FrobeniusNorm( u );
+        if( beta == Real(0) )
+        {
+            T.Resize( k+1, k+1 );
+            break;
+        }
+        if( k < numSteps-1 )
+            T(k+1,k) = T(k,k+1) = beta;
+        vPrev = v;
+        v = u;
+        v *= F(1)/beta;
+    }
+
+    Matrix<Real> tEig;
+    HermitianEig( LOWER, T, tEig );
+    return tEig(tEig.Height()-1) + beta;
+}
+
+// Overwrite X with p(A) X, where p is the Chebyshev polynomial of the given
+// degree for the interval [lowerBound,upperBound], scaled so that
+// p(lambdaMin) = 1 in order to avoid overflow. The three-term recurrence
+// follows Zhou and Saad's scaled variant.
+template<typename F,class MatrixType>
+void ChebyshevFilter
+( UpperOrLower uplo,
+  const MatrixType& A,
+        MatrixType& X,
+        MatrixType& Y,
+        Int degree,
+        Base<F> lambdaMin,
+        Base<F> lowerBound,
+        Base<F> upperBound )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real halfWidth = (upperBound-lowerBound) / 2;
+    const Real center = (upperBound+lowerBound) / 2;
+    Real sigma = halfWidth / (lambdaMin-center);
+    const Real tau = 2 / sigma;
+
+    // Y := (A - center I) X (sigma / halfWidth)
+    Y = X;
+    Hemm
+    ( LEFT, uplo,
+      F(sigma/halfWidth), A, X, F(-center*sigma/halfWidth), Y );
+
+    MatrixType* prev = &X;
+    MatrixType* curr = &Y;
+    for( Int k=1; k<degree; ++k )
+    {
+        // prev := (A - center I) curr (2 sigmaNew / halfWidth) -
+        //         prev (sigma sigmaNew)
+        const Real sigmaNew = 1 / (tau-sigma);
+        const Real scale = 2*sigmaNew/halfWidth;
+        Hemm( LEFT, uplo, F(scale), A, *curr, F(-sigma*sigmaNew), *prev );
+        Axpy( F(-center*scale), *curr, *prev );
+        std::swap( prev, curr );
+        sigma = sigmaNew;
+    }
+    if( curr != &X )
+        X = *curr;
+}
+
+template<typename F,class MatrixType,class TriangType>
+void ChebyshevOrthonormalize
+( MatrixType& V, TriangType& R, qr::CholeskyQRVariant variant )
+{
+    EL_DEBUG_CSE
+    qr::CholeskyQRCtrl cholCtrl;
+    cholCtrl.variant = variant;
+    try
+    {
+        qr::Cholesky( V, R, cholCtrl );
+    }
+    catch( NonHPDMatrixException& e )
+    {
+        qr::ExplicitUnitary( V );
+    }
+}
+
+template<typename F,class MatrixType>
+void ChebyshevInitialBasis
+( const MatrixType& X, MatrixType& V, Int basisSize, bool warmStart )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height();
+    Gaussian( V, n, basisSize );
+    if( warmStart && X.Width() > 0 )
+    {
+        if( X.Width() > basisSize )
+            LogicError
+            ("Warm start had ",X.Width()," vectors, but the basis only has ",
+             "room for ",basisSize);
+        auto VStart = V( ALL, IR(0,X.Width()) );
+        VStart = X;
+    }
+}
+
+} // namespace herm_eig
+
+template<typename Field>
+HermitianChebyshevInfo
+HermitianChebyshevEig
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+        Int numEig,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const HermitianChebyshevCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("Hermitian matrices must be square");
+    if( numEig < 0 || numEig > n )
+        LogicError("Cannot compute ",numEig," eigenpairs of an ",n," x ",n,
+                   " matrix");
+    if( ctrl.degree < 1 )
+        LogicError("The Chebyshev degree must be positive");
+    if( ctrl.warmStart && X.Width() > 0 && X.Height() != n )
+        LogicError("The warm start vectors were of the wrong height");
+    HermitianChebyshevInfo info;
+    if( numEig == 0 )
+    {
+        w.Resize( 0, 1 );
+        X.Resize( n, 0 );
+        return info;
+    }
+    const Int basisSize = herm_eig::ChebyshevBasisSize( n, numEig, ctrl );
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( ctrl.tol > Real(0) ? ctrl.tol : n*eps );
+
+    Matrix<Field> V, AV, W;
+    const Real upperBound =
+      herm_eig::LanczosUpperBound<Field>
+      ( uplo, A, V, AV, W, ctrl.numLanczosSteps );
+
+    herm_eig::ChebyshevInitialBasis<Field>( X, V, basisSize, ctrl.warmStart );
+    Matrix<Field> H, Z, R;
+    herm_eig::ChebyshevOrthonormalize<Field>( V, R, ctrl.orthoVariant );
+
+    Matrix<Real> theta, residNorms;
+    Zeros( AV, n, basisSize );
+    for( Int it=0; it<ctrl.maxIts; ++it )
+    {
+        // Rayleigh-Ritz with H = V^H A V
+        Hemm( LEFT, uplo, Field(1), A, V, Field(0), AV );
+        Gemm( ADJOINT, NORMAL, Field(1), V, AV, H );
+        HermitianEig( LOWER, H, theta, Z );
+        W = V;
+        Gemm( NORMAL, NORMAL, Field(1), W, Z, V );
+        W = AV;
+        Gemm( NORMAL, NORMAL, Field(1), W, Z, AV );
+        info.numIterations = it+1;
+
+        // Count the leading Ritz pairs with small residuals
+        W = AV( ALL, IR(0,numEig) );
+        X = V( ALL, IR(0,numEig) );
+        DiagonalScale( RIGHT, NORMAL, theta(IR(0,numEig),ALL), X );
+        W -= X;
+        ColumnTwoNorms( W, residNorms );
+        const Real spectralRadius = Max( Abs(theta(0)), Abs(upperBound) );
+        info.numConverged = 0;
+        while( info.numConverged < numEig &&
+               residNorms(info.numConverged) <= tol*spectralRadius )
+            ++info.numConverged;
+        if( ctrl.progress )
+            Output
+            ("iteration ",it,": ",info.numConverged," of ",numEig,
+             " converged");
+        if( info.numConverged == numEig )
+            break;
+
+        const Real lowerBound = theta(basisSize-1);
+        if( lowerBound >= upperBound )
+            break;
+        herm_eig::ChebyshevFilter<Field>
+        ( uplo, A, V, W, ctrl.degree, theta(0), lowerBound, upperBound );
+        herm_eig::ChebyshevOrthonormalize<Field>( V, R, ctrl.orthoVariant );
+    }
+    w = theta( IR(0,numEig), ALL );
+    X = V( ALL, IR(0,numEig) );
+    return info;
+}
+
+template<typename Field>
+HermitianChebyshevInfo
+HermitianChebyshevEig
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& APre,
+        Int numEig,
+        AbstractDistMatrix<Base<Field>>& wPre,
+        AbstractDistMatrix<Field>& XPre,
+  const HermitianChebyshevCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = APre.Height();
+    if( APre.Width() != n )
+        LogicError("Hermitian matrices must be square");
+    if( numEig < 0 || numEig > n )
+        LogicError("Cannot compute ",numEig," eigenpairs of an ",n," x ",n,
+                   " matrix");
+    if( ctrl.degree < 1 )
+        LogicError("The Chebyshev degree must be positive");
+    if( ctrl.warmStart && XPre.Width() > 0 && XPre.Height() != n )
+        LogicError("The warm start vectors were of the wrong height");
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> XProx( XPre );
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    auto& A = AProx.GetLocked();
+    auto& X = XProx.Get();
+    auto& w = wProx.Get();
+    const Grid& g = A.Grid();
+
+    HermitianChebyshevInfo info;
+    if( numEig == 0 )
+    {
+        w.Resize( 0, 1 );
+        X.Resize( n, 0 );
+        return info;
+    }
+    const Int basisSize = herm_eig::ChebyshevBasisSize( n, numEig, ctrl );
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( ctrl.tol > Real(0) ? ctrl.tol : n*eps );
+
+    DistMatrix<Field> V(g), AV(g), W(g);
+    const Real upperBound =
+      herm_eig::LanczosUpperBound<Field>
+      ( uplo, A, V, AV, W, ctrl.numLanczosSteps );
+
+    herm_eig::ChebyshevInitialBasis<Field>( X, V, basisSize, ctrl.warmStart );
+    DistMatrix<Field,STAR,STAR> H(g), Z(g), R(g);
+    herm_eig::ChebyshevOrthonormalize<Field>( V, R, ctrl.orthoVariant );
+
+    // The projected eigenproblem is redundantly solved on every process
+    Matrix<Real> theta;
+    DistMatrix<Real,STAR,STAR> thetaLeading(g), residNorms_STAR_STAR(g);
+    DistMatrix<Real,MR,STAR> residNorms(g);
+    Zeros( AV, n, basisSize );
+    for( Int it=0; it<ctrl.maxIts; ++it )
+    {
+        // Rayleigh-Ritz with H = V^H A V
+        Hemm( LEFT, uplo, Field(1), A, V, Field(0), AV );
+        Gemm( ADJOINT, NORMAL, Field(1), V, AV, H );
+        Z.Resize( basisSize, basisSize );
+        HermitianEig( LOWER, H.Matrix(), theta, Z.Matrix() );
+        W = V;
+        Gemm( NORMAL, NORMAL, Field(1), W, Z, V );
+        W = AV;
+        Gemm( NORMAL, NORMAL, Field(1), W, Z, AV );
+        info.numIterations = it+1;
+
+        // Count the leading Ritz pairs with small residuals
+        thetaLeading.Resize( numEig, 1 );
+        thetaLeading.Matrix() = theta( IR(0,numEig), ALL );
+        W = AV( ALL, IR(0,numEig) );
+        X = V( ALL, IR(0,numEig) );
+        DiagonalScale( RIGHT, NORMAL, thetaLeading, X );
+        W -= X;
+        ColumnTwoNorms( W, residNorms );
+        residNorms_STAR_STAR = residNorms;
+        const Real spectralRadius = Max( Abs(theta(0)), Abs(upperBound) );
+        info.numConverged = 0;
+        while( info.numConverged < numEig &&
+               residNorms_STAR_STAR.GetLocal(info.numConverged,0) <=
+               tol*spectralRadius )
+            ++info.numConverged;
+        if( ctrl.progress && g.Rank() == 0 )
+            Output
+            ("iteration ",it,": ",info.numConverged," of ",numEig,
+             " converged");
+        if( info.numConverged == numEig )
+            break;
+
+        const Real lowerBound = theta(basisSize-1);
+        if( lowerBound >= upperBound )
+            break;
+        herm_eig::ChebyshevFilter<Field>
+        ( uplo, A, V, W, ctrl.degree, theta(0), lowerBound, upperBound );
+        herm_eig::ChebyshevOrthonormalize<Field>( V, R, ctrl.orthoVariant );
+    }
+    w = thetaLeading;
+    X = V( ALL, IR(0,numEig) );
+    return info;
+}
+
+#define PROTO(Field) \
+  template HermitianChebyshevInfo HermitianChebyshevEig \
+  ( UpperOrLower uplo, \
+    const Matrix<Field>& A, \
+    Int numEig, \
+    Matrix<Base<Field>>& w, \
+    Matrix<Field>& X, \
+    const HermitianChebyshevCtrl<Base<Field>>& ctrl ); \
+  template HermitianChebyshevInfo HermitianChebyshevEig \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<Field>& A, \
+    Int numEig, \
+    AbstractDistMatrix<Base<Field>>& w, \
+    AbstractDistMatrix<Field>& X, \
+    const HermitianChebyshevCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
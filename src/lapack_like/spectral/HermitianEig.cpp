@@ -9,6 +9,7 @@
 #include <El.hpp>
 
 #include "./HermitianEig/SDC.hpp"
+#include "./HermitianEig/Slicing.hpp"
 
 // The targeted number of pieces to break the eigenvectors into during the
 // redistribution from the [* ,VR] distribution after PMRRR to the [MC,MR]
@@ -72,7 +73,8 @@ MRRRPostEstimate
         AbstractDistMatrix<Real>& Q,
         SortType sort,
         Real vl,
-        Real vu );
+        Real vu,
+  const MRRRCtrl& mrrrCtrl=MRRRCtrl() );
 
 } // namespace herm_tridiag_eig
 
@@ -261,6 +263,7 @@ HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_TRACE_REGION("HermitianEig");
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
     if( ctrl.useSDC )
@@ -505,6 +508,7 @@ HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_TRACE_REGION("HermitianEig");
     typedef Base<F> Real;
     if( APre.Height() != APre.Width() )
         LogicError("Hermitian matrices must be square");
@@ -620,6 +624,7 @@ HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_TRACE_REGION("HermitianEig");
     typedef Base<F> Real;
     const Int n = A.Height();
     auto subset = ctrl.tridiagEigCtrl.subset;
@@ -930,7 +935,8 @@ MRRR
     if( subset.rangeSubset )
         info.tridiagEigInfo = herm_tridiag_eig::MRRRPostEstimate
         ( d_STAR_STAR, e_STAR_STAR, w, Q_STAR_VR, UNSORTED,
-          subset.lowerBound, subset.upperBound );
+          subset.lowerBound, subset.upperBound,
+          ctrl.tridiagEigCtrl.mrrrCtrl );
     else
         info.tridiagEigInfo = HermitianTridiagEig
         ( d_STAR_STAR, e_STAR_STAR, w, Q_STAR_VR, ctrl.tridiagEigCtrl );
@@ -1009,6 +1015,7 @@ HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_TRACE_REGION("HermitianEig");
     typedef Base<F> Real;
     const Int n = A.Height();
     auto subset = ctrl.tridiagEigCtrl.subset;
@@ -1084,6 +1091,11 @@ HermitianEig
         herm_eig::SDC( uplo, A, w, Q, ctrl.sdcCtrl );
         herm_eig::SortAndFilter( w, Q, ctrl.tridiagEigCtrl );
     }
+    else if( ctrl.useSlicing )
+    {
+        herm_eig::Slicing( uplo, A, w, Q, ctrl );
+        herm_eig::SortAndFilter( w, Q, ctrl.tridiagEigCtrl );
+    }
     else if( ctrl.tridiagEigCtrl.alg == HERM_TRIDIAG_EIG_MRRR )
     {
         info = herm_eig::MRRR( uplo, A, w, Q, ctrl );
@@ -1109,10 +1121,14 @@ HermitianEig
         SafeScale( normMin, maxNormA, w );
     }
 
-    auto sortPairs = TaggedSort( w, ctrl.tridiagEigCtrl.sort );
-    for( Int j=0; j<w.Height(); ++j )
-        w.Set( j, 0, sortPairs[j].value );
-    ApplyTaggedSortToEachRow( sortPairs, Q );
+    // Sort the eigenpairs with a parallel sample sort rather than gathering
+    if( ctrl.tridiagEigCtrl.sort != UNSORTED )
+    {
+        DistPermutation sortPerm( w.Grid() );
+        SortingPermutation( w, sortPerm, ctrl.tridiagEigCtrl.sort );
+        sortPerm.PermuteRows( w );
+        sortPerm.PermuteCols( Q );
+    }
 
     if( ctrl.timeStages )
     {
@@ -18,8 +18,6 @@ namespace El {
 namespace herm_eig {
 
 using El::schur::ComputePartition;
-using El::schur::PushSubproblems;
-using El::schur::PullSubproblems;
 
 // TODO(poulson): Exploit symmetry in A := Q^H A Q. Routine for A := X^H A X?
 
@@ -140,6 +138,7 @@ RandomizedSignDivide
     auto S( G );
     PolarCtrl polarCtrl;
     polarCtrl.qdwh = true;
+    polarCtrl.qdwhCtrl.mixedPrecision = ctrl.mixedPrecision;
     HermitianPolar( uplo, S, polarCtrl );
     ShiftDiagonal( S, F(1) );
     S *= F(1)/F(2);
@@ -210,7 +209,8 @@ RandomizedSignDivide
     auto S( G );
     PolarCtrl polarCtrl;
     polarCtrl.qdwh = true;
-    HermitianPolar( uplo, G, polarCtrl );
+    polarCtrl.qdwhCtrl.mixedPrecision = ctrl.mixedPrecision;
+    HermitianPolar( uplo, S, polarCtrl );
     ShiftDiagonal( S, F(1) );
     S *= F(1)/F(2);
 
@@ -590,16 +590,39 @@ void SDC
     else
         Zero( ATR );
 
-    // Recurse on the two subproblems
+    // Recurse on the two subproblems concurrently, each over a subgrid whose
+    // size is proportional to its work
     DistMatrix<F> ATLSub, ABRSub;
     DistMatrix<Real,VR,STAR> wTSub, wBSub;
-    PushSubproblems
-    ( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub, ctrl.progress );
-    if( ATL.Participating() )
-        SDC( uplo, ATLSub, wTSub, ctrl );
-    if( ABR.Participating() )
-        SDC( uplo, ABRSub, wBSub, ctrl );
-    PullSubproblems( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub );
+    auto subproblem =
+      [&]( DistMatrix<F>& AHalf, DistMatrix<Real,VR,STAR>& wHalf,
+           DistMatrix<F>& ASub, DistMatrix<Real,VR,STAR>& wSub )
+      {
+          Subproblem half;
+          half.work = Pow( double(AHalf.Height()), 3. );
+          half.push = [&]( const Grid& subgrid )
+            {
+                ASub.SetGrid( subgrid );
+                wSub.SetGrid( subgrid );
+                ASub = AHalf;
+            };
+          half.solve = [&]( const Grid& )
+            { SDC( uplo, ASub, wSub, ctrl ); };
+          half.pull = [&]()
+            {
+                AHalf = ASub;
+                schur::PullVRStar( wSub, wHalf );
+                ASub.Empty();
+                wSub.Empty();
+            };
+          return half;
+      };
+    vector<Subproblem> subproblems;
+    subproblems.push_back( subproblem( ATL, wT, ATLSub, wTSub ) );
+    subproblems.push_back( subproblem( ABR, wB, ABRSub, wBSub ) );
+    SubproblemCtrl subCtrl;
+    subCtrl.progress = ctrl.progress;
+    RunSubproblems( A.Grid(), subproblems, subCtrl );
 }
 
 template<typename F>
@@ -656,21 +679,49 @@ void SDC
     else
         Zero( ATR );
 
-    // Recurse on the two subproblems
+    // Recurse on the two subproblems concurrently, each over a subgrid whose
+    // size is proportional to its work, and pull the results back to this grid
     DistMatrix<F> ATLSub, ABRSub, ZTSub, ZBSub;
     DistMatrix<Real,VR,STAR> wTSub, wBSub;
-    PushSubproblems
-    ( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub, ZTSub, ZBSub, 
-      ctrl.progress );
-    if( ATLSub.Participating() )
-        SDC( uplo, ATLSub, wTSub, ZTSub, ctrl );
-    if( ABRSub.Participating() )
-        SDC( uplo, ABRSub, wBSub, ZBSub, ctrl );
-
-    // Pull the results back to this grid
     DistMatrix<F> ZT(g), ZB(g);
-    PullSubproblems
-    ( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub, ZT, ZB, ZTSub, ZBSub );
+    auto subproblem =
+      [&]( DistMatrix<F>& AHalf, DistMatrix<Real,VR,STAR>& wHalf,
+           DistMatrix<F>& ZHalf, DistMatrix<F>& ASub,
+           DistMatrix<Real,VR,STAR>& wSub, DistMatrix<F>& ZSub )
+      {
+          Subproblem half;
+          half.work = Pow( double(AHalf.Height()), 3. );
+          half.push = [&]( const Grid& subgrid )
+            {
+                ASub.SetGrid( subgrid );
+                wSub.SetGrid( subgrid );
+                ZSub.SetGrid( subgrid );
+                ASub = AHalf;
+            };
+          half.solve = [&]( const Grid& )
+            { SDC( uplo, ASub, wSub, ZSub, ctrl ); };
+          half.pull = [&]()
+            {
+                AHalf = ASub;
+                schur::PullVRStar( wSub, wHalf );
+                if( ZSub.Grid() != g )
+                {
+                    bool includeViewers = true;
+                    ZSub.MakeConsistent( includeViewers );
+                }
+                ZHalf = ZSub;
+                ASub.Empty();
+                wSub.Empty();
+                ZSub.Empty();
+            };
+          return half;
+      };
+    vector<Subproblem> subproblems;
+    subproblems.push_back( subproblem( ATL, wT, ZT, ATLSub, wTSub, ZTSub ) );
+    subproblems.push_back( subproblem( ABR, wB, ZB, ABRSub, wBSub, ZBSub ) );
+    SubproblemCtrl subCtrl;
+    subCtrl.progress = ctrl.progress;
+    RunSubproblems( g, subproblems, subCtrl );
 
     // Update the eigen vectors
     auto G( QL );
@@ -0,0 +1,332 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANEIG_SLICING_HPP
+#define EL_HERMITIANEIG_SLICING_HPP
+
+namespace El {
+namespace herm_eig {
+
+// Spectrum slicing for the eigenpairs with eigenvalues in (lowerBound,
+// upperBound]:
+//
+//  1) The interval is split into equal-width slices, and the slices are
+//     dealt out to disjoint subgrids, each of which receives a copy of A.
+//
+//  2) Each subgrid computes the number of eigenvalues less than or equal to
+//     each of its slice boundaries from the inertia of a pivoted LDL^H
+//     factorization of A - sigma I, and the counts are shared.
+//
+//  3) Each subgrid factors A - sigma I about the midpoint of each of its
+//     slices and runs shift-and-invert subspace iteration (with a
+//     Rayleigh-Ritz projection in each step) on a basis with room for the
+//     known number of eigenvalues in the slice plus guard vectors. Since the
+//     slice is the interval of eigenvalues closest to the shift, its
+//     eigenpairs are the Ritz pairs closest to the shift.
+//
+// The subgrids only communicate with each other when A is distributed and
+// when the eigenpairs are gathered.
+
+// Split the processes of 'grid' into 'numGroups' contiguous subgrids
+inline void SliceGrids
+( const Grid& grid, Int numGroups, vector<unique_ptr<Grid>>& grids )
+{
+    EL_DEBUG_CSE
+    const Int p = grid.Size();
+    mpi::Group owningGroup = grid.OwningGroup();
+    grids.resize( numGroups );
+    Int offset = 0;
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const Int groupSize = p/numGroups + ( group < p % numGroups ? 1 : 0 );
+        vector<int> ranks( groupSize );
+        for( Int q=0; q<groupSize; ++q )
+            ranks[q] = offset + q;
+        mpi::Group subgroup;
+        mpi::Incl( owningGroup, groupSize, ranks.data(), subgroup );
+        grids[group].reset
+        ( new Grid
+          ( grid.VCComm(), subgroup, Grid::DefaultHeight(groupSize) ) );
+        mpi::Free( subgroup );
+        offset += groupSize;
+    }
+}
+
+// Factor A - sigma I, perturbing sigma if it is (numerically) an eigenvalue,
+// and return the number of eigenvalues of A less than or equal to sigma
+template<typename F>
+Int ShiftedFactor
+( const DistMatrix<F>& A,
+        Base<F>& sigma,
+        DistMatrix<F>& B,
+        DistMatrix<F,MD,STAR>& dSub,
+        DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real maxNormA = MaxNorm( A );
+    InertiaType inertia;
+    for( Int attempt=0; attempt<10; ++attempt )
+    {
+        B = A;
+        ShiftDiagonal( B, F(-sigma) );
+        LDL( B, dSub, P, true );
+        inertia = ldl::Inertia( GetRealPartOfDiagonal(B), dSub );
+        if( inertia.numZero == 0 )
+            break;
+        sigma += 10*eps*Max(maxNormA,Abs(sigma))*Real(attempt+1);
+    }
+    return inertia.numNegative + inertia.numZero;
+}
+
+// Compute the 'numEig' eigenpairs of A closest to sigma through
+// shift-and-invert subspace iteration
+template<typename F>
+void SliceEig
+( const DistMatrix<F>& A,
+        Base<F> sigma,
+        Int numEig,
+        DistMatrix<Base<F>,STAR,STAR>& w,
+        DistMatrix<F>& X,
+  const HermitianSliceCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( ctrl.tol > Real(0) ? ctrl.tol : n*eps );
+    const Real oneNormA = HermitianOneNorm( LOWER, A );
+
+    DistMatrix<F> B(g);
+    DistMatrix<F,MD,STAR> dSub(g);
+    DistPermutation P(g);
+    ShiftedFactor( A, sigma, B, dSub, P );
+
+    const Int basisSize = Min( n, 2*numEig+ctrl.numGuardVectors );
+    DistMatrix<F> V(g), AV(g), R(g);
+    Gaussian( V, n, basisSize );
+    DistMatrix<F,STAR,STAR> H(g), Z_STAR_STAR(g);
+    DistMatrix<Real,MR,STAR> residNorms(g);
+    Matrix<Real> theta;
+    Matrix<F> Z;
+    vector<ValueInt<Real>> distances( basisSize );
+    for( Int it=0; it<ctrl.maxIts; ++it )
+    {
+        // V := orth(inv(A - sigma I) V)
+        ldl::SolveAfter( B, dSub, P, V, true );
+        qr::ExplicitUnitary( V );
+
+        // Rayleigh-Ritz with H = V^H A V
+        Hemm( LEFT, LOWER, F(1), A, V, F(0), AV );
+        Gemm( ADJOINT, NORMAL, F(1), V, AV, H );
+        HermitianEig( LOWER, H.Matrix(), theta, Z );
+
+        // Order the Ritz pairs by their distance from the shift
+        for( Int j=0; j<basisSize; ++j )
+        {
+            distances[j].value = Abs(theta(j)-sigma);
+            distances[j].index = j;
+        }
+        std::sort
+        ( distances.begin(), distances.end(), ValueInt<Real>::Lesser );
+        Z_STAR_STAR.Resize( basisSize, basisSize );
+        w.Resize( numEig, 1 );
+        for( Int j=0; j<basisSize; ++j )
+        {
+            const Int jOld = distances[j].index;
+            auto zj = Z_STAR_STAR.Matrix()( ALL, IR(j) );
+            zj = Z( ALL, IR(jOld) );
+            if( j < numEig )
+                w.Matrix()(j) = theta(jOld);
+        }
+        X = V;
+        Gemm( NORMAL, NORMAL, F(1), X, Z_STAR_STAR, V );
+        R = AV;
+        Gemm( NORMAL, NORMAL, F(1), R, Z_STAR_STAR, AV );
+
+        // R := A X - X diag(w) for the numEig closest Ritz pairs
+        auto V0 = V( ALL, IR(0,numEig) );
+        R = AV( ALL, IR(0,numEig) );
+        X = V0;
+        DiagonalScale( RIGHT, NORMAL, w, X );
+        R -= X;
+        ColumnTwoNorms( R, residNorms );
+        const Real maxResid = MaxNorm( residNorms );
+        if( ctrl.progress && g.Rank() == 0 )
+            Output
+            ("  sigma=",sigma,", iteration ",it,": max residual ",maxResid);
+        if( maxResid <= tol*oneNormA )
+            break;
+        if( it == ctrl.maxIts-1 && g.Rank() == 0 )
+            Output
+            ("Warning: slice about ",sigma," did not converge in ",
+             ctrl.maxIts," iterations (max residual ",maxResid,")");
+    }
+    X = V( ALL, IR(0,numEig) );
+}
+
+template<typename F>
+void Slicing
+( UpperOrLower uplo,
+  const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<Base<F>>& wPre,
+        AbstractDistMatrix<F>& QPre,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const auto& subset = ctrl.tridiagEigCtrl.subset;
+    const auto& sliceCtrl = ctrl.sliceCtrl;
+    if( !subset.rangeSubset )
+        LogicError("Spectrum slicing requires a range subset");
+    const Grid& grid = APre.Grid();
+    const Int n = APre.Height();
+    const Real lowerBound = subset.lowerBound;
+    const Real upperBound = subset.upperBound;
+
+    DistMatrix<F> A( APre );
+    MakeHermitian( uplo, A );
+
+    DistMatrixWriteProxy<Real,Real,VR,STAR> wProx( wPre );
+    DistMatrixWriteProxy<F,F,MC,MR> QProx( QPre );
+    auto& w = wProx.Get();
+    auto& Q = QProx.Get();
+
+    const Int p = grid.Size();
+    const Int numSlices =
+      ( sliceCtrl.numSlices > 0 ? sliceCtrl.numSlices : p );
+    const Int numGroups = Min( numSlices, p );
+    vector<unique_ptr<Grid>> grids;
+    SliceGrids( grid, numGroups, grids );
+    Int myGroup = -1;
+    for( Int group=0; group<numGroups; ++group )
+        if( grids[group]->InGrid() )
+            myGroup = group;
+    const Grid& myGrid = *grids[myGroup];
+
+    // Give each subgrid a copy of A
+    DistMatrix<F> ASub( myGrid );
+    for( Int group=0; group<numGroups; ++group )
+    {
+        if( group == myGroup )
+        {
+            ASub = A;
+        }
+        else
+        {
+            DistMatrix<F> AOther( *grids[group] );
+            AOther = A;
+        }
+    }
+    A.Empty();
+
+    // Count the eigenvalues less than or equal to each slice boundary
+    const Real width = (upperBound-lowerBound) / numSlices;
+    auto boundary = [&]( Int j )
+      { return j == numSlices ? upperBound : lowerBound + j*width; };
+    vector<Int> countLeq( numSlices+1, 0 );
+    {
+        DistMatrix<F> B( myGrid );
+        InertiaType inertia;
+        for( Int j=myGroup; j<=numSlices; j+=numGroups )
+        {
+            B = ASub;
+            ShiftDiagonal( B, F(-boundary(j)) );
+            LDLDeterminantAndInertia( LOWER, B, inertia, true );
+            countLeq[j] = inertia.numNegative + inertia.numZero;
+        }
+    }
+    mpi::AllReduce( countLeq.data(), numSlices+1, mpi::MAX, grid.Comm() );
+
+    vector<Int> sliceOffsets( numSlices+1, 0 );
+    for( Int slice=0; slice<numSlices; ++slice )
+        sliceOffsets[slice+1] =
+          sliceOffsets[slice] + countLeq[slice+1] - countLeq[slice];
+    const Int numEig = sliceOffsets[numSlices];
+    if( sliceCtrl.progress && grid.Rank() == 0 )
+        Output
+        (numEig," eigenvalues in (",lowerBound,",",upperBound,"] split over ",
+         numSlices," slices on ",numGroups," subgrids");
+
+    // Solve the slices of each subgrid and pack their eigenpairs
+    auto groupNumEig = [&]( Int group )
+      {
+          Int count = 0;
+          for( Int slice=group; slice<numSlices; slice+=numGroups )
+              count += sliceOffsets[slice+1] - sliceOffsets[slice];
+          return count;
+      };
+    DistMatrix<F> XSub( myGrid );
+    DistMatrix<Real> wSub( myGrid );
+    Zeros( XSub, n, groupNumEig(myGroup) );
+    Zeros( wSub, groupNumEig(myGroup), 1 );
+    {
+        DistMatrix<Real,STAR,STAR> wSlice( myGrid );
+        DistMatrix<F> XSlice( myGrid );
+        Int packedOffset = 0;
+        for( Int slice=myGroup; slice<numSlices; slice+=numGroups )
+        {
+            const Int sliceNumEig =
+              sliceOffsets[slice+1] - sliceOffsets[slice];
+            if( sliceNumEig == 0 )
+                continue;
+            const Real sigma = (boundary(slice)+boundary(slice+1)) / 2;
+            SliceEig( ASub, sigma, sliceNumEig, wSlice, XSlice, sliceCtrl );
+
+            const Range<Int>
+              packedInd( packedOffset, packedOffset+sliceNumEig );
+            auto XPacked = XSub( ALL, packedInd );
+            auto wPacked = wSub( packedInd, ALL );
+            XPacked = XSlice;
+            wPacked = wSlice;
+            packedOffset += sliceNumEig;
+        }
+    }
+    ASub.Empty();
+
+    // Gather the eigenpairs from each subgrid
+    Zeros( w, numEig, 1 );
+    Zeros( Q, n, numEig );
+    const bool includeViewers = true;
+    for( Int group=0; group<numGroups; ++group )
+    {
+        DistMatrix<F> XOther( *grids[group] );
+        DistMatrix<Real> wOther( *grids[group] );
+        auto& XGroup = ( group == myGroup ? XSub : XOther );
+        auto& wGroup = ( group == myGroup ? wSub : wOther );
+        XGroup.MakeConsistent( includeViewers );
+        wGroup.MakeConsistent( includeViewers );
+
+        DistMatrix<F> X( grid );
+        DistMatrix<Real> wX( grid );
+        X = XGroup;
+        wX = wGroup;
+
+        Int packedOffset = 0;
+        for( Int slice=group; slice<numSlices; slice+=numGroups )
+        {
+            const Int sliceNumEig =
+              sliceOffsets[slice+1] - sliceOffsets[slice];
+            const Range<Int>
+              packedInd( packedOffset, packedOffset+sliceNumEig );
+            const Range<Int> ind( sliceOffsets[slice], sliceOffsets[slice+1] );
+            auto QSlice = Q( ALL, ind );
+            auto wSlice = w( ind, ALL );
+            QSlice = X( ALL, packedInd );
+            wSlice = wX( packedInd, ALL );
+            packedOffset += sliceNumEig;
+        }
+    }
+}
+
+} // namespace herm_eig
+} // namespace El
+
+#endif // ifndef EL_HERMITIANEIG_SLICING_HPP
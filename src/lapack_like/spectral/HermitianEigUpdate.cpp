@@ -0,0 +1,298 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace herm_eig_update {
+
+// Overwrite (w,Z) with the eigendecomposition of
+//
+//   Z diag(w) Z^H + sigma u u^H,
+//
+// where the projected update vector z = Z^H u has already been formed. Since
+// Z is only modified through column operations, it may be an arbitrary subset
+// of the rows of the eigenvectors (e.g., the local rows of a [VC,STAR]
+// distribution).
+template<typename F>
+void RankOne
+( const Base<F>& sigma,
+  const Matrix<F>& z,
+        Matrix<Base<F>>& w,
+        Matrix<F>& Z,
+  const HermitianEigUpdateCtrl<Base<F>>& ctrl,
+        SecularEVDInfo& info )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = w.Height();
+    const Int height = Z.Height();
+    if( n == 0 || sigma == Real(0) )
+        return;
+
+    // Absorb the phases of z into the columns of Z so that the update vector
+    // is real and non-negative
+    Matrix<Real> zAbs( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        zAbs(j) = Abs(z(j));
+        if( zAbs(j) > Real(0) )
+        {
+            auto zCol = Z( ALL, IR(j) );
+            zCol *= z(j) / zAbs(j);
+        }
+    }
+    const Real zNorm = FrobeniusNorm( zAbs );
+    if( zNorm == Real(0) )
+        return;
+
+    // A negative update of diag(w) is a positive update of diag(-w), so we
+    // form
+    //
+    //   diag(d) + rho zSort zSort^T,
+    //
+    // where d = sgn(sigma) w is sorted in ascending order and
+    // || zSort ||_2 = 1.
+    const Real sgn = Sgn( sigma, false );
+    Real rho = Abs(sigma)*zNorm*zNorm;
+    Matrix<Real> d( n, 1 ), zSort( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        d(j) = sgn*w(j);
+        zSort(j) = zAbs(j) / zNorm;
+    }
+    Permutation sortPerm;
+    SortingPermutation( d, sortPerm, ASCENDING );
+    sortPerm.PermuteRows( d );
+    sortPerm.PermuteRows( zSort );
+    auto column = [&]( Int j ) { return sortPerm.Preimage(j); };
+
+    // Rescale so that the deflation tolerance is simply a multiple of eps
+    const Real scale = Max( rho, MaxNorm(d) );
+    SafeScale( Real(1), scale, d );
+    SafeScale( Real(1), scale, rho );
+    const Real eps = limits::Epsilon<Real>();
+    const Real deflationTol = ctrl.deflationFudge*eps;
+
+    // Deflate the components of the update which are sufficiently small, as
+    // well as one of each pair of sufficiently close diagonal entries (after
+    // rotating its update component into the other's), exactly as in the
+    // divide-and-conquer merges
+    vector<Int> undeflated;
+    Int revivalCandidate = -1;
+    Int numDeflated = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        if( rho*zSort(j) <= deflationTol )
+        {
+            ++numDeflated;
+            ++info.numDeflations;
+            ++info.numSmallUpdateDeflations;
+            continue;
+        }
+        if( revivalCandidate >= 0 )
+        {
+            const Real gamma = SafeNorm( zSort(j), zSort(revivalCandidate) );
+            const Real c = zSort(j) / gamma;
+            const Real s = zSort(revivalCandidate) / gamma;
+            const Real offDiagNew = c*s*(d(j)-d(revivalCandidate));
+            if( Abs(offDiagNew) <= deflationTol )
+            {
+                zSort(j) = gamma;
+                zSort(revivalCandidate) = 0;
+                const Real deltaDeflate =
+                  d(revivalCandidate)*(c*c) + d(j)*(s*s);
+                d(j) = d(j)*(c*c) + d(revivalCandidate)*(s*s);
+                d(revivalCandidate) = deltaDeflate;
+                blas::Rot
+                ( height,
+                  Z.Buffer(0,column(j)), 1,
+                  Z.Buffer(0,column(revivalCandidate)), 1,
+                  c, F(s) );
+                ++numDeflated;
+                ++info.numDeflations;
+                ++info.numCloseDiagonalDeflations;
+                revivalCandidate = j;
+                continue;
+            }
+            undeflated.push_back( revivalCandidate );
+        }
+        revivalCandidate = j;
+    }
+    if( revivalCandidate >= 0 )
+        undeflated.push_back( revivalCandidate );
+    const Int numUndeflated = undeflated.size();
+    if( ctrl.progress )
+        Output
+        ("Rank-one update deflated ",numDeflated," of ",n," eigenpairs");
+
+    if( numUndeflated > 0 )
+    {
+        Matrix<Real> dUndeflated( numUndeflated, 1 ),
+                     zUndeflated( numUndeflated, 1 );
+        for( Int t=0; t<numUndeflated; ++t )
+        {
+            dUndeflated(t) = d(undeflated[t]);
+            zUndeflated(t) = zSort(undeflated[t]);
+        }
+        const Real zUndeflatedNorm = FrobeniusNorm( zUndeflated );
+        zUndeflated *= Real(1) / zUndeflatedNorm;
+        const Real rhoUndeflated = rho*zUndeflatedNorm*zUndeflatedNorm;
+
+        Matrix<Real> wSecular, QSecular;
+        auto secularInfo =
+          SecularEVD
+          ( dUndeflated, rhoUndeflated, zUndeflated, wSecular, QSecular,
+            ctrl.secularCtrl );
+        info.numIterations += secularInfo.numIterations;
+        info.numAlternations += secularInfo.numAlternations;
+        info.numCubicIterations += secularInfo.numCubicIterations;
+        info.numCubicFailures += secularInfo.numCubicFailures;
+
+        // Apply the secular eigenvectors to the undeflated columns of Z
+        Matrix<F> ZUndeflated( height, numUndeflated ), QSecularF, ZNew;
+        for( Int t=0; t<numUndeflated; ++t )
+        {
+            auto zCol = Z( ALL, IR(column(undeflated[t])) );
+            auto zUndeflatedCol = ZUndeflated( ALL, IR(t) );
+            zUndeflatedCol = zCol;
+        }
+        Copy( QSecular, QSecularF );
+        Gemm( NORMAL, NORMAL, F(1), ZUndeflated, QSecularF, ZNew );
+        for( Int t=0; t<numUndeflated; ++t )
+        {
+            auto zCol = Z( ALL, IR(column(undeflated[t])) );
+            zCol = ZNew( ALL, IR(t) );
+            d(undeflated[t]) = wSecular(t);
+        }
+    }
+
+    // Undo the scaling and the negation and return the eigenpairs in
+    // ascending order
+    SafeScale( scale, Real(1), d );
+    for( Int j=0; j<n; ++j )
+        w(column(j)) = sgn*d(j);
+    Permutation finalPerm;
+    SortingPermutation( w, finalPerm, ASCENDING );
+    finalPerm.PermuteRows( w );
+    finalPerm.PermuteCols( Z );
+}
+
+} // namespace herm_eig_update
+
+template<typename F>
+SecularEVDInfo
+HermitianEigUpdate
+(       Matrix<Base<F>>& w,
+        Matrix<F>& Z,
+  const Matrix<F>& U,
+  const Matrix<F>& V,
+  const HermitianEigUpdateCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = Z.Height();
+    const Int k = U.Width();
+    if( Z.Width() != n || w.Height() != n || w.Width() != 1 )
+        LogicError("Z must be n x n and w must be n x 1");
+    if( U.Height() != n || V.Height() != k || V.Width() != k )
+        LogicError("U must be n x k and V must be k x k");
+
+    // Split the update into rank-one updates using the eigenvectors of V
+    Matrix<F> VCopy( V ), X, UX;
+    Matrix<Real> sigma;
+    HermitianEig( LOWER, VCopy, sigma, X );
+    Gemm( NORMAL, NORMAL, F(1), U, X, UX );
+
+    SecularEVDInfo info;
+    Matrix<F> z;
+    for( Int t=0; t<k; ++t )
+    {
+        auto u = UX( ALL, IR(t) );
+        Zeros( z, n, 1 );
+        Gemv( ADJOINT, F(1), Z, u, F(0), z );
+        herm_eig_update::RankOne( sigma(t), z, w, Z, ctrl, info );
+    }
+    return info;
+}
+
+template<typename F>
+SecularEVDInfo
+HermitianEigUpdate
+(       AbstractDistMatrix<Base<F>>& wPre,
+        AbstractDistMatrix<F>& ZPre,
+  const AbstractDistMatrix<F>& UPre,
+  const AbstractDistMatrix<F>& VPre,
+  const HermitianEigUpdateCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    DistMatrixReadWriteProxy<F,F,VC,STAR> ZProx( ZPre );
+    auto& Z = ZProx.Get();
+    DistMatrixReadWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    auto& w = wProx.Get();
+    const Grid& g = Z.Grid();
+    const Int n = Z.Height();
+    const Int k = UPre.Width();
+    if( Z.Width() != n || w.Height() != n || w.Width() != 1 )
+        LogicError("Z must be n x n and w must be n x 1");
+    if( UPre.Height() != n || VPre.Height() != k || VPre.Width() != k )
+        LogicError("U must be n x k and V must be k x k");
+
+    // The small eigenproblem for V is solved redundantly, and the local rows
+    // of U X are aligned with those of Z
+    DistMatrix<F,STAR,STAR> V_STAR_STAR( VPre );
+    Matrix<F> X;
+    Matrix<Real> sigma;
+    HermitianEig( LOWER, V_STAR_STAR.Matrix(), sigma, X );
+    DistMatrix<F,VC,STAR> U(g);
+    U.AlignWith( Z );
+    Copy( UPre, U );
+    Matrix<F> UXLoc;
+    Gemm( NORMAL, NORMAL, F(1), U.LockedMatrix(), X, UXLoc );
+
+    auto ctrlMod( ctrl );
+    ctrlMod.progress = ( ctrl.progress && g.Rank() == 0 );
+    auto& ZLoc = Z.Matrix();
+    auto& wLoc = w.Matrix();
+    SecularEVDInfo info;
+    Matrix<F> z;
+    for( Int t=0; t<k; ++t )
+    {
+        auto uLoc = UXLoc( ALL, IR(t) );
+        Zeros( z, n, 1 );
+        Gemv( ADJOINT, F(1), ZLoc, uLoc, F(0), z );
+        mpi::AllReduce( z.Buffer(), n, Z.ColComm() );
+        herm_eig_update::RankOne( sigma(t), z, wLoc, ZLoc, ctrlMod, info );
+    }
+    return info;
+}
+
+#define PROTO(F) \
+  template SecularEVDInfo HermitianEigUpdate \
+  (       Matrix<Base<F>>& w, \
+          Matrix<F>& Z, \
+    const Matrix<F>& U, \
+    const Matrix<F>& V, \
+    const HermitianEigUpdateCtrl<Base<F>>& ctrl ); \
+  template SecularEVDInfo HermitianEigUpdate \
+  (       AbstractDistMatrix<Base<F>>& w, \
+          AbstractDistMatrix<F>& Z, \
+    const AbstractDistMatrix<F>& U, \
+    const AbstractDistMatrix<F>& V, \
+    const HermitianEigUpdateCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
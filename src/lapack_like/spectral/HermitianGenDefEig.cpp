@@ -148,6 +148,188 @@ HermitianGenDefEig
     return info;
 }
 
+// Reuse the Cholesky factor of B
+// ===============================
+
+template<typename Field>
+HermitianGenDefEigSolver<Field>::HermitianGenDefEigSolver
+( Pencil pencil, UpperOrLower uplo, const AbstractDistMatrix<Field>& B )
+: pencil_(pencil), uplo_(uplo), factor_(B)
+{
+    EL_DEBUG_CSE
+    if( B.Height() != B.Width() )
+        LogicError("Hermitian matrices must be square.");
+    Cholesky( uplo_, factor_ );
+}
+
+template<typename Field>
+const DistMatrix<Field>& HermitianGenDefEigSolver<Field>::Factor() const
+{ return factor_; }
+
+template<typename Field>
+void HermitianGenDefEigSolver<Field>::ToStandard( DistMatrix<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    if( pencil_ == AXBX || pencil_ == ABX )
+    {
+        const Orientation orientation = ( uplo_==LOWER ? ADJOINT : NORMAL );
+        Trmm( LEFT, uplo_, orientation, NON_UNIT, Field(1), factor_, X );
+    }
+    else /* pencil_ == BAX */
+    {
+        const Orientation orientation = ( uplo_==LOWER ? NORMAL : ADJOINT );
+        Trsm( LEFT, uplo_, orientation, NON_UNIT, Field(1), factor_, X );
+    }
+}
+
+template<typename Field>
+void HermitianGenDefEigSolver<Field>::FromStandard( DistMatrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    if( pencil_ == AXBX || pencil_ == ABX )
+    {
+        const Orientation orientation = ( uplo_==LOWER ? ADJOINT : NORMAL );
+        Trsm( LEFT, uplo_, orientation, NON_UNIT, Field(1), factor_, Y );
+    }
+    else /* pencil_ == BAX */
+    {
+        const Orientation orientation = ( uplo_==LOWER ? NORMAL : ADJOINT );
+        Trmm( LEFT, uplo_, orientation, NON_UNIT, Field(1), factor_, Y );
+    }
+}
+
+template<typename Field>
+void HermitianGenDefEigSolver<Field>::ApplyReduced
+( const DistMatrix<Field>& A,
+  const DistMatrix<Field>& Y,
+        DistMatrix<Field>& CY ) const
+{
+    EL_DEBUG_CSE
+    // With B = L L^H, C is either inv(L) A inv(L)^H or L^H A L (and similarly
+    // for B = U^H U)
+    const Orientation inner = ( uplo_==LOWER ? ADJOINT : NORMAL );
+    const Orientation outer = ( uplo_==LOWER ? NORMAL : ADJOINT );
+    DistMatrix<Field> Z( Y );
+    if( pencil_ == AXBX )
+    {
+        Trsm( LEFT, uplo_, inner, NON_UNIT, Field(1), factor_, Z );
+        Hemm( LEFT, uplo_, Field(1), A, Z, Field(0), CY );
+        Trsm( LEFT, uplo_, outer, NON_UNIT, Field(1), factor_, CY );
+    }
+    else
+    {
+        Trmm( LEFT, uplo_, outer, NON_UNIT, Field(1), factor_, Z );
+        Hemm( LEFT, uplo_, Field(1), A, Z, Field(0), CY );
+        Trmm( LEFT, uplo_, inner, NON_UNIT, Field(1), factor_, CY );
+    }
+}
+
+template<typename Field>
+HermitianEigInfo HermitianGenDefEigSolver<Field>::Eig
+( AbstractDistMatrix<Field>& APre,
+  AbstractDistMatrix<Base<Field>>& w,
+  const HermitianEigCtrl<Field>& ctrl ) const
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    if( pencil_ == AXBX )
+        TwoSidedTrsm( uplo_, NON_UNIT, A, factor_ );
+    else
+        TwoSidedTrmm( uplo_, NON_UNIT, A, factor_ );
+    return HermitianEig( uplo_, A, w, ctrl );
+}
+
+template<typename Field>
+HermitianEigInfo HermitianGenDefEigSolver<Field>::Eig
+( AbstractDistMatrix<Field>& APre,
+  AbstractDistMatrix<Base<Field>>& w,
+  AbstractDistMatrix<Field>& XPre,
+  const HermitianEigCtrl<Field>& ctrl ) const
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> XProx( XPre );
+    auto& A = AProx.Get();
+    auto& X = XProx.Get();
+    if( pencil_ == AXBX )
+        TwoSidedTrsm( uplo_, NON_UNIT, A, factor_ );
+    else
+        TwoSidedTrmm( uplo_, NON_UNIT, A, factor_ );
+    auto info = HermitianEig( uplo_, A, w, X, ctrl );
+    FromStandard( X );
+    return info;
+}
+
+template<typename Field>
+Int HermitianGenDefEigSolver<Field>::Refine
+( const AbstractDistMatrix<Field>& APre,
+  AbstractDistMatrix<Base<Field>>& w,
+  AbstractDistMatrix<Field>& XPre,
+  const HermitianGenDefRefineCtrl<Base<Field>>& ctrl ) const
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> XProx( XPre );
+    auto& A = AProx.GetLocked();
+    auto& X = XProx.Get();
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int k = X.Width();
+    if( X.Height() != n )
+        LogicError("X must have the same height as A");
+    if( 2*k > n )
+        LogicError("Refinement requires at least twice as many rows as X");
+
+    DistMatrix<Field> Y( X ), CY(g);
+    ToStandard( Y );
+    ApplyReduced( A, Y, CY );
+
+    DistMatrix<Field> S(g), CS(g), H(g), Q(g), R(g);
+    DistMatrix<Real,STAR,STAR> wRitz(g);
+    Int numIts = 0;
+    const Int maxIts = Max( ctrl.maxIts, Int(1) );
+    while( numIts < maxIts )
+    {
+        ++numIts;
+
+        // Orthonormalize the basis [Y, C Y]
+        Zeros( S, n, 2*k );
+        auto SL = S( ALL, IR(0,k) );
+        auto SR = S( ALL, IR(k,2*k) );
+        SL = Y;
+        SR = CY;
+        qr::ExplicitUnitary( S );
+
+        // Rayleigh-Ritz on H = S^H C S
+        ApplyReduced( A, S, CS );
+        Gemm( ADJOINT, NORMAL, Field(1), S, CS, H );
+        HermitianEig( LOWER, H, wRitz, Q );
+        auto QL = Q( ALL, IR(0,k) );
+        Gemm( NORMAL, NORMAL, Field(1), S, QL, Y );
+        Gemm( NORMAL, NORMAL, Field(1), CS, QL, CY );
+
+        // R := C Y - Y diag(w)
+        auto wL = wRitz( IR(0,k), ALL );
+        R = Y;
+        DiagonalScale( RIGHT, NORMAL, wL, R );
+        R -= CY;
+        const Real residNorm = FrobeniusNorm( R );
+        const Real scale = MaxNorm( wL );
+        if( ctrl.progress )
+            OutputFromRoot
+            (g.Comm(),"Refinement iteration ",numIts,": || C Y - Y W ||_F = ",
+             residNorm,", max |w| = ",scale);
+        if( residNorm <= ctrl.tol*scale )
+            break;
+    }
+    Copy( wRitz( IR(0,k), ALL ), w );
+    X = Y;
+    FromStandard( X );
+    return numIts;
+}
+
 #define PROTO(Field) \
   template HermitianEigInfo HermitianGenDefEig \
   ( Pencil pencil, \
@@ -178,7 +360,8 @@ HermitianGenDefEig
     AbstractDistMatrix<Field>& B, \
     AbstractDistMatrix<Base<Field>>& w, \
     AbstractDistMatrix<Field>& X, \
-    const HermitianEigCtrl<Field>& ctrl );
+    const HermitianEigCtrl<Field>& ctrl ); \
+  template class HermitianGenDefEigSolver<Field>;
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
@@ -10,6 +10,7 @@
 
 #include "./HermitianTridiagEig/QR.hpp"
 #include "./HermitianTridiagEig/DivideAndConquer.hpp"
+#include "./HermitianTridiagEig/Bisection.hpp"
 
 // NOTE: dSubReal and QReal could be packed into their complex counterparts
 
@@ -379,6 +380,22 @@ LAPACKHelper
     return info;
 }
 
+template<typename Real>
+HermitianTridiagEigInfo
+BisectionHelper
+( const Matrix<Real>& d,
+  const Matrix<Real>& dSub,
+        Matrix<Real>& w,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = d.Height();
+    Matrix<Real> dSubSq( Max(n-1,Int(0)), 1 );
+    for( Int j=0; j<n-1; ++j )
+        dSubSq(j) = dSub(j)*dSub(j);
+    return Bisection( d, dSubSq, w, ctrl );
+}
+
 template<typename Real,
          typename=EnableIf<IsBlasScalar<Real>>>
 HermitianTridiagEigInfo
@@ -401,6 +418,10 @@ Helper
         auto dSubMod( dSub );
         return DCHelper( dMod, dSubMod, w, ctrl );
     }
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+    {
+        return BisectionHelper( d, dSub, w, ctrl );
+    }
     // Both d and dSub need to be modifiable
     auto dMod( d );
     auto dSubMod( dSub );
@@ -424,6 +445,10 @@ Helper
         auto dSubMod( dSub );
         return QRHelper( d, dSubMod, w, ctrl );
     }
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+    {
+        return BisectionHelper( d, dSub, w, ctrl );
+    }
     else
     {
         auto dMod( d );
@@ -565,6 +590,28 @@ DCHelper
     return info;
 }
 
+template<typename F>
+HermitianTridiagEigInfo
+BisectionHelper
+( const AbstractDistMatrix<Base<F>>& d,
+  const AbstractDistMatrix<F>& dSub,
+        AbstractDistMatrix<Base<F>>& w,
+  const HermitianTridiagEigCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = d.Height();
+    const Grid& g = d.Grid();
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d ), dSubSq(g);
+    DistMatrix<F,STAR,STAR> dSub_STAR_STAR( dSub );
+    dSubSq.Resize( Max(n-1,Int(0)), 1 );
+    for( Int j=0; j<n-1; ++j )
+        dSubSq.SetLocal
+        ( j, 0, RealPart(Conj(dSub_STAR_STAR.GetLocal(j,0))*
+                         dSub_STAR_STAR.GetLocal(j,0)) );
+    return Bisection( d_STAR_STAR, dSubSq, w, ctrl );
+}
+
 template<typename Real,
          typename=EnableIf<IsBlasScalar<Real>>>
 HermitianTridiagEigInfo
@@ -635,6 +682,10 @@ Helper
     {
         return DCHelper( d, dSub, wPre, ctrl );
     }
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+    {
+        return BisectionHelper( d, dSub, wPre, ctrl );
+    }
     else
     {
         return MRRRHelper( d, dSub, wPre, ctrl );
@@ -656,6 +707,10 @@ Helper
     {
         return QRHelper( d, dSub, w, ctrl );
     }
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+    {
+        return BisectionHelper( d, dSub, w, ctrl );
+    }
     else
     {
         return DCHelper( d, dSub, w, ctrl );
@@ -744,6 +799,10 @@ Helper
     {
         return DCHelper( d, dSub, wPre, ctrl );
     }
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+    {
+        return BisectionHelper( d, dSub, wPre, ctrl );
+    }
     else
     {
         return MRRRHelper( d, dSub, wPre, ctrl );
@@ -765,6 +824,10 @@ Helper
     {
         return QRHelper( d, dSub, w, ctrl );
     }
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+    {
+        return BisectionHelper( d, dSub, w, ctrl );
+    }
     else
     {
         return DCHelper( d, dSub, w, ctrl );
@@ -982,6 +1045,8 @@ HermitianTridiagEig
   const HermitianTridiagEigCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+        LogicError("Bisection does not compute eigenvectors");
     return herm_tridiag_eig::Helper( d, dSub, w, Q, ctrl );
 }
 
@@ -1150,6 +1215,63 @@ DCHelper
     return info;
 }
 
+// Run PMRRR through 'eig', which is handed the local eigenvalue buffer, the
+// local eigenvector buffer, its leading dimension, and the partition slack,
+// and store the resulting eigenpairs in w and Q. Q must be n x k, where k
+// bounds the number of computed eigenpairs. Without partition slack, the
+// blocks of eigenvectors computed by each process coincide with the local
+// columns of Q and are written in place; otherwise, PMRRR may move the block
+// boundaries into gaps of the spectrum and the blocks are redistributed.
+template<typename Real,typename EigFunctor>
+herm_tridiag_eig::Info
+MRRRPairs
+( DistMatrix<Real,VR,STAR>& w,
+  DistMatrix<double,STAR,VR>& Q,
+  const MRRRCtrl& ctrl,
+  EigFunctor eig )
+{
+    EL_DEBUG_CSE
+    const Int n = Q.Height();
+    const Int k = Q.Width();
+    vector<double> wVector(n);
+    if( ctrl.partitionSlack <= 0. )
+    {
+        auto rangeInfo =
+          eig( wVector.data(), Q.Buffer(), int(Q.LDim()), 0. );
+        const Int kActual = rangeInfo.numGlobalEigenvalues;
+        w.Resize( kActual, 1 );
+        Q.Resize( n, kActual );
+        for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
+            w.SetLocal( iLoc, 0, Real(wVector[iLoc]) );
+        return rangeInfo;
+    }
+
+    const int commSize = mpi::Size( w.ColComm() );
+    Matrix<double> ZLoc( n,
+      herm_tridiag_eig::MaxLocalEigenvectors
+      ( int(k), commSize, ctrl.partitionSlack ) );
+    auto rangeInfo =
+      eig( wVector.data(), ZLoc.Buffer(), int(ZLoc.LDim()),
+           ctrl.partitionSlack );
+    const Int kActual = rangeInfo.numGlobalEigenvalues;
+    const Int numLocal = rangeInfo.numLocalEigenvalues;
+    const Int first = rangeInfo.firstLocalEigenvalue;
+
+    Zeros( w, kActual, 1 );
+    Zeros( Q, n, kActual );
+    w.Reserve( numLocal );
+    Q.Reserve( n*numLocal );
+    for( Int t=0; t<numLocal; ++t )
+    {
+        w.QueueUpdate( first+t, 0, Real(wVector[t]) );
+        for( Int i=0; i<n; ++i )
+            Q.QueueUpdate( i, first+t, ZLoc(i,t) );
+    }
+    w.ProcessQueues();
+    Q.ProcessQueues();
+    return rangeInfo;
+}
+
 template<typename Real,
          typename=EnableIf<IsBlasScalar<Real>>>
 HermitianTridiagEigInfo
@@ -1202,29 +1324,28 @@ MRRRHelper
         k = n;
     Q.Resize( n, k );
 
-    herm_tridiag_eig::Info rangeInfo;
-    vector<double> wVector(n);
-    if( ctrl.subset.rangeSubset )
-        rangeInfo = herm_tridiag_eig::Eig
-          ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(),
-            wVector.data(), Q.Buffer(), Q.LDim(), w.ColComm(),
-            ctrl.subset.lowerBound, ctrl.subset.upperBound );
-    else if( ctrl.subset.indexSubset )
-        rangeInfo = herm_tridiag_eig::Eig
-          ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(),
-            wVector.data(), Q.Buffer(), Q.LDim(), w.ColComm(),
-            int(ctrl.subset.lowerIndex), int(ctrl.subset.upperIndex) );
-    else
-        rangeInfo = herm_tridiag_eig::Eig
-          ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(),
-            wVector.data(), Q.Buffer(), Q.LDim(), w.ColComm() );
-    w.Resize( rangeInfo.numGlobalEigenvalues, 1 );
-    Q.Resize( n, rangeInfo.numGlobalEigenvalues );
-    for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
-        w.SetLocal( iLoc, 0, Real(wVector[iLoc]) );
+    double* dBuf = d_STAR_STAR.Buffer();
+    double* dSubBuf = dSub_STAR_STAR.Buffer();
+    mpi::Comm comm = w.ColComm();
+    MRRRPairs( w, Q, ctrl.mrrrCtrl,
+      [&]( double* wBuf, double* ZBuf, int ldZ, double slack )
+      {
+          if( ctrl.subset.rangeSubset )
+              return herm_tridiag_eig::Eig
+                ( int(n), dBuf, dSubBuf, wBuf, ZBuf, ldZ, comm,
+                  ctrl.subset.lowerBound, ctrl.subset.upperBound, slack );
+          else if( ctrl.subset.indexSubset )
+              return herm_tridiag_eig::Eig
+                ( int(n), dBuf, dSubBuf, wBuf, ZBuf, ldZ, comm,
+                  int(ctrl.subset.lowerIndex), int(ctrl.subset.upperIndex),
+                  slack );
+          else
+              return herm_tridiag_eig::Eig
+                ( int(n), dBuf, dSubBuf, wBuf, ZBuf, ldZ, comm, slack );
+      } );
 
     auto sortPairs = TaggedSort( w, ctrl.sort );
-    for( Int j=0; j<n; ++j )
+    for( Int j=0; j<w.Height(); ++j )
         w.Set( j, 0, sortPairs[j].value );
     ApplyTaggedSortToEachRow( sortPairs, Q );
 
@@ -1290,32 +1411,28 @@ MRRRHelper
     DistMatrix<double,STAR,VR> QReal(g);
     QReal.Resize( n, k );
 
-    herm_tridiag_eig::Info rangeInfo;
-    vector<double> wVector(n);
-    if( ctrl.subset.rangeSubset )
-        rangeInfo = herm_tridiag_eig::Eig
-          ( int(n), d_STAR_STAR.Buffer(), dSubReal.Buffer(),
-            wVector.data(), QReal.Buffer(), QReal.LDim(), w.ColComm(),
-            ctrl.subset.lowerBound, ctrl.subset.upperBound );
-    else if( ctrl.subset.indexSubset )
-        rangeInfo = herm_tridiag_eig::Eig
-          ( int(n), d_STAR_STAR.Buffer(), dSubReal.Buffer(),
-            wVector.data(), QReal.Buffer(), QReal.LDim(), w.ColComm(),
-            int(ctrl.subset.lowerIndex), int(ctrl.subset.upperIndex) );
-    else
-        rangeInfo = herm_tridiag_eig::Eig
-          ( int(n), d_STAR_STAR.Buffer(), dSubReal.Buffer(),
-            wVector.data(), QReal.Buffer(), QReal.LDim(), w.ColComm() );
-
-    w.Resize( rangeInfo.numGlobalEigenvalues, 1 );
-    auto& wLoc = w.Matrix();
-    for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
-        wLoc(iLoc) = wVector[iLoc];
-
-    QReal.Resize( n, rangeInfo.numGlobalEigenvalues );
+    double* dBuf = d_STAR_STAR.Buffer();
+    double* dSubBuf = dSubReal.Buffer();
+    mpi::Comm comm = w.ColComm();
+    MRRRPairs( w, QReal, ctrl.mrrrCtrl,
+      [&]( double* wBuf, double* ZBuf, int ldZ, double slack )
+      {
+          if( ctrl.subset.rangeSubset )
+              return herm_tridiag_eig::Eig
+                ( int(n), dBuf, dSubBuf, wBuf, ZBuf, ldZ, comm,
+                  ctrl.subset.lowerBound, ctrl.subset.upperBound, slack );
+          else if( ctrl.subset.indexSubset )
+              return herm_tridiag_eig::Eig
+                ( int(n), dBuf, dSubBuf, wBuf, ZBuf, ldZ, comm,
+                  int(ctrl.subset.lowerIndex), int(ctrl.subset.upperIndex),
+                  slack );
+          else
+              return herm_tridiag_eig::Eig
+                ( int(n), dBuf, dSubBuf, wBuf, ZBuf, ldZ, comm, slack );
+      } );
 
     auto sortPairs = TaggedSort( w, ctrl.sort );
-    for( Int j=0; j<n; ++j )
+    for( Int j=0; j<w.Height(); ++j )
         w.Set( j, 0, sortPairs[j].value );
     ApplyTaggedSortToEachRow( sortPairs, QReal );
 
@@ -1431,6 +1548,8 @@ HermitianTridiagEig
   const HermitianTridiagEigCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+        LogicError("Bisection does not compute eigenvectors");
     return herm_tridiag_eig::Helper( d, dSub, w, Q, ctrl );
 }
 
@@ -1487,7 +1606,8 @@ MRRRPostEstimateHelper
         AbstractDistMatrix<Real>& QPre,
         SortType sort,
         Real vl,
-        Real vu )
+        Real vu,
+  const MRRRCtrl& mrrrCtrl )
 {
     EL_DEBUG_CSE
     HermitianTridiagEigInfo info;
@@ -1510,21 +1630,20 @@ MRRRPostEstimateHelper
     dSub_STAR_STAR.Resize( n-1, 1, n );
     Copy( dSub, dSub_STAR_STAR );
 
-    vector<double> wVector(n);
-    auto rangeInfo = herm_tridiag_eig::Eig
-    ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(), wVector.data(),
-      Q.Buffer(), Q.LDim(), w.ColComm(), vl, vu );
-    const Int k = rangeInfo.numGlobalEigenvalues;
-
-    w.Resize( k, 1 );
-    for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
-        w.SetLocal( iLoc, 0, Real(wVector[iLoc]) );
-
-    // Shrink Q
-    Q.Resize( n, k );
+    // Q is shrunk to the number of computed eigenpairs
+    double* dBuf = d_STAR_STAR.Buffer();
+    double* dSubBuf = dSub_STAR_STAR.Buffer();
+    mpi::Comm comm = w.ColComm();
+    MRRRPairs( w, Q, mrrrCtrl,
+      [&]( double* wBuf, double* ZBuf, int ldZ, double slack )
+      {
+          return herm_tridiag_eig::Eig
+            ( int(n), dBuf, dSubBuf, wBuf, ZBuf, ldZ, comm,
+              double(vl), double(vu), slack );
+      } );
 
     auto sortPairs = TaggedSort( w, sort );
-    for( Int j=0; j<n; ++j )
+    for( Int j=0; j<w.Height(); ++j )
         w.Set( j, 0, sortPairs[j].value );
     ApplyTaggedSortToEachRow( sortPairs, Q );
 
@@ -1542,7 +1661,8 @@ MRRRPostEstimateHelper
         AbstractDistMatrix<Real>& QPre,
         SortType sort,
         Real vl,
-        Real vu )
+        Real vu,
+  const MRRRCtrl& mrrrCtrl )
 {
     EL_DEBUG_CSE
     LogicError
@@ -1573,10 +1693,11 @@ MRRRPostEstimate
         AbstractDistMatrix<Real>& Q,
         SortType sort,
         Real vl,
-        Real vu )
+        Real vu,
+  const MRRRCtrl& mrrrCtrl )
 {
     EL_DEBUG_CSE
-    return MRRRPostEstimateHelper( d, dSub, w, Q, sort, vl, vu );
+    return MRRRPostEstimateHelper( d, dSub, w, Q, sort, vl, vu, mrrrCtrl );
 }
 
 } // namespace herm_tridiag_eig
@@ -1632,7 +1753,8 @@ MRRRPostEstimate
           AbstractDistMatrix<Real>& Q, \
           SortType sort, \
           Real vl, \
-          Real vu );
+          Real vu, \
+    const herm_tridiag_eig::MRRRCtrl& mrrrCtrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
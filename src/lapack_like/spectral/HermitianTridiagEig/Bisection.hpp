@@ -0,0 +1,298 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERM_TRIDIAG_EIG_BISECTION_HPP
+#define EL_HERM_TRIDIAG_EIG_BISECTION_HPP
+
+namespace El {
+namespace herm_tridiag_eig {
+
+// Eigenvalues of a symmetric tridiagonal matrix via bisection on Sturm counts
+// (cf. LAPACK's {s,d}stebz [CITATION]). The number of eigenvalues less than a
+// shift sigma is the number of negative pivots of the LDL^T factorization of
+// T - sigma I, which only requires the diagonal and the squares of the
+// subdiagonal. Since every eigenvalue is isolated independently, the indices
+// are split across processes and threads, and each thread bisects a batch of
+// indices at once so that the inner loop of the Sturm count runs over the
+// (independent) shifts of the batch.
+namespace bisect {
+
+template<typename Real>
+struct Problem
+{
+    Int n;
+    const Real* d;
+    const Real* dSubSq;
+
+    // The smallest allowed magnitude of a pivot
+    Real pivMin;
+
+    // An interval containing the spectrum
+    Real lower, upper;
+
+    // The absolute tolerance for the width of each bisection interval
+    Real absTol;
+};
+
+// Overwrite counts[k] with the number of eigenvalues less than shifts[k]
+template<typename Real>
+void SturmCounts
+( const Problem<Real>& problem,
+  Int numShifts,
+  const Real* shifts,
+        Int* counts,
+        Real* pivots )
+{
+    for( Int k=0; k<numShifts; ++k )
+    {
+        counts[k] = 0;
+        pivots[k] = 1;
+    }
+    for( Int i=0; i<problem.n; ++i )
+    {
+        const Real delta = problem.d[i];
+        const Real betaSq = ( i > 0 ? problem.dSubSq[i-1] : Real(0) );
+        for( Int k=0; k<numShifts; ++k )
+        {
+            Real pivot = (delta-shifts[k]) - betaSq/pivots[k];
+            if( Abs(pivot) < problem.pivMin )
+                pivot = -problem.pivMin;
+            counts[k] += ( pivot < Real(0) );
+            pivots[k] = pivot;
+        }
+    }
+}
+
+// Compute the eigenvalues with (zero-based) indices in [beg,end)
+template<typename Real>
+void Eigenvalues
+( const Problem<Real>& problem, Int beg, Int end, Real* w, Int batchSize )
+{
+    EL_DEBUG_CSE
+    const Real eps = limits::Epsilon<Real>();
+
+    // The number of halvings needed to shrink the initial interval to the
+    // absolute tolerance (which is bounded in case the tolerance is zero)
+    Int maxIts = 2;
+    const Int maxItsBound = 4*NumMantissaBits<Real>();
+    for( Real width=problem.upper-problem.lower;
+         width > problem.absTol && maxIts < maxItsBound; width /= 2 )
+        ++maxIts;
+
+    vector<Real> lowers(batchSize), uppers(batchSize), shifts(batchSize),
+      pivots(batchSize);
+    vector<Int> indices(batchSize), counts(batchSize);
+    for( Int batchBeg=beg; batchBeg<end; batchBeg+=batchSize )
+    {
+        const Int batchEnd = Min( batchBeg+batchSize, end );
+        Int numActive = batchEnd - batchBeg;
+        for( Int k=0; k<numActive; ++k )
+        {
+            indices[k] = batchBeg + k;
+            lowers[k] = problem.lower;
+            uppers[k] = problem.upper;
+        }
+
+        for( Int it=0; it<maxIts && numActive>0; ++it )
+        {
+            for( Int k=0; k<numActive; ++k )
+                shifts[k] = (lowers[k]+uppers[k])/2;
+            SturmCounts
+            ( problem, numActive, shifts.data(), counts.data(),
+              pivots.data() );
+
+            // Eigenvalue j lies below the shift if and only if more than j
+            // eigenvalues do
+            Int numStillActive = 0;
+            for( Int k=0; k<numActive; ++k )
+            {
+                if( counts[k] > indices[k] )
+                    uppers[k] = shifts[k];
+                else
+                    lowers[k] = shifts[k];
+
+                const Real tol =
+                  Max( problem.absTol,
+                       2*eps*Max(Abs(lowers[k]),Abs(uppers[k])) );
+                if( uppers[k]-lowers[k] <= tol )
+                {
+                    w[indices[k]-beg] = (lowers[k]+uppers[k])/2;
+                    continue;
+                }
+                indices[numStillActive] = indices[k];
+                lowers[numStillActive] = lowers[k];
+                uppers[numStillActive] = uppers[k];
+                ++numStillActive;
+            }
+            numActive = numStillActive;
+        }
+        for( Int k=0; k<numActive; ++k )
+            w[indices[k]-beg] = (lowers[k]+uppers[k])/2;
+    }
+}
+
+// Form the problem description and the index range [beg,end) requested by
+// the subset of the control structure
+template<typename Real>
+void Setup
+( const Matrix<Real>& d,
+  const Matrix<Real>& dSubSq,
+  const HermitianTridiagEigCtrl<Real>& ctrl,
+        Problem<Real>& problem,
+        Int& beg,
+        Int& end )
+{
+    EL_DEBUG_CSE
+    const Int n = d.Height();
+    const Real eps = limits::Epsilon<Real>();
+    problem.n = n;
+    problem.d = d.LockedBuffer();
+    problem.dSubSq = dSubSq.LockedBuffer();
+
+    // Gershgorin bounds for the spectrum
+    Real maxBetaSq = 1;
+    problem.lower = problem.upper = ( n > 0 ? d(0) : Real(0) );
+    for( Int i=0; i<n; ++i )
+    {
+        Real radius = 0;
+        if( i > 0 )
+            radius += Sqrt(dSubSq(i-1));
+        if( i < n-1 )
+        {
+            radius += Sqrt(dSubSq(i));
+            maxBetaSq = Max( maxBetaSq, dSubSq(i) );
+        }
+        problem.lower = Min( problem.lower, d(i)-radius );
+        problem.upper = Max( problem.upper, d(i)+radius );
+    }
+    problem.pivMin = limits::SafeMin<Real>()*maxBetaSq;
+    const Real norm = Max( Abs(problem.lower), Abs(problem.upper) );
+    const Real pad = 2*n*eps*norm + 4*problem.pivMin;
+    problem.lower -= pad;
+    problem.upper += pad;
+    problem.absTol =
+      ( ctrl.bisectCtrl.absTol > Real(0) ? ctrl.bisectCtrl.absTol : eps*norm );
+
+    if( ctrl.subset.indexSubset )
+    {
+        beg = ctrl.subset.lowerIndex;
+        end = ctrl.subset.upperIndex+1;
+    }
+    else if( ctrl.subset.rangeSubset )
+    {
+        // The eigenvalues in (lowerBound,upperBound] are those whose indices
+        // lie between the Sturm counts of the two bounds
+        const Real shifts[2] =
+          { Max(ctrl.subset.lowerBound,problem.lower),
+            Min(ctrl.subset.upperBound,problem.upper) };
+        Int counts[2];
+        Real pivots[2];
+        SturmCounts( problem, 2, shifts, counts, pivots );
+        beg = counts[0];
+        end = Max( counts[1], beg );
+    }
+    else
+    {
+        beg = 0;
+        end = n;
+    }
+}
+
+// Compute the eigenvalues with indices in [beg,end) using the requested
+// number of threads
+template<typename Real>
+void Eigenvalues
+( const Problem<Real>& problem,
+  Int beg,
+  Int end,
+  Real* w,
+  const BisectionCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = Max( ctrl.batchSize, Int(1) );
+    const Int numEig = end - beg;
+    if( ctrl.numThreads == 1 || numEig <= batchSize )
+    {
+        Eigenvalues( problem, beg, end, w, batchSize );
+        return;
+    }
+
+    TaskGraph graph;
+    for( Int batchBeg=beg; batchBeg<end; batchBeg+=batchSize )
+    {
+        const Int batchEnd = Min( batchBeg+batchSize, end );
+        Real* wBatch = &w[batchBeg-beg];
+        auto task = [&problem,batchBeg,batchEnd,wBatch,batchSize]()
+        { Eigenvalues( problem, batchBeg, batchEnd, wBatch, batchSize ); };
+        graph.Insert( task, {problem.d,problem.dSubSq}, {wBatch} );
+    }
+    graph.Execute( ctrl.numThreads );
+}
+
+} // namespace bisect
+
+template<typename Real>
+HermitianTridiagEigInfo
+Bisection
+( const Matrix<Real>& d,
+  const Matrix<Real>& dSubSq,
+        Matrix<Real>& w,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    HermitianTridiagEigInfo info;
+    bisect::Problem<Real> problem;
+    Int beg, end;
+    bisect::Setup( d, dSubSq, ctrl, problem, beg, end );
+    w.Resize( end-beg, 1 );
+    bisect::Eigenvalues( problem, beg, end, w.Buffer(), ctrl.bisectCtrl );
+    if( ctrl.sort == DESCENDING )
+        Sort( w, ctrl.sort );
+    return info;
+}
+
+// Each process computes a contiguous block of the requested eigenvalues
+// before they are combined with a summation over the grid
+template<typename Real>
+HermitianTridiagEigInfo
+Bisection
+( const DistMatrix<Real,STAR,STAR>& d,
+  const DistMatrix<Real,STAR,STAR>& dSubSq,
+        AbstractDistMatrix<Real>& w,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    HermitianTridiagEigInfo info;
+    bisect::Problem<Real> problem;
+    Int beg, end;
+    bisect::Setup
+    ( d.LockedMatrix(), dSubSq.LockedMatrix(), ctrl, problem, beg, end );
+
+    const Grid& g = d.Grid();
+    const Int numEig = end - beg;
+    const Int numProcs = g.Size();
+    const Int rank = g.VCRank();
+    const Int localBeg = beg + (rank*numEig)/numProcs;
+    const Int localEnd = beg + ((rank+1)*numEig)/numProcs;
+
+    DistMatrix<Real,STAR,STAR> w_STAR_STAR(g);
+    Zeros( w_STAR_STAR, numEig, 1 );
+    bisect::Eigenvalues
+    ( problem, localBeg, localEnd,
+      w_STAR_STAR.Buffer()+(localBeg-beg), ctrl.bisectCtrl );
+    mpi::AllReduce( w_STAR_STAR.Buffer(), numEig, g.VCComm() );
+    if( ctrl.sort == DESCENDING )
+        Sort( w_STAR_STAR, ctrl.sort );
+    Copy( w_STAR_STAR, w );
+    return info;
+}
+
+} // namespace herm_tridiag_eig
+} // namespace El
+
+#endif // ifndef EL_HERM_TRIDIAG_EIG_BISECTION_HPP
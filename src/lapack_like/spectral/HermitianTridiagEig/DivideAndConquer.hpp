@@ -11,11 +11,96 @@
 
 // TODO(poulson): Move said routine into a utility function
 #include "../Schur/SDC.hpp"
-using El::schur::SplitGrid;
 
 namespace El {
 namespace herm_tridiag_eig {
 
+// Solve the secular equation for each of the columns of QSecular, where
+// column jLoc corresponds to the undeflated index firstCol + jLoc*colStride,
+// storing the eigenvalue in dSecular(jLoc) and the negated shifts in the
+// column. The contributions of these columns to the (unsigned) corrected
+// update vector are multiplied into rCorrected.
+//
+// The solves are batched through SecularEigenvalues, and the products
+// forming rCorrected are then computed one row at a time so that no two
+// threads update the same entry.
+template<typename Real>
+void SolveSecularColumns
+( const Matrix<Real>& dUndeflated,
+  const Matrix<Real>& zUndeflated,
+  const Real& rho,
+        Matrix<Real>& dSecular,
+        Matrix<Real>& QSecular,
+        Int firstCol,
+        Int colStride,
+        Matrix<Real>& rCorrected,
+        SecularEVDInfo& secularInfo,
+  const SecularEVDCtrl<Real>& secularCtrl,
+  bool progress )
+{
+    EL_DEBUG_CSE
+    const Int numUndeflated = QSecular.Height();
+    const Int numLocal = QSecular.Width();
+
+    auto batchInfo =
+      SecularEigenvalues
+      ( firstCol, colStride, numLocal, dUndeflated, rho, zUndeflated,
+        dSecular, QSecular, secularCtrl );
+    secularInfo.numIterations += batchInfo.numIterations;
+    secularInfo.numAlternations += batchInfo.numAlternations;
+    secularInfo.numCubicIterations += batchInfo.numCubicIterations;
+    secularInfo.numCubicFailures += batchInfo.numCubicFailures;
+    if( progress )
+        for( Int jLoc=0; jLoc<numLocal; ++jLoc )
+            Output
+            ("Secular eigenvalue ",firstCol+jLoc*colStride," is ",
+             dSecular(jLoc));
+
+    EL_PARALLEL_FOR_GRAIN(numLocal*numUndeflated)
+    for( Int k=0; k<numUndeflated; ++k )
+    {
+        Real product = rCorrected(k);
+        for( Int jLoc=0; jLoc<numLocal; ++jLoc )
+        {
+            const Int j = firstCol + jLoc*colStride;
+            if( j == k )
+                product *= QSecular(k,jLoc);
+            else
+                product *=
+                  QSecular(k,jLoc) / (dUndeflated(j)-dUndeflated(k));
+        }
+        rCorrected(k) = product;
+    }
+}
+
+// Overwrite each column of QSecular, which holds the negated shifts of the
+// secular equation, with the unnormalized eigenvector r ./ q, and store the
+// normalized eigenvector, with its rows permuted by the inverse of the
+// packing permutation, in the corresponding column of U.
+template<typename Real>
+void FormSecularEigenvectors
+( const Matrix<Real>& rCorrected,
+  const Permutation& packingPerm,
+        Matrix<Real>& QSecular,
+        Matrix<Real>& U )
+{
+    EL_DEBUG_CSE
+    const Int numUndeflated = QSecular.Height();
+    const Int numLocal = QSecular.Width();
+    EL_PARALLEL_FOR_GRAIN(numLocal*numUndeflated)
+    for( Int jLoc=0; jLoc<numLocal; ++jLoc )
+    {
+        auto q = QSecular(ALL,IR(jLoc));
+        for( Int i=0; i<numUndeflated; ++i )
+            q(i) = rCorrected(i) / q(i);
+
+        auto u = U(ALL,IR(jLoc));
+        const Real qFrob = FrobeniusNorm( q );
+        for( Int i=0; i<numUndeflated; ++i )
+            u(i) = q(packingPerm.Preimage(i)) / qFrob;
+    }
+}
+
 // The following is analogous to LAPACK's {s,d}laed{1,2,3} [CITATION] but does
 // not accept initial sorting permutations for w0 and w1, nor does it enforce
 // any ordering on the resulting eigenvalues.
@@ -431,59 +516,24 @@ Merge
     else
         QSecular.Resize( numUndeflated, numUndeflated );
 
-    for( Int j=0; j<numUndeflated; ++j )
-    {
-        auto minusShift = QSecular( ALL, IR(j) );
-
-        auto valueInfo =
-          SecularEigenvalue
-          ( j, dUndeflated, rho, zUndeflated, d(j), minusShift,
-            dcCtrl.secularCtrl );
-        if( ctrl.progress )
-            Output("Secular eigenvalue ",j," is ",d(j));
-
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
-        {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
-        }
-    }
+    auto dSecular = d( undeflatedInd, ALL );
+    SolveSecularColumns
+    ( dUndeflated, zUndeflated, rho, dSecular, QSecular,
+      0, 1, rCorrected, secularInfo,
+      dcCtrl.secularCtrl, ctrl.progress );
     for( Int j=0; j<numUndeflated; ++j )
         rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
 
-    // Compute the unnormalized eigenvectors.
-    if( ctrl.progress )
-        Output("Computing unnormalized eigenvectors");
-    for( Int j=0; j<numUndeflated; ++j )
-    {
-        auto q = QSecular(ALL,IR(j));
-        for( Int i=0; i<numUndeflated; ++i )
-            q(i) = rCorrected(i) / q(i);
-    }
-
-    // Form the normalized right singular vectors with the rows permuted by
-    // the inverse of the packing permutation in U. This allows the product
-    // of QPacked with U to be equal to the unpacked Q times the eigenvectors
-    // from the secular equation.
+    // Compute the unnormalized eigenvectors and then form the normalized
+    // right singular vectors with the rows permuted by the inverse of the
+    // packing permutation in U. This allows the product of QPacked with U to
+    // be equal to the unpacked Q times the eigenvectors from the secular
+    // equation.
     Matrix<Real> U;
     if( ctrl.progress )
         Output("Forming undeflated right singular vectors");
     U.Resize( numUndeflated, numUndeflated );
-    for( Int j=0; j<numUndeflated; ++j )
-    {
-        auto q = QSecular(ALL,IR(j));
-        auto u = U(ALL,IR(j));
-        const Real qFrob = FrobeniusNorm( q );
-        for( Int i=0; i<numUndeflated; ++i )
-            u(i) = q(packingPerm.Preimage(i)) / qFrob;
-    }
+    FormSecularEigenvectors( rCorrected, packingPerm, QSecular, U );
     // Overwrite the first 'numUndeflated' columns of Q with the updated
     // eigenvectors by exploiting the partitioning of Z = QPacked as
     //
@@ -973,33 +1023,13 @@ Merge
     auto& dSecularLoc = dSecular.Matrix();
     auto& QSecularLoc = QSecular.Matrix();
 
-    const Int numUndeflatedLoc = QSecularLoc.Width();
-    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
-    {
-        const Int j = QSecular.GlobalCol(jLoc);
-        auto minusShift = QSecularLoc( ALL, IR(jLoc) );
-
-        auto valueInfo =
-          SecularEigenvalue
-          ( j, dUndeflated, rho, zUndeflated, dSecularLoc(jLoc),
-            minusShift, dcCtrl.secularCtrl );
-        if( ctrl.progress && amRoot )
-            Output("Secular eigenvalue ",j," is ",dSecularLoc(jLoc));
-
-        // We will sum these across all of the processors at the top-level
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
-        {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
-        }
-    }
+    // Each process solves for its local columns (as a threaded batch), and
+    // we will sum the iteration counts across all of the
+    // processors at the top-level
+    SolveSecularColumns
+    ( dUndeflated, zUndeflated, rho, dSecularLoc, QSecularLoc,
+      QSecular.RowShift(), QSecular.RowStride(), rCorrected, secularInfo,
+      dcCtrl.secularCtrl, ctrl.progress && amRoot );
     AllReduce( rCorrected, g.VRComm(), mpi::PROD );
     for( Int j=0; j<numUndeflated; ++j )
         rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
@@ -1009,34 +1039,15 @@ Merge
         wUndeflated = dSecular;
     }
 
-    // Compute the unnormalized eigenvectors.
-    if( ctrl.progress && amRoot )
-        Output("Computing unnormalized eigenvectors");
-    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
-    {
-        auto q = QSecularLoc(ALL,IR(jLoc));
-        for( Int i=0; i<numUndeflated; ++i )
-            q(i) = rCorrected(i) / q(i);
-    }
-
-
-    // Form the normalized eigenvectors with the rows permuted by
-    // the inverse of the packing permutation in U. This allows the product
-    // of QPacked with U to be equal to the unpacked Q times the eigenvectors
-    // from the secular equation.
+    // Compute the unnormalized eigenvectors and then form the normalized
+    // eigenvectors with the rows permuted by the inverse of the packing
+    // permutation in U. This allows the product of QPacked with U to be equal
+    // to the unpacked Q times the eigenvectors from the secular equation.
     if( ctrl.progress && amRoot )
         Output("Forming undeflated right singular vectors");
     DistMatrix<Real,STAR,VR> U(g);
     U.Resize( numUndeflated, numUndeflated );
-    auto& ULoc = U.Matrix();
-    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
-    {
-        auto q = QSecularLoc(ALL,IR(jLoc));
-        auto u = ULoc(ALL,IR(jLoc));
-        const Real qFrob = FrobeniusNorm( q );
-        for( Int i=0; i<numUndeflated; ++i )
-            u(i) = q(packingPerm.Preimage(i)) / qFrob;
-    }
+    FormSecularEigenvectors( rCorrected, packingPerm, QSecularLoc, U.Matrix() );
     // Overwrite the first 'numUndeflated' columns of Q with the updated
     // eigenvectors by exploiting the partitioning of Z = QPacked as
     //
@@ -1334,7 +1345,7 @@ DivideAndConquer
     // TODO(poulson): A more intelligent split point.
     const Int split = (n/2) + 1;
     const Grid *leftGrid, *rightGrid;
-    SplitGrid( split, n-split, grid, leftGrid, rightGrid );
+    schur::SplitGrid( split, n-split, grid, leftGrid, rightGrid );
     const Real& beta = superDiag(split-1);
 
     auto mainDiag0 = mainDiag( IR(0,split), ALL );
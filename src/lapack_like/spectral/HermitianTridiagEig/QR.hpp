@@ -94,7 +94,8 @@ void QLSweep
   Matrix<Base<Field>>& e,
   Matrix<Base<Field>>& cList,
   Matrix<Base<Field>>& sList,
-  Matrix<Field>& Q,
+  GivensSequenceQueue<Field>& QQueue,
+  Int offset,
   const Base<Field>& shift,
   bool wantEigVecs )
 {
@@ -136,8 +137,7 @@ void QLSweep
     e(0) = g;
     if( wantEigVecs )
     {
-        ApplyGivensSequence
-        ( RIGHT, VARIABLE_GIVENS_SEQUENCE, BACKWARD, cList, sList, Q );
+        QQueue.Push( BACKWARD, offset, cList, sList );
     }
 }
 
@@ -147,7 +147,8 @@ void QRSweep
   Matrix<Base<Field>>& e,
   Matrix<Base<Field>>& cList,
   Matrix<Base<Field>>& sList,
-  Matrix<Field>& Q,
+  GivensSequenceQueue<Field>& QQueue,
+  Int offset,
   const Base<Field>& shift,
   bool wantEigVecs )
 {
@@ -186,8 +187,7 @@ void QRSweep
     e(n-2) = g;
     if( wantEigVecs )
     {
-        ApplyGivensSequence
-        ( RIGHT, VARIABLE_GIVENS_SEQUENCE, FORWARD, cList, sList, Q );
+        QQueue.Push( FORWARD, offset, cList, sList );
     }
 }
 
@@ -208,7 +208,6 @@ Helper
     EL_DEBUG_CSE
     typedef Base<Field> Real;
     const Int n = d.Height();
-    const Int mQ = Q.Height();
     herm_tridiag_eig::QRInfo info;
 
     if( n <= 1 )
@@ -226,7 +225,8 @@ Helper
 
     Matrix<Real> cList(n-1,1), sList(n-1,1);
     Matrix<Real> dSub, eSub;
-    Matrix<Field> QSub;
+    // The sweeps are only applied to Q in batches (see GivensSequenceQueue)
+    GivensSequenceQueue<Field> QQueue( Q );
 
     const Int maxIter = n*ctrl.qrCtrl.maxIterPerEig;
     Int winBeg = 0;
@@ -343,8 +343,7 @@ Helper
                           lambda0, lambda1, c, s,
                           ctrl.qrCtrl.fullAccuracyTwoByTwo );
                         // Apply the Givens rotation from the right to Q
-                        blas::Rot
-                        ( mQ, &Q(0,subWinBeg), 1, &Q(0,subWinBeg+1), 1, c, s );
+                        QQueue.PushRotation( subWinBeg, c, s );
                     }
                     else
                     {
@@ -372,14 +371,11 @@ Helper
                 // of these views
                 View( dSub, d, IR(subWinBeg,iterEnd), ALL );
                 View( eSub, e, IR(subWinBeg,Min(iterEnd,n-1)), ALL );
-                if( ctrl.wantEigVecs )
-                {
-                    View( QSub, Q, ALL, IR(subWinBeg,iterEnd) );
-                }
 
                 Real shift = WilkinsonShift( dSub(0), eSub(0), dSub(1) );
                 QLSweep
-                ( dSub, eSub, cList, sList, QSub, shift, ctrl.wantEigVecs );
+                ( dSub, eSub, cList, sList, QQueue, subWinBeg, shift,
+                  ctrl.wantEigVecs );
             }
         }
         else
@@ -437,9 +433,7 @@ Helper
                           lambda0, lambda1, c, s,
                           ctrl.qrCtrl.fullAccuracyTwoByTwo );
                         // Apply the Givens rotation from the right to Q
-                        blas::Rot
-                        ( mQ, &Q(0,subWinEnd-2), 1, &Q(0,subWinEnd-1), 1,
-                          c, s );
+                        QQueue.PushRotation( subWinEnd-2, c, s );
                     }
                     else
                     {
@@ -467,16 +461,13 @@ Helper
                 // of these views
                 View( dSub, d, IR(iterBeg,subWinEnd), ALL );
                 View( eSub, e, IR(iterBeg,Min(subWinEnd,n-1)), ALL );
-                if( ctrl.wantEigVecs )
-                {
-                    View( QSub, Q, ALL, IR(iterBeg,subWinEnd) );
-                }
 
                 Real shift =
                   WilkinsonShift
                   ( d(subWinEnd-1), e(subWinEnd-2), d(subWinEnd-2) );
                 QRSweep
-                ( dSub, eSub, cList, sList, QSub, shift, ctrl.wantEigVecs );
+                ( dSub, eSub, cList, sList, QQueue, iterBeg, shift,
+                  ctrl.wantEigVecs );
             }
         }
 
@@ -490,6 +481,7 @@ Helper
         }
         if( info.numIterations >= maxIter )
         {
+            QQueue.Flush();
             for( Int i=0; i<n-1; ++i )
                 if( e(i) != zero )
                     ++info.numUnconverged;
@@ -499,6 +491,7 @@ Helper
             return info;
         }
     }
+    QQueue.Flush();
 
     return info;
 }
@@ -0,0 +1,222 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./HessenbergQZ/Simple.hpp"
+#include "./HessenbergQZ/AED.hpp"
+
+namespace El {
+
+template<typename F>
+HessenbergQZInfo
+HessenbergQZ
+( Matrix<F>& H,
+  Matrix<F>& T,
+  Matrix<F>& alpha,
+  Matrix<F>& beta,
+  Matrix<F>& Q,
+  Matrix<F>& Z,
+  const HessenbergQZCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = H.Height();
+    if( H.Width() != n || T.Height() != n || T.Width() != n )
+        LogicError("H and T must be square and of the same size");
+    auto ctrlMod( ctrl );
+    ctrlMod.winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    ctrlMod.winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+    ctrlMod.wantSchurVecs = true;
+    if( !ctrl.accumulateSchurVecs )
+    {
+        Identity( Q, n, n );
+        Identity( Z, n, n );
+        ctrlMod.accumulateSchurVecs = true;
+    }
+
+    if( ctrl.alg == HESSENBERG_QZ_AED )
+    {
+        return hess_qz::AED( H, T, alpha, beta, Q, Z, ctrlMod );
+    }
+    else
+    {
+        return hess_qz::Simple( H, T, alpha, beta, Q, Z, ctrlMod );
+    }
+}
+
+template<typename F>
+HessenbergQZInfo
+HessenbergQZ
+( Matrix<F>& H,
+  Matrix<F>& T,
+  Matrix<F>& alpha,
+  Matrix<F>& beta,
+  const HessenbergQZCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = H.Height();
+    if( H.Width() != n || T.Height() != n || T.Width() != n )
+        LogicError("H and T must be square and of the same size");
+    auto ctrlMod( ctrl );
+    ctrlMod.winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    ctrlMod.winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+    ctrlMod.wantSchurVecs = false;
+
+    Matrix<F> Q, Z;
+    if( ctrl.alg == HESSENBERG_QZ_AED )
+    {
+        return hess_qz::AED( H, T, alpha, beta, Q, Z, ctrlMod );
+    }
+    else
+    {
+        return hess_qz::Simple( H, T, alpha, beta, Q, Z, ctrlMod );
+    }
+}
+
+namespace hess_qz {
+
+// Since the QZ iteration is dominated by sequences of rotations, each process
+// redundantly iterates on its own copy of the pencil and only accumulates the
+// rotations (and the Gemm updates of the block transformations) into its
+// local rows of the Schur vectors.
+template<typename F>
+HessenbergQZInfo
+Redundant
+( AbstractDistMatrix<F>& HPre,
+  AbstractDistMatrix<F>& TPre,
+  AbstractDistMatrix<F>& alphaPre,
+  AbstractDistMatrix<F>& betaPre,
+  DistMatrix<F,VC,STAR>& Q,
+  DistMatrix<F,VC,STAR>& Z,
+  const HessenbergQZCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,STAR,STAR> HProx( HPre ), TProx( TPre );
+    auto& H = HProx.Get();
+    auto& T = TProx.Get();
+    const Int n = H.Height();
+    if( H.Width() != n || T.Height() != n || T.Width() != n )
+        LogicError("H and T must be square and of the same size");
+
+    alphaPre.Resize( n, 1 );
+    betaPre.Resize( n, 1 );
+    DistMatrixWriteProxy<F,F,STAR,STAR> alphaProx( alphaPre ),
+      betaProx( betaPre );
+    auto& alpha = alphaProx.Get();
+    auto& beta = betaProx.Get();
+
+    auto ctrlMod( ctrl );
+    ctrlMod.progress = ( ctrl.progress && H.Grid().Rank() == 0 );
+    if( ctrl.alg == HESSENBERG_QZ_AED )
+    {
+        return AED
+        ( H.Matrix(), T.Matrix(), alpha.Matrix(), beta.Matrix(),
+          Q.Matrix(), Z.Matrix(), ctrlMod );
+    }
+    else
+    {
+        return Simple
+        ( H.Matrix(), T.Matrix(), alpha.Matrix(), beta.Matrix(),
+          Q.Matrix(), Z.Matrix(), ctrlMod );
+    }
+}
+
+} // namespace hess_qz
+
+template<typename F>
+HessenbergQZInfo
+HessenbergQZ
+( AbstractDistMatrix<F>& H,
+  AbstractDistMatrix<F>& T,
+  AbstractDistMatrix<F>& alpha,
+  AbstractDistMatrix<F>& beta,
+  AbstractDistMatrix<F>& QPre,
+  AbstractDistMatrix<F>& ZPre,
+  const HessenbergQZCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    // Technically, the 'Read' portion of the proxies is only needed if
+    // ctrl.accumulateSchurVecs is true.
+    DistMatrixReadWriteProxy<F,F,VC,STAR> QProx( QPre ), ZProx( ZPre );
+    auto& Q = QProx.Get();
+    auto& Z = ZProx.Get();
+
+    const Int n = H.Height();
+    auto ctrlMod( ctrl );
+    ctrlMod.winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    ctrlMod.winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+    ctrlMod.wantSchurVecs = true;
+    if( !ctrl.accumulateSchurVecs )
+    {
+        Identity( Q, n, n );
+        Identity( Z, n, n );
+        ctrlMod.accumulateSchurVecs = true;
+    }
+
+    return hess_qz::Redundant( H, T, alpha, beta, Q, Z, ctrlMod );
+}
+
+template<typename F>
+HessenbergQZInfo
+HessenbergQZ
+( AbstractDistMatrix<F>& H,
+  AbstractDistMatrix<F>& T,
+  AbstractDistMatrix<F>& alpha,
+  AbstractDistMatrix<F>& beta,
+  const HessenbergQZCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = H.Height();
+    auto ctrlMod( ctrl );
+    ctrlMod.winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    ctrlMod.winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+    ctrlMod.wantSchurVecs = false;
+
+    DistMatrix<F,VC,STAR> Q(H.Grid()), Z(H.Grid());
+    return hess_qz::Redundant( H, T, alpha, beta, Q, Z, ctrlMod );
+}
+
+#define PROTO(F) \
+  template HessenbergQZInfo HessenbergQZ \
+  ( Matrix<F>& H, \
+    Matrix<F>& T, \
+    Matrix<F>& alpha, \
+    Matrix<F>& beta, \
+    const HessenbergQZCtrl& ctrl ); \
+  template HessenbergQZInfo HessenbergQZ \
+  ( AbstractDistMatrix<F>& H, \
+    AbstractDistMatrix<F>& T, \
+    AbstractDistMatrix<F>& alpha, \
+    AbstractDistMatrix<F>& beta, \
+    const HessenbergQZCtrl& ctrl ); \
+  template HessenbergQZInfo HessenbergQZ \
+  ( Matrix<F>& H, \
+    Matrix<F>& T, \
+    Matrix<F>& alpha, \
+    Matrix<F>& beta, \
+    Matrix<F>& Q, \
+    Matrix<F>& Z, \
+    const HessenbergQZCtrl& ctrl ); \
+  template HessenbergQZInfo HessenbergQZ \
+  ( AbstractDistMatrix<F>& H, \
+    AbstractDistMatrix<F>& T, \
+    AbstractDistMatrix<F>& alpha, \
+    AbstractDistMatrix<F>& beta, \
+    AbstractDistMatrix<F>& Q, \
+    AbstractDistMatrix<F>& Z, \
+    const HessenbergQZCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_REAL_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
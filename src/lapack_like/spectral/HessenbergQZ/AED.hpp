@@ -0,0 +1,416 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HESS_QZ_AED_HPP
+#define EL_HESS_QZ_AED_HPP
+
+#include "./Util.hpp"
+#include "./Simple.hpp"
+#include "./Sweep.hpp"
+
+namespace El {
+namespace hess_qz {
+
+// Forward declaration for the recursive AED calls
+template<typename F>
+HessenbergQZInfo
+AED
+( Matrix<F>& H,
+  Matrix<F>& T,
+  Matrix<F>& alpha,
+  Matrix<F>& beta,
+  Matrix<F>& Q,
+  Matrix<F>& Z,
+  const HessenbergQZCtrl& ctrl,
+  Int recursionLevel=0 );
+
+// Attempt to deflate eigenvalues from the trailing deflationSize x
+// deflationSize window of the unreduced block [activeBeg,activeLast] by
+// computing the generalized Schur form of the window and testing the
+// components of the resulting spike. The eigenvalues which could not be
+// deflated are moved to the top of the window and returned in
+// alpha(activeLast-numUndeflated-numDeflated+1 : activeLast-numDeflated) so
+// that they may be used as shifts, and the window is returned to
+// Hessenberg-triangular form by reflecting the spike back and chasing the
+// resulting bulges off the bottom of the undeflated portion. This is a
+// translation of LAPACK's zlaqz2.
+template<typename F>
+void AggressiveDeflation
+( Int activeBeg,
+  Int activeLast,
+  Int deflationSize,
+  Matrix<F>& H,
+  Matrix<F>& T,
+  Matrix<F>& alpha,
+  Matrix<F>& beta,
+  Matrix<F>& Q,
+  Matrix<F>& Z,
+  const HessenbergQZCtrl& ctrl,
+  Int recursionLevel,
+  Int& numUndeflated,
+  Int& numDeflated )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = H.Height();
+    const Real safeMin = limits::SafeMin<Real>();
+    const Real ulp = limits::Precision<Real>();
+    const Real smallNum = safeMin*(Real(n)/ulp);
+
+    const Int winSize = Min( deflationSize, activeLast-activeBeg+1 );
+    const Int winBeg = activeLast-winSize+1;
+    const bool haveSpike = ( winBeg > activeBeg );
+    const F spike = ( haveSpike ? H(winBeg,winBeg-1) : F(0) );
+
+    if( winSize == 1 )
+    {
+        alpha(winBeg) = H(winBeg,winBeg);
+        beta(winBeg) = T(winBeg,winBeg);
+        if( Abs(spike) <= Max( smallNum, ulp*Abs(H(winBeg,winBeg)) ) )
+        {
+            numUndeflated = 0;
+            numDeflated = 1;
+            if( haveSpike )
+                H(winBeg,winBeg-1) = 0;
+        }
+        else
+        {
+            numUndeflated = 1;
+            numDeflated = 0;
+        }
+        return;
+    }
+
+    // Compute the generalized Schur form of the window, but keep a copy in
+    // case of a convergence failure
+    auto winInd = IR(winBeg,activeLast+1);
+    auto HWin = H( winInd, winInd );
+    auto TWin = T( winInd, winInd );
+    Matrix<F> HWinSave( HWin ), TWinSave( TWin );
+    Matrix<F> QWin, ZWin;
+    Identity( QWin, winSize, winSize );
+    Identity( ZWin, winSize, winSize );
+    Matrix<F> alphaWin, betaWin;
+    auto winCtrl( ctrl );
+    winCtrl.winBeg = 0;
+    winCtrl.winEnd = winSize;
+    winCtrl.fullTriangle = true;
+    winCtrl.wantSchurVecs = true;
+    winCtrl.accumulateSchurVecs = true;
+    winCtrl.demandConverged = false;
+    winCtrl.progress = false;
+    HessenbergQZInfo winInfo;
+    if( winSize < ctrl.minMultiBulgeSize || recursionLevel >= 1 )
+        winInfo = Simple( HWin, TWin, alphaWin, betaWin, QWin, ZWin, winCtrl );
+    else
+        winInfo =
+          AED
+          ( HWin, TWin, alphaWin, betaWin, QWin, ZWin, winCtrl,
+            recursionLevel+1 );
+    if( winInfo.numUnconverged > 0 )
+    {
+        // The trailing converged eigenvalues of the window may still be used
+        // as shifts
+        numDeflated = 0;
+        numUndeflated = winSize - winInfo.numUnconverged;
+        for( Int j=winInfo.numUnconverged; j<winSize; ++j )
+        {
+            alpha(winBeg+j) = alphaWin(j);
+            beta(winBeg+j) = betaWin(j);
+        }
+        HWin = HWinSave;
+        TWin = TWinSave;
+        return;
+    }
+
+    // Test the components of the spike from the bottom up, moving each
+    // undeflatable eigenvalue to the top of the window
+    Int deflateLast = activeLast;
+    if( !haveSpike || spike == F(0) )
+    {
+        deflateLast = winBeg-1;
+    }
+    else
+    {
+        Int numMoved = 0;
+        for( Int k=0; k<winSize; ++k )
+        {
+            const Int jLoc = deflateLast-winBeg;
+            Real diagAbs = Abs(HWin(jLoc,jLoc));
+            if( diagAbs == Real(0) )
+                diagAbs = Abs(spike);
+            if( Abs(spike*QWin(0,jLoc)) <= Max( ulp*diagAbs, smallNum ) )
+            {
+                --deflateLast;
+            }
+            else
+            {
+                MoveUp
+                ( HWin, TWin, jLoc, numMoved, winSize,
+                  true, QWin, true, ZWin );
+                ++numMoved;
+            }
+        }
+    }
+    numDeflated = activeLast - deflateLast;
+    numUndeflated = winSize - numDeflated;
+    for( Int j=winBeg; j<=activeLast; ++j )
+    {
+        alpha(j) = H(j,j);
+        beta(j) = T(j,j);
+    }
+
+    if( haveSpike && spike != F(0) )
+    {
+        // Reflect the spike back onto the subdiagonal, which introduces a
+        // bulge for each of the undeflated eigenvalues...
+        Real c;
+        F s;
+        for( Int j=winBeg; j<=deflateLast; ++j )
+            H(j,winBeg-1) = spike*Conj(QWin(0,j-winBeg));
+        for( Int j=deflateLast-1; j>=winBeg; --j )
+        {
+            ZeroFromLeft( H, j, winBeg-1, c, s );
+            RotateRows( c, s, H, j, Max(winBeg,j-1), activeLast+1 );
+            RotateRows( c, s, T, j, j-1, activeLast+1 );
+            RotateColumns( c, s, QWin, j-winBeg, 0, winSize );
+        }
+
+        // ...and then chase each of them off of the undeflated portion
+        for( Int k=deflateLast-1; k>=winBeg; --k )
+            for( Int j=k; j<deflateLast; ++j )
+                ChaseBulge
+                ( j, winBeg, activeLast+1, deflateLast, H, T,
+                  true, QWin, winBeg, true, ZWin, winBeg );
+    }
+
+    const Int rowBeg = ( ctrl.fullTriangle ? 0 : activeBeg );
+    const Int colEnd = ( ctrl.fullTriangle ? n : activeLast+1 );
+    ApplyBlockTransforms
+    ( H, T,
+      QWin, winInd, IR(activeLast+1,colEnd),
+      ZWin, winInd, IR(rowBeg,winBeg),
+      ctrl.wantSchurVecs, Q, ctrl.wantSchurVecs, Z );
+}
+
+// A multishift QZ algorithm with aggressive early deflation in the style of
+// Kagstrom and Kressner's "Multishift Variants of the QZ Algorithm with
+// Aggressive Early Deflation" [CITATION]; this is a translation of LAPACK's
+// zlaqz0. The single-shift algorithm is used for small pencils, for the
+// deflation windows of the recursive calls, and to normalize the final
+// generalized Schur form.
+template<typename F>
+HessenbergQZInfo
+AED
+( Matrix<F>& H,
+  Matrix<F>& T,
+  Matrix<F>& alpha,
+  Matrix<F>& beta,
+  Matrix<F>& Q,
+  Matrix<F>& Z,
+  const HessenbergQZCtrl& ctrl,
+  Int recursionLevel )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = H.Height();
+    const Int winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    const Int winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+    const Int winSize = winEnd - winBeg;
+    HessenbergQZInfo info;
+
+    alpha.Resize( n, 1 );
+    beta.Resize( n, 1 );
+    if( winSize < ctrl.minMultiBulgeSize )
+        return Simple( H, T, alpha, beta, Q, Z, ctrl );
+
+    Int numShiftsRec = ctrl.numShifts( n, winSize );
+    numShiftsRec = Min( numShiftsRec, (n+6)/9 );
+    numShiftsRec = Min( numShiftsRec, winSize-1 );
+    numShiftsRec = Max( Int(2), numShiftsRec-Mod(numShiftsRec,2) );
+    const Int deflationSizeRec =
+      ctrl.deflationSize( n, winSize, numShiftsRec );
+    // Cf. LAPACK's IPARMQ for this choice of the (desired) order of the
+    // diagonal blocks which the bulge chains are chased through
+    const double relCost = 10;
+    Int extraSize =
+      Int(numShiftsRec/Sqrt(1+2*numShiftsRec/(relCost/100*n)));
+    extraSize = ((extraSize-1)/4)*4 + 4;
+    const Int blockSizeRec = numShiftsRec + extraSize;
+
+    const Real safeMin = limits::SafeMin<Real>();
+    const Real ulp = limits::Precision<Real>();
+    const Real smallNum = safeMin*(Real(n)/ulp);
+    auto winInd = IR(winBeg,winEnd);
+    const Real TTol = Max( safeMin, ulp*FrobeniusNorm(T(winInd,winInd)) );
+    auto negligibleSubdiag = [&]( Int j )
+      {
+          const Real diagSum = Abs(H(j,j)) + Abs(H(j-1,j-1));
+          return Abs(H(j,j-1)) <= Max( smallNum, ulp*diagSum );
+      };
+
+    Real c;
+    F s;
+    Int iterBeg=winBeg, iterLast=winEnd-1;
+    Int numStagnant=0;
+    F exceptShift=0;
+    const Int maxIter = 30*winSize;
+    Matrix<F> alphaShifts, betaShifts;
+    for( Int iter=0; iter<maxIter; ++iter )
+    {
+        if( iterBeg+1 >= iterLast )
+            break;
+
+        // Check for deflations at the end and start of the active block
+        if( negligibleSubdiag(iterLast) )
+        {
+            H(iterLast,iterLast-1) = 0;
+            --iterLast;
+            numStagnant = 0;
+            exceptShift = 0;
+        }
+        if( negligibleSubdiag(iterBeg+1) )
+        {
+            H(iterBeg+1,iterBeg) = 0;
+            ++iterBeg;
+            numStagnant = 0;
+            exceptShift = 0;
+        }
+        if( iterBeg+1 >= iterLast )
+            break;
+
+        // Find the beginning of the trailing unreduced block
+        Int blockBeg = iterBeg;
+        for( Int k=iterLast; k>=iterBeg+1; --k )
+        {
+            if( negligibleSubdiag(k) )
+            {
+                H(k,k-1) = 0;
+                blockBeg = k;
+                break;
+            }
+        }
+        const Int rowBeg = ( ctrl.fullTriangle ? 0 : blockBeg );
+        const Int colEnd = ( ctrl.fullTriangle ? n : iterLast+1 );
+
+        // Move each negligible diagonal entry of T to the top of the block,
+        // where the corresponding infinite eigenvalue can be deflated
+        for( Int k=iterLast; k>=blockBeg; --k )
+        {
+            if( Abs(T(k,k)) >= TTol )
+                continue;
+            for( Int j=k; j>=blockBeg+1; --j )
+            {
+                ZeroFromRight( T, j-1, j-1, c, s );
+                RotateColumns( c, s, T, j-1, rowBeg, j-1 );
+                RotateColumns
+                ( c, s, H, j-1, rowBeg, Min(j+1,iterLast)+1 );
+                if( ctrl.wantSchurVecs )
+                    RotateColumns( c, s, Z, j-1, 0, Z.Height() );
+                if( j < iterLast )
+                {
+                    ZeroFromLeft( H, j, j-1, c, s );
+                    RotateRows( c, s, H, j, j, colEnd );
+                    RotateRows( c, s, T, j, j, colEnd );
+                    if( ctrl.wantSchurVecs )
+                        RotateColumns( c, s, Q, j, 0, Q.Height() );
+                }
+            }
+            if( blockBeg < iterLast )
+            {
+                ZeroFromLeft( H, blockBeg, blockBeg, c, s );
+                RotateRows( c, s, H, blockBeg, blockBeg+1, colEnd );
+                RotateRows( c, s, T, blockBeg, blockBeg+1, colEnd );
+                if( ctrl.wantSchurVecs )
+                    RotateColumns( c, s, Q, blockBeg, 0, Q.Height() );
+            }
+            ++blockBeg;
+        }
+        if( blockBeg >= iterLast )
+        {
+            iterLast = blockBeg-1;
+            numStagnant = 0;
+            exceptShift = 0;
+            continue;
+        }
+
+        // If the trailing block is small, setting the deflation window to
+        // the entire block will deflate all of its eigenvalues while
+        // updating the off-diagonal portions of the pencil with Gemm
+        Int deflationSize = deflationSizeRec;
+        if( iterLast-blockBeg+1 < ctrl.minMultiBulgeSize )
+        {
+            if( iterLast-iterBeg+1 < ctrl.minMultiBulgeSize )
+            {
+                deflationSize = iterLast-iterBeg+1;
+                blockBeg = iterBeg;
+            }
+            else
+                deflationSize = iterLast-blockBeg+1;
+        }
+
+        Int numUndeflated, numDeflated;
+        AggressiveDeflation
+        ( blockBeg, iterLast, deflationSize, H, T, alpha, beta, Q, Z, ctrl,
+          recursionLevel, numUndeflated, numDeflated );
+        if( ctrl.progress )
+            Output
+            ("Iteration ",iter,": deflated ",numDeflated," of ",
+             numDeflated+numUndeflated);
+        if( numDeflated > 0 )
+        {
+            iterLast -= numDeflated;
+            numStagnant = 0;
+            exceptShift = 0;
+        }
+        if( numDeflated > ctrl.sufficientDeflation(numDeflated+numUndeflated)
+            || iterLast-blockBeg+1 < ctrl.minMultiBulgeSize )
+            continue;
+
+        ++numStagnant;
+        Int numShifts = Min( numShiftsRec, iterLast-blockBeg );
+        numShifts = Min( numShifts, numUndeflated );
+        const Int shiftBeg = iterLast-numUndeflated+1;
+        if( numStagnant % 6 == 0 )
+        {
+            // An exceptional shift
+            if( (Real(maxIter)*safeMin)*Abs(H(iterLast,iterLast-1)) <
+                Abs(H(iterLast-1,iterLast-1)) )
+                exceptShift =
+                  H(iterLast,iterLast-1) / T(iterLast-1,iterLast-1);
+            else
+                exceptShift += F(1)/(safeMin*Real(maxIter));
+            alpha(shiftBeg) = 1;
+            beta(shiftBeg) = exceptShift;
+            numShifts = 1;
+        }
+        if( numShifts == 0 )
+            continue;
+
+        auto shiftInd = IR(shiftBeg,shiftBeg+numShifts);
+        alphaShifts = alpha( shiftInd, ALL );
+        betaShifts = beta( shiftInd, ALL );
+        Sweep
+        ( blockBeg, iterLast, blockSizeRec, alphaShifts, betaShifts,
+          H, T, Q, Z, ctrl );
+        ++info.numIterations;
+    }
+
+    // Normalize the generalized Schur form and set the eigenvalues (and, in
+    // the rare event that the above did not converge, continue with single
+    // shifts)
+    auto simpleInfo = Simple( H, T, alpha, beta, Q, Z, ctrl );
+    info.numIterations += simpleInfo.numIterations;
+    info.numUnconverged = simpleInfo.numUnconverged;
+    return info;
+}
+
+} // namespace hess_qz
+} // namespace El
+
+#endif // ifndef EL_HESS_QZ_AED_HPP
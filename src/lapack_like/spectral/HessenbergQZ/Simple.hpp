@@ -0,0 +1,349 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HESS_QZ_SIMPLE_HPP
+#define EL_HESS_QZ_SIMPLE_HPP
+
+#include "./Util.hpp"
+
+namespace El {
+namespace hess_qz {
+
+// The Wilkinson shift of the trailing 2 x 2 block of H inv(T), i.e., its
+// eigenvalue nearest to the bottom-right entry, computed by factoring the
+// trailing 2 x 2 block of T as U D, with U unit upper triangular
+template<typename F>
+F WilkinsonShift
+( const Matrix<F>& H,
+  const Matrix<F>& T,
+  Int last,
+  const Base<F>& HScale,
+  const Base<F>& TScale )
+{
+    typedef Base<F> Real;
+    const F u01 = (TScale*T(last-1,last)) / (TScale*T(last,last));
+    const F d00 = (HScale*H(last-1,last-1)) / (TScale*T(last-1,last-1));
+    const F d10 = (HScale*H(last,last-1)) / (TScale*T(last-1,last-1));
+    const F d01 = (HScale*H(last-1,last)) / (TScale*T(last,last));
+    const F d11 = (HScale*H(last,last)) / (TScale*T(last,last));
+    const F e11 = d11 - u01*d10;
+    const F e01 = d01 - u01*d00;
+
+    F shift = e11;
+    const F gamma = Sqrt(e01)*Sqrt(d10);
+    if( gamma != F(0) )
+    {
+        const F x = (d00-shift) / Real(2);
+        const Real xAbs = OneAbs(x);
+        const Real scale = Max( OneAbs(gamma), xAbs );
+        const F xScaled = x / scale;
+        const F gammaScaled = gamma / scale;
+        F y = scale*Sqrt( xScaled*xScaled + gammaScaled*gammaScaled );
+        if( xAbs > Real(0) )
+        {
+            const F xUnit = x / xAbs;
+            if( RealPart(xUnit)*RealPart(y) + ImagPart(xUnit)*ImagPart(y) <
+                Real(0) )
+                y = -y;
+        }
+        shift -= gamma*(gamma/(x+y));
+    }
+    return shift;
+}
+
+// A single-shift QZ iteration for the active window of a complex
+// Hessenberg-triangular pencil, which is a translation of LAPACK's zhgeqz.
+// Upon completion, the window of T has a real, non-negative diagonal and the
+// generalized eigenvalues are given by alpha(j) / beta(j).
+template<typename F>
+HessenbergQZInfo
+Simple
+( Matrix<F>& H,
+  Matrix<F>& T,
+  Matrix<F>& alpha,
+  Matrix<F>& beta,
+  Matrix<F>& Q,
+  Matrix<F>& Z,
+  const HessenbergQZCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = H.Height();
+    const Int winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    const Int winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+    const bool wantSchurVecs = ctrl.wantSchurVecs;
+    const bool fullTriangle = ctrl.fullTriangle;
+    HessenbergQZInfo info;
+
+    alpha.Resize( n, 1 );
+    beta.Resize( n, 1 );
+    if( winBeg >= winEnd )
+        return info;
+
+    const Real safeMin = limits::SafeMin<Real>();
+    const Real ulp = limits::Precision<Real>();
+    auto winInd = IR(winBeg,winEnd);
+    const Real HNorm = FrobeniusNorm( H(winInd,winInd) );
+    const Real TNorm = FrobeniusNorm( T(winInd,winInd) );
+    const Real HTol = Max( safeMin, ulp*HNorm );
+    const Real TTol = Max( safeMin, ulp*TNorm );
+    const Real HScale = Real(1) / Max( safeMin, HNorm );
+    const Real TScale = Real(1) / Max( safeMin, TNorm );
+
+    auto negligibleSubdiag = [&]( Int j )
+      {
+          const Real diagSum = OneAbs(H(j,j)) + OneAbs(H(j-1,j-1));
+          return OneAbs(H(j,j-1)) <= Max( safeMin, ulp*diagSum );
+      };
+
+    // The rotations from the right are applied to rows [rowBeg,...) and those
+    // from the left to columns [...,colEnd)
+    Int last = winEnd-1;
+    Int rowBeg = ( fullTriangle ? 0 : winBeg );
+    Int colEnd = ( fullTriangle ? n : winEnd );
+    Int iter=0;
+    F exceptShift = 0;
+    Real c;
+    F s;
+    const Int maxIter = 30*(winEnd-winBeg);
+    Int totalIter;
+    for( totalIter=0; totalIter<maxIter; ++totalIter )
+    {
+        // Determine whether the last eigenvalue has converged, whether a
+        // zero diagonal entry of T can be used to force it to, or where the
+        // unreduced block ending at 'last' begins
+        bool deflateLast=false, zeroLastT=false;
+        Int first=-1;
+        if( last == winBeg )
+        {
+            deflateLast = true;
+        }
+        else if( negligibleSubdiag(last) )
+        {
+            H(last,last-1) = 0;
+            deflateLast = true;
+        }
+        else if( Abs(T(last,last)) <= TTol )
+        {
+            T(last,last) = 0;
+            zeroLastT = true;
+        }
+        else
+        {
+            for( Int j=last-1; j>=winBeg; --j )
+            {
+                bool smallSubdiag;
+                if( j == winBeg )
+                {
+                    smallSubdiag = true;
+                }
+                else if( negligibleSubdiag(j) )
+                {
+                    H(j,j-1) = 0;
+                    smallSubdiag = true;
+                }
+                else
+                    smallSubdiag = false;
+
+                if( Abs(T(j,j)) < TTol )
+                {
+                    T(j,j) = 0;
+
+                    // Test for two consecutive small subdiagonals
+                    bool smallSubdiags = false;
+                    if( !smallSubdiag &&
+                        OneAbs(H(j,j-1))*(HScale*OneAbs(H(j+1,j))) <=
+                        OneAbs(H(j,j))*(HScale*HTol) )
+                        smallSubdiags = true;
+
+                    if( smallSubdiag || smallSubdiags )
+                    {
+                        // Split off the 1 x 1 block at the top, which may
+                        // need to be repeated if the next diagonal entry of
+                        // T is also zero
+                        for( Int jch=j; jch<last; ++jch )
+                        {
+                            ZeroFromLeft( H, jch, jch, c, s );
+                            RotateRows( c, s, H, jch, jch+1, colEnd );
+                            RotateRows( c, s, T, jch, jch+1, colEnd );
+                            if( wantSchurVecs )
+                                RotateColumns( c, s, Q, jch, 0, Q.Height() );
+                            if( smallSubdiags )
+                                H(jch,jch-1) *= c;
+                            smallSubdiags = false;
+                            if( OneAbs(T(jch+1,jch+1)) >= TTol )
+                            {
+                                if( jch+1 >= last )
+                                    deflateLast = true;
+                                else
+                                    first = jch+1;
+                                break;
+                            }
+                            T(jch+1,jch+1) = 0;
+                        }
+                        if( !deflateLast && first < 0 )
+                            zeroLastT = true;
+                    }
+                    else
+                    {
+                        // Chase the zero down to T(last,last)
+                        for( Int jch=j; jch<last; ++jch )
+                        {
+                            ZeroFromLeft( T, jch, jch+1, c, s );
+                            RotateRows( c, s, T, jch, jch+2, colEnd );
+                            RotateRows( c, s, H, jch, jch-1, colEnd );
+                            if( wantSchurVecs )
+                                RotateColumns( c, s, Q, jch, 0, Q.Height() );
+
+                            ZeroFromRight( H, jch+1, jch-1, c, s );
+                            RotateColumns( c, s, H, jch-1, rowBeg, jch+1 );
+                            RotateColumns( c, s, T, jch-1, rowBeg, jch );
+                            if( wantSchurVecs )
+                                RotateColumns
+                                ( c, s, Z, jch-1, 0, Z.Height() );
+                        }
+                        zeroLastT = true;
+                    }
+                    break;
+                }
+                else if( smallSubdiag )
+                {
+                    first = j;
+                    break;
+                }
+            }
+            if( !deflateLast && !zeroLastT && first < 0 )
+                LogicError("Could not find a splitting point");
+        }
+
+        if( zeroLastT )
+        {
+            // Use the zero in T(last,last) to clear H(last,last-1)
+            ZeroFromRight( H, last, last-1, c, s );
+            RotateColumns( c, s, H, last-1, rowBeg, last );
+            RotateColumns( c, s, T, last-1, rowBeg, last );
+            if( wantSchurVecs )
+                RotateColumns( c, s, Z, last-1, 0, Z.Height() );
+            deflateLast = true;
+        }
+
+        if( deflateLast )
+        {
+            // Normalize the diagonal entry of T to be real and non-negative
+            const Real tauAbs = Abs(T(last,last));
+            if( tauAbs > safeMin )
+            {
+                const F phase = Conj(T(last,last)/tauAbs);
+                T(last,last) = tauAbs;
+                if( fullTriangle )
+                {
+                    for( Int i=rowBeg; i<last; ++i )
+                        T(i,last) *= phase;
+                    for( Int i=rowBeg; i<=last; ++i )
+                        H(i,last) *= phase;
+                }
+                else
+                    H(last,last) *= phase;
+                if( wantSchurVecs )
+                    for( Int i=0; i<Z.Height(); ++i )
+                        Z(i,last) *= phase;
+            }
+            else
+                T(last,last) = 0;
+            alpha(last) = H(last,last);
+            beta(last) = T(last,last);
+
+            --last;
+            if( last < winBeg )
+                break;
+            iter = 0;
+            exceptShift = 0;
+            if( !fullTriangle )
+            {
+                colEnd = last+1;
+                if( rowBeg > last )
+                    rowBeg = winBeg;
+            }
+            continue;
+        }
+
+        // Perform a single-shift QZ sweep over [first,last]
+        ++iter;
+        ++info.numIterations;
+        if( !fullTriangle )
+            rowBeg = first;
+
+        F shift;
+        if( iter % 10 != 0 )
+        {
+            shift = WilkinsonShift( H, T, last, HScale, TScale );
+        }
+        else
+        {
+            // An exceptional shift
+            if( iter % 20 == 0 && TScale*OneAbs(T(last,last)) > safeMin )
+                exceptShift +=
+                  (HScale*H(last,last)) / (TScale*T(last,last));
+            else
+                exceptShift +=
+                  (HScale*H(last,last-1)) / (TScale*T(last-1,last-1));
+            shift = exceptShift;
+        }
+
+        // Look for two consecutive small subdiagonal entries
+        Int start = first;
+        F phi = HScale*H(first,first) - shift*(TScale*T(first,first));
+        for( Int j=last-1; j>first; --j )
+        {
+            const F psi = HScale*H(j,j) - shift*(TScale*T(j,j));
+            Real psiAbs = OneAbs(psi);
+            Real subdiagAbs = HScale*OneAbs(H(j+1,j));
+            const Real maxAbs = Max( psiAbs, subdiagAbs );
+            if( maxAbs < Real(1) && maxAbs != Real(0) )
+            {
+                psiAbs /= maxAbs;
+                subdiagAbs /= maxAbs;
+            }
+            if( OneAbs(H(j,j-1))*subdiagAbs <= psiAbs*HTol )
+            {
+                start = j;
+                phi = psi;
+                break;
+            }
+        }
+
+        Givens( phi, HScale*H(start+1,start), c, s );
+        for( Int j=start; j<last; ++j )
+        {
+            if( j > start )
+                ZeroFromLeft( H, j, j-1, c, s );
+            RotateRows( c, s, H, j, j, colEnd );
+            RotateRows( c, s, T, j, j, colEnd );
+            if( wantSchurVecs )
+                RotateColumns( c, s, Q, j, 0, Q.Height() );
+
+            ZeroFromRight( T, j+1, j, c, s );
+            RotateColumns( c, s, H, j, rowBeg, Min(j+2,last)+1 );
+            RotateColumns( c, s, T, j, rowBeg, j+1 );
+            if( wantSchurVecs )
+                RotateColumns( c, s, Z, j, 0, Z.Height() );
+        }
+    }
+    if( totalIter == maxIter )
+    {
+        if( ctrl.demandConverged )
+            RuntimeError("QZ iteration did not converge");
+        info.numUnconverged = last-winBeg+1;
+    }
+    return info;
+}
+
+} // namespace hess_qz
+} // namespace El
+
+#endif // ifndef EL_HESS_QZ_SIMPLE_HPP
@@ -0,0 +1,141 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HESS_QZ_SWEEP_HPP
+#define EL_HESS_QZ_SWEEP_HPP
+
+#include "./Util.hpp"
+
+namespace El {
+namespace hess_qz {
+
+// Perform a multishift QZ sweep over the unreduced block [winBeg,winLast] of
+// a Hessenberg-triangular pencil using the shifts alpha(j) / beta(j).
+//
+// Just as in the multi-bulge Hessenberg QR sweeps, the shifts are introduced
+// as a tightly-packed chain of bulges, the chain is chased down the diagonal
+// in steps of several positions at a time, and it is finally chased off the
+// bottom of the block. Each of these stages only applies its rotations to a
+// small diagonal window (of order roughly blockSizeDesired) while
+// accumulating them into a pair of small unitary matrices, which are then
+// applied to the remainder of the pencil (and the Schur vectors) with Gemm.
+// Since the shifts of a complex pencil do not need to be paired, each bulge
+// occupies a single position. This is a translation of LAPACK's zlaqz3.
+template<typename F>
+void Sweep
+( Int winBeg,
+  Int winLast,
+  Int blockSizeDesired,
+  Matrix<F>& alpha,
+  Matrix<F>& beta,
+  Matrix<F>& H,
+  Matrix<F>& T,
+  Matrix<F>& Q,
+  Matrix<F>& Z,
+  const HessenbergQZCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = H.Height();
+    const Int numShifts = alpha.Height();
+    if( numShifts < 1 || winBeg >= winLast )
+        return;
+    EL_DEBUG_ONLY(
+      if( numShifts > winLast-winBeg )
+          LogicError("Too many shifts for the active block");
+    )
+    const Real safeMin = limits::SafeMin<Real>();
+    const Real safeMax = Real(1) / safeMin;
+    const bool wantSchurVecs = ctrl.wantSchurVecs;
+    const Int rowBeg = ( ctrl.fullTriangle ? 0 : winBeg );
+    const Int colEnd = ( ctrl.fullTriangle ? n : winLast+1 );
+    const Int numSteps = Max( blockSizeDesired-numShifts, Int(1) );
+
+    Real c;
+    F s;
+    Matrix<F> QBlock, ZBlock;
+
+    // Introduce the shifts and chase each of them just far enough to make
+    // room for the next, so that the (numShifts+1) x numShifts diagonal
+    // block beginning at (winBeg,winBeg) holds the chain
+    Identity( QBlock, numShifts+1, numShifts+1 );
+    Identity( ZBlock, numShifts, numShifts );
+    for( Int i=0; i<numShifts; ++i )
+    {
+        F a = alpha(i);
+        F b = beta(i);
+        const Real scale = Sqrt(Abs(a))*Sqrt(Abs(b));
+        if( scale >= safeMin && scale <= safeMax )
+        {
+            a /= scale;
+            b /= scale;
+        }
+        F phi = b*H(winBeg,winBeg) - a*T(winBeg,winBeg);
+        F gamma = b*H(winBeg+1,winBeg);
+        if( Abs(phi) > safeMax || Abs(gamma) > safeMax )
+        {
+            phi = 1;
+            gamma = 0;
+        }
+        Givens( phi, gamma, c, s );
+        RotateRows( c, s, H, winBeg, winBeg, winBeg+numShifts );
+        RotateRows( c, s, T, winBeg, winBeg, winBeg+numShifts );
+        RotateColumns( c, s, QBlock, 0, 0, numShifts+1 );
+        for( Int j=0; j<numShifts-1-i; ++j )
+            ChaseBulge
+            ( winBeg+j, winBeg, winBeg+numShifts, winLast, H, T,
+              true, QBlock, winBeg, true, ZBlock, winBeg );
+    }
+    ApplyBlockTransforms
+    ( H, T,
+      QBlock, IR(winBeg,winBeg+numShifts+1), IR(winBeg+numShifts,colEnd),
+      ZBlock, IR(winBeg,winBeg+numShifts), IR(rowBeg,winBeg),
+      wantSchurVecs, Q, wantSchurVecs, Z );
+
+    // Chase the chain, which occupies positions [k,k+numShifts), down the
+    // diagonal numSteps positions at a time
+    Int k = winBeg;
+    while( k < winLast-numShifts )
+    {
+        const Int steps = Min( winLast-numShifts-k, numSteps );
+        const Int blockSize = numShifts + steps;
+        Identity( QBlock, blockSize, blockSize );
+        Identity( ZBlock, blockSize, blockSize );
+        for( Int i=numShifts-1; i>=0; --i )
+            for( Int j=0; j<steps; ++j )
+                ChaseBulge
+                ( k+i+j, k+1, k+blockSize, winLast, H, T,
+                  true, QBlock, k+1, true, ZBlock, k );
+        ApplyBlockTransforms
+        ( H, T,
+          QBlock, IR(k+1,k+blockSize+1), IR(k+blockSize,colEnd),
+          ZBlock, IR(k,k+blockSize), IR(rowBeg,k+1),
+          wantSchurVecs, Q, wantSchurVecs, Z );
+        k += steps;
+    }
+
+    // Chase the chain off of the bottom of the block
+    Identity( QBlock, numShifts, numShifts );
+    Identity( ZBlock, numShifts+1, numShifts+1 );
+    const Int chainBeg = winLast-numShifts;
+    for( Int i=1; i<=numShifts; ++i )
+        for( Int j=winLast-i; j<winLast; ++j )
+            ChaseBulge
+            ( j, chainBeg+1, winLast+1, winLast, H, T,
+              true, QBlock, chainBeg+1, true, ZBlock, chainBeg );
+    ApplyBlockTransforms
+    ( H, T,
+      QBlock, IR(chainBeg+1,winLast+1), IR(winLast+1,colEnd),
+      ZBlock, IR(chainBeg,winLast+1), IR(rowBeg,chainBeg+1),
+      wantSchurVecs, Q, wantSchurVecs, Z );
+}
+
+} // namespace hess_qz
+} // namespace El
+
+#endif // ifndef EL_HESS_QZ_SWEEP_HPP
@@ -0,0 +1,274 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HESS_QZ_UTIL_HPP
+#define EL_HESS_QZ_UTIL_HPP
+
+namespace El {
+namespace hess_qz {
+
+// Throughout the QZ routines, a Givens rotation (c,s) is the 2 x 2 unitary
+// matrix
+//
+//   G = |       c  s |,
+//       | -conj(s) c |
+//
+// as returned by El::Givens. The routines below apply G from the left to a
+// pair of adjacent rows and G^H from the right to a pair of adjacent columns.
+// Since the Schur vectors are only ever modified through the latter, they are
+// allowed to be an arbitrary subset of the rows of Q and Z (e.g., the local
+// rows of a [VC,STAR] distribution).
+
+template<typename F>
+Base<F> OneAbs( const F& alpha )
+{ return Abs(RealPart(alpha)) + Abs(ImagPart(alpha)); }
+
+// A([i,i+1],jBeg:jEnd-1) := G A([i,i+1],jBeg:jEnd-1)
+template<typename F>
+void RotateRows
+( const Base<F>& c,
+  const F& s,
+        Matrix<F>& A,
+        Int i,
+        Int jBeg,
+        Int jEnd )
+{
+    F* A0 = A.Buffer(i,0);
+    F* A1 = A.Buffer(i+1,0);
+    const Int ALDim = A.LDim();
+    const F sConj = Conj(s);
+    for( Int j=jBeg; j<jEnd; ++j )
+    {
+        const F alpha0 = A0[j*ALDim];
+        const F alpha1 = A1[j*ALDim];
+        A0[j*ALDim] =        c*alpha0 + s*alpha1;
+        A1[j*ALDim] = -sConj*alpha0 + c*alpha1;
+    }
+}
+
+// A(iBeg:iEnd-1,[j,j+1]) := A(iBeg:iEnd-1,[j,j+1]) G^H
+template<typename F>
+void RotateColumns
+( const Base<F>& c,
+  const F& s,
+        Matrix<F>& A,
+        Int j,
+        Int iBeg,
+        Int iEnd )
+{
+    F* a0 = A.Buffer(0,j);
+    F* a1 = A.Buffer(0,j+1);
+    const F sConj = Conj(s);
+    for( Int i=iBeg; i<iEnd; ++i )
+    {
+        const F alpha0 = a0[i];
+        const F alpha1 = a1[i];
+        a0[i] = c*alpha0 + sConj*alpha1;
+        a1[i] = -s*alpha0 + c*alpha1;
+    }
+}
+
+// Compute the rotation which, when applied from the left to rows i and i+1,
+// zeroes A(i+1,j) and return (c,s)
+template<typename F>
+void ZeroFromLeft( Matrix<F>& A, Int i, Int j, Base<F>& c, F& s )
+{
+    A(i,j) = Givens( A(i,j), A(i+1,j), c, s );
+    A(i+1,j) = F(0);
+}
+
+// Compute the rotation which, when applied from the right to columns j and
+// j+1, zeroes A(i,j) and return (c,s)
+template<typename F>
+void ZeroFromRight( Matrix<F>& A, Int i, Int j, Base<F>& c, F& s )
+{
+    A(i,j+1) = Givens( A(i,j+1), A(i,j), c, s );
+    A(i,j) = F(0);
+    s = -s;
+}
+
+// Chase the bulge T(k+1,k) of a single-shift QZ sweep one position down the
+// pencil (or, if k+1 is the last index of the active window, remove it).
+// The rotations from the right only update rows [rowBeg,...) and those from
+// the left only update columns [...,colEnd), while the rotations are
+// accumulated into the columns of Q and Z offset by qOff and zOff. This is a
+// translation of LAPACK's {c,z}laqz1.
+template<typename F>
+void ChaseBulge
+( Int k,
+  Int rowBeg,
+  Int colEnd,
+  Int winLast,
+  Matrix<F>& H,
+  Matrix<F>& T,
+  bool wantQ, Matrix<F>& Q, Int qOff,
+  bool wantZ, Matrix<F>& Z, Int zOff )
+{
+    typedef Base<F> Real;
+    Real c;
+    F s;
+    if( k+1 == winLast )
+    {
+        ZeroFromRight( T, winLast, winLast-1, c, s );
+        RotateColumns( c, s, T, winLast-1, rowBeg, winLast );
+        RotateColumns( c, s, H, winLast-1, rowBeg, winLast+1 );
+        if( wantZ )
+            RotateColumns( c, s, Z, winLast-1-zOff, 0, Z.Height() );
+    }
+    else
+    {
+        ZeroFromRight( T, k+1, k, c, s );
+        RotateColumns( c, s, H, k, rowBeg, k+3 );
+        RotateColumns( c, s, T, k, rowBeg, k+1 );
+        if( wantZ )
+            RotateColumns( c, s, Z, k-zOff, 0, Z.Height() );
+
+        ZeroFromLeft( H, k+1, k, c, s );
+        RotateRows( c, s, H, k+1, k+1, colEnd );
+        RotateRows( c, s, T, k+1, k+1, colEnd );
+        if( wantQ )
+            RotateColumns( c, s, Q, k+1-qOff, 0, Q.Height() );
+    }
+}
+
+// Attempt to swap the adjacent diagonal entries j and j+1 of the generalized
+// Schur form (S,T) of order n, where the rotations from the right update rows
+// [0,j+2) and those from the left update columns [j,n). The swap is rejected
+// (and false returned) if it would not be backward stable. This is a
+// translation of LAPACK's {c,z}tgex2.
+template<typename F>
+bool SwapAdjacent
+( Matrix<F>& S,
+  Matrix<F>& T,
+  Int j,
+  Int n,
+  bool wantQ, Matrix<F>& Q,
+  bool wantZ, Matrix<F>& Z )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Precision<Real>();
+    const Real smallNum = limits::SafeMin<Real>() / eps;
+
+    Matrix<F> SSub, TSub;
+    SSub = S( IR(j,j+2), IR(j,j+2) );
+    TSub = T( IR(j,j+2), IR(j,j+2) );
+    const Real SThresh = Max( 20*eps*FrobeniusNorm(SSub), smallNum );
+    const Real TThresh = Max( 20*eps*FrobeniusNorm(TSub), smallNum );
+
+    const F phi = SSub(1,1)*TSub(0,0) - TSub(1,1)*SSub(0,0);
+    const F gamma = SSub(1,1)*TSub(0,1) - TSub(1,1)*SSub(0,1);
+    const Real SMag = Abs(SSub(1,1))*Abs(TSub(0,0));
+    const Real TMag = Abs(SSub(0,0))*Abs(TSub(1,1));
+
+    Real cZ, cQ;
+    F sZ, sQ;
+    Givens( gamma, phi, cZ, sZ );
+    sZ = -sZ;
+    RotateColumns( cZ, sZ, SSub, 0, 0, 2 );
+    RotateColumns( cZ, sZ, TSub, 0, 0, 2 );
+    if( SMag >= TMag )
+        Givens( SSub(0,0), SSub(1,0), cQ, sQ );
+    else
+        Givens( TSub(0,0), TSub(1,0), cQ, sQ );
+    RotateRows( cQ, sQ, SSub, 0, 0, 2 );
+    RotateRows( cQ, sQ, TSub, 0, 0, 2 );
+
+    // Only accept the swap if the (1,0) entries are negligible
+    if( Abs(SSub(1,0)) > SThresh || Abs(TSub(1,0)) > TThresh )
+        return false;
+
+    RotateColumns( cZ, sZ, S, j, 0, j+2 );
+    RotateColumns( cZ, sZ, T, j, 0, j+2 );
+    RotateRows( cQ, sQ, S, j, j, n );
+    RotateRows( cQ, sQ, T, j, j, n );
+    S(j+1,j) = F(0);
+    T(j+1,j) = F(0);
+    if( wantZ )
+        RotateColumns( cZ, sZ, Z, j, 0, Z.Height() );
+    if( wantQ )
+        RotateColumns( cQ, sQ, Q, j, 0, Q.Height() );
+    return true;
+}
+
+// Move the diagonal entry 'from' of the generalized Schur form (S,T) of order
+// n up to position 'to' <= 'from' through a sequence of adjacent swaps and
+// return its final position (which is larger than 'to' if a swap was
+// rejected). This is a translation of LAPACK's {c,z}tgexc.
+template<typename F>
+Int MoveUp
+( Matrix<F>& S,
+  Matrix<F>& T,
+  Int from,
+  Int to,
+  Int n,
+  bool wantQ, Matrix<F>& Q,
+  bool wantZ, Matrix<F>& Z )
+{
+    Int here = from;
+    while( here > to )
+    {
+        if( !SwapAdjacent( S, T, here-1, n, wantQ, Q, wantZ, Z ) )
+            break;
+        --here;
+    }
+    return here;
+}
+
+// Apply the unitary transformations accumulated for a diagonal block to the
+// remainder of the pencil, i.e., for each A in {H,T},
+//
+//   A(rowInd,colRight) := QBlock^H A(rowInd,colRight), and
+//   A(rowAbove,colInd) := A(rowAbove,colInd) ZBlock,
+//
+// and accumulate QBlock and ZBlock into the Schur vectors.
+template<typename F>
+void ApplyBlockTransforms
+( Matrix<F>& H,
+  Matrix<F>& T,
+  const Matrix<F>& QBlock, Range<Int> rowInd, Range<Int> colRight,
+  const Matrix<F>& ZBlock, Range<Int> colInd, Range<Int> rowAbove,
+  bool wantQ, Matrix<F>& Q,
+  bool wantZ, Matrix<F>& Z )
+{
+    Matrix<F> tmp;
+    if( colRight.end > colRight.beg )
+    {
+        auto HRight = H( rowInd, colRight );
+        Gemm( ADJOINT, NORMAL, F(1), QBlock, HRight, tmp );
+        HRight = tmp;
+        auto TRight = T( rowInd, colRight );
+        Gemm( ADJOINT, NORMAL, F(1), QBlock, TRight, tmp );
+        TRight = tmp;
+    }
+    if( rowAbove.end > rowAbove.beg )
+    {
+        auto HAbove = H( rowAbove, colInd );
+        Gemm( NORMAL, NORMAL, F(1), HAbove, ZBlock, tmp );
+        HAbove = tmp;
+        auto TAbove = T( rowAbove, colInd );
+        Gemm( NORMAL, NORMAL, F(1), TAbove, ZBlock, tmp );
+        TAbove = tmp;
+    }
+    if( wantQ )
+    {
+        auto QCols = Q( ALL, rowInd );
+        Gemm( NORMAL, NORMAL, F(1), QCols, QBlock, tmp );
+        QCols = tmp;
+    }
+    if( wantZ )
+    {
+        auto ZCols = Z( ALL, colInd );
+        Gemm( NORMAL, NORMAL, F(1), ZCols, ZBlock, tmp );
+        ZCols = tmp;
+    }
+}
+
+} // namespace hess_qz
+} // namespace El
+
+#endif // ifndef EL_HESS_QZ_UTIL_HPP
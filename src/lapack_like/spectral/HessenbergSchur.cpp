@@ -506,8 +506,183 @@ void Sweep
     SweepHelper( H, shifts, Z, ctrl );
 }
 
+// Z may be null if the Schur vectors are not wanted. Since exceptions cannot
+// escape the threaded loop, the index of the first member whose
+// decomposition failed (or -1) is returned through 'firstFailure'.
+template<typename F>
+HessenbergSchurInfo
+BatchedHelper
+( Int n,
+  F* H, Int HLDim, Int HStride,
+  Complex<Base<F>>* w, Int wStride,
+  F* Z, Int ZLDim, Int ZStride,
+  Int batchSize,
+  Int& firstFailure,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    EL_DEBUG_ONLY(
+      if( n < 0 || batchSize < 0 )
+          LogicError("Batch dimensions must be non-negative");
+      if( HLDim < Max(n,1) || (Z != nullptr && ZLDim < Max(n,1)) )
+          LogicError("Invalid leading dimension in BatchedHessenbergSchur");
+    )
+    vector<HessenbergSchurInfo> infos( batchSize );
+    vector<byte> success( batchSize, true );
+    EL_PARALLEL_FOR_GRAIN(batchSize*n*n*n)
+    for( Int b=0; b<batchSize; ++b )
+    {
+        try
+        {
+            Matrix<F> HMember( n, n, &H[b*HStride], HLDim );
+            Matrix<Complex<Real>> wMember( n, 1, &w[b*wStride], Max(n,1) );
+            if( Z == nullptr )
+            {
+                infos[b] = HessenbergSchur( HMember, wMember, ctrl );
+            }
+            else
+            {
+                Matrix<F> ZMember( n, n, &Z[b*ZStride], ZLDim );
+                infos[b] = HessenbergSchur( HMember, wMember, ZMember, ctrl );
+            }
+        }
+        catch( std::exception& e ) { success[b] = false; }
+    }
+
+    HessenbergSchurInfo info;
+    firstFailure = -1;
+    for( Int b=0; b<batchSize; ++b )
+    {
+        if( !success[b] && firstFailure == -1 )
+            firstFailure = b;
+        info.numUnconverged += infos[b].numUnconverged;
+        info.numIterations = Max( info.numIterations, infos[b].numIterations );
+    }
+    return info;
+}
+
+template<typename F>
+HessenbergSchurInfo
+BatchedHelper
+( DistMatrix<F,STAR,VR,BLOCK>& H,
+  DistMatrix<Complex<Base<F>>,STAR,VR,BLOCK>& w,
+  DistMatrix<F,STAR,VR,BLOCK>* Z,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    HessenbergSchurInfo info;
+    const Int n = H.Height();
+    if( n == 0 )
+        return info;
+    const Int batchSize = H.Width() / n;
+    if( H.Width() != n*batchSize || H.BlockWidth() != n || H.RowCut() != 0 )
+        LogicError("H must be n x (n batchSize) with a block width of n");
+    if( w.Height() != n || w.Width() != batchSize || w.BlockWidth() != 1 ||
+        w.RowCut() != 0 || w.RowAlign() != H.RowAlign() )
+        LogicError
+        ("w must be n x batchSize with a block width of one and aligned "
+         "with H");
+    if( Z != nullptr &&
+        (Z->Height() != n || Z->Width() != H.Width() ||
+         Z->BlockWidth() != n || Z->RowCut() != 0 ||
+         Z->RowAlign() != H.RowAlign()) )
+        LogicError("Z must be distributed in the same manner as H");
+
+    Int firstFailure;
+    info =
+      BatchedHelper
+      ( n,
+        H.Buffer(), H.LDim(), n*H.LDim(),
+        w.Buffer(), w.LDim(),
+        ( Z == nullptr ? nullptr : Z->Buffer() ),
+        ( Z == nullptr ? n : Z->LDim() ),
+        ( Z == nullptr ? 0 : n*Z->LDim() ),
+        w.LocalWidth(), firstFailure, ctrl );
+
+    // Make sure that all processes agree on whether to throw
+    mpi::Comm comm = H.DistComm();
+    info.numUnconverged = mpi::AllReduce( info.numUnconverged, comm );
+    info.numIterations =
+      mpi::AllReduce( info.numIterations, mpi::MAX, comm );
+    const Int firstLocalFailure =
+      ( firstFailure == -1 ? -1 : w.GlobalCol(firstFailure) );
+    const Int failure = mpi::AllReduce( firstLocalFailure, mpi::MAX, comm );
+    if( failure != -1 )
+        RuntimeError
+        ("HessenbergSchur failed for member ",failure," of the batch");
+    return info;
+}
+
 } // namespace hess_schur
 
+template<typename F>
+HessenbergSchurInfo
+BatchedHessenbergSchur
+( Int n,
+  F* H, Int HLDim, Int HStride,
+  Complex<Base<F>>* w, Int wStride,
+  Int batchSize,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Int firstFailure;
+    auto info =
+      hess_schur::BatchedHelper
+      ( n, H, HLDim, HStride, w, wStride, (F*)nullptr, n, 0, batchSize,
+        firstFailure, ctrl );
+    if( firstFailure != -1 )
+        RuntimeError
+        ("HessenbergSchur failed for member ",firstFailure," of the batch");
+    return info;
+}
+
+template<typename F>
+HessenbergSchurInfo
+BatchedHessenbergSchur
+( Int n,
+  F* H, Int HLDim, Int HStride,
+  Complex<Base<F>>* w, Int wStride,
+  F* Z, Int ZLDim, Int ZStride,
+  Int batchSize,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Int firstFailure;
+    auto info =
+      hess_schur::BatchedHelper
+      ( n, H, HLDim, HStride, w, wStride, Z, ZLDim, ZStride, batchSize,
+        firstFailure, ctrl );
+    if( firstFailure != -1 )
+        RuntimeError
+        ("HessenbergSchur failed for member ",firstFailure," of the batch");
+    return info;
+}
+
+template<typename F>
+HessenbergSchurInfo
+BatchedHessenbergSchur
+( DistMatrix<F,STAR,VR,BLOCK>& H,
+  DistMatrix<Complex<Base<F>>,STAR,VR,BLOCK>& w,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    return hess_schur::BatchedHelper
+    ( H, w, (DistMatrix<F,STAR,VR,BLOCK>*)nullptr, ctrl );
+}
+
+template<typename F>
+HessenbergSchurInfo
+BatchedHessenbergSchur
+( DistMatrix<F,STAR,VR,BLOCK>& H,
+  DistMatrix<Complex<Base<F>>,STAR,VR,BLOCK>& w,
+  DistMatrix<F,STAR,VR,BLOCK>& Z,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    return hess_schur::BatchedHelper( H, w, &Z, ctrl );
+}
+
 #define PROTO(F) \
   template HessenbergSchurInfo HessenbergSchur \
   ( Matrix<F>& H, \
@@ -536,6 +711,28 @@ void Sweep
   ( DistMatrix<F,MC,MR,BLOCK>& H, \
     DistMatrix<Complex<Base<F>>,STAR,STAR>& shifts, \
     DistMatrix<F,MC,MR,BLOCK>& Z, \
+    const HessenbergSchurCtrl& ctrl ); \
+  template HessenbergSchurInfo BatchedHessenbergSchur \
+  ( Int n, \
+    F* H, Int HLDim, Int HStride, \
+    Complex<Base<F>>* w, Int wStride, \
+    Int batchSize, \
+    const HessenbergSchurCtrl& ctrl ); \
+  template HessenbergSchurInfo BatchedHessenbergSchur \
+  ( Int n, \
+    F* H, Int HLDim, Int HStride, \
+    Complex<Base<F>>* w, Int wStride, \
+    F* Z, Int ZLDim, Int ZStride, \
+    Int batchSize, \
+    const HessenbergSchurCtrl& ctrl ); \
+  template HessenbergSchurInfo BatchedHessenbergSchur \
+  ( DistMatrix<F,STAR,VR,BLOCK>& H, \
+    DistMatrix<Complex<Base<F>>,STAR,VR,BLOCK>& w, \
+    const HessenbergSchurCtrl& ctrl ); \
+  template HessenbergSchurInfo BatchedHessenbergSchur \
+  ( DistMatrix<F,STAR,VR,BLOCK>& H, \
+    DistMatrix<Complex<Base<F>>,STAR,VR,BLOCK>& w, \
+    DistMatrix<F,STAR,VR,BLOCK>& Z, \
     const HessenbergSchurCtrl& ctrl );
 
 #define EL_NO_INT_PROTO
@@ -15,61 +15,26 @@ namespace El {
 namespace hess_schur {
 namespace aed {
 
-// The spike value will be overwritten
+// Given the (partial) Schur decomposition H = V T V', with the leading
+// 'numUnconverged' diagonal entries of T unconverged, deflate the trailing
+// portion of the spike and, if possible, overwrite H with the updated
+// deflation window. The spike value will be overwritten.
 template<typename Real>
-AEDInfo NibbleHelper
+AEDInfo DeflateWindow
 ( Matrix<Real>& H,
+  Matrix<Real>& T,
   Real& spikeValue,
+  Int numUnconverged,
   Matrix<Complex<Real>>& w,
   Matrix<Real>& V,
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
     const Int n = H.Height();
-    AEDInfo info;
-
     const Real zero(0);
-    const Real ulp = limits::Precision<Real>();
-    const Real safeMin = limits::SafeMin<Real>();
-    const Real smallNum = safeMin*(Real(n)/ulp);
-
-    Zeros( V, 0, 0 );
-    if( n == 1 )
-    {
-        w(0) = H(0,0);
-        if( Abs(spikeValue) <= Max( smallNum, ulp*Abs(w(0).real()) ) )
-        {
-            // The offdiagonal entry was small enough to deflate
-            info.numDeflated = 1;
-            spikeValue = zero;
-        }
-        else
-        {
-            // The offdiagonal entry was too large to deflate
-            info.numShiftCandidates = 1;
-        }
-        return info;
-    }
-
-    // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
-    auto T( H ); // TODO(poulson): Reuse this matrix?
-    Identity( V, n, n );
-    auto ctrlSub( ctrl );
-    ctrlSub.winBeg = 0;
-    ctrlSub.winEnd = n;
-    ctrlSub.fullTriangle = true;
-    ctrlSub.wantSchurVecs = true;
-    ctrlSub.demandConverged = false;
-    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
-                                      : HESSENBERG_SCHUR_MULTIBULGE );
-    auto infoSub = HessenbergSchur( T, w, V, ctrlSub );
-    EL_DEBUG_ONLY(
-      if( infoSub.numUnconverged != 0 )
-          Output(infoSub.numUnconverged," eigenvalues did not converge");
-    )
 
     vector<Real> work(2*n);
-    info = SpikeDeflation( T, V, spikeValue, infoSub.numUnconverged, work );
+    AEDInfo info = SpikeDeflation( T, V, spikeValue, numUnconverged, work );
     if( ctrl.progress )
     {
         if( info.numUnconverged > 0 )
@@ -187,9 +152,11 @@ AEDInfo NibbleHelper
 }
 
 template<typename Real>
-AEDInfo NibbleHelper
+AEDInfo DeflateWindow
 ( Matrix<Complex<Real>>& H,
+  Matrix<Complex<Real>>& T,
   Complex<Real>& spikeValue,
+  Int numUnconverged,
   Matrix<Complex<Real>>& w,
   Matrix<Complex<Real>>& V,
   const HessenbergSchurCtrl& ctrl )
@@ -197,50 +164,10 @@ AEDInfo NibbleHelper
     EL_DEBUG_CSE
     typedef Complex<Real> Field;
     const Int n = H.Height();
-    AEDInfo info;
-
     const Real zero(0);
-    const Real ulp = limits::Precision<Real>();
-    const Real safeMin = limits::SafeMin<Real>();
-    const Real smallNum = safeMin*(Real(n)/ulp);
-
-    Zeros( V, 0, 0 );
-    if( n == 1 )
-    {
-        w(0) = H(0,0);
-        if( OneAbs(spikeValue) <= Max( smallNum, ulp*OneAbs(w(0)) ) )
-        {
-            // The offdiagonal entry was small enough to deflate
-            info.numDeflated = 1;
-            spikeValue = zero;
-        }
-        else
-        {
-            // The offdiagonal entry was too large to deflate
-            info.numShiftCandidates = 1;
-        }
-        return info;
-    }
-
-    // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
-    auto T( H ); // TODO(poulson): Reuse this matrix?
-    Identity( V, n, n );
-    auto ctrlSub( ctrl );
-    ctrlSub.winBeg = 0;
-    ctrlSub.winEnd = n;
-    ctrlSub.fullTriangle = true;
-    ctrlSub.wantSchurVecs = true;
-    ctrlSub.demandConverged = false;
-    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
-                                      : HESSENBERG_SCHUR_MULTIBULGE );
-    auto infoSub = HessenbergSchur( T, w, V, ctrlSub );
-    EL_DEBUG_ONLY(
-      if( infoSub.numUnconverged != 0 )
-          Output(infoSub.numUnconverged," eigenvalues did not converge");
-    )
 
     vector<Field> work(2*n);
-    info = SpikeDeflation( T, V, spikeValue, infoSub.numUnconverged, work );
+    AEDInfo info = SpikeDeflation( T, V, spikeValue, numUnconverged, work );
     if( ctrl.progress )
     {
         if( info.numUnconverged > 0 )
@@ -337,6 +264,118 @@ AEDInfo NibbleHelper
     return info;
 }
 
+// The spike value will be overwritten
+template<typename Real>
+AEDInfo NibbleHelper
+( Matrix<Real>& H,
+  Real& spikeValue,
+  Matrix<Complex<Real>>& w,
+  Matrix<Real>& V,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = H.Height();
+    AEDInfo info;
+
+    const Real zero(0);
+    const Real ulp = limits::Precision<Real>();
+    const Real safeMin = limits::SafeMin<Real>();
+    const Real smallNum = safeMin*(Real(n)/ulp);
+
+    Zeros( V, 0, 0 );
+    if( n == 1 )
+    {
+        w(0) = H(0,0);
+        if( Abs(spikeValue) <= Max( smallNum, ulp*Abs(w(0).real()) ) )
+        {
+            // The offdiagonal entry was small enough to deflate
+            info.numDeflated = 1;
+            spikeValue = zero;
+        }
+        else
+        {
+            // The offdiagonal entry was too large to deflate
+            info.numShiftCandidates = 1;
+        }
+        return info;
+    }
+
+    // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
+    auto T( H ); // TODO(poulson): Reuse this matrix?
+    Identity( V, n, n );
+    auto ctrlSub( ctrl );
+    ctrlSub.winBeg = 0;
+    ctrlSub.winEnd = n;
+    ctrlSub.fullTriangle = true;
+    ctrlSub.wantSchurVecs = true;
+    ctrlSub.demandConverged = false;
+    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
+                                      : HESSENBERG_SCHUR_MULTIBULGE );
+    auto infoSub = HessenbergSchur( T, w, V, ctrlSub );
+    EL_DEBUG_ONLY(
+      if( infoSub.numUnconverged != 0 )
+          Output(infoSub.numUnconverged," eigenvalues did not converge");
+    )
+    return DeflateWindow
+    ( H, T, spikeValue, infoSub.numUnconverged, w, V, ctrl );
+}
+
+template<typename Real>
+AEDInfo NibbleHelper
+( Matrix<Complex<Real>>& H,
+  Complex<Real>& spikeValue,
+  Matrix<Complex<Real>>& w,
+  Matrix<Complex<Real>>& V,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> Field;
+    const Int n = H.Height();
+    AEDInfo info;
+
+    const Real zero(0);
+    const Real ulp = limits::Precision<Real>();
+    const Real safeMin = limits::SafeMin<Real>();
+    const Real smallNum = safeMin*(Real(n)/ulp);
+
+    Zeros( V, 0, 0 );
+    if( n == 1 )
+    {
+        w(0) = H(0,0);
+        if( OneAbs(spikeValue) <= Max( smallNum, ulp*OneAbs(w(0)) ) )
+        {
+            // The offdiagonal entry was small enough to deflate
+            info.numDeflated = 1;
+            spikeValue = zero;
+        }
+        else
+        {
+            // The offdiagonal entry was too large to deflate
+            info.numShiftCandidates = 1;
+        }
+        return info;
+    }
+
+    // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
+    auto T( H ); // TODO(poulson): Reuse this matrix?
+    Identity( V, n, n );
+    auto ctrlSub( ctrl );
+    ctrlSub.winBeg = 0;
+    ctrlSub.winEnd = n;
+    ctrlSub.fullTriangle = true;
+    ctrlSub.wantSchurVecs = true;
+    ctrlSub.demandConverged = false;
+    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
+                                      : HESSENBERG_SCHUR_MULTIBULGE );
+    auto infoSub = HessenbergSchur( T, w, V, ctrlSub );
+    EL_DEBUG_ONLY(
+      if( infoSub.numUnconverged != 0 )
+          Output(infoSub.numUnconverged," eigenvalues did not converge");
+    )
+    return DeflateWindow
+    ( H, T, spikeValue, infoSub.numUnconverged, w, V, ctrl );
+}
+
 template<typename Field>
 AEDInfo Nibble
 ( Matrix<Field>& H,
@@ -396,6 +435,67 @@ AEDInfo Nibble
     return info;
 }
 
+// Compute the Schur decomposition of a distributed deflation window using the
+// distributed (recursive) algorithm on a subgrid and gather the resulting
+// quasi-triangular matrix and Schur vectors onto the root of T and V.
+// The number of unconverged eigenvalues is returned on every process.
+template<typename Field>
+Int SubgridWindowSchur
+( const DistMatrix<Field,MC,MR,BLOCK>& HWin,
+        DistMatrix<Field,CIRC,CIRC>& T,
+        DistMatrix<Field,CIRC,CIRC>& V,
+        Int numSubgridProcs,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = HWin.Grid();
+    const Int n = HWin.Height();
+
+    vector<int> subgridRanks( numSubgridProcs );
+    for( Int q=0; q<numSubgridProcs; ++q )
+        subgridRanks[q] = q;
+    mpi::Group owningGroup = grid.OwningGroup();
+    mpi::Group subgridGroup;
+    mpi::Incl
+    ( owningGroup, numSubgridProcs, subgridRanks.data(), subgridGroup );
+    const Grid subgrid
+    ( grid.VCComm(), subgridGroup, Grid::DefaultHeight(numSubgridProcs) );
+    mpi::Free( subgridGroup );
+
+    DistMatrix<Field> HWinElem( grid );
+    HWinElem = HWin;
+    DistMatrix<Field> HSub( subgrid ), VSub( subgrid );
+    HSub = HWinElem;
+
+    Int numUnconverged = 0;
+    if( subgrid.InGrid() )
+    {
+        auto ctrlSub( ctrl );
+        ctrlSub.winBeg = 0;
+        ctrlSub.winEnd = n;
+        ctrlSub.fullTriangle = true;
+        ctrlSub.wantSchurVecs = true;
+        ctrlSub.accumulateSchurVecs = false;
+        ctrlSub.demandConverged = false;
+        ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
+                                          : HESSENBERG_SCHUR_MULTIBULGE );
+        DistMatrix<Complex<Base<Field>>,STAR,STAR> wSub( subgrid );
+        auto infoSub = HessenbergSchur( HSub, wSub, VSub, ctrlSub );
+        numUnconverged = infoSub.numUnconverged;
+    }
+    numUnconverged =
+      mpi::AllReduce( numUnconverged, mpi::MAX, grid.VCComm() );
+
+    const bool includeViewers = true;
+    HSub.MakeConsistent( includeViewers );
+    VSub.MakeConsistent( includeViewers );
+    HWinElem = HSub;
+    T = HWinElem;
+    HWinElem = VSub;
+    V = HWinElem;
+    return numUnconverged;
+}
+
 template<typename Field>
 AEDInfo Nibble
 ( DistMatrix<Field,MC,MR,BLOCK>& H,
@@ -430,7 +530,34 @@ AEDInfo Nibble
       ( deflateBeg==winBeg ? Field(0) : H.Get(deflateBeg,deflateBeg-1) );
     Int VSize = 0;
     Matrix<Field> V;
-    if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
+
+    // Large windows are handled by the distributed algorithm on a subgrid
+    // where each process owns roughly a minDistMultiBulgeSize x
+    // minDistMultiBulgeSize block
+    const Int subgridDim = blockSize / Max(ctrl.minDistMultiBulgeSize,Int(1));
+    const Int numSubgridProcs = Min( grid.Size(), subgridDim*subgridDim );
+    if( blockSize >= ctrl.minDistAEDSize && numSubgridProcs > 1 )
+    {
+        if( ctrl.progress && grid.Rank() == 0 )
+            Output
+            ("  Computing the Schur decomposition of the AED window of size ",
+             blockSize," on ",numSubgridProcs," processes");
+        DistMatrix<Field,CIRC,CIRC> T( grid, owner ), VSchur( grid, owner );
+        const Int numUnconverged =
+          SubgridWindowSchur( HDefl, T, VSchur, numSubgridProcs, ctrl );
+        if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
+        {
+            for( Int i=0; i<numUnconverged; ++i )
+                wDefl.Matrix()(i) = T.Matrix()(i,i);
+            V = VSchur.Matrix();
+            info =
+              DeflateWindow
+              ( HDefl_CIRC_CIRC.Matrix(), T.Matrix(), spikeValue,
+                numUnconverged, wDefl.Matrix(), V, ctrl );
+            VSize = V.Height();
+        }
+    }
+    else if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
     {
         info =
           NibbleHelper
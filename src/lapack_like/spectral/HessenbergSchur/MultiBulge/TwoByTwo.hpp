@@ -78,8 +78,9 @@ void TwoByTwo
     // can be rescaled to be real (and both equal to 'c').
     auto HSub = H( IR(offset,offset+2), IR(offset,offset+2) );
     auto wSub = w( IR(offset,offset+2), ALL );
-    Matrix<Complex<Real>> ZSub;
-    HessenbergSchur( HSub, wSub, ZSub );
+    Matrix<Complex<Real>> ZSubDynamic;
+    HessenbergSchur( HSub, wSub, ZSubDynamic );
+    const SmallMatrix<Complex<Real>,2,2> ZSub( ZSubDynamic );
 
     if( ctrl.fullTriangle )
     {
@@ -88,7 +89,7 @@ void TwoByTwo
             // Overwrite H((offset,offset+1),offset+2:end) *= ZSub'
             // (applied from the left)
             auto HRight = H( ALL, IR(offset+2,END) );
-            Matrix<Complex<Real>> ZSubAdj;
+            SmallMatrix<Complex<Real>,2,2> ZSubAdj;
             Adjoint( ZSub, ZSubAdj );
             Transform2x2Rows( ZSubAdj, HRight, offset, offset+1 );
         }
@@ -219,6 +219,136 @@ void Kernel
     Copy( VR, K );
 }
 
+namespace image_and_kernel {
+
+// Overwrite K with an orthonormal basis for the orthogonal complement of the
+// span of the orthonormal columns of W
+template<typename Field>
+void Complement( Matrix<Field>& W, Matrix<Field>& K )
+{
+    EL_DEBUG_CSE
+    const Int n = W.Height();
+    const Int rank = W.Width();
+    Matrix<Field> householderScalars;
+    Matrix<Base<Field>> signature;
+    QR( W, householderScalars, signature );
+    Zeros( K, n, n-rank );
+    FillDiagonal( K, Field(1), -rank );
+    qr::ApplyQ( LEFT, NORMAL, W, householderScalars, signature, K );
+}
+
+template<typename Field>
+void Complement( DistMatrix<Field>& W, AbstractDistMatrix<Field>& K )
+{
+    EL_DEBUG_CSE
+    const Int n = W.Height();
+    const Int rank = W.Width();
+    const Grid& g = W.Grid();
+    DistMatrix<Field,MD,STAR> householderScalars(g);
+    DistMatrix<Base<Field>,MD,STAR> signature(g);
+    QR( W, householderScalars, signature );
+    Zeros( K, n, n-rank );
+    FillDiagonal( K, Field(1), -rank );
+    qr::ApplyQ( LEFT, NORMAL, W, householderScalars, signature, K );
+}
+
+} // namespace image_and_kernel
+
+template<typename Field>
+void ImageAndKernel
+( const Matrix<Field>& B,
+        Matrix<Field>& M,
+        Matrix<Field>& K,
+  const RankRevealCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == RANK_REVEAL_SVD && ctrl.tol == Base<Field>(0) )
+    {
+        ImageAndKernel( B, M, K );
+        return;
+    }
+    Matrix<Field> T, W;
+    RankReveal( B, M, T, W, ctrl );
+    image_and_kernel::Complement( W, K );
+}
+
+template<typename Field>
+void ImageAndKernel
+( const AbstractDistMatrix<Field>& B,
+        AbstractDistMatrix<Field>& M,
+        AbstractDistMatrix<Field>& K,
+  const RankRevealCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == RANK_REVEAL_SVD && ctrl.tol == Base<Field>(0) )
+    {
+        ImageAndKernel( B, M, K );
+        return;
+    }
+    const Grid& g = B.Grid();
+    DistMatrix<Field> T(g), W(g);
+    RankReveal( B, M, T, W, ctrl );
+    image_and_kernel::Complement( W, K );
+}
+
+template<typename Field>
+void Image
+( const Matrix<Field>& B,
+        Matrix<Field>& M,
+  const RankRevealCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> T, W;
+    RankReveal( B, M, T, W, ctrl );
+}
+
+template<typename Field>
+void Image
+( const AbstractDistMatrix<Field>& B,
+        AbstractDistMatrix<Field>& M,
+  const RankRevealCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = B.Grid();
+    DistMatrix<Field> T(g), W(g);
+    RankReveal( B, M, T, W, ctrl );
+}
+
+template<typename Field>
+void Kernel
+( const Matrix<Field>& B,
+        Matrix<Field>& K,
+  const RankRevealCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == RANK_REVEAL_SVD && ctrl.tol == Base<Field>(0) )
+    {
+        Kernel( B, K );
+        return;
+    }
+    Matrix<Field> M, T, W;
+    RankReveal( B, M, T, W, ctrl );
+    image_and_kernel::Complement( W, K );
+}
+
+template<typename Field>
+void Kernel
+( const AbstractDistMatrix<Field>& B,
+        AbstractDistMatrix<Field>& K,
+  const RankRevealCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == RANK_REVEAL_SVD && ctrl.tol == Base<Field>(0) )
+    {
+        Kernel( B, K );
+        return;
+    }
+    const Grid& g = B.Grid();
+    DistMatrix<Field> M(g), T(g), W(g);
+    RankReveal( B, M, T, W, ctrl );
+    image_and_kernel::Complement( W, K );
+}
+
 #define PROTO(Field) \
   template void ImageAndKernel \
   ( const Matrix<Field>& B, \
@@ -239,7 +369,33 @@ void Kernel
           Matrix<Field>& K ); \
   template void Kernel \
   ( const AbstractDistMatrix<Field>& B, \
-          AbstractDistMatrix<Field>& K );
+          AbstractDistMatrix<Field>& K ); \
+  template void ImageAndKernel \
+  ( const Matrix<Field>& B, \
+          Matrix<Field>& M, \
+          Matrix<Field>& K, \
+    const RankRevealCtrl<Base<Field>>& ctrl ); \
+  template void ImageAndKernel \
+  ( const AbstractDistMatrix<Field>& B, \
+          AbstractDistMatrix<Field>& M, \
+          AbstractDistMatrix<Field>& K, \
+    const RankRevealCtrl<Base<Field>>& ctrl ); \
+  template void Image \
+  ( const Matrix<Field>& B, \
+          Matrix<Field>& M, \
+    const RankRevealCtrl<Base<Field>>& ctrl ); \
+  template void Image \
+  ( const AbstractDistMatrix<Field>& B, \
+          AbstractDistMatrix<Field>& M, \
+    const RankRevealCtrl<Base<Field>>& ctrl ); \
+  template void Kernel \
+  ( const Matrix<Field>& B, \
+          Matrix<Field>& K, \
+    const RankRevealCtrl<Base<Field>>& ctrl ); \
+  template void Kernel \
+  ( const AbstractDistMatrix<Field>& B, \
+          AbstractDistMatrix<Field>& K, \
+    const RankRevealCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
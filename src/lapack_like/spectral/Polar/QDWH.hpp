@@ -24,6 +24,55 @@ namespace El {
 
 namespace polar {
 
+// Overwrite ATemp with A inv(C), where the lower triangle of C holds the
+// well-conditioned Gram matrix I + c A^H A of a Cholesky-based iteration
+template<typename F>
+void CholeskySolve
+( Matrix<F>& C, const Matrix<F>& A, Matrix<F>& ATemp, const QDWHCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.mixedPrecision )
+    {
+        // Solve C X = A^H with a low-precision factorization of C
+        Matrix<F> X;
+        Adjoint( A, X );
+        HPDSolve( LOWER, NORMAL, C, X, MixedPrecisionCtrl<Base<F>>() );
+        Adjoint( X, ATemp );
+    }
+    else
+    {
+        Cholesky( LOWER, C );
+        ATemp = A;
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
+        Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
+    }
+}
+
+template<typename F>
+void CholeskySolve
+(       DistMatrix<F>& C,
+  const DistMatrix<F>& A,
+        DistMatrix<F>& ATemp,
+  const QDWHCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.mixedPrecision )
+    {
+        // Solve C X = A^H with a low-precision factorization of C
+        DistMatrix<F> X(A.Grid());
+        Adjoint( A, X );
+        HPDSolve( LOWER, NORMAL, C, X, MixedPrecisionCtrl<Base<F>>() );
+        Adjoint( X, ATemp );
+    }
+    else
+    {
+        Cholesky( LOWER, C );
+        ATemp = A;
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
+        Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
+    }
+}
+
 template<typename F>
 QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
 {
@@ -97,10 +146,7 @@ QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
             //
             Identity( C, n, n );
             Herk( LOWER, ADJOINT, c, A, Real(1), C );
-            Cholesky( LOWER, C );
-            ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
-            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
+            CholeskySolve( C, A, ATemp, ctrl );
             A *= beta;
             Axpy( alpha, ATemp, A );
             ++info.numCholIts;
@@ -156,8 +202,9 @@ QDWHInfo QDWH( Matrix<F>& A, Matrix<F>& P, const QDWHCtrl& ctrl )
     EL_DEBUG_CSE
     Matrix<F> ACopy( A );
     auto info = QDWH( A, ctrl );
-    Zeros( P, A.Height(), A.Height() );
-    Trrk( LOWER, NORMAL, NORMAL, F(1), A, ACopy, F(0), P );
+    // P := Q^H A
+    Zeros( P, A.Width(), A.Width() );
+    Trrk( LOWER, ADJOINT, NORMAL, F(1), A, ACopy, F(0), P );
     MakeHermitian( LOWER, P );
     return info;
 }
@@ -243,10 +290,7 @@ QDWHInner
             //
             Identity( C, n, n );
             Herk( LOWER, ADJOINT, c, A, Real(1), C );
-            Cholesky( LOWER, C );
-            ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
-            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
+            CholeskySolve( C, A, ATemp, ctrl );
             A *= beta;
             Axpy( alpha, ATemp, A );
             ++info.numCholIts;
@@ -317,8 +361,9 @@ QDWH
 
     DistMatrix<F> ACopy( A );
     auto info = QDWH( A, ctrl );
-    Zeros( P, A.Height(), A.Height() );
-    Trrk( LOWER, NORMAL, NORMAL, F(1), A, ACopy, F(0), P );
+    // P := Q^H A
+    Zeros( P, A.Width(), A.Width() );
+    Trrk( LOWER, ADJOINT, NORMAL, F(1), A, ACopy, F(0), P );
     MakeHermitian( LOWER, P );
     return info;
 }
@@ -327,6 +372,8 @@ QDWH
 
 namespace herm_polar {
 
+using El::polar::CholeskySolve;
+
 template<typename F>
 QDWHInfo
 QDWHInner
@@ -411,10 +458,7 @@ QDWHInner
             MakeHermitian( uplo, A );
             Identity( C, n, n );
             Herk( LOWER, ADJOINT, c, A, Real(1), C );
-            Cholesky( LOWER, C );
-            ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
-            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
+            CholeskySolve( C, A, ATemp, ctrl );
             A *= beta;
             Axpy( alpha, ATemp, A );
             ++info.numCholIts;
@@ -563,10 +607,7 @@ QDWHInner
             MakeHermitian( uplo, A );
             Identity( C, n, n );
             Herk( LOWER, ADJOINT, c, A, Real(1), C );
-            Cholesky( LOWER, C );
-            ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
-            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
+            CholeskySolve( C, A, ATemp, ctrl );
             A *= beta;
             Axpy( alpha, ATemp, A );
             ++info.numCholIts;
@@ -14,6 +14,8 @@
 #include "./Pseudospectra/IRA.hpp"
 #include "./Pseudospectra/IRL.hpp"
 #include "./Pseudospectra/Analytic.hpp"
+#include "./Pseudospectra/Farm.hpp"
+#include "./Pseudospectra/Adaptive.hpp"
 
 // For one-norm pseudospectra. An adaptation of the more robust algorithm of
 // Higham and Tisseur will hopefully be implemented soon.
@@ -315,6 +317,17 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
     }
 
     psCtrl.schur = true;
+    if( psCtrl.numSubgrids > 1 )
+    {
+        auto cloud =
+          []( const DistMatrix<C>& USub,
+              const DistMatrix<C,VR,STAR>& shiftsSub,
+                    DistMatrix<Real,VR,STAR>& invNormsSub,
+              const PseudospecCtrl<Real>& subCtrl )
+          { return TriangularSpectralCloud
+                   ( USub, shiftsSub, invNormsSub, subCtrl ); };
+        return pspec::SubgridCloud( U, shifts, invNorms, psCtrl, cloud );
+    }
     if( psCtrl.norm == PS_TWO_NORM )
     {
         if( psCtrl.arnoldi )
@@ -373,6 +386,24 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
     }
 
     psCtrl.schur = true;
+    if( psCtrl.numSubgrids > 1 )
+    {
+        // Q is only needed for one-norm pseudospectra
+        if( psCtrl.norm == PS_TWO_NORM )
+            return TriangularSpectralCloud( U, shifts, invNorms, psCtrl );
+        DistMatrixReadProxy<Field,C,MC,MR> QProx( QPre );
+        auto& Q = QProx.GetLocked();
+        auto cloud =
+          []( const DistMatrix<C>& USub,
+              const DistMatrix<C>& QSub,
+              const DistMatrix<C,VR,STAR>& shiftsSub,
+                    DistMatrix<Real,VR,STAR>& invNormsSub,
+              const PseudospecCtrl<Real>& subCtrl )
+          { return TriangularSpectralCloud
+                   ( USub, QSub, shiftsSub, invNormsSub, subCtrl ); };
+        return pspec::SubgridCloud
+               ( U, Q, shifts, invNorms, psCtrl, cloud );
+    }
     if( psCtrl.norm == PS_TWO_NORM )
     {
         if( psCtrl.arnoldi )
@@ -437,6 +468,17 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
     psCtrl.schur = true;
     if( psCtrl.norm == PS_ONE_NORM )
         LogicError("This option is not yet written");
+    if( psCtrl.numSubgrids > 1 )
+    {
+        auto cloud =
+          []( const DistMatrix<Real>& USub,
+              const DistMatrix<C,VR,STAR>& shiftsSub,
+                    DistMatrix<Real,VR,STAR>& invNormsSub,
+              const PseudospecCtrl<Real>& subCtrl )
+          { return QuasiTriangularSpectralCloud
+                   ( USub, shiftsSub, invNormsSub, subCtrl ); };
+        return pspec::SubgridCloud( U, shifts, invNorms, psCtrl, cloud );
+    }
     return pspec::IRA( U, shifts, invNorms, psCtrl );
 }
 
@@ -483,6 +525,8 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
     psCtrl.schur = true;
     if( psCtrl.norm == PS_ONE_NORM )
         LogicError("This option is not yet written");
+    if( psCtrl.numSubgrids > 1 )
+        return QuasiTriangularSpectralCloud( U, shifts, invNorms, psCtrl );
     return pspec::IRA( U, shifts, invNorms, psCtrl );
 }
 
@@ -508,6 +552,17 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
     // TODO: Check if the subdiagonal is sufficiently small, and, if so, revert
     //       to TriangularSpectralCloud
     psCtrl.schur = false;
+    if( psCtrl.numSubgrids > 1 )
+    {
+        auto cloud =
+          []( const DistMatrix<C>& HSub,
+              const DistMatrix<C,VR,STAR>& shiftsSub,
+                    DistMatrix<Real,VR,STAR>& invNormsSub,
+              const PseudospecCtrl<Real>& subCtrl )
+          { return HessenbergSpectralCloud
+                   ( HSub, shiftsSub, invNormsSub, subCtrl ); };
+        return pspec::SubgridCloud( H, shifts, invNorms, psCtrl, cloud );
+    }
     if( psCtrl.norm == PS_TWO_NORM )
     {
         if( psCtrl.arnoldi )
@@ -547,6 +602,24 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
     // TODO: Check if the subdiagonal is sufficiently small, and, if so, revert
     //       to TriangularSpectralCloud
     psCtrl.schur = false;
+    if( psCtrl.numSubgrids > 1 )
+    {
+        // Q is only needed for one-norm pseudospectra
+        if( psCtrl.norm == PS_TWO_NORM )
+            return HessenbergSpectralCloud( H, shifts, invNorms, psCtrl );
+        DistMatrixReadProxy<Field,C,MC,MR> QProx( QPre );
+        auto& Q = QProx.GetLocked();
+        auto cloud =
+          []( const DistMatrix<C>& HSub,
+              const DistMatrix<C>& QSub,
+              const DistMatrix<C,VR,STAR>& shiftsSub,
+                    DistMatrix<Real,VR,STAR>& invNormsSub,
+              const PseudospecCtrl<Real>& subCtrl )
+          { return HessenbergSpectralCloud
+                   ( HSub, QSub, shiftsSub, invNormsSub, subCtrl ); };
+        return pspec::SubgridCloud
+               ( H, Q, shifts, invNorms, psCtrl, cloud );
+    }
     if( psCtrl.norm == PS_TWO_NORM )
     {
         if( psCtrl.arnoldi )
@@ -818,6 +891,17 @@ Matrix<Int> TriangularSpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& batchCtrl )
+          { return TriangularSpectralCloud( U, shifts, invNorms, batchCtrl ); };
+        return pspec::AdaptiveWindow
+          ( invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+            psCtrl, cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -863,6 +947,20 @@ Matrix<Int> TriangularSpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& batchCtrl )
+          {
+              return TriangularSpectralCloud
+                     ( U, Q, shifts, invNorms, batchCtrl );
+          };
+        return pspec::AdaptiveWindow
+          ( invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+            psCtrl, cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -906,6 +1004,20 @@ Matrix<Int> QuasiTriangularSpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& batchCtrl )
+          {
+              return QuasiTriangularSpectralCloud
+                     ( U, shifts, invNorms, batchCtrl );
+          };
+        return pspec::AdaptiveWindow
+          ( invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+            psCtrl, cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -950,6 +1062,20 @@ Matrix<Int> QuasiTriangularSpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& batchCtrl )
+          {
+              return QuasiTriangularSpectralCloud
+                     ( U, Q, shifts, invNorms, batchCtrl );
+          };
+        return pspec::AdaptiveWindow
+          ( invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+            psCtrl, cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -995,6 +1121,17 @@ Matrix<Int> HessenbergSpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& batchCtrl )
+          { return HessenbergSpectralCloud( H, shifts, invNorms, batchCtrl ); };
+        return pspec::AdaptiveWindow
+          ( invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+            psCtrl, cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -1040,6 +1177,20 @@ Matrix<Int> HessenbergSpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& batchCtrl )
+          {
+              return HessenbergSpectralCloud
+                     ( H, Q, shifts, invNorms, batchCtrl );
+          };
+        return pspec::AdaptiveWindow
+          ( invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+            psCtrl, cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -1085,6 +1236,18 @@ DistMatrix<Int> TriangularSpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const AbstractDistMatrix<C>& shifts,
+                     AbstractDistMatrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& batchCtrl )
+          { return TriangularSpectralCloud( U, shifts, invNorms, batchCtrl ); };
+        return pspec::AdaptiveWindow
+          ( g, invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+            psCtrl, cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -1134,6 +1297,21 @@ DistMatrix<Int> TriangularSpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const AbstractDistMatrix<C>& shifts,
+                     AbstractDistMatrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& batchCtrl )
+          {
+              return TriangularSpectralCloud
+                     ( U, Q, shifts, invNorms, batchCtrl );
+          };
+        return pspec::AdaptiveWindow
+          ( g, invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+            psCtrl, cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -1181,6 +1359,21 @@ DistMatrix<Int> QuasiTriangularSpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const AbstractDistMatrix<C>& shifts,
+                     AbstractDistMatrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& batchCtrl )
+          {
+              return QuasiTriangularSpectralCloud
+                     ( U, shifts, invNorms, batchCtrl );
+          };
+        return pspec::AdaptiveWindow
+          ( g, invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+            psCtrl, cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -1229,6 +1422,21 @@ DistMatrix<Int> QuasiTriangularSpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const AbstractDistMatrix<C>& shifts,
+                     AbstractDistMatrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& batchCtrl )
+          {
+              return QuasiTriangularSpectralCloud
+                     ( U, Q, shifts, invNorms, batchCtrl );
+          };
+        return pspec::AdaptiveWindow
+          ( g, invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+            psCtrl, cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -1278,6 +1486,18 @@ DistMatrix<Int> HessenbergSpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const AbstractDistMatrix<C>& shifts,
+                     AbstractDistMatrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& batchCtrl )
+          { return HessenbergSpectralCloud( H, shifts, invNorms, batchCtrl ); };
+        return pspec::AdaptiveWindow
+          ( g, invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+            psCtrl, cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -1327,6 +1547,21 @@ DistMatrix<Int> HessenbergSpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const AbstractDistMatrix<C>& shifts,
+                     AbstractDistMatrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& batchCtrl )
+          {
+              return HessenbergSpectralCloud
+                     ( H, Q, shifts, invNorms, batchCtrl );
+          };
+        return pspec::AdaptiveWindow
+          ( g, invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+            psCtrl, cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -1374,6 +1609,17 @@ Matrix<Int> SpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& batchCtrl )
+          { return SpectralCloud( A, shifts, invNorms, batchCtrl ); };
+        return pspec::AdaptiveWindow
+          ( invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+            psCtrl, cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -1419,6 +1665,18 @@ DistMatrix<Int> SpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const AbstractDistMatrix<C>& shifts,
+                     AbstractDistMatrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& batchCtrl )
+          { return SpectralCloud( A, shifts, invNorms, batchCtrl ); };
+        return pspec::AdaptiveWindow
+          ( g, invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+            psCtrl, cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
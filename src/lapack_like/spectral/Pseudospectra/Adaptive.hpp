@@ -0,0 +1,311 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOSPECTRA_ADAPTIVE_HPP
+#define EL_PSEUDOSPECTRA_ADAPTIVE_HPP
+
+namespace El {
+namespace pspec {
+
+// Rather than computing the pseudospectral estimate at every pixel of a
+// realSize x imagSize window, begin with a coarse lattice of pixels spaced
+// psCtrl.adaptiveStride apart and recursively bisect only the cells whose
+// corner values of log10(epsilon) straddle one of the requested contours.
+// Each level of the quadtree sends all of its new corners to the cloud
+// routine at once, so that the multi-shift triangular solves still operate
+// on large batches of shifts. The pixels which were never sampled are
+// bilinearly interpolated (in log10(epsilon)) from the corners of the
+// unrefined cell containing them and are given an iteration count of zero.
+
+struct AdaptiveCell
+{
+    Int x0, x1, y0, y1;
+};
+
+template<typename Real>
+bool StraddlesContour
+( const Real* levels, const vector<Real>& contours )
+{
+    Real minLevel=levels[0], maxLevel=levels[0];
+    for( Int k=0; k<4; ++k )
+    {
+        // Corners which coincide with (or are numerically at) an eigenvalue
+        // always force a refinement
+        if( !limits::IsFinite(levels[k]) )
+            return true;
+        minLevel = Min( minLevel, levels[k] );
+        maxLevel = Max( maxLevel, levels[k] );
+    }
+    if( contours.size() == 0 )
+        return Floor(minLevel) != Floor(maxLevel);
+    for( const auto& contour : contours )
+        if( minLevel < contour && contour <= maxLevel )
+            return true;
+    return false;
+}
+
+template<typename Real,typename CloudFunc>
+void AdaptiveSample
+( Int realSize,
+  Int imagSize,
+  Complex<Real> center,
+  Real realWidth,
+  Real imagWidth,
+  const PseudospecCtrl<Real>& psCtrl,
+        CloudFunc cloud,
+        Matrix<Real>& invNorms,
+        Matrix<Int>& itCounts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    if( psCtrl.adaptiveStride < 1 )
+        LogicError("Adaptive stride must be positive");
+    const Int stride = psCtrl.adaptiveStride;
+    const Int numPixels = realSize*imagSize;
+    const Real realStep = realWidth/realSize;
+    const Real imagStep = imagWidth/imagSize;
+    const C corner = center + C(-realWidth/2,imagWidth/2);
+    const Real logTen = Log( Real(10) );
+
+    // The individual batches should neither trigger snapshots with the
+    // wrong dimensions nor recursively refine
+    auto batchCtrl( psCtrl );
+    batchCtrl.adaptive = false;
+    batchCtrl.snapCtrl.realSize = 0;
+    batchCtrl.snapCtrl.imagSize = 0;
+
+    // The entries are indexed by x*imagSize+y in order to match the ordering
+    // used by ReshapeIntoGrid
+    Zeros( invNorms, numPixels, 1 );
+    Zeros( itCounts, numPixels, 1 );
+    Matrix<Real> levels;
+    Zeros( levels, numPixels, 1 );
+    Matrix<Int> sampled;
+    Zeros( sampled, numPixels, 1 );
+
+    auto breakpoints = [&]( Int size )
+    {
+        vector<Int> points;
+        for( Int i=0; i<size-1; i+=stride )
+            points.push_back( i );
+        points.push_back( size-1 );
+        return points;
+    };
+    const auto xPoints = breakpoints( realSize );
+    const auto yPoints = breakpoints( imagSize );
+    const Int numXCells = Max( Int(xPoints.size())-1, 1 );
+    const Int numYCells = Max( Int(yPoints.size())-1, 1 );
+    vector<AdaptiveCell> active, leaves;
+    for( Int i=0; i<numXCells; ++i )
+    {
+        const Int x0 = xPoints[i];
+        const Int x1 = xPoints[Min(i+1,Int(xPoints.size())-1)];
+        for( Int j=0; j<numYCells; ++j )
+        {
+            const Int y0 = yPoints[j];
+            const Int y1 = yPoints[Min(j+1,Int(yPoints.size())-1)];
+            active.push_back( AdaptiveCell{x0,x1,y0,y1} );
+        }
+    }
+
+    Int level=0, numSampled=0;
+    while( active.size() > 0 )
+    {
+        // Gather the corners which have not yet been sampled
+        vector<Int> newPixels;
+        for( const auto& cell : active )
+        {
+            const Int xs[2] = { cell.x0, cell.x1 };
+            const Int ys[2] = { cell.y0, cell.y1 };
+            for( Int s=0; s<2; ++s )
+                for( Int t=0; t<2; ++t )
+                {
+                    const Int pixel = xs[s]*imagSize + ys[t];
+                    if( !sampled(pixel) )
+                    {
+                        sampled(pixel) = 1;
+                        newPixels.push_back( pixel );
+                    }
+                }
+        }
+
+        // Compute the new estimates as a single batch
+        const Int numNew = newPixels.size();
+        if( numNew > 0 )
+        {
+            Matrix<C> shifts( numNew, 1 );
+            for( Int k=0; k<numNew; ++k )
+            {
+                const Int x = newPixels[k] / imagSize;
+                const Int y = newPixels[k] % imagSize;
+                shifts(k) = corner+C((x+0.5)*realStep,-(y+0.5)*imagStep);
+            }
+            Matrix<Real> newInvNorms;
+            auto newItCounts = cloud( shifts, newInvNorms, batchCtrl );
+            for( Int k=0; k<numNew; ++k )
+            {
+                const Int pixel = newPixels[k];
+                invNorms(pixel) = newInvNorms(k);
+                itCounts(pixel) = newItCounts(k);
+                levels(pixel) = -Log(newInvNorms(k))/logTen;
+            }
+            numSampled += numNew;
+        }
+        if( progress )
+            Output
+            ("Adaptive level ",level,": ",numNew," new shifts (",numSampled,
+             " of ",numPixels," sampled)");
+
+        // Bisect each cell which straddles a contour
+        vector<AdaptiveCell> next;
+        for( const auto& cell : active )
+        {
+            const Int xDiff = cell.x1 - cell.x0;
+            const Int yDiff = cell.y1 - cell.y0;
+            if( xDiff <= 1 && yDiff <= 1 )
+                continue;
+            const Real cornerLevels[4] =
+              { levels(cell.x0*imagSize+cell.y0),
+                levels(cell.x0*imagSize+cell.y1),
+                levels(cell.x1*imagSize+cell.y0),
+                levels(cell.x1*imagSize+cell.y1) };
+            if( !StraddlesContour( cornerLevels, psCtrl.contours ) )
+            {
+                leaves.push_back( cell );
+                continue;
+            }
+            vector<Int> xs{ cell.x0 }, ys{ cell.y0 };
+            if( xDiff > 1 )
+                xs.push_back( (cell.x0+cell.x1)/2 );
+            if( yDiff > 1 )
+                ys.push_back( (cell.y0+cell.y1)/2 );
+            xs.push_back( cell.x1 );
+            ys.push_back( cell.y1 );
+            for( size_t s=0; s+1<xs.size(); ++s )
+                for( size_t t=0; t+1<ys.size(); ++t )
+                    next.push_back
+                    ( AdaptiveCell{xs[s],xs[s+1],ys[t],ys[t+1]} );
+        }
+        active.swap( next );
+        ++level;
+    }
+
+    // Interpolate the remaining pixels from the corners of their cells
+    for( const auto& cell : leaves )
+    {
+        const Real l00 = levels(cell.x0*imagSize+cell.y0);
+        const Real l01 = levels(cell.x0*imagSize+cell.y1);
+        const Real l10 = levels(cell.x1*imagSize+cell.y0);
+        const Real l11 = levels(cell.x1*imagSize+cell.y1);
+        const Real xDiff = cell.x1 - cell.x0;
+        const Real yDiff = cell.y1 - cell.y0;
+        for( Int x=cell.x0; x<=cell.x1; ++x )
+        {
+            const Real s = ( xDiff == Real(0) ? Real(0) : (x-cell.x0)/xDiff );
+            for( Int y=cell.y0; y<=cell.y1; ++y )
+            {
+                const Int pixel = x*imagSize + y;
+                if( sampled(pixel) )
+                    continue;
+                const Real t =
+                  ( yDiff == Real(0) ? Real(0) : (y-cell.y0)/yDiff );
+                const Real interp = (1-s)*((1-t)*l00 + t*l01) +
+                                       s *((1-t)*l10 + t*l11);
+                invNorms(pixel) = Pow( Real(10), -interp );
+            }
+        }
+    }
+}
+
+template<typename Real,typename CloudFunc>
+Matrix<Int> AdaptiveWindow
+(       Matrix<Real>& invNormMap,
+  Complex<Real> center,
+  Real realWidth,
+  Real imagWidth,
+  Int realSize,
+  Int imagSize,
+  PseudospecCtrl<Real>& psCtrl,
+        CloudFunc cloud )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> invNorms;
+    Matrix<Int> itCounts;
+    AdaptiveSample
+    ( realSize, imagSize, center, realWidth, imagWidth, psCtrl, cloud,
+      invNorms, itCounts, psCtrl.progress );
+    FinalSnapshot( invNorms, itCounts, psCtrl.snapCtrl );
+
+    Matrix<Int> itCountMap;
+    ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
+    ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
+    return itCountMap;
+}
+
+// Every process redundantly drives the (inexpensive) quadtree logic, while
+// each batch of shifts is handed to the distributed cloud routine
+template<typename Real,typename CloudFunc>
+DistMatrix<Int> AdaptiveWindow
+( const Grid& g,
+        AbstractDistMatrix<Real>& invNormMap,
+  Complex<Real> center,
+  Real realWidth,
+  Real imagWidth,
+  Int realSize,
+  Int imagSize,
+  PseudospecCtrl<Real>& psCtrl,
+        CloudFunc cloud )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+
+    auto replicatedCloud =
+      [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+           const PseudospecCtrl<Real>& batchCtrl )
+      {
+          DistMatrix<C,VR,STAR> shiftsDist( shifts.Height(), 1, g );
+          for( Int iLoc=0; iLoc<shiftsDist.LocalHeight(); ++iLoc )
+              shiftsDist.SetLocal
+              ( iLoc, 0, shifts(shiftsDist.GlobalRow(iLoc)) );
+          DistMatrix<Real,VR,STAR> invNormsDist(g);
+          auto itCountsDist = cloud( shiftsDist, invNormsDist, batchCtrl );
+
+          DistMatrix<Real,STAR,STAR> invNorms_STAR_STAR( invNormsDist );
+          DistMatrix<Int,STAR,STAR> itCounts_STAR_STAR( itCountsDist );
+          invNorms = invNorms_STAR_STAR.Matrix();
+          return Matrix<Int>( itCounts_STAR_STAR.Matrix() );
+      };
+    Matrix<Real> invNormsLoc;
+    Matrix<Int> itCountsLoc;
+    AdaptiveSample
+    ( realSize, imagSize, center, realWidth, imagWidth, psCtrl,
+      replicatedCloud, invNormsLoc, itCountsLoc,
+      psCtrl.progress && g.Rank() == 0 );
+
+    const Int numPixels = realSize*imagSize;
+    DistMatrix<Real,VR,STAR> invNorms( numPixels, 1, g );
+    DistMatrix<Int,VR,STAR> itCounts( numPixels, 1, g );
+    for( Int iLoc=0; iLoc<invNorms.LocalHeight(); ++iLoc )
+    {
+        const Int i = invNorms.GlobalRow(iLoc);
+        invNorms.SetLocal( iLoc, 0, invNormsLoc(i) );
+        itCounts.SetLocal( iLoc, 0, itCountsLoc(i) );
+    }
+    FinalSnapshot( invNorms, itCounts, psCtrl.snapCtrl );
+
+    DistMatrix<Int> itCountMap(g);
+    ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
+    ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
+    return itCountMap;
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_ADAPTIVE_HPP
@@ -0,0 +1,316 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOSPECTRA_FARM_HPP
+#define EL_PSEUDOSPECTRA_FARM_HPP
+
+namespace El {
+namespace pspec {
+
+// Rather than processing every shift collectively on the full grid, split
+// the grid into independent subgrids, each of which holds a copy of the
+// (quasi-)triangular or Hessenberg matrix, and farm out chunks of shifts:
+//
+//  1) The root of subgrid 0 also acts as a dispatcher which hands out the
+//     chunks in order, servicing any pending requests in between its own
+//     chunks.
+//
+//  2) The root of every other subgrid requests its next chunk before
+//     starting on its current one, so that its request is only delayed if
+//     it finishes a chunk before the dispatcher finishes its own, and
+//     broadcasts each chunk index over its subgrid.
+//
+//  3) Each process records the results for the shifts that it owned within
+//     its subgrid, and a single summation over the full grid assembles them.
+
+const int FARM_REQUEST_TAG = 0;
+const int FARM_REPLY_TAG = 1;
+
+// Split the processes of 'grid' into 'numSubgrids' contiguous subgrids and
+// return the index of the one containing this process
+inline Int FarmGrids
+( const Grid& grid, Int numSubgrids, vector<unique_ptr<Grid>>& subgrids )
+{
+    EL_DEBUG_CSE
+    const Int p = grid.Size();
+    mpi::Group owningGroup = grid.OwningGroup();
+    subgrids.resize( numSubgrids );
+    Int offset = 0, mySubgrid = -1;
+    for( Int q=0; q<numSubgrids; ++q )
+    {
+        const Int subgridSize =
+          p/numSubgrids + ( q < p % numSubgrids ? 1 : 0 );
+        vector<int> ranks( subgridSize );
+        for( Int r=0; r<subgridSize; ++r )
+            ranks[r] = offset + r;
+        mpi::Group subgroup;
+        mpi::Incl( owningGroup, subgridSize, ranks.data(), subgroup );
+        subgrids[q].reset
+        ( new Grid
+          ( grid.VCComm(), subgroup, Grid::DefaultHeight(subgridSize) ) );
+        mpi::Free( subgroup );
+        if( subgrids[q]->InGrid() )
+            mySubgrid = q;
+        offset += subgridSize;
+    }
+    return mySubgrid;
+}
+
+// Give each subgrid a copy of A
+template<typename F>
+void Replicate
+( const DistMatrix<F>& A,
+  const vector<unique_ptr<Grid>>& subgrids,
+        Int mySubgrid,
+        DistMatrix<F>& ASub )
+{
+    EL_DEBUG_CSE
+    const Int numSubgrids = subgrids.size();
+    for( Int q=0; q<numSubgrids; ++q )
+    {
+        if( q == mySubgrid )
+        {
+            ASub = A;
+        }
+        else
+        {
+            DistMatrix<F> AOther( *subgrids[q] );
+            AOther = A;
+        }
+    }
+}
+
+// 'solve' should compute the inverse norms for the given shifts on this
+// process's subgrid and return the corresponding iteration counts
+template<typename Real,class SolveType>
+DistMatrix<Int,VR,STAR> FarmShifts
+( const Grid& grid,
+  const vector<unique_ptr<Grid>>& subgrids,
+        Int mySubgrid,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+        AbstractDistMatrix<Real>& invNormsPre,
+        PseudospecCtrl<Real> psCtrl,
+  const SolveType& solve )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Int numSubgrids = subgrids.size();
+    const Grid& subgrid = *subgrids[mySubgrid];
+    const Int numShifts = shifts.Height();
+    const Int chunkSize =
+      ( psCtrl.chunkSize > 0 ?
+        psCtrl.chunkSize : Max(numShifts/(4*numSubgrids),Int(1)) );
+    const Int numChunks = (numShifts+chunkSize-1) / chunkSize;
+    if( psCtrl.progress && grid.Rank() == 0 )
+        Output
+        ("Farming ",numChunks," chunks of up to ",chunkSize," shifts to ",
+         numSubgrids," subgrids");
+
+    // The subproblems should neither recurse nor take snapshots
+    auto subCtrl( psCtrl );
+    subCtrl.numSubgrids = 1;
+    subCtrl.progress = false;
+    subCtrl.snapCtrl.realSize = subCtrl.snapCtrl.imagSize = 0;
+
+    DistMatrix<C,STAR,STAR> shifts_STAR_STAR( shifts );
+    Matrix<Real> invNormsAll;
+    Matrix<Int> itCountsAll;
+    Zeros( invNormsAll, numShifts, 1 );
+    Zeros( itCountsAll, numShifts, 1 );
+
+    // The requests are exchanged over a duplicate of the grid's communicator
+    // so that they cannot be confused with any other messages
+    mpi::Comm comm;
+    mpi::Dup( grid.VCComm(), comm );
+    const int dispatcher = subgrids[0]->VCToViewing(0);
+    const bool isDispatcher = ( mpi::Rank(comm) == dispatcher );
+    const bool isSubgridRoot = ( subgrid.VCRank() == 0 );
+
+    // Each request contains the index of the requesting subgrid
+    Int nextChunk = 0;
+    vector<bool> retired( numSubgrids, false );
+    auto reply = [&]( int source )
+      {
+          const Int q =
+            mpi::TaggedRecv<Int>( source, FARM_REQUEST_TAG, comm );
+          Int chunk = -1;
+          if( nextChunk < numChunks )
+              chunk = nextChunk++;
+          else
+              retired[q] = true;
+          mpi::TaggedSend( chunk, source, FARM_REPLY_TAG, comm );
+      };
+
+    Int chunk = -1;
+    Int requestBuf = mySubgrid, replyBuf = -1;
+    mpi::Request<Int> sendRequest, recvRequest;
+    if( isDispatcher )
+    {
+        if( nextChunk < numChunks )
+            chunk = nextChunk++;
+    }
+    else if( isSubgridRoot )
+    {
+        mpi::TaggedSend( requestBuf, dispatcher, FARM_REQUEST_TAG, comm );
+        chunk = mpi::TaggedRecv<Int>( dispatcher, FARM_REPLY_TAG, comm );
+    }
+    mpi::Broadcast( chunk, 0, subgrid.VCComm() );
+
+    Timer timer;
+    while( chunk >= 0 )
+    {
+        // Request the next chunk (or, as the dispatcher, answer requests)
+        // before starting on this one
+        if( isDispatcher )
+        {
+            mpi::Status status;
+            while( mpi::IProbe
+                   ( mpi::ANY_SOURCE, FARM_REQUEST_TAG, comm, status ) )
+                reply( status.MPI_SOURCE );
+        }
+        else if( isSubgridRoot )
+        {
+            mpi::TaggedISend
+            ( &requestBuf, 1, dispatcher, FARM_REQUEST_TAG, comm,
+              sendRequest );
+            mpi::TaggedIRecv
+            ( &replyBuf, 1, dispatcher, FARM_REPLY_TAG, comm, recvRequest );
+        }
+
+        if( psCtrl.progress && isSubgridRoot )
+            timer.Start();
+        const Int chunkBeg = chunk*chunkSize;
+        const Int chunkEnd = Min( chunkBeg+chunkSize, numShifts );
+        DistMatrix<C,VR,STAR> shiftsSub( chunkEnd-chunkBeg, 1, subgrid );
+        const Int numLocShifts = shiftsSub.LocalHeight();
+        for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
+        {
+            const Int i = chunkBeg + shiftsSub.GlobalRow(iLoc);
+            shiftsSub.SetLocal( iLoc, 0, shifts_STAR_STAR.GetLocal(i,0) );
+        }
+        DistMatrix<Real,VR,STAR> invNormsSub( subgrid );
+        auto itCountsSub = solve( shiftsSub, invNormsSub, subCtrl );
+        for( Int iLoc=0; iLoc<invNormsSub.LocalHeight(); ++iLoc )
+        {
+            const Int i = chunkBeg + invNormsSub.GlobalRow(iLoc);
+            invNormsAll(i) = invNormsSub.GetLocal(iLoc,0);
+        }
+        for( Int iLoc=0; iLoc<itCountsSub.LocalHeight(); ++iLoc )
+        {
+            const Int i = chunkBeg + itCountsSub.GlobalRow(iLoc);
+            itCountsAll(i) = itCountsSub.GetLocal(iLoc,0);
+        }
+        if( psCtrl.progress && isSubgridRoot )
+            Output
+            ("Subgrid ",mySubgrid," finished chunk ",chunk," (shifts ",
+             chunkBeg," through ",chunkEnd-1,") in ",timer.Stop(),
+             " seconds");
+
+        if( isDispatcher )
+        {
+            chunk = -1;
+            if( nextChunk < numChunks )
+                chunk = nextChunk++;
+        }
+        else if( isSubgridRoot )
+        {
+            mpi::Wait( sendRequest );
+            mpi::Wait( recvRequest );
+            chunk = replyBuf;
+        }
+        mpi::Broadcast( chunk, 0, subgrid.VCComm() );
+    }
+
+    // Every other subgrid root has exactly one more request to make
+    if( isDispatcher )
+    {
+        for( Int q=1; q<numSubgrids; ++q )
+            if( !retired[q] )
+                reply( subgrids[q]->VCToViewing(0) );
+    }
+    mpi::Free( comm );
+
+    mpi::AllReduce( invNormsAll.Buffer(), numShifts, grid.VCComm() );
+    mpi::AllReduce( itCountsAll.Buffer(), numShifts, grid.VCComm() );
+
+    DistMatrixWriteProxy<Real,Real,VR,STAR> invNormsProx( invNormsPre );
+    auto& invNorms = invNormsProx.Get();
+    DistMatrix<Int,VR,STAR> itCounts( grid );
+    invNorms.AlignWith( shifts );
+    itCounts.AlignWith( shifts );
+    invNorms.Resize( numShifts, 1 );
+    itCounts.Resize( numShifts, 1 );
+    const Int numLocShifts = shifts.LocalHeight();
+    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
+    {
+        const Int i = shifts.GlobalRow(iLoc);
+        invNorms.SetLocal( iLoc, 0, invNormsAll(i) );
+        itCounts.SetLocal( iLoc, 0, itCountsAll(i) );
+    }
+    FinalSnapshot( invNorms, itCounts, psCtrl.snapCtrl );
+    return itCounts;
+}
+
+template<typename F,typename Real,class CloudType>
+DistMatrix<Int,VR,STAR> SubgridCloud
+( const DistMatrix<F>& U,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+        AbstractDistMatrix<Real>& invNorms,
+  const PseudospecCtrl<Real>& psCtrl,
+  const CloudType& cloud )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Grid& grid = U.Grid();
+    const Int numSubgrids = Min( psCtrl.numSubgrids, Int(grid.Size()) );
+    vector<unique_ptr<Grid>> subgrids;
+    const Int mySubgrid = FarmGrids( grid, numSubgrids, subgrids );
+    DistMatrix<F> USub( *subgrids[mySubgrid] );
+    Replicate( U, subgrids, mySubgrid, USub );
+
+    auto solve =
+      [&]( const DistMatrix<C,VR,STAR>& shiftsSub,
+                 DistMatrix<Real,VR,STAR>& invNormsSub,
+           const PseudospecCtrl<Real>& subCtrl )
+      { return cloud( USub, shiftsSub, invNormsSub, subCtrl ); };
+    return FarmShifts
+      ( grid, subgrids, mySubgrid, shifts, invNorms, psCtrl, solve );
+}
+
+template<typename F,typename Real,class CloudType>
+DistMatrix<Int,VR,STAR> SubgridCloud
+( const DistMatrix<F>& U,
+  const DistMatrix<F>& Q,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+        AbstractDistMatrix<Real>& invNorms,
+  const PseudospecCtrl<Real>& psCtrl,
+  const CloudType& cloud )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Grid& grid = U.Grid();
+    const Int numSubgrids = Min( psCtrl.numSubgrids, Int(grid.Size()) );
+    vector<unique_ptr<Grid>> subgrids;
+    const Int mySubgrid = FarmGrids( grid, numSubgrids, subgrids );
+    DistMatrix<F> USub( *subgrids[mySubgrid] ), QSub( *subgrids[mySubgrid] );
+    Replicate( U, subgrids, mySubgrid, USub );
+    Replicate( Q, subgrids, mySubgrid, QSub );
+
+    auto solve =
+      [&]( const DistMatrix<C,VR,STAR>& shiftsSub,
+                 DistMatrix<Real,VR,STAR>& invNormsSub,
+           const PseudospecCtrl<Real>& subCtrl )
+      { return cloud( USub, QSub, shiftsSub, invNormsSub, subCtrl ); };
+    return FarmShifts
+      ( grid, subgrids, mySubgrid, shifts, invNorms, psCtrl, solve );
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_FARM_HPP
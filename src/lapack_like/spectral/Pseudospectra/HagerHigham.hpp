@@ -125,9 +125,17 @@ OneNormConvergenceTest
     auto& activeEstsLoc = activeEsts.Matrix();
     auto& activeConvergedLoc = activeConverged.Matrix();
 
-    // Compute the infinity norm of each local column of Z and its location
+    // Each shift needs the maximum absolute value of its column of Z (and
+    // its location), the real part of the inner product of its columns of Z
+    // and X, and the one norm of its column of Y. Rather than paying for
+    // three reductions per iteration, the sums are packed after the
+    // max-locs in a single ValueInt buffer (tagged with a negative index)
+    // and reduced together.
     const Int numLocShifts = activeEsts.LocalHeight();
-    vector<ValueInt<Real>> valueInts(numLocShifts);
+    vector<ValueInt<Real>> reduceBuf(3*numLocShifts);
+    ValueInt<Real>* valueInts = &reduceBuf[0];
+    ValueInt<Real>* innerProds = &reduceBuf[numLocShifts];
+    ValueInt<Real>* oneNorms = &reduceBuf[2*numLocShifts];
     for( Int jLoc=0; jLoc<numLocShifts; ++jLoc )
     {
         valueInts[jLoc].value = 0;
@@ -141,38 +149,41 @@ OneNormConvergenceTest
                 valueInts[jLoc].index = activeZ.GlobalRow(iLoc);
             }
         }
-    }
-    mpi::AllReduce
-    ( valueInts.data(), numLocShifts, mpi::MaxLocOp<Real>(),
-      activeZ.ColComm() );
 
-    // Compute the real parts of the inner products of each column of Z and X
-    // NOTE: Except in the first iteration, each column of X should only have
-    //       a single nonzero entry, so this can be greatly accelerated.
-    vector<Real> innerProds(numLocShifts);
-    for( Int jLoc=0; jLoc<numLocShifts; ++jLoc )
-    {
+        // NOTE: Except in the first iteration, each column of X should only
+        //       have a single nonzero entry, so this can be greatly
+        //       accelerated.
         const C innerProd =
           blas::Dot
            ( nLoc, activeZ.LockedBuffer(0,jLoc), 1,
                    activeX.LockedBuffer(0,jLoc), 1 );
-        innerProds[jLoc] = RealPart(innerProd);
-    }
-    mpi::AllReduce
-    ( innerProds.data(), numLocShifts, mpi::SUM, activeZ.ColComm() );
+        innerProds[jLoc].value = RealPart(innerProd);
+        innerProds[jLoc].index = -1;
 
-    // Compute the one norms
-    vector<Real> oneNorms(numLocShifts);
-    for( Int jLoc=0; jLoc<numLocShifts; ++jLoc )
-        oneNorms[jLoc] = blas::Nrm1( nLoc, activeY.LockedBuffer(0,jLoc), 1 );
+        oneNorms[jLoc].value =
+          blas::Nrm1( nLoc, activeY.LockedBuffer(0,jLoc), 1 );
+        oneNorms[jLoc].index = -1;
+    }
+    auto maxLocOrSum =
+      []( const ValueInt<Real>& a, const ValueInt<Real>& b )
+      -> ValueInt<Real>
+      {
+          if( a.index < 0 )
+              return ValueInt<Real>{ a.value+b.value, a.index };
+          if( a.value > b.value ||
+              (a.value == b.value && a.index < b.index) )
+              return a;
+          return b;
+      };
     mpi::AllReduce
-    ( oneNorms.data(), numLocShifts, mpi::SUM, activeY.ColComm() );
+    ( reduceBuf.data(), 3*numLocShifts, maxLocOrSum, true,
+      activeZ.ColComm() );
 
     // Check for convergence
     for( Int jLoc=0; jLoc<numLocShifts; ++jLoc )
     {
-        activeEstsLoc(jLoc) = oneNorms[jLoc];
-        if( numIts > 0 && valueInts[jLoc].value <= innerProds[jLoc] )
+        activeEstsLoc(jLoc) = oneNorms[jLoc].value;
+        if( numIts > 0 && valueInts[jLoc].value <= innerProds[jLoc].value )
         {
             activeConvergedLoc(jLoc) = 1;
         }
@@ -189,6 +200,134 @@ OneNormConvergenceTest
     return activeConverged;
 }
 
+// Solves against (U - zI) and (U - zI)^H for many shifts z, where U is an
+// upper-triangular [MC,MR] matrix which does not change between iterations.
+// MultiShiftTrsm redistributes every panel of U on every call, which makes
+// the triangle, rather than the right-hand sides, the dominant
+// communication cost of each Hager-Higham iteration. Instead, each diagonal
+// block U11 is gathered once as [* ,* ] and the panel above it, U01, once as
+// [MC,* ], so that the panels require roughly n^2/(2 r) memory per process
+// and the communication of each solve is limited to blocks of the
+// right-hand sides. Both orientations sweep over the same cached panels:
+// the forward solve is the usual bottom-up column-oriented algorithm, while
+// the adjoint solve runs top-down, with each block of X updated by the
+// contraction of U01^H against the previously-computed rows.
+template<typename F>
+class UpperSweeps
+{
+public:
+    UpperSweeps( const DistMatrix<F>& U, Int colAlign )
+    : colAlign_(colAlign), bsize_(Blocksize())
+    {
+        EL_DEBUG_CSE
+        const Grid& g = U.Grid();
+        const Int n = U.Height();
+        for( Int k=0; k<n; k+=bsize_ )
+        {
+            const Int nb = Min(bsize_,n-k);
+            const Range<Int> ind0( 0, k    ),
+                             ind1( k, k+nb );
+
+            U11_STAR_STAR_.emplace_back( g );
+            U11_STAR_STAR_.back() = U( ind1, ind1 );
+
+            U01_MC_STAR_.emplace_back( g );
+            U01_MC_STAR_.back().AlignCols( colAlign );
+            U01_MC_STAR_.back() = U( ind0, ind1 );
+        }
+    }
+
+    // X := inv(U - diag(shifts)) X
+    void Solve( const DistMatrix<F,VR,STAR>& shifts, DistMatrix<F>& X )
+    {
+        EL_DEBUG_CSE
+        EL_DEBUG_ONLY(
+          if( X.ColAlign() != colAlign_ )
+              LogicError("X was not aligned with the cached panels");
+        )
+        const Grid& g = X.Grid();
+        DistMatrix<F,STAR,MR> X1_STAR_MR(g);
+        DistMatrix<F,STAR,VR> X1_STAR_VR(g);
+
+        const Int m = X.Height();
+        const Int kLast = LastOffset( m, bsize_ );
+        for( Int k=kLast; k>=0; k-=bsize_ )
+        {
+            const Int nb = Min(bsize_,m-k);
+            const Int block = k / bsize_;
+            const Range<Int> ind0( 0, k    ),
+                             ind1( k, k+nb );
+
+            auto X0 = X( ind0, ALL );
+            auto X1 = X( ind1, ALL );
+
+            X1_STAR_VR.AlignWith( shifts );
+            X1_STAR_VR = X1;
+            MultiShiftTrsm
+            ( LEFT, UPPER, NORMAL, F(1),
+              U11_STAR_STAR_[block].Matrix(), shifts.LockedMatrix(),
+              X1_STAR_VR.Matrix() );
+
+            X1_STAR_MR.AlignWith( X0 );
+            X1_STAR_MR = X1_STAR_VR;
+            X1 = X1_STAR_MR;
+
+            // X0[MC,MR] -= U01[MC,* ] X1[* ,MR]
+            LocalGemm
+            ( NORMAL, NORMAL,
+              F(-1), U01_MC_STAR_[block], X1_STAR_MR, F(1), X0 );
+        }
+    }
+
+    // X := inv(U - diag(shifts))^H X
+    void AdjointSolve( const DistMatrix<F,VR,STAR>& shifts, DistMatrix<F>& X )
+    {
+        EL_DEBUG_CSE
+        EL_DEBUG_ONLY(
+          if( X.ColAlign() != colAlign_ )
+              LogicError("X was not aligned with the cached panels");
+        )
+        const Grid& g = X.Grid();
+        DistMatrix<F,STAR,MR> Z1_STAR_MR(g);
+        DistMatrix<F,STAR,VR> X1_STAR_VR(g);
+
+        const Int m = X.Height();
+        for( Int k=0; k<m; k+=bsize_ )
+        {
+            const Int nb = Min(bsize_,m-k);
+            const Int block = k / bsize_;
+            const Range<Int> ind0( 0, k    ),
+                             ind1( k, k+nb );
+
+            auto X0 = X( ind0, ALL );
+            auto X1 = X( ind1, ALL );
+
+            // X1[MC,MR] -= SumScatter(U01[MC,* ]^H X0[MC,MR])
+            if( k > 0 )
+            {
+                Z1_STAR_MR.AlignWith( X1 );
+                LocalGemm
+                ( ADJOINT, NORMAL,
+                  F(1), U01_MC_STAR_[block], X0, Z1_STAR_MR );
+                AxpyContract( F(-1), Z1_STAR_MR, X1 );
+            }
+
+            X1_STAR_VR.AlignWith( shifts );
+            X1_STAR_VR = X1;
+            MultiShiftTrsm
+            ( LEFT, UPPER, ADJOINT, F(1),
+              U11_STAR_STAR_[block].Matrix(), shifts.LockedMatrix(),
+              X1_STAR_VR.Matrix() );
+            X1 = X1_STAR_VR;
+        }
+    }
+
+private:
+    Int colAlign_, bsize_;
+    vector<DistMatrix<F,STAR,STAR>> U11_STAR_STAR_;
+    vector<DistMatrix<F,MC,  STAR>> U01_MC_STAR_;
+};
+
 template<typename Real>
 Matrix<Int>
 HagerHigham
@@ -586,6 +725,12 @@ HagerHigham
     DistMatrix<C> X(g);
     Ones( X, n, numShifts );
     X *= C(1)/C(n);
+
+    // The Schur case gathers the panels of U once rather than per iteration
+    unique_ptr<UpperSweeps<C>> sweeps;
+    if( psCtrl.schur )
+        sweeps = MakeUnique<UpperSweeps<C>>( U, X.ColAlign() );
+
     Int numIts=0, numDone=0;
     DistMatrix<Real,MR,STAR> estimates(g);
     estimates.AlignWith( shifts );
@@ -611,15 +756,13 @@ HagerHigham
         {
             // Solve against (U - zI)
             activeY = activeX;
-            MultiShiftTrsm
-            ( LEFT, UPPER, NORMAL, C(1), U, activeShifts, activeY );
+            sweeps->Solve( activeShifts, activeY );
 
             activeZ = activeY;
             EntrywiseMap( activeZ, MakeFunction(unitMap) );
 
             // Solve against (U - zI)^H
-            MultiShiftTrsm
-            ( LEFT, UPPER, ADJOINT, C(1), U, activeShifts, activeZ );
+            sweeps->AdjointSolve( activeShifts, activeZ );
         }
         else
         {
@@ -692,7 +835,7 @@ HagerHigham
         }
     }
     if( psCtrl.schur )
-        MultiShiftTrsm( LEFT, UPPER, NORMAL, C(1), U, shifts, X );
+        sweeps->Solve( shifts, X );
     else
     {
         DistMatrix<C,STAR,VR> X_STAR_VR(X);
@@ -786,6 +929,12 @@ HagerHigham
     DistMatrix<C> X(g);
     Ones( X, n, numShifts );
     X *= C(1)/C(n);
+
+    // The Schur case gathers the panels of U once rather than per iteration
+    unique_ptr<UpperSweeps<C>> sweeps;
+    if( psCtrl.schur )
+        sweeps = MakeUnique<UpperSweeps<C>>( U, X.ColAlign() );
+
     Int numIts=0, numDone=0;
     DistMatrix<Real,MR,STAR> estimates(g);
     estimates.AlignWith( shifts );
@@ -812,8 +961,7 @@ HagerHigham
         {
             // Solve against Q (U - zI) Q^H
             Gemm( ADJOINT, NORMAL, C(1), Q, activeX, activeV );
-            MultiShiftTrsm
-            ( LEFT, UPPER, NORMAL, C(1), U, activeShifts, activeV );
+            sweeps->Solve( activeShifts, activeV );
             Gemm( NORMAL, NORMAL, C(1), Q, activeV, activeY );
 
             activeZ = activeY;
@@ -821,8 +969,7 @@ HagerHigham
 
             // Solve against Q (U - zI)^H Q^H
             Gemm( ADJOINT, NORMAL, C(1), Q, activeZ, activeV );
-            MultiShiftTrsm
-            ( LEFT, UPPER, ADJOINT, C(1), U, activeShifts, activeV );
+            sweeps->AdjointSolve( activeShifts, activeV );
             Gemm( NORMAL, NORMAL, C(1), Q, activeV, activeZ );
         }
         else
@@ -847,7 +994,7 @@ HagerHigham
             ( LOWER, NORMAL, C(1), UAdj_VC_STAR, activeShiftsConj,
               activeV_STAR_VR );
             activeV = activeV_STAR_VR;
-            Gemm( NORMAL, NORMAL, C(1), Q, activeV, activeY );
+            Gemm( NORMAL, NORMAL, C(1), Q, activeV, activeZ );
         }
 
         auto activeConverged =
@@ -915,7 +1062,7 @@ HagerHigham
     }
     if( psCtrl.schur )
     {
-        MultiShiftTrsm( LEFT, UPPER, NORMAL, C(1), U, shifts, Y );
+        sweeps->Solve( shifts, Y );
     }
     else
     {
@@ -227,7 +227,8 @@ Matrix<Int> IRA
     const Int numShifts = shifts.Height();
 
     const Int maxIts = psCtrl.maxIts;
-    const Int basisSize = psCtrl.basisSize;
+    const Int basisSize =
+      BudgetedBasisSize( n, numShifts, 1, psCtrl );
     const bool deflate = psCtrl.deflate;
     const bool progress = psCtrl.progress;
 
@@ -454,7 +455,8 @@ IRA
     const Int numShifts = shifts.Height();
 
     const Int maxIts = psCtrl.maxIts;
-    const Int basisSize = psCtrl.basisSize;
+    const Int basisSize =
+      BudgetedBasisSize( n, numShifts, 1, psCtrl );
     const bool deflate = psCtrl.deflate;
     const bool progress = psCtrl.progress;
 
@@ -678,7 +680,8 @@ IRA
     const Grid& g = U.Grid();
 
     const Int maxIts = psCtrl.maxIts;
-    const Int basisSize = psCtrl.basisSize;
+    const Int basisSize =
+      BudgetedBasisSize( n, numShifts, g.Size(), psCtrl );
     const bool deflate = psCtrl.deflate;
     const bool progress = psCtrl.progress;
 
@@ -956,7 +959,8 @@ IRA
     const Grid& g = U.Grid();
 
     const Int maxIts = psCtrl.maxIts;
-    const Int basisSize = psCtrl.basisSize;
+    const Int basisSize =
+      BudgetedBasisSize( n, numShifts, g.Size(), psCtrl );
     const bool deflate = psCtrl.deflate;
     const bool progress = psCtrl.progress;
 
@@ -456,6 +456,20 @@ FindConverged
     return activeConverged;
 }
 
+// Shrink the Krylov basis, whose (basisSize+1) n x numShifts blocks of
+// complex vectors are stored twice and spread over 'numProcs' processes, so
+// that it fits within the memory budget. At least two vectors are kept so
+// that implicit restarting remains possible.
+template<typename Real>
+Int BudgetedBasisSize
+( Int n, Int numShifts, Int numProcs, const PseudospecCtrl<Real>& psCtrl )
+{
+    const double blockBytes =
+      2*double(n)*numShifts*sizeof(Complex<Real>)/numProcs;
+    const Int minBasisSize = Min( psCtrl.basisSize, Int(2) );
+    return BudgetedCount( psCtrl.basisSize+1, blockBytes, minBasisSize+1 ) - 1;
+}
+
 } // namespace pspec
 } // namespace El
 
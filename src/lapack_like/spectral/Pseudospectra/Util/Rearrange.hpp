@@ -91,11 +91,10 @@ void RestoreOrdering
     DistMatrix<Int,STAR,STAR> preimageCopy( preimage );
     DistMatrix<T,STAR,STAR> xCopy( x );
     const Int numShifts = preimage.Height();
-    // TODO(poulson): Significantly lower the latency
     for( Int j=0; j<numShifts; ++j )
     {
-        const Int dest = preimageCopy.Get(j,0);
-        x.Set( dest, 0, xCopy.Get(j,0) );
+        const Int dest = preimageCopy.GetLocal(j,0);
+        x.Set( dest, 0, xCopy.GetLocal(j,0) );
     }
 }
 
@@ -110,12 +109,11 @@ void RestoreOrdering
     DistMatrix<T1, STAR,STAR> xCopy( x );
     DistMatrix<T2, STAR,STAR> yCopy( y );
     const Int numShifts = preimage.Height();
-    // TODO(poulson): Significantly lower the latency
     for( Int j=0; j<numShifts; ++j )
     {
-        const Int dest = preimageCopy.Get(j,0);
-        x.Set( dest, 0, xCopy.Get(j,0) );
-        y.Set( dest, 0, yCopy.Get(j,0) );
+        const Int dest = preimageCopy.GetLocal(j,0);
+        x.Set( dest, 0, xCopy.GetLocal(j,0) );
+        y.Set( dest, 0, yCopy.GetLocal(j,0) );
     }
 }
 
@@ -13,6 +13,18 @@ namespace El {
 
 namespace pspec {
 
+template<typename MatrixType>
+void NumSave
+( const MatrixType& A, const string& title, SnapshotCtrl& snapCtrl )
+{
+    EL_DEBUG_CSE
+    if( snapCtrl.asyncNumSave )
+        snapCtrl.pendingNumSaves.push_back
+        ( WriteAsync( A, title, snapCtrl.numFormat ).share() );
+    else
+        Write( A, title, snapCtrl.numFormat );
+}
+
 template<typename Real>
 void Snapshot
 ( const Matrix<Int>& preimage,
@@ -56,10 +68,11 @@ void Snapshot
         }
         if( numSave )
         {
+            snapCtrl.WaitForNumSaves();
             auto title = BuildString( snapCtrl.numBase, "_", numIts );
-            Write( estMap, title, snapCtrl.numFormat );
+            NumSave( estMap, title, snapCtrl );
             if( snapCtrl.itCounts )
-                Write( itCountMap, title+"_counts", snapCtrl.numFormat );
+                NumSave( itCountMap, title+"_counts", snapCtrl );
             snapCtrl.numSaveCount = 0;
         }
         if( imgSave || imgDisp )
@@ -99,6 +112,7 @@ void FinalSnapshot
 {
     EL_DEBUG_CSE
     auto logMap = []( const Real& alpha ) { return Log(alpha); };
+    snapCtrl.WaitForNumSaves();
     if( snapCtrl.realSize != 0 && snapCtrl.imagSize != 0 )
     {
         const bool numSave = ( snapCtrl.numSaveFreq >= 0 );
@@ -193,10 +207,11 @@ void Snapshot
         }
         if( numSave )
         {
+            snapCtrl.WaitForNumSaves();
             auto title = BuildString( snapCtrl.numBase, "_", numIts );
-            Write( estMap, title, snapCtrl.numFormat );
+            NumSave( estMap, title, snapCtrl );
             if( snapCtrl.itCounts )
-                Write( itCountMap, title+"_counts", snapCtrl.numFormat );
+                NumSave( itCountMap, title+"_counts", snapCtrl );
             snapCtrl.numSaveCount = 0;
         }
         if( imgSave || imgDisp )
@@ -236,6 +251,7 @@ void FinalSnapshot
 {
     EL_DEBUG_CSE
     auto logMap = []( const Real& alpha ) { return Log(alpha); };
+    snapCtrl.WaitForNumSaves();
     if( snapCtrl.realSize != 0 && snapCtrl.imagSize != 0 )
     {
         const bool numSave = ( snapCtrl.numSaveFreq >= 0 );
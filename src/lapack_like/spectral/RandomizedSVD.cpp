@@ -0,0 +1,200 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace rand_svd {
+
+// Return the number of columns of the sketch
+template<typename Real>
+Int SketchSize
+( Int m, Int n, Int rank, const RandomizedSVDCtrl<Real>& ctrl )
+{
+    const Int minDim = Min(m,n);
+    if( rank < 0 || rank > minDim )
+        LogicError("Invalid rank of ",rank," for a ",m," x ",n," matrix");
+    return Min( rank+Max(ctrl.oversampling,Int(0)), minDim );
+}
+
+// Overwrite Y with an orthonormal basis for its column space, using TSQR
+// when each process owns at least as many rows as there are columns
+template<typename F>
+void Orthonormalize( DistMatrix<F,VC,STAR>& Y )
+{
+    EL_DEBUG_CSE
+    const Grid& g = Y.Grid();
+    if( Y.Height() >= g.Size()*Y.Width() )
+    {
+        DistMatrix<F,STAR,STAR> R(g);
+        qr::ExplicitTS( Y, R );
+    }
+    else
+        qr::ExplicitUnitary( Y );
+}
+
+} // namespace rand_svd
+
+template<typename F>
+void RandomizedRangeFinder
+( const Matrix<F>& A,
+        Int rank,
+        Matrix<F>& Q,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numSamples = rand_svd::SketchSize( m, n, rank, ctrl );
+
+    // Q := A Omega, without ever forming Omega
+    SketchOperator<F> Omega( ctrl.sketch, n, numSamples, ctrl.sketchSparsity );
+    Omega.Apply( A, Q );
+    qr::ExplicitUnitary( Q );
+
+    // Subspace iteration with A A^H, orthonormalizing after each application
+    // of A or A^H so that the smaller singular values are not lost
+    Matrix<F> Z;
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        Gemm( ADJOINT, NORMAL, F(1), A, Q, Z );
+        qr::ExplicitUnitary( Z );
+        Gemm( NORMAL, NORMAL, F(1), A, Z, Q );
+        qr::ExplicitUnitary( Q );
+    }
+}
+
+template<typename F>
+void RandomizedRangeFinder
+( const AbstractDistMatrix<F>& APre,
+        Int rank,
+        AbstractDistMatrix<F>& QPre,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = APre.Grid();
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Int numSamples = rand_svd::SketchSize( m, n, rank, ctrl );
+
+    // Q := A Omega, where Omega is generated identically on every process
+    DistMatrix<F,VC,STAR> Q(g);
+    SketchOperator<F> Omega( ctrl.sketch, n, numSamples, ctrl.sketchSparsity );
+    Omega.Apply( APre, Q );
+    rand_svd::Orthonormalize( Q );
+
+    DistMatrix<F,VC,STAR> Z(g);
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        Gemm( ADJOINT, NORMAL, F(1), APre, Q, Z );
+        rand_svd::Orthonormalize( Z );
+        Gemm( NORMAL, NORMAL, F(1), APre, Z, Q );
+        rand_svd::Orthonormalize( Q );
+    }
+    Copy( Q, QPre );
+}
+
+template<typename F>
+SVDInfo RandomizedSVD
+( const Matrix<F>& A,
+        Int rank,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    Matrix<F> Q;
+    RandomizedRangeFinder( A, rank, Q, ctrl );
+
+    // Since Q^H A = (A^H Q)^H, if A^H Q = W Sigma Z^H, then
+    // A ~= Q Q^H A = (Q Z) Sigma W^H
+    Matrix<F> BAdj, W, Z;
+    Matrix<Real> sFull;
+    Gemm( ADJOINT, NORMAL, F(1), A, Q, BAdj );
+    auto info = SVD( BAdj, W, sFull, Z, ctrl.svdCtrl );
+
+    auto ZL = Z( ALL, IR(0,rank) );
+    Gemm( NORMAL, NORMAL, F(1), Q, ZL, U );
+    Copy( sFull( IR(0,rank), ALL ), s );
+    Copy( W( ALL, IR(0,rank) ), V );
+    return info;
+}
+
+template<typename F>
+SVDInfo RandomizedSVD
+( const AbstractDistMatrix<F>& A,
+        Int rank,
+        AbstractDistMatrix<F>& U,
+        AbstractDistMatrix<Base<F>>& s,
+        AbstractDistMatrix<F>& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    DistMatrix<F,VC,STAR> Q(g);
+    RandomizedRangeFinder( A, rank, Q, ctrl );
+
+    // The projected matrix, A^H Q, is tall and skinny, so we use TSQR as a
+    // preprocessing step for its SVD when the rows are sufficiently spread out
+    DistMatrix<F,VC,STAR> BAdj(g), W(g), UFull(g);
+    DistMatrix<F,STAR,STAR> Z(g);
+    DistMatrix<Real,STAR,STAR> sFull(g);
+    Gemm( ADJOINT, NORMAL, F(1), A, Q, BAdj );
+    SVDInfo info;
+    if( BAdj.Height() >= g.Size()*BAdj.Width() )
+        info = svd::TSQR( BAdj, W, sFull, Z );
+    else
+        info = SVD( BAdj, W, sFull, Z, ctrl.svdCtrl );
+
+    auto ZL = Z( ALL, IR(0,rank) );
+    UFull.AlignWith( Q );
+    LocalGemm( NORMAL, NORMAL, F(1), Q, ZL, UFull );
+    Copy( UFull, U );
+    Copy( sFull( IR(0,rank), ALL ), s );
+    Copy( W( ALL, IR(0,rank) ), V );
+    return info;
+}
+
+#define PROTO(F) \
+  template void RandomizedRangeFinder \
+  ( const Matrix<F>& A, \
+          Int rank, \
+          Matrix<F>& Q, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl ); \
+  template void RandomizedRangeFinder \
+  ( const AbstractDistMatrix<F>& A, \
+          Int rank, \
+          AbstractDistMatrix<F>& Q, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl ); \
+  template SVDInfo RandomizedSVD \
+  ( const Matrix<F>& A, \
+          Int rank, \
+          Matrix<F>& U, \
+          Matrix<Base<F>>& s, \
+          Matrix<F>& V, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl ); \
+  template SVDInfo RandomizedSVD \
+  ( const AbstractDistMatrix<F>& A, \
+          Int rank, \
+          AbstractDistMatrix<F>& U, \
+          AbstractDistMatrix<Base<F>>& s, \
+          AbstractDistMatrix<F>& V, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,330 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace rank_reveal {
+
+template<typename Real>
+Real RelativeTolerance( Int m, Int n, const RankRevealCtrl<Real>& ctrl )
+{
+    return
+      ( ctrl.tol == Real(0) ? Max(m,n)*limits::Epsilon<Real>() : ctrl.tol );
+}
+
+// Return the number of leading singular values above relTol*s(0)
+template<typename Real>
+Int NumericalRank( const Matrix<Real>& s, Real relTol )
+{
+    const Int numSingVals = s.Height();
+    if( numSingVals == 0 )
+        return 0;
+    const Real tol = relTol*s(0);
+    for( Int j=0; j<numSingVals; ++j )
+        if( s(j) <= tol )
+            return j;
+    return numSingVals;
+}
+
+template<typename F>
+Int SVD
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<F>& T,
+        Matrix<F>& W,
+  const RankRevealCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real relTol = RelativeTolerance( m, n, ctrl );
+
+    SVDCtrl<Real> svdCtrl;
+    svdCtrl.bidiagSVDCtrl.approach = COMPACT_SVD;
+    svdCtrl.bidiagSVDCtrl.tolType = RELATIVE_TO_MAX_SING_VAL_TOL;
+    svdCtrl.bidiagSVDCtrl.tol = relTol;
+    Matrix<F> UFull, WFull;
+    Matrix<Real> s;
+    El::SVD( A, UFull, s, WFull, svdCtrl );
+
+    const Int rank = NumericalRank( s, relTol );
+    U = UFull( ALL, IR(0,rank) );
+    W = WFull( ALL, IR(0,rank) );
+    auto sT = s( IR(0,rank), ALL );
+    Diagonal( T, sT );
+    return rank;
+}
+
+template<typename F>
+Int SVD
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& U,
+        AbstractDistMatrix<F>& T,
+        AbstractDistMatrix<F>& W,
+  const RankRevealCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real relTol = RelativeTolerance( m, n, ctrl );
+
+    SVDCtrl<Real> svdCtrl;
+    svdCtrl.bidiagSVDCtrl.approach = COMPACT_SVD;
+    svdCtrl.bidiagSVDCtrl.tolType = RELATIVE_TO_MAX_SING_VAL_TOL;
+    svdCtrl.bidiagSVDCtrl.tol = relTol;
+    const Grid& g = A.Grid();
+    DistMatrix<F> UFull(g), WFull(g);
+    DistMatrix<Real,STAR,STAR> s(g);
+    El::SVD( A, UFull, s, WFull, svdCtrl );
+
+    const Int rank = NumericalRank( s.Matrix(), relTol );
+    auto UL = UFull( ALL, IR(0,rank) );
+    auto WL = WFull( ALL, IR(0,rank) );
+    Copy( UL, U );
+    Copy( WL, W );
+    auto sT = s.Matrix()( IR(0,rank), ALL );
+    Diagonal( T, sT );
+    return rank;
+}
+
+// Double the guess of the rank until the sketch has captured a singular
+// value below the tolerance (or spans the entire range of A)
+template<typename F>
+Int RandomizedSVD
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<F>& T,
+        Matrix<F>& W,
+  const RankRevealCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Real relTol = RelativeTolerance( m, n, ctrl );
+
+    Int guess = ( ctrl.rankGuess > 0 ? ctrl.rankGuess : Blocksize() );
+    guess = Min( guess, minDim );
+    Matrix<F> UFull, WFull;
+    Matrix<Real> s;
+    Int rank;
+    while( true )
+    {
+        El::RandomizedSVD( A, guess, UFull, s, WFull, ctrl.randomizedCtrl );
+        rank = NumericalRank( s, relTol );
+        if( rank < guess || guess == minDim )
+            break;
+        guess = Min( 2*guess, minDim );
+    }
+    U = UFull( ALL, IR(0,rank) );
+    W = WFull( ALL, IR(0,rank) );
+    auto sT = s( IR(0,rank), ALL );
+    Diagonal( T, sT );
+    return rank;
+}
+
+template<typename F>
+Int RandomizedSVD
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& U,
+        AbstractDistMatrix<F>& T,
+        AbstractDistMatrix<F>& W,
+  const RankRevealCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Real relTol = RelativeTolerance( m, n, ctrl );
+
+    Int guess = ( ctrl.rankGuess > 0 ? ctrl.rankGuess : Blocksize() );
+    guess = Min( guess, minDim );
+    const Grid& g = A.Grid();
+    DistMatrix<F> UFull(g), WFull(g);
+    DistMatrix<Real,STAR,STAR> s(g);
+    Int rank;
+    while( true )
+    {
+        El::RandomizedSVD( A, guess, UFull, s, WFull, ctrl.randomizedCtrl );
+        rank = NumericalRank( s.Matrix(), relTol );
+        if( rank < guess || guess == minDim )
+            break;
+        guess = Min( 2*guess, minDim );
+    }
+    auto UL = UFull( ALL, IR(0,rank) );
+    auto WL = WFull( ALL, IR(0,rank) );
+    Copy( UL, U );
+    Copy( WL, W );
+    auto sT = s.Matrix()( IR(0,rank), ALL );
+    Diagonal( T, sT );
+    return rank;
+}
+
+template<typename F>
+Int RandomizedURV
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<F>& T,
+        Matrix<F>& W,
+  const RankRevealCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    // A P = Q R, stopping at the numerical rank
+    QRCtrl<Real> qrCtrl;
+    qrCtrl.colPiv = true;
+    qrCtrl.randomized = true;
+    qrCtrl.oversampling = ctrl.randomizedCtrl.oversampling;
+    qrCtrl.adaptive = true;
+    qrCtrl.tol = RelativeTolerance( m, n, ctrl );
+    Matrix<F> AFact( A ), householderScalars;
+    Matrix<Real> signature;
+    Permutation P;
+    QR( AFact, householderScalars, signature, P, qrCtrl );
+    const Int rank = householderScalars.Height();
+
+    // U := Q(:,0:r)
+    auto AFactL = AFact( ALL, IR(0,rank) );
+    Identity( U, m, rank );
+    qr::ApplyQ( LEFT, NORMAL, AFactL, householderScalars, signature, U );
+
+    // [R11 R12] = [0 T] Z
+    Matrix<F> R1( AFact( IR(0,rank), ALL ) ), householderScalarsR;
+    Matrix<Real> signatureR;
+    MakeTrapezoidal( UPPER, R1 );
+    RQ( R1, householderScalarsR, signatureR );
+    T = R1( ALL, IR(n-rank,n) );
+    MakeTrapezoidal( UPPER, T );
+
+    // W := P Z^H [0; I]
+    Zeros( W, n, rank );
+    FillDiagonal( W, F(1), -(n-rank) );
+    rq::ApplyQ( LEFT, ADJOINT, R1, householderScalarsR, signatureR, W );
+    P.InversePermuteRows( W );
+    return rank;
+}
+
+template<typename F>
+Int RandomizedURV
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& U,
+        AbstractDistMatrix<F>& T,
+        AbstractDistMatrix<F>& W,
+  const RankRevealCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Grid& g = A.Grid();
+
+    // A P = Q R, stopping at the numerical rank
+    QRCtrl<Real> qrCtrl;
+    qrCtrl.colPiv = true;
+    qrCtrl.randomized = true;
+    qrCtrl.oversampling = ctrl.randomizedCtrl.oversampling;
+    qrCtrl.adaptive = true;
+    qrCtrl.tol = RelativeTolerance( m, n, ctrl );
+    DistMatrix<F> AFact( A );
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Real,MD,STAR> signature(g);
+    DistPermutation P(g);
+    QR( AFact, householderScalars, signature, P, qrCtrl );
+    const Int rank = householderScalars.Height();
+
+    // U := Q(:,0:r)
+    auto AFactL = AFact( ALL, IR(0,rank) );
+    Identity( U, m, rank );
+    qr::ApplyQ( LEFT, NORMAL, AFactL, householderScalars, signature, U );
+
+    // [R11 R12] = [0 T] Z
+    DistMatrix<F> R1( AFact( IR(0,rank), ALL ) );
+    DistMatrix<F,MD,STAR> householderScalarsR(g);
+    DistMatrix<Real,MD,STAR> signatureR(g);
+    MakeTrapezoidal( UPPER, R1 );
+    RQ( R1, householderScalarsR, signatureR );
+    auto R1R = R1( ALL, IR(n-rank,n) );
+    Copy( R1R, T );
+    MakeTrapezoidal( UPPER, T );
+
+    // W := P Z^H [0; I]
+    Zeros( W, n, rank );
+    FillDiagonal( W, F(1), -(n-rank) );
+    rq::ApplyQ( LEFT, ADJOINT, R1, householderScalarsR, signatureR, W );
+    P.InversePermuteRows( W );
+    return rank;
+}
+
+} // namespace rank_reveal
+
+template<typename F>
+Int RankReveal
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<F>& T,
+        Matrix<F>& W,
+  const RankRevealCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == RANK_REVEAL_RANDOMIZED_SVD )
+        return rank_reveal::RandomizedSVD( A, U, T, W, ctrl );
+    else if( ctrl.approach == RANK_REVEAL_RANDOMIZED_URV )
+        return rank_reveal::RandomizedURV( A, U, T, W, ctrl );
+    else
+        return rank_reveal::SVD( A, U, T, W, ctrl );
+}
+
+template<typename F>
+Int RankReveal
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& U,
+        AbstractDistMatrix<F>& T,
+        AbstractDistMatrix<F>& W,
+  const RankRevealCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( A, U, T, W ))
+    if( ctrl.approach == RANK_REVEAL_RANDOMIZED_SVD )
+        return rank_reveal::RandomizedSVD( A, U, T, W, ctrl );
+    else if( ctrl.approach == RANK_REVEAL_RANDOMIZED_URV )
+        return rank_reveal::RandomizedURV( A, U, T, W, ctrl );
+    else
+        return rank_reveal::SVD( A, U, T, W, ctrl );
+}
+
+#define PROTO(F) \
+  template Int RankReveal \
+  ( const Matrix<F>& A, \
+          Matrix<F>& U, \
+          Matrix<F>& T, \
+          Matrix<F>& W, \
+    const RankRevealCtrl<Base<F>>& ctrl ); \
+  template Int RankReveal \
+  ( const AbstractDistMatrix<F>& A, \
+          AbstractDistMatrix<F>& U, \
+          AbstractDistMatrix<F>& T, \
+          AbstractDistMatrix<F>& W, \
+    const RankRevealCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
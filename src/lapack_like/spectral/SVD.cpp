@@ -9,6 +9,8 @@
 #include <El.hpp>
 
 #include "./SVD/Chan.hpp"
+#include "./SVD/Jacobi.hpp"
+#include "./SVD/QDWH.hpp"
 #include "./SVD/Product.hpp"
 
 namespace El {
@@ -64,7 +66,7 @@ SVDInfo ScaLAPACKHelper
         const bool compact = ( approach == COMPACT_SVD );
         if( compact )
         {
-            const Real twoNorm = ( k==0 ? Real(0) : s.Get(0,0) );
+            const Real twoNorm = ( k==0 ? Real(0) : s.GetLocal(0,0) );
             const Real thresh =
               bidiag_svd::APosterioriThreshold
               ( m, n, twoNorm, ctrl.bidiagSVDCtrl );
@@ -72,7 +74,7 @@ SVDInfo ScaLAPACKHelper
             Int rank = k;
             for( Int j=0; j<k; ++j )
             {
-                if( s.Get(j,0) <= thresh )
+                if( s.GetLocal(j,0) <= thresh )
                 {
                     rank = j;
                     break;
@@ -228,6 +230,10 @@ SVDInfo SVD
     if( (bidiagSVDCtrl.wantU && bidiagSVDCtrl.accumulateU) ||
         (bidiagSVDCtrl.wantV && bidiagSVDCtrl.accumulateV) )
         LogicError("SVD does not support singular vector accumulation");
+    if( bidiagSVDCtrl.approach == JACOBI_SVD )
+        return svd::Jacobi( A, U, s, V, ctrl );
+    if( bidiagSVDCtrl.approach == QDWH_SVD )
+        return svd::QDWH( A, U, s, V, ctrl );
 
     if( !ctrl.overwrite && ctrl.bidiagSVDCtrl.approach != PRODUCT_SVD )
     {
@@ -298,6 +304,10 @@ SVDInfo SVD
     if( (bidiagSVDCtrl.wantU && bidiagSVDCtrl.accumulateU) ||
         (bidiagSVDCtrl.wantV && bidiagSVDCtrl.accumulateV) )
         LogicError("SVD does not support singular vector accumulation");
+    if( bidiagSVDCtrl.approach == JACOBI_SVD )
+        return svd::Jacobi( A, U, s, V, ctrl );
+    if( bidiagSVDCtrl.approach == QDWH_SVD )
+        return svd::QDWH( A, U, s, V, ctrl );
 
     if( IsBlasScalar<Field>::value && ctrl.useScaLAPACK )
     {
@@ -443,7 +453,7 @@ SVDInfo ScaLAPACKHelper
         ( m, n, A.Buffer(), descA.data(), s.Buffer() );
         if( compact )
         {
-            const Real twoNorm = ( k==0 ? Real(0) : s.Get(0,0) );
+            const Real twoNorm = ( k==0 ? Real(0) : s.GetLocal(0,0) );
             const Real thresh =
               bidiag_svd::APosterioriThreshold
               ( m, n, twoNorm, ctrl.bidiagSVDCtrl );
@@ -451,7 +461,7 @@ SVDInfo ScaLAPACKHelper
             Int rank = k;
             for( Int j=0; j<k; ++j )
             {
-                if( s.Get(j,0) <= thresh )
+                if( s.GetLocal(j,0) <= thresh )
                 {
                     rank = j;
                     break;
@@ -497,6 +507,14 @@ SVDInfo SVD
         const bool relative = (tolType == RELATIVE_TO_MAX_SING_VAL_TOL);
         return svd::Product( A, s, ctrl.bidiagSVDCtrl.tol, relative );
     }
+    else if( ctrl.bidiagSVDCtrl.approach == JACOBI_SVD )
+    {
+        return svd::Jacobi( A, s, ctrl );
+    }
+    else if( ctrl.bidiagSVDCtrl.approach == QDWH_SVD )
+    {
+        return svd::QDWH( A, s, ctrl );
+    }
     else
     {
         auto ACopy( A );
@@ -524,6 +542,14 @@ SVDInfo SVD
     {
         return svd::LAPACKHelper( A, s, ctrl );
     }
+    if( ctrl.bidiagSVDCtrl.approach == JACOBI_SVD )
+    {
+        return svd::Jacobi( A, s, ctrl );
+    }
+    if( ctrl.bidiagSVDCtrl.approach == QDWH_SVD )
+    {
+        return svd::QDWH( A, s, ctrl );
+    }
 
     SVDInfo info;
     if( ctrl.bidiagSVDCtrl.approach == THIN_SVD ||
@@ -555,6 +581,14 @@ SVDInfo SVD
     {
         return svd::ScaLAPACKHelper( A, s, ctrl );
     }
+    if( ctrl.bidiagSVDCtrl.approach == JACOBI_SVD )
+    {
+        return svd::Jacobi( A, s, ctrl );
+    }
+    if( ctrl.bidiagSVDCtrl.approach == QDWH_SVD )
+    {
+        return svd::QDWH( A, s, ctrl );
+    }
     if( ctrl.bidiagSVDCtrl.approach == THIN_SVD ||
         ctrl.bidiagSVDCtrl.approach == COMPACT_SVD ||
         ctrl.bidiagSVDCtrl.approach == FULL_SVD )
@@ -584,6 +618,14 @@ SVDInfo SVD
     {
         return svd::ScaLAPACKHelper( A, s, ctrl );
     }
+    if( ctrl.bidiagSVDCtrl.approach == JACOBI_SVD )
+    {
+        return svd::Jacobi( A, s, ctrl );
+    }
+    if( ctrl.bidiagSVDCtrl.approach == QDWH_SVD )
+    {
+        return svd::QDWH( A, s, ctrl );
+    }
     if( ctrl.bidiagSVDCtrl.approach == PRODUCT_SVD )
     {
         auto tolType = ctrl.bidiagSVDCtrl.tolType;
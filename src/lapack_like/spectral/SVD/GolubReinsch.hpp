@@ -248,10 +248,18 @@ SVDInfo GolubReinsch
 
     // Bidiagonalize A
     Timer timer;
-    DistMatrix<Field,STAR,STAR> householderScalarsP(g), householderScalarsQ(g);
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    if( ctrl.twoStageBidiag )
+    {
+        bidiag::TwoStageCondensed( A, ctrl.bidiagBandwidth );
+    }
+    else
+    {
+        DistMatrix<Field,STAR,STAR>
+          householderScalarsP(g), householderScalarsQ(g);
+        Bidiag( A, householderScalarsP, householderScalarsQ );
+    }
     if( ctrl.time && g.Rank() == 0 )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
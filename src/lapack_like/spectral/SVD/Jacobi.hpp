@@ -0,0 +1,439 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVD_JACOBI_HPP
+#define EL_SVD_JACOBI_HPP
+
+// One-sided block Jacobi in the spirit of Drmac and Veselic's "New fast and
+// accurate Jacobi SVD algorithm": after the QR factorization A = Q R, the
+// columns of X = R^H are orthogonalized, X V = W, by sweeping over pairs of
+// column blocks. Each pair [X_I, X_J] is orthogonalized by the eigenvectors
+// Z of its Gram matrix [X_I, X_J]^H [X_I, X_J], which are applied to both X
+// and V with Gemm. Since R = V Sigma (W inv(Sigma))^H, where Sigma holds the
+// column norms of W, we have A = (Q V) Sigma (W inv(Sigma))^H.
+//
+// In the distributed case, the rows of X and V are distributed as [VC,STAR]
+// matrices, so that each Gram matrix is the sum of local contributions and
+// the rotations require no communication. The pairs of each round of a
+// round-robin ordering are disjoint, so their Gram matrices are summed with
+// a single AllReduce.
+
+namespace El {
+namespace svd {
+
+namespace jacobi {
+
+// Return the pairs of blocks for each round of a round-robin ordering. When
+// the number of blocks is odd, the block paired with the dummy index of -1
+// is orthogonalized on its own.
+inline vector<vector<std::pair<Int,Int>>> RoundRobin( Int numBlocks )
+{
+    const Int numSlots = numBlocks + (numBlocks % 2);
+    vector<Int> slots( numSlots );
+    for( Int i=0; i<numSlots; ++i )
+        slots[i] = ( i < numBlocks ? i : -1 );
+
+    const Int numRounds = Max( numSlots-1, Int(1) );
+    vector<vector<std::pair<Int,Int>>> rounds( numRounds );
+    for( Int round=0; round<numRounds; ++round )
+    {
+        for( Int k=0; k<numSlots/2; ++k )
+            rounds[round].emplace_back( slots[k], slots[numSlots-1-k] );
+        // Rotate all but the first slot
+        std::rotate( slots.begin()+1, slots.end()-1, slots.end() );
+    }
+    return rounds;
+}
+
+// Return the largest value of |g_ij| / sqrt(g_ii g_jj) for i != j, ignoring
+// the columns whose squared norms, g_jj, are at most 'negligibleSquared'
+template<typename F>
+Base<F>
+MaxRelativeOffDiagonal( const Matrix<F>& G, Base<F> negligibleSquared )
+{
+    typedef Base<F> Real;
+    const Int k = G.Height();
+    Real offMax = 0;
+    for( Int j=0; j<k; ++j )
+    {
+        const Real gammaJJ = RealPart(G(j,j));
+        if( gammaJJ <= negligibleSquared )
+            continue;
+        for( Int i=j+1; i<k; ++i )
+        {
+            const Real gammaII = RealPart(G(i,i));
+            if( gammaII <= negligibleSquared )
+                continue;
+            offMax = Max( offMax, Abs(G(i,j))/Sqrt(gammaII*gammaJJ) );
+        }
+    }
+    return offMax;
+}
+
+// Perform a sweep over all pairs of column blocks of X, applying the same
+// rotations to V, and return the number of pairs which were rotated.
+// 'reduce' should sum a buffer of Gram matrix contributions over all of the
+// processes which own rows of X.
+template<typename F,class ReduceType>
+Int Sweep
+( Matrix<F>& X,
+  Matrix<F>& V,
+  Int blocksize,
+  const vector<vector<std::pair<Int,Int>>>& rounds,
+  Base<F> tol,
+  Base<F> negligibleSquared,
+  const ReduceType& reduce )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = X.Width();
+    auto blockInd = [&]( Int block )
+    { return IR( block*blocksize, Min((block+1)*blocksize,n) ); };
+
+    HermitianEigCtrl<F> eigCtrl;
+    eigCtrl.tridiagEigCtrl.sort = DESCENDING;
+
+    Int numRotated = 0;
+    Matrix<F> XPair, VPair, XPairNew, VPairNew, Z;
+    Matrix<Real> lambda;
+    for( const auto& round : rounds )
+    {
+        // Form the local contributions to the Gram matrices of this round
+        const Int numPairs = round.size();
+        vector<Int> pairWidths(numPairs), gramOffsets(numPairs);
+        Int gramSize = 0;
+        for( Int k=0; k<numPairs; ++k )
+        {
+            const Int first = round[k].first;
+            const Int second = round[k].second;
+            pairWidths[k] = 0;
+            if( first >= 0 )
+                pairWidths[k] += blockInd(first).end - blockInd(first).beg;
+            if( second >= 0 )
+                pairWidths[k] += blockInd(second).end - blockInd(second).beg;
+            gramOffsets[k] = gramSize;
+            gramSize += pairWidths[k]*pairWidths[k];
+        }
+        vector<F> gramBuf( gramSize, F(0) );
+        auto gatherPair = [&]( Int k, const Matrix<F>& Y, Matrix<F>& YPair )
+        {
+            Zeros( YPair, Y.Height(), pairWidths[k] );
+            Int offset = 0;
+            for( const Int block : { round[k].first, round[k].second } )
+            {
+                if( block < 0 )
+                    continue;
+                auto ind = blockInd( block );
+                auto YBlock = Y( ALL, ind );
+                auto YPairBlock =
+                  YPair( ALL, IR(offset,offset+ind.end-ind.beg) );
+                YPairBlock = YBlock;
+                offset += ind.end - ind.beg;
+            }
+        };
+        auto scatterPair = [&]( Int k, const Matrix<F>& YPair, Matrix<F>& Y )
+        {
+            Int offset = 0;
+            for( const Int block : { round[k].first, round[k].second } )
+            {
+                if( block < 0 )
+                    continue;
+                auto ind = blockInd( block );
+                auto YBlock = Y( ALL, ind );
+                auto YPairBlock =
+                  YPair( ALL, IR(offset,offset+ind.end-ind.beg) );
+                YBlock = YPairBlock;
+                offset += ind.end - ind.beg;
+            }
+        };
+        for( Int k=0; k<numPairs; ++k )
+        {
+            gatherPair( k, X, XPair );
+            Matrix<F> G;
+            G.Attach
+            ( pairWidths[k], pairWidths[k],
+              &gramBuf[gramOffsets[k]], pairWidths[k] );
+            Herk( LOWER, ADJOINT, Real(1), XPair, Real(0), G );
+        }
+        reduce( gramBuf.data(), gramSize );
+
+        // Every process owns identical copies of the Gram matrices and
+        // therefore computes identical rotations
+        for( Int k=0; k<numPairs; ++k )
+        {
+            Matrix<F> G;
+            G.Attach
+            ( pairWidths[k], pairWidths[k],
+              &gramBuf[gramOffsets[k]], pairWidths[k] );
+            MakeHermitian( LOWER, G );
+            if( MaxRelativeOffDiagonal( G, negligibleSquared ) <= tol )
+                continue;
+            HermitianEig( LOWER, G, lambda, Z, eigCtrl );
+
+            gatherPair( k, X, XPair );
+            Gemm( NORMAL, NORMAL, F(1), XPair, Z, XPairNew );
+            scatterPair( k, XPairNew, X );
+
+            gatherPair( k, V, VPair );
+            Gemm( NORMAL, NORMAL, F(1), VPair, Z, VPairNew );
+            scatterPair( k, VPairNew, V );
+
+            ++numRotated;
+        }
+    }
+    return numRotated;
+}
+
+// Run sweeps until no pair requires rotation and return the number of sweeps
+template<typename F,class ReduceType>
+Int Orthogonalize
+( Matrix<F>& X,
+  Matrix<F>& V,
+  const SVDCtrl<Base<F>>& ctrl,
+  const ReduceType& reduce )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = X.Width();
+    const Int blocksize =
+      ( ctrl.jacobiBlocksize > 0 ? ctrl.jacobiBlocksize : Blocksize() );
+    const Int numBlocks = Max( (n+blocksize-1)/blocksize, Int(1) );
+    const auto rounds = RoundRobin( numBlocks );
+    const Real tol =
+      ( ctrl.jacobiTol > Real(0) ? ctrl.jacobiTol :
+        Sqrt(Real(n))*limits::Epsilon<Real>() );
+
+    // Columns whose norms are below eps || X ||_F are not orthogonalized
+    const Real localFrobNorm = FrobeniusNorm( X );
+    F frobNormSquared = localFrobNorm*localFrobNorm;
+    reduce( &frobNormSquared, 1 );
+    const Real eps = limits::Epsilon<Real>();
+    const Real negligibleSquared = eps*eps*RealPart(frobNormSquared);
+
+    Int numSweeps = 0;
+    while( numSweeps < ctrl.jacobiMaxSweeps )
+    {
+        const Int numRotated =
+          Sweep( X, V, blocksize, rounds, tol, negligibleSquared, reduce );
+        ++numSweeps;
+        if( numRotated == 0 )
+            break;
+    }
+    return numSweeps;
+}
+
+// Overwrite the squared column norms in s with the column norms in
+// descending order and return the corresponding permutation
+template<typename Real>
+void SortNorms
+( Matrix<Real>& s, vector<Int>& perm )
+{
+    EL_DEBUG_CSE
+    const Int n = s.Height();
+    perm.resize( n );
+    for( Int j=0; j<n; ++j )
+    {
+        s(j) = Sqrt( s(j) );
+        perm[j] = j;
+    }
+    std::stable_sort
+    ( perm.begin(), perm.end(),
+      [&]( Int a, Int b ) { return s(a) > s(b); } );
+    Matrix<Real> sSorted( n, 1 );
+    for( Int j=0; j<n; ++j )
+        sSorted(j) = s(perm[j]);
+    s = sSorted;
+}
+
+// Overwrite Y with its permuted columns
+template<typename F>
+void PermuteColumns( Matrix<F>& Y, const vector<Int>& perm )
+{
+    EL_DEBUG_CSE
+    const Int n = Y.Width();
+    Matrix<F> YPerm( Y.Height(), n );
+    for( Int j=0; j<n; ++j )
+    {
+        auto yCol = Y( ALL, IR(perm[j]) );
+        auto yPermCol = YPerm( ALL, IR(j) );
+        yPermCol = yCol;
+    }
+    Y = YPerm;
+}
+
+// Overwrite Y with its permuted columns, each divided by the corresponding
+// (nonzero) entry of 'scales'
+template<typename F>
+void PermuteAndScaleColumns
+( Matrix<F>& Y, const vector<Int>& perm, const Matrix<Base<F>>& scales )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    PermuteColumns( Y, perm );
+    const Int n = Y.Width();
+    for( Int j=0; j<n; ++j )
+    {
+        if( scales(j) != Real(0) )
+        {
+            auto yCol = Y( ALL, IR(j) );
+            yCol *= Real(1)/scales(j);
+        }
+    }
+}
+
+} // namespace jacobi
+
+template<typename Field>
+SVDInfo Jacobi
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    SVDInfo info;
+    if( m < n )
+    {
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+        info = Jacobi( AAdj, V, s, U, ctrl );
+        return info;
+    }
+
+    // A = Q R
+    Matrix<Field> R;
+    U = A;
+    qr::Explicit( U, R );
+
+    // X := R^H and then X V = W
+    Matrix<Field> X, VAcc;
+    Adjoint( R, X );
+    Identity( VAcc, n, n );
+    auto noReduce = []( Field* buf, Int size ) { };
+    info.numJacobiSweeps = jacobi::Orthogonalize( X, VAcc, ctrl, noReduce );
+
+    Zeros( s, n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        const Real norm = FrobeniusNorm( X(ALL,IR(j)) );
+        s(j) = norm*norm;
+    }
+    vector<Int> perm;
+    jacobi::SortNorms( s, perm );
+
+    // U := Q VAcc and V := W inv(Sigma)
+    jacobi::PermuteColumns( VAcc, perm );
+    auto Q( U );
+    Gemm( NORMAL, NORMAL, Field(1), Q, VAcc, U );
+    jacobi::PermuteAndScaleColumns( X, perm, s );
+    V = X;
+    return info;
+}
+
+template<typename Field>
+SVDInfo Jacobi
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    SVDInfo info;
+    if( m < n )
+    {
+        DistMatrix<Field,VC,STAR> AAdj(g);
+        Adjoint( A, AAdj );
+        info = Jacobi( AAdj, V, s, U, ctrl );
+        return info;
+    }
+
+    // A = Q R, using TSQR when every process owns at least n rows
+    DistMatrix<Field,VC,STAR> Q( A );
+    DistMatrix<Field,STAR,STAR> R(g);
+    if( m >= g.Size()*n )
+        qr::ExplicitTS( Q, R );
+    else
+        qr::Explicit( Q, R );
+
+    // X := R^H and then X V = W
+    DistMatrix<Field,STAR,STAR> RAdj(g);
+    Adjoint( R, RAdj );
+    DistMatrix<Field,VC,STAR> X( RAdj ), VAcc(g);
+    VAcc.AlignWith( X );
+    Identity( VAcc, n, n );
+    mpi::Comm comm = X.ColComm();
+    auto reduce =
+      [&]( Field* buf, Int size ) { mpi::AllReduce( buf, size, comm ); };
+    info.numJacobiSweeps =
+      jacobi::Orthogonalize( X.Matrix(), VAcc.Matrix(), ctrl, reduce );
+
+    // Sum the local contributions to the squared column norms
+    Matrix<Real> sLoc;
+    Zeros( sLoc, n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        const Real localNorm = FrobeniusNorm( X.LockedMatrix()(ALL,IR(j)) );
+        sLoc(j) = localNorm*localNorm;
+    }
+    mpi::AllReduce( sLoc.Buffer(), n, comm );
+    vector<Int> perm;
+    jacobi::SortNorms( sLoc, perm );
+
+    // U := Q VAcc and V := W inv(Sigma)
+    jacobi::PermuteColumns( VAcc.Matrix(), perm );
+    DistMatrix<Field,STAR,STAR> VAcc_STAR_STAR( VAcc );
+    DistMatrix<Field,VC,STAR> UVC(g);
+    UVC.AlignWith( Q );
+    LocalGemm( NORMAL, NORMAL, Field(1), Q, VAcc_STAR_STAR, UVC );
+    Copy( UVC, U );
+    jacobi::PermuteAndScaleColumns( X.Matrix(), perm, sLoc );
+    Copy( X, V );
+
+    DistMatrix<Real,STAR,STAR> s_STAR_STAR(g);
+    s_STAR_STAR.Resize( n, 1 );
+    s_STAR_STAR.Matrix() = sLoc;
+    Copy( s_STAR_STAR, s );
+    return info;
+}
+
+template<typename Field>
+SVDInfo Jacobi
+( const Matrix<Field>& A,
+        Matrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> U, V;
+    return Jacobi( A, U, s, V, ctrl );
+}
+
+template<typename Field>
+SVDInfo Jacobi
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Field,VC,STAR> U(A.Grid());
+    DistMatrix<Field,VC,STAR> V(A.Grid());
+    return Jacobi( A, U, s, V, ctrl );
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_JACOBI_HPP
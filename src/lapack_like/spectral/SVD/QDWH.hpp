@@ -0,0 +1,249 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVD_QDWH_HPP
+#define EL_SVD_QDWH_HPP
+
+#include "../Polar/QDWH.hpp"
+
+namespace El {
+namespace svd {
+
+// The QDWH-SVD of
+//
+//   Yuji Nakatsukasa and Nicholas J. Higham,
+//   "Stable and efficient spectral divide and conquer algorithms for the
+//   symmetric eigenvalue decomposition and the SVD",
+//   SIAM J. Sci. Comput., 35(3), pp. A1325--A1349, 2013 [CITATION].
+//
+// After reducing a tall A to its (square) R factor, the polar decomposition
+// R = W H is computed with the QDWH iteration and the Hermitian positive
+// semi-definite factor is diagonalized as H = V Sigma V^H, so that
+// A = (Q W V) Sigma V^H. Rather than the memory-bound bidiagonalization,
+// almost all of the work lies in the QR factorizations, Cholesky
+// factorizations, and Gemm's of the QDWH iteration.
+
+namespace qdwh {
+
+// Rounding errors can result in slightly negative eigenvalues of H, so their
+// signs are moved into the columns of U before re-sorting
+template<typename Real,class MatrixType>
+void FixSigns( Matrix<Real>& s, MatrixType& U, MatrixType& V )
+{
+    EL_DEBUG_CSE
+    const Int n = s.Height();
+    for( Int j=0; j<n; ++j )
+    {
+        if( s(j) < Real(0) )
+        {
+            s(j) = -s(j);
+            auto u = U( ALL, IR(j) );
+            Scale( Real(-1), u );
+        }
+    }
+    auto sortPairs = TaggedSort( s, DESCENDING, true );
+    for( Int j=0; j<n; ++j )
+        s(j) = sortPairs[j].value;
+    ApplyTaggedSortToEachRow( sortPairs, U );
+    ApplyTaggedSortToEachRow( sortPairs, V );
+}
+
+template<typename Real>
+void FixSigns( Matrix<Real>& s )
+{
+    EL_DEBUG_CSE
+    const Int n = s.Height();
+    for( Int j=0; j<n; ++j )
+        s(j) = Abs(s(j));
+    Sort( s, DESCENDING );
+}
+
+template<typename Field>
+HermitianEigCtrl<Field> EigCtrl()
+{
+    HermitianEigCtrl<Field> eigCtrl;
+    eigCtrl.tridiagEigCtrl.sort = DESCENDING;
+    return eigCtrl;
+}
+
+} // namespace qdwh
+
+template<typename Field>
+SVDInfo QDWH
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    SVDInfo info;
+    if( m < n )
+    {
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+        info = QDWH( AAdj, V, s, U, ctrl );
+        return info;
+    }
+
+    // A = Q R
+    Matrix<Field> Q, R;
+    if( m > n )
+    {
+        Q = A;
+        qr::Explicit( Q, R );
+    }
+    else
+        R = A;
+
+    // R = W H
+    Matrix<Field> W( R ), H;
+    info.qdwhInfo = polar::QDWH( W, H, ctrl.qdwhCtrl );
+
+    // H = V Sigma V^H
+    HermitianEig( LOWER, H, s, V, qdwh::EigCtrl<Field>() );
+
+    // U := Q W V
+    Matrix<Field> WV;
+    Gemm( NORMAL, NORMAL, Field(1), W, V, WV );
+    qdwh::FixSigns( s, WV, V );
+    if( m > n )
+        Gemm( NORMAL, NORMAL, Field(1), Q, WV, U );
+    else
+        U = WV;
+    return info;
+}
+
+template<typename Field>
+SVDInfo QDWH
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    SVDInfo info;
+    if( m < n )
+    {
+        DistMatrix<Field> AAdj(g);
+        Adjoint( A, AAdj );
+        info = QDWH( AAdj, V, s, U, ctrl );
+        return info;
+    }
+
+    // A = Q R
+    DistMatrix<Field> Q(g), R(g);
+    if( m > n )
+    {
+        Copy( A, Q );
+        qr::Explicit( Q, R );
+    }
+    else
+        Copy( A, R );
+
+    // R = W H
+    DistMatrix<Field> W( R ), H(g);
+    info.qdwhInfo = polar::QDWH( W, H, ctrl.qdwhCtrl );
+
+    // H = V Sigma V^H
+    DistMatrix<Field> VH(g);
+    DistMatrix<Real,VR,STAR> s_VR_STAR(g);
+    HermitianEig( LOWER, H, s_VR_STAR, VH, qdwh::EigCtrl<Field>() );
+
+    // U := Q W V
+    DistMatrix<Field> WV(g);
+    Gemm( NORMAL, NORMAL, Field(1), W, VH, WV );
+    DistMatrix<Real,STAR,STAR> s_STAR_STAR( s_VR_STAR );
+    qdwh::FixSigns( s_STAR_STAR.Matrix(), WV, VH );
+    if( m > n )
+    {
+        DistMatrix<Field> UMCMR(g);
+        Gemm( NORMAL, NORMAL, Field(1), Q, WV, UMCMR );
+        Copy( UMCMR, U );
+    }
+    else
+        Copy( WV, U );
+    Copy( VH, V );
+    Copy( s_STAR_STAR, s );
+    return info;
+}
+
+template<typename Field>
+SVDInfo QDWH
+( const Matrix<Field>& A,
+        Matrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    SVDInfo info;
+    if( m < n )
+    {
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+        info = QDWH( AAdj, s, ctrl );
+        return info;
+    }
+
+    // Only the R factor of A is needed
+    Matrix<Field> W( A ), H;
+    if( m > n )
+        qr::ExplicitTriang( W );
+
+    info.qdwhInfo = polar::QDWH( W, H, ctrl.qdwhCtrl );
+    HermitianEig( LOWER, H, s, qdwh::EigCtrl<Field>() );
+    qdwh::FixSigns( s );
+    return info;
+}
+
+template<typename Field>
+SVDInfo QDWH
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    SVDInfo info;
+    if( m < n )
+    {
+        DistMatrix<Field> AAdj(g);
+        Adjoint( A, AAdj );
+        info = QDWH( AAdj, s, ctrl );
+        return info;
+    }
+
+    // Only the R factor of A is needed
+    DistMatrix<Field> W( A ), H(g);
+    if( m > n )
+        qr::ExplicitTriang( W );
+
+    info.qdwhInfo = polar::QDWH( W, H, ctrl.qdwhCtrl );
+    DistMatrix<Real,VR,STAR> s_VR_STAR(g);
+    HermitianEig( LOWER, H, s_VR_STAR, qdwh::EigCtrl<Field>() );
+    DistMatrix<Real,STAR,STAR> s_STAR_STAR( s_VR_STAR );
+    qdwh::FixSigns( s_STAR_STAR.Matrix() );
+    Copy( s_STAR_STAR, s );
+    return info;
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_QDWH_HPP
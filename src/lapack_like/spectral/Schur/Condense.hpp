@@ -21,13 +21,11 @@ void Condense
     EL_DEBUG_CSE
     Timer timer;
 
-    Matrix<F> householderScalars;
     if( ctrl.time )
         timer.Start();
-    Hessenberg( UPPER, A, householderScalars );
+    hessenberg::ExplicitCondensed( UPPER, A, ctrl.hessCtrl );
     if( ctrl.time )
         Output("  Hessenberg reduction: ",timer.Stop()," seconds");
-    MakeTrapezoidal( UPPER, A, -1 );
 
     if( ctrl.time )
         timer.Start();
@@ -54,14 +52,19 @@ void Condense
     EL_DEBUG_CSE
     Timer timer;
 
-    Matrix<F> householderScalars;
     if( ctrl.time )
         timer.Start();
-    Hessenberg( UPPER, A, householderScalars );
+    if( ctrl.hessCtrl.twoStage )
+        hessenberg::TwoStage( A, Q, ctrl.hessCtrl.bandwidth );
+    else
+    {
+        Matrix<F> householderScalars;
+        Hessenberg( UPPER, A, householderScalars );
+        hessenberg::FormQ( UPPER, A, householderScalars, Q );
+        MakeTrapezoidal( UPPER, A, -1 );
+    }
     if( ctrl.time )
         Output("  Hessenberg reduction: ",timer.Stop()," seconds");
-    hessenberg::FormQ( UPPER, A, householderScalars, Q );
-    MakeTrapezoidal( UPPER, A, -1 );
 
     auto hessSchurCtrl( ctrl.hessSchurCtrl );
     hessSchurCtrl.accumulateSchurVecs = true;
@@ -93,7 +96,7 @@ void Condense
     // Reduce the matrix to upper-Hessenberg form in an elemental form
     if( ctrl.time && grid.Rank() == 0 )
         timer.Start();
-    hessenberg::ExplicitCondensed( UPPER, A );
+    hessenberg::ExplicitCondensed( UPPER, A, ctrl.hessCtrl );
     if( ctrl.time && grid.Rank() == 0 )
         Output("  Hessenberg reduction: ",timer.Stop()," seconds"); 
 
@@ -125,21 +128,33 @@ void Condense
     const Grid& grid = A.Grid();
     Timer timer;
 
-    // Reduce A to upper-Hessenberg form
-    DistMatrix<F,STAR,STAR> householderScalars( A.Grid() );
-    if( ctrl.time && grid.Rank() == 0 )
-        timer.Start();
-    Hessenberg( UPPER, A, householderScalars );
-    if( ctrl.time && grid.Rank() == 0 )
-        Output("  Hessenberg reduction: ",timer.Stop()," seconds");
-
-    // Explicitly accumulate the Householder transformations into Q
-    if( ctrl.time && grid.Rank() == 0 )
-        timer.Start();
-    hessenberg::FormQ( UPPER, A, householderScalars, Q );
-    if( ctrl.time && grid.Rank() == 0 )
-        Output("  hessenberg::FormQ: ",timer.Stop()," seconds");
-    MakeTrapezoidal( UPPER, A, -1 );
+    if( ctrl.hessCtrl.twoStage )
+    {
+        // Reduce A to upper-Hessenberg form while accumulating Q
+        if( ctrl.time && grid.Rank() == 0 )
+            timer.Start();
+        hessenberg::TwoStage( A, Q, ctrl.hessCtrl.bandwidth );
+        if( ctrl.time && grid.Rank() == 0 )
+            Output("  Two-stage Hessenberg: ",timer.Stop()," seconds");
+    }
+    else
+    {
+        // Reduce A to upper-Hessenberg form
+        DistMatrix<F,STAR,STAR> householderScalars( A.Grid() );
+        if( ctrl.time && grid.Rank() == 0 )
+            timer.Start();
+        Hessenberg( UPPER, A, householderScalars );
+        if( ctrl.time && grid.Rank() == 0 )
+            Output("  Hessenberg reduction: ",timer.Stop()," seconds");
+
+        // Explicitly accumulate the Householder transformations into Q
+        if( ctrl.time && grid.Rank() == 0 )
+            timer.Start();
+        hessenberg::FormQ( UPPER, A, householderScalars, Q );
+        if( ctrl.time && grid.Rank() == 0 )
+            Output("  hessenberg::FormQ: ",timer.Stop()," seconds");
+        MakeTrapezoidal( UPPER, A, -1 );
+    }
     
     // Call the black-box HessenbergSchur decomposition
     if( ctrl.time && grid.Rank() == 0 )
@@ -1083,6 +1083,28 @@ inline bool SplitGrid
     }
 }
 
+// Since no inter-grid redistributions exist for [VR,* ] distributions yet,
+// route the translation of w from the grid of wSub through [MC,MR]
+template<typename T>
+void PullVRStar
+( DistMatrix<T,VR,STAR>& wSub, DistMatrix<T,VR,STAR>& w )
+{
+    EL_DEBUG_CSE
+    if( w.Grid() == wSub.Grid() )
+    {
+        w = wSub;
+        return;
+    }
+    bool includeViewers = true;
+    DistMatrix<T> wSub_MC_MR( wSub.Grid() );
+    if( wSub.Participating() )
+        wSub_MC_MR = wSub;
+    wSub_MC_MR.MakeConsistent( includeViewers );
+    DistMatrix<T> w_MC_MR( w.Grid() );
+    w_MC_MR = wSub_MC_MR;
+    w = w_MC_MR;
+}
+
 template<typename F,typename EigType>
 bool PushSubproblems
 ( DistMatrix<F>& ATL,
@@ -1134,34 +1156,10 @@ void PullSubproblems
     ATL = ATLSub;
     ABR = ABRSub;
 
-    // This section is a hack since no inter-grid redistributions exist for
-    // [VR,* ] distributions yet
     if( progress && grid.Rank() == 0 )
         Output("Pulling wT and wB");
-    if( sameGrid )
-    {
-        wT = wTSub;
-        wB = wBSub;
-    }
-    else
-    {
-        bool includeViewers = true;
-        DistMatrix<EigType> wTSub_MC_MR( wTSub.Grid() );
-        if( wTSub.Participating() )
-            wTSub_MC_MR = wTSub;
-        wTSub_MC_MR.MakeConsistent( includeViewers );
-        DistMatrix<EigType> wT_MC_MR(wT.Grid());
-        wT_MC_MR = wTSub_MC_MR;
-        wT = wT_MC_MR;
-
-        DistMatrix<EigType> wBSub_MC_MR( wBSub.Grid() );
-        if( wBSub.Participating() )
-            wBSub_MC_MR = wBSub;
-        wBSub_MC_MR.MakeConsistent( includeViewers );
-        DistMatrix<EigType> wB_MC_MR(wB.Grid());
-        wB_MC_MR = wBSub_MC_MR;
-        wB = wB_MC_MR;
-    }
+    PullVRStar( wTSub, wT );
+    PullVRStar( wBSub, wB );
 
     const Grid *leftGrid = &ATLSub.Grid();
     const Grid *rightGrid = &ABRSub.Grid();
@@ -1325,39 +1323,16 @@ void PullSubproblems
     ATL = ATLSub;
     ABR = ABRSub;
 
-    // This section is a hack since no inter-grid redistributions exist for
-    // [VR,* ] distributions yet
-    bool includeViewers = true;
     if( progress && grid.Rank() == 0 )
         Output("Pulling wT and wB");
-    if( sameGrid )
-    {
-        wT = wTSub;
-        wB = wBSub;
-    }
-    else
-    {
-        DistMatrix<EigType> wTSub_MC_MR( wTSub.Grid() );
-        if( wTSub.Participating() )
-            wTSub_MC_MR = wTSub;
-        wTSub_MC_MR.MakeConsistent( includeViewers );
-        DistMatrix<EigType> wT_MC_MR(wT.Grid());
-        wT_MC_MR = wTSub_MC_MR;
-        wT = wT_MC_MR;
-
-        DistMatrix<EigType> wBSub_MC_MR( wBSub.Grid() );
-        if( wBSub.Participating() )
-            wBSub_MC_MR = wBSub;
-        wBSub_MC_MR.MakeConsistent( includeViewers );
-        DistMatrix<EigType> wB_MC_MR(wB.Grid());
-        wB_MC_MR = wBSub_MC_MR;
-        wB = wB_MC_MR;
-    }
+    PullVRStar( wTSub, wT );
+    PullVRStar( wBSub, wB );
 
     if( progress && grid.Rank() == 0 )
         Output("Pulling ZT and ZB");
     if( !sameGrid )
     {
+        bool includeViewers = true;
         ZTSub.MakeConsistent( includeViewers );
         ZBSub.MakeConsistent( includeViewers );
     }
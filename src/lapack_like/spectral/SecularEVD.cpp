@@ -488,7 +488,8 @@ void SecularUpdate
         const Real rightGap = state.dMinusShift(origin+1);
 
         Real a;
-        Matrix<Real> zCubic(3,1);
+        Real zCubicBuf[3];
+        Matrix<Real> zCubic( 3, 1, zCubicBuf, 3 );
         if( state.alternateStrategy )
         {
             a = state.secularMinus - leftGap*state.psiMinusDeriv -
@@ -597,7 +598,8 @@ void SecularUpdate
                 zCubic(2) = z(origin+1)*z(origin+1);
             }
         }
-        Matrix<Real> dCubic(3,1);
+        Real dCubicBuf[3];
+        Matrix<Real> dCubic( 3, 1, dCubicBuf, 3 );
         dCubic(0) = leftGap;
         dCubic(1) = state.dMinusShift(origin);
         dCubic(2) = rightGap;
@@ -1221,24 +1223,66 @@ SecularEigenvalue
         return info;
     }
 
+    // The solvers work directly within dMinusShift rather than a workspace
     if( k < n-1 )
     {
         secular_evd::State<Real> state;
+        View( state.dMinusShift, dMinusShift );
         info = secular_evd::SecularInner( k, d, rho, z, state, ctrl );
         eigenvalue = state.rootEst;
-        dMinusShift = state.dMinusShift;
     }
     else
     {
         secular_evd::LastState<Real> state;
+        View( state.dMinusShift, dMinusShift );
         info = secular_evd::SecularLast( k, d, rho, z, state, ctrl );
         eigenvalue = state.rootEst;
-        dMinusShift = state.dMinusShift;
     }
 
     return info;
 }
 
+template<typename Real,typename>
+SecularEVDInfo
+SecularEigenvalues
+( Int firstValue,
+  Int valueStride,
+  Int numValues,
+  const Matrix<Real>& d,
+  const Real& rho,
+  const Matrix<Real>& z,
+        Matrix<Real>& w,
+        Matrix<Real>& dMinusShift,
+  const SecularEVDCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = d.Height();
+    w.Resize( numValues, 1 );
+    dMinusShift.Resize( n, numValues );
+
+    // The roots are independent, so they are split across threads, with
+    // each solve working in place within its column of dMinusShift
+    vector<SecularEVDInfo> valueInfos( numValues );
+    EL_PARALLEL_FOR_GRAIN(numValues*n)
+    for( Int t=0; t<numValues; ++t )
+    {
+        auto dMinusShiftCol = dMinusShift( ALL, IR(t) );
+        valueInfos[t] =
+          SecularEigenvalue
+          ( firstValue+t*valueStride, d, rho, z, w(t), dMinusShiftCol, ctrl );
+    }
+
+    SecularEVDInfo info;
+    for( const auto& valueInfo : valueInfos )
+    {
+        info.numIterations += valueInfo.numIterations;
+        info.numAlternations += valueInfo.numAlternations;
+        info.numCubicIterations += valueInfo.numCubicIterations;
+        info.numCubicFailures += valueInfo.numCubicFailures;
+    }
+    return info;
+}
+
 template<typename Real,typename>
 SecularEVDInfo
 SecularEVD
@@ -1272,15 +1316,11 @@ SecularEVD
         return info;
     }
 
-    // TODO(poulson): Batch secular equation solvers?
-    //
     // Compute all of the eigenvalues and the vector r ~= sqrt(rho) z which
     // would produce the given eigenvalues to high relative accuracy.
     //
-    // We accumulate the products involved in computing r in an online manner
-    // and take the square-root of the absolute value (and the correct sign)
-    // at the end. The key is to recognize that the only term left out of entry
-    // i of the corrected vector in Eq. (3.6) of Gu/Eisenstat in the product
+    // The key is to recognize that the only term left out of entry i of the
+    // corrected vector in Eq. (3.6) of Gu/Eisenstat in the product
     //
     //    prod_{k=0}^{n-1} (lambda_k - d(i)) / (d(k) - d(i))
     //
@@ -1297,35 +1337,29 @@ SecularEVD
     //      prod_{k=0  }^{i-1} (lambda_k - d(i)) / (d(k) - d(i)) *
     //      prod_{k=i+1}^{n-1} (lambda_k - d(i)) / (d(k) - d(i)).
     //
-    // Given that we have available only one lambda_j at a time, we greedily
-    // update all r(i) products given each lambda_j
-    // (Cf. LAPACK's {s,d}lasd8 [CITATION] for this approach).
+    // (Cf. LAPACK's {s,d}lasd8 [CITATION] for this approach). Since all of
+    // the eigenvalues are solved for in a batch, with d - lambda_j stored in
+    // the j'th column of Q, each r(i) is formed independently from row i.
     //
     Q.Resize( n, n );
-    Matrix<Real> r;
-    Ones( r, n, 1 );
-    for( Int j=0; j<n; ++j )
-    {
-        // While we will temporarily store dMinusShift in the j'th column of Q.
-        auto q = Q(ALL,IR(j));
-        auto valueInfo = SecularEigenvalue( j, d, rho, z, w(j), q, ctrl );
-
-        info.numIterations += valueInfo.numIterations;
-        info.numAlternations += valueInfo.numAlternations;
-        info.numCubicIterations += valueInfo.numCubicIterations;
-        info.numCubicFailures += valueInfo.numCubicFailures;
+    info = SecularEigenvalues( 0, 1, n, d, rho, z, w, Q, ctrl );
 
-        r(j) *= q(j);
-        for( Int k=0; k<n; ++k )
+    Matrix<Real> r( n, 1 );
+    EL_PARALLEL_FOR_GRAIN(n*n)
+    for( Int i=0; i<n; ++i )
+    {
+        Real product = 1;
+        for( Int j=0; j<n; ++j )
         {
-            if( k == j )
-                continue;
-            r(k) *= q(k) / (d(j)-d(k));
+            if( j == i )
+                product *= Q(i,i);
+            else
+                product *= Q(i,j) / (d(j)-d(i));
         }
+        r(i) = Sgn(z(i),false) * Sqrt(Abs(product));
     }
-    for( Int j=0; j<n; ++j )
-        r(j) = Sgn(z(j),false) * Sqrt(Abs(r(j)));
 
+    EL_PARALLEL_FOR_GRAIN(n*n)
     for( Int j=0; j<n; ++j )
     {
         // Compute the j'th eigenvectors via Eqs. (3.4) and (3.3), respectively.
@@ -1359,6 +1393,17 @@ SecularEVD
           Matrix<Real>& dMinusShift, \
     const SecularEVDCtrl<Real>& ctrl ); \
   template SecularEVDInfo \
+  SecularEigenvalues \
+  ( Int firstValue, \
+    Int valueStride, \
+    Int numValues, \
+    const Matrix<Real>& d, \
+    const Real& rho, \
+    const Matrix<Real>& z, \
+          Matrix<Real>& w, \
+          Matrix<Real>& dMinusShift, \
+    const SecularEVDCtrl<Real>& ctrl ); \
+  template SecularEVDInfo \
   SecularEVD \
   ( const Matrix<Real>& d, \
     const Real& rho, \
@@ -604,7 +604,8 @@ void SecularUpdate
           state.dPlusShift(origin+1)*state.dMinusShift(origin+1);
 
         Real a;
-        Matrix<Real> zCubic(3,1);
+        Real zCubicBuf[3];
+        Matrix<Real> zCubic( 3, 1, zCubicBuf, 3 );
         if( state.alternateStrategy )
         {
             a = state.secularMinus - leftGap*state.psiMinusDeriv -
@@ -715,7 +716,8 @@ void SecularUpdate
                 zCubic(2) = z(origin+1)*z(origin+1);
             }
         }
-        Matrix<Real> dCubic(3,1);
+        Real dCubicBuf[3];
+        Matrix<Real> dCubic( 3, 1, dCubicBuf, 3 );
         dCubic(0) = leftGap;
         dCubic(1) = state.dPlusShift(origin)*state.dMinusShift(origin);
         dCubic(2) = rightGap;
@@ -1399,26 +1401,74 @@ SecularSingularValue
         return info;
     }
 
+    // The solvers work directly within dMinusShift and dPlusShift rather than
+    // workspaces
     if( k < n-1 )
     {
         secular_svd::State<Real> state;
+        View( state.dMinusShift, dMinusShift );
+        View( state.dPlusShift, dPlusShift );
         info = secular_svd::SecularInner( k, d, rho, z, state, ctrl );
         singularValue = state.sigmaEst;
-        dPlusShift = state.dPlusShift;
-        dMinusShift = state.dMinusShift;
     }
     else
     {
         secular_svd::LastState<Real> state;
+        View( state.dMinusShift, dMinusShift );
+        View( state.dPlusShift, dPlusShift );
         info = secular_svd::SecularLast( k, d, rho, z, state, ctrl );
         singularValue = state.sigmaEst;
-        dPlusShift = state.dPlusShift;
-        dMinusShift = state.dMinusShift;
     }
 
     return info;
 }
 
+template<typename Real,typename>
+SecularSVDInfo
+SecularSingularValues
+( Int firstValue,
+  Int valueStride,
+  Int numValues,
+  const Matrix<Real>& d,
+  const Real& rho,
+  const Matrix<Real>& z,
+        Matrix<Real>& s,
+        Matrix<Real>& dMinusShift,
+        Matrix<Real>& dPlusShift,
+  const SecularSVDCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = d.Height();
+    s.Resize( numValues, 1 );
+    dMinusShift.Resize( n, numValues );
+    dPlusShift.Resize( n, numValues );
+
+    // The roots are independent, so they are split across threads, with
+    // each solve working in place within its columns of dMinusShift and
+    // dPlusShift
+    vector<SecularSVDInfo> valueInfos( numValues );
+    EL_PARALLEL_FOR_GRAIN(numValues*n)
+    for( Int t=0; t<numValues; ++t )
+    {
+        auto dMinusShiftCol = dMinusShift( ALL, IR(t) );
+        auto dPlusShiftCol = dPlusShift( ALL, IR(t) );
+        valueInfos[t] =
+          SecularSingularValue
+          ( firstValue+t*valueStride, d, rho, z, s(t),
+            dMinusShiftCol, dPlusShiftCol, ctrl );
+    }
+
+    SecularSVDInfo info;
+    for( const auto& valueInfo : valueInfos )
+    {
+        info.numIterations += valueInfo.numIterations;
+        info.numAlternations += valueInfo.numAlternations;
+        info.numCubicIterations += valueInfo.numCubicIterations;
+        info.numCubicFailures += valueInfo.numCubicFailures;
+    }
+    return info;
+}
+
 template<typename Real,typename>
 SecularSVDInfo
 SecularSVD
@@ -1459,15 +1509,11 @@ SecularSVD
         return info;
     }
 
-    // TODO(poulson): Batch secular equation solvers?
-    //
     // Compute all of the singular values and the vector r ~= sqrt(rho) z which
     // would produce the given singular values to high relative accuracy.
     //
-    // We accumulate the products involved in computing r in an online manner
-    // and take the square-root of the absolute value (and the correct sign)
-    // at the end. The key is to recognize that the only term left out of entry
-    // i of the corrected vector in Eq. (3.6) of Gu/Eisenstat in the product
+    // The key is to recognize that the only term left out of entry i of the
+    // corrected vector in Eq. (3.6) of Gu/Eisenstat in the product
     //
     //    prod_{k=0}^{n-1} (sigma_k^2 - d(i)^2) / (d(k)^2 - d(i)^2)
     //
@@ -1484,46 +1530,38 @@ SecularSVD
     //      prod_{k=0  }^{i-1} (sigma_k^2 - d(i)^2) / (d(k)^2 - d(i)^2) *
     //      prod_{k=i+1}^{n-1} (sigma_k^2 - d(i)^2) / (d(k)^2 - d(i)^2).
     //
-    // Given that we have available only one sigma_j at a time, we greedily
-    // update all r(i) products given each sigma_j
-    // (Cf. LAPACK's {s,d}lasd8 [CITATION] for this approach).
+    // (Cf. LAPACK's {s,d}lasd8 [CITATION] for this approach). Since all of
+    // the singular values are solved for in a batch, with d - s(j) and
+    // d + s(j) stored in the j'th columns of U and V, each r(i) is formed
+    // independently from row i.
     //
     U.Resize( n, n );
     V.Resize( n, n );
-    Matrix<Real> r;
-    Ones( r, n, 1 );
-    auto vScratch = V(ALL,IR(0));
-    for( Int j=0; j<n; ++j )
-    {
-        // While we will temporarily store dMinusShift and dPlusShift in the
-        // j'th columns of U and V, respectively, it is worth noting that we
-        // only require access to their Hadamard product after this loop ends.
-        auto u = U(ALL,IR(j));
-        auto valueInfo =
-          SecularSingularValue( j, d, rho, z, s(j), u, vScratch, ctrl );
-
-        info.numIterations += valueInfo.numIterations;
-        info.numAlternations += valueInfo.numAlternations;
-        info.numCubicIterations += valueInfo.numCubicIterations;
-        info.numCubicFailures += valueInfo.numCubicFailures;
+    info = SecularSingularValues( 0, 1, n, d, rho, z, s, U, V, ctrl );
 
-        // u currently hold d-s(j) and vScratch currently holds d+s(j).
-        // Overwrite u with their element-wise product since that is all we
-        // require from here on out.
-        for( Int k=0; k<n; ++k )
-            u(k) *= vScratch(k);
+    // Overwrite U with the element-wise product of d - s(j) and d + s(j),
+    // since that is all we require from here on out.
+    EL_PARALLEL_FOR_GRAIN(n*n)
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            U(i,j) *= V(i,j);
 
-        r(j) *= u(j);
-        for( Int k=0; k<n; ++k )
+    Matrix<Real> r( n, 1 );
+    EL_PARALLEL_FOR_GRAIN(n*n)
+    for( Int i=0; i<n; ++i )
+    {
+        Real product = 1;
+        for( Int j=0; j<n; ++j )
         {
-            if( k == j )
-                continue;
-            r(k) *= u(k) / ((d(j)+d(k))*(d(j)-d(k)));
+            if( j == i )
+                product *= U(i,i);
+            else
+                product *= U(i,j) / ((d(j)+d(i))*(d(j)-d(i)));
         }
+        r(i) = Sgn(z(i),false) * Sqrt(Abs(product));
     }
-    for( Int j=0; j<n; ++j )
-        r(j) = Sgn(z(j),false) * Sqrt(Abs(r(j)));
 
+    EL_PARALLEL_FOR_GRAIN(n*n)
     for( Int j=0; j<n; ++j )
     {
         // Compute the j'th left and right singular vectors via
@@ -1568,6 +1606,18 @@ SecularSVD
           Matrix<Real>& dPlusShift, \
     const SecularSVDCtrl<Real>& ctrl ); \
   template SecularSVDInfo \
+  SecularSingularValues \
+  ( Int firstValue, \
+    Int valueStride, \
+    Int numValues, \
+    const Matrix<Real>& d, \
+    const Real& rho, \
+    const Matrix<Real>& z, \
+          Matrix<Real>& s, \
+          Matrix<Real>& dMinusShift, \
+          Matrix<Real>& dPlusShift, \
+    const SecularSVDCtrl<Real>& ctrl ); \
+  template SecularSVDInfo \
   SecularSVD \
   ( const Matrix<Real>& d, \
     const Real& rho, \
@@ -0,0 +1,364 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace sketch {
+
+// The counter-based draws of the random signs of an SRHT (in counter column
+// zero) and of its sampled columns (in counter column one)
+inline Int SRHTSign
+( unsigned long long seed, unsigned long long stream, Int j )
+{ return CounterBasedUniforms(seed,stream,j,0)[0] < 0.5 ? -1 : 1; }
+
+// Draw the distinct columns and the signs of the nonzeros of row i of a
+// sparse sign embedding, rejecting repeated columns
+inline void SparseSignRow
+( unsigned long long seed, unsigned long long stream, Int i,
+  Int width, Int numNonzeros, vector<Int>& cols, vector<Int>& signs )
+{
+    cols.clear();
+    signs.clear();
+    for( Int attempt=0; Int(cols.size())<numNonzeros; ++attempt )
+    {
+        const auto uniforms = CounterBasedUniforms(seed,stream,i,attempt);
+        const Int col = Min( Int(uniforms[0]*width), width-1 );
+        if( std::find(cols.begin(),cols.end(),col) == cols.end() )
+        {
+            cols.push_back( col );
+            signs.push_back( uniforms[1] < 0.5 ? -1 : 1 );
+        }
+    }
+}
+
+// Z := A D H S / sqrt(numSamples). Blocks of rows of A D are copied into a
+// zero-padded buffer which is then transformed in place with a fast
+// Walsh-Hadamard transform, so that each butterfly acts upon contiguous
+// columns of the buffer.
+template<typename F>
+void ApplySRHT
+( const Matrix<F>& A,
+  const vector<Int>& signs,
+        Int N,
+  const vector<Int>& samples,
+        Matrix<F>& Z )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numSamples = samples.size();
+    const Int bsize = Blocksize();
+    const Real scale = Real(1) / Sqrt(Real(numSamples));
+
+    Matrix<F> W;
+    for( Int i=0; i<m; i+=bsize )
+    {
+        const Int nb = Min(bsize,m-i);
+        Zeros( W, nb, N );
+        for( Int j=0; j<n; ++j )
+        {
+            const F* aCol = A.LockedBuffer(i,j);
+            F* wCol = W.Buffer(0,j);
+            const Real sign = signs[j];
+            for( Int r=0; r<nb; ++r )
+                wCol[r] = sign*aCol[r];
+        }
+
+        for( Int h=1; h<N; h*=2 )
+        {
+            for( Int j=0; j<N; j+=2*h )
+            {
+                for( Int k=j; k<j+h; ++k )
+                {
+                    F* w0 = W.Buffer(0,k);
+                    F* w1 = W.Buffer(0,k+h);
+                    for( Int r=0; r<nb; ++r )
+                    {
+                        const F alpha = w0[r];
+                        const F beta = w1[r];
+                        w0[r] = alpha + beta;
+                        w1[r] = alpha - beta;
+                    }
+                }
+            }
+        }
+
+        for( Int t=0; t<numSamples; ++t )
+        {
+            const F* wCol = W.LockedBuffer(0,samples[t]);
+            F* zCol = Z.Buffer(i,t);
+            for( Int r=0; r<nb; ++r )
+                zCol[r] = scale*wCol[r];
+        }
+    }
+}
+
+} // namespace sketch
+
+template<typename F>
+SketchOperator<F>::SketchOperator
+( RandomizedSketchType type, Int height, Int width, Int sparsity )
+: type_(type), height_(height), width_(width), sparsity_(sparsity),
+  seed_(CounterBasedSeed()), stream_(NextCounterBasedStream())
+{
+    EL_DEBUG_CSE
+    if( height < 0 || width < 0 )
+        LogicError("Invalid sketch dimensions of ",height," x ",width);
+    if( type == SPARSE_SIGN_SKETCH && sparsity <= 0 )
+        LogicError("Invalid sparse sign sketch sparsity of ",sparsity);
+    if( type == SRHT_SKETCH )
+    {
+        hadamardOrder_ = 1;
+        while( hadamardOrder_ < height )
+            hadamardOrder_ *= 2;
+        if( width > hadamardOrder_ )
+            LogicError
+            ("Cannot sample ",width," columns of a Hadamard matrix of order ",
+             hadamardOrder_);
+
+        // A partial Fisher-Yates shuffle
+        vector<Int> perm( hadamardOrder_ );
+        for( Int j=0; j<hadamardOrder_; ++j )
+            perm[j] = j;
+        for( Int t=0; t<width; ++t )
+        {
+            const double u = CounterBasedUniforms(seed_,stream_,t,1)[0];
+            const Int numLeft = hadamardOrder_ - t;
+            const Int offset = Min( Int(u*numLeft), numLeft-1 );
+            std::swap( perm[t], perm[t+offset] );
+        }
+        samples_.assign( perm.begin(), perm.begin()+width );
+    }
+}
+
+template<typename F>
+void SketchOperator<F>::LocalApply
+( const Matrix<F>& A, Int colShift, Int colStride, Matrix<F>& Z ) const
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int nLoc = A.Width();
+    const Int k = width_;
+    if( type_ == SRHT_SKETCH )
+    {
+        if( colShift != 0 || colStride != 1 || nLoc != height_ )
+            LogicError("An SRHT must be applied to entire rows");
+        vector<Int> signs( height_ );
+        for( Int j=0; j<height_; ++j )
+            signs[j] = sketch::SRHTSign( seed_, stream_, j );
+        sketch::ApplySRHT( A, signs, hadamardOrder_, samples_, Z );
+    }
+    else if( type_ == SPARSE_SIGN_SKETCH )
+    {
+        // Each column of A is added into the columns of Z selected by the
+        // nonzeros of the corresponding row of Omega
+        const Int numNonzeros = Min( sparsity_, k );
+        const Real scale = Real(1) / Sqrt(Real(numNonzeros));
+        vector<Int> cols, signs;
+        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+        {
+            const Int j = colShift + jLoc*colStride;
+            sketch::SparseSignRow
+            ( seed_, stream_, j, k, numNonzeros, cols, signs );
+            const F* aCol = A.LockedBuffer(0,jLoc);
+            for( Int s=0; s<numNonzeros; ++s )
+                blas::Axpy
+                ( m, F(Real(signs[s])*scale), aCol, 1, Z.Buffer(0,cols[s]), 1 );
+        }
+    }
+    else
+    {
+        // Generate a block of rows of Omega at a time and accumulate its
+        // product with the corresponding block of columns of A
+        const Int bsize = Blocksize();
+        const bool gaussian = ( type_ == GAUSSIAN_SKETCH );
+        const auto seed = seed_;
+        const auto stream = stream_;
+        Matrix<F> OmegaBlock;
+        for( Int jLoc=0; jLoc<nLoc; jLoc+=bsize )
+        {
+            const Int nb = Min(bsize,nLoc-jLoc);
+            OmegaBlock.Resize( nb, k );
+            F* OmegaBuf = OmegaBlock.Buffer();
+            const Int OmegaLDim = OmegaBlock.LDim();
+            EL_PARALLEL_FOR_COLLAPSE2_GRAIN(nb*k)
+            for( Int t=0; t<k; ++t )
+            {
+                for( Int r=0; r<nb; ++r )
+                {
+                    const Int j = colShift + (jLoc+r)*colStride;
+                    const auto uniforms =
+                      CounterBasedUniforms( seed, stream, j, t );
+                    OmegaBuf[r+t*OmegaLDim] =
+                      gaussian ?
+                      counter_based::Normal( uniforms, F(0), Real(1) ) :
+                      ( uniforms[0] < 0.5 ? F(-1) : F(1) );
+                }
+            }
+            Gemm
+            ( NORMAL, NORMAL,
+              F(1), A( ALL, IR(jLoc,jLoc+nb) ), OmegaBlock, F(1), Z );
+        }
+    }
+}
+
+template<typename F>
+void SketchOperator<F>::Apply
+( F alpha, const Matrix<F>& A, F beta, Matrix<F>& Y ) const
+{
+    EL_DEBUG_CSE
+    if( A.Width() != height_ )
+        LogicError
+        ("Cannot apply a ",height_," x ",width_," sketch to a ",A.Height(),
+         " x ",A.Width()," matrix");
+    if( Y.Height() != A.Height() || Y.Width() != width_ )
+        LogicError("Y was ",Y.Height()," x ",Y.Width());
+    Matrix<F> Z;
+    Zeros( Z, A.Height(), width_ );
+    LocalApply( A, 0, 1, Z );
+    Scale( beta, Y );
+    Axpy( alpha, Z, Y );
+}
+
+template<typename F>
+void SketchOperator<F>::Apply( const Matrix<F>& A, Matrix<F>& Y ) const
+{
+    EL_DEBUG_CSE
+    Y.Resize( A.Height(), width_ );
+    Apply( F(1), A, F(0), Y );
+}
+
+template<typename F>
+void SketchOperator<F>::Apply
+( F alpha, const AbstractDistMatrix<F>& APre,
+  F beta,        AbstractDistMatrix<F>& Y ) const
+{
+    EL_DEBUG_CSE
+    const Grid& g = APre.Grid();
+    const Int m = APre.Height();
+    if( APre.Width() != height_ )
+        LogicError
+        ("Cannot apply a ",height_," x ",width_," sketch to a ",m," x ",
+         APre.Width()," matrix");
+    if( Y.Height() != m || Y.Width() != width_ )
+        LogicError("Y was ",Y.Height()," x ",Y.Width());
+
+    if( type_ == SRHT_SKETCH )
+    {
+        // The fast Walsh-Hadamard transform needs entire rows of A
+        DistMatrixReadProxy<F,F,VC,STAR> AProx( APre );
+        auto& A = AProx.GetLocked();
+        DistMatrix<F,VC,STAR> Z(g);
+        Z.AlignWith( A );
+        Zeros( Z, m, width_ );
+        LocalApply( A.LockedMatrix(), 0, 1, Z.Matrix() );
+        Scale( beta, Y );
+        Axpy( alpha, Z, Y );
+    }
+    else
+    {
+        DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+        auto& A = AProx.GetLocked();
+        DistMatrix<F,MC,STAR> Z(g);
+        Z.AlignWith( A );
+        Zeros( Z, m, width_ );
+        LocalApply
+        ( A.LockedMatrix(), A.RowShift(), A.RowStride(), Z.Matrix() );
+        AllReduce( Z.Matrix(), A.RowComm() );
+        Scale( beta, Y );
+        Axpy( alpha, Z, Y );
+    }
+}
+
+template<typename F>
+void SketchOperator<F>::Apply
+( const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& Y ) const
+{
+    EL_DEBUG_CSE
+    Y.Resize( A.Height(), width_ );
+    Apply( F(1), A, F(0), Y );
+}
+
+template<typename F>
+void SketchOperator<F>::Form( Matrix<F>& Omega ) const
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    Zeros( Omega, height_, width_ );
+    if( type_ == SRHT_SKETCH )
+    {
+        // Entry (j,s) of the Walsh-Hadamard matrix is the parity of the
+        // number of bits shared by j and s
+        const Real scale = Real(1) / Sqrt(Real(width_));
+        for( Int t=0; t<width_; ++t )
+        {
+            const Int s = samples_[t];
+            for( Int j=0; j<height_; ++j )
+            {
+                Int parity = 0;
+                for( Int shared=(j & s); shared != 0; shared >>= 1 )
+                    parity ^= (shared & 1);
+                const Int sign = sketch::SRHTSign( seed_, stream_, j );
+                Omega(j,t) = F( Real(parity ? -sign : sign)*scale );
+            }
+        }
+    }
+    else if( type_ == SPARSE_SIGN_SKETCH )
+    {
+        const Int numNonzeros = Min( sparsity_, width_ );
+        const Real scale = Real(1) / Sqrt(Real(numNonzeros));
+        vector<Int> cols, signs;
+        for( Int j=0; j<height_; ++j )
+        {
+            sketch::SparseSignRow
+            ( seed_, stream_, j, width_, numNonzeros, cols, signs );
+            for( Int s=0; s<numNonzeros; ++s )
+                Omega(j,cols[s]) = F( Real(signs[s])*scale );
+        }
+    }
+    else
+    {
+        for( Int t=0; t<width_; ++t )
+        {
+            for( Int j=0; j<height_; ++j )
+            {
+                const auto uniforms = CounterBasedUniforms(seed_,stream_,j,t);
+                if( type_ == GAUSSIAN_SKETCH )
+                    Omega(j,t) =
+                      counter_based::Normal( uniforms, F(0), Real(1) );
+                else
+                    Omega(j,t) = ( uniforms[0] < 0.5 ? F(-1) : F(1) );
+            }
+        }
+    }
+}
+
+template<typename F>
+RandomizedSketchType SketchOperator<F>::Type() const { return type_; }
+
+template<typename F>
+Int SketchOperator<F>::Height() const { return height_; }
+
+template<typename F>
+Int SketchOperator<F>::Width() const { return width_; }
+
+#define PROTO(F) \
+  template class SketchOperator<F>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
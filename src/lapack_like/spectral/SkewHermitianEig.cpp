@@ -10,6 +10,373 @@
 
 namespace El {
 
+namespace skew_herm_eig {
+
+// Complex skew-Hermitian matrices are handled by computing the eigenpairs of
+// the Hermitian matrix -i G.
+//
+// Real skew-symmetric matrices instead stay real: they are reduced to the
+// skew-symmetric tridiagonal T = Q^T G Q, with Q = H_0 H_1 ... H_{n-2}, and,
+// if T has subdiagonal e, then, with D = diag(1,i,-1,-i,1,...),
+//
+//   -i T = D S D^H,
+//
+// where S is the real symmetric tridiagonal matrix with a zero diagonal and
+// subdiagonal -e. The eigenvectors of -i G are therefore Q D Z, where S Z =
+// Z diag(w), and, as each row of D Z is either purely real or purely
+// imaginary, Q D Z can be formed by applying the (real) reflectors to the
+// real and imaginary parts of D Z. This avoids the four-fold increase in
+// work and the doubling of memory of the complex reduction.
+
+// Form the full skew-symmetric matrix from the strictly-'uplo' triangle of G
+template<typename Real>
+void FillSkew( UpperOrLower uplo, const Matrix<Real>& G, Matrix<Real>& A )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> AT;
+    A = G;
+    MakeTrapezoidal( uplo, A, (uplo==LOWER ? -1 : 1) );
+    Transpose( A, AT );
+    Axpy( Real(-1), AT, A );
+}
+
+template<typename Real>
+void FillSkew
+( UpperOrLower uplo, const AbstractDistMatrix<Real>& G, DistMatrix<Real>& A )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Real> AT( A.Grid() );
+    Copy( G, A );
+    MakeTrapezoidal( uplo, A, (uplo==LOWER ? -1 : 1) );
+    Transpose( A, AT );
+    Axpy( Real(-1), AT, A );
+}
+
+// Reduce the full skew-symmetric matrix A to tridiagonal form, storing the
+// reflectors below the subdiagonal in the same manner as
+// HermitianTridiag( LOWER, ... ). Since u^T A u = 0 for skew-symmetric A,
+// each two-sided update, (I - tau u u^T) A (I - tau u u^T), simplifies to the
+// rank-two update A + u w^T - w u^T, where w = tau A u.
+template<typename Real>
+void Tridiag( Matrix<Real>& A, Matrix<Real>& householderScalars )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    Zeros( householderScalars, Max(n-1,Int(0)), 1 );
+
+    Matrix<Real> w21;
+    for( Int k=0; k<n-1; ++k )
+    {
+        const Range<Int> ind1( k, k+1 ),
+                         ind2( k+1, n ),
+                         ind2T( k+1, k+2 ),
+                         ind2B( k+2, n );
+
+        auto a21      = A( ind2,  ind1 );
+        auto alpha21T = A( ind2T, ind1 );
+        auto a21B     = A( ind2B, ind1 );
+        auto A22      = A( ind2,  ind2 );
+
+        const Real tau = LeftReflector( alpha21T, a21B );
+        householderScalars(k) = tau;
+        const Real epsilon1 = alpha21T(0);
+        alpha21T(0) = Real(1);
+
+        Gemv( NORMAL, tau, A22, a21, w21 );
+        Ger( Real(1), a21, w21, A22 );
+        Ger( Real(-1), w21, a21, A22 );
+
+        alpha21T(0) = epsilon1;
+    }
+}
+
+template<typename Real>
+void Tridiag
+( DistMatrix<Real>& A, DistMatrix<Real,VC,STAR>& householderScalars )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    Zeros( householderScalars, Max(n-1,Int(0)), 1 );
+
+    DistMatrix<Real> w21(g);
+    for( Int k=0; k<n-1; ++k )
+    {
+        const Range<Int> ind1( k, k+1 ),
+                         ind2( k+1, n ),
+                         ind2T( k+1, k+2 ),
+                         ind2B( k+2, n );
+
+        auto a21      = A( ind2,  ind1 );
+        auto alpha21T = A( ind2T, ind1 );
+        auto a21B     = A( ind2B, ind1 );
+        auto A22      = A( ind2,  ind2 );
+
+        const Real tau = LeftReflector( alpha21T, a21B );
+        householderScalars.Set( k, 0, tau );
+        const Real epsilon1 = alpha21T.Get(0,0);
+        alpha21T.Set( 0, 0, Real(1) );
+
+        Gemv( NORMAL, tau, A22, a21, w21 );
+        Ger( Real(1), a21, w21, A22 );
+        Ger( Real(-1), w21, a21, A22 );
+
+        alpha21T.Set( 0, 0, epsilon1 );
+    }
+}
+
+// Overwrite Y = [Z, Z] with [Re(D Z), Im(D Z)], where the k'th diagonal
+// entry of D is i^k
+template<typename Real>
+void ScaleByPhases( Matrix<Real>& Y )
+{
+    EL_DEBUG_CSE
+    const Int n = Y.Height();
+    const Int m = Y.Width()/2;
+    for( Int j=0; j<m; ++j )
+    {
+        for( Int i=0; i<n; ++i )
+        {
+            const Real sgn = ( i % 4 < 2 ? Real(1) : Real(-1) );
+            const bool isReal = ( i % 2 == 0 );
+            Y(i,j  ) = ( isReal ? sgn*Y(i,j  ) : Real(0) );
+            Y(i,j+m) = ( isReal ? Real(0) : sgn*Y(i,j+m) );
+        }
+    }
+}
+
+template<typename Real>
+void ScaleByPhases( DistMatrix<Real>& Y )
+{
+    EL_DEBUG_CSE
+    const Int m = Y.Width()/2;
+    auto& YLoc = Y.Matrix();
+    for( Int jLoc=0; jLoc<Y.LocalWidth(); ++jLoc )
+    {
+        const bool leftHalf = ( Y.GlobalCol(jLoc) < m );
+        for( Int iLoc=0; iLoc<Y.LocalHeight(); ++iLoc )
+        {
+            const Int i = Y.GlobalRow(iLoc);
+            const Real sgn = ( i % 4 < 2 ? Real(1) : Real(-1) );
+            const bool isReal = ( i % 2 == 0 );
+            YLoc(iLoc,jLoc) =
+              ( isReal == leftHalf ? sgn*YLoc(iLoc,jLoc) : Real(0) );
+        }
+    }
+}
+
+template<typename Real>
+HermitianEigInfo
+Helper
+( UpperOrLower uplo,
+  const Matrix<Real>& G,
+        Matrix<Real>& wImag,
+  const HermitianEigCtrl<Complex<Real>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> A, householderScalars;
+    FillSkew( uplo, G, A );
+    Tridiag( A, householderScalars );
+
+    const Int n = A.Height();
+    Matrix<Real> d, e;
+    Zeros( d, n, 1 );
+    e = GetDiagonal( A, -1 );
+    e *= -1;
+    HermitianEigInfo info;
+    info.tridiagEigInfo =
+      HermitianTridiagEig( d, e, wImag, ctrl.tridiagEigCtrl );
+    return info;
+}
+
+template<typename Real>
+HermitianEigInfo
+Helper
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Real>& G,
+        AbstractDistMatrix<Real>& wImag,
+  const HermitianEigCtrl<Complex<Real>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = G.Grid();
+    DistMatrix<Real> A(g);
+    DistMatrix<Real,VC,STAR> householderScalars(g);
+    FillSkew( uplo, G, A );
+    Tridiag( A, householderScalars );
+
+    const Int n = A.Height();
+    DistMatrix<Real,STAR,STAR> d(g);
+    Zeros( d, n, 1 );
+    auto e = GetDiagonal( A, -1 );
+    e *= -1;
+    HermitianEigInfo info;
+    info.tridiagEigInfo =
+      HermitianTridiagEig( d, e, wImag, ctrl.tridiagEigCtrl );
+    return info;
+}
+
+template<typename Real>
+HermitianEigInfo
+Helper
+( UpperOrLower uplo,
+  const Matrix<Complex<Real>>& G,
+        Matrix<Real>& wImag,
+  const HermitianEigCtrl<Complex<Real>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Complex<Real>> A( G );
+    ScaleTrapezoid( Complex<Real>(0,-1), uplo, A );
+    return HermitianEig( uplo, A, wImag, ctrl );
+}
+
+template<typename Real>
+HermitianEigInfo
+Helper
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Complex<Real>>& G,
+        AbstractDistMatrix<Real>& wImag,
+  const HermitianEigCtrl<Complex<Real>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Complex<Real>> A(G.Grid());
+    Copy( G, A );
+    ScaleTrapezoid( Complex<Real>(0,-1), uplo, A );
+    return HermitianEig( uplo, A, wImag, ctrl );
+}
+
+template<typename Real>
+HermitianEigInfo
+Helper
+( UpperOrLower uplo,
+  const Matrix<Real>& G,
+        Matrix<Real>& wImag,
+        Matrix<Complex<Real>>& Q,
+  const HermitianEigCtrl<Complex<Real>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> A, householderScalars;
+    FillSkew( uplo, G, A );
+    Tridiag( A, householderScalars );
+
+    const Int n = A.Height();
+    Matrix<Real> d, e, Z;
+    Zeros( d, n, 1 );
+    e = GetDiagonal( A, -1 );
+    e *= -1;
+    auto tridiagEigCtrl = ctrl.tridiagEigCtrl;
+    tridiagEigCtrl.accumulateEigVecs = false;
+    HermitianEigInfo info;
+    info.tridiagEigInfo =
+      HermitianTridiagEig( d, e, wImag, Z, tridiagEigCtrl );
+
+    // Apply Q to the real and imaginary parts of D Z at once
+    const Int m = Z.Width();
+    Matrix<Real> Y;
+    Y.Resize( n, 2*m );
+    auto YL = Y( ALL, IR(0,m) );
+    auto YR = Y( ALL, IR(m,2*m) );
+    YL = Z;
+    YR = Z;
+    ScaleByPhases( Y );
+    herm_tridiag::ApplyQ( LEFT, LOWER, NORMAL, A, householderScalars, Y );
+
+    Q.Resize( n, m );
+    for( Int j=0; j<m; ++j )
+        for( Int i=0; i<n; ++i )
+            Q(i,j) = Complex<Real>( Y(i,j), Y(i,j+m) );
+    return info;
+}
+
+template<typename Real>
+HermitianEigInfo
+Helper
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Real>& G,
+        AbstractDistMatrix<Real>& wImag,
+        AbstractDistMatrix<Complex<Real>>& QPre,
+  const HermitianEigCtrl<Complex<Real>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = G.Grid();
+    DistMatrix<Real> A(g);
+    DistMatrix<Real,VC,STAR> householderScalars(g);
+    FillSkew( uplo, G, A );
+    Tridiag( A, householderScalars );
+
+    const Int n = A.Height();
+    DistMatrix<Real,STAR,STAR> d(g);
+    DistMatrix<Real> Z(g);
+    Zeros( d, n, 1 );
+    auto e = GetDiagonal( A, -1 );
+    e *= -1;
+    auto tridiagEigCtrl = ctrl.tridiagEigCtrl;
+    tridiagEigCtrl.accumulateEigVecs = false;
+    HermitianEigInfo info;
+    info.tridiagEigInfo =
+      HermitianTridiagEig( d, e, wImag, Z, tridiagEigCtrl );
+
+    // Apply Q to the real and imaginary parts of D Z at once
+    const Int m = Z.Width();
+    DistMatrix<Real> Y(g);
+    Y.Resize( n, 2*m );
+    auto YL = Y( ALL, IR(0,m) );
+    auto YR = Y( ALL, IR(m,2*m) );
+    YL = Z;
+    YR = Z;
+    ScaleByPhases( Y );
+    herm_tridiag::ApplyQ( LEFT, LOWER, NORMAL, A, householderScalars, Y );
+
+    DistMatrixWriteProxy<Complex<Real>,Complex<Real>,MC,MR> QProx( QPre );
+    auto& Q = QProx.Get();
+    Q.Resize( n, m );
+    DistMatrix<Real> YRe(g), YIm(g);
+    YRe.AlignWith( Q );
+    YIm.AlignWith( Q );
+    YRe = Y( ALL, IR(0,m) );
+    YIm = Y( ALL, IR(m,2*m) );
+    auto& QLoc = Q.Matrix();
+    const auto& YReLoc = YRe.LockedMatrix();
+    const auto& YImLoc = YIm.LockedMatrix();
+    for( Int jLoc=0; jLoc<Q.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<Q.LocalHeight(); ++iLoc )
+            QLoc(iLoc,jLoc) =
+              Complex<Real>( YReLoc(iLoc,jLoc), YImLoc(iLoc,jLoc) );
+    return info;
+}
+
+template<typename Real>
+HermitianEigInfo
+Helper
+( UpperOrLower uplo,
+  const Matrix<Complex<Real>>& G,
+        Matrix<Real>& wImag,
+        Matrix<Complex<Real>>& Q,
+  const HermitianEigCtrl<Complex<Real>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Complex<Real>> A( G );
+    ScaleTrapezoid( Complex<Real>(0,-1), uplo, A );
+    return HermitianEig( uplo, A, wImag, Q, ctrl );
+}
+
+template<typename Real>
+HermitianEigInfo
+Helper
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Complex<Real>>& G,
+        AbstractDistMatrix<Real>& wImag,
+        AbstractDistMatrix<Complex<Real>>& Q,
+  const HermitianEigCtrl<Complex<Real>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Complex<Real>> A(G.Grid());
+    Copy( G, A );
+    ScaleTrapezoid( Complex<Real>(0,-1), uplo, A );
+    return HermitianEig( uplo, A, wImag, Q, ctrl );
+}
+
+} // namespace skew_herm_eig
+
 // Compute eigenvalues
 // ===================
 
@@ -22,10 +389,9 @@ SkewHermitianEig
   const HermitianEigCtrl<Complex<Base<Field>>>& ctrl )
 {
     EL_DEBUG_CSE
-    Matrix<Complex<Base<Field>>> A;
-    Copy( G, A );
-    ScaleTrapezoid( Complex<Base<Field>>(0,-1), uplo, A );
-    return HermitianEig( uplo, A, wImag, ctrl );
+    if( G.Height() != G.Width() )
+        LogicError("Skew-Hermitian matrices must be square");
+    return skew_herm_eig::Helper( uplo, G, wImag, ctrl );
 }
 
 template<typename Field>
@@ -37,10 +403,9 @@ SkewHermitianEig
   const HermitianEigCtrl<Complex<Base<Field>>>& ctrl )
 {
     EL_DEBUG_CSE
-    DistMatrix<Complex<Base<Field>>> A(G.Grid());
-    Copy( G, A );
-    ScaleTrapezoid( Complex<Base<Field>>(0,-1), uplo, A );
-    return HermitianEig( uplo, A, wImag, ctrl );
+    if( G.Height() != G.Width() )
+        LogicError("Skew-Hermitian matrices must be square");
+    return skew_herm_eig::Helper( uplo, G, wImag, ctrl );
 }
 
 // Compute eigenpairs
@@ -55,10 +420,9 @@ SkewHermitianEig
   const HermitianEigCtrl<Complex<Base<Field>>>& ctrl )
 {
     EL_DEBUG_CSE
-    Matrix<Complex<Base<Field>>> A;
-    Copy( G, A );
-    ScaleTrapezoid( Complex<Base<Field>>(0,-1), uplo, A );
-    return HermitianEig( uplo, A, wImag, Q, ctrl );
+    if( G.Height() != G.Width() )
+        LogicError("Skew-Hermitian matrices must be square");
+    return skew_herm_eig::Helper( uplo, G, wImag, Q, ctrl );
 }
 
 template<typename Field>
@@ -71,10 +435,9 @@ SkewHermitianEig
   const HermitianEigCtrl<Complex<Base<Field>>>& ctrl )
 {
     EL_DEBUG_CSE
-    DistMatrix<Complex<Base<Field>>> A(G.Grid());
-    Copy( G, A );
-    ScaleTrapezoid( Complex<Base<Field>>(0,-1), uplo, A );
-    return HermitianEig( uplo, A, wImag, Q, ctrl );
+    if( G.Height() != G.Width() )
+        LogicError("Skew-Hermitian matrices must be square");
+    return skew_herm_eig::Helper( uplo, G, wImag, Q, ctrl );
 }
 
 #define PROTO(Field) \
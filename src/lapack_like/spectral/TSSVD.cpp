@@ -0,0 +1,286 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace svd {
+
+namespace {
+
+// Overwrite T with the upper-trapezoidal factor of its QR decomposition
+template<typename Field>
+void Triangularize( Matrix<Field>& T )
+{
+    EL_DEBUG_CSE
+    const Int k = Min(T.Height(),T.Width());
+    Matrix<Field> householderScalars;
+    Matrix<Base<Field>> signature;
+    QR( T, householderScalars, signature );
+    Matrix<Field> R;
+    Copy( T( IR(0,k), ALL ), R );
+    MakeTrapezoidal( UPPER, R );
+    T = std::move(R);
+}
+
+// Overwrite T with the triangular factor of [S; T]
+template<typename Field>
+void Merge( const Matrix<Field>& S, Matrix<Field>& T )
+{
+    EL_DEBUG_CSE
+    const Int n = T.Width();
+    const Int mS = S.Height();
+    const Int mT = T.Height();
+    Matrix<Field> Z;
+    Z.Resize( mS+mT, n );
+    auto ZTop = Z( IR(0,mS), ALL );
+    auto ZBot = Z( IR(mS,mS+mT), ALL );
+    ZTop = S;
+    ZBot = T;
+    Triangularize( Z );
+    T = std::move(Z);
+}
+
+} // anonymous namespace
+
+template<typename Field>
+StreamingTSQR<Field>::StreamingTSQR( Int width, const Grid& grid )
+: width_(width), R_(grid), V_(grid), s_(grid), sInv_(grid)
+{
+    EL_DEBUG_CSE
+    if( width < 0 )
+        LogicError("Width must be non-negative");
+}
+
+template<typename Field>
+void StreamingTSQR<Field>::Push( Matrix<Field>& T )
+{
+    EL_DEBUG_CSE
+    for( auto& level : levels_ )
+    {
+        if( level.Height() == 0 )
+        {
+            level = std::move(T);
+            return;
+        }
+        Merge( level, T );
+        level.Empty();
+    }
+    levels_.emplace_back( std::move(T) );
+}
+
+template<typename Field>
+void StreamingTSQR<Field>::AddLocalRows( const Matrix<Field>& WLoc )
+{
+    EL_DEBUG_CSE
+    if( finalized_ )
+        LogicError("Cannot add rows after finalizing");
+    if( WLoc.Width() != width_ )
+        LogicError("W must have the same width as A");
+    if( WLoc.Height() == 0 )
+        return;
+    Matrix<Field> T( WLoc );
+    Triangularize( T );
+    Push( T );
+    localHeight_ += WLoc.Height();
+}
+
+template<typename Field>
+void StreamingTSQR<Field>::AddRows( const AbstractDistMatrix<Field>& WPre )
+{
+    EL_DEBUG_CSE
+    if( WPre.Width() != width_ )
+        LogicError("W must have the same width as A");
+    DistMatrixReadProxy<Field,Field,VC,STAR> WProx( WPre );
+    AddLocalRows( WProx.GetLocked().LockedMatrix() );
+}
+
+template<typename Field>
+SVDInfo StreamingTSQR<Field>::Finalize()
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( finalized_ )
+        LogicError("Already finalized");
+    const Grid& g = R_.Grid();
+    const Int n = width_;
+
+    // Collapse the local tree into a single n x n triangle (padded with zeros
+    // if fewer than n rows were received)
+    Matrix<Field> T;
+    for( auto& level : levels_ )
+    {
+        if( level.Height() == 0 )
+            continue;
+        if( T.Height() == 0 )
+            T = std::move(level);
+        else
+            Merge( level, T );
+    }
+    levels_.clear();
+
+    // Every process owns exactly n rows of the stacked triangles, which is
+    // the minimum local height supported by TSQR
+    DistMatrix<Field,VC,STAR> Z(g);
+    const Int p = mpi::Size( Z.ColComm() );
+    Zeros( Z, p*n, n );
+    if( T.Height() != 0 )
+    {
+        auto ZTop = Z.Matrix()( IR(0,T.Height()), ALL );
+        ZTop = T;
+    }
+    height_ = mpi::AllReduce( localHeight_, Z.ColComm() );
+    if( height_ < n )
+        LogicError("StreamingTSQR assumes m >= n");
+
+    SVDInfo info;
+    Zeros( R_, n, n );
+    Zeros( s_, n, 1 );
+    Zeros( V_, n, n );
+    auto treeData = qr::TS( Z );
+    if( Z.ColRank() == 0 )
+    {
+        R_.Matrix() = qr::ts::RootQR( Z, treeData )( IR(0,n), ALL );
+        MakeTrapezoidal( UPPER, R_.Matrix() );
+
+        Matrix<Field> RCopy( R_.Matrix() ), U;
+        info = SVD( RCopy, U, s_.Matrix(), V_.Matrix() );
+    }
+    Broadcast( R_.Matrix(), Z.ColComm(), 0 );
+    Broadcast( s_.Matrix(), Z.ColComm(), 0 );
+    Broadcast( V_.Matrix(), Z.ColComm(), 0 );
+
+    // Use the same cutoff as the pseudoinverse
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( n == 0 ? Real(0) : height_*eps*s_.GetLocal(0,0) );
+    Zeros( sInv_, n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        const Real sigma = s_.GetLocal(j,0);
+        if( sigma > tol )
+            sInv_.SetLocal( j, 0, Real(1)/sigma );
+    }
+
+    finalized_ = true;
+    return info;
+}
+
+template<typename Field>
+void StreamingTSQR<Field>::LeftSingularVectors
+( const Matrix<Field>& WLoc, Matrix<Field>& UWLoc ) const
+{
+    EL_DEBUG_CSE
+    if( !finalized_ )
+        LogicError("Must finalize before forming U");
+    if( WLoc.Width() != width_ )
+        LogicError("W must have the same width as A");
+    Zeros( UWLoc, WLoc.Height(), width_ );
+    Gemm
+    ( NORMAL, NORMAL,
+      Field(1), WLoc, V_.LockedMatrix(), Field(0), UWLoc );
+    DiagonalScale( RIGHT, NORMAL, sInv_.LockedMatrix(), UWLoc );
+}
+
+template<typename Field>
+void StreamingTSQR<Field>::LeftSingularVectors
+( const AbstractDistMatrix<Field>& WPre,
+        AbstractDistMatrix<Field>& UWPre ) const
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Field,Field,VC,STAR> WProx( WPre );
+    DistMatrixWriteProxy<Field,Field,VC,STAR> UWProx( UWPre );
+    auto& W = WProx.GetLocked();
+    auto& UW = UWProx.Get();
+    UW.AlignColsAndResize
+    ( W.ColAlign(), W.Height(), width_, false, false );
+    if( UW.ColAlign() == W.ColAlign() )
+    {
+        LeftSingularVectors( W.LockedMatrix(), UW.Matrix() );
+    }
+    else
+    {
+        // UW is a view (or constrained) with a different alignment
+        DistMatrix<Field,VC,STAR> UWAlign(W.Grid());
+        UWAlign.AlignWith( W );
+        UWAlign.Resize( W.Height(), width_ );
+        LeftSingularVectors( W.LockedMatrix(), UWAlign.Matrix() );
+        UW = UWAlign;
+    }
+}
+
+template<typename Field>
+Int StreamingTSQR<Field>::Height() const
+{
+    if( !finalized_ )
+        LogicError("The height is only known after finalizing");
+    return height_;
+}
+
+template<typename Field>
+Int StreamingTSQR<Field>::Width() const { return width_; }
+
+template<typename Field>
+bool StreamingTSQR<Field>::Finalized() const { return finalized_; }
+
+template<typename Field>
+const DistMatrix<Field,STAR,STAR>& StreamingTSQR<Field>::R() const
+{
+    if( !finalized_ )
+        LogicError("R is only formed after finalizing");
+    return R_;
+}
+
+template<typename Field>
+const DistMatrix<Base<Field>,STAR,STAR>&
+StreamingTSQR<Field>::SingularValues() const
+{
+    if( !finalized_ )
+        LogicError("The singular values are only formed after finalizing");
+    return s_;
+}
+
+template<typename Field>
+const DistMatrix<Field,STAR,STAR>&
+StreamingTSQR<Field>::RightSingularVectors() const
+{
+    if( !finalized_ )
+        LogicError("V is only formed after finalizing");
+    return V_;
+}
+
+template<typename Field>
+SVDInfo TSQR
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V )
+{
+    EL_DEBUG_CSE
+    StreamingTSQR<Field> tsqr( A.Width(), A.Grid() );
+    tsqr.AddRows( A );
+    const SVDInfo info = tsqr.Finalize();
+    Copy( tsqr.SingularValues(), s );
+    Copy( tsqr.RightSingularVectors(), V );
+    return info;
+}
+
+#define PROTO(Field) \
+  template class StreamingTSQR<Field>; \
+  template SVDInfo TSQR \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Base<Field>>& s, \
+          AbstractDistMatrix<Field>& V );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace svd
+} // namespace El
@@ -20,29 +20,40 @@ namespace triang_eig {
 // TODO(poulson): "Naive" versions for academic accuracy and performance
 // experiments
 
+// The number of right-hand sides transposed at once by ShiftMajorSolve
+inline Int ShiftTileSize() { return 128; }
+
+// Returns U(i,i) - shift, perturbed away from zero if necessary
+template<typename Field>
+Field ShiftedPivot
+( const Field& diagVal, const Field& shift, const Base<Field>& smallDiag )
+{
+    Field pivot = diagVal - shift;
+    // TODO(poulson): Perhaps preserve phase in complex plane
+    if( OneAbs(pivot) < smallDiag )
+        pivot = smallDiag;
+    return pivot;
+}
+
 // See "Robust Triangular Solves for Use in Condition
 // Estimation" by Edward Anderson for notation and bounds.
 // Entries in U are assumed to be less (in magnitude) than bigNum.
+//
+// Either robustly solve (U - shift I) x = scale x, where x is the leading
+// portion of an eigenvector, or return false after (possibly) rescaling x if
+// the estimated growth is modest enough for an unscaled solve.
 template<typename Field>
-void MultiShiftDiagonalBlockSolve
+bool SafeShiftedSolve
 (       Matrix<Field>& U,
-  const Matrix<Field>& shifts,
-        Matrix<Field>& X,
-        Matrix<Field>& scales )
+  const Matrix<Field>& diag,
+  const Matrix<Base<Field>>& cNorm,
+  const Field& shift,
+        Matrix<Field>& x,
+        Base<Field>& scale )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
-    EL_DEBUG_ONLY(
-      if( U.Height() != U.Width() )
-          LogicError("Triangular matrix must be square");
-      if( U.Width() != X.Height() )
-          LogicError("Matrix dimensions do not match");
-      if( shifts.Height() != X.Width() )
-          LogicError("Incompatible number of shifts");
-    )
-    auto diag = GetDiagonal(U);
-    const Int n = U.Height();
-    const Int numShifts = shifts.Height();
+    const Int xHeight = x.Height();
 
     const Real underflow = limits::SafeMin<Real>();
     const Real overflow = limits::Max<Real>();
@@ -53,169 +64,266 @@ void MultiShiftDiagonalBlockSolve
     const Real oneHalf = Real(1)/Real(2);
     const Real oneQuarter = Real(1)/Real(4);
 
-    // Default scale is 1
-    Ones( scales, numShifts, 1 );
+    const Real smallDiag = Max( ulp*OneAbs(shift), smallNum );
 
-    // Compute infinity norms of columns of U (excluding diagonal)
-    Matrix<Real> cNorm( n, 1 );
-    cNorm(0) = 0;
-    for( Int j=1; j<n; ++j )
+    // Determine largest entry of RHS
+    Real xMax = MaxNorm( x );
+    if( xMax >= bigNum )
     {
-        //cNormBuf[j] = MaxNorm( U(IR(0,j),IR(j)) );
-        cNorm(j) = 0;
-        for( Int i=0; i<j; ++i )
-            cNorm(j) = Max( cNorm(j), Abs(U(i,j)) );
+        const Real s = oneHalf*bigNum/xMax;
+        x *= s;
+        xMax *= s;
+        scale *= s;
     }
-
-    // Iterate through RHS's
-    for( Int j=1; j<numShifts; ++j )
+    if( xMax <= smallNum )
     {
-        const Int xHeight = Min(n,j);
+        return true;
+    }
 
-        // Initialize triangular system
-        // TODO(poulson): Only modify the first xHeight entries of the diagonal
-        SetDiagonal( U, diag );
-        const Field shift = shifts(j);
-        const Real smallDiag = Max( ulp*OneAbs(shift), smallNum );
-        for( Int k=0; k<xHeight; ++k )
+    // Estimate growth of entries in triangular solve
+    //   Note: See "Robust Triangular Solves for Use in Condition
+    //   Estimation" by Edward Anderson for explanation of bounds.
+    Real invGi = 1/xMax;
+    Real invMi = invGi;
+    for( Int i=xHeight-1; i>=0; --i )
+    {
+        const Real absUii = SafeAbs( ShiftedPivot(diag(i),shift,smallDiag) );
+        if( invGi<=smallNum || invMi<=smallNum || absUii<=smallNum )
         {
-            U(k,k) -= shift;
-            // TODO(poulson): Perhaps preserve phase in complex plane
-            if( OneAbs(U(k,k)) < smallDiag )
-                U(k,k) = smallDiag;
+            invGi = 0;
+            break;
         }
-        auto xj = X( IR(0,xHeight), IR(j) );
-        Real scales_j = Real(1);
-
-        // Determine largest entry of RHS
-        Real xjMax = MaxNorm( xj );
-        if( xjMax >= bigNum )
+        invMi = Min( invMi, absUii*invGi );
+        if( i > 0 )
         {
-            const Real s = oneHalf*bigNum/xjMax;
-            xj *= s;
-            xjMax *= s;
-            scales_j *= s;
+            invGi *= absUii/(absUii+cNorm(i));
         }
-        if( xjMax <= smallNum )
+    }
+    invGi = Min( invGi, invMi );
+    if( invGi > smallNum )
+    {
+        return false;
+    }
+
+    // Perform backward substitution since estimated growth is large
+    for( Int i=0; i<xHeight; ++i )
+        U(i,i) = ShiftedPivot( diag(i), shift, smallDiag );
+    for( Int i=xHeight-1; i>=0; --i )
+    {
+        // Perform division and check for overflow
+        const Field Uii = U(i,i);
+        const Real absUii = SafeAbs( Uii );
+        Field Xi = x(i);
+        Real absXi = SafeAbs( Xi );
+        if( absUii > smallNum )
         {
-            continue;
+            if( absUii<=1 && absXi>=absUii*bigNum )
+            {
+                // Set overflowing entry to 0.5/U[i,i]
+                const Real s = oneHalf/absXi;
+                Xi *= s;
+                x *= s;
+                xMax *= s;
+                scale *= s;
+            }
+            Xi /= Uii;
         }
-
-        // Estimate growth of entries in triangular solve
-        //   Note: See "Robust Triangular Solves for Use in Condition
-        //   Estimation" by Edward Anderson for explanation of bounds.
-        Real invGi = 1/xjMax;
-        Real invMi = invGi;
-        for( Int i=xHeight-1; i>=0; --i )
+        else if( absUii > 0 )
         {
-            const Real absUii = SafeAbs( U(i,i) );
-            if( invGi<=smallNum || invMi<=smallNum || absUii<=smallNum )
+            if( absXi >= absUii*bigNum )
             {
-                invGi = 0;
-                break;
+                // Set overflowing entry to bigNum/2
+                const Real s = oneHalf*absUii*bigNum/absXi;
+                Xi *= s;
+                x *= s;
+                xMax *= s;
+                scale *= s;
             }
-            invMi = Min( invMi, absUii*invGi );
-            if( i > 0 )
+            Xi /= Uii;
+        }
+        else
+        {
+            // TODO(poulson): maybe this tolerance should be loosened to
+            //   | Xi | >= || A || * eps
+            if( absXi >= smallNum )
             {
-                invGi *= absUii/(absUii+cNorm(i));
+                Xi = Field(1);
+                Zero( x );
+                xMax = Real(0);
+                scale = Real(0);
             }
         }
-        invGi = Min( invGi, invMi );
+        x(i) = Xi;
 
-        if( invGi > smallNum )
+        if( i > 0 )
         {
-            // Call TRSV since estimated growth is not too large
-            blas::Trsv( 'U', 'N', 'N', xHeight, &U(0,0), U.LDim(), &xj(0), 1 );
+            // Check for possible overflows in AXPY
+            // Note: G(i+1) <= G(i) + | Xi | * cNorm(i)
+            absXi = SafeAbs( Xi );
+            const Real cNorm_i = cNorm(i);
+            if( absXi >= Real(1) &&
+                cNorm_i >= (bigNum-xMax)/absXi )
+            {
+                const Real s = oneQuarter/absXi;
+                Xi *= s;
+                x *= s;
+                xMax *= s;
+                absXi *= s;
+                scale *= s;
+            }
+            else if( absXi < Real(1) &&
+                     absXi*cNorm_i >= bigNum-xMax )
+            {
+                const Real s = oneQuarter;
+                Xi *= s;
+                x *= s;
+                xMax *= s;
+                absXi *= s;
+                scale *= s;
+            }
+            xMax += absXi*cNorm_i;
+
+            // AXPY x(0:i) -= Xi*U(0:i,i)
+            blas::Axpy( i, -Xi, &U(0,i), 1, &x(0), 1 );
         }
-        else
+    }
+    for( Int i=0; i<xHeight; ++i )
+        U(i,i) = diag(i);
+    return true;
+}
+
+// Solve (U(0:h,0:h) - shift_j I) x = x, where x = X(0:h,j) and h=heights[t],
+// for each column j=cols[t]. The heights must be nondecreasing.
+//
+// Each tile of right-hand sides is transposed so that the entries of a given
+// row for all of the shifts in the tile are contiguous. Every step of the
+// substitution is then a unit-stride Hadamard product or Axpy over the shifts
+// whose systems contain said row, and U is only traversed once per tile.
+template<typename Field>
+void ShiftMajorSolve
+( const Matrix<Field>& U,
+  const Matrix<Field>& shifts,
+  const vector<Int>& cols,
+  const vector<Int>& heights,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = U.Height();
+    const Int numCols = cols.size();
+    const Int tileSize = ShiftTileSize();
+
+    const Real underflow = limits::SafeMin<Real>();
+    const Real overflow = limits::Max<Real>();
+    const Real ulp = limits::Precision<Real>();
+    const Real smallNum = Max( underflow/ulp, Real(1)/(overflow*ulp) );
+
+    Matrix<Field> XTile, recips;
+    for( Int tBeg=0; tBeg<numCols; tBeg+=tileSize )
+    {
+        const Int nt = Min( tileSize, numCols-tBeg );
+        Zeros( XTile, nt, n );
+        for( Int t=0; t<nt; ++t )
+            for( Int i=0; i<heights[tBeg+t]; ++i )
+                XTile(t,i) = X(i,cols[tBeg+t]);
+        Field* XTileBuf = XTile.Buffer();
+        const Int ldTile = XTile.LDim();
+
+        recips.Resize( nt, 1 );
+        Field* recipBuf = recips.Buffer();
+        Int tFirst = nt;
+        for( Int i=n-1; i>=0; --i )
         {
-            // Perform backward substitution since estimated growth is large
-            for( Int i=xHeight-1; i>=0; --i )
+            // Activate the systems which contain row i
+            while( tFirst > 0 && heights[tBeg+tFirst-1] > i )
+                --tFirst;
+            const Int numActive = nt - tFirst;
+            if( numActive == 0 )
+                continue;
+
+            for( Int t=tFirst; t<nt; ++t )
             {
-                // Perform division and check for overflow
-                const Field Uii = U(i,i);
-                const Real absUii = SafeAbs( Uii );
-                Field Xij = xj(i);
-                Real absXij = SafeAbs( Xij );
-                if( absUii > smallNum )
-                {
-                    if( absUii<=1 && absXij>=absUii*bigNum )
-                    {
-                        // Set overflowing entry to 0.5/U[i,i]
-                        const Real s = oneHalf/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        scales_j *= s;
-                    }
-                    Xij /= Uii;
-                }
-                else if( absUii > 0 )
-                {
-                    if( absXij >= absUii*bigNum )
-                    {
-                        // Set overflowing entry to bigNum/2
-                        const Real s = oneHalf*absUii*bigNum/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        scales_j *= s;
-                    }
-                    Xij /= Uii;
-                }
-                else
-                {
-                    // TODO(poulson): maybe this tolerance should be loosened to
-                    //   | Xij | >= || A || * eps
-                    if( absXij >= smallNum )
-                    {
-                        Xij = Field(1);
-                        Zero( xj );
-                        xjMax = Real(0);
-                        scales_j = Real(0);
-                    }
-                }
-                xj(i) = Xij;
+                const Field shift = shifts(cols[tBeg+t]);
+                const Real smallDiag = Max( ulp*OneAbs(shift), smallNum );
+                recipBuf[t] =
+                  Field(1) / ShiftedPivot( U(i,i), shift, smallDiag );
+            }
+            Field* xi = &XTileBuf[tFirst+i*ldTile];
+            simd::Hadamard( numActive, xi, &recipBuf[tFirst], xi );
+            for( Int k=0; k<i; ++k )
+            {
+                const Field gamma = U(k,i);
+                if( gamma != Field(0) )
+                    simd::Axpy
+                    ( numActive, -gamma, xi, &XTileBuf[tFirst+k*ldTile] );
+            }
+        }
 
-                if( i > 0 )
-                {
+        for( Int t=0; t<nt; ++t )
+            for( Int i=0; i<heights[tBeg+t]; ++i )
+                X(i,cols[tBeg+t]) = XTile(t,i);
+    }
+}
 
-                    // Check for possible overflows in AXPY
-                    // Note: G(i+1) <= G(i) + | Xij | * cNorm(i)
-                    absXij = SafeAbs( Xij );
-                    const Real cNorm_i = cNorm(i);
-                    if( absXij >= Real(1) &&
-                        cNorm_i >= (bigNum-xjMax)/absXij )
-                    {
-                        const Real s = oneQuarter/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        absXij *= s;
-                        scales_j *= s;
-                    }
-                    else if( absXij < Real(1) &&
-                             absXij*cNorm_i >= bigNum-xjMax )
-                    {
-                        const Real s = oneQuarter;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        absXij *= s;
-                        scales_j *= s;
-                    }
-                    xjMax += absXij*cNorm_i;
-
-                    // AXPY X(0:i,j) -= Xij*U(0:i,i)
-                    blas::Axpy( i, -Xij, &U(0,i), 1, &xj(0), 1 );
-                }
-            }
+// Compute the maximum absolute value of the strictly upper portion of each
+// column of U
+template<typename Field>
+void StrictlyUpperColumnMaxNorms
+( const Matrix<Field>& U, Matrix<Base<Field>>& cNorm )
+{
+    EL_DEBUG_CSE
+    const Int n = U.Height();
+    Zeros( cNorm, n, 1 );
+    for( Int j=1; j<n; ++j )
+        for( Int i=0; i<j; ++i )
+            cNorm(j) = Max( cNorm(j), Abs(U(i,j)) );
+}
+
+// The systems whose estimated growth is modest are deferred to a single
+// shift-major solve rather than one Trsv per shift
+template<typename Field>
+void MultiShiftDiagonalBlockSolve
+(       Matrix<Field>& U,
+  const Matrix<Field>& shifts,
+        Matrix<Field>& X,
+        Matrix<Field>& scales )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    EL_DEBUG_ONLY(
+      if( U.Height() != U.Width() )
+          LogicError("Triangular matrix must be square");
+      if( U.Width() != X.Height() )
+          LogicError("Matrix dimensions do not match");
+      if( shifts.Height() != X.Width() )
+          LogicError("Incompatible number of shifts");
+    )
+    auto diag = GetDiagonal(U);
+    const Int n = U.Height();
+    const Int numShifts = shifts.Height();
+
+    // Default scale is 1
+    Ones( scales, numShifts, 1 );
+
+    // Compute infinity norms of columns of U (excluding diagonal)
+    Matrix<Real> cNorm;
+    StrictlyUpperColumnMaxNorms( U, cNorm );
+
+    // Iterate through RHS's (skipping the first shift)
+    vector<Int> deferredCols, deferredHeights;
+    for( Int j=1; j<numShifts; ++j )
+    {
+        const Int xHeight = Min(n,j);
+        auto xj = X( IR(0,xHeight), IR(j) );
+        Real scales_j = Real(1);
+        if( !SafeShiftedSolve( U, diag, cNorm, shifts(j), xj, scales_j ) )
+        {
+            deferredCols.push_back( j );
+            deferredHeights.push_back( xHeight );
         }
         scales(j) = scales_j;
     }
-
-    // Reset matrix diagonal
-    SetDiagonal( U, diag );
+    ShiftMajorSolve( U, shifts, deferredCols, deferredHeights, X );
 }
 
 template<typename Field>
@@ -245,31 +353,16 @@ void MultiShiftDiagonalBlockSolve
     auto diag = GetDiagonal(ULoc);
     const Int n = U.Height();
 
-    const Real underflow = limits::SafeMin<Real>();
-    const Real overflow = limits::Max<Real>();
-    const Real ulp = limits::Precision<Real>();
-    const Real smallNum = Max( underflow/ulp, Real(1)/(overflow*ulp) );
-    const Real bigNum = Real(1)/smallNum;
-
-    const Real oneHalf = Real(1)/Real(2);
-    const Real oneQuarter = Real(1)/Real(4);
-
     // Default scale is 1
     const Int numShifts = shifts.Height();
     Ones( scales, numShifts, 1 );
 
     // Compute infinity norms of columns of U (excluding diagonal)
-    Matrix<Real> cNorm( n, 1 );
-    cNorm(0) = 0;
-    for( Int j=1; j<n; ++j )
-    {
-        //cNormBuf[j] = MaxNorm( ULoc(IR(0,j),IR(j)) );
-        cNorm(j) = 0;
-        for( Int i=0; i<j; ++i )
-            cNorm(j) = Max( cNorm(j), Abs(ULoc(i,j)) );
-    }
+    Matrix<Real> cNorm;
+    StrictlyUpperColumnMaxNorms( ULoc, cNorm );
 
     // Iterate through RHS's (skipping the first shift)
+    vector<Int> deferredCols, deferredHeights;
     const Int numLocalShifts = shifts.LocalHeight();
     for( Int jLoc=0; jLoc<numLocalShifts; ++jLoc )
     {
@@ -277,152 +370,17 @@ void MultiShiftDiagonalBlockSolve
         if( j == 0 )
             continue;
         const Int xHeight = Min(n,j);
-
-        // Initialize triangular system
-        // TODO(poulson): Only modify the first xHeight entries of the diagonal
-        SetDiagonal( ULoc, diag );
-        const Field shift = shiftsLoc(jLoc);
-        const Real smallDiag = Max( ulp*OneAbs(shift), smallNum );
-        for( Int k=0; k<xHeight; ++k )
-        {
-            ULoc(k,k) -= shift;
-            // TODO(poulson): Perhaps preserve phase in complex plane
-            if( OneAbs(ULoc(k,k)) < smallDiag )
-                ULoc(k,k) = smallDiag;
-        }
         auto xj = XLoc( IR(0,xHeight), IR(jLoc) );
         Real scales_j = Real(1);
-
-        // Determine largest entry of RHS
-        Real xjMax = MaxNorm( xj );
-        if( xjMax >= bigNum )
+        if( !SafeShiftedSolve
+             ( ULoc, diag, cNorm, shiftsLoc(jLoc), xj, scales_j ) )
         {
-            const Real s = oneHalf*bigNum/xjMax;
-            xj *= s;
-            xjMax *= s;
-            scales_j *= s;
-        }
-        if( xjMax <= smallNum )
-        {
-            continue;
-        }
-
-        // Estimate growth of entries in triangular solve
-        //   Note: See "Robust Triangular Solves for Use in Condition
-        //   Estimation" by Edward Anderson for explanation of bounds.
-        Real invGi = 1/xjMax;
-        Real invMi = invGi;
-        for( Int i=xHeight-1; i>=0; --i )
-        {
-            const Real absUii = SafeAbs( ULoc(i,i) );
-            if( invGi<=smallNum || invMi<=smallNum || absUii<=smallNum )
-            {
-                invGi = 0;
-                break;
-            }
-            invMi = Min( invMi, absUii*invGi );
-            if( i > 0 )
-            {
-                invGi *= absUii/(absUii+cNorm(i));
-            }
-        }
-        invGi = Min( invGi, invMi );
-
-        if( invGi > smallNum )
-        {
-            // Call TRSV since estimated growth is not too large
-            blas::Trsv
-            ( 'U', 'N', 'N', xHeight, &ULoc(0,0), U.LDim(), &xj(0), 1 );
-        }
-        else
-        {
-            // Perform backward substitution since estimated growth is large
-            for( Int i=xHeight-1; i>=0; --i )
-            {
-                // Perform division and check for overflow
-                const Field Uii = ULoc(i,i);
-                const Real absUii = SafeAbs( Uii );
-                Field Xij = xj(i);
-                Real absXij = SafeAbs( Xij );
-                if( absUii > smallNum )
-                {
-                    if( absUii<=1 && absXij>=absUii*bigNum )
-                    {
-                        // Set overflowing entry to 0.5/U[i,i]
-                        const Real s = oneHalf/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        scales_j *= s;
-                    }
-                    Xij /= Uii;
-                }
-                else if( absUii > 0 )
-                {
-                    if( absXij >= absUii*bigNum )
-                    {
-                        // Set overflowing entry to bigNum/2
-                        const Real s = oneHalf*absUii*bigNum/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        scales_j *= s;
-                    }
-                    Xij /= Uii;
-                }
-                else
-                {
-                    // TODO(poulson): maybe this tolerance should be loosened to
-                    //   | Xij | >= || A || * eps
-                    if( absXij >= smallNum )
-                    {
-                        Xij = Field(1);
-                        Zero( xj );
-                        xjMax = Real(0);
-                        scales_j = Real(0);
-                    }
-                }
-                xj(i) = Xij;
-
-                if( i > 0 )
-                {
-
-                    // Check for possible overflows in AXPY
-                    // Note: G(i+1) <= G(i) + | Xij | * cNorm(i)
-                    absXij = SafeAbs( Xij );
-                    const Real cNorm_i = cNorm(i);
-                    if( absXij >= Real(1) &&
-                        cNorm_i >= (bigNum-xjMax)/absXij )
-                    {
-                        const Real s = oneQuarter/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        absXij *= s;
-                        scales_j *= s;
-                    }
-                    else if( absXij < Real(1) &&
-                             absXij*cNorm_i >= bigNum-xjMax )
-                    {
-                        const Real s = oneQuarter;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        absXij *= s;
-                        scales_j *= s;
-                    }
-                    xjMax += absXij*cNorm_i;
-
-                    // AXPY X(0:i,j) -= Xij*U(0:i,i)
-                    blas::Axpy( i, -Xij, &ULoc(0,i), 1, &xj(0), 1 );
-                }
-            }
+            deferredCols.push_back( jLoc );
+            deferredHeights.push_back( xHeight );
         }
         scalesLoc(jLoc) = scales_j;
     }
-
-    // Reset matrix diagonal
-    SetDiagonal( ULoc, diag );
+    ShiftMajorSolve( ULoc, shiftsLoc, deferredCols, deferredHeights, XLoc );
 }
 
 template<typename Field>
@@ -593,6 +551,14 @@ void MultiShiftSolve
     const Int bsize = Blocksize();
     const Int kLast = LastOffset( m, bsize );
 
+    const Real oneHalf = Real(1)/Real(2);
+
+    const Real underflow = limits::SafeMin<Real>();
+    const Real overflow = limits::Max<Real>();
+    const Real ulp = limits::Precision<Real>();
+    const Real smallNum = Max( underflow/ulp, Real(1)/(overflow*ulp) );
+    const Real bigNum = Real(1)/smallNum;
+
     DistMatrixReadProxy<Field,Field,MC,MR> UProx( UPre );
     DistMatrixReadProxy<Field,Field,VR,STAR> shiftsProx( shiftsPre );
     DistMatrixReadWriteProxy<Field,Field,MC,MR> XProx( XPre );
@@ -610,12 +576,43 @@ void MultiShiftSolve
     DistMatrix<Field,VR,  STAR> scalesUpdate_VR_STAR(g);
     DistMatrix<Field,MR,  STAR> scalesUpdate_MR_STAR(g);
 
-    Ones( scales, n, 1 );
+    // The scales and the running bounds on the largest entry of each RHS are
+    // kept redundantly within each process column
+    DistMatrix<Field,MR,STAR> scales_MR_STAR(g);
+    DistMatrix<Real,MR,STAR> XMax(g);
+    scales_MR_STAR.AlignWith( X );
+    XMax.AlignWith( X );
+    Ones( scales_MR_STAR, n, 1 );
+    Zeros( XMax, n, 1 );
     scalesUpdate_VR_STAR.Resize( n, 1 );
 
-    // TODO(poulson): Intitialize XMax with the largest entry of each RHS
-    // TODO(poulson): Rescale X if any of the columns are too large
+    // Determine largest entry of each RHS
+    auto& XLoc = X.Matrix();
+    auto& XMaxLoc = XMax.Matrix();
+    auto& scalesLoc = scales_MR_STAR.Matrix();
+    const Int XLocalWidth = X.LocalWidth();
+    for( Int jLoc=0; jLoc<XLocalWidth; ++jLoc )
+    {
+        const Int iLocEnd = X.LocalRowOffset( X.GlobalCol(jLoc) );
+        for( Int iLoc=0; iLoc<iLocEnd; ++iLoc )
+            XMaxLoc(jLoc) = Max( XMaxLoc(jLoc), Abs(XLoc(iLoc,jLoc)) );
+    }
+    mpi::AllReduce( XMaxLoc.Buffer(), XLocalWidth, mpi::MAX, X.ColComm() );
+    for( Int jLoc=0; jLoc<XLocalWidth; ++jLoc )
+    {
+        Real xjMax = XMaxLoc(jLoc);
+        if( xjMax >= bigNum )
+        {
+            const Real s = oneHalf*bigNum/xjMax;
+            const Int iLocEnd = X.LocalRowOffset( X.GlobalCol(jLoc) );
+            blas::Scal( iLocEnd, Field(s), XLoc.Buffer(0,jLoc), 1 );
+            xjMax *= s;
+            scalesLoc(jLoc) *= s;
+        }
+        XMaxLoc(jLoc) = Max( xjMax, 2*smallNum );
+    }
 
+    Matrix<Real> U01Max;
     for( Int k=kLast; k>=0; k-=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -632,6 +629,10 @@ void MultiShiftSolve
         auto X2 = X( ind2, IR(k,END) );
 
         auto shiftsActive = shifts( IR(k,END), ALL );
+        auto scalesActive = scales_MR_STAR( IR(k,END), ALL );
+        auto XMaxActive = XMax( IR(k,END), ALL );
+        auto& scalesActiveLoc = scalesActive.Matrix();
+        auto& XMaxActiveLoc = XMaxActive.Matrix();
 
         // Perform triangular solve on diagonal block
         // X1[* ,VR] := U11^-1[* ,* ] X1[* ,VR]
@@ -645,7 +646,20 @@ void MultiShiftSolve
 
         X1_STAR_MR.AlignWith( X0 );
         X1_STAR_MR = X1_STAR_VR; // X1[* ,MR]  <- X1[* ,VR]
-        X1 = X1_STAR_MR; // X1[MC,MR] <- X1[* ,MR]
+        auto& X1Loc = X1_STAR_MR.Matrix();
+
+        // Scale the local portions of column jActiveLoc of [X0; X1; X2]
+        auto scaleColumn =
+          [&]( Int jActiveLoc, Real s )
+          {
+              blas::Scal
+              ( X0.LocalHeight(), Field(s), X0.Buffer(0,jActiveLoc), 1 );
+              blas::Scal( nb, Field(s), X1Loc.Buffer(0,jActiveLoc), 1 );
+              blas::Scal
+              ( X2.LocalHeight(), Field(s), X2.Buffer(0,jActiveLoc), 1 );
+              scalesActiveLoc(jActiveLoc) *= s;
+              XMaxActiveLoc(jActiveLoc) *= s;
+          };
 
         // Apply scalings on RHS
         scalesUpdate_MR_STAR.AlignWith( X1 );
@@ -659,36 +673,69 @@ void MultiShiftSolve
             {
                 // X1 has already been rescaled, but X0 and X2 have not
                 blas::Scal
-                ( X0.LocalHeight(), sigma, X0.Buffer(0,jActiveLoc), 1 );
+                ( X0.LocalHeight(), Field(sigma),
+                  X0.Buffer(0,jActiveLoc), 1 );
                 blas::Scal
-                ( X2.LocalHeight(), sigma, X2.Buffer(0,jActiveLoc), 1 );
-
-                // TODO(poulson): Update XMax
+                ( X2.LocalHeight(), Field(sigma),
+                  X2.Buffer(0,jActiveLoc), 1 );
+                scalesActiveLoc(jActiveLoc) *= sigma;
+                XMaxActiveLoc(jActiveLoc) *= sigma;
             }
-            else
+        }
+
+        if( k > 0 )
+        {
+            U01_MC_STAR.AlignWith( X0 );
+            U01_MC_STAR = U01; // U01[MC,* ] <- U01[MC,MR]
+
+            // Compute infinity norms of columns in U01
+            // Note: nb*cNorm is the sum of infinity norms
+            const auto& U01Loc = U01_MC_STAR.LockedMatrix();
+            Zeros( U01Max, nb, 1 );
+            for( Int j=0; j<nb; ++j )
+                for( Int iLoc=0; iLoc<U01Loc.Height(); ++iLoc )
+                    U01Max(j) = Max( U01Max(j), Abs(U01Loc(iLoc,j)) );
+            mpi::AllReduce
+            ( U01Max.Buffer(), nb, mpi::MAX, U01_MC_STAR.ColComm() );
+            Real cNorm = 0;
+            for( Int j=0; j<nb; ++j )
+                cNorm += U01Max(j) / nb;
+
+            // Check for possible overflows in GEMM
+            // Note: G(i+1) <= G(i) + nb*cNorm*|| X1[:,j] ||_infty
+            for( Int jActiveLoc=0; jActiveLoc<X1LocalWidth; ++jActiveLoc )
             {
-                // Force the value to one so the diagonal scale does not
-                // have an effect. This is somewhat of a hack.
-                scalesUpdateLoc(jActiveLoc) = Field(1);
+                const Real xjMax = XMaxActiveLoc(jActiveLoc);
+                Real X1Max = MaxNorm( X1Loc(ALL,IR(jActiveLoc)) );
+                if( X1Max >= 1 &&
+                    cNorm >= (bigNum-xjMax)/X1Max/nb )
+                {
+                    const Real s = oneHalf/(X1Max*nb);
+                    scaleColumn( jActiveLoc, s );
+                    X1Max *= s;
+                }
+                else if( X1Max < 1 &&
+                         cNorm*X1Max >= (bigNum-xjMax)/nb )
+                {
+                    const Real s = oneHalf/nb;
+                    scaleColumn( jActiveLoc, s );
+                    X1Max *= s;
+                }
+                XMaxActiveLoc(jActiveLoc) += nb*cNorm*X1Max;
             }
         }
-        auto scalesActive = scales(IR(k,END),ALL);
-        DiagonalScale( LEFT,  NORMAL, scalesUpdate_MR_STAR, scalesActive );
+        X1 = X1_STAR_MR; // X1[MC,MR] <- X1[* ,MR]
 
         if( k > 0 )
         {
-            // TODO(poulson): Compute infinity norms of columns in U01
-            // TODO(poulson): Check for possible overflows in GEMM
-
             // Update RHS with GEMM
             // X0[MC,MR] -= U01[MC,* ] X1[* ,MR]
-            U01_MC_STAR.AlignWith( X0 );
-            U01_MC_STAR = U01; // U01[MC,* ] <- U01[MC,MR]
             LocalGemm
             ( NORMAL, NORMAL,
               Field(-1), U01_MC_STAR, X1_STAR_MR, Field(1), X0 );
         }
     }
+    scales = scales_MR_STAR;
 }
 
 } // namespace triang_eig
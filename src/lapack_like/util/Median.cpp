@@ -8,50 +8,185 @@
 */
 #include <El.hpp>
 
+#include <algorithm>
+
 namespace El {
 
+namespace median {
+
+// Break ties in value by index so that the order is total
+template<typename Real>
+bool Lesser( const ValueInt<Real>& a, const ValueInt<Real>& b )
+{ return a.value < b.value || (a.value == b.value && a.index < b.index); }
+
+} // namespace median
+
 template<typename Real,
          typename/*=DisableIf<IsComplex<Real>>*/>
-ValueInt<Real> Median( const Matrix<Real>& x )
+ValueInt<Real> OrderStatistic( const Matrix<Real>& x, Int k )
 {
     EL_DEBUG_CSE
     const Int m = x.Height();
     const Int n = x.Width();
     if( m != 1 && n != 1 )
-        LogicError("Median is meant for a single vector");
+        LogicError("OrderStatistic is meant for a single vector");
 
-    const Int k = ( n==1 ? m : n );
+    const Int length = ( n==1 ? m : n );
+    if( k < 0 || k >= length )
+        LogicError("Invalid rank ",k," for a vector of length ",length);
     const Int stride = ( n==1 ? 1 : x.LDim() );
     const Real* xBuffer = x.LockedBuffer();
 
-    vector<ValueInt<Real>> pairs( k );
-    for( Int i=0; i<k; ++i )
+    vector<ValueInt<Real>> pairs( length );
+    for( Int i=0; i<length; ++i )
     {
         pairs[i].value = xBuffer[i*stride];
         pairs[i].index = i;
     }
-    std::sort( pairs.begin(), pairs.end(), ValueInt<Real>::Lesser );
+    std::nth_element
+    ( pairs.begin(), pairs.begin()+k, pairs.end(), median::Lesser<Real> );
 
-    return pairs[k/2];
+    return pairs[k];
 }
 
+// A distributed quickselect over x[VC,* ] where each pivot is the weighted
+// median of the medians of the remaining local candidates, so that every
+// step discards at least a quarter of the candidates with a few collectives
+// of size O(p) rather than gathering the vector
 template<typename Real,
          typename/*=DisableIf<IsComplex<Real>>*/>
-ValueInt<Real> Median( const AbstractDistMatrix<Real>& x )
+ValueInt<Real> OrderStatistic( const AbstractDistMatrix<Real>& x, Int k )
 {
     EL_DEBUG_CSE
     if( x.ColDist() == STAR && x.RowDist() == STAR )
+        return OrderStatistic( x.LockedMatrix(), k );
+
+    const Int m = x.Height();
+    const Int n = x.Width();
+    if( m != 1 && n != 1 )
+        LogicError("OrderStatistic is meant for a single vector");
+    const Int length = ( n==1 ? m : n );
+    if( k < 0 || k >= length )
+        LogicError("Invalid rank ",k," for a vector of length ",length);
+
+    DistMatrix<Real,VC,STAR> x_VC_STAR(x.Grid());
+    if( n == 1 )
+        x_VC_STAR = x;
+    else
+        Transpose( x, x_VC_STAR );
+    const Int localHeight = x_VC_STAR.LocalHeight();
+    vector<ValueInt<Real>> candidates( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
     {
-        return Median( x.LockedMatrix() );
+        candidates[iLoc].value = x_VC_STAR.GetLocal(iLoc,0);
+        candidates[iLoc].index = x_VC_STAR.GlobalRow(iLoc);
     }
-    else
+
+    mpi::Comm comm = x_VC_STAR.DistComm();
+    const int commSize = mpi::Size( comm );
+    vector<Real> proposalValues( commSize );
+    vector<Int> proposalIndices( commSize ), proposalWeights( commSize );
+    while( true )
     {
-        DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
-        return Median( x_STAR_STAR.LockedMatrix() );
+        const Int numLocal = candidates.size();
+        ValueInt<Real> proposal{ Real(0), Int(-1) };
+        if( numLocal > 0 )
+        {
+            auto mid = candidates.begin() + numLocal/2;
+            std::nth_element
+            ( candidates.begin(), mid, candidates.end(),
+              median::Lesser<Real> );
+            proposal = *mid;
+        }
+        mpi::AllGather( &proposal.value, 1, proposalValues.data(), 1, comm );
+        mpi::AllGather( &proposal.index, 1, proposalIndices.data(), 1, comm );
+        mpi::AllGather( &numLocal, 1, proposalWeights.data(), 1, comm );
+
+        vector<pair<ValueInt<Real>,Int>> proposals;
+        Int totalWeight = 0;
+        for( int q=0; q<commSize; ++q )
+        {
+            if( proposalWeights[q] == 0 )
+                continue;
+            proposals.emplace_back
+            ( ValueInt<Real>{proposalValues[q],proposalIndices[q]},
+              proposalWeights[q] );
+            totalWeight += proposalWeights[q];
+        }
+        std::sort
+        ( proposals.begin(), proposals.end(),
+          []( const pair<ValueInt<Real>,Int>& a,
+              const pair<ValueInt<Real>,Int>& b )
+          { return median::Lesser( a.first, b.first ); } );
+        Int weight = 0;
+        ValueInt<Real> pivot = proposals.back().first;
+        for( const auto& entry : proposals )
+        {
+            weight += entry.second;
+            if( 2*weight >= totalWeight )
+            {
+                pivot = entry.first;
+                break;
+            }
+        }
+
+        // The pivot is an entry of x, so its rank follows from the number
+        // of candidates which precede it
+        const Int numLocalLess =
+          std::count_if
+          ( candidates.begin(), candidates.end(),
+            [&]( const ValueInt<Real>& c )
+            { return median::Lesser( c, pivot ); } );
+        const Int numLess = mpi::AllReduce( numLocalLess, comm );
+        if( k == numLess )
+            return pivot;
+
+        auto newEnd =
+          ( k < numLess ?
+            std::remove_if
+            ( candidates.begin(), candidates.end(),
+              [&]( const ValueInt<Real>& c )
+              { return !median::Lesser( c, pivot ); } ) :
+            std::remove_if
+            ( candidates.begin(), candidates.end(),
+              [&]( const ValueInt<Real>& c )
+              { return !median::Lesser( pivot, c ); } ) );
+        candidates.erase( newEnd, candidates.end() );
+        if( k > numLess )
+            k -= numLess+1;
     }
 }
 
+template<typename Real,
+         typename/*=DisableIf<IsComplex<Real>>*/>
+ValueInt<Real> Median( const Matrix<Real>& x )
+{
+    EL_DEBUG_CSE
+    const Int m = x.Height();
+    const Int n = x.Width();
+    if( m != 1 && n != 1 )
+        LogicError("Median is meant for a single vector");
+    const Int k = ( n==1 ? m : n );
+    return OrderStatistic( x, k/2 );
+}
+
+template<typename Real,
+         typename/*=DisableIf<IsComplex<Real>>*/>
+ValueInt<Real> Median( const AbstractDistMatrix<Real>& x )
+{
+    EL_DEBUG_CSE
+    const Int m = x.Height();
+    const Int n = x.Width();
+    if( m != 1 && n != 1 )
+        LogicError("Median is meant for a single vector");
+    const Int k = ( n==1 ? m : n );
+    return OrderStatistic( x, k/2 );
+}
+
 #define PROTO(Real) \
+  template ValueInt<Real> OrderStatistic( const Matrix<Real>& x, Int k ); \
+  template ValueInt<Real> OrderStatistic \
+  ( const AbstractDistMatrix<Real>& x, Int k ); \
   template ValueInt<Real> Median( const Matrix<Real>& x ); \
   template ValueInt<Real> Median( const AbstractDistMatrix<Real>& x );
 
@@ -12,6 +12,153 @@
 
 namespace El {
 
+namespace sort {
+
+// Order (value,index) pairs by value and then by index so that the order is
+// total, which makes the distributed sorts deterministic and stable
+template<typename Real>
+struct PairOrder
+{
+    bool descending;
+
+    bool operator()( const ValueInt<Real>& a, const ValueInt<Real>& b ) const
+    {
+        if( a.value != b.value )
+            return descending ? a.value > b.value : a.value < b.value;
+        return a.index < b.index;
+    }
+};
+
+// Sort the entries of x[VC,* ] with a parallel sample sort: each process
+// sorts its local entries, contributes regularly-spaced samples to the choice
+// of splitters, and then exchanges its entries with a single AllToAll. Upon
+// return, this process holds the contiguous chunk of the sorted (value,index)
+// pairs which begins at the global position 'offset'.
+template<typename Real>
+vector<ValueInt<Real>>
+SampleSort( const DistMatrix<Real,VC,STAR>& x, SortType sort, Int& offset )
+{
+    EL_DEBUG_CSE
+    const PairOrder<Real> order{ sort == DESCENDING };
+    const Int localHeight = x.LocalHeight();
+    vector<ValueInt<Real>> pairs( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        pairs[iLoc].value = x.GetLocal(iLoc,0);
+        pairs[iLoc].index = x.GlobalRow(iLoc);
+    }
+    std::sort( pairs.begin(), pairs.end(), order );
+
+    mpi::Comm comm = x.DistComm();
+    const int commSize = mpi::Size( comm );
+    offset = 0;
+    if( commSize == 1 )
+        return pairs;
+
+    // Gather commSize-1 regularly-spaced samples from each process (with an
+    // index of -1 marking the absence of a sample)
+    const int numSamples = commSize-1;
+    vector<Real> sampleValues( numSamples, Real(0) );
+    vector<Int> sampleIndices( numSamples, -1 );
+    if( localHeight > 0 )
+    {
+        for( Int s=0; s<numSamples; ++s )
+        {
+            const auto& pair = pairs[((s+1)*localHeight)/commSize];
+            sampleValues[s] = pair.value;
+            sampleIndices[s] = pair.index;
+        }
+    }
+    vector<Real> allSampleValues( numSamples*commSize );
+    vector<Int> allSampleIndices( numSamples*commSize );
+    mpi::AllGather
+    ( sampleValues.data(), numSamples,
+      allSampleValues.data(), numSamples, comm );
+    mpi::AllGather
+    ( sampleIndices.data(), numSamples,
+      allSampleIndices.data(), numSamples, comm );
+    vector<ValueInt<Real>> samples;
+    for( Int s=0; s<numSamples*commSize; ++s )
+        if( allSampleIndices[s] >= 0 )
+            samples.push_back( {allSampleValues[s],allSampleIndices[s]} );
+    std::sort( samples.begin(), samples.end(), order );
+
+    // Send the entries between the (q-1)'th and q'th splitters to process q
+    vector<int> sendCounts( commSize, 0 ), sendOffs( commSize, 0 );
+    if( !samples.empty() )
+    {
+        const Int numTotalSamples = samples.size();
+        auto begin = pairs.begin();
+        for( int q=0; q<commSize; ++q )
+        {
+            auto end = pairs.end();
+            if( q < commSize-1 )
+            {
+                const auto& splitter =
+                  samples[((q+1)*numTotalSamples)/commSize];
+                end = std::lower_bound( begin, pairs.end(), splitter, order );
+            }
+            sendOffs[q] = begin - pairs.begin();
+            sendCounts[q] = end - begin;
+            begin = end;
+        }
+    }
+    vector<Real> sendValues( localHeight );
+    vector<Int> sendIndices( localHeight );
+    for( Int k=0; k<localHeight; ++k )
+    {
+        sendValues[k] = pairs[k].value;
+        sendIndices[k] = pairs[k].index;
+    }
+    SwapClear( pairs );
+    auto recvValues = mpi::AllToAll( sendValues, sendCounts, sendOffs, comm );
+    auto recvIndices =
+      mpi::AllToAll( sendIndices, sendCounts, sendOffs, comm );
+
+    const Int numRecv = recvValues.size();
+    pairs.resize( numRecv );
+    for( Int k=0; k<numRecv; ++k )
+    {
+        pairs[k].value = recvValues[k];
+        pairs[k].index = recvIndices[k];
+    }
+    std::sort( pairs.begin(), pairs.end(), order );
+
+    offset = mpi::Scan( numRecv, comm ) - numRecv;
+    return pairs;
+}
+
+// Add each of the local sorted pairs, which begin at the global position
+// 'offset', into the corresponding entry of a zero-initialized x[VC,* ], or
+// its original index into p[VC,* ]
+template<typename Real>
+void ScatterSortedValues
+( const vector<ValueInt<Real>>& pairs, Int offset,
+  DistMatrix<Real,VC,STAR>& x )
+{
+    EL_DEBUG_CSE
+    const Int numPairs = pairs.size();
+    x.Reserve( numPairs );
+    for( Int k=0; k<numPairs; ++k )
+        x.QueueUpdate( offset+k, 0, pairs[k].value );
+    x.ProcessQueues();
+}
+
+template<typename Real>
+void ScatterSortedIndices
+( const vector<ValueInt<Real>>& pairs, Int offset,
+  DistMatrix<Int,VC,STAR>& p )
+{
+    EL_DEBUG_CSE
+    const Int numPairs = pairs.size();
+    p.Reserve( numPairs );
+    for( Int k=0; k<numPairs; ++k )
+        p.QueueUpdate( offset+k, 0, pairs[k].index );
+    p.ProcessQueues();
+}
+
+} // namespace sort
+
 // Sort each column of the real matrix X
 
 template<typename Real,
@@ -57,9 +204,19 @@ void Sort( AbstractDistMatrix<Real>& X, SortType sort, bool stable )
         if( X.Participating() )
             Sort( X.Matrix(), sort, stable );
     }
+    else if( X.Width() == 1 )
+    {
+        // Sort the column vector in parallel
+        DistMatrix<Real,VC,STAR> x_VC_STAR( X );
+        Int offset;
+        auto pairs = sort::SampleSort( x_VC_STAR, sort, offset );
+        Zero( x_VC_STAR );
+        sort::ScatterSortedValues( pairs, offset, x_VC_STAR );
+        Copy( x_VC_STAR, X );
+    }
     else
     {
-        // TODO(poulson): Distributed sort
+        // TODO(poulson): Distributed sort of each column
 
         // Get a copy on a single process, sort, and then redistribute
         DistMatrix<Real,CIRC,CIRC> X_CIRC_CIRC( X );
@@ -227,6 +384,34 @@ void SortingPermutation
         sortPerm.SetImage( sortPairs[i].index, i );
 }
 
+template<typename Real,
+         typename/*=DisableIf<IsComplex<Real>>*/>
+void SortingPermutation
+( const AbstractDistMatrix<Real>& x, DistPermutation& sortPerm,
+  SortType sort, bool stable )
+{
+    EL_DEBUG_CSE
+    const Int m = x.Height();
+    const Int n = x.Width();
+    if( m != 1 && n != 1 )
+        LogicError("SortingPermutation is meant for a single vector");
+    const Grid& g = x.Grid();
+    DistMatrix<Real,VC,STAR> x_VC_STAR(g);
+    if( n == 1 )
+        x_VC_STAR = x;
+    else
+        Transpose( x, x_VC_STAR );
+
+    // The sample sort breaks ties by index and is thus always stable
+    Int offset;
+    auto pairs = sort::SampleSort( x_VC_STAR, sort, offset );
+    DistMatrix<Int,VC,STAR> preimages(g);
+    Zeros( preimages, x_VC_STAR.Height(), 1 );
+    sort::ScatterSortedIndices( pairs, offset, preimages );
+    sortPerm.SetGrid( g );
+    sortPerm.SetPreimages( preimages );
+}
+
 template<typename Real,
          typename/*=DisableIf<IsComplex<Real>>*/>
 void MergeSortingPermutation
@@ -290,7 +475,11 @@ void MergeSortingPermutation
   template vector<ValueInt<Real>> TaggedSort \
   ( const AbstractDistMatrix<Real>& x, SortType sort, bool stable ); \
   template void SortingPermutation \
-  ( const Matrix<Real>& x, Permutation& sortPerm, SortType sort, bool stable );
+  ( const Matrix<Real>& x, Permutation& sortPerm, \
+    SortType sort, bool stable ); \
+  template void SortingPermutation \
+  ( const AbstractDistMatrix<Real>& x, DistPermutation& sortPerm, \
+    SortType sort, bool stable );
 
 // For support for double-precision MRRR with float eigenvectors
 
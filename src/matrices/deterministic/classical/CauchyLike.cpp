@@ -39,7 +39,7 @@ void CauchyLike
         )
         return F1(r[i]*s[j]/x[i]-y[j]);
       };
-    IndexDependentFill( A, function<F1(Int,Int)>(cauchyFill) );
+    IndexDependentFill( A, cauchyFill );
 }
 
 template<typename F1,typename F2>
@@ -69,7 +69,7 @@ void CauchyLike
         )
         return F1(r[i]*s[j]/x[i]-y[j]);
       };
-    IndexDependentFill( A, function<F1(Int,Int)>(cauchyFill) );
+    IndexDependentFill( A, cauchyFill );
 }
 
 #define PROTO_TYPES(F1,F2) \
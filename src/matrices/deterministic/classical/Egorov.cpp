@@ -22,7 +22,7 @@ void Egorov
       [&]( Int i, Int j ) -> Complex<Real>
       { const Real theta = phase(i,j);
         return Complex<Real>(Cos(theta),Sin(theta)); };
-    IndexDependentFill( A, function<Complex<Real>(Int,Int)>(egorovFill) );
+    IndexDependentFill( A, egorovFill );
 }
 
 template<typename Real>
@@ -36,7 +36,7 @@ void Egorov
       [&]( Int i, Int j ) -> Complex<Real>
       { const Real theta = phase(i,j);
         return Complex<Real>(Cos(theta),Sin(theta)); };
-    IndexDependentFill( A, function<Complex<Real>(Int,Int)>(egorovFill) );
+    IndexDependentFill( A, egorovFill );
 }
 
 #define PROTO(Real) \
@@ -19,7 +19,7 @@ void Fiedler( Matrix<Field>& A, const vector<Field>& c )
     const Int n = c.size();
     A.Resize( n, n );
     auto fiedlerFill = [&]( Int i, Int j ) { return Abs(c[i]-c[j]); };
-    IndexDependentFill( A, function<Field(Int,Int)>(fiedlerFill) );
+    IndexDependentFill( A, fiedlerFill );
 }
 
 template<typename Field>
@@ -29,7 +29,7 @@ void Fiedler( AbstractDistMatrix<Field>& A, const vector<Field>& c )
     const Int n = c.size();
     A.Resize( n, n );
     auto fiedlerFill = [&]( Int i, Int j ) { return Abs(c[i]-c[j]); };
-    IndexDependentFill( A, function<Field(Int,Int)>(fiedlerFill) );
+    IndexDependentFill( A, fiedlerFill );
 }
 
 #define PROTO(Field) \
@@ -23,7 +23,7 @@ void Fourier( Matrix<Complex<Real>>& A, Int n )
       [=]( Int i, Int j ) -> Complex<Real>
       { const Real theta = -2*pi*i*j/n;
         return Complex<Real>(Cos(theta),Sin(theta))/nSqrt; };
-    IndexDependentFill( A, function<Complex<Real>(Int,Int)>(fourierFill) );
+    IndexDependentFill( A, fourierFill );
 }
 
 template<typename Real>
@@ -37,12 +37,175 @@ void Fourier( AbstractDistMatrix<Complex<Real>>& A, Int n )
       [=]( Int i, Int j ) -> Complex<Real>
       { const Real theta = -2*pi*i*j/n;
         return Complex<Real>(Cos(theta),Sin(theta))/nSqrt; };
-    IndexDependentFill( A, function<Complex<Real>(Int,Int)>(fourierFill) );
+    IndexDependentFill( A, fourierFill );
+}
+
+namespace fourier {
+
+// A precomputed plan for the (unnormalized) discrete Fourier transform of
+// order n, x := W x, where W(j,k) = exp(sign 2 pi i j k / n). Powers of two
+// use an iterative radix-2 transform, and other orders use the chirp
+// factorization of
+//   Leo I. Bluestein,
+//   "A linear filtering approach to the computation of discrete Fourier
+//    transform",
+//   IEEE Trans. on Audio and Electroacoustics, Vol. 18, No. 4, 1970,
+// in which the transform is a circular convolution of length M >= 2n-1, a
+// power of two, which is itself computed with radix-2 transforms.
+template<typename Real>
+class Plan
+{
+public:
+    Plan( Int n, bool adjoint )
+    : n_(n)
+    {
+        M_ = 1;
+        while( M_ < n )
+            M_ *= 2;
+        const Real sign = ( adjoint ? 1 : -1 );
+        if( M_ != n )
+        {
+            // The chirp is w_k = exp(sign pi i k^2 / n), where k^2 is reduced
+            // modulo 2n before the division to preserve accuracy
+            M_ = 1;
+            while( M_ < 2*n-1 )
+                M_ *= 2;
+            chirp_.resize( n );
+            for( Int k=0; k<n; ++k )
+            {
+                const Int kSquared = (k*k) % (2*n);
+                const Real theta = sign*Pi<Real>()*kSquared/n;
+                chirp_[k] = Complex<Real>(Cos(theta),Sin(theta));
+            }
+        }
+        SetTwiddles( M_, sign, twiddles_ );
+        if( M_ != n )
+        {
+            // Transform the (circularly wrapped) conjugate chirp once, and
+            // fold the 1/M of the inverse convolution transform into it
+            SetTwiddles( M_, -sign, inverseTwiddles_ );
+            chirpHat_.assign( M_, Complex<Real>(0) );
+            for( Int k=0; k<n; ++k )
+            {
+                chirpHat_[k] = Conj(chirp_[k]) / Real(M_);
+                if( k > 0 )
+                    chirpHat_[M_-k] = chirpHat_[k];
+            }
+            Radix2( chirpHat_.data(), twiddles_ );
+        }
+    }
+
+    // x := W x, where 'work' is resized as needed
+    void Apply( Complex<Real>* x, vector<Complex<Real>>& work ) const
+    {
+        if( M_ == n_ )
+        {
+            Radix2( x, twiddles_ );
+            return;
+        }
+        work.assign( M_, Complex<Real>(0) );
+        for( Int k=0; k<n_; ++k )
+            work[k] = x[k]*chirp_[k];
+        Radix2( work.data(), twiddles_ );
+        for( Int k=0; k<M_; ++k )
+            work[k] *= chirpHat_[k];
+        Radix2( work.data(), inverseTwiddles_ );
+        for( Int k=0; k<n_; ++k )
+            x[k] = work[k]*chirp_[k];
+    }
+
+private:
+    Int n_, M_;
+    vector<Complex<Real>> twiddles_, inverseTwiddles_, chirp_, chirpHat_;
+
+    static void SetTwiddles
+    ( Int N, Real sign, vector<Complex<Real>>& twiddles )
+    {
+        twiddles.resize( N/2 );
+        for( Int k=0; k<N/2; ++k )
+        {
+            const Real theta = sign*2*Pi<Real>()*k/N;
+            twiddles[k] = Complex<Real>(Cos(theta),Sin(theta));
+        }
+    }
+
+    // An in-place, iterative radix-2 transform of order 2*twiddles.size()
+    static void Radix2
+    ( Complex<Real>* x, const vector<Complex<Real>>& twiddles )
+    {
+        const Int N = 2*twiddles.size();
+        if( N <= 1 )
+            return;
+        for( Int i=1, j=0; i<N; ++i )
+        {
+            Int bit = N >> 1;
+            for( ; j & bit; bit >>= 1 )
+                j ^= bit;
+            j ^= bit;
+            if( i < j )
+                std::swap( x[i], x[j] );
+        }
+        for( Int length=2; length<=N; length*=2 )
+        {
+            const Int halfLength = length/2;
+            const Int stride = N/length;
+            for( Int i=0; i<N; i+=length )
+            {
+                for( Int k=0; k<halfLength; ++k )
+                {
+                    const Complex<Real> u = x[i+k];
+                    const Complex<Real> v =
+                      x[i+k+halfLength]*twiddles[k*stride];
+                    x[i+k] = u + v;
+                    x[i+k+halfLength] = u - v;
+                }
+            }
+        }
+    }
+};
+
+} // namespace fourier
+
+template<typename Real>
+void ApplyFourier( Matrix<Complex<Real>>& A, bool adjoint )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int numCols = A.Width();
+    if( n <= 1 )
+        return;
+    const fourier::Plan<Real> plan( n, adjoint );
+    const Real nSqrtInv = Real(1) / Sqrt( Real(n) );
+    Complex<Real>* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR_GRAIN(n*numCols)
+    for( Int j=0; j<numCols; ++j )
+    {
+        vector<Complex<Real>> work;
+        Complex<Real>* aCol = &ABuf[j*ALDim];
+        plan.Apply( aCol, work );
+        for( Int i=0; i<n; ++i )
+            aCol[i] *= nSqrtInv;
+    }
+}
+
+template<typename Real>
+void ApplyFourier( AbstractDistMatrix<Complex<Real>>& APre, bool adjoint )
+{
+    EL_DEBUG_CSE
+    // Redistribute so that each process owns entire columns
+    DistMatrixReadWriteProxy<Complex<Real>,Complex<Real>,STAR,VR>
+      AProx( APre );
+    auto& A = AProx.Get();
+    ApplyFourier( A.Matrix(), adjoint );
 }
 
 #define PROTO(Real) \
   template void Fourier( Matrix<Complex<Real>>& A, Int n ); \
-  template void Fourier( AbstractDistMatrix<Complex<Real>>& A, Int n );
+  template void Fourier( AbstractDistMatrix<Complex<Real>>& A, Int n ); \
+  template void ApplyFourier( Matrix<Complex<Real>>& A, bool adjoint ); \
+  template void ApplyFourier \
+  ( AbstractDistMatrix<Complex<Real>>& A, bool adjoint );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
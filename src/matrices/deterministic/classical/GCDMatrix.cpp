@@ -18,7 +18,7 @@ void GCDMatrix( Matrix<T>& G, Int m, Int n )
     EL_DEBUG_CSE
     G.Resize( m, n );
     auto gcdFill = []( Int i, Int j ) { return T(GCD(i+1,j+1)); };
-    IndexDependentFill( G, function<T(Int,Int)>(gcdFill) );
+    IndexDependentFill( G, gcdFill );
 }
 
 template<typename T>
@@ -27,7 +27,7 @@ void GCDMatrix( AbstractDistMatrix<T>& G, Int m, Int n )
     EL_DEBUG_CSE
     G.Resize( m, n );
     auto gcdFill = []( Int i, Int j ) { return T(GCD(i+1,j+1)); };
-    IndexDependentFill( G, function<T(Int,Int)>(gcdFill) );
+    IndexDependentFill( G, gcdFill );
 }
 
 #define PROTO(T) \
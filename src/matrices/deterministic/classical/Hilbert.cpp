@@ -18,7 +18,7 @@ void Hilbert( Matrix<F>& A, Int n )
     EL_DEBUG_CSE
     A.Resize( n, n );
     auto hilbertFill = []( Int i, Int j ) { return F(1)/F(i+j+1); };
-    IndexDependentFill( A, function<F(Int,Int)>(hilbertFill) );
+    IndexDependentFill( A, hilbertFill );
 }
 
 template<typename F>
@@ -27,7 +27,7 @@ void Hilbert( AbstractDistMatrix<F>& A, Int n )
     EL_DEBUG_CSE
     A.Resize( n, n );
     auto hilbertFill = []( Int i, Int j ) { return F(1)/F(i+j+1); };
-    IndexDependentFill( A, function<F(Int,Int)>(hilbertFill) );
+    IndexDependentFill( A, hilbertFill );
 }
 
 #define PROTO(F) \
@@ -20,8 +20,15 @@ void Toeplitz( Matrix<S>& A, Int m, Int n, const vector<T>& a )
     if( a.size() != Unsigned(length) )
         LogicError("a was the wrong size");
     A.Resize( m, n );
-    auto toeplitzFill = [&]( Int i, Int j ) { return a[i-j+(n-1)]; };
-    IndexDependentFill( A, function<S(Int,Int)>(toeplitzFill) );
+    // Each column is a (strided) contiguous piece of a
+    auto toeplitzColumn =
+      [&]( Int j, Int iBeg, Int iStride, Int count, S* buf )
+      {
+          const T* aCol = a.data() + (iBeg-j+(n-1));
+          for( Int k=0; k<count; ++k )
+              buf[k] = S(aCol[k*iStride]);
+      };
+    IndexDependentColumnFill( A, toeplitzColumn );
 }
 
 template<typename S,typename T>
@@ -32,8 +39,15 @@ void Toeplitz( AbstractDistMatrix<S>& A, Int m, Int n, const vector<T>& a )
     if( a.size() != Unsigned(length) )
         LogicError("a was the wrong size");
     A.Resize( m, n );
-    auto toeplitzFill = [&]( Int i, Int j ) { return a[i-j+(n-1)]; };
-    IndexDependentFill( A, function<S(Int,Int)>(toeplitzFill) );
+    // Each column is a (strided) contiguous piece of a
+    auto toeplitzColumn =
+      [&]( Int j, Int iBeg, Int iStride, Int count, S* buf )
+      {
+          const T* aCol = a.data() + (iBeg-j+(n-1));
+          for( Int k=0; k<count; ++k )
+              buf[k] = S(aCol[k*iStride]);
+      };
+    IndexDependentColumnFill( A, toeplitzColumn );
 }
 
 #define PROTO_TYPES(T1,T2) \
@@ -44,7 +44,7 @@ void Walsh( Matrix<T>& A, Int k, bool binary )
         }
         return ( on ? onValue : offValue );
       };
-    IndexDependentFill( A, function<T(Int,Int)>(walshFill) );
+    IndexDependentFill( A, walshFill );
 }
 
 template<typename T>
@@ -79,12 +79,56 @@ void Walsh( AbstractDistMatrix<T>& A, Int k, bool binary )
         }
         return ( on ? onValue : offValue );
       };
-    IndexDependentFill( A, function<T(Int,Int)>(walshFill) );
+    IndexDependentFill( A, walshFill );
+}
+
+template<typename T>
+void ApplyWalsh( Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int numCols = A.Width();
+    if( n & (n-1) )
+        LogicError("Walsh matrices require a power-of-two order, not ",n);
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+
+    // Each column is transformed in place with n log2(n) additions
+    EL_PARALLEL_FOR_GRAIN(n*numCols)
+    for( Int j=0; j<numCols; ++j )
+    {
+        T* aCol = &ABuf[j*ALDim];
+        for( Int h=1; h<n; h*=2 )
+        {
+            for( Int i=0; i<n; i+=2*h )
+            {
+                for( Int r=i; r<i+h; ++r )
+                {
+                    const T alpha = aCol[r];
+                    const T beta = aCol[r+h];
+                    aCol[r] = alpha + beta;
+                    aCol[r+h] = alpha - beta;
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+void ApplyWalsh( AbstractDistMatrix<T>& APre )
+{
+    EL_DEBUG_CSE
+    // Redistribute so that each process owns entire columns
+    DistMatrixReadWriteProxy<T,T,STAR,VR> AProx( APre );
+    auto& A = AProx.Get();
+    ApplyWalsh( A.Matrix() );
 }
 
 #define PROTO(T) \
   template void Walsh( Matrix<T>& A, Int k, bool binary ); \
-  template void Walsh( AbstractDistMatrix<T>& A, Int k, bool binary );
+  template void Walsh( AbstractDistMatrix<T>& A, Int k, bool binary ); \
+  template void ApplyWalsh( Matrix<T>& A ); \
+  template void ApplyWalsh( AbstractDistMatrix<T>& A );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -28,7 +28,7 @@ void GKS( Matrix<F>& A, Int n )
       { if( i < j )       { return -F(1)/Sqrt(F(j+1)); }
         else if( i == j ) { return  F(1)/Sqrt(F(j+1)); }
         else              { return  F(0);            } };
-    IndexDependentFill( A, function<F(Int,Int)>(gksFill) );
+    IndexDependentFill( A, gksFill );
 }
 
 template<typename F>
@@ -41,7 +41,7 @@ void GKS( AbstractDistMatrix<F>& A, Int n )
       { if( i < j )       { return -F(1)/Sqrt(F(j+1)); }
         else if( i == j ) { return  F(1)/Sqrt(F(j+1)); }
         else              { return  F(0);            } };
-    IndexDependentFill( A, function<F(Int,Int)>(gksFill) );
+    IndexDependentFill( A, gksFill );
 }
 
 #define PROTO(F) \
@@ -18,7 +18,7 @@ void MinIJ( Matrix<T>& M, Int n )
     EL_DEBUG_CSE
     M.Resize( n, n );
     auto minIJFill = []( Int i, Int j ) { return T(Min(i+1,j+1)); };
-    IndexDependentFill( M, function<T(Int,Int)>(minIJFill) );
+    IndexDependentFill( M, minIJFill );
 }
 
 template<typename T>
@@ -27,7 +27,7 @@ void MinIJ( AbstractDistMatrix<T>& M, Int n )
     EL_DEBUG_CSE
     M.Resize( n, n );
     auto minIJFill = []( Int i, Int j ) { return T(Min(i+1,j+1)); };
-    IndexDependentFill( M, function<T(Int,Int)>(minIJFill) );
+    IndexDependentFill( M, minIJFill );
 }
 
 #define PROTO(T) \
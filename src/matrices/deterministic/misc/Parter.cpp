@@ -19,7 +19,7 @@ void Parter( Matrix<F>& P, Int n )
     P.Resize( n, n );
     const F oneHalf = F(1)/F(2);
     auto parterFill = [=]( Int i, Int j ) { return F(1)/(F(i)-F(j)+oneHalf); };
-    IndexDependentFill( P, function<F(Int,Int)>(parterFill) );
+    IndexDependentFill( P, parterFill );
 }
 
 template<typename F>
@@ -29,7 +29,7 @@ void Parter( AbstractDistMatrix<F>& P, Int n )
     P.Resize( n, n );
     const F oneHalf = F(1)/F(2);
     auto parterFill = [=]( Int i, Int j ) { return F(1)/(F(i)-F(j)+oneHalf); };
-    IndexDependentFill( P, function<F(Int,Int)>(parterFill) );
+    IndexDependentFill( P, parterFill );
 }
 
 #define PROTO(F) \
@@ -21,7 +21,7 @@ void Redheffer( Matrix<T>& R, Int n )
       []( Int i, Int j ) -> T
       { if( j == 0 || ((j+1)%(i+1))==0 ) { return T(1); }
         else                             { return T(0); } };
-    IndexDependentFill( R, function<T(Int,Int)>(redhefferFill) );
+    IndexDependentFill( R, redhefferFill );
 }
 
 template<typename T>
@@ -33,7 +33,7 @@ void Redheffer( AbstractDistMatrix<T>& R, Int n )
       []( Int i, Int j ) -> T
       { if( j == 0 || ((j+1)%(i+1))==0 ) { return T(1); }
         else                             { return T(0); } };
-    IndexDependentFill( R, function<T(Int,Int)>(redhefferFill) );
+    IndexDependentFill( R, redhefferFill );
 }
 
 #define PROTO(T) \
@@ -19,7 +19,7 @@ void Ris( Matrix<F>& R, Int n )
     R.Resize( n, n );
     const F oneHalf = F(1)/F(2);
     auto risFill = [=]( Int i, Int j ) { return oneHalf/(F(n-i-j)-oneHalf); };
-    IndexDependentFill( R, function<F(Int,Int)>(risFill) );
+    IndexDependentFill( R, risFill );
 }
 
 template<typename F>
@@ -29,7 +29,7 @@ void Ris( AbstractDistMatrix<F>& R, Int n )
     R.Resize( n, n );
     const F oneHalf = F(1)/F(2);
     auto risFill = [=]( Int i, Int j ) { return oneHalf/(F(n-i-j)-oneHalf); };
-    IndexDependentFill( R, function<F(Int,Int)>(risFill) );
+    IndexDependentFill( R, risFill );
 }
 
 #define PROTO(F) \
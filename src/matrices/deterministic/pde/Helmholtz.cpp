@@ -8,10 +8,53 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
 #include <El/matrices.hpp>
 
 namespace El {
 
+template<typename F>
+StencilOperator<F> HelmholtzOperator( Int n, F shift )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real hInv = n+1;
+    const Real hInvSquared = hInv*hInv;
+    const F mainTerm = 2*hInvSquared - shift;
+    return StencilOperator<F>
+      ( n, 1, 1, mainTerm, -hInvSquared, F(0), F(0) );
+}
+
+template<typename F>
+StencilOperator<F> HelmholtzOperator( Int nx, Int ny, F shift )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real hxInv = nx+1;
+    const Real hyInv = ny+1;
+    const Real hxInvSquared = hxInv*hxInv;
+    const Real hyInvSquared = hyInv*hyInv;
+    const F mainTerm = 2*(hxInvSquared+hyInvSquared) - shift;
+    return StencilOperator<F>
+      ( nx, ny, 1, mainTerm, -hxInvSquared, -hyInvSquared, F(0) );
+}
+
+template<typename F>
+StencilOperator<F> HelmholtzOperator( Int nx, Int ny, Int nz, F shift )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real hxInv = nx+1;
+    const Real hyInv = ny+1;
+    const Real hzInv = nz+1;
+    const Real hxInvSquared = hxInv*hxInv;
+    const Real hyInvSquared = hyInv*hyInv;
+    const Real hzInvSquared = hzInv*hzInv;
+    const F mainTerm = 2*(hxInvSquared+hyInvSquared+hzInvSquared) - shift;
+    return StencilOperator<F>
+      ( nx, ny, nz, mainTerm, -hxInvSquared, -hyInvSquared, -hzInvSquared );
+}
+
 // 1D Helmholtz
 // ============
 
@@ -19,46 +62,29 @@ template<typename F>
 void Helmholtz( Matrix<F>& H, Int n, F shift )
 {
     EL_DEBUG_CSE
-    typedef Base<F> R;
-    Zeros( H, n, n );
-
-    const R hInv = n+1;
-    const R hInvSquared = hInv*hInv;
-    const F mainTerm = 2*hInvSquared - shift;
-    for( Int i=0; i<n; ++i )
-    {
-        H(i,i) = mainTerm;
-        if( i != 0 )
-            H(i,i-1) = -hInvSquared;
-        if( i != n-1 )
-            H(i,i+1) = -hInvSquared;
-    }
+    HelmholtzOperator( n, shift ).Form( H );
 }
 
 template<typename F>
 void Helmholtz( AbstractDistMatrix<F>& H, Int n, F shift )
 {
     EL_DEBUG_CSE
-    typedef Base<F> Real;
-    Zeros( H, n, n );
-
-    const Real hInv = n+1;
-    const Real hInvSquared = hInv*hInv;
-    const F mainTerm = 2*hInvSquared - shift;
+    HelmholtzOperator( n, shift ).Form( H );
+}
 
-    const Int localHeight = H.LocalHeight();
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-    {
-        const Int i = H.GlobalRow(iLoc);
-
-        H.Set( i, i, mainTerm );
-        if( i != 0 )
-            H.Set( i, i-1, -hInvSquared );
-        if( i != n-1 )
-            H.Set( i, i+1, -hInvSquared );
-    }
+template<typename F>
+void Helmholtz( SparseMatrix<F>& H, Int n, F shift )
+{
+    EL_DEBUG_CSE
+    HelmholtzOperator( n, shift ).Form( H );
 }
 
+template<typename F>
+void Helmholtz( DistSparseMatrix<F>& H, Int n, F shift )
+{
+    EL_DEBUG_CSE
+    HelmholtzOperator( n, shift ).Form( H );
+}
 
 // 2D Helmholtz
 // ============
@@ -67,65 +93,29 @@ template<typename F>
 void Helmholtz( Matrix<F>& H, Int nx, Int ny, F shift )
 {
     EL_DEBUG_CSE
-    typedef Base<F> Real;
-    const Int n = nx*ny;
-    Zeros( H, n, n );
-
-    const Real hxInv = nx+1;
-    const Real hyInv = ny+1;
-    const Real hxInvSquared = hxInv*hxInv;
-    const Real hyInvSquared = hyInv*hyInv;
-    const F mainTerm = 2*(hxInvSquared+hyInvSquared) - shift;
-    for( Int i=0; i<n; ++i )
-    {
-        const Int x = i % nx;
-        const Int y = i/nx;
-
-        H(i,i) = mainTerm;
-        if( x != 0 )
-            H(i,i-1) = -hxInvSquared;
-        if( x != nx-1 )
-            H(i,i+1) = -hxInvSquared;
-        if( y != 0 )
-            H(i,i-nx) = -hyInvSquared;
-        if( y != ny-1 )
-            H(i,i+nx) = -hyInvSquared;
-    }
+    HelmholtzOperator( nx, ny, shift ).Form( H );
 }
 
 template<typename F>
 void Helmholtz( AbstractDistMatrix<F>& H, Int nx, Int ny, F shift )
 {
     EL_DEBUG_CSE
-    typedef Base<F> Real;
-    const Int n = nx*ny;
-    Zeros( H, n, n );
-
-    const Real hxInv = nx+1;
-    const Real hyInv = ny+1;
-    const Real hxInvSquared = hxInv*hxInv;
-    const Real hyInvSquared = hyInv*hyInv;
-    const F mainTerm = 2*(hxInvSquared+hyInvSquared) - shift;
+    HelmholtzOperator( nx, ny, shift ).Form( H );
+}
 
-    const Int localHeight = H.LocalHeight();
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-    {
-        const Int i = H.GlobalRow(iLoc);
-        const Int x = i % nx;
-        const Int y = i/nx;
-
-        H.Set( i, i, mainTerm );
-        if( x != 0 )
-            H.Set( i, i-1, -hxInvSquared );
-        if( x != nx-1 )
-            H.Set( i, i+1, -hxInvSquared );
-        if( y != 0 )
-            H.Set( i, i-nx, -hyInvSquared );
-        if( y != ny-1 )
-            H.Set( i, i+nx, -hyInvSquared );
-    }
+template<typename F>
+void Helmholtz( SparseMatrix<F>& H, Int nx, Int ny, F shift )
+{
+    EL_DEBUG_CSE
+    HelmholtzOperator( nx, ny, shift ).Form( H );
 }
 
+template<typename F>
+void Helmholtz( DistSparseMatrix<F>& H, Int nx, Int ny, F shift )
+{
+    EL_DEBUG_CSE
+    HelmholtzOperator( nx, ny, shift ).Form( H );
+}
 
 // 3D Helmholtz
 // ============
@@ -134,81 +124,37 @@ template<typename F>
 void Helmholtz( Matrix<F>& H, Int nx, Int ny, Int nz, F shift )
 {
     EL_DEBUG_CSE
-    typedef Base<F> Real;
-    const Int n = nx*ny*nz;
-    Zeros( H, n, n );
-
-    const Real hxInv = nx+1;
-    const Real hyInv = ny+1;
-    const Real hzInv = nz+1;
-    const Real hxInvSquared = hxInv*hxInv;
-    const Real hyInvSquared = hyInv*hyInv;
-    const Real hzInvSquared = hzInv*hzInv;
-    const F mainTerm = 2*(hxInvSquared+hyInvSquared+hzInvSquared) - shift;
-    for( Int i=0; i<n; ++i )
-    {
-        const Int x = i % nx;
-        const Int y = (i/nx) % ny;
-        const Int z = i/(nx*ny);
-
-        H(i,i) = mainTerm;
-        if( x != 0 )
-            H(i,i-1) = -hxInvSquared;
-        if( x != nx-1 )
-            H(i,i+1) = -hxInvSquared;
-        if( y != 0 )
-            H(i,i-nx) = -hyInvSquared;
-        if( y != ny-1 )
-            H(i,i+nx) = -hyInvSquared;
-        if( z != 0 )
-            H(i,i-nx*ny) = -hzInvSquared;
-        if( z != nz-1 )
-            H(i,i+nx*ny) = -hzInvSquared;
-    }
+    HelmholtzOperator( nx, ny, nz, shift ).Form( H );
 }
 
 template<typename F>
 void Helmholtz( AbstractDistMatrix<F>& H, Int nx, Int ny, Int nz, F shift )
 {
     EL_DEBUG_CSE
-    typedef Base<F> Real;
-    const Int n = nx*ny*nz;
-    Zeros( H, n, n );
-
-    const Real hxInv = nx+1;
-    const Real hyInv = ny+1;
-    const Real hzInv = nz+1;
-    const Real hxInvSquared = hxInv*hxInv;
-    const Real hyInvSquared = hyInv*hyInv;
-    const Real hzInvSquared = hzInv*hzInv;
-    const F mainTerm = 2*(hxInvSquared+hyInvSquared+hzInvSquared) - shift;
+    HelmholtzOperator( nx, ny, nz, shift ).Form( H );
+}
 
-    const Int localHeight = H.LocalHeight();
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-    {
-        const Int i = H.GlobalRow(iLoc);
-        const Int x = i % nx;
-        const Int y = (i/nx) % ny;
-        const Int z = i/(nx*ny);
-
-        H.Set( i, i, mainTerm );
-        if( x != 0 )
-            H.Set( i, i-1, -hxInvSquared );
-        if( x != nx-1 )
-            H.Set( i, i+1, -hxInvSquared );
-        if( y != 0 )
-            H.Set( i, i-nx, -hyInvSquared );
-        if( y != ny-1 )
-            H.Set( i, i+nx, -hyInvSquared );
-        if( z != 0 )
-            H.Set( i, i-nx*ny, -hzInvSquared );
-        if( z != nz-1 )
-            H.Set( i, i+nx*ny, -hzInvSquared );
-    }
+template<typename F>
+void Helmholtz( SparseMatrix<F>& H, Int nx, Int ny, Int nz, F shift )
+{
+    EL_DEBUG_CSE
+    HelmholtzOperator( nx, ny, nz, shift ).Form( H );
 }
 
+template<typename F>
+void Helmholtz( DistSparseMatrix<F>& H, Int nx, Int ny, Int nz, F shift )
+{
+    EL_DEBUG_CSE
+    HelmholtzOperator( nx, ny, nz, shift ).Form( H );
+}
 
 #define PROTO(F) \
+  template StencilOperator<F> HelmholtzOperator \
+  ( Int nx, F shift ); \
+  template StencilOperator<F> HelmholtzOperator \
+  ( Int nx, Int ny, F shift ); \
+  template StencilOperator<F> HelmholtzOperator \
+  ( Int nx, Int ny, Int nz, F shift ); \
   template void Helmholtz \
   ( Matrix<F>& H, Int nx, F shift ); \
   template void Helmholtz \
@@ -220,7 +166,19 @@ void Helmholtz( AbstractDistMatrix<F>& H, Int nx, Int ny, Int nz, F shift )
   template void Helmholtz \
   ( Matrix<F>& H, Int nx, Int ny, Int nz, F shift ); \
   template void Helmholtz \
-  ( AbstractDistMatrix<F>& H, Int nx, Int ny, Int nz, F shift );
+  ( AbstractDistMatrix<F>& H, Int nx, Int ny, Int nz, F shift ); \
+  template void Helmholtz \
+  ( SparseMatrix<F>& H, Int nx, F shift ); \
+  template void Helmholtz \
+  ( DistSparseMatrix<F>& H, Int nx, F shift ); \
+  template void Helmholtz \
+  ( SparseMatrix<F>& H, Int nx, Int ny, F shift ); \
+  template void Helmholtz \
+  ( DistSparseMatrix<F>& H, Int nx, Int ny, F shift ); \
+  template void Helmholtz \
+  ( SparseMatrix<F>& H, Int nx, Int ny, Int nz, F shift ); \
+  template void Helmholtz \
+  ( DistSparseMatrix<F>& H, Int nx, Int ny, Int nz, F shift );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./Stencil.hpp"
+
 namespace El {
 
 namespace pml {
@@ -45,148 +47,148 @@ sInv( Int j, Int n, Int numPmlPoints, Real h, Real pmlExp, Real sigma, Real k )
 
 } // namespace pml
 
-// 1D Helmholtz with PML
-// =====================
+// The coefficients of the rows of the PML-stretched Helmholtz operator on a
+// one, two, or three-dimensional grid, which are evaluated independently for
+// each row (x,y,z) so that the rows may be generated in parallel
 template<typename Real>
-void HelmholtzPML
-( Matrix<Complex<Real>>& H, Int n,
-  Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp )
+class PMLCoefficients
 {
-    EL_DEBUG_CSE
-    using namespace pml;
-    typedef Complex<Real> C;
-    Zeros( H, n, n );
-
-    const Real k = RealPart(omega) / (2*M_PI);
-    const Real h = Real(1)/(n+1);
-    const Real hSquared = h*h;
-    for( Int i=0; i<n; ++i )
+public:
+    PMLCoefficients
+    ( Int numDims, Int nx, Int ny, Int nz,
+      Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp )
+    : numDims_(numDims), omega_(omega), numPmlPoints_(numPmlPoints),
+      sigma_(sigma), pmlExp_(pmlExp), k_(RealPart(omega)/(2*M_PI))
     {
-        const Int x = i;
+        dims_[0] = nx;
+        dims_[1] = ny;
+        dims_[2] = nz;
+    }
 
-        const C sInvL = sInv( x-1, n, numPmlPoints, h, pmlExp, sigma, k );
-        const C sInvM = sInv( x,   n, numPmlPoints, h, pmlExp, sigma, k );
-        const C sInvR = sInv( x+1, n, numPmlPoints, h, pmlExp, sigma, k );
+    void operator()
+    ( Int x, Int y, Int z, stencil::Coefficients<Complex<Real>>& coefs )
+    const
+    {
+        typedef Complex<Real> C;
+        const Int coords[3] = { x, y, z };
+        C sInvL[3], sInvM[3], sInvR[3];
+        Real hSquared[3];
+        for( Int d=0; d<numDims_; ++d )
+        {
+            const Real h = Real(1)/(dims_[d]+1);
+            hSquared[d] = h*h;
+            sInvL[d] =
+              pml::sInv
+              ( coords[d]-1, dims_[d], numPmlPoints_, h, pmlExp_, sigma_, k_ );
+            sInvM[d] =
+              pml::sInv
+              ( coords[d], dims_[d], numPmlPoints_, h, pmlExp_, sigma_, k_ );
+            sInvR[d] =
+              pml::sInv
+              ( coords[d]+1, dims_[d], numPmlPoints_, h, pmlExp_, sigma_, k_ );
+        }
+
+        // The stretching of each direction is weighted by the central
+        // stretchings of the others (which is trivial in 1D)
+        C termL[3], termR[3];
+        C mainTerm = 0;
+        C massTerm = omega_*omega_;
+        for( Int d=0; d<numDims_; ++d )
+        {
+            C top = Real(1);
+            bool firstFactor = true;
+            for( Int e=0; e<numDims_; ++e )
+            {
+                if( e == d )
+                    continue;
+                top = ( firstFactor ? sInvM[e] : top*sInvM[e] );
+                firstFactor = false;
+            }
+            const C tempL = top/sInvL[d];
+            const C tempM = top/sInvM[d];
+            const C tempR = top/sInvR[d];
+            termL[d] = (tempL+tempM) / (2*hSquared[d]);
+            termR[d] = (tempM+tempR) / (2*hSquared[d]);
+            mainTerm += termL[d];
+            mainTerm += termR[d];
+            massTerm *= sInvM[d];
+        }
+        coefs.main = mainTerm - massTerm;
+        coefs.xL = -termL[0];
+        coefs.xR = -termR[0];
+        coefs.yL = ( numDims_ > 1 ? -termL[1] : C(0) );
+        coefs.yR = ( numDims_ > 1 ? -termR[1] : C(0) );
+        coefs.zL = ( numDims_ > 2 ? -termL[2] : C(0) );
+        coefs.zR = ( numDims_ > 2 ? -termR[2] : C(0) );
+    }
 
-        // This is a bit silly in 1D, but it keeps the structure from 2D/3D
-        const C xTop = Real(1);
-        const C xTempL = xTop/sInvL;
-        const C xTempM = xTop/sInvM;
-        const C xTempR = xTop/sInvR;
-        const C xTermL = (xTempL+xTempM) / (2*hSquared);
-        const C xTermR = (xTempM+xTempR) / (2*hSquared);
+private:
+    Int numDims_;
+    Int dims_[3];
+    Complex<Real> omega_;
+    Int numPmlPoints_;
+    Real sigma_, pmlExp_, k_;
+};
 
-        const C mainTerm = (xTermL+xTermR) - omega*omega*sInvM;
+// 1D Helmholtz with PML
+// =====================
 
-        H(i,i) = mainTerm;
-        if( x != 0 )
-            H(i,i-1) = -xTermL;
-        if( x != n-1 )
-            H(i,i+1) = -xTermR;
-    }
+template<typename Real>
+void HelmholtzPML
+( Matrix<Complex<Real>>& H, Int nx,
+  Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp )
+{
+    EL_DEBUG_CSE
+    PMLCoefficients<Real>
+      coefFunc( 1, nx, 1, 1, omega, numPmlPoints, sigma, pmlExp );
+    stencil::Form( H, nx, 1, 1, coefFunc );
 }
 
 template<typename Real>
 void HelmholtzPML
-( AbstractDistMatrix<Complex<Real>>& H, Int n,
+( AbstractDistMatrix<Complex<Real>>& H, Int nx,
   Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp )
 {
     EL_DEBUG_CSE
-    using namespace pml;
-    typedef Complex<Real> C;
-    Zeros( H, n, n );
-
-    const Real k = RealPart(omega) / (2*M_PI);
-    const Real h = Real(1)/(n+1);
-    const Real hSquared = h*h;
-
-    const Int localHeight = H.LocalHeight();
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-    {
-        const Int i = H.GlobalRow(iLoc);
-        const Int x = i;
-
-        const C sInvL = sInv( x-1, n, numPmlPoints, h, pmlExp, sigma, k );
-        const C sInvM = sInv( x,   n, numPmlPoints, h, pmlExp, sigma, k );
-        const C sInvR = sInv( x+1, n, numPmlPoints, h, pmlExp, sigma, k );
-
-        // This is a bit silly in 1D, but it keeps the structure from 2D/3D
-        const C xTop = Real(1);
-        const C xTempL = xTop/sInvL;
-        const C xTempM = xTop/sInvM;
-        const C xTempR = xTop/sInvR;
-        const C xTermL = (xTempL+xTempM) / (2*hSquared);
-        const C xTermR = (xTempM+xTempR) / (2*hSquared);
-
-        const C mainTerm = (xTermL+xTermR) - omega*omega*sInvM;
+    PMLCoefficients<Real>
+      coefFunc( 1, nx, 1, 1, omega, numPmlPoints, sigma, pmlExp );
+    stencil::Form( H, nx, 1, 1, coefFunc );
+}
 
-        H.Set( i, i, mainTerm );
-        if( x != 0 )
-            H.Set( i, i-1, -xTermL );
-        if( x != n-1 )
-            H.Set( i, i+1, -xTermR );
-    }
+template<typename Real>
+void HelmholtzPML
+( SparseMatrix<Complex<Real>>& H, Int nx,
+  Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp )
+{
+    EL_DEBUG_CSE
+    PMLCoefficients<Real>
+      coefFunc( 1, nx, 1, 1, omega, numPmlPoints, sigma, pmlExp );
+    stencil::Form( H, nx, 1, 1, coefFunc );
 }
 
+template<typename Real>
+void HelmholtzPML
+( DistSparseMatrix<Complex<Real>>& H, Int nx,
+  Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp )
+{
+    EL_DEBUG_CSE
+    PMLCoefficients<Real>
+      coefFunc( 1, nx, 1, 1, omega, numPmlPoints, sigma, pmlExp );
+    stencil::Form( H, nx, 1, 1, coefFunc );
+}
 
 // 2D Helmholtz with PML
 // =====================
+
 template<typename Real>
 void HelmholtzPML
 ( Matrix<Complex<Real>>& H, Int nx, Int ny,
   Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp )
 {
     EL_DEBUG_CSE
-    using namespace pml;
-    typedef Complex<Real> C;
-    const Int n = nx*ny;
-    Zeros( H, n, n );
-
-    const Real k = RealPart(omega) / (2*M_PI);
-    const Real hx = Real(1)/(nx+1);
-    const Real hy = Real(1)/(ny+1);
-    const Real hxSquared = hx*hx;
-    const Real hySquared = hy*hy;
-    for( Int i=0; i<n; ++i )
-    {
-        const Int x = i % nx;
-        const Int y = i / nx;
-
-        const C sxInvL = sInv( x-1, nx, numPmlPoints, hx, pmlExp, sigma, k );
-        const C sxInvM = sInv( x,   nx, numPmlPoints, hx, pmlExp, sigma, k );
-        const C sxInvR = sInv( x+1, nx, numPmlPoints, hx, pmlExp, sigma, k );
-
-        const C syInvL = sInv( y-1, ny, numPmlPoints, hy, pmlExp, sigma, k );
-        const C syInvM = sInv( y,   ny, numPmlPoints, hy, pmlExp, sigma, k );
-        const C syInvR = sInv( y+1, ny, numPmlPoints, hy, pmlExp, sigma, k );
-
-        const C xTop = syInvM;
-        const C xTempL = xTop/sxInvL;
-        const C xTempM = xTop/sxInvM;
-        const C xTempR = xTop/sxInvR;
-        const C xTermL = (xTempL+xTempM) / (2*hxSquared);
-        const C xTermR = (xTempM+xTempR) / (2*hxSquared);
-
-        const C yTop = sxInvM;
-        const C yTempL = yTop/syInvL;
-        const C yTempM = yTop/syInvM;
-        const C yTempR = yTop/syInvR;
-        const C yTermL = (yTempL+yTempM) / (2*hySquared);
-        const C yTermR = (yTempM+yTempR) / (2*hySquared);
-
-        const C mainTerm = (xTermL+xTermR+yTermL+yTermR) -
-                           omega*omega*sxInvM*syInvM;
-
-        H(i,i) = mainTerm;
-        if( x != 0 )
-            H(i,i-1) = -xTermL;
-        if( x != nx-1 )
-            H(i,i+1) = -xTermR;
-        if( y != 0 )
-            H(i,i-nx) = -yTermL;
-        if( y != ny-1 )
-            H(i,i+nx) = -yTermR;
-    }
+    PMLCoefficients<Real>
+      coefFunc( 2, nx, ny, 1, omega, numPmlPoints, sigma, pmlExp );
+    stencil::Form( H, nx, ny, 1, coefFunc );
 }
 
 template<typename Real>
@@ -195,138 +197,45 @@ void HelmholtzPML
   Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp )
 {
     EL_DEBUG_CSE
-    using namespace pml;
-    typedef Complex<Real> C;
-    const Int n = nx*ny;
-    Zeros( H, n, n );
-
-    const Real k = RealPart(omega) / (2*M_PI);
-    const Real hx = Real(1)/(nx+1);
-    const Real hy = Real(1)/(ny+1);
-    const Real hxSquared = hx*hx;
-    const Real hySquared = hy*hy;
-
-    const Int localHeight = H.LocalHeight();
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-    {
-        const Int i = H.GlobalRow(iLoc);
-        const Int x = i % nx;
-        const Int y = i / nx;
-
-        const C sxInvL = sInv( x-1, nx, numPmlPoints, hx, pmlExp, sigma, k );
-        const C sxInvM = sInv( x,   nx, numPmlPoints, hx, pmlExp, sigma, k );
-        const C sxInvR = sInv( x+1, nx, numPmlPoints, hx, pmlExp, sigma, k );
-
-        const C syInvL = sInv( y-1, ny, numPmlPoints, hy, pmlExp, sigma, k );
-        const C syInvM = sInv( y,   ny, numPmlPoints, hy, pmlExp, sigma, k );
-        const C syInvR = sInv( y+1, ny, numPmlPoints, hy, pmlExp, sigma, k );
-
-        const C xTop = syInvM;
-        const C xTempL = xTop/sxInvL;
-        const C xTempM = xTop/sxInvM;
-        const C xTempR = xTop/sxInvR;
-        const C xTermL = (xTempL+xTempM) / (2*hxSquared);
-        const C xTermR = (xTempM+xTempR) / (2*hxSquared);
-
-        const C yTop = sxInvM;
-        const C yTempL = yTop/syInvL;
-        const C yTempM = yTop/syInvM;
-        const C yTempR = yTop/syInvR;
-        const C yTermL = (yTempL+yTempM) / (2*hySquared);
-        const C yTermR = (yTempM+yTempR) / (2*hySquared);
-
-        const C mainTerm = (xTermL+xTermR+yTermL+yTermR) -
-                           omega*omega*sxInvM*syInvM;
+    PMLCoefficients<Real>
+      coefFunc( 2, nx, ny, 1, omega, numPmlPoints, sigma, pmlExp );
+    stencil::Form( H, nx, ny, 1, coefFunc );
+}
 
-        H.Set( i, i, mainTerm );
-        if( x != 0 )
-            H.Set( i, i-1, -xTermL );
-        if( x != nx-1 )
-            H.Set( i, i+1, -xTermR );
-        if( y != 0 )
-            H.Set( i, i-nx, -yTermL );
-        if( y != ny-1 )
-            H.Set( i, i+nx, -yTermR );
-    }
+template<typename Real>
+void HelmholtzPML
+( SparseMatrix<Complex<Real>>& H, Int nx, Int ny,
+  Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp )
+{
+    EL_DEBUG_CSE
+    PMLCoefficients<Real>
+      coefFunc( 2, nx, ny, 1, omega, numPmlPoints, sigma, pmlExp );
+    stencil::Form( H, nx, ny, 1, coefFunc );
 }
 
+template<typename Real>
+void HelmholtzPML
+( DistSparseMatrix<Complex<Real>>& H, Int nx, Int ny,
+  Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp )
+{
+    EL_DEBUG_CSE
+    PMLCoefficients<Real>
+      coefFunc( 2, nx, ny, 1, omega, numPmlPoints, sigma, pmlExp );
+    stencil::Form( H, nx, ny, 1, coefFunc );
+}
 
 // 3D Helmholtz with PML
 // =====================
+
 template<typename Real>
 void HelmholtzPML
 ( Matrix<Complex<Real>>& H, Int nx, Int ny, Int nz,
   Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp )
 {
     EL_DEBUG_CSE
-    using namespace pml;
-    typedef Complex<Real> C;
-    const Int n = nx*ny*nz;
-    Zeros( H, n, n );
-
-    const Real k = RealPart(omega) / (2*M_PI);
-    const Real hx = Real(1)/(nx+1);
-    const Real hy = Real(1)/(ny+1);
-    const Real hz = Real(1)/(nz+1);
-    const Real hxSquared = hx*hx;
-    const Real hySquared = hy*hy;
-    const Real hzSquared = hz*hz;
-    for( Int i=0; i<n; ++i )
-    {
-        const Int x = i % nx;
-        const Int y = (i/nx) % ny;
-        const Int z = i/(nx*ny);
-
-        const C sxInvL = sInv( x-1, nx, numPmlPoints, hx, pmlExp, sigma, k );
-        const C sxInvM = sInv( x,   nx, numPmlPoints, hx, pmlExp, sigma, k );
-        const C sxInvR = sInv( x+1, nx, numPmlPoints, hx, pmlExp, sigma, k );
-
-        const C syInvL = sInv( y-1, ny, numPmlPoints, hy, pmlExp, sigma, k );
-        const C syInvM = sInv( y,   ny, numPmlPoints, hy, pmlExp, sigma, k );
-        const C syInvR = sInv( y+1, ny, numPmlPoints, hy, pmlExp, sigma, k );
-
-        const C szInvL = sInv( z-1, nz, numPmlPoints, hz, pmlExp, sigma, k );
-        const C szInvM = sInv( z,   nz, numPmlPoints, hz, pmlExp, sigma, k );
-        const C szInvR = sInv( z+1, nz, numPmlPoints, hz, pmlExp, sigma, k );
-
-        const C xTop = syInvM*szInvM;
-        const C xTempL = xTop/sxInvL;
-        const C xTempM = xTop/sxInvM;
-        const C xTempR = xTop/sxInvR;
-        const C xTermL = (xTempL+xTempM) / (2*hxSquared);
-        const C xTermR = (xTempM+xTempR) / (2*hxSquared);
-
-        const C yTop = sxInvM*szInvM;
-        const C yTempL = yTop/syInvL;
-        const C yTempM = yTop/syInvM;
-        const C yTempR = yTop/syInvR;
-        const C yTermL = (yTempL+yTempM) / (2*hySquared);
-        const C yTermR = (yTempM+yTempR) / (2*hySquared);
-
-        const C zTop = sxInvM*syInvM;
-        const C zTempL = zTop/szInvL;
-        const C zTempM = zTop/szInvM;
-        const C zTempR = zTop/szInvR;
-        const C zTermL = (zTempL+zTempM) / (2*hzSquared);
-        const C zTermR = (zTempM+zTempR) / (2*hzSquared);
-
-        const C mainTerm = (xTermL+xTermR+yTermL+yTermR+zTermL+zTermR) -
-                           omega*omega*sxInvM*syInvM*szInvM;
-
-        H(i,i) = mainTerm;
-        if( x != 0 )
-            H(i,i-1) = -xTermL;
-        if( x != nx-1 )
-            H(i,i+1) = -xTermR;
-        if( y != 0 )
-            H(i,i-nx) = -yTermL;
-        if( y != ny-1 )
-            H(i,i+nx) = -yTermR;
-        if( z != 0 )
-            H(i,i-nx*ny) = -zTermL;
-        if( z != nz-1 )
-            H(i,i+nx*ny) = -zTermR;
-    }
+    PMLCoefficients<Real>
+      coefFunc( 3, nx, ny, nz, omega, numPmlPoints, sigma, pmlExp );
+    stencil::Form( H, nx, ny, nz, coefFunc );
 }
 
 template<typename Real>
@@ -335,79 +244,32 @@ void HelmholtzPML
   Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp )
 {
     EL_DEBUG_CSE
-    using namespace pml;
-    typedef Complex<Real> C;
-    const Int n = nx*ny*nz;
-    Zeros( H, n, n );
-
-    const Real k = RealPart(omega) / (2*M_PI);
-    const Real hx = Real(1)/(nx+1);
-    const Real hy = Real(1)/(ny+1);
-    const Real hz = Real(1)/(nz+1);
-    const Real hxSquared = hx*hx;
-    const Real hySquared = hy*hy;
-    const Real hzSquared = hz*hz;
-
-    const Int localHeight = H.LocalHeight();
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-    {
-        const Int i = H.GlobalRow(iLoc);
-        const Int x = i % nx;
-        const Int y = (i/nx) % ny;
-        const Int z = i/(nx*ny);
-
-        const C sxInvL = sInv( x-1, nx, numPmlPoints, hx, pmlExp, sigma, k );
-        const C sxInvM = sInv( x,   nx, numPmlPoints, hx, pmlExp, sigma, k );
-        const C sxInvR = sInv( x+1, nx, numPmlPoints, hx, pmlExp, sigma, k );
-
-        const C syInvL = sInv( y-1, ny, numPmlPoints, hy, pmlExp, sigma, k );
-        const C syInvM = sInv( y,   ny, numPmlPoints, hy, pmlExp, sigma, k );
-        const C syInvR = sInv( y+1, ny, numPmlPoints, hy, pmlExp, sigma, k );
-
-        const C szInvL = sInv( z-1, nz, numPmlPoints, hz, pmlExp, sigma, k );
-        const C szInvM = sInv( z,   nz, numPmlPoints, hz, pmlExp, sigma, k );
-        const C szInvR = sInv( z+1, nz, numPmlPoints, hz, pmlExp, sigma, k );
-
-        const C xTop = syInvM*szInvM;
-        const C xTempL = xTop/sxInvL;
-        const C xTempM = xTop/sxInvM;
-        const C xTempR = xTop/sxInvR;
-        const C xTermL = (xTempL+xTempM) / (2*hxSquared);
-        const C xTermR = (xTempM+xTempR) / (2*hxSquared);
-
-        const C yTop = sxInvM*szInvM;
-        const C yTempL = yTop/syInvL;
-        const C yTempM = yTop/syInvM;
-        const C yTempR = yTop/syInvR;
-        const C yTermL = (yTempL+yTempM) / (2*hySquared);
-        const C yTermR = (yTempM+yTempR) / (2*hySquared);
-
-        const C zTop = sxInvM*syInvM;
-        const C zTempL = zTop/szInvL;
-        const C zTempM = zTop/szInvM;
-        const C zTempR = zTop/szInvR;
-        const C zTermL = (zTempL+zTempM) / (2*hzSquared);
-        const C zTermR = (zTempM+zTempR) / (2*hzSquared);
-
-        const C mainTerm = (xTermL+xTermR+yTermL+yTermR+zTermL+zTermR) -
-                           omega*omega*sxInvM*syInvM*szInvM;
+    PMLCoefficients<Real>
+      coefFunc( 3, nx, ny, nz, omega, numPmlPoints, sigma, pmlExp );
+    stencil::Form( H, nx, ny, nz, coefFunc );
+}
 
-        H.Set( i, i, mainTerm );
-        if( x != 0 )
-            H.Set( i, i-1, -xTermL );
-        if( x != nx-1 )
-            H.Set( i, i+1, -xTermR );
-        if( y != 0 )
-            H.Set( i, i-nx, -yTermL );
-        if( y != ny-1 )
-            H.Set( i, i+nx, -yTermR );
-        if( z != 0 )
-            H.Set( i, i-nx*ny, -zTermL );
-        if( z != nz-1 )
-            H.Set( i, i+nx*ny, -zTermR );
-    }
+template<typename Real>
+void HelmholtzPML
+( SparseMatrix<Complex<Real>>& H, Int nx, Int ny, Int nz,
+  Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp )
+{
+    EL_DEBUG_CSE
+    PMLCoefficients<Real>
+      coefFunc( 3, nx, ny, nz, omega, numPmlPoints, sigma, pmlExp );
+    stencil::Form( H, nx, ny, nz, coefFunc );
 }
 
+template<typename Real>
+void HelmholtzPML
+( DistSparseMatrix<Complex<Real>>& H, Int nx, Int ny, Int nz,
+  Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp )
+{
+    EL_DEBUG_CSE
+    PMLCoefficients<Real>
+      coefFunc( 3, nx, ny, nz, omega, numPmlPoints, sigma, pmlExp );
+    stencil::Form( H, nx, ny, nz, coefFunc );
+}
 
 #define PROTO(Real) \
   template void HelmholtzPML \
@@ -417,16 +279,34 @@ void HelmholtzPML
   ( AbstractDistMatrix<Complex<Real>>& H, Int nx, \
     Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp ); \
   template void HelmholtzPML \
+  ( SparseMatrix<Complex<Real>>& H, Int nx, \
+    Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp ); \
+  template void HelmholtzPML \
+  ( DistSparseMatrix<Complex<Real>>& H, Int nx, \
+    Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp ); \
+  template void HelmholtzPML \
   ( Matrix<Complex<Real>>& H, Int nx, Int ny, \
     Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp ); \
   template void HelmholtzPML \
   ( AbstractDistMatrix<Complex<Real>>& H, Int nx, Int ny, \
     Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp ); \
   template void HelmholtzPML \
+  ( SparseMatrix<Complex<Real>>& H, Int nx, Int ny, \
+    Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp ); \
+  template void HelmholtzPML \
+  ( DistSparseMatrix<Complex<Real>>& H, Int nx, Int ny, \
+    Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp ); \
+  template void HelmholtzPML \
   ( Matrix<Complex<Real>>& H, Int nx, Int ny, Int nz, \
     Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp ); \
   template void HelmholtzPML \
   ( AbstractDistMatrix<Complex<Real>>& H, Int nx, Int ny, Int nz, \
+    Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp ); \
+  template void HelmholtzPML \
+  ( SparseMatrix<Complex<Real>>& H, Int nx, Int ny, Int nz, \
+    Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp ); \
+  template void HelmholtzPML \
+  ( DistSparseMatrix<Complex<Real>>& H, Int nx, Int ny, Int nz, \
     Complex<Real> omega, Int numPmlPoints, Real sigma, Real pmlExp );
 
 #define EL_NO_INT_PROTO
@@ -7,10 +7,55 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
 #include <El/matrices.hpp>
 
 namespace El {
 
+// The negations of the Helmholtz operators with zero shift
+
+template<typename F>
+StencilOperator<F> LaplacianOperator( Int n )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real hInv = n+1;
+    const Real hInvSquared = hInv*hInv;
+    const F mainTerm = -2*hInvSquared;
+    return StencilOperator<F>( n, 1, 1, mainTerm, hInvSquared, F(0), F(0) );
+}
+
+template<typename F>
+StencilOperator<F> LaplacianOperator( Int nx, Int ny )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real hxInv = nx+1;
+    const Real hyInv = ny+1;
+    const Real hxInvSquared = hxInv*hxInv;
+    const Real hyInvSquared = hyInv*hyInv;
+    const F mainTerm = -2*(hxInvSquared+hyInvSquared);
+    return StencilOperator<F>
+      ( nx, ny, 1, mainTerm, hxInvSquared, hyInvSquared, F(0) );
+}
+
+template<typename F>
+StencilOperator<F> LaplacianOperator( Int nx, Int ny, Int nz )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real hxInv = nx+1;
+    const Real hyInv = ny+1;
+    const Real hzInv = nz+1;
+    const Real hxInvSquared = hxInv*hxInv;
+    const Real hyInvSquared = hyInv*hyInv;
+    const Real hzInvSquared = hzInv*hzInv;
+    const F mainTerm = -2*(hxInvSquared+hyInvSquared+hzInvSquared);
+    return StencilOperator<F>
+      ( nx, ny, nz, mainTerm, hxInvSquared, hyInvSquared, hzInvSquared );
+}
+
 // 1D Laplacian
 // ============
 
@@ -18,16 +63,28 @@ template<typename F>
 void Laplacian( Matrix<F>& L, Int n )
 {
     EL_DEBUG_CSE
-    Helmholtz( L, n, F(0) );
-    L *= -1;
+    LaplacianOperator<F>( n ).Form( L );
 }
 
 template<typename F>
 void Laplacian( AbstractDistMatrix<F>& L, Int n )
 {
     EL_DEBUG_CSE
-    Helmholtz( L, n, F(0) );
-    L *= -1;
+    LaplacianOperator<F>( n ).Form( L );
+}
+
+template<typename F>
+void Laplacian( SparseMatrix<F>& L, Int n )
+{
+    EL_DEBUG_CSE
+    LaplacianOperator<F>( n ).Form( L );
+}
+
+template<typename F>
+void Laplacian( DistSparseMatrix<F>& L, Int n )
+{
+    EL_DEBUG_CSE
+    LaplacianOperator<F>( n ).Form( L );
 }
 
 // 2D Laplacian
@@ -37,16 +94,28 @@ template<typename F>
 void Laplacian( Matrix<F>& L, Int nx, Int ny )
 {
     EL_DEBUG_CSE
-    Helmholtz( L, nx, ny, F(0) );
-    L *= -1;
+    LaplacianOperator<F>( nx, ny ).Form( L );
 }
 
 template<typename F>
 void Laplacian( AbstractDistMatrix<F>& L, Int nx, Int ny )
 {
     EL_DEBUG_CSE
-    Helmholtz( L, nx, ny, F(0) );
-    L *= -1;
+    LaplacianOperator<F>( nx, ny ).Form( L );
+}
+
+template<typename F>
+void Laplacian( SparseMatrix<F>& L, Int nx, Int ny )
+{
+    EL_DEBUG_CSE
+    LaplacianOperator<F>( nx, ny ).Form( L );
+}
+
+template<typename F>
+void Laplacian( DistSparseMatrix<F>& L, Int nx, Int ny )
+{
+    EL_DEBUG_CSE
+    LaplacianOperator<F>( nx, ny ).Form( L );
 }
 
 // 3D Laplacian
@@ -56,19 +125,35 @@ template<typename F>
 void Laplacian( Matrix<F>& L, Int nx, Int ny, Int nz )
 {
     EL_DEBUG_CSE
-    Helmholtz( L, nx, ny, nz, F(0) );
-    L *= -1;
+    LaplacianOperator<F>( nx, ny, nz ).Form( L );
 }
 
 template<typename F>
 void Laplacian( AbstractDistMatrix<F>& L, Int nx, Int ny, Int nz )
 {
     EL_DEBUG_CSE
-    Helmholtz( L, nx, ny, nz, F(0) );
-    L *= -1;
+    LaplacianOperator<F>( nx, ny, nz ).Form( L );
+}
+
+template<typename F>
+void Laplacian( SparseMatrix<F>& L, Int nx, Int ny, Int nz )
+{
+    EL_DEBUG_CSE
+    LaplacianOperator<F>( nx, ny, nz ).Form( L );
+}
+
+template<typename F>
+void Laplacian( DistSparseMatrix<F>& L, Int nx, Int ny, Int nz )
+{
+    EL_DEBUG_CSE
+    LaplacianOperator<F>( nx, ny, nz ).Form( L );
 }
 
 #define PROTO(F) \
+  template StencilOperator<F> LaplacianOperator( Int nx ); \
+  template StencilOperator<F> LaplacianOperator( Int nx, Int ny ); \
+  template StencilOperator<F> LaplacianOperator \
+  ( Int nx, Int ny, Int nz ); \
   template void Laplacian( Matrix<F>& L, Int nx ); \
   template void Laplacian( AbstractDistMatrix<F>& L, Int nx ); \
   template void Laplacian( Matrix<F>& L, Int nx, Int ny ); \
@@ -76,7 +161,15 @@ void Laplacian( AbstractDistMatrix<F>& L, Int nx, Int ny, Int nz )
   template void Laplacian \
   ( Matrix<F>& L, Int nx, Int ny, Int nz ); \
   template void Laplacian \
-  ( AbstractDistMatrix<F>& L, Int nx, Int ny, Int nz );
+  ( AbstractDistMatrix<F>& L, Int nx, Int ny, Int nz ); \
+  template void Laplacian( SparseMatrix<F>& L, Int nx ); \
+  template void Laplacian( DistSparseMatrix<F>& L, Int nx ); \
+  template void Laplacian( SparseMatrix<F>& L, Int nx, Int ny ); \
+  template void Laplacian( DistSparseMatrix<F>& L, Int nx, Int ny ); \
+  template void Laplacian \
+  ( SparseMatrix<F>& L, Int nx, Int ny, Int nz ); \
+  template void Laplacian \
+  ( DistSparseMatrix<F>& L, Int nx, Int ny, Int nz );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
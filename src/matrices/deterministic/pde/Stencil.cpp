@@ -0,0 +1,254 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+#include <El/matrices.hpp>
+
+#include "./Stencil.hpp"
+
+namespace El {
+
+template<typename Field>
+StencilOperator<Field>::StencilOperator
+( Int nx, Int ny, Int nz,
+  Field mainTerm, Field xTerm, Field yTerm, Field zTerm )
+: nx_(nx), ny_(ny), nz_(nz),
+  mainTerm_(mainTerm), xTerm_(xTerm), yTerm_(yTerm), zTerm_(zTerm)
+{
+    EL_DEBUG_CSE
+    if( nx < 0 || ny < 0 || nz < 0 )
+        LogicError
+        ("Invalid grid dimensions of ",nx," x ",ny," x ",nz);
+}
+
+template<typename Field>
+void StencilOperator<Field>::LocalApply
+( Orientation orientation,
+  Field alpha, const Matrix<Field>& X, Int XOffset,
+  Field beta,        Matrix<Field>& Y, Int firstRow ) const
+{
+    EL_DEBUG_CSE
+    // The stencil is symmetric, and so only its adjoint differs from it
+    const bool conjugate = ( orientation == ADJOINT );
+    const Field mainTerm = ( conjugate ? Conj(mainTerm_) : mainTerm_ );
+    const Field xTerm = ( conjugate ? Conj(xTerm_) : xTerm_ );
+    const Field yTerm = ( conjugate ? Conj(yTerm_) : yTerm_ );
+    const Field zTerm = ( conjugate ? Conj(zTerm_) : zTerm_ );
+    const Int nx = nx_;
+    const Int ny = ny_;
+    const Int nz = nz_;
+    const Int nxy = nx*ny;
+    const Int numRows = Y.Height();
+    const Int numRHS = Y.Width();
+    for( Int j=0; j<numRHS; ++j )
+    {
+        const Field* XBuf = X.LockedBuffer(0,j);
+        Field* YBuf = Y.Buffer(0,j);
+        EL_PARALLEL_FOR
+        for( Int iLoc=0; iLoc<numRows; ++iLoc )
+        {
+            const Int i = firstRow + iLoc;
+            const Int x = i % nx;
+            const Int y = (i/nx) % ny;
+            const Int z = i/nxy;
+            const Field* chi = &XBuf[i-XOffset];
+            Field sum = mainTerm*chi[0];
+            if( z != 0 )
+                sum += zTerm*chi[-nxy];
+            if( y != 0 )
+                sum += yTerm*chi[-nx];
+            if( x != 0 )
+                sum += xTerm*chi[-1];
+            if( x != nx-1 )
+                sum += xTerm*chi[1];
+            if( y != ny-1 )
+                sum += yTerm*chi[nx];
+            if( z != nz-1 )
+                sum += zTerm*chi[nxy];
+            if( beta == Field(0) )
+                YBuf[iLoc] = alpha*sum;
+            else
+                YBuf[iLoc] = beta*YBuf[iLoc] + alpha*sum;
+        }
+    }
+}
+
+template<typename Field>
+void StencilOperator<Field>::Apply
+( Orientation orientation,
+  Field alpha, const Matrix<Field>& X,
+  Field beta,        Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    const Int n = Height();
+    if( X.Height() != n || Y.Height() != n || Y.Width() != X.Width() )
+        LogicError
+        ("Nonconformal application of an operator of order ",n," to a ",
+         X.Height()," x ",X.Width()," matrix with a ",Y.Height()," x ",
+         Y.Width()," result");
+    LocalApply( orientation, alpha, X, 0, beta, Y, 0 );
+}
+
+template<typename Field>
+void StencilOperator<Field>::Apply
+( Orientation orientation,
+  Field alpha, const DistMultiVec<Field>& X,
+  Field beta,        DistMultiVec<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    const Int n = Height();
+    const Int numRHS = X.Width();
+    if( X.Height() != n || Y.Height() != n || Y.Width() != numRHS )
+        LogicError
+        ("Nonconformal application of an operator of order ",n," to a ",
+         X.Height()," x ",numRHS," DistMultiVec with a ",Y.Height()," x ",
+         Y.Width()," result");
+    if( X.Grid() != Y.Grid() )
+        LogicError("X and Y must be distributed over the same grid");
+    mpi::Comm comm = X.Grid().Comm();
+    const int commSize = X.Grid().Size();
+    const int commRank = X.Grid().Rank();
+    const Int blocksize = X.Blocksize();
+
+    // Each process owns a contiguous block of rows, and computing the rows
+    // [first,last) requires the rows of X within 'halo' of them
+    const Int halo =
+      ( nz_ > 1 ? nx_*ny_ : ( ny_ > 1 ? nx_ : Min(nx_-1,Int(1)) ) );
+    auto ownedRange = [&]( int q, Int& first, Int& last )
+      {
+          first = Min( q*blocksize, n );
+          last = Min( first+blocksize, n );
+      };
+    auto neededRange = [&]( Int first, Int last, Int& lo, Int& hi )
+      {
+          lo = ( first == last ? first : Max( first-halo, Int(0) ) );
+          hi = ( first == last ? last : Min( last+halo, n ) );
+      };
+    Int first, last, lo, hi;
+    ownedRange( commRank, first, last );
+    neededRange( first, last, lo, hi );
+
+    // Both sides of each exchange follow from the block distribution
+    vector<int> sendSizes( commSize, 0 ), recvSizes( commSize, 0 );
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        Int qFirst, qLast, qLo, qHi;
+        ownedRange( q, qFirst, qLast );
+        neededRange( qFirst, qLast, qLo, qHi );
+        sendSizes[q] =
+          Max( Min(last,qHi)-Max(first,qLo), Int(0) )*numRHS;
+        recvSizes[q] =
+          Max( Min(qLast,hi)-Max(qFirst,lo), Int(0) )*numRHS;
+    }
+    vector<int> sendOffs, recvOffs;
+    const int numSends = Scan( sendSizes, sendOffs );
+    const int numRecvs = Scan( recvSizes, recvOffs );
+
+    const Matrix<Field>& XLoc = X.LockedMatrix();
+    vector<Field> sendBuf( numSends );
+    for( int q=0; q<commSize; ++q )
+    {
+        if( sendSizes[q] == 0 )
+            continue;
+        Int qFirst, qLast, qLo, qHi;
+        ownedRange( q, qFirst, qLast );
+        neededRange( qFirst, qLast, qLo, qHi );
+        Int offset = sendOffs[q];
+        for( Int j=0; j<numRHS; ++j )
+            for( Int i=Max(first,qLo); i<Min(last,qHi); ++i )
+                sendBuf[offset++] = XLoc(i-first,j);
+    }
+    vector<Field> recvBuf( numRecvs );
+    mpi::AllToAll
+    ( sendBuf.data(), sendSizes.data(), sendOffs.data(),
+      recvBuf.data(), recvSizes.data(), recvOffs.data(), comm );
+    SwapClear( sendBuf );
+
+    // Assemble the rows [lo,hi) of X and apply the stencil to them
+    Matrix<Field> XHalo;
+    Zeros( XHalo, hi-lo, numRHS );
+    for( Int j=0; j<numRHS; ++j )
+        for( Int i=first; i<last; ++i )
+            XHalo(i-lo,j) = XLoc(i-first,j);
+    for( int q=0; q<commSize; ++q )
+    {
+        if( recvSizes[q] == 0 )
+            continue;
+        Int qFirst, qLast;
+        ownedRange( q, qFirst, qLast );
+        Int offset = recvOffs[q];
+        for( Int j=0; j<numRHS; ++j )
+            for( Int i=Max(qFirst,lo); i<Min(qLast,hi); ++i )
+                XHalo(i-lo,j) = recvBuf[offset++];
+    }
+    LocalApply( orientation, alpha, XHalo, lo, beta, Y.Matrix(), first );
+}
+
+template<typename Field>
+void StencilOperator<Field>::Form( Matrix<Field>& A ) const
+{
+    EL_DEBUG_CSE
+    const stencil::Coefficients<Field> coefs =
+      { mainTerm_, xTerm_, xTerm_, yTerm_, yTerm_, zTerm_, zTerm_ };
+    auto coefFunc =
+      [&]( Int, Int, Int, stencil::Coefficients<Field>& rowCoefs )
+      { rowCoefs = coefs; };
+    stencil::Form( A, nx_, ny_, nz_, coefFunc );
+}
+
+template<typename Field>
+void StencilOperator<Field>::Form( AbstractDistMatrix<Field>& A ) const
+{
+    EL_DEBUG_CSE
+    const stencil::Coefficients<Field> coefs =
+      { mainTerm_, xTerm_, xTerm_, yTerm_, yTerm_, zTerm_, zTerm_ };
+    auto coefFunc =
+      [&]( Int, Int, Int, stencil::Coefficients<Field>& rowCoefs )
+      { rowCoefs = coefs; };
+    stencil::Form( A, nx_, ny_, nz_, coefFunc );
+}
+
+template<typename Field>
+void StencilOperator<Field>::Form( SparseMatrix<Field>& A ) const
+{
+    EL_DEBUG_CSE
+    const stencil::Coefficients<Field> coefs =
+      { mainTerm_, xTerm_, xTerm_, yTerm_, yTerm_, zTerm_, zTerm_ };
+    auto coefFunc =
+      [&]( Int, Int, Int, stencil::Coefficients<Field>& rowCoefs )
+      { rowCoefs = coefs; };
+    stencil::Form( A, nx_, ny_, nz_, coefFunc );
+}
+
+template<typename Field>
+void StencilOperator<Field>::Form( DistSparseMatrix<Field>& A ) const
+{
+    EL_DEBUG_CSE
+    const stencil::Coefficients<Field> coefs =
+      { mainTerm_, xTerm_, xTerm_, yTerm_, yTerm_, zTerm_, zTerm_ };
+    auto coefFunc =
+      [&]( Int, Int, Int, stencil::Coefficients<Field>& rowCoefs )
+      { rowCoefs = coefs; };
+    stencil::Form( A, nx_, ny_, nz_, coefFunc );
+}
+
+#define PROTO(Field) \
+  template class StencilOperator<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,209 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_MATRICES_PDE_STENCIL_HPP
+#define EL_MATRICES_PDE_STENCIL_HPP
+
+namespace El {
+namespace stencil {
+
+// The nonzero entries of the row of a (3, 5, or) 7-point finite-difference
+// operator corresponding to a point (x,y,z) of an nx x ny x nz grid, with the
+// points numbered naturally (x varying fastest), e.g., 'xL' is the coupling to
+// (x-1,y,z). One- and two-dimensional grids have unit trailing dimensions.
+template<typename Field>
+struct Coefficients
+{
+    Field main;
+    Field xL, xR, yL, yR, zL, zR;
+};
+
+const Int maxRowEntries = 7;
+
+inline Int NumRowEntries( Int x, Int y, Int z, Int nx, Int ny, Int nz )
+{
+    return 1 + (x != 0) + (x != nx-1) + (y != 0) + (y != ny-1) +
+               (z != 0) + (z != nz-1);
+}
+
+// Emit the entries of row i = x + nx (y + ny z) in increasing column order so
+// that rows may be written directly into the sorted sparse formats
+template<typename Field>
+Int RowEntries
+( Int x, Int y, Int z, Int nx, Int ny, Int nz,
+  const Coefficients<Field>& coefs, Int* cols, Field* vals )
+{
+    const Int i = x + nx*(y + ny*z);
+    Int numEntries = 0;
+    auto push = [&]( Int j, const Field& value )
+      {
+          cols[numEntries] = j;
+          vals[numEntries] = value;
+          ++numEntries;
+      };
+    if( z != 0 )
+        push( i-nx*ny, coefs.zL );
+    if( y != 0 )
+        push( i-nx, coefs.yL );
+    if( x != 0 )
+        push( i-1, coefs.xL );
+    push( i, coefs.main );
+    if( x != nx-1 )
+        push( i+1, coefs.xR );
+    if( y != ny-1 )
+        push( i+nx, coefs.yR );
+    if( z != nz-1 )
+        push( i+nx*ny, coefs.zR );
+    return numEntries;
+}
+
+// Each of the following forms the operator whose row coefficients are
+// produced by coefFunc(x,y,z,coefs), generating the (local) rows in parallel
+
+template<typename Field,class CoefFunc>
+void Form
+( Matrix<Field>& A, Int nx, Int ny, Int nz, const CoefFunc& coefFunc )
+{
+    EL_DEBUG_CSE
+    const Int n = nx*ny*nz;
+    Zeros( A, n, n );
+    Field* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int i=0; i<n; ++i )
+    {
+        Coefficients<Field> coefs;
+        Int cols[maxRowEntries];
+        Field vals[maxRowEntries];
+        const Int x = i % nx;
+        const Int y = (i/nx) % ny;
+        const Int z = i/(nx*ny);
+        coefFunc( x, y, z, coefs );
+        const Int numEntries =
+          RowEntries( x, y, z, nx, ny, nz, coefs, cols, vals );
+        for( Int e=0; e<numEntries; ++e )
+            ABuf[i+cols[e]*ALDim] = vals[e];
+    }
+}
+
+template<typename Field,class CoefFunc>
+void Form
+( AbstractDistMatrix<Field>& A, Int nx, Int ny, Int nz,
+  const CoefFunc& coefFunc )
+{
+    EL_DEBUG_CSE
+    const Int n = nx*ny*nz;
+    Zeros( A, n, n );
+    Field* ALocBuf = A.Buffer();
+    const Int ALocLDim = A.LDim();
+    const Int localHeight = A.LocalHeight();
+    EL_PARALLEL_FOR
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        Coefficients<Field> coefs;
+        Int cols[maxRowEntries];
+        Field vals[maxRowEntries];
+        const Int i = A.GlobalRow(iLoc);
+        const Int x = i % nx;
+        const Int y = (i/nx) % ny;
+        const Int z = i/(nx*ny);
+        coefFunc( x, y, z, coefs );
+        const Int numEntries =
+          RowEntries( x, y, z, nx, ny, nz, coefs, cols, vals );
+        for( Int e=0; e<numEntries; ++e )
+            if( A.IsLocalCol(cols[e]) )
+                ALocBuf[iLoc+A.LocalCol(cols[e])*ALocLDim] = vals[e];
+    }
+}
+
+// The sparse forms size the storage from the grid geometry, fill each row in
+// place, and then only need ProcessQueues to form the row offsets since the
+// entries are already sorted and unique
+template<typename Field,class CoefFunc>
+void Form
+( SparseMatrix<Field>& A, Int nx, Int ny, Int nz,
+  const CoefFunc& coefFunc )
+{
+    EL_DEBUG_CSE
+    const Int n = nx*ny*nz;
+    Zeros( A, n, n );
+    vector<Int> rowOffsets( n+1 );
+    rowOffsets[0] = 0;
+    for( Int i=0; i<n; ++i )
+        rowOffsets[i+1] = rowOffsets[i] +
+          NumRowEntries( i % nx, (i/nx) % ny, i/(nx*ny), nx, ny, nz );
+    A.ForceNumEntries( rowOffsets[n] );
+    Int* sourceBuf = A.SourceBuffer();
+    Int* targetBuf = A.TargetBuffer();
+    Field* valueBuf = A.ValueBuffer();
+    EL_PARALLEL_FOR
+    for( Int i=0; i<n; ++i )
+    {
+        Coefficients<Field> coefs;
+        const Int x = i % nx;
+        const Int y = (i/nx) % ny;
+        const Int z = i/(nx*ny);
+        coefFunc( x, y, z, coefs );
+        const Int offset = rowOffsets[i];
+        const Int numEntries =
+          RowEntries
+          ( x, y, z, nx, ny, nz, coefs,
+            &targetBuf[offset], &valueBuf[offset] );
+        for( Int e=0; e<numEntries; ++e )
+            sourceBuf[offset+e] = i;
+    }
+    A.ProcessQueues();
+}
+
+// Each process generates its rows of the DistMultiVec (and DistMap) ordering
+template<typename Field,class CoefFunc>
+void Form
+( DistSparseMatrix<Field>& A, Int nx, Int ny, Int nz,
+  const CoefFunc& coefFunc )
+{
+    EL_DEBUG_CSE
+    const Int n = nx*ny*nz;
+    Zeros( A, n, n );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    vector<Int> rowOffsets( localHeight+1 );
+    rowOffsets[0] = 0;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalRow + iLoc;
+        rowOffsets[iLoc+1] = rowOffsets[iLoc] +
+          NumRowEntries( i % nx, (i/nx) % ny, i/(nx*ny), nx, ny, nz );
+    }
+    A.ForceNumLocalEntries( rowOffsets[localHeight] );
+    Int* sourceBuf = A.SourceBuffer();
+    Int* targetBuf = A.TargetBuffer();
+    Field* valueBuf = A.ValueBuffer();
+    EL_PARALLEL_FOR
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        Coefficients<Field> coefs;
+        const Int i = firstLocalRow + iLoc;
+        const Int x = i % nx;
+        const Int y = (i/nx) % ny;
+        const Int z = i/(nx*ny);
+        coefFunc( x, y, z, coefs );
+        const Int offset = rowOffsets[iLoc];
+        const Int numEntries =
+          RowEntries
+          ( x, y, z, nx, ny, nz, coefs,
+            &targetBuf[offset], &valueBuf[offset] );
+        for( Int e=0; e<numEntries; ++e )
+            sourceBuf[offset+e] = i;
+    }
+    A.ProcessLocalQueues();
+}
+
+} // namespace stencil
+} // namespace El
+
+#endif // ifndef EL_MATRICES_PDE_STENCIL_HPP
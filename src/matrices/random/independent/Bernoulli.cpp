@@ -21,13 +21,25 @@ void Bernoulli( Matrix<T>& A, Int m, Int n, double p )
         ("Invalid choice of parameter p for Bernoulli distribution: ",p);
     A.Resize( m, n );
     const double q = 1-p;
+    if( CounterBasedRandom() )
+    {
+        const auto stream = NextCounterBasedStream();
+        auto doubleCoin = [=]( Int i, Int j ) -> T
+        {
+            const double alpha = CounterBasedUniforms(stream,i,j)[0];
+            if( alpha <= q ) return T(0);
+            else             return T(1);
+        };
+        IndexDependentFill( A, doubleCoin );
+        return;
+    }
     auto doubleCoin = [=]() -> T
     {
         const double alpha = SampleUniform<double>(0,1);
         if( alpha <= q ) return T(0); 
         else             return T(1);
     };
-    EntrywiseFill( A, function<T()>(doubleCoin) );
+    EntrywiseFill( A, doubleCoin );
 }
 
 template<typename T>
@@ -39,13 +51,25 @@ void Bernoulli( AbstractDistMatrix<T>& A, Int m, Int n, double p )
         ("Invalid choice of parameter p for Bernoulli distribution: ",p);
     A.Resize( m, n );
     const double q = 1-p;
+    if( CounterBasedRandom() )
+    {
+        const auto stream = NextCounterBasedStream();
+        auto doubleCoin = [=]( Int i, Int j ) -> T
+        {
+            const double alpha = CounterBasedUniforms(stream,i,j)[0];
+            if( alpha <= q ) return T(0);
+            else             return T(1);
+        };
+        IndexDependentFill( A, doubleCoin );
+        return;
+    }
     auto doubleCoin = [=]() -> T
     {
         const double alpha = SampleUniform<double>(0,1);
         if( alpha <= q ) return T(0); 
         else             return T(1);
     };
-    EntrywiseFill( A, function<T()>(doubleCoin) );
+    EntrywiseFill( A, doubleCoin );
 }
 
 #define PROTO(T) \
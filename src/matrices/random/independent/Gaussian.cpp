@@ -17,14 +17,31 @@ template<typename F>
 void MakeGaussian( Matrix<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    if( CounterBasedRandom() )
+    {
+        const auto stream = NextCounterBasedStream();
+        auto sampleNormal = [=]( Int i, Int j )
+          { return CounterBasedNormal( stream, i, j, mean, stddev ); };
+        IndexDependentFill( A, sampleNormal );
+        return;
+    }
     auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
-    EntrywiseFill( A, function<F()>(sampleNormal) );
+    EntrywiseFill( A, sampleNormal );
 }
 
 template<typename F>
 void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    if( CounterBasedRandom() )
+    {
+        // Every process draws its own entries by their global indices
+        const auto stream = NextCounterBasedStream();
+        auto sampleNormal = [=]( Int i, Int j )
+          { return CounterBasedNormal( stream, i, j, mean, stddev ); };
+        IndexDependentFill( A, sampleNormal );
+        return;
+    }
     if( A.RedundantRank() == 0 )
         MakeGaussian( A.Matrix(), mean, stddev );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -17,6 +17,19 @@ void ThreeValued( Matrix<T>& A, Int m, Int n, double p )
 {
     EL_DEBUG_CSE
     A.Resize( m, n );
+    if( CounterBasedRandom() )
+    {
+        const auto stream = NextCounterBasedStream();
+        auto tripleCoin = [=]( Int i, Int j ) -> T
+        {
+            const double alpha = CounterBasedUniforms(stream,i,j)[0];
+            if( alpha <= p/2 ) return T(-1);
+            else if( alpha <= p ) return T(1);
+            else return T(0);
+        };
+        IndexDependentFill( A, tripleCoin );
+        return;
+    }
     auto tripleCoin = [=]() -> T
     { 
         const double alpha = SampleUniform<double>(0,1);
@@ -24,7 +37,7 @@ void ThreeValued( Matrix<T>& A, Int m, Int n, double p )
         else if( alpha <= p ) return T(1);
         else return T(0);
     };
-    EntrywiseFill( A, function<T()>(tripleCoin) );
+    EntrywiseFill( A, tripleCoin );
 }
 
 template<typename T>
@@ -32,6 +45,20 @@ void ThreeValued( AbstractDistMatrix<T>& A, Int m, Int n, double p )
 {
     EL_DEBUG_CSE
     A.Resize( m, n );
+    if( CounterBasedRandom() )
+    {
+        // Every process draws its own entries by their global indices
+        const auto stream = NextCounterBasedStream();
+        auto tripleCoin = [=]( Int i, Int j ) -> T
+        {
+            const double alpha = CounterBasedUniforms(stream,i,j)[0];
+            if( alpha <= p/2 ) return T(-1);
+            else if( alpha <= p ) return T(1);
+            else return T(0);
+        };
+        IndexDependentFill( A, tripleCoin );
+        return;
+    }
     if( A.RedundantRank() == 0 )
         ThreeValued( A.Matrix(), A.LocalHeight(), A.LocalWidth(), p );
     Broadcast( A, A.RedundantComm(), 0 );
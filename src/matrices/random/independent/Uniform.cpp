@@ -18,8 +18,16 @@ template<typename T>
 void MakeUniform( Matrix<T>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    if( CounterBasedRandom() )
+    {
+        const auto stream = NextCounterBasedStream();
+        auto sampleBall = [=]( Int i, Int j )
+          { return CounterBasedBall( stream, i, j, center, radius ); };
+        IndexDependentFill( A, sampleBall );
+        return;
+    }
     auto sampleBall = [=]() { return SampleBall(center,radius); };
-    EntrywiseFill( A, function<T()>(sampleBall) );
+    EntrywiseFill( A, sampleBall );
 }
 
 template<typename T>
@@ -34,6 +42,15 @@ template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    if( CounterBasedRandom() )
+    {
+        // Every process draws its own entries by their global indices
+        const auto stream = NextCounterBasedStream();
+        auto sampleBall = [=]( Int i, Int j )
+          { return CounterBasedBall( stream, i, j, center, radius ); };
+        IndexDependentFill( A, sampleBall );
+        return;
+    }
     if( A.RedundantRank() == 0 )
         MakeUniform( A.Matrix(), center, radius );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -47,6 +64,31 @@ void Uniform( AbstractDistMatrix<T>& A, Int m, Int n, T center, Base<T> radius )
     MakeUniform( A, center, radius );
 }
 
+template<typename T>
+void MakeUniform( DistMultiVec<T>& A, T center, Base<T> radius )
+{
+    EL_DEBUG_CSE
+    if( CounterBasedRandom() )
+    {
+        const auto stream = NextCounterBasedStream();
+        const Int firstLocalRow = A.FirstLocalRow();
+        auto sampleBall = [=]( Int iLoc, Int j )
+          { return CounterBasedBall
+                   ( stream, firstLocalRow+iLoc, j, center, radius ); };
+        IndexDependentFill( A.Matrix(), sampleBall );
+        return;
+    }
+    MakeUniform( A.Matrix(), center, radius );
+}
+
+template<typename T>
+void Uniform( DistMultiVec<T>& A, Int m, Int n, T center, Base<T> radius )
+{
+    EL_DEBUG_CSE
+    A.Resize( m, n );
+    MakeUniform( A, center, radius );
+}
+
 
 #define PROTO(T) \
   template void MakeUniform \
@@ -56,7 +98,11 @@ void Uniform( AbstractDistMatrix<T>& A, Int m, Int n, T center, Base<T> radius )
   template void Uniform \
   ( Matrix<T>& A, Int m, Int n, T center, Base<T> radius ); \
   template void Uniform \
-  ( AbstractDistMatrix<T>& A, Int m, Int n, T center, Base<T> radius );
+  ( AbstractDistMatrix<T>& A, Int m, Int n, T center, Base<T> radius ); \
+  template void MakeUniform \
+  ( DistMultiVec<T>& A, T center, Base<T> radius ); \
+  template void Uniform \
+  ( DistMultiVec<T>& A, Int m, Int n, T center, Base<T> radius );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -0,0 +1,142 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
+  const string& msg )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(msg,": sizes differ");
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A_STAR_STAR.GetLocal(i,j) != B_STAR_STAR.GetLocal(i,j) )
+                LogicError(msg,": entry (",i,",",j,") differs");
+}
+
+template<typename T>
+void TestComposite( Int m, Int n, Int k, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    typedef Base<T> Real;
+
+    // The Hamiltonian-like composite | A, L; 0, B | with a zero block
+    DistMatrix<T> A(g), L(g), B(g);
+    DistMatrix<T,VC,STAR> L_VC_STAR(g);
+    Uniform( A, m, m );
+    Uniform( L, m, n );
+    Uniform( B, n, n );
+    L_VC_STAR = L;
+    CompositeMatrix<T> W( 2, 2 );
+    W.SetBlock( 0, 0, A );
+    W.SetBlock( 0, 1, L_VC_STAR );
+    W.SetBlock( 1, 1, B );
+
+    DistMatrix<T> WFull(g), WTop(g), WBottom(g), Z(g);
+    Zeros( Z, n, m );
+    HCat( A, L, WTop );
+    HCat( Z, B, WBottom );
+    VCat( WTop, WBottom, WFull );
+
+    DistMatrix<T,MR,MC> W_MR_MC(g);
+    Copy( W, W_MR_MC );
+    CheckEqual( W_MR_MC, WFull, "Copy of a composite" );
+
+    // Products with the composite on either side, in each orientation
+    const Real eps = limits::Epsilon<Real>();
+    for( auto orientA : { NORMAL, TRANSPOSE, ADJOINT } )
+    {
+        for( auto orientB : { NORMAL, ADJOINT } )
+        {
+            DistMatrix<T> X(g), C(g), CRef(g);
+            if( orientB == NORMAL )
+                Uniform( X, m+n, k );
+            else
+                Uniform( X, k, m+n );
+            Uniform( C, m+n, k );
+            CRef = C;
+            Gemm( orientA, orientB, T(2), W, X, T(-1), C );
+            Gemm( orientA, orientB, T(2), WFull, X, T(-1), CRef );
+            C -= CRef;
+            const Real errLeft = FrobeniusNorm( C ) / FrobeniusNorm( CRef );
+
+            DistMatrix<T> Y(g), D(g), DRef(g);
+            if( orientA == NORMAL )
+                Uniform( Y, k, m+n );
+            else
+                Uniform( Y, m+n, k );
+            Uniform( D, k, m+n );
+            DRef = D;
+            Gemm( orientA, orientB, T(2), Y, W, T(-1), D );
+            Gemm( orientA, orientB, T(2), Y, WFull, T(-1), DRef );
+            D -= DRef;
+            const Real errRight = FrobeniusNorm( D ) / FrobeniusNorm( DRef );
+            OutputFromRoot
+            (g.Comm(),"Gemm",OrientationToChar(orientA),
+             OrientationToChar(orientB),": composite on the left ",errLeft,
+             ", on the right ",errRight);
+            if( errLeft > 10*(m+n)*eps || errRight > 10*(m+n)*eps )
+                LogicError("Composite Gemm was inaccurate");
+        }
+    }
+
+    // Reshape through the direct exchange (elemental distributions) and
+    // through the queues (block distributions)
+    Matrix<T> WSeq, WReshapedSeq;
+    {
+        DistMatrix<T,STAR,STAR> W_STAR_STAR( WFull );
+        WSeq = W_STAR_STAR.Matrix();
+    }
+    const Int mNew = (m+n)/2;
+    const Int nNew = 2*(m+n);
+    Reshape( mNew, nNew, WSeq, WReshapedSeq );
+    DistMatrix<T,STAR,STAR> WReshapedRef(g);
+    WReshapedRef.Resize( mNew, nNew );
+    WReshapedRef.Matrix() = WReshapedSeq;
+
+    DistMatrix<T,VC,STAR> WReshaped_VC_STAR(g);
+    Reshape( mNew, nNew, WFull, WReshaped_VC_STAR );
+    CheckEqual( WReshaped_VC_STAR, WReshapedRef, "Reshape to [VC,* ]" );
+    DistMatrix<T,STAR,STAR> W_STAR_STAR( W_MR_MC );
+    DistMatrix<T> WReshaped(g);
+    Reshape( mNew, nNew, W_STAR_STAR, WReshaped );
+    CheckEqual( WReshaped, WReshapedRef, "Reshape from [* ,* ]" );
+    DistMatrix<T,MC,MR,BLOCK> W_BLOCK( WFull ), WReshaped_BLOCK(g);
+    Reshape( mNew, nNew, W_BLOCK, WReshaped_BLOCK );
+    CheckEqual( WReshaped_BLOCK, WReshapedRef, "Block Reshape" );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of the leading block",37);
+        const Int n = Input("--n","height of the trailing block",23);
+        const Int k = Input("--k","number of columns of the operand",11);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestComposite<float>( m, n, k, g );
+        TestComposite<Complex<double>>( m, n, k, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Use integer-valued entries so that the sums are exact
+template<typename T>
+T TestEntry( Int i, Int j ) { return T((i+2*j)%7 - 3); }
+
+template<typename T>
+void FillEntries( ElementalMatrix<T>& A )
+{
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            A.SetLocal
+            ( iLoc, jLoc, TestEntry<T>(A.GlobalRow(iLoc),A.GlobalCol(jLoc)) );
+}
+
+// Each entry of A is replicated over the processes which contribute to the
+// corresponding entry of B, so that B(i,j) should be 'numCopies' times it
+template<typename T>
+void CheckEntries
+( const ElementalMatrix<T>& B, T scale, const string& label )
+{
+    bool equal = true;
+    for( Int jLoc=0; jLoc<B.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+            if( B.GetLocal(iLoc,jLoc) !=
+                scale*TestEntry<T>(B.GlobalRow(iLoc),B.GlobalCol(jLoc)) )
+                equal = false;
+    if( !mpi::AllReduce( int(equal), mpi::MIN, B.Grid().Comm() ) )
+        LogicError(label," produced the wrong sums");
+}
+
+template<typename T,Dist U,Dist V,Dist UGath,Dist VGath>
+void TestContraction( const Grid& g, Int m, Int n, const string& label )
+{
+    DistMatrix<T,UGath,VGath> A(g);
+    A.Resize( m, n );
+    FillEntries( A );
+    DistMatrix<T,U,V> B(g);
+    const T numCopies = T(B.DistSize()/A.DistSize());
+
+    Contract( A, B );
+    CheckEntries( B, numCopies, label+" Contract" );
+
+    // B := B + 2 A contracted
+    AxpyContract( T(2), A, B );
+    CheckEntries( B, T(3)*numCopies, label+" AxpyContract" );
+}
+
+template<typename T>
+void TestContractions( const Grid& g, Int m, Int n )
+{
+    TestContraction<T,MC,MR,STAR,MR>( g, m, n, "[* ,MR] -> [MC,MR]" );
+    TestContraction<T,MC,MR,MC,STAR>( g, m, n, "[MC,* ] -> [MC,MR]" );
+    TestContraction<T,MC,MR,STAR,STAR>( g, m, n, "[* ,* ] -> [MC,MR]" );
+    TestContraction<T,VC,STAR,MC,STAR>( g, m, n, "[MC,* ] -> [VC,* ]" );
+    TestContraction<T,STAR,VR,STAR,MR>( g, m, n, "[* ,MR] -> [* ,VR]" );
+    // A single column is reduced to the owning process row
+    TestContraction<T,MC,MR,MC,STAR>( g, m, 1, "[MC,* ] -> [MC,MR] vector" );
+}
+
+template<typename T>
+void TestAllSettings( const Grid& g, Int m, Int n, Int segmentSize )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    const PipelineCtrl defaultCtrl = ContractPipelineCtrl();
+    PipelineCtrl ctrl;
+    ctrl.segmentSize = segmentSize;
+    for( auto alg : { mpi::REDUCE_SCATTER_NATIVE,
+                      mpi::REDUCE_SCATTER_RECURSIVE_HALVING } )
+    {
+        mpi::SetReduceScatterAlgorithm( alg );
+        SetContractPipelineCtrl( defaultCtrl );
+        TestContractions<T>( g, m, n );
+        SetContractPipelineCtrl( ctrl );
+        TestContractions<T>( g, m, n );
+    }
+    mpi::SetReduceScatterAlgorithm( mpi::REDUCE_SCATTER_NATIVE );
+    SetContractPipelineCtrl( defaultCtrl );
+    OutputFromRoot(g.Comm(),"PASSED");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--m","height",77);
+        const Int n = Input("--n","width",41);
+        const Int segmentSize =
+          Input("--segmentSize","entries per pipelined chunk",50);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, gridHeight, order );
+
+        TestAllSettings<double>( g, m, n, segmentSize );
+        TestAllSettings<Complex<double>>( g, m, n, segmentSize );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T,Dist U,Dist V>
+void CheckEqual
+( const ElementalMatrix<T>& A, const DistMatrix<T,U,V>& B,
+  const std::string& msg )
+{
+    DistMatrix<T,U,V> E( A );
+    E -= B;
+    const Base<T> errNorm = FrobeniusNorm( E );
+    if( errNorm != Base<T>(0) )
+        LogicError(msg," was incorrect: || E ||_F = ",errNorm);
+}
+
+template<typename T>
+void TestCopyAsync( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+
+    // Start several redistributions before completing any of them
+    DistMatrix<T,MC,STAR> A_MC_STAR(g);
+    DistMatrix<T,STAR,MR> A_STAR_MR(g);
+    DistMatrix<T,VC,STAR> A_VC_STAR(g);
+    auto futureMC = CopyAsync( A, A_MC_STAR );
+    auto futureMR = CopyAsync( A, A_STAR_MR );
+    auto futureVC = CopyAsync( A, A_VC_STAR );
+    futureVC.Wait();
+    while( !futureMR.Test() ) { }
+    futureMC.Wait();
+    if( futureMC.Pending() || futureMR.Pending() || futureVC.Pending() )
+        LogicError("Redistributions were still pending");
+    CheckEqual( A, A_MC_STAR, "[MC,* ] <- [MC,MR]" );
+    CheckEqual( A, A_STAR_MR, "[* ,MR] <- [MC,MR]" );
+    CheckEqual( A, A_VC_STAR, "[VC,* ] <- [MC,MR]" );
+
+    // Unsupported redistributions should complete immediately
+    DistMatrix<T,MR,MC> A_MR_MC(g);
+    auto futureTrans = CopyAsync( A, A_MR_MC );
+    if( futureTrans.Pending() )
+        LogicError("Blocking fallback was left pending");
+    CheckEqual( A, A_MR_MC, "[MR,MC] <- [MC,MR]" );
+
+    // Contractions should sum over the redundant copies
+    DistMatrix<T,MC,MR> B(g), BRef(g);
+    auto futureRow = ContractAsync( A_MC_STAR, B );
+    futureRow.Wait();
+    Contract( A_MC_STAR, BRef );
+    CheckEqual( BRef, B, "[MC,MR] <- [MC,* ] contraction" );
+
+    auto futureCol = ContractAsync( A_STAR_MR, B );
+    futureCol.Wait();
+    Contract( A_STAR_MR, BRef );
+    CheckEqual( BRef, B, "[MC,MR] <- [* ,MR] contraction" );
+    OutputFromRoot(g.Comm(),"PASSED");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",100);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, gridHeight, order );
+        ComplainIfDebug();
+
+        TestCopyAsync<float>( m, n, g );
+        TestCopyAsync<Complex<float>>( m, n, g );
+        TestCopyAsync<double>( m, n, g );
+        TestCopyAsync<Complex<double>>( m, n, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
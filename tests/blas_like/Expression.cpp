@@ -0,0 +1,103 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare C := alpha A + beta (B .* D) - E, formed via a single fused
+// expression, against the composition of Axpy and Hadamard
+template<typename T>
+void TestSequential( Int m, Int n )
+{
+    Matrix<T> A, B, D, E;
+    Uniform( A, m, n );
+    Uniform( B, m, n );
+    Uniform( D, m, n );
+    Uniform( E, m, n );
+    const T alpha = T(2), beta = T(-3);
+
+    Matrix<T> C;
+    expr::Evaluate
+    ( alpha*expr::Lazy(A) + beta*Hadamard(expr::Lazy(B),expr::Lazy(D)) -
+      expr::Lazy(E), C );
+
+    Matrix<T> CRef;
+    Hadamard( B, D, CRef );
+    CRef *= beta;
+    Axpy( alpha, A, CRef );
+    CRef -= E;
+    CRef -= C;
+    const Base<T> error = FrobeniusNorm( CRef );
+    if( error > 10*m*n*limits::Epsilon<Base<T>>() )
+        LogicError("Sequential expression had error ",error);
+
+    // The target may also be an operand
+    Matrix<T> CCopy( C );
+    expr::Evaluate
+    ( expr::Map( expr::Lazy(C), []( const T& chi ) { return chi*chi; } )
+      - expr::Lazy(C), C );
+    Hadamard( CCopy, CCopy, CRef );
+    CRef -= CCopy;
+    CRef -= C;
+    if( FrobeniusNorm( CRef ) > 10*m*n*limits::Epsilon<Base<T>>() )
+        LogicError("Sequential in-place expression was incorrect");
+}
+
+template<typename T>
+void TestDistributed( Int m, Int n, const Grid& g )
+{
+    DistMatrix<T> A(g), C(g);
+    DistMatrix<T,VC,STAR> B(g);
+    DistMatrix<T,STAR,STAR> D(g);
+    Uniform( A, m, n );
+    Uniform( B, m, n );
+    Uniform( D, m, n );
+    const T alpha = T(2), beta = T(-3);
+
+    // B and D are each redistributed once despite being used twice
+    expr::Evaluate
+    ( alpha*expr::Lazy(A) + beta*Hadamard(expr::Lazy(B),expr::Lazy(D)) +
+      expr::Lazy(B) - expr::Lazy(D), C );
+
+    DistMatrix<T> BElem( B ), DElem( D ), CRef(g);
+    Hadamard( BElem, DElem, CRef );
+    CRef *= beta;
+    Axpy( alpha, A, CRef );
+    CRef += BElem;
+    CRef -= DElem;
+    CRef -= C;
+    const Base<T> error = FrobeniusNorm( CRef );
+    if( error > 10*m*n*limits::Epsilon<Base<T>>() )
+        LogicError("Distributed expression had error ",error);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height",100);
+        const Int n = Input("--n","width",80);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestSequential<float>( m, n );
+        TestSequential<double>( m, n );
+        TestSequential<Complex<double>>( m, n );
+        TestDistributed<double>( m, n, g );
+        TestDistributed<Complex<double>>( m, n, g );
+        OutputFromRoot(comm,"Expressions were correct");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
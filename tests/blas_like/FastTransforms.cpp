@@ -0,0 +1,92 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the fast Fourier transform of the columns of a distributed matrix,
+// and its adjoint, against multiplication by the explicit Fourier matrix
+template<typename Real>
+void TestFourier( Int n, Int numCols, const Grid& g )
+{
+    typedef Complex<Real> C;
+    OutputFromRoot(g.Comm(),"Testing FFT of order ",n," with ",TypeName<C>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+    DistMatrix<C> F(g), X(g), Y(g), YExpl(g);
+    Fourier( F, n );
+    Uniform( X, n, numCols );
+    for( const bool adjoint : { false, true } )
+    {
+        Y = X;
+        ApplyFourier( Y, adjoint );
+        Gemm( adjoint ? ADJOINT : NORMAL, NORMAL, C(1), F, X, YExpl );
+        const Real frobExpl = FrobeniusNorm( YExpl );
+        YExpl -= Y;
+        const Real relError = FrobeniusNorm( YExpl ) / frobExpl;
+        OutputFromRoot
+        (g.Comm(),(adjoint ? "Adjoint" : "Forward")," relative error: ",
+         relError);
+        if( relError > Real(10)*Log(Real(n))*eps )
+            LogicError("Fast Fourier transform was inaccurate");
+    }
+    PopIndent();
+}
+
+template<typename T>
+void TestWalsh( Int k, Int numCols, const Grid& g )
+{
+    const Int n = Int(1) << k;
+    OutputFromRoot
+    (g.Comm(),"Testing FWHT of order ",n," with ",TypeName<T>());
+    PushIndent();
+    DistMatrix<T> W(g), X(g), Y(g), YExpl(g);
+    Walsh( W, k );
+    Uniform( X, n, numCols );
+    Y = X;
+    ApplyWalsh( Y );
+    Gemm( NORMAL, NORMAL, T(1), W, X, YExpl );
+    const Base<T> frobExpl = FrobeniusNorm( YExpl );
+    YExpl -= Y;
+    const Base<T> relError = FrobeniusNorm( YExpl ) / frobExpl;
+    OutputFromRoot(g.Comm(),"Relative error: ",relError);
+    if( relError > Base<T>(10)*k*limits::Epsilon<Base<T>>() )
+        LogicError("Fast Walsh-Hadamard transform was inaccurate");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int k = Input("--k","log2 of the power-of-two order",7);
+        const Int n = Input("--n","order of a general FFT",100);
+        const Int numCols = Input("--numCols","number of columns",10);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestFourier<float>( Int(1) << k, numCols, g );
+        TestFourier<float>( n, numCols, g );
+        TestFourier<double>( Int(1) << k, numCols, g );
+        TestFourier<double>( n, numCols, g );
+#ifdef HYDROGEN_HAVE_QUADMATH
+        TestFourier<Quad>( n, numCols, g );
+#endif
+        TestWalsh<float>( k, numCols, g );
+        TestWalsh<double>( k, numCols, g );
+        TestWalsh<Complex<double>>( k, numCols, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
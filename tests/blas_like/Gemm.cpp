@@ -143,6 +143,36 @@ void TestGemm
         ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
     PopIndent();
 
+    // Test the look-ahead variants which overlap communication and compute
+    // as well as the variants which replicate over layers of processes
+    const GemmAlgorithm extraAlgs[] =
+      { GEMM_SUMMA_A_PIPELINED, GEMM_SUMMA_B_PIPELINED,
+        GEMM_SUMMA_C_PIPELINED, GEMM_25D, GEMM_3D, GEMM_DEFAULT };
+    const char* extraNames[] =
+      { "Pipelined stationary A", "Pipelined stationary B",
+        "Pipelined stationary C", "2.5D", "3D", "Cost-model selected" };
+    for( Int alg=0; alg<6; ++alg )
+    {
+        C = COrig;
+        OutputFromRoot(g.Comm(),extraNames[alg]," algorithm:");
+        PushIndent();
+        mpi::Barrier( g.Comm() );
+        timer.Start();
+        Gemm( orientA, orientB, alpha, A, B, beta, C, extraAlgs[alg] );
+        mpi::Barrier( g.Comm() );
+        runTime = timer.Stop();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+        OutputFromRoot
+        (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+        if( print )
+            Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+        if( correctness )
+            TestAssociativity
+            ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+        PopIndent();
+    }
+
     if( orientA == NORMAL && orientB == NORMAL )
     {
         // Test the variant of Gemm for panel-panel dot products
@@ -192,16 +222,60 @@ main( int argc, char* argv[] )
         const Int rowAlignA = Input("--rowAlignA","row align of A",0);
         const Int rowAlignB = Input("--rowAlignB","row align of B",0);
         const Int rowAlignC = Input("--rowAlignC","row align of C",0);
+        const bool calibrate =
+          Input("--calibrate","calibrate the Gemm cost model?",true);
+        const bool topologyAware =
+          Input("--topologyAware","pack process columns onto nodes?",false);
+        const bool strassen =
+          Input("--strassen","use Strassen-Winograd for local Gemm?",false);
+        const Int strassenCutoff =
+          Input("--strassenCutoff","Strassen-Winograd leaf size",64);
+        const bool ozaki =
+          Input("--ozaki","emulate extended-precision local Gemm?",false);
         ProcessInput();
         PrintInputReport();
 
-        if( gridHeight == 0 )
+        if( gridHeight == 0 && !topologyAware )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
-        const Grid g( comm, gridHeight, order );
+        GridTopologyCtrl topologyCtrl;
+        topologyCtrl.height = gridHeight;
+        std::unique_ptr<Grid> gridPtr
+        ( topologyAware ?
+          new Grid( comm, topologyCtrl, order ) :
+          new Grid( comm, gridHeight, order ) );
+        const Grid& g = *gridPtr;
+        OutputFromRoot
+        (comm,"Using a ",g.Height()," x ",g.Width()," process grid");
         const Orientation orientA = CharToOrientation( transA );
         const Orientation orientB = CharToOrientation( transB );
         SetBlocksize( nb );
+        if( calibrate )
+            CalibrateGemmCostModel( g );
+        if( strassen )
+        {
+            SetLocalGemmAlgorithm( LOCAL_GEMM_STRASSEN );
+            SetStrassenCutoff<float>( strassenCutoff );
+            SetStrassenCutoff<double>( strassenCutoff );
+            SetStrassenCutoff<Complex<float>>( strassenCutoff );
+            SetStrassenCutoff<Complex<double>>( strassenCutoff );
+#ifdef EL_HAVE_QD
+            SetStrassenCutoff<DoubleDouble>( strassenCutoff );
+            SetStrassenCutoff<QuadDouble>( strassenCutoff );
+            SetStrassenCutoff<Complex<DoubleDouble>>( strassenCutoff );
+            SetStrassenCutoff<Complex<QuadDouble>>( strassenCutoff );
+#endif
+#ifdef EL_HAVE_QUAD
+            SetStrassenCutoff<Quad>( strassenCutoff );
+            SetStrassenCutoff<Complex<Quad>>( strassenCutoff );
+#endif
+#ifdef EL_HAVE_MPC
+            SetStrassenCutoff<BigFloat>( strassenCutoff );
+            SetStrassenCutoff<Complex<BigFloat>>( strassenCutoff );
+#endif
+        }
+        else if( ozaki )
+            SetLocalGemmAlgorithm( LOCAL_GEMM_OZAKI );
 
         ComplainIfDebug();
         OutputFromRoot(comm,"Will test Gemm",transA,transB);
@@ -0,0 +1,117 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void CheckError
+( const DistMatrix<Field>& C, const DistMatrix<Field>& CRef,
+  const string& label )
+{
+    typedef Base<Field> Real;
+    DistMatrix<Field> E( CRef );
+    E -= C;
+    const Real error = FrobeniusNorm( E );
+    const Real tol =
+      100*C.Height()*limits::Epsilon<Real>()*Max(FrobeniusNorm(CRef),Real(1));
+    OutputFromRoot(C.Grid().Comm(),"  ",label," error: ",error);
+    if( error > tol )
+        LogicError(label," error of ",error," exceeded ",tol);
+}
+
+template<typename Field>
+void TestGramAccumulator( Int m, Int n, Int blocksize, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    typedef Base<Field> Real;
+
+    DistMatrix<Field> A(g);
+    Uniform( A, m, n, Field(1), Real(1) );
+
+    // The reference Gramian and covariance
+    DistMatrix<Field> GRef(g), CovRef(g);
+    Herk( LOWER, ADJOINT, Real(1), A, GRef );
+    MakeHermitian( LOWER, GRef );
+    DistMatrix<Field> ACenter( A ), ones(g);
+    DistMatrix<Field,STAR,STAR> means(g);
+    Ones( ones, m, 1 );
+    Gemv( ADJOINT, Field(1)/Field(m), A, ones, means );
+    for( Int j=0; j<n; ++j )
+    {
+        auto aCenter = ACenter( ALL, IR(j) );
+        Shift( aCenter, -Conj(means.Get(j,0)) );
+    }
+    Herk( LOWER, ADJOINT, Real(1)/Real(m-1), ACenter, CovRef );
+    MakeHermitian( LOWER, CovRef );
+
+    // Stream [VC,STAR] row blocks, querying midway through the pass
+    GramAccumulator<Field> accumulator( n, g );
+    DistMatrix<Field> G(g), Cov(g);
+    DistMatrix<Field,VC,STAR> ABlock(g);
+    for( Int i=0; i<m; i+=blocksize )
+    {
+        const Int nb = Min(blocksize,m-i);
+        ABlock = A( IR(i,i+nb), ALL );
+        accumulator.Update( ABlock );
+        if( i == 0 )
+            accumulator.Gramian( G );
+    }
+    if( accumulator.NumRows() != m )
+        LogicError("Accumulated ",accumulator.NumRows()," rows instead of ",m);
+    accumulator.Gramian( G );
+    CheckError( G, GRef, "[VC,STAR] Gramian" );
+    accumulator.Covariance( Cov );
+    CheckError( Cov, CovRef, "[VC,STAR] covariance" );
+
+    // A second pass where each process owns entire row blocks
+    accumulator.Reset();
+    DistMatrix<Field,STAR,STAR> A_STAR_STAR( A );
+    const int commRank = mpi::Rank( g.Comm() );
+    const int commSize = mpi::Size( g.Comm() );
+    for( Int i=0, block=0; i<m; i+=blocksize, ++block )
+    {
+        if( block % commSize != commRank )
+            continue;
+        const Int nb = Min(blocksize,m-i);
+        accumulator.Update( A_STAR_STAR.LockedMatrix()( IR(i,i+nb), ALL ) );
+    }
+    accumulator.Gramian( G );
+    CheckError( G, GRef, "Local Gramian" );
+
+    Matrix<Field> colMeans;
+    accumulator.ColumnMeans( colMeans );
+    for( Int j=0; j<n; ++j )
+        if( Abs(colMeans(j)-Conj(means.GetLocal(j,0))) >
+            10*m*limits::Epsilon<Real>() )
+            LogicError("Column mean ",j," was incorrect");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height",300);
+        const Int n = Input("--n","width",40);
+        const Int blocksize = Input("--blocksize","rows per block",37);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestGramAccumulator<float>( m, n, blocksize, g );
+        TestGramAccumulator<double>( m, n, blocksize, g );
+        TestGramAccumulator<Complex<double>>( m, n, blocksize, g );
+        OutputFromRoot(comm,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
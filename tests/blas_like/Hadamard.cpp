@@ -46,6 +46,45 @@ void TestHadamard(Int m, Int n, const Grid& g, bool print)
   }
 }
 
+template <typename T, DistWrap W>
+void TestHermitianHadamard(Int n, const Grid& g)
+{
+  DistMatrix<T, MC, MR, W> A(g), B(g);
+  Uniform(A, n, n);
+  Uniform(B, n, n);
+  const T sentinel = T(7);
+  for (UpperOrLower uplo : {LOWER, UPPER})
+  {
+    // Only the 'uplo' triangle should be formed (or mapped).
+    DistMatrix<T, MC, MR, W> C(g), D(A);
+    C.AlignWith(A);
+    C.Resize(n, n);
+    Fill(C, sentinel);
+    HermitianHadamard(uplo, A, B, C);
+    HermitianEntrywiseMap
+    (uplo, D, function<T(const T&)>([](const T& alpha) { return T(2)*alpha; }));
+    for (Int jLoc = 0; jLoc < A.LocalWidth(); ++jLoc)
+    {
+      const Int j = A.GlobalCol(jLoc);
+      for (Int iLoc = 0; iLoc < A.LocalHeight(); ++iLoc)
+      {
+        const Int i = A.GlobalRow(iLoc);
+        const bool inTriangle = (uplo == LOWER ? i >= j : i <= j);
+        const T alpha = A.GetLocal(iLoc, jLoc);
+        const T expected =
+          inTriangle ? alpha * B.GetLocal(iLoc, jLoc) : sentinel;
+        const T expectedMap = inTriangle ? T(2)*alpha : alpha;
+        if (Abs(C.GetLocal(iLoc, jLoc) - expected) >
+            10 * limits::Epsilon<El::Base<T>>())
+          RuntimeError("HermitianHadamard was incorrect at (", i, ",", j, ")");
+        if (D.GetLocal(iLoc, jLoc) != expectedMap)
+          RuntimeError
+          ("HermitianEntrywiseMap was incorrect at (", i, ",", j, ")");
+      }
+    }
+  }
+}
+
 int main(int argc, char** argv)
 {
   Environment env(argc, argv);
@@ -68,6 +107,10 @@ int main(int argc, char** argv)
     TestHadamard<double, BLOCK>(m, n, g, print);
     TestHadamard<Complex<double>, ELEMENT>(m, n, g, print);
     TestHadamard<Complex<double>, BLOCK>(m, n, g, print);
+    OutputFromRoot(comm, "Testing HermitianHadamard");
+    TestHermitianHadamard<double, ELEMENT>(m, g);
+    TestHermitianHadamard<double, BLOCK>(m, g);
+    TestHermitianHadamard<Complex<double>, ELEMENT>(m, g);
 #if defined(EL_HAVE_QD)
     TestHadamard<DoubleDouble, ELEMENT>(m, n, g, print);
     TestHadamard<DoubleDouble, BLOCK>(m, n, g, print);
@@ -0,0 +1,136 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+T TestEntry( Int i, Int j ) { return T(i) - T(3*j) + T(1)/T(i+j+1); }
+
+template<typename T>
+void CheckEntries
+( const string& name, const AbstractDistMatrix<T>& A, const Grid& g )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    const Matrix<T>& ALoc = A_STAR_STAR.Matrix();
+    Int numWrong = 0;
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( ALoc(i,j) != TestEntry<T>(i,j) )
+                ++numWrong;
+    if( numWrong != 0 )
+        LogicError(name," produced ",numWrong," incorrect entries");
+}
+
+template<typename T>
+void TestFills( AbstractDistMatrix<T>& A, Int m, Int n, const Grid& g )
+{
+    auto entry = []( Int i, Int j ) { return TestEntry<T>(i,j); };
+    auto column = []( Int j, Int iBeg, Int iStride, Int count, T* buf )
+      {
+          for( Int k=0; k<count; ++k )
+              buf[k] = TestEntry<T>(iBeg+k*iStride,j);
+      };
+    auto map = []( Int i, Int j, const T& alpha )
+      { return alpha + TestEntry<T>(i,j); };
+
+    Zeros( A, m, n );
+    IndexDependentFill( A, function<T(Int,Int)>(entry) );
+    CheckEntries( "IndexDependentFill with a std::function", A, g );
+
+    Zeros( A, m, n );
+    IndexDependentFill( A, entry );
+    CheckEntries( "IndexDependentFill with a lambda", A, g );
+
+    Zeros( A, m, n );
+    IndexDependentColumnFill( A, column );
+    CheckEntries( "IndexDependentColumnFill", A, g );
+
+    Zeros( A, m, n );
+    IndexDependentMap( A, map );
+    CheckEntries( "IndexDependentMap with a lambda", A, g );
+}
+
+template<typename T>
+void TestIndexDependentFill( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+
+    // Check the sequential fills, including the chunked column-vector case
+    for( const Int width : { n, Int(1) } )
+    {
+        Matrix<T> A;
+        Zeros( A, m, width );
+        IndexDependentColumnFill
+        ( A, [&]( Int j, Int iBeg, Int iStride, Int count, T* buf )
+             {
+                 for( Int k=0; k<count; ++k )
+                     buf[k] = TestEntry<T>(iBeg+k*iStride,j);
+             } );
+        for( Int j=0; j<width; ++j )
+            for( Int i=0; i<m; ++i )
+                if( A(i,j) != TestEntry<T>(i,j) )
+                    LogicError("Sequential IndexDependentColumnFill failed");
+    }
+
+    for( const Int width : { n, Int(1) } )
+    {
+        DistMatrix<T> A(g);
+        TestFills( A, m, width, g );
+        DistMatrix<T,VC,STAR> A_VC_STAR(g);
+        TestFills( A_VC_STAR, m, width, g );
+        DistMatrix<T,STAR,VR> A_STAR_VR(g);
+        TestFills( A_STAR_VR, m, width, g );
+        DistMatrix<T,MC,MR,BLOCK> ABlock(g);
+        TestFills( ABlock, m, width, g );
+    }
+
+    // Compare the cost of the std::function and inlined fills
+    Matrix<T> A;
+    Zeros( A, m, n );
+    auto entry = []( Int i, Int j ) { return TestEntry<T>(i,j); };
+    Timer timer;
+    timer.Start();
+    IndexDependentFill( A, function<T(Int,Int)>(entry) );
+    const double functionTime = timer.Stop();
+    timer.Start();
+    IndexDependentFill( A, entry );
+    const double inlineTime = timer.Stop();
+    OutputFromRoot
+    (g.Comm(),"std::function fill: ",functionTime," seconds, inlined fill: ",
+     inlineTime," seconds");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",2100);
+        const Int n = Input("--n","width of matrix",57);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestIndexDependentFill<float>( m, n, g );
+        TestIndexDependentFill<Complex<float>>( m, n, g );
+        TestIndexDependentFill<double>( m, n, g );
+        TestIndexDependentFill<Complex<double>>( m, n, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,182 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Every process holds a copy of the sequential matrices
+template<typename F,class DistType>
+void Scatter( const Grid& g, const Matrix<F>& X, DistType& XDist )
+{
+    DistMatrix<F,STAR,STAR> X_STAR_STAR(g);
+    X_STAR_STAR.LockedAttach( g, X );
+    Copy( X_STAR_STAR, XDist );
+}
+
+template<typename F>
+void Gather( const DistMultiVec<F>& XDist, Matrix<F>& X )
+{
+    DistMatrix<F,STAR,STAR> X_STAR_STAR( XDist.Grid() );
+    Copy( XDist, X_STAR_STAR );
+    X = X_STAR_STAR.Matrix();
+}
+
+template<typename F>
+void TestKronecker
+( Orientation orientation, Int mA, Int nA, Int mB, Int nB, Int numRHS,
+  const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const bool normal = ( orientation == NORMAL );
+    const Int m = mA*mB;
+    const Int n = nA*nB;
+
+    // Compare the implicit operator against the explicit Kronecker product
+    Matrix<F> A, B, C, X, Y, YExpl;
+    Uniform( A, mA, nA );
+    Uniform( B, mB, nB );
+    Kronecker( A, B, C );
+    Uniform( X, (normal ? n : m), numRHS );
+    Uniform( Y, (normal ? m : n), numRHS );
+    YExpl = Y;
+    KroneckerOperator<F> K( A, B );
+    Multiply( orientation, F(2), K, X, F(-1), Y );
+    Gemm( orientation, NORMAL, F(2), C, X, F(-1), YExpl );
+    const Real frobExpl = FrobeniusNorm( YExpl );
+    YExpl -= Y;
+    const Real errSeq = FrobeniusNorm( YExpl ) / frobExpl;
+    OutputFromRoot(g.Comm(),"Sequential relative error: ",errSeq);
+    if( errSeq > Real(100)*Max(m,n)*eps )
+        LogicError("Sequential Kronecker multiply was inaccurate");
+
+    DistMatrix<F> ADist(g), BDist(g);
+    DistMultiVec<F> XDist(g), YDist(g);
+    Scatter( g, A, ADist );
+    Scatter( g, B, BDist );
+    Scatter( g, X, XDist );
+    Uniform( YDist, (normal ? m : n), numRHS );
+    Matrix<F> YSeq;
+    Gather( YDist, YSeq );
+    DistKroneckerOperator<F> KDist( ADist, BDist );
+    Multiply( orientation, F(2), KDist, XDist, F(-1), YDist );
+    Multiply( orientation, F(2), K, X, F(-1), YSeq );
+    Matrix<F> YGath;
+    Gather( YDist, YGath );
+    YGath -= YSeq;
+    const Real errDist = FrobeniusNorm( YGath ) / FrobeniusNorm( YSeq );
+    OutputFromRoot(g.Comm(),"Distributed relative error: ",errDist);
+    if( errDist > Real(100)*Max(m,n)*eps )
+        LogicError("Distributed Kronecker multiply was inaccurate");
+
+    // Solve against square, well-conditioned factors, both directly and with
+    // FGMRES
+    Matrix<F> AS, BS;
+    Uniform( AS, mA, mA );
+    Uniform( BS, mB, mB );
+    ShiftDiagonal( AS, F(mA) );
+    ShiftDiagonal( BS, F(mB) );
+    KroneckerOperator<F> KS( AS, BS );
+    Matrix<F> XSol, BRHS;
+    Uniform( XSol, m, numRHS );
+    Zeros( BRHS, m, numRHS );
+    KS( F(1), XSol, F(0), BRHS );
+    const Real frobSol = FrobeniusNorm( XSol );
+
+    Matrix<F> XDirect( BRHS );
+    LinearSolve( KS, XDirect );
+    XDirect -= XSol;
+    const Real errSolve = FrobeniusNorm( XDirect ) / frobSol;
+    OutputFromRoot(g.Comm(),"Direct solve relative error: ",errSolve);
+    if( errSolve > Real(1000)*m*eps )
+        LogicError("Kronecker LinearSolve was inaccurate");
+
+    DistMatrix<F> ASDist(g), BSDist(g);
+    Scatter( g, AS, ASDist );
+    Scatter( g, BS, BSDist );
+    DistKroneckerOperator<F> KSDist( ASDist, BSDist );
+    DistMultiVec<F> XDistSol(g);
+    Scatter( g, BRHS, XDistSol );
+    LinearSolve( KSDist, XDistSol );
+    Matrix<F> XDistGath;
+    Gather( XDistSol, XDistGath );
+    XDistGath -= XSol;
+    const Real errDistSolve = FrobeniusNorm( XDistGath ) / frobSol;
+    OutputFromRoot
+    (g.Comm(),"Distributed direct solve relative error: ",errDistSolve);
+    if( errDistSolve > Real(1000)*m*eps )
+        LogicError("Distributed Kronecker LinearSolve was inaccurate");
+
+    auto identity = []( Matrix<F>& ) { };
+    Matrix<F> XKrylov( BRHS );
+    const Real relTol = Pow( eps, Real(0.75) );
+    FGMRES( KS, identity, XKrylov, relTol, 50, 500, false );
+    XKrylov -= XSol;
+    const Real errKrylov = FrobeniusNorm( XKrylov ) / frobSol;
+    OutputFromRoot(g.Comm(),"FGMRES relative error: ",errKrylov);
+    if( errKrylov > Real(100)*relTol )
+        LogicError("FGMRES on a KroneckerOperator did not converge");
+
+    // || A \otimes B ||_2 = || A ||_2 || B ||_2 is estimated through the
+    // generic LinearOperator interface (including adjoint applications)
+    const Real twoNorm = TwoNorm( A )*TwoNorm( B );
+    const LinearOperator<F>& KOp = K;
+    const LinearOperator<F>& KDistOp = KDist;
+    const Real estTol = Pow( eps, Real(0.5) );
+    const Real est = TwoNormEstimate( KOp, estTol, 10000 );
+    const Real estDist = TwoNormEstimate( KDistOp, estTol, 10000 );
+    OutputFromRoot
+    (g.Comm(),"Two-norm: ",twoNorm,", estimates: ",est,", ",estDist);
+    // Power iteration approaches the two-norm from below
+    const Real upperBound = twoNorm*(1+estTol);
+    if( est > upperBound || est < twoNorm/2 ||
+        estDist > upperBound || estDist < twoNorm/2 )
+        LogicError("Two-norm estimates of the operator were inaccurate");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const char transChar = Input
+            ("--trans","orientation of the operator: N/T/C",'N');
+        const Int mA = Input("--mA","height of A",12);
+        const Int nA = Input("--nA","width of A",9);
+        const Int mB = Input("--mB","height of B",7);
+        const Int nB = Input("--nB","width of B",11);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid g( comm, gridHeight );
+        const Orientation orientation = CharToOrientation( transChar );
+        ComplainIfDebug();
+
+        TestKronecker<float>( orientation, mA, nA, mB, nB, numRHS, g );
+        TestKronecker<Complex<float>>
+        ( orientation, mA, nA, mB, nB, numRHS, g );
+
+        TestKronecker<double>( orientation, mA, nA, mB, nB, numRHS, g );
+        TestKronecker<Complex<double>>
+        ( orientation, mA, nA, mB, nB, numRHS, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
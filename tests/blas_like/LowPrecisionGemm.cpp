@@ -0,0 +1,161 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The unit roundoff of each sixteen-bit format
+template<typename T> float UnitRoundoff();
+template<> float UnitRoundoff<Half>() { return std::ldexp(1.f,-11); }
+template<> float UnitRoundoff<BFloat16>() { return std::ldexp(1.f,-8); }
+
+template<typename T>
+void TestConversions( Int numSamples )
+{
+    Output("Testing conversions to ",TypeName<T>());
+    PushIndent();
+    const float u = UnitRoundoff<T>();
+    Matrix<float> X;
+    Uniform( X, numSamples, 1, 0.f, 100.f );
+    for( Int i=0; i<numSamples; ++i )
+    {
+        const float alpha = X(i);
+        const T alphaLow( alpha );
+        if( Abs(float(alphaLow)-alpha) > u*Abs(alpha) )
+            LogicError("Rounding ",alpha," to ",TypeName<T>()," gave ",
+                       float(alphaLow));
+        if( T(float(alphaLow)).Bits() != alphaLow.Bits() )
+            LogicError("Widening and rounding was not the identity");
+    }
+    if( float(T(0.f)) != 0.f || float(T(-1.f)) != -1.f ||
+        float(T(0.5f)) != 0.5f )
+        LogicError("Small powers of two were not exactly represented");
+    PopIndent();
+}
+
+template<typename T>
+void TestGemm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, const Grid& g, bool print )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing ",TypeName<T>()," Gemm",OrientationToChar(orientA),
+     OrientationToChar(orientB));
+    PushIndent();
+    const float alpha = 2.f, beta = -1.f;
+
+    DistMatrix<float> AF(g), BF(g), C(g);
+    if( orientA == NORMAL )
+        Uniform( AF, m, k );
+    else
+        Uniform( AF, k, m );
+    if( orientB == NORMAL )
+        Uniform( BF, k, n );
+    else
+        Uniform( BF, n, k );
+    Uniform( C, m, n );
+
+    // Round the inputs and check that a round trip through another
+    // distribution preserves them exactly
+    DistMatrix<T> A(g), B(g);
+    Copy( AF, A );
+    Copy( BF, B );
+    DistMatrix<T,VR,STAR> A_VR_STAR( A );
+    DistMatrix<T> ACopy( A_VR_STAR );
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            if( A.GetLocal(iLoc,jLoc).Bits() !=
+                ACopy.GetLocal(iLoc,jLoc).Bits() )
+                LogicError("Redistribution changed an entry");
+    Copy( A, AF );
+    Copy( B, BF );
+
+    // The reference product of the rounded inputs in single precision
+    DistMatrix<float> CRef( C );
+    Gemm( orientA, orientB, alpha, AF, BF, beta, CRef );
+
+    Timer timer;
+    timer.Start();
+    Gemm( orientA, orientB, alpha, A, B, beta, C );
+    OutputFromRoot(g.Comm(),"Mixed-precision Gemm: ",timer.Stop()," seconds");
+    if( print )
+    {
+        Print( C, "C" );
+        Print( CRef, "CRef" );
+    }
+
+    const float CRefFrob = FrobeniusNorm( CRef );
+    C -= CRef;
+    const float relError = FrobeniusNorm( C ) / CRefFrob;
+    OutputFromRoot(g.Comm(),"|| C - CRef ||_F / || CRef ||_F = ",relError);
+    if( relError > k*limits::Epsilon<float>() )
+        LogicError("Relative error was unacceptably high");
+
+    // The sequential interface on the local portion of a [STAR,STAR] copy
+    if( g.Rank() == 0 )
+    {
+        DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+        DistMatrix<float,STAR,STAR> CRef_STAR_STAR( CRef );
+        Matrix<float> CSeq;
+        Zeros( CSeq, m, n );
+        Gemm
+        ( orientA, orientB, alpha,
+          A_STAR_STAR.LockedMatrix(), B_STAR_STAR.LockedMatrix(),
+          0.f, CSeq );
+        Matrix<float> ARef, BRef, CSeqRef;
+        Copy( A_STAR_STAR.LockedMatrix(), ARef );
+        Copy( B_STAR_STAR.LockedMatrix(), BRef );
+        Zeros( CSeqRef, m, n );
+        Gemm( orientA, orientB, alpha, ARef, BRef, 0.f, CSeqRef );
+        CSeq -= CSeqRef;
+        const float seqError =
+          FrobeniusNorm( CSeq ) / Max(FrobeniusNorm(CSeqRef),1.f);
+        Output("Sequential relative error = ",seqError);
+        if( seqError > k*limits::Epsilon<float>() )
+            LogicError("Sequential relative error was unacceptably high");
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of C",100);
+        const Int n = Input("--n","width of C",80);
+        const Int k = Input("--k","inner dimension",150);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        const Grid g( comm );
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestConversions<Half>( 1000 );
+            TestConversions<BFloat16>( 1000 );
+        }
+        for( auto orientA : { NORMAL, TRANSPOSE } )
+        {
+            for( auto orientB : { NORMAL, TRANSPOSE } )
+            {
+                TestGemm<Half>( orientA, orientB, m, n, k, g, print );
+                TestGemm<BFloat16>( orientA, orientB, m, n, k, g, print );
+            }
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
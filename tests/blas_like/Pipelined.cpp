@@ -0,0 +1,101 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual
+( const Matrix<T>& A, const Matrix<T>& B, mpi::Comm comm,
+  const string& label )
+{
+    bool equal = true;
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A(i,j) != B(i,j) )
+                equal = false;
+    if( !mpi::AllReduce( int(equal), mpi::MIN, comm ) )
+        LogicError(label," did not reproduce the matrix");
+    OutputFromRoot(comm,"  ",label," passed");
+}
+
+template<typename T>
+void TestPipelined( Int m, Int n, Int segmentSize, mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing with ",TypeName<T>());
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    PipelineCtrl ctrl;
+    ctrl.segmentSize = segmentSize;
+
+    // Pass a (non-contiguous) view of each process's matrix around a ring
+    Matrix<T> A, B, AFull, BFull;
+    Uniform( AFull, m+3, n );
+    Zeros( BFull, m+2, n );
+    auto AView = AFull( IR(1,m+1), ALL );
+    auto BView = BFull( IR(0,m), ALL );
+    const int next = Mod( commRank+1, commSize );
+    const int prev = Mod( commRank-1, commSize );
+    auto future = SendRecvAsync( AView, BView, comm, next, prev, ctrl );
+    future.Wait();
+    if( future.Pending() )
+        LogicError("The transfer was still pending after Wait");
+    Matrix<T> BRef( m, n );
+    SendRecv( AView, BRef, comm, next, prev );
+    CheckEqual( BView, BRef, comm, "SendRecvAsync" );
+
+    // Contiguous sends and receives, completed through Test
+    A = AView;
+    B.Resize( m, n );
+    Zero( B );
+    auto recvFuture = RecvAsync( B, comm, prev, ctrl );
+    auto sendFuture = SendAsync( A, comm, next, ctrl );
+    while( !recvFuture.Test() ) { }
+    sendFuture.Wait();
+    CheckEqual( B, BRef, comm, "SendAsync/RecvAsync" );
+
+    // Chain broadcasts from the last process
+    const int root = commSize-1;
+    Matrix<T> C, CRef;
+    Uniform( C, m, n );
+    CRef = C;
+    Broadcast( CRef, comm, root );
+    PipelinedBroadcast( C, comm, root, ctrl );
+    CheckEqual( C, CRef, comm, "PipelinedBroadcast" );
+
+    Matrix<T> DFull;
+    Uniform( DFull, m+1, n );
+    auto D = DFull( IR(1,m+1), ALL );
+    Matrix<T> DRef( D );
+    Broadcast( DRef, comm, root );
+    PipelinedBroadcast( D, comm, root, ctrl );
+    CheckEqual( D, DRef, comm, "Non-contiguous PipelinedBroadcast" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height",100);
+        const Int n = Input("--n","width",30);
+        const Int segmentSize = Input("--segmentSize","entries per message",37);
+        ProcessInput();
+        PrintInputReport();
+
+        TestPipelined<float>( m, n, segmentSize, comm );
+        TestPipelined<double>( m, n, segmentSize, comm );
+        TestPipelined<Complex<double>>( m, n, segmentSize, comm );
+        OutputFromRoot(comm,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual
+( const DistMatrix<T>& A, const DistMatrix<T>& B, const string& label )
+{
+    DistMatrix<T> E( A );
+    E -= B;
+    const Base<T> error = MaxNorm( E );
+    OutputFromRoot(A.Grid().Comm(),"  ",label," error: ",error);
+    if( error != Base<T>(0) )
+        LogicError(label," error of ",error," was nonzero");
+}
+
+// Regrid A into B and back onto the grid of A
+template<typename T,Dist U,Dist V>
+void TestRegrid
+( const DistMatrix<T>& A, const Grid& grid, const string& gridName )
+{
+    DistMatrix<T,U,V> B(grid);
+    Regrid( A, B );
+    DistMatrix<T> C(A.Grid());
+    Regrid( B, C );
+    CheckEqual
+    ( A, C, "["+DistToString(U)+","+DistToString(V)+"] on "+gridName );
+}
+
+template<typename T>
+void TestRegrids
+( Int m, Int n,
+  const Grid& grid, const Grid& subgrid, const Grid& flatGrid )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<T>());
+    DistMatrix<T> A(grid);
+    Uniform( A, m, n );
+
+    TestRegrid<T,MC,MR>( A, grid, "the same grid" );
+    TestRegrid<T,MR,MC>( A, grid, "the same grid" );
+    TestRegrid<T,MC,MR>( A, subgrid, "a subgrid" );
+    TestRegrid<T,STAR,STAR>( A, subgrid, "a subgrid" );
+    TestRegrid<T,VC,STAR>( A, flatGrid, "a 1 x p grid" );
+    TestRegrid<T,MD,STAR>( A, flatGrid, "a 1 x p grid" );
+    TestRegrid<T,STAR,MR>( A, flatGrid, "a 1 x p grid" );
+
+    // Shrink onto the subgrid, reshape, and grow back in-place
+    DistMatrix<T> B( A );
+    Regrid( B, subgrid );
+    if( &B.Grid() != &subgrid )
+        LogicError("In-place regrid did not change the grid");
+    Regrid( B, flatGrid );
+    Regrid( B, grid );
+    CheckEqual( A, B, "In-place" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",75);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+
+        // A subgrid over the first half of the processes
+        const int subgridSize = Max(commSize/2,1);
+        vector<int> subgridRanks(subgridSize);
+        for( int q=0; q<subgridSize; ++q )
+            subgridRanks[q] = q;
+        mpi::Group group, subgroup;
+        mpi::CommGroup( comm, group );
+        mpi::Incl( group, subgridSize, subgridRanks.data(), subgroup );
+
+        const Grid grid( comm );
+        const Grid subgrid( comm, subgroup, Grid::DefaultHeight(subgridSize) );
+        const Grid flatGrid( comm, 1 );
+
+        TestRegrids<double>( m, n, grid, subgrid, flatGrid );
+        TestRegrids<Complex<float>>( m, n, grid, subgrid, flatGrid );
+
+        mpi::Free( subgroup );
+        mpi::Free( group );
+        OutputFromRoot(comm,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
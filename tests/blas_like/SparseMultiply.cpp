@@ -0,0 +1,158 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void Gather( const DistMultiVec<F>& XDist, Matrix<F>& X )
+{
+    DistMatrix<F,STAR,STAR> X_STAR_STAR( XDist.Grid() );
+    Copy( XDist, X_STAR_STAR );
+    X = X_STAR_STAR.Matrix();
+}
+
+template<typename F>
+void Scatter( const Matrix<F>& X, DistMultiVec<F>& XDist )
+{
+    XDist.Resize( X.Height(), X.Width() );
+    for( Int iLoc=0; iLoc<XDist.LocalHeight(); ++iLoc )
+        for( Int j=0; j<X.Width(); ++j )
+            XDist.Matrix()(iLoc,j) = X(XDist.GlobalRow(iLoc),j);
+}
+
+template<typename F>
+void Densify( const DistSparseMatrix<F>& A, Matrix<F>& B )
+{
+    Zeros( B, A.Height(), A.Width() );
+    for( Int e=0; e<A.NumLocalEntries(); ++e )
+        B(A.Row(e),A.Col(e)) += A.Value(e);
+    mpi::AllReduce( B.Buffer(), B.Height()*B.Width(), A.Grid().Comm() );
+}
+
+// Compare the distributed product against a dense product with the
+// densified matrix
+template<typename F>
+void CheckProduct
+( Orientation orientation, const DistSparseMatrix<F>& A, Int numRHS )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Real eps = limits::Epsilon<Real>();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int XHeight = ( orientation == NORMAL ? n : m );
+    const Int YHeight = ( orientation == NORMAL ? m : n );
+
+    Matrix<F> ADense;
+    Densify( A, ADense );
+
+    // Generate the same right-hand sides on every process
+    Matrix<F> X, Y;
+    Zeros( X, XHeight, numRHS );
+    Zeros( Y, YHeight, numRHS );
+    if( g.Rank() == 0 )
+    {
+        Uniform( X, XHeight, numRHS );
+        Uniform( Y, YHeight, numRHS );
+    }
+    Broadcast( X, g.Comm(), 0 );
+    Broadcast( Y, g.Comm(), 0 );
+
+    DistMultiVec<F> XDist(g), YDist(g);
+    Scatter( X, XDist );
+    Scatter( Y, YDist );
+    const F alpha = F(2), beta = F(-1);
+    Multiply( orientation, alpha, A, XDist, beta, YDist );
+    Gemm( orientation, NORMAL, alpha, ADense, X, beta, Y );
+
+    Matrix<F> YGath;
+    Gather( YDist, YGath );
+    const Real YFrob = FrobeniusNorm( Y );
+    YGath -= Y;
+    const Real relErr = FrobeniusNorm( YGath ) / YFrob;
+    OutputFromRoot
+    (g.Comm(),OrientationToChar(orientation)," product with ",numRHS,
+     " right-hand sides: relative error ",relErr);
+    if( relErr > Real(100)*eps )
+        LogicError("Distributed sparse product was inaccurate");
+}
+
+template<typename F>
+void TestSparseMultiply( Int nx, Int ny, Int numRHS, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    DistSparseMatrix<F> A(g);
+    Laplacian( A, nx, ny );
+    for( auto orientation : { NORMAL, TRANSPOSE, ADJOINT } )
+    {
+        CheckProduct( orientation, A, 1 );
+        CheckProduct( orientation, A, numRHS );
+    }
+
+    // Modifying the sparsity pattern must invalidate the halo plan, so
+    // couple each row to a distant column on (typically) another process
+    const Int n = A.Height();
+    A.Reserve( A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow( iLoc );
+        A.QueueLocalUpdate( iLoc, (i+n/2) % n, F(i+1) );
+    }
+    A.ProcessLocalQueues();
+    for( auto orientation : { NORMAL, ADJOINT } )
+        CheckProduct( orientation, A, numRHS );
+
+    // A rectangular matrix has a different column distribution than its
+    // row distribution
+    DistSparseMatrix<F> B(g);
+    const Int width = 2*n+1;
+    B.Resize( n, width );
+    B.Reserve( 3*B.LocalHeight() );
+    for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+    {
+        const Int i = B.GlobalRow( iLoc );
+        B.QueueLocalUpdate( iLoc, i, F(1) );
+        B.QueueLocalUpdate( iLoc, (2*i+1) % width, F(-2) );
+        B.QueueLocalUpdate( iLoc, width-1-i, F(3) );
+    }
+    B.ProcessLocalQueues();
+    for( auto orientation : { NORMAL, ADJOINT } )
+        CheckProduct( orientation, B, numRHS );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int nx = Input("--nx","size of x dimension",13);
+        const Int ny = Input("--ny","size of y dimension",11);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",4);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestSparseMultiply<float>( nx, ny, numRHS, g );
+        TestSparseMultiply<Complex<float>>( nx, ny, numRHS, g );
+        TestSparseMultiply<double>( nx, ny, numRHS, g );
+        TestSparseMultiply<Complex<double>>( nx, ny, numRHS, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Real>
+void CheckMerged
+( const DistMatrix<Real>& CReal,
+  const DistMatrix<Real>& CImag,
+  const DistMatrix<Complex<Real>>& C,
+  const string& label )
+{
+    DistMatrix<Complex<Real>> E(C.Grid());
+    MergeComplex( CReal, CImag, E );
+    E -= C;
+    const Real error = MaxNorm( E );
+    const Real tol = 10*limits::Epsilon<Real>()*Max(MaxNorm(C),Real(1));
+    OutputFromRoot(C.Grid().Comm(),"  ",label," error: ",error);
+    if( error > tol )
+        LogicError(label," error of ",error," exceeded ",tol);
+}
+
+template<typename Real>
+void TestSplitComplex( Int m, Int n, const Grid& g, bool print )
+{
+    typedef Complex<Real> C;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Real>());
+
+    DistMatrix<C> A(g), B(g);
+    Uniform( A, m, n );
+    Uniform( B, m, n );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( B, "B" );
+    }
+
+    DistMatrix<Real> AReal(g), AImag(g), BReal(g), BImag(g);
+    SplitComplex( A, AReal, AImag );
+    SplitComplex( B, BReal, BImag );
+    CheckMerged( AReal, AImag, A, "Split/merge" );
+
+    // The real and imaginary parts should match RealPart and ImagPart
+    DistMatrix<Real> ARealPart(g);
+    RealPart( A, ARealPart );
+    ARealPart -= AReal;
+    if( MaxNorm(ARealPart) != Real(0) )
+        LogicError("SplitComplex did not reproduce RealPart");
+
+    DistMatrix<C> CInter(g);
+    DistMatrix<Real> CReal(g), CImag(g);
+    Hadamard( A, B, CInter );
+    Hadamard( AReal, AImag, BReal, BImag, CReal, CImag );
+    CheckMerged( CReal, CImag, CInter, "Hadamard" );
+
+    const C alpha( Real(2), Real(-3) );
+    CInter = B;
+    Axpy( alpha, A, CInter );
+    CReal = BReal;
+    CImag = BImag;
+    Axpy( alpha, AReal, AImag, CReal, CImag );
+    CheckMerged( CReal, CImag, CInter, "Axpy" );
+
+    const C innerProd = HilbertSchmidt( A, B );
+    const C splitInnerProd = HilbertSchmidt( AReal, AImag, BReal, BImag );
+    const Real innerProdError = Abs(innerProd-splitInnerProd);
+    const Real innerProdTol =
+      10*m*n*limits::Epsilon<Real>()*FrobeniusNorm(A)*FrobeniusNorm(B);
+    OutputFromRoot
+    (g.Comm(),"  HilbertSchmidt error: ",innerProdError);
+    if( innerProdError > innerProdTol )
+        LogicError
+        ("HilbertSchmidt error of ",innerProdError," exceeded ",
+         innerProdTol);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height",100);
+        const Int n = Input("--n","width",100);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestSplitComplex<float>( m, n, g, print );
+        TestSplitComplex<double>( m, n, g, print );
+#ifdef EL_HAVE_QD
+        TestSplitComplex<DoubleDouble>( m, n, g, print );
+        TestSplitComplex<QuadDouble>( m, n, g, print );
+#endif
+#ifdef EL_HAVE_QUAD
+        TestSplitComplex<Quad>( m, n, g, print );
+#endif
+#ifdef EL_HAVE_MPC
+        TestSplitComplex<BigFloat>( m, n, g, print );
+#endif
+        OutputFromRoot(comm,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,226 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void Gather( const DistMultiVec<F>& XDist, Matrix<F>& X )
+{
+    DistMatrix<F,STAR,STAR> X_STAR_STAR( XDist.Grid() );
+    Copy( XDist, X_STAR_STAR );
+    X = X_STAR_STAR.Matrix();
+}
+
+template<typename F>
+void Scatter( const Matrix<F>& X, DistMultiVec<F>& XDist )
+{
+    XDist.Resize( X.Height(), X.Width() );
+    for( Int iLoc=0; iLoc<XDist.LocalHeight(); ++iLoc )
+        for( Int j=0; j<X.Width(); ++j )
+            XDist.Matrix()(iLoc,j) = X(XDist.GlobalRow(iLoc),j);
+}
+
+// Densify a sparse matrix so that it may be compared entrywise
+template<typename F>
+void Densify( const SparseMatrix<F>& A, Matrix<F>& B )
+{
+    Zeros( B, A.Height(), A.Width() );
+    for( Int e=0; e<A.NumEntries(); ++e )
+        B(A.Row(e),A.Col(e)) += A.Value(e);
+}
+
+template<typename F>
+void Densify( const DistSparseMatrix<F>& A, Matrix<F>& B )
+{
+    Zeros( B, A.Height(), A.Width() );
+    for( Int e=0; e<A.NumLocalEntries(); ++e )
+        B(A.Row(e),A.Col(e)) += A.Value(e);
+    mpi::AllReduce( B.Buffer(), B.Height()*B.Width(), A.Grid().Comm() );
+}
+
+template<typename F>
+void CheckForms
+( const string& name, const Grid& g, const Matrix<F>& A,
+  const SparseMatrix<F>& ASparse, const DistMatrix<F>& ADist,
+  const DistSparseMatrix<F>& ADistSparse )
+{
+    typedef Base<F> Real;
+    Matrix<F> E;
+    Densify( ASparse, E );
+    E -= A;
+    Real err = FrobeniusNorm( E );
+    Densify( ADistSparse, E );
+    E -= A;
+    err += FrobeniusNorm( E );
+    DistMatrix<F,STAR,STAR> ADist_STAR_STAR( ADist );
+    E = ADist_STAR_STAR.Matrix();
+    E -= A;
+    err += FrobeniusNorm( E );
+    OutputFromRoot(g.Comm(),name," formation discrepancy: ",err);
+    if( err != Real(0) )
+        LogicError("The forms of the ",name," operator differed");
+}
+
+template<typename F>
+void TestStencil
+( Orientation orientation, Int nx, Int ny, Int nz, Int numRHS,
+  const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const F shift = F(10);
+
+    // Exercise one, two, and three-dimensional stencils
+    vector<StencilOperator<F>> ops;
+    ops.push_back( HelmholtzOperator( nx*ny*nz, shift ) );
+    ops.push_back( HelmholtzOperator( nx*ny, nz, shift ) );
+    ops.push_back( HelmholtzOperator( nx, ny, nz, shift ) );
+    ops.push_back( LaplacianOperator<F>( nx, ny, nz ) );
+    for( auto& op : ops )
+    {
+        op.SetGrid( g );
+        const Int n = op.Height();
+
+        Matrix<F> A;
+        SparseMatrix<F> ASparse;
+        DistMatrix<F> ADist(g);
+        DistSparseMatrix<F> ADistSparse(g);
+        op.Form( A );
+        op.Form( ASparse );
+        op.Form( ADist );
+        op.Form( ADistSparse );
+        CheckForms( "stencil", g, A, ASparse, ADist, ADistSparse );
+
+        // Compare the matrix-free applications against the explicit matrix
+        Matrix<F> X, Y, YExpl;
+        Uniform( X, n, numRHS );
+        Uniform( Y, n, numRHS );
+        YExpl = Y;
+        op.Apply( orientation, F(2), X, F(-1), Y );
+        Gemm( orientation, NORMAL, F(2), A, X, F(-1), YExpl );
+        const Real frobExpl = FrobeniusNorm( YExpl );
+        YExpl -= Y;
+        const Real errSeq = FrobeniusNorm( YExpl ) / frobExpl;
+        OutputFromRoot(g.Comm(),"Sequential relative error: ",errSeq);
+        if( errSeq > Real(100)*eps )
+            LogicError("Sequential stencil application was inaccurate");
+
+        DistMultiVec<F> XDist(g), YDist(g);
+        Scatter( X, XDist );
+        Uniform( YDist, n, numRHS );
+        Matrix<F> YSeq;
+        Gather( YDist, YSeq );
+        op.Apply( orientation, F(2), XDist, F(-1), YDist );
+        op.Apply( orientation, F(2), X, F(-1), YSeq );
+        Matrix<F> YGath;
+        Gather( YDist, YGath );
+        YGath -= YSeq;
+        const Real errDist = FrobeniusNorm( YGath );
+        OutputFromRoot(g.Comm(),"Distributed discrepancy: ",errDist);
+        if( errDist != Real(0) )
+            LogicError("Distributed stencil application differed");
+    }
+
+    // The Helmholtz operator with zero shift is HPD, and so CG applies
+    auto op = HelmholtzOperator( nx, ny, nz, F(0) );
+    op.SetGrid( g );
+    const Int n = op.Height();
+    Matrix<F> XSol, B;
+    Uniform( XSol, n, 1 );
+    op( XSol, B );
+    DistMultiVec<F> BDist(g);
+    Scatter( B, BDist );
+    auto identity = []( DistMultiVec<F>& ) { };
+    const Real relTol = Pow( eps, Real(0.5) );
+    CG( op, identity, BDist, relTol, 10*n, false );
+    Matrix<F> XCG;
+    Gather( BDist, XCG );
+    XCG -= XSol;
+    const Real errCG = FrobeniusNorm( XCG ) / FrobeniusNorm( XSol );
+    OutputFromRoot(g.Comm(),"Distributed CG relative error: ",errCG);
+    if( errCG > Real(1000)*relTol )
+        LogicError("CG on a distributed stencil did not converge");
+
+    PopIndent();
+}
+
+template<typename Real>
+void TestPML( Int nx, Int ny, Int nz, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing PML with ",TypeName<Real>());
+    PushIndent();
+    typedef Complex<Real> C;
+    const C omega( Real(20), Real(0) );
+    Matrix<C> A;
+    SparseMatrix<C> ASparse;
+    DistMatrix<C> ADist(g);
+    DistSparseMatrix<C> ADistSparse(g);
+
+    HelmholtzPML( A, nx*ny*nz, omega );
+    HelmholtzPML( ASparse, nx*ny*nz, omega );
+    HelmholtzPML( ADist, nx*ny*nz, omega );
+    HelmholtzPML( ADistSparse, nx*ny*nz, omega );
+    CheckForms( "1D PML", g, A, ASparse, ADist, ADistSparse );
+
+    HelmholtzPML( A, nx*ny, nz, omega );
+    HelmholtzPML( ASparse, nx*ny, nz, omega );
+    HelmholtzPML( ADist, nx*ny, nz, omega );
+    HelmholtzPML( ADistSparse, nx*ny, nz, omega );
+    CheckForms( "2D PML", g, A, ASparse, ADist, ADistSparse );
+
+    HelmholtzPML( A, nx, ny, nz, omega );
+    HelmholtzPML( ASparse, nx, ny, nz, omega );
+    HelmholtzPML( ADist, nx, ny, nz, omega );
+    HelmholtzPML( ADistSparse, nx, ny, nz, omega );
+    CheckForms( "3D PML", g, A, ASparse, ADist, ADistSparse );
+
+    // The operator is complex symmetric
+    Matrix<C> ATrans;
+    Transpose( A, ATrans );
+    ATrans -= A;
+    if( FrobeniusNorm( ATrans ) != Real(0) )
+        LogicError("The 3D PML operator was not complex symmetric");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const char transChar = Input
+            ("--trans","orientation of the operator: N/T/C",'N');
+        const Int nx = Input("--nx","size of x dimension",7);
+        const Int ny = Input("--ny","size of y dimension",5);
+        const Int nz = Input("--nz","size of z dimension",4);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        const Orientation orientation = CharToOrientation( transChar );
+        ComplainIfDebug();
+
+        TestStencil<float>( orientation, nx, ny, nz, numRHS, g );
+        TestStencil<Complex<float>>( orientation, nx, ny, nz, numRHS, g );
+        TestStencil<double>( orientation, nx, ny, nz, numRHS, g );
+        TestStencil<Complex<double>>( orientation, nx, ny, nz, numRHS, g );
+
+        TestPML<float>( nx, ny, nz, g );
+        TestPML<double>( nx, ny, nz, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
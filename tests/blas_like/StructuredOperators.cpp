@@ -0,0 +1,178 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+vector<F> RandomVector( Int n )
+{
+    vector<F> a( n );
+    for( Int k=0; k<n; ++k )
+        a[k] = SampleUniform<F>();
+    return a;
+}
+
+template<typename F>
+void Gather( const DistMultiVec<F>& XDist, Matrix<F>& X )
+{
+    DistMatrix<F,STAR,STAR> X_STAR_STAR( XDist.Grid() );
+    Copy( XDist, X_STAR_STAR );
+    X = X_STAR_STAR.Matrix();
+}
+
+// Compare the fast sequential and distributed applications of an operator
+// against the explicit matrix
+template<typename F>
+void TestOperator
+( const string& name, Orientation orientation,
+  const LinearOperator<F>& op, const LinearOperator<F>& opDist,
+  const Matrix<F>& A, Int numRHS, const Grid& g )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const bool normal = ( orientation == NORMAL );
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    Matrix<F> X, Y, YExpl;
+    Uniform( X, (normal ? n : m), numRHS );
+    Uniform( Y, (normal ? m : n), numRHS );
+    YExpl = Y;
+    op.Apply( orientation, F(2), X, F(-1), Y );
+    Gemm( orientation, NORMAL, F(2), A, X, F(-1), YExpl );
+    const Real frobExpl = FrobeniusNorm( YExpl );
+    YExpl -= Y;
+    const Real errSeq = FrobeniusNorm( YExpl ) / frobExpl;
+    OutputFromRoot(g.Comm(),name," sequential relative error: ",errSeq);
+    if( errSeq > Real(100)*Max(m,n)*eps )
+        LogicError("Sequential ",name," multiply was inaccurate");
+
+    DistMultiVec<F> XDist(g), YDist(g);
+    XDist.Resize( X.Height(), numRHS );
+    for( Int iLoc=0; iLoc<XDist.LocalHeight(); ++iLoc )
+        for( Int j=0; j<numRHS; ++j )
+            XDist.Matrix()(iLoc,j) = X(XDist.GlobalRow(iLoc),j);
+    Uniform( YDist, (normal ? m : n), numRHS );
+    Matrix<F> YSeq;
+    Gather( YDist, YSeq );
+    opDist.Apply( orientation, F(2), XDist, F(-1), YDist );
+    op.Apply( orientation, F(2), X, F(-1), YSeq );
+    Matrix<F> YGath;
+    Gather( YDist, YGath );
+    YGath -= YSeq;
+    const Real errDist = FrobeniusNorm( YGath ) / FrobeniusNorm( YSeq );
+    OutputFromRoot(g.Comm(),name," distributed relative error: ",errDist);
+    if( errDist > Real(100)*Max(m,n)*eps )
+        LogicError("Distributed ",name," multiply was inaccurate");
+}
+
+template<typename F>
+void TestStructured
+( Orientation orientation, Int m, Int n, Int numRHS, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+
+    Matrix<F> A;
+    const vector<F> a = RandomVector<F>( m+n-1 );
+    Toeplitz( A, m, n, a );
+    ToeplitzOperator<F> T( m, n, a ), TDist( m, n, a, g );
+    TestOperator( "Toeplitz", orientation, T, TDist, A, numRHS, g );
+
+    Hankel( A, m, n, a );
+    HankelOperator<F> H( m, n, a ), HDist( m, n, a, g );
+    TestOperator( "Hankel", orientation, H, HDist, A, numRHS, g );
+
+    // The order of a circulant matrix need not be a power of two
+    const vector<F> c = RandomVector<F>( m );
+    Circulant( A, c );
+    CirculantOperator<F> C( c ), CDist( c, g );
+    TestOperator( "Circulant", orientation, C, CDist, A, numRHS, g );
+
+    // Solve against a diagonally dominant Toeplitz matrix with the Levinson
+    // recursion and with FGMRES
+    vector<F> s = RandomVector<F>( 2*n-1 );
+    s[n-1] += F(2*n);
+    ToeplitzOperator<F> TS( n, n, s ), TSDist( n, n, s, g );
+    Matrix<F> XSol, BRHS;
+    Uniform( XSol, n, numRHS );
+    Zeros( BRHS, n, numRHS );
+    TS( F(1), XSol, F(0), BRHS );
+    const Real frobSol = FrobeniusNorm( XSol );
+
+    Matrix<F> XDirect( BRHS );
+    LinearSolve( TS, XDirect );
+    XDirect -= XSol;
+    const Real errSolve = FrobeniusNorm( XDirect ) / frobSol;
+    OutputFromRoot(g.Comm(),"Levinson relative error: ",errSolve);
+    if( errSolve > Real(1000)*n*eps )
+        LogicError("Toeplitz LinearSolve was inaccurate");
+
+    DistMultiVec<F> XDistSol(g);
+    XDistSol.Resize( n, numRHS );
+    for( Int iLoc=0; iLoc<XDistSol.LocalHeight(); ++iLoc )
+        for( Int j=0; j<numRHS; ++j )
+            XDistSol.Matrix()(iLoc,j) = BRHS(XDistSol.GlobalRow(iLoc),j);
+    LinearSolve( TSDist, XDistSol );
+    Matrix<F> XDistGath;
+    Gather( XDistSol, XDistGath );
+    XDistGath -= XSol;
+    const Real errDistSolve = FrobeniusNorm( XDistGath ) / frobSol;
+    OutputFromRoot
+    (g.Comm(),"Distributed Levinson relative error: ",errDistSolve);
+    if( errDistSolve > Real(1000)*n*eps )
+        LogicError("Distributed Toeplitz LinearSolve was inaccurate");
+
+    auto identity = []( Matrix<F>& ) { };
+    Matrix<F> XKrylov( BRHS );
+    const Real relTol = Pow( eps, Real(0.75) );
+    FGMRES( TS, identity, XKrylov, relTol, 50, 500, false );
+    XKrylov -= XSol;
+    const Real errKrylov = FrobeniusNorm( XKrylov ) / frobSol;
+    OutputFromRoot(g.Comm(),"FGMRES relative error: ",errKrylov);
+    if( errKrylov > Real(100)*relTol )
+        LogicError("FGMRES on a ToeplitzOperator did not converge");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const char transChar = Input
+            ("--trans","orientation of the operator: N/T/C",'N');
+        const Int m = Input("--m","height of operators",37);
+        const Int n = Input("--n","width of operators",21);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid g( comm, gridHeight );
+        const Orientation orientation = CharToOrientation( transChar );
+        ComplainIfDebug();
+
+        TestStructured<float>( orientation, m, n, numRHS, g );
+        TestStructured<Complex<float>>( orientation, m, n, numRHS, g );
+        TestStructured<double>( orientation, m, n, numRHS, g );
+        TestStructured<Complex<double>>( orientation, m, n, numRHS, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual
+( const AbstractDistMatrix<T>& A,
+  const Matrix<T>& B,
+  const string& label )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    Matrix<T> E( A_STAR_STAR.Matrix() );
+    E -= B;
+    const Base<T> error = MaxNorm( E );
+    OutputFromRoot(A.Grid().Comm(),"  ",label," error: ",error);
+    if( error != Base<T>(0) )
+        LogicError(label," error of ",error," was nonzero");
+}
+
+template<typename T,Dist U,Dist V,Dist USub,Dist VSub>
+void TestSubmatrix( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing [",DistToString(U),",",DistToString(V),"] -> [",
+     DistToString(USub),",",DistToString(VSub),"]");
+    DistMatrix<T,U,V> A(g);
+    Uniform( A, m, n );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    const auto& ALoc = A_STAR_STAR.Matrix();
+
+    // Scattered (and unsorted) indices, including a repeated row
+    vector<Int> I, J;
+    for( Int i=m-1; i>=0; i-=3 )
+        I.push_back( i );
+    if( m > 0 )
+        I.push_back( I[0] );
+    for( Int j=0; j<n; j+=2 )
+        J.push_back( (7*j) % n );
+    std::sort( J.begin(), J.end() );
+    J.erase( std::unique(J.begin(),J.end()), J.end() );
+    std::reverse( J.begin(), J.end() );
+
+    DistMatrix<T,USub,VSub> ASub(g);
+    Matrix<T> ASubLoc;
+    GetSubmatrix( A, I, J, ASub );
+    GetSubmatrix( ALoc, I, J, ASubLoc );
+    CheckEqual( ASub, ASubLoc, "GetSubmatrix" );
+
+    GetSubmatrix( A, IR(1,m), J, ASub );
+    GetSubmatrix( ALoc, IR(1,m), J, ASubLoc );
+    CheckEqual( ASub, ASubLoc, "GetSubmatrix with row range" );
+
+    // Drop the repeated row so that the result of the updates is defined
+    I.pop_back();
+    GetSubmatrix( ALoc, I, J, ASubLoc );
+    Uniform( ASub, I.size(), J.size() );
+    DistMatrix<T,STAR,STAR> ASub_STAR_STAR( ASub );
+
+    Matrix<T> BLoc( ALoc );
+    UpdateSubmatrix( A, I, J, T(3), ASub );
+    UpdateSubmatrix( BLoc, I, J, T(3), ASub_STAR_STAR.Matrix() );
+    CheckEqual( A, BLoc, "UpdateSubmatrix" );
+
+    SetSubmatrix( A, I, J, ASub );
+    SetSubmatrix( BLoc, I, J, ASub_STAR_STAR.Matrix() );
+    CheckEqual( A, BLoc, "SetSubmatrix" );
+}
+
+template<typename T>
+void TestSubmatrices( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    TestSubmatrix<T,MC,MR,MC,MR>( m, n, g );
+    TestSubmatrix<T,MC,MR,STAR,STAR>( m, n, g );
+    TestSubmatrix<T,MC,MR,VC,STAR>( m, n, g );
+    TestSubmatrix<T,STAR,STAR,MR,MC>( m, n, g );
+    TestSubmatrix<T,VR,STAR,MC,STAR>( m, n, g );
+    TestSubmatrix<T,STAR,MR,STAR,VC>( m, n, g );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height",100);
+        const Int n = Input("--n","width",80);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestSubmatrices<double>( m, n, g );
+        TestSubmatrices<float>( m, n, g );
+        TestSubmatrices<Complex<double>>( m, n, g );
+        OutputFromRoot(comm,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
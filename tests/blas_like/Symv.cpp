@@ -29,6 +29,7 @@ void TestSymv
     Uniform( A, m, m );
     Uniform( x, m, 1 );
     Uniform( y, m, 1 );
+    DistMatrix<T> y0( y );
     if( print )
     {
         Print( A, "A" );
@@ -51,6 +52,33 @@ void TestSymv
     if( print )
         Print( y, BuildString("y := ",alpha," Symm(A) x + ",beta," y") );
 
+    // Compare against a Gemv with the explicitly symmetrized matrix, for
+    // both column and row vectors
+    DistMatrix<T> S( A );
+    MakeSymmetric( uplo, S );
+    const Base<T> tol = 10*m*limits::Epsilon<Base<T>>();
+    {
+        DistMatrix<T> yRef( y0 );
+        Gemv( NORMAL, alpha, S, x, beta, yRef );
+        yRef -= y;
+        if( FrobeniusNorm( yRef ) > tol*(1+FrobeniusNorm( y )) )
+            LogicError("Symv with column vectors was incorrect");
+    }
+    {
+        DistMatrix<T> xTrans(g), yTrans(g);
+        Transpose( x, xTrans );
+        Transpose( y0, yTrans );
+        Symv( uplo, alpha, A, xTrans, beta, yTrans );
+        DistMatrix<T> yRef( y0 );
+        Gemv( NORMAL, alpha, S, x, beta, yRef );
+        DistMatrix<T> yRefTrans(g);
+        Transpose( yRef, yRefTrans );
+        yRefTrans -= yTrans;
+        if( FrobeniusNorm( yRefTrans ) > tol*(1+FrobeniusNorm( yRef )) )
+            LogicError("Symv with row vectors was incorrect");
+    }
+    OutputFromRoot(g.Comm(),"Results agreed with Gemv");
+
     PopIndent();
 }
 
@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T,Dist U,Dist V>
+void TestTopKAbs( Int m, Int n, Int k, bool largest, const Grid& g )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing [",DistToString(U),",",DistToString(V),"] with ",
+     TypeName<T>(),(largest ? " (largest)" : " (smallest)"));
+
+    // Draw from a small set of integers so that many ties must be broken
+    DistMatrix<T,U,V> A(g);
+    Uniform( A, m, n, T(0), Base<T>(4) );
+    Round( A );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    const Matrix<T>& ALoc = A_STAR_STAR.LockedMatrix();
+
+    auto entries = TopKAbs( A, k, largest );
+    auto seqEntries = TopKAbs( ALoc, k, largest );
+    if( entries.size() != seqEntries.size() ||
+        Int(entries.size()) != Min(k,m*n) )
+        LogicError("TopKAbs returned the wrong number of entries");
+    for( size_t t=0; t<entries.size(); ++t )
+    {
+        if( entries[t].i != seqEntries[t].i ||
+            entries[t].j != seqEntries[t].j ||
+            entries[t].value != seqEntries[t].value )
+            LogicError("TopKAbs entry ",t," did not match sequential result");
+        if( entries[t].value != Abs(ALoc(entries[t].i,entries[t].j)) )
+            LogicError("TopKAbs entry ",t," had the wrong value");
+        if( t > 0 && (largest ? entries[t].value > entries[t-1].value
+                              : entries[t].value < entries[t-1].value) )
+            LogicError("TopKAbs entries were not sorted");
+    }
+
+    DistMatrix<Int,STAR,V> rowInds(g);
+    DistMatrix<Base<T>,STAR,V> colValues(g);
+    ColumnTopKAbs( A, k, rowInds, colValues, largest );
+    Matrix<Int> seqRowInds;
+    Matrix<Base<T>> seqColValues;
+    ColumnTopKAbs( ALoc, k, seqRowInds, seqColValues, largest );
+    for( Int jLoc=0; jLoc<rowInds.LocalWidth(); ++jLoc )
+    {
+        const Int j = rowInds.GlobalCol(jLoc);
+        for( Int t=0; t<k; ++t )
+        {
+            if( rowInds.GetLocal(t,jLoc) != seqRowInds(t,j) ||
+                colValues.GetLocal(t,jLoc) != seqColValues(t,j) )
+                LogicError("ColumnTopKAbs did not match sequential result");
+        }
+    }
+
+    DistMatrix<Int,U,STAR> colInds(g);
+    DistMatrix<Base<T>,U,STAR> rowValues(g);
+    RowTopKAbs( A, k, colInds, rowValues, largest );
+    Matrix<Int> seqColInds;
+    Matrix<Base<T>> seqRowValues;
+    RowTopKAbs( ALoc, k, seqColInds, seqRowValues, largest );
+    for( Int iLoc=0; iLoc<colInds.LocalHeight(); ++iLoc )
+    {
+        const Int i = colInds.GlobalRow(iLoc);
+        for( Int t=0; t<k; ++t )
+        {
+            if( colInds.GetLocal(iLoc,t) != seqColInds(i,t) ||
+                rowValues.GetLocal(iLoc,t) != seqRowValues(i,t) )
+                LogicError("RowTopKAbs did not match sequential result");
+        }
+    }
+}
+
+template<typename T>
+void TestTopKAbs( Int m, Int n, Int k, const Grid& g )
+{
+    for( bool largest : { true, false } )
+    {
+        TestTopKAbs<T,MC,  MR  >( m, n, k, largest, g );
+        TestTopKAbs<T,VC,  STAR>( m, n, k, largest, g );
+        TestTopKAbs<T,STAR,VR  >( m, n, k, largest, g );
+        TestTopKAbs<T,STAR,STAR>( m, n, k, largest, g );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height",50);
+        const Int n = Input("--n","width",30);
+        const Int k = Input("--k","number of entries to select",7);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestTopKAbs<float>( m, n, k, g );
+        TestTopKAbs<double>( m, n, k, g );
+        TestTopKAbs<Complex<double>>( m, n, k, g );
+        // Selections larger than the matrix dimensions should be padded
+        TestTopKAbs<double>( 5, 3, 2*Max(m,n), g );
+        OutputFromRoot(comm,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestTriangleSizes( UpperOrLower uplo, const DistMatrix<T>& C )
+{
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const auto sizes = LocalTriangleSizes( uplo, C );
+    Int totalSize = 0;
+    for( const Int size : sizes )
+        totalSize += size;
+    Int expectedTotal = 0;
+    for( Int j=0; j<n; ++j )
+        expectedTotal +=
+          ( uplo == LOWER ? Max(m-j,Int(0)) : Min(j+1,m) );
+    if( totalSize != expectedTotal )
+        LogicError
+        ("The triangle sizes summed to ",totalSize," rather than ",
+         expectedTotal);
+
+    Int localSize = 0;
+    for( Int jLoc=0; jLoc<C.LocalWidth(); ++jLoc )
+    {
+        const Int j = C.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<C.LocalHeight(); ++iLoc )
+        {
+            const Int i = C.GlobalRow(iLoc);
+            if( (uplo == LOWER && i >= j) || (uplo == UPPER && i <= j) )
+                ++localSize;
+        }
+    }
+    if( localSize != sizes[C.DistRank()] )
+        LogicError
+        ("The local triangle had ",localSize," entries rather than ",
+         sizes[C.DistRank()]);
+}
+
+template<typename T>
+void TestTrrk( const Grid& g, UpperOrLower uplo, Int n, Int k )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    DistMatrix<T> A(g), B(g), C(g), CRef(g);
+    Uniform( A, n, k );
+    Uniform( B, k, n );
+    Uniform( C, n, n );
+    CRef = C;
+
+    TestTriangleSizes( uplo, C );
+    auto CTall = C( ALL, IR(0,n/2) );
+    TestTriangleSizes( uplo, CTall );
+
+    // The measured imbalance of the local updates should track the
+    // predicted ownership of the triangle
+    EnablePerfCounters();
+    {
+        EL_TRACE_REGION("TrrkTest");
+        Trrk( uplo, NORMAL, NORMAL, T(1), A, B, T(1), C );
+    }
+    DisablePerfCounters();
+    const double predicted = TriangleImbalance( uplo, C );
+    for( const auto& imbalance : PerfCounterImbalance( g.Comm() ) )
+    {
+        if( imbalance.routine != "TrrkTest" )
+            continue;
+        if( imbalance.minFlops > imbalance.meanFlops ||
+            imbalance.meanFlops > imbalance.maxFlops ||
+            imbalance.meanFlops == 0 )
+            LogicError("The flop counters were inconsistent");
+        OutputFromRoot
+        (g.Comm(),"Predicted imbalance: ",predicted,
+         ", measured: ",imbalance.Imbalance());
+        if( g.Size() == 1 && imbalance.Imbalance() != 1 )
+            LogicError("A single process cannot be imbalanced");
+    }
+    if( g.Size() == 1 && predicted != 1 )
+        LogicError("The predicted imbalance of one process was ",predicted);
+
+    Gemm( NORMAL, NORMAL, T(1), A, B, T(1), CRef );
+    MakeTrapezoidal( uplo, C );
+    MakeTrapezoidal( uplo, CRef );
+    CRef -= C;
+    const Base<T> error = FrobeniusNorm( CRef );
+    const Base<T> tol = 10*k*limits::Epsilon<Base<T>>()*FrobeniusNorm( C );
+    if( error > tol )
+        LogicError("Trrk had an error of ",error," > ",tol);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","size of C",100);
+        const Int k = Input("--k","inner dimension",20);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( mpi::COMM_WORLD );
+        TestTrrk<double>( g, LOWER, n, k );
+        TestTrrk<double>( g, UPPER, n, k );
+        TestTrrk<Complex<double>>( g, LOWER, n, k );
+        OutputFromRoot(mpi::COMM_WORLD,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
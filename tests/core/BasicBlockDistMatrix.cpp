@@ -61,6 +61,14 @@ main( int argc, char* argv[] )
             Print( w, "w(A)" );
             Print( Q, "Q" );
         }
+
+        // View Q through its ScaLAPACK descriptor without copying
+        DistMatrix<Complex<double>,MC,MR,BLOCK> QView(g);
+        QView.LockedAttachScaLAPACK( Q.Descriptor(), Q.LockedBuffer() );
+        if( QView.Height() != n || QView.Width() != n ||
+            QView.BlockHeight() != Q.BlockHeight() ||
+            QView.LockedBuffer() != Q.LockedBuffer() )
+            LogicError("ScaLAPACK view of Q was incorrect");
 #endif
     }
     catch( std::exception& e ) { ReportException(e); }
@@ -0,0 +1,72 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+void TestTuning( const string& filename )
+{
+    ClearTunedBlocksizes();
+    const Int defaultBlocksize = Blocksize();
+    if( TunedBlocksize<double>("LU",1000) != defaultBlocksize )
+        LogicError("Untuned query did not fall back to the default blocksize");
+
+    // Queries should use the nearest tuned local size
+    SetTunedBlocksize( "LU", TypeName<double>(), 128, 1, 1, 32 );
+    SetTunedBlocksize( "LU", TypeName<double>(), 4096, 1, 1, 192 );
+    if( TunedBlocksize<double>("LU",100) != 32 ||
+        TunedBlocksize<double>("LU",3000) != 192 ||
+        TunedBlocksize<double>("LU",1u<<20) != 192 )
+        LogicError("Tuned blocksizes were not properly interpolated");
+    if( TunedBlocksize<float>("LU",128) != defaultBlocksize ||
+        TunedBlocksize<double>("LU",128,2,2) != defaultBlocksize )
+        LogicError("Tuned blocksizes leaked across datatypes or grids");
+
+    // The search should choose the fastest candidate
+    const Int best =
+      TuneBlocksize
+      ( "Cholesky", TypeName<double>(), 512, 1, 1,
+        []( Int nb )
+        {
+            if( TunedBlocksize<double>("Cholesky",512) != nb )
+                LogicError("Candidate blocksize was not in effect");
+            return double(Abs(nb-96));
+        } );
+    if( best != 96 || TunedBlocksize<double>("Cholesky",512) != 96 )
+        LogicError("Autotuner chose ",best," rather than 96");
+
+    // The tuning file should round-trip
+    SaveTuningFile( filename );
+    mpi::Barrier( mpi::COMM_WORLD );
+    ClearTunedBlocksizes();
+    LoadTuningFile( filename );
+    if( TunedBlocksize<double>("LU",100) != 32 ||
+        TunedBlocksize<double>("Cholesky",512) != 96 )
+        LogicError("Tuning file did not round-trip");
+    ClearTunedBlocksizes();
+
+    OutputFromRoot(mpi::COMM_WORLD,"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const string filename =
+          Input("--filename","tuning file",string("BlocksizeTuning.txt"));
+        ProcessInput();
+        PrintInputReport();
+
+        TestTuning( filename );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
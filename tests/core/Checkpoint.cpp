@@ -0,0 +1,88 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T,Dist U,Dist V,DistWrap wrap=ELEMENT>
+void TestRestore
+( const DistMatrix<T>& A, const Grid& g, const string& basename )
+{
+    DistMatrix<T,U,V,wrap> B(g);
+    ReadCheckpoint( B, basename );
+    if( B.Height() != A.Height() || B.Width() != A.Width() )
+        LogicError("Restored matrix had the wrong dimensions");
+    // Compare on the original grid
+    DistMatrix<T> BOrig( A.Grid() ), E( A.Grid() );
+    Copy( B, BOrig );
+    E = A;
+    E -= BOrig;
+    if( FrobeniusNorm( E ) != Base<T>(0) )
+        LogicError
+        ("Restoring into [",DistToString(U),",",DistToString(V),
+         "] was incorrect");
+}
+
+template<typename T>
+void TestCheckpoint( const Grid& g, const Grid& gOther, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    const string basename = "Checkpoint";
+    DistMatrix<T> A(g);
+    A.Align( 1 % g.Height(), 0 );
+    Uniform( A, m, n );
+    WriteCheckpoint( A, basename );
+
+    // The same layout reads each shard directly
+    DistMatrix<T> B(g);
+    B.Align( 1 % g.Height(), 0 );
+    ReadCheckpoint( B, basename );
+    B -= A;
+    if( FrobeniusNorm( B ) != Base<T>(0) )
+        LogicError("Restoring into the same layout was incorrect");
+
+    // Other layouts redistribute
+    TestRestore<T,MC,MR>( A, g, basename );
+    TestRestore<T,VC,STAR>( A, g, basename );
+    TestRestore<T,STAR,STAR>( A, g, basename );
+    TestRestore<T,MC,MR,BLOCK>( A, g, basename );
+    TestRestore<T,MC,MR>( A, gOther, basename );
+
+    mpi::Barrier( g.Comm() );
+    if( g.Rank() == 0 )
+    {
+        std::remove( (basename+".ckpt").c_str() );
+        for( int shard=0; shard<g.Size(); ++shard )
+            std::remove( (basename+".ckpt."+std::to_string(shard)).c_str() );
+    }
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",53);
+        const Int n = Input("--width","width of matrix",41);
+        ProcessInput();
+        PrintInputReport();
+
+        // Restart onto a grid of a different shape
+        const Grid g( comm );
+        const Grid gOther( comm, 1 );
+        TestCheckpoint<double>( g, gOther, m, n );
+        TestCheckpoint<Complex<float>>( g, gOther, m, n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
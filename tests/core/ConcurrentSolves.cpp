@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <thread>
+using namespace El;
+
+// Solve a batch of small HPD systems with a thread-specific blocksize and
+// return the largest relative residual
+template<typename F>
+Base<F> SolveBatch( Int n, Int numSolves, Int blocksize )
+{
+    PushBlocksizeStack( blocksize );
+    Base<F> maxResid = 0;
+    for( Int solve=0; solve<numSolves; ++solve )
+    {
+        if( Blocksize() != blocksize )
+            LogicError("The blocksize of another thread leaked");
+        Matrix<F> A, B, X;
+        HermitianUniformSpectrum( A, n, 1, 2 );
+        Uniform( B, n, 1 );
+        Matrix<F> L( A );
+        Cholesky( LOWER, L );
+        X = B;
+        cholesky::SolveAfter( LOWER, NORMAL, L, X );
+        Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), B );
+        maxResid = Max( maxResid, FrobeniusNorm(B)/FrobeniusNorm(X) );
+    }
+    PopBlocksizeStack();
+    return maxResid;
+}
+
+template<typename F>
+void TestConcurrentSolves( Int n, Int numSolves, Int numThreads )
+{
+    OutputFromRoot
+    (mpi::COMM_WORLD,"Testing concurrent solves with ",TypeName<F>());
+    const Int mainBlocksize = Blocksize();
+    vector<Base<F>> resids( numThreads );
+    vector<std::thread> threads;
+    for( Int t=0; t<numThreads; ++t )
+        threads.emplace_back
+        ( [&,t]() { resids[t] = SolveBatch<F>( n, numSolves, 4+t ); } );
+    for( auto& thread : threads )
+        thread.join();
+    if( Blocksize() != mainBlocksize )
+        LogicError("The blocksize of the main thread was modified");
+    const Base<F> tol = n*n*limits::Epsilon<Base<F>>();
+    for( Int t=0; t<numThreads; ++t )
+        if( resids[t] > tol )
+            LogicError("Thread ",t," had a relative residual of ",resids[t]);
+}
+
+void TestContexts()
+{
+    // Each thread has a distinctly seeded generator...
+    std::mt19937::result_type first, second;
+    std::thread([&](){ first = Generator()(); }).join();
+    std::thread([&](){ second = Generator()(); }).join();
+    if( first == second )
+        LogicError("Two threads drew identical random numbers");
+
+    // ...and explicitly installed contexts reproduce their random numbers
+    Matrix<double> A, B;
+    {
+        Context context( 17 );
+        ContextScope scope( context );
+        Uniform( A, 10, 10 );
+    }
+    {
+        Context context( 17 );
+        ContextScope scope( context );
+        Uniform( B, 10, 10 );
+    }
+    B -= A;
+    if( FrobeniusNorm(B) != 0. )
+        LogicError("Identically seeded contexts generated different matrices");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","size of each system",20);
+        const Int numSolves = Input("--numSolves","solves per thread",50);
+        const Int numThreads = Input("--numThreads","number of threads",4);
+        ProcessInput();
+        PrintInputReport();
+
+        TestContexts();
+        TestConcurrentSolves<float>( n, numSolves, numThreads );
+        TestConcurrentSolves<Complex<double>>( n, numSolves, numThreads );
+        OutputFromRoot(mpi::COMM_WORLD,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
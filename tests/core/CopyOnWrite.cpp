@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestSequential( Int m, Int n )
+{
+    Matrix<T> A;
+    Uniform( A, m, n );
+    const T alpha = A.Get(0,0);
+
+    // A copy should share the buffer until it is modified
+    Matrix<T> B( A );
+    if( B.LockedBuffer() != A.LockedBuffer() || !A.Shared() )
+        LogicError("Copy did not share the buffer");
+    B.Set( 0, 0, alpha+T(1) );
+    if( B.LockedBuffer() == A.LockedBuffer() || B.Shared() )
+        LogicError("Modified copy did not detach");
+    if( A.Get(0,0) != alpha || B.Get(0,0) != alpha+T(1) )
+        LogicError("Modifying a copy-on-write copy changed the original");
+    if( A.Shared() )
+        LogicError("The last sharer of a buffer was still marked as shared");
+
+    // An explicit detach should preserve the entries
+    Matrix<T> C( A );
+    C.Detach();
+    Matrix<T> E( A );
+    E -= C;
+    if( C.LockedBuffer() == A.LockedBuffer() || FrobeniusNorm(E) != Base<T>(0) )
+        LogicError("Explicit detach was incorrect");
+
+    // Copying from an rvalue owner should steal its buffer
+    const T* CBuf = C.LockedBuffer();
+    Matrix<T> D;
+    Copy( std::move(C), D );
+    if( D.LockedBuffer() != CBuf )
+        LogicError("Copy from an rvalue did not steal the buffer");
+}
+
+template<typename T>
+void TestDistributed( const Grid& g, Int m, Int n )
+{
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+
+    DistMatrix<T> B( A );
+    const bool shared =
+      A.LocalHeight()*A.LocalWidth() == 0 ||
+      B.LockedBuffer() == A.LockedBuffer();
+    if( !mpi::AllReduce( int(shared), mpi::MIN, g.Comm() ) )
+        LogicError("Distributed copy did not share the local buffers");
+
+    B *= T(2);
+    DistMatrix<T> E( A );
+    E *= T(2);
+    E -= B;
+    if( FrobeniusNorm( E ) != Base<T>(0) )
+        LogicError("Scaling a copy-on-write copy changed the original");
+
+    // Writing through a view of a copy must not reach the original
+    DistMatrix<T> C( A ), AOrig(g);
+    Copy( A, AOrig );
+    AOrig.Matrix().Detach();
+    const Int k = Min(m,n)/2;
+    auto CTL = C( IR(0,k), IR(0,k) );
+    Fill( CTL, T(3) );
+    E = A;
+    E -= AOrig;
+    if( FrobeniusNorm( E ) != Base<T>(0) )
+        LogicError("Writing through a view of a copy changed the original");
+    auto CTLCheck = C( IR(0,k), IR(0,k) );
+    if( k > 0 && CTLCheck.Get(0,0) != T(3) )
+        LogicError("Writing through a view of a copy was lost");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",50);
+        const Int n = Input("--width","width of matrix",30);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetCopyOnWrite( true );
+        TestSequential<double>( m, n );
+        TestSequential<Complex<double>>( m, n );
+        TestDistributed<double>( g, m, n );
+        TestDistributed<Complex<double>>( g, m, n );
+        SetCopyOnWrite( false );
+        OutputFromRoot(comm,"Copy-on-write copies were correct");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Fill the matrix with the given kind of counter-based random entries, after
+// resetting the stream index so that every call draws the same entries
+template<typename T,class MatType>
+void Fill( Int kind, unsigned long long seed, MatType& A, Int m, Int n )
+{
+    SetCounterBasedSeed( seed );
+    if( kind == 0 )
+        Gaussian( A, m, n );
+    else if( kind == 1 )
+        Uniform( A, m, n );
+    else
+        Rademacher( A, m, n );
+}
+
+template<typename T,Dist U,Dist V>
+void TestGridIndependence
+( const Grid& g, Int kind, unsigned long long seed,
+  const Matrix<T>& ASeq )
+{
+    const Int m = ASeq.Height();
+    const Int n = ASeq.Width();
+    DistMatrix<T,U,V> A(g);
+    Fill<T>( kind, seed, A, m, n );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    Matrix<T> E( A_STAR_STAR.Matrix() );
+    E -= ASeq;
+    if( FrobeniusNorm( E ) != Base<T>(0) )
+        LogicError
+        ("Counter-based fill of kind ",kind," on a ",g.Height()," x ",
+         g.Width()," grid differed from the sequential fill");
+}
+
+template<typename T>
+void TestCounterBased( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    const unsigned long long seed = 1729;
+    mpi::Comm comm = g.Comm();
+    const Grid gCol( comm, mpi::Size(comm) );
+    for( Int kind=0; kind<3; ++kind )
+    {
+        Matrix<T> ASeq;
+        Fill<T>( kind, seed, ASeq, m, n );
+        TestGridIndependence<T,MC,MR>( g, kind, seed, ASeq );
+        TestGridIndependence<T,MC,MR>( gCol, kind, seed, ASeq );
+        TestGridIndependence<T,VC,STAR>( g, kind, seed, ASeq );
+        TestGridIndependence<T,STAR,VR>( g, kind, seed, ASeq );
+    }
+
+    // Successive fills should draw from different streams
+    SetCounterBasedSeed( seed );
+    Matrix<T> A, B;
+    Gaussian( A, m, n );
+    Gaussian( B, m, n );
+    B -= A;
+    if( FrobeniusNorm( B ) == Base<T>(0) )
+        LogicError("Successive counter-based fills were identical");
+
+    // Each entry of a standard normal matrix has unit variance
+    typedef Base<T> Real;
+    const Real relVariance = FrobeniusNorm( A ) / Sqrt( Real(m*n) );
+    OutputFromRoot(g.Comm(),"sqrt(mean(|A(i,j)|^2)) = ",relVariance);
+    if( Abs(relVariance-Real(1)) > Real(0.1) )
+        LogicError("Counter-based normal samples had the wrong variance");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",50);
+        const Int n = Input("--width","width of matrix",30);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetCounterBasedRandom( true );
+
+        TestCounterBased<float>( g, m, n );
+        TestCounterBased<Complex<float>>( g, m, n );
+        TestCounterBased<double>( g, m, n );
+        TestCounterBased<Complex<double>>( g, m, n );
+#ifdef HYDROGEN_HAVE_QUADMATH
+        TestCounterBased<Quad>( g, m, n );
+#endif
+        SetCounterBasedRandom( false );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestDLPack( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+
+    // Export a view with a leading dimension larger than its height
+    Matrix<T> A;
+    Uniform( A, 2*m, n );
+    auto ASub = A( IR(1,m+1), ALL );
+    DLManagedTensorVersioned* managed = ToDLPack( ASub );
+    const DLTensor& tensor = managed->dl_tensor;
+    if( tensor.ndim != 2 || tensor.shape[0] != m || tensor.shape[1] != n ||
+        tensor.strides[0] != 1 || tensor.strides[1] != A.LDim() ||
+        tensor.data != ASub.Buffer() )
+        LogicError("Exported tensor had the wrong layout");
+    if( managed->flags & DLPACK_FLAG_BITMASK_READ_ONLY )
+        LogicError("Mutable export was flagged as read-only");
+
+    // Attaching the export must alias the original entries
+    Matrix<T> B;
+    AttachDLPack( B, tensor );
+    B.Set( 0, 0, T(17) );
+    if( A.Get(1,0) != T(17) )
+        LogicError("Attached tensor did not alias the exported matrix");
+    managed->deleter( managed );
+
+    const Matrix<T>& ALocked = A;
+    managed = LockedToDLPack( ALocked );
+    if( !(managed->flags & DLPACK_FLAG_BITMASK_READ_ONLY) )
+        LogicError("Locked export was not flagged as read-only");
+    Matrix<T> C;
+    LockedAttachDLPack( C, managed->dl_tensor );
+    if( !C.Locked() || C.LockedBuffer() != A.LockedBuffer() )
+        LogicError("Locked attachment was incorrect");
+    managed->deleter( managed );
+
+    // Round trip the local block of a distributed matrix
+    DistMatrix<T> D(g);
+    Uniform( D, m, n );
+    DistMatrix<T> DCopy( D );
+    managed = ToDLPack( D );
+    DistMatrix<T> E(g);
+    AttachDLPack
+    ( E, m, n, g, D.ColAlign(), D.RowAlign(), managed->dl_tensor );
+    E -= DCopy;
+    if( FrobeniusNorm( E ) != Base<T>(0) )
+        LogicError("Attached local block was incorrect");
+    managed->deleter( managed );
+
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",37);
+        const Int n = Input("--width","width of matrix",23);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestDLPack<Int>( g, m, n );
+        TestDLPack<float>( g, m, n );
+        TestDLPack<double>( g, m, n );
+        TestDLPack<Complex<double>>( g, m, n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -179,6 +179,101 @@ DistMatrixTest( Int m, Int n, const Grid& grid, bool print )
     CheckAll<T,VR,  STAR>( m, n, grid, print );
 }
 
+template<typename T>
+void
+ArenaTest( Int m, Int n, const Grid& grid )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing communication arena reuse with ",TypeName<T>());
+    DistMatrix<T> A(grid);
+    Uniform( A, m, n );
+    DistMatrix<T,VC,STAR> A_VC_STAR(grid);
+    DistMatrix<T,STAR,MR> A_STAR_MR(grid);
+
+    // Warm up the arena before counting its allocations
+    A_VC_STAR = A;
+    A_STAR_MR = A;
+    A = A_VC_STAR;
+    const Arena& arena = grid.CommArena();
+    const Int numAllocations = arena.NumAllocations();
+    for( Int it=0; it<5; ++it )
+    {
+        A_VC_STAR = A;
+        A_STAR_MR = A;
+        A = A_VC_STAR;
+    }
+    if( arena.NumOutstanding() != 0 )
+        LogicError("Arena had ",arena.NumOutstanding()," outstanding buffers");
+    if( Int(arena.NumAllocations()) != numAllocations )
+        LogicError("Arena was not reused in the steady state");
+    OutputFromRoot(grid.Comm(),"PASSED");
+}
+
+template<typename T>
+void
+RedistPlanTest( Int m, Int n, const Grid& grid )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing persistent redistribution plans with ",
+     TypeName<T>());
+    DistMatrix<T> A(grid);
+    DistMatrix<T,VC,STAR> B(grid), BRef(grid);
+    DistMatrix<T,STAR,MR> C(grid), CRef(grid);
+    A.Resize( m, n );
+    RedistPlan<T,MC,MR,VC,STAR> planB( A, B );
+    RedistPlan<T,MC,MR,STAR,MR> planC( A, C );
+    for( Int it=0; it<3; ++it )
+    {
+        Uniform( A, m, n );
+        planB.Execute( A, B );
+        planC.Execute( A, C );
+        BRef = A;
+        CRef = A;
+        BRef -= B;
+        CRef -= C;
+        if( FrobeniusNorm(BRef) != Base<T>(0) ||
+            FrobeniusNorm(CRef) != Base<T>(0) )
+            LogicError("Redistribution plan produced an incorrect result");
+    }
+    OutputFromRoot(grid.Comm(),"PASSED");
+}
+
+template<typename T>
+void
+NodeSharedTest( Int m, Int n, const Grid& grid )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing node-shared [STAR,STAR] matrices with ",
+     TypeName<T>());
+    DistMatrix<T> A(grid);
+    DistMatrix<T,MR,MC> B(grid);
+    DistMatrix<T,STAR,STAR> AShared(grid), BShared(grid), ARef(grid);
+    AShared.SetNodeShared();
+    BShared.SetNodeShared();
+    for( Int it=0; it<3; ++it )
+    {
+        // Grow the matrices to force the shared buffers to be reallocated
+        Uniform( A, m+it, n );
+        Uniform( B, m, n+it );
+        AShared = A;
+        BShared = B;
+        ARef = A;
+        ARef -= AShared;
+        if( FrobeniusNorm(ARef) != Base<T>(0) )
+            LogicError("Node-shared gather from [MC,MR] was incorrect");
+        ARef = B;
+        ARef -= BShared;
+        if( FrobeniusNorm(ARef) != Base<T>(0) )
+            LogicError("Node-shared gather from [MR,MC] was incorrect");
+    }
+    AShared.SetNodeShared( false );
+    ARef = A;
+    ARef -= AShared;
+    if( FrobeniusNorm(ARef) != Base<T>(0) )
+        LogicError("Disabling node sharing did not preserve the matrix");
+    OutputFromRoot(grid.Comm(),"PASSED");
+}
+
 int
 main( int argc, char* argv[] )
 {
@@ -208,6 +303,13 @@ main( int argc, char* argv[] )
         DistMatrixTest<double>( m, n, grid, print );
         DistMatrixTest<Complex<double>>( m, n, grid, print );
 
+        ArenaTest<double>( m, n, grid );
+        ArenaTest<Complex<double>>( m, n, grid );
+        RedistPlanTest<double>( m, n, grid );
+        RedistPlanTest<Complex<double>>( m, n, grid );
+        NodeSharedTest<double>( m, n, grid );
+        NodeSharedTest<Complex<double>>( m, n, grid );
+
 #ifdef EL_HAVE_QD
         DistMatrixTest<DoubleDouble>( m, n, grid, print );
         DistMatrixTest<QuadDouble>( m, n, grid, print );
@@ -0,0 +1,128 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form the same swap sequence, of the given length, for the sequential and
+// distributed permutations, with room for as many additional swaps. The
+// destinations are deterministic so that every process agrees on them.
+void FormSwaps
+( Permutation& P, DistPermutation& PDist, Int n, Int numSwaps, bool implicit )
+{
+    P.MakeIdentity( n );
+    P.ReserveSwaps( 2*numSwaps );
+    PDist.MakeIdentity( n );
+    PDist.ReserveSwaps( 2*numSwaps );
+    for( Int j=0; j<numSwaps; ++j )
+    {
+        const Int origin = ( implicit ? j : (3*j+1) % n );
+        const Int dest = (7*j+5) % n;
+        P.Swap( origin, dest );
+        PDist.Swap( origin, dest );
+    }
+}
+
+template<typename T,Dist U,Dist V>
+void CheckAgainstSequential
+( const DistMatrix<T,U,V>& A, const Matrix<T>& ASeq, const string& msg )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    Matrix<T> E( ASeq );
+    E -= A_STAR_STAR.Matrix();
+    if( FrobeniusNorm(E) != Base<T>(0) )
+        LogicError(msg," was incorrect");
+}
+
+template<typename T,Dist U,Dist V>
+void TestPermutation
+( const Grid& g, Int m, Int n, Int numSwaps, Int offset, bool implicit )
+{
+    DistMatrix<T,U,V> A(g);
+    Uniform( A, m, n );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    Matrix<T> ASeq( A_STAR_STAR.Matrix() );
+
+    Permutation P;
+    DistPermutation PDist(g);
+    FormSwaps( P, PDist, m-offset, numSwaps, implicit );
+    auto ASeqBot = ASeq( IR(offset,m), ALL );
+
+    // Apply the same sequence twice so that the cached composition is reused
+    for( Int rep=0; rep<2; ++rep )
+    {
+        P.PermuteRows( ASeqBot );
+        PDist.PermuteRows( A, offset );
+        CheckAgainstSequential( A, ASeq, "Row permutation" );
+    }
+    for( Int rep=0; rep<2; ++rep )
+    {
+        P.InversePermuteRows( ASeqBot );
+        PDist.InversePermuteRows( A, offset );
+        CheckAgainstSequential( A, ASeq, "Inverse row permutation" );
+    }
+
+    // Appending swaps must invalidate the cached composition
+    for( Int j=0; j<numSwaps; ++j )
+    {
+        const Int dest = (5*j+2) % (m-offset);
+        P.Swap( numSwaps+j, dest );
+        PDist.Swap( numSwaps+j, dest );
+    }
+    P.PermuteRows( ASeqBot );
+    PDist.PermuteRows( A, offset );
+    CheckAgainstSequential( A, ASeq, "Extended row permutation" );
+
+    FormSwaps( P, PDist, n, Min(numSwaps,n), implicit );
+    auto ASeqAll = ASeq( ALL, IR(0,n) );
+    P.PermuteCols( ASeqAll );
+    PDist.PermuteCols( A );
+    CheckAgainstSequential( A, ASeq, "Column permutation" );
+    P.InversePermuteCols( ASeqAll );
+    PDist.InversePermuteCols( A );
+    CheckAgainstSequential( A, ASeq, "Inverse column permutation" );
+}
+
+template<typename T>
+void TestPermutations( const Grid& g, Int m, Int n, Int numSwaps )
+{
+    for( const bool implicit : { true, false } )
+    {
+        TestPermutation<T,MC,MR>( g, m, n, numSwaps, 0, implicit );
+        TestPermutation<T,MC,MR>( g, m, n, numSwaps, 3, implicit );
+        TestPermutation<T,VC,STAR>( g, m, n, numSwaps, 0, implicit );
+        TestPermutation<T,STAR,VR>( g, m, n, numSwaps, 1, implicit );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",50);
+        const Int n = Input("--width","width of matrix",30);
+        const Int numSwaps = Input("--numSwaps","number of swaps",20);
+        ProcessInput();
+        PrintInputReport();
+
+        if( 2*numSwaps > m-3 )
+            LogicError("Twice the number of swaps must be at most height-3");
+
+        const Grid g( comm );
+        TestPermutations<double>( g, m, n, numSwaps );
+        TestPermutations<Complex<double>>( g, m, n, numSwaps );
+        OutputFromRoot(comm,"Distributed permutations were correct");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
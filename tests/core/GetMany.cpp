@@ -0,0 +1,101 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare batched and cached global entry access against Get
+template<typename T,Dist U,Dist V>
+void TestGetMany( const Grid& g, Int m, Int n, Int panelWidth )
+{
+    DistMatrix<T,U,V> A(g);
+    Uniform( A, m, n );
+
+    vector<pair<Int,Int>> indices;
+    for( Int k=0; k<2*m; ++k )
+        indices.emplace_back( (7*k) % m, (3*k+1) % n );
+    const auto values = A.GetMany( indices );
+    for( size_t k=0; k<indices.size(); ++k )
+        if( values[k] != A.Get(indices[k].first,indices[k].second) )
+            LogicError
+            ("GetMany of [",DistToString(U),",",DistToString(V),
+             "] disagreed with Get at entry ",k);
+
+    vector<Entry<T>> entries;
+    for( Int k=0; k<Min(m,n); ++k )
+        entries.push_back( Entry<T>{k,k,T(k)} );
+    A.SetMany( entries );
+    for( Int k=0; k<Min(m,n); ++k )
+        if( A.Get(k,k) != T(k) )
+            LogicError
+            ("SetMany of [",DistToString(U),",",DistToString(V),
+             "] did not set entry (",k,",",k,")");
+
+    DistMatrixReadCache<T> cache( A, panelWidth );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( cache.Get(i,j) != A.Get(i,j) )
+                LogicError
+                ("Cached entry (",i,",",j,") of [",DistToString(U),",",
+                 DistToString(V),"] disagreed with Get");
+    const Int numPanels = (n+panelWidth-1) / panelWidth;
+    if( cache.NumMisses() != numPanels )
+        LogicError
+        ("Expected ",numPanels," cache misses but there were ",
+         cache.NumMisses());
+
+    // Modify the matrix and ensure that invalidation refreshes the cache
+    A.Set( 0, n-1, T(-1) );
+    cache.Invalidate();
+    if( cache.Get(0,n-1) != T(-1) )
+        LogicError("Cache was not refreshed after invalidation");
+
+    OutputFromRoot
+    (g.Comm(),"[",DistToString(U),",",DistToString(V),"]: PASSED");
+}
+
+template<typename T>
+void TestGets( const Grid& g, Int m, Int n, Int panelWidth )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    TestGetMany<T,MC,  MR  >( g, m, n, panelWidth );
+    TestGetMany<T,MD,  STAR>( g, m, n, panelWidth );
+    TestGetMany<T,VR,  STAR>( g, m, n, panelWidth );
+    TestGetMany<T,STAR,MC  >( g, m, n, panelWidth );
+    TestGetMany<T,STAR,STAR>( g, m, n, panelWidth );
+    TestGetMany<T,CIRC,CIRC>( g, m, n, panelWidth );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int m = Input("--height","height of matrix",40);
+        const Int n = Input("--width","width of matrix",30);
+        const Int panelWidth = Input("--panelWidth","cache panel width",8);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid g( comm, gridHeight );
+
+        TestGets<double>( g, m, n, panelWidth );
+        TestGets<Complex<double>>( g, m, n, panelWidth );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
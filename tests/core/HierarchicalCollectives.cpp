@@ -0,0 +1,87 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestCollectives( Int n, mpi::Comm flatComm, mpi::Comm twoLevelComm )
+{
+    OutputFromRoot(flatComm,"Testing with ",TypeName<T>());
+    const int commSize = mpi::Size( flatComm );
+    const int commRank = mpi::Rank( flatComm );
+
+    // Use integer-valued entries so that the results are exact
+    vector<T> x(n*commSize);
+    for( Int i=0; i<n*commSize; ++i )
+        x[i] = T(Int(commRank+1)*(i%7) - 3);
+
+    vector<T> yFlat(n*commSize), yTwoLevel(n*commSize);
+    mpi::AllReduce( x.data(), yFlat.data(), n*commSize, flatComm );
+    mpi::AllReduce( x.data(), yTwoLevel.data(), n*commSize, twoLevelComm );
+    if( yFlat != yTwoLevel )
+        LogicError("AllReduce results differed");
+
+    mpi::AllGather( x.data(), n, yFlat.data(), n, flatComm );
+    mpi::AllGather( x.data(), n, yTwoLevel.data(), n, twoLevelComm );
+    if( yFlat != yTwoLevel )
+        LogicError("AllGather results differed");
+
+    vector<T> xFlat( x ), xTwoLevel( x );
+    vector<T> zFlat(n), zTwoLevel(n);
+    mpi::ReduceScatter( xFlat.data(), zFlat.data(), n, flatComm );
+    mpi::ReduceScatter( xTwoLevel.data(), zTwoLevel.data(), n, twoLevelComm );
+    if( zFlat != zTwoLevel )
+        LogicError("ReduceScatter results differed");
+
+    xFlat = x;
+    xTwoLevel = x;
+    mpi::ReduceScatter( xFlat.data(), n, mpi::MAX, flatComm );
+    mpi::ReduceScatter( xTwoLevel.data(), n, mpi::MAX, twoLevelComm );
+    if( !std::equal( xFlat.begin(), xFlat.begin()+n, xTwoLevel.begin() ) )
+        LogicError("In-place ReduceScatter results differed");
+
+    OutputFromRoot(flatComm,"PASSED");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","entries per process",100);
+        const bool permute =
+          Input("--permute","interleave the processes of the nodes?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        // Optionally reverse the ranks so that the processes of each node
+        // are not contiguous
+        const int commRank = mpi::Rank( mpi::COMM_WORLD );
+        const int key = ( permute ? -commRank : commRank );
+        mpi::Comm flatComm, twoLevelComm;
+        mpi::Split( mpi::COMM_WORLD, 0, key, flatComm );
+        mpi::Split( mpi::COMM_WORLD, 0, key, twoLevelComm );
+        const bool enabled = mpi::EnableHierarchicalCollectives( twoLevelComm );
+        OutputFromRoot
+        (flatComm,"Two-level collectives were ",(enabled?"":"not "),
+         "enabled");
+
+        TestCollectives<double>( n, flatComm, twoLevelComm );
+        TestCollectives<Complex<double>>( n, flatComm, twoLevelComm );
+
+        mpi::Free( twoLevelComm );
+        if( mpi::HierarchicalCollectives( twoLevelComm ) )
+            LogicError("Freeing the communicator did not deregister it");
+        mpi::Free( flatComm );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
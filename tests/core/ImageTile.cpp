@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the distributed tile against one computed from a full copy
+template<typename T,Dist U,Dist V>
+void TestReduction
+( const DistMatrix<T>& A, Int mPix, Int nPix, TileReduction reduction,
+  Base<T> tol )
+{
+    DistMatrix<T,U,V> B( A );
+    Matrix<double> tile;
+    const bool root = ImageTile( B, tile, mPix, nPix, reduction, false, tol );
+
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    if( !root )
+        return;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Matrix<double> tileRef, counts;
+    Zeros( tileRef, mPix, nPix );
+    Zeros( counts, mPix, nPix );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            const Int iPix = (i*mPix)/m;
+            const Int jPix = (j*nPix)/n;
+            const T alpha = A_STAR_STAR.GetLocal(i,j);
+            counts(iPix,jPix) += 1;
+            if( reduction == TILE_MEAN )
+                tileRef(iPix,jPix) += double(RealPart(alpha));
+            else if( reduction == TILE_MAX_ABS )
+                tileRef(iPix,jPix) =
+                  Max( tileRef(iPix,jPix), double(Abs(alpha)) );
+            else if( Abs(alpha) > tol )
+                tileRef(iPix,jPix) += 1;
+        }
+    }
+    if( reduction == TILE_MEAN )
+        for( Int jPix=0; jPix<nPix; ++jPix )
+            for( Int iPix=0; iPix<mPix; ++iPix )
+                tileRef(iPix,jPix) /= counts(iPix,jPix);
+
+    tileRef -= tile;
+    if( MaxNorm( tileRef ) > 1e-10 )
+        LogicError
+        ("Tile of [",DistToString(U),",",DistToString(V),"] matrix with ",
+         "reduction ",reduction," was incorrect");
+}
+
+template<typename T>
+void TestImageTile( const Grid& g, Int m, Int n, Int mPix, Int nPix )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    for( const TileReduction reduction :
+         { TILE_MEAN, TILE_MAX_ABS, TILE_NONZERO_COUNT } )
+    {
+        TestReduction<T,MC,MR>( A, mPix, nPix, reduction, Base<T>(0.5) );
+        TestReduction<T,VC,STAR>( A, mPix, nPix, reduction, Base<T>(0.5) );
+        TestReduction<T,STAR,STAR>( A, mPix, nPix, reduction, Base<T>(0.5) );
+    }
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",203);
+        const Int n = Input("--width","width of matrix",151);
+        const Int mPix = Input("--mPix","height of tile",17);
+        const Int nPix = Input("--nPix","width of tile",13);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestImageTile<double>( g, m, n, mPix, nPix );
+        TestImageTile<Complex<float>>( g, m, n, mPix, nPix );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
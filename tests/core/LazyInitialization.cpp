@@ -0,0 +1,60 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+void TestLazyTypes()
+{
+    const bool eager = std::getenv("EL_MPI_EAGER_TYPES") != nullptr;
+    if( !eager && mpi::CreatedCustom(mpi::FLOAT_FAMILY) )
+        LogicError("The float types were created within El::Initialize");
+
+    // The first MaxLoc over ValueInt<float> creates the whole float family
+    const int commRank = mpi::Rank( mpi::COMM_WORLD );
+    const int commSize = mpi::Size( mpi::COMM_WORLD );
+    ValueInt<float> pivot;
+    pivot.value = float(commRank);
+    pivot.index = commRank;
+    pivot = mpi::AllReduce( pivot, mpi::MaxLocOp<float>(), mpi::COMM_WORLD );
+    if( !mpi::CreatedCustom(mpi::FLOAT_FAMILY) )
+        LogicError("The float types were not created upon first use");
+    if( pivot.index != commSize-1 )
+        LogicError("MaxLoc returned index ",pivot.index);
+}
+
+void TestLazyGrids()
+{
+    if( Grid::HaveDefault() || Grid::HaveTrivial() )
+        LogicError("The default grids were built within El::Initialize");
+    DistMatrix<double> A( 10, 10 );
+    if( !Grid::HaveDefault() || Grid::HaveTrivial() )
+        LogicError("The default grid was not built upon first request");
+    if( A.Grid().Size() != mpi::Size(mpi::COMM_WORLD) )
+        LogicError("The default grid did not span COMM_WORLD");
+    if( Grid::Trivial().Size() != 1 )
+        LogicError("The trivial grid was not a single process");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        TestLazyGrids();
+        TestLazyTypes();
+        OutputFromRoot(mpi::COMM_WORLD,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
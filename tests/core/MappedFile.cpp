@@ -0,0 +1,63 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestMappedFile( Int m, Int n, const string& basename )
+{
+    Output("Testing with ",TypeName<T>());
+    Matrix<T> A;
+    Uniform( A, m, n );
+
+    for( const FileFormat format : { BINARY, BINARY_FLAT } )
+    {
+        Write( A, basename, format );
+        const string filename = basename + "." + FileExtension(format);
+        {
+            MappedFile file( filename );
+            Matrix<T> B;
+            if( format == BINARY )
+                MapBinary( B, file );
+            else
+                MapBinaryFlat( B, file, m, n );
+            if( !B.Locked() || B.Height() != m || B.Width() != n )
+                LogicError("Mapped matrix was not a locked m x n view");
+            Matrix<T> E( B );
+            E -= A;
+            if( FrobeniusNorm( E ) != Base<T>(0) )
+                LogicError
+                ("Mapped ",FileExtension(format)," file was incorrect");
+        }
+        std::remove( filename.c_str() );
+    }
+    Output("passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",57);
+        const Int n = Input("--width","width of matrix",31);
+        ProcessInput();
+        PrintInputReport();
+
+        // Each process maps its own files
+        const string basename =
+          "MappedFile" + std::to_string(mpi::Rank(mpi::COMM_WORLD));
+        TestMappedFile<float>( m, n, basename );
+        TestMappedFile<Complex<double>>( m, n, basename );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
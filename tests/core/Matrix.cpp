@@ -38,6 +38,36 @@ void TestMatrix( Int m, Int n, Int ldim )
     Output("passed");
 }
 
+template<typename T>
+void TestAllocationPolicy( Int m, Int n )
+{
+    Output("Testing allocation policy with ",TypeName<T>());
+
+    AllocationPolicy policy;
+    policy.hugePages = TRANSPARENT_HUGE_PAGES;
+    policy.numa = NUMA_INTERLEAVE;
+    policy.minBytes = 0;
+
+    Matrix<T> A;
+    A.SetAllocationPolicy( policy );
+    A.Resize( m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            A.Set( i, j, T(i+j*m) );
+
+    Matrix<T> B( A );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A.Get(i,j) != T(i+j*m) || B.Get(i,j) != T(i+j*m) )
+                LogicError("Policy-allocated matrix was not properly filled");
+
+    // Force a reallocation
+    A.Resize( 2*m, 2*n );
+    A.Empty();
+
+    Output("passed");
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -58,6 +88,9 @@ main( int argc, char* argv[] )
             TestMatrix<double>( m, n, ldim );
             TestMatrix<Complex<double>>( m, n, ldim );
 
+            TestAllocationPolicy<float>( m, n );
+            TestAllocationPolicy<Complex<double>>( m, n );
+
 #ifdef EL_HAVE_QD
             TestMatrix<DoubleDouble>( m, n, ldim );
             TestMatrix<QuadDouble>( m, n, ldim );
@@ -0,0 +1,104 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+void TestTracking( Int n )
+{
+    const size_t matrixBytes = n*n*sizeof(double);
+    const size_t bytesLive = GetMemoryStats().bytesLive;
+    ResetMemoryPeak();
+    {
+        Matrix<double> A( n, n );
+        if( GetMemoryStats().bytesLive != bytesLive+matrixBytes )
+            LogicError("The allocation was not tracked");
+    }
+    const MemoryStats stats = GetMemoryStats();
+    if( stats.bytesLive != bytesLive )
+        LogicError("The deallocation was not tracked");
+    if( stats.bytesPeak < bytesLive+matrixBytes )
+        LogicError("The peak usage was not tracked");
+
+    EnableMemoryTracking();
+    {
+        EL_TRACE_REGION("Outer");
+        Matrix<double> A( n, n );
+        {
+            EL_TRACE_REGION("Inner");
+            Matrix<double> B( n, n );
+        }
+    }
+    DisableMemoryTracking();
+    const auto regions = RegionMemoryStats();
+    if( regions.size() != 2 || regions[0].region != "Outer" ||
+        regions[1].region != "Outer > Inner" )
+        LogicError("The regions were not recorded");
+    // The outer region includes the allocations of the inner one
+    if( regions[0].bytesAllocated != 2*matrixBytes ||
+        regions[1].bytesAllocated != matrixBytes )
+        LogicError("The allocations of the regions were incorrect");
+    if( regions[0].bytesPeak < bytesLive+2*matrixBytes ||
+        regions[1].bytesPeak < bytesLive+2*matrixBytes )
+        LogicError("The peaks of the regions were incorrect");
+}
+
+void TestBudget( Int n )
+{
+    const size_t matrixBytes = n*n*sizeof(double);
+    const size_t bytesLive = GetMemoryStats().bytesLive;
+
+    SetMemoryBudget( bytesLive+matrixBytes/2, true );
+    if( MemoryHeadroom() != matrixBytes/2 || FitsMemoryBudget(matrixBytes) )
+        LogicError("The headroom was incorrect");
+    if( BudgetedCount( 10, matrixBytes/8 ) != 4 ||
+        BudgetedCount( 10, matrixBytes, 2 ) != 2 )
+        LogicError("The budgeted counts were incorrect");
+    bool threw = false;
+    try { Matrix<double> A( n, n ); }
+    catch( std::exception& ) { threw = true; }
+    if( !threw )
+        LogicError("The enforced budget was exceeded");
+
+    // Unenforced budgets only guide the choice of algorithms, e.g., the
+    // sign function should fall back to the Newton iteration
+    Matrix<double> A;
+    Identity( A, n, n );
+    A *= 2;
+    SetMemoryBudget( GetMemoryStats().bytesLive+matrixBytes );
+    SignCtrl<double> ctrl;
+    ctrl.method = SIGN_PADE;
+    Sign( A, ctrl );
+    SetMemoryBudget( 0 );
+    if( MemoryHeadroom() != std::numeric_limits<size_t>::max() )
+        LogicError("The budget was not removed");
+    Matrix<double> I;
+    Identity( I, n, n );
+    A -= I;
+    if( FrobeniusNorm(A) > n*limits::Epsilon<double>() )
+        LogicError("The sign function was incorrect under a budget");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","matrix size",100);
+        ProcessInput();
+        PrintInputReport();
+
+        TestTracking( n );
+        TestBudget( n );
+        OutputFromRoot(mpi::COMM_WORLD,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestMemoryPool( Int m, Int n, Int numIts )
+{
+    Output("Testing with ",TypeName<T>());
+    EmptyMemoryPool();
+    ResetMemoryPoolStats();
+    const MemoryPoolStats initStats = GetMemoryPoolStats();
+
+    for( Int it=0; it<numIts; ++it )
+    {
+        Matrix<T> A, B;
+        Uniform( A, m, n );
+        Zeros( B, m, n );
+        Copy( A, B );
+        if( A.Get(m/2,n/2) != B.Get(m/2,n/2) )
+            LogicError("Pooled buffer was corrupted");
+    }
+
+    const MemoryPoolStats stats = GetMemoryPoolStats();
+    if( stats.bytesLive != initStats.bytesLive )
+        LogicError("Pooled allocator leaked ",stats.bytesLive," bytes");
+    if( stats.bytesPeak < size_t(m*n)*sizeof(T) )
+        LogicError("Peak memory usage was not properly tracked");
+    if( numIts > 1 && stats.numHits == 0 )
+        LogicError("Pooled allocator never reused a buffer");
+    Output
+    ("  peak bytes: ",stats.bytesPeak,", hit rate: ",stats.HitRate());
+
+    // Ensure that the cap is respected
+    EmptyMemoryPool();
+    SetMemoryPoolCap( 0 );
+    {
+        Matrix<T> A( m, n );
+    }
+    if( GetMemoryPoolStats().bytesCached != 0 )
+        LogicError("Pooled allocator exceeded its cap");
+    SetMemoryPoolCap( std::numeric_limits<size_t>::max() );
+
+    Output("passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const Int numIts = Input("--numIts","number of iterations",10);
+        ProcessInput();
+        PrintInputReport();
+
+        EnableMemoryPool();
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            TestMemoryPool<float>( m, n, numIts );
+            TestMemoryPool<Complex<float>>( m, n, numIts );
+
+            TestMemoryPool<double>( m, n, numIts );
+            TestMemoryPool<Complex<double>>( m, n, numIts );
+        }
+        DisableMemoryPool();
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
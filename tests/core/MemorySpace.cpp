@@ -0,0 +1,84 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A trivial arena which tracks the number of live bytes
+size_t arenaBytes = 0;
+
+void* ArenaAllocate( size_t numBytes )
+{
+    arenaBytes += numBytes;
+    return std::malloc( numBytes );
+}
+
+void ArenaFree( void* ptr, size_t numBytes )
+{
+    arenaBytes -= numBytes;
+    std::free( ptr );
+}
+
+template<typename T>
+void TestMemorySpace( MemorySpace space, Int m, Int n )
+{
+    Output("Testing with ",TypeName<T>());
+    AllocationPolicy policy;
+    policy.space = space;
+    {
+        Matrix<T> A;
+        A.SetAllocationPolicy( policy );
+        A.Resize( m, n );
+        if( A.MemorySpace() != space )
+            LogicError("Buffer was not allocated in the requested space");
+        if( arenaBytes < size_t(m*n)*sizeof(T) )
+            LogicError("Buffer was not allocated by the registered allocator");
+        if( HostAccessible( space ) )
+        {
+            Uniform( A, m, n );
+            Matrix<T> B( A );
+            B -= A;
+            if( FrobeniusNorm( B ) != Base<T>(0) )
+                LogicError("Copy of user-allocated buffer was incorrect");
+        }
+    }
+    if( arenaBytes != 0 )
+        LogicError("Registered allocator leaked ",arenaBytes," bytes");
+    Output("passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        ProcessInput();
+        PrintInputReport();
+
+        Allocator arena;
+        arena.allocate = ArenaAllocate;
+        arena.free = ArenaFree;
+        SetAllocator( USER_MEMORY, arena );
+        // Host memory stands in for a device that the tests cannot assume
+        SetAllocator( DEVICE_MEMORY, arena );
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            TestMemorySpace<float>( USER_MEMORY, m, n );
+            TestMemorySpace<Complex<double>>( USER_MEMORY, m, n );
+            TestMemorySpace<double>( DEVICE_MEMORY, m, n );
+        }
+        ClearAllocator( USER_MEMORY );
+        ClearAllocator( DEVICE_MEMORY );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
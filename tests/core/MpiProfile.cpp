@@ -0,0 +1,82 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+void TestProfile( Int n, const string& filename )
+{
+    const Grid& g = Grid::Default();
+    DistMatrix<double> A(g);
+    Uniform( A, n, n );
+
+    mpi::EnableProfiling( true );
+    {
+        EL_TRACE_REGION("Sum");
+        for( Int trial=0; trial<3; ++trial )
+            mpi::AllReduce( A.Matrix().Buffer(), A.LocalHeight(), g.MCComm() );
+    }
+    LU( A );
+    mpi::DisableProfiling();
+
+    // Three all-reductions over the MC communicator from the "Sum" region
+    bool found = false;
+    for( const auto& profile : mpi::Profile() )
+    {
+        if( profile.comm == "MC" && profile.call == "AllReduce" &&
+            profile.site == "Sum" )
+        {
+            found = true;
+            if( profile.numCalls != 3 )
+                LogicError("Recorded ",profile.numCalls," calls rather than 3");
+            const double numBytes = 3.*A.LocalHeight()*sizeof(double);
+            if( profile.numBytes != numBytes )
+                LogicError
+                ("Recorded ",profile.numBytes," bytes rather than ",numBytes);
+            Int numHistogramCalls = 0;
+            for( Int bucket=0; bucket<mpi::PROFILE_NUM_BUCKETS; ++bucket )
+                numHistogramCalls += profile.histogram[bucket];
+            if( numHistogramCalls != 3 )
+                LogicError("Histogram did not account for every call");
+        }
+    }
+    if( !found )
+        LogicError("The MC all-reductions were not profiled");
+
+    // Profiling should stop recording once disabled
+    const Int numProfiles = mpi::Profile().size();
+    mpi::AllReduce( A.Matrix().Buffer(), A.LocalHeight(), g.MCComm() );
+    if( Int(mpi::Profile().size()) != numProfiles )
+        LogicError("Profile changed while profiling was disabled");
+
+    mpi::WriteProfile( filename );
+    mpi::ResetProfile();
+    if( !mpi::Profile().empty() )
+        LogicError("Profile was not reset");
+
+    OutputFromRoot(mpi::COMM_WORLD,"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","matrix size",100);
+        const string filename =
+          Input("--filename","profile file",string("MpiProfile.txt"));
+        ProcessInput();
+        PrintInputReport();
+
+        TestProfile( n, filename );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Write A in the given format and read it back into a matrix with a
+// (generally) different distribution, both in parallel and sequentially
+template<typename T,Dist U,Dist V,DistWrap wrap=ELEMENT>
+void TestRoundTrip
+( const DistMatrix<T>& A, FileFormat format, const string& basename )
+{
+    const Grid& g = A.Grid();
+    Write( A, basename, format );
+    const string filename = basename + "." + FileExtension(format);
+
+    for( const bool sequential : { false, true } )
+    {
+        DistMatrix<T,U,V,wrap> B(g);
+        if( format == BINARY_FLAT )
+            B.Resize( A.Height(), A.Width() );
+        Read( B, filename, format, sequential );
+        if( B.Height() != A.Height() || B.Width() != A.Width() )
+            LogicError("Read matrix had the wrong dimensions");
+        DistMatrix<T> E( B );
+        E -= A;
+        if( FrobeniusNorm( E ) != Base<T>(0) )
+            LogicError
+            ("Reading ",FileExtension(format)," file into [",DistToString(U),
+             ",",DistToString(V),"] was incorrect (sequential=",sequential,
+             ")");
+    }
+    mpi::Barrier( g.Comm() );
+    if( g.Rank() == 0 )
+        std::remove( filename.c_str() );
+}
+
+template<typename T>
+void TestParallelIO( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    for( const FileFormat format : { BINARY, BINARY_FLAT } )
+    {
+        TestRoundTrip<T,MC,MR>( A, format, "ParallelIO" );
+        TestRoundTrip<T,VC,STAR>( A, format, "ParallelIO" );
+        TestRoundTrip<T,STAR,STAR>( A, format, "ParallelIO" );
+        TestRoundTrip<T,MC,MR,BLOCK>( A, format, "ParallelIO" );
+    }
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",67);
+        const Int n = Input("--width","width of matrix",43);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestParallelIO<double>( g, m, n );
+        TestParallelIO<Complex<float>>( g, m, n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+PerfCounter FindCounter( const string& routine )
+{
+    for( const auto& counter : PerfCounters() )
+        if( counter.routine == routine )
+            return counter;
+    LogicError("There was no counter for ",routine);
+    return PerfCounter();
+}
+
+void TestPerfCounters( Int n )
+{
+    Matrix<double> A, B, C;
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+    Zeros( C, n, n );
+
+    EnablePerfCounters();
+    for( Int rep=0; rep<2; ++rep )
+    {
+        EL_TRACE_REGION("Outer");
+        Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+    }
+    // Nested regions are attributed to the outermost one
+    const PerfCounter outer = FindCounter( "Outer" );
+    const double gemmFlops = 2.*n*n*n;
+    const double gemmBytes = 4.*n*n*sizeof(double);
+    if( outer.numCalls != 2 )
+        LogicError("Outer was entered ",outer.numCalls," times, not twice");
+    if( outer.numFlops != 2*gemmFlops )
+        LogicError
+        ("Outer performed ",outer.numFlops," flops rather than ",2*gemmFlops);
+    if( outer.numBytes != 2*gemmBytes )
+        LogicError
+        ("Outer touched ",outer.numBytes," bytes rather than ",2*gemmBytes);
+
+    // Work outside of any region is attributed to "Other"
+    Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+    if( FindCounter("Other").numFlops != gemmFlops )
+        LogicError("Unattributed flops were not counted");
+
+    // The local LAPACK wrappers are counted as well
+    Matrix<double> H, w;
+    HermitianUniformSpectrum( H, n, -1, 1 );
+    w.Resize( n, 1 );
+    {
+        EL_TRACE_REGION("LocalEig");
+        lapack::HermitianEig( 'L', n, H.Buffer(), H.LDim(), w.Buffer() );
+    }
+    const PerfCounter localEig = FindCounter( "LocalEig" );
+    if( localEig.numFlops != (4./3)*n*n*n ||
+        localEig.numBytes != 2.*n*n*sizeof(double) )
+        LogicError("The local Hermitian eigensolver was not counted");
+
+    // Top-level routines open their own regions
+    HermitianUniformSpectrum( H, n, -1, 1 );
+    HermitianEig( LOWER, H, w );
+    if( FindCounter("HermitianEig").numCalls != 1 )
+        LogicError("HermitianEig was not counted");
+
+    ResetPerfCounters();
+    if( !PerfCounters().empty() )
+        LogicError("The counters were not reset");
+
+    // The hooks should be inert when the counters are disabled
+    DisablePerfCounters();
+    {
+        EL_TRACE_REGION("Uncounted");
+        Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+    }
+    if( PerfCountersEnabled() || !PerfCounters().empty() )
+        LogicError("The counters were not disabled");
+
+    OutputFromRoot(mpi::COMM_WORLD,"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","matrix size",100);
+        ProcessInput();
+        PrintInputReport();
+
+        TestPerfCounters( n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
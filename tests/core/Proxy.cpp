@@ -0,0 +1,110 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Ensure that a [U,V] read proxy of A holds the same entries as a
+// redistributed copy and that it only copies when the layouts differ
+template<typename T,Dist U,Dist V>
+void TestReadProxy( const DistMatrix<T>& A )
+{
+    const Grid& g = A.Grid();
+    const bool expectView =
+      proxy::EquivalentDist( U, g ) == proxy::EquivalentDist( MC, g ) &&
+      proxy::EquivalentDist( V, g ) == proxy::EquivalentDist( MR, g );
+
+    DistMatrixReadProxy<T,T,U,V> AProx( A );
+    const auto& AView = AProx.GetLocked();
+    const bool viewed =
+      mpi::AllReduce
+      ( int(AView.LockedBuffer() == A.LockedBuffer()), mpi::MIN, g.Comm() );
+    if( A.LocalHeight()*A.LocalWidth() > 0 && viewed != expectView )
+        LogicError
+        ("[",DistToString(U),",",DistToString(V),"] read proxy ",
+         (viewed?"unexpectedly viewed":"unexpectedly copied"));
+
+    DistMatrix<T,U,V> ACopy( A );
+    DistMatrix<T> E( AView );
+    E -= DistMatrix<T>( ACopy );
+    if( FrobeniusNorm( E ) != Base<T>(0) )
+        LogicError
+        ("[",DistToString(U),",",DistToString(V),"] read proxy was incorrect");
+    OutputFromRoot
+    (g.Comm(),"[",DistToString(U),",",DistToString(V),"]: ",
+     (viewed?"viewed":"copied"));
+}
+
+template<typename T>
+void TestReadWriteProxy( const DistMatrix<T>& A )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<T> B( A ), BCopy( A );
+    {
+        DistMatrixReadWriteProxy<T,T,VC,STAR> BProx( B );
+        BProx.Get() *= T(2);
+    }
+    BCopy *= T(2);
+    BCopy -= B;
+    if( FrobeniusNorm( BCopy ) != Base<T>(0) )
+        LogicError("[VC,* ] read/write proxy was incorrect");
+    OutputFromRoot(g.Comm(),"[VC,* ] read/write proxy was correct");
+}
+
+template<typename T>
+void TestProxies( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    TestReadProxy<T,MC,  MR  >( A );
+    TestReadProxy<T,STAR,STAR>( A );
+    TestReadProxy<T,VC,  STAR>( A );
+    TestReadProxy<T,VR,  STAR>( A );
+    TestReadProxy<T,STAR,VC  >( A );
+    TestReadProxy<T,STAR,VR  >( A );
+    TestReadProxy<T,MR,  MC  >( A );
+    TestReadWriteProxy( A );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",50);
+        const Int n = Input("--width","width of matrix",30);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
+        const Grid g( comm, gridHeight, order );
+
+        TestProxies<double>( g, m, n );
+        TestProxies<Complex<double>>( g, m, n );
+
+        // Every process row is a 1 x c grid and every process column a
+        // r x 1 grid, over which more distributions coincide
+        const Grid rowGrid( g.RowComm(), 1, order );
+        TestProxies<double>( rowGrid, m, n );
+        const Grid colGrid( g.ColComm(), g.Height(), order );
+        TestProxies<double>( colGrid, m, n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Every process queues 'numRepeats' updates of each entry of an m x n matrix
+// so that every entry of the result should equal numRepeats*commSize*(i+j)
+template<typename T,Dist U,Dist V>
+void TestQueueUpdate( const Grid& g, Int m, Int n, Int numRepeats )
+{
+    const int commSize = mpi::Size( g.Comm() );
+    DistMatrix<T,U,V> A(g);
+    Zeros( A, m, n );
+
+    A.Reserve( numRepeats*m*n );
+#ifdef EL_HYBRID
+    #pragma omp parallel for
+#endif
+    for( Int j=0; j<n; ++j )
+        for( Int rep=0; rep<numRepeats; ++rep )
+            for( Int i=0; i<m; ++i )
+                A.QueueUpdate( i, j, T(i+j) );
+    A.ProcessQueues();
+
+    DistMatrix<T,U,V> E(g);
+    Zeros( E, m, n );
+    for( Int jLoc=0; jLoc<E.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<E.LocalHeight(); ++iLoc )
+            E.SetLocal
+            ( iLoc, jLoc,
+              T(numRepeats*commSize*(E.GlobalRow(iLoc)+E.GlobalCol(jLoc))) );
+    E -= A;
+    if( FrobeniusNorm( E ) != Base<T>(0) )
+        LogicError
+        ("Queued updates of [",DistToString(U),",",DistToString(V),
+         "] matrix were incorrect");
+    OutputFromRoot
+    (g.Comm(),"[",DistToString(U),",",DistToString(V),"]: PASSED");
+}
+
+template<typename T>
+void TestQueues( const Grid& g, Int m, Int n, Int numRepeats )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    TestQueueUpdate<T,MC,  MR  >( g, m, n, numRepeats );
+    TestQueueUpdate<T,VC,  STAR>( g, m, n, numRepeats );
+    TestQueueUpdate<T,STAR,STAR>( g, m, n, numRepeats );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int m = Input("--height","height of matrix",40);
+        const Int n = Input("--width","width of matrix",30);
+        const Int numRepeats = Input("--numRepeats","updates per entry",3);
+        const Int roundSize =
+          Input("--roundSize","entries sent per round",Int(100));
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid g( comm, gridHeight );
+        SetQueueRoundSize( roundSize );
+
+        TestQueues<double>( g, m, n, numRepeats );
+        TestQueues<Complex<double>>( g, m, n, numRepeats );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T,Dist U,Dist V>
+void CheckEqual
+( const DistMatrix<T,U,V>& B, const DistMatrix<T,U,V>& BRef,
+  const string& name )
+{
+    if( B.Height() != BRef.Height() || B.Width() != BRef.Width() )
+        LogicError(name," had the wrong dimensions");
+    DistMatrix<T> E( B );
+    E -= BRef;
+    if( FrobeniusNorm( E ) != Base<T>(0) )
+        LogicError(name," did not match the unbatched redistribution");
+}
+
+template<typename T>
+void TestBatch( const Grid& grid, Int m, Int n )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<T>());
+    DistMatrix<T> AFull(grid);
+    Uniform( AFull, m+3, n+2 );
+    // Offset views so that the sources are not aligned with the grid
+    auto A = AFull( IR(1,m+1), IR(2,n+2) );
+    DistMatrix<T,VC,STAR> A_VC_STAR( AFull );
+    DistMatrix<T,STAR,VR> A_STAR_VR( AFull );
+    auto AVC = A_VC_STAR( IR(3,m+3), IR(0,n) );
+    auto AVR = A_STAR_VR( IR(1,m+1), IR(1,n+1) );
+
+    DistMatrix<T,MC,STAR> B_MC_STAR(grid);
+    DistMatrix<T,STAR,MR> B_STAR_MR(grid);
+    DistMatrix<T,STAR,STAR> B_STAR_STAR(grid), C_STAR_STAR(grid),
+      D_STAR_STAR(grid);
+    DistMatrix<T,VR,STAR> B_VR_STAR(grid);
+
+    RedistBatch<T> batch;
+    batch.Queue( A, B_MC_STAR );
+    batch.Queue( A, B_STAR_MR );
+    batch.Queue( A, B_STAR_STAR );
+    batch.Queue( AVC, C_STAR_STAR );
+    batch.Queue( AVR, D_STAR_STAR );
+    // Not a gather, so this one falls back to Copy
+    batch.Queue( A, B_VR_STAR );
+    if( batch.NumQueued() != 6 )
+        LogicError("The redistributions were not queued");
+    batch.Execute();
+    if( batch.NumQueued() != 0 )
+        LogicError("The batch was not emptied");
+
+    CheckEqual( B_MC_STAR, DistMatrix<T,MC,STAR>(A), "A[MC,* ]" );
+    CheckEqual( B_STAR_MR, DistMatrix<T,STAR,MR>(A), "A[* ,MR]" );
+    CheckEqual( B_STAR_STAR, DistMatrix<T,STAR,STAR>(A), "A[* ,* ]" );
+    CheckEqual( C_STAR_STAR, DistMatrix<T,STAR,STAR>(AVC), "AVC[* ,* ]" );
+    CheckEqual( D_STAR_STAR, DistMatrix<T,STAR,STAR>(AVR), "AVR[* ,* ]" );
+    CheckEqual( B_VR_STAR, DistMatrix<T,VR,STAR>(A), "A[VR,* ]" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--m","height of matrix",50);
+        const Int n = Input("--n","width of matrix",30);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( mpi::COMM_WORLD );
+        TestBatch<double>( grid, m, n );
+        TestBatch<Complex<float>>( grid, m, n );
+        OutputFromRoot(mpi::COMM_WORLD,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+void TestSplitGrid( const Grid& grid )
+{
+    const int p = grid.Size();
+    vector<double> weights( Min(p,3) );
+    for( Int i=0; i<Int(weights.size()); ++i )
+        weights[i] = i+1;
+    auto subgrids = SplitGrid( grid, weights );
+    int numProcs = 0, numOwned = 0;
+    for( const auto& subgrid : subgrids )
+    {
+        if( subgrid->Size() < 1 )
+            LogicError("A subgrid was empty");
+        numProcs += subgrid->Size();
+        if( subgrid->InGrid() )
+            ++numOwned;
+    }
+    if( numProcs != p || numOwned != 1 )
+        LogicError("The subgrids did not partition the grid");
+}
+
+// Form each block of columns of C := A B over its own subgrid
+void TestBlocks( const Grid& grid, Int n, Int numBlocks, Int numThreads )
+{
+    DistMatrix<double> A(grid), B(grid), C(grid), CFull(grid);
+    Uniform( A, n, n );
+    Uniform( B, n, numBlocks*n );
+    Zeros( C, n, numBlocks*n );
+    Zeros( CFull, n, numBlocks*n );
+    Gemm( NORMAL, NORMAL, 1., A, B, 0., CFull );
+
+    vector<DistMatrix<double>> ASubs( numBlocks ), BSubs( numBlocks );
+    vector<Subproblem> subproblems( numBlocks );
+    for( Int k=0; k<numBlocks; ++k )
+    {
+        auto ind = IR(k*n,(k+1)*n);
+        // Make the work uneven so that the subgrids differ in size
+        subproblems[k].work = k+1;
+        subproblems[k].push = [&,k,ind]( const Grid& subgrid )
+          {
+              ASubs[k].SetGrid( subgrid );
+              BSubs[k].SetGrid( subgrid );
+              ASubs[k] = A;
+              BSubs[k] = B( ALL, ind );
+          };
+        subproblems[k].solve = [&,k]( const Grid& subgrid )
+          {
+              // Solves which share a process only touch local matrices
+              if( subgrid.Size() == 1 )
+              {
+                  auto BLoc( BSubs[k].Matrix() );
+                  Gemm
+                  ( NORMAL, NORMAL,
+                    1., ASubs[k].LockedMatrix(), BLoc,
+                    0., BSubs[k].Matrix() );
+              }
+              else
+              {
+                  auto BCopy( BSubs[k] );
+                  Gemm( NORMAL, NORMAL, 1., ASubs[k], BCopy, 0., BSubs[k] );
+              }
+          };
+        subproblems[k].pull = [&,k,ind]()
+          {
+              if( BSubs[k].Grid() != grid )
+              {
+                  bool includeViewers = true;
+                  BSubs[k].MakeConsistent( includeViewers );
+              }
+              auto CBlock = C( ALL, ind );
+              CBlock = BSubs[k];
+              ASubs[k].Empty();
+              BSubs[k].Empty();
+          };
+    }
+    SubproblemCtrl ctrl;
+    ctrl.numThreads = numThreads;
+    RunSubproblems( grid, subproblems, ctrl );
+
+    C -= CFull;
+    const double error = FrobeniusNorm( C );
+    const double tol = 10*n*limits::Epsilon<double>()*FrobeniusNorm( CFull );
+    if( error > tol )
+        LogicError
+        ("The ",numBlocks," subproblems had an error of ",error," > ",tol);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","size of each block",50);
+        const Int numThreads = Input("--numThreads","threads per process",2);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( mpi::COMM_WORLD );
+        TestSplitGrid( grid );
+        // Fewer, as many, and more subproblems than processes
+        TestBlocks( grid, n, 1, numThreads );
+        TestBlocks( grid, n, grid.Size(), numThreads );
+        TestBlocks( grid, n, 2*grid.Size()+1, numThreads );
+        OutputFromRoot(mpi::COMM_WORLD,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
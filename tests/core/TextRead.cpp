@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A symmetric coordinate file with a duplicated entry, blank lines, and
+// numbers which exercise both the exact and the fallback conversions
+const char* coordinateFile =
+  "%%MatrixMarket matrix coordinate real symmetric\n"
+  "% comment\n"
+  "4 4 6\n"
+  "1 1 1.5\n"
+  "2 1 -2.25e-3\n"
+  "\n"
+  "3 2 0.1\n"
+  "4 4 1e-310\n"
+  "4 3 12345678901234567890\n"
+  "4 3 +7\n";
+
+const char* asciiFile =
+  "1 2 3\n"
+  "  4 5.5 -6e2  \n"
+  "\n"
+  "7 8 9\r\n";
+
+template<typename T>
+void CheckEqual( const Matrix<T>& A, const Matrix<T>& B, const string& msg )
+{
+    Matrix<T> E( A );
+    E -= B;
+    if( FrobeniusNorm( E ) != Base<T>(0) )
+        LogicError(msg," was incorrect");
+}
+
+void TestTextRead( const Grid& g, const string& basename )
+{
+    Matrix<double> ACoord;
+    Zeros( ACoord, 4, 4 );
+    ACoord(0,0) = 1.5;
+    ACoord(1,0) = ACoord(0,1) = -2.25e-3;
+    ACoord(2,1) = ACoord(1,2) = 0.1;
+    ACoord(3,3) = std::strtod( "1e-310", nullptr );
+    ACoord(3,2) = ACoord(2,3) =
+      std::strtod( "12345678901234567890", nullptr ) + 7;
+
+    Matrix<double> AAscii( 3, 3 );
+    AAscii(0,0) = 1; AAscii(0,1) = 2;   AAscii(0,2) = 3;
+    AAscii(1,0) = 4; AAscii(1,1) = 5.5; AAscii(1,2) = -600;
+    AAscii(2,0) = 7; AAscii(2,1) = 8;   AAscii(2,2) = 9;
+
+    const string coordName = basename + ".mm";
+    const string asciiName = basename + ".txt";
+    if( g.Rank() == 0 )
+    {
+        std::ofstream( coordName.c_str() ) << coordinateFile;
+        std::ofstream( asciiName.c_str() ) << asciiFile;
+    }
+    mpi::Barrier( g.Comm() );
+
+    Matrix<double> A;
+    Read( A, coordName, MATRIX_MARKET );
+    CheckEqual( A, ACoord, "Sequential Matrix Market read" );
+    Read( A, asciiName, ASCII );
+    CheckEqual( A, AAscii, "Sequential ASCII read" );
+
+    DistMatrix<double> ADist(g);
+    DistMatrix<double,VC,STAR> BDist(g);
+    Read( ADist, coordName, MATRIX_MARKET );
+    Read( BDist, coordName, MATRIX_MARKET );
+    DistMatrix<double,CIRC,CIRC> ARoot( ADist ), BRoot( BDist );
+    if( ARoot.CrossRank() == ARoot.Root() )
+    {
+        CheckEqual( ARoot.Matrix(), ACoord, "Distributed Matrix Market read" );
+        CheckEqual( BRoot.Matrix(), ACoord, "Distributed Matrix Market read" );
+    }
+    Read( ADist, asciiName, ASCII );
+    ARoot = ADist;
+    if( ARoot.CrossRank() == ARoot.Root() )
+        CheckEqual( ARoot.Matrix(), AAscii, "Distributed ASCII read" );
+
+    mpi::Barrier( g.Comm() );
+    if( g.Rank() == 0 )
+    {
+        std::remove( coordName.c_str() );
+        std::remove( asciiName.c_str() );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        ProcessInput();
+        const Grid g( comm );
+        TestTextRead( g, "TextRead" );
+        OutputFromRoot(comm,"Text files were read correctly");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <fstream>
+#include <sstream>
+using namespace El;
+
+void TestTrace( Int n, const string& filename )
+{
+    const Grid& g = Grid::Default();
+    DistMatrix<double> A(g), B(g), C(g);
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+
+    EnableTracing();
+    {
+        EL_TRACE_REGION("Outer");
+        Gemm( NORMAL, NORMAL, 1., A, B, C );
+        {
+            EL_TRACE_REGION("Inner");
+            mpi::Barrier( g.Comm() );
+        }
+    }
+    WriteTrace( filename );
+    DisableTracing();
+
+    if( mpi::Rank() == 0 )
+    {
+        std::ifstream file( filename.c_str() );
+        std::stringstream contents;
+        contents << file.rdbuf();
+        const string trace = contents.str();
+        const char* expected[] =
+          { "\"traceEvents\"", "\"name\":\"Outer\"", "\"path\":\"Outer > Gemm\"",
+            "\"path\":\"Outer > Inner\"", "\"commBytes\"", "\"flops\"" };
+        for( const char* substring : expected )
+            if( trace.find( substring ) == string::npos )
+                LogicError("Trace did not contain ",substring);
+    }
+
+    // Hooks should be inert when tracing is disabled
+    {
+        EL_TRACE_REGION("Untraced");
+        Gemm( NORMAL, NORMAL, 1., A, B, C );
+    }
+    if( TracingEnabled() )
+        LogicError("Tracing was not disabled");
+
+    OutputFromRoot(mpi::COMM_WORLD,"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","matrix size",100);
+        const string filename =
+          Input("--filename","trace file",string("Trace.json"));
+        ProcessInput();
+        PrintInputReport();
+
+        TestTrace( n, filename );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Redistribute A while the given wire format is active and check that each
+// entry is within the relative error bound of the format
+template<typename T,Dist U,Dist V>
+void TestRedistribution
+( const DistMatrix<T>& A, mpi::WireFormat format, double bound )
+{
+    DistMatrix<T,U,V> B(A.Grid());
+    {
+        mpi::WireFormatGuard guard( format );
+        B = A;
+    }
+    if( mpi::GetWireFormat() != mpi::WIRE_FULL )
+        LogicError("Wire format was not restored");
+
+    DistMatrix<T> E( B );
+    E -= A;
+    const double relError = double(MaxNorm(E)) / double(MaxNorm(A));
+    if( relError > 2*bound )
+        LogicError
+        ("Relative error of ",relError," in redistribution to [",
+         DistToString(U),",",DistToString(V),"] exceeded bound of ",bound);
+}
+
+template<typename T>
+void TestWireFormat( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    const mpi::WireFormat formats[] =
+      { mpi::WIRE_FULL, mpi::WIRE_SINGLE, mpi::WIRE_BFLOAT16 };
+    const double bounds[] =
+      { double(limits::Epsilon<Base<T>>()), std::ldexp(1.,-24),
+        std::ldexp(1.,-8) };
+    for( Int k=0; k<3; ++k )
+    {
+        const double bound =
+          Max( bounds[k], double(limits::Epsilon<Base<T>>()) );
+        TestRedistribution<T,STAR,STAR>( A, formats[k], bound );
+        TestRedistribution<T,VC,STAR>( A, formats[k], bound );
+        TestRedistribution<T,MR,MC>( A, formats[k], bound );
+        TestRedistribution<T,STAR,VR>( A, formats[k], bound );
+    }
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",67);
+        const Int n = Input("--width","width of matrix",43);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestWireFormat<double>( g, m, n );
+        TestWireFormat<Complex<double>>( g, m, n );
+        TestWireFormat<float>( g, m, n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Start a background write of A, overwrite A while the write may still be in
+// progress, and check that the file holds the original entries
+template<typename T>
+void TestWriteAsync( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    const string basename = "WriteAsync";
+    const string filename = basename + "." + FileExtension(BINARY);
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    DistMatrix<T> ACopy( A );
+    auto written = WriteAsync( A, basename, BINARY );
+    Zero( A );
+    written.get();
+    mpi::Barrier( g.Comm() );
+
+    DistMatrix<T> B(g);
+    Read( B, filename, BINARY );
+    B -= ACopy;
+    if( FrobeniusNorm( B ) != Base<T>(0) )
+        LogicError("Background write of DistMatrix was incorrect");
+
+    // A sequential matrix with several writes in flight
+    Matrix<T> C;
+    Uniform( C, m, n );
+    Matrix<T> CCopy( C );
+    vector<std::future<void>> writes;
+    for( Int i=0; i<3; ++i )
+        writes.push_back
+        ( WriteAsync( C, BuildString(basename,"_",g.Rank(),"_",i), BINARY ) );
+    Scale( T(2), C );
+    for( Int i=0; i<3; ++i )
+    {
+        writes[i].get();
+        const string name =
+          BuildString(basename,"_",g.Rank(),"_",i,".",FileExtension(BINARY));
+        Matrix<T> D;
+        Read( D, name, BINARY );
+        D -= CCopy;
+        if( FrobeniusNorm( D ) != Base<T>(0) )
+            LogicError("Background write of Matrix was incorrect");
+        std::remove( name.c_str() );
+    }
+
+    mpi::Barrier( g.Comm() );
+    if( g.Rank() == 0 )
+        std::remove( filename.c_str() );
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",67);
+        const Int n = Input("--width","width of matrix",43);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestWriteAsync<double>( g, m, n );
+        TestWriteAsync<Complex<float>>( g, m, n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
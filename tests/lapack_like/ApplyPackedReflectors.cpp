@@ -87,6 +87,57 @@ void TestCorrectness
         LogicError("Relative error was unacceptably large");
 }
 
+// Applying the retained panels (twice, so that they are reused) should
+// match the standard application, both in parallel and sequentially
+template<typename F>
+void TestPanels
+( LeftOrRight side,
+  UpperOrLower uplo,
+  ForwardOrBackward order,
+  Conjugation conjugation,
+  Int offset,
+  const DistMatrix<F>& H,
+  const DistMatrix<F,MD,STAR>& householderScalars,
+  const DistMatrix<F>& AOrig,
+  const DistMatrix<F>& AApplied )
+{
+    typedef Base<F> Real;
+    const Grid& g = H.Grid();
+    const Int m = H.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = 10*m*eps*Max(FrobeniusNorm(AApplied),Real(1));
+
+    OutputFromRoot(g.Comm(),"Testing retained panels...");
+    DistPackedReflectorPanels<F> panels;
+    DistMatrix<F,STAR,STAR> H_STAR_STAR( H ),
+      householderScalars_STAR_STAR( householderScalars );
+    PackedReflectorPanels<F> localPanels;
+    for( Int apply=0; apply<2; ++apply )
+    {
+        DistMatrix<F> A( AOrig );
+        ApplyPackedReflectors
+        ( side, uplo, VERTICAL, order, conjugation, offset,
+          H, householderScalars, A, panels );
+        A -= AApplied;
+        const Real error = FrobeniusNorm( A );
+        if( error > tol )
+            LogicError("Retained panels had an error of ",error," > ",tol);
+
+        DistMatrix<F,STAR,STAR> A_STAR_STAR( AOrig );
+        ApplyPackedReflectors
+        ( side, uplo, VERTICAL, order, conjugation, offset,
+          H_STAR_STAR.LockedMatrix(),
+          householderScalars_STAR_STAR.LockedMatrix(),
+          A_STAR_STAR.Matrix(), localPanels );
+        A = A_STAR_STAR;
+        A -= AApplied;
+        const Real localError = FrobeniusNorm( A );
+        if( localError > tol )
+            LogicError
+            ("Retained local panels had an error of ",localError," > ",tol);
+    }
+}
+
 template<typename F>
 void TestUT
 ( const Grid& g,
@@ -142,6 +193,7 @@ void TestUT
         Print( householderScalars, "householderScalars" );
     }
 
+    DistMatrix<F> AOrig( A );
     OutputFromRoot(g.Comm(),"Starting UT transform...");
     mpi::Barrier( g.Comm() );
     Timer timer;
@@ -158,6 +210,9 @@ void TestUT
         Print( A, "A after factorization" );
     if( correctness )
     {
+        TestPanels
+        ( side, uplo, order, conjugation, offset,
+          H, householderScalars, AOrig, A );
         TestCorrectness
         ( side, uplo, order, conjugation, offset, printMatrices, H, householderScalars );
     }
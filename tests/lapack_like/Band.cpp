@@ -0,0 +1,163 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Return a random, diagonally dominant banded matrix
+template<typename Field>
+Matrix<Field> RandomBand( Int n, Int lowerBW, Int upperBW )
+{
+    Matrix<Field> A;
+    Zeros( A, n, n );
+    for( Int j=0; j<n; ++j )
+    {
+        const Int iBeg = Max( j-upperBW, Int(0) );
+        const Int iEnd = Min( j+lowerBW+1, n );
+        for( Int i=iBeg; i<iEnd; ++i )
+            A(i,j) = SampleUniform<Field>();
+        A(j,j) += Field(lowerBW+upperBW+1);
+    }
+    return A;
+}
+
+template<typename Field>
+void CheckError
+( const Matrix<Field>& X, const Matrix<Field>& XTrue,
+  const string& label, mpi::Comm comm )
+{
+    typedef Base<Field> Real;
+    Matrix<Field> E( X );
+    E -= XTrue;
+    const Real error = MaxNorm( E );
+    const Real tol =
+      100*XTrue.Height()*limits::Epsilon<Real>()*Max(MaxNorm(XTrue),Real(1));
+    OutputFromRoot(comm,"  ",label," error: ",error);
+    if( error > tol )
+        LogicError(label," error of ",error," exceeded ",tol);
+}
+
+template<typename Field>
+void TestBand
+( Int n, Int lowerBW, Int upperBW, Int numRHS, const Grid& g, bool print )
+{
+    mpi::Comm comm = g.Comm();
+    OutputFromRoot(comm,"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    // Every process forms the same matrix
+    Matrix<Field> ADense = RandomBand<Field>( n, lowerBW, upperBW );
+    mpi::Broadcast( ADense.Buffer(), n*n, 0, comm );
+    BandMatrix<Field> A( ADense, lowerBW, upperBW );
+    if( print && g.Rank() == 0 )
+        Print( ADense, "A" );
+
+    Matrix<Field> X, Y, YDense;
+    Uniform( X, n, numRHS );
+    mpi::Broadcast( X.Buffer(), n*numRHS, 0, comm );
+    for( auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        Uniform( Y, n, numRHS );
+        mpi::Broadcast( Y.Buffer(), n*numRHS, 0, comm );
+        YDense = Y;
+        A.Apply( orientation, Field(2), X, Field(-1), Y );
+        Gemm( orientation, NORMAL, Field(2), ADense, X, Field(-1), YDense );
+        CheckError( Y, YDense, "Apply", comm );
+    }
+    for( auto uplo : {LOWER,UPPER} )
+    {
+        for( auto orientation : {NORMAL,ADJOINT} )
+        {
+            Y = X;
+            YDense = X;
+            A.Trsm( uplo, orientation, NON_UNIT, Y );
+            Trsm
+            ( LEFT, uplo, orientation, NON_UNIT, Field(1), ADense, YDense );
+            CheckError( Y, YDense, "Trsm", comm );
+        }
+    }
+
+    Matrix<Field> B;
+    Gemm( NORMAL, NORMAL, Field(1), ADense, X, B );
+    Y = B;
+    A.Factor();
+    A.Solve( Y );
+    CheckError( Y, X, "Solve", comm );
+
+    // Distributed versions
+    DistBandMatrix<Field> ADist( n, lowerBW, upperBW, g );
+    const Int firstLocalRow = ADist.FirstLocalRow();
+    const Int localHeight = ADist.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalRow + iLoc;
+        const Int jBeg = Max( i-lowerBW, Int(0) );
+        const Int jEnd = Min( i+upperBW+1, n );
+        for( Int j=jBeg; j<jEnd; ++j )
+            ADist.SetLocal( iLoc, j, ADense(i,j) );
+    }
+    DistMultiVec<Field> XDist( n, numRHS, g ), YDist( n, numRHS, g );
+    XDist.Matrix() = X( IR(firstLocalRow,firstLocalRow+localHeight), ALL );
+    for( auto orientation : {NORMAL,ADJOINT} )
+    {
+        Zero( YDist );
+        ADist.Apply( orientation, Field(1), XDist, Field(0), YDist );
+        Gemm( orientation, NORMAL, Field(1), ADense, X, YDense );
+        Matrix<Field> YLocTrue =
+          YDense( IR(firstLocalRow,firstLocalRow+localHeight), ALL );
+        CheckError( YDist.Matrix(), YLocTrue, "Distributed Apply", comm );
+    }
+
+    DistMultiVec<Field> BDist( n, numRHS, g );
+    BDist.Matrix() = B( IR(firstLocalRow,firstLocalRow+localHeight), ALL );
+    ADist.Factor();
+    ADist.Solve( BDist );
+    Matrix<Field> XLocTrue =
+      X( IR(firstLocalRow,firstLocalRow+localHeight), ALL );
+    CheckError( BDist.Matrix(), XLocTrue, "Distributed Solve", comm );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int n = Input("--n","matrix order",200);
+        const Int lowerBW = Input("--lowerBW","lower bandwidth",3);
+        const Int upperBW = Input("--upperBW","upper bandwidth",2);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",4);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestBand<float>( n, lowerBW, upperBW, numRHS, g, print );
+        TestBand<Complex<float>>( n, lowerBW, upperBW, numRHS, g, print );
+        TestBand<double>( n, lowerBW, upperBW, numRHS, g, print );
+        TestBand<Complex<double>>( n, lowerBW, upperBW, numRHS, g, print );
+#ifdef EL_HAVE_QD
+        TestBand<DoubleDouble>( n, lowerBW, upperBW, numRHS, g, print );
+        TestBand<QuadDouble>( n, lowerBW, upperBW, numRHS, g, print );
+#endif
+#ifdef EL_HAVE_QUAD
+        TestBand<Quad>( n, lowerBW, upperBW, numRHS, g, print );
+        TestBand<Complex<Quad>>( n, lowerBW, upperBW, numRHS, g, print );
+#endif
+#ifdef EL_HAVE_MPC
+        TestBand<BigFloat>( n, lowerBW, upperBW, numRHS, g, print );
+#endif
+        OutputFromRoot(comm,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -271,8 +271,20 @@ void TestBidiag
         Display( householderScalarsQ, "householderScalarsQ after Bidiag" );
     }
     if( correctness )
+    {
         TestCorrectness
         ( A, householderScalarsP, householderScalarsQ, AOrig, print, display );
+
+        OutputFromRoot(g.Comm(),"Bidiagonalizing on an adaptive grid");
+        if( !GetGemmCostModel().calibrated )
+            CalibrateGemmCostModel( g );
+        A = AOrig;
+        BidiagCtrl ctrl;
+        ctrl.adaptiveGrid = true;
+        Bidiag( A, householderScalarsP, householderScalarsQ, ctrl );
+        TestCorrectness
+        ( A, householderScalarsP, householderScalarsQ, AOrig, print, display );
+    }
     PopIndent();
 }
 
@@ -84,6 +84,7 @@ void TestDivideAndConquer
   bool wantU,
   bool wantV,
   Int cutoff,
+  Int numThreads,
   Int maxIter,  
   Int maxCubicIter,
   FlipOrClip negativeFix,
@@ -102,6 +103,7 @@ void TestDivideAndConquer
     ctrl.progress = progress;
     ctrl.dcCtrl.exploitStructure = true;
     ctrl.dcCtrl.cutoff = cutoff;
+    ctrl.dcCtrl.numThreads = numThreads;
     ctrl.dcCtrl.secularCtrl.maxIterations = maxIter;
     ctrl.dcCtrl.secularCtrl.negativeFix = negativeFix;
     ctrl.dcCtrl.secularCtrl.penalizeDerivative = penalizeDerivative;
@@ -170,6 +172,69 @@ void TestDivideAndConquer
     Output("");
 }
 
+// Compare the singular values from dqds against those of the QR algorithm
+// (with a relative-to-self tolerance) for a random and a graded matrix
+template<typename Real>
+void TestDQDS( Int n, UpperOrLower uplo, bool progress, bool print )
+{
+    Output("Testing dqds with ",TypeName<Real>());
+    BidiagSVDCtrl<Real> ctrl;
+    ctrl.progress = progress;
+    ctrl.wantU = false;
+    ctrl.wantV = false;
+    ctrl.tolType = RELATIVE_TO_SELF_SING_VAL_TOL;
+    const Real tol = 100*n*limits::Epsilon<Real>();
+
+    Matrix<Real> mainDiag, offDiag;
+    for( const bool graded : { false, true } )
+    {
+        Uniform( mainDiag, n, 1, Real(2), Real(1) );
+        Uniform( offDiag, n-1, 1, Real(2), Real(1) );
+        if( graded )
+        {
+            // Shrink the entries geometrically down to (roughly) the fourth
+            // root of the underflow threshold so that dqds does not resort
+            // to the QR algorithm
+            const Real ratio =
+              Pow( limits::SafeMin<Real>(), Real(1)/Real(4*n) );
+            Real scale = 1;
+            for( Int i=0; i<n; ++i )
+            {
+                mainDiag(i) *= scale;
+                if( i < n-1 )
+                    offDiag(i) *= scale*ratio;
+                scale *= ratio;
+            }
+        }
+
+        Timer timer;
+        Matrix<Real> sDQDS, sQR;
+        ctrl.useDQDS = true;
+        timer.Start();
+        auto info = BidiagSVD( uplo, mainDiag, offDiag, sDQDS, ctrl );
+        Output
+        ("  dqds: ",timer.Stop()," seconds, ",info.dqdsInfo.numSweeps,
+         " transforms");
+        ctrl.useDQDS = false;
+        timer.Start();
+        BidiagSVD( uplo, mainDiag, offDiag, sQR, ctrl );
+        Output("  QR: ",timer.Stop()," seconds");
+        if( print )
+        {
+            Print( sDQDS, "sDQDS" );
+            Print( sQR, "sQR" );
+        }
+
+        Real maxRelError = 0;
+        for( Int i=0; i<n; ++i )
+            maxRelError =
+              Max( maxRelError, Abs(sDQDS(i)-sQR(i))/sQR(i) );
+        Output("  max relative deviation from QR: ",maxRelError);
+        if( maxRelError > tol )
+            LogicError("dqds singular values were inaccurate");
+    }
+}
+
 int main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
@@ -182,6 +247,8 @@ int main( int argc, char* argv[] )
         const Int maxCubicIter = Input("--maxCubicIter","max cubic iter's",40);
         const bool clip = Input("--clip","clip negative?",true);
         const Int divideCutoff = Input("--divideCutoff","D&C cutoff",60);
+        const Int numThreads =
+          Input("--numThreads","number of threads for the subtrees",2);
         const bool wantU = Input("--wantU","compute U?",true);
         const bool wantV = Input("--wantV","compute V?",true);
         const bool progress = Input("--progress","print progress?",false);
@@ -196,50 +263,53 @@ int main( int argc, char* argv[] )
           ( clip ? CLIP_NEGATIVES : FLIP_NEGATIVES );
 
         TestDivideAndConquer<float>
-        ( n, uplo, wantU, wantV, divideCutoff, maxIter, maxCubicIter,
-          negativeFix, progress, print );
+        ( n, uplo, wantU, wantV, divideCutoff, numThreads, maxIter,
+          maxCubicIter, negativeFix, progress, print );
         TestDivideAndConquer<Complex<float>>
-        ( n, uplo, wantU, wantV, divideCutoff, maxIter, maxCubicIter,
-          negativeFix, progress, print );
+        ( n, uplo, wantU, wantV, divideCutoff, numThreads, maxIter,
+          maxCubicIter, negativeFix, progress, print );
 
         TestDivideAndConquer<double>
-        ( n, uplo, wantU, wantV, divideCutoff, maxIter, maxCubicIter,
-          negativeFix, progress, print );
+        ( n, uplo, wantU, wantV, divideCutoff, numThreads, maxIter,
+          maxCubicIter, negativeFix, progress, print );
         TestDivideAndConquer<Complex<double>>
-        ( n, uplo, wantU, wantV, divideCutoff, maxIter, maxCubicIter,
-          negativeFix, progress, print );
+        ( n, uplo, wantU, wantV, divideCutoff, numThreads, maxIter,
+          maxCubicIter, negativeFix, progress, print );
+
+        TestDQDS<float>( n, uplo, progress, print );
+        TestDQDS<double>( n, uplo, progress, print );
 
 #ifdef EL_HAVE_QD
         TestDivideAndConquer<DoubleDouble>
-        ( n, uplo, wantU, wantV, divideCutoff, maxIter, maxCubicIter,
-          negativeFix, progress, print );
+        ( n, uplo, wantU, wantV, divideCutoff, numThreads, maxIter,
+          maxCubicIter, negativeFix, progress, print );
         TestDivideAndConquer<Complex<DoubleDouble>>
-        ( n, uplo, wantU, wantV, divideCutoff, maxIter, maxCubicIter,
-          negativeFix, progress, print );
+        ( n, uplo, wantU, wantV, divideCutoff, numThreads, maxIter,
+          maxCubicIter, negativeFix, progress, print );
 
         TestDivideAndConquer<QuadDouble>
-        ( n, uplo, wantU, wantV, divideCutoff, maxIter, maxCubicIter,
-          negativeFix, progress, print );
+        ( n, uplo, wantU, wantV, divideCutoff, numThreads, maxIter,
+          maxCubicIter, negativeFix, progress, print );
         TestDivideAndConquer<Complex<QuadDouble>>
-        ( n, uplo, wantU, wantV, divideCutoff, maxIter, maxCubicIter,
-          negativeFix, progress, print );
+        ( n, uplo, wantU, wantV, divideCutoff, numThreads, maxIter,
+          maxCubicIter, negativeFix, progress, print );
 #endif
 #ifdef EL_HAVE_QUAD
         TestDivideAndConquer<Quad>
-        ( n, uplo, wantU, wantV, divideCutoff, maxIter, maxCubicIter,
-          negativeFix, progress, print );
+        ( n, uplo, wantU, wantV, divideCutoff, numThreads, maxIter,
+          maxCubicIter, negativeFix, progress, print );
         TestDivideAndConquer<Complex<Quad>>
-        ( n, uplo, wantU, wantV, divideCutoff, maxIter, maxCubicIter,
-          negativeFix, progress, print );
+        ( n, uplo, wantU, wantV, divideCutoff, numThreads, maxIter,
+          maxCubicIter, negativeFix, progress, print );
 #endif
 #ifdef EL_HAVE_MPC
         mpfr::SetPrecision( prec );
         TestDivideAndConquer<BigFloat>
-        ( n, uplo, wantU, wantV, divideCutoff, maxIter, maxCubicIter,
-          negativeFix, progress, print );
+        ( n, uplo, wantU, wantV, divideCutoff, numThreads, maxIter,
+          maxCubicIter, negativeFix, progress, print );
         TestDivideAndConquer<Complex<BigFloat>>
-        ( n, uplo, wantU, wantV, divideCutoff, maxIter, maxCubicIter,
-          negativeFix, progress, print );
+        ( n, uplo, wantU, wantV, divideCutoff, numThreads, maxIter,
+          maxCubicIter, negativeFix, progress, print );
 #endif
     }
     catch( std::exception& e ) { ReportException(e); }
@@ -0,0 +1,151 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the results of the native [MC,MR,BLOCK] implementations against
+// those of the standard [MC,MR] implementations
+
+template<typename F>
+void Compare
+( const string& label,
+  const AbstractDistMatrix<F>& ABlock,
+  const AbstractDistMatrix<F>& AElem,
+  bool print )
+{
+    typedef Base<F> Real;
+    const Grid& g = AElem.Grid();
+    const Real eps = limits::Epsilon<Real>();
+    DistMatrix<F> E( ABlock );
+    if( print )
+    {
+        Print( E, label+" (BLOCK)" );
+        Print( AElem, label+" (ELEMENT)" );
+    }
+    E -= AElem;
+    const Real relError =
+      FrobeniusNorm( E ) / Max( FrobeniusNorm( AElem ), Real(1) );
+    const Int n = Max( AElem.Height(), AElem.Width() );
+    OutputFromRoot
+    (g.Comm(),label,": || ABlock - AElem ||_F / || AElem ||_F = ",relError);
+    if( relError > n*eps*Real(100) )
+        LogicError("Native block-cyclic ",label," was inaccurate");
+}
+
+template<typename F>
+void TestBlockCyclic
+( const Grid& g, Int m, Int n, Int mb, Int nb, bool print )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    // Gemm
+    {
+        DistMatrix<F,MC,MR,BLOCK> A(m,n,g,mb,nb), B(n,m,g,nb,mb),
+                                  C(m,m,g,mb,mb);
+        Uniform( A, m, n );
+        Uniform( B, n, m );
+        Uniform( C, m, m );
+        DistMatrix<F> AElem( A ), BElem( B ), CElem( C );
+        Gemm( NORMAL, NORMAL, F(2), A, B, F(-1), C );
+        Gemm( NORMAL, NORMAL, F(2), AElem, BElem, F(-1), CElem );
+        Compare( "Gemm", C, CElem, print );
+    }
+
+    // Trsm
+    for( const auto uplo : { LOWER, UPPER } )
+    {
+        DistMatrix<F> AElem(g);
+        HermitianUniformSpectrum( AElem, m, Real(1), Real(2) );
+        MakeTrapezoidal( uplo, AElem );
+        DistMatrix<F,MC,MR,BLOCK> A(m,m,g,mb,mb), B(m,n,g,mb,nb);
+        A = AElem;
+        Uniform( B, m, n );
+        DistMatrix<F> BElem( B );
+        Trsm( LEFT, uplo, NORMAL, NON_UNIT, F(3), A, B );
+        Trsm( LEFT, uplo, NORMAL, NON_UNIT, F(3), AElem, BElem );
+        Compare( uplo == LOWER ? "Trsm LLN" : "Trsm LUN", B, BElem, print );
+    }
+
+    // Cholesky
+    for( const auto uplo : { LOWER, UPPER } )
+    {
+        DistMatrix<F> AElem(g);
+        HermitianUniformSpectrum( AElem, m, Real(1), Real(10) );
+        DistMatrix<F,MC,MR,BLOCK> A(m,m,g,mb,mb);
+        A = AElem;
+        Cholesky( uplo, A );
+        Cholesky( uplo, AElem );
+        Compare
+        ( uplo == LOWER ? "Cholesky LOWER" : "Cholesky UPPER",
+          A, AElem, print );
+    }
+
+    // LU with partial pivoting
+    {
+        DistMatrix<F,MC,MR,BLOCK> A(m,n,g,mb,mb);
+        Uniform( A, m, n );
+        DistMatrix<F> AElem( A );
+        DistPermutation P(g), PElem(g);
+        LU( A, P );
+        LU( AElem, PElem );
+        Compare( "LU", A, AElem, print );
+    }
+
+    // Householder QR
+    {
+        DistMatrix<F,MC,MR,BLOCK> A(m,n,g,mb,mb);
+        Uniform( A, m, n );
+        DistMatrix<F> AElem( A );
+        DistMatrix<F,MD,STAR> householderScalars(g),
+                              householderScalarsElem(g);
+        DistMatrix<Real,MD,STAR> signature(g), signatureElem(g);
+        QR( A, householderScalars, signature );
+        QR( AElem, householderScalarsElem, signatureElem );
+        Compare( "QR", A, AElem, print );
+        Compare
+        ( "QR Householder scalars",
+          householderScalars, householderScalarsElem, print );
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrices",100);
+        const Int n = Input("--width","width of matrices",80);
+        const Int mb = Input("--blockHeight","height of dist block",16);
+        const Int nb = Input("--blockWidth","width of dist block",16);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
+        const Grid g( comm, gridHeight, order );
+        ComplainIfDebug();
+
+        TestBlockCyclic<double>( g, m, n, mb, nb, print );
+        TestBlockCyclic<Complex<double>>( g, m, n, mb, nb, print );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -208,6 +208,8 @@ main( int argc, char* argv[] )
         const bool print = Input("--print","print matrices?",false);
         const bool printDiag = Input("--printDiag","print diag of fact?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const bool lookahead =
+          Input("--lookahead","overlap the next panel?",false);
 #ifdef EL_HAVE_SCALAPACK
         const bool scalapack = Input("--scalapack","test ScaLAPACK?",false);
 #else
@@ -229,6 +231,7 @@ main( int argc, char* argv[] )
         const Grid g( comm, gridHeight, order );
         const UpperOrLower uplo = CharToUpperOrLower( uploChar );
         SetBlocksize( nb );
+        SetFactorLookahead( lookahead );
 
         ComplainIfDebug();
 
@@ -0,0 +1,138 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+string AlgName( LeastSquaresAlg alg )
+{
+    switch( alg )
+    {
+    case LS_AUTO: return "Automatic";
+    case LS_HOUSEHOLDER: return "Householder";
+    case LS_TSQR: return "TSQR";
+    default: return "Seminormal";
+    }
+}
+
+template<typename Field>
+Base<Field> RelativeDifference
+( const Matrix<Field>& X, const Matrix<Field>& XRef )
+{
+    Matrix<Field> E( X );
+    E -= XRef;
+    return FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+}
+
+template<typename Field>
+void TestDenseLeastSquares
+( Int m, Int n, Int k, Int blockHeight, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+    typedef Base<Field> Real;
+    const Real tol = Real(100)*m*limits::Epsilon<Real>();
+
+    // An inconsistent, well-conditioned overdetermined system
+    Matrix<Field> A, B;
+    Gaussian( A, m, n );
+    Gaussian( B, m, k );
+    DistMatrix<Field> ADist(g), BDist(g);
+    {
+        DistMatrix<Field,STAR,STAR> A_STAR_STAR(g), B_STAR_STAR(g);
+        A_STAR_STAR.Resize( m, n );
+        A_STAR_STAR.Matrix() = A;
+        B_STAR_STAR.Resize( m, k );
+        B_STAR_STAR.Matrix() = B;
+        ADist = A_STAR_STAR;
+        BDist = B_STAR_STAR;
+    }
+
+    DenseLeastSquaresCtrl ctrl;
+    ctrl.alg = LS_HOUSEHOLDER;
+    Matrix<Field> XRef;
+    LeastSquares( NORMAL, A, B, XRef, ctrl );
+
+    for( const LeastSquaresAlg alg :
+         { LS_AUTO, LS_HOUSEHOLDER, LS_TSQR, LS_SEMINORMAL } )
+    {
+        ctrl.alg = alg;
+        Matrix<Field> X;
+        LeastSquares( NORMAL, A, B, X, ctrl );
+        const Real diff = RelativeDifference( X, XRef );
+
+        DistMatrix<Field> XDist(g);
+        Timer timer;
+        if( g.Rank() == 0 )
+            timer.Start();
+        LeastSquares( NORMAL, ADist, BDist, XDist, ctrl );
+        const double distTime = ( g.Rank() == 0 ? timer.Stop() : 0. );
+        DistMatrix<Field,STAR,STAR> X_STAR_STAR( XDist );
+        const Real diffDist = RelativeDifference( X_STAR_STAR.Matrix(), XRef );
+
+        OutputFromRoot
+        (g.Comm(),AlgName(alg),": sequential difference ",diff,
+         ", distributed difference ",diffDist," (",distTime," secs)");
+        if( diff > tol || diffDist > tol )
+            LogicError(AlgName(alg)," least squares was inaccurate");
+    }
+
+    // Absorb the rows of [A, B] a block at a time
+    StreamingLeastSquares<Field> streaming( n, k, g );
+    for( Int i=0; i<m; i+=blockHeight )
+    {
+        const Range<Int> ind( i, Min(i+blockHeight,m) );
+        streaming.AddRows( ADist(ind,ALL), BDist(ind,ALL) );
+    }
+    DistMatrix<Field> XDist(g);
+    streaming.Solve( XDist );
+    DistMatrix<Field,STAR,STAR> X_STAR_STAR( XDist );
+    const Real diffStream = RelativeDifference( X_STAR_STAR.Matrix(), XRef );
+
+    Matrix<Field> E( B );
+    Gemm( NORMAL, NORMAL, Field(-1), A, XRef, Field(1), E );
+    const Real residNorm = FrobeniusNorm( E );
+    const Real residNormStream = streaming.ResidualNorm();
+    OutputFromRoot
+    (g.Comm(),"Streaming: difference ",diffStream,", residual norm ",
+     residNormStream," vs. ",residNorm);
+    if( diffStream > tol ||
+        Abs(residNormStream-residNorm) > tol*residNorm )
+        LogicError("Streaming least squares was inaccurate");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of A",2000);
+        const Int n = Input("--n","width of A",20);
+        const Int k = Input("--k","number of right-hand sides",3);
+        const Int blockHeight =
+          Input("--blockHeight","height of the streamed row blocks",300);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestDenseLeastSquares<float>( m, n, k, blockHeight, g );
+        TestDenseLeastSquares<Complex<float>>( m, n, k, blockHeight, g );
+        TestDenseLeastSquares<double>( m, n, k, blockHeight, g );
+        TestDenseLeastSquares<Complex<double>>( m, n, k, blockHeight, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
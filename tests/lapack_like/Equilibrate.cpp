@@ -0,0 +1,98 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestRuiz( const Grid& grid, Int m, Int n, Int maxIter, bool progress )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+
+    // Badly scale the rows and columns of a random matrix
+    DistMatrix<Field> A(grid);
+    Uniform( A, m, n );
+    DistMatrix<Real,MC,STAR> rowBad(grid);
+    DistMatrix<Real,MR,STAR> colBad(grid);
+    rowBad.Resize( m, 1 );
+    colBad.Resize( n, 1 );
+    IndexDependentFill
+    ( rowBad, []( Int i, Int j ) { return Pow(Real(10),Real(i%7-3)); } );
+    IndexDependentFill
+    ( colBad, []( Int i, Int j ) { return Pow(Real(10),Real(i%5-2)); } );
+    DiagonalScale( LEFT, NORMAL, rowBad, A );
+    DiagonalScale( RIGHT, NORMAL, colBad, A );
+    DistMatrix<Field> AOrig( A );
+    DistMatrix<Field,STAR,STAR> A_STAR_STAR( A );
+
+    RuizEquilCtrl<Real> ctrl;
+    ctrl.maxIter = maxIter;
+    ctrl.tol = Real(1)/Real(100);
+    ctrl.progress = progress;
+    DistMatrix<Real,MC,STAR> dRow(grid);
+    DistMatrix<Real,MR,STAR> dCol(grid);
+    RuizEquil( A, dRow, dCol, ctrl );
+
+    // The original matrix should be recovered from the scalings
+    const Real tol = 10*Max(m,n)*limits::Epsilon<Real>();
+    DistMatrix<Field> B( A );
+    DiagonalScale( LEFT, NORMAL, dRow, B );
+    DiagonalScale( RIGHT, NORMAL, dCol, B );
+    B -= AOrig;
+    const Real error = FrobeniusNorm( B ) / FrobeniusNorm( AOrig );
+    if( error > tol )
+        LogicError("Relative reconstruction error was ",error," > ",tol);
+
+    // The rows should end with unit maximum norms, which (as the entries
+    // are bounded by one after the last column rescaling) leaves the column
+    // maximum norms no smaller than one
+    DistMatrix<Real,MC,STAR> rowMax(grid);
+    DistMatrix<Real,MR,STAR> colMax(grid);
+    RowMaxNorms( A, rowMax );
+    ColumnMaxNorms( A, colMax );
+    for( Int iLoc=0; iLoc<rowMax.LocalHeight(); ++iLoc )
+        if( Abs(rowMax.GetLocal(iLoc,0)-Real(1)) > tol )
+            LogicError("A row had a maximum norm of ",rowMax.GetLocal(iLoc,0));
+    for( Int jLoc=0; jLoc<colMax.LocalHeight(); ++jLoc )
+        if( colMax.GetLocal(jLoc,0) < Real(1)-tol )
+            LogicError
+            ("A column had a maximum norm of ",colMax.GetLocal(jLoc,0));
+
+    // The sequential variant should agree
+    Matrix<Real> dRowLoc, dColLoc;
+    RuizEquil( A_STAR_STAR.Matrix(), dRowLoc, dColLoc, ctrl );
+    DistMatrix<Field> ASeq( A_STAR_STAR );
+    ASeq -= A;
+    const Real seqError = FrobeniusNorm( ASeq );
+    if( seqError > tol*FrobeniusNorm( A ) )
+        LogicError("The sequential and distributed variants differed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",80);
+        const Int maxIter = Input("--maxIter","maximum Ruiz sweeps",50);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( mpi::COMM_WORLD );
+        TestRuiz<double>( grid, m, n, maxIter, progress );
+        TestRuiz<Complex<double>>( grid, m, n, maxIter, progress );
+        OutputFromRoot(mpi::COMM_WORLD,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
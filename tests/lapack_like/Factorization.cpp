@@ -0,0 +1,131 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Check || B - op(A) X ||_F / (|| A ||_F || X ||_F)
+template<typename Field>
+void CheckSolve
+( Orientation orientation,
+  const DistMatrix<Field>& A,
+  const DistMatrix<Field>& X,
+  const DistMatrix<Field>& B,
+  const string& label )
+{
+    typedef Base<Field> Real;
+    DistMatrix<Field> R( B );
+    Gemm( orientation, NORMAL, Field(-1), A, X, Field(1), R );
+    const Real relResid =
+      FrobeniusNorm(R) / (FrobeniusNorm(A)*FrobeniusNorm(X));
+    OutputFromRoot(A.Grid().Comm(),"  ",label," relative residual: ",relResid);
+    if( relResid > 100*A.Height()*limits::Epsilon<Real>() )
+        LogicError(label," relative residual of ",relResid," was too large");
+}
+
+template<typename Field>
+void TestFactorization
+( FactorizationType type, const string& typeName,
+  Int n, Int numRHS, Int rank, const Grid& g )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing ",typeName," with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> A(g);
+    if( type == CHOLESKY_FACTORIZATION || type == LDL_FACTORIZATION )
+        HermitianUniformSpectrum( A, n, Real(1), Real(10) );
+    else
+    {
+        Uniform( A, n, n );
+        ShiftDiagonal( A, Field(n) );
+    }
+    Factorization<Field> factorization( type, A );
+
+    DistMatrix<Field> X(g), B(g);
+    for( auto orientation : {NORMAL,ADJOINT,TRANSPOSE,NORMAL} )
+    {
+        Uniform( B, n, numRHS );
+        X = B;
+        factorization.Solve( orientation, X );
+        CheckSolve( orientation, A, X, B, "Solve" );
+    }
+
+    // A := A + U V^H, applied in two steps
+    DistMatrix<Field> U(g), V(g);
+    Uniform( U, n, rank );
+    Uniform( V, n, rank );
+    U *= Field(1)/Field(n);
+    auto U0 = U( ALL, IR(0,rank/2) );
+    auto V0 = V( ALL, IR(0,rank/2) );
+    auto U1 = U( ALL, IR(rank/2,rank) );
+    auto V1 = V( ALL, IR(rank/2,rank) );
+    factorization.LowRankUpdate( U0, V0 );
+    factorization.LowRankUpdate( U1, V1 );
+    if( factorization.UpdateRank() != rank )
+        LogicError("Expected an update rank of ",rank);
+    Gemm( NORMAL, ADJOINT, Field(1), U, V, Field(1), A );
+    for( auto orientation : {NORMAL,ADJOINT,TRANSPOSE} )
+    {
+        Uniform( B, n, numRHS );
+        X = B;
+        factorization.Solve( orientation, X );
+        CheckSolve( orientation, A, X, B, "Updated solve" );
+    }
+
+    PopIndent();
+}
+
+template<typename Field>
+void TestFactorizations( Int n, Int numRHS, Int rank, const Grid& g )
+{
+    TestFactorization<Field>( LU_FACTORIZATION, "LU", n, numRHS, rank, g );
+    TestFactorization<Field>
+    ( CHOLESKY_FACTORIZATION, "Cholesky", n, numRHS, rank, g );
+    TestFactorization<Field>( LDL_FACTORIZATION, "LDL", n, numRHS, rank, g );
+    TestFactorization<Field>( QR_FACTORIZATION, "QR", n, numRHS, rank, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int n = Input("--n","matrix order",100);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",10);
+        const Int rank = Input("--rank","rank of the update",4);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        const Grid g( comm );
+        TestFactorizations<float>( n, numRHS, rank, g );
+        TestFactorizations<Complex<float>>( n, numRHS, rank, g );
+        TestFactorizations<double>( n, numRHS, rank, g );
+        TestFactorizations<Complex<double>>( n, numRHS, rank, g );
+#ifdef EL_HAVE_QD
+        TestFactorizations<DoubleDouble>( n, numRHS, rank, g );
+        TestFactorizations<QuadDouble>( n, numRHS, rank, g );
+#endif
+#ifdef EL_HAVE_QUAD
+        TestFactorizations<Quad>( n, numRHS, rank, g );
+        TestFactorizations<Complex<Quad>>( n, numRHS, rank, g );
+#endif
+#ifdef EL_HAVE_MPC
+        TestFactorizations<BigFloat>( n, numRHS, rank, g );
+#endif
+        OutputFromRoot(comm,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
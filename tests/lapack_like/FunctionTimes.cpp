@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void Distribute( const Matrix<Field>& A, DistMatrix<Field>& ADist )
+{
+    DistMatrix<Field,STAR,STAR> A_STAR_STAR( ADist.Grid() );
+    A_STAR_STAR.Resize( A.Height(), A.Width() );
+    A_STAR_STAR.Matrix() = A;
+    ADist = A_STAR_STAR;
+}
+
+template<typename Field>
+Base<Field> RelativeError
+( const Matrix<Field>& X, const Matrix<Field>& XRef )
+{
+    Matrix<Field> E( X );
+    E -= XRef;
+    return FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+}
+
+template<typename Field>
+void TestFunctionTimes( Int n, Int k, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+    typedef Base<Field> Real;
+    typedef Complex<Real> C;
+    KrylovFunctionCtrl<Real> ctrl;
+    const Real tol = Real(100)*ctrl.relTol;
+
+    Matrix<Field> B;
+    Uniform( B, n, k );
+    DistMatrix<Field> BDist(g);
+    Distribute( B, BDist );
+
+    // exp(A) B for a Hermitian A with spectrum in roughly [-2,2], compared
+    // against a dense application of HermitianFunction
+    Matrix<Field> A;
+    Uniform( A, n, n, Field(0), Real(2)/Sqrt(Real(n)) );
+    MakeHermitian( LOWER, A );
+    auto expFunc = []( const Real& omega ) { return Exp(omega); };
+    Matrix<Field> FA( A ), XRef, X;
+    HermitianFunction( LOWER, FA, function<Real(const Real&)>(expFunc) );
+    Zeros( XRef, n, k );
+    Gemm( NORMAL, NORMAL, Field(1), FA, B, Field(0), XRef );
+
+    Timer timer;
+    timer.Start();
+    HermitianFunctionTimes( LOWER, A, B, X, expFunc, ctrl );
+    const double hermTime = timer.Stop();
+    const Real hermError = RelativeError( X, XRef );
+    DistMatrix<Field> ADist(g), XDist(g);
+    Distribute( A, ADist );
+    HermitianFunctionTimes( LOWER, ADist, BDist, XDist, expFunc, ctrl );
+    DistMatrix<Field,STAR,STAR> X_STAR_STAR( XDist );
+    const Real hermDistError = RelativeError( X_STAR_STAR.Matrix(), XRef );
+    OutputFromRoot
+    (g.Comm(),"Hermitian exp: error ",hermError," (",hermTime," secs), ",
+     "distributed error ",hermDistError);
+    if( hermError > tol || hermDistError > tol )
+        LogicError("HermitianFunctionTimes was inaccurate");
+
+    // sqrt(A) B for a non-Hermitian A with spectrum near 2, compared against
+    // a dense Newton square root
+    Uniform( A, n, n, Field(0), Real(1)/Sqrt(Real(n)) );
+    ShiftDiagonal( A, Field(2) );
+    auto sqrtFunc = []( const C& lambda ) { return Sqrt(lambda); };
+    FA = A;
+    SquareRoot( FA );
+    Gemm( NORMAL, NORMAL, Field(1), FA, B, Field(0), XRef );
+
+    timer.Start();
+    MatrixFunctionTimes( A, B, X, sqrtFunc, ctrl );
+    const double genTime = timer.Stop();
+    const Real genError = RelativeError( X, XRef );
+    Distribute( A, ADist );
+    MatrixFunctionTimes( ADist, BDist, XDist, sqrtFunc, ctrl );
+    X_STAR_STAR = XDist;
+    const Real genDistError = RelativeError( X_STAR_STAR.Matrix(), XRef );
+    OutputFromRoot
+    (g.Comm(),"General sqrt: error ",genError," (",genTime," secs), ",
+     "distributed error ",genDistError);
+    if( genError > tol || genDistError > tol )
+        LogicError("MatrixFunctionTimes was inaccurate");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","matrix order",300);
+        const Int k = Input("--k","number of columns of B",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestFunctionTimes<float>( n, k, g );
+        TestFunctionTimes<Complex<float>>( n, k, g );
+        TestFunctionTimes<double>( n, k, g );
+        TestFunctionTimes<Complex<double>>( n, k, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestRandomHelper
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const HessenbergQZCtrl& ctrl,
+  bool print )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+
+    Matrix<F> S, T, Q, Z, alpha, beta;
+    Timer timer;
+
+    S = A;
+    T = B;
+    timer.Start();
+    auto info = GeneralizedSchur( S, T, alpha, beta, Q, Z, ctrl );
+    Output("GeneralizedSchur: ",timer.Stop()," seconds");
+    Output("Converged in ",info.numIterations," iterations");
+    if( print )
+    {
+        Print( alpha, "alpha" );
+        Print( beta, "beta" );
+        Print( Q, "Q" );
+        Print( Z, "Z" );
+        Print( S, "S" );
+        Print( T, "T" );
+    }
+
+    Matrix<F> R;
+    Gemm( NORMAL, NORMAL, F(1), Q, S, R );
+    Gemm( NORMAL, NORMAL, F(1), A, Z, F(-1), R );
+    const Real AFrob = FrobeniusNorm( A );
+    const Real ARelErr = FrobeniusNorm( R ) / (eps*n*AFrob);
+    Gemm( NORMAL, NORMAL, F(1), Q, T, R );
+    Gemm( NORMAL, NORMAL, F(1), B, Z, F(-1), R );
+    const Real BFrob = FrobeniusNorm( B );
+    const Real BRelErr = FrobeniusNorm( R ) / (eps*n*BFrob);
+    Output("|| A Z - Q S ||_F / (eps n || A ||_F) = ",ARelErr);
+    Output("|| B Z - Q T ||_F / (eps n || B ||_F) = ",BRelErr);
+    // TODO(poulson): A more refined failure condition
+    if( ARelErr > Real(100) || BRelErr > Real(100) )
+        LogicError("Relative error was unacceptably large");
+    Output("Passed test");
+    Output("");
+}
+
+template<typename F>
+void TestRandomHelper
+( const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& B,
+  const HessenbergQZCtrl& ctrl,
+  bool print )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Grid& grid = A.Grid();
+
+    DistMatrix<F> S(grid), T(grid), Q(grid), Z(grid);
+    DistMatrix<F,STAR,STAR> alpha(grid), beta(grid);
+    Timer timer;
+
+    S = A;
+    T = B;
+    timer.Start();
+    auto info = GeneralizedSchur( S, T, alpha, beta, Q, Z, ctrl );
+    if( grid.Rank() == 0 )
+    {
+        Output("GeneralizedSchur: ",timer.Stop()," seconds");
+        Output("Converged in ",info.numIterations," iterations");
+    }
+    if( print )
+    {
+        Print( alpha, "alpha" );
+        Print( beta, "beta" );
+        Print( Q, "Q" );
+        Print( Z, "Z" );
+        Print( S, "S" );
+        Print( T, "T" );
+    }
+
+    DistMatrix<F> R(grid);
+    Gemm( NORMAL, NORMAL, F(1), Q, S, R );
+    Gemm( NORMAL, NORMAL, F(1), A, Z, F(-1), R );
+    const Real AFrob = FrobeniusNorm( A );
+    const Real ARelErr = FrobeniusNorm( R ) / (eps*n*AFrob);
+    Gemm( NORMAL, NORMAL, F(1), Q, T, R );
+    Gemm( NORMAL, NORMAL, F(1), B, Z, F(-1), R );
+    const Real BFrob = FrobeniusNorm( B );
+    const Real BRelErr = FrobeniusNorm( R ) / (eps*n*BFrob);
+    if( grid.Rank() == 0 )
+    {
+        Output("|| A Z - Q S ||_F / (eps n || A ||_F) = ",ARelErr);
+        Output("|| B Z - Q T ||_F / (eps n || B ||_F) = ",BRelErr);
+    }
+    // TODO(poulson): A more refined failure condition
+    if( ARelErr > Real(100) || BRelErr > Real(100) )
+        LogicError("Relative error was unacceptably large");
+    if( grid.Rank() == 0 )
+    {
+        Output("Passed test");
+        Output("");
+    }
+}
+
+template<typename F>
+void TestRandom( Int n, const HessenbergQZCtrl& ctrl, bool print )
+{
+    EL_DEBUG_CSE
+    Output("Testing uniform with ",TypeName<F>());
+    Matrix<F> A, B;
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( B, "B" );
+    }
+    TestRandomHelper( A, B, ctrl, print );
+}
+
+template<typename F>
+void TestRandom
+( Int n, const Grid& grid, const HessenbergQZCtrl& ctrl, bool print )
+{
+    EL_DEBUG_CSE
+    if( grid.Rank() == 0 )
+        Output("Testing uniform with ",TypeName<F>());
+    DistMatrix<F> A(grid), B(grid);
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( B, "B" );
+    }
+    TestRandomHelper( A, B, ctrl, print );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","random matrix size",100);
+        const Int algInt = Input("--alg","AED: 0, Simple: 1",0);
+        const Int minMultiBulgeSize =
+          Input
+          ("--minMultiBulgeSize",
+           "minimum size for using a multishift algorithm",75);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool distributed =
+          Input("--distributed","test distributed?",true);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        HessenbergQZCtrl ctrl;
+        ctrl.alg = static_cast<HessenbergQZAlg>(algInt);
+        ctrl.minMultiBulgeSize = minMultiBulgeSize;
+        ctrl.progress = progress;
+
+        const Grid grid( mpi::COMM_WORLD );
+
+        if( sequential && grid.Rank() == 0 )
+        {
+            TestRandom<Complex<float>>( n, ctrl, print );
+            TestRandom<Complex<double>>( n, ctrl, print );
+#ifdef EL_HAVE_QUAD
+            TestRandom<Complex<Quad>>( n, ctrl, print );
+#endif
+#ifdef EL_HAVE_QD
+            TestRandom<Complex<DoubleDouble>>( n, ctrl, print );
+            TestRandom<Complex<QuadDouble>>( n, ctrl, print );
+#endif
+        }
+        if( distributed )
+        {
+            TestRandom<Complex<float>>( n, grid, ctrl, print );
+            TestRandom<Complex<double>>( n, grid, ctrl, print );
+#ifdef EL_HAVE_QUAD
+            TestRandom<Complex<Quad>>( n, grid, ctrl, print );
+#endif
+#ifdef EL_HAVE_QD
+            TestRandom<Complex<DoubleDouble>>( n, grid, ctrl, print );
+            TestRandom<Complex<QuadDouble>>( n, grid, ctrl, print );
+#endif
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
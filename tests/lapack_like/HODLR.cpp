@@ -0,0 +1,186 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void Gather( const DistMultiVec<F>& XDist, Matrix<F>& X )
+{
+    DistMatrix<F,STAR,STAR> X_STAR_STAR( XDist.Grid() );
+    Copy( XDist, X_STAR_STAR );
+    X = X_STAR_STAR.Matrix();
+}
+
+template<typename F>
+void Scatter( const Matrix<F>& X, DistMultiVec<F>& XDist )
+{
+    XDist.Resize( X.Height(), X.Width() );
+    for( Int iLoc=0; iLoc<XDist.LocalHeight(); ++iLoc )
+        for( Int j=0; j<X.Width(); ++j )
+            XDist.Matrix()(iLoc,j) = X(XDist.GlobalRow(iLoc),j);
+}
+
+template<typename F>
+void CheckCompression
+( const string& name, const HODLRMatrix<F>& H, const Matrix<F>& A,
+  const HODLRCtrl<Base<F>>& ctrl, const Grid& g )
+{
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    Matrix<F> E;
+    H.Form( E );
+    E -= A;
+    const Real err = FrobeniusNorm( E ) / FrobeniusNorm( A );
+    OutputFromRoot
+    (g.Comm(),name," compression: max rank of ",H.MaxRank(),", ",
+     H.NumEntries()," of ",n*n," entries, relative error ",err);
+    if( err > Real(100)*Sqrt(Real(n))*ctrl.relTol )
+        LogicError("The ",name," compression was inaccurate");
+}
+
+template<typename F>
+void TestHODLR
+( Orientation orientation, Int n, Int numRHS, Int leafSize, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+
+    // A Cauchy matrix with interlaced points, whose off-diagonal blocks are
+    // numerically low-rank
+    vector<Real> x( n ), y( n );
+    for( Int i=0; i<n; ++i )
+    {
+        x[i] = Real(i);
+        y[i] = Real(i) + Real(1)/Real(2);
+    }
+    Matrix<F> A;
+    Cauchy( A, x, y );
+
+    HODLRCtrl<Real> ctrl;
+    ctrl.leafSize = leafSize;
+    ctrl.relTol = Pow( eps, Real(0.75) );
+    HODLRMatrix<F> H( A, ctrl );
+    CheckCompression( "Sequential", H, A, ctrl, g );
+
+    // The fast application should match the decompressed matrix
+    Matrix<F> AComp;
+    H.Form( AComp );
+    Matrix<F> X, Y, YExpl;
+    Uniform( X, n, numRHS );
+    Uniform( Y, n, numRHS );
+    YExpl = Y;
+    H.Apply( orientation, F(2), X, F(-1), Y );
+    Gemm( orientation, NORMAL, F(2), AComp, X, F(-1), YExpl );
+    const Real frobExpl = FrobeniusNorm( YExpl );
+    YExpl -= Y;
+    const Real errApply = FrobeniusNorm( YExpl ) / frobExpl;
+    OutputFromRoot(g.Comm(),"Application relative error: ",errApply);
+    if( errApply > Real(100)*n*eps )
+        LogicError("The HODLR application was inaccurate");
+
+    // The solve is exact for the compressed matrix
+    H.Factor();
+    Matrix<F> XSol, B;
+    Uniform( XSol, n, numRHS );
+    H( XSol, B );
+    const Real frobSol = FrobeniusNorm( XSol );
+    Matrix<F> XDirect( B );
+    H.Solve( XDirect );
+    XDirect -= XSol;
+    const Real errSolve = FrobeniusNorm( XDirect ) / frobSol;
+    OutputFromRoot(g.Comm(),"Solve relative error: ",errSolve);
+    if( errSolve > Real(1000)*n*eps )
+        LogicError("The HODLR solve was inaccurate");
+
+    // ...and is a nearly-exact preconditioner for the original matrix
+    Zeros( B, n, numRHS );
+    Gemm( NORMAL, NORMAL, F(1), A, XSol, F(0), B );
+    auto applyA = [&]( F alpha, const Matrix<F>& Z, F beta, Matrix<F>& W )
+      { Gemm( NORMAL, NORMAL, alpha, A, Z, beta, W ); };
+    auto precond = [&]( Matrix<F>& W ) { H.Solve( W ); };
+    Matrix<F> XKrylov( B );
+    const Real relTol = Pow( eps, Real(0.7) );
+    FGMRES( applyA, precond, XKrylov, relTol, 10, 20, false );
+    XKrylov -= XSol;
+    const Real errKrylov = FrobeniusNorm( XKrylov ) / frobSol;
+    OutputFromRoot
+    (g.Comm(),"HODLR-preconditioned FGMRES relative error: ",errKrylov);
+    if( errKrylov > Real(100)*relTol )
+        LogicError("HODLR-preconditioned FGMRES did not converge");
+
+    // Compress from a distributed matrix and compare the distributed
+    // application and solve against their sequential counterparts
+    DistMatrix<F> ADist(g);
+    Cauchy( ADist, x, y );
+    HODLRMatrix<F> HDist( ADist, ctrl );
+    CheckCompression( "Distributed", HDist, A, ctrl, g );
+    HDist.Factor();
+
+    DistMultiVec<F> XDist(g), YDist(g);
+    Scatter( X, XDist );
+    Uniform( YDist, n, numRHS );
+    Matrix<F> YSeq;
+    Gather( YDist, YSeq );
+    HDist.Apply( orientation, F(2), XDist, F(-1), YDist );
+    HDist.Apply( orientation, F(2), X, F(-1), YSeq );
+    Matrix<F> YGath;
+    Gather( YDist, YGath );
+    YGath -= YSeq;
+    const Real errDist = FrobeniusNorm( YGath ) / FrobeniusNorm( YSeq );
+    OutputFromRoot(g.Comm(),"Distributed application discrepancy: ",errDist);
+    if( errDist > Real(100)*n*eps )
+        LogicError("The distributed HODLR application differed");
+
+    DistMultiVec<F> BDist(g);
+    Scatter( B, BDist );
+    HDist.Solve( BDist );
+    HDist.Solve( B );
+    Matrix<F> BGath;
+    Gather( BDist, BGath );
+    BGath -= B;
+    const Real errDistSolve = FrobeniusNorm( BGath ) / FrobeniusNorm( B );
+    OutputFromRoot
+    (g.Comm(),"Distributed solve discrepancy: ",errDistSolve);
+    if( errDistSolve > Real(100)*n*eps )
+        LogicError("The distributed HODLR solve differed");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const char transChar = Input
+            ("--trans","orientation of the operator: N/T/C",'N');
+        const Int n = Input("--n","matrix order",300);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        const Int leafSize = Input("--leafSize","HODLR leaf size",32);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        const Orientation orientation = CharToOrientation( transChar );
+        ComplainIfDebug();
+
+        TestHODLR<float>( orientation, n, numRHS, leafSize, g );
+        TestHODLR<Complex<float>>( orientation, n, numRHS, leafSize, g );
+        TestHODLR<double>( orientation, n, numRHS, leafSize, g );
+        TestHODLR<Complex<double>>( orientation, n, numRHS, leafSize, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
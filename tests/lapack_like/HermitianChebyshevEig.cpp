@@ -0,0 +1,190 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A,
+  const DistMatrix<Base<F>,STAR,STAR>& w,
+  const DistMatrix<F>& X,
+  const HermitianChebyshevCtrl<Base<F>>& ctrl )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int numEig = w.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = HermitianOneNorm( LOWER, A );
+
+    // Compare against the smallest eigenvalues from the dense solver
+    OutputFromRoot(g.Comm(),"Testing eigenvalues");
+    PushIndent();
+    DistMatrix<F> ACopy( A );
+    DistMatrix<Real,VR,STAR> wDense(g);
+    HermitianEigCtrl<F> denseCtrl;
+    denseCtrl.tridiagEigCtrl.subset.indexSubset = true;
+    denseCtrl.tridiagEigCtrl.subset.lowerIndex = 0;
+    denseCtrl.tridiagEigCtrl.subset.upperIndex = numEig-1;
+    HermitianEig( LOWER, ACopy, wDense, denseCtrl );
+    DistMatrix<Real,STAR,STAR> wError( wDense );
+    wError -= w;
+    const Real maxEigError = MaxNorm( wError );
+    const Real relEigError = maxEigError / (n*eps*oneNormA);
+    OutputFromRoot
+    (g.Comm(),"|| w - wDense ||_max / (n eps || A ||_1) = ",relEigError);
+    PopIndent();
+
+    // Form I - X^H X
+    OutputFromRoot(g.Comm(),"Testing orthogonality of X");
+    PushIndent();
+    DistMatrix<F> Z(g);
+    Identity( Z, numEig, numEig );
+    Herk( LOWER, ADJOINT, Real(-1), X, Real(1), Z );
+    const Real orthogError = HermitianMaxNorm( LOWER, Z );
+    const Real relOrthogError = orthogError / (n*eps);
+    OutputFromRoot
+    (g.Comm(),"|| I - X^H X ||_max / (n eps) = ",relOrthogError);
+    PopIndent();
+
+    // Form A X - X diag(w)
+    OutputFromRoot(g.Comm(),"Testing residuals");
+    PushIndent();
+    DistMatrix<F> XScaled( X ), R(g);
+    DiagonalScale( RIGHT, NORMAL, w, XScaled );
+    Zeros( R, n, numEig );
+    Hemm( LEFT, LOWER, F(1), A, X, F(0), R );
+    R -= XScaled;
+    const Real residError = FrobeniusNorm( R );
+    const Real relResidError = residError / (n*eps*oneNormA);
+    OutputFromRoot
+    (g.Comm(),"|| A X - X diag(w) ||_F / (n eps || A ||_1) = ",relResidError);
+    PopIndent();
+
+    const Real tolScale =
+      ( ctrl.tol > Real(0) ? ctrl.tol / (n*eps) : Real(1) );
+    if( relEigError > 100*tolScale )
+        LogicError("Relative eigenvalue error was unacceptably large");
+    if( relOrthogError > Real(100) )
+        LogicError("Relative orthogonality error was unacceptably large");
+    if( relResidError > 100*tolScale*Sqrt(Real(numEig)) )
+        LogicError("Relative residual was unacceptably large");
+}
+
+template<typename F>
+void TestHermitianChebyshevEig
+( const Grid& g,
+  Int n,
+  Int numEig,
+  double perturbation,
+  bool correctness,
+  bool print,
+  const HermitianChebyshevCtrl<double>& ctrlDbl )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    HermitianChebyshevCtrl<Real> ctrl;
+    ctrl.numGuardVectors = ctrlDbl.numGuardVectors;
+    ctrl.degree = ctrlDbl.degree;
+    ctrl.maxIts = ctrlDbl.maxIts;
+    ctrl.numLanczosSteps = ctrlDbl.numLanczosSteps;
+    ctrl.tol = Real(ctrlDbl.tol);
+    ctrl.orthoVariant = ctrlDbl.orthoVariant;
+    ctrl.progress = ctrlDbl.progress;
+
+    DistMatrix<F> A(g), X(g);
+    DistMatrix<Real,STAR,STAR> w(g);
+    Wigner( A, n );
+    if( print )
+        Print( A, "A" );
+
+    OutputFromRoot(g.Comm(),"Starting cold-started solve");
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    auto info = HermitianChebyshevEig( LOWER, A, numEig, w, X, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot
+    (g.Comm(),"Time: ",timer.Stop()," seconds, ",info.numIterations,
+     " iterations, ",info.numConverged," of ",numEig," converged");
+    if( print )
+    {
+        Print( w, "w" );
+        Print( X, "X" );
+    }
+    if( correctness )
+        TestCorrectness( A, w, X, ctrl );
+
+    // Perturb A and restart from the previous eigenvectors
+    DistMatrix<F> E(g);
+    Wigner( E, n );
+    Axpy( F(perturbation), E, A );
+    ctrl.warmStart = true;
+    OutputFromRoot(g.Comm(),"Starting warm-started solve");
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    info = HermitianChebyshevEig( LOWER, A, numEig, w, X, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot
+    (g.Comm(),"Time: ",timer.Stop()," seconds, ",info.numIterations,
+     " iterations, ",info.numConverged," of ",numEig," converged");
+    if( correctness )
+        TestCorrectness( A, w, X, ctrl );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--height","height of matrix",200);
+        const Int numEig = Input("--numEig","number of eigenpairs",20);
+        const Int numGuard = Input("--numGuard","number of guard vectors",0);
+        const Int degree = Input("--degree","Chebyshev degree",10);
+        const Int maxIts = Input("--maxIts","maximum iterations",100);
+        const double tol = Input("--tol","relative tolerance",0.);
+        const double perturbation =
+          Input("--perturbation","warm-start perturbation",1e-3);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool correctness =
+          Input("--correctness","test correctness?",true);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        HermitianChebyshevCtrl<double> ctrl;
+        ctrl.numGuardVectors = numGuard;
+        ctrl.degree = degree;
+        ctrl.maxIts = maxIts;
+        ctrl.tol = tol;
+        ctrl.progress = progress;
+
+        TestHermitianChebyshevEig<double>
+        ( g, n, numEig, perturbation, correctness, print, ctrl );
+        TestHermitianChebyshevEig<Complex<double>>
+        ( g, n, numEig, perturbation, correctness, print, ctrl );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -224,6 +224,13 @@ void TestSuite
     ctrl.tridiagEigCtrl.alg = ctrlDbl.tridiagEigCtrl.alg;
     ctrl.tridiagEigCtrl.subset = subset;
     ctrl.tridiagEigCtrl.progress = ctrlDbl.tridiagEigCtrl.progress;
+    ctrl.tridiagEigCtrl.mrrrCtrl = ctrlDbl.tridiagEigCtrl.mrrrCtrl;
+    ctrl.useSlicing = ctrlDbl.useSlicing;
+    ctrl.sliceCtrl.numSlices = ctrlDbl.sliceCtrl.numSlices;
+    ctrl.sliceCtrl.progress = ctrlDbl.sliceCtrl.progress;
+    ctrl.useSDC = ctrlDbl.useSDC;
+    ctrl.sdcCtrl.mixedPrecision = ctrlDbl.sdcCtrl.mixedPrecision;
+    ctrl.sdcCtrl.progress = ctrlDbl.sdcCtrl.progress;
 
     if( sequential && g.Rank() == 0 )
     {
@@ -290,6 +297,16 @@ main( int argc, char* argv[] )
         const bool useScaLAPACK =
           Input("--useScaLAPACK","test ScaLAPACK?",false);
         const Int algInt = Input("--algInt","0: QR, 1: D&C, 2: MRRR",1);
+        const double partitionSlack =
+          Input("--partitionSlack","MRRR partition slack",0.);
+        const bool useSlicing =
+          Input("--slicing","use spectrum slicing (requires range V)?",false);
+        const Int numSlices =
+          Input("--numSlices","number of slices (0 for one per process)",0);
+        const bool useSDC =
+          Input("--sdc","use QDWH-based spectral divide and conquer?",false);
+        const bool mixedQDWH =
+          Input("--mixedQDWH","use mixed-precision QDWH iterations?",false);
         const bool sequential =
           Input("--sequential","test sequential?",true);
         const bool distributed =
@@ -344,6 +361,13 @@ main( int argc, char* argv[] )
         ctrl.tridiagEigCtrl.alg = alg;
         ctrl.tridiagEigCtrl.subset = subset;
         ctrl.tridiagEigCtrl.progress = progress;
+        ctrl.tridiagEigCtrl.mrrrCtrl.partitionSlack = partitionSlack;
+        ctrl.useSlicing = useSlicing;
+        ctrl.sliceCtrl.numSlices = numSlices;
+        ctrl.sliceCtrl.progress = progress;
+        ctrl.useSDC = useSDC;
+        ctrl.sdcCtrl.mixedPrecision = mixedQDWH;
+        ctrl.sdcCtrl.progress = progress;
 
         if( testReal )
         {
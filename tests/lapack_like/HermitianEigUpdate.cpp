@@ -0,0 +1,160 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A,
+  const DistMatrix<Base<F>,STAR,STAR>& w,
+  const DistMatrix<F>& Z )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = HermitianOneNorm( LOWER, A );
+
+    // Compare against the eigenvalues from the dense solver
+    OutputFromRoot(g.Comm(),"Testing eigenvalues");
+    PushIndent();
+    DistMatrix<F> ACopy( A );
+    DistMatrix<Real,VR,STAR> wDense(g);
+    HermitianEig( LOWER, ACopy, wDense );
+    DistMatrix<Real,STAR,STAR> wError( wDense );
+    wError -= w;
+    const Real relEigError = MaxNorm( wError ) / (n*eps*oneNormA);
+    OutputFromRoot
+    (g.Comm(),"|| w - wDense ||_max / (n eps || A ||_1) = ",relEigError);
+    PopIndent();
+
+    // Form I - Z^H Z
+    OutputFromRoot(g.Comm(),"Testing orthogonality of Z");
+    PushIndent();
+    DistMatrix<F> E(g);
+    Identity( E, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), Z, Real(1), E );
+    const Real relOrthogError = HermitianMaxNorm( LOWER, E ) / (n*eps);
+    OutputFromRoot
+    (g.Comm(),"|| I - Z^H Z ||_max / (n eps) = ",relOrthogError);
+    PopIndent();
+
+    // Form A Z - Z diag(w)
+    OutputFromRoot(g.Comm(),"Testing residuals");
+    PushIndent();
+    DistMatrix<F> ZScaled( Z ), R(g);
+    DiagonalScale( RIGHT, NORMAL, w, ZScaled );
+    Zeros( R, n, n );
+    Hemm( LEFT, LOWER, F(1), A, Z, F(0), R );
+    R -= ZScaled;
+    const Real relResidError = FrobeniusNorm( R ) / (n*eps*oneNormA);
+    OutputFromRoot
+    (g.Comm(),"|| A Z - Z diag(w) ||_F / (n eps || A ||_1) = ",relResidError);
+    PopIndent();
+
+    if( relEigError > Real(100) )
+        LogicError("Relative eigenvalue error was unacceptably large");
+    if( relOrthogError > Real(100) )
+        LogicError("Relative orthogonality error was unacceptably large");
+    if( relResidError > Real(100) )
+        LogicError("Relative residual was unacceptably large");
+}
+
+template<typename F>
+void TestHermitianEigUpdate
+( const Grid& g,
+  Int n,
+  Int rank,
+  bool correctness,
+  bool print,
+  bool progress )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    DistMatrix<F> A(g), Z(g), U(g), V(g);
+    DistMatrix<Real,STAR,STAR> w(g);
+    Wigner( A, n );
+    {
+        DistMatrix<F> ACopy( A );
+        HermitianEig( LOWER, ACopy, w, Z );
+    }
+
+    // Add and remove samples as in a sliding-window covariance
+    Uniform( U, n, rank );
+    Zeros( V, rank, rank );
+    for( Int j=0; j<rank; ++j )
+        V.Set( j, j, ( j % 2 == 0 ? Real(1) : Real(-1) ) / Real(n) );
+    if( print )
+    {
+        Print( U, "U" );
+        Print( V, "V" );
+    }
+
+    HermitianEigUpdateCtrl<Real> ctrl;
+    ctrl.progress = progress;
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    auto info = HermitianEigUpdate( w, Z, U, V, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot
+    (g.Comm(),"Time: ",timer.Stop()," seconds, ",info.numDeflations,
+     " deflations, ",info.numIterations," secular iterations");
+    if( print )
+    {
+        Print( w, "w" );
+        Print( Z, "Z" );
+    }
+
+    if( correctness )
+    {
+        DistMatrix<F> UV(g);
+        Gemm( NORMAL, NORMAL, F(1), U, V, UV );
+        Gemm( NORMAL, ADJOINT, F(1), UV, U, F(1), A );
+        TestCorrectness( A, w, Z );
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--height","height of matrix",200);
+        const Int rank = Input("--rank","rank of the update",4);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool correctness =
+          Input("--correctness","test correctness?",true);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        TestHermitianEigUpdate<double>
+        ( g, n, rank, correctness, print, progress );
+        TestHermitianEigUpdate<Complex<double>>
+        ( g, n, rank, correctness, print, progress );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -423,6 +423,68 @@ void TestHermitianGenDefEig
     PopIndent();
 }
 
+// Reuse the Cholesky factor of B for a pencil and then refine the smallest
+// eigenpairs after a small perturbation of A
+template<typename F>
+void TestSolver
+( Int m,
+  UpperOrLower uplo,
+  Pencil pencil,
+  const Grid& g )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing HermitianGenDefEigSolver");
+    PushIndent();
+
+    DistMatrix<F> A(g), B(g);
+    HermitianUniformSpectrum( A, m, 1, 10 );
+    if( pencil == BAX )
+    {
+        Zeros( B, m, m );
+        DistMatrix<F> C(g);
+        Uniform( C, m, m );
+        Herk( uplo, ADJOINT, Real(1), C, Real(0), B );
+    }
+    else
+        HermitianUniformSpectrum( B, m, 1, 10 );
+
+    HermitianGenDefEigSolver<F> solver( pencil, uplo, B );
+    DistMatrix<F> AMod( A ), BMod( B ), X(g);
+    DistMatrix<Real,VR,STAR> w(g), wRef(g);
+    solver.Eig( AMod, w, X );
+    AMod = A;
+    HermitianGenDefEig( pencil, uplo, AMod, BMod, wRef );
+    const Real scale = MaxNorm( wRef );
+    const Real eps = limits::Epsilon<Real>();
+    w -= wRef;
+    const Real eigError = MaxNorm( w );
+    OutputFromRoot(g.Comm(),"|| w - wRef ||_max = ",eigError);
+    if( eigError > 100*m*eps*scale )
+        LogicError("Cached factorization yielded different eigenvalues");
+
+    // Perturb A and refine the smallest eigenpairs
+    const Int k = Max( Min( m/4, Int(10) ), Int(1) );
+    DistMatrix<F> E(g);
+    HermitianUniformSpectrum( E, m, -1, 1 );
+    Axpy( Pow(eps,Real(0.25)), E, A );
+    DistMatrix<F> Xk( X(ALL,IR(0,k)) );
+    DistMatrix<Real,VR,STAR> wk(g);
+    HermitianGenDefRefineCtrl<Real> refineCtrl;
+    refineCtrl.maxIts = 100;
+    const Int numIts = solver.Refine( A, wk, Xk, refineCtrl );
+    AMod = A;
+    solver.Eig( AMod, wRef );
+    DistMatrix<Real,VR,STAR> wRefk( wRef(IR(0,k),ALL) );
+    wk -= wRefk;
+    const Real refineError = MaxNorm( wk );
+    OutputFromRoot
+    (g.Comm(),"Refinement: ",numIts," iterations, || w - wRef ||_max = ",
+     refineError);
+    if( refineError > 10*refineCtrl.tol*scale )
+        LogicError("Refinement did not converge to the smallest eigenvalues");
+    PopIndent();
+}
+
 template<typename F>
 void TestSuite
 ( Int m,
@@ -488,6 +550,8 @@ void TestSuite
         OutputFromRoot(g.Comm(),"Nonstandard distributions:");
         TestHermitianGenDefEig<F,MR,MC,MC>
         ( m, uplo, pencil, onlyEigvals, correctness, print, g, ctrl );
+
+        TestSolver<F>( m, uplo, pencil, g );
     }
 
     PopIndent();
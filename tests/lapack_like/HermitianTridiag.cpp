@@ -270,6 +270,50 @@ void TestHermitianTridiag
     PopIndent();
 }
 
+template<typename Field>
+void TestTwoStage
+( UpperOrLower uplo,
+  const DistMatrix<Field>& A,
+  const HermitianTridiagCtrl<Field>& ctrl,
+  bool correctness,
+  bool print )
+{
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Grid& grid = A.Grid();
+    DistMatrix<Field> T( A );
+    Timer timer;
+
+    OutputFromRoot(grid.Comm(),"Starting two-stage tridiagonalization...");
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    herm_tridiag::ExplicitCondensed( uplo, T, ctrl );
+    mpi::Barrier( grid.Comm() );
+    OutputFromRoot(grid.Comm(),timer.Stop()," seconds");
+    if( print )
+        Print( T, "T after two-stage tridiagonalization" );
+    if( !correctness )
+        return;
+
+    // The two-stage reduction discards the reflectors, so compare the
+    // eigenvalues of the tridiagonal matrix against those of A
+    DistMatrix<Field> ACopy( A );
+    DistMatrix<Real,VR,STAR> w(grid), wTwoStage(grid);
+    HermitianEig( uplo, ACopy, w );
+    auto d = GetRealPartOfDiagonal( T );
+    auto e = GetDiagonal( T, -1 );
+    HermitianTridiagEig( d, e, wTwoStage );
+    const Real normA = HermitianFrobeniusNorm( uplo, A );
+    wTwoStage -= w;
+    const Real relError = FrobeniusNorm( wTwoStage ) /
+      (normA*m*limits::Epsilon<Real>());
+    OutputFromRoot
+    (grid.Comm(),"||w - wTwoStage||_F / (eps m ||A||_F) = ",relError);
+    // TODO: A more refined failure condition
+    if( relError > Real(100) )
+        LogicError("Relative eigenvalue error was unacceptably large");
+}
+
 template<typename Field>
 void TestHermitianTridiag
 ( const Grid& grid,
@@ -277,6 +321,7 @@ void TestHermitianTridiag
   Int m,
   Int nbLocal,
   bool avoidTrmv,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -314,6 +359,24 @@ void TestHermitianTridiag
     ctrl.order = COLUMN_MAJOR;
     InnerTestHermitianTridiag
     ( uplo, A, householderScalars, ctrl, correctness, print, display );
+
+    OutputFromRoot(grid.Comm(),"Adaptive algorithm:");
+    if( !GetGemmCostModel().calibrated )
+        CalibrateGemmCostModel( grid );
+    int gridHeight, gridWidth;
+    SelectCondenseGrid
+    ( CONDENSE_HERMITIAN_TRIDIAG, m, m, grid, gridHeight, gridWidth,
+      sizeof(Field) );
+    OutputFromRoot
+    (grid.Comm(),"Selected a ",gridHeight," x ",gridWidth," grid");
+    ctrl.approach = HERMITIAN_TRIDIAG_ADAPTIVE;
+    InnerTestHermitianTridiag
+    ( uplo, A, householderScalars, ctrl, correctness, print, display );
+
+    OutputFromRoot(grid.Comm(),"Two-stage algorithm:");
+    ctrl.twoStage = true;
+    ctrl.bandwidth = bandwidth;
+    TestTwoStage( uplo, A, ctrl, correctness, print );
     PopIndent();
 }
 
@@ -333,6 +396,8 @@ main( int argc, char* argv[] )
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool avoidTrmv =
           Input("--avoidTrmv","avoid Trmv local Symv",true);
+        const Int bandwidth =
+          Input("--bandwidth","two-stage intermediate bandwidth",8);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
@@ -411,48 +476,59 @@ main( int argc, char* argv[] )
 
         if( testReal )
             TestHermitianTridiag<float>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<float>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 
         if( testReal )
             TestHermitianTridiag<double>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<double>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 
 #ifdef EL_HAVE_QD
         if( testReal )
         {
             TestHermitianTridiag<DoubleDouble>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
             TestHermitianTridiag<QuadDouble>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         }
         if( testCpx )
         {
             TestHermitianTridiag<Complex<DoubleDouble>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
             TestHermitianTridiag<Complex<QuadDouble>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         }
 #endif
 
 #ifdef EL_HAVE_QUAD
         if( testReal )
             TestHermitianTridiag<Quad>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<Quad>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
         if( testReal )
             TestHermitianTridiag<BigFloat>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -150,6 +150,67 @@ void TestRandom
         Print( R );
 }
 
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void TestBisection( Int n, Int numThreads, bool print )
+{
+    EL_DEBUG_CSE
+    Output("Testing bisection with ",TypeName<Real>());
+
+    Matrix<Real> d, e;
+    Uniform( d, n, 1 );
+    Uniform( e, n-1, 1 );
+    const Real TOne = HermitianTridiagOneNorm( d, e );
+    const Real tol = 10*n*limits::Epsilon<Real>()*TOne;
+
+    HermitianTridiagEigCtrl<Real> ctrl;
+    ctrl.alg = HERM_TRIDIAG_EIG_QR;
+    Matrix<Real> wQR;
+    HermitianTridiagEig( d, e, wQR, ctrl );
+
+    ctrl.alg = HERM_TRIDIAG_EIG_BISECTION;
+    ctrl.bisectCtrl.numThreads = numThreads;
+    ctrl.bisectCtrl.batchSize = Max( n/(2*numThreads), Int(1) );
+    Matrix<Real> w;
+    Timer timer;
+    timer.Start();
+    HermitianTridiagEig( d, e, w, ctrl );
+    Output("Bisection: ",timer.Stop()," seconds");
+    if( print )
+    {
+        Print( wQR, "wQR" );
+        Print( w, "w" );
+    }
+    w -= wQR;
+    const Real error = MaxNorm( w );
+    Output("|| w - wQR ||_max / || T ||_1 = ",error/TOne);
+    if( error > tol )
+        LogicError("Bisection eigenvalues differed by ",error);
+
+    // The middle half of the spectrum, first by index and then by range
+    const Int lowerIndex = n/4;
+    const Int upperIndex = (3*n)/4;
+    ctrl.subset.indexSubset = true;
+    ctrl.subset.lowerIndex = lowerIndex;
+    ctrl.subset.upperIndex = upperIndex;
+    HermitianTridiagEig( d, e, w, ctrl );
+    w -= wQR( IR(lowerIndex,upperIndex+1), ALL );
+    if( MaxNorm(w) > tol )
+        LogicError("Bisection index subset was incorrect");
+
+    ctrl.subset.indexSubset = false;
+    ctrl.subset.rangeSubset = true;
+    ctrl.subset.lowerBound = (wQR(lowerIndex-1)+wQR(lowerIndex))/2;
+    ctrl.subset.upperBound = (wQR(upperIndex)+wQR(upperIndex+1))/2;
+    HermitianTridiagEig( d, e, w, ctrl );
+    if( w.Height() != upperIndex-lowerIndex+1 )
+        LogicError
+        ("Bisection range subset found ",w.Height()," eigenvalues rather than ",
+         upperIndex-lowerIndex+1);
+    w -= wQR( IR(lowerIndex,upperIndex+1), ALL );
+    if( MaxNorm(w) > tol )
+        LogicError("Bisection range subset was incorrect");
+}
+
 int main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
@@ -163,6 +224,8 @@ int main( int argc, char* argv[] )
         const bool progress = Input("--progress","print progress?",true);
         const bool print = Input("--print","print matrices?",false);
         const Int algInt = Input("--algInt","0: QR, 1: D&C, 2: MRRR",1);
+        const Int numThreads =
+          Input("--numThreads","number of threads for bisection",2);
         ProcessInput();
         PrintInputReport();
 
@@ -195,6 +258,12 @@ int main( int argc, char* argv[] )
 #ifdef EL_HAVE_MPC
         TestRandom<BigFloat>( n, progress, alg, qrCtrl, print );
 #endif
+
+        TestBisection<float>( n, numThreads, print );
+        TestBisection<double>( n, numThreads, print );
+#ifdef EL_HAVE_QD
+        TestBisection<DoubleDouble>( n, numThreads, print );
+#endif
     }
     catch( std::exception& e ) { ReportException(e); }
 
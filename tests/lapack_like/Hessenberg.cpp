@@ -232,7 +232,63 @@ void TestHessenberg
         Display( householderScalars, "householderScalars after Hessenberg" );
     }
     if( correctness )
+    {
+        TestCorrectness( uplo, A, householderScalars, AOrig, print, display );
+
+        OutputFromRoot(grid.Comm(),"Reducing on an adaptive grid...");
+        if( !GetGemmCostModel().calibrated )
+            CalibrateGemmCostModel( grid );
+        A = AOrig;
+        HessenbergCtrl ctrl;
+        ctrl.adaptiveGrid = true;
+        Hessenberg( uplo, A, householderScalars, ctrl );
         TestCorrectness( uplo, A, householderScalars, AOrig, print, display );
+    }
+    PopIndent();
+}
+
+// Check that the two-stage reduction returns an upper Hessenberg H and a
+// unitary Q such that A = Q H Q^H
+template<typename Field>
+void TestTwoStage( const Grid& grid, Int n, Int bandwidth )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot
+    (grid.Comm(),"Testing two-stage reduction with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> A(grid), AOrig(grid), Q(grid), H(grid), E(grid);
+    Uniform( A, n, n );
+    AOrig = A;
+    const Real oneNormAOrig = OneNorm( AOrig );
+    hessenberg::TwoStage( A, Q, bandwidth );
+
+    H = A;
+    MakeTrapezoidal( LOWER, H, -2 );
+    if( FrobeniusNorm( H ) != Real(0) )
+        LogicError("The two-stage reduction was not upper Hessenberg");
+
+    Identity( E, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), E );
+    const Real orthError = HermitianMaxNorm( LOWER, E );
+    Gemm( NORMAL, NORMAL, Field(1), Q, A, H );
+    E = AOrig;
+    Gemm( NORMAL, ADJOINT, Field(-1), H, Q, Field(1), E );
+    const Real relError = InfinityNorm( E ) / (n*eps*oneNormAOrig);
+    OutputFromRoot
+    (grid.Comm(),"||I - Q^H Q||_max = ",orthError,
+     ", ||A - Q H Q^H||_oo / (eps n || A ||_1) = ",relError);
+    if( orthError > n*eps || relError > Real(1) )
+        LogicError("Unacceptably large two-stage error");
+
+    // The reduction without Q should produce the same Hessenberg matrix
+    DistMatrix<Field> B( AOrig );
+    hessenberg::TwoStage( B, bandwidth );
+    B -= A;
+    if( FrobeniusNorm( B ) > n*eps*oneNormAOrig )
+        LogicError("The two-stage reductions with and without Q differed");
+
     PopIndent();
 }
 
@@ -249,6 +305,8 @@ main( int argc, char* argv[] )
         const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
         const Int n = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int bandwidth =
+          Input("--bandwidth","two-stage bandwidth (nb if zero)",7);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
@@ -311,6 +369,9 @@ main( int argc, char* argv[] )
 #endif
         }
 
+        TestTwoStage<double>( grid, n, bandwidth );
+        TestTwoStage<Complex<double>>( grid, n, bandwidth );
+
         TestHessenberg<float>
         ( grid, uplo, n, correctness, print, display );
         TestHessenberg<Complex<float>>
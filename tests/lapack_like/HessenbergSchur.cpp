@@ -293,6 +293,68 @@ void TestRandom
     TestRandomHelper( H, ctrl, print );
 }
 
+template<typename Field>
+void TestBatched
+( Int n, Int batchSize, const Grid& grid, const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    if( grid.Rank() == 0 )
+        Output("Testing batched uniform Hessenberg with ",TypeName<Field>());
+
+    // All three matrices use the default alignments and cuts of zero
+    DistMatrix<Field,STAR,VR,BLOCK>
+      H(n,n*batchSize,grid,n,n), Z(n,n*batchSize,grid,n,n);
+    DistMatrix<Complex<Real>,STAR,VR,BLOCK> w(n,batchSize,grid,n,1);
+    Uniform( H, n, n*batchSize );
+
+    // Zero the entries below the subdiagonal of each local member
+    const Int localBatchSize = w.LocalWidth();
+    for( Int b=0; b<localBatchSize; ++b )
+    {
+        auto HMember = H.Matrix()( ALL, IR(b*n,(b+1)*n) );
+        MakeTrapezoidal( UPPER, HMember, -1 );
+    }
+    const Matrix<Field> HOrig( H.LockedMatrix() );
+
+    Timer timer;
+    timer.Start();
+    auto info = BatchedHessenbergSchur( H, w, Z, ctrl );
+    if( grid.Rank() == 0 )
+    {
+        Output("BatchedHessenbergSchur: ",timer.Stop()," seconds");
+        Output("Maximum of ",info.numIterations," iterations");
+    }
+
+    Real maxRelErr = 0;
+    Matrix<Field> R;
+    for( Int b=0; b<localBatchSize; ++b )
+    {
+        const IR memberInd(b*n,(b+1)*n);
+        auto HMember = HOrig( ALL, memberInd );
+        auto TMember = H.LockedMatrix()( ALL, memberInd );
+        auto ZMember = Z.LockedMatrix()( ALL, memberInd );
+        Gemm( NORMAL, NORMAL, Field(1), ZMember, TMember, R );
+        Gemm( NORMAL, NORMAL, Field(1), HMember, ZMember, Field(-1), R );
+        const Real relErr =
+          FrobeniusNorm( R ) / (eps*n*FrobeniusNorm( HMember ));
+        maxRelErr = Max( maxRelErr, relErr );
+    }
+    maxRelErr = mpi::AllReduce( maxRelErr, mpi::MAX, H.DistComm() );
+    if( grid.Rank() == 0 )
+        Output
+        ("max_b || H_b Z_b - Z_b T_b ||_F / (eps n || H_b ||_F) = ",
+         maxRelErr);
+    if( maxRelErr > Real(100) )
+        LogicError("Relative error was unacceptably large");
+    if( grid.Rank() == 0 )
+    {
+        Output("Passed test");
+        Output("");
+    }
+}
+
 int main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
@@ -300,11 +362,21 @@ int main( int argc, char* argv[] )
     try
     {
         const Int n = Input("--n","random matrix size",60);
+        const Int batchSize =
+          Input("--batchSize","number of matrices in the batched test",0);
         const Int algInt = Input("--alg","AED: 0, MultiBulge: 1, Simple: 2",0);
         const Int minMultiBulgeSize =
           Input
           ("--minMultiBulgeSize",
            "minimum size for using a multi-bulge algorithm",75);
+        const Int minDistMultiBulgeSize =
+          Input
+          ("--minDistMultiBulgeSize",
+           "minimum size for using the distributed multi-bulge algorithm",400);
+        const Int minDistAEDSize =
+          Input
+          ("--minDistAEDSize",
+           "minimum size for solving AED windows on a subgrid",1000);
         const bool accumulate =
           Input("--accumulate","accumulate reflections?",true);
         const bool sortShifts =
@@ -322,6 +394,8 @@ int main( int argc, char* argv[] )
         HessenbergSchurCtrl ctrl;
         ctrl.alg = static_cast<HessenbergSchurAlg>(algInt);
         ctrl.minMultiBulgeSize = minMultiBulgeSize;
+        ctrl.minDistMultiBulgeSize = minDistMultiBulgeSize;
+        ctrl.minDistAEDSize = minDistAEDSize;
         ctrl.accumulateReflections = accumulate;
         ctrl.sortShifts = sortShifts;
         ctrl.progress = progress;
@@ -390,6 +464,13 @@ int main( int argc, char* argv[] )
             TestRandom<Complex<BigFloat>>( n, grid, ctrl, print );
 #endif
         }
+        if( batchSize > 0 )
+        {
+            TestBatched<float>( n, batchSize, grid, ctrl );
+            TestBatched<Complex<float>>( n, batchSize, grid, ctrl );
+            TestBatched<double>( n, batchSize, grid, ctrl );
+            TestBatched<Complex<double>>( n, batchSize, grid, ctrl );
+        }
     }
     catch( std::exception& e ) { ReportException(e); }
 
@@ -0,0 +1,95 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Return || A inv(A) - I ||_F / (|| A ||_F || inv(A) ||_F)
+template<typename Field>
+Base<Field> Residual( const Matrix<Field>& A, const Matrix<Field>& AInv )
+{
+    const Int n = A.Height();
+    Matrix<Field> E;
+    Identity( E, n, n );
+    Gemm( NORMAL, NORMAL, Field(1), A, AInv, Field(-1), E );
+    return FrobeniusNorm( E ) / (FrobeniusNorm( A )*FrobeniusNorm( AInv ));
+}
+
+template<typename Field>
+void TestInverse( Int n, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+    typedef Base<Field> Real;
+    const Real tol = Real(10)*n*limits::Epsilon<Real>();
+
+    // A random matrix with a small diagonal so that pivoting is required
+    Matrix<Field> A;
+    Uniform( A, n, n );
+    for( Int i=0; i<n; ++i )
+        A(i,i) *= limits::Epsilon<Real>();
+
+    Timer timer;
+    Matrix<Field> AInv( A );
+    timer.Start();
+    Inverse( AInv );
+    const double luTime = timer.Stop();
+    const Real luResid = Residual( A, AInv );
+
+    AInv = A;
+    timer.Start();
+    inverse::GaussJordan( AInv );
+    const double gjTime = timer.Stop();
+    const Real gjResid = Residual( A, AInv );
+
+    DistMatrix<Field> AInvDist(g);
+    {
+        DistMatrix<Field,STAR,STAR> A_STAR_STAR(g);
+        A_STAR_STAR.Resize( n, n );
+        A_STAR_STAR.Matrix() = A;
+        AInvDist = A_STAR_STAR;
+    }
+    inverse::GaussJordan( AInvDist );
+    DistMatrix<Field,STAR,STAR> AInv_STAR_STAR( AInvDist );
+    const Real gjDistResid = Residual( A, AInv_STAR_STAR.Matrix() );
+
+    OutputFromRoot
+    (g.Comm(),"LU-based: ",luResid," (",luTime," secs), Gauss-Jordan: ",
+     gjResid," (",gjTime," secs), distributed Gauss-Jordan: ",gjDistResid);
+    if( luResid > tol || gjResid > tol || gjDistResid > tol )
+        LogicError("Inversion was inaccurate");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","matrix order",300);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        TestInverse<float>( n, g );
+        TestInverse<Complex<float>>( n, g );
+        TestInverse<double>( n, g );
+        TestInverse<Complex<double>>( n, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -93,6 +93,38 @@ void TestCorrectness
         LogicError("Relative error was unacceptably high");
 }
 
+template<typename Field>
+void TestAasenCorrectness
+( bool conjugated,
+  bool print,
+  const Matrix<Field>& A,
+  const Permutation& p,
+  const Matrix<Field>& AOrig,
+        Int numRHS=100 )
+{
+    typedef Base<Field> Real;
+    const Int m = AOrig.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = HermitianOneNorm( LOWER, AOrig );
+
+    Matrix<Field> B, X;
+    Uniform( B, m, numRHS );
+    X = B;
+    ldl::SolveAfterAasen( A, p, X, conjugated );
+    if( print )
+        Print( X, "X" );
+    const Real oneNormX = OneNorm( X );
+    Symm( LEFT, LOWER, Field(-1), AOrig, X, Field(1), B, conjugated );
+    const Real infError = InfinityNorm( B );
+    const Real relError = infError / (m*eps*oneNormA*oneNormX);
+
+    Output("||B - A X||_oo / (eps m ||A||_1 ||X||_1) = ",relError);
+
+    // TODO: A more refined failure condition
+    if( relError > Real(10) )
+        LogicError("Relative error was unacceptably high");
+}
+
 template<typename Field>
 void TestLDL
 ( Int m,
@@ -134,7 +166,18 @@ void TestLDL
         Print( P, "P" );
     }
     if( correctness )
+    {
         TestCorrectness( conjugated, print, A, dSub, p, AOrig );
+
+        Output("Starting Aasen factorization...");
+        A = AOrig;
+        timer.Start();
+        ldl::Aasen( A, p, conjugated );
+        Output(timer.Stop()," seconds");
+        if( print )
+            Print( A, "A after Aasen factorization" );
+        TestAasenCorrectness( conjugated, print, A, p, AOrig );
+    }
     PopIndent();
 }
 
@@ -186,6 +229,59 @@ void TestLDL
     PopIndent();
 }
 
+// Check the single-pass determinant and inertia against a Hermitian matrix
+// with a prescribed spectrum
+template<typename Field>
+void TestDeterminantAndInertia( const Grid& grid, Int m )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot
+    (grid.Comm(),"Testing LDLDeterminantAndInertia with ",TypeName<Field>());
+    DistMatrix<Real,STAR,STAR> w(grid);
+    Zeros( w, m, 1 );
+    InertiaType expected;
+    expected.numPositive = expected.numNegative = expected.numZero = 0;
+    Real logAbsDet = 0;
+    for( Int i=0; i<m; ++i )
+    {
+        const Real omega = ( i % 3 == 0 ? Real(-1) : Real(1) )*(1+Real(i)/m);
+        w.Set( i, 0, omega );
+        if( omega > 0 )
+            ++expected.numPositive;
+        else
+            ++expected.numNegative;
+        logAbsDet += Log(Abs(omega));
+    }
+    const Real expectedRho =
+      ( expected.numNegative % 2 == 0 ? Real(1) : Real(-1) );
+
+    DistMatrix<Field> Z(grid), A(grid);
+    Gaussian( Z, m, m );
+    qr::ExplicitUnitary( Z );
+    HermitianFromEVD( LOWER, A, w, Z );
+
+    InertiaType inertia;
+    auto det = LDLDeterminantAndInertia( LOWER, A, inertia );
+    if( inertia.numPositive != expected.numPositive ||
+        inertia.numNegative != expected.numNegative ||
+        inertia.numZero != expected.numZero )
+        LogicError
+        ("Inertia was (",inertia.numPositive,",",inertia.numNegative,",",
+         inertia.numZero,") rather than (",expected.numPositive,",",
+         expected.numNegative,",",expected.numZero,")");
+    const Real logError = Abs(det.kappa*det.n - logAbsDet);
+    OutputFromRoot(grid.Comm(),"log|det(A)| error: ",logError);
+    if( det.rho != expectedRho || logError > Real(1e-8)*m )
+        LogicError("Determinant was incorrect");
+
+    // Allowing A to be overwritten should not change the result
+    InertiaType inertiaOver;
+    auto detOver = LDLDeterminantAndInertia( LOWER, A, inertiaOver, true );
+    if( detOver.rho != det.rho || detOver.kappa != det.kappa ||
+        inertiaOver.numNegative != inertia.numNegative )
+        LogicError("The overwriting variant disagreed");
+}
+
 int
 main( int argc, char* argv[] )
 {
@@ -295,6 +391,9 @@ main( int argc, char* argv[] )
         TestLDL<Complex<BigFloat>>
         ( grid, m, conjugated, nbLocal, correctness, print );
 #endif
+
+        TestDeterminantAndInertia<double>( grid, m );
+        TestDeterminantAndInertia<Complex<double>>( grid, m );
     }
     catch( exception& e ) { ReportException(e); }
 
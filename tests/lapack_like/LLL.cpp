@@ -0,0 +1,197 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Ensure that R^H R matches the Gram matrix of the first 'rank' columns of B
+template<typename F>
+void CheckGram( const Matrix<F>& B, const Matrix<F>& R, Int rank )
+{
+    typedef Base<F> Real;
+    auto BActive = B( ALL, IR(0,rank) );
+    auto RActive = R( IR(0,rank), IR(0,rank) );
+    Matrix<F> G;
+    Herk( LOWER, ADJOINT, Real(1), BActive, G );
+    Herk( LOWER, ADJOINT, Real(-1), RActive, Real(1), G );
+    MakeHermitian( LOWER, G );
+    const Real error = FrobeniusNorm( G );
+    const Real scale = FrobeniusNorm( BActive );
+    const Real tol = 100*B.Height()*limits::Epsilon<Real>()*scale*scale;
+    Output("  || B^H B - R^H R ||_F = ",error);
+    if( error > tol )
+        LogicError("Gram matrix mismatch of ",error," > ",tol);
+}
+
+template<typename F>
+void CheckReduction
+( const Matrix<F>& BOrig,
+  const Matrix<F>& B,
+  const Matrix<F>& U,
+  const Matrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl,
+  const LLLInfo<Base<F>>& info )
+{
+    typedef Base<F> Real;
+    const Int n = B.Width();
+    Output
+    ("  rank=",info.rank,", nullity=",info.nullity,", numSwaps=",
+     info.numSwaps,", delta=",info.delta,", eta=",info.eta);
+    if( info.rank + info.nullity != n )
+        LogicError("The rank and nullity did not sum to the width");
+
+    // B = BOrig U (with all quantities integral)
+    Matrix<F> E( B );
+    Gemm( NORMAL, NORMAL, F(-1), BOrig, U, F(1), E );
+    if( MaxNorm(E) >= Real(1)/Real(2) )
+        LogicError("B != BOrig U");
+    for( Int j=info.rank; j<n; ++j )
+        if( MaxNorm(B(ALL,IR(j))) != Real(0) )
+            LogicError("Column ",j," of the null space was nonzero");
+
+    CheckGram( B, R, info.rank );
+
+    // Rounding each part of a complex multiplier leaves up to sqrt(2)/2
+    const Real etaBound = ( IsComplex<F>::value ? Real(0.71) : Real(0.51) );
+    if( ctrl.variant != LLL_WEAK && info.eta > etaBound )
+        LogicError("The basis was not size-reduced: eta=",info.eta);
+    if( ctrl.variant != LLL_WEAK && info.delta < ctrl.delta-Real(1e-10) )
+        LogicError
+        ("The basis only satisfied the Lovasz condition for delta=",
+         info.delta);
+}
+
+template<typename F>
+void TestLLL( Int n, Base<F> alpha, Int numThreads )
+{
+    typedef Base<F> Real;
+    Output("Testing LLL with ",TypeName<F>());
+
+    Matrix<F> A;
+    AjtaiTypeBasis( A, n, alpha );
+    const LLLVariant variants[] = { LLL_WEAK, LLL_NORMAL, LLL_DEEP };
+    for( const auto variant : variants )
+    {
+        for( const bool presort : { false, true } )
+        {
+            Output(" variant=",Int(variant),", presort=",presort);
+            LLLCtrl<Real> ctrl;
+            ctrl.delta = Real(0.99);
+            ctrl.variant = variant;
+            ctrl.presort = presort;
+            ctrl.numThreads = numThreads;
+            Matrix<F> B( A ), U, R;
+            auto info = LLL( B, U, R, ctrl );
+            CheckReduction( A, B, U, R, ctrl, info );
+            if( info.nullity != 0 )
+                LogicError("An Ajtai basis should have full rank");
+        }
+    }
+
+    // Append integer combinations of the first few columns so that the
+    // dependencies must be reduced to zero
+    const Int numDep = 3;
+    Matrix<F> C, ADep;
+    Zeros( C, n, numDep );
+    for( Int j=0; j<numDep; ++j )
+        for( Int i=0; i<Min(n,Int(4)); ++i )
+            C(i,j) = F(Int(i+2*j+1));
+    Zeros( ADep, n, n+numDep );
+    auto ADepL = ADep( ALL, IR(0,n) );
+    auto ADepR = ADep( ALL, IR(n,n+numDep) );
+    ADepL = A;
+    Gemm( NORMAL, NORMAL, F(1), A, C, ADepR );
+    LLLCtrl<Real> ctrl;
+    ctrl.numThreads = numThreads;
+    Matrix<F> B( ADep ), U, R;
+    auto info = LLL( B, U, R, ctrl );
+    CheckReduction( ADep, B, U, R, ctrl, info );
+    if( info.rank != n || info.nullity != numDep )
+        LogicError
+        ("Expected a rank of ",n," and a nullity of ",numDep,
+         " but found ",info.rank," and ",info.nullity);
+}
+
+template<typename Real>
+void TestBKZ( Int n, Real radius, Int blocksize )
+{
+    Output("Testing BKZ with ",TypeName<Real>());
+    Matrix<Real> A;
+    KnapsackTypeBasis( A, n, radius );
+
+    BKZCtrl<Real> ctrl;
+    ctrl.blocksize = blocksize;
+    ctrl.lllCtrl.delta = Real(0.99);
+    Matrix<Real> BLLL( A ), RLLL;
+    LLL( BLLL, RLLL, ctrl.lllCtrl );
+    Matrix<Real> B( A ), R;
+    auto info = BKZ( B, R, ctrl );
+    Output
+    ("  numTours=",info.numTours,", numInsertions=",info.numInsertions);
+    if( info.lllInfo.rank != n )
+        LogicError("A knapsack basis should have full rank");
+    CheckGram( B, R, n );
+
+    // The BKZ basis should still be a basis of the lattice: its coordinates
+    // with respect to the original basis must be integral
+    Matrix<Real> X;
+    LeastSquares( NORMAL, A, B, X );
+    Matrix<Real> XRound( X );
+    EntrywiseMap( XRound, function<Real(const Real&)>(
+      []( const Real& alpha ) { return Round(alpha); } ) );
+    XRound -= X;
+    if( MaxNorm(XRound) > Real(1e-6) )
+        LogicError("The BKZ basis left the lattice");
+
+    // Enumeration cannot lengthen the first vector
+    const Real lllNorm = FrobeniusNorm( BLLL(ALL,IR(0)) );
+    const Real bkzNorm = FrobeniusNorm( B(ALL,IR(0)) );
+    Output("  || b_0 ||: LLL=",lllNorm,", BKZ=",bkzNorm);
+    if( bkzNorm > lllNorm*(1+Real(1e-10)) )
+        LogicError("BKZ lengthened the first basis vector");
+    for( Int k=0; k+1<n; ++k )
+    {
+        Matrix<Real> x;
+        const Int kEnd = Min( k+blocksize, n );
+        auto RBlock = R( IR(k,kEnd), IR(k,kEnd) );
+        Matrix<Real> RBlockCopy( RBlock );
+        const Real radiusSq = ctrl.lllCtrl.delta*R(k,k)*R(k,k);
+        if( bkz::Enumerate( RBlockCopy, radiusSq, x ) )
+            LogicError("Window ",k," of the BKZ basis could be improved");
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","dimension of the Ajtai basis",20);
+        const double alpha = Input("--alpha","Ajtai exponent",0.8);
+        const Int nKnapsack = Input("--nKnapsack","knapsack dimension",20);
+        const double radius = Input("--radius","knapsack radius",1e6);
+        const Int blocksize = Input("--blocksize","BKZ blocksize",6);
+        const Int numThreads = Input("--numThreads","number of threads",2);
+        const Int nb = Input("--nb","algorithmic blocksize",8);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        if( mpi::Rank() == 0 )
+        {
+            TestLLL<double>( n, alpha, numThreads );
+            TestLLL<Complex<double>>( n, alpha, numThreads );
+            TestBKZ<double>( nKnapsack, radius, blocksize );
+        }
+        OutputFromRoot(mpi::COMM_WORLD,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void CheckConstraint
+( const Matrix<F>& B, const Matrix<F>& D, const Matrix<F>& X )
+{
+    typedef Base<F> Real;
+    Matrix<F> E( D );
+    Gemm( NORMAL, NORMAL, F(-1), B, X, F(1), E );
+    const Real error = FrobeniusNorm( E );
+    const Real tol =
+      100*B.Width()*limits::Epsilon<Real>()*
+      (FrobeniusNorm(B)*FrobeniusNorm(X)+FrobeniusNorm(D));
+    if( error > tol )
+        LogicError("|| B X - D ||_F = ",error," > ",tol);
+}
+
+template<typename F>
+void CheckSame( const Matrix<F>& X, const Matrix<F>& XRef, const string& msg )
+{
+    typedef Base<F> Real;
+    Matrix<F> E( X );
+    E -= XRef;
+    const Real error = FrobeniusNorm( E );
+    const Real tol =
+      100*X.Height()*limits::Epsilon<Real>()*Max(FrobeniusNorm(XRef),Real(1));
+    if( error > tol )
+        LogicError(msg," differed by ",error," > ",tol);
+}
+
+template<typename F>
+void TestSequential
+( Int m, Int n, Int p, Int numRhs, Int numProblems, Int numThreads )
+{
+    Output("Testing sequential LSE with ",TypeName<F>());
+    Matrix<F> B;
+    Uniform( B, p, n );
+    vector<Matrix<F>> A(numProblems), C(numProblems), D(numProblems), X;
+    for( Int k=0; k<numProblems; ++k )
+    {
+        Uniform( A[k], m, n );
+        Uniform( C[k], m, numRhs );
+        Uniform( D[k], p, numRhs );
+    }
+
+    LSE( A, B, C, D, X, numThreads );
+    Matrix<F> XRef;
+    for( Int k=0; k<numProblems; ++k )
+    {
+        LSE( A[k], B, C[k], D[k], XRef );
+        CheckConstraint( B, D[k], XRef );
+        CheckSame( X[k], XRef, "Batched solution "+std::to_string(k) );
+    }
+
+    // Reuse the factorization of the first problem for new right-hand sides
+    lse::Factorization<F> factorization;
+    lse::Factor( A[0], B, factorization );
+    Matrix<F> CNew, DNew, XNew;
+    Uniform( CNew, m, numRhs );
+    Uniform( DNew, p, numRhs );
+    lse::SolveAfter( factorization, CNew, DNew, XNew );
+    LSE( A[0], B, CNew, DNew, XRef );
+    CheckSame( XNew, XRef, "Factored solution" );
+}
+
+template<typename F>
+void TestDistributed( const Grid& g, Int m, Int n, Int p, Int numRhs )
+{
+    OutputFromRoot(g.Comm(),"Testing distributed LSE with ",TypeName<F>());
+    DistMatrix<F> A(g), B(g), C(g), D(g), X(g), XFact(g);
+    Uniform( A, m, n );
+    Uniform( B, p, n );
+    Uniform( C, m, numRhs );
+    Uniform( D, p, numRhs );
+
+    // A is tall enough that its factorization is built from TSQR panels
+    LSE( A, B, C, D, X );
+    lse::DistFactorization<F> factorization;
+    lse::Factor( A, B, factorization );
+    lse::SolveAfter( factorization, C, D, XFact );
+
+    DistMatrix<F,CIRC,CIRC> B_CIRC_CIRC( B ), D_CIRC_CIRC( D ),
+      X_CIRC_CIRC( X ), XFact_CIRC_CIRC( XFact );
+    if( g.Rank() == 0 )
+    {
+        CheckConstraint
+        ( B_CIRC_CIRC.Matrix(), D_CIRC_CIRC.Matrix(), X_CIRC_CIRC.Matrix() );
+        CheckSame
+        ( XFact_CIRC_CIRC.Matrix(), X_CIRC_CIRC.Matrix(),
+          "Factored solution" );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--m","height of A",200);
+        const Int n = Input("--n","width of A and B",20);
+        const Int p = Input("--p","height of B",5);
+        const Int numRhs = Input("--numRhs","number of right-hand sides",3);
+        const Int numProblems = Input("--numProblems","number of problems",8);
+        const Int numThreads = Input("--numThreads","number of threads",0);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        if( mpi::Rank() == 0 )
+        {
+            TestSequential<double>( m, n, p, numRhs, numProblems, numThreads );
+            TestSequential<Complex<double>>
+            ( m, n, p, numRhs, numProblems, numThreads );
+        }
+
+        const Grid g( mpi::COMM_WORLD );
+        TestDistributed<double>( g, m, n, p, numRhs );
+        TestDistributed<Complex<double>>( g, m, n, p, numRhs );
+        OutputFromRoot(mpi::COMM_WORLD,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -35,10 +35,10 @@ void TestCorrectness
     const Real oneNormY = OneNorm( Y );
     if( pivoting == 0 )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
-        lu::SolveAfter( NORMAL, A, P, Y );
-    else
+    else if( pivoting == 2 )
         lu::SolveAfter( NORMAL, A, P, Q, Y );
+    else
+        lu::SolveAfter( NORMAL, A, P, Y );
 
     // Now investigate the residual, ||AOrig Y - X||_oo
     Gemm( NORMAL, NORMAL, Field(-1), AOrig, Y, Field(1), X );
@@ -82,10 +82,10 @@ void TestCorrectness
     const Real oneNormY = OneNorm( Y );
     if( pivoting == 0 )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
-        lu::SolveAfter( NORMAL, A, P, Y );
-    else
+    else if( pivoting == 2 )
         lu::SolveAfter( NORMAL, A, P, Q, Y );
+    else
+        lu::SolveAfter( NORMAL, A, P, Y );
 
     // Now investigate the residual, ||AOrig Y - X||_oo
     Gemm( NORMAL, NORMAL, Field(-1), AOrig, Y, Field(1), X );
@@ -129,9 +129,10 @@ void TestLU
     Output("Starting LU factorization...");
     Timer timer;
     timer.Start();
+    // Tournament pivoting only differs from partial pivoting in parallel
     if( pivoting == 0 )
         LU( A );
-    else if( pivoting == 1 )
+    else if( pivoting == 1 || pivoting == 3 )
         LU( A, P );
     else if( pivoting == 2 )
         LU( A, P, Q );
@@ -208,6 +209,8 @@ void TestLU
         LU( A, P );
     else if( pivoting == 2 )
         LU( A, P, Q );
+    else if( pivoting == 3 )
+        LU( A, P, LU_CALU );
     mpi::Barrier( grid.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -260,10 +263,13 @@ main( int argc, char* argv[] )
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
-        const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
+        const Int pivot = Input
+          ("--pivot","0: none, 1: partial, 2: full, 3: tournament",1);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const bool lookahead =
+          Input("--lookahead","overlap the next panel?",false);
         const bool correctness =
           Input("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -272,7 +278,7 @@ main( int argc, char* argv[] )
 #endif
         ProcessInput();
         PrintInputReport();
-        if( pivot < 0 || pivot > 2 )
+        if( pivot < 0 || pivot > 3 )
             LogicError("Invalid pivot value");
 
 #ifdef EL_HAVE_MPC
@@ -284,6 +290,7 @@ main( int argc, char* argv[] )
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
         const Grid grid( comm, gridHeight, order );
         SetBlocksize( nb );
+        SetFactorLookahead( lookahead );
         ComplainIfDebug();
         if( pivot == 0 )
             OutputFromRoot(grid.Comm(),"Testing LU with no pivoting");
@@ -291,6 +298,9 @@ main( int argc, char* argv[] )
             OutputFromRoot(grid.Comm(),"Testing LU with partial pivoting");
         else if( pivot == 2 )
             OutputFromRoot(grid.Comm(),"Testing LU with full pivoting");
+        else if( pivot == 3 )
+            OutputFromRoot
+            (grid.Comm(),"Testing LU with tournament pivoting");
 
         if( sequential && mpi::Rank() == 0 )
         {
@@ -0,0 +1,138 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A stable convection-diffusion-like operator whose nonsymmetric off-diagonals
+// yield complex eigenvalues
+template<typename F>
+void MakeStable( Matrix<F>& A, Int n )
+{
+    Zeros( A, n, n );
+    for( Int i=0; i<n; ++i )
+    {
+        A(i,i) = F(-3);
+        if( i > 0 )
+            A(i,i-1) = F(-1)/F(2);
+        if( i < n-1 )
+            A(i,i+1) = F(1);
+    }
+}
+
+template<typename F>
+Base<F> RelativeResidual
+( const Matrix<F>& A, const Matrix<F>& B, const Matrix<F>& Z )
+{
+    const Int n = A.Height();
+    Matrix<F> X, R;
+    Zeros( X, n, n );
+    Zeros( R, n, n );
+    Herk( LOWER, NORMAL, Base<F>(1), Z, X );
+    MakeHermitian( LOWER, X );
+    Herk( LOWER, NORMAL, Base<F>(1), B, R );
+    MakeHermitian( LOWER, R );
+    const Base<F> normBB = FrobeniusNorm( R );
+    Gemm( NORMAL, NORMAL, F(1), A, X, F(1), R );
+    Gemm( NORMAL, ADJOINT, F(1), X, A, F(1), R );
+    return FrobeniusNorm( R ) / normBB;
+}
+
+template<typename F>
+void TestLowRankLyapunov( Int n, Int k, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+
+    Matrix<F> A, B, Z;
+    MakeStable( A, n );
+    Uniform( B, n, k );
+
+    LowRankLyapunovCtrl<Real> ctrl;
+    Timer timer;
+    timer.Start();
+    LowRankLyapunov( A, B, Z, ctrl );
+    const double lowRankTime = timer.Stop();
+    const Real err = RelativeResidual( A, B, Z );
+    OutputFromRoot
+    (g.Comm(),"Low-rank ADI: ",Z.Width()," columns, relative residual ",err,
+     ", ",lowRankTime," secs");
+    if( err > Real(10)*ctrl.relTol )
+        LogicError("Low-rank ADI did not converge");
+
+    // Compare against the dense (sign-based) Lyapunov solver applied to
+    // (-A) X + X (-A)^H = B B^H
+    Matrix<F> ANeg( A ), C, XDense;
+    ANeg *= F(-1);
+    Zeros( C, n, n );
+    Herk( LOWER, NORMAL, Real(1), B, C );
+    MakeHermitian( LOWER, C );
+    timer.Start();
+    Lyapunov( ANeg, C, XDense );
+    const double denseTime = timer.Stop();
+    Matrix<F> X;
+    Zeros( X, n, n );
+    Herk( LOWER, NORMAL, Real(1), Z, X );
+    MakeHermitian( LOWER, X );
+    X -= XDense;
+    const Real diff = FrobeniusNorm( X ) / FrobeniusNorm( XDense );
+    OutputFromRoot
+    (g.Comm(),"Difference from dense solution: ",diff,", dense time: ",
+     denseTime," secs");
+    if( diff > Real(100)*ctrl.relTol )
+        LogicError("Low-rank ADI differed from the dense solution");
+
+    // The distributed solver
+    DistMatrix<F> ADist(g), BDist(g), ZDist(g);
+    {
+        DistMatrix<F,STAR,STAR> A_STAR_STAR(g), B_STAR_STAR(g);
+        A_STAR_STAR.Resize( n, n );
+        A_STAR_STAR.Matrix() = A;
+        B_STAR_STAR.Resize( n, k );
+        B_STAR_STAR.Matrix() = B;
+        ADist = A_STAR_STAR;
+        BDist = B_STAR_STAR;
+    }
+    LowRankLyapunov( ADist, BDist, ZDist, ctrl );
+    DistMatrix<F,STAR,STAR> Z_STAR_STAR( ZDist );
+    const Real errDist = RelativeResidual( A, B, Z_STAR_STAR.Matrix() );
+    OutputFromRoot
+    (g.Comm(),"Distributed low-rank ADI: ",ZDist.Width(),
+     " columns, relative residual ",errDist);
+    if( errDist > Real(10)*ctrl.relTol )
+        LogicError("Distributed low-rank ADI did not converge");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","matrix order",200);
+        const Int k = Input("--k","number of columns of B",2);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestLowRankLyapunov<float>( n, k, g );
+        TestLowRankLyapunov<Complex<float>>( n, k, g );
+        TestLowRankLyapunov<double>( n, k, g );
+        TestLowRankLyapunov<Complex<double>>( n, k, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
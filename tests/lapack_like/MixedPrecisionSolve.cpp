@@ -0,0 +1,220 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The three test matrices are respectively general, Hermitian
+// positive-definite, and Hermitian indefinite, and each is well-conditioned
+// so that refinement from the demoted precision should converge
+enum SolveType { LINEAR_SOLVE, HPD_SOLVE, SYMMETRIC_SOLVE };
+
+template<typename Field>
+void TestCorrectness
+( SolveType type,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Field>& X )
+{
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = OneNorm( A );
+    const Real oneNormX = OneNorm( X );
+
+    Matrix<Field> R( B );
+    if( type == LINEAR_SOLVE )
+        Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), R );
+    else
+        Hemm( LEFT, LOWER, Field(-1), A, X, Field(1), R );
+    const Real relError = InfinityNorm( R ) / (eps*n*oneNormA*oneNormX);
+    Output("||B - A X||_oo / (eps n ||A||_1 ||X||_1) = ",relError);
+
+    // TODO: A more refined failure condition
+    if( relError > Real(10) )
+        LogicError("Relative error was unacceptably high");
+}
+
+template<typename Field>
+void TestCorrectness
+( SolveType type,
+  const DistMatrix<Field>& A,
+  const DistMatrix<Field>& B,
+  const DistMatrix<Field>& X )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = A.Grid();
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = OneNorm( A );
+    const Real oneNormX = OneNorm( X );
+
+    DistMatrix<Field> R( B );
+    if( type == LINEAR_SOLVE )
+        Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), R );
+    else
+        Hemm( LEFT, LOWER, Field(-1), A, X, Field(1), R );
+    const Real relError = InfinityNorm( R ) / (eps*n*oneNormA*oneNormX);
+    OutputFromRoot
+    (grid.Comm(),"||B - A X||_oo / (eps n ||A||_1 ||X||_1) = ",relError);
+
+    // TODO: A more refined failure condition
+    if( relError > Real(10) )
+        LogicError("Relative error was unacceptably high");
+}
+
+template<typename Field>
+void TestSolve
+( SolveType type,
+  Int n,
+  Int numRHS,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl,
+  bool print )
+{
+    Output("Testing with ",TypeName<Field>());
+    PushIndent();
+
+    Matrix<Field> A, B, X;
+    if( type == LINEAR_SOLVE )
+    {
+        Uniform( A, n, n );
+        ShiftDiagonal( A, Field(n) );
+    }
+    else if( type == HPD_SOLVE )
+        HermitianUniformSpectrum( A, n, 1, 10 );
+    else
+        HermitianUniformSpectrum( A, n, -10, 10 );
+    Uniform( B, n, numRHS );
+    X = B;
+    if( print )
+        Print( A, "A" );
+
+    Timer timer;
+    timer.Start();
+    if( type == LINEAR_SOLVE )
+        LinearSolve( A, X, ctrl );
+    else if( type == HPD_SOLVE )
+        HPDSolve( LOWER, NORMAL, A, X, ctrl );
+    else
+        SymmetricSolve( LOWER, NORMAL, A, X, true, ctrl );
+    Output(timer.Stop()," seconds");
+    if( print )
+        Print( X, "X" );
+    TestCorrectness( type, A, B, X );
+    PopIndent();
+}
+
+template<typename Field>
+void TestSolve
+( const Grid& grid,
+  SolveType type,
+  Int n,
+  Int numRHS,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl,
+  bool print )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> A(grid), B(grid), X(grid);
+    if( type == LINEAR_SOLVE )
+    {
+        Uniform( A, n, n );
+        ShiftDiagonal( A, Field(n) );
+    }
+    else if( type == HPD_SOLVE )
+        HermitianUniformSpectrum( A, n, 1, 10 );
+    else
+        HermitianUniformSpectrum( A, n, -10, 10 );
+    Uniform( B, n, numRHS );
+    X = B;
+    if( print )
+        Print( A, "A" );
+
+    Timer timer;
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    if( type == LINEAR_SOLVE )
+        LinearSolve( A, X, ctrl );
+    else if( type == HPD_SOLVE )
+        HPDSolve( LOWER, NORMAL, A, X, ctrl );
+    else
+        SymmetricSolve( LOWER, NORMAL, A, X, true, ctrl );
+    mpi::Barrier( grid.Comm() );
+    OutputFromRoot(grid.Comm(),timer.Stop()," seconds");
+    if( print )
+        Print( X, "X" );
+    TestCorrectness( type, A, B, X );
+    PopIndent();
+}
+
+template<typename Field>
+void TestSolves
+( const Grid& grid,
+  Int n,
+  Int numRHS,
+  bool gmres,
+  bool promoteResiduals,
+  bool sequential,
+  bool print )
+{
+    MixedPrecisionCtrl<Base<Field>> ctrl;
+    ctrl.gmres = gmres;
+    ctrl.promoteResiduals = promoteResiduals;
+    const SolveType types[3] = { LINEAR_SOLVE, HPD_SOLVE, SYMMETRIC_SOLVE };
+    for( Int k=0; k<3; ++k )
+    {
+        if( sequential && mpi::Rank() == 0 )
+            TestSolve<Field>( types[k], n, numRHS, ctrl, print );
+        if( !gmres )
+            TestSolve<Field>( grid, types[k], n, numRHS, ctrl, print );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","process grid height",0);
+        const Int n = Input("--height","height of matrix",100);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool gmres = Input("--gmres","use GMRES-IR?",false);
+        const bool promoteResiduals =
+          Input("--promote","promote the residuals?",false);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid grid( comm, gridHeight );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        TestSolves<double>
+        ( grid, n, numRHS, gmres, promoteResiduals, sequential, print );
+        TestSolves<Complex<double>>
+        ( grid, n, numRHS, gmres, promoteResiduals, sequential, print );
+
+#ifdef EL_HAVE_QD
+        TestSolves<DoubleDouble>
+        ( grid, n, numRHS, gmres, promoteResiduals, sequential, print );
+        TestSolves<Complex<DoubleDouble>>
+        ( grid, n, numRHS, gmres, promoteResiduals, sequential, print );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
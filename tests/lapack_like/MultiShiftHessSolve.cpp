@@ -141,7 +141,8 @@ void TestHessenberg
   Int n, 
   bool correctness,
   bool print,
-  bool display )
+  bool display,
+  const MultiShiftHessCtrl& ctrl )
 {
     Output("Testing with ",TypeName<F>());
     PushIndent();
@@ -164,7 +165,7 @@ void TestHessenberg
     Output("Starting Hessenberg solve...");
     Timer timer;
     timer.Start();
-    MultiShiftHessSolve( uplo, orientation, F(1), H, shifts, X );
+    MultiShiftHessSolve( uplo, orientation, F(1), H, shifts, X, ctrl );
     const double runTime = timer.Stop();
     // TODO: Flop calculation
     Output("Time = ",runTime," seconds");
@@ -182,7 +183,8 @@ void TestHessenberg
   Int n, 
   bool correctness,
   bool print,
-  bool display )
+  bool display,
+  const MultiShiftHessCtrl& ctrl )
 {
     OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
     PushIndent();
@@ -206,7 +208,7 @@ void TestHessenberg
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    MultiShiftHessSolve( uplo, orientation, F(1), H, shifts, X );
+    MultiShiftHessSolve( uplo, orientation, F(1), H, shifts, X, ctrl );
     mpi::Barrier( mpi::COMM_WORLD );
     const double runTime = timer.Stop();
     // TODO: Flop calculation
@@ -235,6 +237,13 @@ main( int argc, char* argv[] )
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
         const bool display = Input("--display","display matrices?",false);
+        const Int shiftBlocksize =
+          Input("--shiftBlocksize","number of shifts swept together",64);
+        const Int numThreads = Input("--numThreads","number of threads",1);
+        const bool replicateH =
+          Input("--replicateH","replicate H on each process?",true);
+        const bool mixedPrecision =
+          Input("--mixedPrecision","sweep in lower precision?",false);
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec = Input("--prec","MPFR precision",256);
 #endif
@@ -252,75 +261,81 @@ main( int argc, char* argv[] )
         SetBlocksize( nb );
         ComplainIfDebug();
 
+        MultiShiftHessCtrl ctrl;
+        ctrl.shiftBlocksize = shiftBlocksize;
+        ctrl.numThreads = numThreads;
+        ctrl.replicateH = replicateH;
+        ctrl.mixedPrecision = mixedPrecision;
+
         if( sequential && mpi::Rank() == 0 )
         {
             TestHessenberg<float>
-            ( uplo, orient, m, n, correctness, print, display );
+            ( uplo, orient, m, n, correctness, print, display, ctrl );
             TestHessenberg<Complex<float>>
-            ( uplo, orient, m, n, correctness, print, display );
+            ( uplo, orient, m, n, correctness, print, display, ctrl );
 
             TestHessenberg<double>
-            ( uplo, orient, m, n, correctness, print, display );
+            ( uplo, orient, m, n, correctness, print, display, ctrl );
             TestHessenberg<Complex<double>>
-            ( uplo, orient, m, n, correctness, print, display );
+            ( uplo, orient, m, n, correctness, print, display, ctrl );
 
 #ifdef EL_HAVE_QD
             TestHessenberg<DoubleDouble>
-            ( uplo, orient, m, n, correctness, print, display );
+            ( uplo, orient, m, n, correctness, print, display, ctrl );
             TestHessenberg<QuadDouble>
-            ( uplo, orient, m, n, correctness, print, display );
+            ( uplo, orient, m, n, correctness, print, display, ctrl );
 
             TestHessenberg<Complex<DoubleDouble>>
-            ( uplo, orient, m, n, correctness, print, display );
+            ( uplo, orient, m, n, correctness, print, display, ctrl );
             TestHessenberg<Complex<QuadDouble>>
-            ( uplo, orient, m, n, correctness, print, display );
+            ( uplo, orient, m, n, correctness, print, display, ctrl );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestHessenberg<Quad>
-            ( uplo, orient, m, n, correctness, print, display );
+            ( uplo, orient, m, n, correctness, print, display, ctrl );
             TestHessenberg<Complex<Quad>>
-            ( uplo, orient, m, n, correctness, print, display );
+            ( uplo, orient, m, n, correctness, print, display, ctrl );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestHessenberg<BigFloat>
-            ( uplo, orient, m, n, correctness, print, display );
+            ( uplo, orient, m, n, correctness, print, display, ctrl );
 #endif
         }
 
         TestHessenberg<float>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, correctness, print, display, ctrl );
         TestHessenberg<Complex<float>>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, correctness, print, display, ctrl );
 
         TestHessenberg<double>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, correctness, print, display, ctrl );
         TestHessenberg<Complex<double>>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, correctness, print, display, ctrl );
 
 #ifdef EL_HAVE_QD
         TestHessenberg<DoubleDouble>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, correctness, print, display, ctrl );
         TestHessenberg<QuadDouble>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, correctness, print, display, ctrl );
 
         TestHessenberg<Complex<DoubleDouble>>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, correctness, print, display, ctrl );
         TestHessenberg<Complex<QuadDouble>>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, correctness, print, display, ctrl );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestHessenberg<Quad>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, correctness, print, display, ctrl );
         TestHessenberg<Complex<Quad>>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, correctness, print, display, ctrl );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestHessenberg<BigFloat>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, correctness, print, display, ctrl );
 #endif
     }
     catch( std::exception& e ) { ReportException(e); }
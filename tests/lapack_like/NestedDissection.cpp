@@ -20,7 +20,7 @@ int main( int argc, char* argv[] )
     {
         const Int n = Input("--n","size of n x n x n grid",30);
         const bool sequential = Input
-            ("--sequential","sequential partitions?",true);
+            ("--sequential","sequential partitions?",false);
         const int numDistSeps = Input
             ("--numDistSeps",
              "number of separators to try per distributed partition",1);
@@ -0,0 +1,144 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form the coefficients of the continuous algebraic Riccati equation
+//
+//   X K X - A^H X - X A = L,
+//
+// with K = B B^H + I and L = C C^H + I, so that a unique stabilizing
+// solution exists for any A.
+template<typename F>
+void FormCoefficients
+( Int n, Int k, DistMatrix<F>& A, DistMatrix<F>& K, DistMatrix<F>& L )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<F> B(g), C(g);
+    Uniform( A, n, n );
+    Uniform( B, n, k );
+    Uniform( C, n, k );
+    Identity( K, n, n );
+    Identity( L, n, n );
+    Herk( LOWER, NORMAL, Base<F>(1), B, Base<F>(1), K );
+    Herk( LOWER, NORMAL, Base<F>(1), C, Base<F>(1), L );
+}
+
+template<typename F>
+Base<F> RelativeResidual
+( const DistMatrix<F>& A, const DistMatrix<F>& K, const DistMatrix<F>& L,
+  const DistMatrix<F>& X )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<F> KFull( K ), R( L ), KX(g);
+    MakeHermitian( LOWER, KFull );
+    MakeHermitian( LOWER, R );
+    const Base<F> normL = FrobeniusNorm( R );
+    Gemm( NORMAL, NORMAL, F(1), KFull, X, KX );
+    Gemm( NORMAL, NORMAL, F(1), X, KX, F(-1), R );
+    Gemm( ADJOINT, NORMAL, F(-1), A, X, F(1), R );
+    Gemm( NORMAL, NORMAL, F(-1), X, A, F(1), R );
+    return FrobeniusNorm( R ) / normL;
+}
+
+template<typename F>
+void TestNewtonRiccati( Int n, Int k, const Grid& g, bool progress )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+
+    DistMatrix<F> A(g), K(g), L(g), X(g);
+    FormCoefficients( n, k, A, K, L );
+
+    NewtonRiccatiCtrl<Real> ctrl;
+    ctrl.progress = progress;
+
+    // A cold start from the sign-based solver
+    ctrl.warmStart = false;
+    Timer timer;
+    timer.Start();
+    Int numSteps = NewtonRiccati( LOWER, A, K, L, X, ctrl );
+    OutputFromRoot
+    (g.Comm(),"Cold start: ",numSteps," Newton steps in ",timer.Stop(),
+     " seconds");
+    Real resid = RelativeResidual( A, K, L, X );
+    OutputFromRoot(g.Comm(),"Relative residual: ",resid);
+    if( resid > Pow(eps,Real(0.5)) )
+        LogicError("Relative residual was unacceptably high");
+
+    // Slowly varying coefficients, each warm-started from the last solution
+    ctrl.warmStart = true;
+    DistMatrix<F> E(g);
+    for( Int step=0; step<3; ++step )
+    {
+        Uniform( E, n, n );
+        Axpy( Real(1)/Real(1000), E, A );
+
+        timer.Start();
+        numSteps = NewtonRiccati( LOWER, A, K, L, X, ctrl );
+        OutputFromRoot
+        (g.Comm(),"Warm start: ",numSteps," Newton steps in ",timer.Stop(),
+         " seconds");
+        resid = RelativeResidual( A, K, L, X );
+        OutputFromRoot(g.Comm(),"Relative residual: ",resid);
+        if( resid > Pow(eps,Real(0.5)) )
+            LogicError("Relative residual was unacceptably high");
+        if( numSteps > 3 )
+            LogicError("Warm start took ",numSteps," Newton steps");
+    }
+
+    // The sequential solver on a redundant copy
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), K_STAR_STAR( K ),
+                            L_STAR_STAR( L ), X_STAR_STAR( X );
+    Uniform( E, n, n );
+    DistMatrix<F,STAR,STAR> E_STAR_STAR( E );
+    Axpy( Real(1)/Real(1000), E_STAR_STAR, A_STAR_STAR );
+    numSteps = NewtonRiccati
+    ( LOWER, A_STAR_STAR.LockedMatrix(), K_STAR_STAR.LockedMatrix(),
+      L_STAR_STAR.LockedMatrix(), X_STAR_STAR.Matrix(), ctrl );
+    A = A_STAR_STAR;
+    X = X_STAR_STAR;
+    resid = RelativeResidual( A, K, L, X );
+    OutputFromRoot
+    (g.Comm(),"Sequential warm start: ",numSteps,
+     " Newton steps, relative residual ",resid);
+    if( resid > Pow(eps,Real(0.5)) )
+        LogicError("Relative residual was unacceptably high");
+    if( numSteps > 3 )
+        LogicError("Sequential warm start took ",numSteps," Newton steps");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","matrix order",60);
+        const Int k = Input("--k","number of columns of B and C",4);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestNewtonRiccati<double>( n, k, g, progress );
+        TestNewtonRiccati<Complex<double>>( n, k, g, progress );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
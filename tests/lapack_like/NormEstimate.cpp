@@ -0,0 +1,132 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The estimators are randomized, so only require agreement to within a
+// modest factor of the exact (SVD or inverse-based) values
+template<typename Real>
+void CheckRatio
+( const string& name, const Real& estimate, const Real& exact,
+  const Real& minRatio, const Real& maxRatio, mpi::Comm comm )
+{
+    const Real ratio = estimate / exact;
+    OutputFromRoot(comm,name,": estimate=",estimate,", exact=",exact);
+    if( ratio < minRatio || ratio > maxRatio )
+        LogicError(name," estimate was inaccurate");
+}
+
+template<typename Field>
+void TestNormEstimate( Int n, Int k, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+    typedef Base<Field> Real;
+    mpi::Comm comm = g.Comm();
+    const Real loose = Real(1)/Real(10);
+    const Real upper = Real(1) + Pow(limits::Epsilon<Real>(),Real(0.5));
+
+    DistMatrix<Field> A(g), ATall(g), HPD(g);
+    Gaussian( A, n, n );
+    Gaussian( ATall, 2*n, n );
+    Identity( HPD, n, n );
+    HPD *= Real(n);
+    Herk( LOWER, NORMAL, Real(1), ATall( IR(0,n), ALL ), Real(1), HPD );
+
+    CheckRatio
+    ("One condition",ConditionEstimate(A,ONE_NORM),OneCondition(A),
+     loose,upper,comm);
+    CheckRatio
+    ("Infinity condition",ConditionEstimate(A,INFINITY_NORM),
+     InfinityCondition(A),loose,upper,comm);
+    CheckRatio
+    ("Two condition",ConditionEstimate(A,TWO_NORM),TwoCondition(A),
+     loose,upper,comm);
+    CheckRatio
+    ("Frobenius condition",ConditionEstimate(A,FROBENIUS_NORM),
+     FrobeniusCondition(A),loose,1/loose,comm);
+    CheckRatio
+    ("Rectangular two condition",ConditionEstimate(ATall,TWO_NORM),
+     TwoCondition(ATall),loose,upper,comm);
+
+    // Reuse a Cholesky factorization
+    DistMatrix<Field> L( HPD );
+    Cholesky( LOWER, L );
+    const Real normHPD = HermitianOneNorm( LOWER, HPD );
+    DistMatrix<Field> HPDFull( HPD );
+    MakeHermitian( LOWER, HPDFull );
+    CheckRatio
+    ("HPD one condition",
+     condest::AfterCholesky( LOWER, L, normHPD, ONE_NORM ),
+     OneCondition(HPDFull),loose,upper,comm);
+
+    NormEstimateCtrl<Real> ctrl;
+    Timer timer;
+    if( g.Rank() == 0 )
+        timer.Start();
+    const Real nuclearEst = NuclearNormEstimate( A, ctrl );
+    const double estTime = ( g.Rank() == 0 ? timer.Stop() : 0. );
+    if( g.Rank() == 0 )
+        timer.Start();
+    const Real nuclear = NuclearNorm( A );
+    const double exactTime = ( g.Rank() == 0 ? timer.Stop() : 0. );
+    OutputFromRoot
+    (comm,"Nuclear norm estimate took ",estTime," secs vs. ",exactTime);
+    CheckRatio("Nuclear norm",nuclearEst,nuclear,loose,1/loose,comm);
+    CheckRatio
+    ("Schatten 3-norm",SchattenNormEstimate(ATall,Real(3),ctrl),
+     SchattenNorm(ATall,Real(3)),loose,1/loose,comm);
+    CheckRatio
+    ("Ky-Fan norm",KyFanNormEstimate(ATall,k,ctrl),KyFanNorm(ATall,k),
+     loose,upper,comm);
+    CheckRatio
+    ("Ky-Fan-Schatten norm",KyFanSchattenNormEstimate(A,k,Real(2),ctrl),
+     KyFanSchattenNorm(A,k,Real(2)),loose,upper,comm);
+
+    // The sequential variants
+    DistMatrix<Field,STAR,STAR> A_STAR_STAR( A );
+    const auto& ALoc = A_STAR_STAR.Matrix();
+    CheckRatio
+    ("Sequential one condition",ConditionEstimate(ALoc,ONE_NORM),
+     OneCondition(ALoc),loose,upper,comm);
+    CheckRatio
+    ("Sequential two condition",ConditionEstimate(ALoc,TWO_NORM),
+     TwoCondition(ALoc),loose,upper,comm);
+    CheckRatio
+    ("Sequential nuclear norm",NuclearNormEstimate(ALoc,ctrl),
+     NuclearNorm(ALoc),loose,1/loose,comm);
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","matrix order",200);
+        const Int k = Input("--k","number of Ky-Fan singular values",5);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestNormEstimate<float>( n, k, g );
+        TestNormEstimate<Complex<float>>( n, k, g );
+        TestNormEstimate<double>( n, k, g );
+        TestNormEstimate<Complex<double>>( n, k, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The matrices are written to disk, factored within the file, and then read
+// back in so that the factors can be checked against the originals
+
+template<typename Field>
+void TestCholesky
+( const Grid& grid,
+  Int n,
+  const OutOfCoreCtrl& ctrl,
+  const string& basename,
+  bool print )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(grid.Comm(),"Testing Cholesky with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> A(grid), L(grid);
+    HermitianUniformSpectrum( A, n, 1, 10 );
+    Write( A, basename, BINARY );
+    mpi::Barrier( grid.Comm() );
+    const string filename = basename + "." + FileExtension(BINARY);
+
+    Timer timer;
+    timer.Start();
+    OutOfCoreCholesky<Field>( grid, filename, ctrl );
+    OutputFromRoot(grid.Comm(),timer.Stop()," seconds");
+
+    Read( L, filename, BINARY );
+    MakeTrapezoidal( LOWER, L );
+    if( print )
+        Print( L, "L" );
+    const Real frobA = FrobeniusNorm( A );
+    Herk( LOWER, NORMAL, Real(-1), L, Real(1), A );
+    MakeTrapezoidal( LOWER, A );
+    const Real relError =
+      FrobeniusNorm( A ) / (frobA*n*limits::Epsilon<Real>());
+    OutputFromRoot
+    (grid.Comm(),"||A - L L^H||_F / (eps n ||A||_F) = ",relError);
+
+    // TODO: A more refined failure condition
+    if( relError > Real(10) )
+        LogicError("Relative error was unacceptably high");
+    PopIndent();
+}
+
+template<typename Field>
+void TestLU
+( const Grid& grid,
+  Int m,
+  Int n,
+  const OutOfCoreCtrl& ctrl,
+  const string& basename,
+  bool print )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(grid.Comm(),"Testing LU with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> A(grid), F(grid);
+    Uniform( A, m, n );
+    Write( A, basename, BINARY );
+    mpi::Barrier( grid.Comm() );
+    const string filename = basename + "." + FileExtension(BINARY);
+
+    DistPermutation P(grid);
+    Timer timer;
+    timer.Start();
+    OutOfCoreLU<Field>( grid, filename, P, ctrl );
+    OutputFromRoot(grid.Comm(),timer.Stop()," seconds");
+
+    Read( F, filename, BINARY );
+    if( print )
+        Print( F, "F" );
+    const Int minDim = Min(m,n);
+    DistMatrix<Field> L(grid), U(grid);
+    L = F( ALL, IR(0,minDim) );
+    U = F( IR(0,minDim), ALL );
+    MakeTrapezoidal( LOWER, L );
+    FillDiagonal( L, Field(1) );
+    MakeTrapezoidal( UPPER, U );
+
+    const Real frobA = FrobeniusNorm( A );
+    P.PermuteRows( A );
+    Gemm( NORMAL, NORMAL, Field(-1), L, U, Field(1), A );
+    const Real relError =
+      FrobeniusNorm( A ) / (frobA*Max(m,n)*limits::Epsilon<Real>());
+    OutputFromRoot
+    (grid.Comm(),"||P A - L U||_F / (eps max(m,n) ||A||_F) = ",relError);
+
+    // TODO: A more refined failure condition
+    if( relError > Real(100) )
+        LogicError("Relative error was unacceptably high");
+    PopIndent();
+}
+
+template<typename Field>
+void TestFactorizations
+( const Grid& grid,
+  Int m,
+  Int n,
+  const OutOfCoreCtrl& ctrl,
+  const string& basename,
+  bool print )
+{
+    TestCholesky<Field>( grid, n, ctrl, basename, print );
+    TestLU<Field>( grid, m, n, ctrl, basename, print );
+    TestLU<Field>( grid, n, m, ctrl, basename, print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","process grid height",0);
+        const Int m = Input("--height","height of matrix",300);
+        const Int n = Input("--width","width of matrix",200);
+        const Int panelWidth =
+          Input("--panelWidth","out-of-core panel width",64);
+        const bool asyncRead = Input("--async","read asynchronously?",true);
+        const string basename =
+          Input("--basename","basename of the scratch file",string("ooc"));
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid grid( comm, gridHeight );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        OutOfCoreCtrl ctrl;
+        ctrl.panelWidth = panelWidth;
+        ctrl.asyncRead = asyncRead;
+        TestFactorizations<float>( grid, m, n, ctrl, basename, print );
+        TestFactorizations<Complex<float>>( grid, m, n, ctrl, basename, print );
+        TestFactorizations<double>( grid, m, n, ctrl, basename, print );
+        TestFactorizations<Complex<double>>
+        ( grid, m, n, ctrl, basename, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
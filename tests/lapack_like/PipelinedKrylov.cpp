@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solve against a 2D Helmholtz operator, which is HPD for a zero shift and
+// indefinite for a shift between its eigenvalues, with pipelined CG (in the
+// former case) or pipelined MINRES (in either case), using both sequential
+// and distributed vectors, and check the true residuals
+template<typename Field>
+void TestPipelinedKrylov
+( bool useCG, Int nx, Int ny, Base<Field> shift, const Grid& g )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing ",(useCG ? "CG" : "MINRES")," with shift ",shift,
+     " and ",TypeName<Field>());
+    PushIndent();
+    typedef Base<Field> Real;
+    const Real relTol = Pow( limits::Epsilon<Real>(), Real(0.5) );
+    const Int maxIts = 10*nx*ny;
+    const Int n = nx*ny;
+    const Int numRHS = 2;
+
+    // Use the (HPD) inverse of the diagonal of the Laplacian as the
+    // preconditioner
+    const Real hxInv = nx+1;
+    const Real hyInv = ny+1;
+    const Real diagInv = 1/(2*(hxInv*hxInv+hyInv*hyInv));
+
+    SparseMatrix<Field> A;
+    Helmholtz( A, nx, ny, Field(shift) );
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& x,
+           Field beta, Matrix<Field>& y )
+      { Multiply( NORMAL, alpha, A, x, beta, y ); };
+    auto precond = [&]( Matrix<Field>& w ) { w *= diagInv; };
+
+    Matrix<Field> B, X;
+    Uniform( B, n, numRHS );
+    X = B;
+    const Int its =
+      useCG ? CG( applyA, precond, X, relTol, maxIts, false )
+            : MINRES( applyA, precond, X, relTol, maxIts, false );
+    Matrix<Field> R( B );
+    Multiply( NORMAL, Field(-1), A, X, Field(1), R );
+    const Real relResid = FrobeniusNorm( R ) / FrobeniusNorm( B );
+    OutputFromRoot
+    (g.Comm(),"Sequential: ",its," iterations, relative residual ",relResid);
+    if( relResid > 10*relTol )
+        LogicError("Sequential residual was too large");
+
+    DistSparseMatrix<Field> ADist(g);
+    Helmholtz( ADist, nx, ny, Field(shift) );
+    auto applyADist =
+      [&]( Field alpha, const DistMultiVec<Field>& x,
+           Field beta, DistMultiVec<Field>& y )
+      { Multiply( NORMAL, alpha, ADist, x, beta, y ); };
+    auto precondDist =
+      [&]( DistMultiVec<Field>& w ) { w.Matrix() *= diagInv; };
+
+    DistMultiVec<Field> BDist(g), XDist(g);
+    Uniform( BDist, n, numRHS );
+    XDist = BDist;
+    const Int itsDist =
+      useCG ? CG( applyADist, precondDist, XDist, relTol, maxIts, false )
+            : MINRES( applyADist, precondDist, XDist, relTol, maxIts, false );
+    DistMultiVec<Field> RDist( BDist );
+    Multiply( NORMAL, Field(-1), ADist, XDist, Field(1), RDist );
+    const Real relResidDist = FrobeniusNorm( RDist ) / FrobeniusNorm( BDist );
+    OutputFromRoot
+    (g.Comm(),"Distributed: ",itsDist," iterations, relative residual ",
+     relResidDist);
+    if( relResidDist > 10*relTol )
+        LogicError("Distributed residual was too large");
+
+    PopIndent();
+}
+
+template<typename Field>
+void TestAll( Int nx, Int ny, Base<Field> shift, const Grid& g )
+{
+    TestPipelinedKrylov<Field>( true, nx, ny, Base<Field>(0), g );
+    TestPipelinedKrylov<Field>( false, nx, ny, Base<Field>(0), g );
+    TestPipelinedKrylov<Field>( false, nx, ny, shift, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int nx = Input("--nx","size of grid in x dimension",20);
+        const Int ny = Input("--ny","size of grid in y dimension",20);
+        const double shift =
+          Input("--shift","shift of the indefinite operator",60.);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestAll<float>( nx, ny, shift, g );
+        TestAll<Complex<float>>( nx, ny, shift, g );
+        TestAll<double>( nx, ny, shift, g );
+        TestAll<Complex<double>>( nx, ny, shift, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -169,6 +169,7 @@ void TestQR
 ( const Grid& grid,
   Int m,
   Int n,
+  bool communicationAvoiding,
   bool correctness,
   bool print )
 {
@@ -189,7 +190,10 @@ void TestQR
     OutputFromRoot(grid.Comm(),"Starting QR factorization...");
     mpi::Barrier( grid.Comm() );
     const double startTime = mpi::Time();
-    QR( A, householderScalars, signature );
+    if( communicationAvoiding )
+        qr::CA( A, householderScalars, signature );
+    else
+        QR( A, householderScalars, signature );
     mpi::Barrier( grid.Comm() );
     const double runTime = mpi::Time() - startTime;
     const double realGFlops = (2.*mD*nD*nD - 2./3.*nD*nD*nD)/(1.e9*runTime);
@@ -221,6 +225,8 @@ main( int argc, char* argv[] )
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",64);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const bool communicationAvoiding =
+          Input("--ca","use TSQR panels (CAQR)?",false);
         const bool correctness =
           Input("--correctness","test correctness?",true);
 #ifdef EL_HAVE_MPC
@@ -281,39 +287,39 @@ main( int argc, char* argv[] )
         }
 
         TestQR<float>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
         TestQR<Complex<float>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
 
         TestQR<double>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
         TestQR<Complex<double>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
 
 #ifdef EL_HAVE_QD
         TestQR<DoubleDouble>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
         TestQR<QuadDouble>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
 
         TestQR<Complex<DoubleDouble>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
         TestQR<Complex<QuadDouble>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestQR<Quad>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
         TestQR<Complex<Quad>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestQR<BigFloat>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
         TestQR<Complex<BigFloat>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -0,0 +1,149 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void CheckLower
+( const DistMatrix<Field>& ARFP,
+  const DistMatrix<Field>& A,
+  const string& label )
+{
+    typedef Base<Field> Real;
+    DistMatrix<Field> E(A.Grid());
+    rfp::Unpack( ARFP, E );
+    DistMatrix<Field> ALower( A );
+    MakeTrapezoidal( LOWER, ALower );
+    E -= ALower;
+    const Real error = MaxNorm( E );
+    const Real tol =
+      100*A.Height()*limits::Epsilon<Real>()*Max(MaxNorm(A),Real(1));
+    OutputFromRoot(A.Grid().Comm(),"  ",label," error: ",error);
+    if( error > tol )
+        LogicError(label," error of ",error," exceeded ",tol);
+}
+
+template<typename Field>
+void TestRFP( Int n, Int numRHS, const Grid& g, bool print )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> A(g), ARFP(g);
+    HermitianUniformSpectrum( A, n, Real(1), Real(10) );
+    rfp::Pack( LOWER, A, ARFP );
+    if( ARFP.Height() != rfp::Height(n) || ARFP.Width() != rfp::Width(n) )
+        LogicError("Packed array had the wrong dimensions");
+    CheckLower( ARFP, A, "Pack/unpack" );
+    DistMatrix<Field> AUpperRFP(g);
+    rfp::Pack( UPPER, A, AUpperRFP );
+    CheckLower( AUpperRFP, A, "Upper pack/unpack" );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( ARFP, "ARFP" );
+    }
+
+    // Packed Herk versus full Herk
+    DistMatrix<Field> C(g), CRFP(g), G(g);
+    Uniform( G, n, numRHS );
+    C = A;
+    CRFP = ARFP;
+    Herk( LOWER, NORMAL, Real(2), G, Real(-1), C );
+    rfp::Herk( NORMAL, Real(2), G, Real(-1), CRFP );
+    CheckLower( CRFP, C, "Herk" );
+    Uniform( G, numRHS, n );
+    C = A;
+    CRFP = ARFP;
+    Herk( LOWER, ADJOINT, Real(2), G, Real(-1), C );
+    rfp::Herk( ADJOINT, Real(2), G, Real(-1), CRFP );
+    CheckLower( CRFP, C, "Adjoint Herk" );
+
+    // Packed Cholesky versus full Cholesky
+    DistMatrix<Field> L( A );
+    Cholesky( LOWER, L );
+    DistMatrix<Field> LRFP( ARFP );
+    rfp::Cholesky( LRFP );
+    CheckLower( LRFP, L, "Cholesky" );
+
+    // Packed Trsm versus full Trsm
+    DistMatrix<Field> B(g), X(g), Y(g);
+    Uniform( B, n, numRHS );
+    const Field alpha = Field(3);
+    for( auto orientation : {NORMAL,ADJOINT} )
+    {
+        X = B;
+        Y = B;
+        Trsm( LEFT, LOWER, orientation, NON_UNIT, alpha, L, X );
+        rfp::Trsm( orientation, alpha, LRFP, Y );
+        Y -= X;
+        const Real error = MaxNorm( Y );
+        const Real tol = 100*n*limits::Epsilon<Real>()*MaxNorm(X);
+        OutputFromRoot
+        (g.Comm(),"  ",orientation==NORMAL ? "Trsm" : "Adjoint Trsm",
+         " error: ",error);
+        if( error > tol )
+            LogicError("Trsm error of ",error," exceeded ",tol);
+    }
+
+    // HPD solve
+    X = B;
+    rfp::HPDSolve( ARFP, X );
+    DistMatrix<Field> R( B );
+    Hemm( LEFT, LOWER, Field(-1), A, X, Field(1), R );
+    const Real relResid = FrobeniusNorm(R) / FrobeniusNorm(B);
+    OutputFromRoot(g.Comm(),"  || B - A X ||_F / || B ||_F = ",relResid);
+    if( relResid > 100*n*limits::Epsilon<Real>() )
+        LogicError("Relative residual of ",relResid," was unacceptably large");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int n = Input("--n","matrix order",101);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",10);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        const Grid g( comm );
+        for( Int order : {n,n+1} )
+        {
+            OutputFromRoot(comm,"n=",order);
+            TestRFP<float>( order, numRHS, g, print );
+            TestRFP<Complex<float>>( order, numRHS, g, print );
+            TestRFP<double>( order, numRHS, g, print );
+            TestRFP<Complex<double>>( order, numRHS, g, print );
+#ifdef EL_HAVE_QD
+            TestRFP<DoubleDouble>( order, numRHS, g, print );
+            TestRFP<QuadDouble>( order, numRHS, g, print );
+#endif
+#ifdef EL_HAVE_QUAD
+            TestRFP<Quad>( order, numRHS, g, print );
+            TestRFP<Complex<Quad>>( order, numRHS, g, print );
+#endif
+#ifdef EL_HAVE_MPC
+            TestRFP<BigFloat>( order, numRHS, g, print );
+#endif
+        }
+        OutputFromRoot(comm,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A,
+  const DistMatrix<F>& U,
+  const DistMatrix<Base<F>,VR,STAR>& s,
+  const DistMatrix<F>& V,
+  bool print )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int rank = s.Height();
+    const Int maxDim = Max(m,n);
+    const Real eps = limits::Epsilon<Real>();
+
+    // Form I - U^H U
+    OutputFromRoot(g.Comm(),"Testing orthogonality of U...");
+    PushIndent();
+    DistMatrix<F> Z(g);
+    Identity( Z, rank, rank );
+    Herk( UPPER, ADJOINT, Real(-1), U, Real(1), Z );
+    const Real relOrthogUError =
+      HermitianMaxNorm( UPPER, Z ) / (eps*maxDim);
+    OutputFromRoot
+    (g.Comm(),"||U' U - I||_max / (eps Max(m,n)) = ",relOrthogUError);
+    PopIndent();
+
+    // Form I - V^H V
+    OutputFromRoot(g.Comm(),"Testing orthogonality of V...");
+    PushIndent();
+    Identity( Z, rank, rank );
+    Herk( UPPER, ADJOINT, Real(-1), V, Real(1), Z );
+    const Real relOrthogVError =
+      HermitianMaxNorm( UPPER, Z ) / (eps*maxDim);
+    OutputFromRoot
+    (g.Comm(),"||V' V - I||_max / (eps Max(m,n)) = ",relOrthogVError);
+    PopIndent();
+
+    // Since A has the given rank, A - U S V^H should be at roundoff level
+    OutputFromRoot(g.Comm(),"Testing if A = U S V'...");
+    PushIndent();
+    DistMatrix<F> E( A ), VScaled( V );
+    DiagonalScale( RIGHT, NORMAL, s, VScaled );
+    Gemm( NORMAL, ADJOINT, F(-1), U, VScaled, F(1), E );
+    if( print )
+        Print( E, "A - U S V'" );
+    const Real relError =
+      FrobeniusNorm( E ) / (eps*maxDim*FrobeniusNorm( A ));
+    OutputFromRoot
+    (g.Comm(),"||A - U S V'||_F / (eps Max(m,n) ||A||_F) = ",relError);
+    PopIndent();
+
+    if( relOrthogUError > Real(100) )
+        LogicError("Relative orthogonality error for U was too large");
+    if( relOrthogVError > Real(100) )
+        LogicError("Relative orthogonality error for V was too large");
+    if( relError > Real(100) )
+        LogicError("Relative low-rank approximation error was too large");
+}
+
+// Check that the implicit application of each kind of sketch, both
+// sequentially and in parallel, matches the product with the explicitly
+// formed sketch
+template<typename F>
+void TestSketchOperator( const Grid& g, Int m, Int n, Int k, Int sparsity )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing sketches with ",TypeName<F>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+    const RandomizedSketchType types[] =
+      { GAUSSIAN_SKETCH, SRHT_SKETCH, RADEMACHER_SKETCH, SPARSE_SIGN_SKETCH };
+    for( const auto type : types )
+    {
+        DistMatrix<F> A(g);
+        Gaussian( A, m, n );
+        DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+
+        SketchOperator<F> Omega( type, n, k, sparsity );
+        Matrix<F> OmegaFull, Y, YSeq;
+        Omega.Form( OmegaFull );
+        Gemm( NORMAL, NORMAL, F(1), A_STAR_STAR.Matrix(), OmegaFull, Y );
+        Omega.Apply( A_STAR_STAR.Matrix(), YSeq );
+
+        DistMatrix<F> YDist(g);
+        Omega.Apply( A, YDist );
+        DistMatrix<F,STAR,STAR> YDist_STAR_STAR( YDist );
+
+        const Real YNorm = FrobeniusNorm( Y );
+        YSeq -= Y;
+        YDist_STAR_STAR.Matrix() -= Y;
+        const Real seqError = FrobeniusNorm( YSeq ) / (eps*n*YNorm);
+        const Real distError =
+          FrobeniusNorm( YDist_STAR_STAR.Matrix() ) / (eps*n*YNorm);
+        OutputFromRoot
+        (g.Comm(),"sketch ",int(type),": sequential error ",seqError,
+         ", distributed error ",distError);
+        if( seqError > Real(10) || distError > Real(10) )
+            LogicError("Implicit sketch did not match the explicit sketch");
+    }
+    PopIndent();
+}
+
+template<typename F>
+void TestRandomizedSVD
+( const Grid& g,
+  Int m,
+  Int n,
+  Int rank,
+  const RandomizedSVDCtrl<double>& ctrlDbl,
+  bool correctness,
+  bool print )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    RandomizedSVDCtrl<Real> ctrl;
+    ctrl.oversampling = ctrlDbl.oversampling;
+    ctrl.numPowerIts = ctrlDbl.numPowerIts;
+    ctrl.sketch = ctrlDbl.sketch;
+    ctrl.sketchSparsity = ctrlDbl.sketchSparsity;
+
+    // Form a matrix of exactly the given rank
+    DistMatrix<F> X(g), Y(g), A(g);
+    Gaussian( X, m, rank );
+    Gaussian( Y, n, rank );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, A );
+    if( print )
+        Print( A, "A" );
+
+    DistMatrix<F> U(g), V(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    Timer timer;
+    OutputFromRoot(g.Comm(),"Starting randomized SVD...");
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    RandomizedSVD( A, rank, U, s, V, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),"Time = ",timer.Stop()," seconds");
+    if( print )
+    {
+        Print( U, "U" );
+        Print( s, "s" );
+        Print( V, "V" );
+    }
+    if( correctness )
+        TestCorrectness( A, U, s, V, print );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",500);
+        const Int n = Input("--n","width of matrix",300);
+        const Int rank = Input("--rank","rank of matrix",20);
+        const Int oversampling =
+          Input("--oversampling","number of extra sketch columns",10);
+        const Int numPowerIts =
+          Input("--numPowerIts","number of power iterations",1);
+        const Int sketch =
+          Input
+          ("--sketch","0: Gaussian, 1: SRHT, 2: Rademacher, 3: sparse sign",
+           0);
+        const Int sparsity =
+          Input("--sparsity","nonzeros per row of a sparse sign sketch",8);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool correctness =
+          Input("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        RandomizedSVDCtrl<double> ctrl;
+        ctrl.oversampling = oversampling;
+        ctrl.numPowerIts = numPowerIts;
+        ctrl.sketch = static_cast<RandomizedSketchType>(sketch);
+        ctrl.sketchSparsity = sparsity;
+
+        const Int numSamples = Min( rank+oversampling, Min(m,n) );
+        TestSketchOperator<float>( g, m, n, numSamples, sparsity );
+        TestSketchOperator<Complex<double>>( g, m, n, numSamples, sparsity );
+
+        TestRandomizedSVD<float>
+        ( g, m, n, rank, ctrl, correctness, print );
+        TestRandomizedSVD<Complex<float>>
+        ( g, m, n, rank, ctrl, correctness, print );
+        TestRandomizedSVD<double>
+        ( g, m, n, rank, ctrl, correctness, print );
+        TestRandomizedSVD<Complex<double>>
+        ( g, m, n, rank, ctrl, correctness, print );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void CheckSmall
+( const Grid& g, const DistMatrix<Field>& E, Base<Field> scale,
+  const string& msg )
+{
+    typedef Base<Field> Real;
+    const Real error = FrobeniusNorm( E );
+    const Real tol = Real(1e-8)*Max(scale,Real(1));
+    OutputFromRoot(g.Comm(),"  ",msg,": ",error);
+    if( error > tol )
+        LogicError(msg," was ",error," > ",tol);
+}
+
+template<typename Field>
+void TestApproach
+( const Grid& g, RankRevealApproach approach, const DistMatrix<Field>& A,
+  Int rank )
+{
+    typedef Base<Field> Real;
+    const Int n = A.Width();
+    const Real frobA = FrobeniusNorm( A );
+    OutputFromRoot(g.Comm(),"Approach ",Int(approach));
+
+    RankRevealCtrl<Real> ctrl;
+    ctrl.approach = approach;
+    ctrl.tol = Real(1e-10);
+    ctrl.rankGuess = 2;
+
+    // A ~= U T W^H
+    DistMatrix<Field> U(g), T(g), W(g), E(g), Z(g);
+    const Int numericalRank = RankReveal( A, U, T, W, ctrl );
+    if( numericalRank != rank )
+        LogicError("Found a rank of ",numericalRank," rather than ",rank);
+    E = A;
+    Gemm( NORMAL, NORMAL, Field(1), U, T, Z );
+    Gemm( NORMAL, ADJOINT, Field(-1), Z, W, Field(1), E );
+    CheckSmall( g, E, frobA, "|| A - U T W^H ||_F" );
+    Identity( E, rank, rank );
+    Herk( LOWER, ADJOINT, Real(-1), W, Real(1), E );
+    MakeHermitian( LOWER, E );
+    CheckSmall( g, E, Real(1), "|| I - W^H W ||_F" );
+
+    // A K = 0 with K^H K = I
+    DistMatrix<Field> M(g), K(g);
+    ImageAndKernel( A, M, K, ctrl );
+    if( M.Width() != rank || K.Width() != n-rank )
+        LogicError("The image and kernel had the wrong dimensions");
+    Gemm( NORMAL, NORMAL, Field(1), A, K, E );
+    CheckSmall( g, E, frobA, "|| A K ||_F" );
+    Identity( E, n-rank, n-rank );
+    Herk( LOWER, ADJOINT, Real(-1), K, Real(1), E );
+    MakeHermitian( LOWER, E );
+    CheckSmall( g, E, Real(1), "|| I - K^H K ||_F" );
+
+    // A pinv(A) A = A
+    DistMatrix<Field> pinvA( A );
+    Pseudoinverse( pinvA, ctrl );
+    Gemm( NORMAL, NORMAL, Field(1), A, pinvA, Z );
+    E = A;
+    Gemm( NORMAL, NORMAL, Field(-1), Z, A, Field(1), E );
+    CheckSmall( g, E, frobA, "|| A - A pinv(A) A ||_F" );
+}
+
+template<typename Field>
+void TestRankReveal( const Grid& g, Int m, Int n, Int rank )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    DistMatrix<Field> X(g), Y(g), A(g);
+    Gaussian( X, m, rank );
+    Gaussian( Y, n, rank );
+    Gemm( NORMAL, ADJOINT, Field(1), X, Y, A );
+
+    TestApproach( g, RANK_REVEAL_SVD, A, rank );
+    TestApproach( g, RANK_REVEAL_RANDOMIZED_SVD, A, rank );
+    TestApproach( g, RANK_REVEAL_RANDOMIZED_URV, A, rank );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",80);
+        const Int rank = Input("--rank","rank of matrix",7);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        const Grid g( mpi::COMM_WORLD );
+        TestRankReveal<double>( g, m, n, rank );
+        TestRankReveal<Complex<double>>( g, m, n, rank );
+        OutputFromRoot(mpi::COMM_WORLD,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A vector which every process can reconstruct from its id
+template<typename F>
+void MakeColumn( Int id, Int n, Matrix<F>& a )
+{
+    a.Resize( n, 1 );
+    for( Int i=0; i<n; ++i )
+        a(i) = F(Base<F>(id+1)/(i+1)) + F(Base<F>(i)/(id+2));
+}
+
+// Each process owns one reflector, which annihilates all but the first entry
+// of the column defined by its id, and sends it to the next process, so that
+// every process applies both local and remote reflectors. Its adjoint, which
+// is kept local, is applied from the right to the adjoint of the column.
+template<typename F>
+void TestBatch( mpi::Comm comm, Int n, Int numBlocks )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(comm,"Testing with ",TypeName<F>());
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const int prevRank = Mod( commRank-1, commSize );
+    const int nextRank = Mod( commRank+1, commSize );
+
+    Matrix<F> a, v;
+    MakeColumn( commRank, n, a );
+    F chi = a(0);
+    v = a( IR(1,n), ALL );
+    const F tau = LeftReflector( chi, v );
+
+    ReflectorBatch<F> batch( comm );
+    batch.AddReflector( commRank, tau, v, vector<int>(1,nextRank) );
+    batch.AddReflector( commSize+commRank, Conj(tau), v );
+
+    vector<Matrix<F>> blocks( numBlocks+2 );
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        MakeColumn( commRank, n, blocks[b] );
+        batch.QueueApply( LEFT, commRank, blocks[b] );
+    }
+    MakeColumn( prevRank, n, blocks[numBlocks] );
+    batch.QueueApply( LEFT, prevRank, blocks[numBlocks] );
+    Adjoint( a, blocks[numBlocks+1] );
+    batch.QueueApply( RIGHT, commSize+commRank, blocks[numBlocks+1] );
+    if( batch.NumQueued() != numBlocks+2 )
+        LogicError("The applications were not queued");
+    batch.Execute();
+    if( batch.NumQueued() != 0 )
+        LogicError("The batch was not emptied");
+
+    for( Int b=0; b<numBlocks+1; ++b )
+    {
+        Matrix<F> col;
+        MakeColumn( b<numBlocks ? commRank : prevRank, n, col );
+        const Real norm = FrobeniusNorm( col );
+        const Real tol = 10*n*limits::Epsilon<Real>()*norm;
+        if( Abs(Abs(blocks[b](0))-norm) > tol )
+            LogicError("The reflector did not preserve the norm");
+        auto x = blocks[b]( IR(1,n), ALL );
+        if( FrobeniusNorm( x ) > tol )
+            LogicError("The reflector did not annihilate the column");
+    }
+    // a' H' = (H a)' = [beta; 0]'
+    auto yRight = blocks[numBlocks+1]( ALL, IR(1,n) );
+    const Real tol = 10*n*limits::Epsilon<Real>()*FrobeniusNorm( a );
+    if( FrobeniusNorm( yRight ) > tol )
+        LogicError("The adjoint reflector did not annihilate the row");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","length of each reflector",20);
+        const Int numBlocks = Input("--numBlocks","local blocks",5);
+        ProcessInput();
+        PrintInputReport();
+
+        TestBatch<float>( mpi::COMM_WORLD, n, numBlocks );
+        TestBatch<double>( mpi::COMM_WORLD, n, numBlocks );
+        TestBatch<Complex<double>>( mpi::COMM_WORLD, n, numBlocks );
+        OutputFromRoot(mpi::COMM_WORLD,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+Base<Field> RelativeDifference
+( const Matrix<Field>& X, const Matrix<Field>& XRef )
+{
+    Matrix<Field> E( X );
+    E -= XRef;
+    return FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+}
+
+template<typename Field>
+void TestRegularizationPath( Int m, Int n, Int k, Int numGammas, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+    typedef Base<Field> Real;
+    const Real tol = Real(100)*(m+n)*limits::Epsilon<Real>();
+
+    Matrix<Field> A, B, G;
+    Gaussian( A, m, n );
+    Gaussian( B, m, k );
+    // A well-conditioned, upper-bidiagonal regularization matrix
+    Identity( G, n, n );
+    for( Int i=0; i<n-1; ++i )
+        G(i,i+1) = Field(-1)/Field(2);
+
+    Matrix<Real> gammas;
+    Zeros( gammas, numGammas, 1 );
+    for( Int j=0; j<numGammas; ++j )
+        gammas(j) = Pow( Real(10), Real(-3)+Real(4*j)/Max(numGammas-1,Int(1)) );
+
+    DistMatrix<Field> ADist(g), BDist(g), GDist(g);
+    {
+        DistMatrix<Field,STAR,STAR> A_STAR_STAR(g), B_STAR_STAR(g),
+          G_STAR_STAR(g);
+        A_STAR_STAR.Resize( m, n );
+        A_STAR_STAR.Matrix() = A;
+        B_STAR_STAR.Resize( m, k );
+        B_STAR_STAR.Matrix() = B;
+        G_STAR_STAR.Resize( n, n );
+        G_STAR_STAR.Matrix() = G;
+        ADist = A_STAR_STAR;
+        BDist = B_STAR_STAR;
+        GDist = G_STAR_STAR;
+    }
+
+    Timer timer;
+    Matrix<Field> X, XTik;
+    if( g.Rank() == 0 )
+        timer.Start();
+    auto info = RidgePath( NORMAL, A, B, gammas, X );
+    const double pathTime = ( g.Rank() == 0 ? timer.Stop() : 0. );
+    auto tikInfo = TikhonovPath( NORMAL, A, B, G, gammas, XTik );
+
+    DistMatrix<Field> XDist(g), XTikDist(g);
+    RidgePath( NORMAL, ADist, BDist, gammas, XDist );
+    TikhonovPath( NORMAL, ADist, BDist, GDist, gammas, XTikDist );
+    DistMatrix<Field,STAR,STAR> X_STAR_STAR( XDist ),
+      XTik_STAR_STAR( XTikDist );
+
+    for( Int j=0; j<numGammas; ++j )
+    {
+        const Range<Int> ind( j*k, (j+1)*k );
+
+        Matrix<Field> XRef;
+        Ridge( NORMAL, A, B, gammas(j), XRef, RIDGE_SVD );
+        const Real diff = RelativeDifference( X(ALL,ind), XRef );
+        const Real diffDist =
+          RelativeDifference( X_STAR_STAR.Matrix()(ALL,ind), XRef );
+
+        Matrix<Field> E( B );
+        Gemm( NORMAL, NORMAL, Field(-1), A, XRef, Field(1), E );
+        const Real residNorm = FrobeniusNorm( E );
+        const Real residDiff =
+          Abs(info.residualNorms(j)-residNorm) / residNorm;
+        const Real solNormDiff =
+          Abs(info.solutionNorms(j)-FrobeniusNorm(XRef)) / FrobeniusNorm(XRef);
+
+        Matrix<Field> GScaled( G ), XTikRef;
+        GScaled *= gammas(j);
+        Tikhonov( NORMAL, A, B, GScaled, XTikRef, TIKHONOV_QR );
+        const Real tikDiff = RelativeDifference( XTik(ALL,ind), XTikRef );
+        const Real tikDiffDist =
+          RelativeDifference( XTik_STAR_STAR.Matrix()(ALL,ind), XTikRef );
+
+        OutputFromRoot
+        (g.Comm(),"gamma=",gammas(j),": Ridge differences ",diff,", ",
+         diffDist,", criteria differences ",residDiff,", ",solNormDiff,
+         ", Tikhonov differences ",tikDiff,", ",tikDiffDist,", GCV=",
+         info.gcv(j),", curvature=",info.lCurveCurvatures(j));
+        if( diff > tol || diffDist > tol || residDiff > tol ||
+            solNormDiff > tol )
+            LogicError("Ridge path was inaccurate");
+        if( tikDiff > tol || tikDiffDist > tol )
+            LogicError("Tikhonov path was inaccurate");
+    }
+    OutputFromRoot
+    (g.Comm(),"Path of ",numGammas," parameters took ",pathTime," secs; ",
+     "GCV chose gamma=",gammas(info.gcvIndex),", the L-curve chose gamma=",
+     gammas(info.lCurveIndex),", Tikhonov GCV chose gamma=",
+     gammas(tikInfo.gcvIndex));
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of A",200);
+        const Int n = Input("--n","width of A",100);
+        const Int k = Input("--k","number of right-hand sides",2);
+        const Int numGammas =
+          Input("--numGammas","number of regularization parameters",9);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestRegularizationPath<float>( m, n, k, numGammas, g );
+        TestRegularizationPath<Complex<float>>( m, n, k, numGammas, g );
+        TestRegularizationPath<double>( m, n, k, numGammas, g );
+        TestRegularizationPath<Complex<double>>( m, n, k, numGammas, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
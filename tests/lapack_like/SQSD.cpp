@@ -0,0 +1,174 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form the Hermitian quasi-semidefinite matrix
+//
+//   J = | F,    A |,
+//       | A^H, -G |
+//
+// where F and G are rank-deficient HPSD matrices, so that the regularized
+// factorization must perturb some of the pivots.
+template<typename Field>
+void FormJ( Int n0, Int n1, Matrix<Field>& J )
+{
+    const Int n = n0 + n1;
+    Zeros( J, n, n );
+    const Range<Int> ind0(0,n0), ind1(n0,n);
+
+    Matrix<Field> X, Y;
+    Uniform( X, n0, n0/2 );
+    Uniform( Y, n1, n1/2 );
+    auto J00 = J( ind0, ind0 );
+    auto J10 = J( ind1, ind0 );
+    auto J11 = J( ind1, ind1 );
+    Herk( LOWER, NORMAL, Base<Field>(1), X, Base<Field>(0), J00 );
+    Uniform( J10, n1, n0 );
+    Herk( LOWER, NORMAL, Base<Field>(-1), Y, Base<Field>(0), J11 );
+    MakeHermitian( LOWER, J );
+}
+
+template<typename Field>
+void FormJ( Int n0, Int n1, DistMatrix<Field>& J )
+{
+    const Int n = n0 + n1;
+    const Grid& g = J.Grid();
+    Zeros( J, n, n );
+    const Range<Int> ind0(0,n0), ind1(n0,n);
+
+    DistMatrix<Field> X(g), Y(g);
+    Uniform( X, n0, n0/2 );
+    Uniform( Y, n1, n1/2 );
+    auto J00 = J( ind0, ind0 );
+    auto J10 = J( ind1, ind0 );
+    auto J11 = J( ind1, ind1 );
+    Herk( LOWER, NORMAL, Base<Field>(1), X, Base<Field>(0), J00 );
+    Uniform( J10, n1, n0 );
+    Herk( LOWER, NORMAL, Base<Field>(-1), Y, Base<Field>(0), J11 );
+    MakeHermitian( LOWER, J );
+}
+
+template<typename Field>
+void TestSQSD( Int n0, Int n1, Int numRHS, bool print )
+{
+    typedef Base<Field> Real;
+    Output("Testing with ",TypeName<Field>());
+    PushIndent();
+    const Int n = n0 + n1;
+    const Real eps = limits::Epsilon<Real>();
+
+    Matrix<Field> J;
+    FormJ( n0, n1, J );
+    if( print )
+        Print( J, "J" );
+
+    Matrix<Field> JFact( J );
+    Matrix<Real> regCand, reg;
+    regCand.Resize( n, 1 );
+    Fill( regCand, Pow(eps,Real(0.5))*HermitianMaxNorm(LOWER,J) );
+    reg_ldl::RegularizedQSDLDL( n0, JFact, regCand, reg );
+    Int numReg = 0;
+    for( Int i=0; i<n; ++i )
+        if( reg(i) != Real(0) )
+            ++numReg;
+    Output(numReg," of ",n," pivots were regularized");
+
+    Matrix<Field> B, X;
+    Uniform( B, n, numRHS );
+    const Real BFrob = FrobeniusNorm( B );
+    for( auto uplo : { LOWER, UPPER } )
+    {
+        X = B;
+        Timer timer;
+        timer.Start();
+        SQSDSolve( n0, uplo, J, X );
+        Output("SQSDSolve: ",timer.Stop()," seconds");
+
+        Matrix<Field> R( B );
+        Hemm( LEFT, uplo, Field(-1), J, X, Field(1), R );
+        const Real relResid = FrobeniusNorm( R ) / BFrob;
+        Output("|| B - J X ||_F / || B ||_F = ",relResid);
+        if( relResid > 10*Pow(eps,Real(0.5)) )
+            LogicError("Relative residual was unacceptably high");
+    }
+    PopIndent();
+}
+
+template<typename Field>
+void TestSQSD
+( const Grid& g, Int n0, Int n1, Int numRHS, bool print )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+    const Int n = n0 + n1;
+    const Real eps = limits::Epsilon<Real>();
+
+    DistMatrix<Field> J(g);
+    FormJ( n0, n1, J );
+    if( print )
+        Print( J, "J" );
+
+    DistMatrix<Field> B(g), X(g);
+    Uniform( B, n, numRHS );
+    const Real BFrob = FrobeniusNorm( B );
+    for( auto uplo : { LOWER, UPPER } )
+    {
+        X = B;
+        Timer timer;
+        timer.Start();
+        SQSDSolve( n0, uplo, J, X );
+        OutputFromRoot(g.Comm(),"SQSDSolve: ",timer.Stop()," seconds");
+
+        DistMatrix<Field> R( B );
+        Hemm( LEFT, uplo, Field(-1), J, X, Field(1), R );
+        const Real relResid = FrobeniusNorm( R ) / BFrob;
+        OutputFromRoot
+        (g.Comm(),"|| B - J X ||_F / || B ||_F = ",relResid);
+        if( relResid > 10*Pow(eps,Real(0.5)) )
+            LogicError("Relative residual was unacceptably high");
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n0 = Input("--n0","size of the positive block",60);
+        const Int n1 = Input("--n1","size of the negative block",40);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        const Grid g( comm );
+
+        if( sequential && mpi::Rank(comm) == 0 )
+        {
+            TestSQSD<float>( n0, n1, numRHS, print );
+            TestSQSD<double>( n0, n1, numRHS, print );
+            TestSQSD<Complex<double>>( n0, n1, numRHS, print );
+        }
+        TestSQSD<float>( g, n0, n1, numRHS, print );
+        TestSQSD<double>( g, n0, n1, numRHS, print );
+        TestSQSD<Complex<double>>( g, n0, n1, numRHS, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solve against a shifted 2D Helmholtz operator with s-step GMRES, both with
+// sequential and with distributed vectors, and check the true residuals
+template<typename Field>
+void TestSStepGMRES
+( Int nx, Int ny, Base<Field> shift, Int s, Int restart, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+    typedef Base<Field> Real;
+    const Real relTol = Pow( limits::Epsilon<Real>(), Real(0.5) );
+    const Int maxIts = 10*nx*ny;
+    const Int n = nx*ny;
+    const Int numRHS = 2;
+
+    SparseMatrix<Field> A;
+    Helmholtz( A, nx, ny, Field(shift) );
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& x,
+           Field beta, Matrix<Field>& y )
+      { Multiply( NORMAL, alpha, A, x, beta, y ); };
+    auto identity = []( Matrix<Field>& ) { };
+
+    Matrix<Field> B, X;
+    Uniform( B, n, numRHS );
+    X = B;
+    const Int its =
+      SStepGMRES( applyA, identity, X, relTol, restart, maxIts, s, false );
+    Matrix<Field> R( B );
+    Multiply( NORMAL, Field(-1), A, X, Field(1), R );
+    const Real relResid = FrobeniusNorm( R ) / FrobeniusNorm( B );
+    OutputFromRoot
+    (g.Comm(),"Sequential: ",its," iterations, relative residual ",relResid);
+    if( relResid > 10*relTol )
+        LogicError("Sequential s-step GMRES residual was too large");
+
+    DistSparseMatrix<Field> ADist(g);
+    Helmholtz( ADist, nx, ny, Field(shift) );
+    auto applyADist =
+      [&]( Field alpha, const DistMultiVec<Field>& x,
+           Field beta, DistMultiVec<Field>& y )
+      { Multiply( NORMAL, alpha, ADist, x, beta, y ); };
+    auto identityDist = []( DistMultiVec<Field>& ) { };
+
+    DistMultiVec<Field> BDist(g), XDist(g);
+    Uniform( BDist, n, numRHS );
+    XDist = BDist;
+    const Int itsDist =
+      SStepGMRES
+      ( applyADist, identityDist, XDist, relTol, restart, maxIts, s, false );
+    DistMultiVec<Field> RDist( BDist );
+    Multiply( NORMAL, Field(-1), ADist, XDist, Field(1), RDist );
+    const Real relResidDist = FrobeniusNorm( RDist ) / FrobeniusNorm( BDist );
+    OutputFromRoot
+    (g.Comm(),"Distributed: ",itsDist," iterations, relative residual ",
+     relResidDist);
+    if( relResidDist > 10*relTol )
+        LogicError("Distributed s-step GMRES residual was too large");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int nx = Input("--nx","size of grid in x dimension",20);
+        const Int ny = Input("--ny","size of grid in y dimension",20);
+        const double shift = Input("--shift","shift of the operator",0.);
+        const Int s = Input("--s","number of steps per reduction",4);
+        const Int restart = Input("--restart","GMRES restart",32);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestSStepGMRES<float>( nx, ny, shift, s, restart, g );
+        TestSStepGMRES<Complex<float>>( nx, ny, shift, s, restart, g );
+        TestSStepGMRES<double>( nx, ny, shift, s, restart, g );
+        TestSStepGMRES<Complex<double>>( nx, ny, shift, s, restart, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -326,6 +326,29 @@ void TestDistributedSVD
         if( scaledResidual > Real(50) )
             LogicError("SVD residual was unacceptably large");
     }
+
+    // Compare against the singular values from a two-stage bidiagonalization
+    if( !scalapack )
+    {
+        SVDCtrl<Real> twoStageCtrl( ctrl );
+        twoStageCtrl.bidiagSVDCtrl.wantU = false;
+        twoStageCtrl.bidiagSVDCtrl.wantV = false;
+        twoStageCtrl.twoStageBidiag = true;
+        twoStageCtrl.bidiagBandwidth = 8;
+        DistMatrix<Real,STAR,STAR> sTwoStage(grid);
+        SVD( A, sTwoStage, twoStageCtrl );
+        const Int numCommon = Min(sTwoStage.Height(),numSingVals);
+        auto sTwoStageT = sTwoStage( IR(0,numCommon), ALL );
+        sTwoStageT -= s( IR(0,numCommon), ALL );
+        const Real eps = limits::Epsilon<Real>();
+        const Real twoStageError =
+          FrobeniusNorm( sTwoStageT ) / (Max(m,n)*eps*twoNormA);
+        if( commRank == 0 )
+            Output
+            ("||s - sTwoStage||_2 / (max(m,n) eps ||A||_2) = ",twoStageError);
+        if( twoStageError > Real(50) )
+            LogicError("Two-stage singular values were inaccurate");
+    }
     if( commRank == 0 )
         Output("");
 }
@@ -374,7 +397,12 @@ main( int argc, char* argv[] )
         const Int n = Input("--width","width of matrix",100);
         const Int rank = Input("--rank","rank of matrix",10);
         const Int blocksize = Input("--blocksize","algorithmic blocksize",32);
-        const Int approachInt = Input("--approach","SVD approach",0);
+        const Int approachInt =
+          Input
+          ("--approach",
+           "SVD approach (0: thin, 1: compact, 2: full, 3: product, 4: Jacobi, "
+           "5: QDWH)",
+           0);
 #ifdef EL_HAVE_SCALAPACK
         const bool scalapack = Input("--scalapack","test ScaLAPACK?",false);
         const Int mb = Input("--mb","block height",32);
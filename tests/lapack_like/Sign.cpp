@@ -0,0 +1,208 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+string MethodName( SignMethod method )
+{
+    switch( method )
+    {
+    case SIGN_NEWTON: return "Newton";
+    case SIGN_NEWTON_SCHULZ_HYBRID: return "Newton-Schulz hybrid";
+    default: return "Pade";
+    }
+}
+
+// Form A = Q diag(d) inv(Q) and its sign, Q diag(sgn(d)) inv(Q), where Q is
+// a well-conditioned perturbation of the identity and the magnitudes of the
+// eigenvalues span several orders of magnitude
+template<typename F>
+void MakeProblem( Int n, Matrix<F>& A, Matrix<F>& S )
+{
+    typedef Base<F> Real;
+    Matrix<F> Q, QInv;
+    Uniform( Q, n, n, F(0), Real(1)/Real(2*n) );
+    ShiftDiagonal( Q, F(1) );
+    QInv = Q;
+    Inverse( QInv );
+
+    Matrix<F> d, dSgn;
+    Zeros( d, n, 1 );
+    Zeros( dSgn, n, 1 );
+    for( Int i=0; i<n; ++i )
+    {
+        const Real sgn = ( i % 3 == 0 ? Real(-1) : Real(1) );
+        d(i) = sgn*Pow( Real(10), Real(4*i)/Real(n)-Real(2) );
+        dSgn(i) = sgn;
+    }
+
+    Matrix<F> Y( Q );
+    DiagonalScale( RIGHT, NORMAL, d, Y );
+    Zeros( A, n, n );
+    Gemm( NORMAL, NORMAL, F(1), Y, QInv, F(0), A );
+    Y = Q;
+    DiagonalScale( RIGHT, NORMAL, dSgn, Y );
+    Zeros( S, n, n );
+    Gemm( NORMAL, NORMAL, F(1), Y, QInv, F(0), S );
+}
+
+template<typename F>
+void TestSign( Int n, Int padeOrder, Int numSubgrids, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+
+    Matrix<F> A, S;
+    MakeProblem( n, A, S );
+    const Real frobS = FrobeniusNorm( S );
+    DistMatrix<F> ADist(g);
+    {
+        DistMatrix<F,STAR,STAR> A_STAR_STAR(g);
+        A_STAR_STAR.Resize( n, n );
+        A_STAR_STAR.Matrix() = A;
+        ADist = A_STAR_STAR;
+    }
+
+    for( const SignMethod method :
+         { SIGN_NEWTON, SIGN_NEWTON_SCHULZ_HYBRID, SIGN_PADE } )
+    {
+        SignCtrl<Real> ctrl;
+        ctrl.method = method;
+        ctrl.padeOrder = padeOrder;
+        ctrl.numSubgrids = numSubgrids;
+        const string name = MethodName( method );
+
+        Matrix<F> X( A );
+        Timer timer;
+        timer.Start();
+        Sign( X, ctrl );
+        const double seqTime = timer.Stop();
+        X -= S;
+        const Real err = FrobeniusNorm( X ) / frobS;
+
+        DistMatrix<F> XDist( ADist );
+        if( g.Rank() == 0 )
+            timer.Start();
+        Sign( XDist, ctrl );
+        const double distTime = ( g.Rank() == 0 ? timer.Stop() : 0. );
+        DistMatrix<F,STAR,STAR> X_STAR_STAR( XDist );
+        X_STAR_STAR.Matrix() -= S;
+        const Real errDist = FrobeniusNorm( X_STAR_STAR.Matrix() ) / frobS;
+
+        OutputFromRoot
+        (g.Comm(),name,": sequential error ",err," (",seqTime," secs), ",
+         "distributed error ",errDist," (",distTime," secs)");
+        if( err > Real(10)*Sqrt(eps) || errDist > Real(10)*Sqrt(eps) )
+            LogicError("The ",name," sign iteration was inaccurate");
+    }
+
+    // Lyapunov solves A X + X A^H = C through the sign of a 2n x 2n matrix
+    // and therefore inherits the default sign iteration
+    Matrix<F> ALyap, C, X;
+    Uniform( ALyap, n, n );
+    ShiftDiagonal( ALyap, F(n) );
+    Uniform( C, n, n );
+    Lyapunov( ALyap, C, X );
+    Matrix<F> E( C );
+    Gemm( NORMAL, NORMAL, F(1), ALyap, X, F(-1), E );
+    Gemm( NORMAL, ADJOINT, F(1), X, ALyap, F(1), E );
+    const Real errLyap =
+      FrobeniusNorm( E ) / (FrobeniusNorm( ALyap )*FrobeniusNorm( X ));
+    OutputFromRoot(g.Comm(),"Lyapunov relative residual: ",errLyap);
+    if( errLyap > Real(100)*n*eps )
+        LogicError("The Lyapunov solve was inaccurate");
+
+    // The Hamiltonian matrix W = [A^H, L; K, -A] of the Riccati equation
+    // X K X - A^H X - X A = L, with K = L = I, admits the structured iteration
+    const Int nHalf = n/2;
+    Matrix<F> ARicc, K, L, W, WSgn, WSgnHam;
+    Uniform( ARicc, nHalf, nHalf );
+    Identity( K, nHalf, nHalf );
+    Identity( L, nHalf, nHalf );
+    Zeros( W, 2*nHalf, 2*nHalf );
+    auto WTL = W( IR(0,nHalf), IR(0,nHalf) );
+    auto WTR = W( IR(0,nHalf), IR(nHalf,2*nHalf) );
+    auto WBL = W( IR(nHalf,2*nHalf), IR(0,nHalf) );
+    auto WBR = W( IR(nHalf,2*nHalf), IR(nHalf,2*nHalf) );
+    Adjoint( ARicc, WTL );
+    WTR = L;
+    WBL = K;
+    WBR = ARicc;
+    WBR *= -1;
+    WSgn = W;
+    Sign( WSgn );
+    WSgnHam = W;
+    HamiltonianSign( WSgnHam );
+    DistMatrix<F> WDist(g);
+    {
+        DistMatrix<F,STAR,STAR> W_STAR_STAR(g);
+        W_STAR_STAR.Resize( 2*nHalf, 2*nHalf );
+        W_STAR_STAR.Matrix() = W;
+        WDist = W_STAR_STAR;
+    }
+    HamiltonianSign( WDist );
+    DistMatrix<F,STAR,STAR> WSgnDist( WDist );
+    const Real frobSgn = FrobeniusNorm( WSgn );
+    WSgnDist.Matrix() -= WSgn;
+    WSgnHam -= WSgn;
+    const Real errHam = FrobeniusNorm( WSgnHam ) / frobSgn;
+    const Real errHamDist = FrobeniusNorm( WSgnDist.Matrix() ) / frobSgn;
+    OutputFromRoot
+    (g.Comm(),"Hamiltonian sign: sequential deviation ",errHam,
+     ", distributed deviation ",errHamDist);
+    if( errHam > Real(10)*Sqrt(eps) || errHamDist > Real(10)*Sqrt(eps) )
+        LogicError("The Hamiltonian sign iteration was inaccurate");
+
+    Riccati( LOWER, ARicc, K, L, X );
+    E = L;
+    Matrix<F> KX;
+    Gemm( NORMAL, NORMAL, F(1), K, X, KX );
+    Gemm( NORMAL, NORMAL, F(1), X, KX, F(-1), E );
+    Gemm( ADJOINT, NORMAL, F(-1), ARicc, X, F(1), E );
+    Gemm( NORMAL, NORMAL, F(-1), X, ARicc, F(1), E );
+    const Real frobX = FrobeniusNorm( X );
+    const Real errRicc =
+      FrobeniusNorm( E ) /
+      (frobX*frobX + 2*FrobeniusNorm( ARicc )*frobX + FrobeniusNorm( L ));
+    OutputFromRoot(g.Comm(),"Riccati relative residual: ",errRicc);
+    if( errRicc > Real(10)*Sqrt(eps) )
+        LogicError("The Riccati solve was inaccurate");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","matrix order",100);
+        const Int padeOrder = Input("--padeOrder","Pade order",4);
+        const Int numSubgrids =
+          Input("--numSubgrids","number of subgrids for the Pade terms",2);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestSign<float>( n, padeOrder, numSubgrids, g );
+        TestSign<Complex<float>>( n, padeOrder, numSubgrids, g );
+        TestSign<double>( n, padeOrder, numSubgrids, g );
+        TestSign<Complex<double>>( n, padeOrder, numSubgrids, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
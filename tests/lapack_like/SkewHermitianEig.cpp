@@ -0,0 +1,109 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Check that G Q = Q diag(i wImag), that Q has orthonormal columns, and that
+// the eigenvalues agree with those of the complex skew-Hermitian solver
+template<typename Real>
+void CheckEig
+( const Matrix<Real>& G,
+  const Matrix<Real>& wImag,
+  const Matrix<Complex<Real>>& Q,
+  const Matrix<Real>& wImagRef,
+  const string& msg )
+{
+    typedef Complex<Real> C;
+    const Int n = G.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real frobG = FrobeniusNorm( G );
+
+    Matrix<C> GC, E, QScaled( Q );
+    Copy( G, GC );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            QScaled(i,j) *= C(0,wImag(j));
+    E = QScaled;
+    Gemm( NORMAL, NORMAL, C(1), GC, Q, C(-1), E );
+    const Real residual = FrobeniusNorm( E ) / Max(frobG,Real(1));
+    Identity( E, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), E );
+    MakeHermitian( LOWER, E );
+    const Real orthogError = FrobeniusNorm( E );
+    Matrix<Real> wDiff( wImag );
+    wDiff -= wImagRef;
+    const Real eigError = MaxNorm( wDiff ) / Max(frobG,Real(1));
+    Output
+    (msg,": || G Q - Q diag(i w) ||_F / || G ||_F = ",residual,
+     ", || I - Q^H Q ||_F = ",orthogError,", eigenvalue error = ",eigError);
+    const Real tol = Real(100)*n*eps;
+    if( residual > tol || orthogError > tol || eigError > tol )
+        LogicError(msg," was inaccurate");
+}
+
+template<typename Real>
+void TestSkewHermitianEig( const Grid& g, Int n )
+{
+    typedef Complex<Real> C;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Real>());
+
+    // Form a random real skew-symmetric matrix
+    DistMatrix<Real> R(g), GDist(g);
+    Uniform( R, n, n );
+    Transpose( R, GDist );
+    Axpy( Real(-1), R, GDist );
+    DistMatrix<Real,STAR,STAR> G_STAR_STAR( GDist );
+    const auto& G = G_STAR_STAR.LockedMatrix();
+
+    // The eigenvalues from the (complex) Hermitian solver
+    Matrix<C> GC;
+    Copy( G, GC );
+    Matrix<Real> wImagRef;
+    SkewHermitianEig( LOWER, GC, wImagRef );
+
+    if( g.Rank() == 0 )
+    {
+        Matrix<Real> wImag;
+        Matrix<C> Q;
+        SkewHermitianEig( LOWER, G, wImag, Q );
+        CheckEig( G, wImag, Q, wImagRef, "Sequential" );
+    }
+
+    DistMatrix<Real,VR,STAR> wImagDist(g);
+    DistMatrix<C> QDist(g);
+    SkewHermitianEig( UPPER, GDist, wImagDist, QDist );
+    DistMatrix<Real,STAR,STAR> wImag_STAR_STAR( wImagDist );
+    DistMatrix<C,STAR,STAR> Q_STAR_STAR( QDist );
+    if( g.Rank() == 0 )
+        CheckEig
+        ( G, wImag_STAR_STAR.Matrix(), Q_STAR_STAR.Matrix(), wImagRef,
+          "Distributed" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","matrix order",100);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        const Grid g( mpi::COMM_WORLD );
+        TestSkewHermitianEig<float>( g, n );
+        TestSkewHermitianEig<double>( g, n );
+        OutputFromRoot(mpi::COMM_WORLD,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
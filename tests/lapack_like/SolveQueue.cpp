@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestSolveQueue
+( FactorizationType type, const string& typeName,
+  Int n, Int numRequests, const SolveQueueCtrl& ctrl )
+{
+    typedef Base<Field> Real;
+    Output("Testing ",typeName," with ",TypeName<Field>());
+    PushIndent();
+
+    Matrix<Field> A;
+    if( type == CHOLESKY_FACTORIZATION )
+        HermitianUniformSpectrum( A, n, Real(1), Real(10) );
+    else
+    {
+        Uniform( A, n, n );
+        ShiftDiagonal( A, Field(n) );
+    }
+    Factorization<Field> factorization( type, A );
+
+    vector<Matrix<Field>> BList(numRequests);
+    vector<std::future<Matrix<Field>>> futures;
+    {
+        SolveQueue<Field> queue( factorization, NORMAL, ctrl );
+        for( Int j=0; j<numRequests; ++j )
+        {
+            // Mix single vectors with the occasional small block
+            Uniform( BList[j], n, j % 7 == 0 ? 3 : 1 );
+            futures.push_back( queue.Submit(BList[j]) );
+        }
+        queue.Flush();
+        for( Int j=0; j<numRequests; ++j )
+        {
+            Matrix<Field> X = futures[j].get();
+            Matrix<Field> XDirect( BList[j] );
+            factorization.Solve( NORMAL, XDirect );
+            XDirect -= X;
+            const Real error = FrobeniusNorm(XDirect) / FrobeniusNorm(X);
+            if( error > 100*n*limits::Epsilon<Real>() )
+                LogicError
+                ("Request ",j," deviated from a direct solve by ",error);
+        }
+        const Int numBatches = queue.NumBatches();
+        Output("Solved ",queue.NumSolved()," requests in ",numBatches,
+               " batches");
+        if( queue.NumSolved() != numRequests )
+            LogicError("Expected ",numRequests," solved requests");
+        if( numRequests > 1 && numBatches >= numRequests )
+            LogicError("Right-hand sides were not aggregated");
+    }
+
+    // The destructor should drain any remaining requests
+    std::future<Matrix<Field>> future;
+    {
+        SolveQueue<Field> queue( factorization, NORMAL, ctrl );
+        future = queue.Submit( BList[0] );
+    }
+    Matrix<Field> X = future.get();
+    if( X.Height() != n || X.Width() != BList[0].Width() )
+        LogicError("Remaining request was not solved");
+
+    PopIndent();
+}
+
+template<typename Field>
+void TestSolveQueues( Int n, Int numRequests, const SolveQueueCtrl& ctrl )
+{
+    TestSolveQueue<Field>
+    ( LU_FACTORIZATION, "LU", n, numRequests, ctrl );
+    TestSolveQueue<Field>
+    ( CHOLESKY_FACTORIZATION, "Cholesky", n, numRequests, ctrl );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","matrix size",100);
+        const Int numRequests = Input("--numRequests","num. requests",200);
+        const Int maxBatchSize = Input("--maxBatchSize","max batch size",32);
+        const double maxLatency =
+          Input("--maxLatency","max latency in seconds",1.e-2);
+        ProcessInput();
+        PrintInputReport();
+
+        SolveQueueCtrl ctrl;
+        ctrl.maxBatchSize = maxBatchSize;
+        ctrl.maxLatency = maxLatency;
+
+        if( mpi::Rank() == 0 )
+        {
+            TestSolveQueues<float>( n, numRequests, ctrl );
+            TestSolveQueues<Complex<float>>( n, numRequests, ctrl );
+            TestSolveQueues<double>( n, numRequests, ctrl );
+            TestSolveQueues<Complex<double>>( n, numRequests, ctrl );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the distributed sort and selection against sorting a copy of the
+// vector on every process
+template<typename Real>
+void TestSort( const Grid& g, Int n, SortType sort )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Real>());
+    // Only a few distinct values so that there are many ties
+    DistMatrix<Real,VC,STAR> x(g);
+    Uniform( x, n, 1, Real(0), Real(4) );
+    Round( x );
+    DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
+    auto pairs = TaggedSort( x_STAR_STAR.Matrix(), sort, true );
+
+    DistPermutation sortPerm(g);
+    SortingPermutation( x, sortPerm, sort );
+    DistMatrix<Real,VC,STAR> y( x );
+    sortPerm.PermuteRows( y );
+    DistMatrix<Real> z( x );
+    Sort( z, sort );
+    for( Int i=0; i<n; ++i )
+    {
+        if( sortPerm.Preimage(i) != pairs[i].index )
+            LogicError("The sorting permutation was not stable at ",i);
+        if( y.Get(i,0) != pairs[i].value || z.Get(i,0) != pairs[i].value )
+            LogicError("The sorted vector was incorrect at ",i);
+    }
+
+    for( Int k : { Int(0), n/3, n/2, n-1 } )
+    {
+        const auto stat = OrderStatistic( x, k );
+        const auto statSeq = OrderStatistic( x_STAR_STAR.Matrix(), k );
+        if( stat.value != statSeq.value || stat.index != statSeq.index )
+            LogicError("The order statistic of rank ",k," was incorrect");
+    }
+    const auto median = Median( x );
+    if( median.value != OrderStatistic( x_STAR_STAR.Matrix(), n/2 ).value )
+        LogicError("The median was incorrect");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","length of vector",1000);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( mpi::COMM_WORLD );
+        TestSort<float>( g, n, ASCENDING );
+        TestSort<double>( g, n, DESCENDING );
+        OutputFromRoot(mpi::COMM_WORLD,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -75,21 +75,16 @@ void TestSparseDirect
     const Int rootSepSize = sparseLDLFact.NodeInfo().size;
     OutputFromRoot(grid.Comm(),rootSepSize," vertices in root separator\n");
 
+    const LDLFrontType frontType = ( intraPiv ? LDL_INTRAPIV_1D : LDL_1D );
     for( Int repeat=0; repeat<numRepeats; ++repeat )
     {
-        if( repeat != 0 )
-        {
-            sparseLDLFact.ChangeFrontType( SYMM_2D );
-            MakeFrontsUniform( sparseLDLFact.Front() );
-        }
-
         OutputFromRoot(grid.Comm(),"Running LDL^T and redistribution...");
         mpi::Barrier( grid.Comm() );
         timer.Start();
-        if( intraPiv )
-            sparseLDLFact.Factor( LDL_INTRAPIV_1D );
+        if( repeat == 0 )
+            sparseLDLFact.Factor( frontType );
         else
-            sparseLDLFact.Factor( LDL_1D );
+            sparseLDLFact.Refactor( A, frontType );
         mpi::Barrier( grid.Comm() );
         timer.Stop();
         OutputFromRoot(grid.Comm(),timer.Partial()," seconds");
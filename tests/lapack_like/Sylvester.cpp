@@ -0,0 +1,142 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Return || A X + X B - C ||_F / (( ||A||_F + ||B||_F ) ||X||_F + ||C||_F)
+template<typename F>
+Base<F> Residual
+( const Matrix<F>& A, const Matrix<F>& B, const Matrix<F>& C,
+  const Matrix<F>& X )
+{
+    Matrix<F> E( C );
+    Gemm( NORMAL, NORMAL, F(1), A, X, F(-1), E );
+    Gemm( NORMAL, NORMAL, F(1), X, B, F(1), E );
+    return FrobeniusNorm( E ) /
+      ((FrobeniusNorm(A)+FrobeniusNorm(B))*FrobeniusNorm(X) +
+       FrobeniusNorm(C));
+}
+
+template<typename F>
+void Distribute( const Matrix<F>& A, DistMatrix<F>& ADist )
+{
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( ADist.Grid() );
+    A_STAR_STAR.Resize( A.Height(), A.Width() );
+    A_STAR_STAR.Matrix() = A;
+    ADist = A_STAR_STAR;
+}
+
+template<typename F>
+void Check( const string& name, Base<F> error, Int n, const Grid& g )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),name," relative residual: ",error);
+    if( error > Real(100)*n*limits::Epsilon<Real>() )
+        LogicError(name," was inaccurate");
+}
+
+template<typename F>
+void TestSylvester( Int m, Int n, Int cutoff, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+
+    // Shift the spectra of A and B into the right-half plane so that the
+    // sign-based solver also applies
+    Matrix<F> A, B, C, X;
+    Uniform( A, m, m );
+    ShiftDiagonal( A, F(m) );
+    Uniform( B, n, n );
+    ShiftDiagonal( B, F(n) );
+    Uniform( C, m, n );
+
+    SylvesterCtrl<Real> ctrl;
+    ctrl.cutoff = cutoff;
+
+    // The triangular solver on the (quasi-)triangular Schur factors
+    Matrix<F> TA( A ), TB( B );
+    Matrix<Complex<Real>> w;
+    Schur( TA, w );
+    Schur( TB, w );
+    X = C;
+    TriangularSylvester( TA, TB, X, cutoff );
+    Check<F>( "TriangularSylvester", Residual( TA, TB, C, X ), m+n, g );
+
+    Timer timer;
+    ctrl.alg = SYLVESTER_SIGN;
+    timer.Start();
+    Sylvester( A, B, C, X, ctrl );
+    const double signTime = timer.Stop();
+    Check<F>( "Sign-based Sylvester", Residual( A, B, C, X ), m+n, g );
+
+    ctrl.alg = SYLVESTER_SCHUR;
+    timer.Start();
+    Sylvester( A, B, C, X, ctrl );
+    const double schurTime = timer.Stop();
+    Check<F>( "Schur-based Sylvester", Residual( A, B, C, X ), m+n, g );
+    OutputFromRoot
+    (g.Comm(),"Sign-based time: ",signTime," secs, Schur-based time: ",
+     schurTime," secs");
+
+    // Lyapunov with the Schur-based solver
+    Matrix<F> AAdj, CLyap;
+    Adjoint( A, AAdj );
+    Uniform( CLyap, m, m );
+    Lyapunov( A, CLyap, X, ctrl );
+    Check<F>( "Schur-based Lyapunov", Residual( A, AAdj, CLyap, X ), 2*m, g );
+
+    // The distributed Schur-based solvers
+    DistMatrix<F> ADist(g), BDist(g), CDist(g), XDist(g);
+    Distribute( A, ADist );
+    Distribute( B, BDist );
+    Distribute( C, CDist );
+    Sylvester( ADist, BDist, CDist, XDist, ctrl );
+    DistMatrix<F,STAR,STAR> X_STAR_STAR( XDist );
+    Check<F>
+    ( "Distributed Schur-based Sylvester",
+      Residual( A, B, C, X_STAR_STAR.Matrix() ), m+n, g );
+
+    DistMatrix<F> CLyapDist(g);
+    Distribute( CLyap, CLyapDist );
+    Lyapunov( ADist, CLyapDist, XDist, ctrl );
+    X_STAR_STAR = XDist;
+    Check<F>
+    ( "Distributed Schur-based Lyapunov",
+      Residual( A, AAdj, CLyap, X_STAR_STAR.Matrix() ), 2*m, g );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of X",150);
+        const Int n = Input("--n","width of X",100);
+        const Int cutoff = Input("--cutoff","recursion cutoff",16);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestSylvester<float>( m, n, cutoff, g );
+        TestSylvester<Complex<float>>( m, n, cutoff, g );
+        TestSylvester<double>( m, n, cutoff, g );
+        TestSylvester<Complex<double>>( m, n, cutoff, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -59,6 +59,7 @@ void TestQR
 ( const Grid& g,
   Int m,
   Int n,
+  const qr::TSQRCtrl& ctrl,
   bool correctness,
   bool print )
 {
@@ -78,7 +79,7 @@ void TestQR
     OutputFromRoot(g.Comm(),"Starting TSQR factorization...");
     mpi::Barrier( g.Comm() );
     timer.Start();
-    qr::ExplicitTS( AFact, R );
+    qr::ExplicitTS( AFact, R, ctrl );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double mD = double(m);
@@ -108,6 +109,10 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int tree =
+          Input("--tree","0: binary, 1: flat, 2: hybrid reduction tree",0);
+        const Int groupSize =
+          Input("--groupSize","hybrid group size (0 for the node size)",0);
         const bool correctness =
           Input("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -124,43 +129,46 @@ main( int argc, char* argv[] )
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
         const Grid g( comm, order );
         SetBlocksize( nb );
+        qr::TSQRCtrl ctrl;
+        ctrl.tree = static_cast<qr::TSQRTree>(tree);
+        ctrl.groupSize = groupSize;
         ComplainIfDebug();
         OutputFromRoot(comm,"Will test TSQR");
 
         TestQR<float>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrl, correctness, print );
         TestQR<Complex<float>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrl, correctness, print );
 
         TestQR<double>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrl, correctness, print );
         TestQR<Complex<double>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrl, correctness, print );
 
 #ifdef EL_HAVE_QD
         TestQR<DoubleDouble>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrl, correctness, print );
         TestQR<QuadDouble>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrl, correctness, print );
 
         TestQR<Complex<DoubleDouble>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrl, correctness, print );
         TestQR<Complex<QuadDouble>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrl, correctness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestQR<Quad>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrl, correctness, print );
         TestQR<Complex<Quad>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrl, correctness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestQR<BigFloat>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrl, correctness, print );
         TestQR<Complex<BigFloat>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrl, correctness, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
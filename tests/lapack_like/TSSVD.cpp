@@ -110,6 +110,72 @@ void TestSVD
     PopIndent();
 }
 
+// Stream A through StreamingTSQR in blocks of rows and then recompute U
+// during a second pass
+template<typename F>
+void TestStreamingSVD
+( const Grid& g,
+  Int m,
+  Int n,
+  Int blockHeight,
+  bool correctness,
+  bool print )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing streaming with ",TypeName<F>());
+    PushIndent();
+
+    DistMatrix<F,VC,STAR> A(g), U(g), UBlock(g);
+    DistMatrix<Base<F>,STAR,STAR> sFull(g);
+    DistMatrix<F,STAR,STAR> V(g);
+    // Since U = A V inv(Sigma) loses orthogonality in proportion to the
+    // condition number, keep A well-conditioned by making it tall
+    m = Max( m, 4*n );
+    Uniform( A, m, n );
+
+    OutputFromRoot(g.Comm(),"Starting streaming TS-SVD...");
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    svd::StreamingTSQR<F> tsqr( n, g );
+    for( Int i=0; i<m; i+=blockHeight )
+        tsqr.AddRows( A( IR(i,Min(i+blockHeight,m)), ALL ) );
+    tsqr.Finalize();
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),"First pass: ",timer.Stop()," seconds");
+    if( tsqr.Height() != m )
+        LogicError("Streamed ",tsqr.Height()," rows instead of ",m);
+
+    timer.Start();
+    U.AlignWith( A );
+    U.Resize( m, n );
+    for( Int i=0; i<m; i+=blockHeight )
+    {
+        const Range<Int> ind( i, Min(i+blockHeight,m) );
+        tsqr.LeftSingularVectors( A(ind,ALL), UBlock );
+        auto UView = U( ind, ALL );
+        UView = UBlock;
+    }
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),"Second pass: ",timer.Stop()," seconds");
+
+    // The singular values should match those of the in-memory TSQR
+    svd::TSQR( A, sFull, V );
+    const auto& s = tsqr.SingularValues();
+    auto sDiff( s );
+    sDiff -= sFull;
+    const Real eps = limits::Epsilon<Real>();
+    const Real relDiff = MaxNorm( sDiff ) / (eps*Max(m,n)*MaxNorm(s));
+    OutputFromRoot
+    (g.Comm(),"|| s - sFull ||_max / (eps Max(m,n) || s ||_max) = ",relDiff);
+    if( relDiff > Real(10) )
+        LogicError("Streamed singular values did not match");
+
+    if( correctness )
+        TestCorrectness( A, U, s, tsqr.RightSingularVectors(), print );
+    PopIndent();
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -122,6 +188,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int blockHeight =
+          Input("--blockHeight","height of streamed row blocks",37);
         const bool correctness =
           Input("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -143,6 +211,11 @@ main( int argc, char* argv[] )
         ( g, m, n, correctness, print );
         TestSVD<Complex<double>>
         ( g, m, n, correctness, print );
+
+        TestStreamingSVD<float>
+        ( g, m, n, blockHeight, correctness, print );
+        TestStreamingSVD<Complex<double>>
+        ( g, m, n, blockHeight, correctness, print );
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -0,0 +1,169 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void CheckClose
+( const Matrix<F>& A, const Matrix<F>& B, const string& name )
+{
+    Matrix<F> E( A );
+    E -= B;
+    const Base<F> tol =
+      100*Max(A.Height(),A.Width())*limits::Epsilon<Base<F>>();
+    const Base<F> relError = FrobeniusNorm(E) / Max(FrobeniusNorm(B),1);
+    if( relError > tol )
+        LogicError(name," had a relative error of ",relError);
+}
+
+void TestTaskGraph()
+{
+    // A chain of writes interleaved with independent readers must respect the
+    // inferred dependencies
+    Int x = 0;
+    vector<Int> seen( 8, -1 );
+    TaskGraph graph;
+    for( Int stage=0; stage<4; ++stage )
+    {
+        graph.Insert( [&]() { ++x; }, {}, {&x} );
+        graph.Insert( [&,stage]() { seen[2*stage] = x; }, {&x}, {} );
+        graph.Insert( [&,stage]() { seen[2*stage+1] = x; }, {&x}, {} );
+    }
+    if( graph.NumTasks() != 12 )
+        LogicError("The graph had ",graph.NumTasks()," tasks");
+    graph.Execute( 4 );
+    for( Int stage=0; stage<4; ++stage )
+        if( seen[2*stage] != stage+1 || seen[2*stage+1] != stage+1 )
+            LogicError("A reader of stage ",stage," saw the wrong value");
+    if( graph.NumTasks() != 0 )
+        LogicError("The graph was not emptied");
+
+    // Exceptions are propagated to the caller
+    graph.Insert( [](){ RuntimeError("Expected failure"); }, {}, {&x} );
+    graph.Insert( [&](){ x = -1; }, {&x}, {&x} );
+    bool threw = false;
+    try { graph.Execute( 2 ); }
+    catch( std::exception& ) { threw = true; }
+    if( !threw || x == -1 )
+        LogicError("The failure of a task was not propagated");
+}
+
+template<typename F>
+void TestTiled( Int m, Int n, const TiledCtrl& ctrl )
+{
+    OutputFromRoot(mpi::COMM_WORLD,"Testing with ",TypeName<F>());
+    typedef Base<F> Real;
+
+    // Cholesky
+    for( const auto uplo : {LOWER,UPPER} )
+    {
+        Matrix<F> A, ATiled;
+        HermitianUniformSpectrum( A, n, 1, 10 );
+        ATiled = A;
+        Cholesky( uplo, A );
+        TiledCholesky( uplo, ATiled, ctrl );
+        MakeTrapezoidal( uplo, A );
+        MakeTrapezoidal( uplo, ATiled );
+        CheckClose( ATiled, A, "TiledCholesky" );
+    }
+
+    // LU and QR of tall, square, and wide matrices
+    for( const Int width : {n/2,m,2*m} )
+    {
+        Matrix<F> A, ATiled;
+        Uniform( A, m, width );
+        ATiled = A;
+        Permutation P, PTiled;
+        LU( A, P );
+        TiledLU( ATiled, PTiled, ctrl );
+        CheckClose( ATiled, A, "TiledLU" );
+        Matrix<Int> p, pTiled;
+        P.ExplicitVector( p );
+        PTiled.ExplicitVector( pTiled );
+        p -= pTiled;
+        if( MaxNorm(p) != 0 )
+            LogicError("TiledLU chose different pivots");
+
+        Uniform( A, m, width );
+        ATiled = A;
+        Matrix<F> t, tTiled;
+        Matrix<Real> d, dTiled;
+        QR( A, t, d );
+        TiledQR( ATiled, tTiled, dTiled, ctrl );
+        CheckClose( ATiled, A, "TiledQR" );
+        CheckClose( tTiled, t, "The Householder scalars of TiledQR" );
+    }
+
+    // Herk
+    for( const auto uplo : {LOWER,UPPER} )
+    {
+        for( const auto orientation : {NORMAL,ADJOINT} )
+        {
+            Matrix<F> A, C, CTiled;
+            if( orientation == NORMAL )
+                Uniform( A, n, m );
+            else
+                Uniform( A, m, n );
+            Uniform( C, n, n );
+            CTiled = C;
+            Herk( uplo, orientation, Real(2), A, Real(-1), C );
+            TiledHerk( uplo, orientation, Real(2), A, Real(-1), CTiled, ctrl );
+            MakeTrapezoidal( uplo, C );
+            MakeTrapezoidal( uplo, CTiled );
+            CheckClose( CTiled, C, "TiledHerk" );
+        }
+    }
+
+    // Trsm
+    for( const auto side : {LEFT,RIGHT} )
+    {
+        for( const auto uplo : {LOWER,UPPER} )
+        {
+            for( const auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+            {
+                const Int k = ( side==LEFT ? m : n );
+                Matrix<F> A, B, BTiled;
+                Uniform( A, k, k );
+                ShiftDiagonal( A, F(k) );
+                Uniform( B, m, n );
+                BTiled = B;
+                Trsm( side, uplo, orientation, NON_UNIT, F(3), A, B );
+                TiledTrsm
+                ( side, uplo, orientation, NON_UNIT, F(3), A, BTiled, ctrl );
+                CheckClose( BTiled, B, "TiledTrsm" );
+            }
+        }
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--m","height of matrix",70);
+        const Int n = Input("--n","width of matrix",50);
+        const Int tileSize = Input("--tileSize","tile size",16);
+        const Int numThreads = Input("--numThreads","number of threads",4);
+        ProcessInput();
+        PrintInputReport();
+
+        TiledCtrl ctrl;
+        ctrl.tileSize = tileSize;
+        ctrl.numThreads = numThreads;
+        TestTaskGraph();
+        TestTiled<float>( m, n, ctrl );
+        TestTiled<Complex<double>>( m, n, ctrl );
+        OutputFromRoot(mpi::COMM_WORLD,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Real>
+void CheckEstimate
+( const string& name, const Real& estimate, const Real& exact,
+  const Real& relTol, mpi::Comm comm )
+{
+    const Real relError = Abs(estimate-exact) / Abs(exact);
+    OutputFromRoot
+    (comm,name,": estimate=",estimate,", exact=",exact,
+     ", relative error=",relError);
+    if( relError > relTol )
+        LogicError(name," estimate was inaccurate");
+}
+
+template<typename Field>
+void TestTraceEstimate( Int nx, Int ny, Int numProbes, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+    typedef Base<Field> Real;
+    mpi::Comm comm = g.Comm();
+    const Real relTol = Real(5)/Real(100);
+
+    // A shifted 2D Laplacian, which is HPD with spectrum in [1,9]
+    StencilOperator<Field> A
+    ( nx, ny, 1, Field(5), Field(-1), Field(-1), Field(0) );
+    const Int n = A.Height();
+
+    Matrix<Field> AFull;
+    A.Form( AFull );
+    const Real trace = RealPart(Trace( AFull ));
+    Cholesky( LOWER, AFull );
+    Real logDet = 0;
+    for( Int i=0; i<n; ++i )
+        logDet += 2*Log(RealPart(AFull(i,i)));
+
+    TraceEstimateCtrl ctrl;
+    ctrl.numProbes = numProbes;
+    for( const bool distributed : { false, true } )
+    {
+        if( distributed )
+            A.SetGrid( g );
+        const string prefix = ( distributed ? "Distributed " : "" );
+
+        ctrl.estimator = TRACE_HUTCHINSON;
+        CheckEstimate
+        (prefix+"Hutchinson trace",RealPart(TraceEstimate(A,ctrl)),trace,
+         relTol,comm);
+        ctrl.estimator = TRACE_HUTCH_PLUS_PLUS;
+        CheckEstimate
+        (prefix+"Hutch++ trace",RealPart(TraceEstimate(A,ctrl)),trace,
+         relTol,comm);
+        CheckEstimate
+        (prefix+"Log-determinant",HPDLogDetEstimate(A,ctrl),logDet,
+         relTol,comm);
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int nx = Input("--nx","size of grid in x dimension",30);
+        const Int ny = Input("--ny","size of grid in y dimension",30);
+        const Int numProbes = Input("--numProbes","number of probes",30);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestTraceEstimate<float>( nx, ny, numProbes, g );
+        TestTraceEstimate<Complex<float>>( nx, ny, numProbes, g );
+        TestTraceEstimate<double>( nx, ny, numProbes, g );
+        TestTraceEstimate<Complex<double>>( nx, ny, numProbes, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Since Q is never formed, the factorization is checked through
+// || A^H A - R^H R ||_F / ||A||_F^2
+template<typename Field>
+void TestCorrectness
+( const string& label,
+  const DistMatrix<Field>& A,
+  const UpdatableQR<Field>& qr,
+  bool print )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = A.Grid();
+    const Int m = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    if( qr.Height() != m || qr.Width() != A.Width() )
+        LogicError("Factorization dimensions do not match A");
+    if( print )
+        Print( qr.R(), label+": R" );
+
+    DistMatrix<Field> E(grid);
+    Herk( UPPER, ADJOINT, Real(1), A, E );
+    Herk( UPPER, ADJOINT, Real(-1), qr.R(), Real(1), E );
+    MakeHermitian( UPPER, E );
+    const Real frobA = FrobeniusNorm( A );
+    const Real relError = FrobeniusNorm( E ) / (frobA*frobA);
+    OutputFromRoot
+    (grid.Comm(),label,": ||A^H A - R^H R||_F / ||A||_F^2 = ",relError);
+
+    // TODO: A more refined failure condition
+    if( relError > Real(10)*m*eps )
+        LogicError("Relative error was unacceptably high");
+}
+
+template<typename Field>
+void TestUpdatableQR
+( const Grid& grid,
+  Int m,
+  Int n,
+  Int k,
+  bool print )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> A(grid), W(grid), C(grid), B(grid), X(grid);
+    Gaussian( A, m, n );
+    UpdatableQR<Field> qr( grid );
+    qr.Initialize( A );
+    TestCorrectness( "Initialize", A, qr, print );
+
+    // Append k rows and then remove them again
+    Gaussian( W, k, n );
+    qr.AddRows( W );
+    {
+        DistMatrix<Field> AExt(grid);
+        Zeros( AExt, m+k, n );
+        auto AExtT = AExt( IR(0,m), ALL );
+        auto AExtB = AExt( IR(m,m+k), ALL );
+        AExtT = A;
+        AExtB = W;
+        TestCorrectness( "AddRows", AExt, qr, print );
+    }
+    qr.RemoveRows( W );
+    TestCorrectness( "RemoveRows", A, qr, print );
+
+    // Append k columns
+    Gaussian( C, m, k );
+    qr.AddColumns( A, C );
+    {
+        DistMatrix<Field> AExt(grid);
+        Zeros( AExt, m, n+k );
+        auto AExtL = AExt( ALL, IR(0,n) );
+        auto AExtR = AExt( ALL, IR(n,n+k) );
+        AExtL = A;
+        AExtR = C;
+        A = AExt;
+    }
+    TestCorrectness( "AddColumns", A, qr, print );
+
+    // Delete k columns starting from the middle
+    const Int j = n/2;
+    qr.DeleteColumns( j, k );
+    {
+        DistMatrix<Field> AExt(grid);
+        Zeros( AExt, m, n );
+        auto AExtL = AExt( ALL, IR(0,j) );
+        auto AExtR = AExt( ALL, IR(j,n) );
+        AExtL = A( ALL, IR(0,j) );
+        AExtR = A( ALL, IR(j+k,n+k) );
+        A = AExt;
+    }
+    TestCorrectness( "DeleteColumns", A, qr, print );
+
+    // Check the least squares residual is orthogonal to the columns of A
+    typedef Base<Field> Real;
+    Gaussian( B, m, 1 );
+    qr.LeastSquares( A, B, X );
+    Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), B );
+    DistMatrix<Field> Z(grid);
+    Gemm( ADJOINT, NORMAL, Field(1), A, B, Z );
+    const Real frobA = FrobeniusNorm( A );
+    const Real relOrth =
+      FrobeniusNorm( Z ) / (frobA*FrobeniusNorm( B )*limits::Epsilon<Real>());
+    OutputFromRoot
+    (grid.Comm(),"||A^H (B - A X)||_F / (eps ||A||_F ||B - A X||_F) = ",
+     relOrth);
+    if( relOrth > Real(10)*m )
+        LogicError("Least squares residual was not orthogonal to A");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","process grid height",0);
+        const Int m = Input("--height","height of matrix",200);
+        const Int n = Input("--width","width of matrix",50);
+        const Int k = Input("--numUpdates","number of rows/columns",5);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid grid( comm, gridHeight );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        TestUpdatableQR<float>( grid, m, n, k, print );
+        TestUpdatableQR<Complex<float>>( grid, m, n, k, print );
+        TestUpdatableQR<double>( grid, m, n, k, print );
+        TestUpdatableQR<Complex<double>>( grid, m, n, k, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}